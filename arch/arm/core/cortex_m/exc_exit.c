@@ -68,4 +68,9 @@ Z_GENERIC_SECTION(.text._HandlerModeExit) void z_arm_exc_exit(void)
 #ifdef CONFIG_STACK_SENTINEL
 	z_check_stack_sentinel();
 #endif /* CONFIG_STACK_SENTINEL */
+
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+	/* Threads run on the process stack, PSP is the one of the interrupted thread */
+	z_thread_stack_watermark_update(_kernel.cpus->current, __get_PSP());
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
 }
@@ -279,3 +279,17 @@ ISR_DIRECT_DECLARE(z_arm_irq_direct_dynamic_dispatch_no_reschedule)
 #endif /* CONFIG_DYNAMIC_DIRECT_INTERRUPTS */
 
 #endif /* CONFIG_DYNAMIC_INTERRUPTS */
+
+#if defined(CONFIG_ARCH_HAS_IRQ_INTERRUPTED_PC)
+uintptr_t arch_irq_interrupted_pc(void)
+{
+	/* With no other exception active, the current one preempted a thread,
+	 * which runs on PSP with the PC stored in its basic stack frame.
+	 */
+	if ((SCB->ICSR & SCB_ICSR_RETTOBASE_Msk) == 0U) {
+		return 0;
+	}
+
+	return ((uint32_t *)__get_PSP())[6];
+}
+#endif /* CONFIG_ARCH_HAS_IRQ_INTERRUPTED_PC */
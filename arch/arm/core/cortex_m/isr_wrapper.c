@@ -17,6 +17,7 @@
 #include <zephyr/irq.h>
 #include <zephyr/pm/pm.h>
 #include <cmsis_core.h>
+#include <ksched.h>
 
 /**
  *
@@ -74,8 +75,17 @@ void _isr_wrapper(void)
 	irq_number -= 16;
 
 	struct _isr_table_entry *entry = &_sw_isr_table[irq_number];
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ISR
+	uint32_t usage_start = z_sched_usage_isr_enter();
+#endif /* CONFIG_SCHED_THREAD_USAGE_ISR */
+
 	(entry->isr)(entry->arg);
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_ISR
+	z_sched_usage_isr_exit(irq_number, usage_start);
+#endif /* CONFIG_SCHED_THREAD_USAGE_ISR */
+
 #if defined(CONFIG_ARM_CUSTOM_INTERRUPT_CONTROLLER)
 	z_soc_irq_eoi(irq_number);
 #endif
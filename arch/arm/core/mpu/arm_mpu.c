@@ -324,6 +324,12 @@ void arm_core_mpu_mem_partition_config_update(
 	/* Modify the permissions */
 	partition->attr = *new_attr;
 	mpu_configure_region(reg_index, partition);
+
+#if defined(CONFIG_CPU_HAS_ARM_MPU) && !defined(CONFIG_MPU_GAP_FILLING) && \
+	(defined(CONFIG_ARMV8_M_BASELINE) || defined(CONFIG_ARMV8_M_MAINLINE))
+	/* The region no longer matches the image last programmed */
+	dyn_region_image_valid = false;
+#endif
 }
 
 /**
@@ -8,6 +8,8 @@
 #ifndef ZEPHYR_ARCH_ARM_CORE_AARCH32_MPU_ARM_MPU_V8_INTERNAL_H_
 #define ZEPHYR_ARCH_ARM_CORE_AARCH32_MPU_ARM_MPU_V8_INTERNAL_H_
 
+#include <string.h>
+
 #include <cortex_m/cmse.h>
 #define LOG_LEVEL CONFIG_MPU_LOG_LEVEL
 #include <zephyr/logging/log.h>
@@ -30,6 +32,21 @@ struct dynamic_region_info {
  * regions may be configured.
  */
 static struct dynamic_region_info dyn_reg_info[MPU_DYNAMIC_REGION_AREAS_NUM];
+
+#if !defined(CONFIG_MPU_GAP_FILLING)
+/* ARMv8-M MPUs implement up to 16 regions per security state. */
+#define MPU_IMAGE_MAX_REGIONS 16
+
+/**
+ * Image of the MPU region registers as last programmed for the dynamic
+ * regions, indexed by MPU region. A disabled region has a zero RLAR. It
+ * lets a context switch only write the regions that change, which are
+ * none between threads sharing a memory domain, by the same stack
+ * regions.
+ */
+static ARM_MPU_Region_t dyn_region_image[MPU_IMAGE_MAX_REGIONS];
+static bool dyn_region_image_valid;
+#endif /* !CONFIG_MPU_GAP_FILLING */
 #if defined(CONFIG_CPU_CORTEX_M23) || defined(CONFIG_CPU_CORTEX_M33) || \
 	defined(CONFIG_CPU_CORTEX_M55) || defined(CONFIG_CPU_CORTEX_M85)
 static inline void mpu_set_mair0(uint32_t mair0)
@@ -155,6 +172,21 @@ static void mpu_set_region(uint32_t rnr, uint32_t rbar, uint32_t rlar)
  * Note:
  *   The caller must provide a valid region index.
  */
+static inline uint32_t region_conf_rbar(const struct arm_mpu_region *region_conf)
+{
+	return (region_conf->base & MPU_RBAR_BASE_Msk)
+		| (region_conf->attr.rbar &
+			(MPU_RBAR_XN_Msk | MPU_RBAR_AP_Msk | MPU_RBAR_SH_Msk));
+}
+
+static inline uint32_t region_conf_rlar(const struct arm_mpu_region *region_conf)
+{
+	return (region_conf->attr.r_limit & MPU_RLAR_LIMIT_Msk)
+		| ((region_conf->attr.mair_idx << MPU_RLAR_AttrIndx_Pos)
+			& MPU_RLAR_AttrIndx_Msk)
+		| MPU_RLAR_EN_Msk;
+}
+
 static void region_init(const uint32_t index,
 	const struct arm_mpu_region *region_conf)
 {
@@ -162,14 +194,9 @@ static void region_init(const uint32_t index,
 		/* RNR */
 		index,
 		/* RBAR */
-		(region_conf->base & MPU_RBAR_BASE_Msk)
-		| (region_conf->attr.rbar &
-			(MPU_RBAR_XN_Msk | MPU_RBAR_AP_Msk | MPU_RBAR_SH_Msk)),
+		region_conf_rbar(region_conf),
 		/* RLAR */
-		(region_conf->attr.r_limit & MPU_RLAR_LIMIT_Msk)
-		| ((region_conf->attr.mair_idx << MPU_RLAR_AttrIndx_Pos)
-			& MPU_RLAR_AttrIndx_Msk)
-		| MPU_RLAR_EN_Msk
+		region_conf_rlar(region_conf)
 	);
 
 	LOG_DBG("[%d] 0x%08x 0x%08x 0x%08x 0x%08x",
@@ -723,6 +750,94 @@ static inline uint8_t get_num_regions(void)
 	return mpu_get_num_regions();
 }
 
+#if !defined(CONFIG_MPU_GAP_FILLING)
+/* This internal function fills in the MPU register image of a set of
+ * dynamic regions, starting at the first MPU region not used by the
+ * static regions. The remaining regions of the image are disabled.
+ *
+ * It returns the number of MPU region indices configured, or -EINVAL.
+ */
+static int mpu_dynamic_region_image_build(ARM_MPU_Region_t image[],
+	const struct z_arm_mpu_partition regions[], uint8_t regions_num)
+{
+	int reg_index = static_regions_num;
+	struct arm_mpu_region region_conf;
+
+	(void)memset(image, 0, sizeof(ARM_MPU_Region_t) * MPU_IMAGE_MAX_REGIONS);
+
+	for (int i = 0; i < regions_num; i++) {
+		if (regions[i].size == 0U) {
+			continue;
+		}
+
+		if (!mpu_partition_is_valid(&regions[i])) {
+			LOG_ERR("Partition %u: sanity check failed.", i);
+			return -EINVAL;
+		}
+
+		if (reg_index >= get_num_regions()) {
+			LOG_ERR("Failed to allocate new MPU region %u\n", reg_index);
+			return -EINVAL;
+		}
+
+		region_conf.base = regions[i].start;
+		get_region_attr_from_mpu_partition_info(&region_conf.attr,
+			&regions[i].attr, regions[i].start, regions[i].size);
+
+		image[reg_index].RBAR = region_conf_rbar(&region_conf);
+		image[reg_index].RLAR = region_conf_rlar(&region_conf);
+		reg_index++;
+	}
+
+	return reg_index;
+}
+
+/* This internal function programs the MPU regions of an image which
+ * differ from the last programmed image, with a single bulk load. The MPU
+ * is disabled meanwhile, so that no partially written region overlaps
+ * another one.
+ */
+static void mpu_dynamic_region_image_load(const ARM_MPU_Region_t image[])
+{
+	int first = -1;
+	int last = -1;
+	uint32_t ctrl;
+
+	for (int i = static_regions_num; i < get_num_regions(); i++) {
+		if (dyn_region_image_valid &&
+		    (image[i].RBAR == dyn_region_image[i].RBAR) &&
+		    (image[i].RLAR == dyn_region_image[i].RLAR)) {
+			continue;
+		}
+
+		if (first < 0) {
+			first = i;
+		}
+		last = i;
+	}
+
+	if (first < 0) {
+		/* Nothing changed */
+		return;
+	}
+
+	ctrl = MPU->CTRL;
+	barrier_dmem_fence_full();
+	MPU->CTRL = 0;
+	barrier_dsync_fence_full();
+	barrier_isync_fence_full();
+
+	ARM_MPU_Load(first, &image[first], last - first + 1);
+	(void)memcpy(&dyn_region_image[first], &image[first],
+		     sizeof(ARM_MPU_Region_t) * (last - first + 1));
+	dyn_region_image_valid = true;
+
+	MPU->CTRL = ctrl;
+	barrier_dsync_fence_full();
+	barrier_isync_fence_full();
+}
+#endif /* !CONFIG_MPU_GAP_FILLING */
+
 /* This internal function programs the dynamic MPU regions.
  *
  * It returns the number of MPU region indices configured.
@@ -736,12 +851,12 @@ static int mpu_configure_dynamic_mpu_regions(const struct z_arm_mpu_partition
 {
 	int mpu_reg_index = static_regions_num;
 
+#if defined(CONFIG_MPU_GAP_FILLING)
 	/* Disable all MPU regions except for the static ones. */
 	for (int i = mpu_reg_index; i < get_num_regions(); i++) {
 		mpu_clear_region(i);
 	}
 
-#if defined(CONFIG_MPU_GAP_FILLING)
 	/* Reset MPU regions inside which dynamic memory regions may
 	 * be programmed.
 	 */
@@ -760,10 +875,34 @@ static int mpu_configure_dynamic_mpu_regions(const struct z_arm_mpu_partition
 
 	/* We are going to skip the full partition of the background areas.
 	 * So we can disable MPU regions inside which dynamic memory regions
-	 * may be programmed.
+	 * may be programmed. They stay disabled once the first image has
+	 * been loaded.
 	 */
-	for (int i = 0; i < MPU_DYNAMIC_REGION_AREAS_NUM; i++) {
-		mpu_clear_region(dyn_reg_info[i].index);
+	if (!dyn_region_image_valid) {
+		for (int i = 0; i < MPU_DYNAMIC_REGION_AREAS_NUM; i++) {
+			mpu_clear_region(dyn_reg_info[i].index);
+		}
+	}
+
+	if (get_num_regions() <= MPU_IMAGE_MAX_REGIONS) {
+		ARM_MPU_Region_t image[MPU_IMAGE_MAX_REGIONS];
+
+		/* The dynamic regions are now programmed on top of
+		 * existing SRAM region configuration, only writing
+		 * the regions which changed.
+		 */
+		mpu_reg_index = mpu_dynamic_region_image_build(image,
+			dynamic_regions, regions_num);
+		if (mpu_reg_index != -EINVAL) {
+			mpu_dynamic_region_image_load(image);
+		}
+
+		return mpu_reg_index;
+	}
+
+	/* Disable all MPU regions except for the static ones. */
+	for (int i = mpu_reg_index; i < get_num_regions(); i++) {
+		mpu_clear_region(i);
 	}
 
 	/* The dynamic regions are now programmed on top of
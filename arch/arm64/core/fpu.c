@@ -60,6 +60,15 @@ static inline void DBG(char *msg, struct k_thread *t) { }
 
 #endif /* FPU_DEBUG */
 
+/*
+ * Number of times the FPU context of a thread that trapped on FPU access
+ * is restored as soon as it runs again, rather than on its next trap.
+ * Unlike RISC-V, there is no dirty state telling whether the thread still
+ * uses the FPU, so it is given access for a few runs, and has to trap again
+ * to show it still needs it once they are over.
+ */
+#define FPU_RECLAIMS 3
+
 /*
  * Flush FPU content and disable access.
  * This is called locally and also from flush_fpu_ipi_handler().
@@ -269,6 +278,31 @@ void z_arm64_fpu_trap(struct arch_esf *esf)
 	/* restore our content */
 	z_arm64_fpu_restore(&_current->arch.saved_fp_context);
 	DBG("restore", _current);
+
+	/* this thread is using the FPU, avoid its next traps */
+	_current->arch.fpu_reclaims = FPU_RECLAIMS;
+}
+
+/*
+ * Claim the FPU back for the current thread, which made use of it
+ * but lost it to another thread in the mean time, to avoid the likely
+ * exception trap to come otherwise.
+ */
+static void fpu_reclaim(void)
+{
+	arch_flush_local_fpu();
+#ifdef CONFIG_SMP
+	flush_owned_fpu(_current);
+#endif
+
+	/* turn on FPU access */
+	write_cpacr_el1(read_cpacr_el1() | CPACR_EL1_FPEN_NOTRAP);
+	barrier_isync_fence_full();
+
+	/* become new owner and restore our content */
+	atomic_ptr_set(&_current_cpu->arch.fpu_owner, _current);
+	z_arm64_fpu_restore(&_current->arch.saved_fp_context);
+	DBG("reclaim", _current);
 }
 
 /*
@@ -290,6 +324,10 @@ static void fpu_access_update(unsigned int exc_update_level)
 		if (atomic_ptr_get(&_current_cpu->arch.fpu_owner) == _current) {
 			/* turn on FPU access */
 			write_cpacr_el1(cpacr | CPACR_EL1_FPEN_NOTRAP);
+		} else if (_current->arch.fpu_reclaims > 0) {
+			_current->arch.fpu_reclaims--;
+			/* leaves FPU access on */
+			fpu_reclaim();
 		} else {
 			/* deny FPU access */
 			write_cpacr_el1(cpacr & ~CPACR_EL1_FPEN_NOTRAP);
@@ -68,3 +68,20 @@ int arch_irq_disconnect_dynamic(unsigned int irq, unsigned int priority,
 }
 #endif /* CONFIG_SHARED_INTERRUPTS */
 #endif /* CONFIG_DYNAMIC_INTERRUPTS */
+
+uintptr_t arch_irq_interrupted_pc(void)
+{
+	const struct arch_esf *esf;
+
+	if (_current_cpu->nested != 1U) {
+		return 0;
+	}
+
+	/* On the first interrupt level, _isr_wrapper saves the stack pointer
+	 * of the thread, pointing to its exception stack frame, at the top of
+	 * the interrupt stack.
+	 */
+	esf = *((const struct arch_esf **)(_current_cpu->irq_stack - 16));
+
+	return esf->mepc;
+}
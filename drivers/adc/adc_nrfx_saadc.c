@@ -78,6 +78,18 @@ static uint16_t adc_samples_buffer[SAADC_CH_NUM] SAADC_MEMORY_SECTION;
 
 #endif /* CONFIG_SOC_NRF54H20 */
 
+/* Streams sample a single channel with the sample rate timer of the SAADC,
+ * directly into the buffers of the RTIO requests.
+ */
+#if defined(CONFIG_ADC_STREAM) && defined(SAADC_SAMPLERATE_MODE_Msk) && \
+	!defined(ADC_BUFFER_IN_RAM)
+#define SAADC_STREAM
+/* Sample rate timer runs at 16 MHz */
+#define SAADC_STREAM_CC_PER_US 16U
+#define SAADC_STREAM_CC_MIN 80U
+#define SAADC_STREAM_CC_MAX 2047U
+#endif
+
 struct driver_data {
 	struct adc_context ctx;
 
@@ -88,6 +100,16 @@ struct driver_data {
 	void *user_buffer;
 	uint8_t active_channels;
 #endif
+
+#if defined(SAADC_STREAM)
+	/* Request being filled, and the one queued to be filled next */
+	struct rtio_iodev_sqe *stream_sqe;
+	struct rtio_iodev_sqe *stream_next;
+	/* The buffer of stream_sqe was latched, the next one can be set */
+	bool stream_started;
+	/* The sample rate timer is running */
+	bool stream_sampling;
+#endif
 };
 
 static struct driver_data m_data = {
@@ -432,8 +454,8 @@ static int check_buffer_size(const struct adc_sequence *sequence,
 	return 0;
 }
 
-static int start_read(const struct device *dev,
-		      const struct adc_sequence *sequence)
+static int prepare_sequence(const struct adc_sequence *sequence,
+			    uint8_t *p_active_channels)
 {
 	int error;
 	uint32_t selected_channels = sequence->channels;
@@ -510,6 +532,22 @@ static int start_read(const struct device *dev,
 		return error;
 	}
 
+	*p_active_channels = active_channels;
+
+	return 0;
+}
+
+static int start_read(const struct device *dev,
+		      const struct adc_sequence *sequence)
+{
+	int error;
+	uint8_t active_channels;
+
+	error = prepare_sequence(sequence, &active_channels);
+	if (error) {
+		return error;
+	}
+
 #if defined(ADC_BUFFER_IN_RAM)
 	m_data.user_buffer = sequence->buffer;
 	m_data.active_channels = active_channels;
@@ -559,8 +597,161 @@ static int adc_nrfx_read_async(const struct device *dev,
 }
 #endif /* CONFIG_ADC_ASYNC */
 
+#if defined(SAADC_STREAM)
+static void stream_stop(void)
+{
+	nrf_saadc_task_trigger(NRF_SAADC, NRF_SAADC_TASK_STOP);
+	nrf_saadc_int_disable(NRF_SAADC, NRF_SAADC_INT_STARTED);
+	nrf_saadc_continuous_mode_disable(NRF_SAADC);
+	nrf_saadc_disable(NRF_SAADC);
+
+	m_data.stream_sqe = NULL;
+	m_data.stream_started = false;
+	m_data.stream_sampling = false;
+
+	k_sem_give(&m_data.ctx.lock);
+}
+
+static int stream_start(struct rtio_iodev_sqe *iodev_sqe, uint32_t cc)
+{
+	const struct adc_stream_config *cfg = iodev_sqe->sqe.iodev->data;
+	const struct adc_sequence sequence = {
+		.channels = cfg->channels,
+		.buffer = iodev_sqe->sqe.buf,
+		.buffer_size = iodev_sqe->sqe.buf_len,
+		.resolution = cfg->resolution,
+	};
+	uint8_t active_channels;
+	int error;
+
+	/* Regular reads and streams exclude each other */
+	if (k_sem_take(&m_data.ctx.lock, K_NO_WAIT) != 0) {
+		return -EBUSY;
+	}
+
+	error = prepare_sequence(&sequence, &active_channels);
+	if (error) {
+		k_sem_give(&m_data.ctx.lock);
+		return error;
+	}
+
+	nrf_saadc_buffer_init(NRF_SAADC, (nrf_saadc_value_t *)sequence.buffer,
+			      cfg->batch);
+	nrf_saadc_continuous_mode_enable(NRF_SAADC, cc);
+
+	m_data.stream_sqe = iodev_sqe;
+	m_data.stream_started = false;
+	m_data.stream_sampling = false;
+
+	nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_STARTED);
+	nrf_saadc_int_enable(NRF_SAADC, NRF_SAADC_INT_STARTED);
+	nrf_saadc_enable(NRF_SAADC);
+	nrf_saadc_task_trigger(NRF_SAADC, NRF_SAADC_TASK_START);
+
+	return 0;
+}
+
+/* Implementation of the ADC driver API function: submit. */
+static void adc_nrfx_submit(const struct device *dev,
+			    struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct adc_stream_config *cfg = iodev_sqe->sqe.iodev->data;
+	const struct adc_sequence sequence = {
+		.resolution = cfg->resolution,
+	};
+	uint32_t cc = cfg->interval_us * SAADC_STREAM_CC_PER_US;
+	uint32_t buf_len = samples_to_bytes(&sequence, cfg->batch);
+	unsigned int key;
+	uint8_t *buf;
+	int error;
+
+	/* The sample rate timer only samples a single channel, and only
+	 * at rates it can reach, leave the rest to adc_read()
+	 */
+	if (POPCOUNT(cfg->channels) != 1 || cfg->oversampling != 0U ||
+	    cfg->interval_us > SAADC_STREAM_CC_MAX / SAADC_STREAM_CC_PER_US ||
+	    cc < SAADC_STREAM_CC_MIN) {
+		adc_stream_submit_fallback(dev, iodev_sqe);
+		return;
+	}
+
+	error = rtio_sqe_rx_buf(iodev_sqe, buf_len, buf_len, &buf, &buf_len);
+	if (error) {
+		rtio_iodev_sqe_err(iodev_sqe, error);
+		return;
+	}
+
+	key = irq_lock();
+
+	if (m_data.stream_sqe == NULL) {
+		error = stream_start(iodev_sqe, cc);
+	} else if (m_data.stream_next == NULL) {
+		/* Queue the buffer after the current one */
+		m_data.stream_next = iodev_sqe;
+		if (m_data.stream_started) {
+			nrfy_saadc_buffer_pointer_set(NRF_SAADC,
+						      (nrf_saadc_value_t *)buf);
+		}
+	} else {
+		error = -EBUSY;
+	}
+
+	irq_unlock(key);
+
+	if (error) {
+		rtio_iodev_sqe_err(iodev_sqe, error);
+	}
+}
+
+static void stream_irq_handler(void)
+{
+	struct rtio_iodev_sqe *done;
+
+	if (nrf_saadc_event_check(NRF_SAADC, NRF_SAADC_EVENT_STARTED)) {
+		nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_STARTED);
+
+		m_data.stream_started = true;
+		if (!m_data.stream_sampling) {
+			m_data.stream_sampling = true;
+			nrf_saadc_task_trigger(NRF_SAADC, NRF_SAADC_TASK_SAMPLE);
+		}
+		if (m_data.stream_next != NULL) {
+			nrfy_saadc_buffer_pointer_set(NRF_SAADC,
+				(nrf_saadc_value_t *)m_data.stream_next->sqe.buf);
+		}
+	}
+
+	if (nrf_saadc_event_check(NRF_SAADC, NRF_SAADC_EVENT_END)) {
+		nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_END);
+
+		done = m_data.stream_sqe;
+		m_data.stream_started = false;
+
+		if (m_data.stream_next != NULL) {
+			/* The next buffer was latched, keep sampling */
+			m_data.stream_sqe = m_data.stream_next;
+			m_data.stream_next = NULL;
+			nrf_saadc_task_trigger(NRF_SAADC, NRF_SAADC_TASK_START);
+		} else {
+			/* Canceled, or no buffer was queued in time */
+			stream_stop();
+		}
+
+		/* A multishot request is resubmitted from here */
+		rtio_iodev_sqe_ok(done, 0);
+	}
+}
+#endif /* SAADC_STREAM */
+
 static void saadc_irq_handler(const struct device *dev)
 {
+#if defined(SAADC_STREAM)
+	if (m_data.stream_sqe != NULL) {
+		stream_irq_handler();
+		return;
+	}
+#endif
+
 	if (nrf_saadc_event_check(NRF_SAADC, NRF_SAADC_EVENT_END)) {
 		nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_END);
 
@@ -610,6 +801,9 @@ static const struct adc_driver_api adc_nrfx_driver_api = {
 #ifdef CONFIG_ADC_ASYNC
 	.read_async    = adc_nrfx_read_async,
 #endif
+#if defined(SAADC_STREAM)
+	.submit        = adc_nrfx_submit,
+#endif
 #if defined(CONFIG_SOC_NRF54L15)
 	.ref_internal  = 900,
 #elif defined(CONFIG_SOC_NRF54H20)
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/drivers/adc.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/sys/mpsc_lockfree.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(adc_stream, CONFIG_ADC_LOG_LEVEL);
+
+static void adc_stream_work_handler(struct k_work *work);
+
+/* Batches of the drivers without native streaming, sampled in order */
+static struct mpsc adc_stream_queue = MPSC_INIT(adc_stream_queue);
+static K_WORK_DEFINE(adc_stream_work, adc_stream_work_handler);
+
+static void adc_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct adc_stream_config *cfg = iodev_sqe->sqe.iodev->data;
+	const struct device *dev = cfg->adc;
+	const struct adc_driver_api *api = dev->api;
+
+	if (iodev_sqe->sqe.op != RTIO_OP_RX || cfg->batch == 0U) {
+		rtio_iodev_sqe_err(iodev_sqe, -EINVAL);
+		return;
+	}
+
+	if (api->submit != NULL) {
+		api->submit(dev, iodev_sqe);
+	} else {
+		adc_stream_submit_fallback(dev, iodev_sqe);
+	}
+}
+
+const struct rtio_iodev_api __adc_iodev_api = {
+	.submit = adc_iodev_submit,
+};
+
+void adc_stream_submit_fallback(const struct device *dev,
+				struct rtio_iodev_sqe *iodev_sqe)
+{
+	ARG_UNUSED(dev);
+
+	/* adc_read() blocks, and submissions may come from an interrupt */
+	mpsc_push(&adc_stream_queue, &iodev_sqe->q);
+	k_work_submit(&adc_stream_work);
+}
+
+static void adc_stream_read(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct adc_stream_config *cfg = iodev_sqe->sqe.iodev->data;
+	uint32_t min_buf_len = adc_stream_buffer_size(cfg);
+	uint32_t buf_len;
+	uint8_t *buf;
+	int ret;
+
+	ret = rtio_sqe_rx_buf(iodev_sqe, min_buf_len, min_buf_len, &buf, &buf_len);
+	if (ret < 0) {
+		LOG_ERR("Failed to get a %u bytes buffer (%d)", min_buf_len, ret);
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+		return;
+	}
+
+	const struct adc_sequence_options options = {
+		.interval_us = cfg->interval_us,
+		.extra_samplings = cfg->batch - 1U,
+	};
+	const struct adc_sequence sequence = {
+		.options = &options,
+		.channels = cfg->channels,
+		.buffer = buf,
+		.buffer_size = buf_len,
+		.resolution = cfg->resolution,
+		.oversampling = cfg->oversampling,
+	};
+
+	ret = adc_read(cfg->adc, &sequence);
+	if (ret < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+		return;
+	}
+
+	rtio_iodev_sqe_ok(iodev_sqe, 0);
+}
+
+static void adc_stream_work_handler(struct k_work *work)
+{
+	struct mpsc_node *node = mpsc_pop(&adc_stream_queue);
+
+	if (node == NULL) {
+		return;
+	}
+
+	/* Completing a stream batch queues its next one right away: sample
+	 * one batch per run to leave the work queue to others in between.
+	 */
+	adc_stream_read(CONTAINER_OF(node, struct rtio_iodev_sqe, q));
+	k_work_submit(work);
+}
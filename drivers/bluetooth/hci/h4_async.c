@@ -0,0 +1,611 @@
+/* h4_async.c - H:4 UART based Bluetooth driver using the UART async API */
+
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * The UART receives in a ring of DMA buffers, each given to the UART when it
+ * asks for the next one, and parsed by the RX thread as chunks of it are
+ * reported. A buffer goes back to the ring once released by the UART and
+ * fully parsed. When the RX thread lags, reception stops with the last
+ * buffer, flow control holding the controller, and resumes once a buffer
+ * is parsed.
+ *
+ * The queued packets are copied, with their H:4 type, to a TX buffer sent in
+ * a single transfer.
+ */
+
+#include <errno.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/byteorder.h>
+
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/hci.h>
+#include <zephyr/drivers/bluetooth.h>
+
+#define LOG_LEVEL CONFIG_BT_HCI_DRIVER_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(bt_driver);
+
+#include "common/bt_str.h"
+
+#include "../util.h"
+
+#define DT_DRV_COMPAT zephyr_bt_hci_uart
+
+#define RX_BUF_COUNT CONFIG_BT_H4_ASYNC_RX_BUF_COUNT
+#define RX_BUF_SIZE  CONFIG_BT_H4_ASYNC_RX_BUF_SIZE
+#define TX_BUF_SIZE  CONFIG_BT_H4_ASYNC_TX_BUF_SIZE
+
+/* TX transfer in progress */
+#define TX_BUSY 0
+
+struct h4_rx_buf {
+	uint8_t *data;
+	/* Bytes received, updated by the UART callback */
+	size_t len;
+	bool released;
+};
+
+struct h4_data {
+	struct {
+		struct h4_rx_buf bufs[RX_BUF_COUNT];
+		/* Next buffer to give to the UART, owned by the UART callback
+		 * while receiving.
+		 */
+		uint8_t next;
+		/* Oldest buffer, being parsed by the RX thread */
+		uint8_t head;
+		/* Bytes of the oldest buffer already parsed */
+		size_t parsed;
+		/* Buffers given to the UART and not yet parsed */
+		atomic_t used;
+		bool enabled;
+		struct k_sem sem;
+
+		struct net_buf *buf;
+		uint16_t remaining;
+		uint16_t discard;
+
+		bool have_hdr;
+		bool discardable;
+
+		uint8_t hdr_len;
+
+		uint8_t type;
+		union {
+			struct bt_hci_evt_hdr evt;
+			struct bt_hci_acl_hdr acl;
+			struct bt_hci_iso_hdr iso;
+			uint8_t hdr[4];
+		};
+	} rx;
+
+	struct {
+		struct k_fifo fifo;
+		/* Packet partially copied to the TX buffer */
+		struct net_buf *buf;
+		atomic_t flags;
+	} tx;
+
+	bt_hci_recv_t recv;
+};
+
+struct h4_config {
+	const struct device *uart;
+	k_thread_stack_t *rx_thread_stack;
+	size_t rx_thread_stack_size;
+	struct k_thread *rx_thread;
+	uint8_t (*rx_bufs)[RX_BUF_SIZE];
+	uint8_t *tx_buf;
+};
+
+static void reset_rx(struct h4_data *h4)
+{
+	h4->rx.type = BT_HCI_H4_NONE;
+	h4->rx.remaining = 0U;
+	h4->rx.have_hdr = false;
+	h4->rx.hdr_len = 0U;
+	h4->rx.discardable = false;
+}
+
+static struct net_buf *get_rx(struct h4_data *h4, k_timeout_t timeout)
+{
+	LOG_DBG("type 0x%02x, evt 0x%02x", h4->rx.type, h4->rx.evt.evt);
+
+	switch (h4->rx.type) {
+	case BT_HCI_H4_EVT:
+		return bt_buf_get_evt(h4->rx.evt.evt, h4->rx.discardable, timeout);
+	case BT_HCI_H4_ACL:
+		return bt_buf_get_rx(BT_BUF_ACL_IN, timeout);
+	case BT_HCI_H4_ISO:
+		if (IS_ENABLED(CONFIG_BT_ISO)) {
+			return bt_buf_get_rx(BT_BUF_ISO_IN, timeout);
+		}
+	}
+
+	return NULL;
+}
+
+static void h4_get_type(struct h4_data *h4, uint8_t type)
+{
+	h4->rx.type = type;
+
+	switch (type) {
+	case BT_HCI_H4_EVT:
+		h4->rx.remaining = sizeof(h4->rx.evt);
+		break;
+	case BT_HCI_H4_ACL:
+		h4->rx.remaining = sizeof(h4->rx.acl);
+		break;
+	case BT_HCI_H4_ISO:
+		if (IS_ENABLED(CONFIG_BT_ISO)) {
+			h4->rx.remaining = sizeof(h4->rx.iso);
+			break;
+		}
+		__fallthrough;
+	default:
+		LOG_ERR("Unknown H:4 type 0x%02x", type);
+		h4->rx.type = BT_HCI_H4_NONE;
+		return;
+	}
+
+	h4->rx.hdr_len = h4->rx.remaining;
+}
+
+/* Set up the payload once the header is complete */
+static void h4_hdr_done(struct h4_data *h4)
+{
+	switch (h4->rx.type) {
+	case BT_HCI_H4_EVT:
+		if (h4->rx.hdr_len == sizeof(h4->rx.evt) &&
+		    h4->rx.evt.evt == BT_HCI_EVT_LE_META_EVENT) {
+			/* Read the subevent code as part of the header */
+			h4->rx.remaining++;
+			h4->rx.hdr_len++;
+			return;
+		}
+
+		if (h4->rx.evt.evt == BT_HCI_EVT_LE_META_EVENT &&
+		    h4->rx.hdr[sizeof(h4->rx.evt)] == BT_HCI_EVT_LE_ADVERTISING_REPORT) {
+			LOG_DBG("Marking adv report as discardable");
+			h4->rx.discardable = true;
+		}
+#if defined(CONFIG_BT_CLASSIC)
+		if (h4->rx.evt.evt == BT_HCI_EVT_INQUIRY_RESULT_WITH_RSSI ||
+		    h4->rx.evt.evt == BT_HCI_EVT_EXTENDED_INQUIRY_RESULT) {
+			h4->rx.discardable = true;
+		}
+#endif
+
+		h4->rx.remaining = h4->rx.evt.len - (h4->rx.hdr_len - sizeof(h4->rx.evt));
+		LOG_DBG("Got event header. Payload %u bytes", h4->rx.evt.len);
+		break;
+	case BT_HCI_H4_ACL:
+		h4->rx.remaining = sys_le16_to_cpu(h4->rx.acl.len);
+		LOG_DBG("Got ACL header. Payload %u bytes", h4->rx.remaining);
+		break;
+	case BT_HCI_H4_ISO:
+		h4->rx.remaining = bt_iso_hdr_len(sys_le16_to_cpu(h4->rx.iso.len));
+		LOG_DBG("Got ISO header. Payload %u bytes", h4->rx.remaining);
+		break;
+	}
+
+	h4->rx.have_hdr = true;
+}
+
+/* Allocate the buffer of the packet whose header is complete */
+static void h4_payload_start(struct h4_data *h4)
+{
+	/* Discardable events are dropped rather than holding reception */
+	h4->rx.buf = get_rx(h4, h4->rx.discardable ? K_NO_WAIT : K_FOREVER);
+	if (!h4->rx.buf) {
+		LOG_WRN("Discarding event 0x%02x", h4->rx.evt.evt);
+		h4->rx.discard = h4->rx.remaining;
+		reset_rx(h4);
+		return;
+	}
+
+	if (net_buf_tailroom(h4->rx.buf) < (h4->rx.hdr_len + h4->rx.remaining)) {
+		LOG_ERR("Not enough space in buffer %u/%zu", h4->rx.remaining,
+			net_buf_tailroom(h4->rx.buf));
+		net_buf_unref(h4->rx.buf);
+		h4->rx.buf = NULL;
+		h4->rx.discard = h4->rx.remaining;
+		reset_rx(h4);
+		return;
+	}
+
+	net_buf_add_mem(h4->rx.buf, h4->rx.hdr, h4->rx.hdr_len);
+}
+
+static void h4_payload_done(const struct device *dev)
+{
+	struct h4_data *h4 = dev->data;
+	struct net_buf *buf = h4->rx.buf;
+
+	h4->rx.buf = NULL;
+	reset_rx(h4);
+
+	LOG_DBG("Payload (len %u): %s", buf->len, bt_hex(buf->data, buf->len));
+
+	h4->recv(dev, buf);
+}
+
+/* Cut the received bytes in HCI packets */
+static void h4_parse(const struct device *dev, const uint8_t *data, size_t len)
+{
+	struct h4_data *h4 = dev->data;
+	size_t n;
+
+	while (len) {
+		if (h4->rx.discard) {
+			n = MIN(len, h4->rx.discard);
+			h4->rx.discard -= n;
+		} else if (h4->rx.type == BT_HCI_H4_NONE) {
+			h4_get_type(h4, data[0]);
+			n = 1;
+		} else if (!h4->rx.have_hdr) {
+			n = MIN(len, h4->rx.remaining);
+			memcpy(&h4->rx.hdr[h4->rx.hdr_len - h4->rx.remaining], data, n);
+			h4->rx.remaining -= n;
+
+			if (!h4->rx.remaining) {
+				h4_hdr_done(h4);
+			}
+
+			if (h4->rx.have_hdr) {
+				h4_payload_start(h4);
+				if (h4->rx.buf && !h4->rx.remaining) {
+					h4_payload_done(dev);
+				}
+			}
+		} else {
+			n = MIN(len, h4->rx.remaining);
+			net_buf_add_mem(h4->rx.buf, data, n);
+			h4->rx.remaining -= n;
+
+			if (!h4->rx.remaining) {
+				h4_payload_done(dev);
+			}
+		}
+
+		data += n;
+		len -= n;
+	}
+}
+
+/* Called by the UART callback, or by the RX thread while reception is
+ * stopped.
+ */
+static uint8_t *rx_buf_get(struct h4_data *h4, const struct h4_config *cfg)
+{
+	struct h4_rx_buf *rx_buf;
+
+	if (atomic_get(&h4->rx.used) >= RX_BUF_COUNT) {
+		return NULL;
+	}
+
+	rx_buf = &h4->rx.bufs[h4->rx.next];
+	rx_buf->data = cfg->rx_bufs[h4->rx.next];
+	rx_buf->len = 0;
+	rx_buf->released = false;
+
+	h4->rx.next = (h4->rx.next + 1) % RX_BUF_COUNT;
+	atomic_inc(&h4->rx.used);
+
+	return rx_buf->data;
+}
+
+static struct h4_rx_buf *rx_buf_find(struct h4_data *h4, const struct h4_config *cfg,
+				     const uint8_t *data)
+{
+	return &h4->rx.bufs[(data - cfg->rx_bufs[0]) / RX_BUF_SIZE];
+}
+
+static void rx_enable(const struct device *dev)
+{
+	const struct h4_config *cfg = dev->config;
+	struct h4_data *h4 = dev->data;
+	uint8_t *buf;
+	int err;
+
+	buf = rx_buf_get(h4, cfg);
+	if (!buf) {
+		return;
+	}
+
+	h4->rx.enabled = true;
+
+	err = uart_rx_enable(cfg->uart, buf, RX_BUF_SIZE, CONFIG_BT_H4_ASYNC_RX_TIMEOUT);
+	if (err) {
+		LOG_ERR("Unable to enable UART RX (err %d)", err);
+		h4->rx.enabled = false;
+	}
+}
+
+static void rx_thread(void *p1, void *p2, void *p3)
+{
+	const struct device *dev = p1;
+	struct h4_data *h4 = dev->data;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	LOG_DBG("started");
+
+	rx_enable(dev);
+
+	while (1) {
+		k_sem_take(&h4->rx.sem, K_FOREVER);
+
+		while (atomic_get(&h4->rx.used)) {
+			struct h4_rx_buf *rx_buf = &h4->rx.bufs[h4->rx.head];
+			bool released = rx_buf->released;
+			size_t len;
+
+			/* The last chunk of a buffer is reported before it is
+			 * released.
+			 */
+			compiler_barrier();
+			len = rx_buf->len;
+
+			if (h4->rx.parsed < len) {
+				h4_parse(dev, &rx_buf->data[h4->rx.parsed], len - h4->rx.parsed);
+				h4->rx.parsed = len;
+
+				/* Give other threads a chance to run if data
+				 * comes in so fast that this never waits.
+				 */
+				k_yield();
+			}
+
+			if (!released) {
+				break;
+			}
+
+			h4->rx.head = (h4->rx.head + 1) % RX_BUF_COUNT;
+			h4->rx.parsed = 0;
+			atomic_dec(&h4->rx.used);
+		}
+
+		if (!h4->rx.enabled) {
+			rx_enable(dev);
+		}
+	}
+}
+
+/* Copy queued packets to the TX buffer and send it */
+static void tx_start(const struct device *dev)
+{
+	const struct h4_config *cfg = dev->config;
+	struct h4_data *h4 = dev->data;
+	size_t len;
+	int err;
+
+	do {
+		len = 0;
+
+		while (len < TX_BUF_SIZE) {
+			size_t n;
+
+			if (!h4->tx.buf) {
+				uint8_t type;
+
+				h4->tx.buf = net_buf_get(&h4->tx.fifo, K_NO_WAIT);
+				if (!h4->tx.buf) {
+					break;
+				}
+
+				switch (bt_buf_get_type(h4->tx.buf)) {
+				case BT_BUF_ACL_OUT:
+					type = BT_HCI_H4_ACL;
+					break;
+				case BT_BUF_CMD:
+					type = BT_HCI_H4_CMD;
+					break;
+				case BT_BUF_ISO_OUT:
+					if (IS_ENABLED(CONFIG_BT_ISO)) {
+						type = BT_HCI_H4_ISO;
+						break;
+					}
+					__fallthrough;
+				default:
+					LOG_ERR("Unknown buffer type");
+					net_buf_unref(h4->tx.buf);
+					h4->tx.buf = NULL;
+					continue;
+				}
+
+				cfg->tx_buf[len++] = type;
+			}
+
+			n = MIN(h4->tx.buf->len, TX_BUF_SIZE - len);
+			memcpy(&cfg->tx_buf[len], net_buf_pull_mem(h4->tx.buf, n), n);
+			len += n;
+
+			if (!h4->tx.buf->len) {
+				net_buf_unref(h4->tx.buf);
+				h4->tx.buf = NULL;
+			}
+		}
+
+		if (len) {
+			LOG_DBG("Sending %zu bytes", len);
+
+			err = uart_tx(cfg->uart, cfg->tx_buf, len, SYS_FOREVER_US);
+			if (!err) {
+				return;
+			}
+
+			LOG_ERR("Unable to send (err %d)", err);
+		}
+
+		atomic_clear_bit(&h4->tx.flags, TX_BUSY);
+
+		/* Catch packets queued while the TX buffer was being filled */
+	} while (!k_fifo_is_empty(&h4->tx.fifo) &&
+		 !atomic_test_and_set_bit(&h4->tx.flags, TX_BUSY));
+}
+
+static void bt_uart_callback(const struct device *uart, struct uart_event *evt, void *user_data)
+{
+	const struct device *dev = user_data;
+	const struct h4_config *cfg = dev->config;
+	struct h4_data *h4 = dev->data;
+	struct h4_rx_buf *rx_buf;
+	uint8_t *buf;
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+	case UART_TX_ABORTED:
+		tx_start(dev);
+		break;
+	case UART_RX_RDY:
+		rx_buf = rx_buf_find(h4, cfg, evt->data.rx.buf);
+		rx_buf->len = evt->data.rx.offset + evt->data.rx.len;
+		k_sem_give(&h4->rx.sem);
+		break;
+	case UART_RX_BUF_REQUEST:
+		buf = rx_buf_get(h4, cfg);
+		if (buf) {
+			(void)uart_rx_buf_rsp(uart, buf, RX_BUF_SIZE);
+		} else {
+			LOG_DBG("RX buffers full, pausing");
+		}
+		break;
+	case UART_RX_BUF_RELEASED:
+		rx_buf = rx_buf_find(h4, cfg, evt->data.rx_buf.buf);
+		rx_buf->released = true;
+		k_sem_give(&h4->rx.sem);
+		break;
+	case UART_RX_STOPPED:
+		LOG_WRN("RX stopped (reason %u)", evt->data.rx_stop.reason);
+		break;
+	case UART_RX_DISABLED:
+		h4->rx.enabled = false;
+		k_sem_give(&h4->rx.sem);
+		break;
+	default:
+		break;
+	}
+}
+
+static int h4_send(const struct device *dev, struct net_buf *buf)
+{
+	struct h4_data *h4 = dev->data;
+
+	LOG_DBG("buf %p type %u len %u", buf, bt_buf_get_type(buf), buf->len);
+
+	net_buf_put(&h4->tx.fifo, buf);
+
+	if (!atomic_test_and_set_bit(&h4->tx.flags, TX_BUSY)) {
+		tx_start(dev);
+	}
+
+	return 0;
+}
+
+/** Setup the HCI transport, which usually means to reset the Bluetooth IC
+  *
+  * @param dev The device structure for the bus connecting to the IC
+  *
+  * @return 0 on success, negative error value on failure
+  */
+int __weak bt_hci_transport_setup(const struct device *uart)
+{
+	ARG_UNUSED(uart);
+
+	return 0;
+}
+
+static int h4_open(const struct device *dev, bt_hci_recv_t recv)
+{
+	const struct h4_config *cfg = dev->config;
+	struct h4_data *h4 = dev->data;
+	int ret;
+	k_tid_t tid;
+
+	LOG_DBG("");
+
+	ret = bt_hci_transport_setup(cfg->uart);
+	if (ret < 0) {
+		return -EIO;
+	}
+
+	h4->recv = recv;
+
+	ret = uart_callback_set(cfg->uart, bt_uart_callback, (void *)dev);
+	if (ret < 0) {
+		LOG_ERR("UART async API not supported (err %d)", ret);
+		return -EIO;
+	}
+
+	k_sem_init(&h4->rx.sem, 0, 1);
+
+	tid = k_thread_create(cfg->rx_thread, cfg->rx_thread_stack,
+			      cfg->rx_thread_stack_size,
+			      rx_thread, (void *)dev, NULL, NULL,
+			      K_PRIO_COOP(CONFIG_BT_RX_PRIO),
+			      0, K_NO_WAIT);
+	k_thread_name_set(tid, "bt_rx_thread");
+
+	return 0;
+}
+
+#if defined(CONFIG_BT_HCI_SETUP)
+static int h4_setup(const struct device *dev, const struct bt_hci_setup_params *params)
+{
+	const struct h4_config *cfg = dev->config;
+
+	ARG_UNUSED(params);
+
+	/* Vendor-specific commands sequence to initialize the BT Controller
+	 * before the BT Host executes its Reset sequence, see h4.c.
+	 */
+	extern int bt_h4_vnd_setup(const struct device *dev);
+
+	return bt_h4_vnd_setup(cfg->uart);
+}
+#endif
+
+static const struct bt_hci_driver_api h4_driver_api = {
+	.open = h4_open,
+	.send = h4_send,
+#if defined(CONFIG_BT_HCI_SETUP)
+	.setup = h4_setup,
+#endif
+};
+
+#define BT_UART_DEVICE_INIT(inst) \
+	static K_KERNEL_STACK_DEFINE(rx_thread_stack_##inst, CONFIG_BT_DRV_RX_STACK_SIZE); \
+	static struct k_thread rx_thread_##inst; \
+	static uint8_t rx_bufs_##inst[RX_BUF_COUNT][RX_BUF_SIZE] __aligned(4); \
+	static uint8_t tx_buf_##inst[TX_BUF_SIZE] __aligned(4); \
+	static const struct h4_config h4_config_##inst = { \
+		.uart = DEVICE_DT_GET(DT_INST_PARENT(inst)), \
+		.rx_thread_stack = rx_thread_stack_##inst, \
+		.rx_thread_stack_size = K_KERNEL_STACK_SIZEOF(rx_thread_stack_##inst), \
+		.rx_thread = &rx_thread_##inst, \
+		.rx_bufs = rx_bufs_##inst, \
+		.tx_buf = tx_buf_##inst, \
+	}; \
+	static struct h4_data h4_data_##inst = { \
+		.tx = { \
+			.fifo = Z_FIFO_INITIALIZER(h4_data_##inst.tx.fifo), \
+		}, \
+	}; \
+	DEVICE_DT_INST_DEFINE(inst, NULL, NULL, &h4_data_##inst, &h4_config_##inst, \
+			      POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &h4_driver_api)
+
+DT_INST_FOREACH_STATUS_OKAY(BT_UART_DEVICE_INIT)
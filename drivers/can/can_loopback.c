@@ -11,6 +11,7 @@
 #include <string.h>
 
 #include <zephyr/drivers/can.h>
+#include <zephyr/drivers/can/filter_table.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/util.h>
@@ -26,7 +27,7 @@ struct can_loopback_frame {
 struct can_loopback_filter {
 	can_rx_callback_t rx_cb;
 	void *cb_arg;
-	struct can_filter filter;
+	struct can_filter_table_entry entry;
 };
 
 struct can_loopback_config {
@@ -36,6 +37,8 @@ struct can_loopback_config {
 struct can_loopback_data {
 	struct can_driver_data common;
 	struct can_loopback_filter filters[CONFIG_CAN_MAX_FILTER];
+	struct can_filter_table filter_table;
+	sys_slist_t filter_buckets[CAN_FILTER_TABLE_BUCKETS(CONFIG_CAN_MAX_FILTER)];
 	struct k_mutex mtx;
 	struct k_msgq tx_msgq;
 	char msgq_buffer[CONFIG_CAN_LOOPBACK_TX_MSGQ_SIZE * sizeof(struct can_loopback_frame)];
@@ -45,10 +48,12 @@ struct can_loopback_data {
 		      CONFIG_CAN_LOOPBACK_TX_THREAD_STACK_SIZE);
 };
 
-static void receive_frame(const struct device *dev,
-			  const struct can_frame *frame,
-			  struct can_loopback_filter *filter)
+static void receive_frame(struct can_filter_table_entry *entry,
+			  const struct can_frame *frame, void *user_data)
 {
+	const struct device *dev = user_data;
+	struct can_loopback_filter *filter =
+		CONTAINER_OF(entry, struct can_loopback_filter, entry);
 	struct can_frame frame_tmp = *frame;
 
 	LOG_DBG("Receiving %d bytes. Id: 0x%x, ID type: %s %s",
@@ -64,7 +69,6 @@ static void tx_thread(void *arg1, void *arg2, void *arg3)
 	const struct device *dev = arg1;
 	struct can_loopback_data *data = dev->data;
 	struct can_loopback_frame frame;
-	struct can_loopback_filter *filter;
 	int ret;
 
 	ARG_UNUSED(arg2);
@@ -90,13 +94,8 @@ static void tx_thread(void *arg1, void *arg2, void *arg3)
 
 		k_mutex_lock(&data->mtx, K_FOREVER);
 
-		for (int i = 0; i < CONFIG_CAN_MAX_FILTER; i++) {
-			filter = &data->filters[i];
-			if (filter->rx_cb != NULL &&
-			    can_frame_matches_filter(&frame.frame, &filter->filter)) {
-				receive_frame(dev, &frame.frame, filter);
-			}
-		}
+		can_filter_table_match(&data->filter_table, &frame.frame, receive_frame,
+				       (void *)dev);
 
 		k_mutex_unlock(&data->mtx);
 	}
@@ -199,7 +198,8 @@ static int can_loopback_add_rx_filter(const struct device *dev, can_rx_callback_
 
 	loopback_filter->rx_cb = cb;
 	loopback_filter->cb_arg = cb_arg;
-	loopback_filter->filter = *filter;
+	loopback_filter->entry.filter = *filter;
+	can_filter_table_add(&data->filter_table, &loopback_filter->entry);
 	k_mutex_unlock(&data->mtx);
 
 	LOG_DBG("Filter added. ID: %d", filter_id);
@@ -218,7 +218,10 @@ static void can_loopback_remove_rx_filter(const struct device *dev, int filter_i
 
 	LOG_DBG("Remove filter ID: %d", filter_id);
 	k_mutex_lock(&data->mtx, K_FOREVER);
-	data->filters[filter_id].rx_cb = NULL;
+	if (data->filters[filter_id].rx_cb != NULL) {
+		can_filter_table_remove(&data->filter_table, &data->filters[filter_id].entry);
+		data->filters[filter_id].rx_cb = NULL;
+	}
 	k_mutex_unlock(&data->mtx);
 }
 
@@ -424,6 +427,9 @@ static int can_loopback_init(const struct device *dev)
 		data->filters[i].rx_cb = NULL;
 	}
 
+	can_filter_table_init(&data->filter_table, data->filter_buckets,
+			      ARRAY_SIZE(data->filter_buckets));
+
 	k_msgq_init(&data->tx_msgq, data->msgq_buffer, sizeof(struct can_loopback_frame),
 		    CONFIG_CAN_LOOPBACK_TX_MSGQ_SIZE);
 
@@ -19,6 +19,9 @@ struct ili9xxx_data {
 	uint8_t bytes_per_pixel;
 	enum display_pixel_format pixel_format;
 	enum display_orientation orientation;
+	/* Completion callback of the asynchronous write in flight */
+	display_write_cb_t write_cb;
+	void *write_user_data;
 };
 
 #ifdef CONFIG_ILI9XXX_READ
@@ -185,6 +188,68 @@ static int ili9xxx_write(const struct device *dev, const uint16_t x,
 	return 0;
 }
 
+static void ili9xxx_write_done(const struct device *mipi_dev, int result,
+			       void *user_data)
+{
+	const struct device *dev = user_data;
+	struct ili9xxx_data *data = dev->data;
+
+	ARG_UNUSED(mipi_dev);
+
+	data->write_cb(dev, result, data->write_user_data);
+}
+
+static int ili9xxx_write_async(const struct device *dev, const uint16_t x,
+			       const uint16_t y,
+			       const struct display_buffer_descriptor *desc,
+			       const void *buf, display_write_cb_t cb,
+			       void *user_data)
+{
+	const struct ili9xxx_config *config = dev->config;
+	struct ili9xxx_data *data = dev->data;
+	struct display_buffer_descriptor mipi_desc;
+	int r;
+
+	/* Strided buffers are written row by row */
+	if (desc->pitch > desc->width) {
+		r = ili9xxx_write(dev, x, y, desc, buf);
+		if (r == 0) {
+			cb(dev, 0, user_data);
+		}
+		return r;
+	}
+
+	__ASSERT((desc->width * data->bytes_per_pixel * desc->height) <=
+			 desc->buf_size,
+		 "Input buffer to small");
+
+	LOG_DBG("Writing %dx%d (w,h) @ %dx%d (x,y) asynchronously",
+		desc->width, desc->height, x, y);
+	/* The commands wait for the previous write to complete */
+	r = ili9xxx_set_mem_area(dev, x, y, desc->width, desc->height);
+	if (r < 0) {
+		return r;
+	}
+
+	r = ili9xxx_transmit(dev, ILI9XXX_RAMWR, NULL, 0);
+	if (r < 0) {
+		return r;
+	}
+
+	mipi_desc.width = desc->width;
+	mipi_desc.height = desc->height;
+	mipi_desc.pitch = desc->width;
+	mipi_desc.buf_size = desc->width * data->bytes_per_pixel * desc->height;
+
+	data->write_cb = cb;
+	data->write_user_data = user_data;
+
+	return mipi_dbi_write_display_async(config->mipi_dev,
+					    &config->dbi_config, buf,
+					    &mipi_desc, data->pixel_format,
+					    ili9xxx_write_done, (void *)dev);
+}
+
 #ifdef CONFIG_ILI9XXX_READ
 
 static int ili9xxx_read(const struct device *dev, const uint16_t x,
@@ -485,6 +550,7 @@ static const struct display_driver_api ili9xxx_api = {
 	.get_capabilities = ili9xxx_get_capabilities,
 	.set_pixel_format = ili9xxx_set_pixel_format,
 	.set_orientation = ili9xxx_set_orientation,
+	.write_async = ili9xxx_write_async,
 };
 
 #ifdef CONFIG_ILI9340
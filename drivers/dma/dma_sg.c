@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/drivers/dma/dma_sg.h>
+#include <zephyr/sys/util.h>
+#ifdef CONFIG_NET_BUF
+#include <zephyr/net/buf.h>
+#endif
+#ifdef CONFIG_RTIO
+#include <zephyr/rtio/rtio.h>
+#endif
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(dma_sg, CONFIG_DMA_LOG_LEVEL);
+
+void dma_sg_init(struct dma_sg *sg, const struct device *dev, uint32_t channel,
+		 const struct dma_config *cfg, uint8_t flags)
+{
+	sg->dev = dev;
+	sg->channel = channel;
+	sg->cfg = *cfg;
+	sg->flags = flags;
+	sg->loaded = 0;
+
+	if (cfg->head_block != NULL) {
+		sg->tmpl = *cfg->head_block;
+	} else {
+		memset(&sg->tmpl, 0, sizeof(sg->tmpl));
+	}
+
+	sg->tmpl.next_block = NULL;
+	dma_sg_reset(sg);
+}
+
+int dma_sg_add(struct dma_sg *sg, uint64_t src, uint64_t dst, size_t size)
+{
+	struct dma_block_config *block;
+
+	if (sg->count == sg->max_blocks) {
+		return -ENOMEM;
+	}
+
+	block = &sg->blocks[sg->count];
+	*block = sg->tmpl;
+	block->source_address = src;
+	block->dest_address = dst;
+	block->block_size = size;
+
+	if (sg->count > 0) {
+		sg->blocks[sg->count - 1].next_block = block;
+	}
+
+	sg->count++;
+	sg->total += size;
+
+	return 0;
+}
+
+static bool dma_sg_mem_is_source(const struct dma_sg *sg)
+{
+	return sg->cfg.channel_direction == MEMORY_TO_PERIPHERAL ||
+	       sg->cfg.channel_direction == MEMORY_TO_MEMORY;
+}
+
+int dma_sg_add_mem(struct dma_sg *sg, void *mem, size_t size, uint64_t *dev_addr)
+{
+	uint64_t addr = (uintptr_t)mem;
+	uint16_t dev_adj;
+	int rc;
+
+	if (dma_sg_mem_is_source(sg)) {
+		rc = dma_sg_add(sg, addr, *dev_addr, size);
+		dev_adj = sg->tmpl.dest_addr_adj;
+	} else {
+		rc = dma_sg_add(sg, *dev_addr, addr, size);
+		dev_adj = sg->tmpl.source_addr_adj;
+	}
+
+	if (rc == 0) {
+		if (dev_adj == DMA_ADDR_ADJ_INCREMENT) {
+			*dev_addr += size;
+		} else if (dev_adj == DMA_ADDR_ADJ_DECREMENT) {
+			*dev_addr -= size;
+		}
+	}
+
+	return rc;
+}
+
+static void dma_sg_rewind(struct dma_sg *sg, uint16_t count, size_t total)
+{
+	sg->count = count;
+	sg->total = total;
+}
+
+#ifdef CONFIG_NET_BUF
+int dma_sg_add_net_buf(struct dma_sg *sg, struct net_buf *frags, uint64_t dev_addr)
+{
+	const uint16_t count = sg->count;
+	const size_t total = sg->total;
+	bool tx = dma_sg_mem_is_source(sg);
+
+	for (struct net_buf *frag = frags; frag != NULL; frag = frag->frags) {
+		void *mem = tx ? frag->data : net_buf_tail(frag);
+		size_t size = tx ? frag->len : net_buf_tailroom(frag);
+
+		if (size == 0) {
+			continue;
+		}
+
+		if (dma_sg_add_mem(sg, mem, size, &dev_addr) < 0) {
+			dma_sg_rewind(sg, count, total);
+			return -ENOMEM;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_NET_BUF */
+
+#ifdef CONFIG_RTIO
+int dma_sg_add_rtio(struct dma_sg *sg, struct rtio_iodev_sqe *iodev_sqe, uint64_t dev_addr)
+{
+	const uint16_t count = sg->count;
+	const size_t total = sg->total;
+	bool tx = dma_sg_mem_is_source(sg);
+	int rc = 0;
+
+	for (struct rtio_iodev_sqe *curr = iodev_sqe; curr != NULL; curr = rtio_txn_next(curr)) {
+		struct rtio_sqe *sqe = &curr->sqe;
+
+		switch (sqe->op) {
+		case RTIO_OP_TX:
+			rc = tx ? dma_sg_add_mem(sg, sqe->buf, sqe->buf_len, &dev_addr) : -EINVAL;
+			break;
+		case RTIO_OP_TINY_TX:
+			rc = tx ? dma_sg_add_mem(sg, sqe->tiny_buf, sqe->tiny_buf_len, &dev_addr)
+				: -EINVAL;
+			break;
+		case RTIO_OP_RX:
+			rc = tx ? -EINVAL : dma_sg_add_mem(sg, sqe->buf, sqe->buf_len, &dev_addr);
+			break;
+		default:
+			rc = -EINVAL;
+			break;
+		}
+
+		if (rc < 0) {
+			LOG_DBG("Cannot add op %u (%d)", sqe->op, rc);
+			dma_sg_rewind(sg, count, total);
+			return rc;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_RTIO */
+
+int dma_sg_start(struct dma_sg *sg)
+{
+	struct dma_block_config *block = &sg->blocks[0];
+	int rc;
+
+	if (sg->count == 0) {
+		return -EINVAL;
+	}
+
+	sg->blocks[sg->count - 1].next_block = NULL;
+
+	if ((sg->flags & DMA_SG_RELOAD) != 0 && sg->count == 1 && sg->loaded == 1) {
+		rc = dma_reload(sg->dev, sg->channel, block->source_address, block->dest_address,
+				block->block_size);
+		if (rc == 0) {
+			return dma_start(sg->dev, sg->channel);
+		}
+
+		if (rc != -ENOSYS) {
+			return rc;
+		}
+
+		LOG_DBG("No reload on channel %u, configuring it", sg->channel);
+		sg->flags &= ~DMA_SG_RELOAD;
+	}
+
+	sg->cfg.head_block = sg->blocks;
+	sg->cfg.block_count = sg->count;
+
+	rc = dma_config(sg->dev, sg->channel, &sg->cfg);
+	if (rc < 0) {
+		sg->loaded = 0;
+		return rc;
+	}
+
+	sg->loaded = sg->count;
+
+	return dma_start(sg->dev, sg->channel);
+}
@@ -56,13 +56,13 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME);
  * different from the normal RAM virt_to_phys mapping.
  */
 #ifdef CONFIG_MMU
-#define TXDESC_PHYS_H(idx) hi32(p->tx_descs_phys + (idx) * sizeof(struct dwmac_dma_desc))
-#define TXDESC_PHYS_L(idx) lo32(p->tx_descs_phys + (idx) * sizeof(struct dwmac_dma_desc))
+#define TXDESC_PHYS_H(q, idx) hi32((q)->descs_phys + (idx) * sizeof(struct dwmac_dma_desc))
+#define TXDESC_PHYS_L(q, idx) lo32((q)->descs_phys + (idx) * sizeof(struct dwmac_dma_desc))
 #define RXDESC_PHYS_H(idx) hi32(p->rx_descs_phys + (idx) * sizeof(struct dwmac_dma_desc))
 #define RXDESC_PHYS_L(idx) lo32(p->rx_descs_phys + (idx) * sizeof(struct dwmac_dma_desc))
 #else
-#define TXDESC_PHYS_H(idx) phys_hi32(&p->tx_descs[idx])
-#define TXDESC_PHYS_L(idx) phys_lo32(&p->tx_descs[idx])
+#define TXDESC_PHYS_H(q, idx) phys_hi32(&(q)->descs[idx])
+#define TXDESC_PHYS_L(q, idx) phys_lo32(&(q)->descs[idx])
 #define RXDESC_PHYS_H(idx) phys_hi32(&p->rx_descs[idx])
 #define RXDESC_PHYS_L(idx) phys_lo32(&p->rx_descs[idx])
 #endif
@@ -126,31 +126,55 @@ static inline int net_pkt_get_nbfrags(struct net_pkt *pkt)
 	return nbfrags;
 }
 
+/*
+ * Traffic classes are spread evenly over the transmit queues, the highest
+ * traffic classes going to the highest queues which the MTL scheduler
+ * serves first.
+ */
+static unsigned int dwmac_tx_queue_index(struct dwmac_priv *p, struct net_pkt *pkt)
+{
+#if NET_TC_TX_COUNT > 1
+	unsigned int tc = net_tx_priority2tc(net_pkt_priority(pkt));
+
+	return tc * p->nb_tx_queues / NET_TC_TX_COUNT;
+#else
+	ARG_UNUSED(p);
+	ARG_UNUSED(pkt);
+
+	return 0;
+#endif
+}
+
 static int dwmac_send(const struct device *dev, struct net_pkt *pkt)
 {
 	struct dwmac_priv *p = dev->data;
+	unsigned int q_idx = dwmac_tx_queue_index(p, pkt);
+	struct dwmac_tx_queue *q = &p->tx_queues[q_idx];
 	struct net_buf *frag, *pinned;
 	unsigned int pkt_len = net_pkt_get_len(pkt);
 	unsigned int d_idx;
 	struct dwmac_dma_desc *d;
 	uint32_t des2_flags, des3_flags;
 
-	LOG_DBG("pkt len/frags=%d/%d", pkt_len, net_pkt_get_nbfrags(pkt));
+	LOG_DBG("pkt len/frags/queue=%d/%d/%d", pkt_len, net_pkt_get_nbfrags(pkt), q_idx);
+
+	/* only packets of the same queue are serialized */
+	k_mutex_lock(&q->lock, K_FOREVER);
 
 	/* initial flag values */
 	des2_flags = 0;
 	des3_flags = TDES3_FD | TDES3_OWN;
 
 	/* map packet fragments */
-	d_idx = p->tx_desc_head;
+	d_idx = q->head;
 	frag = pkt->buffer;
 	do {
 		LOG_DBG("desc sem/head/tail=%d/%d/%d",
-			k_sem_count_get(&p->free_tx_descs),
-			p->tx_desc_head, p->tx_desc_tail);
+			k_sem_count_get(&q->free_descs),
+			q->head, q->tail);
 
 		/* reserve a free descriptor for this fragment */
-		if (k_sem_take(&p->free_tx_descs, TX_AVAIL_WAIT) != 0) {
+		if (k_sem_take(&q->free_descs, TX_AVAIL_WAIT) != 0) {
 			LOG_DBG("no more free tx descriptors");
 			goto abort;
 		}
@@ -159,11 +183,11 @@ static int dwmac_send(const struct device *dev, struct net_pkt *pkt)
 		pinned = net_buf_clone(frag, TX_AVAIL_WAIT);
 		if (!pinned) {
 			LOG_DBG("net_buf_clone() returned NULL");
-			k_sem_give(&p->free_tx_descs);
+			k_sem_give(&q->free_descs);
 			goto abort;
 		}
 		sys_cache_data_flush_range(pinned->data, pinned->len);
-		p->tx_frags[d_idx] = pinned;
+		q->frags[d_idx] = pinned;
 		LOG_DBG("d[%d]: frag %p pinned %p len %d", d_idx,
 			frag->data, pinned->data, pinned->len);
 
@@ -175,7 +199,7 @@ static int dwmac_send(const struct device *dev, struct net_pkt *pkt)
 		}
 
 		/* fill the descriptor */
-		d = &p->tx_descs[d_idx];
+		d = &q->descs[d_idx];
 		d->des0 = phys_lo32(pinned->data);
 		d->des1 = phys_hi32(pinned->data);
 		d->des2 = pinned->len | des2_flags;
@@ -192,40 +216,45 @@ static int dwmac_send(const struct device *dev, struct net_pkt *pkt)
 	barrier_dmem_fence_full();
 
 	/* update the descriptor index head */
-	p->tx_desc_head = d_idx;
+	q->head = d_idx;
 
 	/* lastly notify the hardware */
-	REG_WRITE(DMA_CHn_TXDESC_TAIL_PTR(0), TXDESC_PHYS_L(d_idx));
+	REG_WRITE(DMA_CHn_TXDESC_TAIL_PTR(q_idx), TXDESC_PHYS_L(q, d_idx));
+
+	k_mutex_unlock(&q->lock);
 
 	return 0;
 
 abort:
-	while (d_idx != p->tx_desc_head) {
+	while (d_idx != q->head) {
 		/* release already pinned fragments */
 		DEC_WRAP(d_idx, NB_TX_DESCS);
-		frag = p->tx_frags[d_idx];
+		frag = q->frags[d_idx];
 		net_pkt_frag_unref(frag);
-		k_sem_give(&p->free_tx_descs);
+		k_sem_give(&q->free_descs);
 	}
+
+	k_mutex_unlock(&q->lock);
+
 	return -ENOMEM;
 }
 
-static void dwmac_tx_release(struct dwmac_priv *p)
+static void dwmac_tx_release(struct dwmac_priv *p, struct dwmac_tx_queue *q)
 {
 	unsigned int d_idx;
 	struct dwmac_dma_desc *d;
 	struct net_buf *frag;
 	uint32_t des3_val;
 
-	for (d_idx = p->tx_desc_tail;
-	     d_idx != p->tx_desc_head;
-	     INC_WRAP(d_idx, NB_TX_DESCS), k_sem_give(&p->free_tx_descs)) {
+	for (d_idx = q->tail;
+	     d_idx != q->head;
+	     INC_WRAP(d_idx, NB_TX_DESCS), k_sem_give(&q->free_descs)) {
 
 		LOG_DBG("desc sem/tail/head=%d/%d/%d",
-			k_sem_count_get(&p->free_tx_descs),
-			p->tx_desc_tail, p->tx_desc_head);
+			k_sem_count_get(&q->free_descs),
+			q->tail, q->head);
 
-		d = &p->tx_descs[d_idx];
+		d = &q->descs[d_idx];
 		des3_val = d->des3;
 		LOG_DBG("TDES3[%d] = 0x%08x", d_idx, des3_val);
 
@@ -235,7 +264,7 @@ static void dwmac_tx_release(struct dwmac_priv *p)
 		}
 
 		/* release corresponding fragments */
-		frag = p->tx_frags[d_idx];
+		frag = q->frags[d_idx];
 		LOG_DBG("unref frag %p", frag->data);
 		net_pkt_frag_unref(frag);
 
@@ -248,7 +277,7 @@ static void dwmac_tx_release(struct dwmac_priv *p)
 			}
 		}
 	}
-	p->tx_desc_tail = d_idx;
+	q->tail = d_idx;
 }
 
 static void dwmac_receive(struct dwmac_priv *p)
@@ -399,17 +428,18 @@ static void dwmac_dma_irq(struct dwmac_priv *p, unsigned int ch)
 	LOG_DBG("DMA_CHn_STATUS(%d) = 0x%08x", ch, status);
 	REG_WRITE(DMA_CHn_STATUS(ch), status);
 
-	__ASSERT(ch == 0, "only one DMA channel is currently supported");
+	__ASSERT(ch < p->nb_tx_queues, "DMA channel %u is not in use", ch);
 
 	if (status & DMA_CHn_STATUS_AIS) {
 		LOG_ERR("Abnormal Interrupt Status received (0x%x)", status);
 	}
 
 	if (status & DMA_CHn_STATUS_TI) {
-		dwmac_tx_release(p);
+		dwmac_tx_release(p, &p->tx_queues[ch]);
 	}
 
-	if (status & DMA_CHn_STATUS_RI) {
+	/* reception only uses the first channel */
+	if (ch == 0 && (status & DMA_CHn_STATUS_RI)) {
 		dwmac_receive(p);
 	}
 }
@@ -513,6 +543,7 @@ static void dwmac_iface_init(struct net_if *iface)
 {
 	struct dwmac_priv *p = net_if_get_device(iface)->data;
 	uint32_t reg_val;
+	unsigned int q;
 
 	__ASSERT(!p->iface, "interface already initialized?");
 	p->iface = iface;
@@ -530,9 +561,20 @@ static void dwmac_iface_init(struct net_if *iface)
 	 * stop at and to prevent our head indexes from looping back
 	 * onto our tail indexes.
 	 */
-	k_sem_init(&p->free_tx_descs, NB_TX_DESCS - 1, NB_TX_DESCS - 1);
+	for (q = 0; q < p->nb_tx_queues; q++) {
+		k_sem_init(&p->tx_queues[q].free_descs, NB_TX_DESCS - 1, NB_TX_DESCS - 1);
+		k_mutex_init(&p->tx_queues[q].lock);
+	}
 	k_sem_init(&p->free_rx_descs, NB_RX_DESCS - 1, NB_RX_DESCS - 1);
 
+	/*
+	 * Each transmit queue has its own lock, so that a TX thread waiting
+	 * for descriptors does not hold back the packets of other queues.
+	 */
+	if (p->nb_tx_queues > 1) {
+		net_if_flag_set(iface, NET_IF_NO_TX_LOCK);
+	}
+
 	/* set up RX buffer refill thread */
 	k_thread_create(&p->rx_refill_thread, p->rx_refill_thread_stack,
 			K_KERNEL_STACK_SIZEOF(p->rx_refill_thread_stack),
@@ -541,8 +583,10 @@ static void dwmac_iface_init(struct net_if *iface)
 	k_thread_name_set(&p->rx_refill_thread, "dwmac_rx_refill");
 
 	/* start up TX/RX */
-	reg_val = REG_READ(DMA_CHn_TX_CTRL(0));
-	REG_WRITE(DMA_CHn_TX_CTRL(0), reg_val | DMA_CHn_TX_CTRL_St);
+	for (q = 0; q < p->nb_tx_queues; q++) {
+		reg_val = REG_READ(DMA_CHn_TX_CTRL(q));
+		REG_WRITE(DMA_CHn_TX_CTRL(q), reg_val | DMA_CHn_TX_CTRL_St);
+	}
 	reg_val = REG_READ(DMA_CHn_RX_CTRL(0));
 	REG_WRITE(DMA_CHn_RX_CTRL(0), reg_val | DMA_CHn_RX_CTRL_SR);
 	reg_val = REG_READ(MAC_CONF);
@@ -550,23 +594,51 @@ static void dwmac_iface_init(struct net_if *iface)
 	REG_WRITE(MAC_CONF, reg_val);
 
 	/* unmask IRQs */
-	REG_WRITE(DMA_CHn_IRQ_ENABLE(0),
-		  DMA_CHn_IRQ_ENABLE_TIE |
-		  DMA_CHn_IRQ_ENABLE_RIE |
-		  DMA_CHn_IRQ_ENABLE_NIE |
-		  DMA_CHn_IRQ_ENABLE_FBEE |
-		  DMA_CHn_IRQ_ENABLE_CDEE |
-		  DMA_CHn_IRQ_ENABLE_AIE);
+	for (q = 0; q < p->nb_tx_queues; q++) {
+		REG_WRITE(DMA_CHn_IRQ_ENABLE(q),
+			  DMA_CHn_IRQ_ENABLE_TIE |
+			  (q == 0 ? DMA_CHn_IRQ_ENABLE_RIE : 0) |
+			  DMA_CHn_IRQ_ENABLE_NIE |
+			  DMA_CHn_IRQ_ENABLE_FBEE |
+			  DMA_CHn_IRQ_ENABLE_CDEE |
+			  DMA_CHn_IRQ_ENABLE_AIE);
+	}
 
 	LOG_DBG("done");
 }
 
+/*
+ * Split the transmit FIFO evenly between the queues and serve them by
+ * strict priority, the highest queue first.
+ */
+static void dwmac_mtl_tx_init(struct dwmac_priv *p)
+{
+	unsigned int fifo_size = 128 << FIELD_GET(MAC_HW_FEATURE1_TXFIFOSIZE, p->feature1);
+	unsigned int queue_size = MAX(fifo_size / p->nb_tx_queues, 256);
+	uint32_t reg_val;
+	unsigned int q;
+
+	reg_val = REG_READ(MTL_OPERATION_MODE);
+	reg_val &= ~MTL_OPERATION_MODE_SCHALG;
+	reg_val |= FIELD_PREP(MTL_OPERATION_MODE_SCHALG, MTL_OPERATION_MODE_SCHALG_SP);
+	REG_WRITE(MTL_OPERATION_MODE, reg_val);
+
+	for (q = 0; q < p->nb_tx_queues; q++) {
+		REG_WRITE(MTL_TXQn_OPERATION_MODE(q),
+			  FIELD_PREP(MTL_TXQn_OPERATION_MODE_TQS, queue_size / 256 - 1) |
+			  FIELD_PREP(MTL_TXQn_OPERATION_MODE_TXQEN,
+				     MTL_TXQn_OPERATION_MODE_TXQEN_ENABLED) |
+			  MTL_TXQn_OPERATION_MODE_TSF);
+	}
+}
+
 int dwmac_probe(const struct device *dev)
 {
 	struct dwmac_priv *p = dev->data;
 	int ret;
 	uint32_t reg_val;
 	k_timepoint_t timeout;
+	unsigned int q;
 
 	ret = dwmac_bus_init(p);
 	if (ret != 0) {
@@ -598,19 +670,36 @@ int dwmac_probe(const struct device *dev)
 
 	dwmac_platform_init(p);
 
-	memset(p->tx_descs, 0, NB_TX_DESCS * sizeof(struct dwmac_dma_desc));
+	/* use as many transmit channels as configured and available */
+	p->nb_tx_queues = MIN(NB_TX_QUEUES,
+			      FIELD_GET(MAC_HW_FEATURE2_TXCHCNT, p->feature2) + 1);
+	if (p->nb_tx_queues < NB_TX_QUEUES) {
+		LOG_WRN("only %u TX queues available", p->nb_tx_queues);
+	}
+
+	for (q = 0; q < NB_TX_QUEUES; q++) {
+		memset(p->tx_queues[q].descs, 0, NB_TX_DESCS * sizeof(struct dwmac_dma_desc));
+	}
 	memset(p->rx_descs, 0, NB_RX_DESCS * sizeof(struct dwmac_dma_desc));
 
+	if (p->nb_tx_queues > 1) {
+		dwmac_mtl_tx_init(p);
+	}
+
 	/* set up DMA */
-	REG_WRITE(DMA_CHn_TX_CTRL(0), 0);
+	for (q = 0; q < p->nb_tx_queues; q++) {
+		struct dwmac_tx_queue *txq = &p->tx_queues[q];
+
+		REG_WRITE(DMA_CHn_TX_CTRL(q), 0);
+		REG_WRITE(DMA_CHn_TXDESC_LIST_HADDR(q), TXDESC_PHYS_H(txq, 0));
+		REG_WRITE(DMA_CHn_TXDESC_LIST_ADDR(q), TXDESC_PHYS_L(txq, 0));
+		REG_WRITE(DMA_CHn_TXDESC_RING_LENGTH(q), NB_TX_DESCS - 1);
+	}
 	REG_WRITE(DMA_CHn_RX_CTRL(0),
 		  FIELD_PREP(DMA_CHn_RX_CTRL_PBL, 32) |
 		  FIELD_PREP(DMA_CHn_RX_CTRL_RBSZ, RX_FRAG_SIZE));
-	REG_WRITE(DMA_CHn_TXDESC_LIST_HADDR(0), TXDESC_PHYS_H(0));
-	REG_WRITE(DMA_CHn_TXDESC_LIST_ADDR(0), TXDESC_PHYS_L(0));
 	REG_WRITE(DMA_CHn_RXDESC_LIST_HADDR(0), RXDESC_PHYS_H(0));
 	REG_WRITE(DMA_CHn_RXDESC_LIST_ADDR(0), RXDESC_PHYS_L(0));
-	REG_WRITE(DMA_CHn_TXDESC_RING_LENGTH(0), NB_TX_DESCS - 1);
 	REG_WRITE(DMA_CHn_RXDESC_RING_LENGTH(0), NB_RX_DESCS - 1);
 
 	return 0;
@@ -34,7 +34,7 @@ int dwmac_bus_init(struct dwmac_priv *p)
 #endif
 
 static struct dwmac_dma_desc __aligned(CONFIG_DCACHE_LINE_SIZE)
-			dwmac_tx_rx_descriptors[NB_TX_DESCS + NB_RX_DESCS];
+			dwmac_tx_rx_descriptors[NB_TX_QUEUES * NB_TX_DESCS + NB_RX_DESCS];
 
 static const uint8_t dwmac_mac_addr[6] = DT_INST_PROP(0, local_mac_address);
 
@@ -57,12 +57,15 @@ void dwmac_platform_init(struct dwmac_priv *p)
 	LOG_DBG("desc virt %p uncached %p phys 0x%lx",
 		dwmac_tx_rx_descriptors, desc_uncached_addr, desc_phys_addr);
 
-	p->tx_descs = (void *)desc_uncached_addr;
-	desc_uncached_addr += NB_TX_DESCS * sizeof(struct dwmac_dma_desc);
-	p->rx_descs = (void *)desc_uncached_addr;
+	for (int q = 0; q < NB_TX_QUEUES; q++) {
+		p->tx_queues[q].descs = (void *)desc_uncached_addr;
+		desc_uncached_addr += NB_TX_DESCS * sizeof(struct dwmac_dma_desc);
+
+		p->tx_queues[q].descs_phys = desc_phys_addr;
+		desc_phys_addr += NB_TX_DESCS * sizeof(struct dwmac_dma_desc);
+	}
 
-	p->tx_descs_phys = desc_phys_addr;
-	desc_phys_addr += NB_TX_DESCS * sizeof(struct dwmac_dma_desc);
+	p->rx_descs = (void *)desc_uncached_addr;
 	p->rx_descs_phys = desc_phys_addr;
 
 	/* basic configuration for this platform */
@@ -22,6 +22,9 @@
 #define NB_TX_DESCS		CONFIG_DWMAC_NB_TX_DESCS
 #define NB_RX_DESCS		CONFIG_DWMAC_NB_RX_DESCS
 
+/* number of transmit DMA channels, each one feeding its own MTL queue */
+#define NB_TX_QUEUES		CONFIG_DWMAC_NB_TX_QUEUES
+
 /* stack size for RX refill thread */
 #define RX_REFILL_STACK_SIZE	1024
 
@@ -37,6 +40,20 @@ struct dwmac_dma_desc {
 	uint32_t des3;
 };
 
+/* transmit DMA channel state */
+struct dwmac_tx_queue {
+	struct dwmac_dma_desc *descs;
+	struct k_sem free_descs;
+	struct k_mutex lock;
+	unsigned int head, tail;
+
+#ifdef CONFIG_MMU
+	uintptr_t descs_phys;
+#endif
+
+	struct net_buf *frags[NB_TX_DESCS]; /* index shared with descs */
+};
+
 /* our private instance structure */
 struct dwmac_priv {
 	mem_addr_t base_addr;
@@ -50,16 +67,17 @@ struct dwmac_priv {
 	uint32_t feature2;
 	uint32_t feature3;
 
-	struct dwmac_dma_desc *tx_descs, *rx_descs;
-	struct k_sem free_tx_descs, free_rx_descs;
-	unsigned int tx_desc_head, tx_desc_tail;
+	struct dwmac_tx_queue tx_queues[NB_TX_QUEUES];
+	unsigned int nb_tx_queues;
+
+	struct dwmac_dma_desc *rx_descs;
+	struct k_sem free_rx_descs;
 	unsigned int rx_desc_head, rx_desc_tail;
 
 #ifdef CONFIG_MMU
-	uintptr_t tx_descs_phys, rx_descs_phys;
+	uintptr_t rx_descs_phys;
 #endif
 
-	struct net_buf *tx_frags[NB_TX_DESCS]; /* index shared with tx_descs */
 	struct net_buf *rx_frags[NB_RX_DESCS]; /* index shared with rx_descs */
 
 	struct net_pkt *rx_pkt;
@@ -649,6 +667,9 @@ extern const struct ethernet_api dwmac_api;
 
 #define MTL_OPERATION_MODE			0x0c00
 
+#define MTL_OPERATION_MODE_SCHALG		GENMASK(6, 5)
+#define MTL_OPERATION_MODE_SCHALG_SP		3
+
 /* 17.2.2 */
 
 #define MTL_DBG_CTL				0x0c08
@@ -790,6 +811,11 @@ extern const struct ethernet_api dwmac_api;
 
 #define MTL_TXQn_OPERATION_MODE(n)		(0x0d00 + 0x40 * (n))
 
+#define MTL_TXQn_OPERATION_MODE_TQS		GENMASK(24, 16)
+#define MTL_TXQn_OPERATION_MODE_TXQEN		GENMASK(3, 2)
+#define MTL_TXQn_OPERATION_MODE_TXQEN_ENABLED	2
+#define MTL_TXQn_OPERATION_MODE_TSF		BIT(1)
+
 /* 17.3.2, 17.4.2 */
 
 #define MTL_TXQn_UNDERFLOW(n)			(0x0d04 + 0x40 * (n))
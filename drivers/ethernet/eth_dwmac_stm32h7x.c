@@ -92,12 +92,14 @@ int dwmac_bus_init(struct dwmac_priv *p)
 #endif
 
 /* Descriptor rings in uncached memory */
-static struct dwmac_dma_desc dwmac_tx_descs[NB_TX_DESCS] __desc_mem;
+static struct dwmac_dma_desc dwmac_tx_descs[NB_TX_QUEUES][NB_TX_DESCS] __desc_mem;
 static struct dwmac_dma_desc dwmac_rx_descs[NB_RX_DESCS] __desc_mem;
 
 void dwmac_platform_init(struct dwmac_priv *p)
 {
-	p->tx_descs = dwmac_tx_descs;
+	for (int q = 0; q < NB_TX_QUEUES; q++) {
+		p->tx_queues[q].descs = dwmac_tx_descs[q];
+	}
 	p->rx_descs = dwmac_rx_descs;
 
 	/* basic configuration for this platform */
@@ -159,6 +159,15 @@ static enum ethernet_hw_caps eth_nxp_enet_qos_get_capabilities(const struct devi
 	return ETHERNET_LINK_100BASE_T | ETHERNET_LINK_10BASE_T;
 }
 
+static void enet_qos_rx_irq_enable(enet_qos_t *base)
+{
+	unsigned int key = irq_lock();
+
+	base->DMA_CH[0].DMA_CHX_INT_EN |= ENET_QOS_REG_PREP(DMA_CH_DMA_CHX_INT_EN, RIE, 0b1);
+
+	irq_unlock(key);
+}
+
 static void eth_nxp_enet_qos_rx(struct k_work *work)
 {
 	struct nxp_enet_qos_rx_data *rx_data =
@@ -171,6 +180,12 @@ static void eth_nxp_enet_qos_rx(struct k_work *work)
 	struct net_buf *new_buf;
 	struct net_buf *buf;
 	size_t pkt_len;
+	sys_slist_t batch;
+	bool pending = false;
+	int count = 0;
+	int ret;
+
+	sys_slist_init(&batch);
 
 	/* We are going to find all of the descriptors we own and update them */
 	for (int i = 0; i < NUM_RX_BUFDESC; i++) {
@@ -181,12 +196,19 @@ static void eth_nxp_enet_qos_rx(struct k_work *work)
 			continue;
 		}
 
+		if (count == CONFIG_NET_RX_BATCH_BUDGET) {
+			/* Budget spent, let other work run and come back later */
+			pending = true;
+			break;
+		}
+
 		/* Otherwise, we found a packet that we need to process */
 		pkt = net_pkt_rx_alloc(K_NO_WAIT);
 
 		if (!pkt) {
 			LOG_ERR("Could not alloc RX pkt");
-			goto error;
+			eth_stats_update_errors_rx(data->iface);
+			break;
 		}
 
 		LOG_DBG("Created RX pkt %p", pkt);
@@ -203,7 +225,9 @@ static void eth_nxp_enet_qos_rx(struct k_work *work)
 			 * we don't know what the upper layer will do to our poor buffer.
 			 */
 			LOG_ERR("No RX buf available");
-			goto error;
+			net_pkt_unref(pkt);
+			eth_stats_update_errors_rx(data->iface);
+			break;
 		}
 
 		buf = data->rx.reserved_bufs[i];
@@ -212,17 +236,14 @@ static void eth_nxp_enet_qos_rx(struct k_work *work)
 		LOG_DBG("Receiving RX packet");
 
 		/* Finally, we have decided that it is time to wrap the buffer nicely
-		 * up within a packet, and try to send it. It's only one buffer,
+		 * up within a packet, and queue it to the batch. It's only one buffer,
 		 * thanks to ENET QOS hardware handing the fragmentation,
 		 * so the construction of the packet is very simple.
 		 */
 		net_buf_add(buf, pkt_len);
 		net_pkt_frag_insert(pkt, buf);
-		if (net_recv_data(data->iface, pkt)) {
-			LOG_ERR("RECV failed");
-			/* Quite a shame. */
-			goto error;
-		}
+		net_pkt_list_append(&batch, pkt);
+		count++;
 
 		LOG_DBG("Recycling RX buf");
 
@@ -235,11 +256,21 @@ static void eth_nxp_enet_qos_rx(struct k_work *work)
 		eth_stats_update_pkts_rx(data->iface);
 	}
 
-	return;
+	if (count > 0) {
+		ret = net_recv_data_batch(data->iface, &batch);
+		if (ret < count) {
+			LOG_ERR("RECV failed");
+			/* Quite a shame. */
+			eth_stats_update_errors_rx(data->iface);
+		}
+	}
 
-error:
-	net_pkt_unref(pkt);
-	eth_stats_update_errors_rx(data->iface);
+	if (pending) {
+		k_work_submit_to_queue(&rx_work_queue, &data->rx.rx_work);
+	} else {
+		/* Ring drained, go back to being interrupt driven */
+		enet_qos_rx_irq_enable(data->rx.base);
+	}
 }
 
 static void eth_nxp_enet_qos_mac_isr(const struct device *dev)
@@ -263,6 +294,11 @@ static void eth_nxp_enet_qos_mac_isr(const struct device *dev)
 			k_work_submit(&data->tx.tx_done_work);
 		}
 		if (ENET_QOS_REG_GET(DMA_CH_DMA_CHX_STAT, RI, dma_ch0_interrupts)) {
+			/* Interrupt mitigation, the RX work polls the ring with
+			 * the interrupt masked until it is drained.
+			 */
+			base->DMA_CH[0].DMA_CHX_INT_EN &=
+				~ENET_QOS_REG_PREP(DMA_CH_DMA_CHX_INT_EN, RIE, 0b1);
 			k_work_submit_to_queue(&rx_work_queue, &data->rx.rx_work);
 		}
 	}
@@ -553,6 +589,7 @@ static int eth_nxp_enet_qos_mac_init(const struct device *dev)
 	k_sem_init(&data->tx.tx_sem, 1, 1);
 
 	/* Work upon a reception of a packet to a buffer */
+	data->rx.base = base;
 	k_work_init(&data->rx.rx_work, eth_nxp_enet_qos_rx);
 
 	/* Work upon a complete transmission by a channel's TX DMA */
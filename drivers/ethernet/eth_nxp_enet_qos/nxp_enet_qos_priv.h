@@ -106,6 +106,7 @@ struct nxp_enet_qos_rx_data {
 	struct k_work rx_work;
 	volatile union nxp_enet_qos_rx_desc descriptors[NUM_RX_BUFDESC];
 	struct net_buf *reserved_bufs[NUM_RX_BUFDESC];
+	enet_qos_t *base;
 };
 
 struct nxp_enet_qos_mac_data {
@@ -805,12 +805,27 @@ out:
 	return pkt;
 }
 
+static void eth_rx_flush(struct eth_stm32_hal_dev_data *dev_data, sys_slist_t *batch,
+			 int count)
+{
+	int res;
+
+	res = net_recv_data_batch(NULL, batch);
+	if (res < count) {
+		eth_stats_update_errors_rx(get_iface(dev_data));
+		LOG_ERR("Failed to enqueue %d frame(s) into RX queue",
+			res < 0 ? count : count - res);
+	}
+}
+
 static void rx_thread(void *arg1, void *unused1, void *unused2)
 {
 	const struct device *dev;
 	struct eth_stm32_hal_dev_data *dev_data;
 	struct net_if *iface;
 	struct net_pkt *pkt;
+	sys_slist_t batch;
+	int count;
 	int res;
 	uint32_t status;
 	HAL_StatusTypeDef hal_ret = HAL_OK;
@@ -833,20 +848,29 @@ static void rx_thread(void *arg1, void *unused1, void *unused2)
 				dev_data->link_up = true;
 				net_eth_carrier_on(get_iface(dev_data));
 			}
+			/* Hand the frames to the stack in batches so that the
+			 * RX queue is locked and woken up once per batch.
+			 */
+			sys_slist_init(&batch);
+			count = 0;
+
 			while ((pkt = eth_rx(dev)) != NULL) {
 				iface = net_pkt_iface(pkt);
 #if defined(CONFIG_NET_DSA)
 				iface = dsa_net_recv(iface, &pkt);
 #endif
-				res = net_recv_data(iface, pkt);
-				if (res < 0) {
-					eth_stats_update_errors_rx(
-							net_pkt_iface(pkt));
-					LOG_ERR("Failed to enqueue frame "
-						"into RX queue: %d", res);
-					net_pkt_unref(pkt);
+				net_pkt_set_iface(pkt, iface);
+				net_pkt_list_append(&batch, pkt);
+
+				if (++count == CONFIG_NET_RX_BATCH_BUDGET) {
+					eth_rx_flush(dev_data, &batch, count);
+					count = 0;
 				}
 			}
+
+			if (count > 0) {
+				eth_rx_flush(dev_data, &batch, count);
+			}
 		} else if (res == -EAGAIN) {
 			/* semaphore timeout period expired, check link status */
 			hal_ret = read_eth_phy_register(&dev_data->heth,
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Read cache in front of the flash API.
+ *
+ * Small reads are served from a few lines, each holding an aligned block of
+ * CONFIG_FLASH_READ_CACHE_LINE_SIZE bytes of a device. A miss reads the whole
+ * line, so the data following, or preceding, the requested bytes is fetched
+ * by the same command sequence. Reads of at least a line bypass the cache.
+ * Writes and erases going through the flash API drop the lines they overlap.
+ */
+
+#include <string.h>
+
+#include <zephyr/drivers/flash.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#define LINE_SIZE CONFIG_FLASH_READ_CACHE_LINE_SIZE
+
+BUILD_ASSERT(IS_POWER_OF_TWO(LINE_SIZE), "the cache line size is not a power of two");
+
+struct flash_read_cache_line {
+	/* Device of the line, NULL if the line is invalid */
+	const struct device *dev;
+	off_t offset;
+	uint8_t data[LINE_SIZE] __aligned(4);
+};
+
+static struct flash_read_cache_line lines[CONFIG_FLASH_READ_CACHE_LINES];
+static unsigned int next_victim;
+static K_MUTEX_DEFINE(cache_lock);
+
+static struct flash_read_cache_line *cache_lookup(const struct device *dev, off_t offset)
+{
+	ARRAY_FOR_EACH_PTR(lines, line) {
+		if (line->dev == dev && line->offset == offset) {
+			return line;
+		}
+	}
+
+	return NULL;
+}
+
+static struct flash_read_cache_line *cache_fill(const struct device *dev, off_t offset)
+{
+	const struct flash_driver_api *api = (const struct flash_driver_api *)dev->api;
+	struct flash_read_cache_line *line = &lines[next_victim];
+
+	next_victim = (next_victim + 1U) % ARRAY_SIZE(lines);
+
+	line->dev = NULL;
+	if (api->read(dev, offset, line->data, LINE_SIZE) < 0) {
+		/* e.g. the line goes past the end of the device */
+		return NULL;
+	}
+
+	line->dev = dev;
+	line->offset = offset;
+
+	return line;
+}
+
+int z_flash_read_cache_read(const struct device *dev, off_t offset, void *data, size_t len)
+{
+	const struct flash_driver_api *api = (const struct flash_driver_api *)dev->api;
+	uint8_t *dst = data;
+	int rc = 0;
+
+	if (len >= LINE_SIZE || offset < 0) {
+		return api->read(dev, offset, data, len);
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	while (len > 0) {
+		off_t base = ROUND_DOWN(offset, LINE_SIZE);
+		size_t skip = offset - base;
+		size_t chunk = MIN(len, LINE_SIZE - skip);
+		struct flash_read_cache_line *line;
+
+		line = cache_lookup(dev, base);
+		if (line == NULL) {
+			line = cache_fill(dev, base);
+		}
+
+		if (line != NULL) {
+			memcpy(dst, &line->data[skip], chunk);
+		} else {
+			rc = api->read(dev, offset, dst, chunk);
+			if (rc < 0) {
+				break;
+			}
+		}
+
+		dst += chunk;
+		offset += chunk;
+		len -= chunk;
+	}
+
+	k_mutex_unlock(&cache_lock);
+
+	return rc;
+}
+
+void z_flash_read_cache_invalidate(const struct device *dev, off_t offset, size_t len)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	ARRAY_FOR_EACH_PTR(lines, line) {
+		if (line->dev != dev || line->offset + LINE_SIZE <= offset) {
+			continue;
+		}
+
+		if (line->offset < offset || (size_t)(line->offset - offset) < len) {
+			line->dev = NULL;
+		}
+	}
+
+	k_mutex_unlock(&cache_lock);
+}
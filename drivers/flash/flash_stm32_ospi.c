@@ -9,6 +9,7 @@
 
 #include <errno.h>
 #include <zephyr/kernel.h>
+#include <zephyr/cache.h>
 #include <zephyr/toolchain.h>
 #include <zephyr/arch/common/ffs.h>
 #include <zephyr/sys/util.h>
@@ -1324,6 +1325,8 @@ static int flash_stm32_ospi_read(const struct device *dev, off_t addr,
 	LOG_DBG("MemoryMapped Read offset: 0x%lx, len: %zu",
 		(long)(STM32_OSPI_BASE_ADDRESS + addr),
 		size);
+	/* Drop lines cached before a write or an erase done in indirect mode */
+	sys_cache_data_invd_range((uint8_t *)STM32_OSPI_BASE_ADDRESS + addr, size);
 	memcpy(data, (uint8_t *)STM32_OSPI_BASE_ADDRESS + addr, size);
 
 #else /* CONFIG_STM32_MEMMAP */
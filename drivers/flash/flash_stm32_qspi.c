@@ -10,6 +10,7 @@
 
 #include <errno.h>
 #include <zephyr/kernel.h>
+#include <zephyr/cache.h>
 #include <zephyr/toolchain.h>
 #include <zephyr/arch/common/ffs.h>
 #include <zephyr/sys/__assert.h>
@@ -485,6 +486,8 @@ static int flash_stm32_qspi_read(const struct device *dev, off_t addr,
 	uintptr_t mmap_addr = STM32_QSPI_BASE_ADDRESS + addr;
 
 	LOG_DBG("Memory-mapped read from 0x%08lx, len %zu", mmap_addr, size);
+	/* Drop lines cached before a write or an erase done in indirect mode */
+	sys_cache_data_invd_range((void *)mmap_addr, size);
 	memcpy(data, (void *)mmap_addr, size);
 	ret = 0;
 	goto end;
@@ -15,6 +15,7 @@
 
 #include <errno.h>
 #include <zephyr/kernel.h>
+#include <zephyr/cache.h>
 #include <soc.h>
 #include <zephyr/drivers/pinctrl.h>
 #include <zephyr/drivers/clock_control/stm32_clock_control.h>
@@ -1182,6 +1183,8 @@ static int flash_stm32_xspi_read(const struct device *dev, off_t addr,
 	uintptr_t mmap_addr = STM32_XSPI_BASE_ADDRESS + addr;
 
 	LOG_DBG("Memory-mapped read from 0x%08lx, len %zu", mmap_addr, size);
+	/* Drop lines cached before a write or an erase done in indirect mode */
+	sys_cache_data_invd_range((void *)mmap_addr, size);
 	memcpy(data, (void *)mmap_addr, size);
 	ret = 0;
 	goto read_end;
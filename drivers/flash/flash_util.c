@@ -58,6 +58,11 @@ int z_impl_flash_fill(const struct device *dev, uint8_t val, off_t offset,
 		}
 		stored += chunk;
 	}
+
+#if defined(CONFIG_FLASH_READ_CACHE)
+	z_flash_read_cache_invalidate(dev, offset, size);
+#endif /* CONFIG_FLASH_READ_CACHE */
+
 	return rc;
 }
 
@@ -70,7 +75,13 @@ int z_impl_flash_flatten(const struct device *dev, off_t offset, size_t size)
 #if IS_ENABLED(CONFIG_FLASH_HAS_EXPLICIT_ERASE)
 	if ((flash_params_get_erase_cap(params) & FLASH_ERASE_C_EXPLICIT) &&
 		api->erase != NULL) {
-		return api->erase(dev, offset, size);
+		int rc = api->erase(dev, offset, size);
+
+#if defined(CONFIG_FLASH_READ_CACHE)
+		z_flash_read_cache_invalidate(dev, offset, size);
+#endif /* CONFIG_FLASH_READ_CACHE */
+
+		return rc;
 	}
 #endif
 
@@ -58,11 +58,95 @@ void i2c_rtio_init(struct i2c_rtio *ctx, const struct device *dev)
 	mpsc_init(&ctx->io_q);
 	ctx->txn_curr = NULL;
 	ctx->txn_head = NULL;
+#ifdef CONFIG_I2C_RTIO_BATCH_RESTART
+	ctx->txn_next = NULL;
+	ctx->batch_stop = false;
+	ctx->batch_restart = false;
+	ctx->next_restart = false;
+#endif
 	ctx->dt_spec.bus = dev;
 	ctx->iodev.data = &ctx->dt_spec;
 	ctx->iodev.api = &i2c_iodev_api;
 }
 
+#ifdef CONFIG_I2C_RTIO_BATCH_RESTART
+static bool i2c_rtio_is_msg(const struct rtio_sqe *sqe)
+{
+	return sqe->op == RTIO_OP_RX || sqe->op == RTIO_OP_TX || sqe->op == RTIO_OP_TINY_TX;
+}
+
+/**
+ * @private
+ * @brief Join the next queued transaction to the current one with a repeated start
+ *
+ * Called with the spinlock held once the last message of the current
+ * transaction is about to be started. If another transaction is already
+ * queued, the stop condition ending the current transaction is replaced by a
+ * repeated start beginning the next one, saving the bus idle time and an
+ * interrupt in between. Only messages are joined, configure and recover
+ * requests always see an idle bus.
+ */
+static void i2c_rtio_batch(struct i2c_rtio *ctx)
+{
+	struct rtio_sqe *last = &ctx->txn_curr->sqe;
+	struct rtio_sqe *first;
+	struct mpsc_node *next;
+
+	if (ctx->txn_next != NULL || !i2c_rtio_is_msg(last) ||
+	    (last->iodev_flags & RTIO_IODEV_I2C_STOP) == 0) {
+		return;
+	}
+
+	next = mpsc_pop(&ctx->io_q);
+	if (next == NULL) {
+		return;
+	}
+
+	ctx->txn_next = CONTAINER_OF(next, struct rtio_iodev_sqe, q);
+	first = &ctx->txn_next->sqe;
+	if (!i2c_rtio_is_msg(first)) {
+		return;
+	}
+
+	last->iodev_flags &= ~RTIO_IODEV_I2C_STOP;
+	ctx->batch_stop = true;
+	ctx->next_restart = (first->iodev_flags & RTIO_IODEV_I2C_RESTART) == 0;
+	first->iodev_flags |= RTIO_IODEV_I2C_RESTART;
+
+#ifdef CONFIG_I2C_RTIO_STATS
+	ctx->stats.restarts++;
+#endif
+}
+
+/**
+ * @private
+ * @brief Give back the flags changed by i2c_rtio_batch() before completing a transaction
+ *
+ * The submissions may be reused by their owner, e.g. multishot ones, so they
+ * are completed as they were submitted. On error the transaction joined to
+ * the failed one is started on its own instead.
+ */
+static void i2c_rtio_unbatch(struct i2c_rtio *ctx, bool error)
+{
+	if (ctx->batch_stop) {
+		ctx->txn_curr->sqe.iodev_flags |= RTIO_IODEV_I2C_STOP;
+		ctx->batch_stop = false;
+	}
+
+	if (ctx->batch_restart) {
+		ctx->txn_head->sqe.iodev_flags &= ~RTIO_IODEV_I2C_RESTART;
+	}
+
+	ctx->batch_restart = ctx->next_restart;
+	ctx->next_restart = false;
+
+	if (error && ctx->batch_restart) {
+		ctx->txn_next->sqe.iodev_flags &= ~RTIO_IODEV_I2C_RESTART;
+		ctx->batch_restart = false;
+	}
+}
+#endif /* CONFIG_I2C_RTIO_BATCH_RESTART */
+
 /**
  * @private
  * @brief Setup the next transaction (could be a single op) if needed
@@ -73,6 +157,7 @@ void i2c_rtio_init(struct i2c_rtio *ctx, const struct device *dev)
 static bool i2c_rtio_next(struct i2c_rtio *ctx, bool completion)
 {
 	k_spinlock_key_t key = k_spin_lock(&ctx->slock);
+	struct mpsc_node *next;
 
 	/* Already working on something, bail early */
 	if (!completion && ctx->txn_head != NULL) {
@@ -80,19 +165,51 @@ static bool i2c_rtio_next(struct i2c_rtio *ctx, bool completion)
 		return false;
 	}
 
-	struct mpsc_node *next = mpsc_pop(&ctx->io_q);
+#ifdef CONFIG_I2C_RTIO_BATCH_RESTART
+	if (ctx->txn_next != NULL) {
+		ctx->txn_head = ctx->txn_next;
+		ctx->txn_curr = ctx->txn_head;
+		ctx->txn_next = NULL;
+		goto start;
+	}
+#endif
+
+	next = mpsc_pop(&ctx->io_q);
 
 	/* Nothing left to do */
 	if (next == NULL) {
+#ifdef CONFIG_I2C_RTIO_STATS
+		if (ctx->txn_head != NULL) {
+			ctx->stats.busy_cycles += k_cycle_get_32() - ctx->busy_start;
+		}
+#endif
 		ctx->txn_head = NULL;
 		ctx->txn_curr = NULL;
 		k_spin_unlock(&ctx->slock, key);
 		return false;
 	}
 
+#ifdef CONFIG_I2C_RTIO_STATS
+	if (ctx->txn_head == NULL) {
+		ctx->busy_start = k_cycle_get_32();
+	}
+#endif
+
 	ctx->txn_head = CONTAINER_OF(next, struct rtio_iodev_sqe, q);
 	ctx->txn_curr = ctx->txn_head;
 
+#ifdef CONFIG_I2C_RTIO_BATCH_RESTART
+start:
+	if (rtio_txn_next(ctx->txn_curr) == NULL) {
+		i2c_rtio_batch(ctx);
+	}
+#endif
+
+#ifdef CONFIG_I2C_RTIO_STATS
+	ctx->stats.transactions++;
+	ctx->stats.messages++;
+#endif
+
 	k_spin_unlock(&ctx->slock, key);
 
 	return true;
@@ -102,19 +219,64 @@ bool i2c_rtio_complete(struct i2c_rtio *ctx, int status)
 {
 	/* On error bail */
 	if (status < 0) {
+#ifdef CONFIG_I2C_RTIO_STATS
+		ctx->stats.errors++;
+#endif
+#ifdef CONFIG_I2C_RTIO_BATCH_RESTART
+		i2c_rtio_unbatch(ctx, true);
+#endif
 		rtio_iodev_sqe_err(ctx->txn_head, status);
 		return i2c_rtio_next(ctx, true);
 	}
 
 	/* Try for next submission in the transaction */
-	ctx->txn_curr = rtio_txn_next(ctx->txn_curr);
-	if (ctx->txn_curr) {
+	if (rtio_txn_next(ctx->txn_curr)) {
+		ctx->txn_curr = rtio_txn_next(ctx->txn_curr);
+#if defined(CONFIG_I2C_RTIO_BATCH_RESTART) || defined(CONFIG_I2C_RTIO_STATS)
+		k_spinlock_key_t key = k_spin_lock(&ctx->slock);
+
+#ifdef CONFIG_I2C_RTIO_BATCH_RESTART
+		if (rtio_txn_next(ctx->txn_curr) == NULL) {
+			i2c_rtio_batch(ctx);
+		}
+#endif
+#ifdef CONFIG_I2C_RTIO_STATS
+		ctx->stats.messages++;
+#endif
+		k_spin_unlock(&ctx->slock, key);
+#endif
 		return true;
 	}
 
+#ifdef CONFIG_I2C_RTIO_BATCH_RESTART
+	i2c_rtio_unbatch(ctx, false);
+#endif
 	rtio_iodev_sqe_ok(ctx->txn_head, status);
 	return i2c_rtio_next(ctx, true);
 }
+
+#ifdef CONFIG_I2C_RTIO_STATS
+void i2c_rtio_stats_get(struct i2c_rtio *ctx, struct i2c_rtio_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&ctx->slock);
+
+	*stats = ctx->stats;
+	if (ctx->txn_head != NULL) {
+		stats->busy_cycles += k_cycle_get_32() - ctx->busy_start;
+	}
+	k_spin_unlock(&ctx->slock, key);
+}
+
+void i2c_rtio_stats_reset(struct i2c_rtio *ctx)
+{
+	k_spinlock_key_t key = k_spin_lock(&ctx->slock);
+
+	ctx->stats = (struct i2c_rtio_stats){0};
+	ctx->busy_start = k_cycle_get_32();
+	k_spin_unlock(&ctx->slock, key);
+}
+#endif /* CONFIG_I2C_RTIO_STATS */
+
 bool i2c_rtio_submit(struct i2c_rtio *ctx, struct rtio_iodev_sqe *iodev_sqe)
 {
 	mpsc_push(&ctx->io_q, &iodev_sqe->q);
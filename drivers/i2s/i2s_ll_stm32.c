@@ -468,6 +468,11 @@ static int i2s_stm32_write(const struct device *dev, void *mem_block,
 		return ret;
 	}
 
+	/* Assure cache coherency before DMA read operation, here rather than
+	 * in the DMA callback so the next block is started without delay.
+	 */
+	sys_cache_data_flush_range(mem_block, size);
+
 	/* Add data to the end of the TX queue */
 	queue_put(&dev_data->tx.mem_block_queue, mem_block, size);
 
@@ -615,6 +620,12 @@ rx_disable:
 	rx_stream_disable(stream, dev);
 }
 
+/*
+ * TX blocks are sent straight from the slab, one DMA transfer each, and the
+ * next transfer is started from here. A cyclic transfer over a ring would not
+ * depend on this callback running in time, but every block would have to be
+ * copied into the ring at the half and full transfer callbacks.
+ */
 static void dma_tx_callback(const struct device *dma_dev, void *arg,
 			    uint32_t channel, int status)
 {
@@ -622,6 +633,7 @@ static void dma_tx_callback(const struct device *dma_dev, void *arg,
 	const struct i2s_stm32_cfg *cfg = dev->config;
 	struct i2s_stm32_data *const dev_data = dev->data;
 	struct stream *stream = &dev_data->tx;
+	void *mblk_sent = NULL;
 	size_t mem_block_size;
 	int ret;
 
@@ -633,8 +645,8 @@ static void dma_tx_callback(const struct device *dma_dev, void *arg,
 
 	__ASSERT_NO_MSG(stream->mem_block != NULL);
 
-	/* All block data sent */
-	k_mem_slab_free(stream->cfg.mem_slab, stream->mem_block);
+	/* All block data sent, the block is freed once the next one is started */
+	mblk_sent = stream->mem_block;
 	stream->mem_block = NULL;
 
 	/* Stop transmission if there was an error */
@@ -684,9 +696,6 @@ static void dma_tx_callback(const struct device *dma_dev, void *arg,
 	}
 	k_sem_give(&stream->sem);
 
-	/* Assure cache coherency before DMA read operation */
-	sys_cache_data_flush_range(stream->mem_block, mem_block_size);
-
 	ret = reload_dma(stream->dev_dma, stream->dma_channel,
 			&stream->dma_cfg,
 			stream->mem_block,
@@ -701,9 +710,14 @@ static void dma_tx_callback(const struct device *dma_dev, void *arg,
 		goto tx_disable;
 	}
 
+	k_mem_slab_free(stream->cfg.mem_slab, mblk_sent);
+
 	return;
 
 tx_disable:
+	if (mblk_sent != NULL) {
+		k_mem_slab_free(stream->cfg.mem_slab, mblk_sent);
+	}
 	tx_stream_disable(stream, dev);
 }
 
@@ -845,9 +859,6 @@ static int tx_stream_start(struct stream *stream, const struct device *dev)
 	}
 	k_sem_give(&stream->sem);
 
-	/* Assure cache coherency before DMA read operation */
-	sys_cache_data_flush_range(stream->mem_block, mem_block_size);
-
 	if (stream->master) {
 		LL_I2S_SetTransferMode(cfg->i2s, LL_I2S_MODE_MASTER_TX);
 	} else {
@@ -48,23 +48,25 @@ struct ws2812_i2s_cfg {
 	uint8_t nibble_zero;
 };
 
-/* Serialize an 8-bit color channel value into two 16-bit I2S values (or 1 32-bit
- * word).
- */
-static inline void ws2812_i2s_ser(uint32_t *word, uint8_t color, const uint8_t sym_one,
-				  const uint8_t sym_zero)
+/* Build the 16-bit I2S value of each 4-bit color value, LSbit in the lowest symbol. */
+static void ws2812_i2s_nibbles(uint16_t nibbles[16], const uint8_t sym_one,
+			       const uint8_t sym_zero)
 {
-	*word = 0;
-	for (uint16_t i = 0; i < 8; i++) {
-		if ((1 << i) & color) {
-			*word |= sym_one << (i * 4);
-		} else {
-			*word |= sym_zero << (i * 4);
+	for (uint16_t v = 0; v < 16; v++) {
+		nibbles[v] = 0;
+		for (uint16_t i = 0; i < 4; i++) {
+			nibbles[v] |= ((v & BIT(i)) ? sym_one : sym_zero) << (i * 4);
 		}
 	}
+}
 
-	/* Swap the two I2S values due to the (audio) channel TX order. */
-	*word = (*word >> 16) | (*word << 16);
+/* Serialize an 8-bit color channel value into two 16-bit I2S values (or 1 32-bit
+ * word).
+ */
+static inline void ws2812_i2s_ser(uint32_t *word, uint8_t color, const uint16_t nibbles[16])
+{
+	/* The two I2S values are swapped due to the (audio) channel TX order. */
+	*word = nibbles[color >> 4] | ((uint32_t)nibbles[color & 0x0F] << 16);
 }
 
 static int ws2812_strip_update_rgb(const struct device *dev, struct led_rgb *pixels,
@@ -72,6 +74,7 @@ static int ws2812_strip_update_rgb(const struct device *dev, struct led_rgb *pix
 {
 	const struct ws2812_i2s_cfg *cfg = dev->config;
 	uint8_t sym_one, sym_zero;
+	uint16_t nibbles[16];
 	uint32_t reset_word;
 	uint32_t *tx_buf;
 	uint32_t flush_time_us;
@@ -88,6 +91,8 @@ static int ws2812_strip_update_rgb(const struct device *dev, struct led_rgb *pix
 		reset_word = 0;
 	}
 
+	ws2812_i2s_nibbles(nibbles, sym_one, sym_zero);
+
 	/* Acquire memory for the I2S payload. */
 	ret = k_mem_slab_alloc(cfg->mem_slab, &mem_block, K_SECONDS(10));
 	if (ret < 0) {
@@ -127,7 +132,7 @@ static int ws2812_strip_update_rgb(const struct device *dev, struct led_rgb *pix
 			default:
 				return -EINVAL;
 			}
-			ws2812_i2s_ser(tx_buf, pixel, sym_one, sym_zero);
+			ws2812_i2s_ser(tx_buf, pixel, nibbles);
 			tx_buf++;
 		}
 	}
@@ -47,6 +47,21 @@ struct ws2812_spi_cfg {
 	uint16_t reset_delay;
 };
 
+struct ws2812_spi_data {
+	/* SPI frames of each 4-bit value, MSbit first */
+	uint8_t nibble_frames[16][4];
+	struct spi_buf buf;
+	struct spi_buf_set tx;
+	atomic_t busy;
+	/* End of the reset delay latching the last asynchronous update */
+	k_timepoint_t latch_end;
+#ifdef CONFIG_SPI_ASYNC
+	const struct device *dev;
+	led_strip_update_cb_t cb;
+	void *user_data;
+#endif
+};
+
 static const struct ws2812_spi_cfg *dev_cfg(const struct device *dev)
 {
 	return dev->config;
@@ -57,14 +72,11 @@ static const struct ws2812_spi_cfg *dev_cfg(const struct device *dev)
  * of SPI frames, MSbit first, where a one bit becomes SPI frame
  * one_frame, and zero bit becomes zero_frame.
  */
-static inline void ws2812_spi_ser(uint8_t buf[8], uint8_t color,
-				  const uint8_t one_frame, const uint8_t zero_frame)
+static inline void ws2812_spi_ser(const struct ws2812_spi_data *data, uint8_t buf[8],
+				  uint8_t color)
 {
-	int i;
-
-	for (i = 0; i < 8; i++) {
-		buf[i] = color & BIT(7 - i) ? one_frame : zero_frame;
-	}
+	memcpy(&buf[0], data->nibble_frames[color >> 4], 4);
+	memcpy(&buf[4], data->nibble_frames[color & 0x0f], 4);
 }
 
 /*
@@ -75,28 +87,18 @@ static inline void ws2812_reset_delay(uint16_t delay)
 	k_usleep(delay);
 }
 
-static int ws2812_strip_update_rgb(const struct device *dev,
-				   struct led_rgb *pixels,
-				   size_t num_pixels)
+/*
+ * Convert pixel data into SPI frames. Each frame has pixel data
+ * in color mapping on-wire format (e.g. GRB, GRBW, RGB, etc).
+ */
+static int ws2812_spi_encode(const struct device *dev, size_t offset,
+			     const struct led_rgb *pixels, size_t num_pixels)
 {
 	const struct ws2812_spi_cfg *cfg = dev_cfg(dev);
-	const uint8_t one = cfg->one_frame, zero = cfg->zero_frame;
-	struct spi_buf buf = {
-		.buf = cfg->px_buf,
-		.len = (cfg->length * 8 * cfg->num_colors),
-	};
-	const struct spi_buf_set tx = {
-		.buffers = &buf,
-		.count = 1
-	};
-	uint8_t *px_buf = cfg->px_buf;
+	const struct ws2812_spi_data *data = dev->data;
+	uint8_t *px_buf = cfg->px_buf + offset * 8 * cfg->num_colors;
 	size_t i;
-	int rc;
 
-	/*
-	 * Convert pixel data into SPI frames. Each frame has pixel data
-	 * in color mapping on-wire format (e.g. GRB, GRBW, RGB, etc).
-	 */
 	for (i = 0; i < num_pixels; i++) {
 		uint8_t j;
 
@@ -120,20 +122,90 @@ static int ws2812_strip_update_rgb(const struct device *dev,
 			default:
 				return -EINVAL;
 			}
-			ws2812_spi_ser(px_buf, pixel, one, zero);
+			ws2812_spi_ser(data, px_buf, pixel);
 			px_buf += 8;
 		}
 	}
 
+	return 0;
+}
+
+#ifdef CONFIG_SPI_ASYNC
+static void ws2812_spi_done(const struct device *spi, int result, void *arg)
+{
+	const struct device *dev = arg;
+	struct ws2812_spi_data *data = dev->data;
+	led_strip_update_cb_t cb = data->cb;
+	void *user_data = data->user_data;
+
+	ARG_UNUSED(spi);
+
+	data->latch_end = sys_timepoint_calc(K_USEC(dev_cfg(dev)->reset_delay));
+	atomic_clear(&data->busy);
+
+	cb(dev, result, user_data);
+}
+#endif
+
+static int ws2812_strip_update_rgb_range(const struct device *dev, size_t offset,
+					 struct led_rgb *pixels, size_t num_pixels,
+					 led_strip_update_cb_t cb, void *user_data)
+{
+	const struct ws2812_spi_cfg *cfg = dev_cfg(dev);
+	struct ws2812_spi_data *data = dev->data;
+	int rc;
+
+	/* The frame buffer is read by the transfer in flight */
+	if (!atomic_cas(&data->busy, 0, 1)) {
+		return -EBUSY;
+	}
+
+	rc = ws2812_spi_encode(dev, offset, pixels, num_pixels);
+	if (rc < 0) {
+		atomic_clear(&data->busy);
+		return rc;
+	}
+
+	if (!sys_timepoint_expired(data->latch_end)) {
+		k_sleep(sys_timepoint_timeout(data->latch_end));
+	}
+
+#ifdef CONFIG_SPI_ASYNC
+	if (cb != NULL) {
+		data->cb = cb;
+		data->user_data = user_data;
+
+		rc = spi_transceive_cb(cfg->bus.bus, &cfg->bus.config, &data->tx, NULL,
+				       ws2812_spi_done, (void *)dev);
+		if (rc < 0) {
+			atomic_clear(&data->busy);
+		}
+
+		return rc;
+	}
+#endif
+
 	/*
 	 * Display the pixel data.
 	 */
-	rc = spi_write_dt(&cfg->bus, &tx);
+	rc = spi_write_dt(&cfg->bus, &data->tx);
 	ws2812_reset_delay(cfg->reset_delay);
+	atomic_clear(&data->busy);
+
+	if (rc == 0 && cb != NULL) {
+		cb(dev, 0, user_data);
+	}
 
 	return rc;
 }
 
+static int ws2812_strip_update_rgb(const struct device *dev,
+				   struct led_rgb *pixels,
+				   size_t num_pixels)
+{
+	return ws2812_strip_update_rgb_range(dev, 0, pixels, num_pixels, NULL, NULL);
+}
+
 static size_t ws2812_strip_length(const struct device *dev)
 {
 	const struct ws2812_spi_cfg *cfg = dev_cfg(dev);
@@ -144,6 +216,7 @@ static size_t ws2812_strip_length(const struct device *dev)
 static int ws2812_spi_init(const struct device *dev)
 {
 	const struct ws2812_spi_cfg *cfg = dev_cfg(dev);
+	struct ws2812_spi_data *data = dev->data;
 	uint8_t i;
 
 	if (!spi_is_ready_dt(&cfg->bus)) {
@@ -166,12 +239,25 @@ static int ws2812_spi_init(const struct device *dev)
 		}
 	}
 
+	for (i = 0; i < ARRAY_SIZE(data->nibble_frames); i++) {
+		for (uint8_t bit = 0; bit < 4; bit++) {
+			data->nibble_frames[i][bit] = i & BIT(3 - bit) ? cfg->one_frame
+								      : cfg->zero_frame;
+		}
+	}
+
+	data->buf.buf = cfg->px_buf;
+	data->buf.len = cfg->length * 8 * cfg->num_colors;
+	data->tx.buffers = &data->buf;
+	data->tx.count = 1;
+
 	return 0;
 }
 
 static const struct led_strip_driver_api ws2812_spi_api = {
 	.update_rgb = ws2812_strip_update_rgb,
 	.length = ws2812_strip_length,
+	.update_rgb_range = ws2812_strip_update_rgb_range,
 };
 
 #define WS2812_SPI_NUM_PIXELS(idx) \
@@ -201,6 +287,7 @@ static const struct led_strip_driver_api ws2812_spi_api = {
 #define WS2812_SPI_DEVICE(idx)						 \
 									 \
 	static uint8_t ws2812_spi_##idx##_px_buf[WS2812_SPI_BUFSZ(idx)]; \
+	static struct ws2812_spi_data ws2812_spi_##idx##_data;		 \
 									 \
 	WS2812_COLOR_MAPPING(idx);					 \
 									 \
@@ -218,7 +305,7 @@ static const struct led_strip_driver_api ws2812_spi_api = {
 	DEVICE_DT_INST_DEFINE(idx,					 \
 			      ws2812_spi_init,				 \
 			      NULL,					 \
-			      NULL,					 \
+			      &ws2812_spi_##idx##_data,			 \
 			      &ws2812_spi_##idx##_cfg,			 \
 			      POST_KERNEL,				 \
 			      CONFIG_LED_STRIP_INIT_PRIORITY,		 \
@@ -26,6 +26,15 @@ struct mipi_dbi_spi_data {
 	/* Used for 3 wire mode */
 	uint16_t spi_byte;
 	struct k_mutex lock;
+#ifdef CONFIG_MIPI_DBI_SPI_ASYNC
+	/* Available while no asynchronous write is in flight */
+	struct k_sem idle;
+	/* Buffer of the asynchronous write, used until it completes */
+	struct spi_buf async_buffer;
+	struct spi_buf_set async_buf_set;
+	mipi_dbi_write_cb_t async_cb;
+	void *async_user_data;
+#endif
 };
 
 /* Expands to 1 if the node does not have the `write-only` property */
@@ -45,6 +54,27 @@ uint32_t var = MIPI_DBI_SPI_READ_REQUIRED;
  */
 #define MIPI_DBI_DC_BIT BIT(9)
 
+/* Wait for the asynchronous write in flight, if any, to complete before
+ * using the bus. Must be called with the lock held.
+ */
+static inline void mipi_dbi_spi_wait_idle(struct mipi_dbi_spi_data *data)
+{
+#ifdef CONFIG_MIPI_DBI_SPI_ASYNC
+	(void)k_sem_take(&data->idle, K_FOREVER);
+#else
+	ARG_UNUSED(data);
+#endif
+}
+
+static inline void mipi_dbi_spi_set_idle(struct mipi_dbi_spi_data *data)
+{
+#ifdef CONFIG_MIPI_DBI_SPI_ASYNC
+	k_sem_give(&data->idle);
+#else
+	ARG_UNUSED(data);
+#endif
+}
+
 static int mipi_dbi_spi_write_helper(const struct device *dev,
 				     const struct mipi_dbi_config *dbi_config,
 				     bool cmd_present, uint8_t cmd,
@@ -63,6 +93,7 @@ static int mipi_dbi_spi_write_helper(const struct device *dev,
 	if (ret < 0) {
 		return ret;
 	}
+	mipi_dbi_spi_wait_idle(data);
 
 	if (dbi_config->mode == MIPI_DBI_MODE_SPI_3WIRE &&
 	    IS_ENABLED(CONFIG_MIPI_DBI_SPI_3WIRE)) {
@@ -71,7 +102,8 @@ static int mipi_dbi_spi_write_helper(const struct device *dev,
 		 */
 		if ((dbi_config->config.operation & SPI_WORD_SIZE_MASK)
 		    != SPI_WORD_SET(9)) {
-			return -ENOTSUP;
+			ret = -ENOTSUP;
+			goto out;
 		}
 		buffer.buf = &data->spi_byte;
 		buffer.len = 2;
@@ -129,6 +161,7 @@ static int mipi_dbi_spi_write_helper(const struct device *dev,
 		ret = -ENOTSUP;
 	}
 out:
+	mipi_dbi_spi_set_idle(data);
 	k_mutex_unlock(&data->lock);
 	return ret;
 }
@@ -154,6 +187,84 @@ static int mipi_dbi_spi_write_display(const struct device *dev,
 					 framebuf, desc->buf_size);
 }
 
+#ifdef CONFIG_MIPI_DBI_SPI_ASYNC
+
+static void mipi_dbi_spi_write_done(const struct device *spi_dev, int result,
+				    void *user_data)
+{
+	const struct device *dev = user_data;
+	struct mipi_dbi_spi_data *data = dev->data;
+	mipi_dbi_write_cb_t cb = data->async_cb;
+
+	ARG_UNUSED(spi_dev);
+
+	if (result < 0) {
+		LOG_ERR("Display write failed (%d)", result);
+	}
+
+	cb(dev, result, data->async_user_data);
+	k_sem_give(&data->idle);
+}
+
+static int mipi_dbi_spi_write_display_async(const struct device *dev,
+					    const struct mipi_dbi_config *dbi_config,
+					    const uint8_t *framebuf,
+					    struct display_buffer_descriptor *desc,
+					    enum display_pixel_format pixfmt,
+					    mipi_dbi_write_cb_t cb,
+					    void *user_data)
+{
+	const struct mipi_dbi_spi_config *config = dev->config;
+	const struct spi_driver_api *spi_api = config->spi_dev->api;
+	struct mipi_dbi_spi_data *data = dev->data;
+	int ret;
+
+	/* 3 wire mode packs every byte with its command/data bit, and not
+	 * every SPI controller can transfer asynchronously.
+	 */
+	if (dbi_config->mode != MIPI_DBI_MODE_SPI_4WIRE ||
+	    spi_api->transceive_async == NULL) {
+		ret = mipi_dbi_spi_write_display(dev, dbi_config, framebuf,
+						 desc, pixfmt);
+		if (ret == 0) {
+			cb(dev, 0, user_data);
+		}
+		return ret;
+	}
+
+	if (desc->buf_size == 0) {
+		cb(dev, 0, user_data);
+		return 0;
+	}
+
+	ret = k_mutex_lock(&data->lock, K_FOREVER);
+	if (ret < 0) {
+		return ret;
+	}
+	mipi_dbi_spi_wait_idle(data);
+
+	data->async_cb = cb;
+	data->async_user_data = user_data;
+	data->async_buffer.buf = (void *)framebuf;
+	data->async_buffer.len = desc->buf_size;
+	data->async_buf_set.buffers = &data->async_buffer;
+	data->async_buf_set.count = 1;
+
+	/* Set CD pin high for data */
+	gpio_pin_set_dt(&config->cmd_data, 1);
+	ret = spi_transceive_cb(config->spi_dev, &dbi_config->config,
+				&data->async_buf_set, NULL,
+				mipi_dbi_spi_write_done, (void *)dev);
+	if (ret < 0) {
+		mipi_dbi_spi_set_idle(data);
+	}
+
+	k_mutex_unlock(&data->lock);
+	return ret;
+}
+
+#endif /* CONFIG_MIPI_DBI_SPI_ASYNC */
+
 #if MIPI_DBI_SPI_READ_REQUIRED
 
 static int mipi_dbi_spi_command_read(const struct device *dev,
@@ -175,6 +286,7 @@ static int mipi_dbi_spi_command_read(const struct device *dev,
 	if (ret < 0) {
 		return ret;
 	}
+	mipi_dbi_spi_wait_idle(data);
 	memcpy(&tmp_config, &dbi_config->config, sizeof(tmp_config));
 	if (dbi_config->mode == MIPI_DBI_MODE_SPI_3WIRE &&
 	    IS_ENABLED(CONFIG_MIPI_DBI_SPI_3WIRE)) {
@@ -239,6 +351,7 @@ static int mipi_dbi_spi_command_read(const struct device *dev,
 	}
 out:
 	spi_release(config->spi_dev, &tmp_config);
+	mipi_dbi_spi_set_idle(data);
 	k_mutex_unlock(&data->lock);
 	return ret;
 }
@@ -271,8 +384,20 @@ static int mipi_dbi_spi_release(const struct device *dev,
 				const struct mipi_dbi_config *dbi_config)
 {
 	const struct mipi_dbi_spi_config *config = dev->config;
+	struct mipi_dbi_spi_data *data = dev->data;
+	int ret;
 
-	return spi_release(config->spi_dev, &dbi_config->config);
+	ret = k_mutex_lock(&data->lock, K_FOREVER);
+	if (ret < 0) {
+		return ret;
+	}
+	mipi_dbi_spi_wait_idle(data);
+
+	ret = spi_release(config->spi_dev, &dbi_config->config);
+
+	mipi_dbi_spi_set_idle(data);
+	k_mutex_unlock(&data->lock);
+	return ret;
 }
 
 static int mipi_dbi_spi_init(const struct device *dev)
@@ -309,6 +434,9 @@ static int mipi_dbi_spi_init(const struct device *dev)
 	}
 
 	k_mutex_init(&data->lock);
+#ifdef CONFIG_MIPI_DBI_SPI_ASYNC
+	k_sem_init(&data->idle, 1, 1);
+#endif
 
 	return 0;
 }
@@ -318,6 +446,9 @@ static struct mipi_dbi_driver_api mipi_dbi_spi_driver_api = {
 	.command_write = mipi_dbi_spi_command_write,
 	.write_display = mipi_dbi_spi_write_display,
 	.release = mipi_dbi_spi_release,
+#ifdef CONFIG_MIPI_DBI_SPI_ASYNC
+	.write_display_async = mipi_dbi_spi_write_display_async,
+#endif
 #if MIPI_DBI_SPI_READ_REQUIRED
 	.command_read = mipi_dbi_spi_command_read,
 #endif
@@ -8,6 +8,9 @@
 
 #include <zephyr/drivers/sensor.h>
 #include <zephyr/dsp/types.h>
+#ifdef CONFIG_SENSOR_DECODE_DSP
+#include <zephyr/dsp/dsp.h>
+#endif
 #include <zephyr/logging/log.h>
 
 LOG_MODULE_REGISTER(sensor_compat, CONFIG_SENSOR_LOG_LEVEL);
@@ -505,3 +508,106 @@ const struct sensor_decoder_api __sensor_default_decoder = {
 	.get_size_info = sensor_natively_supported_channel_size_info,
 	.decode = decode,
 };
+
+/* Number of frames decoded at once when a decoder has no bulk decode function */
+#define SOA_FALLBACK_FRAMES 8
+
+static int decode_soa_fallback(const struct sensor_decoder_api *decoder, const uint8_t *buffer,
+			       struct sensor_chan_spec channel, uint32_t *fit, uint16_t max_count,
+			       struct sensor_soa_data *data_out)
+{
+	union {
+		struct sensor_three_axis_data three_axis;
+		struct sensor_q31_data q31;
+		uint8_t raw[sizeof(struct sensor_three_axis_data) +
+			    (SOA_FALLBACK_FRAMES - 1) * sizeof(struct sensor_three_axis_sample_data)];
+	} chunk;
+	size_t base_size, frame_size;
+	uint16_t count = 0;
+	bool three_axis;
+	int rc;
+
+	rc = decoder->get_size_info(channel, &base_size, &frame_size);
+	if (rc != 0) {
+		return rc;
+	}
+
+	if (base_size == sizeof(struct sensor_three_axis_data) &&
+	    frame_size == sizeof(struct sensor_three_axis_sample_data)) {
+		three_axis = true;
+	} else if (base_size == sizeof(struct sensor_q31_data) &&
+		   frame_size == sizeof(struct sensor_q31_sample_data)) {
+		three_axis = false;
+	} else {
+		return -ENOTSUP;
+	}
+
+	while (count < max_count) {
+		uint16_t n = MIN(max_count - count, SOA_FALLBACK_FRAMES);
+
+		rc = decoder->decode(buffer, channel, fit, n, &chunk);
+		if (rc <= 0) {
+			break;
+		}
+
+		if (count == 0) {
+			data_out->header.base_timestamp_ns =
+				chunk.three_axis.header.base_timestamp_ns;
+			data_out->shift = three_axis ? chunk.three_axis.shift : chunk.q31.shift;
+		}
+
+		for (int i = 0; i < rc; i++, count++) {
+			if (three_axis) {
+				const struct sensor_three_axis_sample_data *s =
+					&chunk.three_axis.readings[i];
+
+				data_out->values[0][count] = s->x;
+				data_out->values[1][count] = s->y;
+				data_out->values[2][count] = s->z;
+				if (data_out->timestamp_delta != NULL) {
+					data_out->timestamp_delta[count] = s->timestamp_delta;
+				}
+			} else {
+				data_out->values[0][count] = chunk.q31.readings[i].value;
+				if (data_out->timestamp_delta != NULL) {
+					data_out->timestamp_delta[count] =
+						chunk.q31.readings[i].timestamp_delta;
+				}
+			}
+		}
+
+		/* A short chunk means the end of the buffer */
+		if (rc < n) {
+			break;
+		}
+	}
+
+	if (count == 0) {
+		return rc;
+	}
+
+	data_out->header.reading_count = count;
+	return count;
+}
+
+int sensor_decode_soa(const struct sensor_decoder_api *decoder, const uint8_t *buffer,
+		      struct sensor_chan_spec channel, uint32_t *fit, uint16_t max_count,
+		      struct sensor_soa_data *data_out)
+{
+	if (decoder->decode_soa != NULL) {
+		return decoder->decode_soa(buffer, channel, fit, max_count, data_out);
+	}
+
+	return decode_soa_fallback(decoder, buffer, channel, fit, max_count, data_out);
+}
+
+void sensor_decode_scale_q31(q31_t *values, size_t count, q31_t scale)
+{
+#ifdef CONFIG_SENSOR_DECODE_DSP
+	zdsp_scale_q31(values, scale, 0, values, count);
+#else
+	for (size_t i = 0; i < count; i++) {
+		values[i] = (q31_t)(((int64_t)values[i] * scale) >> 31);
+	}
+#endif
+}
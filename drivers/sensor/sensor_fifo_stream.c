@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * FIFO streaming shared by the sensor drivers. At each watermark interrupt the
+ * fill level and then the frames are read with chained RTIO submissions, so
+ * the CPU only runs the short callbacks between the transfers. The frames are
+ * timestamped from the interrupt times: the newest frame in the FIFO is taken
+ * to be sampled at the interrupt, and the period between frames is measured
+ * from the number of frames received between two interrupts.
+ */
+
+#include <zephyr/drivers/sensor/fifo_stream.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(sensor_fifo_stream, CONFIG_SENSOR_LOG_LEVEL);
+
+/* The measured period is filtered over about this many interrupts */
+#define PERIOD_FILTER_SHIFT 2
+
+void sensor_fifo_stream_init(struct sensor_fifo_stream *stream, const struct device *dev,
+			     const struct sensor_fifo_stream_config *cfg, struct rtio *r,
+			     struct rtio_iodev *bus, uint32_t period_ns)
+{
+	__ASSERT_NO_MSG(cfg->count_len == 1 || cfg->count_len == 2);
+	__ASSERT_NO_MSG(cfg->frame_size > 0);
+	__ASSERT_NO_MSG(cfg->done != NULL);
+
+	*stream = (struct sensor_fifo_stream){
+		.dev = dev,
+		.cfg = cfg,
+		.r = r,
+		.bus = bus,
+		.period_ns = period_ns,
+	};
+}
+
+void sensor_fifo_stream_set_period(struct sensor_fifo_stream *stream, uint32_t period_ns)
+{
+	k_spinlock_key_t key = k_spin_lock(&stream->lock);
+
+	stream->period_ns = period_ns;
+	stream->last_time = 0;
+	k_spin_unlock(&stream->lock, key);
+}
+
+void sensor_fifo_stream_submit(struct sensor_fifo_stream *stream,
+			       struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct sensor_read_config *read_cfg = iodev_sqe->sqe.iodev->data;
+	enum sensor_stream_data_opt opt = SENSOR_STREAM_DATA_DROP;
+	k_spinlock_key_t key;
+
+	/* Use the option keeping the most data when both FIFO triggers are set */
+	for (size_t i = 0; i < read_cfg->count; i++) {
+		if (read_cfg->triggers[i].trigger == SENSOR_TRIG_FIFO_WATERMARK ||
+		    read_cfg->triggers[i].trigger == SENSOR_TRIG_FIFO_FULL) {
+			opt = MIN(opt, read_cfg->triggers[i].opt);
+		}
+	}
+
+	key = k_spin_lock(&stream->lock);
+	stream->sqe = iodev_sqe;
+	stream->opt = opt;
+	k_spin_unlock(&stream->lock, key);
+}
+
+/* Flush the completions of the transfers, returning the first error */
+static int fifo_stream_check(struct rtio *r)
+{
+	struct rtio_cqe *cqe;
+	int rc = 0;
+
+	while ((cqe = rtio_cqe_consume(r)) != NULL) {
+		if (rc == 0 && cqe->result < 0) {
+			rc = cqe->result;
+		}
+		rtio_cqe_release(r, cqe);
+	}
+
+	return rc;
+}
+
+static void fifo_stream_header(struct sensor_fifo_stream *stream, uint8_t *buf,
+			       uint16_t frames, uint64_t timestamp)
+{
+	struct sensor_fifo_stream_header *hdr = (struct sensor_fifo_stream_header *)buf;
+
+	*hdr = (struct sensor_fifo_stream_header){
+		.timestamp = timestamp,
+		.period_ns = stream->period_ns,
+		.frame_count = frames,
+		.frame_size = stream->cfg->frame_size,
+		.trigger = stream->trigger,
+	};
+
+	if (stream->cfg->fill_header != NULL) {
+		stream->cfg->fill_header(stream->dev, hdr, buf + sizeof(*hdr));
+	}
+}
+
+static void fifo_stream_complete(struct sensor_fifo_stream *stream, struct rtio_iodev_sqe *sqe,
+				 int rc)
+{
+	if (rc < 0) {
+		stream->last_time = 0;
+		rtio_iodev_sqe_err(sqe, rc);
+	} else {
+		rtio_iodev_sqe_ok(sqe, 0);
+	}
+
+	stream->cfg->done(stream->dev);
+}
+
+static void fifo_stream_data_cb(struct rtio *r, const struct rtio_sqe *sqe, void *arg)
+{
+	struct sensor_fifo_stream *stream = arg;
+
+	fifo_stream_complete(stream, sqe->userdata, fifo_stream_check(r));
+}
+
+/* Update the period from the frames received since the previous interrupt */
+static void fifo_stream_measure(struct sensor_fifo_stream *stream, uint16_t frames)
+{
+	uint64_t elapsed = stream->irq_time - stream->last_time;
+	uint32_t measured;
+
+	if (stream->last_time == 0 || frames == 0 || stream->irq_time <= stream->last_time) {
+		return;
+	}
+
+	measured = (uint32_t)MIN(elapsed / frames, UINT32_MAX);
+
+	/* Ignore intervals the nominal rate cannot explain, e.g. after missed interrupts */
+	if (measured < stream->period_ns / 2 || measured / 2 > stream->period_ns) {
+		return;
+	}
+
+	stream->period_ns += ((int32_t)(measured - stream->period_ns)) >> PERIOD_FILTER_SHIFT;
+}
+
+static void fifo_stream_count_cb(struct rtio *r, const struct rtio_sqe *sqe, void *arg)
+{
+	struct sensor_fifo_stream *stream = arg;
+	const struct sensor_fifo_stream_config *cfg = stream->cfg;
+	struct rtio_iodev_sqe *iodev_sqe = sqe->userdata;
+	const uint32_t hdr_size = sizeof(struct sensor_fifo_stream_header) + cfg->header_size;
+	struct rtio_sqe *write_reg, *read_data, *complete;
+	uint16_t count, frames, avail;
+	uint64_t first_time;
+	uint32_t buf_len;
+	uint8_t *buf;
+	uint8_t reg;
+	int rc;
+
+	rc = fifo_stream_check(r);
+	if (rc < 0) {
+		LOG_DBG("FIFO level read failed (%d)", rc);
+		fifo_stream_complete(stream, iodev_sqe, rc);
+		return;
+	}
+
+	if (cfg->count_len == 2) {
+		count = cfg->count_be ? sys_get_be16(stream->count_buf)
+				      : sys_get_le16(stream->count_buf);
+	} else {
+		count = stream->count_buf[0];
+	}
+	count &= cfg->count_mask;
+	frames = cfg->count_frames ? count : count / cfg->frame_size;
+
+	fifo_stream_measure(stream, frames);
+
+	/* The newest frame was sampled when the watermark was reached */
+	first_time = stream->irq_time;
+	if (frames > 0) {
+		first_time -= (uint64_t)stream->period_ns * (frames - 1);
+	}
+
+	rc = rtio_sqe_rx_buf(iodev_sqe, hdr_size + cfg->frame_size,
+			     hdr_size + (uint32_t)frames * cfg->frame_size, &buf, &buf_len);
+	if (rc < 0) {
+		LOG_DBG("No buffer for %u frames", frames);
+		fifo_stream_complete(stream, iodev_sqe, -ENOMEM);
+		return;
+	}
+
+	avail = MIN(frames, (buf_len - hdr_size) / cfg->frame_size);
+
+	/* Frames left in the FIFO would skew the next period measurement */
+	stream->last_time = avail == frames ? stream->irq_time : 0;
+
+	fifo_stream_header(stream, buf, avail, first_time);
+
+	if (avail == 0) {
+		fifo_stream_complete(stream, iodev_sqe, 0);
+		return;
+	}
+
+	write_reg = rtio_sqe_acquire(r);
+	read_data = rtio_sqe_acquire(r);
+	complete = rtio_sqe_acquire(r);
+	if (write_reg == NULL || read_data == NULL || complete == NULL) {
+		rtio_sqe_drop_all(r);
+		fifo_stream_complete(stream, iodev_sqe, -ENOMEM);
+		return;
+	}
+
+	reg = cfg->data_reg | cfg->read_flag;
+	rtio_sqe_prep_tiny_write(write_reg, stream->bus, RTIO_PRIO_NORM, &reg, 1, NULL);
+	write_reg->flags = RTIO_SQE_TRANSACTION;
+	rtio_sqe_prep_read(read_data, stream->bus, RTIO_PRIO_NORM, buf + hdr_size,
+			   (uint32_t)avail * cfg->frame_size, NULL);
+	read_data->flags = RTIO_SQE_CHAINED;
+	rtio_sqe_prep_callback(complete, fifo_stream_data_cb, stream, iodev_sqe);
+
+	rtio_submit(r, 0);
+}
+
+static void fifo_stream_no_data(struct sensor_fifo_stream *stream,
+				struct rtio_iodev_sqe *iodev_sqe)
+{
+	const uint32_t hdr_size = sizeof(struct sensor_fifo_stream_header) +
+				  stream->cfg->header_size;
+	uint32_t buf_len;
+	uint8_t *buf;
+
+	if (stream->opt == SENSOR_STREAM_DATA_DROP && stream->cfg->flush != NULL) {
+		stream->cfg->flush(stream->dev);
+		stream->last_time = stream->irq_time;
+	} else {
+		/* The frames stay in the FIFO */
+		stream->last_time = 0;
+	}
+
+	if (rtio_sqe_rx_buf(iodev_sqe, hdr_size, hdr_size, &buf, &buf_len) != 0) {
+		fifo_stream_complete(stream, iodev_sqe, -ENOMEM);
+		return;
+	}
+
+	fifo_stream_header(stream, buf, 0, stream->irq_time);
+	fifo_stream_complete(stream, iodev_sqe, 0);
+}
+
+void sensor_fifo_stream_irq(struct sensor_fifo_stream *stream, enum sensor_trigger_type trigger,
+			    uint64_t timestamp)
+{
+	const struct sensor_fifo_stream_config *cfg = stream->cfg;
+	struct rtio_sqe *write_reg, *read_count, *check;
+	struct rtio_iodev_sqe *iodev_sqe;
+	struct rtio *r = stream->r;
+	k_spinlock_key_t key;
+	uint8_t reg;
+
+	key = k_spin_lock(&stream->lock);
+	iodev_sqe = stream->sqe;
+	stream->sqe = NULL;
+	k_spin_unlock(&stream->lock, key);
+
+	/* Not inherently an overrun, the next submission may come in time */
+	if (iodev_sqe == NULL) {
+		LOG_DBG("No pending SQE");
+		stream->last_time = 0;
+		cfg->done(stream->dev);
+		return;
+	}
+
+	stream->irq_time = timestamp;
+	stream->trigger = trigger;
+
+	if (stream->opt != SENSOR_STREAM_DATA_INCLUDE) {
+		fifo_stream_no_data(stream, iodev_sqe);
+		return;
+	}
+
+	(void)fifo_stream_check(r);
+
+	write_reg = rtio_sqe_acquire(r);
+	read_count = rtio_sqe_acquire(r);
+	check = rtio_sqe_acquire(r);
+	if (write_reg == NULL || read_count == NULL || check == NULL) {
+		rtio_sqe_drop_all(r);
+		fifo_stream_complete(stream, iodev_sqe, -ENOMEM);
+		return;
+	}
+
+	reg = cfg->count_reg | cfg->read_flag;
+	rtio_sqe_prep_tiny_write(write_reg, stream->bus, RTIO_PRIO_NORM, &reg, 1, NULL);
+	write_reg->flags = RTIO_SQE_TRANSACTION;
+	rtio_sqe_prep_read(read_count, stream->bus, RTIO_PRIO_NORM, stream->count_buf,
+			   cfg->count_len, NULL);
+	read_count->flags = RTIO_SQE_CHAINED;
+	rtio_sqe_prep_callback(check, fifo_stream_count_cb, stream, iodev_sqe);
+
+	rtio_submit(r, 0);
+}
@@ -685,11 +685,255 @@ static bool icm24688_decoder_has_trigger(const uint8_t *buffer, enum sensor_trig
 	}
 }
 
+/*
+ * Get the left aligned raw value of an axis and its scale, so that the decoded value is
+ * (raw * scale) >> 31 as computed by sensor_decode_scale_q31().
+ */
+static int icm42688_read_raw_from_packet(const uint8_t *pkt, bool is_accel, int fs,
+					 uint8_t axis_offset, q31_t *raw, q31_t *scale)
+{
+	int offset = 1 + (axis_offset * 2);
+	int32_t value;
+
+	if (!is_accel && FIELD_GET(FIFO_HEADER_ACCEL, pkt[0]) == 1) {
+		offset += 7;
+	}
+
+	value = (int16_t)sys_le16_to_cpu((pkt[offset] << 8) | pkt[offset + 1]);
+
+	if (FIELD_GET(FIFO_HEADER_20, pkt[0]) == 1) {
+		uint32_t mask = is_accel ? GENMASK(7, 4) : GENMASK(3, 0);
+
+		value = (value << 4) | FIELD_GET(mask, pkt[0x11 + axis_offset]);
+		if (value == -524288) {
+			/* Invalid 20 bit value */
+			return -ENODATA;
+		}
+		/* In 20 bit mode, FS can only be +/-16g and +/-2000dps */
+		*raw = value << (is_accel ? 13 : 12);
+		*scale = is_accel ? (INT64_C(16) * BIT(8) * 9.80665) : 131;
+		return 0;
+	}
+
+	if (value <= -32767) {
+		/* Invalid 16 bit value */
+		return -ENODATA;
+	}
+	*raw = value << 16;
+
+	if (is_accel) {
+		switch (fs) {
+		case ICM42688_DT_ACCEL_FS_2:
+			*scale = INT64_C(2) * BIT(31 - 5) * 9.80665;
+			break;
+		case ICM42688_DT_ACCEL_FS_4:
+			*scale = INT64_C(4) * BIT(31 - 6) * 9.80665;
+			break;
+		case ICM42688_DT_ACCEL_FS_8:
+			*scale = INT64_C(8) * BIT(31 - 7) * 9.80665;
+			break;
+		default:
+			*scale = INT64_C(16) * BIT(31 - 8) * 9.80665;
+			break;
+		}
+		return 0;
+	}
+
+	switch (fs) {
+	case ICM42688_DT_GYRO_FS_2000:
+		*scale = 164;
+		break;
+	case ICM42688_DT_GYRO_FS_1000:
+		*scale = 328;
+		break;
+	case ICM42688_DT_GYRO_FS_500:
+		*scale = 655;
+		break;
+	case ICM42688_DT_GYRO_FS_250:
+		*scale = 1310;
+		break;
+	case ICM42688_DT_GYRO_FS_125:
+		*scale = 2620;
+		break;
+	case ICM42688_DT_GYRO_FS_62_5:
+		*scale = 5243;
+		break;
+	case ICM42688_DT_GYRO_FS_31_25:
+		*scale = 10486;
+		break;
+	default:
+		*scale = 20972;
+		break;
+	}
+	return 0;
+}
+
+/*
+ * Bulk FIFO decode: a first pass gathers the raw samples of the requested channel into the
+ * output arrays, then they are converted in place by the shared vector kernel. A batch ends
+ * early when the sample format changes, as the whole batch is converted with one scale.
+ */
+static int icm42688_fifo_decode_soa(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+				    uint32_t *fit, uint16_t max_count,
+				    struct sensor_soa_data *data_out)
+{
+	const struct icm42688_fifo_data *edata = (const struct icm42688_fifo_data *)buffer;
+	const uint8_t *buffer_end = buffer + sizeof(struct icm42688_fifo_data) + edata->fifo_count;
+	const bool is_temp = chan_spec.chan_type == SENSOR_CHAN_DIE_TEMP;
+	const bool is_accel = IS_ACCEL(chan_spec.chan_type);
+	const int fs = is_accel ? edata->header.accel_fs : edata->header.gyro_fs;
+	int accel_frame_count = 0;
+	int gyro_frame_count = 0;
+	q31_t batch_scale = 0;
+	uint16_t count = 0;
+
+	if (!is_temp && !is_accel && !IS_GYRO(chan_spec.chan_type)) {
+		return -ENOTSUP;
+	}
+	if ((uintptr_t)buffer_end <= *fit || chan_spec.chan_idx != 0) {
+		return 0;
+	}
+
+	data_out->header.base_timestamp_ns = edata->header.timestamp;
+	if (is_temp) {
+		data_out->shift = 9;
+	} else {
+		icm42688_get_shift(is_accel ? SENSOR_CHAN_ACCEL_XYZ : SENSOR_CHAN_GYRO_XYZ,
+				   edata->header.accel_fs, edata->header.gyro_fs, &data_out->shift);
+	}
+
+	buffer += sizeof(struct icm42688_fifo_data);
+	while (count < max_count && buffer < buffer_end) {
+		const bool is_20b = FIELD_GET(FIFO_HEADER_20, buffer[0]) == 1;
+		const bool has_accel = FIELD_GET(FIFO_HEADER_ACCEL, buffer[0]) == 1;
+		const bool has_gyro = FIELD_GET(FIFO_HEADER_GYRO, buffer[0]) == 1;
+		const uint8_t *frame_end = buffer;
+		uint32_t timestamp_delta;
+		q31_t raw[3], scale;
+		int rc = 0;
+
+		if (is_20b) {
+			frame_end += 20;
+		} else if (has_accel && has_gyro) {
+			frame_end += 16;
+		} else {
+			frame_end += 8;
+		}
+		if (has_accel) {
+			accel_frame_count++;
+		}
+		if (has_gyro) {
+			gyro_frame_count++;
+		}
+
+		if ((uintptr_t)buffer < *fit || (!is_temp && (is_accel ? !has_accel : !has_gyro))) {
+			buffer = frame_end;
+			continue;
+		}
+
+		if (is_temp) {
+			data_out->values[0][count] = icm42688_read_temperature_from_packet(buffer);
+			timestamp_delta = has_accel ? accel_period_ns[edata->accel_odr] *
+							      (accel_frame_count - 1)
+						    : gyro_period_ns[edata->gyro_odr] *
+							      (gyro_frame_count - 1);
+		} else {
+			for (uint8_t axis = 0; axis < 3; axis++) {
+				rc |= icm42688_read_raw_from_packet(buffer, is_accel, fs, axis,
+								    &raw[axis], &scale);
+			}
+			if (rc != 0) {
+				if (is_accel) {
+					accel_frame_count--;
+				} else {
+					gyro_frame_count--;
+				}
+				buffer = frame_end;
+				continue;
+			}
+			if (count == 0) {
+				batch_scale = scale;
+			} else if (scale != batch_scale) {
+				break;
+			}
+			for (uint8_t axis = 0; axis < 3; axis++) {
+				data_out->values[axis][count] = raw[axis];
+			}
+			timestamp_delta = is_accel ? accel_period_ns[edata->accel_odr] *
+							     (accel_frame_count - 1)
+						   : gyro_period_ns[edata->gyro_odr] *
+							     (gyro_frame_count - 1);
+		}
+
+		if (data_out->timestamp_delta != NULL) {
+			data_out->timestamp_delta[count] = timestamp_delta;
+		}
+		buffer = frame_end;
+		*fit = (uintptr_t)frame_end;
+		count++;
+	}
+
+	if (!is_temp) {
+		for (uint8_t axis = 0; axis < 3; axis++) {
+			sensor_decode_scale_q31(data_out->values[axis], count, batch_scale);
+		}
+	}
+
+	data_out->header.reading_count = count;
+	return count;
+}
+
+static int icm42688_one_shot_decode_soa(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+					uint32_t *fit, uint16_t max_count,
+					struct sensor_soa_data *data_out)
+{
+	union {
+		struct sensor_three_axis_data three_axis;
+		struct sensor_q31_data q31;
+	} out;
+	int rc;
+
+	rc = icm42688_one_shot_decode(buffer, chan_spec, fit, max_count, &out);
+	if (rc <= 0) {
+		return rc;
+	}
+
+	data_out->header = out.three_axis.header;
+	if (chan_spec.chan_type == SENSOR_CHAN_DIE_TEMP) {
+		data_out->shift = out.q31.shift;
+		data_out->values[0][0] = out.q31.readings[0].temperature;
+	} else {
+		data_out->shift = out.three_axis.shift;
+		for (int axis = 0; axis < 3; axis++) {
+			data_out->values[axis][0] = out.three_axis.readings[0].values[axis];
+		}
+	}
+	if (data_out->timestamp_delta != NULL) {
+		data_out->timestamp_delta[0] = 0;
+	}
+
+	return rc;
+}
+
+static int icm42688_decoder_decode_soa(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+				       uint32_t *fit, uint16_t max_count,
+				       struct sensor_soa_data *data_out)
+{
+	const struct icm42688_decoder_header *header =
+		(const struct icm42688_decoder_header *)buffer;
+
+	if (header->is_fifo) {
+		return icm42688_fifo_decode_soa(buffer, chan_spec, fit, max_count, data_out);
+	}
+	return icm42688_one_shot_decode_soa(buffer, chan_spec, fit, max_count, data_out);
+}
+
 SENSOR_DECODER_API_DT_DEFINE() = {
 	.get_frame_count = icm42688_decoder_get_frame_count,
 	.get_size_info = icm42688_decoder_get_size_info,
 	.decode = icm42688_decoder_decode,
 	.has_trigger = icm24688_decoder_has_trigger,
+	.decode_soa = icm42688_decoder_decode_soa,
 };
 
 int icm42688_get_decoder(const struct device *dev, const struct sensor_decoder_api **decoder)
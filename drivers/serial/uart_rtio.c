@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * RTIO iodev on top of the UART asynchronous API. Writes are queued and
+ * sent one after the other. A single read is served at a time, directly in
+ * its buffer. For multishot reads using the RTIO mempool the next mempool
+ * buffer is handed to the driver on UART_RX_BUF_REQUEST and adopted by the
+ * resubmitted read, so data keeps flowing in place between completions.
+ *
+ * Drivers may raise events from within the API calls, so the UART is never
+ * called with the context lock held.
+ */
+
+#include <zephyr/drivers/uart.h>
+#include <zephyr/drivers/serial/uart_rtio.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(uart_rtio, CONFIG_UART_LOG_LEVEL);
+
+static bool rx_is_multishot(const struct rtio_iodev_sqe *iodev_sqe)
+{
+	const uint32_t flags = iodev_sqe->sqe.flags;
+
+	return IS_ENABLED(CONFIG_RTIO_SYS_MEM_BLOCKS) && (flags & RTIO_SQE_MULTISHOT) &&
+	       (flags & RTIO_SQE_MEMPOOL_BUFFER);
+}
+
+static void tx_next(struct uart_rtio *ctx)
+{
+	struct rtio_iodev_sqe *iodev_sqe;
+	struct mpsc_node *node;
+	const uint8_t *buf;
+	size_t len;
+	k_spinlock_key_t key;
+	int err;
+
+	while (true) {
+		key = k_spin_lock(&ctx->lock);
+		node = (ctx->tx_curr == NULL) ? mpsc_pop(&ctx->tx_q) : NULL;
+		if (node == NULL) {
+			k_spin_unlock(&ctx->lock, key);
+			return;
+		}
+		iodev_sqe = CONTAINER_OF(node, struct rtio_iodev_sqe, q);
+		ctx->tx_curr = iodev_sqe;
+		k_spin_unlock(&ctx->lock, key);
+
+		if (iodev_sqe->sqe.op == RTIO_OP_TINY_TX) {
+			buf = iodev_sqe->sqe.tiny_buf;
+			len = iodev_sqe->sqe.tiny_buf_len;
+		} else {
+			buf = iodev_sqe->sqe.tx_buf;
+			len = iodev_sqe->sqe.tx_buf_len;
+		}
+
+		err = uart_tx(ctx->dev, buf, len, SYS_FOREVER_US);
+		if (err == 0) {
+			return;
+		}
+
+		LOG_ERR("uart_tx failed (%d)", err);
+
+		key = k_spin_lock(&ctx->lock);
+		ctx->tx_curr = NULL;
+		k_spin_unlock(&ctx->lock, key);
+
+		rtio_iodev_sqe_err(iodev_sqe, err);
+	}
+}
+
+static void tx_complete(struct uart_rtio *ctx, int err)
+{
+	struct rtio_iodev_sqe *iodev_sqe;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&ctx->lock);
+	iodev_sqe = ctx->tx_curr;
+	ctx->tx_curr = NULL;
+	k_spin_unlock(&ctx->lock, key);
+
+	if (iodev_sqe == NULL) {
+		return;
+	}
+
+	if (err) {
+		rtio_iodev_sqe_err(iodev_sqe, err);
+	} else {
+		rtio_iodev_sqe_ok(iodev_sqe, 0);
+	}
+
+	tx_next(ctx);
+}
+
+/* Stop the receiver, the pending read is completed once its buffer is released */
+static void rx_stop(struct uart_rtio *ctx)
+{
+	k_spinlock_key_t key;
+	bool stop;
+
+	key = k_spin_lock(&ctx->lock);
+	stop = ctx->rx_enabled && !ctx->rx_stopping;
+	ctx->rx_stopping = true;
+	k_spin_unlock(&ctx->lock, key);
+
+	if (stop) {
+		(void)uart_rx_disable(ctx->dev);
+	}
+}
+
+/* Enable the receiver in the buffer of the pending read, if it is not running */
+static void rx_start(struct uart_rtio *ctx)
+{
+	struct rtio_iodev_sqe *iodev_sqe;
+	k_spinlock_key_t key;
+	uint8_t *buf;
+	uint32_t len;
+	int err;
+
+	key = k_spin_lock(&ctx->lock);
+
+	iodev_sqe = ctx->rx_curr;
+	if ((iodev_sqe == NULL) || ctx->rx_enabled) {
+		k_spin_unlock(&ctx->lock, key);
+		return;
+	}
+
+	err = rtio_sqe_rx_buf(iodev_sqe, 1, ctx->rx_buf_size, &buf, &len);
+	if (err == 0) {
+		ctx->rx_buf = buf;
+		ctx->rx_len = len;
+		ctx->rx_bytes = 0;
+		ctx->rx_enabled = true;
+		ctx->rx_stopping = false;
+	}
+
+	k_spin_unlock(&ctx->lock, key);
+
+	if (err == 0) {
+		err = uart_rx_enable(ctx->dev, buf, len, ctx->rx_timeout_us);
+		if (err == 0) {
+			return;
+		}
+	}
+
+	LOG_ERR("Failed to start reception (%d)", err);
+
+	key = k_spin_lock(&ctx->lock);
+	ctx->rx_enabled = false;
+	ctx->rx_curr = NULL;
+	ctx->rx_buf = NULL;
+	k_spin_unlock(&ctx->lock, key);
+
+	rtio_iodev_sqe_err(iodev_sqe, err);
+}
+
+static void rx_submit(struct uart_rtio *ctx, struct rtio_iodev_sqe *iodev_sqe)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&ctx->lock);
+
+	if (ctx->rx_curr != NULL) {
+		k_spin_unlock(&ctx->lock, key);
+		rtio_iodev_sqe_err(iodev_sqe, -EBUSY);
+		return;
+	}
+
+	ctx->rx_curr = iodev_sqe;
+
+	if (ctx->rx_next_buf != NULL) {
+		/* Resubmitted multishot read, the driver already fills the next buffer */
+		iodev_sqe->sqe.buf = ctx->rx_next_buf;
+		iodev_sqe->sqe.buf_len = ctx->rx_next_len;
+		ctx->rx_buf = ctx->rx_next_buf;
+		ctx->rx_len = ctx->rx_next_len;
+		ctx->rx_bytes = 0;
+		ctx->rx_next_buf = NULL;
+	}
+
+	k_spin_unlock(&ctx->lock, key);
+
+	/* A stopping receiver is restarted on UART_RX_DISABLED instead */
+	rx_start(ctx);
+}
+
+static void rx_rdy(struct uart_rtio *ctx, const struct uart_event_rx *rx)
+{
+	k_spinlock_key_t key;
+	bool idle = false;
+
+	key = k_spin_lock(&ctx->lock);
+	if ((ctx->rx_curr != NULL) && (rx->buf == ctx->rx_buf)) {
+		ctx->rx_bytes += rx->len;
+		idle = (rx->offset + rx->len) < ctx->rx_len;
+	}
+	k_spin_unlock(&ctx->lock, key);
+
+	/* The line went idle before the buffer was full, complete the read */
+	if (idle) {
+		rx_stop(ctx);
+	}
+}
+
+static void rx_buf_request(struct uart_rtio *ctx)
+{
+	struct rtio *r = NULL;
+	k_spinlock_key_t key;
+	uint8_t *buf = NULL;
+	uint32_t len = 0;
+
+	key = k_spin_lock(&ctx->lock);
+	if ((ctx->rx_curr != NULL) && rx_is_multishot(ctx->rx_curr) &&
+	    (ctx->rx_next_buf == NULL) && !ctx->rx_stopping) {
+		r = ctx->rx_curr->r;
+		if (rtio_block_pool_alloc(r, 1, ctx->rx_buf_size, &buf, &len) == 0) {
+			ctx->rx_next_r = r;
+			ctx->rx_next_buf = buf;
+			ctx->rx_next_len = len;
+		} else {
+			buf = NULL;
+		}
+	}
+	k_spin_unlock(&ctx->lock, key);
+
+	if ((buf == NULL) || (uart_rx_buf_rsp(ctx->dev, buf, len) == 0)) {
+		return;
+	}
+
+	key = k_spin_lock(&ctx->lock);
+	ctx->rx_next_buf = NULL;
+	k_spin_unlock(&ctx->lock, key);
+
+	rtio_release_buffer(r, buf, len);
+}
+
+static void rx_buf_released(struct uart_rtio *ctx, uint8_t *buf)
+{
+	struct rtio_iodev_sqe *iodev_sqe;
+	k_spinlock_key_t key;
+	uint32_t bytes;
+	bool orphan;
+	int err;
+
+	key = k_spin_lock(&ctx->lock);
+
+	if (buf == ctx->rx_next_buf) {
+		/* Next buffer not taken by any read */
+		ctx->rx_next_buf = NULL;
+		k_spin_unlock(&ctx->lock, key);
+		rtio_release_buffer(ctx->rx_next_r, buf, ctx->rx_next_len);
+		return;
+	}
+
+	iodev_sqe = ctx->rx_curr;
+	if ((iodev_sqe == NULL) || (buf != ctx->rx_buf)) {
+		k_spin_unlock(&ctx->lock, key);
+		return;
+	}
+
+	bytes = ctx->rx_bytes;
+	err = ctx->rx_err;
+	ctx->rx_err = 0;
+	ctx->rx_buf = NULL;
+
+	if ((bytes == 0U) && (err == 0)) {
+		/* Nothing received, keep the read pending until the receiver is restarted */
+		if (iodev_sqe->sqe.flags & RTIO_SQE_MEMPOOL_BUFFER) {
+			rtio_release_buffer(iodev_sqe->r, buf, iodev_sqe->sqe.buf_len);
+			iodev_sqe->sqe.buf = NULL;
+			iodev_sqe->sqe.buf_len = 0;
+		}
+		k_spin_unlock(&ctx->lock, key);
+		return;
+	}
+
+	ctx->rx_curr = NULL;
+	k_spin_unlock(&ctx->lock, key);
+
+	/* A multishot read is resubmitted from here and takes the next buffer */
+	if (err) {
+		rtio_iodev_sqe_err(iodev_sqe, err);
+	} else {
+		rtio_iodev_sqe_ok(iodev_sqe, bytes);
+	}
+
+	key = k_spin_lock(&ctx->lock);
+	orphan = ctx->rx_next_buf != NULL;
+	k_spin_unlock(&ctx->lock, key);
+
+	/* No read took the next buffer, let the driver give it back */
+	if (orphan) {
+		rx_stop(ctx);
+	}
+}
+
+static void rx_disabled(struct uart_rtio *ctx)
+{
+	struct rtio *r;
+	k_spinlock_key_t key;
+	uint8_t *buf;
+
+	key = k_spin_lock(&ctx->lock);
+	ctx->rx_enabled = false;
+	ctx->rx_stopping = false;
+	/* Not every driver releases the next buffer when reception stops */
+	r = ctx->rx_next_r;
+	buf = ctx->rx_next_buf;
+	ctx->rx_next_buf = NULL;
+	k_spin_unlock(&ctx->lock, key);
+
+	if (buf != NULL) {
+		rtio_release_buffer(r, buf, ctx->rx_next_len);
+	}
+
+	/* Serve the read submitted while the receiver was stopping */
+	rx_start(ctx);
+}
+
+static void uart_rtio_callback(const struct device *dev, struct uart_event *evt, void *user_data)
+{
+	struct uart_rtio *ctx = user_data;
+	k_spinlock_key_t key;
+
+	ARG_UNUSED(dev);
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+		tx_complete(ctx, 0);
+		break;
+	case UART_TX_ABORTED:
+		tx_complete(ctx, -ECANCELED);
+		break;
+	case UART_RX_RDY:
+		rx_rdy(ctx, &evt->data.rx);
+		break;
+	case UART_RX_BUF_REQUEST:
+		rx_buf_request(ctx);
+		break;
+	case UART_RX_BUF_RELEASED:
+		rx_buf_released(ctx, evt->data.rx_buf.buf);
+		break;
+	case UART_RX_STOPPED:
+		LOG_WRN("Reception stopped (reason %d)", evt->data.rx_stop.reason);
+		key = k_spin_lock(&ctx->lock);
+		ctx->rx_err = -EIO;
+		k_spin_unlock(&ctx->lock, key);
+		break;
+	case UART_RX_DISABLED:
+		rx_disabled(ctx);
+		break;
+	default:
+		break;
+	}
+}
+
+static void uart_rtio_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct uart_rtio *ctx = iodev_sqe->sqe.iodev->data;
+
+	switch (iodev_sqe->sqe.op) {
+	case RTIO_OP_TX:
+	case RTIO_OP_TINY_TX:
+		mpsc_push(&ctx->tx_q, &iodev_sqe->q);
+		tx_next(ctx);
+		break;
+	case RTIO_OP_RX:
+		rx_submit(ctx, iodev_sqe);
+		break;
+	default:
+		LOG_ERR("Unsupported RTIO operation %d", iodev_sqe->sqe.op);
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+		break;
+	}
+}
+
+const struct rtio_iodev_api uart_rtio_iodev_api = {
+	.submit = uart_rtio_submit,
+};
+
+int uart_rtio_init(const struct rtio_iodev *iodev)
+{
+	struct uart_rtio *ctx = iodev->data;
+
+	if (!device_is_ready(ctx->dev)) {
+		return -ENODEV;
+	}
+
+	mpsc_init(&ctx->tx_q);
+
+	if (uart_callback_set(ctx->dev, uart_rtio_callback, ctx) != 0) {
+		return -ENOTSUP;
+	}
+
+	return 0;
+}
@@ -25,6 +25,9 @@ LOG_MODULE_REGISTER(spi_ll_stm32);
 #include <zephyr/drivers/dma/dma_stm32.h>
 #include <zephyr/drivers/dma.h>
 #endif
+#ifdef CONFIG_SPI_RTIO
+#include <zephyr/rtio/rtio.h>
+#endif
 #include <zephyr/drivers/clock_control/stm32_clock_control.h>
 #include <zephyr/drivers/clock_control.h>
 #include <zephyr/irq.h>
@@ -52,6 +55,10 @@ LOG_MODULE_REGISTER(spi_ll_stm32);
 
 #define WAIT_1US	1U
 
+#if defined(CONFIG_SPI_RTIO) && !defined(CONFIG_SPI_STM32_DMA)
+#error "STM32 SPI RTIO support requires CONFIG_SPI_STM32_DMA"
+#endif
+
 /*
  * Check for SPI_SR_FRE to determine support for TI mode frame format
  * error flag, because STM32F1 SoCs do not support it and  STM32CUBE
@@ -121,6 +128,10 @@ static uint32_t bits2bytes(uint32_t bits)
  */
 static __aligned(32) uint32_t dummy_rx_tx_buffer __nocache;
 
+#ifdef CONFIG_SPI_RTIO
+static void spi_stm32_iodev_complete(const struct device *dev, int status);
+#endif /* CONFIG_SPI_RTIO */
+
 /* This function is executed in the interrupt context */
 static void dma_callback(const struct device *dma_dev, void *arg,
 			 uint32_t channel, int status)
@@ -149,6 +160,19 @@ static void dma_callback(const struct device *dma_dev, void *arg,
 		}
 	}
 
+#ifdef CONFIG_SPI_RTIO
+	/* RTIO submissions are chained from here, without waking any thread */
+	if (spi_dma_data->txn_curr != NULL) {
+		if (spi_dma_data->status_flags & SPI_STM32_DMA_ERROR_FLAG) {
+			spi_stm32_iodev_complete(spi_dma_data->dev, -EIO);
+		} else if ((spi_dma_data->status_flags & SPI_STM32_DMA_DONE_FLAG) ==
+			   SPI_STM32_DMA_DONE_FLAG) {
+			spi_stm32_iodev_complete(spi_dma_data->dev, 0);
+		}
+		return;
+	}
+#endif /* CONFIG_SPI_RTIO */
+
 	k_sem_give(&spi_dma_data->status_sem);
 }
 
@@ -1123,7 +1147,273 @@ end:
 }
 #endif /* CONFIG_SPI_STM32_DMA */
 
-static int spi_stm32_transceive(const struct device *dev,
+#ifdef CONFIG_SPI_RTIO
+#ifdef CONFIG_DCACHE
+static bool spi_stm32_iodev_buf_ok(const uint8_t *buf, size_t len)
+{
+	return (buf == NULL) || buf_in_nocache((uintptr_t)buf, len);
+}
+#endif /* CONFIG_DCACHE */
+
+/* Load the DMA channels for the current submission, called from thread or DMA ISR */
+static void spi_stm32_iodev_start(const struct device *dev)
+{
+	const struct spi_stm32_config *cfg = dev->config;
+	struct spi_stm32_data *data = dev->data;
+	struct rtio_sqe *sqe = &data->txn_curr->sqe;
+	uint8_t frame_size_bytes = bits2bytes(SPI_WORD_SIZE_GET(data->ctx.config->operation));
+	const uint8_t *tx_buf = NULL;
+	uint8_t *rx_buf = NULL;
+	size_t len;
+	int ret;
+
+	switch (sqe->op) {
+	case RTIO_OP_RX:
+		rx_buf = sqe->buf;
+		len = sqe->buf_len;
+		break;
+	case RTIO_OP_TX:
+		tx_buf = sqe->buf;
+		len = sqe->buf_len;
+		break;
+	case RTIO_OP_TINY_TX:
+		tx_buf = sqe->tiny_buf;
+		len = sqe->tiny_buf_len;
+		break;
+	case RTIO_OP_TXRX:
+		tx_buf = sqe->tx_buf;
+		rx_buf = sqe->rx_buf;
+		len = sqe->txrx_buf_len;
+		break;
+	default:
+		LOG_ERR("Invalid op code %d for submission %p", sqe->op, (void *)sqe);
+		spi_stm32_iodev_complete(dev, -EINVAL);
+		return;
+	}
+
+	if ((len == 0) || ((len % frame_size_bytes) != 0)) {
+		spi_stm32_iodev_complete(dev, -EINVAL);
+		return;
+	}
+
+#ifdef CONFIG_DCACHE
+	if (!spi_stm32_iodev_buf_ok(tx_buf, len) || !spi_stm32_iodev_buf_ok(rx_buf, len)) {
+		spi_stm32_iodev_complete(dev, -EFAULT);
+		return;
+	}
+#endif /* CONFIG_DCACHE */
+
+	len /= frame_size_bytes;
+	data->status_flags = 0;
+
+	ret = spi_stm32_dma_rx_load(dev, rx_buf, len * data->dma_rx.dma_cfg.dest_data_size);
+	if (ret == 0) {
+		ret = spi_stm32_dma_tx_load(dev, tx_buf,
+					    len * data->dma_tx.dma_cfg.source_data_size);
+	}
+	if (ret != 0) {
+		spi_stm32_iodev_complete(dev, ret);
+		return;
+	}
+
+#if !DT_HAS_COMPAT_STATUS_OKAY(st_stm32h7_spi)
+	/* toggle the DMA request to restart the transfer */
+	LL_SPI_EnableDMAReq_RX(cfg->spi);
+	LL_SPI_EnableDMAReq_TX(cfg->spi);
+#endif /* ! st_stm32h7_spi */
+}
+
+/* Enable the SPI for a new transaction */
+static int spi_stm32_iodev_begin(const struct device *dev)
+{
+	const struct spi_stm32_config *cfg = dev->config;
+	struct spi_stm32_data *data = dev->data;
+	struct spi_dt_spec *spi_dt_spec = data->txn_curr->sqe.iodev->data;
+	SPI_TypeDef *spi = cfg->spi;
+	int ret;
+
+	if ((data->dma_tx.dma_dev == NULL) || (data->dma_rx.dma_dev == NULL)) {
+		return -ENOTSUP;
+	}
+
+	spi_stm32_pm_policy_state_lock_get(dev);
+
+	ret = spi_stm32_configure(dev, &spi_dt_spec->config);
+	if (ret != 0) {
+		spi_stm32_pm_policy_state_lock_put(dev);
+		return ret;
+	}
+
+#if DT_HAS_COMPAT_STATUS_OKAY(st_stm32h7_spi)
+	/* set request before enabling (else SPI CFG1 reg is write protected) */
+	LL_SPI_EnableDMAReq_RX(spi);
+	LL_SPI_EnableDMAReq_TX(spi);
+
+	LL_SPI_Enable(spi);
+	if (LL_SPI_GetMode(spi) == LL_SPI_MODE_MASTER) {
+		LL_SPI_StartMasterTransfer(spi);
+	}
+#else
+	LL_SPI_Enable(spi);
+#endif /* st_stm32h7_spi */
+
+	spi_stm32_cs_control(dev, true);
+
+	return 0;
+}
+
+/* Release the SPI at the end of a transaction */
+static void spi_stm32_iodev_end(const struct device *dev)
+{
+	const struct spi_stm32_config *cfg = dev->config;
+	struct spi_stm32_data *data = dev->data;
+	SPI_TypeDef *spi = cfg->spi;
+
+	if (LL_SPI_GetMode(spi) == LL_SPI_MODE_MASTER) {
+		while (ll_func_spi_is_busy(spi)) {
+			/* NOP */
+		}
+	}
+
+	spi_stm32_cs_control(dev, false);
+
+	if (!(data->ctx.config->operation & SPI_HOLD_ON_CS)) {
+		LL_SPI_Disable(spi);
+	}
+	LL_SPI_DisableDMAReq_TX(spi);
+	LL_SPI_DisableDMAReq_RX(spi);
+
+	(void)dma_stop(data->dma_rx.dma_dev, data->dma_rx.channel);
+	(void)dma_stop(data->dma_tx.dma_dev, data->dma_tx.channel);
+
+	spi_stm32_pm_policy_state_lock_put(dev);
+}
+
+static void spi_stm32_iodev_next(const struct device *dev, bool completion)
+{
+	struct spi_stm32_data *data = dev->data;
+	struct rtio_iodev_sqe *txn_head;
+	k_spinlock_key_t key;
+	int ret;
+
+	key = k_spin_lock(&data->lock);
+
+	if (!completion && data->txn_curr != NULL) {
+		k_spin_unlock(&data->lock, key);
+		return;
+	}
+
+	struct mpsc_node *next = mpsc_pop(&data->io_q);
+
+	if (next != NULL) {
+		struct rtio_iodev_sqe *next_sqe = CONTAINER_OF(next, struct rtio_iodev_sqe, q);
+
+		data->txn_head = next_sqe;
+		data->txn_curr = next_sqe;
+	} else {
+		data->txn_head = NULL;
+		data->txn_curr = NULL;
+	}
+
+	k_spin_unlock(&data->lock, key);
+
+	if (data->txn_curr == NULL) {
+		return;
+	}
+
+	ret = spi_stm32_iodev_begin(dev);
+	if (ret != 0) {
+		txn_head = data->txn_head;
+		spi_stm32_iodev_next(dev, true);
+		rtio_iodev_sqe_err(txn_head, ret);
+		return;
+	}
+
+	spi_stm32_iodev_start(dev);
+}
+
+/*
+ * Called from the DMA ISR once the current submission is done: the next
+ * submission of the transaction is loaded right away, so the whole chain
+ * runs back to back with the chip select held.
+ */
+static void spi_stm32_iodev_complete(const struct device *dev, int status)
+{
+	struct spi_stm32_data *data = dev->data;
+	struct rtio_iodev_sqe *txn_head;
+
+	if ((status == 0) && (data->txn_curr->sqe.flags & RTIO_SQE_TRANSACTION)) {
+		data->txn_curr = rtio_txn_next(data->txn_curr);
+		spi_stm32_iodev_start(dev);
+		return;
+	}
+
+	txn_head = data->txn_head;
+	spi_stm32_iodev_end(dev);
+	spi_stm32_iodev_next(dev, true);
+
+	if (status == 0) {
+		rtio_iodev_sqe_ok(txn_head, 0);
+	} else {
+		rtio_iodev_sqe_err(txn_head, status);
+	}
+}
+
+static void spi_stm32_iodev_submit(const struct device *dev,
+				   struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct spi_stm32_data *data = dev->data;
+
+	mpsc_push(&data->io_q, &iodev_sqe->q);
+	spi_stm32_iodev_next(dev, false);
+}
+
+/* Blocking transfers go through the RTIO queue so they are serialized with it */
+static int transceive_rtio(const struct device *dev,
+			   const struct spi_config *config,
+			   const struct spi_buf_set *tx_bufs,
+			   const struct spi_buf_set *rx_bufs)
+{
+	struct spi_stm32_data *data = dev->data;
+	struct spi_dt_spec *dt_spec = &data->dt_spec;
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+	int err = 0;
+	int ret;
+
+	spi_context_lock(&data->ctx, false, NULL, NULL, config);
+
+	dt_spec->config = *config;
+
+	ret = spi_rtio_copy(data->r, &data->iodev, tx_bufs, rx_bufs, &sqe);
+	if (ret < 0) {
+		err = ret;
+		goto end;
+	}
+
+	/* Submit request and wait */
+	rtio_submit(data->r, ret);
+
+	while (ret > 0) {
+		cqe = rtio_cqe_consume(data->r);
+
+		if (cqe->result < 0) {
+			err = cqe->result;
+		}
+
+		rtio_cqe_release(data->r, cqe);
+
+		ret--;
+	}
+
+end:
+	spi_context_release(&data->ctx, err);
+
+	return err;
+}
+#endif /* CONFIG_SPI_RTIO */
+
+
 				const struct spi_config *config,
 				const struct spi_buf_set *tx_bufs,
 				const struct spi_buf_set *rx_bufs)
@@ -1133,8 +1423,12 @@ static int spi_stm32_transceive(const struct device *dev,
 
 	if ((data->dma_tx.dma_dev != NULL)
 	 && (data->dma_rx.dma_dev != NULL)) {
+#ifdef CONFIG_SPI_RTIO
+		return transceive_rtio(dev, config, tx_bufs, rx_bufs);
+#else
 		return transceive_dma(dev, config, tx_bufs, rx_bufs,
 				      false, NULL, NULL);
+#endif /* CONFIG_SPI_RTIO */
 	}
 #endif /* CONFIG_SPI_STM32_DMA */
 	return transceive(dev, config, tx_bufs, rx_bufs, false, NULL, NULL);
@@ -1156,6 +1450,9 @@ static const struct spi_driver_api api_funcs = {
 	.transceive = spi_stm32_transceive,
 #ifdef CONFIG_SPI_ASYNC
 	.transceive_async = spi_stm32_transceive_async,
+#endif
+#ifdef CONFIG_SPI_RTIO
+	.iodev_submit = spi_stm32_iodev_submit,
 #endif
 	.release = spi_stm32_release,
 };
@@ -1230,6 +1527,14 @@ static int spi_stm32_init(const struct device *dev)
 
 #endif /* CONFIG_SPI_STM32_DMA */
 
+#ifdef CONFIG_SPI_RTIO
+	data->dev = dev;
+	data->dt_spec.bus = dev;
+	data->iodev.api = &spi_iodev_api;
+	data->iodev.data = &data->dt_spec;
+	mpsc_init(&data->io_q);
+#endif /* CONFIG_SPI_RTIO */
+
 	err = spi_context_cs_configure_all(&data->ctx);
 	if (err < 0) {
 		return err;
@@ -1358,6 +1663,16 @@ static void spi_stm32_irq_config_func_##id(const struct device *dev)		\
 #define SPI_DMA_STATUS_SEM(id)
 #endif /* CONFIG_SPI_STM32_DMA */
 
+#ifdef CONFIG_SPI_RTIO
+#define SPI_STM32_RTIO_DEFINE(id)					\
+	RTIO_DEFINE(spi_stm32_rtio_##id, CONFIG_SPI_STM32_RTIO_SQ_SIZE,	\
+		    CONFIG_SPI_STM32_RTIO_SQ_SIZE);
+#define SPI_STM32_RTIO_INIT(id)	.r = &spi_stm32_rtio_##id,
+#else
+#define SPI_STM32_RTIO_DEFINE(id)
+#define SPI_STM32_RTIO_INIT(id)
+#endif /* CONFIG_SPI_RTIO */
+
 #define SPI_SUPPORTS_FIFO(id)	DT_INST_NODE_HAS_PROP(id, fifo_enable)
 #define SPI_GET_FIFO_PROP(id)	DT_INST_PROP(id, fifo_enable)
 #define SPI_FIFO_ENABLED(id)	COND_CODE_1(SPI_SUPPORTS_FIFO(id), (SPI_GET_FIFO_PROP(id)), (0))
@@ -1388,6 +1703,8 @@ static const struct spi_stm32_config spi_stm32_cfg_##id = {		\
 			DT_INST_PROP(id, mssi_clock),))			\
 };									\
 									\
+SPI_STM32_RTIO_DEFINE(id)						\
+									\
 static struct spi_stm32_data spi_stm32_dev_data_##id = {		\
 	SPI_CONTEXT_INIT_LOCK(spi_stm32_dev_data_##id, ctx),		\
 	SPI_CONTEXT_INIT_SYNC(spi_stm32_dev_data_##id, ctx),		\
@@ -1395,6 +1712,7 @@ static struct spi_stm32_data spi_stm32_dev_data_##id = {		\
 	SPI_DMA_CHANNEL(id, tx, TX, MEMORY, PERIPHERAL)			\
 	SPI_DMA_STATUS_SEM(id)						\
 	SPI_CONTEXT_CS_GPIOS_INITIALIZE(DT_DRV_INST(id), ctx)		\
+	SPI_STM32_RTIO_INIT(id)						\
 };									\
 									\
 PM_DEVICE_DT_INST_DEFINE(id, spi_stm32_pm_action);			\
@@ -68,6 +68,16 @@ struct spi_stm32_data {
 	struct stream dma_rx;
 	struct stream dma_tx;
 #endif /* CONFIG_SPI_STM32_DMA */
+#ifdef CONFIG_SPI_RTIO
+	const struct device *dev;
+	struct k_spinlock lock;
+	struct rtio *r; /* context for blocking calls */
+	struct mpsc io_q;
+	struct rtio_iodev iodev;
+	struct rtio_iodev_sqe *txn_head;
+	struct rtio_iodev_sqe *txn_curr;
+	struct spi_dt_spec dt_spec;
+#endif /* CONFIG_SPI_RTIO */
 	bool pm_policy_state_on;
 };
 
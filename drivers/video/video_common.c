@@ -15,6 +15,8 @@ static struct video_buffer video_buf[CONFIG_VIDEO_BUFFER_POOL_NUM_MAX];
 
 struct mem_block {
 	void *data;
+	/* The memory belongs to the caller of video_buffer_import() */
+	bool imported;
 };
 
 static struct mem_block video_block[CONFIG_VIDEO_BUFFER_POOL_NUM_MAX];
@@ -44,6 +46,7 @@ struct video_buffer *video_buffer_aligned_alloc(size_t size, size_t align)
 		return NULL;
 	}
 
+	block->imported = false;
 	vbuf->buffer = block->data;
 	vbuf->size = size;
 	vbuf->bytesused = 0;
@@ -51,6 +54,38 @@ struct video_buffer *video_buffer_aligned_alloc(size_t size, size_t align)
 	return vbuf;
 }
 
+struct video_buffer *video_buffer_import(void *mem, size_t size)
+{
+	struct video_buffer *vbuf = NULL;
+	struct mem_block *block;
+	int i;
+
+	if (mem == NULL) {
+		return NULL;
+	}
+
+	/* find available video buffer */
+	for (i = 0; i < ARRAY_SIZE(video_buf); i++) {
+		if (video_buf[i].buffer == NULL) {
+			vbuf = &video_buf[i];
+			block = &video_block[i];
+			break;
+		}
+	}
+
+	if (vbuf == NULL) {
+		return NULL;
+	}
+
+	block->data = mem;
+	block->imported = true;
+	vbuf->buffer = mem;
+	vbuf->size = size;
+	vbuf->bytesused = 0;
+
+	return vbuf;
+}
+
 struct video_buffer *video_buffer_alloc(size_t size)
 {
 	return video_buffer_aligned_alloc(size, sizeof(void *));
@@ -71,6 +106,9 @@ void video_buffer_release(struct video_buffer *vbuf)
 
 	vbuf->buffer = NULL;
 	if (block) {
-		k_heap_free(&video_buffer_pool, block->data);
+		if (!block->imported) {
+			k_heap_free(&video_buffer_pool, block->data);
+		}
+		block->data = NULL;
 	}
 }
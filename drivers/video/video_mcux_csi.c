@@ -295,6 +295,11 @@ static int video_mcux_csi_enqueue(const struct device *dev, enum video_endpoint_
 	to_read = data->csi_config.linePitch_Bytes * data->csi_config.height;
 	vbuf->bytesused = to_read;
 
+	/* Imported buffers may have been written by the CPU: make sure no
+	 * dirty cache line gets evicted over the frame while it is captured.
+	 */
+	video_buffer_cache_invalidate(vbuf);
+
 	ret = CSI_TransferSubmitEmptyBuffer(config->base, &data->csi_handle,
 					    (uint32_t)vbuf->buffer);
 	if (ret != kStatus_Success) {
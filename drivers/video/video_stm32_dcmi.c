@@ -21,7 +21,8 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(video_stm32_dcmi, CONFIG_STM32_DCMI_LOG_LEVEL);
 
-K_HEAP_DEFINE(video_stm32_buffer_pool, CONFIG_VIDEO_BUFFER_POOL_SZ_MAX);
+K_HEAP_DEFINE(video_stm32_buffer_pool,
+	      CONFIG_VIDEO_BUFFER_POOL_SZ_MAX + CONFIG_VIDEO_BUFFER_POOL_ALIGN);
 
 typedef void (*irq_config_func_t)(const struct device *dev);
 
@@ -90,6 +91,8 @@ void HAL_DCMI_FrameEventCallback(DCMI_HandleTypeDef *hdcmi)
 	}
 
 	vbuf->timestamp = k_uptime_get_32();
+	/* Drop stale cache lines of the previous frame before reading */
+	sys_cache_data_invd_range(dev_data->buffer, vbuf->bytesused);
 	memcpy(vbuf->buffer, dev_data->buffer, vbuf->bytesused);
 
 	k_fifo_put(&dev_data->fifo_out, vbuf);
@@ -261,7 +264,10 @@ static int video_stm32_dcmi_stream_start(const struct device *dev)
 	const struct video_stm32_dcmi_config *config = dev->config;
 	size_t buffer_size = data->pitch * data->height;
 
-	data->buffer = k_heap_alloc(&video_stm32_buffer_pool, buffer_size, K_NO_WAIT);
+	/* Cache line aligned, so that invalidating it spares the heap */
+	data->buffer = k_heap_aligned_alloc(&video_stm32_buffer_pool,
+					    CONFIG_VIDEO_BUFFER_POOL_ALIGN,
+					    buffer_size, K_NO_WAIT);
 	if (data->buffer == NULL) {
 		LOG_ERR("Failed to allocate DCMI buffer for image. Size %d bytes", buffer_size);
 		return -ENOMEM;
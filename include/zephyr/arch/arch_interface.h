@@ -1278,6 +1278,17 @@ typedef bool (*stack_trace_callback_fn)(void *cookie, unsigned long addr);
 void arch_stack_walk(stack_trace_callback_fn callback_fn, void *cookie,
 		     const struct k_thread *thread, const struct arch_esf *esf);
 
+/**
+ * @brief Get the program counter of the thread interrupted by the current ISR
+ *
+ * Used by sampling profilers. Only available when
+ * @kconfig{CONFIG_ARCH_HAS_IRQ_INTERRUPTED_PC} is selected.
+ *
+ * @return Address of the instruction the interrupted thread resumes at, or 0
+ *         if the ISR preempted another ISR.
+ */
+uintptr_t arch_irq_interrupted_pc(void);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
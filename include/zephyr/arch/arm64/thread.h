@@ -66,6 +66,8 @@ struct _thread_arch {
 #endif
 #ifdef CONFIG_FPU_SHARING
 	struct z_arm64_fp_context saved_fp_context;
+	/* FPU context switches to perform without waiting for a trap */
+	uint8_t fpu_reclaims;
 #endif
 	uint8_t exception_depth;
 };
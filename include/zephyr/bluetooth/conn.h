@@ -676,6 +676,54 @@ int bt_conn_le_set_path_loss_mon_param(struct bt_conn *conn,
  */
 int bt_conn_le_set_path_loss_mon_enable(struct bt_conn *conn, bool enable);
 
+/** @brief Transmit scheduling statistics of a connection */
+struct bt_conn_tx_stats {
+	/** Number of fragments sent to the controller */
+	uint32_t frags;
+	/** Number of turns the connection waited for */
+	uint32_t waits;
+	/** Total time spent waiting for a turn, in microseconds */
+	uint64_t wait_us;
+	/** Longest wait for a turn, in microseconds */
+	uint32_t max_wait_us;
+};
+
+/** @brief Set the transmit weight of a connection.
+ *
+ *  The weight is the number of controller buffers the connection can hold
+ *  before the host serves the next connection with data to send, giving the
+ *  connection a larger or smaller share of the controller buffers.
+ *
+ *  @param conn   Connection object.
+ *  @param weight Number of controller buffers, 0 for
+ *                @kconfig{CONFIG_BT_CONN_TX_WEIGHT}.
+ *
+ *  @return Zero on success or (negative) error code on failure.
+ */
+int bt_conn_tx_weight_set(struct bt_conn *conn, uint8_t weight);
+
+/** @brief Get the transmit scheduling statistics of a connection.
+ *
+ *  A connection waits for a turn from the moment it has data to send, or it
+ *  used up its weight, until the host picks it to send its next fragment.
+ *
+ *  @note To use this API @kconfig{CONFIG_BT_CONN_TX_STATS} must be set.
+ *
+ *  @param conn  Connection object.
+ *  @param stats Statistics since the connection was created or last reset.
+ *
+ *  @return Zero on success or (negative) error code on failure.
+ */
+int bt_conn_tx_stats_get(const struct bt_conn *conn, struct bt_conn_tx_stats *stats);
+
+/** @brief Reset the transmit scheduling statistics of a connection.
+ *
+ *  @note To use this API @kconfig{CONFIG_BT_CONN_TX_STATS} must be set.
+ *
+ *  @param conn Connection object.
+ */
+void bt_conn_tx_stats_reset(struct bt_conn *conn);
+
 /** @brief Update the connection parameters.
  *
  *  If the local device is in the peripheral role then updating the connection
@@ -213,6 +213,35 @@ struct bt_hci_cp_vs_set_min_num_used_chans {
 	uint8_t  min_used_chans;
 } __packed;
 
+#define BT_HCI_VS_SCAN_FILTER_OFFSET_ANY       0xff
+#define BT_HCI_VS_SCAN_FILTER_DATA_MAX         16
+#define BT_HCI_OP_VS_SCAN_FILTER_ADD           BT_OP(BT_OGF_VS, 0x0013)
+
+/* Pattern matching AD elements of type ad_type whose value holds data at
+ * offset, or at any multiple of len with BT_HCI_VS_SCAN_FILTER_OFFSET_ANY
+ * (UUID lists). A pattern of len 0 matches any element of type ad_type.
+ */
+struct bt_hci_cp_vs_scan_filter_add {
+	uint8_t  ad_type;
+	uint8_t  offset;
+	uint8_t  len;
+	uint8_t  data[0];
+} __packed;
+
+#define BT_HCI_OP_VS_SCAN_FILTER_CLEAR         BT_OP(BT_OGF_VS, 0x0014)
+
+#define BT_HCI_VS_SCAN_FILTER_DISABLED         0x00
+#define BT_HCI_VS_SCAN_FILTER_ENABLED          0x01
+#define BT_HCI_OP_VS_SET_SCAN_REPORT_PARAMS    BT_OP(BT_OGF_VS, 0x0015)
+
+/* Windows in milliseconds, 0 disables deduplication or batching */
+struct bt_hci_cp_vs_set_scan_report_params {
+	uint8_t  filter;
+	uint16_t dedup_window;
+	uint16_t batch_window;
+	uint8_t  batch_max;
+} __packed;
+
 /* Events */
 
 struct bt_hci_evt_vs {
@@ -883,6 +883,86 @@ int bt_iso_chan_send(struct bt_iso_chan *chan, struct net_buf *buf, uint16_t seq
 int bt_iso_chan_send_ts(struct bt_iso_chan *chan, struct net_buf *buf, uint16_t seq_num,
 			uint32_t ts);
 
+/** @brief ISO TX stream
+ *
+ *  Sends the SDUs of an ISO channel, one per SDU interval, from a pool of buffers
+ *  dedicated to the stream. Each SDU is sent with bt_iso_chan_send_ts() stamped with its
+ *  sequence number and SDU reference timestamp, so the application may queue several
+ *  SDUs ahead of their transmission without allocating from shared pools or tracking
+ *  either value. Define with @ref BT_ISO_TX_STREAM_DEFINE.
+ */
+struct bt_iso_tx_stream {
+	/** @cond INTERNAL_HIDDEN */
+	struct net_buf_pool *pool;
+	struct bt_iso_chan *chan;
+	uint32_t interval;
+	uint32_t ts;
+	uint16_t seq_num;
+	/** @endcond */
+};
+
+/** @brief Statically define an ISO TX stream
+ *
+ *  @param _name  Name of the stream.
+ *  @param _count Number of SDU buffers, i.e. the maximum number of SDUs queued ahead.
+ *  @param _sdu   Maximum SDU size in octets.
+ */
+#define BT_ISO_TX_STREAM_DEFINE(_name, _count, _sdu)                                            \
+	NET_BUF_POOL_FIXED_DEFINE(_CONCAT(_name, _pool), _count, BT_ISO_SDU_BUF_SIZE(_sdu),     \
+				  CONFIG_BT_CONN_TX_USER_DATA_SIZE, NULL);                      \
+	static struct bt_iso_tx_stream _name = {                                                \
+		.pool = &_CONCAT(_name, _pool),                                                 \
+	}
+
+/** @brief Start an ISO TX stream
+ *
+ *  @param stream   Stream.
+ *  @param chan     Connected channel to send the SDUs on.
+ *  @param seq_num  Sequence number of the first SDU.
+ *  @param ts       SDU reference timestamp of the first SDU in microseconds, e.g. derived
+ *                  from bt_iso_chan_get_tx_sync() for a channel already sending.
+ *  @param interval SDU interval in microseconds.
+ */
+void bt_iso_tx_stream_start(struct bt_iso_tx_stream *stream, struct bt_iso_chan *chan,
+			    uint16_t seq_num, uint32_t ts, uint32_t interval);
+
+/** @brief Get a buffer for the next SDU of an ISO TX stream
+ *
+ *  The buffer has the headroom needed by the stack reserved. Buffers return to the
+ *  stream once their SDU is sent, or when the application unreferences them.
+ *
+ *  @param stream  Stream.
+ *  @param timeout Time to wait for an SDU of the stream to be sent.
+ *
+ *  @return Buffer, or NULL if all the buffers are queued.
+ */
+struct net_buf *bt_iso_tx_stream_buf_get(struct bt_iso_tx_stream *stream, k_timeout_t timeout);
+
+/** @brief Send the next SDU of an ISO TX stream
+ *
+ *  The SDU is sent with the next sequence number and a timestamp one SDU interval after
+ *  the previous one.
+ *
+ *  @note Buffer ownership is transferred to the stack in case of success, in
+ *  case of an error the caller retains the ownership of the buffer.
+ *
+ *  @param stream Stream.
+ *  @param buf    Buffer from bt_iso_tx_stream_buf_get() holding the SDU.
+ *
+ *  @return 0 in case of success or negative value in case of error, see bt_iso_chan_send_ts().
+ */
+int bt_iso_tx_stream_send(struct bt_iso_tx_stream *stream, struct net_buf *buf);
+
+/** @brief Skip SDU intervals of an ISO TX stream
+ *
+ *  To be called when no SDU is available for some SDU intervals, e.g. after an underrun
+ *  of the audio source, so that the next SDU keeps its place in the schedule.
+ *
+ *  @param stream Stream.
+ *  @param count  Number of SDU intervals without SDU.
+ */
+void bt_iso_tx_stream_skip(struct bt_iso_tx_stream *stream, uint16_t count);
+
 /** @brief ISO Unicast TX Info Structure */
 struct bt_iso_unicast_tx_info {
 	/** The transport latency in us */
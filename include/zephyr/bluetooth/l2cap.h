@@ -67,8 +67,8 @@ extern "C" {
  *
  *  The MTU for incoming L2CAP SDUs with segmentation is defined by the
  *  size of the application buffer pool. The application will have to define
- *  an alloc_buf callback for the channel in order to support receiving
- *  segmented L2CAP SDUs.
+ *  an alloc_buf or alloc_sdu callback for the channel in order to support
+ *  receiving segmented L2CAP SDUs.
  */
 #define BT_L2CAP_SDU_RX_MTU (BT_L2CAP_RX_MTU - BT_L2CAP_SDU_HDR_SIZE)
 
@@ -327,7 +327,7 @@ struct bt_l2cap_chan_ops {
 	 *
 	 *  If this callback is provided the channel will use it to allocate
 	 *  buffers to store incoming data. Channels that requires segmentation
-	 *  must set this callback.
+	 *  must set this callback or @ref alloc_sdu.
 	 *  If the application has not set a callback the L2CAP SDU MTU will be
 	 *  truncated to @ref BT_L2CAP_SDU_RX_MTU.
 	 *
@@ -337,6 +337,25 @@ struct bt_l2cap_chan_ops {
 	 */
 	struct net_buf *(*alloc_buf)(struct bt_l2cap_chan *chan);
 
+	/** @brief Channel alloc_sdu callback
+	 *
+	 *  If this callback is provided the channel will use it, in place of
+	 *  @ref alloc_buf, to get the destination buffer of each incoming SDU
+	 *  once its length is known from the first PDU. The SDU is assembled
+	 *  in place in the returned buffer, which is then passed to @ref recv.
+	 *  The buffer may reference application storage, e.g. allocated with
+	 *  net_buf_alloc_with_data(), and must have room for the whole SDU:
+	 *  credits for the full SDU are then given at once to the peer.
+	 *  Returning NULL makes the channel fall back to @ref alloc_buf, if
+	 *  set, or disconnect.
+	 *
+	 *  @param chan The channel requesting a buffer.
+	 *  @param sdu_len Length of the SDU to receive.
+	 *
+	 *  @return Buffer with at least @p sdu_len bytes of tailroom.
+	 */
+	struct net_buf *(*alloc_sdu)(struct bt_l2cap_chan *chan, uint16_t sdu_len);
+
 	/** @brief Channel recv callback
 	 *
 	 *  @param chan The channel receiving data.
@@ -35,10 +35,18 @@ struct bt_mesh_statistic {
 	uint32_t rx_proxy;
 	/** Received over unknown interface. */
 	uint32_t rx_uknown;
+	/** Received frames dropped as duplicates of recently received ones. */
+	uint32_t rx_dup;
 	/** Counter of frames that were initiated to relay over advertiser bearer. */
 	uint32_t tx_adv_relay_planned;
 	/** Counter of frames that succeeded relaying over advertiser bearer. */
 	uint32_t tx_adv_relay_succeeded;
+	/** Sum of the delays between the reception of the frames relayed over
+	 *  advertiser bearer and the start of their transmission, in milliseconds.
+	 */
+	uint32_t tx_adv_relay_latency_sum;
+	/** Longest of these delays, in milliseconds. */
+	uint32_t tx_adv_relay_latency_max;
 	/** Counter of frames that were initiated to send over advertiser bearer locally. */
 	uint32_t tx_local_planned;
 	/** Counter of frames that succeeded to send over advertiser bearer locally. */
@@ -281,6 +281,26 @@ void isotp_unbind(struct isotp_recv_ctx *rctx);
  */
 int isotp_recv(struct isotp_recv_ctx *rctx, uint8_t *data, size_t len, k_timeout_t timeout);
 
+/**
+ * @brief Set the buffer the next multi-frame message is received into
+ *
+ * The consecutive frames of the next multi-frame message are written
+ * directly into @p buf, as they are received. The message is then returned
+ * by isotp_recv_net() as a single net_buf whose data is @p buf, or by
+ * isotp_recv() without copying when called with @p buf. The buffer is only
+ * used for one message, and must be set again for the following one. A
+ * message longer than @p size is rejected with an overflow flow control
+ * frame, the buffer then being kept for the next message.
+ *
+ * Single frame messages are still received in the SF and FF buffers.
+ *
+ * @param rctx Context that is already bound.
+ * @param buf  Buffer, which must not be accessed until the message has
+ *             been received.
+ * @param size Size of the buffer.
+ */
+void isotp_set_recv_buf(struct isotp_recv_ctx *rctx, uint8_t *buf, size_t size);
+
 /**
  * @brief Get the net buffer on data reception
  *
@@ -436,7 +456,7 @@ struct isotp_send_ctx {
 	};
 	struct isotp_fc_opts opts;
 	uint8_t state;
-	uint8_t tx_backlog;
+	atomic_t tx_backlog;
 	struct k_sem tx_sem;
 	struct isotp_msg_id rx_addr;
 	struct isotp_msg_id tx_addr;
@@ -468,6 +488,12 @@ struct isotp_recv_ctx {
 	uint8_t bs;
 	uint8_t wft;
 	uint8_t sn_expected : 4;
+	uint8_t is_user_buf : 1;
+#ifdef CONFIG_ISOTP_RX_USER_BUF
+	/* buffer for the next multi-frame message, see isotp_set_recv_buf */
+	uint8_t *user_buf;
+	size_t user_buf_size;
+#endif
 };
 
 /** @endcond */
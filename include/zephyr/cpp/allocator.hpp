@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief C++ allocators backed by Zephyr memory pools
+ */
+
+#ifndef ZEPHYR_INCLUDE_CPP_ALLOCATOR_HPP_
+#define ZEPHYR_INCLUDE_CPP_ALLOCATOR_HPP_
+
+#if __cplusplus < 201103L
+#error "zephyr/cpp/allocator.hpp requires C++11 or later"
+#endif
+
+#include <cstddef>
+#include <new>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/arena.h>
+
+/**
+ * @defgroup cpp_allocators C++ Allocators
+ * @ingroup memory_management
+ *
+ * Allocators meeting the C++ Allocator requirements, so standard library
+ * containers, or any allocator-aware class, can take their memory from a
+ * k_heap, a k_mem_slab or a sys_arena instead of the global heap.
+ *
+ * The allocators never block. When the pool is exhausted they throw
+ * std::bad_alloc if exceptions are enabled and return a null pointer
+ * otherwise, as the minimal C++ library operator new does.
+ *
+ * @{
+ */
+
+namespace zephyr {
+
+/** @cond INTERNAL_HIDDEN */
+namespace detail {
+
+template <typename T> inline T *alloc_result(void *mem)
+{
+#if defined(CONFIG_CPP_EXCEPTIONS)
+	if (mem == nullptr) {
+		throw std::bad_alloc();
+	}
+#endif
+	return static_cast<T *>(mem);
+}
+
+} /* namespace detail */
+/** @endcond */
+
+/**
+ * @brief Allocator taking its memory from a k_heap
+ *
+ * Any number of objects can be allocated at once, the memory is aligned
+ * for @p T.
+ *
+ * @tparam T Type of the allocated objects
+ */
+template <typename T> class heap_allocator {
+public:
+	/** Type of the allocated objects */
+	typedef T value_type;
+
+	/**
+	 * @brief Build an allocator for a heap
+	 *
+	 * @param heap Heap to allocate from, must outlive the allocator
+	 */
+	explicit heap_allocator(struct k_heap *heap) noexcept : heap_(heap)
+	{
+	}
+
+	/** @brief Rebind an allocator of the same heap to another type */
+	template <typename U>
+	heap_allocator(const heap_allocator<U> &other) noexcept : heap_(other.heap())
+	{
+	}
+
+	/**
+	 * @brief Allocate memory for @p n objects
+	 *
+	 * @param n Number of objects
+	 * @return Pointer to the memory, or NULL when the heap is full
+	 */
+	T *allocate(std::size_t n)
+	{
+		if (n > SIZE_MAX / sizeof(T)) {
+			return detail::alloc_result<T>(nullptr);
+		}
+
+		return detail::alloc_result<T>(
+			k_heap_aligned_alloc(heap_, alignof(T), n * sizeof(T), K_NO_WAIT));
+	}
+
+	/**
+	 * @brief Free memory returned by allocate()
+	 *
+	 * @param p Pointer to the memory
+	 * @param n Number of objects it was allocated for
+	 */
+	void deallocate(T *p, std::size_t n) noexcept
+	{
+		ARG_UNUSED(n);
+
+		k_heap_free(heap_, p);
+	}
+
+	/** @return The heap of the allocator */
+	struct k_heap *heap() const noexcept
+	{
+		return heap_;
+	}
+
+private:
+	struct k_heap *heap_;
+};
+
+/** @brief Allocators of the same heap can free each other's memory */
+template <typename T, typename U>
+inline bool operator==(const heap_allocator<T> &a, const heap_allocator<U> &b) noexcept
+{
+	return a.heap() == b.heap();
+}
+
+/** @brief Allocators of different heaps cannot free each other's memory */
+template <typename T, typename U>
+inline bool operator!=(const heap_allocator<T> &a, const heap_allocator<U> &b) noexcept
+{
+	return !(a == b);
+}
+
+/**
+ * @brief Allocator taking its memory from a k_mem_slab
+ *
+ * Allocations and frees take constant time, but only one object can be
+ * allocated at a time and it must fit in a block of the slab. This suits
+ * node based containers, such as lists, sets and maps, but not vectors.
+ * The slab blocks must be aligned for @p T.
+ *
+ * @tparam T Type of the allocated objects
+ */
+template <typename T> class slab_allocator {
+public:
+	/** Type of the allocated objects */
+	typedef T value_type;
+
+	/**
+	 * @brief Build an allocator for a memory slab
+	 *
+	 * @param slab Slab to allocate from, must outlive the allocator
+	 */
+	explicit slab_allocator(struct k_mem_slab *slab) noexcept : slab_(slab)
+	{
+	}
+
+	/** @brief Rebind an allocator of the same slab to another type */
+	template <typename U>
+	slab_allocator(const slab_allocator<U> &other) noexcept : slab_(other.slab())
+	{
+	}
+
+	/**
+	 * @brief Allocate a block for one object
+	 *
+	 * @param n Number of objects, anything but 1 fails
+	 * @return Pointer to the block, or NULL when the slab is full or the
+	 *         objects do not fit in a block
+	 */
+	T *allocate(std::size_t n)
+	{
+		void *mem = nullptr;
+
+		if ((n == 1U) && (sizeof(T) <= slab_->info.block_size)) {
+			if (k_mem_slab_alloc(slab_, &mem, K_NO_WAIT) != 0) {
+				mem = nullptr;
+			}
+		}
+
+		__ASSERT(IS_ALIGNED(mem, alignof(T)), "slab blocks are misaligned");
+
+		return detail::alloc_result<T>(mem);
+	}
+
+	/**
+	 * @brief Free a block returned by allocate()
+	 *
+	 * @param p Pointer to the block
+	 * @param n Number of objects, always 1
+	 */
+	void deallocate(T *p, std::size_t n) noexcept
+	{
+		ARG_UNUSED(n);
+
+		k_mem_slab_free(slab_, p);
+	}
+
+	/** @return The slab of the allocator */
+	struct k_mem_slab *slab() const noexcept
+	{
+		return slab_;
+	}
+
+private:
+	struct k_mem_slab *slab_;
+};
+
+/** @brief Allocators of the same slab can free each other's memory */
+template <typename T, typename U>
+inline bool operator==(const slab_allocator<T> &a, const slab_allocator<U> &b) noexcept
+{
+	return a.slab() == b.slab();
+}
+
+/** @brief Allocators of different slabs cannot free each other's memory */
+template <typename T, typename U>
+inline bool operator!=(const slab_allocator<T> &a, const slab_allocator<U> &b) noexcept
+{
+	return !(a == b);
+}
+
+/**
+ * @brief Allocator taking its memory from a sys_arena
+ *
+ * Allocations only cost an alignment and a comparison. The memory is given
+ * back all at once with sys_arena_rewind() or sys_arena_reset(), typically
+ * at the end of a processing cycle. Freeing the last allocation gives it
+ * back too, anything else is a no-op. Requires CONFIG_SYS_ARENA.
+ *
+ * Like the arena itself, the allocator is not thread safe.
+ *
+ * @tparam T Type of the allocated objects
+ */
+template <typename T> class arena_allocator {
+public:
+	/** Type of the allocated objects */
+	typedef T value_type;
+
+	/**
+	 * @brief Build an allocator for an arena
+	 *
+	 * @param arena Arena to allocate from, must outlive the allocator
+	 */
+	explicit arena_allocator(struct sys_arena *arena) noexcept : arena_(arena)
+	{
+	}
+
+	/** @brief Rebind an allocator of the same arena to another type */
+	template <typename U>
+	arena_allocator(const arena_allocator<U> &other) noexcept : arena_(other.arena())
+	{
+	}
+
+	/**
+	 * @brief Allocate memory for @p n objects
+	 *
+	 * @param n Number of objects
+	 * @return Pointer to the memory, or NULL when the arena is full
+	 */
+	T *allocate(std::size_t n)
+	{
+		if (n > SIZE_MAX / sizeof(T)) {
+			return detail::alloc_result<T>(nullptr);
+		}
+
+		return detail::alloc_result<T>(
+			sys_arena_aligned_alloc(arena_, alignof(T), n * sizeof(T)));
+	}
+
+	/**
+	 * @brief Give back memory returned by allocate()
+	 *
+	 * Only takes effect for the last allocation of the arena.
+	 *
+	 * @param p Pointer to the memory
+	 * @param n Number of objects it was allocated for
+	 */
+	void deallocate(T *p, std::size_t n) noexcept
+	{
+		uint8_t *mem = reinterpret_cast<uint8_t *>(p);
+
+		if (mem + n * sizeof(T) == arena_->base + arena_->offset) {
+			sys_arena_rewind(arena_, static_cast<sys_arena_mark_t>(mem - arena_->base));
+		}
+	}
+
+	/** @return The arena of the allocator */
+	struct sys_arena *arena() const noexcept
+	{
+		return arena_;
+	}
+
+private:
+	struct sys_arena *arena_;
+};
+
+/** @brief Allocators of the same arena can free each other's memory */
+template <typename T, typename U>
+inline bool operator==(const arena_allocator<T> &a, const arena_allocator<U> &b) noexcept
+{
+	return a.arena() == b.arena();
+}
+
+/** @brief Allocators of different arenas cannot free each other's memory */
+template <typename T, typename U>
+inline bool operator!=(const arena_allocator<T> &a, const arena_allocator<U> &b) noexcept
+{
+	return !(a == b);
+}
+
+} /* namespace zephyr */
+
+/** @} */
+
+#endif /* ZEPHYR_INCLUDE_CPP_ALLOCATOR_HPP_ */
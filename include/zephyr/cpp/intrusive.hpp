@@ -0,0 +1,452 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Type safe C++ wrappers of the intrusive lists and trees
+ */
+
+#ifndef ZEPHYR_INCLUDE_CPP_INTRUSIVE_HPP_
+#define ZEPHYR_INCLUDE_CPP_INTRUSIVE_HPP_
+
+#if __cplusplus < 201103L
+#error "zephyr/cpp/intrusive.hpp requires C++11 or later"
+#endif
+
+#include <cstddef>
+
+#include <zephyr/sys/slist.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/rb.h>
+
+/**
+ * @defgroup cpp_containers C++ Containers
+ * @ingroup datastructure_apis
+ *
+ * Containers which never allocate memory: a fixed capacity vector, and
+ * wrappers of sys_slist_t, sys_dlist_t and struct rbtree linking objects
+ * through a node member, given as a pointer to member. The wrappers only
+ * link and unlink the objects, which are owned by the caller and must
+ * outlive their membership.
+ *
+ * @{
+ */
+
+namespace zephyr {
+
+/** @cond INTERNAL_HIDDEN */
+namespace detail {
+
+template <typename T, typename M> inline T *container_of(M *ptr, M T::*member)
+{
+	/* Equivalent of offsetof() for a pointer to member */
+	std::size_t offset = reinterpret_cast<std::size_t>(
+		&(reinterpret_cast<T *>(sizeof(T))->*member)) - sizeof(T);
+
+	return reinterpret_cast<T *>(reinterpret_cast<char *>(ptr) - offset);
+}
+
+/* Forward iterator over the objects of a list */
+template <typename T, typename N, N T::*Node, N *(*Next)(void *, N *)> class list_iterator {
+public:
+	list_iterator(void *list, N *node) noexcept : list_(list), node_(node)
+	{
+	}
+
+	T &operator*() const noexcept
+	{
+		return *container_of(node_, Node);
+	}
+
+	T *operator->() const noexcept
+	{
+		return container_of(node_, Node);
+	}
+
+	list_iterator &operator++() noexcept
+	{
+		node_ = Next(list_, node_);
+		return *this;
+	}
+
+	bool operator==(const list_iterator &other) const noexcept
+	{
+		return node_ == other.node_;
+	}
+
+	bool operator!=(const list_iterator &other) const noexcept
+	{
+		return node_ != other.node_;
+	}
+
+private:
+	void *list_;
+	N *node_;
+};
+
+inline sys_snode_t *slist_next(void *list, sys_snode_t *node)
+{
+	ARG_UNUSED(list);
+
+	return sys_slist_peek_next(node);
+}
+
+inline sys_dnode_t *dlist_next(void *list, sys_dnode_t *node)
+{
+	return sys_dlist_peek_next(static_cast<sys_dlist_t *>(list), node);
+}
+
+} /* namespace detail */
+/** @endcond */
+
+/**
+ * @brief Singly linked list of objects
+ *
+ * Wraps a sys_slist_t. Most operations take constant time, but remove()
+ * takes linear time.
+ *
+ * @tparam T Type of the objects
+ * @tparam Node sys_snode_t member of @p T linking the objects
+ */
+template <typename T, sys_snode_t T::*Node> class slist {
+public:
+	/** Type of the iterators */
+	typedef detail::list_iterator<T, sys_snode_t, Node, detail::slist_next> iterator;
+
+	slist() noexcept
+	{
+		sys_slist_init(&list_);
+	}
+
+	slist(const slist &) = delete;
+	slist &operator=(const slist &) = delete;
+
+	/** @return true if the list has no object */
+	bool empty() noexcept
+	{
+		return sys_slist_is_empty(&list_);
+	}
+
+	/** @return The first object, or NULL if the list is empty */
+	T *front() noexcept
+	{
+		return from_node(sys_slist_peek_head(&list_));
+	}
+
+	/** @return The last object, or NULL if the list is empty */
+	T *back() noexcept
+	{
+		return from_node(sys_slist_peek_tail(&list_));
+	}
+
+	/** @brief Insert an object at the start of the list */
+	void push_front(T &obj) noexcept
+	{
+		sys_slist_prepend(&list_, &(obj.*Node));
+	}
+
+	/** @brief Insert an object at the end of the list */
+	void push_back(T &obj) noexcept
+	{
+		sys_slist_append(&list_, &(obj.*Node));
+	}
+
+	/** @brief Insert an object after another, or first if @p prev is NULL */
+	void insert_after(T *prev, T &obj) noexcept
+	{
+		sys_slist_insert(&list_, (prev != nullptr) ? &(prev->*Node) : nullptr,
+				 &(obj.*Node));
+	}
+
+	/** @return The first object, unlinked, or NULL if the list is empty */
+	T *pop_front() noexcept
+	{
+		return from_node(sys_slist_get(&list_));
+	}
+
+	/** @return true if the object was found and unlinked */
+	bool remove(T &obj) noexcept
+	{
+		return sys_slist_find_and_remove(&list_, &(obj.*Node));
+	}
+
+	/** @return Number of objects, counted in linear time */
+	std::size_t size() noexcept
+	{
+		return sys_slist_len(&list_);
+	}
+
+	iterator begin() noexcept
+	{
+		return iterator(&list_, sys_slist_peek_head(&list_));
+	}
+
+	iterator end() noexcept
+	{
+		return iterator(&list_, nullptr);
+	}
+
+	/** @return The wrapped list */
+	sys_slist_t *native() noexcept
+	{
+		return &list_;
+	}
+
+private:
+	static T *from_node(sys_snode_t *node) noexcept
+	{
+		return (node != nullptr) ? detail::container_of(node, Node) : nullptr;
+	}
+
+	sys_slist_t list_;
+};
+
+/**
+ * @brief Doubly linked list of objects
+ *
+ * Wraps a sys_dlist_t. All operations take constant time, except for
+ * size().
+ *
+ * @tparam T Type of the objects
+ * @tparam Node sys_dnode_t member of @p T linking the objects
+ */
+template <typename T, sys_dnode_t T::*Node> class dlist {
+public:
+	/** Type of the iterators */
+	typedef detail::list_iterator<T, sys_dnode_t, Node, detail::dlist_next> iterator;
+
+	dlist() noexcept
+	{
+		sys_dlist_init(&list_);
+	}
+
+	dlist(const dlist &) = delete;
+	dlist &operator=(const dlist &) = delete;
+
+	/** @return true if the list has no object */
+	bool empty() noexcept
+	{
+		return sys_dlist_is_empty(&list_);
+	}
+
+	/** @return The first object, or NULL if the list is empty */
+	T *front() noexcept
+	{
+		return from_node(sys_dlist_peek_head(&list_));
+	}
+
+	/** @return The last object, or NULL if the list is empty */
+	T *back() noexcept
+	{
+		return from_node(sys_dlist_peek_tail(&list_));
+	}
+
+	/** @return The object following @p obj, or NULL if it is the last */
+	T *next(T &obj) noexcept
+	{
+		return from_node(sys_dlist_peek_next(&list_, &(obj.*Node)));
+	}
+
+	/** @return The object preceding @p obj, or NULL if it is the first */
+	T *prev(T &obj) noexcept
+	{
+		return from_node(sys_dlist_peek_prev(&list_, &(obj.*Node)));
+	}
+
+	/** @brief Insert an object at the start of the list */
+	void push_front(T &obj) noexcept
+	{
+		sys_dlist_prepend(&list_, &(obj.*Node));
+	}
+
+	/** @brief Insert an object at the end of the list */
+	void push_back(T &obj) noexcept
+	{
+		sys_dlist_append(&list_, &(obj.*Node));
+	}
+
+	/** @brief Insert an object before @p next, an object of the list */
+	void insert_before(T &next, T &obj) noexcept
+	{
+		sys_dlist_insert(&(next.*Node), &(obj.*Node));
+	}
+
+	/** @return The first object, unlinked, or NULL if the list is empty */
+	T *pop_front() noexcept
+	{
+		return from_node(sys_dlist_get(&list_));
+	}
+
+	/** @brief Unlink an object of the list */
+	static void remove(T &obj) noexcept
+	{
+		sys_dlist_remove(&(obj.*Node));
+	}
+
+	/** @return true if the object is linked in a list */
+	static bool is_linked(const T &obj) noexcept
+	{
+		return sys_dnode_is_linked(&(obj.*Node));
+	}
+
+	/** @return Number of objects, counted in linear time */
+	std::size_t size() noexcept
+	{
+		return sys_dlist_len(&list_);
+	}
+
+	iterator begin() noexcept
+	{
+		return iterator(&list_, sys_dlist_peek_head(&list_));
+	}
+
+	iterator end() noexcept
+	{
+		return iterator(&list_, nullptr);
+	}
+
+	/** @return The wrapped list */
+	sys_dlist_t *native() noexcept
+	{
+		return &list_;
+	}
+
+private:
+	static T *from_node(sys_dnode_t *node) noexcept
+	{
+		return (node != nullptr) ? detail::container_of(node, Node) : nullptr;
+	}
+
+	sys_dlist_t list_;
+};
+
+/**
+ * @brief Ordered map of objects
+ *
+ * Wraps a struct rbtree, sorting the objects with @p Less. Insertion,
+ * removal and lookups take logarithmic time. Objects comparing equal
+ * can be inserted, the last one is sorted after the others.
+ *
+ * @tparam T Type of the objects
+ * @tparam Node struct rbnode member of @p T linking the objects
+ * @tparam Less Function object type, with a default constructor, taking
+ *              two objects and returning true if the first one sorts
+ *              strictly before the second
+ */
+template <typename T, struct rbnode T::*Node, typename Less> class rbmap {
+public:
+	rbmap() noexcept : tree_()
+	{
+		tree_.lessthan_fn = lessthan;
+	}
+
+	rbmap(const rbmap &) = delete;
+	rbmap &operator=(const rbmap &) = delete;
+
+	/** @return true if the map has no object */
+	bool empty() const noexcept
+	{
+		return tree_.root == nullptr;
+	}
+
+	/** @brief Insert an object in the map */
+	void insert(T &obj) noexcept
+	{
+		rb_insert(&tree_, &(obj.*Node));
+	}
+
+	/** @brief Remove an object of the map */
+	void remove(T &obj) noexcept
+	{
+		rb_remove(&tree_, &(obj.*Node));
+	}
+
+	/** @return true if this very object is in the map */
+	bool contains(T &obj) noexcept
+	{
+		return rb_contains(&tree_, &(obj.*Node));
+	}
+
+	/**
+	 * @brief Look up an object
+	 *
+	 * @param key Object comparing equal to the object looked up
+	 * @return An object of the map comparing equal to @p key, or NULL
+	 */
+	T *find(const T &key) const
+	{
+		struct rbnode *node = tree_.root;
+		Less less;
+
+		while (node != nullptr) {
+			T *obj = detail::container_of(node, Node);
+
+			if (less(key, *obj)) {
+				node = z_rb_child(node, 0U);
+			} else if (less(*obj, key)) {
+				node = z_rb_child(node, 1U);
+			} else {
+				return obj;
+			}
+		}
+
+		return nullptr;
+	}
+
+	/** @return The lowest sorted object, or NULL if the map is empty */
+	T *min() noexcept
+	{
+		return from_node(rb_get_min(&tree_));
+	}
+
+	/** @return The highest sorted object, or NULL if the map is empty */
+	T *max() noexcept
+	{
+		return from_node(rb_get_max(&tree_));
+	}
+
+	/**
+	 * @brief Visit all the objects in order
+	 *
+	 * The map must not be modified meanwhile.
+	 *
+	 * @param fn Function called with a reference to each object
+	 */
+	template <typename F> void for_each(F fn)
+	{
+		struct rbnode *node;
+
+		RB_FOR_EACH(&tree_, node) {
+			fn(*detail::container_of(node, Node));
+		}
+	}
+
+	/** @return The wrapped tree */
+	struct rbtree *native() noexcept
+	{
+		return &tree_;
+	}
+
+private:
+	static T *from_node(struct rbnode *node) noexcept
+	{
+		return (node != nullptr) ? detail::container_of(node, Node) : nullptr;
+	}
+
+	static bool lessthan(struct rbnode *a, struct rbnode *b)
+	{
+		return Less()(*detail::container_of(a, Node), *detail::container_of(b, Node));
+	}
+
+	struct rbtree tree_;
+};
+
+} /* namespace zephyr */
+
+/** @} */
+
+#endif /* ZEPHYR_INCLUDE_CPP_INTRUSIVE_HPP_ */
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Fixed capacity C++ vector
+ */
+
+#ifndef ZEPHYR_INCLUDE_CPP_STATIC_VECTOR_HPP_
+#define ZEPHYR_INCLUDE_CPP_STATIC_VECTOR_HPP_
+
+#if __cplusplus < 201103L
+#error "zephyr/cpp/static_vector.hpp requires C++11 or later"
+#endif
+
+#include <cstddef>
+#include <new>
+
+#include <zephyr/sys/__assert.h>
+
+/**
+ * @addtogroup cpp_containers
+ * @{
+ */
+
+namespace zephyr {
+
+/**
+ * @brief Vector with a fixed capacity
+ *
+ * Stores up to @p N elements in place, without ever allocating memory.
+ * Adding elements to a full vector fails instead: push_back() returns
+ * false and emplace_back() a null pointer. Iterators are plain pointers,
+ * invalidated by erase() only.
+ *
+ * @tparam T Type of the elements
+ * @tparam N Capacity of the vector
+ */
+template <typename T, std::size_t N> class static_vector {
+	static_assert(N > 0, "static_vector needs a capacity");
+
+public:
+	/** Type of the elements */
+	typedef T value_type;
+	/** Type of the sizes */
+	typedef std::size_t size_type;
+	/** Type of the iterators */
+	typedef T *iterator;
+	/** Type of the constant iterators */
+	typedef const T *const_iterator;
+
+	static_vector() noexcept : size_(0)
+	{
+	}
+
+	static_vector(const static_vector &other) : size_(0)
+	{
+		for (const T &item : other) {
+			(void)emplace_back(item);
+		}
+	}
+
+	static_vector &operator=(const static_vector &other)
+	{
+		if (this != &other) {
+			clear();
+			for (const T &item : other) {
+				(void)emplace_back(item);
+			}
+		}
+
+		return *this;
+	}
+
+	~static_vector()
+	{
+		clear();
+	}
+
+	/**
+	 * @brief Construct an element at the end of the vector
+	 *
+	 * @param args Arguments of the element constructor
+	 * @return Pointer to the new element, or NULL if the vector is full
+	 */
+	template <typename... Args> T *emplace_back(Args &&...args)
+	{
+		T *item;
+
+		if (full()) {
+			return nullptr;
+		}
+
+		item = new (&data()[size_]) T(static_cast<Args &&>(args)...);
+		size_++;
+
+		return item;
+	}
+
+	/**
+	 * @brief Copy an element at the end of the vector
+	 *
+	 * @param item Element to copy
+	 * @return true if the element was added, false if the vector is full
+	 */
+	bool push_back(const T &item)
+	{
+		return emplace_back(item) != nullptr;
+	}
+
+	/**
+	 * @brief Move an element at the end of the vector
+	 *
+	 * @param item Element to move
+	 * @return true if the element was added, false if the vector is full
+	 */
+	bool push_back(T &&item)
+	{
+		return emplace_back(static_cast<T &&>(item)) != nullptr;
+	}
+
+	/** @brief Destroy the last element, the vector must not be empty */
+	void pop_back()
+	{
+		__ASSERT_NO_MSG(!empty());
+
+		size_--;
+		data()[size_].~T();
+	}
+
+	/**
+	 * @brief Destroy an element, moving the following ones down
+	 *
+	 * @param pos Iterator of the element
+	 * @return Iterator following the erased element
+	 */
+	iterator erase(iterator pos)
+	{
+		__ASSERT_NO_MSG((pos >= begin()) && (pos < end()));
+
+		for (iterator it = pos; it + 1 != end(); ++it) {
+			*it = static_cast<T &&>(*(it + 1));
+		}
+		pop_back();
+
+		return pos;
+	}
+
+	/** @brief Destroy all the elements */
+	void clear() noexcept
+	{
+		while (size_ > 0) {
+			size_--;
+			data()[size_].~T();
+		}
+	}
+
+	/** @return Number of elements */
+	size_type size() const noexcept
+	{
+		return size_;
+	}
+
+	/** @return Maximum number of elements */
+	static constexpr size_type capacity() noexcept
+	{
+		return N;
+	}
+
+	/** @return true if the vector has no element */
+	bool empty() const noexcept
+	{
+		return size_ == 0;
+	}
+
+	/** @return true if no element can be added */
+	bool full() const noexcept
+	{
+		return size_ == N;
+	}
+
+	/** @return Pointer to the elements */
+	T *data() noexcept
+	{
+		return reinterpret_cast<T *>(storage_);
+	}
+
+	/** @return Pointer to the elements */
+	const T *data() const noexcept
+	{
+		return reinterpret_cast<const T *>(storage_);
+	}
+
+	T &operator[](size_type idx)
+	{
+		__ASSERT_NO_MSG(idx < size_);
+
+		return data()[idx];
+	}
+
+	const T &operator[](size_type idx) const
+	{
+		__ASSERT_NO_MSG(idx < size_);
+
+		return data()[idx];
+	}
+
+	T &front()
+	{
+		return (*this)[0];
+	}
+
+	const T &front() const
+	{
+		return (*this)[0];
+	}
+
+	T &back()
+	{
+		return (*this)[size_ - 1];
+	}
+
+	const T &back() const
+	{
+		return (*this)[size_ - 1];
+	}
+
+	iterator begin() noexcept
+	{
+		return data();
+	}
+
+	const_iterator begin() const noexcept
+	{
+		return data();
+	}
+
+	iterator end() noexcept
+	{
+		return data() + size_;
+	}
+
+	const_iterator end() const noexcept
+	{
+		return data() + size_;
+	}
+
+private:
+	alignas(T) unsigned char storage_[N * sizeof(T)];
+	size_type size_;
+};
+
+} /* namespace zephyr */
+
+/** @} */
+
+#endif /* ZEPHYR_INCLUDE_CPP_STATIC_VECTOR_HPP_ */
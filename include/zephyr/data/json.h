@@ -782,6 +782,102 @@ int json_obj_encode(const struct json_obj_descr *descr, size_t descr_len,
 int json_arr_encode(const struct json_obj_descr *descr, const void *val,
 		    json_append_bytes_t append_bytes, void *data);
 
+/**
+ * @brief Function pointer type to write out the data buffered by a
+ * JSON stream.
+ *
+ * @param bytes Buffered data, e.g. to add to a net_buf chain or to send
+ * on a socket or as an HTTP chunk
+ * @param len Number of bytes in @p bytes
+ * @param data User data given to json_stream_init()
+ *
+ * @return 0 on success, a negative value on error, which is propagated
+ * to the caller of the encoding function.
+ */
+typedef int (*json_stream_flush_t)(const char *bytes, size_t len, void *data);
+
+/**
+ * @brief Streaming encoder state
+ *
+ * The encoded JSON goes through a caller provided buffer, which is
+ * written out whenever it is full, so that objects and arrays of any
+ * size are encoded with a bounded amount of RAM and without measuring
+ * them first with json_calc_encoded_len().
+ */
+struct json_stream {
+	char *buf;
+	size_t size;
+	size_t used;
+	json_stream_flush_t flush;
+	void *data;
+};
+
+/**
+ * @brief Initialize a streaming encoder
+ *
+ * @param stream Stream to initialize
+ * @param buf Buffer collecting the encoded data
+ * @param size Size of @p buf, in bytes
+ * @param flush Function writing out the buffered data
+ * @param data Data pointer to be passed to the flush function
+ */
+void json_stream_init(struct json_stream *stream, char *buf, size_t size,
+		      json_stream_flush_t flush, void *data);
+
+/**
+ * @brief Append raw bytes to a stream
+ *
+ * Emits JSON punctuation around the values encoded with
+ * json_obj_encode_stream(), e.g. to encode a large array one element at
+ * a time.
+ *
+ * @param stream Stream
+ * @param bytes Data to append
+ * @param len Number of bytes in @p bytes
+ *
+ * @return 0 on success, a negative value on error.
+ */
+int json_stream_write(struct json_stream *stream, const char *bytes, size_t len);
+
+/**
+ * @brief Write out the data buffered by a stream
+ *
+ * The encoding functions only flush full buffers: this must be called
+ * once the whole document has been encoded.
+ *
+ * @param stream Stream
+ *
+ * @return 0 on success, a negative value on error.
+ */
+int json_stream_flush(struct json_stream *stream);
+
+/**
+ * @brief Encodes an object into a stream
+ *
+ * @param descr Pointer to the descriptor array
+ * @param descr_len Number of elements in the descriptor array
+ * @param val Struct holding the values
+ * @param stream Stream initialized with json_stream_init()
+ *
+ * @return 0 if object has been successfully encoded. A negative value
+ * indicates an error.
+ */
+int json_obj_encode_stream(const struct json_obj_descr *descr, size_t descr_len,
+			   const void *val, struct json_stream *stream);
+
+/**
+ * @brief Encodes an array into a stream
+ *
+ * @param descr Pointer to the descriptor array
+ * @param val Struct holding the values
+ * @param stream Stream initialized with json_stream_init()
+ *
+ * @return 0 if object has been successfully encoded. A negative value
+ * indicates an error.
+ */
+int json_arr_encode_stream(const struct json_obj_descr *descr, const void *val,
+			   struct json_stream *stream);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DEBUG_BOOT_PROFILE_H_
+#define ZEPHYR_INCLUDE_DEBUG_BOOT_PROFILE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/init.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup boot_profile Boot profiler
+ *  @ingroup os_services
+ *  @brief Timestamps of the boot steps from reset to main()
+ *
+ *  The records are kept in a noinit table, so that they also survive a warm
+ *  reset until the next boot reaches the kernel initialization.
+ *  @{
+ */
+
+/** Boot profile record kinds */
+enum boot_profile_kind {
+	/** z_bss_zero() */
+	BOOT_PROFILE_BSS_ZERO,
+	/** z_data_copy() */
+	BOOT_PROFILE_DATA_COPY,
+	/** Whole init level, up to the init of the next one */
+	BOOT_PROFILE_LEVEL,
+	/** Device init function */
+	BOOT_PROFILE_DEVICE,
+	/** SYS_INIT() function */
+	BOOT_PROFILE_SYS_INIT,
+	/** Call of main(), start and end are the same */
+	BOOT_PROFILE_MAIN,
+};
+
+/** Boot profile record */
+struct boot_profile_record {
+	/** Init entry of BOOT_PROFILE_DEVICE and BOOT_PROFILE_SYS_INIT records */
+	const struct init_entry *entry;
+	/** Timestamp at the start of the step, in cycles */
+	uint32_t start;
+	/** Timestamp at the end of the step, in cycles */
+	uint32_t end;
+	/** Result of init functions */
+	int16_t result;
+	/** Record kind, @ref boot_profile_kind */
+	uint8_t kind;
+	/** Init level, @ref init_level */
+	uint8_t level;
+};
+
+/**
+ * @brief Get the boot profile records
+ *
+ * The records are ordered by the start of the steps, except those of
+ * z_bss_zero() and z_data_copy() which come first.
+ *
+ * @param records Set to the records table.
+ *
+ * @return Number of records.
+ */
+size_t boot_profile_get(const struct boot_profile_record **records);
+
+/**
+ * @brief Get the name of the step of a record
+ *
+ * @param rec Boot profile record.
+ * @param buf Buffer for the names which are not constant strings.
+ * @param len Size of @p buf.
+ *
+ * @return Device name, function symbol (address without CONFIG_SYMTAB) or
+ *         name of the step.
+ */
+const char *boot_profile_name(const struct boot_profile_record *rec, char *buf, size_t len);
+
+/**
+ * @brief Get a boot profile timestamp
+ *
+ * Defaults to k_cycle_get_32(), which may not count yet before the
+ * system timer driver is initialized. Platforms with a free running counter
+ * from reset can override it.
+ *
+ * @return Timestamp in cycles of sys_clock_hw_cycles_per_sec().
+ */
+uint32_t boot_profile_timestamp(void);
+
+/** @cond INTERNAL_HIDDEN */
+
+#ifdef CONFIG_BOOT_PROFILE
+void z_boot_profile_early(enum boot_profile_kind kind, uint32_t start);
+struct boot_profile_record *z_boot_profile_start(enum boot_profile_kind kind, uint8_t level,
+						  const struct init_entry *entry);
+void z_boot_profile_end(struct boot_profile_record *rec, int result);
+void z_boot_profile_reset(void);
+#else
+static inline void z_boot_profile_early(enum boot_profile_kind kind, uint32_t start)
+{
+	ARG_UNUSED(kind);
+	ARG_UNUSED(start);
+}
+
+static inline struct boot_profile_record *z_boot_profile_start(enum boot_profile_kind kind,
+								uint8_t level,
+								const struct init_entry *entry)
+{
+	ARG_UNUSED(kind);
+	ARG_UNUSED(level);
+	ARG_UNUSED(entry);
+
+	return NULL;
+}
+
+static inline void z_boot_profile_end(struct boot_profile_record *rec, int result)
+{
+	ARG_UNUSED(rec);
+	ARG_UNUSED(result);
+}
+
+static inline void z_boot_profile_reset(void)
+{
+}
+#endif /* CONFIG_BOOT_PROFILE */
+
+/** @endcond */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DEBUG_BOOT_PROFILE_H_ */
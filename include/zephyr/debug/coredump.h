@@ -149,6 +149,9 @@ struct coredump_cmd_copy_arg {
 #define	COREDUMP_MEM_HDR_ID		'M'
 #define COREDUMP_MEM_HDR_VER		1
 
+/* Memory block made of LZ4 compressed chunks */
+#define COREDUMP_MEM_HDR_VER_LZ4	2
+
 /* Target code */
 enum coredump_tgt_code {
 	COREDUMP_TGT_UNKNOWN = 0,
@@ -207,6 +210,18 @@ struct coredump_mem_hdr_t {
 	uintptr_t	end;
 } __packed;
 
+/* Header of each chunk of a COREDUMP_MEM_HDR_VER_LZ4 memory block */
+struct coredump_mem_chunk_hdr_t {
+	/* Number of bytes of memory in this chunk */
+	uint16_t	raw_len;
+
+	/*
+	 * Number of bytes of compressed data following this header,
+	 * equal to raw_len if the memory is stored uncompressed
+	 */
+	uint16_t	comp_len;
+} __packed;
+
 typedef void (*coredump_backend_start_t)(void);
 typedef void (*coredump_backend_end_t)(void);
 typedef void (*coredump_backend_buffer_output_t)(uint8_t *buf, size_t buflen);
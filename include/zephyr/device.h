@@ -382,6 +382,13 @@ struct device_state {
 	 * invoked.
 	 */
 	bool initialized : 1;
+
+#if defined(CONFIG_DEVICE_INIT_PARALLEL) || defined(__DOXYGEN__)
+	/** Indicates the device initialization function has been scheduled
+	 * by the parallel initialization.
+	 */
+	bool init_started : 1;
+#endif
 };
 
 struct pm_device_base;
@@ -774,6 +781,23 @@ __syscall bool device_is_ready(const struct device *dev);
  */
 __syscall int device_init(const struct device *dev);
 
+/**
+ * @brief Complete the initialization of a device.
+ *
+ * A device init function which returned -EINPROGRESS, leaving the rest of its
+ * initialization to other contexts, reports the outcome of the initialization
+ * with this call. The device is not ready until then. With
+ * CONFIG_DEVICE_INIT_PARALLEL, the devices requiring it and the SYS_INIT()
+ * entries of its level which come after it are delayed until this call,
+ * otherwise they run without waiting for it.
+ *
+ * Must be called from thread context, only once per -EINPROGRESS returned.
+ *
+ * @param dev device whose initialization completed.
+ * @param result 0 on successful initialization, negative errno otherwise.
+ */
+void device_init_complete(const struct device *dev, int result);
+
 /**
  * @}
  */
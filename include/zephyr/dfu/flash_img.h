@@ -31,6 +31,9 @@ extern "C" {
 
 struct flash_img_context {
 	uint8_t buf[CONFIG_IMG_BLOCK_BUF_SIZE];
+#ifdef CONFIG_IMG_WRITE_ASYNC
+	uint8_t async_buf[CONFIG_IMG_BLOCK_BUF_SIZE];
+#endif
 	const struct flash_area *flash_area;
 	struct stream_flash_ctx stream;
 };
@@ -111,6 +114,105 @@ int flash_img_check(struct flash_img_context *ctx,
 		    const struct flash_img_check *fic,
 		    uint8_t area_id);
 
+#if defined(CONFIG_IMG_DELTA_UPDATE) || defined(__DOXYGEN__)
+
+/** Magic number starting a delta patch, "ZDP1" in little endian byte order */
+#define FLASH_IMG_DELTA_MAGIC 0x3150445aU
+
+/**
+ * Size of the delta patch header: magic, source image size, target image
+ * size and a reserved word, as little endian 32-bit words, then the SHA-256
+ * of the source and of the target image.
+ */
+#define FLASH_IMG_DELTA_HDR_SIZE 80
+
+/**
+ * @name Delta patch operations
+ *
+ * Each operation of a delta patch is a byte opcode followed by its unsigned
+ * LEB128 argument <n>. The source position starts at 0.
+ * @{
+ */
+/** Output <n> bytes of the source image, advancing the source position */
+#define FLASH_IMG_DELTA_OP_COPY 0x00
+/** Output the sum of the <n> following bytes and of the source image bytes */
+#define FLASH_IMG_DELTA_OP_ADD 0x01
+/** Output the <n> following bytes */
+#define FLASH_IMG_DELTA_OP_INSERT 0x02
+/** Move the source position by <n>, zigzag encoded as a signed value */
+#define FLASH_IMG_DELTA_OP_SEEK 0x03
+/** @} */
+
+/**
+ * @brief Context of a delta patch being applied
+ *
+ * The members are internal, the size of the context does not depend on the
+ * size of the images.
+ */
+struct flash_img_delta_context {
+	/** @cond INTERNAL_HIDDEN */
+	struct flash_img_context *img;
+	const struct flash_area *source;
+	uint8_t buf[CONFIG_IMG_DELTA_BUF_SIZE];
+	uint8_t target_sha[32];
+	size_t source_size;
+	size_t target_size;
+	size_t source_pos;
+	size_t written;
+	size_t hdr_len;
+	uint32_t arg;
+	uint8_t arg_shift;
+	uint8_t op;
+	uint8_t state;
+	/** @endcond */
+};
+
+/**
+ * @brief Check whether data starts a delta patch.
+ *
+ * @param data first bytes of the image data
+ * @param len number of bytes available
+ *
+ * @return true if the data starts with FLASH_IMG_DELTA_MAGIC
+ */
+bool flash_img_delta_is_patch(const uint8_t *data, size_t len);
+
+/**
+ * @brief Initialize context needed for applying a delta patch.
+ *
+ * The image reconstructed from the patch and the source image is written
+ * through @p img, which must have been initialized. Only one patch can be
+ * applied at a time.
+ *
+ * @param ctx context to be initialized
+ * @param img image writer context of the target slot
+ * @param source_area_id flash area id of the partition holding the source image
+ *
+ * @return  0 on success, negative errno code on fail
+ */
+int flash_img_delta_init(struct flash_img_delta_context *ctx, struct flash_img_context *img,
+			 uint8_t source_area_id);
+
+/**
+ * @brief Process delta patch input buffers.
+ *
+ * The patch may be split at any byte boundary. The header is checked once
+ * received, including the hash of the source image, and the hash of the
+ * reconstructed image is computed as it is written.
+ *
+ * @param ctx context
+ * @param data patch data
+ * @param len number of bytes of patch data
+ * @param flush true with the end of the patch, flushing the image writer
+ *
+ * @return  0 on success, -EILSEQ if the source or reconstructed image do not
+ * match the hashes of the patch, other negative errno code on fail
+ */
+int flash_img_delta_write(struct flash_img_delta_context *ctx, const uint8_t *data, size_t len,
+			  bool flush);
+
+#endif /* CONFIG_IMG_DELTA_UPDATE */
+
 #ifdef __cplusplus
 }
 #endif
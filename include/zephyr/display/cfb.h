@@ -173,6 +173,9 @@ int cfb_invert_area(const struct device *dev, uint16_t x, uint16_t y,
  * @brief Finalize framebuffer and write it to display RAM,
  * invert or reorder pixels if necessary.
  *
+ * With @kconfig{CONFIG_CHARACTER_FRAMEBUFFER_PARTIAL_UPDATE}, only the area
+ * changed since the last successful call is written.
+ *
  * @param dev Pointer to device structure for driver instance
  *
  * @return 0 on success, negative value otherwise
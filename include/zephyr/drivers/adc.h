@@ -16,6 +16,9 @@
 #include <zephyr/device.h>
 #include <zephyr/dt-bindings/adc/adc.h>
 #include <zephyr/kernel.h>
+#ifdef CONFIG_ADC_STREAM
+#include <zephyr/rtio/rtio.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -694,6 +697,20 @@ typedef int (*adc_api_read_async)(const struct device *dev,
 				  const struct adc_sequence *sequence,
 				  struct k_poll_signal *async);
 
+#if defined(CONFIG_ADC_STREAM) || defined(__DOXYGEN__)
+/**
+ * @brief Type definition of ADC API function for submitting a stream
+ *        request.
+ *
+ * Called with the RTIO submission of an iodev defined by
+ * ADC_DT_STREAM_IODEV(), possibly from an interrupt handler. The driver
+ * fills a buffer of the submission with adc_stream_config::batch sample
+ * sets, then completes it.
+ */
+typedef void (*adc_api_submit)(const struct device *dev,
+			       struct rtio_iodev_sqe *iodev_sqe);
+#endif /* CONFIG_ADC_STREAM */
+
 /**
  * @brief ADC driver API
  *
@@ -704,6 +721,9 @@ __subsystem struct adc_driver_api {
 	adc_api_read          read;
 #ifdef CONFIG_ADC_ASYNC
 	adc_api_read_async    read_async;
+#endif
+#ifdef CONFIG_ADC_STREAM
+	adc_api_submit        submit;
 #endif
 	uint16_t ref_internal;	/* mV */
 };
@@ -835,6 +855,134 @@ static inline int z_impl_adc_read_async(const struct device *dev,
 }
 #endif /* CONFIG_ADC_ASYNC */
 
+#if defined(CONFIG_ADC_STREAM) || defined(__DOXYGEN__)
+/**
+ * @brief Configuration of an ADC stream.
+ *
+ * Each completion of the stream delivers one buffer holding
+ * @ref adc_stream_config.batch sample sets, laid out as adc_read() would
+ * with adc_sequence_options.extra_samplings set to batch - 1: one sample
+ * of each selected channel, in ascending channel order, per set.
+ */
+struct adc_stream_config {
+	/** ADC device sampling the stream. */
+	const struct device *adc;
+	/** Bit mask of the channels to sample, already set up. */
+	uint32_t channels;
+	/** ADC resolution, as in adc_sequence.resolution. */
+	uint8_t resolution;
+	/** Oversampling setting, as in adc_sequence.oversampling. */
+	uint8_t oversampling;
+	/** Interval between two sample sets, in microseconds. */
+	uint32_t interval_us;
+	/** Number of sample sets delivered per completion, at least 1. */
+	uint16_t batch;
+};
+
+/** @cond INTERNAL_HIDDEN */
+extern const struct rtio_iodev_api __adc_iodev_api;
+
+void adc_stream_submit_fallback(const struct device *dev,
+				struct rtio_iodev_sqe *iodev_sqe);
+/** @endcond */
+
+/**
+ * @brief Define a streaming iodev of an ADC.
+ *
+ * Example, sampling 2 channels at 10 kHz and getting 100 sample sets per
+ * completion:
+ *
+ * @code{.c}
+ * ADC_DT_STREAM_IODEV(adc_stream_iodev, DT_NODELABEL(adc), BIT(0) | BIT(1),
+ *                     12, 100, 100);
+ * RTIO_DEFINE_WITH_MEMPOOL(adc_rtio, 4, 4, 8, 512, 4);
+ *
+ * int main(void) {
+ *   struct rtio_sqe *handle;
+ *
+ *   adc_stream(&adc_stream_iodev, &adc_rtio, NULL, &handle);
+ *   ...
+ *   rtio_sqe_cancel(handle);
+ * }
+ * @endcode
+ *
+ * @param name Name of the iodev.
+ * @param dt_node Devicetree node of the ADC.
+ * @param _channels Bit mask of the channels to sample.
+ * @param _resolution ADC resolution, in bits.
+ * @param _interval_us Interval between two sample sets, in microseconds.
+ * @param _batch Number of sample sets per completion.
+ */
+#define ADC_DT_STREAM_IODEV(name, dt_node, _channels, _resolution,		\
+			    _interval_us, _batch)				\
+	static struct adc_stream_config _CONCAT(__adc_stream_config_, name) = {	\
+		.adc = DEVICE_DT_GET(dt_node),					\
+		.channels = (_channels),					\
+		.resolution = (_resolution),					\
+		.interval_us = (_interval_us),					\
+		.batch = (_batch),						\
+	};									\
+	RTIO_IODEV_DEFINE(name, &__adc_iodev_api,				\
+			  &_CONCAT(__adc_stream_config_, name))
+
+/**
+ * @brief Get the size of the buffers of an ADC stream.
+ *
+ * Assumes 16 bit samples, as used by most drivers.
+ *
+ * @param cfg Configuration of the stream.
+ *
+ * @return Size in bytes of a buffer holding one completion.
+ */
+static inline uint32_t adc_stream_buffer_size(const struct adc_stream_config *cfg)
+{
+	return POPCOUNT(cfg->channels) * cfg->batch * sizeof(uint16_t);
+}
+
+/**
+ * @brief Start streaming samples from an ADC.
+ *
+ * Submits a multishot read of @p iodev, so @p ctx gets a completion with
+ * a buffer from its memory pool every adc_stream_config.batch sample
+ * sets, until the request is canceled. Sampling is continuous as long as
+ * the completions are consumed in time, for drivers streaming natively.
+ * Other drivers sample each batch with adc_read() on the system work
+ * queue, and may miss samples between two batches.
+ *
+ * @param iodev The iodev created by ADC_DT_STREAM_IODEV().
+ * @param ctx The RTIO context to service the stream, with a memory pool.
+ * @param userdata Userdata of the completions.
+ * @param handle Where to store the handle used to cancel the stream, may
+ *               be NULL.
+ *
+ * @retval 0 If successful.
+ * @retval -ENOMEM If no submission is available in @p ctx.
+ */
+static inline int adc_stream(struct rtio_iodev *iodev, struct rtio *ctx,
+			     void *userdata, struct rtio_sqe **handle)
+{
+	if (IS_ENABLED(CONFIG_USERSPACE)) {
+		struct rtio_sqe sqe;
+
+		rtio_sqe_prep_read_multishot(&sqe, iodev, RTIO_PRIO_NORM, userdata);
+		rtio_sqe_copy_in_get_handles(ctx, &sqe, handle, 1);
+	} else {
+		struct rtio_sqe *sqe = rtio_sqe_acquire(ctx);
+
+		if (sqe == NULL) {
+			return -ENOMEM;
+		}
+		if (handle != NULL) {
+			*handle = sqe;
+		}
+		rtio_sqe_prep_read_multishot(sqe, iodev, RTIO_PRIO_NORM, userdata);
+	}
+	rtio_submit(ctx, 0);
+
+	return 0;
+}
+#endif /* CONFIG_ADC_STREAM */
+
 /**
  * @brief Get the internal reference voltage.
  *
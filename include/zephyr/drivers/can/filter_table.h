@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Software CAN RX filter table
+ *
+ * Helpers for drivers filtering received CAN frames in software. Filters
+ * matching a single CAN ID are hashed by that ID, so a received frame is
+ * only compared against the filters of its bucket and against the masked
+ * filters, instead of against every installed filter.
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_CAN_FILTER_TABLE_H_
+#define ZEPHYR_INCLUDE_DRIVERS_CAN_FILTER_TABLE_H_
+
+#include <zephyr/drivers/can.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/slist.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup can_interface
+ * @{
+ */
+
+/**
+ * @brief Number of hash buckets suiting a number of filters
+ *
+ * @param max_filters Maximum number of filters in the table.
+ */
+#define CAN_FILTER_TABLE_BUCKETS(max_filters) NHPOT(max_filters)
+
+/**
+ * @brief CAN filter table entry
+ *
+ * Embedded in the driver filter structures. The table only links the
+ * entries, which are owned by the driver.
+ */
+struct can_filter_table_entry {
+	/** @cond INTERNAL_HIDDEN */
+	sys_snode_t node;
+	/** @endcond */
+	/** Filter of the entry, must not be changed while in a table */
+	struct can_filter filter;
+};
+
+/**
+ * @brief CAN filter table
+ */
+struct can_filter_table {
+	/** @cond INTERNAL_HIDDEN */
+	sys_slist_t *buckets;
+	uint32_t num_buckets;
+	sys_slist_t masked;
+	/** @endcond */
+};
+
+/**
+ * @brief Callback called for each table entry matching a frame
+ *
+ * The callback may remove @p entry from the table, but no other entry.
+ *
+ * @param entry Entry matching the frame.
+ * @param frame Received frame.
+ * @param user_data User data given to can_filter_table_match().
+ */
+typedef void (*can_filter_table_cb_t)(struct can_filter_table_entry *entry,
+				      const struct can_frame *frame, void *user_data);
+
+/**
+ * @brief Check if a filter matches a single CAN ID
+ *
+ * @param filter Filter to check.
+ *
+ * @retval true if the filter mask covers all the bits of its ID type.
+ * @retval false otherwise.
+ */
+static inline bool can_filter_is_exact(const struct can_filter *filter)
+{
+	uint32_t id_mask = (filter->flags & CAN_FILTER_IDE) != 0U ? CAN_EXT_ID_MASK
+								   : CAN_STD_ID_MASK;
+
+	return (filter->mask & id_mask) == id_mask;
+}
+
+/**
+ * @brief Hash a CAN ID into a bucket
+ *
+ * Folds the ID so that the low bits depend on all of them, as consecutive
+ * extended IDs, such as J1939 PGNs, often only differ in their upper bits.
+ *
+ * @param id CAN ID.
+ * @param num_buckets Number of buckets, a power of two.
+ *
+ * @return Bucket index, lower than @p num_buckets.
+ */
+static inline uint32_t can_filter_table_hash(uint32_t id, uint32_t num_buckets)
+{
+	return (id ^ (id >> 8) ^ (id >> 16) ^ (id >> 24)) & (num_buckets - 1U);
+}
+
+/**
+ * @brief Merge two filters into one matching at least the frames of both
+ *
+ * The merged filter matches the ID bits the two filters agree on. It can
+ * be installed in a single hardware filter bank when the banks run out,
+ * the frames it lets through then being refined by a software filter
+ * table.
+ *
+ * @param a First filter.
+ * @param b Second filter.
+ * @param[out] merged Merged filter.
+ *
+ * @retval true if the filters were merged.
+ * @retval false if the filters match different ID types.
+ */
+static inline bool can_filter_merge(const struct can_filter *a, const struct can_filter *b,
+				    struct can_filter *merged)
+{
+	if (((a->flags ^ b->flags) & CAN_FILTER_IDE) != 0U) {
+		return false;
+	}
+
+	merged->flags = a->flags;
+	merged->mask = a->mask & b->mask & ~(a->id ^ b->id);
+	merged->id = a->id & merged->mask;
+
+	return true;
+}
+
+/**
+ * @brief Initialize a CAN filter table
+ *
+ * @param table Table to initialize.
+ * @param buckets Array of @p num_buckets lists, must outlive the table.
+ * @param num_buckets Number of buckets, a power of two, see
+ *                    CAN_FILTER_TABLE_BUCKETS().
+ */
+static inline void can_filter_table_init(struct can_filter_table *table, sys_slist_t *buckets,
+					 uint32_t num_buckets)
+{
+	__ASSERT(IS_POWER_OF_TWO(num_buckets), "number of buckets is not a power of two");
+
+	table->buckets = buckets;
+	table->num_buckets = num_buckets;
+	sys_slist_init(&table->masked);
+
+	for (uint32_t i = 0U; i < num_buckets; i++) {
+		sys_slist_init(&buckets[i]);
+	}
+}
+
+/** @cond INTERNAL_HIDDEN */
+static inline sys_slist_t *can_filter_table_list(struct can_filter_table *table,
+						 const struct can_filter *filter)
+{
+	uint32_t id_mask = (filter->flags & CAN_FILTER_IDE) != 0U ? CAN_EXT_ID_MASK
+								   : CAN_STD_ID_MASK;
+
+	if (!can_filter_is_exact(filter)) {
+		return &table->masked;
+	}
+
+	return &table->buckets[can_filter_table_hash(filter->id & id_mask, table->num_buckets)];
+}
+/** @endcond */
+
+/**
+ * @brief Add an entry to a CAN filter table
+ *
+ * Entries matching the same frame are called back in the order they were
+ * added within their list, exact ID entries first.
+ *
+ * @param table Table.
+ * @param entry Entry, with its filter set, not in any table.
+ */
+static inline void can_filter_table_add(struct can_filter_table *table,
+					struct can_filter_table_entry *entry)
+{
+	sys_slist_append(can_filter_table_list(table, &entry->filter), &entry->node);
+}
+
+/**
+ * @brief Remove an entry from a CAN filter table
+ *
+ * Removing an entry which is not in the table is a no-op.
+ *
+ * @param table Table.
+ * @param entry Entry.
+ */
+static inline void can_filter_table_remove(struct can_filter_table *table,
+					   struct can_filter_table_entry *entry)
+{
+	(void)sys_slist_find_and_remove(can_filter_table_list(table, &entry->filter),
+					&entry->node);
+}
+
+/**
+ * @brief Call back every entry of a CAN filter table matching a frame
+ *
+ * Only the bucket of the frame ID and the masked filters are looked at.
+ *
+ * @param table Table.
+ * @param frame Received frame.
+ * @param cb Callback called with each matching entry.
+ * @param user_data User data passed to @p cb.
+ */
+static inline void can_filter_table_match(struct can_filter_table *table,
+					  const struct can_frame *frame, can_filter_table_cb_t cb,
+					  void *user_data)
+{
+	struct can_filter_table_entry *entry;
+	struct can_filter_table_entry *next;
+	sys_slist_t *bucket = &table->buckets[can_filter_table_hash(frame->id,
+								    table->num_buckets)];
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(bucket, entry, next, node) {
+		if (can_frame_matches_filter(frame, &entry->filter)) {
+			cb(entry, frame, user_data);
+		}
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&table->masked, entry, next, node) {
+		if (can_frame_matches_filter(frame, &entry->filter)) {
+			cb(entry, frame, user_data);
+		}
+	}
+}
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_CAN_FILTER_TABLE_H_ */
@@ -153,6 +153,28 @@ typedef int (*display_write_api)(const struct device *dev, const uint16_t x,
 				 const struct display_buffer_descriptor *desc,
 				 const void *buf);
 
+/**
+ * @typedef display_write_cb_t
+ * @brief Completion callback of display_write_async()
+ *
+ * @param dev Pointer to device structure
+ * @param result 0 if the buffer was written, else negative errno code
+ * @param user_data User data given to display_write_async()
+ */
+typedef void (*display_write_cb_t)(const struct device *dev, int result,
+				   void *user_data);
+
+/**
+ * @typedef display_write_async_api
+ * @brief Callback API for writing data to the display asynchronously
+ * See display_write_async() for argument description
+ */
+typedef int (*display_write_async_api)(const struct device *dev,
+				       const uint16_t x, const uint16_t y,
+				       const struct display_buffer_descriptor *desc,
+				       const void *buf, display_write_cb_t cb,
+				       void *user_data);
+
 /**
  * @typedef display_read_api
  * @brief Callback API for reading data from the display
@@ -228,6 +250,7 @@ __subsystem struct display_driver_api {
 	display_get_capabilities_api get_capabilities;
 	display_set_pixel_format_api set_pixel_format;
 	display_set_orientation_api set_orientation;
+	display_write_async_api write_async;
 };
 
 /**
@@ -252,6 +275,53 @@ static inline int display_write(const struct device *dev, const uint16_t x,
 	return api->write(dev, x, y, desc, buf);
 }
 
+/**
+ * @brief Write data to display without waiting for the transfer
+ *
+ * Starts writing the buffer and returns, so the caller can prepare the
+ * next buffer while this one is transferred, typically by DMA. The
+ * buffer must not be modified or freed until @p cb is called. Writes
+ * are performed in order, a write started while another one is in
+ * flight waits for it first.
+ *
+ * Drivers not implementing asynchronous writes write the buffer
+ * synchronously and call @p cb before returning.
+ *
+ * @param dev Pointer to device structure
+ * @param x x Coordinate of the upper left corner where to write the buffer
+ * @param y y Coordinate of the upper left corner where to write the buffer
+ * @param desc Pointer to a structure describing the buffer layout, only
+ *             used until the function returns
+ * @param buf Pointer to buffer array
+ * @param cb Callback called once the buffer is written, possibly from an
+ *           interrupt handler
+ * @param user_data User data passed to @p cb
+ *
+ * @retval 0 on success, @p cb is called exactly once
+ * @retval -errno Negative errno code on failure, @p cb is not called
+ */
+static inline int display_write_async(const struct device *dev,
+				      const uint16_t x, const uint16_t y,
+				      const struct display_buffer_descriptor *desc,
+				      const void *buf, display_write_cb_t cb,
+				      void *user_data)
+{
+	struct display_driver_api *api =
+		(struct display_driver_api *)dev->api;
+	int ret;
+
+	if (api->write_async != NULL) {
+		return api->write_async(dev, x, y, desc, buf, cb, user_data);
+	}
+
+	ret = api->write(dev, x, y, desc, buf);
+	if (ret == 0) {
+		cb(dev, 0, user_data);
+	}
+
+	return ret;
+}
+
 /**
  * @brief Read data from display
  *
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Scatter-gather lists for drivers using DMA channels.
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_DMA_DMA_SG_H_
+#define ZEPHYR_INCLUDE_DRIVERS_DMA_DMA_SG_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/dma.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief DMA scatter-gather lists
+ * @defgroup dma_sg DMA scatter-gather lists
+ * @ingroup dma_interface
+ * @{
+ */
+
+/**
+ * @brief Rearm the channel with dma_reload() for single block transfers
+ *
+ * Only for controllers whose dma_reload() reprograms a stopped channel which
+ * is then started by dma_start(). Controllers not implementing dma_reload()
+ * fall back to dma_config().
+ */
+#define DMA_SG_RELOAD BIT(0)
+
+struct net_buf;
+struct rtio_iodev_sqe;
+
+/**
+ * @brief Scatter-gather list of a DMA channel
+ *
+ * The blocks are preallocated with the list by DMA_SG_DEFINE(), so building
+ * and starting a transfer needs no allocation and may be done from an ISR.
+ * As a DMA channel, a list has a single owner.
+ */
+struct dma_sg {
+	/** @cond INTERNAL_HIDDEN */
+	const struct device *dev;
+	uint32_t channel;
+	struct dma_config cfg;
+	struct dma_block_config tmpl;
+	struct dma_block_config *blocks;
+	uint16_t max_blocks;
+	uint16_t count;
+	uint16_t loaded;
+	uint8_t flags;
+	size_t total;
+	/** @endcond */
+};
+
+/**
+ * @brief Statically define a scatter-gather list
+ *
+ * @param _name Name of the list
+ * @param _max_blocks Maximum number of blocks in a transfer
+ */
+#define DMA_SG_DEFINE(_name, _max_blocks)                                                          \
+	static struct dma_block_config _CONCAT(_name, _blocks)[_max_blocks];                       \
+	static struct dma_sg _name = {                                                             \
+		.blocks = _CONCAT(_name, _blocks),                                                 \
+		.max_blocks = (_max_blocks),                                                       \
+	}
+
+/**
+ * @brief Initialize a scatter-gather list
+ *
+ * @param sg Scatter-gather list
+ * @param dev DMA controller
+ * @param channel DMA channel, owned by the caller
+ * @param cfg Channel configuration. @c head_block, if not NULL, is the
+ *            template of all blocks, e.g. for their address adjustments; the
+ *            addresses, size and link of the template are ignored.
+ * @param flags Options, @ref DMA_SG_RELOAD
+ */
+void dma_sg_init(struct dma_sg *sg, const struct device *dev, uint32_t channel,
+		 const struct dma_config *cfg, uint8_t flags);
+
+/**
+ * @brief Empty a scatter-gather list to build the next transfer
+ *
+ * @param sg Scatter-gather list
+ */
+static inline void dma_sg_reset(struct dma_sg *sg)
+{
+	sg->count = 0;
+	sg->total = 0;
+}
+
+/**
+ * @brief Get the number of bytes of the transfer in a list
+ *
+ * @param sg Scatter-gather list
+ *
+ * @return Sum of the block sizes
+ */
+static inline size_t dma_sg_size(const struct dma_sg *sg)
+{
+	return sg->total;
+}
+
+/**
+ * @brief Add a block to a scatter-gather list
+ *
+ * @param sg Scatter-gather list
+ * @param src Source address
+ * @param dst Destination address
+ * @param size Size of the block in bytes
+ *
+ * @retval 0 Block added
+ * @retval -ENOMEM The list is full
+ */
+int dma_sg_add(struct dma_sg *sg, uint64_t src, uint64_t dst, size_t size);
+
+/**
+ * @brief Add a memory buffer to a scatter-gather list
+ *
+ * The buffer is the source of the block for memory to peripheral and memory to
+ * memory channels, and the destination otherwise. The other end of the block
+ * is @p dev_addr, advanced past the block if the template increments it.
+ *
+ * @param sg Scatter-gather list
+ * @param mem Memory buffer
+ * @param size Size of the buffer in bytes
+ * @param dev_addr Address at the other end of the block, updated
+ *
+ * @retval 0 Block added
+ * @retval -ENOMEM The list is full
+ */
+int dma_sg_add_mem(struct dma_sg *sg, void *mem, size_t size, uint64_t *dev_addr);
+
+/**
+ * @brief Add the fragments of a network buffer to a scatter-gather list
+ *
+ * The data of each fragment is sent by memory to peripheral and memory to
+ * memory channels. Other channels receive into the tailroom of each fragment,
+ * the caller then adds the received length to the fragments. Requires
+ * @kconfig{CONFIG_NET_BUF}.
+ *
+ * @param sg Scatter-gather list
+ * @param frags First fragment
+ * @param dev_addr Address at the other end of the blocks, see dma_sg_add_mem()
+ *
+ * @retval 0 Fragments added
+ * @retval -ENOMEM The list is full, it is left as before the call
+ */
+int dma_sg_add_net_buf(struct dma_sg *sg, struct net_buf *frags, uint64_t dev_addr);
+
+/**
+ * @brief Add the buffers of an RTIO transaction to a scatter-gather list
+ *
+ * Write operations are sent by memory to peripheral and memory to memory
+ * channels, read operations are received by peripheral to memory channels.
+ * Requires @kconfig{CONFIG_RTIO}.
+ *
+ * @param sg Scatter-gather list
+ * @param iodev_sqe First submission of the transaction
+ * @param dev_addr Address at the other end of the blocks, see dma_sg_add_mem()
+ *
+ * @retval 0 Buffers added
+ * @retval -ENOMEM The list is full, it is left as before the call
+ * @retval -EINVAL A submission does not match the direction of the channel
+ */
+int dma_sg_add_rtio(struct dma_sg *sg, struct rtio_iodev_sqe *iodev_sqe, uint64_t dev_addr);
+
+/**
+ * @brief Start the transfer of a scatter-gather list
+ *
+ * The channel is configured with dma_config(), except for a single block
+ * transfer following another one which is rearmed with dma_reload() when
+ * @ref DMA_SG_RELOAD is set.
+ *
+ * @param sg Scatter-gather list
+ *
+ * @retval 0 Transfer started
+ * @retval -EINVAL The list is empty
+ * @retval <0 Error from the DMA controller
+ */
+int dma_sg_start(struct dma_sg *sg);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_DMA_DMA_SG_H_ */
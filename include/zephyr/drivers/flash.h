@@ -207,6 +207,14 @@ __subsystem struct flash_driver_api {
 #endif /* CONFIG_FLASH_EX_OP_ENABLED */
 };
 
+#if defined(CONFIG_FLASH_READ_CACHE)
+/* Read through the flash read cache, see drivers/flash/flash_read_cache.c */
+int z_flash_read_cache_read(const struct device *dev, off_t offset, void *data, size_t len);
+
+/* Drop the cache lines overlapping a range which was written or erased */
+void z_flash_read_cache_invalidate(const struct device *dev, off_t offset, size_t len);
+#endif /* CONFIG_FLASH_READ_CACHE */
+
 /**
  * @}
  */
@@ -236,10 +244,14 @@ static inline int z_impl_flash_read(const struct device *dev, off_t offset,
 				    void *data,
 				    size_t len)
 {
+#if defined(CONFIG_FLASH_READ_CACHE)
+	return z_flash_read_cache_read(dev, offset, data, len);
+#else
 	const struct flash_driver_api *api =
 		(const struct flash_driver_api *)dev->api;
 
 	return api->read(dev, offset, data, len);
+#endif /* CONFIG_FLASH_READ_CACHE */
 }
 
 /**
@@ -273,6 +285,10 @@ static inline int z_impl_flash_write(const struct device *dev, off_t offset,
 
 	rc = api->write(dev, offset, data, len);
 
+#if defined(CONFIG_FLASH_READ_CACHE)
+	z_flash_read_cache_invalidate(dev, offset, len);
+#endif /* CONFIG_FLASH_READ_CACHE */
+
 	return rc;
 }
 
@@ -318,6 +334,10 @@ static inline int z_impl_flash_erase(const struct device *dev, off_t offset,
 		rc = api->erase(dev, offset, size);
 	}
 
+#if defined(CONFIG_FLASH_READ_CACHE)
+	z_flash_read_cache_invalidate(dev, offset, size);
+#endif /* CONFIG_FLASH_READ_CACHE */
+
 	return rc;
 }
 
@@ -616,11 +636,20 @@ static inline int z_impl_flash_ex_op(const struct device *dev, uint16_t code,
 	const struct flash_driver_api *api =
 		(const struct flash_driver_api *)dev->api;
 
+	int rc;
+
 	if (api->ex_op == NULL) {
 		return -ENOTSUP;
 	}
 
-	return api->ex_op(dev, code, in, out);
+	rc = api->ex_op(dev, code, in, out);
+
+#if defined(CONFIG_FLASH_READ_CACHE)
+	/* Extended operations may change the contents of the whole device */
+	z_flash_read_cache_invalidate(dev, 0, SIZE_MAX);
+#endif /* CONFIG_FLASH_READ_CACHE */
+
+	return rc;
 #else
 	ARG_UNUSED(dev);
 	ARG_UNUSED(code);
@@ -15,6 +15,22 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Bus statistics of an i2c rtio context
+ */
+struct i2c_rtio_stats {
+	/** Transactions started */
+	uint32_t transactions;
+	/** Messages started */
+	uint32_t messages;
+	/** Transactions joined to the previous one with a repeated start */
+	uint32_t restarts;
+	/** Transactions that failed */
+	uint32_t errors;
+	/** Cycles spent with transactions in progress, see k_cycle_get_32() */
+	uint64_t busy_cycles;
+};
+
 /**
  * @brief Driver context for implementing i2c with rtio
  */
@@ -26,6 +42,16 @@ struct i2c_rtio {
 	struct rtio_iodev iodev;
 	struct rtio_iodev_sqe *txn_head;
 	struct rtio_iodev_sqe *txn_curr;
+#ifdef CONFIG_I2C_RTIO_BATCH_RESTART
+	struct rtio_iodev_sqe *txn_next;
+	bool batch_stop;
+	bool batch_restart;
+	bool next_restart;
+#endif
+#ifdef CONFIG_I2C_RTIO_STATS
+	struct i2c_rtio_stats stats;
+	uint32_t busy_start;
+#endif
 	struct i2c_dt_spec dt_spec;
 };
 
@@ -108,6 +134,26 @@ int i2c_rtio_transfer(struct i2c_rtio *ctx, struct i2c_msg *msgs, uint8_t num_ms
  */
 int i2c_rtio_recover(struct i2c_rtio *ctx);
 
+/**
+ * @brief Get the bus statistics of an i2c rtio context
+ *
+ * Requires @kconfig{CONFIG_I2C_RTIO_STATS}. The bus utilization over a period
+ * is the increase of @c busy_cycles divided by the cycles elapsed.
+ *
+ * @param ctx I2C RTIO driver context
+ * @param stats Statistics since the last reset
+ */
+void i2c_rtio_stats_get(struct i2c_rtio *ctx, struct i2c_rtio_stats *stats);
+
+/**
+ * @brief Reset the bus statistics of an i2c rtio context
+ *
+ * Requires @kconfig{CONFIG_I2C_RTIO_STATS}.
+ *
+ * @param ctx I2C RTIO driver context
+ */
+void i2c_rtio_stats_reset(struct i2c_rtio *ctx);
+
 #ifdef __cplusplus
 }
 #endif
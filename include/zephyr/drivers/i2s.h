@@ -456,7 +456,10 @@ __syscall int i2s_buf_read(const struct device *dev, void *buf, size_t *size);
  * Data to be sent by the I2S interface is stored first in the TX queue. TX
  * queue consists of memory blocks preallocated by the user from tx_mem_slab
  * (as defined by i2s_configure). This function takes ownership of the memory
- * block and will release it when all data are transmitted.
+ * block and will release it when all data are transmitted. The block must not
+ * be modified once written, as drivers may prepare it for DMA, e.g. clean the
+ * data cache, when it is queued. Queuing several blocks ahead lets drivers
+ * chain them without gaps.
  *
  * If there are no free slots in the TX queue the function will block waiting
  * for the next TX memory block to be send and removed from the queue. This
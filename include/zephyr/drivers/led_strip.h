@@ -81,6 +81,30 @@ typedef int (*led_api_update_channels)(const struct device *dev,
  */
 typedef size_t (*led_api_length)(const struct device *dev);
 
+/**
+ * @typedef led_strip_update_cb_t
+ * @brief Completion callback of led_strip_update_rgb_async()
+ *
+ * @param dev LED strip device.
+ * @param result 0 if the strip was updated, else negative errno code.
+ * @param user_data User data given to led_strip_update_rgb_async().
+ */
+typedef void (*led_strip_update_cb_t)(const struct device *dev, int result,
+				      void *user_data);
+
+/**
+ * @typedef led_api_update_rgb_range
+ * @brief Callback API for updating a range of pixels of an RGB LED strip.
+ *
+ * Synchronous when @p cb is NULL.
+ *
+ * @see led_strip_update_rgb_range() and led_strip_update_rgb_async() for
+ * argument descriptions.
+ */
+typedef int (*led_api_update_rgb_range)(const struct device *dev, size_t offset,
+					 struct led_rgb *pixels, size_t num_pixels,
+					 led_strip_update_cb_t cb, void *user_data);
+
 /**
  * @brief LED strip driver API
  *
@@ -90,6 +114,7 @@ __subsystem struct led_strip_driver_api {
 	led_api_update_rgb update_rgb;
 	led_api_update_channels update_channels;
 	led_api_length length;
+	led_api_update_rgb_range update_rgb_range;
 };
 
 /**
@@ -124,6 +149,99 @@ static inline int led_strip_update_rgb(const struct device *dev,
 	return api->update_rgb(dev, pixels, num_pixels);
 }
 
+/**
+ * @brief		Optional function to update a range of pixels of an RGB LED strip.
+ *
+ * Only the pixels from @a offset to @a offset + @a num_pixels are changed,
+ * the other ones keep the values of the previous update. Drivers keeping
+ * an encoded copy of the whole strip only encode the given pixels.
+ *
+ * Drivers not supporting ranges only accept an @a offset of 0, updating the
+ * strip with led_strip_update_rgb().
+ *
+ * @param dev		LED strip device.
+ * @param offset	Index of the first pixel to update.
+ * @param pixels	Array of pixel data.
+ * @param num_pixels	Length of pixels array.
+ *
+ * @retval		0 on success.
+ * @retval		-ERANGE if the range goes past the end of the strip.
+ * @retval		-ENOSYS if @a offset is not 0 and ranges are not supported.
+ * @retval		-errno negative errno code on other failure.
+ *
+ * @warning		This routine may overwrite @a pixels.
+ */
+static inline int led_strip_update_rgb_range(const struct device *dev, size_t offset,
+					     struct led_rgb *pixels, size_t num_pixels)
+{
+	const struct led_strip_driver_api *api =
+		(const struct led_strip_driver_api *)dev->api;
+
+	if (api->update_rgb_range == NULL) {
+		if (offset != 0) {
+			return -ENOSYS;
+		}
+
+		return led_strip_update_rgb(dev, pixels, num_pixels);
+	}
+
+	if (offset > api->length(dev) || api->length(dev) - offset < num_pixels) {
+		return -ERANGE;
+	}
+
+	return api->update_rgb_range(dev, offset, pixels, num_pixels, NULL, NULL);
+}
+
+/**
+ * @brief		Optional function to update a range of pixels without waiting.
+ *
+ * Like led_strip_update_rgb_range(), but returns once @a pixels are encoded,
+ * while the strip is updated in the background, typically by DMA. @a pixels
+ * can be reused as soon as the function returns. An update started while
+ * another one is in flight fails with -EBUSY.
+ *
+ * Drivers not implementing asynchronous updates update the strip
+ * synchronously and call @a cb before returning.
+ *
+ * @param dev		LED strip device.
+ * @param offset	Index of the first pixel to update.
+ * @param pixels	Array of pixel data.
+ * @param num_pixels	Length of pixels array.
+ * @param cb		Callback called once the strip is updated, possibly from
+ *			an interrupt handler.
+ * @param user_data	User data passed to @a cb.
+ *
+ * @retval		0 on success, @a cb is called exactly once.
+ * @retval		-EBUSY if an update is in flight.
+ * @retval		-errno negative errno code on other failure, @a cb is not
+ *			called.
+ *
+ * @warning		This routine may overwrite @a pixels.
+ */
+static inline int led_strip_update_rgb_async(const struct device *dev, size_t offset,
+					     struct led_rgb *pixels, size_t num_pixels,
+					     led_strip_update_cb_t cb, void *user_data)
+{
+	const struct led_strip_driver_api *api =
+		(const struct led_strip_driver_api *)dev->api;
+	int ret;
+
+	if (api->update_rgb_range == NULL) {
+		ret = led_strip_update_rgb_range(dev, offset, pixels, num_pixels);
+		if (ret == 0) {
+			cb(dev, 0, user_data);
+		}
+
+		return ret;
+	}
+
+	if (offset > api->length(dev) || api->length(dev) - offset < num_pixels) {
+		return -ERANGE;
+	}
+
+	return api->update_rgb_range(dev, offset, pixels, num_pixels, cb, user_data);
+}
+
 /**
  * @brief		Optional function to update an LED strip with the given channel array
  *			(each channel byte corresponding to an individually addressable color
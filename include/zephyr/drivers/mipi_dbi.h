@@ -126,6 +126,16 @@ struct mipi_dbi_config {
 
 
 /** MIPI-DBI host driver API */
+/**
+ * @brief Completion callback of mipi_dbi_write_display_async()
+ *
+ * @param dev mipi dbi controller
+ * @param result 0 if the buffer was written, else negative errno code
+ * @param user_data User data given to mipi_dbi_write_display_async()
+ */
+typedef void (*mipi_dbi_write_cb_t)(const struct device *dev, int result,
+				    void *user_data);
+
 __subsystem struct mipi_dbi_driver_api {
 	int (*command_write)(const struct device *dev,
 			     const struct mipi_dbi_config *config, uint8_t cmd,
@@ -141,6 +151,12 @@ __subsystem struct mipi_dbi_driver_api {
 	int (*reset)(const struct device *dev, uint32_t delay);
 	int (*release)(const struct device *dev,
 		       const struct mipi_dbi_config *config);
+	int (*write_display_async)(const struct device *dev,
+				   const struct mipi_dbi_config *config,
+				   const uint8_t *framebuf,
+				   struct display_buffer_descriptor *desc,
+				   enum display_pixel_format pixfmt,
+				   mipi_dbi_write_cb_t cb, void *user_data);
 };
 
 /**
@@ -242,6 +258,55 @@ static inline int mipi_dbi_write_display(const struct device *dev,
 	return api->write_display(dev, config, framebuf, desc, pixfmt);
 }
 
+/**
+ * @brief Write a display buffer to the display controller asynchronously.
+ *
+ * Same as @ref mipi_dbi_write_display, but returns once the transfer is
+ * started. The framebuffer must stay untouched until @p cb is called.
+ * Commands and writes issued meanwhile wait for the transfer to complete.
+ * Controllers without asynchronous support write the buffer synchronously
+ * and call @p cb before returning.
+ *
+ * @param dev mipi dbi controller
+ * @param config MIPI DBI configuration, must stay valid until @p cb is
+ *   called
+ * @param framebuf: framebuffer to write to display
+ * @param desc: descriptor of framebuffer to write, only used until the
+ *   function returns. Note that the pitch must be equal to width.
+ * @param pixfmt: pixel format of framebuffer data
+ * @param cb: callback called once the buffer is written, possibly from an
+ *   interrupt handler
+ * @param user_data: user data passed to @p cb
+ * @retval 0 buffer write started, @p cb is called exactly once.
+ * @retval -EIO I/O error
+ * @retval -EBUSY controller is busy
+ * @retval -ENOSYS not implemented
+ */
+static inline int mipi_dbi_write_display_async(const struct device *dev,
+					       const struct mipi_dbi_config *config,
+					       const uint8_t *framebuf,
+					       struct display_buffer_descriptor *desc,
+					       enum display_pixel_format pixfmt,
+					       mipi_dbi_write_cb_t cb,
+					       void *user_data)
+{
+	const struct mipi_dbi_driver_api *api =
+		(const struct mipi_dbi_driver_api *)dev->api;
+	int ret;
+
+	if (api->write_display_async != NULL) {
+		return api->write_display_async(dev, config, framebuf, desc,
+						pixfmt, cb, user_data);
+	}
+
+	ret = mipi_dbi_write_display(dev, config, framebuf, desc, pixfmt);
+	if (ret == 0) {
+		cb(dev, 0, user_data);
+	}
+
+	return ret;
+}
+
 /**
  * @brief Resets attached display controller
  *
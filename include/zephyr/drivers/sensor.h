@@ -454,6 +454,24 @@ static inline bool sensor_chan_spec_eq(struct sensor_chan_spec chan_spec0,
 		chan_spec0.chan_idx == chan_spec1.chan_idx;
 }
 
+/**
+ * @brief Decoded frames of a channel, stored as one array per axis
+ *
+ * Filled by sensor_decode_soa(). The caller provides the arrays, each large enough for the
+ * number of frames requested. Single value channels only use @p values[0], three axis
+ * channels use @p values[0] to @p values[2] for x, y and z.
+ */
+struct sensor_soa_data {
+	/** Base timestamp and number of frames decoded by the last call */
+	struct sensor_data_header header;
+	/** Shift common to all the values */
+	int8_t shift;
+	/** Time of each frame relative to the base timestamp, may be NULL */
+	uint32_t *timestamp_delta;
+	/** Value arrays, one per axis */
+	q31_t *values[3];
+};
+
 /**
  * @brief Decodes a single raw data buffer
  *
@@ -524,6 +542,25 @@ struct sensor_decoder_api {
 	 * @return Whether the trigger is present in the buffer
 	 */
 	bool (*has_trigger)(const uint8_t *buffer, enum sensor_trigger_type trigger);
+
+	/**
+	 * @brief Decode up to @p max_count frames into separate arrays
+	 *
+	 * Optional, bulk variant of @ref sensor_decoder_api.decode storing every axis of the
+	 * channel in its own array. Use sensor_decode_soa() rather than calling it directly, it
+	 * falls back to @ref sensor_decoder_api.decode when the decoder does not implement it.
+	 *
+	 * @param[in]     buffer The buffer provided on the @ref rtio context
+	 * @param[in]     channel The channel to decode
+	 * @param[in,out] fit The current frame iterator
+	 * @param[in]     max_count The maximum number of frames to decode
+	 * @param[out]    data_out The decoded data
+	 * @return 0 no more samples to decode
+	 * @return >0 the number of decoded frames
+	 * @return <0 on error
+	 */
+	int (*decode_soa)(const uint8_t *buffer, struct sensor_chan_spec channel, uint32_t *fit,
+			  uint16_t max_count, struct sensor_soa_data *data_out);
 };
 
 /**
@@ -584,6 +621,41 @@ static inline int sensor_decode(struct sensor_decode_context *ctx, void *out, ui
 int sensor_natively_supported_channel_size_info(struct sensor_chan_spec channel, size_t *base_size,
 						size_t *frame_size);
 
+/**
+ * @brief Decode up to @p max_count frames into one array per axis
+ *
+ * Bulk counterpart of sensor_decode(), converting a whole FIFO buffer in one call. It uses
+ * @ref sensor_decoder_api.decode_soa when the decoder implements it, and otherwise decodes
+ * through @ref sensor_decoder_api.decode in small chunks. Only channels decoded to
+ * @ref sensor_q31_data or @ref sensor_three_axis_data are supported.
+ *
+ * @param[in]     decoder The decoder of the sensor
+ * @param[in]     buffer The buffer provided on the @ref rtio context
+ * @param[in]     channel The channel to decode
+ * @param[in,out] fit The current frame iterator
+ * @param[in]     max_count The maximum number of frames to decode
+ * @param[out]    data_out The decoded data
+ * @return 0 no more samples to decode
+ * @return >0 the number of decoded frames
+ * @return <0 on error
+ */
+int sensor_decode_soa(const struct sensor_decoder_api *decoder, const uint8_t *buffer,
+		      struct sensor_chan_spec channel, uint32_t *fit, uint16_t max_count,
+		      struct sensor_soa_data *data_out);
+
+/**
+ * @brief Scale raw left aligned samples in place
+ *
+ * Computes @p values[i] = ( @p values[i] * @p scale) >> 31 for @p count samples, the
+ * conversion kernel shared by the bulk decoders. It uses the DSP subsystem when
+ * :kconfig:option:`CONFIG_SENSOR_DECODE_DSP` is enabled.
+ *
+ * @param[in,out] values Samples to convert
+ * @param[in]     count Number of samples
+ * @param[in]     scale Scale factor in Q31 format
+ */
+void sensor_decode_scale_q31(q31_t *values, size_t count, q31_t scale);
+
 /**
  * @typedef sensor_get_decoder_t
  * @brief Get the decoder associate with the given device
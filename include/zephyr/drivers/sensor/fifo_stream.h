@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Helpers for sensor drivers streaming their FIFO on watermark interrupts.
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_SENSOR_FIFO_STREAM_H_
+#define ZEPHYR_INCLUDE_DRIVERS_SENSOR_FIFO_STREAM_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/rtio/rtio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Sensor FIFO streaming helpers
+ * @defgroup sensor_fifo_stream Sensor FIFO streaming helpers
+ * @ingroup sensor_interface
+ * @{
+ */
+
+/**
+ * @brief Header at the start of each buffer completed by the helper
+ *
+ * The header is followed by @ref sensor_fifo_stream_config.header_size bytes
+ * reserved for the driver, then by @c frame_count frames of
+ * @c frame_size bytes as read from the FIFO.
+ */
+struct sensor_fifo_stream_header {
+	/** Time of the first frame in nanoseconds */
+	uint64_t timestamp;
+	/** Estimated time between two frames in nanoseconds */
+	uint32_t period_ns;
+	/** Number of frames in the buffer */
+	uint16_t frame_count;
+	/** Size of a frame in bytes */
+	uint16_t frame_size;
+	/** Trigger that caused the read */
+	uint8_t trigger;
+} __packed;
+
+/** @brief Description of the FIFO of a sensor */
+struct sensor_fifo_stream_config {
+	/** Register holding the FIFO fill level */
+	uint8_t count_reg;
+	/** Size of the fill level register, 1 or 2 bytes */
+	uint8_t count_len: 2;
+	/** The fill level register is big endian */
+	uint8_t count_be: 1;
+	/** The fill level is a number of frames rather than of bytes */
+	uint8_t count_frames: 1;
+	/** Mask of the valid bits of the fill level */
+	uint16_t count_mask;
+	/** FIFO data register */
+	uint8_t data_reg;
+	/** Bits set in a register address to read it, e.g. the SPI read bit */
+	uint8_t read_flag;
+	/** Size of a FIFO frame in bytes */
+	uint16_t frame_size;
+	/** Space reserved for the driver after the common header */
+	uint16_t header_size;
+	/**
+	 * @brief Fill the driver part of the buffer header
+	 *
+	 * Optional. Called before the FIFO is read, @p hdr is already filled.
+	 */
+	void (*fill_header)(const struct device *dev, const struct sensor_fifo_stream_header *hdr,
+			    uint8_t *buf);
+	/**
+	 * @brief Flush the FIFO
+	 *
+	 * Optional. Called when a trigger asks for its data to be dropped.
+	 */
+	void (*flush)(const struct device *dev);
+	/**
+	 * @brief Re-enable the watermark interrupt
+	 *
+	 * Called once the event reported by sensor_fifo_stream_irq() has been
+	 * handled, successfully or not.
+	 */
+	void (*done)(const struct device *dev);
+};
+
+/** @brief FIFO streaming state, one per sensor */
+struct sensor_fifo_stream {
+	/** @cond INTERNAL_HIDDEN */
+	const struct device *dev;
+	const struct sensor_fifo_stream_config *cfg;
+	struct rtio *r;
+	struct rtio_iodev *bus;
+	struct k_spinlock lock;
+	struct rtio_iodev_sqe *sqe;
+	enum sensor_trigger_type trigger;
+	enum sensor_stream_data_opt opt;
+	uint64_t irq_time;
+	uint64_t last_time;
+	uint32_t period_ns;
+	uint8_t count_buf[2];
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize the streaming state of a sensor
+ *
+ * @param stream Streaming state
+ * @param dev Sensor device, given back to the callbacks of @p cfg
+ * @param cfg Description of the FIFO
+ * @param r RTIO context the bus transfers are submitted to, whose completions
+ *          are consumed by the helper
+ * @param bus Bus iodev of the sensor
+ * @param period_ns Nominal time between two frames, used until it can be measured
+ */
+void sensor_fifo_stream_init(struct sensor_fifo_stream *stream, const struct device *dev,
+			     const struct sensor_fifo_stream_config *cfg, struct rtio *r,
+			     struct rtio_iodev *bus, uint32_t period_ns);
+
+/**
+ * @brief Set the nominal time between two frames
+ *
+ * To be called when the sampling rate changes, the measured period is reset.
+ *
+ * @param stream Streaming state
+ * @param period_ns Nominal time between two frames
+ */
+void sensor_fifo_stream_set_period(struct sensor_fifo_stream *stream, uint32_t period_ns);
+
+/**
+ * @brief Take a streaming submission
+ *
+ * Drivers call this from their submit() API once the sensor is configured
+ * for the triggers of the read configuration. The submission is completed at
+ * the next FIFO watermark or full trigger.
+ *
+ * @param stream Streaming state
+ * @param iodev_sqe Streaming submission
+ */
+void sensor_fifo_stream_submit(struct sensor_fifo_stream *stream,
+			       struct rtio_iodev_sqe *iodev_sqe);
+
+/**
+ * @brief Report a FIFO interrupt
+ *
+ * Called from the interrupt handler of the sensor, with its interrupt
+ * disabled. The FIFO fill level and data are read with chained RTIO
+ * submissions; the frames are timestamped by interpolating between
+ * @p timestamp and the one of the previous interrupt, so the timestamp
+ * should be captured as early as possible, ideally by a hardware counter.
+ * The @ref sensor_fifo_stream_config.done callback is always called.
+ *
+ * @param stream Streaming state
+ * @param trigger Trigger raised, @ref SENSOR_TRIG_FIFO_WATERMARK or @ref SENSOR_TRIG_FIFO_FULL
+ * @param timestamp Time of the interrupt in nanoseconds
+ */
+void sensor_fifo_stream_irq(struct sensor_fifo_stream *stream, enum sensor_trigger_type trigger,
+			    uint64_t timestamp);
+
+/**
+ * @brief Get the time of a frame
+ *
+ * @param hdr Header of a buffer completed by the helper
+ * @param idx Index of the frame
+ *
+ * @return Time of the frame in nanoseconds
+ */
+static inline uint64_t sensor_fifo_stream_frame_time(const struct sensor_fifo_stream_header *hdr,
+						     uint16_t idx)
+{
+	return hdr->timestamp + (uint64_t)hdr->period_ns * idx;
+}
+
+/**
+ * @brief Get the frames of a buffer completed by the helper
+ *
+ * @param buf Buffer completed by the helper
+ * @param header_size Space reserved for the driver, as in its configuration
+ *
+ * @return Pointer to the first frame
+ */
+static inline const uint8_t *sensor_fifo_stream_frames(const uint8_t *buf, uint16_t header_size)
+{
+	return buf + sizeof(struct sensor_fifo_stream_header) + header_size;
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_SENSOR_FIFO_STREAM_H_ */
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief RTIO iodev for UARTs implementing the asynchronous API.
+ */
+
+#ifndef ZEPHYR_DRIVERS_SERIAL_UART_RTIO_H_
+#define ZEPHYR_DRIVERS_SERIAL_UART_RTIO_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/rtio/rtio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @cond INTERNAL_HIDDEN */
+extern const struct rtio_iodev_api uart_rtio_iodev_api;
+/** @endcond */
+
+/** @brief UART RTIO iodev context, one per UART. */
+struct uart_rtio {
+	/* UART the iodev works on. */
+	const struct device *dev;
+
+	/* Size of the buffers taken from the RTIO mempool for reception. */
+	uint32_t rx_buf_size;
+
+	/* Receiver inactivity timeout passed to uart_rx_enable(). */
+	int32_t rx_timeout_us;
+
+	struct k_spinlock lock;
+
+	/* Transmit submissions waiting for the current one to complete. */
+	struct mpsc tx_q;
+	struct rtio_iodev_sqe *tx_curr;
+
+	/* Receive submission and the buffer it owns. */
+	struct rtio_iodev_sqe *rx_curr;
+	uint8_t *rx_buf;
+	uint32_t rx_len;
+	uint32_t rx_bytes;
+	int rx_err;
+
+	/* Mempool buffer given to the driver for a multishot submission. */
+	struct rtio *rx_next_r;
+	uint8_t *rx_next_buf;
+	uint32_t rx_next_len;
+
+	/* Receiver state. */
+	bool rx_enabled;
+	bool rx_stopping;
+};
+
+/**
+ * @brief Define an RTIO iodev for a UART
+ *
+ * Write submissions are sent in order with uart_tx(). A read submission
+ * completes, with the number of bytes received as result, when its buffer
+ * is full or when the receiver has been idle for @p rx_timeout_us. Reads
+ * using the RTIO mempool take buffers of @p rx_buf_size bytes, multishot
+ * reads give the driver the next buffer in advance so reception does not
+ * stop between full buffers. Only one read submission can be pending.
+ *
+ * @param name Name of the iodev
+ * @param uart_dev UART device, which must implement the asynchronous API
+ * @param rx_buf_size Size of the buffers taken from the mempool
+ * @param rx_timeout_us Receiver inactivity timeout in microseconds
+ */
+#define UART_RTIO_IODEV_DEFINE(name, uart_dev, rx_buf_size, rx_timeout_us)                         \
+	static struct uart_rtio CONCAT(name, _ctx) = {                                             \
+		.dev = (uart_dev),                                                                 \
+		.rx_buf_size = (rx_buf_size),                                                      \
+		.rx_timeout_us = (rx_timeout_us),                                                  \
+	};                                                                                         \
+	RTIO_IODEV_DEFINE(name, &uart_rtio_iodev_api, &CONCAT(name, _ctx))
+
+/**
+ * @brief Initialize a UART RTIO iodev
+ *
+ * Takes over the asynchronous API callback of the UART.
+ *
+ * @param iodev Iodev defined by @ref UART_RTIO_IODEV_DEFINE
+ *
+ * @retval 0 on success
+ * @retval -ENODEV if the UART is not ready
+ * @retval -ENOTSUP if the UART does not implement the asynchronous API
+ */
+int uart_rtio_init(const struct rtio_iodev *iodev);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_DRIVERS_SERIAL_UART_RTIO_H_ */
@@ -24,6 +24,7 @@
 #include <zephyr/device.h>
 #include <stddef.h>
 #include <zephyr/kernel.h>
+#include <zephyr/cache.h>
 
 #include <zephyr/types.h>
 
@@ -579,13 +580,70 @@ struct video_buffer *video_buffer_aligned_alloc(size_t size, size_t align);
  */
 struct video_buffer *video_buffer_alloc(size_t size);
 
+/**
+ * @brief Import memory as a video buffer.
+ *
+ * Wraps memory owned by the caller, such as a network buffer or the
+ * framebuffer of another driver, in a video buffer, so frames are
+ * captured to or output from it without any copy. The memory is not
+ * freed by video_buffer_release(), and must stay valid until then.
+ *
+ * For DMA capable devices, the memory must be suitable for DMA, and
+ * aligned to the data cache line size if the data cache is enabled, see
+ * video_buffer_cache_invalidate().
+ *
+ * @param mem Pointer to the memory.
+ * @param size Size of the memory (in bytes).
+ *
+ * @retval pointer to the video buffer, NULL if none is available
+ */
+struct video_buffer *video_buffer_import(void *mem, size_t size);
+
 /**
  * @brief Release a video buffer.
  *
+ * The memory of imported buffers is given back to its owner, the memory
+ * of allocated buffers is freed.
+ *
  * @param buf Pointer to the video buffer to release.
  */
 void video_buffer_release(struct video_buffer *buf);
 
+/**
+ * @brief Clean the data cache of a video buffer.
+ *
+ * Writes the valid data of the buffer back to memory, so it can be read
+ * by a DMA, for instance by an output endpoint or a device the buffer is
+ * shared with, after the CPU wrote it.
+ *
+ * @param buf Pointer to the video buffer.
+ *
+ * @retval 0 Is successful.
+ * @retval -ENOTSUP If the data cache is not managed.
+ */
+static inline int video_buffer_cache_clean(struct video_buffer *buf)
+{
+	return sys_cache_data_flush_range(buf->buffer, buf->bytesused);
+}
+
+/**
+ * @brief Invalidate the data cache of a video buffer.
+ *
+ * Discards the cached copy of the whole buffer, so the CPU reads the
+ * data written to memory by a DMA, for instance by an input endpoint.
+ * The memory must be aligned to the data cache line size, as unrelated
+ * data sharing a cache line would be discarded too.
+ *
+ * @param buf Pointer to the video buffer.
+ *
+ * @retval 0 Is successful.
+ * @retval -ENOTSUP If the data cache is not managed.
+ */
+static inline int video_buffer_cache_invalidate(struct video_buffer *buf)
+{
+	return sys_cache_data_invd_range(buf->buffer, buf->size);
+}
+
 
 /* fourcc - four-character-code */
 #define video_fourcc(a, b, c, d)\
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file zephyr/dsp/pipeline.h
+ *
+ * @brief Public APIs for DSP processing pipelines
+ */
+
+#ifndef INCLUDE_ZEPHYR_DSP_PIPELINE_H_
+#define INCLUDE_ZEPHYR_DSP_PIPELINE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/dsp/dsp.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @ingroup math_dsp
+ * @defgroup math_dsp_pipeline Processing Pipelines
+ *
+ * A pipeline runs a frame of floating-point samples through a sequence of
+ * processing blocks, such as filters, decimators or transforms. The blocks
+ * are the kernels of the DSP backend, using the SIMD instructions of the
+ * target where available.
+ *
+ * No sample is copied between the blocks: the frame buffer given to the
+ * pipeline and a scratch buffer of the pipeline are alternately used as
+ * input and output, except by the blocks processing in place. The frame
+ * buffer is therefore not preserved.
+ * @{
+ */
+
+struct zdsp_block;
+
+/**
+ * @brief Process a frame through a block.
+ *
+ * @param[in]  block       the block
+ * @param[in]  src         points to the input samples, which may be modified
+ * @param[out] dst         points to the output samples, @p src for blocks
+ *                         processing in place
+ * @param[in]  num_samples number of input samples
+ *
+ * @return the number of output samples, or a negative errno code if the
+ *         frame cannot be processed by the block
+ */
+typedef int (*zdsp_block_process_t)(struct zdsp_block *block, float32_t *src, float32_t *dst,
+				    uint32_t num_samples);
+
+/**
+ * @brief Processing block of a DSP pipeline.
+ *
+ * Embedded in the structures of the specific blocks, which are set up by
+ * their initialization function.
+ */
+struct zdsp_block {
+	/** Function processing a frame */
+	zdsp_block_process_t process;
+	/** True if the block writes its output over its input */
+	bool in_place;
+};
+
+/**
+ * @brief DSP processing pipeline.
+ *
+ * Define with ZDSP_PIPELINE_DEFINE().
+ */
+struct zdsp_pipeline {
+	/** @cond INTERNAL_HIDDEN */
+	struct zdsp_block *const *blocks;
+	size_t num_blocks;
+	float32_t *scratch;
+	uint32_t max_frame_size;
+	/** @endcond */
+};
+
+/**
+ * @brief Statically define a DSP processing pipeline.
+ *
+ * @param _name           name of the pipeline
+ * @param _max_frame_size maximum number of samples of the processed frames
+ * @param ...             pointers to the blocks, in processing order
+ */
+#define ZDSP_PIPELINE_DEFINE(_name, _max_frame_size, ...)                                   \
+	static float32_t _name##_scratch[_max_frame_size];                                 \
+	static struct zdsp_block *const _name##_blocks[] = {__VA_ARGS__};                  \
+	struct zdsp_pipeline _name = {                                                     \
+		.blocks = _name##_blocks,                                                  \
+		.num_blocks = ARRAY_SIZE(_name##_blocks),                                  \
+		.scratch = _name##_scratch,                                                \
+		.max_frame_size = _max_frame_size,                                         \
+	}
+
+/**
+ * @brief Run a frame through a DSP processing pipeline.
+ *
+ * @param[in]  pipeline    the pipeline
+ * @param[in]  frame       points to the input samples, also used as working
+ *                         buffer
+ * @param[in]  num_samples number of input samples
+ * @param[out] out         set to the output samples, either in @p frame or
+ *                         in the scratch buffer of the pipeline, valid until
+ *                         the next frame is processed
+ *
+ * @return the number of output samples, or a negative errno code
+ * @retval -EINVAL if the frame is larger than the pipeline maximum frame size
+ */
+int zdsp_pipeline_process(struct zdsp_pipeline *pipeline, float32_t *frame, uint32_t num_samples,
+			  float32_t **out);
+
+/**
+ * @brief Gain block, multiplying the samples by a constant.
+ */
+struct zdsp_gain_block {
+	/** @cond INTERNAL_HIDDEN */
+	struct zdsp_block block;
+	float32_t gain;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a gain block.
+ *
+ * @param[out] gb   the block
+ * @param[in]  gain the gain
+ *
+ * @return the generic block, to be added to a pipeline
+ */
+struct zdsp_block *zdsp_gain_block_init(struct zdsp_gain_block *gb, float32_t gain);
+
+/**
+ * @brief Number of state samples of a FIR block.
+ *
+ * @param num_taps       number of filter coefficients
+ * @param max_frame_size maximum number of samples of the processed frames
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+/* The Helium kernels need room for an extra, vector aligned, frame */
+#define ZDSP_FIR_STATE_SIZE(num_taps, max_frame_size)                                      \
+	((num_taps) + (max_frame_size) - 1 + ROUND_UP(max_frame_size, 4))
+#else
+#define ZDSP_FIR_STATE_SIZE(num_taps, max_frame_size) ((num_taps) + (max_frame_size) - 1)
+#endif
+
+/**
+ * @brief FIR filter block.
+ */
+struct zdsp_fir_block {
+	/** @cond INTERNAL_HIDDEN */
+	struct zdsp_block block;
+	arm_fir_instance_f32 fir;
+	uint32_t max_frame_size;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a FIR filter block.
+ *
+ * @param[out] fb             the block
+ * @param[in]  coeffs         points to the filter coefficients, in time
+ *                            reversed order
+ * @param[in]  num_taps       number of filter coefficients
+ * @param[in]  state          points to ZDSP_FIR_STATE_SIZE() state samples
+ * @param[in]  max_frame_size maximum number of samples of the processed frames
+ *
+ * @return the generic block, to be added to a pipeline
+ */
+struct zdsp_block *zdsp_fir_block_init(struct zdsp_fir_block *fb, const float32_t *coeffs,
+				       uint16_t num_taps, float32_t *state,
+				       uint32_t max_frame_size);
+
+/**
+ * @brief Number of state samples of a biquad cascade block.
+ *
+ * @param num_stages number of second order stages
+ */
+#define ZDSP_BIQUAD_STATE_SIZE(num_stages) (2 * (num_stages))
+
+/**
+ * @brief IIR filter block, made of a cascade of biquad filters.
+ */
+struct zdsp_biquad_block {
+	/** @cond INTERNAL_HIDDEN */
+	struct zdsp_block block;
+	arm_biquad_cascade_df2T_instance_f32 iir;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a biquad cascade block.
+ *
+ * The biquads are implemented in the transposed direct form II.
+ *
+ * @param[out] bb         the block
+ * @param[in]  coeffs     points to 5 coefficients per stage: b0, b1, b2, a1
+ *                        and a2, the feedback coefficients being negated
+ * @param[in]  num_stages number of second order stages
+ * @param[in]  state      points to ZDSP_BIQUAD_STATE_SIZE() state samples
+ *
+ * @return the generic block, to be added to a pipeline
+ */
+struct zdsp_block *zdsp_biquad_block_init(struct zdsp_biquad_block *bb, const float32_t *coeffs,
+					  uint8_t num_stages, float32_t *state);
+
+/**
+ * @brief FIR decimator block.
+ */
+struct zdsp_decimate_block {
+	/** @cond INTERNAL_HIDDEN */
+	struct zdsp_block block;
+	arm_fir_decimate_instance_f32 fir;
+	uint32_t max_frame_size;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a FIR decimator block.
+ *
+ * The block filters the frames and keeps one sample out of @p factor. The
+ * number of samples of the processed frames must be a multiple of
+ * @p factor.
+ *
+ * @param[out] db             the block
+ * @param[in]  coeffs         points to the anti-aliasing filter coefficients,
+ *                            in time reversed order
+ * @param[in]  num_taps       number of filter coefficients
+ * @param[in]  factor         decimation factor
+ * @param[in]  state          points to ZDSP_FIR_STATE_SIZE() state samples
+ * @param[in]  max_frame_size maximum number of samples of the processed frames
+ *
+ * @return the generic block, to be added to a pipeline, or NULL if
+ *         @p max_frame_size is not a multiple of @p factor
+ */
+struct zdsp_block *zdsp_decimate_block_init(struct zdsp_decimate_block *db,
+					    const float32_t *coeffs, uint16_t num_taps,
+					    uint8_t factor, float32_t *state,
+					    uint32_t max_frame_size);
+
+/**
+ * @brief Real FFT block.
+ */
+struct zdsp_rfft_block {
+	/** @cond INTERNAL_HIDDEN */
+	struct zdsp_block block;
+	arm_rfft_fast_instance_f32 rfft;
+	uint16_t fft_len;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a real FFT block.
+ *
+ * The block transforms frames of exactly @p fft_len samples into
+ * @p fft_len / 2 complex bins, as real and imaginary parts. The real
+ * parts of the DC and Nyquist bins are stored in the first bin.
+ *
+ * @param[out] rb      the block
+ * @param[in]  fft_len number of samples of the frames, a power of two from
+ *                     32 to 4096
+ *
+ * @return the generic block, to be added to a pipeline, or NULL if the
+ *         length is not supported
+ */
+struct zdsp_block *zdsp_rfft_block_init(struct zdsp_rfft_block *rb, uint16_t fft_len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_ZEPHYR_DSP_PIPELINE_H_ */
@@ -112,6 +112,15 @@ struct fcb {
 	struct flash_sector *f_sectors;
 	/**< Array of sectors, must be contiguous */
 
+#ifdef CONFIG_FCB_INDEX
+	uint32_t *f_index;
+	/**< Optional array of f_sector_cnt words, one per sector, used to
+	 * remember up to which offset the entries of each sector have already
+	 * been verified. Entries below that offset are walked without reading
+	 * their data again. Can be left NULL to always verify the entries.
+	 */
+#endif
+
 	/* Flash circular buffer internal state */
 	struct k_mutex f_mtx;
 	/**< Locking for accessing the FCB data, internal state */
@@ -191,6 +200,58 @@ int fcb_append(struct fcb *fcb, uint16_t len, struct fcb_entry *loc);
  */
 int fcb_append_finish(struct fcb *fcb, struct fcb_entry *append_loc);
 
+/**
+ * FCB batch of entries, used to append several entries with a single
+ * flash write.
+ */
+struct fcb_batch {
+	uint8_t *fb_buf; /**< Buffer holding the entries as stored in flash */
+	size_t fb_size; /**< Size of the buffer */
+	size_t fb_used; /**< Number of bytes of the buffer already used */
+	uint16_t fb_cnt; /**< Number of entries in the batch */
+};
+
+/**
+ * Initialize an empty batch of entries.
+ *
+ * @param[out] batch Batch to initialize.
+ * @param[in] buf Buffer used to hold the entries, each entry takes its
+ *            length, data and endmarker rounded up to the flash write
+ *            alignment.
+ * @param[in] size Size of the buffer.
+ */
+void fcb_batch_init(struct fcb_batch *batch, uint8_t *buf, size_t size);
+
+/**
+ * Add an entry to a batch.
+ *
+ * The entry is encoded in the batch buffer, with its endmarker, and is
+ * written to flash by @ref fcb_batch_append.
+ *
+ * @param[in] fcb FCB instance structure.
+ * @param[in,out] batch Batch to add the entry to.
+ * @param[in] data Entry payload.
+ * @param[in] len Length of the entry payload.
+ *
+ * @return 0 on success, -ENOMEM if the entry does not fit in the batch
+ *         buffer, other negative values on failure.
+ */
+int fcb_batch_add(struct fcb *fcb, struct fcb_batch *batch, const void *data, uint16_t len);
+
+/**
+ * Append all the entries of a batch to the circular buffer.
+ *
+ * The entries are written with a single flash write, in a new sector if
+ * they do not fit in the active one. The batch is empty on success.
+ *
+ * @param[in] fcb FCB instance structure.
+ * @param[in,out] batch Batch of entries to append.
+ *
+ * @return 0 on success, -ENOSPC if the batch does not fit in a sector or
+ *         there is no free sector, other negative values on failure.
+ */
+int fcb_batch_append(struct fcb *fcb, struct fcb_batch *batch);
+
 /**
  * FCB Walk callback function type.
  *
@@ -162,8 +162,10 @@ struct fs_statvfs {
 #define FS_O_APPEND     0x20
 /** Truncate the file while opening */
 #define FS_O_TRUNC      0x40
+/** Optimize random seeks, file systems without support ignore it */
+#define FS_O_FASTSEEK   0x80
 /** Bitmask for open/create flags */
-#define FS_O_FLAGS_MASK 0x70
+#define FS_O_FLAGS_MASK 0xF0
 
 
 /** Bitmask for open flags */
@@ -272,6 +274,8 @@ static inline void fs_dir_t_init(struct fs_dir_t *zdp)
  *   - @c FS_O_CREATE create file if it does not exist
  *   - @c FS_O_APPEND move to end of file before each write
  *   - @c FS_O_TRUNC truncate the file
+ *   - @c FS_O_FASTSEEK optimize the file for random seeks, with
+ *     @kconfig{CONFIG_FS_FATFS_FASTSEEK} on FAT file systems
  *
  * @warning If @p flags are set to 0 the function will open file, if it exists
  *          and is accessible, but you will have no read/write access to it.
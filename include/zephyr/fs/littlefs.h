@@ -13,6 +13,20 @@
 
 #include <lfs.h>
 
+#ifdef CONFIG_FS_LITTLEFS_STATS
+#include <zephyr/stats/stats.h>
+
+/** @brief Block device operations done by a LittleFS mount */
+STATS_SECT_START(littlefs_stats)
+STATS_SECT_ENTRY32(reads)		/* block read calls */
+STATS_SECT_ENTRY32(read_bytes)		/* bytes read */
+STATS_SECT_ENTRY32(progs)		/* block program calls */
+STATS_SECT_ENTRY32(prog_bytes)		/* bytes programmed */
+STATS_SECT_ENTRY32(erases)		/* block erase calls */
+STATS_SECT_ENTRY32(syncs)		/* device sync calls */
+STATS_SECT_END;
+#endif /* CONFIG_FS_LITTLEFS_STATS */
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -29,7 +43,9 @@ struct fs_littlefs {
 	uint8_t *prog_buffer;
 
 	/* Must be cfg.lookahead_size/4 elements, and
-	 * cfg.lookahead_size must be a multiple of 8.
+	 * cfg.lookahead_size must be a multiple of 8.  A NULL
+	 * cfg.lookahead_buffer is allocated at mount from the
+	 * CONFIG_FS_LITTLEFS_LOOKAHEAD_HEAP_SIZE heap.
 	 */
 	uint32_t *lookahead_buffer[CONFIG_FS_LITTLEFS_LOOKAHEAD_SIZE / sizeof(uint32_t)];
 
@@ -37,6 +53,16 @@ struct fs_littlefs {
 	struct lfs lfs;
 	void *backend;
 	struct k_mutex mutex;
+
+#if CONFIG_FS_LITTLEFS_LOOKAHEAD_HEAP_SIZE > 0
+	/* Lookahead buffer taken from the lookahead heap, if any. */
+	void *lookahead_heap_buffer;
+#endif
+
+#ifdef CONFIG_FS_LITTLEFS_STATS
+	/* Registered under the mount point name at first mount. */
+	STATS_SECT_DECL(littlefs_stats) stats;
+#endif
 };
 
 /** @brief Define a littlefs configuration with customized size
@@ -62,6 +62,14 @@ struct nvs_fs {
 #if CONFIG_NVS_LOOKUP_CACHE
 	uint32_t lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
 #endif
+#if CONFIG_NVS_LOOKUP_INDEX
+	/** Id owning each lookup cache entry */
+	uint16_t lookup_index_id[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+#endif
+#if CONFIG_NVS_BACKGROUND_GC
+	/** Work item running the garbage collection ahead of the writes */
+	struct k_work gc_work;
+#endif
 };
 
 /**
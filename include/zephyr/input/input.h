@@ -53,7 +53,9 @@ struct input_event {
  * @brief Report a new input event.
  *
  * This causes all the callbacks for the specified device to be executed,
- * either synchronously or through the input thread if utilized.
+ * either synchronously or through the input thread if utilized. With
+ * @kconfig{CONFIG_INPUT_FRAME_BATCHING}, events without @p sync are held
+ * and queued together with the next event of the device that has it.
  *
  * @param dev Device generating the event or NULL.
  * @param type Event type (see @ref INPUT_EV_CODES).
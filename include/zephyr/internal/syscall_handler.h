@@ -167,6 +167,17 @@ void k_thread_perms_set(struct k_object *ko, struct k_thread *thread);
  */
 void k_thread_perms_clear(struct k_object *ko, struct k_thread *thread);
 
+/**
+ * Test whether a thread has permission to a kernel object
+ *
+ * @param ko Kernel object metadata to check
+ * @param thread The thread to check
+ * @return true if @a thread may use the object, or the object is public
+ * @note This is an internal API. Do not use unless you are extending
+ *       functionality in the Zephyr tree.
+ */
+bool k_thread_perms_test(struct k_object *ko, struct k_thread *thread);
+
 /**
  * Revoke access to all objects for the provided thread
  *
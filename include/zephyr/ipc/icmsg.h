@@ -123,6 +123,57 @@ int icmsg_send(const struct icmsg_config_t *conf,
 	       struct icmsg_data_t *dev_data,
 	       const void *msg, size_t len);
 
+/** @brief Write a message for the remote icmsg instance without notifying it.
+ *
+ *  Same as @ref icmsg_send, except that the remote instance does not see the
+ *  message until it is notified, with @ref icmsg_notify or by a later
+ *  @ref icmsg_send. This lets a batch of messages raise a single interrupt.
+ *
+ *  @param[in] conf Structure containing configuration parameters for the icmsg
+ *                  instance.
+ *  @param[inout] dev_data Structure containing run-time data used by the icmsg
+ *                         instance.
+ *  @param[in] msg Pointer to a buffer containing data to send.
+ *  @param[in] len Size of data in the @p msg buffer.
+ *
+ *  @retval Number of written bytes.
+ *  @retval -EBUSY when the instance has not finished handshake with the remote
+ *                 instance.
+ *  @retval -ENODATA when the requested data to send is empty.
+ *  @retval -EBADMSG when the requested data to send is too big.
+ *  @retval -ENOBUFS when there are no TX buffers available.
+ *  @retval other errno codes from dependent modules.
+ */
+int icmsg_write(const struct icmsg_config_t *conf,
+		struct icmsg_data_t *dev_data,
+		const void *msg, size_t len);
+
+/** @brief Notify the remote icmsg instance of written messages.
+ *
+ *  @param[in] conf Structure containing configuration parameters for the icmsg
+ *                  instance.
+ *  @param[inout] dev_data Structure containing run-time data used by the icmsg
+ *                         instance.
+ *
+ *  @retval 0 on success.
+ *  @retval other errno codes from dependent modules.
+ */
+int icmsg_notify(const struct icmsg_config_t *conf,
+		 struct icmsg_data_t *dev_data);
+
+/** @brief Check whether received messages are waiting to be processed.
+ *
+ *  It allows the receive callback to tell whether it handles the last message
+ *  of a burst.
+ *
+ *  @param[in] dev_data Structure containing run-time data used by the icmsg
+ *                      instance.
+ *
+ *  @retval true when at least one more message was received.
+ *  @retval false otherwise.
+ */
+bool icmsg_rx_pending(struct icmsg_data_t *dev_data);
+
 /**
  * @}
  */
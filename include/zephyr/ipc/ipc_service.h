@@ -203,6 +203,16 @@ struct ipc_ept_cfg {
 	void *priv;
 };
 
+/** @brief Message of a batch sent with @ref ipc_service_send_batch. */
+struct ipc_service_msg {
+
+	/** Pointer to the buffer to send. */
+	const void *data;
+
+	/** Number of bytes to send. */
+	size_t len;
+};
+
 /** @brief Open an instance
  *
  *  Function to be used to open an instance before being able to register a new
@@ -300,6 +310,33 @@ int ipc_service_deregister_endpoint(struct ipc_ept *ept);
  */
 int ipc_service_send(struct ipc_ept *ept, const void *data, size_t len);
 
+/** @brief Send several messages using given IPC endpoint.
+ *
+ *  Messages are sent in order, the same way as with @ref ipc_service_send.
+ *  Backends supporting it notify the remote once for the whole batch instead
+ *  of once per message, other backends send the messages one by one.
+ *
+ *  @param[in] ept Registered endpoint by @ref ipc_service_register_endpoint.
+ *  @param[in] msgs Messages to send.
+ *  @param[in] count Number of messages in @a msgs.
+ *
+ *  @retval -EIO when no backend is registered or send hook is missing from
+ *               backend.
+ *  @retval -EINVAL when instance, endpoint or messages are invalid.
+ *  @retval -ENOENT when the endpoint is not registered with the instance.
+ *  @retval -EBADMSG when the first message is invalid (i.e. invalid data
+ *		     format, invalid length, ...)
+ *  @retval -EBUSY when the instance is busy.
+ *  @retval -ENOMEM when no memory / buffers are available for the first
+ *		    message.
+ *
+ *  @retval messages number of messages sent, which is less than @a count when
+ *		     sending a message failed after the first one.
+ *  @retval other errno codes depending on the implementation of the backend.
+ */
+int ipc_service_send_batch(struct ipc_ept *ept, const struct ipc_service_msg *msgs,
+			   size_t count);
+
 /** @brief Get the TX buffer size
  *
  *  Get the maximal size of a buffer which can be obtained by @ref
@@ -71,6 +71,31 @@ struct ipc_service_backend {
 	int (*send)(const struct device *instance, void *token,
 		    const void *data, size_t len);
 
+	/** @brief Pointer to the function that will be used to send several
+	 *	   messages at once.
+	 *
+	 *  Optional, the messages are sent one by one with the send hook
+	 *  when not provided.
+	 *
+	 *  @param[in] instance Instance pointer.
+	 *  @param[in] token Backend-specific token.
+	 *  @param[in] msgs Messages to send.
+	 *  @param[in] count Number of messages, at least one.
+	 *
+	 *  @retval -EINVAL when instance is invalid.
+	 *  @retval -ENOENT when the endpoint is not registered with the instance.
+	 *  @retval -EBADMSG when the first message is invalid.
+	 *  @retval -EBUSY when the instance is busy or not ready.
+	 *  @retval -ENOMEM when no memory / buffers are available for the first
+	 *		    message.
+	 *
+	 *  @retval messages number of messages sent.
+	 *  @retval other errno codes depending on the implementation of the
+	 *	    backend.
+	 */
+	int (*send_batch)(const struct device *instance, void *token,
+			  const struct ipc_service_msg *msgs, size_t count);
+
 	/** @brief Pointer to the function that will be used to register endpoints.
 	 *
 	 *  @param[in] instance Instance to register the endpoint onto.
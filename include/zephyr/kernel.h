@@ -397,12 +397,17 @@ static inline void k_thread_heap_assign(struct k_thread *thread,
 	thread->resource_pool = heap;
 }
 
-#if defined(CONFIG_INIT_STACKS) && defined(CONFIG_THREAD_STACK_INFO)
+#if (defined(CONFIG_INIT_STACKS) || defined(CONFIG_THREAD_STACK_WATERMARK)) && \
+	defined(CONFIG_THREAD_STACK_INFO)
 /**
  * @brief Obtain stack usage information for the specified thread
  *
  * User threads will need to have permission on the target thread object.
  *
+ * With @kconfig{CONFIG_THREAD_STACK_WATERMARK}, the unused stack space is
+ * derived from the sampled high water mark of the stack, so it may be
+ * larger than the space which was actually never used.
+ *
  * Some hardware may prevent inspection of a stack buffer currently in use.
  * If this API is called from supervisor mode, on the currently running thread,
  * on a platform which selects @kconfig{CONFIG_NO_UNUSED_STACK_INSPECTION}, an
@@ -1713,6 +1718,31 @@ static inline void *z_impl_k_timer_user_data_get(const struct k_timer *timer)
 	return timer->user_data;
 }
 
+#if defined(CONFIG_TIMEOUT_SLACK) || defined(__DOXYGEN__)
+/**
+ * @brief Set the slack of a timer.
+ *
+ * The timer may expire up to @a slack later than requested, so that its
+ * expiry is handled together with the one of another timeout and the
+ * system timer interrupts less often. Periodic timers keep their nominal
+ * period, the slack only delays the handling of each expiry.
+ *
+ * The slack takes effect on the next start of the timer, or the next
+ * expiry of a periodic timer.
+ *
+ * @kconfig_dep{CONFIG_TIMEOUT_SLACK}
+ *
+ * @param timer     Address of timer.
+ * @param slack     Relative slack, @c K_NO_WAIT for none (the default).
+ */
+__syscall void k_timer_slack_set(struct k_timer *timer, k_timeout_t slack);
+
+static inline void z_impl_k_timer_slack_set(struct k_timer *timer, k_timeout_t slack)
+{
+	timer->timeout.slack = (uint32_t)CLAMP(slack.ticks, 0, INT32_MAX);
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 /** @} */
 
 /**
@@ -2221,6 +2251,9 @@ __syscall int k_futex_wake(struct k_futex *futex, bool wake_all);
 struct k_event {
 	_wait_q_t         wait_q;
 	uint32_t          events;
+	/* Events waited for by the pended threads, may have stale bits */
+	uint32_t          wait_events;
+	uint8_t           options;
 	struct k_spinlock lock;
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_event)
@@ -2231,12 +2264,29 @@ struct k_event {
 
 };
 
-#define Z_EVENT_INITIALIZER(obj) \
+/**
+ * @brief Deliver each event to a single waiter
+ *
+ * An event object with this option wakes the first waiting thread, in
+ * priority order, whose wait conditions are met by the posted events,
+ * and clears the events matching its conditions. The events left can
+ * wake other waiters. A thread whose wait conditions are met when it
+ * calls k_event_wait() or k_event_wait_all() also clears the matching
+ * events. This distributes the events among the waiters instead of
+ * waking all of them.
+ */
+#define K_EVENT_WAKE_ONE BIT(0)
+
+#define Z_EVENT_INITIALIZER_OPTIONS(obj, _options) \
 	{ \
 	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
-	.events = 0 \
+	.events = 0, \
+	.wait_events = 0, \
+	.options = (_options) \
 	}
 
+#define Z_EVENT_INITIALIZER(obj) Z_EVENT_INITIALIZER_OPTIONS(obj, 0)
+
 /**
  * @brief Initialize an event object
  *
@@ -2246,6 +2296,16 @@ struct k_event {
  */
 __syscall void k_event_init(struct k_event *event);
 
+/**
+ * @brief Initialize an event object with options
+ *
+ * This routine initializes an event object, prior to its first use.
+ *
+ * @param event Address of the event object.
+ * @param options Options of the event object, 0 or K_EVENT_WAKE_ONE.
+ */
+__syscall void k_event_init_options(struct k_event *event, uint32_t options);
+
 /**
  * @brief Post one or more events to an event object
  *
@@ -2383,6 +2443,16 @@ static inline uint32_t k_event_test(struct k_event *event, uint32_t events_mask)
 	STRUCT_SECTION_ITERABLE(k_event, name) =               \
 		Z_EVENT_INITIALIZER(name);
 
+/**
+ * @brief Statically define and initialize an event object with options
+ *
+ * @param name Name of the event object.
+ * @param options Options of the event object, 0 or K_EVENT_WAKE_ONE.
+ */
+#define K_EVENT_DEFINE_OPTIONS(name, options)                  \
+	STRUCT_SECTION_ITERABLE(k_event, name) =               \
+		Z_EVENT_INITIALIZER_OPTIONS(name, options);
+
 /** @} */
 
 struct k_fifo {
@@ -2907,6 +2977,19 @@ extern struct k_work_q k_sys_work_q;
  * @{
  */
 
+/**
+ * Mutex contention statistics
+ * @ingroup mutex_apis
+ */
+struct k_mutex_stats {
+	/** Number of locks that found the mutex owned by another thread */
+	uint32_t contended;
+	/** Number of contended locks acquired while spinning */
+	uint32_t spin_acquired;
+	/** Number of contended locks that had to pend */
+	uint32_t pended;
+};
+
 /**
  * Mutex Structure
  * @ingroup mutex_apis
@@ -2928,6 +3011,11 @@ struct k_mutex {
 #ifdef CONFIG_OBJ_CORE_MUTEX
 	struct k_obj_core obj_core;
 #endif
+
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	/** Contention statistics */
+	struct k_mutex_stats stats;
+#endif
 };
 
 /**
@@ -3108,6 +3196,132 @@ __syscall int k_condvar_wait(struct k_condvar *condvar, struct k_mutex *mutex,
  * @cond INTERNAL_HIDDEN
  */
 
+struct k_rwlock {
+	/** Reader count, writer and waiters flags */
+	atomic_t state;
+	/** Threads waiting to read */
+	_wait_q_t read_q;
+	/** Threads waiting to write */
+	_wait_q_t write_q;
+	/** Writer owning the lock */
+	struct k_thread *writer;
+	/** Original priority of the writer */
+	int writer_orig_prio;
+};
+
+#define Z_RWLOCK_INITIALIZER(obj)                                              \
+	{                                                                      \
+		.state = ATOMIC_INIT(0),                                       \
+		.read_q = Z_WAIT_Q_INIT(&(obj).read_q),                        \
+		.write_q = Z_WAIT_Q_INIT(&(obj).write_q),                      \
+		.writer = NULL,                                                \
+		.writer_orig_prio = K_LOWEST_APPLICATION_THREAD_PRIO,          \
+	}
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @defgroup rwlock_apis Reader-Writer Lock APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Statically define and initialize a reader-writer lock.
+ *
+ * The lock can be accessed outside the module where it is defined using:
+ *
+ * @code extern struct k_rwlock <name>; @endcode
+ *
+ * @param name Name of the reader-writer lock.
+ */
+#define K_RWLOCK_DEFINE(name)                                                  \
+	STRUCT_SECTION_ITERABLE(k_rwlock, name) =                              \
+		Z_RWLOCK_INITIALIZER(name)
+
+/**
+ * @brief Initialize a reader-writer lock.
+ *
+ * Upon completion, the lock is not held.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ *
+ * @retval 0 Reader-writer lock initialized.
+ */
+__syscall int k_rwlock_init(struct k_rwlock *rwlock);
+
+/**
+ * @brief Lock a reader-writer lock for reading.
+ *
+ * Any number of threads may hold the lock for reading at the same time. A
+ * thread waits if the lock is held by a writer or if a writer is waiting for
+ * it, so that a steady stream of readers cannot starve writers. The lock is
+ * not recursive: a thread holding it for reading must not lock it again
+ * while a writer may be waiting.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ * @param timeout Waiting period to lock the reader-writer lock,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Lock held for reading.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_rwlock_read_lock(struct k_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Release a reader-writer lock held for reading.
+ *
+ * The last reader hands the lock over to the first waiting writer.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ *
+ * @retval 0 Lock released.
+ * @retval -EPERM The lock is not held for reading.
+ */
+__syscall int k_rwlock_read_unlock(struct k_rwlock *rwlock);
+
+/**
+ * @brief Lock a reader-writer lock for writing.
+ *
+ * A writer has exclusive access to the lock. While it is held for
+ * writing, the priority of the owner is raised to the one of the highest
+ * priority waiting thread, following the same priority inheritance rules
+ * as @ref k_mutex.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ * @param timeout Waiting period to lock the reader-writer lock,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Lock held for writing.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_rwlock_write_lock(struct k_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Release a reader-writer lock held for writing.
+ *
+ * The lock is handed over to the first waiting writer if any, otherwise to
+ * all the waiting readers.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ *
+ * @retval 0 Lock released.
+ * @retval -EPERM The current thread does not hold the lock for writing.
+ */
+__syscall int k_rwlock_write_unlock(struct k_rwlock *rwlock);
+
+/**
+ * @}
+ */
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
 struct k_sem {
 	_wait_q_t wait_q;
 	unsigned int count;
@@ -3520,6 +3734,112 @@ int k_work_queue_drain(struct k_work_q *queue, bool plug);
  */
 int k_work_queue_unplug(struct k_work_q *queue);
 
+#if defined(CONFIG_WORKQUEUE_POOL) || defined(__DOXYGEN__)
+
+struct k_work_q_pool;
+
+/** @brief Start the worker threads of a work queue pool.
+ *
+ * Each member queue of the pool is started with its own thread.  On SMP
+ * systems with CONFIG_SCHED_CPU_MASK the threads are pinned round-robin to
+ * the available CPUs, so each CPU gets its own local queue.
+ *
+ * Member queues are ordinary work queues: the usual k_work and
+ * k_work_delayable flush, cancel and busy-state APIs apply unchanged to
+ * items submitted through the pool.  A worker that runs out of work takes
+ * (steals) the oldest pending item of a sibling queue whose thread is busy.
+ *
+ * @param pool pointer to a pool defined with K_WORK_Q_POOL_DEFINE().
+ *
+ * @param prio initial priority of every worker thread.
+ *
+ * @param cfg optional additional configuration parameters, applied to every
+ * member queue.  Pass @c NULL if not required.
+ */
+void k_work_q_pool_start(struct k_work_q_pool *pool, int prio,
+			 const struct k_work_queue_config *cfg);
+
+/** @brief Submit a work item to a work queue pool.
+ *
+ * The item is appended to the queue local to the submitter: the current
+ * worker's own queue for chained submissions, the current CPU's queue on
+ * SMP, and otherwise the member queues in turn.  If the selected queue's
+ * thread is busy an idle sibling is woken to steal the item.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pool pointer to the work queue pool.
+ *
+ * @param work pointer to the work item.
+ *
+ * @return as with k_work_submit_to_queue().
+ */
+int k_work_submit_to_pool(struct k_work_q_pool *pool, struct k_work *work);
+
+/** @brief Submit an idle delayable work item to a work queue pool after a
+ * delay.
+ *
+ * The target member queue is selected as with k_work_submit_to_pool().
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pool pointer to the work queue pool.
+ *
+ * @param dwork pointer to the delayable work item.
+ *
+ * @param delay the time to wait before submitting the work item.
+ *
+ * @return as with k_work_schedule_for_queue().
+ */
+int k_work_schedule_for_pool(struct k_work_q_pool *pool,
+			     struct k_work_delayable *dwork,
+			     k_timeout_t delay);
+
+/** @brief Reschedule a delayable work item to a work queue pool.
+ *
+ * The target member queue is selected as with k_work_submit_to_pool().
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pool pointer to the work queue pool.
+ *
+ * @param dwork pointer to the delayable work item.
+ *
+ * @param delay the time to wait before submitting the work item.
+ *
+ * @return as with k_work_reschedule_for_queue().
+ */
+int k_work_reschedule_for_pool(struct k_work_q_pool *pool,
+			       struct k_work_delayable *dwork,
+			       k_timeout_t delay);
+
+/** @brief Wait until every queue of a pool has drained, optionally plugging
+ * them.
+ *
+ * @param pool pointer to the work queue pool.
+ *
+ * @param plug if true the member queues will continue to block new
+ * submissions after all items have drained.
+ *
+ * @retval 1 if call had to wait for the drain of any queue to complete
+ * @retval 0 if call did not have to wait
+ * @retval negative if wait was interrupted or failed
+ */
+int k_work_q_pool_drain(struct k_work_q_pool *pool, bool plug);
+
+/** @brief Release the queues of a pool to accept new submissions.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pool pointer to the work queue pool.
+ *
+ * @retval 0 if successfully unplugged
+ * @retval -EALREADY if no queue of the pool was plugged.
+ */
+int k_work_q_pool_unplug(struct k_work_q_pool *pool);
+
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 /** @brief Initialize a delayable work structure.
  *
  * This must be invoked before scheduling a delayable work structure for the
@@ -3614,6 +3934,27 @@ static inline k_ticks_t k_work_delayable_expires_get(
 static inline k_ticks_t k_work_delayable_remaining_get(
 	const struct k_work_delayable *dwork);
 
+#if defined(CONFIG_TIMEOUT_SLACK) || defined(__DOXYGEN__)
+/** @brief Set the slack of a delayable work item.
+ *
+ * The work item may be submitted up to @p slack later than its delay, so
+ * that the expiry is handled together with the one of another timeout and
+ * the system timer interrupts less often.
+ *
+ * The slack takes effect on the next schedule of the work item.
+ *
+ * @kconfig_dep{CONFIG_TIMEOUT_SLACK}
+ *
+ * @funcprops \isr_ok
+ *
+ * @param dwork pointer to the delayable work item.
+ *
+ * @param slack relative slack, @c K_NO_WAIT for none (the default).
+ */
+static inline void k_work_delayable_slack_set(struct k_work_delayable *dwork,
+					      k_timeout_t slack);
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 /** @brief Submit an idle work item to a queue after a delay.
  *
  * Unlike k_work_reschedule_for_queue() this is a no-op if the work item is
@@ -4045,8 +4386,65 @@ struct k_work_q {
 
 	/* Flags describing queue state. */
 	uint32_t flags;
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* Pool this queue is a member of, or NULL. */
+	struct k_work_q_pool *pool;
+#endif /* CONFIG_WORKQUEUE_POOL */
+};
+
+#if defined(CONFIG_WORKQUEUE_POOL) || defined(__DOXYGEN__)
+
+/** @brief A set of work queues sharing their load by work stealing.
+ *
+ * Define instances with K_WORK_Q_POOL_DEFINE().
+ */
+struct k_work_q_pool {
+	/* Member queues, one worker thread each. */
+	struct k_work_q *queues;
+
+	/* Worker stacks, laid out as by K_THREAD_STACK_ARRAY_DEFINE(). */
+	k_thread_stack_t *stacks;
+
+	/* Usable size of each worker stack. */
+	size_t stack_size;
+
+	/* Distance in bytes between two worker stacks. */
+	size_t stack_len;
+
+	/* Number of member queues. */
+	uint32_t num_queues;
+
+	/* Round-robin cursor for submissions without CPU locality. */
+	uint32_t next;
+
+	/* Number of items taken by a worker from a sibling queue. */
+	uint32_t steals;
 };
 
+/**
+ * @brief Statically define a work queue pool.
+ *
+ * The pool must be started with k_work_q_pool_start() before use.
+ *
+ * @param name Name of the pool.
+ * @param n Number of member queues (and worker threads).
+ * @param stack_sz Stack size of each worker thread.
+ */
+#define K_WORK_Q_POOL_DEFINE(name, n, stack_sz)					\
+	static K_THREAD_STACK_ARRAY_DEFINE(_k_work_q_pool_stacks_##name, n,	\
+					   stack_sz);				\
+	static struct k_work_q _k_work_q_pool_queues_##name[n];		\
+	struct k_work_q_pool name = {						\
+		.queues = _k_work_q_pool_queues_##name,				\
+		.stacks = (k_thread_stack_t *)_k_work_q_pool_stacks_##name,	\
+		.stack_size = (stack_sz),					\
+		.stack_len = K_THREAD_STACK_LEN(stack_sz),			\
+		.num_queues = (n),						\
+	}
+
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 /* Provide the implementation for inline functions declared above */
 
 static inline bool k_work_is_pending(const struct k_work *work)
@@ -4078,6 +4476,14 @@ static inline k_ticks_t k_work_delayable_remaining_get(
 	return z_timeout_remaining(&dwork->timeout);
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+static inline void k_work_delayable_slack_set(struct k_work_delayable *dwork,
+					      k_timeout_t slack)
+{
+	dwork->timeout.slack = (uint32_t)CLAMP(slack.ticks, 0, INT32_MAX);
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 static inline k_tid_t k_work_queue_thread_get(struct k_work_q *queue)
 {
 	return &queue->thread;
@@ -4609,6 +5015,62 @@ __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t time
  */
 __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
 
+/**
+ * @brief Send several messages to a message queue.
+ *
+ * This routine sends up to @a num_msgs messages, stored back to back at
+ * @a data, to message queue @a msgq. The messages are handed to waiting
+ * receivers or copied into the queue under a single lock acquisition, and
+ * the receivers woken up cause a single reschedule.
+ *
+ * The routine only waits while not even the first message can be sent,
+ * so fewer than @a num_msgs messages are sent if the queue fills up.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Pointer to the messages.
+ * @param num_msgs Number of messages at @a data.
+ * @param timeout Waiting period to add the first message, or one of the
+ *                special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of messages sent, starting from the first one.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_put_batch(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+			       k_timeout_t timeout);
+
+/**
+ * @brief Receive several messages from a message queue.
+ *
+ * This routine receives up to @a num_msgs messages from message queue
+ * @a msgq in a "first in, first out" manner, storing them back to back at
+ * @a data. The messages are copied out and the queue is refilled from
+ * waiting senders under a single lock acquisition, and the senders woken
+ * up cause a single reschedule.
+ *
+ * The routine only waits while the queue is empty, so fewer than
+ * @a num_msgs messages are received if fewer are queued.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of area to hold the received messages.
+ * @param num_msgs Maximum number of messages to receive.
+ * @param timeout Waiting period to receive the first message,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @return Number of messages received.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_get_batch(struct k_msgq *msgq, void *data, uint32_t num_msgs,
+			       k_timeout_t timeout);
+
 /**
  * @brief Peek/read a message from a message queue.
  *
@@ -4870,6 +5332,8 @@ struct k_pipe {
 	size_t         bytes_used;      /**< Number of bytes used in buffer */
 	size_t         read_index;      /**< Where in buffer to read from */
 	size_t         write_index;     /**< Where in buffer to write */
+	size_t         write_claim;     /**< Bytes claimed for writing */
+	size_t         read_claim;      /**< Bytes claimed for reading */
 	struct k_spinlock lock;		/**< Synchronization lock */
 
 	struct {
@@ -4900,6 +5364,8 @@ struct k_pipe {
 	.bytes_used = 0,                                            \
 	.read_index = 0,                                            \
 	.write_index = 0,                                           \
+	.write_claim = 0,                                           \
+	.read_claim = 0,                                            \
 	.lock = {},                                                 \
 	.wait_q = {                                                 \
 		.readers = Z_WAIT_Q_INIT(&obj.wait_q.readers),       \
@@ -4955,6 +5421,7 @@ void k_pipe_init(struct k_pipe *pipe, unsigned char *buffer, size_t size);
  * @param pipe Address of the pipe.
  * @retval 0 on success
  * @retval -EAGAIN nothing to cleanup
+ * @retval -EBUSY part of the allocated buffer is held by a write or read claim
  */
 int k_pipe_cleanup(struct k_pipe *pipe);
 
@@ -5020,6 +5487,94 @@ __syscall int k_pipe_get(struct k_pipe *pipe, void *data,
 			 size_t bytes_to_read, size_t *bytes_read,
 			 size_t min_xfer, k_timeout_t timeout);
 
+/**
+ * @brief Claim space in the pipe buffer for writing.
+ *
+ * This routine reserves up to @a size contiguous bytes of free space in
+ * the ring buffer of @a pipe, so that the producer can fill it in place,
+ * for instance by DMA, avoiding the copy made by k_pipe_put(). The data
+ * becomes readable when k_pipe_write_commit() is called.
+ *
+ * Consecutive claims extend the claimed space, which may be smaller than
+ * requested when it reaches the end of the buffer; claim again after the
+ * commit to get the space at the start of the buffer. While the claim is
+ * pending, k_pipe_put() can only hand data to waiting readers.
+ *
+ * Only one producer may hold a write claim at a time. The claimed memory
+ * belongs to the pipe, so this routine is not available to user mode.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pipe Address of the pipe.
+ * @param data Set to the address of the claimed space, NULL if none.
+ * @param size Number of bytes requested.
+ *
+ * @return Number of bytes claimed, zero if the buffer is full or the pipe
+ *         has no buffer.
+ */
+size_t k_pipe_write_claim(struct k_pipe *pipe, unsigned char **data, size_t size);
+
+/**
+ * @brief Commit data written to claimed pipe buffer space.
+ *
+ * This routine makes the first @a size bytes of the space claimed with
+ * k_pipe_write_claim() readable, hands them to the readers waiting on
+ * @a pipe and releases the rest of the claim.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes written, up to the total claimed.
+ *
+ * @retval 0 Data committed.
+ * @retval -EINVAL @a size exceeds the claimed space.
+ */
+int k_pipe_write_commit(struct k_pipe *pipe, size_t size);
+
+/**
+ * @brief Claim data in the pipe buffer for reading.
+ *
+ * This routine gives access to up to @a size contiguous bytes of the oldest
+ * data in the ring buffer of @a pipe, so that the consumer can process it
+ * in place instead of copying it out with k_pipe_get(). The data stays in
+ * the pipe until k_pipe_read_finish() is called, and no other read can
+ * complete in the meantime.
+ *
+ * Consecutive claims extend the claimed data, which may be less than
+ * requested when it reaches the end of the buffer; claim again after
+ * finishing to get the data at the start of the buffer.
+ *
+ * Only one consumer may hold a read claim at a time. The claimed memory
+ * belongs to the pipe, so this routine is not available to user mode.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pipe Address of the pipe.
+ * @param data Set to the address of the claimed data, NULL if none.
+ * @param size Number of bytes requested.
+ *
+ * @return Number of bytes claimed, zero if the buffer is empty or the pipe
+ *         has no buffer.
+ */
+size_t k_pipe_read_claim(struct k_pipe *pipe, unsigned char **data, size_t size);
+
+/**
+ * @brief Release data read from the pipe buffer.
+ *
+ * This routine removes the first @a size bytes of the data claimed with
+ * k_pipe_read_claim() from @a pipe and returns the rest of the claim. The
+ * freed space is refilled from the writers waiting on the pipe.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes consumed, up to the total claimed.
+ *
+ * @retval 0 Data released.
+ * @retval -EINVAL @a size exceeds the claimed data.
+ */
+int k_pipe_read_finish(struct k_pipe *pipe, size_t size);
+
 /**
  * @brief Query the number of bytes that may be read from @a pipe.
  *
@@ -5049,8 +5604,11 @@ __syscall size_t k_pipe_write_avail(struct k_pipe *pipe);
  * writers that were previously pended become unpended.
  *
  * @param pipe Address of the pipe.
+ *
+ * @retval 0 Pipe flushed.
+ * @retval -EBUSY A read claim is pending, nothing was flushed.
  */
-__syscall void k_pipe_flush(struct k_pipe *pipe);
+__syscall int k_pipe_flush(struct k_pipe *pipe);
 
 /**
  * @brief Flush the pipe's internal buffer
@@ -5062,8 +5620,11 @@ __syscall void k_pipe_flush(struct k_pipe *pipe);
  * up the pipe's emptied buffer.
  *
  * @param pipe Address of the pipe.
+ *
+ * @retval 0 Buffer flushed.
+ * @retval -EBUSY A read claim is pending, nothing was flushed.
  */
-__syscall void k_pipe_buffer_flush(struct k_pipe *pipe);
+__syscall int k_pipe_buffer_flush(struct k_pipe *pipe);
 
 /** @} */
 
@@ -5080,12 +5641,52 @@ struct k_mem_slab_info {
 #endif
 };
 
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Per-CPU magazine statistics of a memory slab
+ *
+ * Only maintained with CONFIG_MEM_SLAB_MAGAZINE.
+ * @ingroup mem_slab_apis
+ */
+struct k_mem_slab_magazine_stats {
+	/** Allocations served by the magazine of the CPU */
+	uint32_t hits;
+	/** Allocations that refilled the magazine from the slab */
+	uint32_t refills;
+	/** Frees that drained the full magazine to the slab */
+	uint32_t drains;
+	/** Blocks reclaimed from the magazine by other CPUs */
+	uint32_t steals;
+	/** Highest number of blocks held by the magazine */
+	uint32_t max_cached;
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+struct z_mem_slab_magazine {
+	struct k_spinlock lock;
+	uint32_t count;
+	void *blocks[CONFIG_MEM_SLAB_MAGAZINE_SIZE];
+	struct k_mem_slab_magazine_stats stats;
+};
+#endif /* CONFIG_MEM_SLAB_MAGAZINE */
+
 struct k_mem_slab {
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
 	char *buffer;
 	char *free_list;
 	struct k_mem_slab_info info;
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+	struct z_mem_slab_magazine mag[CONFIG_MP_MAX_NUM_CPUS];
+	atomic_t mag_waiters;
+#endif
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
 
@@ -5240,7 +5841,18 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
  */
 static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+	uint32_t cached = 0U;
+
+	/* Blocks cached by the CPUs are free but out of the slab's free list */
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		cached += slab->mag[i].count;
+	}
+
+	return slab->info.num_used - cached;
+#else
 	return slab->info.num_used;
+#endif
 }
 
 /**
@@ -5275,7 +5887,7 @@ static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->info.num_blocks - slab->info.num_used;
+	return slab->info.num_blocks - k_mem_slab_num_used_get(slab);
 }
 
 /**
@@ -5305,6 +5917,22 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
  */
 int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab);
 
+/**
+ * @brief Get the per-CPU magazine statistics of a memory slab
+ *
+ * This routine sums up the statistics of the magazines of all CPUs for
+ * the slab @a slab. The @a max_cached field is the highest value of any
+ * single magazine. Only available with CONFIG_MEM_SLAB_MAGAZINE.
+ *
+ * @param slab Address of the memory slab
+ * @param stats Pointer to memory into which to copy the statistics
+ *
+ * @retval 0 Success
+ * @retval -EINVAL Any parameter points to NULL
+ */
+int k_mem_slab_magazine_stats_get(struct k_mem_slab *slab,
+				  struct k_mem_slab_magazine_stats *stats);
+
 /** @} */
 
 /**
@@ -5773,6 +6401,24 @@ struct k_poll_event {
 	}, \
 	}
 
+/**
+ * @brief Persistent set of poll events
+ *
+ * Events added to a poll set stay registered with their objects between
+ * calls to k_poll_set_wait(), which only returns the events that became
+ * ready.
+ */
+struct k_poll_set {
+	/** PRIVATE - DO NOT TOUCH */
+	sys_dlist_t ready;
+
+	/** PRIVATE - DO NOT TOUCH */
+	_wait_q_t wait_q;
+
+	/** PRIVATE - DO NOT TOUCH */
+	struct z_poller poller;
+};
+
 /**
  * @brief Initialize one struct k_poll_event instance
  *
@@ -5837,6 +6483,71 @@ void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 __syscall int k_poll(struct k_poll_event *events, int num_events,
 		     k_timeout_t timeout);
 
+/**
+ * @brief Initialize a poll set
+ *
+ * @param set Poll set to initialize.
+ */
+void k_poll_set_init(struct k_poll_set *set);
+
+/**
+ * @brief Add a poll event to a poll set
+ *
+ * The event, initialized with k_poll_event_init() or one of the
+ * K_POLL_EVENT_INITIALIZER() macros, stays registered with its object until
+ * it is removed with k_poll_set_del(). It must not be used with k_poll() or
+ * another poll set in the meantime, and the memory holding it must remain
+ * valid.
+ *
+ * Registration is edge-triggered: the event is made ready when it is added
+ * while its object is available, and after that each time the object is
+ * signaled, e.g. each time a semaphore is given while no thread waits on it.
+ * An event is reported once by k_poll_set_wait() no matter how many times
+ * it was signaled, so the caller should consume everything that is
+ * available from the object before waiting again.
+ *
+ * @param set Poll set.
+ * @param event Poll event to add.
+ *
+ * @retval 0 Event added.
+ * @retval -EBUSY Event is already in use by a poll set or k_poll().
+ */
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Remove a poll event from a poll set
+ *
+ * @param set Poll set.
+ * @param event Poll event previously added to @p set.
+ *
+ * @retval 0 Event removed.
+ * @retval -EINVAL Event is not in @p set.
+ */
+int k_poll_set_del(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Wait for events of a poll set to be ready
+ *
+ * Stores pointers to up to @p num_events ready events of the set in
+ * @p events. The state field of each returned event tells what happened,
+ * as with k_poll(). Unlike k_poll(), the cost of a call only depends on the
+ * number of ready events, not on the number of events in the set.
+ *
+ * Several threads may wait on the same set, each ready event is returned to
+ * only one of them.
+ *
+ * @param set Poll set.
+ * @param events Array receiving pointers to the ready events.
+ * @param num_events Size of @p events, must be greater than zero.
+ * @param timeout Waiting period for an event to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of ready events stored in @p events, or -EAGAIN if the
+ *         waiting period timed out.
+ */
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **events,
+		    int num_events, k_timeout_t timeout);
+
 /**
  * @brief Initialize a poll signal object.
  *
@@ -6153,6 +6864,18 @@ void k_sys_runtime_stats_enable(void);
  */
 void k_sys_runtime_stats_disable(void);
 
+/**
+ * @brief Get the runtime statistics of an interrupt line
+ *
+ * Requires CONFIG_SCHED_THREAD_USAGE_ISR. The time of an ISR includes the
+ * time of the nested interrupts which preempted it.
+ *
+ * @param irq Interrupt line, as in the software ISR table.
+ * @param stats Pointer to struct to copy statistics into.
+ * @return -EINVAL if null pointer or invalid interrupt line, otherwise 0
+ */
+int k_isr_runtime_stats_get(unsigned int irq, struct k_isr_stats *stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -59,6 +59,19 @@ struct k_mem_paging_stats_t {
 		/** Number of dirty pages selected for eviction */
 		unsigned long			dirty;
 	} eviction;
+
+#if defined(CONFIG_DEMAND_PAGING_PREFETCH) || defined(__DOXYGEN__)
+	struct {
+		/** Number of pages read ahead */
+		unsigned long			cnt;
+
+		/** Number of read ahead pages accessed before their eviction */
+		unsigned long			hits;
+
+		/** Number of read ahead pages evicted without being accessed */
+		unsigned long			misses;
+	} prefetch;
+#endif /* CONFIG_DEMAND_PAGING_PREFETCH */
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 };
 
@@ -357,6 +370,8 @@ void k_mem_paging_backing_store_location_free(uintptr_t location);
  *
  * Calls to this and k_mem_paging_backing_store_page_in() will always be
  * serialized, but interrupts may be enabled.
+ * The calling thread may also sleep if
+ * k_mem_paging_backing_store_may_sleep() returns true.
  *
  * @param location Location token for the data page, for later retrieval
  */
@@ -370,11 +385,28 @@ void k_mem_paging_backing_store_page_out(uintptr_t location);
  *
  * Calls to this and k_mem_paging_backing_store_page_out() will always be
  * serialized, but interrupts may be enabled.
+ * The calling thread may also sleep if
+ * k_mem_paging_backing_store_may_sleep() returns true.
  *
  * @param location Location token for the data page
  */
 void k_mem_paging_backing_store_page_in(uintptr_t location);
 
+/**
+ * Check whether the ongoing backing store transfer may sleep
+ *
+ * With CONFIG_DEMAND_PAGING_ALLOW_SLEEP, k_mem_paging_backing_store_page_in()
+ * and k_mem_paging_backing_store_page_out() may block the calling thread
+ * until the transfer completes, e.g. on a semaphore given by a DMA
+ * completion interrupt, if this returns true. Otherwise, they are called
+ * with interrupts or the scheduler locked and must complete the transfer
+ * before returning, e.g. by polling.
+ *
+ * @retval true The transfer may sleep
+ * @retval false The transfer must not sleep
+ */
+bool k_mem_paging_backing_store_may_sleep(void);
+
 /**
  * Update internal accounting after a page-in
  *
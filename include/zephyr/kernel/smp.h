@@ -68,4 +68,30 @@ void k_smp_cpu_start(int id, smp_init_fn fn, void *arg);
 void k_smp_cpu_resume(int id, smp_init_fn fn, void *arg,
 		      bool reinit_timer, bool invoke_sched);
 
+typedef void (*smp_call_fn)(void *arg);
+
+/**
+ * @brief Run a function on a CPU.
+ *
+ * This routine runs @a fn on the CPU specified by @a id, from
+ * its IPI handler with interrupts locked, and waits for it to
+ * return. @a fn is called directly if @a id is the current CPU.
+ * IPIs raised for several reasons before the target CPU takes
+ * the first one are coalesced into a single interrupt.
+ *
+ * @note This function must be called from a thread, with
+ *       interrupts unlocked, so that two CPUs calling each
+ *       other do not deadlock. @a fn must not block.
+ *
+ * @note Requires CONFIG_SMP_CALL.
+ *
+ * @param id ID of target CPU.
+ * @param fn Function to be called on the target CPU.
+ * @param arg Argument to @a fn.
+ *
+ * @retval 0 once @a fn has returned.
+ * @retval -EINVAL if @a id is not a valid CPU ID.
+ */
+int k_smp_call_on_cpu(int id, smp_call_fn fn, void *arg);
+
 #endif /* ZEPHYR_INCLUDE_KERNEL_SMP_H_ */
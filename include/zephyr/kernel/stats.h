@@ -27,7 +27,38 @@ struct k_cycle_stats {
 	uint32_t  num_windows;  /**< \# of usage windows */
 	/** @} */
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#if defined(CONFIG_SCHED_THREAD_USAGE_ISR) || defined(__DOXYGEN__)
+	uint64_t  isr;          /**< CPU only: \# of cycles in ISRs */
+#endif /* CONFIG_SCHED_THREAD_USAGE_ISR */
+#if defined(CONFIG_SCHED_THREAD_USAGE_SCHED) || defined(__DOXYGEN__)
+	uint64_t  sched;        /**< CPU only: \# of cycles between threads */
+#endif /* CONFIG_SCHED_THREAD_USAGE_SCHED */
+#if defined(CONFIG_SCHED_THREAD_USAGE_HIST) || defined(__DOXYGEN__)
+	/**
+	 * @name Fields available when CONFIG_SCHED_THREAD_USAGE_HIST is selected.
+	 * @{
+	 */
+	/** Ready latency histogram, see CONFIG_SCHED_THREAD_USAGE_HIST_BINS */
+	uint32_t  ready_hist[CONFIG_SCHED_THREAD_USAGE_HIST_BINS];
+	/** Thread only: wait time histogram */
+	uint32_t  wait_hist[CONFIG_SCHED_THREAD_USAGE_HIST_BINS];
+	uint32_t  hist0;        /**< start of the ready or wait period */
+	bool      waiting;      /**< true if hist0 is the start of a wait */
+	/** @} */
+#endif /* CONFIG_SCHED_THREAD_USAGE_HIST */
+#if defined(CONFIG_SCHED_THREAD_USAGE_WINDOW) || defined(__DOXYGEN__)
+	uint64_t  window0;      /**< total at the start of the load window */
+	uint16_t  load;         /**< rolling average load, in 1/1000 */
+#endif /* CONFIG_SCHED_THREAD_USAGE_WINDOW */
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
+/**
+ * Runtime statistics of an interrupt line, see CONFIG_SCHED_THREAD_USAGE_ISR.
+ */
+struct k_isr_stats {
+	uint64_t  total;        /**< total time in the ISR in cycles */
+	uint32_t  count;        /**< \# of ISR calls */
+};
+
 #endif /* ZEPHYR_INCLUDE_KERNEL_STATS_H_ */
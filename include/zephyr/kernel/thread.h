@@ -172,6 +172,11 @@ struct _thread_stack_info {
 	 */
 	size_t delta;
 
+#if defined(CONFIG_THREAD_STACK_WATERMARK)
+	/* Highest stack usage sampled, from the top of the stack buffer. */
+	size_t watermark;
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
+
 #if defined(CONFIG_THREAD_STACK_MEM_MAPPED)
 	struct {
 		/** Base address of the memory mapped thread stack */
@@ -207,7 +212,8 @@ struct _thread_userspace_local_data {
 typedef struct k_thread_runtime_stats {
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	/*
-	 * For CPU stats, execution_cycles is the sum of non-idle + idle cycles.
+	 * For CPU stats, execution_cycles is the sum of non-idle + idle cycles,
+	 * plus the ISR cycles with CONFIG_SCHED_THREAD_USAGE_ISR.
 	 * For thread stats, execution_cycles = total_cycles.
 	 */
 	uint64_t execution_cycles;    /* total # of cycles (cpu: non-idle + idle) */
@@ -237,6 +243,31 @@ typedef struct k_thread_runtime_stats {
 	uint64_t idle_cycles;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_ISR
+	/* CPU only: # of cycles spent in ISRs, not part of total_cycles */
+	uint64_t isr_cycles;
+#endif /* CONFIG_SCHED_THREAD_USAGE_ISR */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_SCHED
+	/* CPU only: # of cycles spent switching between threads */
+	uint64_t sched_cycles;
+#endif /* CONFIG_SCHED_THREAD_USAGE_SCHED */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_HIST
+	/*
+	 * Bin 0 counts the latencies below 2^CONFIG_SCHED_THREAD_USAGE_HIST_SHIFT
+	 * cycles, bin N the ones below twice the bound of bin N-1, the last
+	 * bin all the longer ones. The wait histogram is zero for CPUs.
+	 */
+	uint32_t ready_hist[CONFIG_SCHED_THREAD_USAGE_HIST_BINS];
+	uint32_t wait_hist[CONFIG_SCHED_THREAD_USAGE_HIST_BINS];
+#endif /* CONFIG_SCHED_THREAD_USAGE_HIST */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_WINDOW
+	/* Rolling average of the non-idle load, in 1/1000 */
+	uint32_t load;
+#endif /* CONFIG_SCHED_THREAD_USAGE_WINDOW */
+
 #if defined(__cplusplus) && !defined(CONFIG_SCHED_THREAD_USAGE) &&                                 \
 	!defined(CONFIG_SCHED_THREAD_USAGE_ANALYSIS) && !defined(CONFIG_SCHED_THREAD_USAGE_ALL)
 	/* If none of the above Kconfig values are defined, this struct will have a size 0 in C
@@ -348,6 +379,11 @@ struct k_thread {
 	/** resource pool */
 	struct k_heap *resource_pool;
 
+#ifdef CONFIG_SYS_ARENA_THREAD
+	/** default arena */
+	struct sys_arena *arena;
+#endif /* CONFIG_SYS_ARENA_THREAD */
+
 #if defined(CONFIG_THREAD_LOCAL_STORAGE)
 	/* Pointer to arch-specific TLS area */
 	uintptr_t tls;
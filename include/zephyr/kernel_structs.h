@@ -173,6 +173,9 @@ struct _cpu {
 #ifdef CONFIG_SMP
 	/* True when _current is allowed to context switch */
 	uint8_t swap_ok;
+
+	/* IPI_REASON_* bits raised by other CPUs, cleared by the IPI */
+	atomic_t ipi_reasons;
 #endif
 
 #ifdef CONFIG_SCHED_THREAD_USAGE
@@ -184,6 +187,16 @@ struct _cpu {
 
 	uint32_t usage0;
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_SCHED
+	/* Timestamp of the last z_sched_usage_stop(), [0] once started */
+	uint32_t sched0;
+#endif
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ISR
+	/* Interrupt nesting level seen by z_sched_usage_isr_enter() */
+	uint8_t usage_isr_nested;
+#endif
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 	struct k_cycle_stats *usage;
 #endif
@@ -294,14 +307,40 @@ struct _timeout;
 typedef void (*_timeout_func_t)(struct _timeout *t);
 
 struct _timeout {
+#ifdef CONFIG_TIMEOUT_QUEUE_PAIRING_HEAP
+	union {
+		sys_dnode_t node;
+		struct {
+			/* Leftmost child and right sibling in the heap */
+			struct _timeout *child;
+			struct _timeout *sibling;
+		};
+	};
+	/* Parent or left sibling, NULL when the timeout is not queued */
+	struct _timeout *prev;
+	/* Insertion order, keeps equal expiries firing in FIFO order */
+	uint32_t seq;
+#else
 	sys_dnode_t node;
+#endif /* CONFIG_TIMEOUT_QUEUE_PAIRING_HEAP */
 	_timeout_func_t fn;
 #ifdef CONFIG_TIMEOUT_64BIT
-	/* Can't use k_ticks_t for header dependency reasons */
+	/* Can't use k_ticks_t for header dependency reasons.  With
+	 * CONFIG_TIMEOUT_QUEUE_PAIRING_HEAP this is the absolute expiry
+	 * tick rather than a delta to the previous timeout.
+	 */
 	int64_t dticks;
 #else
 	int32_t dticks;
 #endif
+#ifdef CONFIG_TIMEOUT_SLACK
+	/* Ticks the expiry may be deferred by to share a wakeup */
+	uint32_t slack;
+#ifdef CONFIG_TIMEOUT_QUEUE_PAIRING_HEAP
+	/* Earliest expiry plus slack of the timeouts in this subtree */
+	int64_t slack_due;
+#endif /* CONFIG_TIMEOUT_QUEUE_PAIRING_HEAP */
+#endif /* CONFIG_TIMEOUT_SLACK */
 };
 
 typedef void (*k_thread_timeslice_fn_t)(struct k_thread *thread, void *data);
@@ -109,6 +109,11 @@ extern char __kernel_ram_size[];
 extern char __bss_start[];
 extern char __bss_end[];
 
+#ifdef CONFIG_LAZY_BSS
+extern char __lazy_bss_start[];
+extern char __lazy_bss_end[];
+#endif /* CONFIG_LAZY_BSS */
+
 /* Used by z_data_copy() or arch-specific implementation */
 #ifdef CONFIG_XIP
 extern char __data_region_load_start[];
@@ -47,6 +47,12 @@
 #define __stm32_backup_sram_section Z_GENERIC_SECTION(_STM32_BACKUP_SRAM_SECTION_NAME)
 #endif /* CONFIG_ARM */
 
+#if defined(CONFIG_LAZY_BSS)
+#define __lazy_bss __in_section_unique(lazy_bss)
+#else
+#define __lazy_bss
+#endif /* CONFIG_LAZY_BSS */
+
 #if defined(CONFIG_NOCACHE_MEMORY)
 #define __nocache __in_section_unique(_NOCACHE_SECTION_NAME)
 #define __nocache_noinit __nocache
@@ -92,6 +92,49 @@ extern "C" {
 		}						\
 	} while (0)
 
+/**
+ * @brief Writes an ERROR level message to the log, rate limited per call site.
+ *
+ * @details Each call site may log up to @kconfig{CONFIG_LOG_RATELIMIT_BURST}
+ * messages every @kconfig{CONFIG_LOG_RATELIMIT_INTERVAL_MS} milliseconds.
+ * Further messages are only counted, and the count is logged before the next
+ * message that gets through.
+ *
+ * @param ... A string optionally containing printk valid conversion specifier,
+ * followed by as many values as specifiers.
+ */
+#define LOG_ERR_RATELIMIT(...) Z_LOG_RATELIMIT(LOG_LEVEL_ERR, __VA_ARGS__)
+
+/**
+ * @brief Writes a WARNING level message to the log, rate limited per call site.
+ *
+ * @details See @ref LOG_ERR_RATELIMIT.
+ *
+ * @param ... A string optionally containing printk valid conversion specifier,
+ * followed by as many values as specifiers.
+ */
+#define LOG_WRN_RATELIMIT(...) Z_LOG_RATELIMIT(LOG_LEVEL_WRN, __VA_ARGS__)
+
+/**
+ * @brief Writes an INFO level message to the log, rate limited per call site.
+ *
+ * @details See @ref LOG_ERR_RATELIMIT.
+ *
+ * @param ... A string optionally containing printk valid conversion specifier,
+ * followed by as many values as specifiers.
+ */
+#define LOG_INF_RATELIMIT(...) Z_LOG_RATELIMIT(LOG_LEVEL_INF, __VA_ARGS__)
+
+/**
+ * @brief Writes a DEBUG level message to the log, rate limited per call site.
+ *
+ * @details See @ref LOG_ERR_RATELIMIT.
+ *
+ * @param ... A string optionally containing printk valid conversion specifier,
+ * followed by as many values as specifiers.
+ */
+#define LOG_DBG_RATELIMIT(...) Z_LOG_RATELIMIT(LOG_LEVEL_DBG, __VA_ARGS__)
+
 /**
  * @brief Unconditionally print raw log message.
  *
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_LOG_BACKEND_RAM_H_
+#define ZEPHYR_LOG_BACKEND_RAM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Read and remove formatted log data from the RAM backend.
+ *
+ * @details Data is returned as a byte stream in the output format of the
+ * backend. In dictionary mode the stream, saved to a file, can be decoded
+ * by scripts/logging/dictionary/log_parser.py.
+ *
+ * @param buf Buffer for the data.
+ * @param len Size of @p buf.
+ *
+ * @return Number of bytes copied to @p buf.
+ */
+size_t log_backend_ram_read(uint8_t *buf, size_t len);
+
+/**
+ * @brief Get the number of bytes waiting to be read from the RAM backend.
+ *
+ * @return Number of bytes.
+ */
+size_t log_backend_ram_pending(void);
+
+/**
+ * @brief Discard all data stored in the RAM backend.
+ */
+void log_backend_ram_clear(void);
+
+/**
+ * @brief Get and reset the number of messages dropped by the RAM backend.
+ *
+ * @details Messages are dropped whole when the buffer has no room for them,
+ * so that the stored stream always contains complete messages.
+ *
+ * @return Number of messages dropped since the last call.
+ */
+uint32_t log_backend_ram_dropped_get(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_LOG_BACKEND_RAM_H_ */
@@ -12,6 +12,7 @@
 #include <stdint.h>
 #include <stdarg.h>
 #include <zephyr/sys/util.h>
+#include <zephyr/sys/atomic.h>
 
 /* This header file keeps all macros and functions needed for creating logging
  * messages (macros like @ref LOG_ERR).
@@ -252,7 +253,7 @@ static inline char z_log_minimal_level_to_char(int level)
 	\
 	bool is_user_context = k_is_user_context(); \
 	if (!IS_ENABLED(CONFIG_LOG_FRONTEND) && IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) && \
-	    !is_user_context && _level > Z_LOG_RUNTIME_FILTER((_dsource)->filters)) { \
+	    !is_user_context && Z_LOG_RUNTIME_FILTERED_OUT((_dsource)->filters, _level)) { \
 		break; \
 	} \
 	int _mode; \
@@ -289,6 +290,54 @@ static inline char z_log_minimal_level_to_char(int level)
 		__VA_ARGS__); \
 } while (0)
 
+/** @internal
+ * @brief State of a rate limited logging call site.
+ */
+struct log_ratelimit {
+	/* Start of the current interval, in milliseconds. */
+	atomic_t start;
+	/* Messages logged in the current interval. */
+	atomic_t used;
+	/* Messages suppressed since the last logged one. */
+	atomic_t suppressed;
+};
+
+/** @internal
+ * @brief Check if a rate limited call site may log a message.
+ *
+ * @param rl Call site state.
+ * @param[out] suppressed Number of messages suppressed by the call site
+ * since the last logged message. Only set when true is returned.
+ *
+ * @retval true The message shall be logged.
+ * @retval false The message is suppressed.
+ */
+bool z_log_ratelimit(struct log_ratelimit *rl, uint32_t *suppressed);
+
+/** @internal
+ * @brief Generic rate limited logging macro.
+ *
+ * Each call site gets its own state. Runs of suppressed messages are
+ * reported with a single message before the next one that is logged.
+ */
+#define Z_LOG_RATELIMIT(_level, ...) do { \
+	if (!Z_LOG_CONST_LEVEL_CHECK(_level)) { \
+		break; \
+	} \
+	if (IS_ENABLED(CONFIG_LOG_MODE_MINIMAL)) { \
+		Z_LOG(_level, __VA_ARGS__); \
+		break; \
+	} \
+	static struct log_ratelimit _rl; \
+	uint32_t _suppressed; \
+	if (z_log_ratelimit(&_rl, &_suppressed)) { \
+		if (_suppressed > 0) { \
+			Z_LOG(_level, "Last message repeated %u times", _suppressed); \
+		} \
+		Z_LOG(_level, __VA_ARGS__); \
+	} \
+} while (0)
+
 /*****************************************************************************/
 /****************** Macros for hexdump logging *******************************/
 /*****************************************************************************/
@@ -336,7 +385,7 @@ static inline char z_log_minimal_level_to_char(int level)
 		break; \
 	} \
 	if (!IS_ENABLED(CONFIG_LOG_FRONTEND) && IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) && \
-	    !is_user_context && (_level) > Z_LOG_RUNTIME_FILTER(filters)) { \
+	    !is_user_context && Z_LOG_RUNTIME_FILTERED_OUT(filters, _level)) { \
 		break; \
 	} \
 	int mode; \
@@ -388,11 +437,21 @@ static inline char z_log_minimal_level_to_char(int level)
 /** @brief Slot mask. */
 #define LOG_FILTER_SLOT_MASK (BIT(LOG_FILTER_SLOT_SIZE) - 1U)
 
+/** @brief Bit offset of the aggregated slot.
+ *
+ * The aggregated slot occupies the most significant bits of the filter word,
+ * so that a runtime filter check is a single compare of the word against a
+ * constant, see @ref Z_LOG_RUNTIME_FILTERED_OUT.
+ */
+#define LOG_FILTER_AGGR_SLOT_SHIFT (32U - LOG_FILTER_SLOT_SIZE)
+
 /** @brief Bit offset of a slot.
  *
  *  @param _id Slot ID.
  */
-#define LOG_FILTER_SLOT_SHIFT(_id) (LOG_FILTER_SLOT_SIZE * (_id))
+#define LOG_FILTER_SLOT_SHIFT(_id) \
+	(((_id) == LOG_FILTER_AGGR_SLOT_IDX) ? LOG_FILTER_AGGR_SLOT_SHIFT : \
+	 (LOG_FILTER_SLOT_SIZE * ((_id) - 1U)))
 
 #define LOG_FILTER_SLOT_GET(_filters, _id) \
 	((*(_filters) >> LOG_FILTER_SLOT_SHIFT(_id)) & LOG_FILTER_SLOT_MASK)
@@ -419,6 +478,14 @@ static inline char z_log_minimal_level_to_char(int level)
 #define Z_LOG_RUNTIME_FILTER(_filter) \
 	LOG_FILTER_SLOT_GET(&(_filter), LOG_FILTER_AGGR_SLOT_IDX)
 
+/* Check if a message with @p _level is rejected by the aggregated level of
+ * @p _filter. As the aggregated level is stored in the most significant bits,
+ * levels above it are exactly those for which the whole filter word is below
+ * the level shifted into the aggregated slot.
+ */
+#define Z_LOG_RUNTIME_FILTERED_OUT(_filter, _level) \
+	((_filter) < ((uint32_t)(_level) << LOG_FILTER_AGGR_SLOT_SHIFT))
+
 /** @brief Log level value used to indicate log entry that should not be
  *	   formatted (raw string).
  */
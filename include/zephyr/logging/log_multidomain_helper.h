@@ -7,6 +7,8 @@
 #ifndef ZEPHYR_INCLUDE_LOGGING_LOG_MULTIDOMAIN_HELPER_H_
 #define ZEPHYR_INCLUDE_LOGGING_LOG_MULTIDOMAIN_HELPER_H_
 
+#include <zephyr/logging/log_msg.h>
+
 /**
  * @brief Logger multidomain backend helpers
  *
@@ -53,6 +55,9 @@
 /** @brief Link-backend readiness indication ID/ */
 #define Z_LOG_MULTIDOMAIN_ID_READY 8
 
+/** @brief Batch of compressed logging messages ID. */
+#define Z_LOG_MULTIDOMAIN_ID_MSG_BATCH 9
+
 /**@} */
 
 /**
@@ -73,6 +78,17 @@ struct log_multidomain_log_msg {
 	uint8_t data[0];
 } __packed;
 
+/** @brief Content of the batch of logging messages.
+ *
+ * Each message in the batch is encoded as the message descriptor, followed by
+ * the source ID and the difference between the message timestamp and the
+ * timestamp of the previous message, both as variable length integers, the
+ * thread ID if enabled, and the package and data of the message.
+ */
+struct log_multidomain_log_msg_batch {
+	uint8_t data[0];
+} __packed;
+
 /** @brief Content of the domain count message. */
 struct log_multidomain_domain_cnt {
 	uint16_t count;
@@ -120,6 +136,7 @@ struct log_multidomain_dropped {
 /** @brief Union with all message types. */
 union log_multidomain_msg_data {
 	struct log_multidomain_log_msg log_msg;
+	struct log_multidomain_log_msg_batch log_msg_batch;
 	struct log_multidomain_domain_cnt domain_cnt;
 	struct log_multidomain_source_cnt source_cnt;
 	struct log_multidomain_domain_name domain_name;
@@ -173,6 +190,7 @@ struct log_multidomain_link {
 	struct k_sem rdy_sem;
 	const struct log_link *link;
 	union log_multidomain_link_dst dst;
+	log_timestamp_t timestamp;
 	int status;
 	bool ready;
 };
@@ -194,11 +212,63 @@ struct log_multidomain_backend {
 	const struct log_multidomain_backend_transport_api *transport_api;
 	const struct log_backend *log_backend;
 	struct k_sem rdy_sem;
+#ifdef CONFIG_LOG_MULTIDOMAIN_BACKEND_BATCH
+	uint8_t batch[CONFIG_LOG_MULTIDOMAIN_BACKEND_BATCH_SIZE] __aligned(sizeof(void *));
+	size_t batch_len;
+	log_timestamp_t timestamp;
+	log_timestamp_t batch_timestamp;
+#endif
 	bool panic;
 	int status;
 	bool ready;
 };
 
+/** @brief Maximum length of an encoded variable length integer. */
+#define Z_LOG_MULTIDOMAIN_VARINT_MAX_LEN 10
+
+/** @brief Encode a variable length integer, 7 bits per byte.
+ *
+ * @param buf Destination, must have room for @ref Z_LOG_MULTIDOMAIN_VARINT_MAX_LEN bytes.
+ * @param val Value.
+ *
+ * @return Number of bytes written.
+ */
+static inline size_t z_log_multidomain_varint_put(uint8_t *buf, uint64_t val)
+{
+	size_t len = 0;
+
+	while (val >= 0x80U) {
+		buf[len++] = (uint8_t)val | 0x80U;
+		val >>= 7;
+	}
+
+	buf[len++] = (uint8_t)val;
+
+	return len;
+}
+
+/** @brief Decode a variable length integer.
+ *
+ * @param buf Source.
+ * @param len Number of bytes available at @p buf.
+ * @param val Location for the decoded value.
+ *
+ * @return Number of bytes read, 0 if the encoding is truncated.
+ */
+static inline size_t z_log_multidomain_varint_get(const uint8_t *buf, size_t len, uint64_t *val)
+{
+	*val = 0;
+
+	for (size_t i = 0; (i < len) && (i < Z_LOG_MULTIDOMAIN_VARINT_MAX_LEN); i++) {
+		*val |= (uint64_t)(buf[i] & 0x7FU) << (7U * i);
+		if ((buf[i] & 0x80U) == 0U) {
+			return i + 1;
+		}
+	}
+
+	return 0;
+}
+
 /** @brief Function to be called when data is received from remote.
  *
  * @param link Link instance.
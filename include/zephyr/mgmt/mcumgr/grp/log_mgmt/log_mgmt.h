@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef H_LOG_MGMT_
+#define H_LOG_MGMT_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Command IDs for log management group.
+ */
+#define LOG_MGMT_ID_SHOW    0
+#define LOG_MGMT_ID_CLEAR   1
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H_LOG_MGMT_ */
@@ -14,6 +14,7 @@ extern "C" {
  * Command IDs for zephyr basic management group.
  */
 #define ZEPHYR_MGMT_GRP_BASIC_CMD_ERASE_STORAGE	0	/* Command to erase storage partition */
+#define ZEPHYR_MGMT_GRP_BASIC_CMD_BOOT_PROFILE	1	/* Command to read the boot profile */
 
 /**
  * Command result codes for statistics management group.
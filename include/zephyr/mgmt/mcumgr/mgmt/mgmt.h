@@ -9,6 +9,7 @@
 #define H_MGMT_MGMT_
 
 #include <inttypes.h>
+#include <zephyr/kernel.h>
 #include <zephyr/sys/slist.h>
 #include <zephyr/mgmt/mcumgr/smp/smp.h>
 #include <zephyr/mgmt/mcumgr/mgmt/mgmt_defines.h>
@@ -93,6 +94,11 @@ struct mgmt_group {
 	/** The numeric ID of this group. */
 	uint16_t mg_group_id;
 
+#if CONFIG_MCUMGR_TRANSPORT_WORKQUEUE_COUNT > 1
+	/** Serializes the handlers of this group across SMP work queues, internal use only */
+	struct k_mutex mg_lock;
+#endif
+
 #if IS_ENABLED(CONFIG_MCUMGR_SMP_SUPPORT_ORIGINAL_PROTOCOL)
 	/** A function handler for translating version 2 SMP error codes to version 1 SMP error
 	 * codes (optional)
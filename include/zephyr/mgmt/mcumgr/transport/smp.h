@@ -125,6 +125,11 @@ struct smp_transport {
 	/* Function pointers */
 	struct smp_transport_api_t functions;
 
+#if CONFIG_MCUMGR_TRANSPORT_WORKQUEUE_COUNT > 1
+	/* Work queue processing the requests, assigned by smp_transport_init() */
+	struct k_work_q *work_q;
+#endif
+
 #ifdef CONFIG_MCUMGR_TRANSPORT_REASSEMBLY
 	/* Packet reassembly internal data, API access only */
 	struct {
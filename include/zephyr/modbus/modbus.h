@@ -383,6 +383,25 @@ struct modbus_user_callbacks {
 
 	/** Floating Point Holding Register write callback */
 	int (*holding_reg_wr_fp)(uint16_t addr, float reg);
+
+	/**
+	 * Input Registers read callback, for a range of integer registers.
+	 * Used instead of input_reg_rd if set.
+	 */
+	int (*input_regs_rd)(uint16_t addr, uint16_t *regs, uint16_t num_regs);
+
+	/**
+	 * Holding Registers read callback, for a range of integer registers.
+	 * Used instead of holding_reg_rd if set.
+	 */
+	int (*holding_regs_rd)(uint16_t addr, uint16_t *regs, uint16_t num_regs);
+
+	/**
+	 * Holding Registers write callback, for a range of integer registers.
+	 * Used instead of holding_reg_wr if set, also to write a single
+	 * register.
+	 */
+	int (*holding_regs_wr)(uint16_t addr, const uint16_t *regs, uint16_t num_regs);
 };
 
 /**
@@ -222,6 +222,75 @@ static inline void net_capture_pkt(struct net_if *iface, struct net_pkt *pkt)
 }
 #endif
 
+/**
+ * @brief One instruction of a capture filter program.
+ *
+ * The filter programs use the classic BPF instruction set and encoding,
+ * so this has the same layout as struct sock_filter of Linux and programs
+ * generated with "tcpdump -dd" can be used as such. The program is run
+ * against the link layer frame, and its return value is the number of bytes
+ * to capture, zero meaning that the packet is not captured.
+ */
+struct net_capture_filter_insn {
+	uint16_t code; /**< Instruction class, size, mode and operation */
+	uint8_t jt;    /**< Jump offset if the condition is true */
+	uint8_t jf;    /**< Jump offset if the condition is false */
+	uint32_t k;    /**< Generic constant */
+};
+
+/**
+ * @brief Set the filter selecting the packets to capture.
+ *
+ * The filter is run on the captured network interface before a packet is
+ * copied, so filtered out packets cost no buffers nor tunnel traffic.
+ *
+ * @param dev Network capture device
+ * @param prog Filter program, NULL to capture all the packets.
+ * @param count Number of instructions in the program.
+ *
+ * @return 0 if ok, -EINVAL if the program is not valid, -ENOMEM if it is
+ *         longer than CONFIG_NET_CAPTURE_FILTER_MAX_INSNS, <0 otherwise.
+ */
+#if defined(CONFIG_NET_CAPTURE_FILTER)
+int net_capture_filter_set(const struct device *dev,
+			   const struct net_capture_filter_insn *prog,
+			   size_t count);
+#else
+static inline int net_capture_filter_set(const struct device *dev,
+					 const struct net_capture_filter_insn *prog,
+					 size_t count)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(prog);
+	ARG_UNUSED(count);
+
+	return -ENOTSUP;
+}
+#endif
+
+/**
+ * @brief Set the maximum number of bytes to capture from each packet.
+ *
+ * Only the beginning of longer packets is sent to the peer, as with the
+ * snapshot length of tcpdump.
+ *
+ * @param dev Network capture device
+ * @param snaplen Maximum number of bytes to capture, 0 for no limit.
+ *
+ * @return 0 if ok, <0 if error
+ */
+#if defined(CONFIG_NET_CAPTURE)
+int net_capture_snaplen_set(const struct device *dev, size_t snaplen);
+#else
+static inline int net_capture_snaplen_set(const struct device *dev, size_t snaplen)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(snaplen);
+
+	return -ENOTSUP;
+}
+#endif
+
 /** @cond INTERNAL_HIDDEN */
 
 /**
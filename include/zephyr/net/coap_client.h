@@ -83,6 +83,32 @@ struct coap_client_option {
 };
 
 /** @cond INTERNAL_HIDDEN */
+#if CONFIG_COAP_CLIENT_BLOCK2_WINDOW > 1
+struct coap_client_block2_slot {
+	struct coap_pending pending;
+	uint32_t block_num;
+	uint16_t len;
+	bool requested;
+	bool received;
+	bool last;
+	uint8_t payload[CONFIG_COAP_CLIENT_BLOCK_SIZE];
+};
+
+struct coap_client_block2_window {
+	/* Slot of block n is n % CONFIG_COAP_CLIENT_BLOCK2_WINDOW */
+	struct coap_client_block2_slot slots[CONFIG_COAP_CLIENT_BLOCK2_WINDOW];
+	/* Next block to pass to the callback */
+	uint32_t expected;
+	/* Next block to request */
+	uint32_t next;
+	/* First block known to be past the end of the transfer */
+	uint32_t end;
+	/* Response code of the request past the end, if it ends the transfer */
+	uint8_t end_code;
+	bool active;
+};
+#endif
+
 struct coap_client_internal_request {
 	uint8_t request_token[COAP_TOKEN_MAX_LEN];
 	uint32_t offset;
@@ -100,6 +126,10 @@ struct coap_client_internal_request {
 	/* For GETs with observe option set */
 	bool is_observe;
 	int last_response_id;
+
+#if CONFIG_COAP_CLIENT_BLOCK2_WINDOW > 1
+	struct coap_client_block2_window blk2;
+#endif
 };
 
 struct coap_client {
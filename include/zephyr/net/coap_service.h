@@ -44,6 +44,17 @@ struct coap_service_data {
 	int sock_fd;
 	struct coap_observer observers[CONFIG_COAP_SERVICE_OBSERVERS];
 	struct coap_pending pending[CONFIG_COAP_SERVICE_PENDING_MESSAGES];
+#if defined(CONFIG_COAP_SERVER_RESOURCE_INDEX)
+	/* Range of the service in the resource index, wildcard resources first */
+	uint16_t index_start;
+	uint16_t index_wildcards;
+	uint16_t index_len;
+	/* Observed resource of each observer */
+	uint16_t observer_res[CONFIG_COAP_SERVICE_OBSERVERS];
+	/* Observers hashed by token, as one based observer indexes */
+	uint16_t observer_bucket[CONFIG_COAP_SERVICE_OBSERVERS];
+	uint16_t observer_next[CONFIG_COAP_SERVICE_OBSERVERS];
+#endif
 };
 
 struct coap_service {
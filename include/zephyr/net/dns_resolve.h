@@ -416,6 +416,12 @@ struct dns_resolve_context {
 		 * cannot be used to find correct pending query.
 		 */
 		uint16_t query_hash;
+
+		/** Index + 1 of the query slot that resolves the same name
+		 * and type on behalf of this one. Zero if this query was sent
+		 * to the DNS servers itself.
+		 */
+		uint8_t leader;
 	} queries[DNS_NUM_CONCUR_QUERIES];
 
 	/** Is this context in use */
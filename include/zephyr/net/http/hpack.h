@@ -12,6 +12,7 @@
 #ifndef ZEPHYR_INCLUDE_NET_HTTP_SERVER_HPACK_H_
 #define ZEPHYR_INCLUDE_NET_HTTP_SERVER_HPACK_H_
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -127,6 +128,74 @@ struct http_hpack_header_buf {
 
 /** @cond INTERNAL_HIDDEN */
 
+#if defined(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE)
+
+#define HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE
+/* Every entry accounts for 32 bytes on top of its name and value */
+#define HTTP_SERVER_HPACK_DYNAMIC_TABLE_ENTRIES (HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE / 32)
+
+/** HPACK encoder dynamic table (RFC 7541, ch 2.3.2). */
+struct http_hpack_encoder_table {
+	/** Names and values of the entries, oldest first. */
+	uint8_t data[HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE];
+
+	/** Name lengths of the entries, oldest first. */
+	uint16_t name_len[HTTP_SERVER_HPACK_DYNAMIC_TABLE_ENTRIES];
+
+	/** Value lengths of the entries, oldest first. */
+	uint16_t value_len[HTTP_SERVER_HPACK_DYNAMIC_TABLE_ENTRIES];
+
+	/** Number of entries. */
+	uint8_t count;
+
+	/** Table size, as defined in RFC 7541, ch 4.1. */
+	uint16_t size;
+
+	/** Maximum table size. */
+	uint16_t max_size;
+
+	/** Flag indicating the maximum size is to be signaled to the decoder. */
+	bool size_update;
+};
+
+/**
+ * @brief Initialize an HPACK encoder dynamic table.
+ *
+ * @param table Dynamic table.
+ */
+void http_hpack_encoder_table_init(struct http_hpack_encoder_table *table);
+
+/**
+ * @brief Apply the SETTINGS_HEADER_TABLE_SIZE setting of the decoder.
+ *
+ * The table is limited to the smallest of the setting and its own size,
+ * the new size being signaled at the start of the next header block.
+ *
+ * @param table Dynamic table.
+ * @param max_size Maximum table size of the decoder.
+ */
+void http_hpack_encoder_table_set_max_size(struct http_hpack_encoder_table *table,
+					   uint32_t max_size);
+
+/**
+ * @brief Encode a header field, indexing it in a dynamic table.
+ *
+ * Header fields found in the static or the dynamic table are encoded as
+ * indexed, the others as literals with incremental indexing.
+ *
+ * @param buf Output buffer.
+ * @param buflen Output buffer length.
+ * @param header Header field to encode.
+ * @param table Dynamic table of the connection.
+ *
+ * @return Encoded length on success, a negative error code otherwise.
+ */
+int http_hpack_encode_header_indexed(uint8_t *buf, size_t buflen,
+				     struct http_hpack_header_buf *header,
+				     struct http_hpack_encoder_table *table);
+
+#endif /* CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE */
+
 int http_hpack_huffman_decode(const uint8_t *encoded_buf, size_t encoded_len,
 			      uint8_t *buf, size_t buflen);
 int http_hpack_huffman_encode(const uint8_t *str, size_t str_len,
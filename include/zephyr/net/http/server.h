@@ -68,6 +68,9 @@ enum http_resource_type {
 	 *  after and upgrade.
 	 */
 	HTTP_RESOURCE_TYPE_WEBSOCKET,
+
+	/** Static resource read from a file system, sent in chunks. */
+	HTTP_RESOURCE_TYPE_STATIC_FS,
 };
 
 /**
@@ -115,6 +118,26 @@ struct http_resource_detail_static {
 BUILD_ASSERT(offsetof(struct http_resource_detail_static, common) == 0);
 /** @endcond */
 
+/**
+ * @brief Representation of a static server resource read from a file system.
+ */
+struct http_resource_detail_static_fs {
+	/** Common resource details. */
+	struct http_resource_detail common;
+
+	/** Path of the file on a mounted file system. */
+	const char *fs_path;
+
+	/** Optional path of a gzip compressed variant of the file, served
+	 *  instead with gzip content encoding to clients accepting it.
+	 */
+	const char *fs_gzip_path;
+};
+
+/** @cond INTERNAL_HIDDEN */
+BUILD_ASSERT(offsetof(struct http_resource_detail_static_fs, common) == 0);
+/** @endcond */
+
 struct http_client_ctx;
 
 /** Indicates the status of the currently processed piece of data.  */
@@ -357,6 +380,10 @@ struct http_client_ctx {
 /** @cond INTERNAL_HIDDEN */
 	/** Websocket security key. */
 	IF_ENABLED(CONFIG_WEBSOCKET, (uint8_t ws_sec_key[HTTP_SERVER_WS_MAX_SEC_KEY_LEN]));
+
+	/** HPACK dynamic table of the HTTP/2 responses. */
+	IF_ENABLED(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE,
+		   (struct http_hpack_encoder_table hpack_table;))
 /** @endcond */
 
 	/** Flag indicating that headers were sent in the reply. */
@@ -376,6 +403,12 @@ struct http_client_ctx {
 
 	/** Flag indicating Websocket key is being processed. */
 	bool websocket_sec_key_next : 1;
+
+	/** Flag indicating Accept-Encoding header is being processed. */
+	bool accept_encoding_next : 1;
+
+	/** Flag indicating the client accepts gzip content encoding. */
+	bool accept_gzip : 1;
 };
 
 /** @brief Start the HTTP2 server.
@@ -485,6 +485,11 @@ struct mqtt_internal {
 
 	/** Internal. Remaining payload length to read. */
 	uint32_t remaining_payload;
+
+#if defined(CONFIG_MQTT_PUBLISH_BATCH)
+	/** Internal. Length of the queued packets in the batch buffer. */
+	uint32_t tx_batch_len;
+#endif
 };
 
 /**
@@ -541,6 +546,17 @@ struct mqtt_client {
 	/** Size of transmit buffer. */
 	uint32_t tx_buf_size;
 
+#if defined(CONFIG_MQTT_PUBLISH_BATCH)
+	/** Optional buffer used to queue QoS 0 PUBLISH packets, so that
+	 *  several of them are sent with a single transport write. NULL
+	 *  disables batching.
+	 */
+	uint8_t *tx_batch_buf;
+
+	/** Size of the batch buffer. */
+	uint32_t tx_batch_buf_size;
+#endif
+
 	/** Keepalive interval for this client in seconds.
 	 *  Default is CONFIG_MQTT_KEEPALIVE.
 	 */
@@ -622,11 +638,30 @@ int mqtt_connect(struct mqtt_client *client);
  * @param[in] param Parameters to be used for the publish message.
  *                  Shall not be NULL.
  *
+ * @note The payload is not copied into the transmit buffer, it is handed to
+ *       the transport as a separate I/O vector. If
+ *       @kconfig{CONFIG_MQTT_PUBLISH_BATCH} is enabled and
+ *       mqtt_client::tx_batch_buf is set, QoS 0 messages that fit are queued
+ *       in the batch buffer instead, and sent together with the next packet,
+ *       on @ref mqtt_publish_flush or on @ref mqtt_live.
+ *
  * @return 0 or a negative error code (errno.h) indicating reason of failure.
  */
 int mqtt_publish(struct mqtt_client *client,
 		 const struct mqtt_publish_param *param);
 
+/**
+ * @brief API to send the QoS 0 PUBLISH packets queued in the batch buffer.
+ *
+ * @param[in] client Client instance for which the procedure is requested.
+ *                   Shall not be NULL.
+ *
+ * @note Only available if @kconfig{CONFIG_MQTT_PUBLISH_BATCH} is enabled.
+ *
+ * @return 0 or a negative error code (errno.h) indicating reason of failure.
+ */
+int mqtt_publish_flush(struct mqtt_client *client);
+
 /**
  * @brief API used by client to send acknowledgment on receiving QoS1 publish
  *        message. Should be called on reception of @ref MQTT_EVT_PUBLISH with
@@ -753,6 +788,8 @@ int mqtt_abort(struct mqtt_client *client);
  *        makes it possible to respect the Keep Alive time agreed with the
  *        broker on connection. @ref mqtt_connect for details on Keep Alive
  *        time.
+ * @note  Any QoS 0 PUBLISH packets queued in the batch buffer are sent as
+ *        well.
  *
  * @return 0 or a negative error code (errno.h) indicating reason of failure.
  */
@@ -196,6 +196,8 @@ struct net_tcp;
 
 struct net_conn_handle;
 
+struct net_buf;
+
 /**
  * Note that we do not store the actual source IP address in the context
  * because the address is already be set in the network interface struct.
@@ -392,6 +394,13 @@ __net_socket struct net_context {
 	bool proxy_enabled;
 #endif
 
+#if defined(CONFIG_NET_IPV6_NBR_CONTEXT_CACHE)
+	/** Neighbor cache entry that the last packet was sent to, offset
+	 * by one. Zero if not known.
+	 */
+	uint8_t ipv6_nbr_hint;
+#endif
+
 };
 
 /**
@@ -1181,6 +1190,41 @@ int net_context_sendto(struct net_context *context,
 		       k_timeout_t timeout,
 		       void *user_data);
 
+/**
+ * @brief Send data held in a network buffer chain without copying it.
+ *
+ * @details The chain is attached as is to the outgoing UDP packet after
+ * the protocol headers, so the buffers may point to external data (see
+ * net_buf_alloc_with_data()), e.g. constant data in flash. The packet takes
+ * its own reference to @p buf which is dropped once the network driver has
+ * sent the packet; the destroy callback of the pool the buffers come from
+ * then tells the caller the data is no longer used. The chain must not be
+ * modified before that. The caller keeps its own reference to @p buf.
+ *
+ * Only UDP is supported. TCP rebuilds segments from its send queue when
+ * retransmitting, so it cannot send from the caller's buffers.
+ *
+ * If @p dst_addr is NULL, the data is sent to the connected peer.
+ *
+ * @param context The network context to use.
+ * @param buf The network buffer chain holding the data to send.
+ * @param dst_addr Destination address, or NULL for a connected context.
+ * @param addrlen Length of the address.
+ * @param cb Caller-supplied callback function.
+ * @param timeout Currently this value is not used.
+ * @param user_data Caller-supplied user data.
+ *
+ * @return numbers of bytes sent on success, -EOPNOTSUPP if the context is
+ *         not a UDP one, a negative errno otherwise
+ */
+int net_context_sendto_buf(struct net_context *context,
+			   struct net_buf *buf,
+			   const struct sockaddr *dst_addr,
+			   socklen_t addrlen,
+			   net_context_send_cb_t cb,
+			   k_timeout_t timeout,
+			   void *user_data);
+
 /**
  * @brief Send data in iovec to a peer specified in msghdr struct.
  *
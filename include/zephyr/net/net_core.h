@@ -120,6 +120,26 @@ enum net_verdict {
  */
 int net_recv_data(struct net_if *iface, struct net_pkt *pkt);
 
+/**
+ * @brief Called by a network device driver to pass a batch of received
+ * network packets to the network stack at once.
+ *
+ * Drivers polling their receive ring collect the harvested packets with
+ * net_pkt_list_append() and hand them over in one call. Packets of the same
+ * traffic class are queued to its RX thread with a single queue operation,
+ * which saves the locking and wakeup done per packet by net_recv_data().
+ * CONFIG_NET_RX_BATCH_BUDGET is the suggested maximum batch size.
+ *
+ * All packets are consumed, the ones that cannot be accepted are freed.
+ *
+ * @param iface Network interface where the packets were received, or NULL
+ *        to use the interface already set in each packet.
+ * @param pkts List of network packets, empty on return.
+ *
+ * @return Number of packets passed up the stack, <0 if error.
+ */
+int net_recv_data_batch(struct net_if *iface, sys_slist_t *pkts);
+
 /**
  * @brief Send data to network.
  *
@@ -45,6 +45,11 @@ enum net_l2_flags {
 	 * IP address etc to network interface.
 	 */
 	NET_L2_POINT_TO_POINT			= BIT(3),
+
+	/** L2 segments TCP packets larger than the MTU (GSO), either in
+	 * software or by handing them to a TSO capable device.
+	 */
+	NET_L2_TCP_GSO				= BIT(4),
 } __packed;
 
 /**
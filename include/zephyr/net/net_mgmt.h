@@ -162,9 +162,10 @@ struct net_mgmt_event_callback {
 #endif
 
 	/** A mask of network events on which the above handler should be
-	 * called in case those events come. Such mask can be modified
-	 * whenever necessary by the owner, and thus will affect the handler
-	 * being called or not.
+	 * called in case those events come. The command part of such mask
+	 * can be modified whenever necessary by the owner, and thus will
+	 * affect the handler being called or not. The callback must be added
+	 * again when its layer or layer code is changed.
 	 */
 	union {
 		/** A mask of network events on which the above handler should
@@ -262,6 +263,28 @@ void net_mgmt_add_event_callback(struct net_mgmt_event_callback *cb);
 #define net_mgmt_add_event_callback(...)
 #endif
 
+/**
+ * @brief Add a user callback run when the event is notified
+ *
+ * Unlike the callbacks added with net_mgmt_add_event_callback(), the
+ * handler is called by the notifier of the event, before the event is
+ * queued, so it is neither delayed by the event queue nor lost when the
+ * queue is full. The handler must be short and must not block, as it runs
+ * in the context of the network stack. If CONFIG_NET_MGMT_EVENT_INFO is
+ * enabled, the info of the event is not copied, so it is only valid during
+ * the call. This is the same as net_mgmt_add_event_callback() if
+ * CONFIG_NET_MGMT_EVENT_DIRECT is enabled.
+ *
+ * The callback is removed with net_mgmt_del_event_callback().
+ *
+ * @param cb A valid pointer on user's callback to add.
+ */
+#ifdef CONFIG_NET_MGMT_EVENT
+void net_mgmt_add_event_callback_direct(struct net_mgmt_event_callback *cb);
+#else
+#define net_mgmt_add_event_callback_direct(...)
+#endif
+
 /**
  * @brief Delete a user callback
  * @param cb A valid pointer on user's callback to delete.
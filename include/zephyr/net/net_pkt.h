@@ -198,6 +198,14 @@ struct net_pkt {
 #if defined(CONFIG_NET_IP_FRAGMENT)
 	uint8_t ip_reassembled : 1; /* Packet is a reassembled IP packet. */
 #endif
+#if defined(CONFIG_NET_GRO)
+	uint8_t gro : 1; /* Coalesced TCP segments, checksums already verified */
+#endif
+#if defined(CONFIG_NET_UDP_CHECKSUM_COPY)
+	uint8_t payload_chksum_set : 1; /* payload_chksum holds the sum of the
+					 * UDP payload.
+					 */
+#endif
 #if defined(CONFIG_NET_PKT_TIMESTAMP)
 	uint8_t tx_timestamping : 1; /** Timestamp transmitted packet */
 	uint8_t rx_timestamping : 1; /** Timestamp received packet */
@@ -292,6 +300,20 @@ struct net_pkt {
 	 */
 	uint8_t priority;
 
+#if defined(CONFIG_NET_TCP_GSO)
+	/* Payload size of the segments a TCP super packet is split into
+	 * before it goes on the wire, zero if the packet is a normal one.
+	 */
+	uint16_t gso_size;
+#endif /* CONFIG_NET_TCP_GSO */
+
+#if defined(CONFIG_NET_UDP_CHECKSUM_COPY)
+	/* One's complement sum of the UDP payload, computed while the payload
+	 * was copied into the packet.
+	 */
+	uint16_t payload_chksum;
+#endif /* CONFIG_NET_UDP_CHECKSUM_COPY */
+
 #if defined(CONFIG_NET_OFFLOAD) || defined(CONFIG_NET_L2_IPIP)
 	/* Remote address of the recived packet. This is only used by
 	 * network interfaces with an offloaded TCP/IP stack, or if we
@@ -324,6 +346,26 @@ static inline struct net_linkaddr *net_pkt_lladdr_if(struct net_pkt *pkt)
 	return net_if_get_link_addr(pkt->iface);
 }
 
+/* Packets are chained through their fifo field when passed around in a
+ * sys_slist_t, for example to net_recv_data_batch().
+ */
+static inline struct net_pkt *net_pkt_list_node_to_pkt(sys_snode_t *node)
+{
+	return CONTAINER_OF((intptr_t *)node, struct net_pkt, fifo);
+}
+
+static inline void net_pkt_list_append(sys_slist_t *list, struct net_pkt *pkt)
+{
+	sys_slist_append(list, (sys_snode_t *)&pkt->fifo);
+}
+
+static inline struct net_pkt *net_pkt_list_get(sys_slist_t *list)
+{
+	sys_snode_t *node = sys_slist_get(list);
+
+	return node != NULL ? net_pkt_list_node_to_pkt(node) : NULL;
+}
+
 static inline struct net_context *net_pkt_context(struct net_pkt *pkt)
 {
 	return pkt->context;
@@ -929,6 +971,94 @@ static inline void net_pkt_set_ip_reassembled(struct net_pkt *pkt,
 }
 #endif /* CONFIG_NET_IP_FRAGMENT */
 
+#if defined(CONFIG_NET_GRO)
+static inline bool net_pkt_is_gro(struct net_pkt *pkt)
+{
+	return !!(pkt->gro);
+}
+
+static inline void net_pkt_set_gro(struct net_pkt *pkt, bool is_gro)
+{
+	pkt->gro = is_gro;
+}
+#else /* CONFIG_NET_GRO */
+static inline bool net_pkt_is_gro(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return false;
+}
+
+static inline void net_pkt_set_gro(struct net_pkt *pkt, bool is_gro)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(is_gro);
+}
+#endif /* CONFIG_NET_GRO */
+
+#if defined(CONFIG_NET_TCP_GSO)
+static inline uint16_t net_pkt_gso_size(struct net_pkt *pkt)
+{
+	return pkt->gso_size;
+}
+
+static inline void net_pkt_set_gso_size(struct net_pkt *pkt, uint16_t gso_size)
+{
+	pkt->gso_size = gso_size;
+}
+#else /* CONFIG_NET_TCP_GSO */
+static inline uint16_t net_pkt_gso_size(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return 0U;
+}
+
+static inline void net_pkt_set_gso_size(struct net_pkt *pkt, uint16_t gso_size)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(gso_size);
+}
+#endif /* CONFIG_NET_TCP_GSO */
+
+#if defined(CONFIG_NET_UDP_CHECKSUM_COPY)
+static inline bool net_pkt_has_payload_chksum(struct net_pkt *pkt)
+{
+	return !!(pkt->payload_chksum_set);
+}
+
+static inline uint16_t net_pkt_payload_chksum(struct net_pkt *pkt)
+{
+	return pkt->payload_chksum;
+}
+
+static inline void net_pkt_set_payload_chksum(struct net_pkt *pkt, uint16_t sum)
+{
+	pkt->payload_chksum = sum;
+	pkt->payload_chksum_set = 1;
+}
+#else /* CONFIG_NET_UDP_CHECKSUM_COPY */
+static inline bool net_pkt_has_payload_chksum(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return false;
+}
+
+static inline uint16_t net_pkt_payload_chksum(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return 0U;
+}
+
+static inline void net_pkt_set_payload_chksum(struct net_pkt *pkt, uint16_t sum)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(sum);
+}
+#endif /* CONFIG_NET_UDP_CHECKSUM_COPY */
+
 static inline uint8_t net_pkt_priority(struct net_pkt *pkt)
 {
 	return pkt->priority;
@@ -2418,6 +2548,22 @@ size_t net_pkt_remaining_data(struct net_pkt *pkt);
  */
 int net_pkt_update_length(struct net_pkt *pkt, size_t length);
 
+/**
+ * @brief Move the start of a packet into its first fragment
+ *
+ * @details Data is moved from the following fragments into the tailroom of
+ *          the first one, until it holds the first @p length bytes of the
+ *          packet, or the whole packet if it is shorter. Headers found in
+ *          these bytes can then be accessed without being copied.
+ *          Note that net_pkt's cursor is reset by this function.
+ *
+ * @param pkt    Network packet
+ * @param length Number of bytes wanted in the first fragment
+ *
+ * @return 0 on success, -ENOBUFS if the first fragment is too small.
+ */
+int net_pkt_pull_up(struct net_pkt *pkt, size_t length);
+
 /**
  * @brief Remove data from the packet at current location
  *
@@ -2499,6 +2645,39 @@ struct net_pkt_data_access {
 
 #endif /* CONFIG_NET_HEADERS_ALWAYS_CONTIGUOUS */
 
+void *net_pkt_get_data_slow(struct net_pkt *pkt,
+			    struct net_pkt_data_access *access);
+int net_pkt_set_data_slow(struct net_pkt *pkt,
+			  struct net_pkt_data_access *access);
+
+/* True if size bytes from the cursor lie within its current fragment, and
+ * moving past them keeps the cursor in that fragment. The cursor machinery
+ * of net_pkt.c can then be skipped.
+ */
+static inline bool net_pkt_cursor_fits(struct net_pkt *pkt, size_t size)
+{
+	struct net_pkt_cursor *cursor = &pkt->cursor;
+	size_t len;
+
+	if (cursor->buf == NULL || cursor->pos == NULL) {
+		return false;
+	}
+
+	len = pkt->overwrite ? cursor->buf->len : net_buf_max_len(cursor->buf);
+
+	return (size_t)(cursor->pos - cursor->buf->data) + size < len;
+}
+
+/* Same as net_pkt_skip() when net_pkt_cursor_fits() is true */
+static inline void net_pkt_cursor_skip_fast(struct net_pkt *pkt, size_t size)
+{
+	if (!pkt->overwrite) {
+		net_buf_add(pkt->cursor.buf, size);
+	}
+
+	pkt->cursor.pos += size;
+}
+
 /** @endcond */
 
 /**
@@ -2514,8 +2693,18 @@ struct net_pkt_data_access {
  *
  * @return a pointer to the requested contiguous data, NULL otherwise.
  */
-void *net_pkt_get_data(struct net_pkt *pkt,
-		       struct net_pkt_data_access *access);
+static inline void *net_pkt_get_data(struct net_pkt *pkt,
+				     struct net_pkt_data_access *access)
+{
+	if (net_pkt_cursor_fits(pkt, access->size)) {
+#if !defined(CONFIG_NET_HEADERS_ALWAYS_CONTIGUOUS)
+		access->data = pkt->cursor.pos;
+#endif
+		return pkt->cursor.pos;
+	}
+
+	return net_pkt_get_data_slow(pkt, access);
+}
 
 /**
  * @brief Set contiguous data into a network packet
@@ -2530,8 +2719,21 @@ void *net_pkt_get_data(struct net_pkt *pkt,
  *
  * @return 0 on success, a negative errno otherwise.
  */
-int net_pkt_set_data(struct net_pkt *pkt,
-		     struct net_pkt_data_access *access);
+static inline int net_pkt_set_data(struct net_pkt *pkt,
+				   struct net_pkt_data_access *access)
+{
+#if !defined(CONFIG_NET_HEADERS_ALWAYS_CONTIGUOUS)
+	if (access->data == pkt->cursor.pos &&
+	    net_pkt_cursor_fits(pkt, access->size)) {
+#else
+	if (net_pkt_cursor_fits(pkt, access->size)) {
+#endif
+		net_pkt_cursor_skip_fast(pkt, access->size);
+		return 0;
+	}
+
+	return net_pkt_set_data_slow(pkt, access);
+}
 
 /**
  * Acknowledge previously contiguous data taken from a network packet
@@ -2540,6 +2742,11 @@ int net_pkt_set_data(struct net_pkt *pkt,
 static inline int net_pkt_acknowledge_data(struct net_pkt *pkt,
 					   struct net_pkt_data_access *access)
 {
+	if (net_pkt_cursor_fits(pkt, access->size)) {
+		net_pkt_cursor_skip_fast(pkt, access->size);
+		return 0;
+	}
+
 	return net_pkt_skip(pkt, access->size);
 }
 
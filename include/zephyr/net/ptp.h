@@ -32,6 +32,53 @@ extern "C" {
 
 #define PTP_VERSION (PTP_MINOR_VERSION << 4 | PTP_MAJOR_VERSION) /**< PTP version IEEE-1588:2019 */
 
+/**
+ * @brief Statistics of the synchronization to the timeTransmitter.
+ *
+ * Offsets and delays are in nanoseconds. The minimum and maximum values
+ * are only meaningful when the matching number of samples is not 0.
+ */
+struct ptp_stats {
+	/** Number of offsets measured */
+	uint32_t offset_count;
+	/** Last offset from the timeTransmitter */
+	int64_t offset_last;
+	/** Smallest offset from the timeTransmitter */
+	int64_t offset_min;
+	/** Largest offset from the timeTransmitter */
+	int64_t offset_max;
+	/** Mean of the absolute offsets from the timeTransmitter */
+	uint64_t offset_abs_mean;
+	/** Number of mean path delays measured */
+	uint32_t delay_count;
+	/** Last mean path delay */
+	int64_t delay_last;
+	/** Smallest mean path delay */
+	int64_t delay_min;
+	/** Largest mean path delay */
+	int64_t delay_max;
+	/** Frequency correction applied by the PI servo, in parts per billion */
+	int32_t freq_ppb;
+	/** Number of times the clock was stepped to the timeTransmitter time */
+	uint32_t step_count;
+};
+
+/**
+ * @brief Get the statistics of the synchronization to the timeTransmitter.
+ *
+ * @note Requires CONFIG_PTP_STATS.
+ *
+ * @param stats Filled with the statistics gathered since the last reset.
+ */
+void ptp_stats_get(struct ptp_stats *stats);
+
+/**
+ * @brief Reset the statistics of the synchronization to the timeTransmitter.
+ *
+ * @note Requires CONFIG_PTP_STATS.
+ */
+void ptp_stats_reset(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -184,6 +184,8 @@ extern "C" {
 /** Socket option to control TLS session caching on a socket. Accepted values:
  *  - 0 - Disabled.
  *  - 1 - Enabled.
+ *  When enabled on a server socket and CONFIG_MBEDTLS_SSL_TICKET_C is
+ *  enabled, the server also issues session tickets to clients.
  */
 #define TLS_SESSION_CACHE 12
 /** Write-only socket option to purge session cache immediately.
@@ -540,6 +542,81 @@ static inline ssize_t zsock_recv(int sock, void *buf, size_t max_len,
 	return zsock_recvfrom(sock, buf, max_len, flags, NULL, NULL);
 }
 
+struct net_buf;
+
+/**
+ * @brief Receive data without copying it
+ *
+ * @details
+ * Instead of copying received data to a caller supplied buffer, hand over
+ * the network buffers holding it. For a datagram socket one whole datagram
+ * is returned, for a stream socket the data of one received segment. The
+ * returned fragment chain starts with the first payload byte and must be
+ * given back with zsock_recv_buf_release() once the caller is done with it.
+ * Until then the buffers count against the network RX buffer pools, so
+ * they should not be held for long.
+ *
+ * Only native (non-offloaded, non-TLS) sockets are supported, and the
+ * function can only be called from supervisor mode. @c ZSOCK_MSG_DONTWAIT
+ * is honored, @c ZSOCK_MSG_PEEK is not supported.
+ *
+ * @param sock Socket file descriptor
+ * @param buf Set to the first fragment holding received data, or NULL
+ *            on end of stream.
+ * @param flags Receive flags
+ * @param src_addr Source address of a datagram, or NULL
+ * @param addrlen Length of @p src_addr, updated on return, or NULL
+ *
+ * @return Number of bytes in the returned fragment chain, 0 on end of
+ *         stream, -1 with errno set on error.
+ */
+ssize_t zsock_recv_buf(int sock, struct net_buf **buf, int flags,
+		       struct sockaddr *src_addr, socklen_t *addrlen);
+
+/**
+ * @brief Release network buffers obtained with zsock_recv_buf()
+ *
+ * @param buf Fragment chain returned by zsock_recv_buf(), may be NULL.
+ */
+void zsock_recv_buf_release(struct net_buf *buf);
+
+/**
+ * @brief Send data held in a network buffer chain without copying it
+ *
+ * @details
+ * The fragments of @p buf become the payload of the outgoing datagram, so
+ * they may reference caller owned memory such as constant data in flash
+ * (see net_buf_alloc_with_data()). The stack holds a reference to @p buf
+ * until the network driver has sent the packet; use the destroy callback
+ * of the buffer pool to learn when the data is no longer in use, and do
+ * not modify the chain before that.
+ *
+ * The caller always keeps its own reference to @p buf and must release it
+ * with net_buf_unref(). Only native (non-offloaded, non-TLS) UDP sockets
+ * are supported, other sockets fail with errno set to EOPNOTSUPP. The
+ * function can only be called from supervisor mode.
+ *
+ * @param sock Socket file descriptor
+ * @param buf Network buffer chain to send
+ * @param flags Send flags
+ * @param dest_addr Destination address, or NULL for a connected socket
+ * @param addrlen Length of @p dest_addr
+ *
+ * @return Number of bytes sent, -1 with errno set on error.
+ */
+ssize_t zsock_sendto_buf(int sock, struct net_buf *buf, int flags,
+			 const struct sockaddr *dest_addr, socklen_t addrlen);
+
+/**
+ * @brief Send a network buffer chain to a connected peer without copying it
+ *
+ * @details See zsock_sendto_buf().
+ */
+static inline ssize_t zsock_send_buf(int sock, struct net_buf *buf, int flags)
+{
+	return zsock_sendto_buf(sock, buf, flags, NULL, 0);
+}
+
 /**
  * @brief Control blocking/non-blocking mode of a socket
  *
@@ -1210,6 +1287,8 @@ struct ifreq {
 #define TCP_KEEPINTVL 3
 /** Number of keepalives before dropping connection */
 #define TCP_KEEPCNT 4
+/** Congestion control algorithm, as a name string such as "cubic" */
+#define TCP_CONGESTION 5
 
 /** @} */
 
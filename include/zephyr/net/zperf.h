@@ -55,6 +55,9 @@ struct zperf_download_params {
 
 /** @endcond */
 
+/** Number of buckets of the send latency histogram */
+#define ZPERF_SEND_LATENCY_BUCKETS 16
+
 /** Performance results */
 struct zperf_results {
 	uint32_t nb_packets_sent;     /**< Number of packets sent */
@@ -67,8 +70,32 @@ struct zperf_results {
 	uint64_t client_time_in_us;   /**< Client connection time in microseconds */
 	uint32_t packet_size;         /**< Packet size */
 	uint32_t nb_packets_errors;   /**< Number of packet errors */
+	/** Cycles used by the uploading thread, 0 without CONFIG_THREAD_RUNTIME_STATS */
+	uint64_t cpu_cycles;
+#if defined(CONFIG_NET_ZPERF_SEND_LATENCY) || defined(__DOXYGEN__)
+	/**
+	 * Histogram of the send call durations of an upload. Bucket 0 counts
+	 * the calls of less than a microsecond, bucket n the calls of 2^(n-1)
+	 * to 2^n microseconds, and the last bucket the longer calls.
+	 */
+	uint32_t send_latency[ZPERF_SEND_LATENCY_BUCKETS];
+#endif
 };
 
+/**
+ * @brief Get a percentile of the send call durations of an upload.
+ *
+ * @note Requires CONFIG_NET_ZPERF_SEND_LATENCY.
+ *
+ * @param result Upload results.
+ * @param percent Percentile, from 0 to 100.
+ *
+ * @return Upper bound of the percentile in microseconds, UINT32_MAX if it
+ *         falls in the last bucket, or 0 if no send call was measured.
+ */
+uint32_t zperf_send_latency_percentile(const struct zperf_results *result,
+				       unsigned int percent);
+
 /**
  * @brief Zperf callback function used for asynchronous operations.
  *
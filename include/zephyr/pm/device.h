@@ -147,6 +147,12 @@ struct pm_device_base {
 	/** Device usage count */
 	uint32_t usage;
 #endif /* CONFIG_PM_DEVICE_RUNTIME */
+#if defined(CONFIG_PM_DEVICE_RUNTIME_RESUME_LATENCY) || defined(__DOXYGEN__)
+	/** Duration of the last runtime resume, in cycles */
+	uint32_t resume_cyc_last;
+	/** Longest runtime resume, in cycles */
+	uint32_t resume_cyc_max;
+#endif /* CONFIG_PM_DEVICE_RUNTIME_RESUME_LATENCY */
 #ifdef CONFIG_PM_DEVICE_POWER_DOMAIN
 	/** Power Domain it belongs */
 	const struct device *domain;
@@ -170,8 +176,15 @@ struct pm_device {
 	struct k_sem lock;
 	/** Event var to listen to the sync request events */
 	struct k_event event;
+#if defined(CONFIG_PM_DEVICE_RUNTIME_ASYNC_BATCH) || defined(__DOXYGEN__)
+	/** Node in the list of pending asynchronous suspends */
+	sys_snode_t batch_node;
+	/** When the pending asynchronous suspend is due */
+	k_timepoint_t batch_due;
+#else
 	/** Work object for asynchronous calls */
 	struct k_work_delayable work;
+#endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC_BATCH */
 #endif /* CONFIG_PM_DEVICE_RUNTIME */
 };
 
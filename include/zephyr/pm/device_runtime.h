@@ -169,6 +169,26 @@ bool pm_device_runtime_is_enabled(const struct device *dev);
  */
 int pm_device_runtime_usage(const struct device *dev);
 
+#if defined(CONFIG_PM_DEVICE_RUNTIME_RESUME_LATENCY) || defined(__DOXYGEN__)
+/**
+ * @brief Get the resume latency of a device.
+ *
+ * The latency is the duration of the device PM resume action run by
+ * pm_device_runtime_get(), not including the resume of its power domain.
+ *
+ * @kconfig_dep{CONFIG_PM_DEVICE_RUNTIME_RESUME_LATENCY}
+ *
+ * @param dev Device instance.
+ * @param last Set to the duration of the last resume, in cycles.
+ * @param max Set to the duration of the longest resume, in cycles.
+ *
+ * @retval 0 If successful.
+ * @retval -ENOTSUP If the device is not using runtime PM.
+ */
+int pm_device_runtime_resume_latency_get(const struct device *dev, uint32_t *last,
+					 uint32_t *max);
+#endif /* CONFIG_PM_DEVICE_RUNTIME_RESUME_LATENCY */
+
 #else
 
 static inline int pm_device_runtime_auto_enable(const struct device *dev)
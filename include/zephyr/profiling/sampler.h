@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_PROFILING_SAMPLER_H_
+#define ZEPHYR_INCLUDE_PROFILING_SAMPLER_H_
+
+#include <stdint.h>
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Sampling profiler
+ * @defgroup profiling_sampler Sampling profiler
+ * @ingroup os_services
+ * @{
+ */
+
+/** @brief Number of samples taken at one location of one thread. */
+struct profiling_sample {
+	/** Interrupted program counter, 0 if not known. */
+	uintptr_t pc;
+	/** Thread running at the time of the samples. */
+	const struct k_thread *thread;
+	/** Number of samples. */
+	uint32_t count;
+};
+
+/**
+ * @brief Callback for @ref profiling_sampler_foreach
+ *
+ * @param sample Histogram entry.
+ * @param cpu CPU the samples were taken on.
+ * @param user_data User data.
+ */
+typedef void (*profiling_sampler_cb_t)(const struct profiling_sample *sample,
+				       unsigned int cpu, void *user_data);
+
+/**
+ * @brief Start taking samples.
+ *
+ * Samples are taken from a kernel timer. Each sample records the thread
+ * running on every CPU and, where the architecture supports it, the
+ * program counter interrupted on the CPU handling the timer. Samples are
+ * accumulated in a histogram per CPU.
+ *
+ * @param freq_hz Sampling frequency.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the frequency is 0 or above the tick rate.
+ * @retval -EALREADY if the sampler is already running.
+ */
+int profiling_sampler_start(uint32_t freq_hz);
+
+/**
+ * @brief Stop taking samples.
+ */
+void profiling_sampler_stop(void);
+
+/**
+ * @brief Clear the histograms.
+ */
+void profiling_sampler_reset(void);
+
+/**
+ * @brief Iterate over the histogram entries of all CPUs.
+ *
+ * Results are only consistent once the sampler is stopped.
+ *
+ * @param cb Callback called for each entry.
+ * @param user_data User data passed to @p cb.
+ *
+ * @return Number of samples lost because a histogram was full.
+ */
+uint32_t profiling_sampler_foreach(profiling_sampler_cb_t cb, void *user_data);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_PROFILING_SAMPLER_H_ */
@@ -280,6 +280,16 @@ struct rtio_sqe {
 
 		/** OP_I2C_CONFIGURE */
 		uint32_t i2c_config;
+
+		/** OP_DISK_READ, OP_DISK_WRITE */
+		struct {
+			uint32_t disk_num_sectors; /**< Number of sectors */
+			uint8_t *disk_buf; /**< Sector buffer */
+			uint32_t disk_start_sector; /**< First sector */
+		};
+
+		/** OP_SEM_GIVE */
+		struct k_sem *sem; /**< Semaphore to give */
 	};
 };
 
@@ -342,6 +352,27 @@ struct rtio {
 	struct k_sem *consume_sem;
 #endif
 
+#ifdef CONFIG_RTIO_CONSUME_SEM_COALESCE
+	/* Number of completions to produce before signaling the consumer */
+	uint16_t cq_notify_count;
+
+	/* Time rtio_cqe_consume_block() polls the completion queue before
+	 * waiting on the semaphore, in microseconds
+	 */
+	uint16_t cq_poll_us;
+
+	/* Longest time a completion waits for the consumer to be signaled,
+	 * in microseconds, 0 to wait for cq_notify_count completions
+	 */
+	uint32_t cq_notify_us;
+
+	/* Completions produced since the consumer was last signaled */
+	atomic_t cq_pending;
+
+	/* Signals the consumer once cq_notify_us have elapsed */
+	struct k_timer cq_notify_timer;
+#endif
+
 	/* Total number of completions */
 	atomic_t cq_count;
 
@@ -477,6 +508,15 @@ struct rtio_iodev {
 /** An operation to configure I2C buses */
 #define RTIO_OP_I2C_CONFIGURE (RTIO_OP_I2C_RECOVER+1)
 
+/** An operation to read sectors from a disk */
+#define RTIO_OP_DISK_READ (RTIO_OP_I2C_CONFIGURE+1)
+
+/** An operation to write sectors to a disk */
+#define RTIO_OP_DISK_WRITE (RTIO_OP_DISK_READ+1)
+
+/** An operation that gives a semaphore */
+#define RTIO_OP_SEM_GIVE (RTIO_OP_DISK_WRITE+1)
+
 /**
  * @brief Prepare a nop (no op) submission
  */
@@ -599,6 +639,25 @@ static inline void rtio_sqe_prep_callback(struct rtio_sqe *sqe,
 	sqe->userdata = userdata;
 }
 
+/**
+ * @brief Prepare a semaphore give op submission
+ *
+ * Unlike a callback this may be submitted from user mode, given access to the
+ * semaphore, letting a batch of submissions signal other threads without a
+ * system call of their own.
+ */
+static inline void rtio_sqe_prep_sem_give(struct rtio_sqe *sqe,
+					  struct k_sem *sem,
+					  void *userdata)
+{
+	memset(sqe, 0, sizeof(struct rtio_sqe));
+	sqe->op = RTIO_OP_SEM_GIVE;
+	sqe->prio = 0;
+	sqe->iodev = NULL;
+	sqe->sem = sem;
+	sqe->userdata = userdata;
+}
+
 /**
  * @brief Prepare a transceive op submission
  */
@@ -779,15 +838,24 @@ static inline void rtio_block_pool_free(struct rtio *r, void *buf, uint32_t buf_
 	_SYS_MEM_BLOCKS_DEFINE_WITH_EXT_BUF(name, WB_UP(blk_sz), blk_cnt,                          \
 					    CONCAT(_block_pool_, name),	RTIO_DMEM)
 
+/* With coalescing the consume semaphore only wakes up the consumer, it does not count completions */
+#ifdef CONFIG_RTIO_CONSUME_SEM_COALESCE
+#define Z_RTIO_CONSUME_SEM_LIMIT 1
+#else
+#define Z_RTIO_CONSUME_SEM_LIMIT K_SEM_MAX_LIMIT
+#endif
+
 #define Z_RTIO_DEFINE(name, _sqe_pool, _cqe_pool, _block_pool)                                     \
 	IF_ENABLED(CONFIG_RTIO_SUBMIT_SEM,                                                         \
 		   (static K_SEM_DEFINE(CONCAT(_submit_sem_, name), 0, K_SEM_MAX_LIMIT)))          \
 	IF_ENABLED(CONFIG_RTIO_CONSUME_SEM,                                                        \
-		   (static K_SEM_DEFINE(CONCAT(_consume_sem_, name), 0, K_SEM_MAX_LIMIT)))         \
+		   (static K_SEM_DEFINE(CONCAT(_consume_sem_, name), 0, Z_RTIO_CONSUME_SEM_LIMIT))) \
 	STRUCT_SECTION_ITERABLE(rtio, name) = {                                                    \
 		IF_ENABLED(CONFIG_RTIO_SUBMIT_SEM, (.submit_sem = &CONCAT(_submit_sem_, name),))   \
 		IF_ENABLED(CONFIG_RTIO_SUBMIT_SEM, (.submit_count = 0,))                           \
 		IF_ENABLED(CONFIG_RTIO_CONSUME_SEM, (.consume_sem = &CONCAT(_consume_sem_, name),))\
+		IF_ENABLED(CONFIG_RTIO_CONSUME_SEM_COALESCE, (.cq_notify_count = 1,))              \
+		IF_ENABLED(CONFIG_RTIO_CONSUME_SEM_COALESCE, (.cq_pending = ATOMIC_INIT(0),))      \
 		.cq_count = ATOMIC_INIT(0),                                                        \
 		.xcqcnt = ATOMIC_INIT(0),                                                          \
 		.sqe_pool = _sqe_pool,                                                             \
@@ -968,7 +1036,7 @@ static inline struct rtio_cqe *rtio_cqe_consume(struct rtio *r)
 	struct mpsc_node *node;
 	struct rtio_cqe *cqe = NULL;
 
-#ifdef CONFIG_RTIO_CONSUME_SEM
+#if defined(CONFIG_RTIO_CONSUME_SEM) && !defined(CONFIG_RTIO_CONSUME_SEM_COALESCE)
 	if (k_sem_take(r->consume_sem, K_NO_WAIT) != 0) {
 		return NULL;
 	}
@@ -998,6 +1066,23 @@ static inline struct rtio_cqe *rtio_cqe_consume_block(struct rtio *r)
 	struct mpsc_node *node;
 	struct rtio_cqe *cqe;
 
+#ifdef CONFIG_RTIO_CONSUME_SEM_COALESCE
+	/* Only sleep when the consumer does not keep up with the completions */
+	node = mpsc_pop(&r->cq);
+	if ((node == NULL) && (r->cq_poll_us > 0)) {
+		uint32_t start = k_cycle_get_32();
+
+		do {
+			Z_SPIN_DELAY(1);
+			node = mpsc_pop(&r->cq);
+		} while ((node == NULL) &&
+			 (k_cyc_to_us_floor32(k_cycle_get_32() - start) < r->cq_poll_us));
+	}
+	while (node == NULL) {
+		k_sem_take(r->consume_sem, K_FOREVER);
+		node = mpsc_pop(&r->cq);
+	}
+#else
 #ifdef CONFIG_RTIO_CONSUME_SEM
 	k_sem_take(r->consume_sem, K_FOREVER);
 #endif
@@ -1006,6 +1091,7 @@ static inline struct rtio_cqe *rtio_cqe_consume_block(struct rtio *r)
 		Z_SPIN_DELAY(1);
 		node = mpsc_pop(&r->cq);
 	}
+#endif /* CONFIG_RTIO_CONSUME_SEM_COALESCE */
 	cqe = CONTAINER_OF(node, struct rtio_cqe, q);
 
 	return cqe;
@@ -1124,6 +1210,57 @@ static inline void rtio_iodev_sqe_err(struct rtio_iodev_sqe *iodev_sqe, int resu
 	rtio_executor_err(iodev_sqe, result);
 }
 
+#ifdef CONFIG_RTIO_CONSUME_SEM_COALESCE
+/**
+ * @brief Set how often the consumer of a context is signaled
+ *
+ * The consumer waiting in rtio_cqe_consume_block() is signaled once every
+ * @p count completions, or once @p timeout_us microseconds have elapsed
+ * since the first completion it was not signaled for, whichever comes first.
+ * With a @p timeout_us of 0, the consumer waits for @p count completions,
+ * which must then be known to come.
+ *
+ * Must not be called while completions are being produced.
+ *
+ * @param r RTIO context
+ * @param count Number of completions per signal, 1 to signal each of them
+ * @param timeout_us Longest delay of a signal in microseconds, 0 for none
+ */
+static inline void rtio_cqe_notify_set(struct rtio *r, uint16_t count, uint32_t timeout_us)
+{
+	r->cq_notify_count = MAX(count, 1);
+	r->cq_notify_us = timeout_us;
+}
+
+/**
+ * @brief Set how long the consumer of a context polls for completions
+ *
+ * rtio_cqe_consume_block() polls the completion queue for up to
+ * @p poll_us microseconds before waiting for a signal, so that a consumer
+ * keeping up with the completions never sleeps.
+ *
+ * @param r RTIO context
+ * @param poll_us Polling time in microseconds, 0 to wait right away
+ */
+static inline void rtio_cqe_poll_set(struct rtio *r, uint16_t poll_us)
+{
+	r->cq_poll_us = poll_us;
+}
+
+/* Signal the consumer according to the notification settings of the context */
+static inline void z_rtio_cqe_notify(struct rtio *r)
+{
+	atomic_val_t pending = atomic_inc(&r->cq_pending) + 1;
+
+	if (pending >= r->cq_notify_count) {
+		atomic_set(&r->cq_pending, 0);
+		k_sem_give(r->consume_sem);
+	} else if ((pending == 1) && (r->cq_notify_us > 0)) {
+		k_timer_start(&r->cq_notify_timer, K_USEC(r->cq_notify_us), K_NO_WAIT);
+	}
+}
+#endif /* CONFIG_RTIO_CONSUME_SEM_COALESCE */
+
 /**
  * Submit a completion queue event with a given result and userdata
  *
@@ -1157,7 +1294,9 @@ static inline void rtio_cqe_submit(struct rtio *r, int result, void *userdata, u
 		}
 	}
 #endif
-#ifdef CONFIG_RTIO_CONSUME_SEM
+#ifdef CONFIG_RTIO_CONSUME_SEM_COALESCE
+	z_rtio_cqe_notify(r);
+#elif defined(CONFIG_RTIO_CONSUME_SEM)
 	k_sem_give(r->consume_sem);
 #endif
 }
@@ -1455,6 +1594,37 @@ static inline int z_impl_rtio_submit(struct rtio *r, uint32_t wait_count)
 	return res;
 }
 
+/**
+ * @brief Copy an array of SQEs into the queue and submit them
+ *
+ * Does the work of rtio_sqe_copy_in() followed by rtio_submit() with a single
+ * system call when called from user mode, and validates each iodev or kernel
+ * object referenced by consecutive SQEs only once.
+ *
+ * @param r RTIO context
+ * @param sqes Pointer to an array of SQEs
+ * @param sqe_count Count of sqes in array
+ * @param wait_count Number of submissions to wait for completion of.
+ *
+ * @retval 0 On success
+ * @retval -ENOMEM not enough room in the queue, nothing was submitted
+ */
+__syscall int rtio_sqe_copy_in_submit(struct rtio *r, const struct rtio_sqe *sqes,
+				      size_t sqe_count, uint32_t wait_count);
+
+static inline int z_impl_rtio_sqe_copy_in_submit(struct rtio *r, const struct rtio_sqe *sqes,
+						 size_t sqe_count, uint32_t wait_count)
+{
+	int res;
+
+	res = z_impl_rtio_sqe_copy_in_get_handles(r, sqes, NULL, sqe_count);
+	if (res != 0) {
+		return res;
+	}
+
+	return z_impl_rtio_submit(r, wait_count);
+}
+
 /**
  * @}
  */
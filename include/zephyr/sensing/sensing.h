@@ -282,6 +282,55 @@ int sensing_get_config(
 const struct sensing_sensor_info *sensing_get_sensor_info(
 		sensing_sensor_handle_t handle);
 
+/**
+ * @brief Read the samples of a sensor instance from its shared sample ring.
+ *
+ * Once attached, the data events of the sensor instance are no longer delivered to the
+ * callback of \p handle. The samples are kept in a ring shared by all the clients of the
+ * sensor and the client reads them at its own rate with \ref sensing_ring_claim and
+ * \ref sensing_ring_finish, without copy. Only the samples reported after this call are
+ * seen, the configured interval still decides which samples the client sees.
+ *
+ * Requires @kconfig{CONFIG_SENSING_SAMPLE_RING}.
+ *
+ * @param handle The sensor instance handle.
+ * @return 0 on success, -ENOMEM if the ring could not be allocated.
+ */
+int sensing_ring_attach(sensing_sensor_handle_t handle);
+
+/**
+ * @brief Claim the next sample of the shared sample ring.
+ *
+ * The sample stays valid and in place until \ref sensing_ring_finish is called, the
+ * sensing subsystem drops new samples instead of overwriting a claimed one.
+ *
+ * @param handle The sensor instance handle, attached with \ref sensing_ring_attach.
+ * @param buf Set to the sample data.
+ * @return 0 on success, -EAGAIN if there is no new sample, -EBUSY if a sample is already
+ * claimed, -EINVAL if the handle is not attached.
+ */
+int sensing_ring_claim(sensing_sensor_handle_t handle, const void **buf);
+
+/**
+ * @brief Release the sample claimed with \ref sensing_ring_claim.
+ *
+ * @param handle The sensor instance handle.
+ * @return 0 on success, -EINVAL if no sample is claimed.
+ */
+int sensing_ring_finish(sensing_sensor_handle_t handle);
+
+/**
+ * @brief Get and clear the number of samples the client lost.
+ *
+ * Samples are lost when the ring wraps around before the client read them, or when a new
+ * sample was dropped because the oldest one was claimed.
+ *
+ * @param handle The sensor instance handle.
+ * @param count Set to the number of lost samples.
+ * @return 0 on success, -EINVAL if the handle is not attached.
+ */
+int sensing_ring_overflow_get(sensing_sensor_handle_t handle, uint32_t *count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -91,6 +91,12 @@ struct sensing_connection {
 	/** Next consume time of the connection. Unit is micro seconds. */
 	uint64_t next_consume_time;
 	struct sensing_callback_list *callback_list; /**< Callback list of the connection. */
+#ifdef CONFIG_SENSING_SAMPLE_RING
+	uint32_t ring_cursor;   /**< Next sample ring entry to read. */
+	uint32_t ring_overflow; /**< Number of samples lost by the connection. */
+	bool ring_reader;       /**< Connection reads the sample ring instead of callbacks. */
+	bool ring_claimed;      /**< Entry at ring_cursor is claimed. */
+#endif
 };
 
 /**
@@ -119,6 +125,9 @@ struct sensing_sensor {
 	struct rtio_sqe *stream_sqe;      /**< Sqe for streaming mode. */
 	atomic_t flag;                    /**< Sensor flag of the sensor instance. */
 	struct sensing_connection *conns; /**< Pointer to sensor connections. */
+#ifdef CONFIG_SENSING_SAMPLE_RING
+	struct sensing_sample_ring *ring; /**< Samples shared by the ring readers. */
+#endif
 };
 
 /**
@@ -338,6 +338,43 @@ int settings_save_one(const char *name, const void *value, size_t val_len);
  */
 int settings_delete(const char *name);
 
+/**
+ * Start a settings transaction.
+ *
+ * Until @ref settings_txn_commit or @ref settings_txn_abort is called, values
+ * saved by the calling thread with @ref settings_save_one, @ref
+ * settings_delete or the @ref settings_handler::h_export handlers are kept in
+ * RAM instead of being written to the storage back-end. Saving a key again in
+ * the same transaction replaces its previous value. Other threads saving or
+ * loading settings are blocked until the transaction ends.
+ *
+ * @retval 0 on success.
+ * @retval -EALREADY if the calling thread already has a transaction open.
+ */
+int settings_txn_begin(void);
+
+/**
+ * Write the values saved in the transaction to the storage back-end.
+ *
+ * The values are written in one batch, framed by the back-end
+ * @ref settings_store_itf::csi_save_start and
+ * @ref settings_store_itf::csi_save_end handlers. The transaction ends even
+ * if the write fails.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if no transaction is open.
+ * @retval -ERRNO error returned by the back-end.
+ */
+int settings_txn_commit(void);
+
+/**
+ * Drop the values saved in the transaction and end it.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if no transaction is open.
+ */
+int settings_txn_abort(void);
+
 /**
  * Call commit for all settings handler. This should apply all
  * settings which has been set, but not applied yet.
@@ -33,6 +33,10 @@ extern const struct shell_transport_api shell_uart_transport_api;
 #define CONFIG_SHELL_BACKEND_SERIAL_ASYNC_RX_BUFFER_SIZE 0
 #endif
 
+#ifndef CONFIG_SHELL_BACKEND_SERIAL_ASYNC_TX_BUFFER_SIZE
+#define CONFIG_SHELL_BACKEND_SERIAL_ASYNC_TX_BUFFER_SIZE 0
+#endif
+
 #define ASYNC_RX_BUF_SIZE (CONFIG_SHELL_BACKEND_SERIAL_ASYNC_RX_BUFFER_COUNT * \
 		(CONFIG_SHELL_BACKEND_SERIAL_ASYNC_RX_BUFFER_SIZE + \
 		 UART_ASYNC_RX_BUF_OVERHEAD))
@@ -64,6 +68,13 @@ struct shell_uart_async {
 	struct uart_async_rx_config async_rx_config;
 	atomic_t pending_rx_req;
 	uint8_t rx_data[ASYNC_RX_BUF_SIZE];
+#if CONFIG_SHELL_BACKEND_SERIAL_ASYNC_TX_BUFFER_SIZE > 0
+	struct k_spinlock tx_lock;
+	uint8_t tx_data[2][CONFIG_SHELL_BACKEND_SERIAL_ASYNC_TX_BUFFER_SIZE];
+	size_t tx_len;
+	uint8_t tx_fill;
+	bool tx_busy;
+#endif
 };
 
 struct shell_uart_polling {
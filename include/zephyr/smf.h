@@ -41,6 +41,36 @@
 	IF_ENABLED(CONFIG_SMF_INITIAL_TRANSITION, (.initial = _initial,))  \
 }
 
+/**
+ * @brief Macro to create a state handling events.
+ *
+ * @param _entry   State entry function or NULL
+ * @param _run     State run function or NULL
+ * @param _exit    State exit function or NULL
+ * @param _parent  State parent object or NULL
+ * @param _initial State initial transition object or NULL
+ * @param _events  Array of smf_event_handler, indexed by event ID
+ */
+#define SMF_CREATE_EVENT_STATE(_entry, _run, _exit, _parent, _initial, _events) \
+{                                                                          \
+	.entry   = _entry,                                                 \
+	.run     = _run,                                                   \
+	.exit    = _exit,                                                  \
+	IF_ENABLED(CONFIG_SMF_ANCESTOR_SUPPORT, (.parent = _parent,))      \
+	IF_ENABLED(CONFIG_SMF_INITIAL_TRANSITION, (.initial = _initial,))  \
+	.events  = _events,                                                \
+	.num_events = ARRAY_SIZE(_events),                                 \
+}
+
+/**
+ * @brief Statically define an event queue of a state machine.
+ *
+ * @param _name       Name of the event queue
+ * @param _max_events Maximum number of events waiting in the queue
+ */
+#define SMF_EVENT_QUEUE_DEFINE(_name, _max_events) \
+	K_MSGQ_DEFINE(_name, sizeof(struct smf_event), _max_events, sizeof(void *))
+
 /**
  * @brief Macro to cast user defined object to state machine
  *        context.
@@ -62,6 +92,24 @@ extern "C" {
  */
 typedef void (*state_execution)(void *obj);
 
+#if defined(CONFIG_SMF_EVENTS) || defined(__DOXYGEN__)
+/** Event dispatched to a state machine. */
+struct smf_event {
+	/** Event ID, indexing the event handlers of the states */
+	uint32_t id;
+	/** Optional event data */
+	void *data;
+};
+
+/**
+ * @brief Function pointer that handles an event in a state
+ *
+ * @param obj   pointer user defined object
+ * @param event dispatched event
+ */
+typedef void (*smf_event_handler)(void *obj, const struct smf_event *event);
+#endif /* CONFIG_SMF_EVENTS */
+
 /** General state that can be used in multiple state machines. */
 struct smf_state {
 	/** Optional method that will be run when this state is entered */
@@ -93,6 +141,15 @@ struct smf_state {
 	const struct smf_state *initial;
 #endif /* CONFIG_SMF_INITIAL_TRANSITION */
 #endif /* CONFIG_SMF_ANCESTOR_SUPPORT */
+#ifdef CONFIG_SMF_EVENTS
+	/**
+	 * Optional event handlers, indexed by event ID. An event without a
+	 * handler in this state is dispatched to the parent state.
+	 */
+	const smf_event_handler *events;
+	/** Number of entries in events */
+	uint32_t num_events;
+#endif /* CONFIG_SMF_EVENTS */
 };
 
 /** Defines the current context of the state machine. */
@@ -118,6 +175,10 @@ struct smf_ctx {
 	 * used to track state machine context
 	 */
 	uint32_t internal;
+#ifdef CONFIG_SMF_EVENTS
+	/** Event queue of the state machine, or NULL */
+	struct k_msgq *event_queue;
+#endif /* CONFIG_SMF_EVENTS */
 };
 
 /**
@@ -167,6 +228,62 @@ void smf_set_handled(struct smf_ctx *ctx);
  */
 int32_t smf_run_state(struct smf_ctx *ctx);
 
+#if defined(CONFIG_SMF_EVENTS) || defined(__DOXYGEN__)
+/**
+ * @brief Sets the event queue of a state machine.
+ *
+ * @param ctx   State machine context
+ * @param queue Queue defined with SMF_EVENT_QUEUE_DEFINE(), or NULL
+ */
+void smf_set_event_queue(struct smf_ctx *ctx, struct k_msgq *queue);
+
+/**
+ * @brief Posts an event to the event queue of a state machine.
+ *
+ * May be called from any context, including an ISR or an event handler of
+ * the state machine itself, the event then being dispatched once the
+ * current one was processed.
+ *
+ * @param ctx  State machine context
+ * @param id   Event ID
+ * @param data Optional event data
+ *
+ * @retval 0 on success.
+ * @retval -ENOMSG if the event queue is full.
+ * @retval -EINVAL if the state machine has no event queue.
+ */
+int smf_post_event(struct smf_ctx *ctx, uint32_t id, void *data);
+
+/**
+ * @brief Dispatches an event to a state machine.
+ *
+ * The handler of the event in the current state is looked up in its event
+ * handler table. If there is none, the event is dispatched to the closest
+ * ancestor having one, otherwise the event is dropped. The handler runs to
+ * completion, including any transition it triggers, before returning.
+ *
+ * @param ctx   State machine context
+ * @param event Event to dispatch
+ * @return	    A non-zero value should terminate the state machine, see
+ *		    smf_run_state().
+ */
+int32_t smf_dispatch_event(struct smf_ctx *ctx, const struct smf_event *event);
+
+/**
+ * @brief Processes the queued events of a state machine.
+ *
+ * Waits for an event for up to @p timeout, then dispatches it and every
+ * other queued event, one at a time, until the queue is empty or the state
+ * machine terminates.
+ *
+ * @param ctx     State machine context
+ * @param timeout Time to wait for the first event
+ * @return	      A non-zero value should terminate the state machine, see
+ *		      smf_run_state().
+ */
+int32_t smf_run_events(struct smf_ctx *ctx, k_timeout_t timeout);
+#endif /* CONFIG_SMF_EVENTS */
+
 #ifdef __cplusplus
 }
 #endif
@@ -198,13 +198,28 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 	 * receiving a ticket
 	 */
 	atomic_val_t ticket = atomic_inc(&l->tail);
+	atomic_val_t owner;
+
 	/* Spin until our ticket is served */
-	while (atomic_get(&l->owner) != ticket) {
-		arch_spin_relax();
+	while ((owner = atomic_get(&l->owner)) != ticket) {
+		/* Back off in proportion to our place in the queue, so
+		 * the waiters about to be served poll the lock the most.
+		 */
+		unsigned long ahead = (unsigned long)ticket - (unsigned long)owner;
+
+		for (unsigned long i = MIN(ahead, CONFIG_MP_MAX_NUM_CPUS); i > 0; i--) {
+			arch_spin_relax();
+		}
 	}
 #else
 	while (!atomic_cas(&l->locked, 0, 1)) {
-		arch_spin_relax();
+		/* Only read the lock until it looks free, so the waiters
+		 * share its cache line instead of bouncing it between
+		 * them with failed atomic_cas() while it is held.
+		 */
+		do {
+			arch_spin_relax();
+		} while (atomic_get(&l->locked) != 0);
 	}
 #endif /* CONFIG_TICKET_SPINLOCKS */
 #endif /* CONFIG_SMP */
@@ -46,6 +46,19 @@
  *     s<stat-idx>
  *
  * E.g., "s0", "s1", etc.
+ *
+ * Statistics updated concurrently from several CPUs can be declared as
+ * per-CPU groups when CONFIG_STATS_PERCPU is enabled.  Each CPU then
+ * increments its own copy of the group, aligned to a cache line, and the
+ * copies are summed when the statistics are read with stats_value_get().
+ * Without CONFIG_STATS_PERCPU, the per-CPU macros fall back to a single,
+ * shared copy of the group:
+ *
+ *     STATS_PERCPU_SECT_DEFINE(my_stats);
+ *     static STATS_PERCPU_SECT_DECL(my_stats) my_stats[STATS_PERCPU_NUM_CPUS];
+ *
+ *     STATS_PERCPU_INIT_AND_REG(my_stats, my_stats, STATS_SIZE_32, "my_stats");
+ *     STATS_PERCPU_INC(my_stats, rx_packets);
  */
 
 #ifndef ZEPHYR_INCLUDE_STATS_STATS_H_
@@ -54,6 +67,10 @@
 #include <stddef.h>
 #include <zephyr/types.h>
 
+#ifdef CONFIG_STATS_PERCPU
+#include <zephyr/kernel.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -71,6 +88,10 @@ struct stats_hdr {
 #ifdef CONFIG_STATS_NAMES
 	const struct stats_name_map *s_map;
 	int s_map_cnt;
+#endif
+#ifdef CONFIG_STATS_PERCPU
+	/* Distance between the per-CPU copies of the group, 0 if not per-CPU */
+	uint16_t s_cpu_stride;
 #endif
 	struct stats_hdr *s_next;
 };
@@ -88,6 +109,17 @@ struct stats_hdr {
  */
 #define STATS_SECT_END }
 
+/**
+ * @brief Declares a per-CPU stat group struct.
+ *
+ * The per-CPU groups are arrays of STATS_PERCPU_NUM_CPUS elements of this
+ * type, defined by STATS_PERCPU_SECT_DEFINE().
+ *
+ * @param group__               The name of the stats group struct.
+ */
+#define STATS_PERCPU_SECT_DECL(group__) \
+	struct stats_percpu_ ## group__
+
 /* The following macros depend on whether CONFIG_STATS is defined.  If it is
  * not defined, then invocations of these macros get compiled out.
  */
@@ -180,6 +212,85 @@ struct stats_hdr {
 #define STATS_CLEAR(group__, var__) \
 	((group__).var__ = 0)
 
+#ifdef CONFIG_STATS_PERCPU
+
+/** Alignment of the per-CPU copies of a stats group. */
+#if defined(CONFIG_DCACHE_LINE_SIZE) && (CONFIG_DCACHE_LINE_SIZE != 0)
+#define STATS_PERCPU_ALIGN CONFIG_DCACHE_LINE_SIZE
+#else
+#define STATS_PERCPU_ALIGN 64
+#endif
+
+/** Number of copies of a per-CPU stats group. */
+#define STATS_PERCPU_NUM_CPUS CONFIG_MP_MAX_NUM_CPUS
+
+/**
+ * @brief Defines the per-CPU stat group struct of a stats group.
+ *
+ * Each copy of the group is aligned to a cache line, so that the CPUs
+ * updating their copy do not invalidate the caches of the others.
+ *
+ * @param group__               The stats group struct name, as in
+ *                                  STATS_SECT_START().
+ */
+#define STATS_PERCPU_SECT_DEFINE(group__)		   \
+	STATS_PERCPU_SECT_DECL(group__) {		   \
+		STATS_SECT_DECL(group__) s;		   \
+	} __aligned(STATS_PERCPU_ALIGN)
+
+/** @cond INTERNAL_HIDDEN */
+static ALWAYS_INLINE unsigned int z_stats_percpu_id(void)
+{
+#ifdef CONFIG_SMP
+	return arch_curr_cpu()->id;
+#else
+	return 0;
+#endif
+}
+/** @endcond */
+
+/**
+ * @brief Increases a per-CPU statistic entry by the specified amount.
+ *
+ * Only the copy of the current CPU is updated, with its interrupts locked
+ * so that no update is lost to an ISR.  Compiled out if CONFIG_STATS is not
+ * defined.
+ *
+ * @param group__               The per-CPU group containing the entry.
+ * @param var__                 The statistic entry to increase.
+ * @param n__                   The amount to increase the statistic entry by.
+ */
+#define STATS_PERCPU_INCN(group__, var__, n__)				     \
+	do {								     \
+		unsigned int stats_key__ = arch_irq_lock();		     \
+									     \
+		STATS_INCN((group__)[z_stats_percpu_id()].s, var__, n__);    \
+		arch_irq_unlock(stats_key__);				     \
+	} while (false)
+
+#else /* CONFIG_STATS_PERCPU */
+
+#define STATS_PERCPU_NUM_CPUS 1
+
+#define STATS_PERCPU_SECT_DEFINE(group__)		   \
+	STATS_PERCPU_SECT_DECL(group__) {		   \
+		STATS_SECT_DECL(group__) s;		   \
+	}
+
+#define STATS_PERCPU_INCN(group__, var__, n__) \
+	STATS_INCN((group__)[0].s, var__, n__)
+
+#endif /* !CONFIG_STATS_PERCPU */
+
+/**
+ * @brief Increments a per-CPU statistic entry.
+ *
+ * @param group__               The per-CPU group containing the entry.
+ * @param var__                 The statistic entry to increase.
+ */
+#define STATS_PERCPU_INC(group__, var__) \
+	STATS_PERCPU_INCN(group__, var__, 1)
+
 #define STATS_SIZE_16 (sizeof(uint16_t))
 #define STATS_SIZE_32 (sizeof(uint32_t))
 #define STATS_SIZE_64 (sizeof(uint64_t))
@@ -210,6 +321,41 @@ struct stats_hdr {
 		STATS_NAME_INIT_PARMS(group__),				 \
 		(name__))
 
+/**
+ * @brief Initializes and registers a per-CPU statistics group.
+ *
+ * @param group__               The per-CPU statistics group to initialize
+ *                                  and register.
+ * @param sect__                The stats group struct name, as in
+ *                                  STATS_SECT_START().
+ * @param size__                The size of each entry in the statistics group,
+ *                                  in bytes.  Must be one of: 2 (16-bits), 4
+ *                                  (32-bits) or 8 (64-bits).
+ * @param name__                The name of the statistics group to register.
+ *                                  This name must be unique among all
+ *                                  statistics groups.
+ *
+ * @return                      0 on success; negative error code on failure.
+ */
+#ifdef CONFIG_STATS_PERCPU
+#define STATS_PERCPU_INIT_AND_REG(group__, sect__, size__, name__)		\
+	stats_init_and_reg_percpu(						\
+		&(group__)[0].s.s_hdr,						\
+		sizeof((group__)[0]),						\
+		(size__),							\
+		(sizeof((group__)[0].s) - sizeof(struct stats_hdr)) / (size__), \
+		STATS_NAME_INIT_PARMS(sect__),					\
+		(name__))
+#else
+#define STATS_PERCPU_INIT_AND_REG(group__, sect__, size__, name__)		\
+	stats_init_and_reg(						\
+		&(group__)[0].s.s_hdr,						\
+		(size__),							\
+		(sizeof((group__)[0].s) - sizeof(struct stats_hdr)) / (size__), \
+		STATS_NAME_INIT_PARMS(sect__),					\
+		(name__))
+#endif
+
 /**
  * @brief Initializes a statistics group.
  *
@@ -272,6 +418,44 @@ int stats_init_and_reg(struct stats_hdr *hdr, uint8_t size, uint16_t cnt,
 		       const struct stats_name_map *map, uint16_t map_cnt,
 		       const char *name);
 
+/**
+ * @brief Initializes and registers a per-CPU statistics group.
+ *
+ * Note: it is recommended to use the STATS_PERCPU_INIT_AND_REG macro
+ * instead of this function.
+ *
+ * @param hdr                   The header of the first copy of the group.
+ * @param stride                The distance between the copies of the
+ *                                  group, in bytes.
+ * @param size                  The size of each individual statistics
+ *                                  element, in bytes.
+ * @param cnt                   The number of elements in the stats group.
+ * @param map                   The mapping of stat offset to name.
+ * @param map_cnt               The number of items in the statistics map
+ * @param name                  The name of the statistics group to register.
+ *
+ * @return                      0 on success; negative error code on failure.
+ *
+ * @see STATS_PERCPU_INIT_AND_REG
+ */
+int stats_init_and_reg_percpu(struct stats_hdr *hdr, uint16_t stride, uint8_t size,
+			      uint16_t cnt, const struct stats_name_map *map,
+			      uint16_t map_cnt, const char *name);
+
+/**
+ * @brief Reads a statistic entry.
+ *
+ * The copies of a per-CPU group are summed.  The copies are read without
+ * locking, so the sum may only miss the concurrent updates.
+ *
+ * @param hdr                   The group containing the entry.
+ * @param off                   The offset of the entry, from `hdr`, as given
+ *                                  to the stats_walk() callbacks.
+ *
+ * @return                      The value of the entry.
+ */
+uint64_t stats_value_get(const struct stats_hdr *hdr, uint16_t off);
+
 /**
  * Zeroes the specified statistics group.
  *
@@ -365,6 +549,14 @@ struct stats_hdr *stats_group_find(const char *name);
 #define STATS_SET(group__, var__)
 #define STATS_CLEAR(group__, var__)
 #define STATS_INIT_AND_REG(group__, size__, name__) (0)
+#define STATS_PERCPU_NUM_CPUS 1
+#define STATS_PERCPU_SECT_DEFINE(group__) \
+	STATS_PERCPU_SECT_DECL(group__) {	  \
+		STATS_SECT_DECL(group__) s;	  \
+	}
+#define STATS_PERCPU_INCN(group__, var__, n__)
+#define STATS_PERCPU_INC(group__, var__)
+#define STATS_PERCPU_INIT_AND_REG(group__, sect__, size__, name__) (0)
 
 #endif /* !CONFIG_STATS */
 
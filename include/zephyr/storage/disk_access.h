@@ -113,6 +113,35 @@ int disk_access_write(const char *pdrv, const uint8_t *data_buf,
  */
 int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buff);
 
+/**
+ * @brief Disk sector cache statistics
+ */
+struct disk_cache_stats {
+	/** Accesses served by a cached line */
+	uint32_t hits;
+	/** Accesses that had to fetch or allocate a line */
+	uint32_t misses;
+	/** Lines fetched ahead of a sequential read */
+	uint32_t read_ahead;
+	/** Dirty lines written back to the disk */
+	uint32_t write_backs;
+};
+
+/**
+ * @brief Get the disk sector cache statistics
+ *
+ * The statistics cover all the disks sharing the cache, which is enabled by
+ * @kconfig{CONFIG_DISK_CACHE}.
+ *
+ * @param[out] stats         Statistics since boot or the last reset
+ */
+void disk_access_cache_stats_get(struct disk_cache_stats *stats);
+
+/**
+ * @brief Reset the disk sector cache statistics
+ */
+void disk_access_cache_stats_reset(void);
+
 #ifdef __cplusplus
 }
 #endif
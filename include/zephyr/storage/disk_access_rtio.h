@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Disk Access RTIO API
+ */
+
+#ifndef ZEPHYR_INCLUDE_STORAGE_DISK_ACCESS_RTIO_H_
+#define ZEPHYR_INCLUDE_STORAGE_DISK_ACCESS_RTIO_H_
+
+#include <string.h>
+#include <zephyr/rtio/rtio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup disk_access_interface
+ * @{
+ */
+
+/** @cond INTERNAL_HIDDEN */
+extern const struct rtio_iodev_api disk_access_iodev_api;
+/** @endcond */
+
+/**
+ * @brief Define an RTIO iodev for a disk
+ *
+ * Requests submitted to the iodev are run in order by a disk access thread
+ * using @ref disk_access_read and @ref disk_access_write, so the submitter
+ * does not wait for the disk. The disk must be initialized before requests
+ * are submitted.
+ *
+ * @param name Name of the iodev
+ * @param pdrv Disk name
+ */
+#define DISK_ACCESS_IODEV_DEFINE(name, pdrv)                                                       \
+	RTIO_IODEV_DEFINE(name, &disk_access_iodev_api, (void *)(pdrv))
+
+/**
+ * @brief Prepare a disk sector read submission
+ *
+ * @param sqe Submission to prepare
+ * @param iodev Disk iodev defined by @ref DISK_ACCESS_IODEV_DEFINE
+ * @param prio Priority of the submission
+ * @param buf Buffer receiving the sectors
+ * @param start_sector First sector to read
+ * @param num_sectors Number of sectors to read
+ * @param userdata User data returned with the completion
+ */
+static inline void rtio_sqe_prep_disk_read(struct rtio_sqe *sqe, const struct rtio_iodev *iodev,
+					   int8_t prio, uint8_t *buf, uint32_t start_sector,
+					   uint32_t num_sectors, void *userdata)
+{
+	memset(sqe, 0, sizeof(struct rtio_sqe));
+	sqe->op = RTIO_OP_DISK_READ;
+	sqe->prio = prio;
+	sqe->iodev = iodev;
+	sqe->disk_buf = buf;
+	sqe->disk_start_sector = start_sector;
+	sqe->disk_num_sectors = num_sectors;
+	sqe->userdata = userdata;
+}
+
+/**
+ * @brief Prepare a disk sector write submission
+ *
+ * @param sqe Submission to prepare
+ * @param iodev Disk iodev defined by @ref DISK_ACCESS_IODEV_DEFINE
+ * @param prio Priority of the submission
+ * @param buf Buffer holding the sectors, which must stay valid until completion
+ * @param start_sector First sector to write
+ * @param num_sectors Number of sectors to write
+ * @param userdata User data returned with the completion
+ */
+static inline void rtio_sqe_prep_disk_write(struct rtio_sqe *sqe, const struct rtio_iodev *iodev,
+					    int8_t prio, const uint8_t *buf, uint32_t start_sector,
+					    uint32_t num_sectors, void *userdata)
+{
+	rtio_sqe_prep_disk_read(sqe, iodev, prio, (uint8_t *)buf, start_sector, num_sectors,
+				userdata);
+	sqe->op = RTIO_OP_DISK_WRITE;
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_STORAGE_DISK_ACCESS_RTIO_H_ */
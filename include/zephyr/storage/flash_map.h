@@ -285,6 +285,26 @@ const struct device *flash_area_get_device(const struct flash_area *fa);
 const char *flash_area_label(const struct flash_area *fa);
 #endif
 
+#if defined(CONFIG_FLASH_MAP_XIP) || defined(__DOXYGEN__)
+/**
+ * @brief Get the address of flash area content readable in place
+ *
+ * Only flash areas of flash memory mapped in the address space of the CPU
+ * can be read in place. The content read at the address changes when the
+ * flash area is written or erased through its driver.
+ *
+ * @param[in]  fa Flash area
+ * @param[in]  off Offset relative from beginning of flash area
+ * @param[in]  len Number of bytes to access
+ * @param[out] addr Address of the content at off
+ *
+ * @return 0 on success, -EINVAL if the range is out of the flash area,
+ *	   -ENOTSUP if the flash area is not memory mapped, -ENOMEM if it
+ *	   could not be mapped.
+ */
+int flash_area_mmap(const struct flash_area *fa, off_t off, size_t len, const void **addr);
+#endif
+
 /**
  * Get the value expected to be read when accessing any erased
  * flash byte.
@@ -24,6 +24,7 @@
  */
 
 #include <stdbool.h>
+#include <zephyr/kernel.h>
 #include <zephyr/drivers/flash.h>
 
 #ifdef __cplusplus
@@ -67,6 +68,13 @@ struct stream_flash_ctx {
 #endif
 	uint8_t erase_value;
 	uint8_t write_block_size;	/* Offset/size device write alignment */
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+	uint8_t *async_buf; /* Buffer being written, or spare buffer */
+	size_t async_bytes; /* Number of bytes of async_buf being written */
+	int async_rc; /* Result of the last asynchronous write */
+	struct k_sem async_done; /* Available when no write is in progress */
+	struct k_work async_work;
+#endif
 };
 
 /**
@@ -123,6 +131,36 @@ size_t stream_flash_bytes_written(struct stream_flash_ctx *ctx);
 int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *data,
 				size_t len, bool flush);
 
+/**
+ * @brief Write full buffers to flash while the next one is being filled.
+ *
+ * Once enabled, each time the write buffer of @p ctx is full it is handed
+ * over to a dedicated work queue and @ref stream_flash_buffered_write
+ * continues with @p buf, so that erasing and programming overlap with the
+ * reception of new data. After programming a buffer the work queue also
+ * erases the page the next buffer starts in, even when the stream ends
+ * there.
+ *
+ * A write waits for the previous buffer to be written before handing over
+ * another one, and returns the error of that previous write, if any. A write
+ * with the flush flag set waits for all the data to be written.
+ * The context callback is invoked from the work queue thread, and
+ * @ref stream_flash_bytes_written does not count the buffer being written.
+ *
+ * This must be called after @ref stream_flash_init and before writing any
+ * data. The context must be flushed before being re-initialized.
+ *
+ * @note Requires @kconfig{CONFIG_STREAM_FLASH_ASYNC}.
+ *
+ * @param ctx context
+ * @param buf second write buffer
+ * @param buf_len length of @p buf, must be the length of the buffer given to
+ *                @ref stream_flash_init
+ * @return non-negative on success, negative errno code on fail
+ */
+int stream_flash_async_enable(struct stream_flash_ctx *ctx, uint8_t *buf,
+			      size_t buf_len);
+
 /**
  * @brief Erase the flash page to which a given offset belongs.
  *
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Bump arena allocator
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_ARENA_H_
+#define ZEPHYR_INCLUDE_SYS_ARENA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup arena_apis Arena Allocator APIs
+ * @ingroup memory_management
+ * @{
+ */
+
+/**
+ * @brief Arena allocator
+ *
+ * Memory is handed out from a contiguous block by bumping an offset.
+ * Allocations are never freed one by one. Instead, everything allocated
+ * after a mark is released at once by rewinding to the mark, or all of
+ * the arena by resetting it.
+ *
+ * Like sys_heap, the arena is not internally synchronized. It is meant to
+ * be used by a single thread, e.g. for the duration of one request.
+ */
+struct sys_arena {
+	/** Start of the managed memory */
+	uint8_t *base;
+	/** Size of the managed memory in bytes */
+	size_t size;
+	/** Offset of the first unused byte */
+	size_t offset;
+	/** Highest offset reached since initialization */
+	size_t max_offset;
+	/** Heap the memory was taken from, if any */
+	struct k_heap *heap;
+};
+
+/**
+ * @brief Arena position, as returned by sys_arena_mark()
+ */
+typedef size_t sys_arena_mark_t;
+
+/**
+ * @brief Initialize an arena on a block of memory
+ *
+ * @param arena Arena to initialize
+ * @param mem Memory to hand out
+ * @param bytes Size of the memory in bytes
+ */
+void sys_arena_init(struct sys_arena *arena, void *mem, size_t bytes);
+
+/**
+ * @brief Initialize an arena on memory taken from a k_heap
+ *
+ * The memory goes back to the heap with sys_arena_release().
+ *
+ * @param arena Arena to initialize
+ * @param heap Heap providing the memory
+ * @param bytes Size of the arena in bytes
+ * @param timeout How long to wait for the heap memory
+ *
+ * @retval 0 Success
+ * @retval -ENOMEM Heap memory could not be allocated in time
+ */
+int sys_arena_init_from_heap(struct sys_arena *arena, struct k_heap *heap,
+			     size_t bytes, k_timeout_t timeout);
+
+/**
+ * @brief Give the memory of an arena back to its heap
+ *
+ * All allocations from the arena become invalid. Does nothing to the
+ * memory of arenas initialized with sys_arena_init().
+ *
+ * @param arena Arena to release
+ */
+void sys_arena_release(struct sys_arena *arena);
+
+/**
+ * @brief Allocate aligned memory from an arena
+ *
+ * @param arena Arena to allocate from
+ * @param align Alignment in bytes, must be a power of two, or 0
+ * @param bytes Number of bytes requested
+ *
+ * @return Pointer to the memory, or NULL if the arena is exhausted
+ */
+void *sys_arena_aligned_alloc(struct sys_arena *arena, size_t align, size_t bytes);
+
+/**
+ * @brief Allocate memory from an arena
+ *
+ * The memory is aligned to sizeof(void *), like with sys_heap_alloc().
+ *
+ * @param arena Arena to allocate from
+ * @param bytes Number of bytes requested
+ *
+ * @return Pointer to the memory, or NULL if the arena is exhausted
+ */
+static inline void *sys_arena_alloc(struct sys_arena *arena, size_t bytes)
+{
+	return sys_arena_aligned_alloc(arena, sizeof(void *), bytes);
+}
+
+/**
+ * @brief Mark the current position of an arena
+ *
+ * Marks may be nested: rewinding to a mark releases the allocations
+ * made after it, including those after any later mark.
+ *
+ * @param arena Arena to mark
+ *
+ * @return Mark to pass to sys_arena_rewind()
+ */
+static inline sys_arena_mark_t sys_arena_mark(struct sys_arena *arena)
+{
+	return arena->offset;
+}
+
+/**
+ * @brief Release all arena allocations made after a mark
+ *
+ * @param arena Arena to rewind
+ * @param mark Mark returned by sys_arena_mark(), not older than the
+ *             last rewind to an earlier mark or reset
+ */
+static inline void sys_arena_rewind(struct sys_arena *arena, sys_arena_mark_t mark)
+{
+	__ASSERT(mark <= arena->offset, "arena mark %zu is beyond %zu",
+		 mark, arena->offset);
+
+	arena->offset = mark;
+}
+
+/**
+ * @brief Release all allocations of an arena
+ *
+ * @param arena Arena to reset
+ */
+static inline void sys_arena_reset(struct sys_arena *arena)
+{
+	arena->offset = 0;
+}
+
+/**
+ * @brief Get the number of allocated bytes of an arena
+ *
+ * This includes the alignment padding between allocations.
+ *
+ * @param arena Arena to query
+ *
+ * @return Number of bytes in use
+ */
+static inline size_t sys_arena_used_get(struct sys_arena *arena)
+{
+	return arena->offset;
+}
+
+/**
+ * @brief Get the highest number of allocated bytes of an arena
+ *
+ * @param arena Arena to query
+ *
+ * @return Highest number of bytes in use since initialization
+ */
+static inline size_t sys_arena_max_used_get(struct sys_arena *arena)
+{
+	return arena->max_offset;
+}
+
+#if defined(CONFIG_SYS_ARENA_THREAD) || defined(__DOXYGEN__)
+
+/**
+ * @brief Assign a default arena to a thread
+ *
+ * The arena is not inherited by threads created by @a thread.
+ *
+ * @param thread Target thread
+ * @param arena Arena to use by default, or NULL for none
+ */
+static inline void sys_arena_thread_assign(struct k_thread *thread,
+					   struct sys_arena *arena)
+{
+	thread->arena = arena;
+}
+
+/**
+ * @brief Get the default arena of the current thread
+ *
+ * @return Arena assigned with sys_arena_thread_assign(), or NULL
+ */
+static inline struct sys_arena *sys_arena_current(void)
+{
+	return k_current_get()->arena;
+}
+
+/**
+ * @brief Allocate memory from the default arena of the current thread
+ *
+ * @param bytes Number of bytes requested
+ *
+ * @return Pointer to the memory, or NULL if the thread has no arena or
+ *         it is exhausted
+ */
+static inline void *sys_arena_thread_alloc(size_t bytes)
+{
+	struct sys_arena *arena = sys_arena_current();
+
+	return (arena != NULL) ? sys_arena_alloc(arena, bytes) : NULL;
+}
+
+#endif /* CONFIG_SYS_ARENA_THREAD */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_ARENA_H_ */
@@ -39,6 +39,11 @@ struct sys_bitarray {
 	/* Bundle of bits */
 	uint32_t *bundles;
 
+#if defined(CONFIG_SYS_BITARRAY_SUMMARY)
+	/* One bit per bundle, set when all bits of the bundle are set */
+	uint32_t *full;
+#endif
+
 	/* Spinlock guarding access to this bit array */
 	struct k_spinlock lock;
 };
@@ -47,6 +52,23 @@ struct sys_bitarray {
 /** Bitarray structure */
 typedef struct sys_bitarray sys_bitarray_t;
 
+/** @cond INTERNAL_HIDDEN */
+#define _SYS_BITARRAY_NUM_BUNDLES(total_bits)				\
+	DIV_ROUND_UP(DIV_ROUND_UP(total_bits, 8), sizeof(uint32_t))
+
+#if defined(CONFIG_SYS_BITARRAY_SUMMARY)
+#define _SYS_BITARRAY_SUMMARY_DEFINE(name, total_bits, sba_mod)	\
+	sba_mod uint32_t _sys_bitarray_full_##name			\
+		[DIV_ROUND_UP(_SYS_BITARRAY_NUM_BUNDLES(total_bits),	\
+			      32)] = {0};
+#define _SYS_BITARRAY_SUMMARY_INIT(name)				\
+	.full = _sys_bitarray_full_##name,
+#else
+#define _SYS_BITARRAY_SUMMARY_DEFINE(name, total_bits, sba_mod)
+#define _SYS_BITARRAY_SUMMARY_INIT(name)
+#endif
+/** @endcond */
+
 /**
  * @brief Create a bitarray object.
  *
@@ -56,13 +78,13 @@ typedef struct sys_bitarray sys_bitarray_t;
  */
 #define _SYS_BITARRAY_DEFINE(name, total_bits, sba_mod)			\
 	sba_mod uint32_t _sys_bitarray_bundles_##name			\
-		[DIV_ROUND_UP(DIV_ROUND_UP(total_bits, 8),		\
-			       sizeof(uint32_t))] = {0};		\
+		[_SYS_BITARRAY_NUM_BUNDLES(total_bits)] = {0};		\
+	_SYS_BITARRAY_SUMMARY_DEFINE(name, total_bits, sba_mod)		\
 	sba_mod sys_bitarray_t name = {					\
 		.num_bits = (total_bits),				\
-		.num_bundles = DIV_ROUND_UP(				\
-			DIV_ROUND_UP(total_bits, 8), sizeof(uint32_t)),	\
+		.num_bundles = _SYS_BITARRAY_NUM_BUNDLES(total_bits),	\
 		.bundles = _sys_bitarray_bundles_##name,		\
+		_SYS_BITARRAY_SUMMARY_INIT(name)			\
 	}
 
 /**
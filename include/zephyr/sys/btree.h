@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @defgroup btree_apis B+tree Ordered Map
+ * @ingroup datastructure_apis
+ *
+ * @brief Cache friendly ordered map
+ *
+ * This implements a B+tree mapping unique integer keys to pointers.
+ * Each node holds up to @ref SYS_BTREE_ORDER keys in a single
+ * CONFIG_SYS_BTREE_NODE_SIZE bytes block, sized to the cache line, so
+ * that a lookup touches a handful of contiguous nodes instead of
+ * chasing one pointer per level as the @ref rbtree_apis do. The values
+ * are stored in the leaves, which are linked for in order iteration.
+ *
+ * The nodes are allocated from a @ref mem_slab_apis "memory slab" given
+ * to sys_btree_init(), which bounds the memory used by the tree. The
+ * tree is not thread safe: callers provide their own locking, also
+ * covering the slab if it is shared.
+ *
+ * @{
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_BTREE_H_
+#define ZEPHYR_INCLUDE_SYS_BTREE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Key type of the B+tree */
+typedef uint32_t sys_btree_key_t;
+
+/**
+ * @brief Maximum number of keys per node
+ *
+ * A node holds a key count, the keys and one more pointer than keys:
+ * the children of an inner node, the values and the next leaf link of
+ * a leaf.
+ */
+#define SYS_BTREE_ORDER                                                                     \
+	((CONFIG_SYS_BTREE_NODE_SIZE - 2 * sizeof(void *)) /                                \
+	 (sizeof(sys_btree_key_t) + sizeof(void *)))
+
+/** @cond INTERNAL_HIDDEN */
+struct sys_btree_node {
+	uint16_t count;
+	uint16_t leaf;
+	sys_btree_key_t keys[SYS_BTREE_ORDER];
+	void *ptrs[SYS_BTREE_ORDER + 1];
+};
+/** @endcond */
+
+/**
+ * @brief B+tree structure
+ */
+struct sys_btree {
+	/** @cond INTERNAL_HIDDEN */
+	struct sys_btree_node *root;
+	struct k_mem_slab *slab;
+	size_t size;
+	uint8_t height;
+	/** @endcond */
+};
+
+/**
+ * @brief Iterator over a B+tree
+ */
+struct sys_btree_iter {
+	/** @cond INTERNAL_HIDDEN */
+	struct sys_btree_node *leaf;
+	size_t idx;
+	/** @endcond */
+};
+
+/**
+ * @brief Statically define a memory slab for B+tree nodes
+ *
+ * @param name Name of the memory slab.
+ * @param num_nodes Number of nodes, i.e. about the number of keys
+ *        divided by three quarters of @ref SYS_BTREE_ORDER.
+ */
+#define SYS_BTREE_SLAB_DEFINE(name, num_nodes)                                             \
+	K_MEM_SLAB_DEFINE_STATIC(name, sizeof(struct sys_btree_node), num_nodes,              \
+				 __alignof__(struct sys_btree_node))
+
+/**
+ * @brief Initialize an empty B+tree
+ *
+ * @param tree Tree to initialize.
+ * @param slab Memory slab of sizeof(struct sys_btree_node) blocks, see
+ *        SYS_BTREE_SLAB_DEFINE().
+ */
+void sys_btree_init(struct sys_btree *tree, struct k_mem_slab *slab);
+
+/**
+ * @brief Insert a key
+ *
+ * @param tree Tree.
+ * @param key Key to insert.
+ * @param val Value of the key.
+ *
+ * @retval 0 on success.
+ * @retval -EEXIST if the key is already in the tree.
+ * @retval -ENOMEM if the slab has not enough free nodes, the tree is
+ *         then left unchanged.
+ */
+int sys_btree_insert(struct sys_btree *tree, sys_btree_key_t key, void *val);
+
+/**
+ * @brief Look up a key
+ *
+ * @param tree Tree.
+ * @param key Key to look up.
+ *
+ * @return Value of the key, NULL if it is not in the tree.
+ */
+void *sys_btree_get(const struct sys_btree *tree, sys_btree_key_t key);
+
+/**
+ * @brief Remove a key
+ *
+ * @param tree Tree.
+ * @param key Key to remove.
+ *
+ * @return Value of the removed key, NULL if it was not in the tree.
+ */
+void *sys_btree_remove(struct sys_btree *tree, sys_btree_key_t key);
+
+/**
+ * @brief Remove all the keys, returning the nodes to the slab
+ *
+ * @param tree Tree.
+ */
+void sys_btree_clear(struct sys_btree *tree);
+
+/**
+ * @brief Get the number of keys in a tree
+ *
+ * @param tree Tree.
+ *
+ * @return Number of keys.
+ */
+static inline size_t sys_btree_size(const struct sys_btree *tree)
+{
+	return tree->size;
+}
+
+/**
+ * @brief Start an iteration at the smallest key not less than @p key
+ *
+ * @param tree Tree.
+ * @param key Key to start from, 0 to iterate over the whole tree.
+ * @param iter Iterator to initialize.
+ */
+void sys_btree_iter_seek(const struct sys_btree *tree, sys_btree_key_t key,
+			 struct sys_btree_iter *iter);
+
+/**
+ * @brief Get the next key of an iteration, in ascending order
+ *
+ * The tree must not be modified during the iteration.
+ *
+ * @param iter Iterator initialized with sys_btree_iter_seek().
+ * @param key Set to the next key.
+ * @param val Set to the value of the next key, may be NULL.
+ *
+ * @return true if a key was returned, false at the end of the tree.
+ */
+bool sys_btree_iter_next(struct sys_btree_iter *iter, sys_btree_key_t *key, void **val);
+
+/**
+ * @brief Get the smallest key of a tree
+ *
+ * @param tree Tree.
+ * @param key Set to the smallest key.
+ * @param val Set to its value, may be NULL.
+ *
+ * @return false if the tree is empty.
+ */
+static inline bool sys_btree_min(const struct sys_btree *tree, sys_btree_key_t *key,
+				 void **val)
+{
+	struct sys_btree_iter iter;
+
+	sys_btree_iter_seek(tree, 0, &iter);
+
+	return sys_btree_iter_next(&iter, key, val);
+}
+
+/**
+ * @brief Get the largest key of a tree
+ *
+ * @param tree Tree.
+ * @param key Set to the largest key.
+ * @param val Set to its value, may be NULL.
+ *
+ * @return false if the tree is empty.
+ */
+bool sys_btree_max(const struct sys_btree *tree, sys_btree_key_t *key, void **val);
+
+/**
+ * @brief Walk a tree in ascending key order
+ *
+ * @param tree Tree.
+ * @param iter Name of a struct sys_btree_iter variable used for the walk.
+ * @param key Name of a sys_btree_key_t variable set to each key.
+ * @param val Name of a void pointer variable set to each value.
+ */
+#define SYS_BTREE_FOR_EACH(tree, iter, key, val)                                            \
+	for (sys_btree_iter_seek((tree), 0, &(iter));                                       \
+	     sys_btree_iter_next(&(iter), &(key), &(val));)
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* ZEPHYR_INCLUDE_SYS_BTREE_H_ */
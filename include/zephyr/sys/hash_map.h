@@ -20,6 +20,7 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/sys/hash_map_api.h>
+#include <zephyr/sys/hash_map_conc.h>
 #include <zephyr/sys/hash_map_cxx.h>
 #include <zephyr/sys/hash_map_oa_lp.h>
 #include <zephyr/sys/hash_map_sc.h>
@@ -306,6 +307,9 @@ static inline size_t sys_hashmap_num_buckets(const struct sys_hashmap *map)
  * @note The number of reserved entries is implementation-defined, but it is only considered
  * as part of the load factor when growing the hash table.
  *
+ * @note With @kconfig{CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH}, the Hashmap only shrinks
+ * below half of the load factor, so that a resize is not undone before its migration ends.
+ *
  * @param map Hashmap to examine
  * @param grow true if an entry is to be added. false if an entry has been removed
  * @param num_reserved the number of reserved entries
@@ -352,7 +356,10 @@ static inline bool sys_hashmap_should_rehash(const struct sys_hashmap *map, bool
 		grow && (data->n_buckets == 0 ||
 			 (size + num_reserved) * 100 / data->n_buckets > map->config->load_factor);
 	should_shrink =
-		shrink && (n_buckets == 0 || (size * 100) / n_buckets <= map->config->load_factor);
+		shrink && (n_buckets == 0 ||
+			   (size * 100) / n_buckets <=
+				   map->config->load_factor /
+					   (IS_ENABLED(CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH) ? 2 : 1));
 
 	return should_grow || should_shrink;
 }
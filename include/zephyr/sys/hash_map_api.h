@@ -231,6 +231,21 @@ struct sys_hashmap_data {
 	size_t size;
 };
 
+/**
+ * @brief State of an incremental rehash
+ *
+ * Used by the Hashmap implementations supporting
+ * @kconfig{CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH}.
+ */
+struct sys_hashmap_rehash {
+	/** Buckets being migrated to the current ones, `NULL` when there are none */
+	void *old_buckets;
+	/** The number of buckets at @a old_buckets */
+	size_t old_n_buckets;
+	/** The number of buckets at @a old_buckets already migrated */
+	size_t migrated;
+};
+
 /** @} */
 
 #ifdef __cplusplus
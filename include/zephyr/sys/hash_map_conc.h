@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @ingroup hashmap_implementations
+ * @brief Concurrent Read-Mostly Hashmap Implementation
+ *
+ * The entries are spread over @kconfig{CONFIG_SYS_HASH_MAP_CONC_SHARDS}
+ * shards, each an open addressing table with its own writer spinlock and
+ * sequence counter. Lookups take no lock: they retry when a writer
+ * modified their shard meanwhile. Writers only serialize with the other
+ * writers of their shard.
+ *
+ * A shard outgrowing its load factor moves its entries to a table twice
+ * as large a few buckets at a time, on each following write, so that no
+ * insertion pays for a whole rehash. Tables are freed once all the
+ * lookups which might still read them are done.
+ *
+ * Insertion and removal may allocate, free or sleep and must be called
+ * from threads. Lookups may also be done from ISRs. Iteration and
+ * sys_hashmap_clear() must not run concurrently with modifications.
+ *
+ * @note Enable with @kconfig{CONFIG_SYS_HASH_MAP_CONC}
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_HASH_MAP_CONC_H_
+#define ZEPHYR_INCLUDE_SYS_HASH_MAP_CONC_H_
+
+#include <stddef.h>
+
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/hash_function.h>
+#include <zephyr/sys/hash_map_api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(CONFIG_SYS_HASH_MAP_CONC) || defined(__DOXYGEN__)
+
+/** @cond INTERNAL_HIDDEN */
+struct sys_hashmap_conc_shard {
+	struct k_spinlock lock;
+	atomic_t seq;
+	atomic_ptr_t table;
+	atomic_ptr_t old;
+	size_t migrated;
+	void *retired;
+};
+
+struct sys_hashmap_conc_data {
+	void *buckets;
+	size_t n_buckets;
+	size_t size;
+	atomic_t epoch;
+	atomic_t readers[2][CONFIG_MP_MAX_NUM_CPUS];
+	struct sys_hashmap_conc_shard shards[CONFIG_SYS_HASH_MAP_CONC_SHARDS];
+};
+/** @endcond */
+
+/**
+ * @brief Declare a Concurrent Hashmap (advanced)
+ *
+ * Declare a Concurrent Hashmap with control over advanced parameters.
+ *
+ * @note The allocator @p _alloc is used for allocating internal Hashmap
+ * entries and does not interact with any user-provided keys or values.
+ *
+ * @param _name Name of the Hashmap.
+ * @param _hash_func Hash function pointer of type @ref sys_hash_func32_t.
+ * @param _alloc_func Allocator function pointer of type @ref sys_hashmap_allocator_t.
+ * @param ... Variant-specific details for @ref sys_hashmap_config.
+ */
+#define SYS_HASHMAP_CONC_DEFINE_ADVANCED(_name, _hash_func, _alloc_func, ...)                      \
+	SYS_HASHMAP_DEFINE_ADVANCED(_name, &sys_hashmap_conc_api, sys_hashmap_config,              \
+				    sys_hashmap_conc_data, _hash_func, _alloc_func, __VA_ARGS__)
+
+/**
+ * @brief Declare a Concurrent Hashmap statically (advanced)
+ *
+ * Declare a Concurrent Hashmap statically with control over advanced parameters.
+ *
+ * @note The allocator @p _alloc is used for allocating internal Hashmap
+ * entries and does not interact with any user-provided keys or values.
+ *
+ * @param _name Name of the Hashmap.
+ * @param _hash_func Hash function pointer of type @ref sys_hash_func32_t.
+ * @param _alloc_func Allocator function pointer of type @ref sys_hashmap_allocator_t.
+ * @param ... Details for @ref sys_hashmap_config.
+ */
+#define SYS_HASHMAP_CONC_DEFINE_STATIC_ADVANCED(_name, _hash_func, _alloc_func, ...)               \
+	SYS_HASHMAP_DEFINE_STATIC_ADVANCED(_name, &sys_hashmap_conc_api, sys_hashmap_config,       \
+					   sys_hashmap_conc_data, _hash_func, _alloc_func,         \
+					   __VA_ARGS__)
+
+/**
+ * @brief Declare a Concurrent Hashmap statically
+ *
+ * Declare a Concurrent Hashmap statically with default parameters.
+ *
+ * @param _name Name of the Hashmap.
+ */
+#define SYS_HASHMAP_CONC_DEFINE_STATIC(_name)                                                      \
+	SYS_HASHMAP_CONC_DEFINE_STATIC_ADVANCED(                                                   \
+		_name, sys_hash32, SYS_HASHMAP_DEFAULT_ALLOCATOR,                                  \
+		SYS_HASHMAP_CONFIG(SIZE_MAX, SYS_HASHMAP_DEFAULT_LOAD_FACTOR))
+
+/**
+ * @brief Declare a Concurrent Hashmap
+ *
+ * Declare a Concurrent Hashmap with default parameters.
+ *
+ * @param _name Name of the Hashmap.
+ */
+#define SYS_HASHMAP_CONC_DEFINE(_name)                                                             \
+	SYS_HASHMAP_CONC_DEFINE_ADVANCED(                                                          \
+		_name, sys_hash32, SYS_HASHMAP_DEFAULT_ALLOCATOR,                                  \
+		SYS_HASHMAP_CONFIG(SIZE_MAX, SYS_HASHMAP_DEFAULT_LOAD_FACTOR))
+
+#ifdef CONFIG_SYS_HASH_MAP_CHOICE_CONC
+#define SYS_HASHMAP_DEFAULT_DEFINE(_name)	 SYS_HASHMAP_CONC_DEFINE(_name)
+#define SYS_HASHMAP_DEFAULT_DEFINE_STATIC(_name) SYS_HASHMAP_CONC_DEFINE_STATIC(_name)
+#define SYS_HASHMAP_DEFAULT_DEFINE_ADVANCED(_name, _hash_func, _alloc_func, ...)                   \
+	SYS_HASHMAP_CONC_DEFINE_ADVANCED(_name, _hash_func, _alloc_func, __VA_ARGS__)
+#define SYS_HASHMAP_DEFAULT_DEFINE_STATIC_ADVANCED(_name, _hash_func, _alloc_func, ...)            \
+	SYS_HASHMAP_CONC_DEFINE_STATIC_ADVANCED(_name, _hash_func, _alloc_func, __VA_ARGS__)
+#endif
+
+extern const struct sys_hashmap_api sys_hashmap_conc_api;
+
+#endif /* CONFIG_SYS_HASH_MAP_CONC */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_HASH_MAP_CONC_H_ */
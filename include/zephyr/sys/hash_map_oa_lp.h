@@ -29,6 +29,9 @@ struct sys_hashmap_oa_lp_data {
 	size_t n_buckets;
 	size_t size;
 	size_t n_tombstones;
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	struct sys_hashmap_rehash rehash;
+#endif
 };
 
 /**
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_HEAP_TRACKER_H_
+#define ZEPHYR_INCLUDE_SYS_HEAP_TRACKER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <zephyr/sys/sys_heap.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct k_thread;
+
+#if defined(CONFIG_SYS_HEAP_TRACKER) || defined(__DOXYGEN__)
+
+/**
+ * @defgroup heap_tracker_apis Heap Allocation Tracker APIs
+ * @ingroup heaps
+ * @{
+ */
+
+/**
+ * @brief Allocation site of the sys_heap allocations
+ *
+ * A site is identified by its heap, its allocating thread and the return
+ * addresses of its backtrace. The first one is the caller of the sys_heap
+ * API, which is the kernel heap code for k_malloc() and k_heap_alloc().
+ * The allocating thread tells those apart, as do the deeper backtraces of
+ * the architectures supporting stack walking.
+ */
+struct sys_heap_tracker_site {
+	/** Heap of the allocations, NULL for the site of the untracked ones */
+	struct sys_heap *heap;
+	/** Allocating thread, NULL for allocations from ISRs */
+	struct k_thread *thread;
+	/** Backtrace of the allocation call, innermost first */
+	uintptr_t pc[CONFIG_SYS_HEAP_TRACKER_DEPTH];
+	/** Bytes of the live allocations, chunk overhead included */
+	size_t bytes;
+	/** High-water mark of @ref bytes */
+	size_t max_bytes;
+	/** Number of live allocations */
+	uint32_t count;
+	/** Number of allocations made */
+	uint32_t allocs;
+	/** Live allocations between two free chunks, at the last fragmentation map */
+	uint32_t pinning;
+};
+
+/**
+ * @brief Fragmentation summary of a heap
+ */
+struct sys_heap_frag_info {
+	/** Total size of the free chunks */
+	size_t free_bytes;
+	/** Size of the largest free chunk */
+	size_t largest_free;
+	/** Number of free chunks */
+	uint32_t free_chunks;
+	/** Number of used chunks */
+	uint32_t used_chunks;
+};
+
+/**
+ * @typedef sys_heap_tracker_site_cb_t
+ * @brief Callback of sys_heap_tracker_foreach()
+ *
+ * @param site Copy of the site statistics.
+ * @param user_data User data given to sys_heap_tracker_foreach().
+ *
+ * @return true to continue, false to stop the iteration.
+ */
+typedef bool (*sys_heap_tracker_site_cb_t)(const struct sys_heap_tracker_site *site,
+					   void *user_data);
+
+/**
+ * @brief Iterate over the allocation sites
+ *
+ * The callback gets a copy of each site and is called without any lock
+ * held, so it may print or allocate.
+ *
+ * @param heap Heap whose sites to report, NULL for all heaps.
+ * @param cb Callback.
+ * @param user_data User data passed to the callback.
+ */
+void sys_heap_tracker_foreach(struct sys_heap *heap, sys_heap_tracker_site_cb_t cb,
+			      void *user_data);
+
+/**
+ * @brief Get the number of untracked allocations
+ *
+ * Allocations are not tracked when the table of the
+ * CONFIG_SYS_HEAP_TRACKER_CHUNKS live allocations is full.
+ *
+ * @return Number of allocations which could not be tracked.
+ */
+uint32_t sys_heap_tracker_untracked_get(void);
+
+/**
+ * @brief Reset the high-water marks of all the sites to their current usage
+ */
+void sys_heap_tracker_reset_max(void);
+
+/**
+ * @brief Build a fragmentation map of a heap
+ *
+ * Each character of @p map covers an equal share of the heap: '.' if it is
+ * free, '#' if it is used and '+' if it is partly used. The live
+ * allocations found between two free chunks are counted in the
+ * @ref sys_heap_tracker_site.pinning field of their site, which points at
+ * the fragmentation hot spots.
+ *
+ * The heap must not be used concurrently, e.g. by holding the lock of its
+ * k_heap. Chunks cached by CONFIG_SYS_HEAP_SIZE_CLASSES are shown as used.
+ *
+ * @param heap Heap to map.
+ * @param map Buffer of @p cells characters plus a terminating NUL, or NULL.
+ * @param cells Number of map cells.
+ * @param info Set to the fragmentation summary of the heap, or NULL.
+ */
+void sys_heap_tracker_frag_map(struct sys_heap *heap, char *map, size_t cells,
+			       struct sys_heap_frag_info *info);
+
+/**
+ * @}
+ */
+
+#endif /* CONFIG_SYS_HEAP_TRACKER */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_HEAP_TRACKER_H_ */
@@ -0,0 +1,481 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SYS_MPMC_LOCKFREE_H_
+#define ZEPHYR_SYS_MPMC_LOCKFREE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <zephyr/toolchain/common.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util_macro.h>
+
+#ifdef CONFIG_MULTITHREADING
+#include <zephyr/kernel.h>
+#endif
+
+/**
+ * @brief Multiple Producer Multiple Consumer (MPMC) Lockfree Queue API
+ * @defgroup mpmc_lockfree MPMC Lockfree Queue API
+ * @ingroup datastructure_apis
+ * @{
+ */
+
+/**
+ * @file mpmc_lockfree.h
+ *
+ * @brief A lock-free and type safe power of 2 fixed sized multiple producer
+ * multiple consumer (MPMC) queue using a ringbuffer with per-slot sequence
+ * numbers.
+ *
+ * Based on the bounded MPMC queue described by Dmitry Vyukov. Producers and
+ * consumers each claim a position with a compare-and-swap on a shared index,
+ * then copy the element in or out of the slot and publish it by updating the
+ * sequence number of the slot. Elements are copied, so they are expected to
+ * be small and of a fixed size. The API is type safe as the underlying buffer
+ * is typed and all usage is done through macros.
+ *
+ * An MPMC queue is safe to produce or consume in any number of ISRs and
+ * threads with O(1) push/pop, save for retries of the compare-and-swap.
+ *
+ * @note A push or pop may report the queue full or empty while another
+ * context is in the middle of an operation on the next slot, even though
+ * other slots could be used. The blocking wrappers handle this by retrying
+ * once that context has finished.
+ */
+
+/**
+ * @private
+ * @brief Common MPMC attributes
+ *
+ * The sequence number of slot i is stored relative to i, so that an all
+ * zero queue is empty and ready for use.
+ *
+ * @warning Not to be manipulated without the macros!
+ */
+struct mpmc {
+	/* position of the next element to produce */
+	atomic_t head;
+
+	/* position of the next element to consume */
+	atomic_t tail;
+
+	/* mask used to automatically wrap values */
+	const unsigned long mask;
+
+	/* per-slot sequence numbers */
+	atomic_t *const seq;
+};
+
+/**
+ * @private
+ * @brief Statically initialize the common MPMC attributes
+ */
+#define Z_MPMC_INITIALIZER(sz, seq_buf)                                                            \
+	{                                                                                          \
+		.head = ATOMIC_INIT(0),                                                            \
+		.tail = ATOMIC_INIT(0),                                                            \
+		.mask = sz - 1,                                                                    \
+		.seq = seq_buf,                                                                    \
+	}
+
+/**
+ * @brief Statically initialize an mpmc
+ *
+ * @param sz Size of the mpmc, must be power of 2 (ex: 2, 4, 8)
+ * @param buf Buffer pointer
+ * @param seq_buf Sequence number buffer pointer, with @p sz entries
+ */
+#define MPMC_INITIALIZER(sz, buf, seq_buf)                                                         \
+	{                                                                                          \
+		._mpmc = Z_MPMC_INITIALIZER(sz, seq_buf),                                          \
+		.buffer = buf,                                                                     \
+	}
+
+/**
+ * @brief Declare an anonymous struct type for an mpmc
+ *
+ * @param name Name of the mpmc symbol to be provided
+ * @param type Type stored in the mpmc
+ */
+#define MPMC_DECLARE(name, type)                                                                   \
+	static struct mpmc_##name {                                                                \
+		struct mpmc _mpmc;                                                                 \
+		type * const buffer;                                                               \
+	}
+
+/**
+ * @brief Define an mpmc with a fixed size
+ *
+ * @param name Name of the mpmc symbol to be provided
+ * @param type Type stored in the mpmc
+ * @param sz Size of the mpmc, must be power of 2 (ex: 2, 4, 8)
+ */
+#define MPMC_DEFINE(name, type, sz)                                                                \
+	BUILD_ASSERT(IS_POWER_OF_TWO(sz));                                                         \
+	static type __mpmc_buf_##name[sz];                                                         \
+	static atomic_t __mpmc_seq_##name[sz];                                                     \
+	MPMC_DECLARE(name, type) name =                                                            \
+		MPMC_INITIALIZER(sz, __mpmc_buf_##name, __mpmc_seq_##name);
+
+/**
+ * @brief Size of the MPMC queue
+ *
+ * @param mpmc MPMC reference
+ */
+#define mpmc_size(mpmc) ((mpmc)->_mpmc.mask + 1)
+
+/**
+ * @private
+ * @brief Load the sequence number of a slot
+ */
+static inline unsigned long z_mpmc_seq_get(struct mpmc *q, unsigned long slot)
+{
+	return (unsigned long)atomic_get(&q->seq[slot]) + slot;
+}
+
+/**
+ * @private
+ * @brief Publish the sequence number of a slot
+ */
+static inline void z_mpmc_seq_set(struct mpmc *q, unsigned long slot, unsigned long seq)
+{
+	(void)atomic_set(&q->seq[slot], (atomic_val_t)(seq - slot));
+}
+
+/**
+ * @private
+ * @brief Claim a position of the queue
+ *
+ * @param q MPMC to claim from
+ * @param idx Index to claim a position from, head or tail
+ * @param ready Offset of the sequence number of a usable slot from its
+ *              position: 0 for producing, 1 for consuming
+ * @param pos Claimed position
+ *
+ * @return true if a position was claimed, false if the queue is full or empty
+ */
+static inline bool z_mpmc_claim(struct mpmc *q, atomic_t *idx, unsigned long ready,
+				unsigned long *pos)
+{
+	unsigned long p = (unsigned long)atomic_get(idx);
+
+	for (;;) {
+		long diff = (long)(z_mpmc_seq_get(q, p & q->mask) - (p + ready));
+
+		if (diff == 0) {
+			if (atomic_cas(idx, (atomic_val_t)p, (atomic_val_t)(p + 1))) {
+				*pos = p;
+				return true;
+			}
+		} else if (diff < 0) {
+			/* The slot still holds the data of the previous lap */
+			return false;
+		} else {
+			/* Another context claimed the position already */
+		}
+		p = (unsigned long)atomic_get(idx);
+	}
+}
+
+/**
+ * @private
+ * @brief Copy an element into the queue
+ */
+static inline bool z_mpmc_push(struct mpmc *q, void *buf, size_t size, const void *val)
+{
+	unsigned long pos;
+
+	if (!z_mpmc_claim(q, &q->head, 0, &pos)) {
+		return false;
+	}
+
+	memcpy((uint8_t *)buf + (pos & q->mask) * size, val, size);
+	z_mpmc_seq_set(q, pos & q->mask, pos + 1);
+
+	return true;
+}
+
+/**
+ * @private
+ * @brief Copy an element out of the queue
+ */
+static inline bool z_mpmc_pop(struct mpmc *q, void *buf, size_t size, void *val)
+{
+	unsigned long pos;
+
+	if (!z_mpmc_claim(q, &q->tail, 1, &pos)) {
+		return false;
+	}
+
+	memcpy(val, (uint8_t *)buf + (pos & q->mask) * size, size);
+	z_mpmc_seq_set(q, pos & q->mask, pos + q->mask + 1);
+
+	return true;
+}
+
+/**
+ * @brief Initialize/reset an mpmc such that its empty
+ *
+ * Note that this is not safe to do while being used in a producer/consumer
+ * situation with multiple calling contexts (isrs/threads).
+ *
+ * @param mpmc MPMC to initialize/reset
+ */
+#define mpmc_reset(mpmc)                                                                           \
+	({                                                                                         \
+		atomic_set(&(mpmc)->_mpmc.head, 0);                                                \
+		atomic_set(&(mpmc)->_mpmc.tail, 0);                                                \
+		for (unsigned long _i = 0; _i < mpmc_size(mpmc); _i++) {                           \
+			atomic_set(&(mpmc)->_mpmc.seq[_i], 0);                                     \
+		}                                                                                  \
+	})
+
+/**
+ * @brief Copy an element into the mpmc
+ *
+ * @param mpmc MPMC to produce into
+ * @param val Pointer to the element to copy into the queue
+ *
+ * @return true if the element was queued, false if the mpmc is full
+ */
+#define mpmc_push(mpmc, val)                                                                       \
+	({                                                                                         \
+		const __typeof__((mpmc)->buffer[0]) *_mpmc_val = (val);                            \
+		z_mpmc_push(&(mpmc)->_mpmc, (mpmc)->buffer, sizeof((mpmc)->buffer[0]), _mpmc_val); \
+	})
+
+/**
+ * @brief Copy an element out of the mpmc
+ *
+ * @param mpmc MPMC to consume from
+ * @param val Pointer to the memory to copy the element into
+ *
+ * @return true if an element was dequeued, false if the mpmc is empty
+ */
+#define mpmc_pop(mpmc, val)                                                                        \
+	({                                                                                         \
+		__typeof__((mpmc)->buffer[0]) *_mpmc_val = (val);                                  \
+		z_mpmc_pop(&(mpmc)->_mpmc, (mpmc)->buffer, sizeof((mpmc)->buffer[0]), _mpmc_val);  \
+	})
+
+/**
+ * @brief Count of consumables in mpmc
+ *
+ * The value is only a snapshot when other contexts use the queue.
+ *
+ * @param mpmc MPMC to get item count for
+ */
+#define mpmc_consumable(mpmc)                                                                      \
+	({                                                                                         \
+		(unsigned long)atomic_get(&(mpmc)->_mpmc.head) -                                   \
+			(unsigned long)atomic_get(&(mpmc)->_mpmc.tail);                            \
+	})
+
+#if defined(CONFIG_MULTITHREADING) || defined(__DOXYGEN__)
+
+/**
+ * @private
+ * @brief Wait state of a blocking MPMC
+ *
+ * The semaphores are only given while threads wait, so uncontended push and
+ * pop stay lock-free. A waiter announces itself before it checks the queue a
+ * last time, so that it cannot miss the element of a concurrent producer.
+ */
+struct z_mpmc_wait {
+	/* given on push while consumers wait or poll */
+	struct k_sem items;
+
+	/* given on pop while producers wait */
+	struct k_sem space;
+
+	atomic_t pop_waiters;
+	atomic_t push_waiters;
+};
+
+/**
+ * @brief Define a blocking mpmc with a fixed size
+ *
+ * On top of the mpmc API, a blocking mpmc can be used with mpmc_push_wait(),
+ * mpmc_pop_wait() and k_poll(). Its semaphores are not kernel objects that
+ * can be granted to user threads.
+ *
+ * @param name Name of the mpmc symbol to be provided
+ * @param type Type stored in the mpmc
+ * @param sz Size of the mpmc, must be power of 2 (ex: 2, 4, 8)
+ */
+#define MPMC_WAIT_DEFINE(name, type, sz)                                                           \
+	BUILD_ASSERT(IS_POWER_OF_TWO(sz));                                                         \
+	static type __mpmc_buf_##name[sz];                                                         \
+	static atomic_t __mpmc_seq_##name[sz];                                                     \
+	static struct mpmc_##name {                                                                \
+		struct mpmc _mpmc;                                                                 \
+		type * const buffer;                                                               \
+		struct z_mpmc_wait _wait;                                                          \
+	} name = {                                                                                 \
+		._mpmc = Z_MPMC_INITIALIZER(sz, __mpmc_seq_##name),                                \
+		.buffer = __mpmc_buf_##name,                                                       \
+		._wait = {                                                                         \
+			.items = Z_SEM_INITIALIZER(name._wait.items, 0, sz),                       \
+			.space = Z_SEM_INITIALIZER(name._wait.space, 0, sz),                       \
+			.pop_waiters = ATOMIC_INIT(0),                                             \
+			.push_waiters = ATOMIC_INIT(0),                                            \
+		},                                                                                 \
+	}
+
+/**
+ * @private
+ * @brief Wait until @p op succeeds, announced in @p waiters, or @p sem times out
+ */
+#define Z_MPMC_WAIT(op, waiters, sem, timeout)                                                     \
+	({                                                                                         \
+		k_timepoint_t _end = sys_timepoint_calc(timeout);                                  \
+		int _ret = 0;                                                                      \
+		while (!(op)) {                                                                    \
+			bool _done;                                                                \
+			atomic_inc(waiters);                                                       \
+			_done = (op);                                                              \
+			if (!_done) {                                                              \
+				_ret = k_sem_take(sem, sys_timepoint_timeout(_end));               \
+			}                                                                          \
+			atomic_dec(waiters);                                                       \
+			if (_done || (_ret != 0)) {                                                \
+				break;                                                             \
+			}                                                                          \
+		}                                                                                  \
+		_ret;                                                                              \
+	})
+
+/**
+ * @private
+ * @brief Wake up a waiter of the other side, if any
+ */
+static inline void z_mpmc_wake(atomic_t *waiters, struct k_sem *sem)
+{
+	if (atomic_get(waiters) != 0) {
+		k_sem_give(sem);
+	}
+}
+
+/**
+ * @brief Copy an element into a blocking mpmc, waiting for space
+ *
+ * @param mpmc Blocking MPMC to produce into
+ * @param val Pointer to the element to copy into the queue
+ * @param timeout Waiting period for space, or one of the special values
+ *                K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Element queued
+ * @retval -EBUSY Returned without waiting
+ * @retval -EAGAIN Waiting period timed out
+ */
+#define mpmc_push_wait(mpmc, val, timeout)                                                         \
+	({                                                                                         \
+		int _mpmc_ret = Z_MPMC_WAIT(mpmc_push(mpmc, val), &(mpmc)->_wait.push_waiters,     \
+					    &(mpmc)->_wait.space, timeout);                        \
+		if (_mpmc_ret == 0) {                                                              \
+			z_mpmc_wake(&(mpmc)->_wait.pop_waiters, &(mpmc)->_wait.items);             \
+		}                                                                                  \
+		_mpmc_ret;                                                                         \
+	})
+
+/**
+ * @brief Copy an element out of a blocking mpmc, waiting for one
+ *
+ * @param mpmc Blocking MPMC to consume from
+ * @param val Pointer to the memory to copy the element into
+ * @param timeout Waiting period for an element, or one of the special values
+ *                K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Element dequeued
+ * @retval -EBUSY Returned without waiting
+ * @retval -EAGAIN Waiting period timed out
+ */
+#define mpmc_pop_wait(mpmc, val, timeout)                                                          \
+	({                                                                                         \
+		int _mpmc_ret = Z_MPMC_WAIT(mpmc_pop(mpmc, val), &(mpmc)->_wait.pop_waiters,       \
+					    &(mpmc)->_wait.items, timeout);                        \
+		if (_mpmc_ret == 0) {                                                              \
+			z_mpmc_wake(&(mpmc)->_wait.push_waiters, &(mpmc)->_wait.space);            \
+		}                                                                                  \
+		_mpmc_ret;                                                                         \
+	})
+
+/**
+ * @brief Reset a blocking mpmc and drop pending wake ups
+ *
+ * No thread may use or wait on the mpmc while it is reset.
+ *
+ * @param mpmc Blocking MPMC to reset
+ */
+#define mpmc_wait_reset(mpmc)                                                                      \
+	({                                                                                         \
+		mpmc_reset(mpmc);                                                                  \
+		k_sem_reset(&(mpmc)->_wait.items);                                                 \
+		k_sem_reset(&(mpmc)->_wait.space);                                                 \
+	})
+
+#if defined(CONFIG_POLL) || defined(__DOXYGEN__)
+
+/**
+ * @brief Initialize a poll event for elements of a blocking mpmc
+ *
+ * The event is a K_POLL_TYPE_SEM_AVAILABLE event. Until
+ * mpmc_poll_event_cleanup() is called, every push gives the semaphore of the
+ * event, at the cost of a lock. Once k_poll() reports the event,
+ * mpmc_poll_pop() gets the element.
+ *
+ * @param mpmc Blocking MPMC to poll
+ * @param event Poll event to initialize
+ */
+#define mpmc_poll_event_init(mpmc, event)                                                          \
+	({                                                                                         \
+		atomic_inc(&(mpmc)->_wait.pop_waiters);                                            \
+		k_poll_event_init(event, K_POLL_TYPE_SEM_AVAILABLE, K_POLL_MODE_NOTIFY_ONLY,       \
+				  &(mpmc)->_wait.items);                                           \
+	})
+
+/**
+ * @brief Stop using a poll event of a blocking mpmc
+ *
+ * @param mpmc Blocking MPMC passed to mpmc_poll_event_init()
+ */
+#define mpmc_poll_event_cleanup(mpmc) atomic_dec(&(mpmc)->_wait.pop_waiters)
+
+/**
+ * @brief Copy an element out of a blocking mpmc after polling it
+ *
+ * Consumes the notification of the poll event along with the element.
+ *
+ * @param mpmc Blocking MPMC that was polled
+ * @param val Pointer to the memory to copy the element into
+ *
+ * @retval 0 Element dequeued
+ * @retval -EBUSY No notification pending
+ * @retval -EAGAIN The element was taken by another consumer, poll again
+ */
+#define mpmc_poll_pop(mpmc, val)                                                                   \
+	({                                                                                         \
+		int _mpmc_ret = k_sem_take(&(mpmc)->_wait.items, K_NO_WAIT);                       \
+		if (_mpmc_ret == 0) {                                                              \
+			_mpmc_ret = mpmc_pop(mpmc, val) ? 0 : -EAGAIN;                             \
+		}                                                                                  \
+		if (_mpmc_ret == 0) {                                                              \
+			z_mpmc_wake(&(mpmc)->_wait.push_waiters, &(mpmc)->_wait.space);            \
+		}                                                                                  \
+		_mpmc_ret;                                                                         \
+	})
+
+#endif /* CONFIG_POLL */
+
+#endif /* CONFIG_MULTITHREADING */
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_SYS_MPMC_LOCKFREE_H_ */
@@ -11,9 +11,8 @@
  * sys_mutex behaves almost exactly like k_mutex, with the added advantage
  * that a sys_mutex instance can reside in user memory.
  *
- * Further enhancements will support locking/unlocking uncontended sys_mutexes
- * with simple atomic ops instead of syscalls, similar to Linux's
- * FUTEX_LOCK_PI and FUTEX_UNLOCK_PI
+ * Uncontended sys_mutexes are locked and unlocked with simple atomic ops
+ * instead of syscalls, similar to Linux's FUTEX_LOCK_PI and FUTEX_UNLOCK_PI.
  */
 
 #ifdef __cplusplus
@@ -21,16 +20,25 @@ extern "C" {
 #endif
 
 #ifdef CONFIG_USERSPACE
+#include <zephyr/kernel.h>
 #include <zephyr/sys/atomic.h>
+#include <zephyr/sys/sync_stats.h>
 #include <zephyr/types.h>
 #include <zephyr/sys_clock.h>
 
+/* Set in sys_mutex::val while the kernel tracks the owner */
+#define Z_SYS_MUTEX_KERNEL BIT(0)
+
 struct sys_mutex {
-	/* Currently unused, but will be used to store state for fast mutexes
-	 * that can be locked/unlocked with atomic ops if there is no
-	 * contention
+	/* 0 if unlocked, otherwise the owner thread ID. The owner is
+	 * tagged with Z_SYS_MUTEX_KERNEL once the mutex was locked
+	 * recursively or contended, and only the kernel changes the value
+	 * from then on.
 	 */
 	atomic_t val;
+#ifdef CONFIG_SYS_SYNC_STATS
+	struct sys_sync_stats stats;
+#endif
 };
 
 /**
@@ -79,6 +87,39 @@ __syscall int z_sys_mutex_kernel_lock(struct sys_mutex *mutex,
 
 __syscall int z_sys_mutex_kernel_unlock(struct sys_mutex *mutex);
 
+#ifdef CONFIG_CURRENT_THREAD_USE_TLS
+/* Number of mutexes per thread the atomic fast path is open for */
+#define Z_SYS_MUTEX_CHECKED_NUM 4
+
+/* Mutexes the kernel accepted from the current thread, the atomic fast
+ * path is only taken for them so that bad or inaccessible addresses still
+ * get -EINVAL or -EACCES from the syscall rather than faulting.
+ */
+extern __thread struct sys_mutex *z_sys_mutex_checked[Z_SYS_MUTEX_CHECKED_NUM];
+extern __thread uint8_t z_sys_mutex_checked_next;
+
+static inline bool z_sys_mutex_is_checked(struct sys_mutex *mutex)
+{
+	for (int i = 0; i < Z_SYS_MUTEX_CHECKED_NUM; i++) {
+		if (z_sys_mutex_checked[i] == mutex) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static inline void z_sys_mutex_checked_add(struct sys_mutex *mutex)
+{
+	if (z_sys_mutex_is_checked(mutex)) {
+		return;
+	}
+
+	z_sys_mutex_checked[z_sys_mutex_checked_next] = mutex;
+	z_sys_mutex_checked_next = (z_sys_mutex_checked_next + 1U) % Z_SYS_MUTEX_CHECKED_NUM;
+}
+#endif /* CONFIG_CURRENT_THREAD_USE_TLS */
+
 /**
  * @brief Lock a mutex.
  *
@@ -89,6 +130,10 @@ __syscall int z_sys_mutex_kernel_unlock(struct sys_mutex *mutex);
  * A thread is permitted to lock a mutex it has already locked. The operation
  * completes immediately and the lock count is increased by 1.
  *
+ * With CONFIG_CURRENT_THREAD_USE_TLS, once the kernel accepted a mutex from
+ * the calling thread, the mutex is locked with an atomic op on its memory
+ * while it is free, and the kernel is only entered if that fails.
+ *
  * @param mutex Address of the mutex, which may reside in user memory
  * @param timeout Waiting period to lock the mutex,
  *                or one of the special values K_NO_WAIT and K_FOREVER.
@@ -101,8 +146,30 @@ __syscall int z_sys_mutex_kernel_unlock(struct sys_mutex *mutex);
  */
 static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
 {
-	/* For now, make the syscall unconditionally */
-	return z_sys_mutex_kernel_lock(mutex, timeout);
+	int ret;
+
+#ifdef CONFIG_CURRENT_THREAD_USE_TLS
+	/* Getting the thread ID costs no syscall, take a free mutex with
+	 * a single atomic op
+	 */
+	if (z_sys_mutex_is_checked(mutex) &&
+	    atomic_cas(&mutex->val, 0, (atomic_val_t)k_current_get())) {
+		Z_SYS_SYNC_STATS_INC(mutex, fast);
+		return 0;
+	}
+#endif
+
+	ret = z_sys_mutex_kernel_lock(mutex, timeout);
+
+	/* The mutex memory is only touched once the kernel validated it */
+	if ((ret != -EINVAL) && (ret != -EACCES)) {
+		Z_SYS_SYNC_STATS_INC(mutex, slow);
+#ifdef CONFIG_CURRENT_THREAD_USE_TLS
+		z_sys_mutex_checked_add(mutex);
+#endif
+	}
+
+	return ret;
 }
 
 /**
@@ -124,9 +191,44 @@ static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
  */
 static inline int sys_mutex_unlock(struct sys_mutex *mutex)
 {
-	/* For now, make the syscall unconditionally */
-	return z_sys_mutex_kernel_unlock(mutex);
+	int ret;
+
+#ifdef CONFIG_CURRENT_THREAD_USE_TLS
+	/* Fails if the kernel took over the mutex, it has to wake a waiter
+	 * or unwind a recursive lock
+	 */
+	if (z_sys_mutex_is_checked(mutex) &&
+	    atomic_cas(&mutex->val, (atomic_val_t)k_current_get(), 0)) {
+		Z_SYS_SYNC_STATS_INC(mutex, fast);
+		return 0;
+	}
+#endif
+
+	ret = z_sys_mutex_kernel_unlock(mutex);
+	if ((ret != -EINVAL) && (ret != -EACCES)) {
+		Z_SYS_SYNC_STATS_INC(mutex, slow);
+	}
+
+	return ret;
+}
+
+#ifdef CONFIG_SYS_SYNC_STATS
+/**
+ * @brief Get the fast path statistics of a mutex.
+ *
+ * The counters give how many lock and unlock operations completed in user
+ * memory and how many had to make a syscall.
+ *
+ * @param mutex Address of the mutex
+ * @param stats Filled with a copy of the counters
+ */
+static inline void sys_mutex_stats_get(struct sys_mutex *mutex,
+				       struct sys_sync_stats *stats)
+{
+	stats->fast = atomic_get(&mutex->stats.fast);
+	stats->slow = atomic_get(&mutex->stats.slow);
 }
+#endif /* CONFIG_SYS_SYNC_STATS */
 
 #include <zephyr/syscalls/mutex.h>
 
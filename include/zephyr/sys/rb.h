@@ -52,6 +52,10 @@
 #include <alloca.h>
 #endif
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /**
  * @brief Balanced red/black tree node structure
  */
@@ -237,4 +241,8 @@ struct rbnode *z_rb_foreach_next(struct rbtree *tree, struct _rb_foreach *f);
 
 /** @} */
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* ZEPHYR_INCLUDE_SYS_RB_H_ */
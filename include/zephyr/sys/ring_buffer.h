@@ -51,6 +51,16 @@ struct ring_buf {
 	/** @endcond */
 };
 
+/**
+ * @brief A contiguous segment of a ring buffer
+ */
+struct ring_buf_vec {
+	/** Start of the segment */
+	uint8_t *data;
+	/** Size of the segment (in bytes), 0 if unused */
+	uint32_t size;
+};
+
 /**
  * @brief Function to force ring_buf internal states to given value
  *
@@ -311,6 +321,35 @@ uint32_t ring_buf_put_claim(struct ring_buf *buf,
  */
 int ring_buf_put_finish(struct ring_buf *buf, uint32_t size);
 
+/**
+ * @brief Allocate buffers for writing data to a ring buffer, across the wrap.
+ *
+ * This works like @ref ring_buf_put_claim but also claims the space at the
+ * beginning of the buffer when the allocation wraps around its end, so that
+ * a scatter-gather transfer (e.g. a DMA with two descriptors) can fill all
+ * the free space at once. The allocation is completed with
+ * @ref ring_buf_put_finish, with the number of bytes written in both
+ * segments.
+ *
+ * @warning
+ * Use cases involving multiple writers to the ring buffer must prevent
+ * concurrent write operations, either by preventing all writers from
+ * being preempted or by using a mutex to govern writes to the ring buffer.
+ *
+ * @warning
+ * Ring buffer instance should not mix byte access and item access
+ * (calls prefixed with ring_buf_item_).
+ *
+ * @param[in]  buf  Address of ring buffer.
+ * @param[out] vec  Segments within ring buffer, to be filled in order. The
+ *		    second one is empty if the allocation does not wrap.
+ * @param[in]  size Requested allocation size (in bytes).
+ *
+ * @return Total size of the allocated buffers which can be smaller than
+ *	   requested if there is not enough free space.
+ */
+uint32_t ring_buf_put_claim_vec(struct ring_buf *buf, struct ring_buf_vec vec[2], uint32_t size);
+
 /**
  * @brief Write (copy) data to a ring buffer.
  *
@@ -361,6 +400,34 @@ uint32_t ring_buf_get_claim(struct ring_buf *buf,
 			    uint8_t **data,
 			    uint32_t size);
 
+/**
+ * @brief Get addresses of valid data in a ring buffer, across the wrap.
+ *
+ * This works like @ref ring_buf_get_claim but also claims the data at the
+ * beginning of the buffer when it wraps around its end, so that a
+ * scatter-gather transfer (e.g. a DMA with two descriptors) can consume all
+ * the valid data at once. The data is freed with @ref ring_buf_get_finish,
+ * with the number of bytes processed in both segments.
+ *
+ * @warning
+ * Use cases involving multiple reads of the ring buffer must prevent
+ * concurrent read operations, either by preventing all readers from
+ * being preempted or by using a mutex to govern reads to the ring buffer.
+ *
+ * @warning
+ * Ring buffer instance should not mix byte access and item access
+ * (calls prefixed with ring_buf_item_).
+ *
+ * @param[in]  buf  Address of ring buffer.
+ * @param[out] vec  Segments within ring buffer, to be read in order. The
+ *		    second one is empty if the data does not wrap.
+ * @param[in]  size Requested size (in bytes).
+ *
+ * @return Total number of valid bytes in the segments which can be smaller
+ *	   than requested if there is not enough data.
+ */
+uint32_t ring_buf_get_claim_vec(struct ring_buf *buf, struct ring_buf_vec vec[2], uint32_t size);
+
 /**
  * @brief Indicate number of bytes read from claimed buffer.
  *
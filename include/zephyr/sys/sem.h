@@ -21,6 +21,7 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/sys/atomic.h>
+#include <zephyr/sys/sync_stats.h>
 #include <zephyr/types.h>
 #include <zephyr/sys/iterable_sections.h>
 
@@ -35,6 +36,9 @@ struct sys_sem {
 #ifdef CONFIG_USERSPACE
 	struct k_futex futex;
 	int limit;
+#ifdef CONFIG_SYS_SYNC_STATS
+	struct sys_sync_stats stats;
+#endif
 #else
 	struct k_sem kernel_sem;
 #endif
@@ -138,6 +142,24 @@ int sys_sem_take(struct sys_sem *sem, k_timeout_t timeout);
  */
 unsigned int sys_sem_count_get(struct sys_sem *sem);
 
+#ifdef CONFIG_SYS_SYNC_STATS
+/**
+ * @brief Get the fast path statistics of a sys_sem
+ *
+ * The counters give how many take and give operations completed in user
+ * memory and how many had to make a futex syscall.
+ *
+ * @param sem Address of the sys_sem.
+ * @param stats Filled with a copy of the counters.
+ */
+static inline void sys_sem_stats_get(struct sys_sem *sem,
+				     struct sys_sync_stats *stats)
+{
+	stats->fast = atomic_get(&sem->stats.fast);
+	stats->slow = atomic_get(&sem->stats.slow);
+}
+#endif /* CONFIG_SYS_SYNC_STATS */
+
 /**
  * @}
  */
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_SHARDED_HEAP_H_
+#define ZEPHYR_INCLUDE_SYS_SHARDED_HEAP_H_
+
+#include <stddef.h>
+
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/sys_heap.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sharded_heap_wrapper Sharded Heap
+ * @ingroup heaps
+ * @{
+ */
+
+/** @cond INTERNAL_HIDDEN */
+struct sys_sharded_heap_arena {
+	struct sys_heap heap;
+	struct k_spinlock lock;
+	/* Blocks freed by other CPUs, linked through their first word */
+	atomic_ptr_t remote;
+};
+/** @endcond */
+
+/**
+ * @brief Sharded heap allocator
+ *
+ * A sys_sharded_heap splits a memory region into one arena per CPU and
+ * a shared arena, each a sys_heap with its own lock. Allocations are
+ * served from the arena of the calling CPU, then from the shared arena
+ * and finally from the arenas of the other CPUs, so CPUs only contend
+ * for their arenas when one of them runs out of memory.
+ *
+ * Blocks freed by the CPU owning their arena, and blocks of the shared
+ * arena, are freed right away. Blocks freed by other CPUs are pushed
+ * on a lock-free list of their arena instead, and actually freed by
+ * the next allocation from that arena.
+ *
+ * All the functions may be called from any thread or ISR, but not from
+ * user mode.
+ */
+struct sys_sharded_heap {
+	/** @cond INTERNAL_HIDDEN */
+	/* The shared arena, then one per CPU */
+	struct sys_sharded_heap_arena arenas[CONFIG_MP_MAX_NUM_CPUS + 1];
+	unsigned int num_arenas;
+	uintptr_t cpu_base;
+	size_t cpu_bytes;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize sharded heap
+ *
+ * Splits the memory region in a shared arena of @p shared_bytes bytes,
+ * at its start, and the remainder in equal arenas for all the CPUs
+ * returned by arch_num_cpus().
+ *
+ * @param heap Sharded heap to initialize
+ * @param mem Memory of the heap
+ * @param bytes Size of the memory, in bytes
+ * @param shared_bytes Size of the shared arena, in bytes, or zero for
+ *                     none. Must be smaller than @p bytes.
+ */
+void sys_sharded_heap_init(struct sys_sharded_heap *heap, void *mem,
+			   size_t bytes, size_t shared_bytes);
+
+/**
+ * @brief Allocate memory from sharded heap
+ *
+ * Just as for sys_heap_alloc(), allocates a block of memory of the
+ * specified size in bytes, preferably from the arena of the calling
+ * CPU.
+ *
+ * @param heap Sharded heap pointer
+ * @param bytes Requested size of the allocation, in bytes
+ * @return A valid pointer to heap memory, or NULL if no memory is available
+ */
+void *sys_sharded_heap_alloc(struct sys_sharded_heap *heap, size_t bytes);
+
+/**
+ * @brief Allocate aligned memory from sharded heap
+ *
+ * Just as for sys_sharded_heap_alloc(), allocates a block of memory
+ * of the specified size in bytes. Takes an additional parameter
+ * specifying a power of two alignment, in bytes.
+ *
+ * @param heap Sharded heap pointer
+ * @param align Power of two alignment for the returned pointer, in bytes
+ * @param bytes Requested size of the allocation, in bytes
+ * @return A valid pointer to heap memory, or NULL if no memory is available
+ */
+void *sys_sharded_heap_aligned_alloc(struct sys_sharded_heap *heap,
+				     size_t align, size_t bytes);
+
+/**
+ * @brief Expand the size of an existing allocation
+ *
+ * Just as for sys_heap_aligned_realloc(), the block is first resized
+ * within its arena. When this fails, a new block is allocated as for
+ * sys_sharded_heap_aligned_alloc() and the data is copied to it.
+ *
+ * @param heap Sharded heap pointer
+ * @param ptr Original pointer returned from a previous allocation, or NULL
+ * @param align Alignment in bytes, must be a power of two
+ * @param bytes Number of bytes requested for the new block, or zero
+ * @return Pointer to memory the caller can now use, or NULL
+ */
+void *sys_sharded_heap_aligned_realloc(struct sys_sharded_heap *heap, void *ptr,
+				       size_t align, size_t bytes);
+
+/**
+ * @brief Free memory allocated from sharded heap
+ *
+ * Returns the specified block, which must be the return value of a
+ * previously successful allocation from the same sharded heap, to the
+ * arena from which it was allocated.
+ *
+ * Accepts NULL as a block parameter, which is specified to have no
+ * effect.
+ *
+ * @param heap Sharded heap pointer
+ * @param mem Block to free
+ */
+void sys_sharded_heap_free(struct sys_sharded_heap *heap, void *mem);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_SHARDED_HEAP_H_ */
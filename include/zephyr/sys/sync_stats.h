@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Fast path statistics of the user mode synchronization objects.
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_SYNC_STATS_H_
+#define ZEPHYR_INCLUDE_SYS_SYNC_STATS_H_
+
+#include <zephyr/sys/atomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Fast and slow path counters of a sys_mutex or sys_sem
+ *
+ * Only maintained with CONFIG_SYS_SYNC_STATS.
+ */
+struct sys_sync_stats {
+	/** Operations completed with atomic instructions only */
+	atomic_t fast;
+	/** Operations that had to enter the kernel */
+	atomic_t slow;
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+#ifdef CONFIG_SYS_SYNC_STATS
+#define Z_SYS_SYNC_STATS_INC(_obj, _path) ((void)atomic_inc(&(_obj)->stats._path))
+#else
+#define Z_SYS_SYNC_STATS_INC(_obj, _path) ((void)(_obj))
+#endif
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_SYNC_STATS_H_ */
@@ -63,6 +63,8 @@ struct z_heap_stress_result {
 	uint32_t total_allocs;
 	uint32_t successful_allocs;
 	uint32_t total_frees;
+	uint32_t total_reallocs;
+	uint32_t successful_reallocs;
 	uint64_t accumulated_in_use_bytes;
 };
 
@@ -72,6 +74,23 @@ struct z_heap_stress_result {
  * @{
  */
 
+/** Number of size classes with CONFIG_SYS_HEAP_SIZE_CLASSES (16 to 256 bytes) */
+#define SYS_HEAP_NUM_SIZE_CLASSES 5
+
+/**
+ * @brief Statistics of a sys_heap size class
+ */
+struct sys_heap_size_class_stats {
+	/** Allocation size of the class in bytes */
+	size_t bytes;
+	/** Number of allocation requests in the class */
+	uint32_t allocs;
+	/** Number of allocations served from cached chunks */
+	uint32_t hits;
+	/** Number of freed chunks currently cached */
+	uint32_t cached;
+};
+
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 
 /**
@@ -95,6 +114,20 @@ int sys_heap_runtime_stats_get(struct sys_heap *heap,
  */
 int sys_heap_runtime_stats_reset_max(struct sys_heap *heap);
 
+/**
+ * @brief Get the statistics of a sys_heap size class
+ *
+ * Together the classes form a histogram of the small allocations
+ * made from the heap. Requires CONFIG_SYS_HEAP_SIZE_CLASSES.
+ *
+ * @param heap Pointer to specified sys_heap
+ * @param idx Index of the size class, below SYS_HEAP_NUM_SIZE_CLASSES
+ * @param stats Pointer to struct to copy statistics into
+ * @return -EINVAL if null pointers or invalid index, otherwise 0
+ */
+int sys_heap_size_class_stats_get(struct sys_heap *heap, unsigned int idx,
+				  struct sys_heap_size_class_stats *stats);
+
 #endif
 
 /** @brief Initialize sys_heap
@@ -248,6 +281,37 @@ void sys_heap_stress(void *(*alloc_fn)(void *arg, size_t bytes),
 		     int target_percent,
 		     struct z_heap_stress_result *result);
 
+/** @brief sys_heap realloc stress test rig
+ *
+ * Same as sys_heap_stress(), but all the operations go through a
+ * single realloc-like callback, and blocks are also grown and shrunk
+ * in place of some of the allocations and frees.  Blocks mostly grow
+ * by a fraction of their size, like buffers growing with their
+ * contents.  Counts of the resizes are returned via the @a result
+ * struct too.
+ *
+ * @param realloc_fn Callback to allocate (@a p is NULL), free (@a
+ *             bytes is zero) or resize a block returned from a previous
+ *             call.  Passes back the @a arg parameter as a context
+ *             handle.
+ * @param arg Context handle to pass back to the callback
+ * @param total_bytes Size of the byte array the heap was initialized in
+ * @param op_count How many iterations to test
+ * @param scratch_mem A pointer to scratch memory to be used by the
+ *                    test.  Should be about 1/2 the size of the heap
+ *                    for tests that need to stress fragmentation.
+ * @param scratch_bytes Size of the memory pointed to by @a scratch_mem
+ * @param target_percent Percentage fill value (1-100) to which the
+ *                       random allocation choices will seek.
+ * @param result Struct into which to store test results.
+ */
+void sys_heap_realloc_stress(void *(*realloc_fn)(void *arg, void *p, size_t bytes),
+			     void *arg, size_t total_bytes,
+			     uint32_t op_count,
+			     void *scratch_mem, size_t scratch_bytes,
+			     int target_percent,
+			     struct z_heap_stress_result *result);
+
 /** @brief Print heap internal structure information to the console
  *
  * Print information on the heap structure such as its size, chunk buckets,
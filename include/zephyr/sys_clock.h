@@ -199,6 +199,19 @@ uint32_t sys_clock_tick_get_32(void);
  */
 int64_t sys_clock_tick_get(void);
 
+/**
+ * @brief Get the number of system timer wakeups avoided by timeout slack
+ *
+ * Each system timer interrupt deferred by the slack of the timeouts counts
+ * the timeouts it handles which are due at a later tick than the previous
+ * one, and would have needed their own interrupt without the slack.
+ *
+ * @kconfig_dep{CONFIG_TIMEOUT_SLACK}
+ *
+ * @return Number of wakeups avoided since boot
+ */
+uint32_t sys_clock_wakeups_avoided_get(void);
+
 #ifndef CONFIG_SYS_CLOCK_EXISTS
 #define sys_clock_tick_get() (0)
 #define sys_clock_tick_get_32() (0)
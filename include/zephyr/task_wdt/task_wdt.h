@@ -91,9 +91,10 @@ int task_wdt_delete(int channel_id);
 /**
  * @brief Feed specified watchdog channel.
  *
- * This function loops through all installed task watchdogs and updates the
- * internal kernel timer used as for the software watchdog with the next due
- * timeout.
+ * This function resets the timeout of the channel. It takes a constant time,
+ * whatever the number of installed task watchdogs, as the internal kernel
+ * timer used for the software watchdog is only updated with the next due
+ * timeout when it expires.
  *
  * @param channel_id Index of the fed channel as returned by task_wdt_add().
  *
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief USBD CDC ACM public header
+ *
+ * Header exposes API for streaming bulk data through the TX FIFO of a CDC ACM
+ * UART device without copying it.
+ */
+
+#ifndef ZEPHYR_INCLUDE_USB_CLASS_USBD_CDC_ACM_H_
+#define ZEPHYR_INCLUDE_USB_CLASS_USBD_CDC_ACM_H_
+
+#include <stdint.h>
+#include <zephyr/device.h>
+
+/**
+ * @brief USB CDC ACM device API
+ * @defgroup usbd_cdc_acm_device USB CDC ACM device API
+ * @ingroup usb
+ * @{
+ */
+
+/**
+ * @brief Claim space in the TX FIFO
+ *
+ * Provides a contiguous area of the TX FIFO of the CDC ACM UART device to
+ * write the data to send to. With CONFIG_USBD_CDC_ACM_TX_TRANSFERS greater
+ * than one, the data is transferred from this area to the host without being
+ * copied.
+ *
+ * The claim/commit API must not be used concurrently with the UART API TX
+ * functions of the device, and only by one thread at a time.
+ *
+ * @param dev CDC ACM UART device
+ * @param data Pointer to the address of the area, set by this function
+ * @param size Requested number of bytes
+ *
+ * @return Number of bytes available in the area, which may be less than
+ *         requested and zero when the TX FIFO is full.
+ */
+uint32_t usbd_cdc_acm_tx_claim(const struct device *dev, uint8_t **data, uint32_t size);
+
+/**
+ * @brief Queue claimed data for transmission
+ *
+ * Queues the first @p size bytes written to the areas obtained with
+ * usbd_cdc_acm_tx_claim() since the previous commit, the rest of the
+ * claimed space is returned to the TX FIFO.
+ *
+ * @param dev CDC ACM UART device
+ * @param size Number of bytes to send
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if @p size exceeds the claimed space
+ */
+int usbd_cdc_acm_tx_commit(const struct device *dev, uint32_t size);
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_USB_CLASS_USBD_CDC_ACM_H_ */
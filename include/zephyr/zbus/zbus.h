@@ -62,6 +62,29 @@ struct zbus_channel_data {
 	 */
 	struct net_buf_pool *msg_subscriber_pool;
 #endif /* ZBUS_MSG_SUBSCRIBER_NET_BUF_POOL_ISOLATION */
+
+#if defined(CONFIG_ZBUS_ASYNC_DISPATCH) || defined(__DOXYGEN__)
+	/** Asynchronous dispatch flag. Indicates the observers are notified by the dispatch
+	 * threads instead of the publisher.
+	 */
+	bool async;
+
+	/** Pending dispatch flag. Set while the channel waits in the dispatch queue, further
+	 * publications are batched into the pending dispatch.
+	 */
+	atomic_t async_pending;
+#endif /* CONFIG_ZBUS_ASYNC_DISPATCH */
+
+#if defined(CONFIG_ZBUS_SEQLOCK_CHANNELS) || defined(__DOXYGEN__)
+	/** Message sequence counter of a seqlock channel. Odd while the publisher is writing the
+	 * message.
+	 */
+	atomic_t seq;
+
+	/** Seqlock channel flag. Indicates the message is published without locking the channel.
+	 */
+	bool seqlock;
+#endif /* CONFIG_ZBUS_SEQLOCK_CHANNELS */
 };
 
 /**
@@ -161,9 +184,29 @@ struct zbus_observer {
 	};
 };
 
+/**
+ * @brief Notification statistics of an observer on a channel.
+ *
+ * Times are measured around the delivery of each notification: the callback of a listener, the
+ * queueing for a subscriber or a message subscriber.
+ */
+struct zbus_obs_stats {
+	/** Number of notifications delivered. */
+	uint32_t count;
+
+	/** Longest notification, in hardware cycles. */
+	uint32_t max_cycles;
+
+	/** Total time spent notifying, in hardware cycles. */
+	uint64_t total_cycles;
+};
+
 /** @cond INTERNAL_HIDDEN */
 struct zbus_channel_observation_mask {
 	bool enabled;
+#if defined(CONFIG_ZBUS_OBSERVER_STATS)
+	struct zbus_obs_stats stats;
+#endif /* CONFIG_ZBUS_OBSERVER_STATS */
 };
 
 struct zbus_channel_observation {
@@ -321,29 +364,19 @@ struct zbus_channel_observation {
 #define ZBUS_OBSERVERS(...) __VA_ARGS__
 
 /* clang-format off */
-/**
- * @brief Zbus channel definition.
- *
- * This macro defines a channel.
- *
- * @param _name The channel's name.
- * @param _type The Message type. It must be a struct or union.
- * @param _validator The validator function.
- * @param _user_data A pointer to the user data.
- *
- * @see struct zbus_channel
- * @param _observers The observers list. The sequence indicates the priority of the observer. The
- * first the highest priority.
- * @param _init_val The message initialization.
- */
-#define ZBUS_CHAN_DEFINE(_name, _type, _validator, _user_data, _observers, _init_val)     \
-	static _type _CONCAT(_zbus_message_, _name) = _init_val;                          \
+/** @cond INTERNAL_HIDDEN */
+#define _ZBUS_CHAN_DEFINE(_name, _type, _validator, _user_data, _observers, _init_val,    \
+			  _seqlock)                                                       \
+	static _type _CONCAT(_zbus_message_, _name) = __DEBRACKET _init_val;              \
 	static struct zbus_channel_data _CONCAT(_zbus_chan_data_, _name) = {              \
 		.observers_start_idx = -1,                                                \
 		.observers_end_idx = -1,                                                  \
 		IF_ENABLED(CONFIG_ZBUS_PRIORITY_BOOST, (                                  \
 			.highest_observer_priority = ZBUS_MIN_THREAD_PRIORITY,            \
 		))                                                                        \
+		IF_ENABLED(CONFIG_ZBUS_SEQLOCK_CHANNELS, (                                \
+			.seqlock = _seqlock,                                              \
+		))                                                                        \
 	};                                                                                \
 	static K_MUTEX_DEFINE(_CONCAT(_zbus_mutex_, _name));                              \
 	_ZBUS_CPP_EXTERN const STRUCT_SECTION_ITERABLE(zbus_channel, _name) = {           \
@@ -358,11 +391,55 @@ struct zbus_channel_observation {
 		))                                                                        \
 	};                                                                                \
 	/* Extern declaration of observers */                                             \
-	ZBUS_OBS_DECLARE(_observers);                                                     \
+	ZBUS_OBS_DECLARE(__DEBRACKET _observers);                                         \
 	/* Create all channel observations from observers list */                         \
-	FOR_EACH_FIXED_ARG_NONEMPTY_TERM(_ZBUS_CHAN_OBSERVATION, (;), _name, _observers)
+	FOR_EACH_FIXED_ARG_NONEMPTY_TERM(_ZBUS_CHAN_OBSERVATION, (;), _name,              \
+					 __DEBRACKET _observers)
+/** @endcond */
 /* clang-format on */
 
+/**
+ * @brief Zbus channel definition.
+ *
+ * This macro defines a channel.
+ *
+ * @param _name The channel's name.
+ * @param _type The Message type. It must be a struct or union.
+ * @param _validator The validator function.
+ * @param _user_data A pointer to the user data.
+ *
+ * @see struct zbus_channel
+ * @param _observers The observers list. The sequence indicates the priority of the observer. The
+ * first the highest priority.
+ * @param _init_val The message initialization.
+ */
+#define ZBUS_CHAN_DEFINE(_name, _type, _validator, _user_data, _observers, _init_val)              \
+	_ZBUS_CHAN_DEFINE(_name, _type, _validator, _user_data, (_observers), (_init_val), false)
+
+/**
+ * @brief Zbus single-writer channel definition.
+ *
+ * This macro defines a channel published through a sequence lock. The publisher copies the
+ * message without taking the channel, so it never waits for readers, and
+ * @ref zbus_chan_read never blocks: it retries when the message changed while it was being
+ * copied. The channel must have a single publisher at a time. Claiming the channel does not
+ * protect its message from the publisher, so read it with @ref zbus_chan_read only. Observers
+ * are still notified with the channel taken, so @ref zbus_chan_pub can time out after the
+ * message has been updated. Requires @kconfig{CONFIG_ZBUS_SEQLOCK_CHANNELS}.
+ *
+ * @param _name The channel's name.
+ * @param _type The Message type. It must be a struct or union.
+ * @param _validator The validator function.
+ * @param _user_data A pointer to the user data.
+ * @param _observers The observers list. The sequence indicates the priority of the observer. The
+ * first the highest priority.
+ * @param _init_val The message initialization.
+ */
+#define ZBUS_CHAN_SEQLOCK_DEFINE(_name, _type, _validator, _user_data, _observers, _init_val)      \
+	BUILD_ASSERT(IS_ENABLED(CONFIG_ZBUS_SEQLOCK_CHANNELS),                                     \
+		     "CONFIG_ZBUS_SEQLOCK_CHANNELS is required");                                  \
+	_ZBUS_CHAN_DEFINE(_name, _type, _validator, _user_data, (_observers), (_init_val), true)
+
 /**
  * @brief Initialize a message.
  *
@@ -534,6 +611,10 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
  * @param[in] timeout Waiting period to read the channel,
  *                or one of the special values K_NO_WAIT and K_FOREVER.
  *
+ * The read of a channel defined with @ref ZBUS_CHAN_SEQLOCK_DEFINE does not take the channel:
+ * the message is copied again until no publication overlapped the copy, and the waiting period
+ * only applies when the publisher was preempted in the middle of a publication.
+ *
  * @retval 0 Channel read.
  * @retval -EBUSY The channel is busy.
  * @retval -EAGAIN Waiting period timed out.
@@ -601,6 +682,60 @@ int zbus_chan_finish(const struct zbus_channel *chan);
  */
 int zbus_chan_notify(const struct zbus_channel *chan, k_timeout_t timeout);
 
+#if defined(CONFIG_ZBUS_ASYNC_DISPATCH) || defined(__DOXYGEN__)
+
+/**
+ * @brief Set the notification mode of a channel.
+ *
+ * In asynchronous mode, publishing or notifying the channel only queues it, and one of the
+ * @kconfig{CONFIG_ZBUS_ASYNC_DISPATCH_THREADS} dispatch threads notifies the observers. The
+ * publisher no longer waits for the observers, whatever their number. Publications made while
+ * the channel is still queued are batched: the observers are notified once, with the latest
+ * message.
+ *
+ * @param chan The channel's reference.
+ * @param async True to notify the observers from the dispatch threads.
+ *
+ * @retval 0 Mode set.
+ * @retval -EFAULT A parameter is incorrect. The function only returns this value when the
+ * @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_chan_async_set(const struct zbus_channel *chan, bool async);
+
+#endif /* CONFIG_ZBUS_ASYNC_DISPATCH */
+
+#if defined(CONFIG_ZBUS_OBSERVER_STATS) || defined(__DOXYGEN__)
+
+/**
+ * @brief Get the notification statistics of an observer on a channel.
+ *
+ * Only the observers listed in the channel definition are measured.
+ *
+ * @param chan The channel's reference.
+ * @param obs The observer's reference.
+ * @param[out] stats The statistics.
+ *
+ * @retval 0 Statistics retrieved.
+ * @retval -ESRCH No observation found for the related pair chan/obs.
+ * @retval -EFAULT A parameter is incorrect. The function only returns this value when the
+ * @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_chan_obs_stats_get(const struct zbus_channel *chan, const struct zbus_observer *obs,
+			    struct zbus_obs_stats *stats);
+
+/**
+ * @brief Reset the notification statistics of all the observers of a channel.
+ *
+ * @param chan The channel's reference.
+ *
+ * @retval 0 Statistics reset.
+ * @retval -EFAULT A parameter is incorrect. The function only returns this value when the
+ * @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_chan_obs_stats_reset(const struct zbus_channel *chan);
+
+#endif /* CONFIG_ZBUS_OBSERVER_STATS */
+
 #if defined(CONFIG_ZBUS_CHANNEL_NAME) || defined(__DOXYGEN__)
 
 /**
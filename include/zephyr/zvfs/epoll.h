@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_
+#define ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_
+
+#include <stdint.h>
+
+#include <zephyr/sys/fdtable.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ZVFS_EPOLL* event values are compatible with Linux */
+#define ZVFS_EPOLLIN  ZVFS_POLLIN
+#define ZVFS_EPOLLPRI ZVFS_POLLPRI
+#define ZVFS_EPOLLOUT ZVFS_POLLOUT
+#define ZVFS_EPOLLERR ZVFS_POLLERR
+#define ZVFS_EPOLLHUP ZVFS_POLLHUP
+#define ZVFS_EPOLLET  BIT(31)
+
+#define ZVFS_EPOLL_CTL_ADD 1
+#define ZVFS_EPOLL_CTL_DEL 2
+#define ZVFS_EPOLL_CTL_MOD 3
+
+typedef union zvfs_epoll_data {
+	void *ptr;
+	int fd;
+	uint32_t u32;
+	uint64_t u64;
+} zvfs_epoll_data_t;
+
+struct zvfs_epoll_event {
+	uint32_t events;
+	zvfs_epoll_data_t data;
+};
+
+/**
+ * @brief Create a ZVFS epoll instance
+ *
+ * An epoll instance keeps the poll registrations of its file descriptors
+ * between calls to @ref zvfs_epoll_wait, so that waiting costs nothing for
+ * file descriptors which are not ready. Any file descriptor which supports
+ * poll, like sockets and eventfds, can be added to it.
+ *
+ * @param flags Must be 0
+ *
+ * @return New ZVFS epoll file descriptor on success, -1 on error
+ */
+int zvfs_epoll_create(int flags);
+
+/**
+ * @brief Add, modify or remove a file descriptor of a ZVFS epoll instance
+ *
+ * By default a file descriptor is level-triggered and reported by every
+ * @ref zvfs_epoll_wait while it is ready. With @ref ZVFS_EPOLLET, it is only
+ * reported again once it has been signaled anew, e.g. after more data was
+ * received.
+ *
+ * The object a file descriptor waits on is picked when it is added or
+ * modified, so a connecting TCP socket should be modified once connected to
+ * wait for send buffer space. A file descriptor is removed from all epoll
+ * instances when it is closed.
+ *
+ * @param epfd ZVFS epoll file descriptor
+ * @param op One of ZVFS_EPOLL_CTL_ADD, ZVFS_EPOLL_CTL_MOD or ZVFS_EPOLL_CTL_DEL
+ * @param fd File descriptor to add, modify or remove
+ * @param event Events to wait for and data to report, ignored for
+ *              ZVFS_EPOLL_CTL_DEL
+ *
+ * @return 0 on success, -1 on error
+ */
+int zvfs_epoll_ctl(int epfd, int op, int fd, struct zvfs_epoll_event *event);
+
+/**
+ * @brief Wait for file descriptors of a ZVFS epoll instance to be ready
+ *
+ * @param epfd ZVFS epoll file descriptor
+ * @param events Array receiving the ready file descriptors
+ * @param maxevents Size of @p events, must be greater than zero
+ * @param timeout Timeout in milliseconds, or -1 to wait forever
+ *
+ * @return Number of entries stored in @p events, 0 on timeout, -1 on error
+ */
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents, int timeout);
+
+/** @cond INTERNAL_HIDDEN */
+
+/* Remove a file descriptor about to be closed from all epoll instances */
+void zvfs_epoll_close_fd(int fd);
+
+/** @endcond */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_ */
@@ -18,6 +18,11 @@
  * Threads waiting on an event object have the option of either waking once
  * any or all of the events it desires have been posted to the event object.
  *
+ * The events waited for by the pended threads are accumulated in the event
+ * object, so that posting events no thread waits for does not walk the wait
+ * queue. Event objects with the K_EVENT_WAKE_ONE option give the matching
+ * events to the first waiter they satisfy, instead of waking all of them.
+ *
  * @brief Kernel event object
  */
 
@@ -43,15 +48,20 @@
 struct event_walk_data {
 	struct k_thread  *head;
 	uint32_t events;
+	/* Events waited for by the threads left pended */
+	uint32_t wait_events;
+	bool wake_one;
 };
 
 #ifdef CONFIG_OBJ_CORE_EVENT
 static struct k_obj_type obj_type_event;
 #endif /* CONFIG_OBJ_CORE_EVENT */
 
-void z_impl_k_event_init(struct k_event *event)
+void z_impl_k_event_init_options(struct k_event *event, uint32_t options)
 {
 	event->events = 0;
+	event->wait_events = 0;
+	event->options = options;
 	event->lock = (struct k_spinlock) {};
 
 	SYS_PORT_TRACING_OBJ_INIT(k_event, event);
@@ -65,6 +75,22 @@ void z_impl_k_event_init(struct k_event *event)
 #endif /* CONFIG_OBJ_CORE_EVENT */
 }
 
+#ifdef CONFIG_USERSPACE
+void z_vrfy_k_event_init_options(struct k_event *event, uint32_t options)
+{
+	K_OOPS(K_SYSCALL_OBJ_NEVER_INIT(event, K_OBJ_EVENT));
+	K_OOPS(K_SYSCALL_VERIFY_MSG((options & ~K_EVENT_WAKE_ONE) == 0U,
+				    "invalid event options 0x%x", options));
+	z_impl_k_event_init_options(event, options);
+}
+#include <zephyr/syscalls/k_event_init_options_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+void z_impl_k_event_init(struct k_event *event)
+{
+	z_impl_k_event_init_options(event, 0);
+}
+
 #ifdef CONFIG_USERSPACE
 void z_vrfy_k_event_init(struct k_event *event)
 {
@@ -102,27 +128,42 @@ static int event_walk_op(struct k_thread *thread, void *data)
 {
 	unsigned int      wait_condition;
 	struct event_walk_data *event_data = data;
+	uint32_t desired = thread->events;
 
 	wait_condition = thread->event_options & K_EVENT_WAIT_MASK;
 
-	if (are_wait_conditions_met(thread->events, event_data->events,
-				    wait_condition)) {
-
-		/*
-		 * Events create a list of threads to wake up. We do
-		 * not want z_thread_timeout to wake these threads; they
-		 * will be woken up by k_event_post_internal once they
-		 * have been processed.
-		 */
-		thread->no_wake_on_timeout = true;
-
-		/*
-		 * The wait conditions have been satisfied. Add this
-		 * thread to the list of threads to unpend.
-		 */
-		thread->next_event_link = event_data->head;
-		event_data->head = thread;
-		z_abort_timeout(&thread->base.timeout);
+	if (!are_wait_conditions_met(desired, event_data->events,
+				     wait_condition)) {
+		event_data->wait_events |= desired;
+		return 0;
+	}
+
+	/*
+	 * Events create a list of threads to wake up. We do
+	 * not want z_thread_timeout to wake these threads; they
+	 * will be woken up by k_event_post_internal once they
+	 * have been processed.
+	 */
+	thread->no_wake_on_timeout = true;
+
+	/*
+	 * The wait conditions have been satisfied. Add this
+	 * thread to the list of threads to unpend, with the set
+	 * of events that woke it.
+	 */
+	thread->next_event_link = event_data->head;
+	event_data->head = thread;
+	thread->events = event_data->events;
+	z_abort_timeout(&thread->base.timeout);
+
+	if (event_data->wake_one) {
+		/* The matching events are not left for the other waiters */
+		event_data->events &= ~desired;
+
+		if (event_data->events == 0U) {
+			/* No other thread can be woken */
+			return 1;
+		}
 	}
 
 	return 0;
@@ -135,6 +176,7 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	struct k_thread  *thread;
 	struct event_walk_data data;
 	uint32_t previous_events;
+	uint32_t set_events;
 
 	data.head = NULL;
 	key = k_spin_lock(&event->lock);
@@ -145,8 +187,21 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	previous_events = event->events & events_mask;
 	events = (event->events & ~events_mask) |
 		 (events & events_mask);
+	set_events = events & ~event->events;
 	event->events = events;
+
+	/*
+	 * The pended threads did not match the previous events. Only the
+	 * newly set events they wait for can make them match.
+	 */
+	if ((set_events & event->wait_events) == 0U) {
+		goto out;
+	}
+
 	data.events = events;
+	data.wait_events = 0;
+	data.wake_one = (event->options & K_EVENT_WAKE_ONE) != 0U;
+
 	/*
 	 * Posting an event has the potential to wake multiple pended threads.
 	 * It is desirable to unpend all affected threads simultaneously. This
@@ -157,20 +212,25 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	 * 3. Ready each of the threads in the linked list
 	 */
 
-	z_sched_waitq_walk(&event->wait_q, event_walk_op, &data);
+	if (z_sched_waitq_walk(&event->wait_q, event_walk_op, &data) == 0) {
+		event->wait_events = data.wait_events;
+	}
+
+	/* Without the events delivered to single waiters */
+	event->events = data.events;
 
 	if (data.head != NULL) {
 		thread = data.head;
 		struct k_thread *next;
 		do {
 			arch_thread_return_value_set(thread, 0);
-			thread->events = events;
 			next = thread->next_event_link;
 			z_sched_wake_thread(thread, false);
 			thread = next;
 		} while (thread != NULL);
 	}
 
+out:
 	z_reschedule(&event->lock, key);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_event, post, event, events,
@@ -268,6 +328,9 @@ static uint32_t k_event_wait_internal(struct k_event *event, uint32_t events,
 
 	if (are_wait_conditions_met(events, event->events, wait_condition)) {
 		rv = event->events;
+		if ((event->options & K_EVENT_WAKE_ONE) != 0U) {
+			event->events &= ~events;
+		}
 
 		k_spin_unlock(&event->lock, key);
 		goto out;
@@ -287,6 +350,7 @@ static uint32_t k_event_wait_internal(struct k_event *event, uint32_t events,
 
 	thread->events = events;
 	thread->event_options = options;
+	event->wait_events |= events;
 
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_event, wait, event, events,
 					   options, timeout);
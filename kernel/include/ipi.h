@@ -16,12 +16,21 @@
 #define IPI_CPU_MASK(cpu_id)   \
 	(IS_ENABLED(CONFIG_IPI_OPTIMIZE) ? BIT(cpu_id) : IPI_ALL_CPUS_MASK)
 
+/* Reasons for which an IPI is sent, raised in the ipi_reasons of a CPU */
+#define IPI_REASON_RESCHEDULE  BIT(0)
+#define IPI_REASON_CALL        BIT(1)
+
 
 /* defined in ipi.c when CONFIG_SMP=y */
 #ifdef CONFIG_SMP
 void flag_ipi(uint32_t ipi_mask);
 void signal_pending_ipi(void);
 atomic_val_t ipi_mask_create(struct k_thread *thread);
+
+/* Clear and handle the IPI reasons of the current CPU, returning them.
+ * Note: interrupts are locked.
+ */
+atomic_val_t ipi_process_pending(void);
 #else
 #define flag_ipi(ipi_mask) do { } while (false)
 #define signal_pending_ipi() do { } while (false)
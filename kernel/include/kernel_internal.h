@@ -35,6 +35,28 @@ void z_init_thread_base(struct _thread_base *thread_base, int priority,
 void z_early_memset(void *dst, int c, size_t n);
 void z_early_memcpy(void *dst, const void *src, size_t n);
 
+#ifdef CONFIG_EARLY_MEM_ASYNC
+/* Implemented by the SoC, see CONFIG_EARLY_MEM_ASYNC */
+void z_early_memset_start(void *dst, int c, size_t n);
+void z_early_memcpy_start(void *dst, const void *src, size_t n);
+void z_early_mem_wait(void);
+#else
+static inline void z_early_memset_start(void *dst, int c, size_t n)
+{
+	z_early_memset(dst, c, n);
+}
+
+static inline void z_early_memcpy_start(void *dst, const void *src, size_t n)
+{
+	z_early_memcpy(dst, src, n);
+}
+
+static inline void z_early_mem_wait(void)
+{
+	/* Operations are synchronous */
+}
+#endif /* CONFIG_EARLY_MEM_ASYNC */
+
 void z_bss_zero(void);
 #ifdef CONFIG_XIP
 void z_data_copy(void);
@@ -160,6 +182,11 @@ extern uint8_t *z_priv_stack_find(k_thread_stack_t *stack);
 /* Calculate stack usage. */
 int z_stack_space_get(const uint8_t *stack_start, size_t size, size_t *unused_ptr);
 
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+/* Account for a sampled stack pointer in the stack high water mark */
+void z_thread_stack_watermark_update(struct k_thread *thread, uintptr_t sp);
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
+
 #ifdef CONFIG_USERSPACE
 bool z_stack_is_user_capable(k_thread_stack_t *stack);
 
@@ -169,6 +196,10 @@ void z_mem_domain_init_thread(struct k_thread *thread);
 /* Memory domain teardown hook, called from z_thread_abort() */
 void z_mem_domain_exit_thread(struct k_thread *thread);
 
+/* sys_mutex slow path, user_val is the word of the sys_mutex in user memory */
+int z_mutex_lock_user(struct k_mutex *mutex, atomic_t *user_val, k_timeout_t timeout);
+int z_mutex_unlock_user(struct k_mutex *mutex, atomic_t *user_val);
+
 /* This spinlock:
  *
  * - Protects the full set of active k_mem_domain objects and their contents
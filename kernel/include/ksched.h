@@ -53,6 +53,7 @@ struct k_thread *z_unpend_first_thread(_wait_q_t *wait_q);
 void z_unpend_thread(struct k_thread *thread);
 int z_unpend_all(_wait_q_t *wait_q);
 bool z_thread_prio_set(struct k_thread *thread, int prio);
+bool z_thread_is_active_elsewhere(struct k_thread *thread);
 void *z_get_next_switch_handle(void *interrupted);
 
 void z_time_slice(void);
@@ -284,6 +285,37 @@ void z_sched_usage_stop(void);
 
 void z_sched_usage_start(struct k_thread *thread);
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_ISR
+/**
+ * @brief Start the accounting of an ISR
+ *
+ * Called by the architecture interrupt dispatch before the ISR of the
+ * software ISR table entry, interrupts may be nested.
+ *
+ * @return Timestamp to pass to z_sched_usage_isr_exit().
+ */
+uint32_t z_sched_usage_isr_enter(void);
+
+/**
+ * @brief Stop the accounting of an ISR
+ *
+ * @param irq Interrupt line of the ISR.
+ * @param start Timestamp returned by z_sched_usage_isr_enter().
+ */
+void z_sched_usage_isr_exit(unsigned int irq, uint32_t start);
+#endif /* CONFIG_SCHED_THREAD_USAGE_ISR */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_HIST
+/**
+ * @brief Mark the start of the ready period of a thread
+ *
+ * Called with the scheduler lock held when a thread is made ready.
+ */
+void z_sched_usage_ready(struct k_thread *thread);
+#else
+#define z_sched_usage_ready(thread) do { } while (false)
+#endif /* CONFIG_SCHED_THREAD_USAGE_HIST */
+
 /**
  * @brief Retrieves CPU cycle usage data for specified core
  */
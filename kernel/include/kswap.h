@@ -17,6 +17,20 @@ extern void z_check_stack_sentinel(void);
 #define z_check_stack_sentinel() /**/
 #endif /* CONFIG_STACK_SENTINEL */
 
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+/* Sample the stack pointer of the outgoing thread, approximated by the
+ * address of a local variable.
+ */
+static ALWAYS_INLINE void z_sample_stack_watermark(void)
+{
+	uint8_t sp_probe;
+
+	z_thread_stack_watermark_update(_current, (uintptr_t)&sp_probe);
+}
+#else
+#define z_sample_stack_watermark() /**/
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
+
 extern struct k_spinlock _sched_spinlock;
 
 /* In SMP, the irq_lock() is a spinlock which is implicitly released
@@ -105,6 +119,7 @@ static ALWAYS_INLINE unsigned int do_swap(unsigned int key,
 	old_thread = _current;
 
 	z_check_stack_sentinel();
+	z_sample_stack_watermark();
 
 	old_thread->swap_retval = -EAGAIN;
 
@@ -206,6 +221,7 @@ static inline int z_swap_irqlock(unsigned int key)
 {
 	int ret;
 	z_check_stack_sentinel();
+	z_sample_stack_watermark();
 	ret = arch_swap(key);
 	return ret;
 }
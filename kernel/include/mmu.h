@@ -158,6 +158,11 @@
  */
 #define K_MEM_PAGE_FRAME_BACKED		BIT(5)
 
+/**
+ * This page frame was read ahead and not evicted since
+ */
+#define K_MEM_PAGE_FRAME_PREFETCHED	BIT(6)
+
 /**
  * Data structure for physical page frames
  *
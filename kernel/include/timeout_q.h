@@ -25,6 +25,12 @@ extern "C" {
 static inline void z_init_timeout(struct _timeout *to)
 {
 	sys_dnode_init(&to->node);
+#ifdef CONFIG_TIMEOUT_QUEUE_PAIRING_HEAP
+	to->prev = NULL;
+#endif /* CONFIG_TIMEOUT_QUEUE_PAIRING_HEAP */
+#ifdef CONFIG_TIMEOUT_SLACK
+	to->slack = 0U;
+#endif /* CONFIG_TIMEOUT_SLACK */
 }
 
 void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
@@ -34,7 +40,11 @@ int z_abort_timeout(struct _timeout *to);
 
 static inline bool z_is_inactive_timeout(const struct _timeout *to)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_PAIRING_HEAP
+	return to->prev == NULL;
+#else
 	return !sys_dnode_is_linked(&to->node);
+#endif /* CONFIG_TIMEOUT_QUEUE_PAIRING_HEAP */
 }
 
 static inline void z_init_thread_timeout(struct _thread_base *thread_base)
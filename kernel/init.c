@@ -32,6 +32,7 @@
 #include <zephyr/tracing/tracing.h>
 #include <stdbool.h>
 #include <zephyr/debug/gcov.h>
+#include <zephyr/debug/boot_profile.h>
 #include <kswap.h>
 #include <zephyr/timing/timing.h>
 #include <zephyr/logging/log.h>
@@ -223,21 +224,25 @@ void z_bss_zero(void)
 		return;
 	}
 
-	z_early_memset(__bss_start, 0, __bss_end - __bss_start);
+#ifdef CONFIG_BOOT_PROFILE
+	uint32_t profile_start = boot_profile_timestamp();
+#endif /* CONFIG_BOOT_PROFILE */
+
+	z_early_memset_start(__bss_start, 0, __bss_end - __bss_start);
 #if DT_NODE_HAS_STATUS(DT_CHOSEN(zephyr_ccm), okay)
-	z_early_memset(&__ccm_bss_start, 0,
-		       (uintptr_t) &__ccm_bss_end
-		       - (uintptr_t) &__ccm_bss_start);
+	z_early_memset_start(&__ccm_bss_start, 0,
+			     (uintptr_t) &__ccm_bss_end
+			     - (uintptr_t) &__ccm_bss_start);
 #endif
 #if DT_NODE_HAS_STATUS(DT_CHOSEN(zephyr_dtcm), okay)
-	z_early_memset(&__dtcm_bss_start, 0,
-		       (uintptr_t) &__dtcm_bss_end
-		       - (uintptr_t) &__dtcm_bss_start);
+	z_early_memset_start(&__dtcm_bss_start, 0,
+			     (uintptr_t) &__dtcm_bss_end
+			     - (uintptr_t) &__dtcm_bss_start);
 #endif
 #if DT_NODE_HAS_STATUS(DT_CHOSEN(zephyr_ocm), okay)
-	z_early_memset(&__ocm_bss_start, 0,
-		       (uintptr_t) &__ocm_bss_end
-		       - (uintptr_t) &__ocm_bss_start);
+	z_early_memset_start(&__ocm_bss_start, 0,
+			     (uintptr_t) &__ocm_bss_end
+			     - (uintptr_t) &__ocm_bss_start);
 #endif
 #ifdef CONFIG_CODE_DATA_RELOCATION
 	extern void bss_zeroing_relocation(void);
@@ -245,9 +250,13 @@ void z_bss_zero(void)
 	bss_zeroing_relocation();
 #endif	/* CONFIG_CODE_DATA_RELOCATION */
 #ifdef CONFIG_COVERAGE_GCOV
-	z_early_memset(&__gcov_bss_start, 0,
-		       ((uintptr_t) &__gcov_bss_end - (uintptr_t) &__gcov_bss_start));
+	z_early_memset_start(&__gcov_bss_start, 0,
+			     ((uintptr_t) &__gcov_bss_end - (uintptr_t) &__gcov_bss_start));
 #endif /* CONFIG_COVERAGE_GCOV */
+	z_early_mem_wait();
+#ifdef CONFIG_BOOT_PROFILE
+	z_boot_profile_early(BOOT_PROFILE_BSS_ZERO, profile_start);
+#endif /* CONFIG_BOOT_PROFILE */
 }
 
 #ifdef CONFIG_LINKER_USE_BOOT_SECTION
@@ -290,6 +299,32 @@ void z_bss_zero_pinned(void)
 }
 #endif /* CONFIG_LINKER_USE_PINNED_SECTION */
 
+#ifdef CONFIG_LAZY_BSS
+static int lazy_bss_zero_start(void)
+{
+	if (IS_ENABLED(CONFIG_EARLY_MEM_ASYNC)) {
+		/* Cleared in the background during the PRE_KERNEL levels */
+		z_early_memset_start(__lazy_bss_start, 0, __lazy_bss_end - __lazy_bss_start);
+	}
+
+	return 0;
+}
+
+/* Called ahead of the POST_KERNEL level rather than as one of its entries,
+ * so that the clearing is done before any of them runs.
+ */
+static void lazy_bss_zero_finish(void)
+{
+	if (IS_ENABLED(CONFIG_EARLY_MEM_ASYNC)) {
+		z_early_mem_wait();
+	} else {
+		(void)memset(__lazy_bss_start, 0, __lazy_bss_end - __lazy_bss_start);
+	}
+}
+
+SYS_INIT(lazy_bss_zero_start, EARLY, 0);
+#endif /* CONFIG_LAZY_BSS */
+
 #ifdef CONFIG_STACK_CANARIES
 #ifdef CONFIG_STACK_CANARIES_TLS
 extern __thread volatile uintptr_t __stack_chk_guard;
@@ -303,6 +338,28 @@ extern volatile uintptr_t __stack_chk_guard;
 __pinned_bss
 bool z_sys_post_kernel;
 
+static int device_init_finish(const struct device *dev, int rc)
+{
+	/* Mark device initialized. If initialization
+	 * failed, record the error condition.
+	 */
+	if (rc < 0) {
+		rc = -rc;
+	}
+	if (rc > UINT8_MAX) {
+		rc = UINT8_MAX;
+	}
+	dev->state->init_res = rc;
+	dev->state->initialized = true;
+
+	if (rc == 0) {
+		/* Run automatic device runtime enablement */
+		(void)pm_device_runtime_auto_enable(dev);
+	}
+
+	return rc;
+}
+
 static int do_device_init(const struct init_entry *entry)
 {
 	const struct device *dev = entry->dev;
@@ -310,28 +367,178 @@ static int do_device_init(const struct init_entry *entry)
 
 	if (entry->init_fn.dev != NULL) {
 		rc = entry->init_fn.dev(dev);
-		/* Mark device initialized. If initialization
-		 * failed, record the error condition.
-		 */
-		if (rc != 0) {
-			if (rc < 0) {
-				rc = -rc;
-			}
-			if (rc > UINT8_MAX) {
-				rc = UINT8_MAX;
+	}
+
+	return device_init_finish(dev, rc);
+}
+
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+static K_MUTEX_DEFINE(init_lock);
+
+/* Signalled whenever an entry of the parallel level completes */
+static K_CONDVAR_DEFINE(init_changed);
+
+static K_THREAD_STACK_ARRAY_DEFINE(init_stacks, CONFIG_DEVICE_INIT_PARALLEL_THREADS,
+				   CONFIG_DEVICE_INIT_PARALLEL_STACK_SIZE);
+static struct k_thread init_threads[CONFIG_DEVICE_INIT_PARALLEL_THREADS];
+
+/* Level being initialized in parallel, all accesses under init_lock */
+static struct {
+	enum init_level level;
+	/* Entries before it are all complete */
+	const struct init_entry *first_pending;
+	const struct init_entry *end;
+} init_par;
+
+static void init_par_advance(void)
+{
+	while (init_par.first_pending < init_par.end &&
+	       init_par.first_pending->dev != NULL &&
+	       init_par.first_pending->dev->state->initialized) {
+		init_par.first_pending++;
+	}
+}
+
+static int init_par_dep_visitor(const struct device *dev, void *context)
+{
+	const struct init_entry *entry = context;
+
+	if (dev->state->initialized) {
+		return 0;
+	}
+
+	/* Only wait for the devices which init before in sequential order,
+	 * others are in a later level or have a deferred initialization.
+	 */
+	for (const struct init_entry *e = init_par.first_pending; e < entry; e++) {
+		if (e->dev == dev) {
+			return -EBUSY;
+		}
+	}
+
+	return 0;
+}
+
+/* Returns the next entry which can start and marks it started */
+static const struct init_entry *init_par_next(bool main_thread)
+{
+	for (const struct init_entry *entry = init_par.first_pending; entry < init_par.end;
+	     entry++) {
+		const struct device *dev = entry->dev;
+
+		if (dev == NULL) {
+			/* SYS_INIT() entries are barriers, running on the main thread
+			 * once all previous entries are complete.
+			 */
+			return (main_thread && entry == init_par.first_pending) ? entry : NULL;
+		}
+
+		if (dev->state->init_started) {
+			continue;
+		}
+
+		if (device_required_foreach(dev, init_par_dep_visitor, (void *)entry) >= 0) {
+			dev->state->init_started = true;
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+static void init_par_run(bool main_thread)
+{
+	k_mutex_lock(&init_lock, K_FOREVER);
+
+	while (init_par.first_pending < init_par.end) {
+		const struct init_entry *entry = init_par_next(main_thread);
+		struct boot_profile_record *rec;
+		const struct device *dev;
+		int result;
+
+		if (entry == NULL) {
+			k_condvar_wait(&init_changed, &init_lock, K_FOREVER);
+			continue;
+		}
+
+		k_mutex_unlock(&init_lock);
+
+		dev = entry->dev;
+		rec = z_boot_profile_start(dev != NULL ? BOOT_PROFILE_DEVICE : BOOT_PROFILE_SYS_INIT,
+					   init_par.level, entry);
+		sys_trace_sys_init_enter(entry, init_par.level);
+		if (dev != NULL) {
+			result = 0;
+			if (entry->init_fn.dev != NULL) {
+				result = entry->init_fn.dev(dev);
 			}
-			dev->state->init_res = rc;
+		} else {
+			result = entry->init_fn.sys();
+		}
+		sys_trace_sys_init_exit(entry, init_par.level, result);
+		z_boot_profile_end(rec, result);
+
+		k_mutex_lock(&init_lock, K_FOREVER);
+
+		if (dev == NULL) {
+			init_par.first_pending++;
+		} else if (result != -EINPROGRESS) {
+			(void)device_init_finish(dev, result);
+		} else {
+			/* Completed by device_init_complete() */
 		}
+
+		init_par_advance();
+		k_condvar_broadcast(&init_changed);
 	}
 
-	dev->state->initialized = true;
+	k_mutex_unlock(&init_lock);
+}
 
-	if (rc == 0) {
-		/* Run automatic device runtime enablement */
-		(void)pm_device_runtime_auto_enable(dev);
+static void init_par_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	init_par_run(false);
+}
+
+static void init_par_run_level(enum init_level level, const struct init_entry *start,
+			       const struct init_entry *end)
+{
+	init_par.level = level;
+	init_par.first_pending = start;
+	init_par.end = end;
+
+	for (int i = 0; i < CONFIG_DEVICE_INIT_PARALLEL_THREADS; i++) {
+		k_thread_create(&init_threads[i], init_stacks[i],
+				K_THREAD_STACK_SIZEOF(init_stacks[i]), init_par_thread,
+				NULL, NULL, NULL, CONFIG_MAIN_THREAD_PRIORITY, 0, K_NO_WAIT);
+		(void)k_thread_name_set(&init_threads[i], "device_init");
 	}
 
-	return rc;
+	init_par_run(true);
+
+	for (int i = 0; i < CONFIG_DEVICE_INIT_PARALLEL_THREADS; i++) {
+		(void)k_thread_join(&init_threads[i], K_FOREVER);
+	}
+}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
+void device_init_complete(const struct device *dev, int result)
+{
+	__ASSERT_NO_MSG(!k_is_in_isr());
+
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+	k_mutex_lock(&init_lock, K_FOREVER);
+	(void)device_init_finish(dev, result);
+	init_par_advance();
+	k_condvar_broadcast(&init_changed);
+	k_mutex_unlock(&init_lock);
+#else
+	(void)device_init_finish(dev, result);
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
 }
 
 /**
@@ -360,11 +567,29 @@ static void z_sys_init_run_level(enum init_level level)
 		__init_end,
 	};
 	const struct init_entry *entry;
+	struct boot_profile_record *level_rec;
+
+	if (level == INIT_LEVEL_EARLY) {
+		z_boot_profile_reset();
+	}
+
+	level_rec = z_boot_profile_start(BOOT_PROFILE_LEVEL, level, NULL);
+
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+	if (level == INIT_LEVEL_POST_KERNEL || level == INIT_LEVEL_APPLICATION) {
+		init_par_run_level(level, levels[level], levels[level+1]);
+		z_boot_profile_end(level_rec, 0);
+		return;
+	}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
 
 	for (entry = levels[level]; entry < levels[level+1]; entry++) {
 		const struct device *dev = entry->dev;
+		struct boot_profile_record *rec;
 		int result;
 
+		rec = z_boot_profile_start(dev != NULL ? BOOT_PROFILE_DEVICE : BOOT_PROFILE_SYS_INIT,
+					   level, entry);
 		sys_trace_sys_init_enter(entry, level);
 		if (dev != NULL) {
 			result = do_device_init(entry);
@@ -372,7 +597,10 @@ static void z_sys_init_run_level(enum init_level level)
 			result = entry->init_fn.sys();
 		}
 		sys_trace_sys_init_exit(entry, level, result);
+		z_boot_profile_end(rec, result);
 	}
+
+	z_boot_profile_end(level_rec, 0);
 }
 
 
@@ -427,6 +655,9 @@ static void bg_thread_main(void *unused1, void *unused2, void *unused3)
 #endif /* CONFIG_MMU */
 	z_sys_post_kernel = true;
 
+#ifdef CONFIG_LAZY_BSS
+	lazy_bss_zero_finish();
+#endif /* CONFIG_LAZY_BSS */
 	z_sys_init_run_level(INIT_LEVEL_POST_KERNEL);
 #if defined(CONFIG_STACK_POINTER_RANDOM) && (CONFIG_STACK_POINTER_RANDOM != 0)
 	z_stack_adjust_initialized = 1;
@@ -458,6 +689,8 @@ static void bg_thread_main(void *unused1, void *unused2, void *unused3)
 
 	extern int main(void);
 
+	z_boot_profile_end(z_boot_profile_start(BOOT_PROFILE_MAIN, 0, NULL), 0);
+
 	(void)main();
 
 	/* Mark non-essential since main() has no more work to do */
@@ -7,11 +7,26 @@
 #include <kswap.h>
 #include <ksched.h>
 #include <ipi.h>
+#include <zephyr/kernel/smp.h>
 
 #ifdef CONFIG_TRACE_SCHED_IPI
 extern void z_trace_sched_ipi(void);
 #endif
 
+#ifdef CONFIG_SMP_CALL
+/* Function call queued for a CPU by k_smp_call_on_cpu() */
+struct smp_call {
+	sys_snode_t node;
+	smp_call_fn fn;
+	void *arg;
+	atomic_t done;
+};
+
+static struct smp_call_queue {
+	struct k_spinlock lock;
+	sys_slist_t calls;
+} smp_call_queues[CONFIG_MP_MAX_NUM_CPUS];
+#endif /* CONFIG_SMP_CALL */
 
 void flag_ipi(uint32_t ipi_mask)
 {
@@ -66,6 +81,44 @@ atomic_val_t ipi_mask_create(struct k_thread *thread)
 	return (atomic_val_t)ipi_mask;
 }
 
+#if defined(CONFIG_SCHED_IPI_SUPPORTED)
+/*
+ * Raise @a reason on the CPUs of @a cpu_bitmap, other than the current one,
+ * and return those needing an IPI. A CPU that already had a reason pending
+ * has yet to take an IPI sent for it, which will handle the new reason
+ * as well. Note: interrupts are locked.
+ */
+static uint32_t ipi_reasons_raise(uint32_t cpu_bitmap, atomic_val_t reason)
+{
+	uint32_t num_cpus = (uint32_t)arch_num_cpus();
+	uint32_t id = _current_cpu->id;
+	uint32_t send = 0;
+
+	for (uint32_t i = 0; i < num_cpus; i++) {
+		if ((i == id) || ((cpu_bitmap & BIT(i)) == 0)) {
+			continue;
+		}
+
+		if (atomic_or(&_kernel.cpus[i].ipi_reasons, reason) == 0) {
+			send |= BIT(i);
+		}
+	}
+
+	return send;
+}
+
+static void ipi_send(uint32_t cpu_bitmap)
+{
+	if (cpu_bitmap != 0) {
+#ifdef CONFIG_ARCH_HAS_DIRECTED_IPIS
+		arch_sched_directed_ipi(cpu_bitmap);
+#else
+		arch_sched_broadcast_ipi();
+#endif
+	}
+}
+#endif /* CONFIG_SCHED_IPI_SUPPORTED */
+
 void signal_pending_ipi(void)
 {
 	/* Synchronization note: you might think we need to lock these
@@ -78,31 +131,114 @@ void signal_pending_ipi(void)
 #if defined(CONFIG_SCHED_IPI_SUPPORTED)
 	if (arch_num_cpus() > 1) {
 		uint32_t  cpu_bitmap;
+		unsigned int key;
 
 		cpu_bitmap = (uint32_t)atomic_clear(&_kernel.pending_ipi);
 		if (cpu_bitmap != 0) {
-#ifdef CONFIG_ARCH_HAS_DIRECTED_IPIS
-			arch_sched_directed_ipi(cpu_bitmap);
-#else
-			arch_sched_broadcast_ipi();
-#endif
+			key = arch_irq_lock();
+			ipi_send(ipi_reasons_raise(cpu_bitmap, IPI_REASON_RESCHEDULE));
+			arch_irq_unlock(key);
 		}
 	}
 #endif /* CONFIG_SCHED_IPI_SUPPORTED */
 }
 
+atomic_val_t ipi_process_pending(void)
+{
+	atomic_val_t reasons = atomic_clear(&_current_cpu->ipi_reasons);
+
+#ifdef CONFIG_SMP_CALL
+	if ((reasons & IPI_REASON_CALL) != 0) {
+		struct smp_call_queue *queue = &smp_call_queues[_current_cpu->id];
+		struct smp_call *call;
+		k_spinlock_key_t key;
+
+		while (true) {
+			key = k_spin_lock(&queue->lock);
+			call = SYS_SLIST_CONTAINER(sys_slist_get(&queue->calls), call, node);
+			k_spin_unlock(&queue->lock, key);
+
+			if (call == NULL) {
+				break;
+			}
+
+			call->fn(call->arg);
+			/* The caller may return at once, call is not valid after this */
+			(void)atomic_set(&call->done, 1);
+		}
+	}
+#endif /* CONFIG_SMP_CALL */
+
+	return reasons;
+}
+
 void z_sched_ipi(void)
 {
 	/* NOTE: When adding code to this, make sure this is called
 	 * at appropriate location when !CONFIG_SCHED_IPI_SUPPORTED.
 	 */
+	atomic_val_t reasons;
+
 #ifdef CONFIG_TRACE_SCHED_IPI
 	z_trace_sched_ipi();
 #endif /* CONFIG_TRACE_SCHED_IPI */
 
+	reasons = ipi_process_pending();
+
 #ifdef CONFIG_TIMESLICING
-	if (thread_is_sliceable(_current)) {
+	/* IPIs sent without a reason, such as the ones halting a
+	 * thread, are handled as reschedule requests.
+	 */
+	if (((reasons == 0) || ((reasons & IPI_REASON_RESCHEDULE) != 0)) &&
+	    thread_is_sliceable(_current)) {
 		z_time_slice();
 	}
+#else
+	ARG_UNUSED(reasons);
 #endif /* CONFIG_TIMESLICING */
 }
+
+#ifdef CONFIG_SMP_CALL
+int k_smp_call_on_cpu(int id, smp_call_fn fn, void *arg)
+{
+	struct smp_call call = {
+		.fn = fn,
+		.arg = arg,
+	};
+	struct smp_call_queue *queue;
+	k_spinlock_key_t key;
+	unsigned int irq_key;
+
+	__ASSERT(!arch_is_in_isr(), "cross-CPU calls can't be made from an ISR");
+
+	if ((id < 0) || (id >= arch_num_cpus())) {
+		return -EINVAL;
+	}
+
+	irq_key = arch_irq_lock();
+	__ASSERT(arch_irq_unlocked(irq_key), "cross-CPU calls need interrupts unlocked");
+
+	if (id == _current_cpu->id) {
+		fn(arg);
+		arch_irq_unlock(irq_key);
+		return 0;
+	}
+
+	queue = &smp_call_queues[id];
+	key = k_spin_lock(&queue->lock);
+	sys_slist_append(&queue->calls, &call.node);
+	k_spin_unlock(&queue->lock, key);
+
+	ipi_send(ipi_reasons_raise(BIT(id), IPI_REASON_CALL));
+	arch_irq_unlock(irq_key);
+
+	/* Interrupts are unlocked while waiting, so two CPUs calling each
+	 * other both get their call handled.
+	 */
+	while (atomic_get(&call.done) == 0) {
+		arch_spin_relax();
+	}
+
+	return 0;
+}
+#endif /* CONFIG_SMP_CALL */
@@ -48,9 +48,9 @@ static int k_mem_slab_stats_query(struct k_obj_core *obj_core, void *stats)
 
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
-	ptr->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
-			  slab->info.block_size;
-	ptr->allocated_bytes = slab->info.num_used * slab->info.block_size;
+	ptr->free_bytes = k_mem_slab_num_free_get(slab) * slab->info.block_size;
+	ptr->allocated_bytes = k_mem_slab_num_used_get(slab) *
+			       slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	ptr->max_allocated_bytes = slab->info.max_used * slab->info.block_size;
 #else
@@ -182,6 +182,10 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	slab->info.max_used = 0U;
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+	memset(slab->mag, 0, sizeof(slab->mag));
+	atomic_clear(&slab->mag_waiters);
+#endif /* CONFIG_MEM_SLAB_MAGAZINE */
 
 	rc = create_free_list(slab);
 	if (rc < 0) {
@@ -216,28 +220,49 @@ static bool slab_ptr_is_good(struct k_mem_slab *slab, const void *ptr)
 }
 #endif
 
-int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
+static inline void slab_take_block(struct k_mem_slab *slab, void **mem)
+{
+	*mem = slab->free_list;
+	slab->free_list = *(char **)(slab->free_list);
+	slab->info.num_used++;
+	__ASSERT((slab->free_list == NULL &&
+		  slab->info.num_used == slab->info.num_blocks) ||
+		 slab_ptr_is_good(slab, slab->free_list),
+		 "slab corruption detected");
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	slab->info.max_used = MAX(slab->info.num_used,
+				  slab->info.max_used);
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+}
+
+/* Returns true if the block went to a waiting thread, which needs a reschedule */
+static bool slab_free_locked(struct k_mem_slab *slab, void *mem)
+{
+	if ((slab->free_list == NULL) && IS_ENABLED(CONFIG_MULTITHREADING)) {
+		struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
+
+		if (pending_thread != NULL) {
+			z_thread_return_value_set_with_data(pending_thread, 0, mem);
+			z_ready_thread(pending_thread);
+			return true;
+		}
+	}
+	*(char **) mem = slab->free_list;
+	slab->free_list = (char *) mem;
+	slab->info.num_used--;
+
+	return false;
+}
+
+static int slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 	int result;
 
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
-
 	if (slab->free_list != NULL) {
 		/* take a free block */
-		*mem = slab->free_list;
-		slab->free_list = *(char **)(slab->free_list);
-		slab->info.num_used++;
-		__ASSERT((slab->free_list == NULL &&
-			  slab->info.num_used == slab->info.num_blocks) ||
-			 slab_ptr_is_good(slab, slab->free_list),
-			 "slab corruption detected");
-
-#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-		slab->info.max_used = MAX(slab->info.num_used,
-					  slab->info.max_used);
-#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
-
+		slab_take_block(slab, mem);
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
 		   !IS_ENABLED(CONFIG_MULTITHREADING)) {
@@ -253,44 +278,185 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 			*mem = _current->base.swap_data;
 		}
 
-		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
-
 		return result;
 	}
 
-	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
-
 	k_spin_unlock(&slab->lock, key);
 
 	return result;
 }
 
-void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+/*
+ * Every CPU caches up to CONFIG_MEM_SLAB_MAGAZINE_SIZE free blocks of the
+ * slab in its own magazine, blocks held there count as used by the slab.
+ * The magazine lock of a CPU is only contended when another CPU reclaims
+ * the cached blocks. It is always taken before the slab lock.
+ */
+#define MAGAZINE_BATCH (CONFIG_MEM_SLAB_MAGAZINE_SIZE / 2)
+
+static struct z_mem_slab_magazine *magazine_lock(struct k_mem_slab *slab,
+						 k_spinlock_key_t *key)
+{
+	/*
+	 * Migrating to another CPU before the lock is taken only costs
+	 * locality, any CPU may use any magazine under its lock.
+	 */
+	struct z_mem_slab_magazine *mag = &slab->mag[arch_curr_cpu()->id];
+
+	*key = k_spin_lock(&mag->lock);
+
+	return mag;
+}
+
+/* Moves the last @a n blocks of the magazine to the slab */
+static bool magazine_drain(struct k_mem_slab *slab,
+			   struct z_mem_slab_magazine *mag, uint32_t n)
 {
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	bool resched = false;
 
-	__ASSERT(slab_ptr_is_good(slab, mem), "Invalid memory pointer provided");
+	for (; n > 0U; n--) {
+		resched |= slab_free_locked(slab, mag->blocks[--mag->count]);
+	}
 
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
-	if ((slab->free_list == NULL) && IS_ENABLED(CONFIG_MULTITHREADING)) {
-		struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
+	k_spin_unlock(&slab->lock, key);
 
-		if (pending_thread != NULL) {
-			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+	return resched;
+}
 
-			z_thread_return_value_set_with_data(pending_thread, 0, mem);
-			z_ready_thread(pending_thread);
-			z_reschedule(&slab->lock, key);
-			return;
+static bool magazine_alloc(struct k_mem_slab *slab, void **mem)
+{
+	struct z_mem_slab_magazine *mag;
+	k_spinlock_key_t key;
+
+	mag = magazine_lock(slab, &key);
+
+	if (mag->count == 0U) {
+		k_spinlock_key_t slab_key = k_spin_lock(&slab->lock);
+
+		while ((mag->count < MAGAZINE_BATCH) && (slab->free_list != NULL)) {
+			slab_take_block(slab, &mag->blocks[mag->count++]);
+		}
+
+		k_spin_unlock(&slab->lock, slab_key);
+
+		if (mag->count == 0U) {
+			k_spin_unlock(&mag->lock, key);
+			return false;
 		}
+
+		mag->stats.refills++;
+		mag->stats.max_cached = MAX(mag->count, mag->stats.max_cached);
+	} else {
+		mag->stats.hits++;
 	}
-	*(char **) mem = slab->free_list;
-	slab->free_list = (char *) mem;
-	slab->info.num_used--;
 
-	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+	*mem = mag->blocks[--mag->count];
+
+	k_spin_unlock(&mag->lock, key);
+
+	return true;
+}
+
+static void magazine_free(struct k_mem_slab *slab, void *mem)
+{
+	struct z_mem_slab_magazine *mag;
+	k_spinlock_key_t key;
+	bool resched = false;
+
+	mag = magazine_lock(slab, &key);
+
+	if (mag->count == CONFIG_MEM_SLAB_MAGAZINE_SIZE) {
+		resched = magazine_drain(slab, mag, MAGAZINE_BATCH);
+		mag->stats.drains++;
+	}
+
+	mag->blocks[mag->count++] = mem;
+	mag->stats.max_cached = MAX(mag->count, mag->stats.max_cached);
+
+	/*
+	 * Some thread is looking for a block and may already have searched
+	 * this magazine, hand the blocks back to the slab for it.
+	 */
+	if (atomic_get(&slab->mag_waiters) != 0) {
+		resched |= magazine_drain(slab, mag, mag->count);
+	}
+
+	k_spin_unlock(&mag->lock, key);
+
+	if (resched) {
+		z_reschedule_unlocked();
+	}
+}
+
+/* Moves the blocks cached by all CPUs back to the slab */
+static void magazine_reclaim(struct k_mem_slab *slab)
+{
+	bool resched = false;
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		struct z_mem_slab_magazine *mag = &slab->mag[i];
+		k_spinlock_key_t key = k_spin_lock(&mag->lock);
+
+		mag->stats.steals += mag->count;
+		resched |= magazine_drain(slab, mag, mag->count);
+
+		k_spin_unlock(&mag->lock, key);
+	}
+
+	if (resched) {
+		z_reschedule_unlocked();
+	}
+}
+#endif /* CONFIG_MEM_SLAB_MAGAZINE */
+
+int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
+{
+	int result;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
+
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+	if (magazine_alloc(slab, mem)) {
+		result = 0;
+	} else {
+		/* Make the CPUs flush their magazines until we are done */
+		atomic_inc(&slab->mag_waiters);
+		magazine_reclaim(slab);
+		result = slab_alloc(slab, mem, timeout);
+		atomic_dec(&slab->mag_waiters);
+	}
+#else
+	result = slab_alloc(slab, mem, timeout);
+#endif /* CONFIG_MEM_SLAB_MAGAZINE */
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
+
+	return result;
+}
+
+void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
+{
+	__ASSERT(slab_ptr_is_good(slab, mem), "Invalid memory pointer provided");
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+	magazine_free(slab, mem);
+#else
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+
+	if (slab_free_locked(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+		z_reschedule(&slab->lock, key);
+		return;
+	}
 
 	k_spin_unlock(&slab->lock, key);
+#endif /* CONFIG_MEM_SLAB_MAGAZINE */
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
 }
 
 int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stats *stats)
@@ -301,8 +467,9 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	stats->allocated_bytes = slab->info.num_used * slab->info.block_size;
-	stats->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
+	stats->allocated_bytes = k_mem_slab_num_used_get(slab) *
+				 slab->info.block_size;
+	stats->free_bytes = k_mem_slab_num_free_get(slab) *
 			    slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	stats->max_allocated_bytes = slab->info.max_used *
@@ -332,3 +499,30 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab)
 	return 0;
 }
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+int k_mem_slab_magazine_stats_get(struct k_mem_slab *slab,
+				  struct k_mem_slab_magazine_stats *stats)
+{
+	if ((slab == NULL) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	*stats = (struct k_mem_slab_magazine_stats) {};
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		struct z_mem_slab_magazine *mag = &slab->mag[i];
+		k_spinlock_key_t key = k_spin_lock(&mag->lock);
+
+		stats->hits += mag->stats.hits;
+		stats->refills += mag->stats.refills;
+		stats->drains += mag->stats.drains;
+		stats->steals += mag->stats.steals;
+		stats->max_cached = MAX(stats->max_cached, mag->stats.max_cached);
+
+		k_spin_unlock(&mag->lock, key);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_MEM_SLAB_MAGAZINE */
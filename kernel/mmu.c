@@ -496,6 +496,7 @@ static int virt_to_page_frame(void *virt, uintptr_t *phys)
 
 	return ret;
 }
+
 /* LCOV_EXCL_STOP */
 
 __weak FUNC_ALIAS(virt_to_page_frame, arch_page_phys_get, int);
@@ -506,6 +507,68 @@ static int page_frame_prepare_locked(struct k_mem_page_frame *pf, bool *dirty_pt
 
 static inline void do_backing_store_page_in(uintptr_t location);
 static inline void do_backing_store_page_out(uintptr_t location);
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_SLEEP
+/* Serializes paging operations, which all go through the scratch page */
+static K_MUTEX_DEFINE(paging_lock_mutex);
+
+/* Thread whose ongoing backing store transfer may sleep */
+static struct k_thread *paging_sleeper;
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_SLEEP */
+
+/*
+ * Keep other paging operations out while a page is transferred with
+ * interrupts unlocked. Without CONFIG_DEMAND_PAGING_ALLOW_SLEEP, this is done
+ * by not letting other threads run at all.
+ */
+static inline void paging_lock(void)
+{
+#if defined(CONFIG_DEMAND_PAGING_ALLOW_SLEEP)
+	(void)k_mutex_lock(&paging_lock_mutex, K_FOREVER);
+#elif defined(CONFIG_DEMAND_PAGING_ALLOW_IRQ)
+	k_sched_lock();
+#endif
+}
+
+static inline void paging_unlock(void)
+{
+#if defined(CONFIG_DEMAND_PAGING_ALLOW_SLEEP)
+	(void)k_mutex_unlock(&paging_lock_mutex);
+#elif defined(CONFIG_DEMAND_PAGING_ALLOW_IRQ)
+	k_sched_unlock();
+#endif
+}
+
+/*
+ * Called around backing store transfers done with interrupts unlocked if
+ * they were unlocked when the paging operation started, per <key>.
+ */
+static inline void paging_transfer_begin(unsigned int key)
+{
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_SLEEP
+	if (arch_irq_unlocked(key) && !k_is_in_isr()) {
+		paging_sleeper = _current;
+	}
+#else
+	ARG_UNUSED(key);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_SLEEP */
+}
+
+static inline void paging_transfer_end(void)
+{
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_SLEEP
+	paging_sleeper = NULL;
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_SLEEP */
+}
+
+bool k_mem_paging_backing_store_may_sleep(void)
+{
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_SLEEP
+	return !k_is_in_isr() && (paging_sleeper == _current);
+#else
+	return false;
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_SLEEP */
+}
 #endif /* CONFIG_DEMAND_PAGING */
 
 /* Allocate a free page frame, and map it to a specified virtual address
@@ -591,6 +654,13 @@ void *k_mem_map_phys_guard(uintptr_t phys, size_t size, uint32_t flags, bool is_
 		return NULL;
 	}
 
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_SLEEP
+	/* Anonymous pages may be obtained by evicting through the scratch page */
+	if (is_anon) {
+		paging_lock();
+	}
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_SLEEP */
+
 	key = k_spin_lock(&z_mm_lock);
 
 	/* Need extra for the guard pages (before and after) which we
@@ -647,6 +717,11 @@ void *k_mem_map_phys_guard(uintptr_t phys, size_t size, uint32_t flags, bool is_
 
 out:
 	k_spin_unlock(&z_mm_lock, key);
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_SLEEP
+	if (is_anon) {
+		paging_unlock();
+	}
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_SLEEP */
 	return dst;
 }
 
@@ -1186,6 +1261,26 @@ static void virt_region_foreach(void *addr, size_t size,
 	}
 }
 
+/* Account for a read ahead page leaving its page frame */
+static inline void paging_stats_prefetch_evicted(struct k_mem_page_frame *pf)
+{
+	if ((pf->va_and_flags & K_MEM_PAGE_FRAME_PREFETCHED) == 0U) {
+		return;
+	}
+
+	k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_PREFETCHED);
+
+#if defined(CONFIG_DEMAND_PAGING_STATS) && defined(CONFIG_DEMAND_PAGING_PREFETCH)
+	uintptr_t flags = arch_page_info_get(k_mem_page_frame_to_virt(pf), NULL, false);
+
+	if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0U) {
+		paging_stats.prefetch.hits++;
+	} else {
+		paging_stats.prefetch.misses++;
+	}
+#endif /* CONFIG_DEMAND_PAGING_STATS && CONFIG_DEMAND_PAGING_PREFETCH */
+}
+
 /*
  * Perform some preparatory steps before paging out. The provided page frame
  * must be evicted to the backing store immediately after this is called
@@ -1239,6 +1334,7 @@ static int page_frame_prepare_locked(struct k_mem_page_frame *pf, bool *dirty_pt
 			LOG_ERR("out of backing store memory");
 			return -ENOMEM;
 		}
+		paging_stats_prefetch_evicted(pf);
 		arch_mem_page_out(k_mem_page_frame_to_virt(pf), *location_ptr);
 		k_mem_paging_eviction_remove(pf);
 	} else {
@@ -1271,8 +1367,8 @@ static int do_mem_evict(void *addr)
 	__ASSERT(!k_is_in_isr(),
 		 "%s is unavailable in ISRs with CONFIG_DEMAND_PAGING_ALLOW_IRQ",
 		 __func__);
-	k_sched_lock();
 #endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	paging_lock();
 	key = irq_lock();
 	flags = arch_page_info_get(addr, &phys, false);
 	__ASSERT((flags & ARCH_DATA_PAGE_NOT_MAPPED) == 0,
@@ -1293,6 +1389,7 @@ static int do_mem_evict(void *addr)
 
 	__ASSERT(ret == 0, "failed to prepare page frame");
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	paging_transfer_begin(key);
 	irq_unlock(key);
 #endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
 	if (dirty) {
@@ -1300,13 +1397,12 @@ static int do_mem_evict(void *addr)
 	}
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
 	key = irq_lock();
+	paging_transfer_end();
 #endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
 	page_frame_free_locked(pf);
 out:
 	irq_unlock(key);
-#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
-	k_sched_unlock();
-#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	paging_unlock();
 	return ret;
 }
 
@@ -1348,8 +1444,8 @@ int k_mem_page_frame_evict(uintptr_t phys)
 	__ASSERT(!k_is_in_isr(),
 		 "%s is unavailable in ISRs with CONFIG_DEMAND_PAGING_ALLOW_IRQ",
 		 __func__);
-	k_sched_lock();
 #endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	paging_lock();
 	key = irq_lock();
 	pf = k_mem_phys_to_page_frame(phys);
 	if (!k_mem_page_frame_is_mapped(pf)) {
@@ -1367,6 +1463,7 @@ int k_mem_page_frame_evict(uintptr_t phys)
 	}
 
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	paging_transfer_begin(key);
 	irq_unlock(key);
 #endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
 	if (dirty) {
@@ -1374,13 +1471,12 @@ int k_mem_page_frame_evict(uintptr_t phys)
 	}
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
 	key = irq_lock();
+	paging_transfer_end();
 #endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
 	page_frame_free_locked(pf);
 out:
 	irq_unlock(key);
-#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
-	k_sched_unlock();
-#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	paging_unlock();
 	return ret;
 }
 
@@ -1477,7 +1573,7 @@ static inline struct k_mem_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
-static bool do_page_fault(void *addr, bool pin)
+static bool do_page_fault(void *addr, bool pin, bool prefetch)
 {
 	struct k_mem_page_frame *pf;
 	int key, ret;
@@ -1515,18 +1611,20 @@ static bool do_page_fault(void *addr, bool pin)
 	 * entire operation. This is far worse for system interrupt latency
 	 * but requires less pinned pages and ISRs may also take page faults.
 	 *
-	 * Support for allowing k_mem_paging_backing_store_page_out() and
-	 * k_mem_paging_backing_store_page_in() to also sleep and allow
-	 * other threads to run (such as in the case where the transfer is
-	 * async DMA) is not implemented. Even if limited to thread context,
-	 * arbitrary memory access triggering exceptions that put a thread to
-	 * sleep on a contended page fault operation will break scheduling
-	 * assumptions of cooperative threads or threads that implement
-	 * crticial sections with spinlocks or disabling IRQs.
+	 * With CONFIG_DEMAND_PAGING_ALLOW_SLEEP, a mutex is taken instead of
+	 * locking the scheduler, and k_mem_paging_backing_store_page_out()
+	 * and k_mem_paging_backing_store_page_in() may sleep until their
+	 * transfer completes (such as in the case where the transfer is
+	 * async DMA), letting other threads run. Threads faulting meanwhile
+	 * wait on the mutex, as all transfers go through the scratch page.
+	 * This is opt-in as arbitrary memory access triggering exceptions
+	 * that put a thread to sleep on a contended page fault operation
+	 * breaks scheduling assumptions of cooperative threads or threads
+	 * that implement crticial sections with spinlocks or disabling IRQs.
 	 */
-	k_sched_lock();
 	__ASSERT(!k_is_in_isr(), "ISR page faults are forbidden");
 #endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	paging_lock();
 
 	key = irq_lock();
 	status = arch_page_location_get(addr, &page_in_location);
@@ -1559,7 +1657,9 @@ static bool do_page_fault(void *addr, bool pin)
 	__ASSERT(status == ARCH_PAGE_LOCATION_PAGED_OUT,
 		 "unexpected status value %d", status);
 
-	paging_stats_faults_inc(faulting_thread, key);
+	if (!prefetch) {
+		paging_stats_faults_inc(faulting_thread, key);
+	}
 
 	pf = free_page_frame_list_get();
 	if (pf == NULL) {
@@ -1576,10 +1676,11 @@ static bool do_page_fault(void *addr, bool pin)
 	__ASSERT(ret == 0, "failed to prepare page frame");
 
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	paging_transfer_begin(key);
 	irq_unlock(key);
 	/* Interrupts are now unlocked if they were not locked when we entered
 	 * this function, and we may service ISRs. The scheduler is still
-	 * locked.
+	 * locked, or other threads are kept out of paging by the mutex.
 	 */
 #endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
 	if (dirty) {
@@ -1589,6 +1690,7 @@ static bool do_page_fault(void *addr, bool pin)
 
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
 	key = irq_lock();
+	paging_transfer_end();
 	k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_BUSY);
 #endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
 	k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_MAPPED);
@@ -1602,11 +1704,15 @@ static bool do_page_fault(void *addr, bool pin)
 	if (!pin) {
 		k_mem_paging_eviction_add(pf);
 	}
+	if (prefetch) {
+		k_mem_page_frame_set(pf, K_MEM_PAGE_FRAME_PREFETCHED);
+#if defined(CONFIG_DEMAND_PAGING_STATS) && defined(CONFIG_DEMAND_PAGING_PREFETCH)
+		paging_stats.prefetch.cnt++;
+#endif
+	}
 out:
 	irq_unlock(key);
-#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
-	k_sched_unlock();
-#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	paging_unlock();
 
 	return result;
 }
@@ -1615,7 +1721,7 @@ static void do_page_in(void *addr)
 {
 	bool ret;
 
-	ret = do_page_fault(addr, false);
+	ret = do_page_fault(addr, false, false);
 	__ASSERT(ret, "unmapped memory address %p", addr);
 	(void)ret;
 }
@@ -1632,7 +1738,7 @@ static void do_mem_pin(void *addr)
 {
 	bool ret;
 
-	ret = do_page_fault(addr, true);
+	ret = do_page_fault(addr, true, false);
 	__ASSERT(ret, "unmapped memory address %p", addr);
 	(void)ret;
 }
@@ -1645,9 +1751,50 @@ void k_mem_pin(void *addr, size_t size)
 	virt_region_foreach(addr, size, do_mem_pin);
 }
 
+#ifdef CONFIG_DEMAND_PAGING_PREFETCH
+/*
+ * Page in the virtual pages following a faulting one, stopping at the first
+ * one which is not paged out. Each page is paged in like on a fault, the
+ * backing store interface transferring one page at a time.
+ */
+static void do_page_prefetch(void *addr)
+{
+	uint8_t *next = UINT_TO_POINTER(ROUND_DOWN(POINTER_TO_UINT(addr),
+						   CONFIG_MMU_PAGE_SIZE));
+	enum arch_page_location status;
+	uintptr_t location;
+	unsigned int key;
+
+	if (k_is_in_isr()) {
+		return;
+	}
+
+	for (int i = 0; i < CONFIG_DEMAND_PAGING_PREFETCH_PAGES; i++) {
+		next += CONFIG_MMU_PAGE_SIZE;
+
+		key = irq_lock();
+		status = arch_page_location_get(next, &location);
+		irq_unlock(key);
+
+		if (status != ARCH_PAGE_LOCATION_PAGED_OUT ||
+		    !do_page_fault(next, false, true)) {
+			break;
+		}
+	}
+}
+#endif /* CONFIG_DEMAND_PAGING_PREFETCH */
+
 bool k_mem_page_fault(void *addr)
 {
-	return do_page_fault(addr, false);
+	bool ret = do_page_fault(addr, false, false);
+
+#ifdef CONFIG_DEMAND_PAGING_PREFETCH
+	if (ret) {
+		do_page_prefetch(addr);
+	}
+#endif /* CONFIG_DEMAND_PAGING_PREFETCH */
+
+	return ret;
 }
 
 static void do_mem_unpin(void *addr)
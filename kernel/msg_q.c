@@ -195,6 +195,129 @@ static inline int z_vrfy_k_msgq_put(struct k_msgq *msgq, const void *data,
 #include <zephyr/syscalls/k_msgq_put_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+/* Copy up to num_msgs messages from data into the ring buffer, in at most
+ * two chunks. Returns the number of messages copied.
+ */
+static uint32_t msgq_ring_write(struct k_msgq *msgq, const char *data, uint32_t num_msgs)
+{
+	uint32_t count = MIN(num_msgs, msgq->max_msgs - msgq->used_msgs);
+	size_t len = (size_t)count * msgq->msg_size;
+	size_t chunk = MIN(len, (size_t)(msgq->buffer_end - msgq->write_ptr));
+
+	(void)memcpy(msgq->write_ptr, data, chunk);
+	(void)memcpy(msgq->buffer_start, data + chunk, len - chunk);
+
+	msgq->write_ptr += chunk;
+	if (chunk < len) {
+		msgq->write_ptr = msgq->buffer_start + (len - chunk);
+	} else if (msgq->write_ptr == msgq->buffer_end) {
+		msgq->write_ptr = msgq->buffer_start;
+	}
+	msgq->used_msgs += count;
+
+	return count;
+}
+
+/* Copy up to num_msgs messages from the ring buffer into data, in at most
+ * two chunks. Returns the number of messages copied.
+ */
+static uint32_t msgq_ring_read(struct k_msgq *msgq, char *data, uint32_t num_msgs)
+{
+	uint32_t count = MIN(num_msgs, msgq->used_msgs);
+	size_t len = (size_t)count * msgq->msg_size;
+	size_t chunk = MIN(len, (size_t)(msgq->buffer_end - msgq->read_ptr));
+
+	(void)memcpy(data, msgq->read_ptr, chunk);
+	(void)memcpy(data + chunk, msgq->buffer_start, len - chunk);
+
+	msgq->read_ptr += chunk;
+	if (chunk < len) {
+		msgq->read_ptr = msgq->buffer_start + (len - chunk);
+	} else if (msgq->read_ptr == msgq->buffer_end) {
+		msgq->read_ptr = msgq->buffer_start;
+	}
+	msgq->used_msgs -= count;
+
+	return count;
+}
+
+int z_impl_k_msgq_put_batch(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+			    k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	struct k_thread *pending_thread;
+	const char *src = data;
+	bool resched = false;
+	k_spinlock_key_t key;
+	uint32_t count = 0U;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
+
+	if (msgq->used_msgs < msgq->max_msgs) {
+		/* the queue is empty if readers are waiting, serve them first */
+		while (count < num_msgs) {
+			pending_thread = z_unpend_first_thread(&msgq->wait_q);
+			if (pending_thread == NULL) {
+				break;
+			}
+
+			(void)memcpy(pending_thread->base.swap_data, src, msgq->msg_size);
+			arch_thread_return_value_set(pending_thread, 0);
+			z_ready_thread(pending_thread);
+			src += msgq->msg_size;
+			count++;
+			resched = true;
+		}
+
+		if (count < num_msgs) {
+			count += msgq_ring_write(msgq, src, num_msgs - count);
+#ifdef CONFIG_POLL
+			handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+#endif /* CONFIG_POLL */
+		}
+		result = (int)count;
+	} else if ((num_msgs == 0U) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		/* don't wait for message space to become available */
+		result = (num_msgs == 0U) ? 0 : -ENOMSG;
+	} else {
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, put, msgq, timeout);
+
+		/* wait until the first message can be sent */
+		_current->base.swap_data = (void *)data;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
+		return (result == 0) ? 1 : result;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
+
+	if (resched) {
+		/* a single reschedule for all the readers woken up */
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_put_batch(struct k_msgq *msgq, const void *data,
+					  uint32_t num_msgs, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_READ(data, num_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_put_batch(msgq, data, num_msgs, timeout);
+}
+#include <zephyr/syscalls/k_msgq_put_batch_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 void z_impl_k_msgq_get_attrs(struct k_msgq *msgq, struct k_msgq_attrs *attrs)
 {
 	attrs->msg_size = msgq->msg_size;
@@ -293,6 +416,73 @@ static inline int z_vrfy_k_msgq_get(struct k_msgq *msgq, void *data,
 #include <zephyr/syscalls/k_msgq_get_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+int z_impl_k_msgq_get_batch(struct k_msgq *msgq, void *data, uint32_t num_msgs,
+			    k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	struct k_thread *pending_thread;
+	bool resched = false;
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
+
+	if (msgq->used_msgs > 0U) {
+		result = (int)msgq_ring_read(msgq, data, num_msgs);
+
+		/* the queue was full if writers are waiting, refill it */
+		while (msgq->used_msgs < msgq->max_msgs) {
+			pending_thread = z_unpend_first_thread(&msgq->wait_q);
+			if (pending_thread == NULL) {
+				break;
+			}
+
+			(void)msgq_ring_write(msgq, pending_thread->base.swap_data, 1U);
+			arch_thread_return_value_set(pending_thread, 0);
+			z_ready_thread(pending_thread);
+			resched = true;
+		}
+	} else if ((num_msgs == 0U) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		/* don't wait for a message to become available */
+		result = (num_msgs == 0U) ? 0 : -ENOMSG;
+	} else {
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
+
+		/* wait until the first message arrives */
+		_current->base.swap_data = data;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, result);
+		return (result == 0) ? 1 : result;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, result);
+
+	if (resched) {
+		/* a single reschedule for all the writers woken up */
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_get_batch(struct k_msgq *msgq, void *data,
+					  uint32_t num_msgs, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(data, num_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_get_batch(msgq, data, num_msgs, timeout);
+}
+#include <zephyr/syscalls/k_msgq_get_batch_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 {
 	k_spinlock_key_t key;
@@ -31,12 +31,15 @@
 #include <zephyr/toolchain.h>
 #include <ksched.h>
 #include <kthread.h>
+#include <kernel_internal.h>
 #include <wait_q.h>
 #include <errno.h>
+#include <string.h>
 #include <zephyr/init.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/mutex.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/llext/symbol.h>
 LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
@@ -50,8 +53,56 @@ static struct k_spinlock lock;
 
 #ifdef CONFIG_OBJ_CORE_MUTEX
 static struct k_obj_type obj_type_mutex;
+
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+static int k_mutex_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
+
+	struct k_mutex *mutex;
+	k_spinlock_key_t key;
+
+	mutex = CONTAINER_OF(obj_core, struct k_mutex, obj_core);
+	key = k_spin_lock(&lock);
+	memcpy(stats, &mutex->stats, sizeof(mutex->stats));
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static int k_mutex_stats_reset(struct k_obj_core *obj_core)
+{
+	__ASSERT(obj_core != NULL, "NULL parameter");
+
+	struct k_mutex *mutex;
+	k_spinlock_key_t key;
+
+	mutex = CONTAINER_OF(obj_core, struct k_mutex, obj_core);
+	key = k_spin_lock(&lock);
+	memset(&mutex->stats, 0, sizeof(mutex->stats));
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc mutex_stats_desc = {
+	.raw_size = sizeof(struct k_mutex_stats),
+	.query_size = sizeof(struct k_mutex_stats),
+	.raw   = k_mutex_stats_raw,
+	.query = k_mutex_stats_raw,
+	.reset = k_mutex_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+
+#define MUTEX_STATS_INC(mutex, field) ((mutex)->stats.field++)
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
 #endif /* CONFIG_OBJ_CORE_MUTEX */
 
+#ifndef MUTEX_STATS_INC
+#define MUTEX_STATS_INC(mutex, field) do { } while (false)
+#endif
+
 int z_impl_k_mutex_init(struct k_mutex *mutex)
 {
 	mutex->owner = NULL;
@@ -64,6 +115,11 @@ int z_impl_k_mutex_init(struct k_mutex *mutex)
 #ifdef CONFIG_OBJ_CORE_MUTEX
 	k_obj_core_init_and_link(K_OBJ_CORE(mutex), &obj_type_mutex);
 #endif /* CONFIG_OBJ_CORE_MUTEX */
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	memset(&mutex->stats, 0, sizeof(mutex->stats));
+	k_obj_core_stats_register(K_OBJ_CORE(mutex), &mutex->stats,
+				  sizeof(struct k_mutex_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
 
 	SYS_PORT_TRACING_OBJ_INIT(k_mutex, mutex, 0);
 
@@ -102,7 +158,137 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
-int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
+static void mutex_take(struct k_mutex *mutex)
+{
+	mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
+				_current->base.prio :
+				mutex->owner_orig_prio;
+
+	mutex->lock_count++;
+	mutex->owner = _current;
+
+	LOG_DBG("%p took mutex %p, count: %d, orig prio: %d",
+		_current, mutex, mutex->lock_count,
+		mutex->owner_orig_prio);
+}
+
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+/*
+ * Busy wait for a mutex whose owner is running on another CPU, on the
+ * assumption that it will release it sooner than it takes to pend and get
+ * woken up. Called and returns with the lock held. Spinning is pointless
+ * once threads are pending, as unlocking hands the mutex over to the first
+ * of them.
+ */
+static bool mutex_spin(struct k_mutex *mutex, k_spinlock_key_t *key)
+{
+	uint32_t start = k_cycle_get_32();
+	uint32_t limit = k_us_to_cyc_ceil32(CONFIG_MUTEX_ADAPTIVE_SPIN_US);
+
+	while ((z_waitq_head(&mutex->wait_q) == NULL) &&
+	       z_thread_is_active_elsewhere(mutex->owner)) {
+		/* Let the owner take the lock to release the mutex */
+		k_spin_unlock(&lock, *key);
+		arch_nop();
+		*key = k_spin_lock(&lock);
+
+		if (mutex->lock_count == 0U) {
+			return true;
+		}
+
+		if ((k_cycle_get_32() - start) >= limit) {
+			break;
+		}
+	}
+
+	return false;
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
+#ifdef CONFIG_USERSPACE
+/*
+ * An uncontended sys_mutex is taken by storing the owner in its word in
+ * user memory, without the kernel knowing. Before acting on it the
+ * ownership is moved to the k_mutex and flagged in the word, which makes
+ * any later atomic unlock fail and the owner come here to unlock it. A
+ * free mutex is reserved for the current thread the same way. From then
+ * on the word is only changed under the lock. Called with the lock held.
+ */
+/*
+ * A thread found in the word only becomes the owner, and inherits the
+ * priority of waiters, if it could have taken the mutex itself: it has
+ * permission on the mutex and shares the memory domain of the caller.
+ */
+static bool mutex_user_owner_valid(struct k_mutex *mutex, struct k_thread *owner)
+{
+	struct k_object *ko;
+
+	if (owner == _current) {
+		return true;
+	}
+
+	ko = k_object_find(mutex);
+	if ((ko == NULL) || !k_thread_perms_test(ko, owner)) {
+		return false;
+	}
+
+	return owner->mem_domain_info.mem_domain == _current->mem_domain_info.mem_domain;
+}
+
+static int mutex_user_adopt(struct k_mutex *mutex, atomic_t *user_val)
+{
+	for (;;) {
+		atomic_val_t val = atomic_get(user_val);
+		struct k_thread *owner;
+		struct k_object *ko;
+
+		if ((val & Z_SYS_MUTEX_KERNEL) != 0) {
+			return 0;
+		}
+
+		if (val == 0) {
+			if (atomic_cas(user_val, 0,
+				       (atomic_val_t)_current | Z_SYS_MUTEX_KERNEL)) {
+				return 0;
+			}
+			continue;
+		}
+
+		/* The word is writable by user mode, trust no value in it */
+		ko = k_object_find((void *)val);
+		if ((ko == NULL) || (ko->type != K_OBJ_THREAD) ||
+		    ((ko->flags & K_OBJ_FLAG_INITIALIZED) == 0U)) {
+			return -EINVAL;
+		}
+
+		owner = (struct k_thread *)val;
+		if (!mutex_user_owner_valid(mutex, owner)) {
+			/* Forged owner, do not let it be boosted: ignore the
+			 * word and take the mutex as if it was free
+			 */
+			if (atomic_cas(user_val, val,
+				       (atomic_val_t)_current | Z_SYS_MUTEX_KERNEL)) {
+				return 0;
+			}
+			continue;
+		}
+
+		if (!atomic_cas(user_val, val, val | Z_SYS_MUTEX_KERNEL)) {
+			continue;
+		}
+
+		__ASSERT_NO_MSG(mutex->lock_count == 0U);
+
+		mutex->owner = owner;
+		mutex->owner_orig_prio = mutex->owner->base.prio;
+		mutex->lock_count = 1U;
+
+		return 0;
+	}
+}
+#endif /* CONFIG_USERSPACE */
+
+static int mutex_lock(struct k_mutex *mutex, atomic_t *user_val, k_timeout_t timeout)
 {
 	int new_prio;
 	k_spinlock_key_t key;
@@ -114,18 +300,24 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	key = k_spin_lock(&lock);
 
-	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
+#ifdef CONFIG_USERSPACE
+	if (user_val != NULL) {
+		int ret = mutex_user_adopt(mutex, user_val);
 
-		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
-					_current->base.prio :
-					mutex->owner_orig_prio;
+		if (ret != 0) {
+			k_spin_unlock(&lock, key);
 
-		mutex->lock_count++;
-		mutex->owner = _current;
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, ret);
 
-		LOG_DBG("%p took mutex %p, count: %d, orig prio: %d",
-			_current, mutex, mutex->lock_count,
-			mutex->owner_orig_prio);
+			return ret;
+		}
+	}
+#else
+	ARG_UNUSED(user_val);
+#endif /* CONFIG_USERSPACE */
+
+	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
+		mutex_take(mutex);
 
 		k_spin_unlock(&lock, key);
 
@@ -134,6 +326,8 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		return 0;
 	}
 
+	MUTEX_STATS_INC(mutex, contended);
+
 	if (unlikely(K_TIMEOUT_EQ(timeout, K_NO_WAIT))) {
 		k_spin_unlock(&lock, key);
 
@@ -142,6 +336,22 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		return -EBUSY;
 	}
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	/* Releasing a sys_mutex reopens its fast path, don't race with it */
+	if ((user_val == NULL) && mutex_spin(mutex, &key)) {
+		MUTEX_STATS_INC(mutex, spin_acquired);
+		mutex_take(mutex);
+
+		k_spin_unlock(&lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
+
+		return 0;
+	}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
+	MUTEX_STATS_INC(mutex, pended);
+
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mutex, lock, mutex, timeout);
 
 	new_prio = new_prio_for_inheritance(_current->base.prio,
@@ -198,6 +408,11 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 	return -EAGAIN;
 }
 
+int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
+{
+	return mutex_lock(mutex, NULL, timeout);
+}
+
 #ifdef CONFIG_USERSPACE
 static inline int z_vrfy_k_mutex_lock(struct k_mutex *mutex,
 				      k_timeout_t timeout)
@@ -208,7 +423,7 @@ static inline int z_vrfy_k_mutex_lock(struct k_mutex *mutex,
 #include <zephyr/syscalls/k_mutex_lock_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
-int z_impl_k_mutex_unlock(struct k_mutex *mutex)
+static int mutex_unlock(struct k_mutex *mutex, atomic_t *user_val)
 {
 	struct k_thread *new_owner;
 
@@ -268,11 +483,24 @@ int z_impl_k_mutex_unlock(struct k_mutex *mutex)
 		 * adjust its priority
 		 */
 		mutex->owner_orig_prio = new_owner->base.prio;
+#ifdef CONFIG_USERSPACE
+		if (user_val != NULL) {
+			atomic_set(user_val, (atomic_val_t)new_owner | Z_SYS_MUTEX_KERNEL);
+		}
+#endif /* CONFIG_USERSPACE */
 		arch_thread_return_value_set(new_owner, 0);
 		z_ready_thread(new_owner);
 		z_reschedule(&lock, key);
 	} else {
 		mutex->lock_count = 0U;
+#ifdef CONFIG_USERSPACE
+		/* Uncontended again, reopen the atomic fast path */
+		if (user_val != NULL) {
+			atomic_set(user_val, 0);
+		}
+#else
+		ARG_UNUSED(user_val);
+#endif /* CONFIG_USERSPACE */
 		k_spin_unlock(&lock, key);
 	}
 
@@ -283,6 +511,11 @@ k_mutex_unlock_return:
 	return 0;
 }
 
+int z_impl_k_mutex_unlock(struct k_mutex *mutex)
+{
+	return mutex_unlock(mutex, NULL);
+}
+
 #ifdef CONFIG_USERSPACE
 static inline int z_vrfy_k_mutex_unlock(struct k_mutex *mutex)
 {
@@ -292,6 +525,39 @@ static inline int z_vrfy_k_mutex_unlock(struct k_mutex *mutex)
 #include <zephyr/syscalls/k_mutex_unlock_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_USERSPACE
+int z_mutex_lock_user(struct k_mutex *mutex, atomic_t *user_val, k_timeout_t timeout)
+{
+	return mutex_lock(mutex, user_val, timeout);
+}
+
+int z_mutex_unlock_user(struct k_mutex *mutex, atomic_t *user_val)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	atomic_val_t val = atomic_get(user_val);
+	int ret;
+
+	if ((val & Z_SYS_MUTEX_KERNEL) != 0) {
+		k_spin_unlock(&lock, key);
+
+		return mutex_unlock(mutex, user_val);
+	}
+
+	/* Still owned through the fast path, the atomic unlock raced */
+	if (val == 0) {
+		ret = -EINVAL;
+	} else if ((val == (atomic_val_t)_current) && atomic_cas(user_val, val, 0)) {
+		ret = 0;
+	} else {
+		ret = -EPERM;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+#endif /* CONFIG_USERSPACE */
+
 #ifdef CONFIG_OBJ_CORE_MUTEX
 static int init_mutex_obj_core_list(void)
 {
@@ -300,10 +566,18 @@ static int init_mutex_obj_core_list(void)
 	z_obj_type_init(&obj_type_mutex, K_OBJ_TYPE_MUTEX_ID,
 			offsetof(struct k_mutex, obj_core));
 
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	k_obj_type_stats_init(&obj_type_mutex, &mutex_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
+
 	/* Initialize and link statically defined mutexes */
 
 	STRUCT_SECTION_FOREACH(k_mutex, mutex) {
 		k_obj_core_init_and_link(K_OBJ_CORE(mutex), &obj_type_mutex);
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+		k_obj_core_stats_register(K_OBJ_CORE(mutex), &mutex->stats,
+					  sizeof(struct k_mutex_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
 	}
 
 	return 0;
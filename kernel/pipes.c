@@ -43,6 +43,8 @@ void k_pipe_init(struct k_pipe *pipe, unsigned char *buffer, size_t size)
 	pipe->bytes_used = 0U;
 	pipe->read_index = 0U;
 	pipe->write_index = 0U;
+	pipe->write_claim = 0U;
+	pipe->read_claim = 0U;
 	pipe->lock = (struct k_spinlock){};
 	z_waitq_init(&pipe->wait_q.writers);
 	z_waitq_init(&pipe->wait_q.readers);
@@ -105,7 +107,7 @@ static inline void handle_poll_events(struct k_pipe *pipe)
 #endif /* CONFIG_POLL */
 }
 
-void z_impl_k_pipe_flush(struct k_pipe *pipe)
+int z_impl_k_pipe_flush(struct k_pipe *pipe)
 {
 	size_t  bytes_read;
 
@@ -113,31 +115,46 @@ void z_impl_k_pipe_flush(struct k_pipe *pipe)
 
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
+	/* The oldest data is in use by the holder of a read claim */
+	if (pipe->read_claim != 0U) {
+		k_spin_unlock(&pipe->lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, flush, pipe);
+
+		return -EBUSY;
+	}
+
 	(void) pipe_get_internal(key, pipe, NULL, (size_t) -1, &bytes_read, 0U,
 				 K_NO_WAIT);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, flush, pipe);
+
+	return 0;
 }
 
 #ifdef CONFIG_USERSPACE
-void z_vrfy_k_pipe_flush(struct k_pipe *pipe)
+int z_vrfy_k_pipe_flush(struct k_pipe *pipe)
 {
 	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
 
-	z_impl_k_pipe_flush(pipe);
+	return z_impl_k_pipe_flush(pipe);
 }
 #include <zephyr/syscalls/k_pipe_flush_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
-void z_impl_k_pipe_buffer_flush(struct k_pipe *pipe)
+int z_impl_k_pipe_buffer_flush(struct k_pipe *pipe)
 {
 	size_t  bytes_read;
+	int ret = 0;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, buffer_flush, pipe);
 
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
-	if (pipe->buffer != NULL) {
+	if (pipe->read_claim != 0U) {
+		k_spin_unlock(&pipe->lock, key);
+		ret = -EBUSY;
+	} else if (pipe->buffer != NULL) {
 		(void) pipe_get_internal(key, pipe, NULL, pipe->size,
 					 &bytes_read, 0U, K_NO_WAIT);
 	} else {
@@ -145,14 +162,16 @@ void z_impl_k_pipe_buffer_flush(struct k_pipe *pipe)
 	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, buffer_flush, pipe);
+
+	return ret;
 }
 
 #ifdef CONFIG_USERSPACE
-void z_vrfy_k_pipe_buffer_flush(struct k_pipe *pipe)
+int z_vrfy_k_pipe_buffer_flush(struct k_pipe *pipe)
 {
 	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
 
-	z_impl_k_pipe_buffer_flush(pipe);
+	return z_impl_k_pipe_buffer_flush(pipe);
 }
 #endif /* CONFIG_USERSPACE */
 
@@ -172,6 +191,15 @@ int k_pipe_cleanup(struct k_pipe *pipe)
 	}
 
 	if ((pipe->flags & K_PIPE_FLAG_ALLOC) != 0U) {
+		/* The claimed memory is part of the buffer to be freed */
+		if ((pipe->write_claim != 0U) || (pipe->read_claim != 0U)) {
+			k_spin_unlock(&pipe->lock, key);
+
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, cleanup, pipe, -EBUSY);
+
+			return -EBUSY;
+		}
+
 		k_free(pipe->buffer);
 		pipe->buffer = NULL;
 
@@ -184,6 +212,8 @@ int k_pipe_cleanup(struct k_pipe *pipe)
 		pipe->bytes_used = 0U;
 		pipe->read_index = 0U;
 		pipe->write_index = 0U;
+		pipe->write_claim = 0U;
+		pipe->read_claim = 0U;
 		pipe->flags &= ~K_PIPE_FLAG_ALLOC;
 	}
 
@@ -377,6 +407,123 @@ static size_t pipe_write(struct k_pipe *pipe, sys_dlist_t *src_list,
 	return num_bytes_written;
 }
 
+/**
+ * @brief Refill the pipe buffer from the waiting writers
+ */
+static void pipe_writers_refill(struct k_pipe *pipe, bool *reschedule)
+{
+	struct _pipe_desc  pipe_desc[2];
+	sys_dlist_t        src_list;
+	sys_dlist_t        pipe_list;
+
+	if ((pipe->bytes_used == pipe->size) || (pipe->write_claim != 0U)) {
+		return;
+	}
+
+	/*
+	 * The pipe is not full. If there are any waiting writers,
+	 * refill the pipe.
+	 */
+
+	sys_dlist_init(&src_list);
+	sys_dlist_init(&pipe_list);
+
+	(void) pipe_waiter_list_populate(&src_list,
+					 &pipe->wait_q.writers,
+					 pipe->size - pipe->bytes_used);
+
+	(void) pipe_buffer_list_populate(&pipe_list, pipe_desc,
+					 pipe->buffer, pipe->size,
+					 pipe->write_index,
+					 pipe->read_index);
+
+	(void) pipe_write(pipe, &src_list, &pipe_list, reschedule);
+
+	/* Wake up the writers whose data now is entirely in the buffer */
+
+	for (struct k_thread *thread = z_waitq_head(&pipe->wait_q.writers);
+	     thread != NULL; thread = z_waitq_head(&pipe->wait_q.writers)) {
+		struct _pipe_desc *desc = thread->base.swap_data;
+
+		if (desc->bytes_to_xfer != 0U) {
+			break;
+		}
+
+		z_unpend_thread(thread);
+		z_ready_thread(thread);
+
+		*reschedule = true;
+	}
+}
+
+/**
+ * @brief Hand the buffered data to the waiting readers
+ *
+ * Readers only wait on an empty pipe buffer. This is needed when the data
+ * was put in the buffer by committing a write claim.
+ */
+static void pipe_readers_fill(struct k_pipe *pipe, bool *reschedule)
+{
+	struct _pipe_desc  pipe_desc[2];
+	struct _pipe_desc *src;
+	struct _pipe_desc *dest;
+	sys_dlist_t        src_list;
+	sys_dlist_t        dest_list;
+	size_t             bytes_copied;
+
+	if ((pipe->bytes_used == 0U) || (pipe->read_claim != 0U)) {
+		return;
+	}
+
+	sys_dlist_init(&src_list);
+	sys_dlist_init(&dest_list);
+
+	(void) pipe_waiter_list_populate(&dest_list,
+					 &pipe->wait_q.readers,
+					 pipe->bytes_used);
+
+	(void) pipe_buffer_list_populate(&src_list, pipe_desc,
+					 pipe->buffer, pipe->size,
+					 pipe->read_index,
+					 pipe->write_index);
+
+	src = (struct _pipe_desc *)sys_dlist_get(&src_list);
+	dest = (struct _pipe_desc *)sys_dlist_get(&dest_list);
+
+	while ((src != NULL) && (dest != NULL)) {
+		bytes_copied = pipe_xfer(dest->buffer, dest->bytes_to_xfer,
+					 src->buffer, src->bytes_to_xfer);
+
+		src->buffer         += bytes_copied;
+		src->bytes_to_xfer  -= bytes_copied;
+
+		dest->buffer        += bytes_copied;
+		dest->bytes_to_xfer -= bytes_copied;
+
+		pipe->bytes_used -= bytes_copied;
+		pipe->read_index += bytes_copied;
+		if (pipe->read_index >= pipe->size) {
+			pipe->read_index -= pipe->size;
+		}
+
+		if (dest->bytes_to_xfer == 0U) {
+
+			/* The thread's read request has been satisfied. */
+
+			z_unpend_thread(dest->thread);
+			z_ready_thread(dest->thread);
+
+			*reschedule = true;
+
+			dest = (struct _pipe_desc *)sys_dlist_get(&dest_list);
+		}
+
+		if (src->bytes_to_xfer == 0U) {
+			src = (struct _pipe_desc *)sys_dlist_get(&src_list);
+		}
+	}
+}
+
 int z_impl_k_pipe_put(struct k_pipe *pipe, const void *data,
 		      size_t bytes_to_write, size_t *bytes_written,
 		      size_t min_xfer, k_timeout_t timeout)
@@ -411,11 +558,17 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, const void *data,
 	 * Second, write to the pipe buffer, if it exists.
 	 */
 
-	bytes_can_write = pipe_waiter_list_populate(&dest_list,
-						    &pipe->wait_q.readers,
-						    bytes_to_write);
+	bytes_can_write = 0U;
+
+	/* Readers waiting during a read claim must get the buffer data first */
+	if (pipe->read_claim == 0U) {
+		bytes_can_write = pipe_waiter_list_populate(&dest_list,
+							    &pipe->wait_q.readers,
+							    bytes_to_write);
+	}
 
-	if (pipe->bytes_used != pipe->size) {
+	/* The free space right after the data is reserved by a write claim */
+	if ((pipe->bytes_used != pipe->size) && (pipe->write_claim == 0U)) {
 		bytes_can_write += pipe_buffer_list_populate(&dest_list,
 							     pipe_desc,
 							     pipe->buffer,
@@ -552,18 +705,26 @@ static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
 
 	sys_dlist_init(&src_list);
 
-	if (pipe->bytes_used != 0) {
-		bytes_can_read = pipe_buffer_list_populate(&src_list,
-							   pipe_desc,
-							   pipe->buffer,
-							   pipe->size,
-							   pipe->read_index,
-							   pipe->write_index);
-	}
+	/*
+	 * The oldest data is reserved by a read claim. Nothing may be read
+	 * until it is finished, not even from the writers, as it would come
+	 * out of order.
+	 */
 
-	bytes_can_read += pipe_waiter_list_populate(&src_list,
-						    &pipe->wait_q.writers,
-						    bytes_to_read);
+	if (pipe->read_claim == 0U) {
+		if (pipe->bytes_used != 0) {
+			bytes_can_read = pipe_buffer_list_populate(&src_list,
+								   pipe_desc,
+								   pipe->buffer,
+								   pipe->size,
+								   pipe->read_index,
+								   pipe->write_index);
+		}
+
+		bytes_can_read += pipe_waiter_list_populate(&src_list,
+							    &pipe->wait_q.writers,
+							    bytes_to_read);
+	}
 
 	if ((bytes_can_read < min_xfer) &&
 	    (K_TIMEOUT_EQ(timeout, K_NO_WAIT))) {
@@ -625,29 +786,7 @@ static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
 		src_desc = (struct _pipe_desc *)sys_dlist_get(&src_list);
 	}
 
-	if (pipe->bytes_used != pipe->size) {
-		sys_dlist_t         pipe_list;
-
-		/*
-		 * The pipe is not full. If there are any waiting writers,
-		 * refill the pipe.
-		 */
-
-		sys_dlist_init(&src_list);
-		sys_dlist_init(&pipe_list);
-
-		(void) pipe_waiter_list_populate(&src_list,
-						 &pipe->wait_q.writers,
-						 pipe->size - pipe->bytes_used);
-
-		(void) pipe_buffer_list_populate(&pipe_list, pipe_desc,
-						 pipe->buffer, pipe->size,
-						 pipe->write_index,
-						 pipe->read_index);
-
-		(void) pipe_write(pipe, &src_list,
-				  &pipe_list, &reschedule_needed);
-	}
+	pipe_writers_refill(pipe, &reschedule_needed);
 
 	/*
 	 * The immediate success conditions below are backwards
@@ -736,6 +875,139 @@ int z_vrfy_k_pipe_get(struct k_pipe *pipe, void *data, size_t bytes_to_read,
 #include <zephyr/syscalls/k_pipe_get_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+size_t k_pipe_write_claim(struct k_pipe *pipe, unsigned char **data, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	size_t start;
+	size_t claim = 0U;
+
+	if (pipe->size != 0U) {
+		/* Contiguous free space following what is already claimed */
+		start = pipe->write_index + pipe->write_claim;
+		if (start >= pipe->size) {
+			start -= pipe->size;
+		}
+
+		claim = MIN(size, pipe->size - pipe->bytes_used - pipe->write_claim);
+		claim = MIN(claim, pipe->size - start);
+		pipe->write_claim += claim;
+		*data = &pipe->buffer[start];
+	}
+
+	if (claim == 0U) {
+		*data = NULL;
+	}
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return claim;
+}
+
+int k_pipe_write_commit(struct k_pipe *pipe, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool reschedule_needed = false;
+
+	CHECKIF(size > pipe->write_claim) {
+		k_spin_unlock(&pipe->lock, key);
+
+		return -EINVAL;
+	}
+
+	pipe->write_claim = 0U;
+
+	if (size == 0U) {
+		k_spin_unlock(&pipe->lock, key);
+
+		return 0;
+	}
+
+	pipe->bytes_used += size;
+	pipe->write_index += size;
+	if (pipe->write_index >= pipe->size) {
+		pipe->write_index -= pipe->size;
+	}
+
+	pipe_readers_fill(pipe, &reschedule_needed);
+	pipe_writers_refill(pipe, &reschedule_needed);
+
+	if (pipe->bytes_used != 0U) {
+		handle_poll_events(pipe);
+	}
+
+	if (reschedule_needed) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return 0;
+}
+
+size_t k_pipe_read_claim(struct k_pipe *pipe, unsigned char **data, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	size_t start;
+	size_t claim = 0U;
+
+	if (pipe->size != 0U) {
+		/* Contiguous data following what is already claimed */
+		start = pipe->read_index + pipe->read_claim;
+		if (start >= pipe->size) {
+			start -= pipe->size;
+		}
+
+		claim = MIN(size, pipe->bytes_used - pipe->read_claim);
+		claim = MIN(claim, pipe->size - start);
+		pipe->read_claim += claim;
+		*data = &pipe->buffer[start];
+	}
+
+	if (claim == 0U) {
+		*data = NULL;
+	}
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return claim;
+}
+
+int k_pipe_read_finish(struct k_pipe *pipe, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool reschedule_needed = false;
+
+	CHECKIF(size > pipe->read_claim) {
+		k_spin_unlock(&pipe->lock, key);
+
+		return -EINVAL;
+	}
+
+	pipe->read_claim = 0U;
+
+	pipe->bytes_used -= size;
+	pipe->read_index += size;
+	if (pipe->read_index >= pipe->size) {
+		pipe->read_index -= pipe->size;
+	}
+
+	/*
+	 * Readers that came during the claim could not read the remaining
+	 * data, writers may fill the space that was freed.
+	 */
+
+	pipe_readers_fill(pipe, &reschedule_needed);
+	pipe_writers_refill(pipe, &reschedule_needed);
+
+	if (reschedule_needed) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return 0;
+}
+
 size_t z_impl_k_pipe_read_avail(struct k_pipe *pipe)
 {
 	size_t res;
@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file @brief reader-writer lock kernel services
+ *
+ * The lock state is a single atomic word holding the number of readers and
+ * two flags, one for a writer owning the lock and one for threads waiting
+ * on it. Readers take and release an uncontended lock with a compare and
+ * swap on that word. Everything else, writers included, goes through the
+ * kernel spinlock, so the wait queues and the flags only change under it.
+ *
+ * Writers are preferred: while any thread waits, the reader fast path is
+ * closed and readers only get in if no writer holds or waits for the lock.
+ * Ownership is handed over directly on release, to the first waiting writer
+ * or otherwise to all waiting readers, so a woken thread never has to retry.
+ * The writer owning the lock inherits the priority of the waiting threads,
+ * readers are not tracked individually and do not.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <zephyr/toolchain.h>
+#include <ksched.h>
+#include <wait_q.h>
+#include <errno.h>
+#include <zephyr/internal/syscall_handler.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/check.h>
+
+#define RWLOCK_WRITER  ((atomic_val_t)BIT(ATOMIC_BITS - 1))
+#define RWLOCK_WAITERS ((atomic_val_t)BIT(ATOMIC_BITS - 2))
+#define RWLOCK_READERS (RWLOCK_WAITERS - 1)
+
+static struct k_spinlock lock;
+
+int z_impl_k_rwlock_init(struct k_rwlock *rwlock)
+{
+	atomic_set(&rwlock->state, 0);
+	z_waitq_init(&rwlock->read_q);
+	z_waitq_init(&rwlock->write_q);
+	rwlock->writer = NULL;
+	rwlock->writer_orig_prio = K_LOWEST_APPLICATION_THREAD_PRIO;
+
+	k_object_init(rwlock);
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_init(struct k_rwlock *rwlock)
+{
+	K_OOPS(K_SYSCALL_OBJ_INIT(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_init(rwlock);
+}
+#include <zephyr/syscalls/k_rwlock_init_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+static bool rwlock_has_waiters(struct k_rwlock *rwlock)
+{
+	return (z_waitq_head(&rwlock->read_q) != NULL) ||
+	       (z_waitq_head(&rwlock->write_q) != NULL);
+}
+
+/* Raise the writer to the priority of the current thread before it pends */
+static void rwlock_boost_writer(struct k_rwlock *rwlock)
+{
+	struct k_thread *writer = rwlock->writer;
+	int new_prio;
+
+	if ((writer == NULL) || !z_is_prio_higher(_current->base.prio, writer->base.prio)) {
+		return;
+	}
+
+	new_prio = z_get_new_prio_with_ceiling(_current->base.prio);
+	if (z_is_prio_higher(new_prio, writer->base.prio)) {
+		(void)z_thread_prio_set(writer, new_prio);
+	}
+}
+
+/* Set the writer priority from its original one and the waiting threads */
+static bool rwlock_adjust_writer_prio(struct k_rwlock *rwlock)
+{
+	struct k_thread *writer = rwlock->writer;
+	struct k_thread *waiter;
+	int new_prio = rwlock->writer_orig_prio;
+
+	waiter = z_waitq_head(&rwlock->write_q);
+	if ((waiter != NULL) && z_is_prio_higher(waiter->base.prio, new_prio)) {
+		new_prio = waiter->base.prio;
+	}
+
+	waiter = z_waitq_head(&rwlock->read_q);
+	if ((waiter != NULL) && z_is_prio_higher(waiter->base.prio, new_prio)) {
+		new_prio = waiter->base.prio;
+	}
+
+	new_prio = z_get_new_prio_with_ceiling(new_prio);
+
+	if (writer->base.prio != new_prio) {
+		return z_thread_prio_set(writer, new_prio);
+	}
+
+	return false;
+}
+
+/*
+ * Pass a lock no writer owns on to the waiting threads: to the first writer
+ * once the last reader is gone, or to all readers if no writer waits.
+ * Called with the spinlock held, returns true if threads were readied.
+ */
+static bool rwlock_handoff(struct k_rwlock *rwlock)
+{
+	atomic_val_t state = atomic_get(&rwlock->state);
+	struct k_thread *thread;
+	atomic_val_t readers = 0;
+
+	if ((state & RWLOCK_WRITER) != 0) {
+		return false;
+	}
+
+	if (z_waitq_head(&rwlock->write_q) != NULL) {
+		if ((state & RWLOCK_READERS) != 0) {
+			/* The last reader hands it over */
+			return false;
+		}
+
+		thread = z_unpend_first_thread(&rwlock->write_q);
+
+		rwlock->writer = thread;
+		rwlock->writer_orig_prio = thread->base.prio;
+
+		/* The waiters flag keeps the reader fast path closed, no
+		 * other thread can change the state meanwhile.
+		 */
+		atomic_set(&rwlock->state, RWLOCK_WRITER |
+			   (rwlock_has_waiters(rwlock) ? RWLOCK_WAITERS : 0));
+
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+		(void)rwlock_adjust_writer_prio(rwlock);
+
+		return true;
+	}
+
+	while ((thread = z_unpend_first_thread(&rwlock->read_q)) != NULL) {
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+		readers++;
+	}
+
+	/* Readers leaving through the fast path may race with this */
+	if (readers != 0) {
+		(void)atomic_add(&rwlock->state, readers);
+	}
+	(void)atomic_and(&rwlock->state, ~RWLOCK_WAITERS);
+
+	return readers != 0;
+}
+
+/* Clean up after a waiting thread gave up, the spinlock is held */
+static void rwlock_waiter_timeout(struct k_rwlock *rwlock, k_spinlock_key_t key)
+{
+	bool resched = rwlock_handoff(rwlock);
+
+	if (rwlock->writer != NULL) {
+		resched = rwlock_adjust_writer_prio(rwlock) || resched;
+	}
+
+	if (!rwlock_has_waiters(rwlock)) {
+		(void)atomic_and(&rwlock->state, ~RWLOCK_WAITERS);
+	}
+
+	if (resched) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+}
+
+int z_impl_k_rwlock_read_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	atomic_val_t state = atomic_get(&rwlock->state);
+	k_spinlock_key_t key;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	/* Fast path, lock not held by a writer and nobody waiting */
+	while ((state & (RWLOCK_WRITER | RWLOCK_WAITERS)) == 0) {
+		if (atomic_cas(&rwlock->state, state, state + 1)) {
+			return 0;
+		}
+		state = atomic_get(&rwlock->state);
+	}
+
+	key = k_spin_lock(&lock);
+
+	for (;;) {
+		state = atomic_get(&rwlock->state);
+
+		if (((state & RWLOCK_WRITER) == 0) &&
+		    (z_waitq_head(&rwlock->write_q) == NULL)) {
+			if (atomic_cas(&rwlock->state, state, state + 1)) {
+				k_spin_unlock(&lock, key);
+				return 0;
+			}
+			continue;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&lock, key);
+			return -EBUSY;
+		}
+
+		if (((state & RWLOCK_WAITERS) != 0) ||
+		    atomic_cas(&rwlock->state, state, state | RWLOCK_WAITERS)) {
+			break;
+		}
+	}
+
+	rwlock_boost_writer(rwlock);
+
+	if (z_pend_curr(&lock, key, &rwlock->read_q, timeout) == 0) {
+		return 0;
+	}
+
+	key = k_spin_lock(&lock);
+	rwlock_waiter_timeout(rwlock, key);
+
+	return -EAGAIN;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_read_lock(struct k_rwlock *rwlock,
+					    k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_read_lock(rwlock, timeout);
+}
+#include <zephyr/syscalls/k_rwlock_read_lock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_rwlock_read_unlock(struct k_rwlock *rwlock)
+{
+	atomic_val_t state = atomic_get(&rwlock->state);
+	k_spinlock_key_t key;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	for (;;) {
+		CHECKIF((state & RWLOCK_READERS) == 0) {
+			return -EPERM;
+		}
+
+		if (atomic_cas(&rwlock->state, state, state - 1)) {
+			break;
+		}
+		state = atomic_get(&rwlock->state);
+	}
+
+	/* Only the last reader has to wake up a waiting thread */
+	if (state != (RWLOCK_WAITERS | 1)) {
+		return 0;
+	}
+
+	key = k_spin_lock(&lock);
+
+	if (rwlock_handoff(rwlock)) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_read_unlock(struct k_rwlock *rwlock)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_read_unlock(rwlock);
+}
+#include <zephyr/syscalls/k_rwlock_read_unlock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_rwlock_write_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	atomic_val_t state;
+	k_spinlock_key_t key;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	key = k_spin_lock(&lock);
+
+	for (;;) {
+		state = atomic_get(&rwlock->state);
+
+		if (((state & (RWLOCK_WRITER | RWLOCK_READERS)) == 0) &&
+		    (z_waitq_head(&rwlock->write_q) == NULL)) {
+			if (atomic_cas(&rwlock->state, state, state | RWLOCK_WRITER)) {
+				rwlock->writer = _current;
+				rwlock->writer_orig_prio = _current->base.prio;
+				k_spin_unlock(&lock, key);
+				return 0;
+			}
+			continue;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&lock, key);
+			return -EBUSY;
+		}
+
+		if (((state & RWLOCK_WAITERS) != 0) ||
+		    atomic_cas(&rwlock->state, state, state | RWLOCK_WAITERS)) {
+			break;
+		}
+	}
+
+	rwlock_boost_writer(rwlock);
+
+	if (z_pend_curr(&lock, key, &rwlock->write_q, timeout) == 0) {
+		return 0;
+	}
+
+	key = k_spin_lock(&lock);
+	rwlock_waiter_timeout(rwlock, key);
+
+	return -EAGAIN;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_write_lock(struct k_rwlock *rwlock,
+					     k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_write_lock(rwlock, timeout);
+}
+#include <zephyr/syscalls/k_rwlock_write_lock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_rwlock_write_unlock(struct k_rwlock *rwlock)
+{
+	k_spinlock_key_t key;
+	bool resched = false;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	CHECKIF(rwlock->writer != _current) {
+		return -EPERM;
+	}
+
+	key = k_spin_lock(&lock);
+
+	if (_current->base.prio != rwlock->writer_orig_prio) {
+		resched = z_thread_prio_set(_current, rwlock->writer_orig_prio);
+	}
+
+	rwlock->writer = NULL;
+	(void)atomic_and(&rwlock->state, ~RWLOCK_WRITER);
+
+	resched = rwlock_handoff(rwlock) || resched;
+
+	if (resched) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_write_unlock(struct k_rwlock *rwlock)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_write_unlock(rwlock);
+}
+#include <zephyr/syscalls/k_rwlock_write_unlock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
@@ -8,6 +8,7 @@
 #include <zephyr/spinlock.h>
 #include <kswap.h>
 #include <kernel_internal.h>
+#include <ipi.h>
 
 static atomic_t global_lock;
 
@@ -119,6 +120,11 @@ static inline void smp_init_top(void *arg)
 	 */
 	wait_for_start_signal(&cpu_start_flag);
 
+	/* The IPIs sent to this CPU while it was off may have been lost,
+	 * handle the reasons they were sent for.
+	 */
+	(void)ipi_process_pending();
+
 	if ((arg == NULL) || csc.invoke_sched) {
 		/* Initialize the dummy thread struct so that
 		 * the scheduler can schedule actual threads to run.
@@ -340,6 +340,28 @@ void z_check_stack_sentinel(void)
 }
 #endif /* CONFIG_STACK_SENTINEL */
 
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+/* Account for a sample of the stack pointer of a thread
+ *
+ * Called with interrupts locked, at context switches and, with support in
+ * arch/ code, when a thread is interrupted. Stack pointers outside of the
+ * thread stack buffer, e.g. on the privileged stack of a user thread, are
+ * ignored.
+ */
+void z_thread_stack_watermark_update(struct k_thread *thread, uintptr_t sp)
+{
+	uintptr_t end = thread->stack_info.start + thread->stack_info.size;
+
+	if ((sp <= thread->stack_info.start) || (sp > end)) {
+		return;
+	}
+
+	if ((end - sp) > thread->stack_info.watermark) {
+		thread->stack_info.watermark = end - sp;
+	}
+}
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
+
 void z_impl_k_thread_start(struct k_thread *thread)
 {
 	SYS_PORT_TRACING_OBJ_FUNC(k_thread, start, thread);
@@ -503,6 +525,9 @@ static char *setup_thread_stack(struct k_thread *new_thread,
 	new_thread->stack_info.start = (uintptr_t)stack_buf_start;
 	new_thread->stack_info.size = stack_buf_size;
 	new_thread->stack_info.delta = delta;
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+	new_thread->stack_info.watermark = delta;
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
 #endif /* CONFIG_THREAD_STACK_INFO */
 	stack_ptr -= delta;
 
@@ -619,6 +644,9 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 		new_thread->base.cpu_mask = -1; /* allow all cpus */
 	}
 #endif /* CONFIG_SCHED_CPU_MASK */
+#ifdef CONFIG_SYS_ARENA_THREAD
+	new_thread->arena = NULL;
+#endif /* CONFIG_SYS_ARENA_THREAD */
 #ifdef CONFIG_ARCH_HAS_CUSTOM_SWAP_TO_MAIN
 	/* _current may be null if the dummy thread is not used */
 	if (!_current) {
@@ -803,11 +831,13 @@ FUNC_NORETURN void k_thread_user_mode_enter(k_thread_entry_t entry,
 #endif /* CONFIG_USERSPACE */
 }
 
-#if defined(CONFIG_INIT_STACKS) && defined(CONFIG_THREAD_STACK_INFO)
+#if (defined(CONFIG_INIT_STACKS) || defined(CONFIG_THREAD_STACK_WATERMARK)) && \
+	defined(CONFIG_THREAD_STACK_INFO)
 #ifdef CONFIG_STACK_GROWS_UP
 #error "Unsupported configuration for stack analysis"
 #endif /* CONFIG_STACK_GROWS_UP */
 
+#ifdef CONFIG_INIT_STACKS
 int z_stack_space_get(const uint8_t *stack_start, size_t size, size_t *unused_ptr)
 {
 	size_t unused = 0;
@@ -858,6 +888,7 @@ int z_stack_space_get(const uint8_t *stack_start, size_t size, size_t *unused_pt
 
 	return 0;
 }
+#endif /* CONFIG_INIT_STACKS */
 
 int z_impl_k_thread_stack_space_get(const struct k_thread *thread,
 				    size_t *unused_ptr)
@@ -868,8 +899,23 @@ int z_impl_k_thread_stack_space_get(const struct k_thread *thread,
 	}
 #endif /* CONFIG_THREAD_STACK_MEM_MAPPED */
 
+#ifdef CONFIG_INIT_STACKS
 	return z_stack_space_get((const uint8_t *)thread->stack_info.start,
 				 thread->stack_info.size, unused_ptr);
+#else
+	unsigned int key = arch_irq_lock();
+
+	/* The running thread was not sampled since it was switched in */
+	if (thread == _current) {
+		z_thread_stack_watermark_update(_current, (uintptr_t)&key);
+	}
+
+	*unused_ptr = thread->stack_info.size - thread->stack_info.watermark;
+
+	arch_irq_unlock(key);
+
+	return 0;
+#endif /* CONFIG_INIT_STACKS */
 }
 
 #ifdef CONFIG_USERSPACE
@@ -898,7 +944,7 @@ int z_vrfy_k_thread_stack_space_get(const struct k_thread *thread,
 }
 #include <zephyr/syscalls/k_thread_stack_space_get_mrsh.c>
 #endif /* CONFIG_USERSPACE */
-#endif /* CONFIG_INIT_STACKS && CONFIG_THREAD_STACK_INFO */
+#endif /* (CONFIG_INIT_STACKS || CONFIG_THREAD_STACK_WATERMARK) && CONFIG_THREAD_STACK_INFO */
 
 #ifdef CONFIG_USERSPACE
 static inline k_ticks_t z_vrfy_k_thread_timeout_remaining_ticks(
@@ -992,7 +1038,26 @@ int k_thread_runtime_stats_all_get(k_thread_runtime_stats_t *stats)
 		stats->average_cycles   += tmp_stats.average_cycles;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 		stats->idle_cycles      += tmp_stats.idle_cycles;
+#ifdef CONFIG_SCHED_THREAD_USAGE_ISR
+		stats->isr_cycles       += tmp_stats.isr_cycles;
+#endif /* CONFIG_SCHED_THREAD_USAGE_ISR */
+#ifdef CONFIG_SCHED_THREAD_USAGE_SCHED
+		stats->sched_cycles     += tmp_stats.sched_cycles;
+#endif /* CONFIG_SCHED_THREAD_USAGE_SCHED */
+#ifdef CONFIG_SCHED_THREAD_USAGE_HIST
+		for (int j = 0; j < CONFIG_SCHED_THREAD_USAGE_HIST_BINS; j++) {
+			stats->ready_hist[j] += tmp_stats.ready_hist[j];
+		}
+#endif /* CONFIG_SCHED_THREAD_USAGE_HIST */
+#ifdef CONFIG_SCHED_THREAD_USAGE_WINDOW
+		stats->load             += tmp_stats.load;
+#endif /* CONFIG_SCHED_THREAD_USAGE_WINDOW */
 	}
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_WINDOW
+	/* The system load is the average of the CPU loads */
+	stats->load /= num_cpus;
+#endif /* CONFIG_SCHED_THREAD_USAGE_WINDOW */
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
 	return 0;
@@ -14,7 +14,14 @@
 
 static uint64_t curr_tick;
 
+#ifdef CONFIG_TIMEOUT_QUEUE_PAIRING_HEAP
+/* Root of the pairing heap, keyed on the absolute expiry tick */
+static struct _timeout *timeout_heap;
+
+static uint32_t timeout_seq;
+#else
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+#endif /* CONFIG_TIMEOUT_QUEUE_PAIRING_HEAP */
 
 static struct k_spinlock timeout_lock;
 
@@ -24,6 +31,12 @@ static struct k_spinlock timeout_lock;
 /* Ticks left to process in the currently-executing sys_clock_announce() */
 static int announce_remaining;
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/* Set when the system timer is programmed past the first expiry */
+static bool slack_deferred;
+static uint32_t wakeups_avoided;
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 #if defined(CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME)
 int z_clock_hw_cycles_per_sec = CONFIG_SYS_CLOCK_HW_CYCLES_PER_SEC;
 
@@ -36,6 +49,192 @@ static inline int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifdef CONFIG_TIMEOUT_QUEUE_PAIRING_HEAP
+
+/*
+ * Pairing heap backend.  Each queued timeout stores its absolute
+ * expiry tick in dticks.  Children of a node are kept in a singly
+ * linked sibling list starting at ->child, and ->prev points to the
+ * parent for the leftmost child or to the left sibling otherwise.
+ * The root points to itself, so a NULL ->prev means "not queued".
+ */
+
+static inline bool expires_before(const struct _timeout *a,
+				  const struct _timeout *b)
+{
+	return (a->dticks < b->dticks) ||
+	       ((a->dticks == b->dticks) && ((int32_t)(a->seq - b->seq) < 0));
+}
+
+/* Link two heaps, returning the new root (whose sibling is cleared) */
+static struct _timeout *heap_meld(struct _timeout *a, struct _timeout *b)
+{
+	if (a == NULL) {
+		return b;
+	}
+
+	if (b == NULL) {
+		return a;
+	}
+
+	if (expires_before(b, a)) {
+		struct _timeout *tmp = a;
+
+		a = b;
+		b = tmp;
+	}
+
+	b->sibling = a->child;
+	if (b->sibling != NULL) {
+		b->sibling->prev = b;
+	}
+	b->prev = a;
+	a->child = b;
+	a->sibling = NULL;
+
+#ifdef CONFIG_TIMEOUT_SLACK
+	a->slack_due = MIN(a->slack_due, b->slack_due);
+#endif /* CONFIG_TIMEOUT_SLACK */
+
+	return a;
+}
+
+/* Standard two-pass pairing of a sibling list into a single heap */
+static struct _timeout *heap_merge_pairs(struct _timeout *list)
+{
+	struct _timeout *pairs = NULL;
+	struct _timeout *root = NULL;
+
+	while (list != NULL) {
+		struct _timeout *a = list;
+		struct _timeout *b = a->sibling;
+
+		list = (b == NULL) ? NULL : b->sibling;
+		a = heap_meld(a, b);
+		a->sibling = pairs;
+		pairs = a;
+	}
+
+	while (pairs != NULL) {
+		struct _timeout *next = pairs->sibling;
+
+		root = heap_meld(root, pairs);
+		pairs = next;
+	}
+
+	return root;
+}
+
+static struct _timeout *first(void)
+{
+	return timeout_heap;
+}
+
+#ifdef CONFIG_TIMEOUT_SLACK
+static struct _timeout *heap_parent(struct _timeout *t)
+{
+	while (t->prev->child != t) {
+		t = t->prev;
+	}
+
+	return t->prev;
+}
+
+/* A subtree whose slack_due was removed from below parent: recompute
+ * the ancestors that took their value from it, stopping at the first
+ * one that still has another timeout due as early.
+ */
+static void slack_due_update(struct _timeout *parent, int64_t removed)
+{
+	struct _timeout *p = parent;
+
+	while ((p != NULL) && (p->slack_due == removed)) {
+		int64_t due = p->dticks + (int64_t)p->slack;
+
+		for (struct _timeout *c = p->child; c != NULL; c = c->sibling) {
+			due = MIN(due, c->slack_due);
+		}
+
+		if (due == removed) {
+			break;
+		}
+
+		p->slack_due = due;
+		p = (p == timeout_heap) ? NULL : heap_parent(p);
+	}
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
+static void insert_timeout(struct _timeout *to)
+{
+	to->seq = timeout_seq++;
+	to->child = NULL;
+	to->sibling = NULL;
+#ifdef CONFIG_TIMEOUT_SLACK
+	to->slack_due = to->dticks + (int64_t)to->slack;
+#endif /* CONFIG_TIMEOUT_SLACK */
+
+	timeout_heap = heap_meld(timeout_heap, to);
+	timeout_heap->prev = timeout_heap;
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	struct _timeout *sub = heap_merge_pairs(t->child);
+
+	if (t == timeout_heap) {
+		timeout_heap = sub;
+	} else {
+#ifdef CONFIG_TIMEOUT_SLACK
+		struct _timeout *parent = heap_parent(t);
+#endif /* CONFIG_TIMEOUT_SLACK */
+
+		if (t->prev->child == t) {
+			t->prev->child = t->sibling;
+		} else {
+			t->prev->sibling = t->sibling;
+		}
+
+		if (t->sibling != NULL) {
+			t->sibling->prev = t->prev;
+		}
+
+#ifdef CONFIG_TIMEOUT_SLACK
+		slack_due_update(parent, t->slack_due);
+#endif /* CONFIG_TIMEOUT_SLACK */
+
+		timeout_heap = heap_meld(timeout_heap, sub);
+	}
+
+	if (timeout_heap != NULL) {
+		timeout_heap->prev = timeout_heap;
+	}
+
+	t->child = NULL;
+	t->sibling = NULL;
+	t->prev = NULL;
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	return timeout->dticks - curr_tick;
+}
+
+#ifdef CONFIG_TIMEOUT_SLACK
+/* must be locked, ticks until the latest wakeup within the slack of all
+ * the timeouts due before it.  A timeout due after that wakeup has a
+ * later expiry plus slack too, so this is the earliest expiry plus slack
+ * of the whole heap, which the root tracks.
+ */
+static int64_t slack_wakeup_rem(void)
+{
+	return timeout_heap->slack_due - curr_tick;
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
+#else
+
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -50,6 +249,24 @@ static struct _timeout *next(struct _timeout *t)
 	return (n == NULL) ? NULL : CONTAINER_OF(n, struct _timeout, node);
 }
 
+static void insert_timeout(struct _timeout *to)
+{
+	struct _timeout *t;
+
+	for (t = first(); t != NULL; t = next(t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			break;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	if (t == NULL) {
+		sys_dlist_append(&timeout_list, &to->node);
+	}
+}
+
 static void remove_timeout(struct _timeout *t)
 {
 	if (next(t) != NULL) {
@@ -59,6 +276,45 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
+/* must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	k_ticks_t ticks = 0;
+
+	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
+		ticks += t->dticks;
+		if (timeout == t) {
+			break;
+		}
+	}
+
+	return ticks;
+}
+
+#ifdef CONFIG_TIMEOUT_SLACK
+/* must be locked, ticks until the latest wakeup within the slack of all
+ * the timeouts due before it
+ */
+static int64_t slack_wakeup_rem(void)
+{
+	struct _timeout *t = first();
+	int64_t ticks = t->dticks;
+	int64_t wakeup = ticks + t->slack;
+
+	for (t = next(t); t != NULL; t = next(t)) {
+		ticks += t->dticks;
+		if (ticks >= wakeup) {
+			break;
+		}
+		wakeup = MIN(wakeup, ticks + (int64_t)t->slack);
+	}
+
+	return wakeup;
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
+#endif /* CONFIG_TIMEOUT_QUEUE_PAIRING_HEAP */
+
 static int32_t elapsed(void)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
@@ -84,13 +340,22 @@ static int32_t next_timeout(void)
 {
 	struct _timeout *to = first();
 	int32_t ticks_elapsed = elapsed();
+	int64_t rem = 0;
 	int32_t ret;
 
+	if (to != NULL) {
+		rem = timeout_rem(to);
+#ifdef CONFIG_TIMEOUT_SLACK
+		rem = slack_wakeup_rem();
+		slack_deferred = rem > timeout_rem(to);
+#endif /* CONFIG_TIMEOUT_SLACK */
+	}
+
 	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	    ((rem - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, rem - ticks_elapsed);
 	}
 
 	return ret;
@@ -107,12 +372,10 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 	__ASSERT_NO_MSG(arch_mem_coherent(to));
 #endif /* CONFIG_KERNEL_COHERENCE */
 
-	__ASSERT(!sys_dnode_is_linked(&to->node), "");
+	__ASSERT(z_is_inactive_timeout(to), "");
 	to->fn = fn;
 
 	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
-
 		if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
 		    (Z_TICK_ABS(timeout.ticks) >= 0)) {
 			k_ticks_t ticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
@@ -122,20 +385,17 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 			to->dticks = timeout.ticks + 1 + elapsed();
 		}
 
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
+		if (IS_ENABLED(CONFIG_TIMEOUT_QUEUE_PAIRING_HEAP)) {
+			to->dticks += curr_tick;
 		}
 
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
-		}
+		insert_timeout(to);
 
-		if (to == first() && announce_remaining == 0) {
+		/* With slack, a timeout due after the first one may also
+		 * bring the wakeup forward.
+		 */
+		if ((to == first() || IS_ENABLED(CONFIG_TIMEOUT_SLACK)) &&
+		    announce_remaining == 0) {
 			sys_clock_set_timeout(next_timeout(), false);
 		}
 	}
@@ -146,7 +406,7 @@ int z_abort_timeout(struct _timeout *to)
 	int ret = -EINVAL;
 
 	K_SPINLOCK(&timeout_lock) {
-		if (sys_dnode_is_linked(&to->node)) {
+		if (!z_is_inactive_timeout(to)) {
 			remove_timeout(to);
 			ret = 0;
 		}
@@ -155,21 +415,6 @@ int z_abort_timeout(struct _timeout *to)
 	return ret;
 }
 
-/* must be locked */
-static k_ticks_t timeout_rem(const struct _timeout *timeout)
-{
-	k_ticks_t ticks = 0;
-
-	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
-		ticks += t->dticks;
-		if (timeout == t) {
-			break;
-		}
-	}
-
-	return ticks;
-}
-
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
 {
 	k_ticks_t ticks = 0;
@@ -226,11 +471,25 @@ void sys_clock_announce(int32_t ticks)
 	announce_remaining = ticks;
 
 	struct _timeout *t;
+#ifdef CONFIG_TIMEOUT_SLACK
+	bool deferred = slack_deferred;
+	bool fired = false;
+#endif /* CONFIG_TIMEOUT_SLACK */
 
 	for (t = first();
-	     (t != NULL) && (t->dticks <= announce_remaining);
+	     (t != NULL) && (timeout_rem(t) <= announce_remaining);
 	     t = first()) {
-		int dt = t->dticks;
+		int dt = MAX(0, timeout_rem(t));
+
+#ifdef CONFIG_TIMEOUT_SLACK
+		/* Due at a later tick than the previous one: it would have
+		 * needed its own wakeup without the slack.
+		 */
+		if (deferred && fired && (dt > 0)) {
+			wakeups_avoided++;
+		}
+		fired = true;
+#endif /* CONFIG_TIMEOUT_SLACK */
 
 		curr_tick += dt;
 		t->dticks = 0;
@@ -242,7 +501,7 @@ void sys_clock_announce(int32_t ticks)
 		announce_remaining -= dt;
 	}
 
-	if (t != NULL) {
+	if (!IS_ENABLED(CONFIG_TIMEOUT_QUEUE_PAIRING_HEAP) && (t != NULL)) {
 		t->dticks -= announce_remaining;
 	}
 
@@ -258,6 +517,13 @@ void sys_clock_announce(int32_t ticks)
 #endif /* CONFIG_TIMESLICING */
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+uint32_t sys_clock_wakeups_avoided_get(void)
+{
+	return wakeups_avoided;
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 int64_t sys_clock_tick_get(void)
 {
 	uint64_t t = 0U;
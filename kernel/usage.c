@@ -10,12 +10,19 @@
 #include <ksched.h>
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
 
 /* Need one of these for this to work */
 #if !defined(CONFIG_USE_SWITCH) && !defined(CONFIG_INSTRUMENT_THREAD_SWITCHING)
 #error "No data backend configured for CONFIG_SCHED_THREAD_USAGE"
 #endif /* !CONFIG_USE_SWITCH && !CONFIG_INSTRUMENT_THREAD_SWITCHING */
 
+/* z_sched_usage_start() has more to update than [usage0] */
+#if defined(CONFIG_SCHED_THREAD_USAGE_ANALYSIS) || defined(CONFIG_SCHED_THREAD_USAGE_SCHED) || \
+	defined(CONFIG_SCHED_THREAD_USAGE_HIST)
+#define USAGE_START_LOCKED
+#endif
+
 static struct k_spinlock usage_lock;
 
 static uint32_t usage_now(void)
@@ -58,6 +65,79 @@ static void sched_cpu_update_usage(struct _cpu *cpu, uint32_t cycles)
 #define sched_cpu_update_usage(cpu, cycles)   do { } while (0)
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_SCHED
+static void sched_cpu_update_sched(struct _cpu *cpu, uint32_t now)
+{
+	if ((cpu->sched0 != 0) && cpu->usage->track_usage) {
+		cpu->usage->sched += now - cpu->sched0;
+	}
+
+	cpu->sched0 = 0;
+}
+#else
+#define sched_cpu_update_sched(cpu, now)   do { } while (0)
+#endif /* CONFIG_SCHED_THREAD_USAGE_SCHED */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_HIST
+static void hist_add(uint32_t *hist, uint32_t cycles)
+{
+	uint32_t bin = 32 - u32_count_leading_zeros(cycles >>
+						    CONFIG_SCHED_THREAD_USAGE_HIST_SHIFT);
+
+	hist[MIN(bin, CONFIG_SCHED_THREAD_USAGE_HIST_BINS - 1)]++;
+}
+
+/* Start the ready period of a preempted thread, or the wait of a blocked one */
+static void sched_thread_hist_stop(struct k_thread *thread, uint32_t now)
+{
+	if (z_is_idle_thread_object(thread)) {
+		return;
+	}
+
+	thread->base.usage.hist0 = now;
+	thread->base.usage.waiting = !z_is_thread_ready(thread);
+}
+
+/* End the ready period of a thread being switched in */
+static void sched_thread_hist_start(struct _cpu *cpu, struct k_thread *thread,
+				    uint32_t now)
+{
+	struct k_cycle_stats *usage = &thread->base.usage;
+
+	if ((usage->hist0 != 0) && !usage->waiting && usage->track_usage) {
+		uint32_t cycles = now - usage->hist0;
+
+		hist_add(usage->ready_hist, cycles);
+
+		if (cpu->usage->track_usage) {
+			hist_add(cpu->usage->ready_hist, cycles);
+		}
+	}
+
+	usage->hist0 = 0;
+	usage->waiting = false;
+}
+
+void z_sched_usage_ready(struct k_thread *thread)
+{
+	k_spinlock_key_t  key = k_spin_lock(&usage_lock);
+	struct k_cycle_stats *usage = &thread->base.usage;
+	uint32_t now = usage_now();
+
+	if (usage->waiting && (usage->hist0 != 0) && usage->track_usage) {
+		hist_add(usage->wait_hist, now - usage->hist0);
+	}
+
+	usage->hist0 = now;
+	usage->waiting = false;
+
+	k_spin_unlock(&usage_lock, key);
+}
+#else
+#define sched_thread_hist_stop(thread, now)        do { } while (0)
+#define sched_thread_hist_start(cpu, thread, now)  do { } while (0)
+#endif /* CONFIG_SCHED_THREAD_USAGE_HIST */
+
 static void sched_thread_update_usage(struct k_thread *thread, uint32_t cycles)
 {
 	thread->base.usage.total += cycles;
@@ -71,19 +151,47 @@ static void sched_thread_update_usage(struct k_thread *thread, uint32_t cycles)
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 }
 
+#if defined(CONFIG_SCHED_THREAD_USAGE_WINDOW) || defined(CONFIG_SCHED_THREAD_USAGE_ISR)
+/* Charge the current thread of a CPU up to now, and restart its window */
+static void usage_update_current(struct _cpu *cpu, uint32_t now)
+{
+	uint32_t cycles = now - cpu->usage0;
+
+	if (cpu->current->base.usage.track_usage) {
+		sched_thread_update_usage(cpu->current, cycles);
+	}
+
+	/* Don't count a new CPU analysis window for every update while idle */
+	if (cpu->current != cpu->idle_thread) {
+		sched_cpu_update_usage(cpu, cycles);
+	}
+
+	cpu->usage0 = now;
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_WINDOW || CONFIG_SCHED_THREAD_USAGE_ISR */
+
 void z_sched_usage_start(struct k_thread *thread)
 {
-#ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
+#ifdef USAGE_START_LOCKED
 	k_spinlock_key_t  key;
+	struct _cpu *cpu;
+	uint32_t now;
 
 	key = k_spin_lock(&usage_lock);
+	cpu = _current_cpu;
+	now = usage_now();
+
+	cpu->usage0 = now;   /* Always update */
 
-	_current_cpu->usage0 = usage_now();   /* Always update */
+	sched_cpu_update_sched(cpu, now);
+	sched_thread_hist_start(cpu, thread, now);
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
 	if (thread->base.usage.track_usage) {
 		thread->base.usage.num_windows++;
 		thread->base.usage.current = 0;
 	}
+#endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 
 	k_spin_unlock(&usage_lock, key);
 #else
@@ -93,7 +201,7 @@ void z_sched_usage_start(struct k_thread *thread)
 	 */
 
 	_current_cpu->usage0 = usage_now();
-#endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#endif /* USAGE_START_LOCKED */
 }
 
 void z_sched_usage_stop(void)
@@ -105,13 +213,19 @@ void z_sched_usage_stop(void)
 	uint32_t u0 = cpu->usage0;
 
 	if (u0 != 0) {
-		uint32_t cycles = usage_now() - u0;
+		uint32_t now = usage_now();
+		uint32_t cycles = now - u0;
 
 		if (cpu->current->base.usage.track_usage) {
 			sched_thread_update_usage(cpu->current, cycles);
 		}
 
 		sched_cpu_update_usage(cpu, cycles);
+		sched_thread_hist_stop(cpu->current, now);
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_SCHED
+		cpu->sched0 = now;
+#endif /* CONFIG_SCHED_THREAD_USAGE_SCHED */
 	}
 
 	cpu->usage0 = 0;
@@ -166,6 +280,24 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 
 	stats->execution_cycles = stats->total_cycles + stats->idle_cycles;
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_ISR
+	stats->isr_cycles = cpu->usage->isr;
+	stats->execution_cycles += stats->isr_cycles;
+#endif /* CONFIG_SCHED_THREAD_USAGE_ISR */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_SCHED
+	stats->sched_cycles = cpu->usage->sched;
+#endif /* CONFIG_SCHED_THREAD_USAGE_SCHED */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_HIST
+	memcpy(stats->ready_hist, cpu->usage->ready_hist, sizeof(stats->ready_hist));
+	memset(stats->wait_hist, 0, sizeof(stats->wait_hist));
+#endif /* CONFIG_SCHED_THREAD_USAGE_HIST */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_WINDOW
+	stats->load = cpu->usage->load;
+#endif /* CONFIG_SCHED_THREAD_USAGE_WINDOW */
+
 	k_spin_unlock(&usage_lock, key);
 }
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
@@ -221,6 +353,23 @@ void z_sched_thread_usage(struct k_thread *thread,
 	stats->idle_cycles = 0;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_ISR
+	stats->isr_cycles = 0;
+#endif /* CONFIG_SCHED_THREAD_USAGE_ISR */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_SCHED
+	stats->sched_cycles = 0;
+#endif /* CONFIG_SCHED_THREAD_USAGE_SCHED */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_HIST
+	memcpy(stats->ready_hist, thread->base.usage.ready_hist, sizeof(stats->ready_hist));
+	memcpy(stats->wait_hist, thread->base.usage.wait_hist, sizeof(stats->wait_hist));
+#endif /* CONFIG_SCHED_THREAD_USAGE_HIST */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_WINDOW
+	stats->load = thread->base.usage.load;
+#endif /* CONFIG_SCHED_THREAD_USAGE_WINDOW */
+
 	k_spin_unlock(&usage_lock, key);
 }
 
@@ -343,6 +492,139 @@ void k_sys_runtime_stats_disable(void)
 }
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_ISR
+static struct k_isr_stats isr_stats[CONFIG_NUM_IRQS];
+
+uint32_t z_sched_usage_isr_enter(void)
+{
+	k_spinlock_key_t  key = k_spin_lock(&usage_lock);
+	struct _cpu *cpu = _current_cpu;
+	uint32_t now = usage_now();
+
+	if ((cpu->usage_isr_nested++ == 0U) && (cpu->usage0 != 0)) {
+		usage_update_current(cpu, now);
+	}
+
+	k_spin_unlock(&usage_lock, key);
+
+	return now;
+}
+
+void z_sched_usage_isr_exit(unsigned int irq, uint32_t start)
+{
+	k_spinlock_key_t  key = k_spin_lock(&usage_lock);
+	struct _cpu *cpu = _current_cpu;
+	uint32_t now = usage_now();
+	uint32_t cycles = now - start;
+
+	if (irq < ARRAY_SIZE(isr_stats)) {
+		isr_stats[irq].total += cycles;
+		isr_stats[irq].count++;
+	}
+
+	if (--cpu->usage_isr_nested == 0U) {
+		if (cpu->usage->track_usage) {
+			cpu->usage->isr += cycles;
+		}
+
+		/* Don't charge the ISR to the interrupted thread */
+		if (cpu->usage0 != 0) {
+			cpu->usage0 = now;
+		}
+	}
+
+	k_spin_unlock(&usage_lock, key);
+}
+
+int k_isr_runtime_stats_get(unsigned int irq, struct k_isr_stats *stats)
+{
+	k_spinlock_key_t  key;
+
+	CHECKIF((irq >= ARRAY_SIZE(isr_stats)) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&usage_lock);
+	*stats = isr_stats[irq];
+	k_spin_unlock(&usage_lock, key);
+
+	return 0;
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_ISR */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_WINDOW
+static uint32_t window_start;
+
+static void window_update(struct k_cycle_stats *usage, uint64_t total, uint32_t elapsed)
+{
+	uint64_t load = ((total - usage->window0) * 1000U) / elapsed;
+
+	usage->window0 = total;
+	usage->load = (usage->load * (CONFIG_SCHED_THREAD_USAGE_WINDOW_AVG - 1) +
+		       MIN(load, 1000U)) / CONFIG_SCHED_THREAD_USAGE_WINDOW_AVG;
+}
+
+static void usage_window_sample(struct k_timer *timer)
+{
+	k_spinlock_key_t  monitor_key;
+	k_spinlock_key_t  key;
+	struct k_thread *thread;
+	uint32_t now;
+	uint32_t elapsed;
+
+	ARG_UNUSED(timer);
+
+	monitor_key = k_spin_lock(&z_thread_monitor_lock);
+	key = k_spin_lock(&usage_lock);
+
+	now = usage_now();
+	elapsed = MAX(now - window_start, 1U);
+	window_start = now;
+
+	/* Only the current thread of this CPU can be brought up to date */
+	if (_current_cpu->usage0 != 0) {
+		usage_update_current(_current_cpu, now);
+	}
+
+	for (thread = _kernel.threads; thread != NULL; thread = thread->next_thread) {
+		if (thread->base.usage.track_usage) {
+			window_update(&thread->base.usage, thread->base.usage.total, elapsed);
+		}
+	}
+
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (uint8_t i = 0; i < num_cpus; i++) {
+		struct k_cycle_stats *usage = _kernel.cpus[i].usage;
+		uint64_t total = usage->total;
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ISR
+		total += usage->isr;
+#endif /* CONFIG_SCHED_THREAD_USAGE_ISR */
+
+		if (usage->track_usage) {
+			window_update(usage, total, elapsed);
+		}
+	}
+
+	k_spin_unlock(&usage_lock, key);
+	k_spin_unlock(&z_thread_monitor_lock, monitor_key);
+}
+
+static K_TIMER_DEFINE(usage_window_timer, usage_window_sample, NULL);
+
+static int usage_window_init(void)
+{
+	window_start = usage_now();
+	k_timer_start(&usage_window_timer, K_MSEC(CONFIG_SCHED_THREAD_USAGE_WINDOW_MS),
+		      K_MSEC(CONFIG_SCHED_THREAD_USAGE_WINDOW_MS));
+
+	return 0;
+}
+
+SYS_INIT(usage_window_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_SCHED_THREAD_USAGE_WINDOW */
+
 #ifdef CONFIG_OBJ_CORE_STATS_THREAD
 int z_thread_stats_raw(struct k_obj_core *obj_core, void *stats)
 {
@@ -382,6 +664,14 @@ int z_thread_stats_reset(struct k_obj_core *obj_core)
 	stats->longest = 0ULL;
 	stats->num_windows = (thread->base.usage.track_usage) ?  1U : 0U;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#ifdef CONFIG_SCHED_THREAD_USAGE_HIST
+	memset(stats->ready_hist, 0, sizeof(stats->ready_hist));
+	memset(stats->wait_hist, 0, sizeof(stats->wait_hist));
+#endif /* CONFIG_SCHED_THREAD_USAGE_HIST */
+#ifdef CONFIG_SCHED_THREAD_USAGE_WINDOW
+	stats->window0 = 0ULL;
+	stats->load = 0U;
+#endif /* CONFIG_SCHED_THREAD_USAGE_WINDOW */
 
 	if (thread != _current_cpu->current) {
 
@@ -168,6 +168,7 @@ uint8_t *z_priv_stack_find(k_thread_stack_t *stack)
 struct dyn_obj {
 	struct k_object kobj;
 	sys_dnode_t dobj_list;
+	struct rbnode node;
 
 	/* The object itself */
 	void *data;
@@ -183,9 +184,27 @@ extern void z_object_gperf_wordlist_foreach(_wordlist_cb_func_t func,
  */
 static sys_dlist_t obj_list = SYS_DLIST_STATIC_INIT(&obj_list);
 
+static bool node_lessthan(struct rbnode *a, struct rbnode *b)
+{
+	return (uintptr_t)CONTAINER_OF(a, struct dyn_obj, node)->kobj.name <
+	       (uintptr_t)CONTAINER_OF(b, struct dyn_obj, node)->kobj.name;
+}
+
 /*
- * TODO: Write some hash table code that will replace obj_list.
+ * Red/black tree of the same objects, keyed by object address, so that
+ * looking up an object on each system call does not depend on the number
+ * of allocated objects.
  */
+static struct rbtree obj_rb_tree = {
+	.lessthan_fn = node_lessthan
+};
+
+/* Remove an object from both obj_list and obj_rb_tree */
+static void dyn_object_remove(struct dyn_obj *dyn)
+{
+	sys_dlist_remove(&dyn->dobj_list);
+	rb_remove(&obj_rb_tree, &dyn->node);
+}
 
 static size_t obj_size_get(enum k_objects otype)
 {
@@ -223,29 +242,30 @@ static size_t obj_align_get(enum k_objects otype)
 
 static struct dyn_obj *dyn_object_find(const void *obj)
 {
-	struct dyn_obj *node;
+	struct dyn_obj *dyn = NULL;
+	struct rbnode *node;
 	k_spinlock_key_t key;
 
-	/* For any dynamically allocated kernel object, the object
-	 * pointer is just a member of the containing struct dyn_obj,
-	 * so just a little arithmetic is necessary to locate the
-	 * corresponding struct rbnode
-	 */
 	key = k_spin_lock(&lists_lock);
 
-	SYS_DLIST_FOR_EACH_CONTAINER(&obj_list, node, dobj_list) {
-		if (node->kobj.name == obj) {
-			goto end;
+	node = obj_rb_tree.root;
+	while (node != NULL) {
+		dyn = CONTAINER_OF(node, struct dyn_obj, node);
+		if (dyn->kobj.name == obj) {
+			break;
 		}
+
+		node = z_rb_child(node, (uintptr_t)dyn->kobj.name < (uintptr_t)obj ? 1U : 0U);
 	}
 
-	/* No object found */
-	node = NULL;
+	if (node == NULL) {
+		/* No object found */
+		dyn = NULL;
+	}
 
- end:
 	k_spin_unlock(&lists_lock, key);
 
-	return node;
+	return dyn;
 }
 
 /**
@@ -376,6 +396,7 @@ static struct k_object *dynamic_object_create(enum k_objects otype, size_t align
 	k_spinlock_key_t key = k_spin_lock(&lists_lock);
 
 	sys_dlist_append(&obj_list, &dyn->dobj_list);
+	rb_insert(&obj_rb_tree, &dyn->node);
 	k_spin_unlock(&lists_lock, key);
 
 	return &dyn->kobj;
@@ -469,7 +490,10 @@ void k_object_free(void *obj)
 
 	dyn = dyn_object_find(obj);
 	if (dyn != NULL) {
-		sys_dlist_remove(&dyn->dobj_list);
+		k_spinlock_key_t lists_key = k_spin_lock(&lists_lock);
+
+		dyn_object_remove(dyn);
+		k_spin_unlock(&lists_lock, lists_key);
 
 		if (dyn->kobj.type == K_OBJ_THREAD) {
 			thread_idx_free(dyn->kobj.data.thread_id);
@@ -533,6 +557,10 @@ static unsigned int thread_index_get(struct k_thread *thread)
 	return ko->data.thread_id;
 }
 
+/* Removes an unreferenced dynamic object, so lists_lock must be held for
+ * dynamic objects. k_object_wordlist_foreach() already holds it around its
+ * callbacks, hence it cannot be taken here.
+ */
 static void unref_check(struct k_object *ko, uintptr_t index)
 {
 	k_spinlock_key_t key = k_spin_lock(&obj_lock);
@@ -579,7 +607,7 @@ static void unref_check(struct k_object *ko, uintptr_t index)
 		break;
 	}
 
-	sys_dlist_remove(&dyn->dobj_list);
+	dyn_object_remove(dyn);
 	k_free(dyn->data);
 	k_free(dyn);
 out:
@@ -625,7 +653,17 @@ void k_thread_perms_clear(struct k_object *ko, struct k_thread *thread)
 
 	if (index != -1) {
 		sys_bitfield_clear_bit((mem_addr_t)&ko->perms, index);
+#ifdef CONFIG_DYNAMIC_OBJECTS
+		/* An unreferenced object is removed from obj_rb_tree, which
+		 * dyn_object_find() walks under lists_lock
+		 */
+		k_spinlock_key_t key = k_spin_lock(&lists_lock);
+
 		unref_check(ko, index);
+		k_spin_unlock(&lists_lock, key);
+#else
+		unref_check(ko, index);
+#endif /* CONFIG_DYNAMIC_OBJECTS */
 	}
 }
 
@@ -645,19 +683,24 @@ void k_thread_perms_all_clear(struct k_thread *thread)
 	}
 }
 
-static int thread_perms_test(struct k_object *ko)
+bool k_thread_perms_test(struct k_object *ko, struct k_thread *thread)
 {
 	int index;
 
 	if ((ko->flags & K_OBJ_FLAG_PUBLIC) != 0U) {
-		return 1;
+		return true;
 	}
 
-	index = thread_index_get(_current);
+	index = thread_index_get(thread);
 	if (index != -1) {
-		return sys_bitfield_test_bit((mem_addr_t)&ko->perms, index);
+		return sys_bitfield_test_bit((mem_addr_t)&ko->perms, index) != 0;
 	}
-	return 0;
+	return false;
+}
+
+static int thread_perms_test(struct k_object *ko)
+{
+	return k_thread_perms_test(ko, _current) ? 1 : 0;
 }
 
 static void dump_permission_error(struct k_object *ko)
@@ -245,6 +245,92 @@ static inline bool notify_queue_locked(struct k_work_q *queue)
 	return rv;
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+/* Wake an idle sibling of a busy pool member so it can steal new work.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue that just received work.
+ */
+static void notify_pool_locked(struct k_work_q *queue)
+{
+	struct k_work_q_pool *pool = queue->pool;
+
+	if ((pool == NULL) || !flag_test(&queue->flags, K_WORK_QUEUE_BUSY_BIT)) {
+		return;
+	}
+
+	for (uint32_t i = 0; i < pool->num_queues; i++) {
+		struct k_work_q *sibling = &pool->queues[i];
+
+		if ((sibling != queue) &&
+		    !flag_test(&sibling->flags, K_WORK_QUEUE_BUSY_BIT) &&
+		    notify_queue_locked(sibling)) {
+			break;
+		}
+	}
+}
+
+/* Take the oldest pending item from a busy sibling of a pool member.
+ *
+ * Items are never taken from a draining queue, and neither a flusher nor
+ * an item followed by its flusher is taken, as the flusher must complete
+ * after the item on the same queue.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the idle queue looking for work.
+ *
+ * @return the node of the stolen work item, now owned by @p queue, or
+ * NULL if nothing could be stolen.
+ */
+static sys_snode_t *pool_steal_locked(struct k_work_q *queue)
+{
+	struct k_work_q_pool *pool = queue->pool;
+
+	if ((pool == NULL) || flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT)) {
+		return NULL;
+	}
+
+	uint32_t self = queue - pool->queues;
+
+	for (uint32_t i = 1; i < pool->num_queues; i++) {
+		struct k_work_q *victim = &pool->queues[(self + i) % pool->num_queues];
+		sys_snode_t *node = sys_slist_peek_head(&victim->pending);
+		sys_snode_t *next;
+		struct k_work *work;
+
+		if ((node == NULL) ||
+		    !flag_test(&victim->flags, K_WORK_QUEUE_BUSY_BIT) ||
+		    flag_test(&victim->flags, K_WORK_QUEUE_DRAIN_BIT)) {
+			continue;
+		}
+
+		work = CONTAINER_OF(node, struct k_work, node);
+		next = sys_slist_peek_next(node);
+
+		/* An item resubmitted by its own handler is still running on
+		 * the victim, and must not run concurrently on this queue.
+		 */
+		if (flag_test(&work->flags, K_WORK_RUNNING_BIT) ||
+		    flag_test(&work->flags, K_WORK_FLUSHING_BIT) ||
+		    ((next != NULL) &&
+		     flag_test(&CONTAINER_OF(next, struct k_work, node)->flags,
+			       K_WORK_FLUSHING_BIT))) {
+			continue;
+		}
+
+		(void)sys_slist_get(&victim->pending);
+		work->queue = queue;
+		pool->steals++;
+
+		return node;
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 /* Submit an work item to a queue if queue state allows new work.
  *
  * Submission is rejected if no queue is provided, or if the queue is
@@ -293,6 +379,9 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 		sys_slist_append(&queue->pending, &work->node);
 		ret = 1;
 		(void)notify_queue_locked(queue);
+#ifdef CONFIG_WORKQUEUE_POOL
+		notify_pool_locked(queue);
+#endif /* CONFIG_WORKQUEUE_POOL */
 	}
 
 	return ret;
@@ -629,6 +718,11 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 
 		/* Check for and prepare any new work. */
 		node = sys_slist_get(&queue->pending);
+#ifdef CONFIG_WORKQUEUE_POOL
+		if (node == NULL) {
+			node = pool_steal_locked(queue);
+		}
+#endif /* CONFIG_WORKQUEUE_POOL */
 		if (node != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
@@ -726,19 +820,21 @@ void k_work_queue_init(struct k_work_q *queue)
 	SYS_PORT_TRACING_OBJ_INIT(k_work_queue, queue);
 }
 
-void k_work_queue_start(struct k_work_q *queue,
-			k_thread_stack_t *stack,
-			size_t stack_size,
-			int prio,
-			const struct k_work_queue_config *cfg)
+/* Set up a work queue and create its thread without starting it.
+ *
+ * See k_work_queue_start() for parameters.
+ */
+static void work_queue_create(struct k_work_q *queue,
+			      k_thread_stack_t *stack,
+			      size_t stack_size,
+			      int prio,
+			      const struct k_work_queue_config *cfg)
 {
 	__ASSERT_NO_MSG(queue);
 	__ASSERT_NO_MSG(stack);
 	__ASSERT_NO_MSG(!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
 	uint32_t flags = K_WORK_QUEUE_STARTED;
 
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
-
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
@@ -764,7 +860,17 @@ void k_work_queue_start(struct k_work_q *queue,
 	if ((cfg != NULL) && (cfg->essential)) {
 		queue->thread.base.user_options |= K_ESSENTIAL;
 	}
+}
+
+void k_work_queue_start(struct k_work_q *queue,
+			k_thread_stack_t *stack,
+			size_t stack_size,
+			int prio,
+			const struct k_work_queue_config *cfg)
+{
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
 
+	work_queue_create(queue, stack, stack_size, prio, cfg);
 	k_thread_start(&queue->thread);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
@@ -822,6 +928,139 @@ int k_work_queue_unplug(struct k_work_q *queue)
 	return ret;
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+
+void k_work_q_pool_start(struct k_work_q_pool *pool, int prio,
+			 const struct k_work_queue_config *cfg)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+	__ASSERT_NO_MSG(pool->num_queues > 0U);
+
+	for (uint32_t i = 0; i < pool->num_queues; i++) {
+		struct k_work_q *queue = &pool->queues[i];
+		k_thread_stack_t *stack = (k_thread_stack_t *)
+			((uint8_t *)pool->stacks + (i * pool->stack_len));
+
+		k_work_queue_init(queue);
+		queue->pool = pool;
+		work_queue_create(queue, stack, pool->stack_size, prio, cfg);
+
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_CPU_MASK)
+		(void)k_thread_cpu_pin(&queue->thread,
+				       i % arch_num_cpus());
+#endif /* CONFIG_SMP && CONFIG_SCHED_CPU_MASK */
+
+		k_thread_start(&queue->thread);
+	}
+}
+
+/* Select the member queue a new submission should go to.
+ *
+ * Invoked with work lock held.
+ */
+static struct k_work_q *pool_select_locked(struct k_work_q_pool *pool)
+{
+	for (uint32_t i = 0; i < pool->num_queues; i++) {
+		if (_current == &pool->queues[i].thread) {
+			/* Chained submission stays local */
+			return &pool->queues[i];
+		}
+	}
+
+#ifdef CONFIG_SMP
+	return &pool->queues[_current_cpu->id % pool->num_queues];
+#else
+	return &pool->queues[pool->next++ % pool->num_queues];
+#endif /* CONFIG_SMP */
+}
+
+int k_work_submit_to_pool(struct k_work_q_pool *pool, struct k_work *work)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+	__ASSERT_NO_MSG(work != NULL);
+	__ASSERT_NO_MSG(work->handler != NULL);
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_work_q *queue = pool_select_locked(pool);
+	int ret = submit_to_queue_locked(work, &queue);
+
+	k_spin_unlock(&lock, key);
+
+	if (ret > 0) {
+		z_reschedule_unlocked();
+	}
+
+	return ret;
+}
+
+#ifdef CONFIG_SYS_CLOCK_EXISTS
+
+int k_work_schedule_for_pool(struct k_work_q_pool *pool,
+			     struct k_work_delayable *dwork,
+			     k_timeout_t delay)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_work_q *queue = pool_select_locked(pool);
+
+	k_spin_unlock(&lock, key);
+
+	return k_work_schedule_for_queue(queue, dwork, delay);
+}
+
+int k_work_reschedule_for_pool(struct k_work_q_pool *pool,
+			       struct k_work_delayable *dwork,
+			       k_timeout_t delay)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_work_q *queue = pool_select_locked(pool);
+
+	k_spin_unlock(&lock, key);
+
+	return k_work_reschedule_for_queue(queue, dwork, delay);
+}
+
+#endif /* CONFIG_SYS_CLOCK_EXISTS */
+
+int k_work_q_pool_drain(struct k_work_q_pool *pool, bool plug)
+{
+	int ret = 0;
+
+	__ASSERT_NO_MSG(pool != NULL);
+
+	for (uint32_t i = 0; i < pool->num_queues; i++) {
+		int rc = k_work_queue_drain(&pool->queues[i], plug);
+
+		if (rc < 0) {
+			return rc;
+		}
+
+		ret |= rc;
+	}
+
+	return ret;
+}
+
+int k_work_q_pool_unplug(struct k_work_q_pool *pool)
+{
+	int ret = -EALREADY;
+
+	__ASSERT_NO_MSG(pool != NULL);
+
+	for (uint32_t i = 0; i < pool->num_queues; i++) {
+		if (k_work_queue_unplug(&pool->queues[i]) == 0) {
+			ret = 0;
+		}
+	}
+
+	return ret;
+}
+
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 #ifdef CONFIG_SYS_CLOCK_EXISTS
 
 /* Timeout handler for delayable work.
@@ -9,6 +9,7 @@
 #include <zephyr/kernel.h>
 #include <kernel_internal.h>
 #include <zephyr/linker/linker-defs.h>
+#include <zephyr/debug/boot_profile.h>
 
 #ifdef CONFIG_STACK_CANARIES
 #ifdef CONFIG_STACK_CANARIES_TLS
@@ -25,23 +26,27 @@ extern volatile uintptr_t __stack_chk_guard;
  */
 void z_data_copy(void)
 {
-	z_early_memcpy(&__data_region_start, &__data_region_load_start,
-		       __data_region_end - __data_region_start);
+#ifdef CONFIG_BOOT_PROFILE
+	uint32_t profile_start = boot_profile_timestamp();
+#endif /* CONFIG_BOOT_PROFILE */
+
+	z_early_memcpy_start(&__data_region_start, &__data_region_load_start,
+			     __data_region_end - __data_region_start);
 #ifdef CONFIG_ARCH_HAS_RAMFUNC_SUPPORT
-	z_early_memcpy(&__ramfunc_start, &__ramfunc_load_start,
-		       (uintptr_t) &__ramfunc_size);
+	z_early_memcpy_start(&__ramfunc_start, &__ramfunc_load_start,
+			     (uintptr_t) &__ramfunc_size);
 #endif /* CONFIG_ARCH_HAS_RAMFUNC_SUPPORT */
 #if DT_NODE_HAS_STATUS(DT_CHOSEN(zephyr_ccm), okay)
-	z_early_memcpy(&__ccm_data_start, &__ccm_data_rom_start,
-		       __ccm_data_end - __ccm_data_start);
+	z_early_memcpy_start(&__ccm_data_start, &__ccm_data_rom_start,
+			     __ccm_data_end - __ccm_data_start);
 #endif
 #if DT_NODE_HAS_STATUS(DT_CHOSEN(zephyr_itcm), okay)
-	z_early_memcpy(&__itcm_start, &__itcm_load_start,
-		       (uintptr_t) &__itcm_size);
+	z_early_memcpy_start(&__itcm_start, &__itcm_load_start,
+			     (uintptr_t) &__itcm_size);
 #endif
 #if DT_NODE_HAS_STATUS(DT_CHOSEN(zephyr_dtcm), okay)
-	z_early_memcpy(&__dtcm_data_start, &__dtcm_data_load_start,
-		       __dtcm_data_end - __dtcm_data_start);
+	z_early_memcpy_start(&__dtcm_data_start, &__dtcm_data_load_start,
+			     __dtcm_data_end - __dtcm_data_start);
 #endif
 #ifdef CONFIG_CODE_DATA_RELOCATION
 	extern void data_copy_xip_relocation(void);
@@ -68,8 +73,12 @@ void z_data_copy(void)
 	}
 	__stack_chk_guard = guard_copy;
 #else
-	z_early_memcpy(&_app_smem_start, &_app_smem_rom_start,
-		       _app_smem_end - _app_smem_start);
+	z_early_memcpy_start(&_app_smem_start, &_app_smem_rom_start,
+			     _app_smem_end - _app_smem_start);
 #endif /* CONFIG_STACK_CANARIES */
 #endif /* CONFIG_USERSPACE */
+	z_early_mem_wait();
+#ifdef CONFIG_BOOT_PROFILE
+	z_boot_profile_early(BOOT_PROFILE_DATA_COPY, profile_start);
+#endif /* CONFIG_BOOT_PROFILE */
 }
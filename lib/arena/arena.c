@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/arena.h>
+#include <zephyr/sys/util.h>
+
+void sys_arena_init(struct sys_arena *arena, void *mem, size_t bytes)
+{
+	arena->base = mem;
+	arena->size = bytes;
+	arena->offset = 0;
+	arena->max_offset = 0;
+	arena->heap = NULL;
+}
+
+int sys_arena_init_from_heap(struct sys_arena *arena, struct k_heap *heap,
+			     size_t bytes, k_timeout_t timeout)
+{
+	void *mem = k_heap_alloc(heap, bytes, timeout);
+
+	if (mem == NULL) {
+		return -ENOMEM;
+	}
+
+	sys_arena_init(arena, mem, bytes);
+	arena->heap = heap;
+
+	return 0;
+}
+
+void sys_arena_release(struct sys_arena *arena)
+{
+	if (arena->heap != NULL) {
+		k_heap_free(arena->heap, arena->base);
+		arena->heap = NULL;
+	}
+
+	arena->base = NULL;
+	arena->size = 0;
+	arena->offset = 0;
+}
+
+void *sys_arena_aligned_alloc(struct sys_arena *arena, size_t align, size_t bytes)
+{
+	uintptr_t start = (uintptr_t)arena->base + arena->offset;
+	size_t offset;
+
+	__ASSERT((align & (align - 1)) == 0, "align must be a power of 2");
+
+	if (align != 0) {
+		start = ROUND_UP(start, align);
+	}
+	offset = start - (uintptr_t)arena->base;
+
+	/* Done this way so that a huge request cannot overflow */
+	if ((offset > arena->size) || (bytes > arena->size - offset)) {
+		return NULL;
+	}
+
+	arena->offset = offset + bytes;
+	arena->max_offset = MAX(arena->max_offset, arena->offset);
+
+	return (void *)start;
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_LIB_CRC_CRC32_TABLE_H_
+#define ZEPHYR_LIB_CRC_CRC32_TABLE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/sys/byteorder.h>
+
+/* Number of 256 entry lookup tables used by the reflected CRC32 variants,
+ * 0 meaning the 16 entry nibble table.
+ */
+#if defined(CONFIG_CRC32_TABLE_SLICING_BY_8)
+#define CRC32_TABLE_SLICES 8
+#elif defined(CONFIG_CRC32_TABLE_SLICING_BY_4)
+#define CRC32_TABLE_SLICES 4
+#elif defined(CONFIG_CRC32_TABLE_BYTE)
+#define CRC32_TABLE_SLICES 1
+#else
+#define CRC32_TABLE_SLICES 0
+#endif
+
+#if CRC32_TABLE_SLICES > 0
+/*
+ * Update a reflected CRC32 without pre or post inversion. Entry i of table k
+ * is the CRC of byte i followed by k zero bytes, which lets the slicing
+ * variants process 4 or 8 bytes with independent lookups.
+ */
+static inline uint32_t crc32_table_update(const uint32_t table[][256], uint32_t crc,
+					  const uint8_t *data, size_t len)
+{
+#if CRC32_TABLE_SLICES == 8
+	for (; len >= 8; len -= 8, data += 8) {
+		uint32_t low = crc ^ sys_get_le32(data);
+		uint32_t high = sys_get_le32(data + 4);
+
+		crc = table[7][low & 0xff] ^ table[6][(low >> 8) & 0xff] ^
+		      table[5][(low >> 16) & 0xff] ^ table[4][low >> 24] ^
+		      table[3][high & 0xff] ^ table[2][(high >> 8) & 0xff] ^
+		      table[1][(high >> 16) & 0xff] ^ table[0][high >> 24];
+	}
+#elif CRC32_TABLE_SLICES == 4
+	for (; len >= 4; len -= 4, data += 4) {
+		uint32_t word = crc ^ sys_get_le32(data);
+
+		crc = table[3][word & 0xff] ^ table[2][(word >> 8) & 0xff] ^
+		      table[1][(word >> 16) & 0xff] ^ table[0][word >> 24];
+	}
+#endif
+
+	for (; len > 0; len--, data++) {
+		crc = (crc >> 8) ^ table[0][(crc ^ *data) & 0xff];
+	}
+
+	return crc;
+}
+#endif /* CRC32_TABLE_SLICES > 0 */
+
+#endif /* ZEPHYR_LIB_CRC_CRC32_TABLE_H_ */
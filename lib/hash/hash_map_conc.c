@@ -0,0 +1,626 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/hash_map.h>
+#include <zephyr/sys/hash_map_conc.h>
+#include <zephyr/sys/util.h>
+
+/*
+ * Each shard has a current table and, while it is being resized, the
+ * previous one from which MIGRATE_STEP buckets are moved on every write.
+ * A key is in exactly one of them.
+ *
+ * Writers modify a shard under its spinlock, with the sequence counter
+ * odd for the duration of the change. Lookups search both tables and
+ * start over if the counter was odd or changed meanwhile.
+ *
+ * Lookups count themselves in readers[epoch & 1] while they may hold a
+ * table pointer. A table unpublished at epoch E is freed once the epoch
+ * reached E + 3: each parity has then been seen drained by an advance
+ * started after the table was unpublished.
+ */
+#define MIGRATE_STEP 8
+#define GRACE_EPOCHS 3
+
+#define N_SHARDS CONFIG_SYS_HASH_MAP_CONC_SHARDS
+
+/* size and n_buckets are read as plain size_t through sys_hashmap_size() & co */
+#define COUNTER(_field) ((atomic_t *)&(_field))
+
+enum bucket_state {
+	UNUSED,
+	USED,
+	TOMBSTONE,
+};
+
+struct conc_entry {
+	uint64_t key;
+	uint64_t value;
+	uint32_t hash;
+	enum bucket_state state;
+};
+
+struct conc_table {
+	/* retired list of the shard */
+	struct conc_table *next;
+	atomic_val_t epoch;
+	size_t n_buckets;
+	size_t n_live;
+	/* USED and TOMBSTONE entries */
+	size_t n_used;
+	struct conc_entry entries[];
+};
+
+BUILD_ASSERT(IS_POWER_OF_TWO(N_SHARDS), "The number of shards must be a power of 2");
+BUILD_ASSERT(sizeof(size_t) == sizeof(atomic_t));
+BUILD_ASSERT(offsetof(struct sys_hashmap_conc_data, buckets) ==
+	     offsetof(struct sys_hashmap_data, buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_conc_data, n_buckets) ==
+	     offsetof(struct sys_hashmap_data, n_buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_conc_data, size) ==
+	     offsetof(struct sys_hashmap_data, size));
+
+static inline struct sys_hashmap_conc_data *conc_data(const struct sys_hashmap *map)
+{
+	return (struct sys_hashmap_conc_data *)map->data;
+}
+
+static inline struct sys_hashmap_conc_shard *conc_shard(struct sys_hashmap_conc_data *data,
+							 uint32_t hash)
+{
+	/* the low bits of the hash select the bucket, mix the high ones in */
+	return &data->shards[((hash * 2654435761U) >> 16) & (N_SHARDS - 1)];
+}
+
+static inline size_t table_live(const struct conc_table *table)
+{
+	return (table == NULL) ? 0 : table->n_live;
+}
+
+static inline bool epoch_elapsed(struct sys_hashmap_conc_data *data, atomic_val_t epoch)
+{
+	return (unsigned long)atomic_get(&data->epoch) - (unsigned long)epoch >= GRACE_EPOCHS;
+}
+
+/*
+ * Find the entry of @p key, NULL if there is none. With @p slot, also
+ * return the first bucket the key could be inserted in.
+ */
+static struct conc_entry *table_find(struct conc_table *table, uint32_t hash, uint64_t key,
+				     struct conc_entry **slot)
+{
+	struct conc_entry *entry;
+
+	if (slot != NULL) {
+		*slot = NULL;
+	}
+
+	if (table == NULL) {
+		return NULL;
+	}
+
+	for (size_t i = 0, j = hash; i < table->n_buckets; ++i, ++j) {
+		j &= (table->n_buckets - 1);
+		entry = &table->entries[j];
+
+		if (entry->state == USED) {
+			if (entry->hash == hash && entry->key == key) {
+				return entry;
+			}
+			continue;
+		}
+
+		if (slot != NULL && *slot == NULL) {
+			*slot = entry;
+		}
+
+		if (entry->state == UNUSED) {
+			break;
+		}
+	}
+
+	return NULL;
+}
+
+static void table_put(struct conc_table *table, struct conc_entry *slot, uint32_t hash,
+		      uint64_t key, uint64_t value)
+{
+	__ASSERT_NO_MSG(slot != NULL && slot->state != USED);
+
+	if (slot->state == UNUSED) {
+		++table->n_used;
+	}
+
+	++table->n_live;
+	slot->key = key;
+	slot->value = value;
+	slot->hash = hash;
+	slot->state = USED;
+}
+
+static atomic_t *conc_read_lock(struct sys_hashmap_conc_data *data)
+{
+	/* only spreads the counters, it does not matter if the thread migrates */
+	unsigned int cpu = IS_ENABLED(CONFIG_SMP) ? arch_curr_cpu()->id : 0;
+	atomic_t *readers = &data->readers[atomic_get(&data->epoch) & 1][cpu];
+
+	atomic_inc(readers);
+
+	return readers;
+}
+
+static inline void conc_read_unlock(atomic_t *readers)
+{
+	atomic_dec(readers);
+}
+
+/* Move to the next epoch if no lookup is left in the previous one */
+static bool conc_advance(struct sys_hashmap_conc_data *data)
+{
+	atomic_val_t epoch = atomic_get(&data->epoch);
+	atomic_val_t next = (atomic_val_t)((unsigned long)epoch + 1);
+	atomic_t *readers = data->readers[next & 1];
+
+	for (size_t i = 0; i < CONFIG_MP_MAX_NUM_CPUS; ++i) {
+		if (atomic_get(&readers[i]) != 0) {
+			return false;
+		}
+	}
+
+	return atomic_cas(&data->epoch, epoch, next);
+}
+
+/* Called with the shard locked, once @p table can no longer be reached */
+static void shard_retire(struct sys_hashmap_conc_data *data, struct sys_hashmap_conc_shard *shard,
+			 struct conc_table *table)
+{
+	table->epoch = atomic_get(&data->epoch);
+	table->next = shard->retired;
+	shard->retired = table;
+}
+
+/* Free the tables of the shard no lookup can still be reading */
+static void shard_reclaim(const struct sys_hashmap *map, struct sys_hashmap_conc_shard *shard)
+{
+	k_spinlock_key_t key;
+	struct conc_table *table;
+	struct conc_table **prev;
+	struct conc_table *reclaimed = NULL;
+	struct sys_hashmap_conc_data *data = conc_data(map);
+
+	(void)conc_advance(data);
+
+	key = k_spin_lock(&shard->lock);
+	prev = (struct conc_table **)&shard->retired;
+	while ((table = *prev) != NULL) {
+		if (epoch_elapsed(data, table->epoch)) {
+			*prev = table->next;
+			table->next = reclaimed;
+			reclaimed = table;
+		} else {
+			prev = &table->next;
+		}
+	}
+	k_spin_unlock(&shard->lock, key);
+
+	while (reclaimed != NULL) {
+		table = reclaimed;
+		reclaimed = table->next;
+		map->alloc_func(table, 0);
+	}
+}
+
+static inline void shard_write_begin(struct sys_hashmap_conc_shard *shard)
+{
+	atomic_inc(&shard->seq);
+}
+
+static inline void shard_write_end(struct sys_hashmap_conc_shard *shard)
+{
+	atomic_inc(&shard->seq);
+}
+
+/* Move up to @p n_steps buckets of the previous table to the current one */
+static void shard_migrate(struct sys_hashmap_conc_data *data, struct sys_hashmap_conc_shard *shard,
+			  size_t n_steps)
+{
+	struct conc_entry *slot;
+	struct conc_entry *entry;
+	struct conc_table *old = atomic_ptr_get(&shard->old);
+	struct conc_table *table = atomic_ptr_get(&shard->table);
+
+	if (old == NULL) {
+		return;
+	}
+
+	for (; n_steps > 0 && old->n_live > 0; --n_steps, ++shard->migrated) {
+		__ASSERT_NO_MSG(shard->migrated < old->n_buckets);
+		entry = &old->entries[shard->migrated];
+		if (entry->state != USED) {
+			continue;
+		}
+
+		(void)table_find(table, entry->hash, entry->key, &slot);
+		table_put(table, slot, entry->hash, entry->key, entry->value);
+		entry->state = TOMBSTONE;
+		--old->n_live;
+	}
+
+	if (old->n_live == 0) {
+		atomic_ptr_set(&shard->old, NULL);
+		shard_retire(data, shard, old);
+	}
+}
+
+/*
+ * Number of buckets of the table to switch to before inserting a new
+ * key, 0 to keep the current one. The previous table is accounted for
+ * since its entries still have to be moved.
+ */
+static size_t shard_resize(const struct sys_hashmap *map, const struct conc_table *table,
+			   const struct conc_table *old)
+{
+	const size_t load_factor = map->config->load_factor;
+	const size_t live = table_live(table) + table_live(old);
+	size_t n_buckets;
+
+	__ASSERT_NO_MSG(load_factor > 0);
+
+	if (table != NULL &&
+	    (table->n_used + table_live(old) + 1) * 100 <= load_factor * table->n_buckets) {
+		return 0;
+	}
+
+	/* at most half of the load factor, so that the next resize is far */
+	n_buckets = (table == NULL) ? MAX(map->config->initial_n_buckets, 1) : table->n_buckets;
+	while ((live + 1) * 200 > load_factor * n_buckets) {
+		n_buckets <<= 1;
+	}
+
+	return n_buckets;
+}
+
+/* Called with the shard locked, inside a write */
+static void shard_install(struct sys_hashmap_conc_data *data, struct sys_hashmap_conc_shard *shard,
+			  struct conc_table *spare)
+{
+	struct conc_table *table;
+
+	/* there is a single previous table, finish moving it */
+	shard_migrate(data, shard, SIZE_MAX);
+	__ASSERT_NO_MSG(atomic_ptr_get(&shard->old) == NULL);
+
+	table = atomic_ptr_get(&shard->table);
+	atomic_ptr_set(&shard->table, spare);
+	if (table != NULL) {
+		atomic_sub(COUNTER(data->n_buckets), table->n_buckets);
+		if (table->n_live > 0) {
+			shard->migrated = 0;
+			atomic_ptr_set(&shard->old, table);
+		} else {
+			shard_retire(data, shard, table);
+		}
+	}
+	atomic_add(COUNTER(data->n_buckets), spare->n_buckets);
+}
+
+static struct conc_table *table_alloc(const struct sys_hashmap *map, size_t n_buckets)
+{
+	struct conc_table *table;
+	const size_t entries_size = n_buckets * sizeof(struct conc_entry);
+
+	table = map->alloc_func(NULL, sizeof(*table) + entries_size);
+	if (table == NULL) {
+		return NULL;
+	}
+
+	memset(table, 0, sizeof(*table) + entries_size);
+	table->n_buckets = n_buckets;
+
+	return table;
+}
+
+static void sys_hashmap_conc_iter_next(struct sys_hashmap_iterator *it)
+{
+	size_t cursor;
+	size_t base = 0;
+	struct conc_table *table;
+	struct conc_entry *entry;
+	const struct sys_hashmap *map = (const struct sys_hashmap *)it->map;
+	struct sys_hashmap_conc_data *data = conc_data(map);
+
+	__ASSERT(it->size == map->data->size, "Concurrent modification!");
+	__ASSERT(sys_hashmap_iterator_has_next(it), "Attempt to access beyond current bound!");
+
+	/* position in the current then previous tables of all the shards, one after the other */
+	cursor = (it->pos == 0) ? 0 : (uintptr_t)it->state;
+
+	for (size_t s = 0; s < N_SHARDS; ++s) {
+		for (int k = 0; k < 2; ++k) {
+			table = atomic_ptr_get((k == 0) ? &data->shards[s].table
+							: &data->shards[s].old);
+			if (table == NULL) {
+				continue;
+			}
+
+			for (; cursor < base + table->n_buckets; ++cursor) {
+				entry = &table->entries[cursor - base];
+				if (entry->state == USED) {
+					it->state = (void *)(uintptr_t)(cursor + 1);
+					it->key = entry->key;
+					it->value = entry->value;
+					++it->pos;
+					return;
+				}
+			}
+
+			base += table->n_buckets;
+		}
+	}
+
+	__ASSERT(false, "Entire Hashmap traversed and no entry was found");
+}
+
+/*
+ * Concurrent Hashmap API
+ */
+
+static void sys_hashmap_conc_iter(const struct sys_hashmap *map, struct sys_hashmap_iterator *it)
+{
+	it->map = map;
+	it->next = sys_hashmap_conc_iter_next;
+	it->pos = 0;
+	*((size_t *)&it->size) = map->data->size;
+}
+
+static void sys_hashmap_conc_clear(struct sys_hashmap *map, sys_hashmap_callback_t cb,
+				   void *cookie)
+{
+	k_spinlock_key_t key;
+	atomic_val_t epoch;
+	struct conc_table *table;
+	struct conc_table *tables = NULL;
+	struct sys_hashmap_conc_shard *shard;
+	struct sys_hashmap_conc_data *data = conc_data(map);
+
+	for (size_t s = 0; s < N_SHARDS; ++s) {
+		shard = &data->shards[s];
+
+		key = k_spin_lock(&shard->lock);
+		shard_write_begin(shard);
+		for (int k = 0; k < 2; ++k) {
+			table = atomic_ptr_get((k == 0) ? &shard->table : &shard->old);
+			if (table != NULL) {
+				atomic_ptr_set((k == 0) ? &shard->table : &shard->old, NULL);
+				table->next = tables;
+				tables = table;
+			}
+		}
+		shard->migrated = 0;
+		shard_write_end(shard);
+		k_spin_unlock(&shard->lock, key);
+	}
+
+	for (table = tables; cb != NULL && table != NULL; table = table->next) {
+		for (size_t i = 0; i < table->n_buckets; ++i) {
+			if (table->entries[i].state == USED) {
+				cb(table->entries[i].key, table->entries[i].value, cookie);
+			}
+		}
+	}
+
+	/* wait for the lookups which may still be reading the tables */
+	epoch = atomic_get(&data->epoch);
+	while (!epoch_elapsed(data, epoch)) {
+		if (!conc_advance(data)) {
+			k_sleep(K_TICKS(1));
+		}
+	}
+
+	while (tables != NULL) {
+		table = tables;
+		tables = table->next;
+		map->alloc_func(table, 0);
+	}
+
+	for (size_t s = 0; s < N_SHARDS; ++s) {
+		shard_reclaim(map, &data->shards[s]);
+	}
+
+	atomic_clear(COUNTER(data->n_buckets));
+	atomic_clear(COUNTER(data->size));
+}
+
+static int sys_hashmap_conc_insert(struct sys_hashmap *map, uint64_t key, uint64_t value,
+				   uint64_t *old_value)
+{
+	int ret;
+	size_t n_buckets;
+	k_spinlock_key_t lock;
+	struct conc_table *old;
+	struct conc_table *table;
+	struct conc_entry *slot;
+	struct conc_entry *entry;
+	struct conc_table *spare = NULL;
+	struct sys_hashmap_conc_data *data = conc_data(map);
+	const uint32_t hash = map->hash_func(&key, sizeof(key));
+	struct sys_hashmap_conc_shard *shard = conc_shard(data, hash);
+
+	for (;;) {
+		lock = k_spin_lock(&shard->lock);
+		table = atomic_ptr_get(&shard->table);
+		old = atomic_ptr_get(&shard->old);
+
+		entry = table_find(table, hash, key, &slot);
+		if (entry == NULL) {
+			entry = table_find(old, hash, key, NULL);
+		}
+
+		if (entry != NULL) {
+			shard_write_begin(shard);
+			if (old_value != NULL) {
+				*old_value = entry->value;
+			}
+			entry->value = value;
+			shard_migrate(data, shard, MIGRATE_STEP);
+			shard_write_end(shard);
+			ret = 0;
+			break;
+		}
+
+		if (map->data->size >= map->config->max_size) {
+			ret = -ENOSPC;
+			break;
+		}
+
+		n_buckets = shard_resize(map, table, old);
+		if (n_buckets == 0) {
+			shard_write_begin(shard);
+			shard_migrate(data, shard, MIGRATE_STEP);
+			/* the migration may have taken the slot */
+			(void)table_find(table, hash, key, &slot);
+			table_put(table, slot, hash, key, value);
+			atomic_inc(COUNTER(data->size));
+			shard_write_end(shard);
+			ret = 1;
+			break;
+		}
+
+		if (spare != NULL && spare->n_buckets == n_buckets) {
+			shard_write_begin(shard);
+			shard_install(data, shard, spare);
+			shard_write_end(shard);
+			spare = NULL;
+			k_spin_unlock(&shard->lock, lock);
+			continue;
+		}
+
+		/* allocate without holding the lock then look again */
+		k_spin_unlock(&shard->lock, lock);
+		if (spare != NULL) {
+			/* never published */
+			map->alloc_func(spare, 0);
+		}
+
+		spare = table_alloc(map, n_buckets);
+		if (spare == NULL) {
+			return -ENOMEM;
+		}
+	}
+
+	k_spin_unlock(&shard->lock, lock);
+
+	if (spare != NULL) {
+		map->alloc_func(spare, 0);
+	}
+
+	shard_reclaim(map, shard);
+
+	return ret;
+}
+
+static bool sys_hashmap_conc_remove(struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	k_spinlock_key_t lock;
+	struct conc_table *owner;
+	struct conc_table *table;
+	struct conc_entry *entry;
+	struct sys_hashmap_conc_data *data = conc_data(map);
+	const uint32_t hash = map->hash_func(&key, sizeof(key));
+	struct sys_hashmap_conc_shard *shard = conc_shard(data, hash);
+
+	lock = k_spin_lock(&shard->lock);
+	table = atomic_ptr_get(&shard->table);
+
+	owner = table;
+	entry = table_find(owner, hash, key, NULL);
+	if (entry == NULL) {
+		owner = atomic_ptr_get(&shard->old);
+		entry = table_find(owner, hash, key, NULL);
+	}
+
+	if (entry == NULL) {
+		k_spin_unlock(&shard->lock, lock);
+		return false;
+	}
+
+	shard_write_begin(shard);
+	if (value != NULL) {
+		*value = entry->value;
+	}
+	entry->state = TOMBSTONE;
+	--owner->n_live;
+	atomic_dec(COUNTER(data->size));
+
+	shard_migrate(data, shard, MIGRATE_STEP);
+
+	/* an empty shard gives its memory back */
+	if (table->n_live == 0 && atomic_ptr_get(&shard->old) == NULL) {
+		atomic_ptr_set(&shard->table, NULL);
+		atomic_sub(COUNTER(data->n_buckets), table->n_buckets);
+		shard_retire(data, shard, table);
+	}
+	shard_write_end(shard);
+	k_spin_unlock(&shard->lock, lock);
+
+	shard_reclaim(map, shard);
+
+	return true;
+}
+
+static bool sys_hashmap_conc_get(const struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	bool found;
+	atomic_val_t seq;
+	atomic_t *readers;
+	uint64_t found_value = 0;
+	struct conc_entry *entry;
+	struct sys_hashmap_conc_data *data = conc_data(map);
+	const uint32_t hash = map->hash_func(&key, sizeof(key));
+	struct sys_hashmap_conc_shard *shard = conc_shard(data, hash);
+
+	readers = conc_read_lock(data);
+	do {
+		seq = atomic_get(&shard->seq);
+		if ((seq & 1) != 0) {
+			/* a writer is modifying the shard */
+			found = false;
+			continue;
+		}
+
+		entry = table_find(atomic_ptr_get(&shard->table), hash, key, NULL);
+		if (entry == NULL) {
+			entry = table_find(atomic_ptr_get(&shard->old), hash, key, NULL);
+		}
+
+		found = (entry != NULL);
+		if (found) {
+			found_value = entry->value;
+		}
+	} while (((seq & 1) != 0) || (atomic_get(&shard->seq) != seq));
+	conc_read_unlock(readers);
+
+	if (found && value != NULL) {
+		*value = found_value;
+	}
+
+	return found;
+}
+
+const struct sys_hashmap_api sys_hashmap_conc_api = {
+	.iter = sys_hashmap_conc_iter,
+	.clear = sys_hashmap_conc_clear,
+	.insert = sys_hashmap_conc_insert,
+	.remove = sys_hashmap_conc_remove,
+	.get = sys_hashmap_conc_get,
+};
@@ -34,13 +34,12 @@ BUILD_ASSERT(offsetof(struct sys_hashmap_oa_lp_data, n_buckets) ==
 BUILD_ASSERT(offsetof(struct sys_hashmap_oa_lp_data, size) ==
 	     offsetof(struct sys_hashmap_data, size));
 
-static struct oalp_entry *sys_hashmap_oa_lp_find(const struct sys_hashmap *map, uint64_t key,
-						 bool used_ok, bool unused_ok, bool tombstone_ok)
+static struct oalp_entry *sys_hashmap_oa_lp_find_in(struct oalp_entry *const buckets,
+						    const size_t n_buckets, uint32_t hash,
+						    uint64_t key, bool used_ok, bool unused_ok,
+						    bool tombstone_ok)
 {
 	struct oalp_entry *entry = NULL;
-	const size_t n_buckets = map->data->n_buckets;
-	uint32_t hash = map->hash_func(&key, sizeof(key));
-	struct oalp_entry *const buckets = map->data->buckets;
 
 	for (size_t i = 0, j = hash; i < n_buckets; ++i, ++j) {
 		j &= (n_buckets - 1);
@@ -73,6 +72,126 @@ static struct oalp_entry *sys_hashmap_oa_lp_find(const struct sys_hashmap *map,
 	return NULL;
 }
 
+static struct oalp_entry *sys_hashmap_oa_lp_find(const struct sys_hashmap *map, uint64_t key,
+						 bool used_ok, bool unused_ok, bool tombstone_ok)
+{
+	uint32_t hash = map->hash_func(&key, sizeof(key));
+
+	return sys_hashmap_oa_lp_find_in(map->data->buckets, map->data->n_buckets, hash, key,
+					 used_ok, unused_ok, tombstone_ok);
+}
+
+/* Find a key in the buckets left to migrate */
+static struct oalp_entry *sys_hashmap_oa_lp_find_old(const struct sys_hashmap *map, uint64_t key)
+{
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	struct oalp_entry *entry;
+	uint32_t hash;
+	const struct sys_hashmap_rehash *rehash =
+		&((const struct sys_hashmap_oa_lp_data *)map->data)->rehash;
+
+	if (rehash->old_buckets == NULL) {
+		return NULL;
+	}
+
+	hash = map->hash_func(&key, sizeof(key));
+	entry = sys_hashmap_oa_lp_find_in(rehash->old_buckets, rehash->old_n_buckets, hash, key,
+					  true, true, false);
+	if (entry == NULL || entry->state == UNUSED) {
+		return NULL;
+	}
+
+	return entry;
+#else
+	ARG_UNUSED(map);
+	ARG_UNUSED(key);
+
+	return NULL;
+#endif
+}
+
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+
+/* Move up to n_steps of the previous buckets to the current ones */
+static void sys_hashmap_oa_lp_migrate(struct sys_hashmap *map, size_t n_steps)
+{
+	uint32_t hash;
+	struct oalp_entry *slot;
+	struct oalp_entry *entry;
+	struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
+	struct sys_hashmap_rehash *rehash = &data->rehash;
+	struct oalp_entry *old_buckets = rehash->old_buckets;
+
+	if (old_buckets == NULL) {
+		return;
+	}
+
+	for (; n_steps > 0 && rehash->migrated < rehash->old_n_buckets;
+	     --n_steps, ++rehash->migrated) {
+		entry = &old_buckets[rehash->migrated];
+		if (entry->state != USED) {
+			continue;
+		}
+
+		/* the key is not in the current buckets, take the first free one */
+		hash = map->hash_func(&entry->key, sizeof(entry->key));
+		slot = sys_hashmap_oa_lp_find_in(data->buckets, data->n_buckets, hash, entry->key,
+						 false, true, true);
+		__ASSERT_NO_MSG(slot != NULL);
+
+		if (slot->state == TOMBSTONE) {
+			--data->n_tombstones;
+		}
+
+		*slot = *entry;
+		entry->state = TOMBSTONE;
+	}
+
+	if (rehash->migrated == rehash->old_n_buckets) {
+		map->alloc_func(old_buckets, 0);
+		rehash->old_buckets = NULL;
+	}
+}
+
+static int sys_hashmap_oa_lp_rehash_incremental(struct sys_hashmap *map, size_t new_n_buckets)
+{
+	struct oalp_entry *new_buckets;
+	struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
+
+	/* resizes happen one at a time */
+	sys_hashmap_oa_lp_migrate(map, SIZE_MAX);
+
+	if (new_n_buckets == 0) {
+		/* empty, nothing to migrate */
+		data->buckets = map->alloc_func(data->buckets, 0);
+		data->n_buckets = 0;
+		data->n_tombstones = 0;
+		return 0;
+	}
+
+	new_buckets = (struct oalp_entry *)map->alloc_func(NULL,
+							   new_n_buckets * sizeof(*new_buckets));
+	if (new_buckets == NULL) {
+		return -ENOMEM;
+	}
+
+	/* ensure all buckets are empty / initialized */
+	memset(new_buckets, 0, new_n_buckets * sizeof(*new_buckets));
+
+	if (data->buckets != NULL) {
+		data->rehash.old_buckets = data->buckets;
+		data->rehash.old_n_buckets = data->n_buckets;
+		data->rehash.migrated = 0;
+	}
+
+	data->buckets = new_buckets;
+	data->n_buckets = new_n_buckets;
+	data->n_tombstones = 0;
+
+	return 0;
+}
+#endif
+
 static int sys_hashmap_oa_lp_insert_no_rehash(struct sys_hashmap *map, uint64_t key, uint64_t value,
 					      uint64_t *old_value)
 {
@@ -80,7 +199,11 @@ static int sys_hashmap_oa_lp_insert_no_rehash(struct sys_hashmap *map, uint64_t
 	struct oalp_entry *entry = NULL;
 	struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
 
-	entry = sys_hashmap_oa_lp_find(map, key, true, true, true);
+	entry = sys_hashmap_oa_lp_find(map, key, true, true, false);
+	if (entry == NULL || entry->state == UNUSED) {
+		/* a new key, it may reuse a tombstone preceding the first unused bucket */
+		entry = sys_hashmap_oa_lp_find(map, key, false, true, true);
+	}
 	__ASSERT_NO_MSG(entry != NULL);
 
 	switch (entry->state) {
@@ -91,18 +214,17 @@ static int sys_hashmap_oa_lp_insert_no_rehash(struct sys_hashmap *map, uint64_t
 	case TOMBSTONE:
 		--data->n_tombstones;
 		++data->size;
-		ret = 0;
+		ret = 1;
 		break;
 	case USED:
 	default:
+		if (old_value != NULL) {
+			*old_value = entry->value;
+		}
 		ret = 0;
 		break;
 	}
 
-	if (old_value != NULL) {
-		*old_value = entry->value;
-	}
-
 	entry->state = USED;
 	entry->key = key;
 	entry->value = value;
@@ -120,6 +242,10 @@ static int sys_hashmap_oa_lp_rehash(struct sys_hashmap *map, bool grow)
 	struct oalp_entry *new_buckets;
 	struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
 
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	sys_hashmap_oa_lp_migrate(map, CONFIG_SYS_HASH_MAP_REHASH_STEP);
+#endif
+
 	if (!sys_hashmap_should_rehash(map, grow, data->n_tombstones, &new_n_buckets)) {
 		return 0;
 	}
@@ -128,6 +254,10 @@ static int sys_hashmap_oa_lp_rehash(struct sys_hashmap *map, bool grow)
 		return -ENOSPC;
 	}
 
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	return sys_hashmap_oa_lp_rehash_incremental(map, new_n_buckets);
+#endif
+
 	/* extract all entries from the hashmap */
 	old_size = data->size;
 	old_n_buckets = data->n_buckets;
@@ -163,33 +293,54 @@ static int sys_hashmap_oa_lp_rehash(struct sys_hashmap *map, bool grow)
 	return 0;
 }
 
+/* Look for the next entry in buckets[i - base] for i in [first, base + n_buckets) */
+static bool sys_hashmap_oa_lp_iter_scan(struct sys_hashmap_iterator *it, struct oalp_entry *buckets,
+					 size_t base, size_t n_buckets, size_t first)
+{
+	struct oalp_entry *entry;
+
+	for (size_t i = first; i < base + n_buckets; ++i) {
+		entry = &buckets[i - base];
+		if (entry->state == USED) {
+			/* state is the index of the next bucket to look at */
+			it->state = (void *)(uintptr_t)(i + 1);
+			it->key = entry->key;
+			it->value = entry->value;
+			++it->pos;
+			return true;
+		}
+	}
+
+	return false;
+}
+
 static void sys_hashmap_oa_lp_iter_next(struct sys_hashmap_iterator *it)
 {
 	size_t i;
-	struct oalp_entry *entry;
 	const struct sys_hashmap *map = (const struct sys_hashmap *)it->map;
 	struct oalp_entry *buckets = map->data->buckets;
+	const size_t n_buckets = map->data->n_buckets;
 
 	__ASSERT(it->size == map->data->size, "Concurrent modification!");
 	__ASSERT(sys_hashmap_iterator_has_next(it), "Attempt to access beyond current bound!");
 
-	if (it->pos == 0) {
-		it->state = buckets;
+	i = (it->pos == 0) ? 0 : (uintptr_t)it->state;
+
+	if (sys_hashmap_oa_lp_iter_scan(it, buckets, 0, n_buckets, i)) {
+		return;
 	}
 
-	i = (struct oalp_entry *)it->state - buckets;
-	__ASSERT(i < map->data->n_buckets, "Invalid iterator state %p", it->state);
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	/* the buckets left to migrate come after the current ones */
+	const struct sys_hashmap_rehash *rehash =
+		&((const struct sys_hashmap_oa_lp_data *)map->data)->rehash;
 
-	for (; i < map->data->n_buckets; ++i) {
-		entry = &buckets[i];
-		if (entry->state == USED) {
-			it->state = &buckets[i + 1];
-			it->key = entry->key;
-			it->value = entry->value;
-			++it->pos;
-			return;
-		}
+	if (rehash->old_buckets != NULL &&
+	    sys_hashmap_oa_lp_iter_scan(it, rehash->old_buckets, n_buckets, rehash->old_n_buckets,
+					MAX(i, n_buckets + rehash->migrated))) {
+		return;
 	}
+#endif
 
 	__ASSERT(false, "Entire Hashmap traversed and no entry was found");
 }
@@ -226,6 +377,24 @@ static void sys_hashmap_oa_lp_clear(struct sys_hashmap *map, sys_hashmap_callbac
 		data->buckets = NULL;
 	}
 
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	struct oalp_entry *old_buckets = data->rehash.old_buckets;
+
+	for (size_t i = data->rehash.migrated; cb != NULL && old_buckets != NULL &&
+					       i < data->rehash.old_n_buckets;
+	     ++i) {
+		entry = &old_buckets[i];
+		if (entry->state == USED) {
+			cb(entry->key, entry->value, cookie);
+		}
+	}
+
+	if (old_buckets != NULL) {
+		map->alloc_func(old_buckets, 0);
+		data->rehash.old_buckets = NULL;
+	}
+#endif
+
 	data->n_buckets = 0;
 	data->size = 0;
 	data->n_tombstones = 0;
@@ -235,12 +404,24 @@ static inline int sys_hashmap_oa_lp_insert(struct sys_hashmap *map, uint64_t key
 					   uint64_t *old_value)
 {
 	int ret;
+	struct oalp_entry *entry;
 
 	ret = sys_hashmap_oa_lp_rehash(map, true);
 	if (ret < 0) {
 		return ret;
 	}
 
+	entry = sys_hashmap_oa_lp_find_old(map, key);
+	if (entry != NULL) {
+		if (old_value != NULL) {
+			*old_value = entry->value;
+		}
+
+		entry->value = value;
+
+		return 0;
+	}
+
 	return sys_hashmap_oa_lp_insert_no_rehash(map, key, value, old_value);
 }
 
@@ -251,7 +432,13 @@ static bool sys_hashmap_oa_lp_remove(struct sys_hashmap *map, uint64_t key, uint
 
 	entry = sys_hashmap_oa_lp_find(map, key, true, true, false);
 	if (entry == NULL || entry->state == UNUSED) {
-		return false;
+		entry = sys_hashmap_oa_lp_find_old(map, key);
+		if (entry == NULL) {
+			return false;
+		}
+	} else {
+		/* the tombstones of the buckets left to migrate go away with them */
+		++data->n_tombstones;
 	}
 
 	if (value != NULL) {
@@ -260,7 +447,6 @@ static bool sys_hashmap_oa_lp_remove(struct sys_hashmap *map, uint64_t key, uint
 
 	entry->state = TOMBSTONE;
 	--data->size;
-	++data->n_tombstones;
 
 	/* ignore a possible -ENOMEM since the table will remain intact */
 	(void)sys_hashmap_oa_lp_rehash(map, false);
@@ -274,7 +460,10 @@ static bool sys_hashmap_oa_lp_get(const struct sys_hashmap *map, uint64_t key, u
 
 	entry = sys_hashmap_oa_lp_find(map, key, true, true, false);
 	if (entry == NULL || entry->state == UNUSED) {
-		return false;
+		entry = sys_hashmap_oa_lp_find_old(map, key);
+		if (entry == NULL) {
+			return false;
+		}
 	}
 
 	if (value != NULL) {
@@ -30,12 +30,24 @@ static void sys_hashmap_sc_entry_init(struct sys_hashmap_sc_entry *entry, uint64
 	sys_dnode_init(&entry->node);
 }
 
-static void sys_hashmap_sc_insert_entry(struct sys_hashmap *map, struct sys_hashmap_sc_entry *entry)
+BUILD_ASSERT(offsetof(struct sys_hashmap_sc_data, buckets) ==
+	     offsetof(struct sys_hashmap_data, buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_sc_data, n_buckets) ==
+	     offsetof(struct sys_hashmap_data, n_buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_sc_data, size) ==
+	     offsetof(struct sys_hashmap_data, size));
+
+static void sys_hashmap_sc_link_entry(struct sys_hashmap *map, struct sys_hashmap_sc_entry *entry)
 {
 	sys_dlist_t *buckets = map->data->buckets;
 	uint32_t hash = map->hash_func(&entry->key, sizeof(entry->key));
 
 	sys_dlist_append(&buckets[hash % map->data->n_buckets], &entry->node);
+}
+
+static void sys_hashmap_sc_insert_entry(struct sys_hashmap *map, struct sys_hashmap_sc_entry *entry)
+{
+	sys_hashmap_sc_link_entry(map, entry);
 	++map->data->size;
 }
 
@@ -50,15 +62,13 @@ static void sys_hashmap_sc_insert_all(struct sys_hashmap *map, sys_dlist_t *list
 	}
 }
 
-static void sys_hashmap_sc_to_list(struct sys_hashmap *map, sys_dlist_t *list)
+static void sys_hashmap_sc_buckets_to_list(sys_dlist_t *buckets, size_t n_buckets,
+					   sys_dlist_t *list)
 {
 	sys_dlist_t *bucket;
 	struct sys_hashmap_sc_entry *entry;
-	sys_dlist_t *buckets = map->data->buckets;
 
-	sys_dlist_init(list);
-
-	for (size_t i = 0; i < map->data->n_buckets; ++i) {
+	for (size_t i = 0; i < n_buckets; ++i) {
 		bucket = &buckets[i];
 		while (!sys_dlist_is_empty(bucket)) {
 			entry = CONTAINER_OF(sys_dlist_get(bucket), struct sys_hashmap_sc_entry,
@@ -68,6 +78,88 @@ static void sys_hashmap_sc_to_list(struct sys_hashmap *map, sys_dlist_t *list)
 	}
 }
 
+static void sys_hashmap_sc_to_list(struct sys_hashmap *map, sys_dlist_t *list)
+{
+	sys_dlist_init(list);
+	sys_hashmap_sc_buckets_to_list(map->data->buckets, map->data->n_buckets, list);
+
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	struct sys_hashmap_rehash *rehash = &((struct sys_hashmap_sc_data *)map->data)->rehash;
+
+	if (rehash->old_buckets != NULL) {
+		sys_hashmap_sc_buckets_to_list(rehash->old_buckets, rehash->old_n_buckets, list);
+		map->alloc_func(rehash->old_buckets, 0);
+		rehash->old_buckets = NULL;
+	}
+#endif
+}
+
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+/* Move up to n_steps of the previous buckets to the current ones */
+static void sys_hashmap_sc_migrate(struct sys_hashmap *map, size_t n_steps)
+{
+	sys_dlist_t *bucket;
+	struct sys_hashmap_sc_entry *entry;
+	struct sys_hashmap_rehash *rehash = &((struct sys_hashmap_sc_data *)map->data)->rehash;
+	sys_dlist_t *old_buckets = rehash->old_buckets;
+
+	if (old_buckets == NULL) {
+		return;
+	}
+
+	for (; n_steps > 0 && rehash->migrated < rehash->old_n_buckets;
+	     --n_steps, ++rehash->migrated) {
+		bucket = &old_buckets[rehash->migrated];
+		while (!sys_dlist_is_empty(bucket)) {
+			entry = CONTAINER_OF(sys_dlist_get(bucket), struct sys_hashmap_sc_entry,
+					     node);
+			sys_hashmap_sc_link_entry(map, entry);
+		}
+	}
+
+	if (rehash->migrated == rehash->old_n_buckets) {
+		map->alloc_func(old_buckets, 0);
+		rehash->old_buckets = NULL;
+	}
+}
+
+static int sys_hashmap_sc_rehash_incremental(struct sys_hashmap *map, size_t new_n_buckets)
+{
+	sys_dlist_t *new_buckets;
+	struct sys_hashmap_rehash *rehash = &((struct sys_hashmap_sc_data *)map->data)->rehash;
+
+	/* resizes happen one at a time */
+	sys_hashmap_sc_migrate(map, SIZE_MAX);
+
+	if (new_n_buckets == 0) {
+		/* empty, nothing to migrate */
+		map->data->buckets = map->alloc_func(map->data->buckets, 0);
+		map->data->n_buckets = 0;
+		return 0;
+	}
+
+	new_buckets = (sys_dlist_t *)map->alloc_func(NULL, new_n_buckets * sizeof(*new_buckets));
+	if (new_buckets == NULL) {
+		return -ENOMEM;
+	}
+
+	for (size_t i = 0; i < new_n_buckets; ++i) {
+		sys_dlist_init(&new_buckets[i]);
+	}
+
+	if (map->data->buckets != NULL) {
+		rehash->old_buckets = map->data->buckets;
+		rehash->old_n_buckets = map->data->n_buckets;
+		rehash->migrated = 0;
+	}
+
+	map->data->buckets = new_buckets;
+	map->data->n_buckets = new_n_buckets;
+
+	return 0;
+}
+#endif
+
 static int sys_hashmap_sc_rehash(struct sys_hashmap *map, bool grow)
 {
 	sys_dlist_t list;
@@ -75,10 +167,18 @@ static int sys_hashmap_sc_rehash(struct sys_hashmap *map, bool grow)
 	size_t new_n_buckets;
 	sys_dlist_t *new_buckets;
 
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	sys_hashmap_sc_migrate(map, CONFIG_SYS_HASH_MAP_REHASH_STEP);
+#endif
+
 	if (!sys_hashmap_should_rehash(map, grow, 0, &new_n_buckets)) {
 		return 0;
 	}
 
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	return sys_hashmap_sc_rehash_incremental(map, new_n_buckets);
+#endif
+
 	/* extract all entries from the hashmap */
 	sys_hashmap_sc_to_list(map, &list);
 
@@ -106,10 +206,22 @@ static int sys_hashmap_sc_rehash(struct sys_hashmap *map, bool grow)
 	return 0;
 }
 
+static struct sys_hashmap_sc_entry *sys_hashmap_sc_find_in(sys_dlist_t *bucket, uint64_t key)
+{
+	struct sys_hashmap_sc_entry *entry;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(bucket, entry, node) {
+		if (entry->key == key) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
 static struct sys_hashmap_sc_entry *sys_hashmap_sc_find(const struct sys_hashmap *map, uint64_t key)
 {
 	uint32_t hash;
-	sys_dlist_t *bucket;
 	sys_dlist_t *buckets;
 	struct sys_hashmap_sc_entry *entry;
 
@@ -121,24 +233,58 @@ static struct sys_hashmap_sc_entry *sys_hashmap_sc_find(const struct sys_hashmap
 
 	hash = map->hash_func(&key, sizeof(key));
 	buckets = (sys_dlist_t *)map->data->buckets;
-	bucket = &buckets[hash % map->data->n_buckets];
+	entry = sys_hashmap_sc_find_in(&buckets[hash % map->data->n_buckets], key);
 
-	SYS_DLIST_FOR_EACH_CONTAINER(bucket, entry, node) {
-		if (entry->key == key) {
-			return entry;
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	const struct sys_hashmap_rehash *rehash =
+		&((const struct sys_hashmap_sc_data *)map->data)->rehash;
+
+	if (entry == NULL && rehash->old_buckets != NULL &&
+	    hash % rehash->old_n_buckets >= rehash->migrated) {
+		buckets = (sys_dlist_t *)rehash->old_buckets;
+		entry = sys_hashmap_sc_find_in(&buckets[hash % rehash->old_n_buckets], key);
+	}
+#endif
+
+	return entry;
+}
+
+static bool sys_hashmap_sc_iter_scan(struct sys_hashmap_iterator *it, sys_dlist_t *bucket,
+				     sys_dlist_t *end, bool *found_previous_key)
+{
+	struct sys_hashmap_sc_entry *entry;
+
+	for (; bucket < end; ++bucket) {
+		SYS_DLIST_FOR_EACH_CONTAINER(bucket, entry, node) {
+			if (!*found_previous_key) {
+				if (entry->key == it->key) {
+					*found_previous_key = true;
+				}
+
+				continue;
+			}
+
+			/* save the bucket to state so we can restart scanning from a saved position
+			 */
+			it->state = bucket;
+			it->key = entry->key;
+			it->value = entry->value;
+			++it->pos;
+
+			return true;
 		}
 	}
 
-	return NULL;
+	return false;
 }
 
 static void sys_hashmap_sc_iter_next(struct sys_hashmap_iterator *it)
 {
 	sys_dlist_t *bucket;
 	bool found_previous_key = false;
-	struct sys_hashmap_sc_entry *entry;
 	const struct sys_hashmap *map = it->map;
 	sys_dlist_t *buckets = map->data->buckets;
+	sys_dlist_t *end = &buckets[map->data->n_buckets];
 
 	__ASSERT(it->size == map->data->size, "Concurrent modification!");
 	__ASSERT(sys_hashmap_iterator_has_next(it), "Attempt to access beyond current bound!");
@@ -149,26 +295,32 @@ static void sys_hashmap_sc_iter_next(struct sys_hashmap_iterator *it)
 		found_previous_key = true;
 	}
 
-	for (bucket = it->state; bucket < &buckets[map->data->n_buckets]; ++bucket) {
-		SYS_DLIST_FOR_EACH_CONTAINER(bucket, entry, node) {
-			if (!found_previous_key) {
-				if (entry->key == it->key) {
-					found_previous_key = true;
-				}
-
-				continue;
-			}
+	bucket = it->state;
 
-			/* save the bucket to state so we can restart scanning from a saved position
-			 */
-			it->state = bucket;
-			it->key = entry->key;
-			it->value = entry->value;
-			++it->pos;
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	/* the buckets left to migrate come after the current ones */
+	const struct sys_hashmap_rehash *rehash =
+		&((const struct sys_hashmap_sc_data *)map->data)->rehash;
+	sys_dlist_t *old_buckets = rehash->old_buckets;
 
+	if (bucket >= buckets && bucket < end) {
+		if (sys_hashmap_sc_iter_scan(it, bucket, end, &found_previous_key)) {
 			return;
 		}
+
+		bucket = (old_buckets == NULL) ? NULL : &old_buckets[rehash->migrated];
+	}
+
+	if (bucket != NULL &&
+	    sys_hashmap_sc_iter_scan(it, bucket, &old_buckets[rehash->old_n_buckets],
+				     &found_previous_key)) {
+		return;
+	}
+#else
+	if (sys_hashmap_sc_iter_scan(it, bucket, end, &found_previous_key)) {
+		return;
 	}
+#endif
 
 	__ASSERT(false, "Entire Hashmap traversed and no entry was found");
 }
@@ -268,8 +420,11 @@ static bool sys_hashmap_sc_remove(struct sys_hashmap *map, uint64_t key, uint64_
 	--map->data->size;
 
 	ret = sys_hashmap_sc_rehash(map, false);
-	/* Realloc to a smaller size of memory should *always* work */
-	__ASSERT_NO_MSG(ret >= 0);
+	/*
+	 * Realloc to a smaller size of memory should *always* work. An incremental
+	 * rehash allocates new buckets instead, the current ones stay if that fails.
+	 */
+	__ASSERT_NO_MSG(ret >= 0 || IS_ENABLED(CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH));
 
 	/* free the entry */
 	map->alloc_func(entry, 0);
@@ -160,6 +160,75 @@ static chunkid_t mem_to_chunkid(struct z_heap *h, void *p)
 	return (mem - chunk_header_bytes(h) - base) / CHUNK_UNIT;
 }
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+/* Pops a cached chunk for the size class of "bytes", if any, and
+ * rounds "chunk_sz" up to the class so that the chunk can be cached.
+ */
+static chunkid_t size_class_alloc(struct z_heap *h, size_t bytes,
+				  chunksz_t *chunk_sz)
+{
+	if (bytes > SIZE_CLASS_MAX) {
+		return 0;
+	}
+
+	unsigned int idx = (bytes <= SIZE_CLASS_MIN) ? 0 :
+		32 - __builtin_clz(bytes - 1) - SIZE_CLASS_MIN_SHIFT;
+	struct z_heap_size_class *sc = &h->size_classes[idx];
+	chunkid_t c = sc->next;
+
+	*chunk_sz = bytes_to_chunksz(h, size_class_bytes(idx));
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	sc->allocs++;
+#endif
+
+	if (c != 0U) {
+		CHECK(chunk_used(h, c) && chunk_size(h, c) == *chunk_sz);
+
+		sc->next = *(chunkid_t *)chunk_mem(h, c);
+		sc->count--;
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+		sc->hits++;
+		h->free_bytes -= chunksz_to_bytes(h, *chunk_sz);
+#endif
+	}
+
+	return c;
+}
+
+/* Caches a chunk being freed if it has the size of a class with room */
+static bool size_class_free(struct z_heap *h, chunkid_t c)
+{
+	size_t bytes = chunksz_to_bytes(h, chunk_size(h, c));
+
+	if ((bytes < SIZE_CLASS_MIN) || (bytes >= 2 * SIZE_CLASS_MAX)) {
+		return false;
+	}
+
+	/* Class chunks have less than CHUNK_UNIT bytes of slack, so the
+	 * class is given by the highest bit of their size.
+	 */
+	unsigned int idx = 31 - __builtin_clz(bytes) - SIZE_CLASS_MIN_SHIFT;
+	struct z_heap_size_class *sc = &h->size_classes[idx];
+
+	if ((sc->count >= CONFIG_SYS_HEAP_SIZE_CLASS_DEPTH) ||
+	    (chunk_size(h, c) != bytes_to_chunksz(h, size_class_bytes(idx)))) {
+		return false;
+	}
+
+	*(chunkid_t *)chunk_mem(h, c) = sc->next;
+	sc->next = c;
+	sc->count++;
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	h->free_bytes += bytes;
+#endif
+
+	return true;
+}
+#endif
+
 void sys_heap_free(struct sys_heap *heap, void *mem)
 {
 	if (mem == NULL) {
@@ -184,7 +253,6 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 		 "corrupted heap bounds (buffer overflow?) for memory at %p",
 		 mem);
 
-	set_chunk_used(h, c, false);
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	h->allocated_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
 #endif
@@ -194,6 +262,15 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 				  chunksz_to_bytes(h, chunk_size(h, c)));
 #endif
 
+	heap_tracker_free(heap, mem, chunksz_to_bytes(h, chunk_size(h, c)));
+
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	if (size_class_free(h, c)) {
+		return;
+	}
+#endif
+
+	set_chunk_used(h, c, false);
 	free_chunk(h, c);
 }
 
@@ -260,7 +337,57 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 	return 0;
 }
 
-void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
+/* Does the free chunk "c" hold "bytes" at the alignment, with rewind? */
+static bool aligned_fit(struct z_heap *h, chunkid_t c, size_t align,
+			size_t rew, size_t bytes)
+{
+	uint8_t *mem = chunk_mem(h, c);
+
+	mem = (uint8_t *) ROUND_UP(mem + rew, align) - rew;
+
+	return (uint8_t *) ROUND_UP(mem + bytes, CHUNK_UNIT) <=
+	       (uint8_t *) &chunk_buf(h)[right_chunk(h, c)];
+}
+
+/* Like alloc_chunk() for an aligned block.  "padded_sz" chunks always
+ * hold it, but the alignment padding is mostly wasted space, so first
+ * try a bounded count of items from each bucket between the ones of the
+ * unpadded and padded sizes, keeping those which hold the block once
+ * aligned.
+ */
+static chunkid_t alloc_aligned_chunk(struct z_heap *h, size_t align,
+				     size_t rew, size_t bytes,
+				     chunksz_t padded_sz)
+{
+	int bi = bucket_idx(h, bytes_to_chunksz(h, bytes));
+	int padded_bi = bucket_idx(h, padded_sz);
+
+	for (; bi <= padded_bi; bi++) {
+		struct z_heap_bucket *b = &h->buckets[bi];
+
+		if (b->next == 0U) {
+			continue;
+		}
+
+		chunkid_t first = b->next;
+		int i = CONFIG_SYS_HEAP_ALLOC_LOOPS;
+
+		do {
+			chunkid_t c = b->next;
+
+			if (aligned_fit(h, c, align, rew, bytes)) {
+				free_list_remove_bidx(h, c, bi);
+				return c;
+			}
+			b->next = next_free_chunk(h, c);
+			CHECK(b->next != 0);
+		} while (--i && b->next != first);
+	}
+
+	return alloc_chunk(h, padded_sz);
+}
+
+static void *heap_alloc(struct sys_heap *heap, size_t bytes, uintptr_t site)
 {
 	struct z_heap *h = heap->heap;
 	void *mem;
@@ -270,7 +397,15 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 	}
 
 	chunksz_t chunk_sz = bytes_to_chunksz(h, bytes);
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	chunkid_t c = size_class_alloc(h, bytes, &chunk_sz);
+
+	if (c == 0U) {
+		c = alloc_chunk(h, chunk_sz);
+	}
+#else
 	chunkid_t c = alloc_chunk(h, chunk_sz);
+#endif
 	if (c == 0U) {
 		return NULL;
 	}
@@ -294,11 +429,19 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 				   chunksz_to_bytes(h, chunk_size(h, c)));
 #endif
 
+	heap_tracker_alloc(heap, mem, chunksz_to_bytes(h, chunk_size(h, c)), site);
+
 	IF_ENABLED(CONFIG_MSAN, (__msan_allocated_memory(mem, bytes)));
 	return mem;
 }
 
-void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
+void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
+{
+	return heap_alloc(heap, bytes, HEAP_TRACKER_SITE());
+}
+
+static void *heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes,
+				uintptr_t site)
 {
 	struct z_heap *h = heap->heap;
 	size_t gap, rew;
@@ -316,7 +459,7 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 		gap = MIN(rew, chunk_header_bytes(h));
 	} else {
 		if (align <= chunk_header_bytes(h)) {
-			return sys_heap_alloc(heap, bytes);
+			return heap_alloc(heap, bytes, site);
 		}
 		rew = 0;
 		gap = chunk_header_bytes(h);
@@ -333,7 +476,7 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 	 * the extra allocations afterwards.
 	 */
 	chunksz_t padded_sz = bytes_to_chunksz(h, bytes + align - gap);
-	chunkid_t c0 = alloc_chunk(h, padded_sz);
+	chunkid_t c0 = alloc_aligned_chunk(h, align, rew, bytes, padded_sz);
 
 	if (c0 == 0) {
 		return NULL;
@@ -347,7 +490,7 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 	/* Get corresponding chunks */
 	chunkid_t c = mem_to_chunkid(h, mem);
 	chunkid_t c_end = end - chunk_buf(h);
-	CHECK(c >= c0 && c  < c_end && c_end <= c0 + padded_sz);
+	CHECK(c >= c0 && c  < c_end && c_end <= right_chunk(h, c0));
 
 	/* Split and free unused prefix */
 	if (c > c0) {
@@ -372,18 +515,114 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 				   chunksz_to_bytes(h, chunk_size(h, c)));
 #endif
 
+	heap_tracker_alloc(heap, mem, chunksz_to_bytes(h, chunk_size(h, c)), site);
+
 	IF_ENABLED(CONFIG_MSAN, (__msan_allocated_memory(mem, bytes)));
 	return mem;
 }
 
+void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
+{
+	return heap_aligned_alloc(heap, align, bytes, HEAP_TRACKER_SITE());
+}
+
+/* Chunks reserved past the need of a growing realloc, so that a block
+ * grown a little at a time is only moved every so often.
+ */
+static chunksz_t realloc_headroom(size_t bytes)
+{
+	return (chunksz_t)((uint64_t)bytes * CONFIG_SYS_HEAP_REALLOC_GROWTH /
+			   100U / CHUNK_UNIT);
+}
+
+/* Grows a block by moving it down into its free left neighbor, merged
+ * with its free right neighbor if any.  The data is moved within the
+ * merged chunk, so the block can grow even if no other chunk would fit.
+ * Returns NULL if the block does not fit there.
+ */
+static void *realloc_left(struct sys_heap *heap, void *ptr, size_t align,
+			  size_t bytes, chunksz_t headroom, uintptr_t site)
+{
+	struct z_heap *h = heap->heap;
+	chunkid_t c = mem_to_chunkid(h, ptr);
+	chunkid_t lc = left_chunk(h, c);
+	chunkid_t rc = right_chunk(h, c);
+	chunkid_t end = rc;
+
+	if (chunk_used(h, lc)) {
+		return NULL;
+	}
+	if (!chunk_used(h, rc)) {
+		end = right_chunk(h, rc);
+	}
+
+	uint8_t *mem = chunk_mem(h, lc);
+
+	if (align > chunk_header_bytes(h)) {
+		mem = (uint8_t *) ROUND_UP(mem, align);
+	}
+
+	chunkid_t nc = mem_to_chunkid(h, mem);
+	size_t align_gap = mem - (uint8_t *)chunk_mem(h, nc);
+	chunksz_t chunks_need = bytes_to_chunksz(h, bytes + align_gap);
+
+	if (nc + chunks_need > end) {
+		return NULL;
+	}
+
+	chunksz_t chunks_new = MIN(chunks_need + headroom, end - nc);
+	size_t old_bytes = chunksz_to_bytes(h, chunk_size(h, c));
+	size_t copy = MIN(sys_heap_usable_size(heap, ptr), bytes);
+
+	/* Merge the three chunks, move the data, then split off what is
+	 * left on both sides.
+	 */
+	free_list_remove(h, lc);
+	if (end != rc) {
+		free_list_remove(h, rc);
+	}
+	set_chunk_size(h, lc, end - lc);
+	set_left_chunk_size(h, end, end - lc);
+
+	memmove(mem, ptr, copy);
+
+	if (nc > lc) {
+		split_chunks(h, lc, nc);
+		free_list_add(h, lc);
+	}
+	if (nc + chunks_new < end) {
+		split_chunks(h, nc, nc + chunks_new);
+		free_list_add(h, nc + chunks_new);
+	}
+	set_chunk_used(h, nc, true);
+
+	size_t new_bytes = chunksz_to_bytes(h, chunk_size(h, nc));
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	h->allocated_bytes -= old_bytes;
+	increase_allocated_bytes(h, new_bytes);
+#endif
+
+#ifdef CONFIG_SYS_HEAP_LISTENER
+	heap_listener_notify_alloc(HEAP_ID_FROM_POINTER(heap), mem, new_bytes);
+	heap_listener_notify_free(HEAP_ID_FROM_POINTER(heap), ptr, old_bytes);
+#endif
+
+	heap_tracker_free(heap, ptr, old_bytes);
+	heap_tracker_alloc(heap, mem, new_bytes, site);
+
+	return mem;
+}
+
 void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
 			       size_t align, size_t bytes)
 {
 	struct z_heap *h = heap->heap;
+	uintptr_t site = HEAP_TRACKER_SITE();
 
 	/* special realloc semantics */
 	if (ptr == NULL) {
-		return sys_heap_aligned_alloc(heap, align, bytes);
+		return heap_aligned_alloc(heap, align, bytes, site);
 	}
 	if (bytes == 0) {
 		sys_heap_free(heap, ptr);
@@ -400,10 +639,13 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
 	chunkid_t rc = right_chunk(h, c);
 	size_t align_gap = (uint8_t *)ptr - (uint8_t *)chunk_mem(h, c);
 	chunksz_t chunks_need = bytes_to_chunksz(h, bytes + align_gap);
+	chunksz_t headroom = realloc_headroom(bytes);
+	void *ptr2;
 
 	if (align && ((uintptr_t)ptr & (align - 1))) {
 		/* ptr is not sufficiently aligned */
-	} else if (chunk_size(h, c) == chunks_need) {
+	} else if ((chunk_size(h, c) >= chunks_need) &&
+		   (chunk_size(h, c) <= chunks_need + headroom)) {
 		/* We're good already */
 		return ptr;
 	} else if (chunk_size(h, c) > chunks_need) {
@@ -417,6 +659,8 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
 			(chunk_size(h, c) - chunks_need) * CHUNK_UNIT;
 #endif
 
+		size_t old_bytes = chunksz_to_bytes(h, chunk_size(h, c));
+
 		split_chunks(h, c, c + chunks_need);
 		set_chunk_used(h, c, true);
 		free_chunk(h, c + chunks_need);
@@ -428,11 +672,16 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
 					  bytes_freed);
 #endif
 
+		heap_tracker_resize(heap, ptr, old_bytes,
+				    chunksz_to_bytes(h, chunk_size(h, c)));
+
 		return ptr;
 	} else if (!chunk_used(h, rc) &&
 		   (chunk_size(h, c) + chunk_size(h, rc) >= chunks_need)) {
 		/* Expand: split the right chunk and append */
-		chunksz_t split_size = chunks_need - chunk_size(h, c);
+		chunksz_t split_size = MIN(chunks_need + headroom,
+					   chunk_size(h, c) + chunk_size(h, rc)) -
+				       chunk_size(h, c);
 
 #ifdef CONFIG_SYS_HEAP_LISTENER
 		size_t bytes_freed = chunksz_to_bytes(h, chunk_size(h, c));
@@ -442,6 +691,8 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
 		increase_allocated_bytes(h, split_size * CHUNK_UNIT);
 #endif
 
+		size_t old_bytes = chunksz_to_bytes(h, chunk_size(h, c));
+
 		free_list_remove(h, rc);
 
 		if (split_size < chunk_size(h, rc)) {
@@ -459,9 +710,16 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
 					  bytes_freed);
 #endif
 
+		heap_tracker_resize(heap, ptr, old_bytes,
+				    chunksz_to_bytes(h, chunk_size(h, c)));
+
 		return ptr;
 	} else {
-		;
+		/* Expand: move down into the left chunk */
+		ptr2 = realloc_left(heap, ptr, align, bytes, headroom, site);
+		if (ptr2 != NULL) {
+			return ptr2;
+		}
 	}
 
 	/*
@@ -471,7 +729,13 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
 	 * The calls to allocation and free functions generate
 	 * notification already, so there is no need to those here.
 	 */
-	void *ptr2 = sys_heap_aligned_alloc(heap, align, bytes);
+	ptr2 = NULL;
+	if ((headroom != 0U) && !size_too_big(h, bytes + headroom * CHUNK_UNIT)) {
+		ptr2 = heap_aligned_alloc(heap, align, bytes + headroom * CHUNK_UNIT, site);
+	}
+	if (ptr2 == NULL) {
+		ptr2 = heap_aligned_alloc(heap, align, bytes, site);
+	}
 
 	if (ptr2 != NULL) {
 		size_t prev_size = chunksz_to_bytes(h, chunk_size(h, c)) - align_gap;
@@ -486,6 +750,9 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 {
 	IF_ENABLED(CONFIG_MSAN, (__sanitizer_dtor_callback(mem, bytes)));
 
+	/* Forget the allocations of a previous heap in the same memory */
+	heap_tracker_init(heap, mem, bytes);
+
 	if (IS_ENABLED(CONFIG_SYS_HEAP_SMALL_ONLY)) {
 		/* Must fit in a 15 bit count of HUNK_UNIT */
 		__ASSERT(bytes / CHUNK_UNIT <= 0x7fffU, "heap size is too big");
@@ -527,6 +794,10 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 		h->buckets[i].next = 0;
 	}
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	memset(h->size_classes, 0, sizeof(h->size_classes));
+#endif
+
 	/* chunk containing our struct z_heap */
 	set_chunk_size(h, 0, chunk0_size);
 	set_left_chunk_size(h, 0, 0);
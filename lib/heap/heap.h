@@ -65,6 +65,22 @@ struct z_heap_bucket {
 	chunkid_t next;
 };
 
+/* Size classes of 16 to 256 bytes.  The chunks cached for a class are
+ * still marked used, and linked through the first word of their memory.
+ */
+#define SIZE_CLASS_MIN_SHIFT 4U
+#define SIZE_CLASS_MIN (1U << SIZE_CLASS_MIN_SHIFT)
+#define SIZE_CLASS_MAX (SIZE_CLASS_MIN << (SYS_HEAP_NUM_SIZE_CLASSES - 1))
+
+struct z_heap_size_class {
+	chunkid_t next;
+	uint16_t count;
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	uint32_t allocs;
+	uint32_t hits;
+#endif
+};
+
 struct z_heap {
 	chunkid_t chunk0_hdr[2];
 	chunkid_t end_chunk;
@@ -73,6 +89,9 @@ struct z_heap {
 	size_t free_bytes;
 	size_t allocated_bytes;
 	size_t max_allocated_bytes;
+#endif
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	struct z_heap_size_class size_classes[SYS_HEAP_NUM_SIZE_CLASSES];
 #endif
 	struct z_heap_bucket buckets[0];
 };
@@ -262,6 +281,11 @@ static inline bool size_too_big(struct z_heap *h, size_t bytes)
 	return (bytes / CHUNK_UNIT) >= h->end_chunk;
 }
 
+static inline size_t size_class_bytes(unsigned int idx)
+{
+	return SIZE_CLASS_MIN << idx;
+}
+
 static inline void get_alloc_info(struct z_heap *h, size_t *alloc_bytes,
 			   size_t *free_bytes)
 {
@@ -277,6 +301,40 @@ static inline void get_alloc_info(struct z_heap *h, size_t *alloc_bytes,
 			*free_bytes += chunksz_to_bytes(h, chunk_size(h, c));
 		}
 	}
+
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	/* Cached chunks look used but are accounted as free */
+	for (unsigned int i = 0; i < SYS_HEAP_NUM_SIZE_CLASSES; i++) {
+		chunksz_t sz = bytes_to_chunksz(h, size_class_bytes(i));
+		size_t cached = h->size_classes[i].count * chunksz_to_bytes(h, sz);
+
+		*alloc_bytes -= cached;
+		*free_bytes += cached;
+	}
+#endif
 }
 
+/* Allocation site tracking hooks, see heap_tracker.c */
+struct sys_heap;
+
+#ifdef CONFIG_SYS_HEAP_TRACKER
+#define HEAP_TRACKER_SITE() ((uintptr_t)__builtin_return_address(0))
+
+void heap_tracker_init(struct sys_heap *heap, void *mem, size_t bytes);
+void heap_tracker_alloc(struct sys_heap *heap, void *mem, size_t bytes,
+			uintptr_t site);
+void heap_tracker_free(struct sys_heap *heap, void *mem, size_t bytes);
+void heap_tracker_resize(struct sys_heap *heap, void *mem, size_t old_bytes,
+			 size_t new_bytes);
+#else
+#define HEAP_TRACKER_SITE() ((uintptr_t)0)
+
+static inline void heap_tracker_init(struct sys_heap *heap, void *mem, size_t bytes) { }
+static inline void heap_tracker_alloc(struct sys_heap *heap, void *mem, size_t bytes,
+				      uintptr_t site) { }
+static inline void heap_tracker_free(struct sys_heap *heap, void *mem, size_t bytes) { }
+static inline void heap_tracker_resize(struct sys_heap *heap, void *mem, size_t old_bytes,
+				       size_t new_bytes) { }
+#endif
+
 #endif /* ZEPHYR_INCLUDE_LIB_OS_HEAP_H_ */
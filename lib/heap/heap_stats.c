@@ -32,3 +32,23 @@ int sys_heap_runtime_stats_reset_max(struct sys_heap *heap)
 
 	return 0;
 }
+
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+int sys_heap_size_class_stats_get(struct sys_heap *heap, unsigned int idx,
+				  struct sys_heap_size_class_stats *stats)
+{
+	if ((heap == NULL) || (stats == NULL) ||
+	    (idx >= SYS_HEAP_NUM_SIZE_CLASSES)) {
+		return -EINVAL;
+	}
+
+	struct z_heap_size_class *sc = &heap->heap->size_classes[idx];
+
+	stats->bytes = size_class_bytes(idx);
+	stats->allocs = sc->allocs;
+	stats->hits = sc->hits;
+	stats->cached = sc->count;
+
+	return 0;
+}
+#endif
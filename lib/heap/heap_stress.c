@@ -11,6 +11,7 @@
 struct z_heap_stress_rec {
 	void *(*alloc_fn)(void *arg, size_t bytes);
 	void (*free_fn)(void *arg, void *p);
+	void *(*realloc_fn)(void *arg, void *p, size_t bytes);
 	void *arg;
 	size_t total_bytes;
 	struct z_heap_stress_block *blocks;
@@ -151,3 +152,77 @@ void sys_heap_stress(void *(*alloc_fn)(void *arg, size_t bytes),
 		result->accumulated_in_use_bytes += sr.bytes_alloced;
 	}
 }
+
+static void *stress_alloc(struct z_heap_stress_rec *sr, size_t bytes)
+{
+	return sr->realloc_fn(sr->arg, NULL, bytes);
+}
+
+static void stress_free(struct z_heap_stress_rec *sr, void *p)
+{
+	(void)sr->realloc_fn(sr->arg, p, 0);
+}
+
+void sys_heap_realloc_stress(void *(*realloc_fn)(void *arg, void *p, size_t bytes),
+			     void *arg, size_t total_bytes,
+			     uint32_t op_count,
+			     void *scratch_mem, size_t scratch_bytes,
+			     int target_percent,
+			     struct z_heap_stress_result *result)
+{
+	struct z_heap_stress_rec sr = {
+	       .realloc_fn = realloc_fn,
+	       .arg = arg,
+	       .total_bytes = total_bytes,
+	       .blocks = scratch_mem,
+	       .nblocks = scratch_bytes / sizeof(struct z_heap_stress_block),
+	       .target_percent = target_percent,
+	};
+
+	*result = (struct z_heap_stress_result) {0};
+
+	for (uint32_t i = 0; i < op_count; i++) {
+		bool alloc = rand_alloc_choice(&sr);
+
+		if ((sr.blocks_alloced != 0) && ((rand32() & 1U) != 0U)) {
+			/* Resize instead: grow by up to a quarter, like a
+			 * buffer filling up, or shrink by half.
+			 */
+			int b = rand_free_choice(&sr);
+			size_t sz = sr.blocks[b].sz;
+			size_t new_sz = alloc ? sz + 1 + rand32() % (sz / 4 + 8) : sz / 2 + 1;
+			void *p = sr.realloc_fn(sr.arg, sr.blocks[b].ptr, new_sz);
+
+			result->total_reallocs++;
+			if (p != NULL) {
+				result->successful_reallocs++;
+				sr.blocks[b].ptr = p;
+				sr.blocks[b].sz = new_sz;
+				sr.bytes_alloced += new_sz - sz;
+			}
+		} else if (alloc) {
+			size_t sz = rand_alloc_size(&sr);
+			void *p = (sz != 0) ? stress_alloc(&sr, sz) : NULL;
+
+			result->total_allocs++;
+			if (p != NULL) {
+				result->successful_allocs++;
+				sr.blocks[sr.blocks_alloced].ptr = p;
+				sr.blocks[sr.blocks_alloced].sz = sz;
+				sr.blocks_alloced++;
+				sr.bytes_alloced += sz;
+			}
+		} else {
+			int b = rand_free_choice(&sr);
+			void *p = sr.blocks[b].ptr;
+			size_t sz = sr.blocks[b].sz;
+
+			result->total_frees++;
+			sr.blocks[b] = sr.blocks[sr.blocks_alloced - 1];
+			sr.blocks_alloced--;
+			sr.bytes_alloced -= sz;
+			stress_free(&sr, p);
+		}
+		result->accumulated_in_use_bytes += sr.bytes_alloced;
+	}
+}
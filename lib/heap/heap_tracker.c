@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/heap_tracker.h>
+#include <zephyr/sys/util.h>
+#include <string.h>
+#include "heap.h"
+
+#define NUM_CHUNKS CONFIG_SYS_HEAP_TRACKER_CHUNKS
+#define NUM_SITES  CONFIG_SYS_HEAP_TRACKER_SITES
+#define DEPTH      CONFIG_SYS_HEAP_TRACKER_DEPTH
+
+/* Site collecting the allocations of the sites which did not fit */
+#define OTHER_SITE 0
+
+/* Live chunk, in an open addressing hash table keyed by its memory */
+struct tracked_chunk {
+	void *mem;
+	uint32_t bytes;
+	uint16_t site;
+};
+
+static struct k_spinlock tracker_lock;
+static struct tracked_chunk chunks[NUM_CHUNKS];
+static struct sys_heap_tracker_site sites[NUM_SITES];
+static uint16_t num_sites = 1;
+static uint32_t untracked;
+
+static size_t chunk_slot(void *mem)
+{
+	return (((uintptr_t)mem / CHUNK_UNIT) * 2654435761U) % NUM_CHUNKS;
+}
+
+static struct tracked_chunk *chunk_find(void *mem)
+{
+	size_t i = chunk_slot(mem);
+
+	for (size_t n = 0; n < NUM_CHUNKS; n++) {
+		if (chunks[i].mem == mem) {
+			return &chunks[i];
+		}
+		if (chunks[i].mem == NULL) {
+			break;
+		}
+		i = (i + 1) % NUM_CHUNKS;
+	}
+
+	return NULL;
+}
+
+static struct tracked_chunk *chunk_insert(void *mem)
+{
+	size_t i = chunk_slot(mem);
+
+	for (size_t n = 0; n < NUM_CHUNKS; n++) {
+		if (chunks[i].mem == NULL) {
+			chunks[i].mem = mem;
+			return &chunks[i];
+		}
+		i = (i + 1) % NUM_CHUNKS;
+	}
+
+	return NULL;
+}
+
+/* Linear probing removal, shifting back the entries which follow */
+static void chunk_remove(struct tracked_chunk *tc)
+{
+	size_t hole = tc - chunks;
+	size_t i = hole;
+
+	for (size_t n = 1; n < NUM_CHUNKS; n++) {
+		i = (i + 1) % NUM_CHUNKS;
+		if (chunks[i].mem == NULL) {
+			break;
+		}
+
+		size_t home = chunk_slot(chunks[i].mem);
+		bool stays = (hole < i) ? ((home > hole) && (home <= i))
+					: ((home > hole) || (home <= i));
+
+		if (!stays) {
+			chunks[hole] = chunks[i];
+			hole = i;
+		}
+	}
+
+	chunks[hole].mem = NULL;
+}
+
+#if DEPTH > 1
+struct backtrace {
+	uintptr_t *pc;
+	int count;
+};
+
+/* Skip the allocator frames, up to the caller of the sys_heap API */
+static bool backtrace_cb(void *cookie, unsigned long addr)
+{
+	struct backtrace *bt = cookie;
+
+	if (bt->count == 0) {
+		if (addr == bt->pc[0]) {
+			bt->count = 1;
+		}
+		return true;
+	}
+
+	bt->pc[bt->count++] = addr;
+
+	return bt->count < DEPTH;
+}
+#endif
+
+static void backtrace_get(uintptr_t site, uintptr_t *pc)
+{
+	memset(pc, 0, DEPTH * sizeof(pc[0]));
+	pc[0] = site;
+
+#if DEPTH > 1
+	if (!k_is_in_isr()) {
+		struct backtrace bt = { .pc = pc };
+
+		arch_stack_walk(backtrace_cb, &bt, NULL, NULL);
+	}
+#endif
+}
+
+static uint16_t site_get(struct sys_heap *heap, struct k_thread *thread, const uintptr_t *pc)
+{
+	struct sys_heap_tracker_site *s;
+
+	for (uint16_t i = 1; i < num_sites; i++) {
+		s = &sites[i];
+		if ((s->heap == heap) && (s->thread == thread) &&
+		    (memcmp(s->pc, pc, sizeof(s->pc)) == 0)) {
+			return i;
+		}
+	}
+
+	if (num_sites == NUM_SITES) {
+		return OTHER_SITE;
+	}
+
+	s = &sites[num_sites];
+	s->heap = heap;
+	s->thread = thread;
+	memcpy(s->pc, pc, sizeof(s->pc));
+
+	return num_sites++;
+}
+
+void heap_tracker_init(struct sys_heap *heap, void *mem, size_t bytes)
+{
+	k_spinlock_key_t key = k_spin_lock(&tracker_lock);
+	uint8_t *start = mem;
+
+	ARG_UNUSED(heap);
+
+	for (size_t i = 0; i < NUM_CHUNKS; i++) {
+		/* Removal can shift another stale chunk into this slot */
+		while ((chunks[i].mem != NULL) && ((uint8_t *)chunks[i].mem >= start) &&
+		       ((uint8_t *)chunks[i].mem < start + bytes)) {
+			struct sys_heap_tracker_site *s = &sites[chunks[i].site];
+
+			s->bytes -= chunks[i].bytes;
+			s->count--;
+			chunk_remove(&chunks[i]);
+		}
+	}
+
+	k_spin_unlock(&tracker_lock, key);
+}
+
+void heap_tracker_alloc(struct sys_heap *heap, void *mem, size_t bytes, uintptr_t site)
+{
+	struct k_thread *thread = k_is_in_isr() ? NULL : k_current_get();
+	uintptr_t pc[DEPTH];
+	struct tracked_chunk *tc;
+	struct sys_heap_tracker_site *s;
+	k_spinlock_key_t key;
+
+	backtrace_get(site, pc);
+
+	key = k_spin_lock(&tracker_lock);
+
+	tc = chunk_insert(mem);
+	if (tc == NULL) {
+		untracked++;
+		k_spin_unlock(&tracker_lock, key);
+		return;
+	}
+
+	tc->bytes = bytes;
+	tc->site = site_get(heap, thread, pc);
+
+	s = &sites[tc->site];
+	s->bytes += bytes;
+	s->max_bytes = MAX(s->max_bytes, s->bytes);
+	s->count++;
+	s->allocs++;
+
+	k_spin_unlock(&tracker_lock, key);
+}
+
+void heap_tracker_free(struct sys_heap *heap, void *mem, size_t bytes)
+{
+	k_spinlock_key_t key = k_spin_lock(&tracker_lock);
+	struct tracked_chunk *tc = chunk_find(mem);
+
+	ARG_UNUSED(heap);
+	ARG_UNUSED(bytes);
+
+	if (tc != NULL) {
+		struct sys_heap_tracker_site *s = &sites[tc->site];
+
+		s->bytes -= tc->bytes;
+		s->count--;
+		chunk_remove(tc);
+	}
+
+	k_spin_unlock(&tracker_lock, key);
+}
+
+void heap_tracker_resize(struct sys_heap *heap, void *mem, size_t old_bytes, size_t new_bytes)
+{
+	k_spinlock_key_t key = k_spin_lock(&tracker_lock);
+	struct tracked_chunk *tc = chunk_find(mem);
+
+	ARG_UNUSED(heap);
+	ARG_UNUSED(old_bytes);
+
+	if (tc != NULL) {
+		struct sys_heap_tracker_site *s = &sites[tc->site];
+
+		s->bytes = s->bytes - tc->bytes + new_bytes;
+		s->max_bytes = MAX(s->max_bytes, s->bytes);
+		tc->bytes = new_bytes;
+	}
+
+	k_spin_unlock(&tracker_lock, key);
+}
+
+void sys_heap_tracker_foreach(struct sys_heap *heap, sys_heap_tracker_site_cb_t cb,
+			      void *user_data)
+{
+	struct sys_heap_tracker_site site;
+	k_spinlock_key_t key;
+
+	for (uint16_t i = 0; ; i++) {
+		key = k_spin_lock(&tracker_lock);
+		if (i >= num_sites) {
+			k_spin_unlock(&tracker_lock, key);
+			break;
+		}
+		site = sites[i];
+		k_spin_unlock(&tracker_lock, key);
+
+		if (((heap != NULL) && (site.heap != heap)) ||
+		    ((i == OTHER_SITE) && (site.allocs == 0U))) {
+			continue;
+		}
+
+		if (!cb(&site, user_data)) {
+			break;
+		}
+	}
+}
+
+uint32_t sys_heap_tracker_untracked_get(void)
+{
+	return untracked;
+}
+
+void sys_heap_tracker_reset_max(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&tracker_lock);
+
+	for (uint16_t i = 0; i < num_sites; i++) {
+		sites[i].max_bytes = sites[i].bytes;
+	}
+
+	k_spin_unlock(&tracker_lock, key);
+}
+
+static void map_mark(struct z_heap *h, char *map, size_t cells, chunkid_t c, char mask)
+{
+	uint64_t start = (uint64_t)c * cells;
+	uint64_t end = (uint64_t)right_chunk(h, c) * cells - 1;
+
+	for (size_t i = start / h->end_chunk; i <= end / h->end_chunk; i++) {
+		map[i] |= mask;
+	}
+}
+
+void sys_heap_tracker_frag_map(struct sys_heap *heap, char *map, size_t cells,
+			       struct sys_heap_frag_info *info)
+{
+	static const char cell_chars[] = { '#', '#', '.', '+' };
+	struct z_heap *h = heap->heap;
+	struct sys_heap_frag_info fi = { 0 };
+	k_spinlock_key_t key;
+	bool left_free = false;
+
+	if (map != NULL) {
+		memset(map, 0, cells + 1);
+	}
+
+	key = k_spin_lock(&tracker_lock);
+
+	for (uint16_t i = 0; i < num_sites; i++) {
+		if (sites[i].heap == heap) {
+			sites[i].pinning = 0;
+		}
+	}
+
+	for (chunkid_t c = right_chunk(h, 0); c < h->end_chunk; c = right_chunk(h, c)) {
+		chunkid_t rc = right_chunk(h, c);
+		bool used = chunk_used(h, c);
+
+		if (used) {
+			fi.used_chunks++;
+
+			if (left_free && (rc < h->end_chunk) && !chunk_used(h, rc)) {
+				void *mem = (uint8_t *)&chunk_buf(h)[c] + chunk_header_bytes(h);
+				struct tracked_chunk *tc = chunk_find(mem);
+
+				if (tc != NULL) {
+					sites[tc->site].pinning++;
+				}
+			}
+		} else {
+			size_t bytes = chunksz_to_bytes(h, chunk_size(h, c));
+
+			fi.free_chunks++;
+			fi.free_bytes += bytes;
+			fi.largest_free = MAX(fi.largest_free, bytes);
+		}
+
+		if ((map != NULL) && (cells > 0)) {
+			map_mark(h, map, cells, c, used ? 1 : 2);
+		}
+
+		left_free = !used;
+	}
+
+	k_spin_unlock(&tracker_lock, key);
+
+	if (map != NULL) {
+		for (size_t i = 0; i < cells; i++) {
+			map[i] = cell_chars[(int)map[i]];
+		}
+	}
+
+	if (info != NULL) {
+		*info = fi;
+	}
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/heap_tracker.h>
+#include <zephyr/sys/iterable_sections.h>
+
+#ifdef CONFIG_SYMTAB
+#include <zephyr/debug/symtab.h>
+#endif
+
+#define MAP_CELLS 64
+
+static bool print_site(const struct sys_heap_tracker_site *site, void *user_data)
+{
+	const struct shell *sh = user_data;
+
+	shell_print(sh, "%-10p %-10p %8zu %8zu %6u %8u %7u", (void *)site->heap,
+		    (void *)site->thread, site->bytes, site->max_bytes, site->count,
+		    site->allocs, site->pinning);
+
+	for (int i = 0; (i < CONFIG_SYS_HEAP_TRACKER_DEPTH) && (site->pc[i] != 0U); i++) {
+#ifdef CONFIG_SYMTAB
+		uint32_t offset;
+		const char *name = symtab_find_symbol_name(site->pc[i], &offset);
+
+		shell_print(sh, "    %p %s+0x%x", (void *)site->pc[i], name, offset);
+#else
+		shell_print(sh, "    %p", (void *)site->pc[i]);
+#endif
+	}
+
+	return true;
+}
+
+static int cmd_sites(const struct shell *sh, size_t argc, char **argv)
+{
+	struct sys_heap *heap = NULL;
+
+	if (argc > 1) {
+		heap = (struct sys_heap *)strtoul(argv[1], NULL, 16);
+	}
+
+	shell_print(sh, "heap       thread        bytes      max  count   allocs pinning");
+	sys_heap_tracker_foreach(heap, print_site, (void *)sh);
+	shell_print(sh, "untracked allocations: %u", sys_heap_tracker_untracked_get());
+
+	return 0;
+}
+
+static int cmd_frag(const struct shell *sh, size_t argc, char **argv)
+{
+	struct sys_heap_frag_info info;
+	char map[MAP_CELLS + 1];
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	STRUCT_SECTION_FOREACH(k_heap, h) {
+		k_spinlock_key_t key = k_spin_lock(&h->lock);
+
+		sys_heap_tracker_frag_map(&h->heap, map, MAP_CELLS, &info);
+		k_spin_unlock(&h->lock, key);
+
+		shell_print(sh, "heap %p: %zu free bytes in %u chunks, largest %zu, %u used chunks",
+			    (void *)&h->heap, info.free_bytes, info.free_chunks, info.largest_free,
+			    info.used_chunks);
+		shell_print(sh, "  [%s]", map);
+	}
+
+	return 0;
+}
+
+static int cmd_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	sys_heap_tracker_reset_max();
+	shell_print(sh, "high-water marks reset");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_heap_tracker,
+	SHELL_CMD_ARG(sites, NULL,
+		      "Allocation sites: live bytes, high-water mark, live and total "
+		      "allocations, allocations pinning free chunks.\n"
+		      "Usage: heap_tracker sites [<heap address>]",
+		      cmd_sites, 1, 1),
+	SHELL_CMD(frag, NULL,
+		  "Fragmentation maps of the kernel heaps ('.' free, '#' used, '+' both), "
+		  "also updating the pinning counts of the sites.",
+		  cmd_frag),
+	SHELL_CMD(reset, NULL, "Reset the high-water marks.", cmd_reset),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(heap_tracker, &sub_heap_tracker, "Heap allocation tracker", NULL);
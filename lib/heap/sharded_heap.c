@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/sys/sharded_heap.h>
+
+#define SHARED_ARENA 0U
+
+static unsigned int curr_cpu_arena(void)
+{
+#ifdef CONFIG_SMP
+	unsigned int key = arch_irq_lock();
+	unsigned int id = arch_curr_cpu()->id;
+
+	arch_irq_unlock(key);
+
+	/* The thread may be migrated meanwhile, which costs a remote
+	 * free at worst.
+	 */
+	return 1U + id;
+#else
+	return 1U;
+#endif
+}
+
+static unsigned int block_arena(struct sys_sharded_heap *heap, void *mem)
+{
+	uintptr_t addr = (uintptr_t)mem;
+	unsigned int idx;
+
+	if (addr < heap->cpu_base) {
+		return SHARED_ARENA;
+	}
+
+	/* The last arena also gets the bytes left by the division */
+	idx = 1U + (addr - heap->cpu_base) / heap->cpu_bytes;
+
+	return MIN(idx, heap->num_arenas - 1U);
+}
+
+static void push_remote(struct sys_sharded_heap_arena *arena, void *mem)
+{
+	void *head;
+
+	do {
+		head = atomic_ptr_get(&arena->remote);
+		*(void **)mem = head;
+	} while (!atomic_ptr_cas(&arena->remote, head, mem));
+}
+
+/* Called with the arena lock held */
+static void drain_remote(struct sys_sharded_heap_arena *arena)
+{
+	void *mem = atomic_ptr_clear(&arena->remote);
+	void *next;
+
+	while (mem != NULL) {
+		next = *(void **)mem;
+		sys_heap_free(&arena->heap, mem);
+		mem = next;
+	}
+}
+
+static void *arena_alloc(struct sys_sharded_heap_arena *arena, size_t align, size_t bytes)
+{
+	k_spinlock_key_t key;
+	void *mem;
+
+	if (arena->heap.heap == NULL) {
+		return NULL;
+	}
+
+	key = k_spin_lock(&arena->lock);
+	drain_remote(arena);
+	mem = sys_heap_aligned_alloc(&arena->heap, align, bytes);
+	k_spin_unlock(&arena->lock, key);
+
+	return mem;
+}
+
+void sys_sharded_heap_init(struct sys_sharded_heap *heap, void *mem,
+			   size_t bytes, size_t shared_bytes)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	uint8_t *cpu_mem = (uint8_t *)mem + shared_bytes;
+	size_t cpu_bytes;
+
+	__ASSERT_NO_MSG(shared_bytes < bytes);
+	__ASSERT_NO_MSG(num_cpus < ARRAY_SIZE(heap->arenas));
+
+	(void)memset(heap, 0, sizeof(*heap));
+
+	cpu_bytes = (bytes - shared_bytes) / num_cpus;
+	heap->num_arenas = 1U + num_cpus;
+	heap->cpu_base = (uintptr_t)cpu_mem;
+	heap->cpu_bytes = cpu_bytes;
+
+	if (shared_bytes != 0U) {
+		sys_heap_init(&heap->arenas[SHARED_ARENA].heap, mem, shared_bytes);
+	}
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		if (i == num_cpus - 1U) {
+			cpu_bytes = (uint8_t *)mem + bytes - cpu_mem;
+		}
+
+		sys_heap_init(&heap->arenas[1U + i].heap, cpu_mem, cpu_bytes);
+		cpu_mem += cpu_bytes;
+	}
+}
+
+void *sys_sharded_heap_alloc(struct sys_sharded_heap *heap, size_t bytes)
+{
+	return sys_sharded_heap_aligned_alloc(heap, 0, bytes);
+}
+
+void *sys_sharded_heap_aligned_alloc(struct sys_sharded_heap *heap,
+				     size_t align, size_t bytes)
+{
+	unsigned int own = curr_cpu_arena();
+	void *mem;
+
+	if (bytes == 0U) {
+		return NULL;
+	}
+
+	/* Remote frees link the blocks through their first word */
+	bytes = MAX(bytes, sizeof(void *));
+
+	mem = arena_alloc(&heap->arenas[own], align, bytes);
+	if (mem != NULL) {
+		return mem;
+	}
+
+	/* Fall back to the shared arena, then steal from the other CPUs */
+	for (unsigned int i = 0; (mem == NULL) && (i < heap->num_arenas); i++) {
+		if (i != own) {
+			mem = arena_alloc(&heap->arenas[i], align, bytes);
+		}
+	}
+
+	return mem;
+}
+
+void *sys_sharded_heap_aligned_realloc(struct sys_sharded_heap *heap, void *ptr,
+				       size_t align, size_t bytes)
+{
+	struct sys_sharded_heap_arena *arena;
+	k_spinlock_key_t key;
+	size_t old_bytes;
+	void *mem;
+
+	if (ptr == NULL) {
+		return sys_sharded_heap_aligned_alloc(heap, align, bytes);
+	}
+
+	if (bytes == 0U) {
+		sys_sharded_heap_free(heap, ptr);
+		return NULL;
+	}
+
+	bytes = MAX(bytes, sizeof(void *));
+	arena = &heap->arenas[block_arena(heap, ptr)];
+
+	key = k_spin_lock(&arena->lock);
+	drain_remote(arena);
+	old_bytes = sys_heap_usable_size(&arena->heap, ptr);
+	mem = sys_heap_aligned_realloc(&arena->heap, ptr, align, bytes);
+	k_spin_unlock(&arena->lock, key);
+
+	if (mem != NULL) {
+		return mem;
+	}
+
+	/* The arena is full, move the block anywhere else */
+	mem = sys_sharded_heap_aligned_alloc(heap, align, bytes);
+	if (mem != NULL) {
+		(void)memcpy(mem, ptr, MIN(old_bytes, bytes));
+		sys_sharded_heap_free(heap, ptr);
+	}
+
+	return mem;
+}
+
+void sys_sharded_heap_free(struct sys_sharded_heap *heap, void *mem)
+{
+	struct sys_sharded_heap_arena *arena;
+	unsigned int idx;
+	k_spinlock_key_t key;
+
+	if (mem == NULL) {
+		return;
+	}
+
+	idx = block_arena(heap, mem);
+	arena = &heap->arenas[idx];
+
+	if ((idx != SHARED_ARENA) && (idx != curr_cpu_arena())) {
+		/* Leave it to the owner of the arena */
+		push_remote(arena, mem);
+		return;
+	}
+
+	key = k_spin_lock(&arena->lock);
+	sys_heap_free(&arena->heap, mem);
+	k_spin_unlock(&arena->lock, key);
+}
@@ -15,6 +15,7 @@
 #include <zephyr/sys/mutex.h>
 #endif
 #include <zephyr/sys/sys_heap.h>
+#include <zephyr/sys/sharded_heap.h>
 #include <zephyr/sys/libc-hooks.h>
 #include <zephyr/types.h>
 #ifdef CONFIG_MMU
@@ -114,8 +115,22 @@ extern char _heap_sentry[];
 
 # endif /* else ALLOCATE_HEAP_AT_STARTUP */
 
+#ifdef CONFIG_COMMON_LIBC_MALLOC_SHARDED
+Z_LIBC_DATA static struct sys_sharded_heap z_malloc_heap;
+
+/* The sharded heap locks each of its arenas itself */
+#define malloc_heap_aligned_alloc sys_sharded_heap_aligned_alloc
+#define malloc_heap_aligned_realloc sys_sharded_heap_aligned_realloc
+#define malloc_heap_free sys_sharded_heap_free
+#define malloc_lock()
+#define malloc_unlock()
+#else
 Z_LIBC_DATA static struct sys_heap z_malloc_heap;
 
+#define malloc_heap_aligned_alloc sys_heap_aligned_alloc
+#define malloc_heap_aligned_realloc sys_heap_aligned_realloc
+#define malloc_heap_free sys_heap_free
+
 #ifdef CONFIG_MULTITHREADING
 Z_LIBC_DATA SYS_MUTEX_DEFINE(z_malloc_heap_mutex);
 
@@ -136,14 +151,15 @@ malloc_unlock(void)
 #define malloc_lock()
 #define malloc_unlock()
 #endif
+#endif /* CONFIG_COMMON_LIBC_MALLOC_SHARDED */
 
 void *malloc(size_t size)
 {
 	malloc_lock();
 
-	void *ret = sys_heap_aligned_alloc(&z_malloc_heap,
-					   __alignof__(z_max_align_t),
-					   size);
+	void *ret = malloc_heap_aligned_alloc(&z_malloc_heap,
+					      __alignof__(z_max_align_t),
+					      size);
 	if (ret == NULL && size != 0) {
 		errno = ENOMEM;
 	}
@@ -157,9 +173,9 @@ void *aligned_alloc(size_t alignment, size_t size)
 {
 	malloc_lock();
 
-	void *ret = sys_heap_aligned_alloc(&z_malloc_heap,
-					   alignment,
-					   size);
+	void *ret = malloc_heap_aligned_alloc(&z_malloc_heap,
+					      alignment,
+					      size);
 	if (ret == NULL && size != 0) {
 		errno = ENOMEM;
 	}
@@ -231,7 +247,12 @@ static int malloc_prepare(void)
 	z_malloc_partition.attr = K_MEM_PARTITION_P_RW_U_RW;
 #endif
 
+#ifdef CONFIG_COMMON_LIBC_MALLOC_SHARDED
+	sys_sharded_heap_init(&z_malloc_heap, heap_base, heap_size,
+			      heap_size / 100 * CONFIG_COMMON_LIBC_MALLOC_SHARED_PERCENT);
+#else
 	sys_heap_init(&z_malloc_heap, heap_base, heap_size);
+#endif
 
 	return 0;
 }
@@ -240,9 +261,9 @@ void *realloc(void *ptr, size_t requested_size)
 {
 	malloc_lock();
 
-	void *ret = sys_heap_aligned_realloc(&z_malloc_heap, ptr,
-					     __alignof__(z_max_align_t),
-					     requested_size);
+	void *ret = malloc_heap_aligned_realloc(&z_malloc_heap, ptr,
+						__alignof__(z_max_align_t),
+						requested_size);
 
 	if (ret == NULL && requested_size != 0) {
 		errno = ENOMEM;
@@ -256,7 +277,7 @@ void *realloc(void *ptr, size_t requested_size)
 void free(void *ptr)
 {
 	malloc_lock();
-	sys_heap_free(&z_malloc_heap, ptr);
+	malloc_heap_free(&z_malloc_heap, ptr);
 	malloc_unlock();
 }
 
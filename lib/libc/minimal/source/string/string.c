@@ -10,6 +10,17 @@
 #include <stdint.h>
 #include <sys/types.h>
 
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+#define MEM_WORD_MASK (sizeof(mem_word_t) - 1)
+
+/* Word with each byte set to <b> */
+#define MEM_WORD_REPEAT(b) ((mem_word_t)-1 / 0xff * (b))
+
+/* Non-zero if any byte of <w> is zero */
+#define MEM_WORD_HAS_ZERO(w) \
+	(((w) - MEM_WORD_REPEAT(0x01)) & ~(w) & MEM_WORD_REPEAT(0x80))
+#endif
+
 /**
  *
  * @brief Copy a string
@@ -106,14 +117,34 @@ char *strrchr(const char *s, int c)
 
 size_t strlen(const char *s)
 {
-	size_t n = 0;
+	const char *start = s;
+
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+	while (((uintptr_t)s) & MEM_WORD_MASK) {
+		if (*s == '\0') {
+			return s - start;
+		}
+		s++;
+	}
+
+	/*
+	 * Aligned word reads never cross a page boundary, so reading up to the
+	 * end of the word holding the terminator is safe.
+	 */
+	const mem_word_t *w = (const mem_word_t *)s;
+
+	while (!MEM_WORD_HAS_ZERO(*w)) {
+		w++;
+	}
+
+	s = (const char *)w;
+#endif
 
 	while (*s != '\0') {
 		s++;
-		n++;
 	}
 
-	return n;
+	return s - start;
 }
 
 /**
@@ -222,6 +253,31 @@ int memcmp(const void *m1, const void *m2, size_t n)
 	const char *c1 = m1;
 	const char *c2 = m2;
 
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+	/* skip equal words when both areas have identical alignment */
+	if ((((uintptr_t)c1 ^ (uintptr_t)c2) & MEM_WORD_MASK) == 0) {
+		while ((((uintptr_t)c1) & MEM_WORD_MASK) && (n > 0) && (*c1 == *c2)) {
+			c1++;
+			c2++;
+			n--;
+		}
+
+		if ((((uintptr_t)c1) & MEM_WORD_MASK) == 0) {
+			const mem_word_t *w1 = (const mem_word_t *)c1;
+			const mem_word_t *w2 = (const mem_word_t *)c2;
+
+			while ((n >= sizeof(mem_word_t)) && (*w1 == *w2)) {
+				w1++;
+				w2++;
+				n -= sizeof(mem_word_t);
+			}
+
+			c1 = (const char *)w1;
+			c2 = (const char *)w2;
+		}
+	}
+#endif
+
 	if (!n) {
 		return 0;
 	}
@@ -278,13 +334,23 @@ void *memmove(void *d, const void *s, size_t n)
 
 void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
 {
+#if defined(CONFIG_MINIMAL_LIBC_STRING_X86_REP)
+	void *dest = d;
+
+	__asm__ volatile("rep movsb"
+			 : "+D"(dest), "+S"(s), "+c"(n)
+			 :
+			 : "memory");
+
+	return d;
+#else
 	/* attempt word-sized copying only if buffers have identical alignment */
 
 	unsigned char *d_byte = (unsigned char *)d;
 	const unsigned char *s_byte = (const unsigned char *)s;
 
 #if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
-	const uintptr_t mask = sizeof(mem_word_t) - 1;
+	const uintptr_t mask = MEM_WORD_MASK;
 
 	if ((((uintptr_t)d ^ (uintptr_t)s_byte) & mask) == 0) {
 
@@ -298,11 +364,29 @@ void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
 			n--;
 		}
 
-		/* do word-sized copying as long as possible */
+		/*
+		 * do word-sized copying as long as possible, four words at a
+		 * time which lets the compiler use load/store multiple
+		 */
 
 		mem_word_t *d_word = (mem_word_t *)d_byte;
 		const mem_word_t *s_word = (const mem_word_t *)s_byte;
 
+		while (n >= 4 * sizeof(mem_word_t)) {
+			mem_word_t w0 = s_word[0];
+			mem_word_t w1 = s_word[1];
+			mem_word_t w2 = s_word[2];
+			mem_word_t w3 = s_word[3];
+
+			d_word[0] = w0;
+			d_word[1] = w1;
+			d_word[2] = w2;
+			d_word[3] = w3;
+			d_word += 4;
+			s_word += 4;
+			n -= 4 * sizeof(mem_word_t);
+		}
+
 		while (n >= sizeof(mem_word_t)) {
 			*(d_word++) = *(s_word++);
 			n -= sizeof(mem_word_t);
@@ -321,6 +405,7 @@ void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
 	}
 
 	return d;
+#endif /* CONFIG_MINIMAL_LIBC_STRING_X86_REP */
 }
 
 /**
@@ -332,6 +417,16 @@ void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
 
 void *memset(void *buf, int c, size_t n)
 {
+#if defined(CONFIG_MINIMAL_LIBC_STRING_X86_REP)
+	void *dest = buf;
+
+	__asm__ volatile("rep stosb"
+			 : "+D"(dest), "+c"(n)
+			 : "a"(c)
+			 : "memory");
+
+	return buf;
+#else
 	/* do byte-sized initialization until word-aligned or finished */
 
 	unsigned char *d_byte = (unsigned char *)buf;
@@ -357,6 +452,15 @@ void *memset(void *buf, int c, size_t n)
 	c_word |= c_word << 32;
 #endif
 
+	while (n >= 4 * sizeof(mem_word_t)) {
+		d_word[0] = c_word;
+		d_word[1] = c_word;
+		d_word[2] = c_word;
+		d_word[3] = c_word;
+		d_word += 4;
+		n -= 4 * sizeof(mem_word_t);
+	}
+
 	while (n >= sizeof(mem_word_t)) {
 		*(d_word++) = c_word;
 		n -= sizeof(mem_word_t);
@@ -373,6 +477,7 @@ void *memset(void *buf, int c, size_t n)
 	}
 
 	return buf;
+#endif /* CONFIG_MINIMAL_LIBC_STRING_X86_REP */
 }
 
 /**
@@ -1344,6 +1344,15 @@ static inline void store_count(const struct conversion *conv,
 	}
 }
 
+/* Specifiers handled by the fast path when they have no flags, width,
+ * precision or length modifier.
+ */
+static inline bool is_simple_specifier(char c)
+{
+	return (c == 'd') || (c == 'i') || (c == 'u') || (c == 'x') ||
+	       (c == 'X') || (c == 's') || (c == 'c');
+}
+
 /* Outline function to emit all characters in [sp, ep). */
 static int outs(cbprintf_cb out,
 		void *ctx,
@@ -1409,6 +1418,57 @@ int z_cbvprintf_impl(cbprintf_cb out, void *ctx, const char *fp,
 			continue;
 		}
 
+		/* Conversions without flags, width, precision or length
+		 * modifier make up most of the formats used for logging
+		 * and shell output. They are emitted directly, without
+		 * going through the generic conversion state below.
+		 */
+		if (IS_ENABLED(CONFIG_CBPRINTF_SIMPLE_FAST_PATH)
+		    && is_simple_specifier(fp[1])) {
+			struct conversion fconv = {
+				.specifier = fp[1],
+			};
+			const char *bps;
+			const char *bpe = buf + sizeof(buf);
+
+			if (IS_ENABLED(CONFIG_CBPRINTF_PACKAGE_SUPPORT_TAGGED_ARGUMENTS)
+			    && tagged_ap) {
+				(void)va_arg(ap, int);
+			}
+
+			switch (fconv.specifier) {
+			case 's':
+				bps = va_arg(ap, const char *);
+				bpe = NULL;
+				break;
+			case 'c':
+				buf[0] = (char)va_arg(ap, int);
+				bps = buf;
+				bpe = buf + 1;
+				break;
+			case 'd':
+			case 'i':
+				sint = va_arg(ap, int);
+				if (sint < 0) {
+					OUTC('-');
+					bps = encode_uint((uint_value_type)-sint, &fconv,
+							  buf, bpe);
+				} else {
+					bps = encode_uint((uint_value_type)sint, &fconv,
+							  buf, bpe);
+				}
+				break;
+			default:
+				bps = encode_uint(va_arg(ap, unsigned int), &fconv,
+						  buf, bpe);
+				break;
+			}
+
+			OUTS(bps, bpe);
+			fp += 2;
+			continue;
+		}
+
 		/* Force union into RAM with conversion state to
 		 * mitigate LLVM code generation bug.
 		 */
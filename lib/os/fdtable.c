@@ -23,6 +23,8 @@
 #include <zephyr/sys/speculation.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/sys/atomic.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/zvfs/epoll.h>
 
 struct stat;
 
@@ -79,10 +81,32 @@ FILE *stdout = &fdtable[1];
 FILE *stderr = &fdtable[2];
 #endif
 
+/* Bitmap of the entries in use, i.e. with a non-zero reference count */
+static atomic_t fdtable_used[ATOMIC_BITMAP_SIZE(CONFIG_ZVFS_OPEN_MAX)] = {
+#if defined(CONFIG_POSIX_DEVICE_IO)
+	BIT(0) | BIT(1) | BIT(2),
+#endif
+};
+
+/*
+ * Last descriptor found for an object, indexed by a hash of the object
+ * address. Entries are only hints, checked against the table on lookup.
+ */
+static int fdtable_obj_hint[CONFIG_ZVFS_OPEN_MAX];
+
 static K_MUTEX_DEFINE(fdtable_lock);
 
+static size_t obj_hint_index(const void *obj)
+{
+	uintptr_t addr = (uintptr_t)obj;
+
+	return ((addr >> 3) ^ (addr >> 11)) % ARRAY_SIZE(fdtable_obj_hint);
+}
+
 static int z_fd_ref(int fd)
 {
+	atomic_set_bit(fdtable_used, fd);
+
 	return atomic_inc(&fdtable[fd].refcount) + 1;
 }
 
@@ -108,16 +132,23 @@ static int z_fd_unref(int fd)
 
 	fdtable[fd].obj = NULL;
 	fdtable[fd].vtable = NULL;
+	atomic_clear_bit(fdtable_used, fd);
 
 	return 0;
 }
 
 static int _find_fd_entry(void)
 {
-	int fd;
+	for (size_t i = 0; i < ARRAY_SIZE(fdtable_used); i++) {
+		atomic_val_t free_bits = ~atomic_get(&fdtable_used[i]);
+		int fd;
 
-	for (fd = 0; fd < ARRAY_SIZE(fdtable); fd++) {
-		if (!atomic_get(&fdtable[fd].refcount)) {
+		if (free_bits == 0) {
+			continue;
+		}
+
+		fd = i * ATOMIC_BITS + u64_count_trailing_zeros((uint64_t)free_bits);
+		if (fd < ARRAY_SIZE(fdtable)) {
 			return fd;
 		}
 	}
@@ -187,10 +218,16 @@ void *zvfs_get_fd_obj(int fd, const struct fd_op_vtable *vtable, int err)
 
 static int z_get_fd_by_obj_and_vtable(void *obj, const struct fd_op_vtable *vtable)
 {
-	int fd;
+	size_t hint = obj_hint_index(obj);
+	int fd = fdtable_obj_hint[hint];
+
+	if (fdtable[fd].obj == obj && fdtable[fd].vtable == vtable) {
+		return fd;
+	}
 
 	for (fd = 0; fd < ARRAY_SIZE(fdtable); fd++) {
 		if (fdtable[fd].obj == obj && fdtable[fd].vtable == vtable) {
+			fdtable_obj_hint[hint] = fd;
 			return fd;
 		}
 	}
@@ -279,6 +316,7 @@ void zvfs_finalize_typed_fd(int fd, void *obj, const struct fd_op_vtable *vtable
 	fdtable[fd].obj = obj;
 	fdtable[fd].vtable = vtable;
 	fdtable[fd].mode = mode;
+	fdtable_obj_hint[obj_hint_index(obj)] = fd;
 
 	/* Let the object know about the lock just in case it needs it
 	 * for something. For BSD sockets, the lock is used with condition
@@ -391,6 +429,10 @@ int zvfs_close(int fd)
 		return -1;
 	}
 
+	if (IS_ENABLED(CONFIG_ZVFS_EPOLL)) {
+		zvfs_epoll_close_fd(fd);
+	}
+
 	(void)k_mutex_lock(&fdtable[fd].lock, K_FOREVER);
 	if (fdtable[fd].vtable->close != NULL) {
 		/* close() is optional - e.g. stdinout_fd_op_vtable */
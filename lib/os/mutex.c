@@ -8,6 +8,12 @@
 #include <zephyr/sys/mutex.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/kernel_structs.h>
+#include <kernel_internal.h>
+
+#ifdef CONFIG_CURRENT_THREAD_USE_TLS
+__thread struct sys_mutex *z_sys_mutex_checked[Z_SYS_MUTEX_CHECKED_NUM];
+__thread uint8_t z_sys_mutex_checked_next;
+#endif /* CONFIG_CURRENT_THREAD_USE_TLS */
 
 static struct k_mutex *get_k_mutex(struct sys_mutex *mutex)
 {
@@ -23,9 +29,9 @@ static struct k_mutex *get_k_mutex(struct sys_mutex *mutex)
 
 static bool check_sys_mutex_addr(struct sys_mutex *addr)
 {
-	/* sys_mutex memory is never touched, just used to lookup the
-	 * underlying k_mutex, but we don't want threads using mutexes
-	 * that are outside their memory domain
+	/* sys_mutex memory holds the owner of the uncontended mutex and is
+	 * used to lookup the underlying k_mutex, we don't want threads using
+	 * mutexes that are outside their memory domain
 	 */
 	return K_SYSCALL_MEMORY_WRITE(addr, sizeof(struct sys_mutex));
 }
@@ -38,7 +44,7 @@ int z_impl_z_sys_mutex_kernel_lock(struct sys_mutex *mutex, k_timeout_t timeout)
 		return -EINVAL;
 	}
 
-	return k_mutex_lock(kernel_mutex, timeout);
+	return z_mutex_lock_user(kernel_mutex, &mutex->val, timeout);
 }
 
 static inline int z_vrfy_z_sys_mutex_kernel_lock(struct sys_mutex *mutex,
@@ -56,11 +62,11 @@ int z_impl_z_sys_mutex_kernel_unlock(struct sys_mutex *mutex)
 {
 	struct k_mutex *kernel_mutex = get_k_mutex(mutex);
 
-	if ((kernel_mutex == NULL) || (kernel_mutex->lock_count == 0)) {
+	if (kernel_mutex == NULL) {
 		return -EINVAL;
 	}
 
-	return k_mutex_unlock(kernel_mutex);
+	return z_mutex_unlock_user(kernel_mutex, &mutex->val);
 }
 
 static inline int z_vrfy_z_sys_mutex_kernel_unlock(struct sys_mutex *mutex)
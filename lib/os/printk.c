@@ -21,6 +21,8 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/cbprintf.h>
 #include <zephyr/llext/symbol.h>
+#include <zephyr/sys/spsc_pbuf.h>
+#include <zephyr/init.h>
 #include <sys/types.h>
 
 /* Option present only when CONFIG_USERSPACE enabled. */
@@ -112,6 +114,122 @@ static int char_out(int c, void *ctx_p)
 	return _char_out(c);
 }
 
+#ifdef CONFIG_PRINTK_DEFERRED
+/* Packet buffer allocations are only word aligned, packages need more. */
+#define DEFERRED_PAD (CBPRINTF_PACKAGE_ALIGNMENT - sizeof(uint32_t))
+
+static uint8_t __aligned(sizeof(uint32_t)) deferred_buf[CONFIG_PRINTK_DEFERRED_BUFFER_SIZE];
+static struct spsc_pbuf *deferred_pbuf;
+static struct k_spinlock deferred_lock;
+static K_SEM_DEFINE(deferred_sem, 0, 1);
+static atomic_t deferred_dropped;
+
+/*
+ * Package the arguments into the packet buffer. The producer side of the
+ * buffer is serialized with a spinlock held only while packaging, the
+ * output thread reads the buffer without locking.
+ *
+ * Returns false if the message must be printed synchronously.
+ */
+static bool deferred_put(const char *fmt, va_list ap)
+{
+	k_spinlock_key_t key;
+	va_list ap_copy;
+	char *buf;
+	int plen;
+	int len;
+
+	if ((deferred_pbuf == NULL) || k_is_pre_kernel()) {
+		return false;
+	}
+
+	va_copy(ap_copy, ap);
+	plen = cbvprintf_package(NULL, 0, 0, fmt, ap_copy);
+	va_end(ap_copy);
+
+	if (plen < 0) {
+		return false;
+	}
+
+	len = plen + DEFERRED_PAD;
+	if (len >= SPSC_PBUF_MAX_LEN) {
+		atomic_inc(&deferred_dropped);
+		return true;
+	}
+
+	key = k_spin_lock(&deferred_lock);
+
+	if (spsc_pbuf_alloc(deferred_pbuf, len, &buf) < len) {
+		k_spin_unlock(&deferred_lock, key);
+		atomic_inc(&deferred_dropped);
+		return true;
+	}
+
+	plen = cbvprintf_package(UINT_TO_POINTER(ROUND_UP(POINTER_TO_UINT(buf),
+							  CBPRINTF_PACKAGE_ALIGNMENT)),
+				 plen, 0, fmt, ap);
+	if (plen > 0) {
+		spsc_pbuf_commit(deferred_pbuf, len);
+	}
+
+	k_spin_unlock(&deferred_lock, key);
+
+	k_sem_give(&deferred_sem);
+
+	return true;
+}
+
+static void deferred_thread(void *p1, void *p2, void *p3)
+{
+	char *buf;
+	uint16_t len;
+	atomic_val_t dropped;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		(void)k_sem_take(&deferred_sem, K_FOREVER);
+
+		while ((len = spsc_pbuf_claim(deferred_pbuf, &buf)) > 0U) {
+#ifdef CONFIG_PRINTK_SYNC
+			k_spinlock_key_t key = k_spin_lock(&lock);
+#endif
+
+			(void)cbpprintf(char_out, NULL,
+					UINT_TO_POINTER(ROUND_UP(POINTER_TO_UINT(buf),
+								 CBPRINTF_PACKAGE_ALIGNMENT)));
+
+#ifdef CONFIG_PRINTK_SYNC
+			k_spin_unlock(&lock, key);
+#endif
+			spsc_pbuf_free(deferred_pbuf, len);
+		}
+
+		dropped = atomic_set(&deferred_dropped, 0);
+		if (dropped > 0) {
+			(void)cbprintf(char_out, NULL, "--- %ld messages dropped ---\n",
+				       (long)dropped);
+		}
+	}
+}
+
+K_THREAD_DEFINE(printk_deferred_thread, CONFIG_PRINTK_DEFERRED_THREAD_STACK_SIZE,
+		deferred_thread, NULL, NULL, NULL,
+		CLAMP(CONFIG_PRINTK_DEFERRED_THREAD_PRIORITY, K_HIGHEST_APPLICATION_THREAD_PRIO,
+		      K_LOWEST_APPLICATION_THREAD_PRIO), 0, 0);
+
+static int printk_deferred_init(void)
+{
+	deferred_pbuf = spsc_pbuf_init(deferred_buf, sizeof(deferred_buf), 0);
+
+	return 0;
+}
+
+SYS_INIT(printk_deferred_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_PRINTK_DEFERRED */
+
 void vprintk(const char *fmt, va_list ap)
 {
 	if (IS_ENABLED(CONFIG_LOG_PRINTK)) {
@@ -138,6 +256,12 @@ void vprintk(const char *fmt, va_list ap)
 			buf_flush(&ctx);
 		}
 	} else {
+#ifdef CONFIG_PRINTK_DEFERRED
+		if (deferred_put(fmt, ap)) {
+			return;
+		}
+#endif
+
 #ifdef CONFIG_PRINTK_SYNC
 		k_spinlock_key_t key = k_spin_lock(&lock);
 #endif
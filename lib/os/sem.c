@@ -66,6 +66,8 @@ int sys_sem_give(struct sys_sem *sem)
 	old_value = bounded_inc(&sem->futex.val,
 				SYS_SEM_MINIMUM, sem->limit);
 	if (old_value < 0) {
+		/* Only a contended semaphore needs the kernel */
+		Z_SYS_SYNC_STATS_INC(sem, slow);
 		ret = k_futex_wake(&sem->futex, true);
 
 		if (ret > 0) {
@@ -74,7 +76,7 @@ int sys_sem_give(struct sys_sem *sem)
 	} else if (old_value >= sem->limit) {
 		return -EAGAIN;
 	} else {
-		;
+		Z_SYS_SYNC_STATS_INC(sem, fast);
 	}
 	return ret;
 }
@@ -84,13 +86,28 @@ int sys_sem_take(struct sys_sem *sem, k_timeout_t timeout)
 	int ret = 0;
 	atomic_t old_value;
 
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		/* Never mark the semaphore contended when not going to wait,
+		 * that would send the next give to the kernel for nothing
+		 */
+		old_value = bounded_dec(&sem->futex.val, SYS_SEM_MINIMUM + 1);
+		if (old_value > 0) {
+			Z_SYS_SYNC_STATS_INC(sem, fast);
+			return 0;
+		}
+
+		return -ETIMEDOUT;
+	}
+
 	do {
 		old_value = bounded_dec(&sem->futex.val,
 					SYS_SEM_MINIMUM);
 		if (old_value > 0) {
+			Z_SYS_SYNC_STATS_INC(sem, fast);
 			return 0;
 		}
 
+		Z_SYS_SYNC_STATS_INC(sem, slow);
 		ret = k_futex_wait(&sem->futex,
 				   SYS_SEM_CONTENDED, timeout);
 	} while (ret == 0 || ret == -EAGAIN);
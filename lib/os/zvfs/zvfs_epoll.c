@@ -0,0 +1,449 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/bitarray.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/fdtable.h>
+#include <zephyr/zvfs/epoll.h>
+
+/* one event for ZVFS_POLLIN, one for ZVFS_POLLOUT */
+#define ZVFS_EPOLL_EVENTS_PER_FD 2
+#define ZVFS_EPOLL_POLL_EVENTS   (ZVFS_EPOLLIN | ZVFS_EPOLLPRI | ZVFS_EPOLLOUT)
+
+BUILD_ASSERT(CONFIG_ZVFS_EPOLL_MAX_FDS <= 256, "entry index must fit in a poll event tag");
+
+int zvfs_poll_internal(struct zvfs_pollfd *fds, int nfds, k_timeout_t timeout);
+
+struct zvfs_epoll_entry {
+	/* on the check list of the instance */
+	sys_dnode_t node;
+	struct k_poll_event pev[ZVFS_EPOLL_EVENTS_PER_FD];
+	struct zvfs_epoll_event event;
+	/* last zvfs_epoll_wait() which reported the entry */
+	uint32_t reported;
+	int fd;
+	uint8_t num_pev;
+};
+
+struct zvfs_epoll {
+	struct k_poll_set set;
+	struct k_mutex lock;
+	/* entries to check without waiting in the next zvfs_epoll_wait() */
+	sys_dlist_t check;
+	uint32_t wait_seq;
+	struct zvfs_epoll_entry entries[CONFIG_ZVFS_EPOLL_MAX_FDS];
+};
+
+SYS_BITARRAY_DEFINE_STATIC(epolls_bitarray, CONFIG_ZVFS_EPOLL_MAX);
+static struct zvfs_epoll epolls[CONFIG_ZVFS_EPOLL_MAX];
+/* protects the allocation of instances against zvfs_epoll_close_fd() */
+static K_MUTEX_DEFINE(epolls_lock);
+static const struct fd_op_vtable zvfs_epoll_fd_vtable;
+
+static inline struct zvfs_epoll_entry *zvfs_epoll_get(sys_dlist_t *list)
+{
+	sys_dnode_t *node = sys_dlist_get(list);
+
+	return (node != NULL) ? CONTAINER_OF(node, struct zvfs_epoll_entry, node) : NULL;
+}
+
+static struct zvfs_epoll_entry *zvfs_epoll_find(struct zvfs_epoll *ep, int fd)
+{
+	for (int i = 0; i < ARRAY_SIZE(ep->entries); i++) {
+		if (ep->entries[i].fd == fd) {
+			return &ep->entries[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void zvfs_epoll_unregister(struct zvfs_epoll *ep, struct zvfs_epoll_entry *entry)
+{
+	for (int i = 0; i < entry->num_pev; i++) {
+		(void)k_poll_set_del(&ep->set, &entry->pev[i]);
+	}
+	entry->num_pev = 0;
+
+	if (sys_dnode_is_linked(&entry->node)) {
+		sys_dlist_remove(&entry->node);
+	}
+}
+
+static int zvfs_epoll_register(struct zvfs_epoll *ep, struct zvfs_epoll_entry *entry)
+{
+	struct zvfs_pollfd pfd = {
+		.fd = entry->fd,
+		.events = entry->event.events & ZVFS_EPOLL_POLL_EVENTS,
+	};
+	struct k_poll_event *pev = entry->pev;
+	const struct fd_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *ctx;
+	int ret;
+
+	ctx = zvfs_get_fd_obj_and_vtable(entry->fd, &vtable, &lock);
+	if (ctx == NULL) {
+		return -EBADF;
+	}
+
+	/* The poll events of the fd are filled in by the same ioctl as for
+	 * zvfs_poll(), but are kept registered in the poll set.
+	 */
+	memset(entry->pev, 0, sizeof(entry->pev));
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	ret = zvfs_fdtable_call_ioctl(vtable, ctx, ZFD_IOCTL_POLL_PREPARE, &pfd, &pev,
+				      entry->pev + ARRAY_SIZE(entry->pev));
+	k_mutex_unlock(lock);
+
+	if (ret == -EXDEV) {
+		/* offloaded sockets have their own poll implementation */
+		return -EPERM;
+	} else if (ret < 0 && ret != -EALREADY) {
+		return ret;
+	}
+
+	entry->num_pev = pev - entry->pev;
+	for (int i = 0; i < entry->num_pev; i++) {
+		entry->pev[i].tag = entry - ep->entries;
+		(void)k_poll_set_add(&ep->set, &entry->pev[i]);
+	}
+
+	/* Whatever is ready already, or could not be registered, like POLLOUT
+	 * of a datagram socket, is found by checking the fd once.
+	 */
+	sys_dlist_append(&ep->check, &entry->node);
+
+	return 0;
+}
+
+static int zvfs_epoll_ctl_locked(struct zvfs_epoll *ep, int op, int fd,
+				 struct zvfs_epoll_event *event)
+{
+	struct zvfs_epoll_entry *entry = zvfs_epoll_find(ep, fd);
+	int ret;
+
+	switch (op) {
+	case ZVFS_EPOLL_CTL_ADD:
+		if (entry != NULL) {
+			return -EEXIST;
+		}
+
+		entry = zvfs_epoll_find(ep, -1);
+		if (entry == NULL) {
+			return -ENOSPC;
+		}
+
+		entry->fd = fd;
+		entry->event = *event;
+		ret = zvfs_epoll_register(ep, entry);
+		if (ret < 0) {
+			entry->fd = -1;
+		}
+
+		return ret;
+
+	case ZVFS_EPOLL_CTL_MOD:
+		if (entry == NULL) {
+			return -ENOENT;
+		}
+
+		zvfs_epoll_unregister(ep, entry);
+		entry->event = *event;
+		ret = zvfs_epoll_register(ep, entry);
+		if (ret < 0) {
+			entry->fd = -1;
+		}
+
+		return ret;
+
+	case ZVFS_EPOLL_CTL_DEL:
+		if (entry == NULL) {
+			return -ENOENT;
+		}
+
+		zvfs_epoll_unregister(ep, entry);
+		entry->fd = -1;
+
+		return 0;
+
+	default:
+		return -EINVAL;
+	}
+}
+
+/* Check the fd of the entry and report it, returns true if it is ready */
+static bool zvfs_epoll_report(struct zvfs_epoll *ep, struct zvfs_epoll_entry *entry,
+			      struct zvfs_epoll_event *event)
+{
+	struct zvfs_pollfd pfd = {
+		.fd = entry->fd,
+		.events = entry->event.events & ZVFS_EPOLL_POLL_EVENTS,
+	};
+	uint32_t revents;
+
+	if (entry->reported == ep->wait_seq) {
+		/* both events of the fd were ready */
+		return false;
+	}
+
+	if (zvfs_poll_internal(&pfd, 1, K_NO_WAIT) < 0 || (pfd.revents & ZVFS_POLLNVAL) != 0) {
+		/* the fd went away without being closed through zvfs */
+		pfd.revents = ZVFS_POLLERR;
+	}
+
+	revents = pfd.revents & (entry->event.events | ZVFS_EPOLLERR | ZVFS_EPOLLHUP);
+	if (revents == 0) {
+		return false;
+	}
+
+	event->events = revents;
+	event->data = entry->event.data;
+	entry->reported = ep->wait_seq;
+
+	return true;
+}
+
+static int zvfs_epoll_wait_locked(struct zvfs_epoll *ep, struct zvfs_epoll_event *events,
+				  int maxevents, k_timeout_t timeout)
+{
+	struct k_poll_event *ready[ARRAY_SIZE(ep->entries) * ZVFS_EPOLL_EVENTS_PER_FD];
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	int n = 0;
+
+	ep->wait_seq++;
+
+	while (n == 0) {
+		sys_dlist_t again = SYS_DLIST_STATIC_INIT(&again);
+		struct zvfs_epoll_entry *entry;
+		int num_ready;
+
+		/* New entries and level-triggered entries reported last time */
+		while (n < maxevents) {
+			entry = zvfs_epoll_get(&ep->check);
+			if (entry == NULL) {
+				break;
+			}
+
+			if (zvfs_epoll_report(ep, entry, &events[n])) {
+				n++;
+				if ((entry->event.events & ZVFS_EPOLLET) == 0) {
+					sys_dlist_append(&again, &entry->node);
+				}
+			}
+		}
+
+		if (n < maxevents) {
+			/* do not block ctl and other waiters while waiting */
+			k_mutex_unlock(&ep->lock);
+			num_ready = k_poll_set_wait(&ep->set, ready,
+						    MIN(maxevents - n, (int)ARRAY_SIZE(ready)),
+						    n > 0 ? K_NO_WAIT : sys_timepoint_timeout(end));
+			(void)k_mutex_lock(&ep->lock, K_FOREVER);
+		} else {
+			num_ready = 0;
+		}
+
+		for (int i = 0; i < num_ready; i++) {
+			entry = &ep->entries[ready[i]->tag];
+
+			/* skip entries removed or modified while waiting */
+			if (entry->fd < 0 || ready[i] < entry->pev ||
+			    ready[i] >= entry->pev + entry->num_pev) {
+				continue;
+			}
+
+			if (zvfs_epoll_report(ep, entry, &events[n])) {
+				n++;
+				if ((entry->event.events & ZVFS_EPOLLET) == 0 &&
+				    !sys_dnode_is_linked(&entry->node)) {
+					sys_dlist_append(&again, &entry->node);
+				}
+			}
+		}
+
+		while ((entry = zvfs_epoll_get(&again)) != NULL) {
+			sys_dlist_append(&ep->check, &entry->node);
+		}
+
+		if (num_ready < 0 || K_TIMEOUT_EQ(sys_timepoint_timeout(end), K_NO_WAIT)) {
+			break;
+		}
+	}
+
+	return n;
+}
+
+static int zvfs_epoll_close_op(void *obj)
+{
+	struct zvfs_epoll *ep = obj;
+	int err;
+
+	(void)k_mutex_lock(&epolls_lock, K_FOREVER);
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+	for (int i = 0; i < ARRAY_SIZE(ep->entries); i++) {
+		if (ep->entries[i].fd >= 0) {
+			zvfs_epoll_unregister(ep, &ep->entries[i]);
+			ep->entries[i].fd = -1;
+		}
+	}
+	k_mutex_unlock(&ep->lock);
+
+	err = sys_bitarray_free(&epolls_bitarray, 1, ep - epolls);
+	__ASSERT(err == 0, "sys_bitarray_free() failed: %d", err);
+
+	k_mutex_unlock(&epolls_lock);
+
+	return 0;
+}
+
+static int zvfs_epoll_ioctl_op(void *obj, unsigned int request, va_list args)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(request);
+	ARG_UNUSED(args);
+
+	errno = EOPNOTSUPP;
+	return -1;
+}
+
+static const struct fd_op_vtable zvfs_epoll_fd_vtable = {
+	.close = zvfs_epoll_close_op,
+	.ioctl = zvfs_epoll_ioctl_op,
+};
+
+/*
+ * Public-facing API
+ */
+
+int zvfs_epoll_create(int flags)
+{
+	struct zvfs_epoll *ep;
+	size_t offset;
+	int fd;
+
+	if (flags != 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&epolls_lock, K_FOREVER);
+
+	if (sys_bitarray_alloc(&epolls_bitarray, 1, &offset) < 0) {
+		k_mutex_unlock(&epolls_lock);
+		errno = ENOMEM;
+		return -1;
+	}
+
+	ep = &epolls[offset];
+
+	fd = zvfs_reserve_fd();
+	if (fd < 0) {
+		sys_bitarray_free(&epolls_bitarray, 1, offset);
+		k_mutex_unlock(&epolls_lock);
+		return -1;
+	}
+
+	k_poll_set_init(&ep->set);
+	k_mutex_init(&ep->lock);
+	sys_dlist_init(&ep->check);
+	ep->wait_seq = 0;
+	for (int i = 0; i < ARRAY_SIZE(ep->entries); i++) {
+		ep->entries[i].fd = -1;
+		ep->entries[i].num_pev = 0;
+		ep->entries[i].reported = 0;
+		sys_dnode_init(&ep->entries[i].node);
+	}
+
+	zvfs_finalize_fd(fd, ep, &zvfs_epoll_fd_vtable);
+
+	k_mutex_unlock(&epolls_lock);
+
+	return fd;
+}
+
+void zvfs_epoll_close_fd(int fd)
+{
+	struct zvfs_epoll_entry *entry;
+	int bit;
+
+	(void)k_mutex_lock(&epolls_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(epolls); i++) {
+		if (sys_bitarray_test_bit(&epolls_bitarray, i, &bit) < 0 || bit == 0) {
+			continue;
+		}
+
+		/* The poll events of the fd are linked into its object, they
+		 * have to be removed before the object goes away.
+		 */
+		(void)k_mutex_lock(&epolls[i].lock, K_FOREVER);
+		entry = zvfs_epoll_find(&epolls[i], fd);
+		if (entry != NULL) {
+			zvfs_epoll_unregister(&epolls[i], entry);
+			entry->fd = -1;
+		}
+		k_mutex_unlock(&epolls[i].lock);
+	}
+
+	k_mutex_unlock(&epolls_lock);
+}
+
+int zvfs_epoll_ctl(int epfd, int op, int fd, struct zvfs_epoll_event *event)
+{
+	struct zvfs_epoll *ep;
+	int ret;
+
+	ep = zvfs_get_fd_obj(epfd, &zvfs_epoll_fd_vtable, EBADF);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (fd < 0 || fd == epfd || (op != ZVFS_EPOLL_CTL_DEL && event == NULL)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+	ret = zvfs_epoll_ctl_locked(ep, op, fd, event);
+	k_mutex_unlock(&ep->lock);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents, int timeout)
+{
+	struct zvfs_epoll *ep;
+	int ret;
+
+	ep = zvfs_get_fd_obj(epfd, &zvfs_epoll_fd_vtable, EBADF);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (events == NULL || maxevents <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+	ret = zvfs_epoll_wait_locked(ep, events, maxevents,
+				     timeout < 0 ? K_FOREVER : K_MSEC(timeout));
+	k_mutex_unlock(&ep->lock);
+
+	return ret;
+}
@@ -6,77 +6,461 @@
 
 #include <errno.h>
 #include <signal.h>
+#include <stdio.h>
 
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
 #include <zephyr/posix/aio.h>
+#include <zephyr/posix/posix_features.h>
+
+/* prototypes for external, not-yet-public, functions in fdtable.c */
+ssize_t zvfs_read(int fd, void *buf, size_t sz, const size_t *from_offset);
+ssize_t zvfs_write(int fd, const void *buf, size_t sz, const size_t *from_offset);
+off_t zvfs_lseek(int fd, off_t offset, int whence);
+int zvfs_fsync(int fd);
+
+/* Operation of aio_fsync(), next to those of lio_listio() */
+#define AIO_OP_FSYNC (LIO_NOP + 1)
+
+struct aio_req {
+	struct k_work work;
+	/* Control block of the request, NULL when the request is free */
+	struct aiocb *cb;
+	int op;
+	/* Notification of a lio_listio() list, made by its last request */
+	bool lio_notify;
+	struct sigevent lio_sig;
+};
+
+static struct aio_req aio_reqs[CONFIG_POSIX_AIO_MAX];
+
+/* Protects aio_reqs and the status of the requests in progress */
+static K_MUTEX_DEFINE(aio_lock);
+/* Broadcast whenever a request completes */
+static K_CONDVAR_DEFINE(aio_cond);
+
+static struct k_work_q aio_workq;
+static K_THREAD_STACK_DEFINE(aio_workq_stack, CONFIG_POSIX_AIO_WORKQ_STACK_SIZE);
+
+static bool aio_sigevent_is_valid(const struct sigevent *sev)
+{
+	/* Signals are not delivered, only notifications by function call */
+	if (sev->sigev_notify == SIGEV_SIGNAL && sev->sigev_signo != 0) {
+		return false;
+	}
+
+	if (sev->sigev_notify == SIGEV_THREAD && sev->sigev_notify_function == NULL) {
+		return false;
+	}
+
+	return true;
+}
+
+static void aio_notify(const struct sigevent *sev)
+{
+	/* The function is called from the work queue rather than a new thread */
+	if (sev->sigev_notify == SIGEV_THREAD) {
+		sev->sigev_notify_function(sev->sigev_value);
+	}
+}
+
+static ssize_t aio_do(int op, struct aiocb *cb)
+{
+	void *buf = (void *)cb->aio_buf;
+	size_t offset = cb->aio_offset;
+	ssize_t ret;
+
+	if (op == AIO_OP_FSYNC) {
+		return zvfs_fsync(cb->aio_fildes);
+	}
+
+	if (op == LIO_READ) {
+		ret = zvfs_read(cb->aio_fildes, buf, cb->aio_nbytes, &offset);
+	} else {
+		ret = zvfs_write(cb->aio_fildes, buf, cb->aio_nbytes, &offset);
+	}
+
+	if (ret >= 0 || errno != ENOTSUP) {
+		return ret;
+	}
+
+	/* Without pread() and pwrite() for this kind of descriptor, seek to the
+	 * offset, which leaves the file offset unspecified as POSIX allows. The
+	 * offset is ignored for descriptors that cannot seek, such as sockets.
+	 */
+	(void)zvfs_lseek(cb->aio_fildes, cb->aio_offset, SEEK_SET);
+
+	if (op == LIO_READ) {
+		return zvfs_read(cb->aio_fildes, buf, cb->aio_nbytes, NULL);
+	}
+
+	return zvfs_write(cb->aio_fildes, buf, cb->aio_nbytes, NULL);
+}
+
+static void aio_work_handler(struct k_work *work)
+{
+	struct aio_req *req = CONTAINER_OF(work, struct aio_req, work);
+	struct aiocb *cb = req->cb;
+	struct sigevent sev = cb->aio_sigevent;
+	struct sigevent lio_sig = req->lio_sig;
+	bool lio_notify = req->lio_notify;
+	ssize_t ret;
+	int err;
+
+	ret = aio_do(req->op, cb);
+	err = (ret < 0) ? errno : 0;
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+	cb->_aio_return = ret;
+	cb->_aio_error = err;
+	req->cb = NULL;
+	(void)k_condvar_broadcast(&aio_cond);
+	k_mutex_unlock(&aio_lock);
+
+	/* The control block may be reused from now on, only use the copies */
+	aio_notify(&sev);
+	if (lio_notify) {
+		aio_notify(&lio_sig);
+	}
+}
+
+static int aio_check(const struct aiocb *cb, int op)
+{
+	if (cb == NULL || !aio_sigevent_is_valid(&cb->aio_sigevent)) {
+		return EINVAL;
+	}
+
+	if (op != AIO_OP_FSYNC && cb->aio_offset < 0) {
+		return EINVAL;
+	}
+
+	return 0;
+}
+
+static struct aio_req *aio_req_alloc(void)
+{
+	ARRAY_FOR_EACH_PTR(aio_reqs, req) {
+		if (req->cb == NULL) {
+			return req;
+		}
+	}
+
+	return NULL;
+}
+
+/* Queue a checked request, with aio_lock held */
+static int aio_submit(struct aiocb *cb, int op, const struct sigevent *lio_sig)
+{
+	struct aio_req *req = aio_req_alloc();
+
+	if (req == NULL) {
+		return EAGAIN;
+	}
+
+	req->cb = cb;
+	req->op = op;
+	req->lio_notify = lio_sig != NULL;
+	if (lio_sig != NULL) {
+		req->lio_sig = *lio_sig;
+	}
+
+	cb->_aio_error = EINPROGRESS;
+	cb->_aio_return = -1;
+
+	(void)k_work_submit_to_queue(&aio_workq, &req->work);
+
+	return 0;
+}
+
+static int aio_request(struct aiocb *cb, int op)
+{
+	int err;
+
+	err = aio_check(cb, op);
+	if (err == 0) {
+		(void)k_mutex_lock(&aio_lock, K_FOREVER);
+		err = aio_submit(cb, op, NULL);
+		k_mutex_unlock(&aio_lock);
+	}
+
+	if (err != 0) {
+		errno = err;
+		return -1;
+	}
+
+	return 0;
+}
 
 int aio_cancel(int fildes, struct aiocb *aiocbp)
 {
-	ARG_UNUSED(fildes);
-	ARG_UNUSED(aiocbp);
+	bool canceled = false;
+	bool not_canceled = false;
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+
+	ARRAY_FOR_EACH_PTR(aio_reqs, req) {
+		struct aiocb *cb = req->cb;
+
+		if (cb == NULL || cb->aio_fildes != fildes ||
+		    (aiocbp != NULL && cb != aiocbp)) {
+			continue;
+		}
+
+		/* Requests already being carried out cannot be canceled */
+		if (k_work_cancel(&req->work) != 0) {
+			not_canceled = true;
+			continue;
+		}
+
+		cb->_aio_error = ECANCELED;
+		cb->_aio_return = -1;
+		req->cb = NULL;
+		canceled = true;
 
-	errno = ENOSYS;
-	return -1;
+		aio_notify(&cb->aio_sigevent);
+		if (req->lio_notify) {
+			aio_notify(&req->lio_sig);
+		}
+	}
+
+	(void)k_condvar_broadcast(&aio_cond);
+	k_mutex_unlock(&aio_lock);
+
+	if (not_canceled) {
+		return AIO_NOTCANCELED;
+	}
+
+	return canceled ? AIO_CANCELED : AIO_ALLDONE;
 }
 
 int aio_error(const struct aiocb *aiocbp)
 {
-	ARG_UNUSED(aiocbp);
+	int err;
 
-	errno = ENOSYS;
-	return -1;
+	if (aiocbp == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+	err = aiocbp->_aio_error;
+	k_mutex_unlock(&aio_lock);
+
+	return err;
 }
 
-int aio_fsync(int fildes, struct aiocb *aiocbp)
+int aio_fsync(int op, struct aiocb *aiocbp)
 {
-	ARG_UNUSED(fildes);
-	ARG_UNUSED(aiocbp);
+	/* O_SYNC and O_DSYNC are both carried out as fsync(), and not all C
+	 * libraries define them, so op is not checked.
+	 */
+	ARG_UNUSED(op);
 
-	errno = ENOSYS;
-	return -1;
+	return aio_request(aiocbp, AIO_OP_FSYNC);
 }
 
 int aio_read(struct aiocb *aiocbp)
 {
-	ARG_UNUSED(aiocbp);
-
-	errno = ENOSYS;
-	return -1;
+	return aio_request(aiocbp, LIO_READ);
 }
 
 ssize_t aio_return(struct aiocb *aiocbp)
 {
-	ARG_UNUSED(aiocbp);
+	ssize_t ret;
 
-	errno = ENOSYS;
-	return -1;
+	if (aiocbp == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+	if (aiocbp->_aio_error == EINPROGRESS) {
+		/* Not completed yet */
+		errno = EINVAL;
+		ret = -1;
+	} else {
+		ret = aiocbp->_aio_return;
+	}
+	k_mutex_unlock(&aio_lock);
+
+	return ret;
+}
+
+static bool aio_any_done(const struct aiocb *const list[], int nent)
+{
+	for (int i = 0; i < nent; i++) {
+		if (list[i] != NULL && list[i]->_aio_error != EINPROGRESS) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool aio_all_done(struct aiocb *const list[], int nent)
+{
+	for (int i = 0; i < nent; i++) {
+		if (list[i] != NULL && list[i]->aio_lio_opcode != LIO_NOP &&
+		    list[i]->_aio_error == EINPROGRESS) {
+			return false;
+		}
+	}
+
+	return true;
 }
 
 int aio_suspend(const struct aiocb *const list[], int nent, const struct timespec *timeout)
 {
-	ARG_UNUSED(list);
-	ARG_UNUSED(nent);
-	ARG_UNUSED(timeout);
+	k_timepoint_t end;
+
+	if (list == NULL || nent < 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (timeout == NULL) {
+		end = sys_timepoint_calc(K_FOREVER);
+	} else if (timeout->tv_sec < 0 || timeout->tv_nsec < 0 ||
+		   timeout->tv_nsec >= NSEC_PER_SEC) {
+		errno = EINVAL;
+		return -1;
+	} else {
+		end = sys_timepoint_calc(K_NSEC((uint64_t)timeout->tv_sec * NSEC_PER_SEC +
+						timeout->tv_nsec));
+	}
 
-	errno = ENOSYS;
-	return -1;
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+	while (!aio_any_done(list, nent)) {
+		if (k_condvar_wait(&aio_cond, &aio_lock, sys_timepoint_timeout(end)) != 0 &&
+		    !aio_any_done(list, nent)) {
+			k_mutex_unlock(&aio_lock);
+			errno = EAGAIN;
+			return -1;
+		}
+	}
+	k_mutex_unlock(&aio_lock);
+
+	return 0;
 }
 
 int aio_write(struct aiocb *aiocbp)
 {
-	ARG_UNUSED(aiocbp);
+	return aio_request(aiocbp, LIO_WRITE);
+}
 
-	errno = ENOSYS;
-	return -1;
+static bool lio_entry_is_valid(const struct aiocb *cb)
+{
+	return (cb->aio_lio_opcode == LIO_READ || cb->aio_lio_opcode == LIO_WRITE) &&
+	       aio_check(cb, cb->aio_lio_opcode) == 0;
 }
 
 int lio_listio(int mode, struct aiocb *const ZRESTRICT list[], int nent,
 	       struct sigevent *ZRESTRICT sig)
 {
-	ARG_UNUSED(mode);
-	ARG_UNUSED(list);
-	ARG_UNUSED(nent);
-	ARG_UNUSED(sig);
+	const struct sigevent *lio_sig = NULL;
+	bool failed = false;
+	int last = -1;
+	int count = 0;
+	int free_count = 0;
+
+	if ((mode != LIO_WAIT && mode != LIO_NOWAIT) || list == NULL || nent < 0 ||
+	    nent > AIO_LISTIO_MAX) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (mode == LIO_NOWAIT && sig != NULL) {
+		if (!aio_sigevent_is_valid(sig)) {
+			errno = EINVAL;
+			return -1;
+		}
+
+		lio_sig = sig;
+	}
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+
+	for (int i = 0; i < nent; i++) {
+		if (list[i] == NULL || list[i]->aio_lio_opcode == LIO_NOP) {
+			continue;
+		}
+
+		if (!lio_entry_is_valid(list[i])) {
+			list[i]->_aio_error = EINVAL;
+			list[i]->_aio_return = -1;
+			failed = true;
+			continue;
+		}
+
+		count++;
+		last = i;
+	}
+
+	ARRAY_FOR_EACH_PTR(aio_reqs, req) {
+		if (req->cb == NULL) {
+			free_count++;
+		}
+	}
+
+	/* Either the whole list is queued or none of it */
+	if (free_count < count) {
+		k_mutex_unlock(&aio_lock);
+		errno = EAGAIN;
+		return -1;
+	}
+
+	/* Requests are carried out in order, so the last one completes last and
+	 * makes the notification of the whole list.
+	 */
+	for (int i = 0; i <= last; i++) {
+		if (list[i] == NULL || list[i]->aio_lio_opcode == LIO_NOP ||
+		    !lio_entry_is_valid(list[i])) {
+			continue;
+		}
+
+		(void)aio_submit(list[i], list[i]->aio_lio_opcode, i == last ? lio_sig : NULL);
+	}
+
+	if (last < 0 && lio_sig != NULL) {
+		aio_notify(lio_sig);
+	}
+
+	if (mode == LIO_WAIT) {
+		while (!aio_all_done(list, nent)) {
+			(void)k_condvar_wait(&aio_cond, &aio_lock, K_FOREVER);
+		}
+
+		for (int i = 0; i < nent; i++) {
+			if (list[i] != NULL && list[i]->aio_lio_opcode != LIO_NOP &&
+			    list[i]->_aio_error != 0) {
+				failed = true;
+			}
+		}
+	}
+
+	k_mutex_unlock(&aio_lock);
+
+	if (failed) {
+		errno = EIO;
+		return -1;
+	}
+
+	return 0;
+}
+
+static int aio_init(void)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "aio_workq",
+	};
+
+	ARRAY_FOR_EACH_PTR(aio_reqs, req) {
+		k_work_init(&req->work, aio_work_handler);
+	}
+
+	k_work_queue_start(&aio_workq, aio_workq_stack, K_THREAD_STACK_SIZEOF(aio_workq_stack),
+			   CONFIG_POSIX_AIO_WORKQ_PRIORITY, &cfg);
 
-	errno = ENOSYS;
-	return -1;
+	return 0;
 }
+SYS_INIT(aio_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
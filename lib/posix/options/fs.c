@@ -14,6 +14,10 @@
 #include <zephyr/posix/sys/stat.h>
 #include <zephyr/posix/fcntl.h>
 #include <zephyr/fs/fs.h>
+#include <zephyr/kernel/mm.h>
+#include <zephyr/posix/sys/mman.h>
+
+#define _page_size COND_CODE_1(CONFIG_MMU, (CONFIG_MMU_PAGE_SIZE), (PAGE_SIZE))
 
 int zvfs_fstat(int fd, struct stat *buf);
 
@@ -136,6 +140,52 @@ static int fs_close_vmeth(void *obj)
 	return rc;
 }
 
+/*
+ * Files are mapped as a private copy in anonymous memory, which with demand
+ * paging can be paged out to the backing store like any other anonymous
+ * memory. Changes to the mapping are not written back to the file.
+ */
+static int fs_mmap(struct posix_fs_desc *ptr, size_t len, int prot, int flags, off_t off,
+		   void **virt)
+{
+	size_t size = ROUND_UP(len, _page_size);
+	off_t pos;
+	ssize_t rc;
+	void *mem;
+
+	if ((len == 0) || (off < 0) || ((flags & MAP_FIXED) != 0) ||
+	    ((off & (_page_size - 1)) != 0)) {
+		return -EINVAL;
+	}
+
+	if (!IS_ENABLED(CONFIG_MMU) || ptr->is_dir ||
+	    (((flags & MAP_SHARED) != 0) && ((prot & PROT_WRITE) != 0))) {
+		return -ENOTSUP;
+	}
+
+	/* The pages are zero filled, which covers the part past the end of file */
+	mem = k_mem_map(size, K_MEM_PERM_RW);
+	if (mem == NULL) {
+		return -ENOMEM;
+	}
+
+	pos = fs_tell(&ptr->file);
+	rc = (pos < 0) ? pos : fs_seek(&ptr->file, off, FS_SEEK_SET);
+	if (rc == 0) {
+		rc = fs_read(&ptr->file, mem, len);
+		(void)fs_seek(&ptr->file, pos, FS_SEEK_SET);
+	}
+
+	if (rc < 0) {
+		k_mem_unmap(mem, size);
+		return rc;
+	}
+
+	*virt = mem;
+
+	return 0;
+}
+
 static int fs_ioctl_vmeth(void *obj, unsigned int request, va_list args)
 {
 	int rc = 0;
@@ -171,6 +221,24 @@ static int fs_ioctl_vmeth(void *obj, unsigned int request, va_list args)
 		}
 		break;
 	}
+	case ZFD_IOCTL_MMAP: {
+		void *addr = va_arg(args, void *);
+		size_t len = va_arg(args, size_t);
+		int prot = va_arg(args, int);
+		int flags = va_arg(args, int);
+		off_t off = va_arg(args, off_t);
+		void **maddr = va_arg(args, void **);
+
+		ARG_UNUSED(addr);
+
+		if (!IS_ENABLED(CONFIG_POSIX_MAPPED_FILES)) {
+			errno = EOPNOTSUPP;
+			return -1;
+		}
+
+		rc = fs_mmap(ptr, len, prot, flags, off, maddr);
+		break;
+	}
 	default:
 		errno = EOPNOTSUPP;
 		return -1;
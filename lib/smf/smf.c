@@ -402,3 +402,85 @@ int32_t smf_run_state(struct smf_ctx *const ctx)
 #endif
 	return 0;
 }
+
+#ifdef CONFIG_SMF_EVENTS
+void smf_set_event_queue(struct smf_ctx *ctx, struct k_msgq *queue)
+{
+	ctx->event_queue = queue;
+}
+
+int smf_post_event(struct smf_ctx *ctx, uint32_t id, void *data)
+{
+	const struct smf_event event = {
+		.id = id,
+		.data = data,
+	};
+
+	if (ctx->event_queue == NULL) {
+		return -EINVAL;
+	}
+
+	return k_msgq_put(ctx->event_queue, &event, K_NO_WAIT);
+}
+
+int32_t smf_dispatch_event(struct smf_ctx *const ctx, const struct smf_event *event)
+{
+	struct internal_ctx *const internal = (void *)&ctx->internal;
+	const struct smf_state *state = ctx->current;
+
+	/* No need to continue if terminate was set */
+	if (internal->terminate) {
+		return ctx->terminate_val;
+	}
+
+	/* Look up the handler in the current state, then in its ancestors */
+	while (state != NULL) {
+		if (event->id < state->num_events && state->events[event->id] != NULL) {
+			break;
+		}
+#ifdef CONFIG_SMF_ANCESTOR_SUPPORT
+		state = state->parent;
+#else
+		state = NULL;
+#endif
+	}
+
+	if (state == NULL) {
+		LOG_DBG("Event %u not handled", event->id);
+		return 0;
+	}
+
+#ifdef CONFIG_SMF_ANCESTOR_SUPPORT
+	/* Keep track of the handling state in case it calls smf_set_state() */
+	ctx->executing = state;
+#endif
+	state->events[event->id](ctx, event);
+
+	internal->new_state = false;
+	internal->handled = false;
+
+	return internal->terminate ? ctx->terminate_val : 0;
+}
+
+int32_t smf_run_events(struct smf_ctx *const ctx, k_timeout_t timeout)
+{
+	struct smf_event event;
+	int32_t ret;
+
+	if (ctx->event_queue == NULL) {
+		return 0;
+	}
+
+	while (k_msgq_get(ctx->event_queue, &event, timeout) == 0) {
+		ret = smf_dispatch_event(ctx, &event);
+		if (ret != 0) {
+			return ret;
+		}
+
+		/* Only wait for the first event */
+		timeout = K_NO_WAIT;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_SMF_EVENTS */
@@ -157,6 +157,134 @@ mismatch:
 	return false;
 }
 
+#if defined(CONFIG_SYS_BITARRAY_SUMMARY)
+/* Refresh the full bundle summary of bundles sidx to eidx (inclusive). */
+static void update_summary(sys_bitarray_t *bitarray, size_t sidx, size_t eidx)
+{
+	size_t idx;
+
+	if (bitarray->full == NULL) {
+		return;
+	}
+
+	for (idx = sidx; idx <= eidx; idx++) {
+		WRITE_BIT(bitarray->full[idx / 32U], idx % 32U,
+			  bitarray->bundles[idx] == ~0U);
+	}
+}
+#else
+static inline void update_summary(sys_bitarray_t *bitarray, size_t sidx, size_t eidx)
+{
+	ARG_UNUSED(bitarray);
+	ARG_UNUSED(sidx);
+	ARG_UNUSED(eidx);
+}
+#endif
+
+/*
+ * Find the first bundle at or after idx which is not all set.
+ *
+ * @retval           Index of the bundle, num_bundles if there is none.
+ */
+static size_t find_non_full_bundle(sys_bitarray_t *bitarray, size_t idx)
+{
+#if defined(CONFIG_SYS_BITARRAY_SUMMARY)
+	uint32_t word;
+
+	if (bitarray->full != NULL) {
+		while (idx < bitarray->num_bundles) {
+			/* Bits past the last bundle are never set */
+			word = ~bitarray->full[idx / 32U] & ~(BIT(idx % 32U) - 1U);
+			if (word != 0U) {
+				idx = ROUND_DOWN(idx, 32U) + find_lsb_set(word) - 1U;
+				return MIN(idx, bitarray->num_bundles);
+			}
+
+			idx = ROUND_DOWN(idx, 32U) + 32U;
+		}
+
+		return bitarray->num_bundles;
+	}
+#endif
+
+	while ((idx < bitarray->num_bundles) && (bitarray->bundles[idx] == ~0U)) {
+		idx++;
+	}
+
+	return idx;
+}
+
+/*
+ * Find the first cleared bit at or after a bit.
+ *
+ * @retval           Offset of the cleared bit, num_bits if there is none.
+ */
+static size_t find_next_clear(sys_bitarray_t *bitarray, size_t bit)
+{
+	size_t idx = bit / bundle_bitness(bitarray);
+	uint32_t bundle;
+
+	if (bit >= bitarray->num_bits) {
+		return bitarray->num_bits;
+	}
+
+	/* Pretend the bits before ours are set */
+	bundle = bitarray->bundles[idx] | (BIT(bit % bundle_bitness(bitarray)) - 1U);
+	if (bundle == ~0U) {
+		idx = find_non_full_bundle(bitarray, idx + 1);
+		if (idx == bitarray->num_bundles) {
+			return bitarray->num_bits;
+		}
+
+		bundle = bitarray->bundles[idx];
+	}
+
+	bit = idx * bundle_bitness(bitarray) + find_lsb_set(~bundle) - 1;
+
+	return MIN(bit, bitarray->num_bits);
+}
+
+/*
+ * Find the last set bit in a region, looking at whole bundles from the
+ * end of the region.
+ *
+ * @param[out] last  Offset of the last set bit.
+ *
+ * @retval     true  If a bit is set in the region
+ * @retval     false If the region is all cleared
+ */
+static bool find_last_set_bit(sys_bitarray_t *bitarray, size_t offset,
+			  size_t num_bits, size_t *last)
+{
+	struct bundle_data bd;
+	uint32_t bundle;
+	uint32_t mask;
+	size_t idx;
+
+	setup_bundle_data(bitarray, &bd, offset, num_bits);
+
+	idx = bd.eidx;
+	mask = bd.emask;
+	for (;;) {
+		if (idx == bd.sidx) {
+			mask &= bd.smask;
+		}
+
+		bundle = bitarray->bundles[idx] & mask;
+		if (bundle != 0U) {
+			*last = idx * bundle_bitness(bitarray) + find_msb_set(bundle) - 1;
+			return true;
+		}
+
+		if (idx == bd.sidx) {
+			return false;
+		}
+
+		idx--;
+		mask = ~0U;
+	}
+}
+
 /*
  * Set or clear a region of bits.
  *
@@ -208,6 +336,8 @@ static void set_region(sys_bitarray_t *bitarray, size_t offset,
 			}
 		}
 	}
+
+	update_summary(bitarray, bd->sidx, bd->eidx);
 }
 
 int sys_bitarray_popcount_region(sys_bitarray_t *bitarray, size_t num_bits, size_t offset,
@@ -309,6 +439,7 @@ int sys_bitarray_xor(sys_bitarray_t *dst, sys_bitarray_t *other, size_t num_bits
 		}
 	}
 
+	update_summary(dst, bd.sidx, bd.eidx);
 	ret = 0;
 
 out:
@@ -337,6 +468,7 @@ int sys_bitarray_set_bit(sys_bitarray_t *bitarray, size_t bit)
 	off = bit % bundle_bitness(bitarray);
 
 	bitarray->bundles[idx] |= BIT(off);
+	update_summary(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -365,6 +497,7 @@ int sys_bitarray_clear_bit(sys_bitarray_t *bitarray, size_t bit)
 	off = bit % bundle_bitness(bitarray);
 
 	bitarray->bundles[idx] &= ~BIT(off);
+	update_summary(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -441,6 +574,7 @@ int sys_bitarray_test_and_set_bit(sys_bitarray_t *bitarray, size_t bit, int *pre
 	}
 
 	bitarray->bundles[idx] |= BIT(off);
+	update_summary(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -480,6 +614,7 @@ int sys_bitarray_test_and_clear_bit(sys_bitarray_t *bitarray, size_t bit, int *p
 	}
 
 	bitarray->bundles[idx] &= ~BIT(off);
+	update_summary(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -492,11 +627,10 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 		       size_t *offset)
 {
 	k_spinlock_key_t key;
-	uint32_t bit_idx;
+	size_t bit_idx;
 	int ret;
-	struct bundle_data bd;
-	size_t off_start, off_end;
-	size_t mismatch;
+	size_t off_end;
+	size_t last;
 
 	__ASSERT_NO_MSG(bitarray != NULL);
 	__ASSERT_NO_MSG(bitarray->num_bits > 0);
@@ -513,46 +647,24 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 		goto out;
 	}
 
-	bit_idx = 0;
-
-	/* Find the first non-allocated bit by looking at bundles
-	 * instead of individual bits.
-	 *
-	 * On RISC-V 64-bit, it complains about undefined reference to `ffs`.
-	 * So don't use this on RISCV64.
+	/* Candidate regions start at a cleared bit. Whenever one contains
+	 * allocated bits, the next one starts at the first cleared bit after
+	 * the last of them, as no region starting before it can fit. Both
+	 * searches look at whole bundles, skipping full ones.
 	 */
-	for (size_t idx = 0; idx < bitarray->num_bundles; idx++) {
-		if (~bitarray->bundles[idx] == 0U) {
-			/* bundle is all 1s => all allocated, skip */
-			bit_idx += bundle_bitness(bitarray);
-			continue;
-		}
-
-		if (bitarray->bundles[idx] != 0U) {
-			/* Find the first free bit in bundle if not all free */
-			off_start = find_lsb_set(~bitarray->bundles[idx]) - 1;
-			bit_idx += off_start;
-		}
-
-		break;
-	}
-
 	off_end = bitarray->num_bits - num_bits;
 	ret = -ENOSPC;
+	bit_idx = find_next_clear(bitarray, 0);
 	while (bit_idx <= off_end) {
-		if (match_region(bitarray, bit_idx, num_bits, false,
-				 &bd, &mismatch)) {
-			set_region(bitarray, bit_idx, num_bits, true, &bd);
+		if (!find_last_set_bit(bitarray, bit_idx, num_bits, &last)) {
+			set_region(bitarray, bit_idx, num_bits, true, NULL);
 
 			*offset = bit_idx;
 			ret = 0;
 			break;
 		}
 
-		/* Fast-forward to the bit just after
-		 * the mismatched bit.
-		 */
-		bit_idx = mismatch + 1;
+		bit_idx = find_next_clear(bitarray, last + 1);
 	}
 
 out:
@@ -566,6 +678,7 @@ int sys_bitarray_find_nth_set(sys_bitarray_t *bitarray, size_t n, size_t num_bit
 	k_spinlock_key_t key;
 	size_t count, idx;
 	uint32_t mask;
+	uint32_t bundle;
 	struct bundle_data bd;
 	int ret;
 
@@ -620,16 +733,15 @@ found:
 	/* The bit we are looking for must be in the current bundle idx.
 	 * Find out the exact index of the bit.
 	 */
-	for (int j = 0; j <= bundle_bitness(bitarray) - 1; j++) {
-		if (bitarray->bundles[idx] & mask & BIT(j)) {
-			if (--n <= 0) {
-				*found_at = idx * bundle_bitness(bitarray) + j;
-				ret = 0;
-				break;
-			}
-		}
+	bundle = bitarray->bundles[idx] & mask;
+	while (--n > 0) {
+		/* Clear the lowest set bit */
+		bundle &= bundle - 1U;
 	}
 
+	*found_at = idx * bundle_bitness(bitarray) + find_lsb_set(bundle) - 1;
+	ret = 0;
+
 out:
 	k_spin_unlock(&bitarray->lock, key);
 	return ret;
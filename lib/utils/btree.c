@@ -0,0 +1,474 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/btree.h>
+
+/*
+ * Inner nodes: ptrs[0..count] are the children, keys[i] is not greater
+ * than any key of the subtree ptrs[i + 1], and greater than every key of
+ * the subtrees on its left.
+ *
+ * Leaves: ptrs[i] is the value of keys[i], ptrs[ORDER] links to the next
+ * leaf.
+ */
+#define ORDER    SYS_BTREE_ORDER
+#define MIN_KEYS (ORDER / 2)
+#define NEXT     ORDER
+
+BUILD_ASSERT(ORDER >= 3, "CONFIG_SYS_BTREE_NODE_SIZE too small");
+BUILD_ASSERT(ORDER <= UINT16_MAX);
+
+struct split {
+	sys_btree_key_t key;
+	struct sys_btree_node *right;
+};
+
+/* First key not less than key */
+static size_t lower_bound(const struct sys_btree_node *n, sys_btree_key_t key)
+{
+	size_t lo = 0, hi = n->count;
+
+	while (lo < hi) {
+		size_t mid = (lo + hi) / 2;
+
+		if (n->keys[mid] < key) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+/* Child of an inner node which may hold key */
+static size_t child_index(const struct sys_btree_node *n, sys_btree_key_t key)
+{
+	size_t lo = 0, hi = n->count;
+
+	while (lo < hi) {
+		size_t mid = (lo + hi) / 2;
+
+		if (n->keys[mid] <= key) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+static struct sys_btree_node *node_alloc(struct sys_btree *tree, bool leaf)
+{
+	struct sys_btree_node *n;
+	int ret;
+
+	/* Cannot fail, sys_btree_insert() checked the free node count */
+	ret = k_mem_slab_alloc(tree->slab, (void **)&n, K_NO_WAIT);
+	__ASSERT_NO_MSG(ret == 0);
+	ARG_UNUSED(ret);
+
+	n->count = 0;
+	n->leaf = leaf;
+	n->ptrs[NEXT] = NULL;
+
+	return n;
+}
+
+static void node_free(struct sys_btree *tree, struct sys_btree_node *n)
+{
+	k_mem_slab_free(tree->slab, n);
+}
+
+/*
+ * Insert key at index i and ptr at index i + off: off is 0 for the
+ * values of a leaf, 1 for the right child of a key in an inner node.
+ */
+static void node_insert(struct sys_btree_node *n, size_t i, sys_btree_key_t key, void *ptr,
+			size_t off)
+{
+	size_t moved = n->count - i;
+
+	memmove(&n->keys[i + 1], &n->keys[i], moved * sizeof(n->keys[0]));
+	memmove(&n->ptrs[i + off + 1], &n->ptrs[i + off], moved * sizeof(n->ptrs[0]));
+	n->keys[i] = key;
+	n->ptrs[i + off] = ptr;
+	n->count++;
+}
+
+/* Remove key i and ptr i + off, see node_insert() */
+static void node_remove(struct sys_btree_node *n, size_t i, size_t off)
+{
+	size_t moved = n->count - i - 1;
+
+	memmove(&n->keys[i], &n->keys[i + 1], moved * sizeof(n->keys[0]));
+	memmove(&n->ptrs[i + off], &n->ptrs[i + off + 1], moved * sizeof(n->ptrs[0]));
+	n->count--;
+}
+
+static void leaf_split(struct sys_btree *tree, struct sys_btree_node *n, size_t i,
+		       sys_btree_key_t key, void *val, struct split *split)
+{
+	struct sys_btree_node *right = node_alloc(tree, true);
+	size_t mid = (ORDER + 1) / 2;
+
+	right->count = ORDER - mid;
+	memcpy(right->keys, &n->keys[mid], right->count * sizeof(n->keys[0]));
+	memcpy(right->ptrs, &n->ptrs[mid], right->count * sizeof(n->ptrs[0]));
+	right->ptrs[NEXT] = n->ptrs[NEXT];
+	n->ptrs[NEXT] = right;
+	n->count = mid;
+
+	if (i < mid) {
+		node_insert(n, i, key, val, 0);
+	} else {
+		node_insert(right, i - mid, key, val, 0);
+	}
+
+	split->key = right->keys[0];
+	split->right = right;
+}
+
+/*
+ * Split a full inner node receiving key at i and child at i + 1. The
+ * ORDER + 1 keys are seen in their final order, the median one moves up.
+ */
+static void inner_split(struct sys_btree *tree, struct sys_btree_node *n, size_t i,
+			sys_btree_key_t key, struct sys_btree_node *child, struct split *split)
+{
+	struct sys_btree_node *right = node_alloc(tree, false);
+	size_t mid = ORDER / 2;
+
+	for (size_t j = mid + 1; j <= ORDER; j++) {
+		right->keys[j - mid - 1] = (j < i) ? n->keys[j] : (j == i) ? key : n->keys[j - 1];
+	}
+	for (size_t j = mid + 1; j <= ORDER + 1; j++) {
+		right->ptrs[j - mid - 1] = (j <= i) ? n->ptrs[j]
+				       : (j == i + 1) ? (void *)child : n->ptrs[j - 1];
+	}
+	right->count = ORDER - mid;
+
+	split->key = (mid < i) ? n->keys[mid] : (mid == i) ? key : n->keys[mid - 1];
+	split->right = right;
+
+	if (i < mid) {
+		n->count = mid - 1;
+		node_insert(n, i, key, child, 1);
+	} else {
+		n->count = mid;
+	}
+}
+
+static int insert_rec(struct sys_btree *tree, struct sys_btree_node *n, sys_btree_key_t key,
+		      void *val, struct split *split)
+{
+	struct split sub = { 0 };
+	size_t i;
+	int ret;
+
+	if (n->leaf) {
+		i = lower_bound(n, key);
+		if ((i < n->count) && (n->keys[i] == key)) {
+			return -EEXIST;
+		}
+
+		if (n->count < ORDER) {
+			node_insert(n, i, key, val, 0);
+		} else {
+			leaf_split(tree, n, i, key, val, split);
+		}
+
+		return 0;
+	}
+
+	i = child_index(n, key);
+	ret = insert_rec(tree, n->ptrs[i], key, val, &sub);
+	if ((ret < 0) || (sub.right == NULL)) {
+		return ret;
+	}
+
+	if (n->count < ORDER) {
+		node_insert(n, i, sub.key, sub.right, 1);
+	} else {
+		inner_split(tree, n, i, sub.key, sub.right, split);
+	}
+
+	return 0;
+}
+
+void sys_btree_init(struct sys_btree *tree, struct k_mem_slab *slab)
+{
+	__ASSERT(slab->info.block_size >= sizeof(struct sys_btree_node),
+		 "slab blocks too small for the B+tree nodes");
+
+	tree->root = NULL;
+	tree->slab = slab;
+	tree->size = 0;
+	tree->height = 0;
+}
+
+int sys_btree_insert(struct sys_btree *tree, sys_btree_key_t key, void *val)
+{
+	struct split split = { 0 };
+	struct sys_btree_node *root;
+	int ret;
+
+	/* A split may go up to a new root: check all the nodes are there */
+	if (k_mem_slab_num_free_get(tree->slab) < (uint32_t)tree->height + 1U) {
+		return -ENOMEM;
+	}
+
+	if (tree->root == NULL) {
+		tree->root = node_alloc(tree, true);
+		tree->height = 1;
+	}
+
+	ret = insert_rec(tree, tree->root, key, val, &split);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (split.right != NULL) {
+		root = node_alloc(tree, false);
+		root->count = 1;
+		root->keys[0] = split.key;
+		root->ptrs[0] = tree->root;
+		root->ptrs[1] = split.right;
+		tree->root = root;
+		tree->height++;
+	}
+
+	tree->size++;
+
+	return 0;
+}
+
+void *sys_btree_get(const struct sys_btree *tree, sys_btree_key_t key)
+{
+	const struct sys_btree_node *n = tree->root;
+	size_t i;
+
+	if (n == NULL) {
+		return NULL;
+	}
+
+	while (!n->leaf) {
+		n = n->ptrs[child_index(n, key)];
+	}
+
+	i = lower_bound(n, key);
+
+	return ((i < n->count) && (n->keys[i] == key)) ? n->ptrs[i] : NULL;
+}
+
+/* Refill child i of n, which is one key short, from a sibling */
+static void rebalance(struct sys_btree *tree, struct sys_btree_node *n, size_t i)
+{
+	struct sys_btree_node *child = n->ptrs[i];
+	struct sys_btree_node *left = (i > 0) ? n->ptrs[i - 1] : NULL;
+	struct sys_btree_node *right = (i < n->count) ? n->ptrs[i + 1] : NULL;
+
+	if ((left != NULL) && (left->count > MIN_KEYS)) {
+		if (child->leaf) {
+			node_insert(child, 0, left->keys[left->count - 1],
+				    left->ptrs[left->count - 1], 0);
+			n->keys[i - 1] = child->keys[0];
+		} else {
+			memmove(&child->keys[1], &child->keys[0],
+				child->count * sizeof(child->keys[0]));
+			memmove(&child->ptrs[1], &child->ptrs[0],
+				(child->count + 1) * sizeof(child->ptrs[0]));
+			child->keys[0] = n->keys[i - 1];
+			child->ptrs[0] = left->ptrs[left->count];
+			child->count++;
+			n->keys[i - 1] = left->keys[left->count - 1];
+		}
+		left->count--;
+		return;
+	}
+
+	if ((right != NULL) && (right->count > MIN_KEYS)) {
+		if (child->leaf) {
+			child->keys[child->count] = right->keys[0];
+			child->ptrs[child->count] = right->ptrs[0];
+			child->count++;
+			node_remove(right, 0, 0);
+			n->keys[i] = right->keys[0];
+		} else {
+			child->keys[child->count] = n->keys[i];
+			child->ptrs[child->count + 1] = right->ptrs[0];
+			child->count++;
+			n->keys[i] = right->keys[0];
+			memmove(&right->keys[0], &right->keys[1],
+				(right->count - 1) * sizeof(right->keys[0]));
+			memmove(&right->ptrs[0], &right->ptrs[1],
+				right->count * sizeof(right->ptrs[0]));
+			right->count--;
+		}
+		return;
+	}
+
+	/* Both siblings are minimal: merge the child with one of them */
+	if (left != NULL) {
+		right = child;
+		i--;
+	} else {
+		left = child;
+	}
+
+	if (left->leaf) {
+		memcpy(&left->keys[left->count], right->keys, right->count * sizeof(right->keys[0]));
+		memcpy(&left->ptrs[left->count], right->ptrs, right->count * sizeof(right->ptrs[0]));
+		left->count += right->count;
+		left->ptrs[NEXT] = right->ptrs[NEXT];
+	} else {
+		left->keys[left->count] = n->keys[i];
+		memcpy(&left->keys[left->count + 1], right->keys,
+		       right->count * sizeof(right->keys[0]));
+		memcpy(&left->ptrs[left->count + 1], right->ptrs,
+		       (right->count + 1) * sizeof(right->ptrs[0]));
+		left->count += right->count + 1;
+	}
+
+	node_remove(n, i, 1);
+	node_free(tree, right);
+}
+
+static bool remove_rec(struct sys_btree *tree, struct sys_btree_node *n, sys_btree_key_t key,
+		       void **val)
+{
+	size_t i;
+
+	if (n->leaf) {
+		i = lower_bound(n, key);
+		if ((i >= n->count) || (n->keys[i] != key)) {
+			return false;
+		}
+
+		*val = n->ptrs[i];
+		node_remove(n, i, 0);
+
+		return true;
+	}
+
+	i = child_index(n, key);
+	if (!remove_rec(tree, n->ptrs[i], key, val)) {
+		return false;
+	}
+
+	if (((struct sys_btree_node *)n->ptrs[i])->count < MIN_KEYS) {
+		rebalance(tree, n, i);
+	}
+
+	return true;
+}
+
+void *sys_btree_remove(struct sys_btree *tree, sys_btree_key_t key)
+{
+	struct sys_btree_node *root = tree->root;
+	void *val = NULL;
+
+	if ((root == NULL) || !remove_rec(tree, root, key, &val)) {
+		return NULL;
+	}
+
+	tree->size--;
+
+	if (root->count == 0) {
+		tree->root = root->leaf ? NULL : root->ptrs[0];
+		tree->height--;
+		node_free(tree, root);
+	}
+
+	return val;
+}
+
+static void clear_rec(struct sys_btree *tree, struct sys_btree_node *n)
+{
+	if (!n->leaf) {
+		for (size_t i = 0; i <= n->count; i++) {
+			clear_rec(tree, n->ptrs[i]);
+		}
+	}
+
+	node_free(tree, n);
+}
+
+void sys_btree_clear(struct sys_btree *tree)
+{
+	if (tree->root != NULL) {
+		clear_rec(tree, tree->root);
+	}
+
+	tree->root = NULL;
+	tree->size = 0;
+	tree->height = 0;
+}
+
+void sys_btree_iter_seek(const struct sys_btree *tree, sys_btree_key_t key,
+			 struct sys_btree_iter *iter)
+{
+	struct sys_btree_node *n = tree->root;
+
+	iter->leaf = NULL;
+	iter->idx = 0;
+
+	if (n == NULL) {
+		return;
+	}
+
+	while (!n->leaf) {
+		n = n->ptrs[child_index(n, key)];
+	}
+
+	iter->leaf = n;
+	iter->idx = lower_bound(n, key);
+}
+
+bool sys_btree_iter_next(struct sys_btree_iter *iter, sys_btree_key_t *key, void **val)
+{
+	while ((iter->leaf != NULL) && (iter->idx >= iter->leaf->count)) {
+		iter->leaf = iter->leaf->ptrs[NEXT];
+		iter->idx = 0;
+	}
+
+	if (iter->leaf == NULL) {
+		return false;
+	}
+
+	*key = iter->leaf->keys[iter->idx];
+	if (val != NULL) {
+		*val = iter->leaf->ptrs[iter->idx];
+	}
+	iter->idx++;
+
+	return true;
+}
+
+bool sys_btree_max(const struct sys_btree *tree, sys_btree_key_t *key, void **val)
+{
+	const struct sys_btree_node *n = tree->root;
+
+	if (n == NULL) {
+		return false;
+	}
+
+	while (!n->leaf) {
+		n = n->ptrs[n->count];
+	}
+
+	*key = n->keys[n->count - 1];
+	if (val != NULL) {
+		*val = n->ptrs[n->count - 1];
+	}
+
+	return true;
+}
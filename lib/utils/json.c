@@ -89,12 +89,58 @@ static int peek(struct json_lexer *lex)
 	return chr;
 }
 
+/* Word at a time scanning, with the haszero() trick of "Bit Twiddling Hacks" */
+#define WORD_ONES  ((unsigned long)-1 / 0xFFU)
+#define WORD_HIGHS (WORD_ONES << 7)
+#define WORD_HAS_ZERO(w) (((w) - WORD_ONES) & ~(w) & WORD_HIGHS)
+#define WORD_HAS_BYTE(w, b) WORD_HAS_ZERO((w) ^ (WORD_ONES * (unsigned char)(b)))
+
+/* Skip the string characters which need no special handling */
+static char *scan_string(char *pos, const char *end)
+{
+	unsigned long w;
+
+	while ((end - pos) >= (ptrdiff_t)sizeof(w)) {
+		memcpy(&w, pos, sizeof(w));
+		if (WORD_HAS_ZERO(w) || WORD_HAS_BYTE(w, '"') || WORD_HAS_BYTE(w, '\\')) {
+			break;
+		}
+		pos += sizeof(w);
+	}
+
+	return pos;
+}
+
+/* Skip the whitespace between tokens, whole words of indentation at once */
+static char *scan_space(char *pos, const char *end)
+{
+	unsigned long w;
+
+	while ((end - pos) >= (ptrdiff_t)sizeof(w)) {
+		memcpy(&w, pos, sizeof(w));
+		if (w != WORD_ONES * ' ') {
+			break;
+		}
+		pos += sizeof(w);
+	}
+
+	while ((pos < end) && ((*pos == ' ') || (*pos == '\n') || (*pos == '\t') ||
+			       (*pos == '\r'))) {
+		pos++;
+	}
+
+	return pos;
+}
+
 static void *lexer_string(struct json_lexer *lex)
 {
 	ignore(lex);
 
 	while (true) {
-		int chr = next(lex);
+		int chr;
+
+		lex->pos = scan_string(lex->pos, lex->end);
+		chr = next(lex);
 
 		if (chr == '\0') {
 			emit(lex, JSON_TOK_ERROR);
@@ -215,7 +261,11 @@ static void *lexer_number(struct json_lexer *lex)
 static void *lexer_json(struct json_lexer *lex)
 {
 	while (true) {
-		int chr = next(lex);
+		int chr;
+
+		lex->pos = scan_space(lex->pos, lex->end);
+		ignore(lex);
+		chr = next(lex);
 
 		switch (chr) {
 		case '\0':
@@ -666,7 +716,8 @@ static int64_t obj_parse(struct json_obj *obj, const struct json_obj_descr *desc
 {
 	struct json_obj_key_value kv;
 	int64_t decoded_fields = 0;
-	size_t i;
+	size_t hint = 0;
+	size_t i, n;
 	int ret;
 
 	while (!obj_next(obj, &kv)) {
@@ -674,7 +725,15 @@ static int64_t obj_parse(struct json_obj *obj, const struct json_obj_descr *desc
 			return decoded_fields;
 		}
 
-		for (i = 0; i < descr_len; i++) {
+		/* Fields usually come in descriptor order: look for the next
+		 * one first, so that the lookup of each key is constant time.
+		 */
+		for (n = 0; n < descr_len; n++) {
+			i = hint + n;
+			if (i >= descr_len) {
+				i -= descr_len;
+			}
+
 			void *decode_field = (char *)val + descr[i].offset;
 
 			/* Field has been decoded already, skip */
@@ -700,11 +759,12 @@ static int64_t obj_parse(struct json_obj *obj, const struct json_obj_descr *desc
 			}
 
 			decoded_fields |= (int64_t)1<<i;
+			hint = i + 1;
 			break;
 		}
 
 		/* Skip field, if no descriptor was found */
-		if (i >= descr_len) {
+		if (n >= descr_len) {
 			ret = skip_field(obj, &kv);
 			if (ret < 0) {
 				return ret;
@@ -805,21 +865,33 @@ static int json_escape_internal(const char *str,
 				json_append_bytes_t append_bytes,
 				void *data)
 {
+	const char *run = str;
 	const char *cur;
 	int ret = 0;
 
+	/* Append the characters between two escapes as a single run */
 	for (cur = str; ret == 0 && *cur; cur++) {
 		char escaped = escape_as(*cur);
 
 		if (escaped) {
 			char bytes[2] = { '\\', escaped };
 
+			if (cur > run) {
+				ret = append_bytes(run, (size_t)(cur - run), data);
+				if (ret < 0) {
+					return ret;
+				}
+			}
+
 			ret = append_bytes(bytes, 2, data);
-		} else {
-			ret = append_bytes(cur, 1, data);
+			run = cur + 1;
 		}
 	}
 
+	if (ret == 0 && cur > run) {
+		ret = append_bytes(run, (size_t)(cur - run), data);
+	}
+
 	return ret;
 }
 
@@ -1137,6 +1209,76 @@ int json_arr_encode_buf(const struct json_obj_descr *descr, const void *val,
 	return json_arr_encode(descr, val, append_bytes_to_buf, &appender);
 }
 
+void json_stream_init(struct json_stream *stream, char *buf, size_t size,
+		      json_stream_flush_t flush, void *data)
+{
+	stream->buf = buf;
+	stream->size = size;
+	stream->used = 0;
+	stream->flush = flush;
+	stream->data = data;
+}
+
+int json_stream_flush(struct json_stream *stream)
+{
+	size_t used = stream->used;
+
+	if (used == 0) {
+		return 0;
+	}
+
+	stream->used = 0;
+
+	return stream->flush(stream->buf, used, stream->data);
+}
+
+int json_stream_write(struct json_stream *stream, const char *bytes, size_t len)
+{
+	int ret;
+
+	while (len > 0) {
+		size_t n;
+
+		if (stream->used == stream->size) {
+			ret = json_stream_flush(stream);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+
+		/* Large runs are written out directly, without a copy */
+		if (stream->used == 0 && len >= stream->size) {
+			return stream->flush(bytes, len, stream->data);
+		}
+
+		n = MIN(len, stream->size - stream->used);
+		memcpy(stream->buf + stream->used, bytes, n);
+		stream->used += n;
+		bytes += n;
+		len -= n;
+	}
+
+	return 0;
+}
+
+static int append_bytes_to_stream(const char *bytes, size_t len, void *data)
+{
+	return json_stream_write(data, bytes, len);
+}
+
+int json_obj_encode_stream(const struct json_obj_descr *descr, size_t descr_len,
+			   const void *val, struct json_stream *stream)
+{
+	return json_obj_encode(descr, descr_len, val, append_bytes_to_stream,
+			       stream);
+}
+
+int json_arr_encode_stream(const struct json_obj_descr *descr, const void *val,
+			   struct json_stream *stream)
+{
+	return json_arr_encode(descr, val, append_bytes_to_stream, stream);
+}
+
 static int measure_bytes(const char *bytes, size_t len, void *data)
 {
 	ssize_t *total = data;
@@ -54,6 +54,20 @@ int ring_buf_put_finish(struct ring_buf *buf, uint32_t size)
 	return 0;
 }
 
+uint32_t ring_buf_put_claim_vec(struct ring_buf *buf, struct ring_buf_vec vec[2], uint32_t size)
+{
+	vec[0].size = ring_buf_put_claim(buf, &vec[0].data, size);
+	vec[1].data = buf->buffer;
+	vec[1].size = 0U;
+
+	/* claims add up, a second one starts at the beginning of the buffer */
+	if (vec[0].size < size) {
+		vec[1].size = ring_buf_put_claim(buf, &vec[1].data, size - vec[0].size);
+	}
+
+	return vec[0].size + vec[1].size;
+}
+
 uint32_t ring_buf_put(struct ring_buf *buf, const uint8_t *data, uint32_t size)
 {
 	uint8_t *dst;
@@ -121,6 +135,20 @@ int ring_buf_get_finish(struct ring_buf *buf, uint32_t size)
 	return 0;
 }
 
+uint32_t ring_buf_get_claim_vec(struct ring_buf *buf, struct ring_buf_vec vec[2], uint32_t size)
+{
+	vec[0].size = ring_buf_get_claim(buf, &vec[0].data, size);
+	vec[1].data = buf->buffer;
+	vec[1].size = 0U;
+
+	/* claims add up, a second one starts at the beginning of the buffer */
+	if (vec[0].size < size) {
+		vec[1].size = ring_buf_get_claim(buf, &vec[1].data, size - vec[0].size);
+	}
+
+	return vec[0].size + vec[1].size;
+}
+
 uint32_t ring_buf_get(struct ring_buf *buf, uint8_t *data, uint32_t size)
 {
 	uint8_t *src;
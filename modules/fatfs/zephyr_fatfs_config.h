@@ -63,6 +63,11 @@
 #define FF_FS_EXFAT		CONFIG_FS_FATFS_EXFAT
 #endif /* defined(CONFIG_FS_FATFS_EXFAT) */
 
+#if defined(CONFIG_FS_FATFS_FASTSEEK)
+#undef FF_USE_FASTSEEK
+#define FF_USE_FASTSEEK		CONFIG_FS_FATFS_FASTSEEK
+#endif /* defined(CONFIG_FS_FATFS_FASTSEEK) */
+
 #if defined(CONFIG_FS_FATFS_REENTRANT)
 #undef FF_FS_REENTRANT
 #undef FF_FS_TIMEOUT
@@ -43,6 +43,16 @@ void lvgl_wait_cb(lv_disp_drv_t *disp_drv)
 	k_sem_take(&flush_complete, K_FOREVER);
 }
 
+#else
+
+static void lvgl_write_done(const struct device *dev, int result, void *user_data)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(result);
+
+	lv_disp_flush_ready((lv_disp_drv_t *)user_data);
+}
+
 #endif /* CONFIG_LV_Z_FLUSH_THREAD */
 
 #ifdef CONFIG_LV_Z_USE_ROUNDER_CB
@@ -128,12 +138,20 @@ void lvgl_flush_display(struct lvgl_display_flush *request)
 	/* Explicitly yield, in case the calling thread is a cooperative one */
 	k_yield();
 #else
-	/* Write directly to the display */
+	/*
+	 * Write directly to the display. Drivers supporting asynchronous
+	 * writes return as soon as the transfer is started, so that with two
+	 * rendering buffers LVGL renders the next one in the meantime.
+	 */
 	struct lvgl_disp_data *data =
 		(struct lvgl_disp_data *)request->disp_drv->user_data;
+	int err;
 
-	display_write(data->display_dev, request->x, request->y,
-		      &request->desc, request->buf);
-	lv_disp_flush_ready(request->disp_drv);
+	err = display_write_async(data->display_dev, request->x, request->y,
+				  &request->desc, request->buf, lvgl_write_done,
+				  request->disp_drv);
+	if (err < 0) {
+		lv_disp_flush_ready(request->disp_drv);
+	}
 #endif
 }
@@ -84,6 +84,7 @@ static otRadioState sState = OT_RADIO_STATE_DISABLED;
 static otRadioFrame sTransmitFrame;
 static otRadioFrame ack_frame;
 static uint8_t ack_psdu[ACK_PKT_LENGTH];
+static uint8_t rx_psdu[IEEE802154_MAX_PHY_PACKET_SIZE];
 
 #if defined(CONFIG_OPENTHREAD_TIME_SYNC)
 static otRadioIeInfo tx_ie_info;
@@ -481,11 +482,23 @@ static void openthread_handle_received_frame(otInstance *instance,
 					     struct net_pkt *pkt)
 {
 	otRadioFrame recv_frame;
+	struct net_buf *last = net_buf_frag_last(pkt->buffer);
+	size_t len = net_buf_frags_len(pkt->buffer);
+
 	memset(&recv_frame, 0, sizeof(otRadioFrame));
 
-	recv_frame.mPsdu = net_buf_frag_last(pkt->buffer)->data;
+	/* The PSDU is handed to OpenThread in place, unless the driver split it
+	 * over several buffers, in which case it is gathered first.
+	 */
+	if (last->len == len) {
+		recv_frame.mPsdu = last->data;
+	} else {
+		len = net_buf_linearize(rx_psdu, sizeof(rx_psdu), pkt->buffer, 0, len);
+		recv_frame.mPsdu = rx_psdu;
+	}
+
 	/* Length inc. CRC. */
-	recv_frame.mLength = net_buf_frags_len(pkt->buffer);
+	recv_frame.mLength = len;
 	recv_frame.mChannel = platformRadioChannelGet(instance);
 	recv_frame.mInfo.mRxInfo.mLqi = net_pkt_ieee802154_lqi(pkt);
 	recv_frame.mInfo.mRxInfo.mRssi = net_pkt_ieee802154_rssi_dbm(pkt);
@@ -12,7 +12,8 @@ is a special section filled with 'llext_const_symbol' structures
 generated by the EXPORT_SYMBOL macro.
 
 Currently, the preparatory work consists mostly of sorting the
-exports table to allow usage of binary search algorithms at runtime.
+exports table, by name or by SLID, to allow usage of binary search
+algorithms at runtime.
 If CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID option is enabled, SLIDs
 of all exported functions are also injected in the export table by
 this script. (In this case, the preparation process is destructive)
@@ -217,26 +218,52 @@ class ZephyrElfExptabPreparator():
         return 0
 
     def _prepare_exptab_for_str_linking(self):
-        #TODO: sort the export table by symbol
-        #      name to allow binary search too
-        #
-        # Plan of action:
-        #   1) Locate in which section the names are located
-        #   2) Load the export table and resolve names
-        #   3) Sort the exports by name
-        #       WARN: THIS MUST USE THE SAME SORTING RULES
-        #       AS LLEXT CODE OR DICHOTOMIC SEARCH WILL BREAK
-        #       Using a custom sorting function might be required.
-        #   4) Write back the updated export table
-        #
-        # N.B.: reusing part of the code in _prepare_elf_for_slid_linking
-        # might be possible and desireable.
-        #
-        # As of writing, this function will never be called as this script
-        # is only called if CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID is enabled,
-        # which makes _prepare_exptab_for_slid_linking be called instead.
-        #
-        self.log.warn(f"_prepare_exptab_for_str_linking: do nothing")
+        """
+        IMPLEMENTATION NOTES:
+          Export names are regular strings placed anywhere in the image,
+          so their addresses are translated to file offsets through the
+          program headers.
+
+          The export table is sorted by name in ASCENDING order, comparing
+          names byte by byte like strcmp() does in the LLEXT code.
+        """
+        if self.elf['e_type'] != 'ET_EXEC':
+            # Entries of relocatable images must stay in place, as the
+            # relocations refer to them by offset
+            self.log.info(f"{self.elf['e_type']} ELF: export table left unsorted")
+            return 0
+
+        def read_symbol_name(name_ptr):
+            offsets = list(self.elf.address_offsets(name_ptr))
+            if not offsets:
+                return None
+
+            raw_name = b''
+            self.elf_fd.seek(offsets[0])
+            while True:
+                c = self.elf_fd.read(1)
+                if c in (b'\0', b''):
+                    break
+                raw_name += c
+
+            return raw_name
+
+        exports_list = []
+        for (name_ptr, export_address) in self.exptab_manipulator:
+            export_name = read_symbol_name(name_ptr)
+            if export_name is None:
+                self.log.warning(f"name at 0x{name_ptr:X} not in a loaded segment - "
+                    "export table left unsorted")
+                return 0
+
+            exports_list.append((export_name, name_ptr, export_address))
+
+        # Python compares bytes objects with the same rules as strcmp()
+        exports_list.sort(key=lambda export: export[0])
+
+        for i, (_, name_ptr, export_address) in enumerate(exports_list):
+            self.exptab_manipulator[i] = (name_ptr, export_address)
+
         return 0
 
     def _set_prep_done_shdr_flag(self):
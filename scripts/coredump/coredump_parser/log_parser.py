@@ -20,9 +20,13 @@ LOG_ARCH_HDR_SIZE = struct.calcsize(LOG_ARCH_HDR_STRUCT)
 
 COREDUMP_MEM_HDR_ID = b'M'
 COREDUMP_MEM_HDR_VER = 1
+COREDUMP_MEM_HDR_VER_LZ4 = 2
 LOG_MEM_HDR_STRUCT = "<cH"
 LOG_MEM_HDR_SIZE = struct.calcsize(LOG_MEM_HDR_STRUCT)
 
+LOG_MEM_CHUNK_HDR_STRUCT = "<HH"
+LOG_MEM_CHUNK_HDR_SIZE = struct.calcsize(LOG_MEM_CHUNK_HDR_STRUCT)
+
 
 logger = logging.getLogger("parser")
 
@@ -85,8 +89,9 @@ class CoredumpLogFile:
         hdr = self.fd.read(LOG_MEM_HDR_SIZE)
         _, hdr_ver = struct.unpack(LOG_MEM_HDR_STRUCT, hdr)
 
-        if hdr_ver != COREDUMP_MEM_HDR_VER:
-            logger.error(f"Memory block version: {hdr_ver}, expected {COREDUMP_MEM_HDR_VER}!")
+        if hdr_ver not in (COREDUMP_MEM_HDR_VER, COREDUMP_MEM_HDR_VER_LZ4):
+            logger.error(f"Memory block version: {hdr_ver}, expected {COREDUMP_MEM_HDR_VER}"
+                         f" or {COREDUMP_MEM_HDR_VER_LZ4}!")
             return False
 
         # Figure out how to read the start and end addresses
@@ -103,7 +108,12 @@ class CoredumpLogFile:
 
         size = eaddr - saddr
 
-        data = self.fd.read(size)
+        if hdr_ver == COREDUMP_MEM_HDR_VER_LZ4:
+            data = self.read_compressed_memory(size)
+            if data is None:
+                return False
+        else:
+            data = self.fd.read(size)
 
         mem = {"start": saddr, "end": eaddr, "data": data}
         self.memory_regions.append(mem)
@@ -113,6 +123,36 @@ class CoredumpLogFile:
 
         return True
 
+    def read_compressed_memory(self, size):
+        try:
+            import lz4.block
+        except ImportError:
+            logger.error("Module lz4 is needed to decompress memory, "
+                         "install it with 'pip install lz4'")
+            return None
+
+        data = bytearray()
+        while len(data) < size:
+            hdr = self.fd.read(LOG_MEM_CHUNK_HDR_SIZE)
+            if len(hdr) != LOG_MEM_CHUNK_HDR_SIZE:
+                logger.error("Truncated compressed memory block")
+                return None
+
+            raw_len, comp_len = struct.unpack(LOG_MEM_CHUNK_HDR_STRUCT, hdr)
+            chunk = self.fd.read(comp_len)
+
+            if comp_len == raw_len:
+                # Chunk stored uncompressed
+                data += chunk
+            else:
+                try:
+                    data += lz4.block.decompress(chunk, uncompressed_size=raw_len)
+                except lz4.block.LZ4BlockError as e:
+                    logger.error(f"Cannot decompress memory chunk: {e}")
+                    return None
+
+        return bytes(data)
+
     def parse(self):
         if self.fd is None:
             self.open()
@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 The Zephyr Project Contributors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""Generate delta patches for CONFIG_IMG_DELTA_UPDATE.
+
+The patch reconstructs the target image from the source image, typically the
+one running on the device, see include/zephyr/dfu/flash_img.h for the format.
+Matches are found through an index of the source blocks; the bytes following
+a match are encoded as differences to the source when they mostly match it,
+as happens with code whose addresses moved, and inserted otherwise.
+"""
+
+import argparse
+import hashlib
+import struct
+import sys
+
+MAGIC = 0x3150445A
+OP_COPY = 0x00
+OP_ADD = 0x01
+OP_INSERT = 0x02
+OP_SEEK = 0x03
+
+BLOCK = 16
+
+
+def leb128(value):
+    out = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return bytes(out)
+
+
+def zigzag(value):
+    return (value << 1) ^ (value >> 63) if value < 0 else value << 1
+
+
+class Patch:
+    def __init__(self):
+        self.ops = bytearray()
+        self.src_pos = 0
+        self.insert = bytearray()
+
+    def op(self, opcode, arg, data=b''):
+        self.ops.append(opcode)
+        self.ops += leb128(arg)
+        self.ops += data
+
+    def flush_insert(self):
+        if self.insert:
+            self.op(OP_INSERT, len(self.insert), self.insert)
+            self.insert = bytearray()
+
+    def seek(self, pos):
+        if pos != self.src_pos:
+            self.flush_insert()
+            self.op(OP_SEEK, zigzag(pos - self.src_pos))
+            self.src_pos = pos
+
+    def copy(self, length):
+        self.flush_insert()
+        self.op(OP_COPY, length)
+        self.src_pos += length
+
+    def add(self, diff):
+        self.flush_insert()
+        self.op(OP_ADD, len(diff), diff)
+        self.src_pos += len(diff)
+
+
+def make_patch(source, target):
+    index = {}
+    for pos in range(0, len(source) - BLOCK + 1):
+        index.setdefault(source[pos:pos + BLOCK], pos)
+
+    patch = Patch()
+    tpos = 0
+    while tpos < len(target):
+        spos = index.get(target[tpos:tpos + BLOCK])
+        if spos is not None:
+            length = BLOCK
+            while (tpos + length < len(target) and spos + length < len(source)
+                   and target[tpos + length] == source[spos + length]):
+                length += 1
+            patch.seek(spos)
+            patch.copy(length)
+            tpos += length
+            continue
+
+        # Try differences against where the source would continue
+        spos = patch.src_pos
+        end = min(tpos + BLOCK, len(target))
+        if spos + (end - tpos) <= len(source):
+            same = sum(1 for i in range(tpos, end) if target[i] == source[spos + i - tpos])
+            if same * 2 >= end - tpos:
+                diff = bytes((target[i] - source[spos + i - tpos]) & 0xFF
+                             for i in range(tpos, end))
+                patch.add(diff)
+                tpos = end
+                continue
+
+        patch.insert.append(target[tpos])
+        tpos += 1
+
+    patch.flush_insert()
+
+    hdr = struct.pack('<IIII', MAGIC, len(source), len(target), 0)
+    hdr += hashlib.sha256(source).digest() + hashlib.sha256(target).digest()
+    return hdr + bytes(patch.ops)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter,
+                                     allow_abbrev=False)
+    parser.add_argument('source', help='image currently on the device')
+    parser.add_argument('target', help='image to update to')
+    parser.add_argument('patch', help='output delta patch')
+    args = parser.parse_args()
+
+    with open(args.source, 'rb') as f:
+        source = f.read()
+    with open(args.target, 'rb') as f:
+        target = f.read()
+
+    patch = make_patch(source, target)
+
+    with open(args.patch, 'wb') as f:
+        f.write(patch)
+
+    print(f'{args.patch}: {len(patch)} bytes, {100 * len(patch) // max(len(target), 1)}% '
+          f'of the target image', file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 The Zephyr Project Contributors
+#
+# SPDX-License-Identifier: Apache-2.0
+"""
+Turn the CONFIG_BOOT_PROFILE records into a boot timeline.
+
+The records are read from a log of the ``boot_profile dump`` shell command,
+or from a JSON file holding the responses of the MCUmgr Zephyr basic group
+boot profile command (a response map or a list of them).
+
+    ./scripts/tracing/boot_profile.py console.log -o boot.json
+
+The output is in the Chrome trace event format, shown as a flame-style
+timeline by https://ui.perfetto.dev or chrome://tracing. The slowest steps
+are also printed.
+"""
+
+import argparse
+import json
+import re
+import sys
+
+BSS_ZERO, DATA_COPY, LEVEL, DEVICE, SYS_INIT, MAIN = range(6)
+KIND_NAMES = ['bss', 'data', 'level', 'device', 'sys_init', 'main']
+
+
+def parse_shell(text):
+    hz = None
+    records = []
+
+    for line in text.splitlines():
+        m = re.search(r'boot_profile hz=(\d+)', line)
+        if m:
+            hz = int(m.group(1))
+            records = []
+            continue
+
+        m = re.search(r'bp,(\d+),(\d+),(\d+),(\d+),(-?\d+),(.*)$', line)
+        if m:
+            records.append({
+                'kind': int(m.group(1)),
+                'level': int(m.group(2)),
+                'start': int(m.group(3)),
+                'end': int(m.group(4)),
+                'rc': int(m.group(5)),
+                'name': m.group(6).strip(),
+            })
+
+    return hz, records
+
+
+def parse_json(text):
+    data = json.loads(text)
+    responses = data if isinstance(data, list) else [data]
+    hz = None
+    records = []
+
+    for rsp in sorted(responses, key=lambda r: r.get('off', 0)):
+        hz = rsp['hz']
+        records += rsp['records']
+
+    return hz, records
+
+
+def resolve_names(records, elf_file):
+    from elftools.elf.elffile import ELFFile
+    from elftools.elf.sections import SymbolTableSection
+
+    symbols = {}
+    with open(elf_file, 'rb') as f:
+        for section in ELFFile(f).iter_sections():
+            if isinstance(section, SymbolTableSection):
+                for sym in section.iter_symbols():
+                    if sym['st_info']['type'] == 'STT_FUNC':
+                        # Thumb functions have the LSB set
+                        symbols[sym['st_value'] & ~1] = sym.name
+
+    for rec in records:
+        if rec['name'].startswith('0x'):
+            rec['name'] = symbols.get(int(rec['name'], 16) & ~1, rec['name'])
+
+
+def to_trace(hz, records):
+    base = min((r['start'] for r in records), default=0)
+
+    def us(cycles):
+        return ((cycles - base) & 0xFFFFFFFF) * 1000000 / hz
+
+    events = []
+    # Steps overlap with parallel device init, each lane showing steps which
+    # do not overlap.
+    lanes = []
+    for rec in sorted(records, key=lambda r: (r['start'] - base) & 0xFFFFFFFF):
+        start = us(rec['start'])
+        dur = ((rec['end'] - rec['start']) & 0xFFFFFFFF) * 1000000 / hz
+
+        if rec['kind'] in (LEVEL, MAIN):
+            tid = 0
+        else:
+            for tid, end in enumerate(lanes, 1):
+                if end <= start:
+                    break
+            else:
+                lanes.append(0)
+                tid = len(lanes)
+            lanes[tid - 1] = start + dur
+
+        events.append({
+            'name': rec['name'],
+            'cat': KIND_NAMES[rec['kind']] if rec['kind'] < len(KIND_NAMES) else '?',
+            'ph': 'i' if rec['kind'] == MAIN else 'X',
+            's': 'g',
+            'ts': start,
+            'dur': dur,
+            'pid': 0,
+            'tid': tid,
+            'args': {'rc': rec['rc'], 'level': rec['level']},
+        })
+
+    return {'traceEvents': events, 'displayTimeUnit': 'ms'}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter,
+                                     allow_abbrev=False)
+    parser.add_argument('input', help='shell log or JSON MCUmgr responses')
+    parser.add_argument('-o', '--output', help='Chrome trace event JSON output file')
+    parser.add_argument('-e', '--elf', help='zephyr.elf to resolve SYS_INIT() function names')
+    parser.add_argument('-n', '--top', type=int, default=10,
+                        help='number of slowest steps to print')
+    args = parser.parse_args()
+
+    with open(args.input) as f:
+        text = f.read()
+
+    try:
+        hz, records = parse_json(text)
+    except (ValueError, KeyError, TypeError):
+        hz, records = parse_shell(text)
+
+    if not hz or not records:
+        sys.exit(f'{args.input}: no boot profile records found')
+
+    if args.elf:
+        resolve_names(records, args.elf)
+
+    trace = to_trace(hz, records)
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            json.dump(trace, f)
+
+    steps = [e for e in trace['traceEvents'] if e['cat'] not in ('level', 'main')]
+    main_ev = [e for e in trace['traceEvents'] if e['cat'] == 'main']
+    if main_ev:
+        print(f'main() called at {main_ev[0]["ts"] / 1000:.3f} ms')
+    for ev in sorted(steps, key=lambda e: e['dur'], reverse=True)[:args.top]:
+        print(f'{ev["dur"] / 1000:10.3f} ms  {ev["cat"]:8}  {ev["name"]}')
+
+
+if __name__ == '__main__':
+    main()
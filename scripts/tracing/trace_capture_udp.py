@@ -0,0 +1,50 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 The Zephyr Project Contributors
+#
+# SPDX-License-Identifier: Apache-2.0
+"""
+Script to capture tracing data with UDP backend.
+"""
+
+import sys
+import socket
+import argparse
+
+def parse_args():
+    global args
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter, allow_abbrev=False)
+    parser.add_argument("-a", "--address", default='0.0.0.0',
+                        required=False, help="local address to listen on")
+    parser.add_argument("-p", "--port", type=int, default=5556,
+                        required=False, help="UDP port to listen on")
+    parser.add_argument("-o", "--output", default='channel0_0',
+                        required=False, help="tracing data output file")
+    args = parser.parse_args()
+
+def main():
+    parse_args()
+    family = socket.AF_INET6 if ':' in args.address else socket.AF_INET
+
+    try:
+        sock = socket.socket(family, socket.SOCK_DGRAM)
+        sock.bind((args.address, args.port))
+    except OSError as e:
+        sys.exit("{}".format(e))
+
+    print("listening on {} port {}".format(args.address, args.port))
+
+    with open(args.output, "wb") as file_desc:
+        while True:
+            data = sock.recv(65535)
+            file_desc.write(data)
+            file_desc.flush()
+
+if __name__=="__main__":
+    try:
+        main()
+    except KeyboardInterrupt:
+        print('Data capture interrupted, data saved into {}'.format(args.output))
+        sys.exit(0)
@@ -171,6 +171,48 @@ static const bool dup_scan = true;
 #endif /* !CONFIG_BT_CTLR_SYNC_PERIODIC_ADI_SUPPORT */
 #endif /* CONFIG_BT_CTLR_DUP_FILTER_LEN > 0 */
 
+#if defined(CONFIG_BT_CTLR_VS_SCAN_FILTER)
+/* AD patterns of the vendor scan report filter */
+static struct scan_pattern {
+	uint8_t ad_type;
+	uint8_t offset;
+	uint8_t len;
+	uint8_t data[BT_HCI_VS_SCAN_FILTER_DATA_MAX];
+} scan_patterns[CONFIG_BT_CTLR_VS_SCAN_FILTER_PATTERNS];
+static uint8_t scan_pattern_count;
+
+/* Advertisers last reported, one entry per address and PDU type */
+static struct scan_dedup_entry {
+	bt_addr_le_t addr;
+	uint8_t      adv_type;
+	uint32_t     time;
+} scan_dedup[CONFIG_BT_CTLR_VS_SCAN_DEDUP_LEN];
+static uint8_t scan_dedup_count;
+/* Next entry to overwrite when the table is full */
+static uint8_t scan_dedup_curr;
+
+static struct {
+	bool     filter;
+	uint16_t dedup_window;
+	uint16_t batch_window;
+	uint8_t  batch_max;
+} scan_report_params;
+
+/* Report parameters of an advertising report event fit in a byte, after the
+ * subevent code and the number of reports.
+ */
+#define SCAN_BATCH_DATA_MAX (UINT8_MAX - sizeof(struct bt_hci_evt_le_meta_event) - 1U)
+
+/* Pending batch of advertising reports, without the event headers */
+static struct {
+	uint8_t  subevent;
+	uint8_t  num;
+	uint8_t  len;
+	uint32_t start;
+	uint8_t  data[SCAN_BATCH_DATA_MAX];
+} scan_batch;
+#endif /* CONFIG_BT_CTLR_VS_SCAN_FILTER */
+
 #if defined(CONFIG_BT_HCI_MESH_EXT)
 struct scan_filter {
 	uint8_t count;
@@ -448,6 +490,15 @@ static void reset(struct net_buf *buf, struct net_buf **evt)
 #endif /* CONFIG_BT_CTLR_SYNC_PERIODIC_ADI_SUPPORT */
 #endif /* CONFIG_BT_CTLR_DUP_FILTER_LEN > 0 */
 
+#if defined(CONFIG_BT_CTLR_VS_SCAN_FILTER)
+	(void)memset(&scan_report_params, 0, sizeof(scan_report_params));
+	scan_pattern_count = 0U;
+	scan_dedup_count = 0U;
+	scan_dedup_curr = 0U;
+	scan_batch.num = 0U;
+	scan_batch.len = 0U;
+#endif /* CONFIG_BT_CTLR_VS_SCAN_FILTER */
+
 	/* reset event masks */
 	event_mask = DEFAULT_EVENT_MASK;
 	event_mask_page_2 = DEFAULT_EVENT_MASK_PAGE_2;
@@ -4840,6 +4891,10 @@ static void vs_read_supported_commands(struct net_buf *buf,
 	/* Set USB Transport Mode */
 	rp->commands[2] |= BIT(0);
 #endif /* USB_DEVICE_BLUETOOTH_VS_H4 */
+#if defined(CONFIG_BT_CTLR_VS_SCAN_FILTER)
+	/* Scan Filter Add, Scan Filter Clear, Set Scan Report Parameters */
+	rp->commands[2] |= BIT(2) | BIT(3) | BIT(4);
+#endif /* CONFIG_BT_CTLR_VS_SCAN_FILTER */
 }
 
 static void vs_read_supported_features(struct net_buf *buf,
@@ -4948,6 +5003,65 @@ static void vs_set_scan_req_reports(struct net_buf *buf, struct net_buf **evt)
 }
 #endif /* CONFIG_BT_CTLR_VS_SCAN_REQ_RX */
 
+#if defined(CONFIG_BT_CTLR_VS_SCAN_FILTER)
+static void vs_scan_filter_add(struct net_buf *buf, struct net_buf **evt)
+{
+	struct bt_hci_cp_vs_scan_filter_add *cmd = (void *)buf->data;
+	struct scan_pattern *pattern;
+
+	if ((buf->len < sizeof(*cmd)) ||
+	    (cmd->len > BT_HCI_VS_SCAN_FILTER_DATA_MAX) ||
+	    (buf->len < (sizeof(*cmd) + cmd->len))) {
+		*evt = cmd_complete_status(BT_HCI_ERR_INVALID_PARAM);
+		return;
+	}
+
+	if (scan_pattern_count >= ARRAY_SIZE(scan_patterns)) {
+		*evt = cmd_complete_status(BT_HCI_ERR_MEM_CAPACITY_EXCEEDED);
+		return;
+	}
+
+	pattern = &scan_patterns[scan_pattern_count];
+	pattern->ad_type = cmd->ad_type;
+	pattern->offset = cmd->offset;
+	pattern->len = cmd->len;
+	memcpy(pattern->data, cmd->data, cmd->len);
+	scan_pattern_count++;
+
+	*evt = cmd_complete_status(0x00);
+}
+
+static void vs_scan_filter_clear(struct net_buf *buf, struct net_buf **evt)
+{
+	scan_pattern_count = 0U;
+
+	*evt = cmd_complete_status(0x00);
+}
+
+static void vs_set_scan_report_params(struct net_buf *buf, struct net_buf **evt)
+{
+	struct bt_hci_cp_vs_set_scan_report_params *cmd = (void *)buf->data;
+	uint16_t batch_window = sys_le16_to_cpu(cmd->batch_window);
+
+	if ((cmd->filter > BT_HCI_VS_SCAN_FILTER_ENABLED) ||
+	    (batch_window && !cmd->batch_max)) {
+		*evt = cmd_complete_status(BT_HCI_ERR_INVALID_PARAM);
+		return;
+	}
+
+	scan_report_params.filter = cmd->filter;
+	scan_report_params.dedup_window = sys_le16_to_cpu(cmd->dedup_window);
+	scan_report_params.batch_window = batch_window;
+	scan_report_params.batch_max = cmd->batch_max;
+
+	/* Restart deduplication, a pending batch is sent by the HCI driver */
+	scan_dedup_count = 0U;
+	scan_dedup_curr = 0U;
+
+	*evt = cmd_complete_status(0x00);
+}
+#endif /* CONFIG_BT_CTLR_VS_SCAN_FILTER */
+
 #if defined(CONFIG_BT_CTLR_TX_PWR_DYNAMIC_CONTROL)
 static void vs_write_tx_power_level(struct net_buf *buf, struct net_buf **evt)
 {
@@ -5513,6 +5627,20 @@ int hci_vendor_cmd_handle_common(uint16_t ocf, struct net_buf *cmd,
 		break;
 #endif /* CONFIG_BT_CTLR_VS_SCAN_REQ_RX */
 
+#if defined(CONFIG_BT_CTLR_VS_SCAN_FILTER)
+	case BT_OCF(BT_HCI_OP_VS_SCAN_FILTER_ADD):
+		vs_scan_filter_add(cmd, evt);
+		break;
+
+	case BT_OCF(BT_HCI_OP_VS_SCAN_FILTER_CLEAR):
+		vs_scan_filter_clear(cmd, evt);
+		break;
+
+	case BT_OCF(BT_HCI_OP_VS_SET_SCAN_REPORT_PARAMS):
+		vs_set_scan_report_params(cmd, evt);
+		break;
+#endif /* CONFIG_BT_CTLR_VS_SCAN_FILTER */
+
 #if defined(CONFIG_BT_CTLR_TX_PWR_DYNAMIC_CONTROL)
 	case BT_OCF(BT_HCI_OP_VS_WRITE_TX_POWER_LEVEL):
 		vs_write_tx_power_level(cmd, evt);
@@ -6380,6 +6508,191 @@ static inline void le_mesh_scan_report(struct pdu_adv *adv,
 }
 #endif /* CONFIG_BT_HCI_MESH_EXT */
 
+#if defined(CONFIG_BT_CTLR_VS_SCAN_FILTER)
+static bool scan_pattern_match(const struct scan_pattern *pattern,
+			       const uint8_t *val, uint8_t val_len)
+{
+	if (!pattern->len) {
+		return true;
+	}
+
+	if (pattern->offset != BT_HCI_VS_SCAN_FILTER_OFFSET_ANY) {
+		return ((pattern->offset + pattern->len) <= val_len) &&
+		       !memcmp(&val[pattern->offset], pattern->data,
+			       pattern->len);
+	}
+
+	/* Search the list of fixed size items, e.g. UUIDs, in the value */
+	for (uint8_t i = 0U; (i + pattern->len) <= val_len; i += pattern->len) {
+		if (!memcmp(&val[i], pattern->data, pattern->len)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool scan_pattern_found(const uint8_t *data, uint8_t len)
+{
+	while (len >= 2U) {
+		uint8_t el_len = data[0];
+
+		if (!el_len || (el_len >= len)) {
+			break;
+		}
+
+		for (uint8_t i = 0U; i < scan_pattern_count; i++) {
+			const struct scan_pattern *pattern = &scan_patterns[i];
+
+			if ((pattern->ad_type == data[1]) &&
+			    scan_pattern_match(pattern, &data[2], el_len - 1U)) {
+				return true;
+			}
+		}
+
+		data += el_len + 1U;
+		len -= el_len + 1U;
+	}
+
+	return false;
+}
+
+static bool scan_dedup_found(uint8_t adv_type, uint8_t addr_type,
+			     const uint8_t *addr)
+{
+	uint32_t now = k_uptime_get_32();
+	struct scan_dedup_entry *entry;
+
+	for (uint8_t i = 0U; i < scan_dedup_count; i++) {
+		entry = &scan_dedup[i];
+
+		if ((entry->adv_type != adv_type) ||
+		    (entry->addr.type != addr_type) ||
+		    memcmp(addr, &entry->addr.a.val[0], sizeof(bt_addr_t))) {
+			continue;
+		}
+
+		if ((now - entry->time) < scan_report_params.dedup_window) {
+			return true;
+		}
+
+		entry->time = now;
+
+		return false;
+	}
+
+	entry = &scan_dedup[scan_dedup_curr];
+	entry->adv_type = adv_type;
+	entry->addr.type = addr_type;
+	memcpy(&entry->addr.a.val[0], addr, sizeof(bt_addr_t));
+	entry->time = now;
+
+	if (scan_dedup_count < ARRAY_SIZE(scan_dedup)) {
+		scan_dedup_count++;
+	}
+	scan_dedup_curr = (scan_dedup_curr + 1U) % ARRAY_SIZE(scan_dedup);
+
+	return false;
+}
+
+/* Vendor filtering and deduplication of legacy advertising reports */
+static bool scan_report_drop(const struct pdu_adv *adv, uint8_t data_len)
+{
+	if (scan_report_params.filter &&
+	    !scan_pattern_found(&adv->adv_ind.data[0], data_len)) {
+		return true;
+	}
+
+	return scan_report_params.dedup_window &&
+	       scan_dedup_found(adv->type, adv->tx_addr, &adv->adv_ind.addr[0]);
+}
+
+void hci_scan_batch_encode(struct net_buf *buf)
+{
+	uint8_t *num_reports;
+
+	if (buf && scan_batch.num) {
+		num_reports = meta_evt(buf, scan_batch.subevent,
+				       sizeof(*num_reports) + scan_batch.len);
+		*num_reports = scan_batch.num;
+		memcpy(&num_reports[1], scan_batch.data, scan_batch.len);
+	}
+
+	scan_batch.num = 0U;
+	scan_batch.len = 0U;
+}
+
+k_timeout_t hci_scan_batch_timeout(void)
+{
+	uint32_t elapsed;
+
+	if (!scan_batch.num) {
+		return K_FOREVER;
+	}
+
+	elapsed = k_uptime_get_32() - scan_batch.start;
+	if (elapsed >= scan_report_params.batch_window) {
+		return K_NO_WAIT;
+	}
+
+	return K_MSEC(scan_report_params.batch_window - elapsed);
+}
+
+/* Move the single report just encoded in buf to the pending batch. buf then
+ * carries the previous batch, if the report ends it, or nothing and is
+ * dropped by the HCI driver.
+ */
+static void scan_batch_add(struct net_buf *buf)
+{
+	const size_t hdr_len = sizeof(struct bt_hci_evt_hdr) +
+			       sizeof(struct bt_hci_evt_le_meta_event) + 1U;
+	uint8_t report[sizeof(struct bt_hci_evt_le_ext_advertising_info) +
+		       PDU_AC_LEG_DATA_SIZE_MAX];
+	struct bt_hci_evt_le_meta_event *me;
+	uint32_t now = k_uptime_get_32();
+	uint8_t subevent;
+	uint8_t len;
+	size_t room;
+
+	if (!scan_report_params.batch_window) {
+		return;
+	}
+
+	me = (void *)&buf->data[sizeof(struct bt_hci_evt_hdr)];
+	subevent = me->subevent;
+	len = buf->len - hdr_len;
+
+	LL_ASSERT(len <= sizeof(report));
+
+	memcpy(report, &buf->data[hdr_len], len);
+	(void)net_buf_remove_mem(buf, buf->len);
+
+	/* The batch is sent in an event buffer like this one */
+	room = MIN(sizeof(scan_batch.data), net_buf_tailroom(buf) - hdr_len);
+
+	if (scan_batch.num &&
+	    ((scan_batch.subevent != subevent) ||
+	     (scan_batch.num >= scan_report_params.batch_max) ||
+	     ((scan_batch.len + len) > room) ||
+	     ((now - scan_batch.start) >= scan_report_params.batch_window))) {
+		hci_scan_batch_encode(buf);
+	}
+
+	if (!scan_batch.num) {
+		scan_batch.subevent = subevent;
+		scan_batch.start = now;
+	}
+
+	memcpy(&scan_batch.data[scan_batch.len], report, len);
+	scan_batch.len += len;
+	scan_batch.num++;
+
+	if (!buf->len && (scan_batch.num >= scan_report_params.batch_max)) {
+		hci_scan_batch_encode(buf);
+	}
+}
+#endif /* CONFIG_BT_CTLR_VS_SCAN_FILTER */
+
 static void le_advertising_report(struct pdu_data *pdu_data,
 				  struct node_rx_pdu *node_rx,
 				  struct net_buf *buf)
@@ -6450,6 +6763,13 @@ static void le_advertising_report(struct pdu_data *pdu_data,
 	} else {
 		data_len = 0U;
 	}
+
+#if defined(CONFIG_BT_CTLR_VS_SCAN_FILTER)
+	if (scan_report_drop(adv, data_len)) {
+		return;
+	}
+#endif /* CONFIG_BT_CTLR_VS_SCAN_FILTER */
+
 	info_len = sizeof(struct bt_hci_evt_le_advertising_info) + data_len +
 		   sizeof(*prssi);
 	sep = meta_evt(buf, BT_HCI_EVT_LE_ADVERTISING_REPORT,
@@ -6482,6 +6802,10 @@ static void le_advertising_report(struct pdu_data *pdu_data,
 	/* RSSI */
 	prssi = &adv_info->data[0] + data_len;
 	*prssi = rssi;
+
+#if defined(CONFIG_BT_CTLR_VS_SCAN_FILTER)
+	scan_batch_add(buf);
+#endif /* CONFIG_BT_CTLR_VS_SCAN_FILTER */
 }
 
 #if defined(CONFIG_BT_CTLR_ADV_EXT)
@@ -6555,6 +6879,12 @@ static void le_ext_adv_legacy_report(struct pdu_data *pdu_data,
 		data_len = 0U;
 	}
 
+#if defined(CONFIG_BT_CTLR_VS_SCAN_FILTER)
+	if (scan_report_drop(adv, data_len)) {
+		return;
+	}
+#endif /* CONFIG_BT_CTLR_VS_SCAN_FILTER */
+
 	info_len = sizeof(struct bt_hci_evt_le_ext_advertising_info) +
 		   data_len;
 	sep = meta_evt(buf, BT_HCI_EVT_LE_EXT_ADVERTISING_REPORT,
@@ -6599,6 +6929,10 @@ static void le_ext_adv_legacy_report(struct pdu_data *pdu_data,
 
 	adv_info->length = data_len;
 	memcpy(&adv_info->data[0], &adv->adv_ind.data[0], data_len);
+
+#if defined(CONFIG_BT_CTLR_VS_SCAN_FILTER)
+	scan_batch_add(buf);
+#endif /* CONFIG_BT_CTLR_VS_SCAN_FILTER */
 }
 
 static uint8_t ext_adv_direct_addr_type(struct lll_scan *lll,
@@ -671,6 +671,12 @@ static inline struct net_buf *process_hbuf(struct node_rx_pdu *n)
  * @brief Blockingly pull from Controller thread's recv_fifo
  * @details Execution context: Host thread
  */
+#if defined(CONFIG_BT_CTLR_VS_SCAN_FILTER)
+#define RECV_TIMEOUT hci_scan_batch_timeout()
+#else /* !CONFIG_BT_CTLR_VS_SCAN_FILTER */
+#define RECV_TIMEOUT K_FOREVER
+#endif /* !CONFIG_BT_CTLR_VS_SCAN_FILTER */
+
 static void recv_thread(void *p1, void *p2, void *p3)
 {
 	const struct device *dev = p1;
@@ -696,8 +702,8 @@ static void recv_thread(void *p1, void *p2, void *p3)
 #if defined(CONFIG_BT_HCI_ACL_FLOW_CONTROL)
 		int err;
 
-		err = k_poll(events, 2, K_FOREVER);
-		LL_ASSERT(err == 0 || err == -EINTR);
+		err = k_poll(events, 2, RECV_TIMEOUT);
+		LL_ASSERT(err == 0 || err == -EINTR || err == -EAGAIN);
 		if (events[0].state == K_POLL_STATE_SIGNALED) {
 			events[0].signal->signaled = 0U;
 		} else if (events[1].state ==
@@ -712,7 +718,7 @@ static void recv_thread(void *p1, void *p2, void *p3)
 		buf = process_hbuf(node_rx);
 
 #else
-		node_rx = k_fifo_get(&recv_fifo, K_FOREVER);
+		node_rx = k_fifo_get(&recv_fifo, RECV_TIMEOUT);
 #endif
 		LOG_DBG("unblocked");
 
@@ -721,6 +727,15 @@ static void recv_thread(void *p1, void *p2, void *p3)
 			buf = process_node(node_rx);
 		}
 
+#if defined(CONFIG_BT_CTLR_VS_SCAN_FILTER)
+		if (!node_rx && !buf &&
+		    K_TIMEOUT_EQ(hci_scan_batch_timeout(), K_NO_WAIT)) {
+			/* Batch window elapsed, send the pending reports */
+			buf = bt_buf_get_evt(BT_HCI_EVT_UNKNOWN, true, K_NO_WAIT);
+			hci_scan_batch_encode(buf);
+		}
+#endif /* CONFIG_BT_CTLR_VS_SCAN_FILTER */
+
 		while (buf) {
 			struct net_buf *frag;
 
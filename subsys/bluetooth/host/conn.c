@@ -760,6 +760,68 @@ static bool acl_has_data(struct bt_conn *conn)
 }
 #endif	/* defined(CONFIG_BT_CONN) */
 
+static uint8_t conn_tx_weight(struct bt_conn *conn)
+{
+	return conn->tx_weight != 0U ? conn->tx_weight : CONFIG_BT_CONN_TX_WEIGHT;
+}
+
+int bt_conn_tx_weight_set(struct bt_conn *conn, uint8_t weight)
+{
+	CHECKIF(conn == NULL) {
+		return -EINVAL;
+	}
+
+	conn->tx_weight = weight;
+
+	return 0;
+}
+
+#if defined(CONFIG_BT_CONN_TX_STATS)
+/* Called with the conn just put in the ready list, or just picked from it */
+static void conn_tx_wait_update(struct bt_conn *conn, bool start)
+{
+	uint32_t wait_us;
+
+	if (start) {
+		conn->tx_wait_start = k_cycle_get_32();
+		conn->tx_waiting = true;
+		return;
+	}
+
+	if (!conn->tx_waiting) {
+		return;
+	}
+
+	conn->tx_waiting = false;
+	wait_us = k_cyc_to_us_floor32(k_cycle_get_32() - conn->tx_wait_start);
+	conn->tx_stats.waits++;
+	conn->tx_stats.wait_us += wait_us;
+	conn->tx_stats.max_wait_us = MAX(conn->tx_stats.max_wait_us, wait_us);
+}
+
+int bt_conn_tx_stats_get(const struct bt_conn *conn, struct bt_conn_tx_stats *stats)
+{
+	CHECKIF(conn == NULL || stats == NULL) {
+		return -EINVAL;
+	}
+
+	*stats = conn->tx_stats;
+
+	return 0;
+}
+
+void bt_conn_tx_stats_reset(struct bt_conn *conn)
+{
+	(void)memset(&conn->tx_stats, 0, sizeof(conn->tx_stats));
+}
+#else
+static void conn_tx_wait_update(struct bt_conn *conn, bool start)
+{
+	ARG_UNUSED(conn);
+	ARG_UNUSED(start);
+}
+#endif /* CONFIG_BT_CONN_TX_STATS */
+
 /* Connection "Scheduler" of sorts:
  *
  * Will try to get the optimal number of queued buffers for the connection.
@@ -781,16 +843,17 @@ static bool should_stop_tx(struct bt_conn *conn)
 		return true;
 	}
 
-	/* Queue only 3 buffers per-conn for now */
-	if (atomic_get(&conn->in_ll) < 3) {
+	/* Queue up to the weight of the conn, 3 buffers by default */
+	if (atomic_get(&conn->in_ll) < conn_tx_weight(conn)) {
 		/* The goal of this heuristic is to allow the link-layer to
 		 * extend an ACL connection event as long as the application
 		 * layer can provide data.
 		 *
-		 * Here we chose three buffers, as some LLs need two enqueued
+		 * The default is three buffers, as some LLs need two enqueued
 		 * packets to be able to set the more-data bit, and one more
 		 * buffer to allow refilling by the app while one of them is
-		 * being sent over-the-air.
+		 * being sent over-the-air. Connections with a larger weight
+		 * get a larger share of the controller buffers.
 		 */
 		return false;
 	}
@@ -804,6 +867,7 @@ void bt_conn_data_ready(struct bt_conn *conn)
 
 	/* The TX processor will call the `pull_cb` to get the buf */
 	if (!atomic_set(&conn->_conn_ready_lock, 1)) {
+		conn_tx_wait_update(conn, true);
 		sys_slist_append(&bt_dev.le.conn_ready,
 				 &conn->_conn_ready);
 		LOG_DBG("raised");
@@ -886,6 +950,9 @@ struct bt_conn *get_conn_ready(void)
 		return NULL;
 	}
 
+	/* The conn got its turn, it may be appended again just below */
+	conn_tx_wait_update(conn, false);
+
 	if (should_stop_tx(conn)) {
 		__maybe_unused sys_snode_t *s = sys_slist_get(&bt_dev.le.conn_ready);
 
@@ -957,7 +1024,7 @@ void bt_conn_suspend_tx(bool suspend)
 }
 #endif	/* CONFIG_BT_TESTING */
 
-void bt_conn_tx_processor(void)
+bool bt_conn_tx_processor(void)
 {
 	LOG_DBG("start");
 	struct bt_conn *conn;
@@ -968,18 +1035,18 @@ void bt_conn_tx_processor(void)
 
 	if (!IS_ENABLED(CONFIG_BT_CONN_TX)) {
 		/* Mom, can we have a real compiler? */
-		return;
+		return false;
 	}
 
 	if (IS_ENABLED(CONFIG_BT_TESTING) && _suspend_tx) {
-		return;
+		return false;
 	}
 
 	conn = get_conn_ready();
 
 	if (!conn) {
 		LOG_DBG("no connection wants to do stuff");
-		return;
+		return false;
 	}
 
 	LOG_DBG("processing conn %p", conn);
@@ -994,7 +1061,7 @@ void bt_conn_tx_processor(void)
 			destroy_and_callback(conn, buf, cb, ud);
 			buf = conn->tx_data_pull(conn, SIZE_MAX, &buf_len);
 		}
-		return;
+		return true;
 	}
 
 	/* now that we are guaranteed resources, we can pull data from the upper
@@ -1008,7 +1075,7 @@ void bt_conn_tx_processor(void)
 		 * the upper layer when it has more data.
 		 */
 		LOG_DBG("no buf returned");
-		return;
+		return false;
 	}
 
 	bool last_buf = conn_mtu(conn) >= buf_len;
@@ -1044,13 +1111,19 @@ void bt_conn_tx_processor(void)
 		destroy_and_callback(conn, buf, cb, ud);
 		bt_conn_disconnect(conn, BT_HCI_ERR_REMOTE_USER_TERM_CONN);
 
-		return;
+		return false;
 	}
 
+#if defined(CONFIG_BT_CONN_TX_STATS)
+	conn->tx_stats.frags++;
+#endif
+
 	/* Always kick the TX work. It will self-suspend if it doesn't get
 	 * resources or there is nothing left to send.
 	 */
 	bt_tx_irq_raise();
+
+	return true;
 }
 
 static void process_unack_tx(struct bt_conn *conn)
@@ -303,6 +303,18 @@ struct bt_conn {
 	/* Next buffer should be an ACL/ISO HCI fragment */
 	bool			next_is_frag;
 
+	/* Number of controller buffers this connection can hold before the TX
+	 * processor moves on to the next ready one. 0 uses the default.
+	 */
+	uint8_t			tx_weight;
+
+#if defined(CONFIG_BT_CONN_TX_STATS)
+	/* Time the connection was put in the ready list */
+	uint32_t		tx_wait_start;
+	bool			tx_waiting;
+	struct bt_conn_tx_stats	tx_stats;
+#endif /* CONFIG_BT_CONN_TX_STATS */
+
 	/* Must be at the end so that everything else in the structure can be
 	 * memset to zero without affecting the ref.
 	 */
@@ -543,7 +555,7 @@ void bt_conn_cleanup_all(void);
 /* Selects based on connection type right semaphore for ACL packets */
 struct k_sem *bt_conn_get_pkts(struct bt_conn *conn);
 
-void bt_conn_tx_processor(void);
+bool bt_conn_tx_processor(void);
 
 /* To be called by upper layers when they want to send something.
  * Functions just like an IRQ.
@@ -60,6 +60,12 @@ LOG_MODULE_REGISTER(bt_gatt);
 
 static uint16_t last_static_handle;
 
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+static void attr_index_build(void);
+#else
+static inline void attr_index_build(void) {}
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
+
 /* Persistent storage format for GATT CCC */
 struct ccc_store {
 	uint16_t handle;
@@ -1539,6 +1545,8 @@ static void bt_gatt_service_init(void)
 	STRUCT_SECTION_FOREACH(bt_gatt_service_static, svc) {
 		last_static_handle += svc->attr_count;
 	}
+
+	attr_index_build();
 }
 
 void bt_gatt_init(void)
@@ -1757,6 +1765,8 @@ int bt_gatt_service_register(struct bt_gatt_service *svc)
 		return err;
 	}
 
+	attr_index_build();
+
 	/* Don't submit any work until the stack is initialized */
 	if (!atomic_test_bit(gatt_flags, GATT_INITIALIZED)) {
 		k_sched_unlock();
@@ -1787,6 +1797,8 @@ int bt_gatt_service_unregister(struct bt_gatt_service *svc)
 		return err;
 	}
 
+	attr_index_build();
+
 	/* Don't submit any work until the stack is initialized */
 	if (!atomic_test_bit(gatt_flags, GATT_INITIALIZED)) {
 		k_sched_unlock();
@@ -2074,6 +2086,191 @@ static void foreach_attr_type_dyndb(uint16_t start_handle, uint16_t end_handle,
 #endif /* CONFIG_BT_GATT_DYNAMIC_DB */
 }
 
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+/* Attributes of the database sorted by handle, rebuilt when services are
+ * registered or unregistered. The entries with a 16-bit UUID, including
+ * 32 and 128-bit UUIDs aliasing one, are also sorted by UUID then handle.
+ */
+struct attr_index_entry {
+	const struct bt_gatt_attr *attr;
+	uint16_t handle;
+	uint16_t uuid16;
+};
+
+static struct {
+	bool valid;
+	uint16_t count;
+	uint16_t uuid_count;
+	struct attr_index_entry entries[CONFIG_BT_GATT_ATTR_INDEX_SIZE];
+	uint16_t by_uuid[CONFIG_BT_GATT_ATTR_INDEX_SIZE];
+} attr_index;
+
+/* 16-bit value of an UUID, 0 if it cannot be represented on 16 bits */
+static uint16_t attr_index_uuid16(const struct bt_uuid *uuid)
+{
+	struct bt_uuid_16 alias = BT_UUID_INIT_16(0);
+
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		return BT_UUID_16(uuid)->val;
+	case BT_UUID_TYPE_32:
+		return BT_UUID_32(uuid)->val <= UINT16_MAX ? BT_UUID_32(uuid)->val : 0;
+	case BT_UUID_TYPE_128:
+		alias.val = sys_get_le16(&BT_UUID_128(uuid)->val[12]);
+		return bt_uuid_cmp(uuid, &alias.uuid) ? 0 : alias.val;
+	default:
+		return 0;
+	}
+}
+
+static uint8_t attr_index_add(const struct bt_gatt_attr *attr, uint16_t handle,
+			      void *user_data)
+{
+	struct attr_index_entry *entry;
+	bool *overflow = user_data;
+
+	if (attr_index.count == ARRAY_SIZE(attr_index.entries)) {
+		*overflow = true;
+		return BT_GATT_ITER_STOP;
+	}
+
+	entry = &attr_index.entries[attr_index.count];
+	entry->attr = attr;
+	entry->handle = handle;
+	entry->uuid16 = attr_index_uuid16(attr->uuid);
+
+	if (entry->uuid16) {
+		attr_index.by_uuid[attr_index.uuid_count++] = attr_index.count;
+	}
+
+	attr_index.count++;
+
+	return BT_GATT_ITER_CONTINUE;
+}
+
+static int attr_index_uuid_cmp(const void *a, const void *b)
+{
+	uint16_t idx_a = *(const uint16_t *)a;
+	uint16_t idx_b = *(const uint16_t *)b;
+	uint16_t uuid_a = attr_index.entries[idx_a].uuid16;
+	uint16_t uuid_b = attr_index.entries[idx_b].uuid16;
+
+	/* Entries are in handle order, so the index orders equal UUIDs */
+	if (uuid_a != uuid_b) {
+		return uuid_a < uuid_b ? -1 : 1;
+	}
+
+	return (int)idx_a - (int)idx_b;
+}
+
+static void attr_index_build(void)
+{
+	bool overflow = false;
+
+	/* Fill the index by walking the services */
+	attr_index.valid = false;
+	attr_index.count = 0;
+	attr_index.uuid_count = 0;
+
+	bt_gatt_foreach_attr(BT_ATT_FIRST_ATTRIBUTE_HANDLE, BT_ATT_LAST_ATTRIBUTE_HANDLE,
+			     attr_index_add, &overflow);
+	if (overflow) {
+		LOG_WRN("More than %u attributes, lookups not indexed",
+			CONFIG_BT_GATT_ATTR_INDEX_SIZE);
+		return;
+	}
+
+	qsort(attr_index.by_uuid, attr_index.uuid_count, sizeof(attr_index.by_uuid[0]),
+	      attr_index_uuid_cmp);
+
+	attr_index.valid = true;
+}
+
+/* Position of the first entry at or after handle */
+static uint16_t attr_index_find(uint16_t handle)
+{
+	uint16_t lo = 0;
+	uint16_t hi = attr_index.count;
+
+	while (lo < hi) {
+		uint16_t mid = lo + (hi - lo) / 2;
+
+		if (attr_index.entries[mid].handle < handle) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+/* Position in the UUID table of the first entry of uuid16 at or after handle */
+static uint16_t attr_index_find_uuid(uint16_t uuid16, uint16_t handle)
+{
+	uint16_t lo = 0;
+	uint16_t hi = attr_index.uuid_count;
+
+	while (lo < hi) {
+		uint16_t mid = lo + (hi - lo) / 2;
+		const struct attr_index_entry *entry =
+			&attr_index.entries[attr_index.by_uuid[mid]];
+
+		if (entry->uuid16 < uuid16 ||
+		    (entry->uuid16 == uuid16 && entry->handle < handle)) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+static void foreach_attr_type_index(uint16_t start_handle, uint16_t end_handle,
+				    const struct bt_uuid *uuid,
+				    const void *attr_data, uint16_t num_matches,
+				    bt_gatt_attr_func_t func, void *user_data)
+{
+	const struct attr_index_entry *entry;
+	uint16_t uuid16 = uuid ? attr_index_uuid16(uuid) : 0;
+	uint16_t i;
+
+	if (uuid16) {
+		for (i = attr_index_find_uuid(uuid16, start_handle);
+		     i < attr_index.uuid_count; i++) {
+			entry = &attr_index.entries[attr_index.by_uuid[i]];
+
+			if (entry->uuid16 != uuid16) {
+				return;
+			}
+
+			if (gatt_foreach_iter(entry->attr, entry->handle,
+					      start_handle, end_handle,
+					      uuid, attr_data, &num_matches,
+					      func, user_data) ==
+			    BT_GATT_ITER_STOP) {
+				return;
+			}
+		}
+
+		return;
+	}
+
+	for (i = attr_index_find(start_handle); i < attr_index.count; i++) {
+		entry = &attr_index.entries[i];
+
+		if (gatt_foreach_iter(entry->attr, entry->handle,
+				      start_handle, end_handle,
+				      uuid, attr_data, &num_matches,
+				      func, user_data) ==
+		    BT_GATT_ITER_STOP) {
+			return;
+		}
+	}
+}
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
+
 void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 			       const struct bt_uuid *uuid,
 			       const void *attr_data, uint16_t num_matches,
@@ -2085,6 +2282,15 @@ void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 		num_matches = UINT16_MAX;
 	}
 
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+	if (attr_index.valid) {
+		foreach_attr_type_index(start_handle, end_handle, uuid,
+					attr_data, num_matches, func,
+					user_data);
+		return;
+	}
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
+
 	if (start_handle <= last_static_handle) {
 		uint16_t handle = 1;
 
@@ -2444,11 +2650,14 @@ static int gatt_notify_mult(struct bt_conn *conn, uint16_t handle,
 			    struct bt_gatt_notify_params *params)
 {
 	struct net_buf **buf = &nfy_mult[bt_conn_index(conn)];
+	const size_t entry_len = sizeof(struct bt_att_notify_mult) + params->len;
+	const uint16_t mtu = bt_att_get_mtu(conn);
 
 	/* Check if we can fit more data into it, in case it doesn't fit send
-	 * the existing buffer and proceed to create a new one
+	 * the existing buffer and proceed to create a new one. The PDU is
+	 * bound by the ATT MTU of the bearers, not only by the buffer size.
 	 */
-	if (*buf && ((net_buf_tailroom(*buf) < sizeof(struct bt_att_notify_mult) + params->len) ||
+	if (*buf && ((net_buf_tailroom(*buf) < entry_len) || ((*buf)->len + entry_len > mtu) ||
 	    !bt_att_tx_meta_data_match(*buf, params->func, params->user_data,
 				       BT_ATT_CHAN_OPT(params)))) {
 		int ret;
@@ -2479,6 +2688,13 @@ static int gatt_notify_mult(struct bt_conn *conn, uint16_t handle,
 	LOG_DBG("handle 0x%04x len %u", handle, params->len);
 	gatt_add_nfy_to_buf(*buf, handle, params);
 
+	/* Don't wait for the deadline when no other value would fit */
+	if ((*buf)->len + sizeof(struct bt_att_notify_mult) + 1 > mtu ||
+	    net_buf_tailroom(*buf) <= sizeof(struct bt_att_notify_mult)) {
+		LOG_DBG("PDU full, sending");
+		return gatt_notify_flush(conn);
+	}
+
 	/* Use `k_work_schedule` to keep the original deadline, instead of
 	 * re-setting the timeout whenever a new notification is appended.
 	 */
@@ -4654,9 +4654,16 @@ static void tx_processor(struct k_work *item)
 		return;
 	}
 
-	/* Hand over control to conn to process pending data */
+	/* Hand over control to conn to process pending data. Commands keep
+	 * their precedence: the burst ends as soon as one is queued.
+	 */
 	if (IS_ENABLED(CONFIG_BT_CONN_TX)) {
-		bt_conn_tx_processor();
+		for (int i = 0; i < CONFIG_BT_CONN_TX_BURST; i++) {
+			if (!bt_conn_tx_processor() ||
+			    !k_fifo_is_empty(&bt_dev.cmd_tx_queue)) {
+				break;
+			}
+		}
 	}
 }
 
@@ -944,6 +944,49 @@ int bt_iso_chan_send_ts(struct bt_iso_chan *chan, struct net_buf *buf, uint16_t
 	return conn_iso_send(iso_conn, buf, BT_ISO_TS_PRESENT);
 }
 
+void bt_iso_tx_stream_start(struct bt_iso_tx_stream *stream, struct bt_iso_chan *chan,
+			    uint16_t seq_num, uint32_t ts, uint32_t interval)
+{
+	__ASSERT_NO_MSG(stream != NULL && stream->pool != NULL);
+
+	stream->chan = chan;
+	stream->seq_num = seq_num;
+	stream->ts = ts;
+	stream->interval = interval;
+}
+
+struct net_buf *bt_iso_tx_stream_buf_get(struct bt_iso_tx_stream *stream, k_timeout_t timeout)
+{
+	struct net_buf *buf;
+
+	buf = net_buf_alloc(stream->pool, timeout);
+	if (buf != NULL) {
+		net_buf_reserve(buf, BT_ISO_CHAN_SEND_RESERVE);
+	}
+
+	return buf;
+}
+
+int bt_iso_tx_stream_send(struct bt_iso_tx_stream *stream, struct net_buf *buf)
+{
+	int err;
+
+	err = bt_iso_chan_send_ts(stream->chan, buf, stream->seq_num, stream->ts);
+	if (err != 0) {
+		return err;
+	}
+
+	bt_iso_tx_stream_skip(stream, 1);
+
+	return 0;
+}
+
+void bt_iso_tx_stream_skip(struct bt_iso_tx_stream *stream, uint16_t count)
+{
+	stream->seq_num += count;
+	stream->ts += (uint32_t)count * stream->interval;
+}
+
 #if defined(CONFIG_BT_ISO_CENTRAL) || defined(CONFIG_BT_ISO_BROADCASTER)
 static bool valid_chan_io_qos(const struct bt_iso_chan_io_qos *io_qos,
 			      bool is_tx, bool is_broadcast, bool advanced)
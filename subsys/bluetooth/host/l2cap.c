@@ -1204,7 +1204,7 @@ static void l2cap_chan_rx_init(struct bt_l2cap_le_chan *chan)
 	/* Truncate MTU if channel have disabled segmentation but still have
 	 * set an MTU which requires it.
 	 */
-	if (!chan->chan.ops->alloc_buf &&
+	if (!chan->chan.ops->alloc_buf && !chan->chan.ops->alloc_sdu &&
 	    (chan->rx.mps < chan->rx.mtu + BT_L2CAP_SDU_HDR_SIZE)) {
 		LOG_WRN("Segmentation disabled but MTU > MPS, truncating MTU");
 		chan->rx.mtu = chan->rx.mps - BT_L2CAP_SDU_HDR_SIZE;
@@ -2409,6 +2409,27 @@ static struct net_buf *l2cap_alloc_frag(k_timeout_t timeout, void *user_data)
 	return frag;
 }
 
+static struct net_buf *l2cap_alloc_sdu(struct bt_l2cap_le_chan *chan, uint16_t sdu_len)
+{
+	struct net_buf *sdu;
+
+	sdu = chan->chan.ops->alloc_sdu(&chan->chan, sdu_len);
+	if (!sdu) {
+		return NULL;
+	}
+
+	/* Segments are only appended, never chained to new fragments */
+	if (net_buf_tailroom(sdu) < sdu_len) {
+		LOG_WRN("SDU buffer too small (%zu < %u)", net_buf_tailroom(sdu), sdu_len);
+		net_buf_unref(sdu);
+		return NULL;
+	}
+
+	LOG_DBG("sdu %p sdu_len %u", sdu, sdu_len);
+
+	return sdu;
+}
+
 static void l2cap_chan_le_recv_sdu(struct bt_l2cap_le_chan *chan,
 				   struct net_buf *buf, uint16_t seg)
 {
@@ -2584,8 +2605,16 @@ static void l2cap_chan_le_recv(struct bt_l2cap_le_chan *chan,
 	}
 
 	/* Always allocate buffer from the channel if supported. */
-	if (chan->chan.ops->alloc_buf) {
-		chan->_sdu = chan->chan.ops->alloc_buf(&chan->chan);
+	if (chan->chan.ops->alloc_sdu || chan->chan.ops->alloc_buf) {
+		/* Let the application place the SDU in its own buffer */
+		if (chan->chan.ops->alloc_sdu) {
+			chan->_sdu = l2cap_alloc_sdu(chan, sdu_len);
+		}
+
+		if (!chan->_sdu && chan->chan.ops->alloc_buf) {
+			chan->_sdu = chan->chan.ops->alloc_buf(&chan->chan);
+		}
+
 		if (!chan->_sdu) {
 			LOG_ERR("Unable to allocate buffer for SDU");
 			bt_l2cap_chan_disconnect(&chan->chan);
@@ -115,6 +115,10 @@ static struct bt_mesh_adv *adv_create_from_pool(struct k_mem_slab *buf_pool,
 	ctx->tag          = tag;
 	ctx->xmit         = xmit;
 
+#if defined(CONFIG_BT_MESH_STATISTIC)
+	ctx->created      = k_uptime_get_32();
+#endif
+
 	return adv;
 }
 
@@ -49,6 +49,11 @@ struct bt_mesh_adv_ctx {
 		  tag:4;
 
 	uint8_t      xmit;
+
+#if defined(CONFIG_BT_MESH_STATISTIC)
+	/* Uptime at creation, in milliseconds */
+	uint32_t     created;
+#endif
 };
 
 struct bt_mesh_adv {
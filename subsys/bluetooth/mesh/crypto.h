@@ -20,6 +20,20 @@ struct bt_mesh_sg {
 
 int bt_mesh_crypto_init(void);
 
+/* AES on a crypto driver for the TinyCrypt backend, -ENOTSUP if not possible */
+int bt_mesh_crypto_drv_init(void);
+
+int bt_mesh_crypto_drv_ecb(const uint8_t key[16], const uint8_t plaintext[16],
+			   uint8_t enc_data[16]);
+
+int bt_mesh_crypto_drv_ccm_encrypt(const uint8_t key[16], uint8_t nonce[13],
+				   const uint8_t *plaintext, size_t len, const uint8_t *aad,
+				   size_t aad_len, uint8_t *enc_data, size_t mic_size);
+
+int bt_mesh_crypto_drv_ccm_decrypt(const uint8_t key[16], uint8_t nonce[13],
+				   const uint8_t *enc_data, size_t len, const uint8_t *aad,
+				   size_t aad_len, uint8_t *plaintext, size_t mic_size);
+
 int bt_mesh_encrypt(const struct bt_mesh_key *key, const uint8_t plaintext[16],
 		    uint8_t enc_data[16]);
 
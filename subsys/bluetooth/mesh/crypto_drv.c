@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * AES-ECB and AES-CCM on a crypto driver, for the TinyCrypt backend. Opening
+ * a session loads the key in the engine, so a session is kept per recently
+ * used key and operation, and evicted in least recently used order.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/crypto/crypto.h>
+#include <zephyr/bluetooth/mesh.h>
+
+#define LOG_LEVEL CONFIG_BT_MESH_CRYPTO_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(bt_mesh_crypto_drv);
+
+#include "mesh.h"
+#include "crypto.h"
+
+#define NONCE_LEN 13
+#define MIC_MAX   16
+
+/* Largest payload of an in-place operation on a driver needing separate
+ * buffers. Covers the network PDUs; the larger transport PDUs go to TinyCrypt.
+ */
+#define BOUNCE_LEN 32
+
+struct drv_session {
+	struct cipher_ctx ctx;
+	uint8_t key[16];
+	enum cipher_mode mode;
+	enum cipher_op op;
+	uint8_t mic_size;
+	bool open;
+	uint32_t last_used;
+};
+
+static struct {
+	const struct device *dev;
+	uint16_t flags;
+	/* Bit (mode * 2 + op) set for each supported mode and operation */
+	uint16_t supported;
+	struct k_mutex lock;
+	struct k_sem done;
+	int status;
+	uint32_t uses;
+	struct drv_session sessions[CONFIG_BT_MESH_CRYPTO_DRIVER_SESSIONS];
+	uint8_t bounce[BOUNCE_LEN + MIC_MAX];
+} drv;
+
+static void drv_op_done(struct cipher_pkt *pkt, int status)
+{
+	ARG_UNUSED(pkt);
+
+	drv.status = status;
+	k_sem_give(&drv.done);
+}
+
+/* Wait for the completion of an asynchronous operation */
+static int drv_wait(int err)
+{
+	if (err || !(drv.flags & CAP_ASYNC_OPS)) {
+		return err;
+	}
+
+	k_sem_take(&drv.done, K_FOREVER);
+
+	return drv.status;
+}
+
+static void drv_session_free(struct drv_session *s)
+{
+	if (s->open) {
+		(void)cipher_free_session(drv.dev, &s->ctx);
+		s->open = false;
+	}
+}
+
+static struct cipher_ctx *session_get(const uint8_t key[16], enum cipher_mode mode,
+				      enum cipher_op op, uint8_t mic_size)
+{
+	struct drv_session *entry = &drv.sessions[0];
+	int err;
+
+	if (!(drv.supported & BIT(mode * 2 + op))) {
+		return NULL;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(drv.sessions); i++) {
+		struct drv_session *s = &drv.sessions[i];
+
+		if (s->open && s->mode == mode && s->op == op && s->mic_size == mic_size &&
+		    !memcmp(s->key, key, 16)) {
+			s->last_used = ++drv.uses;
+			return &s->ctx;
+		}
+
+		if (!entry->open) {
+			continue;
+		}
+
+		if (!s->open || (int32_t)(s->last_used - entry->last_used) < 0) {
+			entry = s;
+		}
+	}
+
+	drv_session_free(entry);
+
+	memcpy(entry->key, key, 16);
+	entry->mode = mode;
+	entry->op = op;
+	entry->mic_size = mic_size;
+	entry->ctx = (struct cipher_ctx){
+		.key.bit_stream = entry->key,
+		.keylen = 16,
+		.flags = drv.flags,
+	};
+
+	if (mode == CRYPTO_CIPHER_MODE_CCM) {
+		entry->ctx.mode_params.ccm_info.tag_len = mic_size;
+		entry->ctx.mode_params.ccm_info.nonce_len = NONCE_LEN;
+	}
+
+	err = cipher_begin_session(drv.dev, &entry->ctx, CRYPTO_CIPHER_ALGO_AES, mode, op);
+	if (err) {
+		LOG_DBG("No session for mode %u op %u (err %d)", mode, op, err);
+		return NULL;
+	}
+
+	entry->open = true;
+	entry->last_used = ++drv.uses;
+
+	return &entry->ctx;
+}
+
+/* Stage the input of an in-place operation if the driver cannot do it */
+static const uint8_t *drv_input(const uint8_t *in, const uint8_t *out, size_t len)
+{
+	if (in != out || (drv.flags & CAP_INPLACE_OPS)) {
+		return in;
+	}
+
+	if (len > sizeof(drv.bounce)) {
+		return NULL;
+	}
+
+	memcpy(drv.bounce, in, len);
+
+	return drv.bounce;
+}
+
+int bt_mesh_crypto_drv_ecb(const uint8_t key[16], const uint8_t plaintext[16],
+			   uint8_t enc_data[16])
+{
+	struct cipher_pkt pkt = {
+		.in_len = 16,
+		.out_buf = enc_data,
+		.out_buf_max = 16,
+	};
+	struct cipher_ctx *ctx;
+	int err;
+
+	if (!drv.dev) {
+		return -ENOTSUP;
+	}
+
+	k_mutex_lock(&drv.lock, K_FOREVER);
+
+	ctx = session_get(key, CRYPTO_CIPHER_MODE_ECB, CRYPTO_CIPHER_OP_ENCRYPT, 0);
+	if (!ctx) {
+		err = -ENOTSUP;
+		goto unlock;
+	}
+
+	pkt.in_buf = (uint8_t *)drv_input(plaintext, enc_data, 16);
+	err = drv_wait(cipher_block_op(ctx, &pkt));
+
+unlock:
+	k_mutex_unlock(&drv.lock);
+
+	return err;
+}
+
+int bt_mesh_crypto_drv_ccm_encrypt(const uint8_t key[16], uint8_t nonce[13],
+				   const uint8_t *plaintext, size_t len, const uint8_t *aad,
+				   size_t aad_len, uint8_t *enc_data, size_t mic_size)
+{
+	uint8_t tag[MIC_MAX];
+	struct cipher_pkt pkt = {
+		.in_len = len,
+		.out_buf = enc_data,
+		.out_buf_max = len + mic_size,
+	};
+	struct cipher_aead_pkt aead = {
+		.pkt = &pkt,
+		.ad = (uint8_t *)aad,
+		.ad_len = aad_len,
+		.tag = tag,
+	};
+	struct cipher_ctx *ctx;
+	int err;
+
+	if (!drv.dev || mic_size > MIC_MAX) {
+		return -ENOTSUP;
+	}
+
+	k_mutex_lock(&drv.lock, K_FOREVER);
+
+	pkt.in_buf = (uint8_t *)drv_input(plaintext, enc_data, len);
+	if (!pkt.in_buf) {
+		err = -ENOTSUP;
+		goto unlock;
+	}
+
+	ctx = session_get(key, CRYPTO_CIPHER_MODE_CCM, CRYPTO_CIPHER_OP_ENCRYPT, mic_size);
+	if (!ctx) {
+		err = -ENOTSUP;
+		goto unlock;
+	}
+
+	err = drv_wait(cipher_ccm_op(ctx, &aead, nonce));
+	if (!err) {
+		/* Drivers either write the MIC after the output or only to the tag */
+		memcpy(&enc_data[len], tag, mic_size);
+	}
+
+unlock:
+	k_mutex_unlock(&drv.lock);
+
+	return err;
+}
+
+int bt_mesh_crypto_drv_ccm_decrypt(const uint8_t key[16], uint8_t nonce[13],
+				   const uint8_t *enc_data, size_t len, const uint8_t *aad,
+				   size_t aad_len, uint8_t *plaintext, size_t mic_size)
+{
+	struct cipher_pkt pkt = {
+		.in_len = len,
+		.out_buf = plaintext,
+		.out_buf_max = len,
+	};
+	struct cipher_aead_pkt aead = {
+		.pkt = &pkt,
+		.ad = (uint8_t *)aad,
+		.ad_len = aad_len,
+	};
+	struct cipher_ctx *ctx;
+	int err;
+
+	if (!drv.dev || mic_size > MIC_MAX) {
+		return -ENOTSUP;
+	}
+
+	k_mutex_lock(&drv.lock, K_FOREVER);
+
+	/* The MIC follows the encrypted data, as some drivers require */
+	pkt.in_buf = (uint8_t *)drv_input(enc_data, plaintext, len + mic_size);
+	if (!pkt.in_buf) {
+		err = -ENOTSUP;
+		goto unlock;
+	}
+
+	aead.tag = pkt.in_buf + len;
+
+	ctx = session_get(key, CRYPTO_CIPHER_MODE_CCM, CRYPTO_CIPHER_OP_DECRYPT, mic_size);
+	if (!ctx) {
+		err = -ENOTSUP;
+		goto unlock;
+	}
+
+	err = drv_wait(cipher_ccm_op(ctx, &aead, nonce));
+
+unlock:
+	k_mutex_unlock(&drv.lock);
+
+	return err;
+}
+
+int bt_mesh_crypto_drv_init(void)
+{
+	static const uint8_t zero_key[16];
+	const struct device *dev;
+	int caps;
+
+	k_mutex_init(&drv.lock);
+	k_sem_init(&drv.done, 0, 1);
+
+	dev = device_get_binding(CONFIG_BT_MESH_CRYPTO_DRIVER_DEV);
+	if (!dev) {
+		LOG_WRN("No crypto device %s, using TinyCrypt", CONFIG_BT_MESH_CRYPTO_DRIVER_DEV);
+		return 0;
+	}
+
+	caps = crypto_query_hwcaps(dev);
+	if (!(caps & CAP_RAW_KEY)) {
+		LOG_WRN("Crypto device needs opaque keys, using TinyCrypt");
+		return 0;
+	}
+
+	drv.flags = CAP_RAW_KEY;
+	drv.flags |= (caps & CAP_INPLACE_OPS) ? CAP_INPLACE_OPS : CAP_SEPARATE_IO_BUFS;
+
+	if (caps & CAP_SYNC_OPS) {
+		drv.flags |= CAP_SYNC_OPS;
+	} else if (!cipher_callback_set(dev, drv_op_done)) {
+		drv.flags |= CAP_ASYNC_OPS;
+	} else {
+		LOG_WRN("No completion callback on crypto device, using TinyCrypt");
+		return 0;
+	}
+
+	drv.dev = dev;
+
+	/* Probe the modes, so unsupported ones never evict a session */
+	drv.supported = BIT(CRYPTO_CIPHER_MODE_ECB * 2 + CRYPTO_CIPHER_OP_ENCRYPT) |
+			BIT(CRYPTO_CIPHER_MODE_CCM * 2 + CRYPTO_CIPHER_OP_ENCRYPT) |
+			BIT(CRYPTO_CIPHER_MODE_CCM * 2 + CRYPTO_CIPHER_OP_DECRYPT);
+
+	for (int mode = CRYPTO_CIPHER_MODE_ECB; mode <= CRYPTO_CIPHER_MODE_CCM; mode++) {
+		for (int op = CRYPTO_CIPHER_OP_DECRYPT; op <= CRYPTO_CIPHER_OP_ENCRYPT; op++) {
+			uint16_t bit = BIT(mode * 2 + op);
+
+			if (!(drv.supported & bit)) {
+				continue;
+			}
+
+			if (session_get(zero_key, mode, op, 4)) {
+				drv_session_free(&drv.sessions[0]);
+			} else {
+				LOG_WRN("Crypto device lacks mode %u op %u", mode, op);
+				drv.supported &= ~bit;
+			}
+		}
+	}
+
+	if (!drv.supported) {
+		drv.dev = NULL;
+	}
+
+	return 0;
+}
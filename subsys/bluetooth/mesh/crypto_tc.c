@@ -36,6 +36,14 @@ static struct {
 int bt_mesh_encrypt(const struct bt_mesh_key *key, const uint8_t plaintext[16],
 		    uint8_t enc_data[16])
 {
+#if defined(CONFIG_BT_MESH_CRYPTO_DRIVER)
+	int err = bt_mesh_crypto_drv_ecb(key->key, plaintext, enc_data);
+
+	if (err != -ENOTSUP) {
+		return err;
+	}
+#endif
+
 	return bt_encrypt_be(key->key, plaintext, enc_data);
 }
 
@@ -43,6 +51,15 @@ int bt_mesh_ccm_encrypt(const struct bt_mesh_key *key, uint8_t nonce[13], const
 			size_t len, const uint8_t *aad, size_t aad_len, uint8_t *enc_data,
 			size_t mic_size)
 {
+#if defined(CONFIG_BT_MESH_CRYPTO_DRIVER)
+	int err = bt_mesh_crypto_drv_ccm_encrypt(key->key, nonce, plaintext, len, aad, aad_len,
+						 enc_data, mic_size);
+
+	if (err != -ENOTSUP) {
+		return err;
+	}
+#endif
+
 	return bt_ccm_encrypt(key->key, nonce, plaintext, len, aad, aad_len, enc_data, mic_size);
 }
 
@@ -50,6 +67,15 @@ int bt_mesh_ccm_decrypt(const struct bt_mesh_key *key, uint8_t nonce[13], const
 			size_t len, const uint8_t *aad, size_t aad_len, uint8_t *plaintext,
 			size_t mic_size)
 {
+#if defined(CONFIG_BT_MESH_CRYPTO_DRIVER)
+	int err = bt_mesh_crypto_drv_ccm_decrypt(key->key, nonce, enc_data, len, aad, aad_len,
+						 plaintext, mic_size);
+
+	if (err != -ENOTSUP) {
+		return err;
+	}
+#endif
+
 	return bt_ccm_decrypt(key->key, nonce, enc_data, len, aad, aad_len, plaintext, mic_size);
 }
 
@@ -152,5 +178,9 @@ __weak int default_CSPRNG(uint8_t *dst, unsigned int len)
 
 int bt_mesh_crypto_init(void)
 {
+	if (IS_ENABLED(CONFIG_BT_MESH_CRYPTO_DRIVER)) {
+		return bt_mesh_crypto_drv_init();
+	}
+
 	return 0;
 }
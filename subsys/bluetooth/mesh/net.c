@@ -75,9 +75,22 @@ struct iv_val {
 static struct {
 	uint32_t src : 15, /* MSb of source is always 0 */
 	      seq : 17;
+#if defined(CONFIG_BT_MESH_MSG_CACHE_HASH)
+	uint16_t next; /* Next entry of the bucket plus one, 0 ends the chain */
+#endif
 } msg_cache[CONFIG_BT_MESH_MSG_CACHE_SIZE];
 static uint16_t msg_cache_next;
 
+#if defined(CONFIG_BT_MESH_MSG_CACHE_HASH)
+#define MSG_CACHE_BUCKETS CONFIG_BT_MESH_MSG_CACHE_HASH_BUCKETS
+
+BUILD_ASSERT(IS_POWER_OF_TWO(MSG_CACHE_BUCKETS), "Bucket count must be a power of two");
+
+/* First entry of each bucket plus one, entries are chained newest first */
+static uint16_t msg_cache_buckets[MSG_CACHE_BUCKETS];
+static uint16_t msg_cache_count;
+#endif
+
 /* Singleton network context (the implementation only supports one) */
 struct bt_mesh_net bt_mesh = {
 	.local_queue = SYS_SLIST_STATIC_INIT(&bt_mesh.local_queue),
@@ -137,6 +150,80 @@ static bool check_dup(struct net_buf_simple *data)
 	return false;
 }
 
+#if defined(CONFIG_BT_MESH_MSG_CACHE_HASH)
+static uint16_t msg_cache_bucket(uint16_t src, uint32_t seq)
+{
+	uint32_t hash = (((uint32_t)src << 17) | seq) * 2654435761U;
+
+	return (hash ^ (hash >> 16)) & (MSG_CACHE_BUCKETS - 1);
+}
+
+static void msg_cache_reset(void)
+{
+	(void)memset(msg_cache, 0, sizeof(msg_cache));
+	(void)memset(msg_cache_buckets, 0, sizeof(msg_cache_buckets));
+	msg_cache_next = 0U;
+	msg_cache_count = 0U;
+}
+
+static bool msg_cache_match(struct net_buf_simple *pdu)
+{
+	uint16_t src = SRC(pdu->data);
+	uint32_t seq = SEQ(pdu->data) & BIT_MASK(17);
+	uint16_t i;
+
+	for (i = msg_cache_buckets[msg_cache_bucket(src & BIT_MASK(15), seq)]; i > 0U;
+	     i = msg_cache[i - 1].next) {
+		if (msg_cache[i - 1].src == src && msg_cache[i - 1].seq == seq) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Unlink the oldest entry, about to be overwritten */
+static void msg_cache_evict(uint16_t idx)
+{
+	uint16_t *link = &msg_cache_buckets[msg_cache_bucket(msg_cache[idx].src,
+							     msg_cache[idx].seq)];
+
+	while (*link != idx + 1U) {
+		__ASSERT_NO_MSG(*link > 0U);
+		link = &msg_cache[*link - 1].next;
+	}
+
+	*link = msg_cache[idx].next;
+}
+
+static void msg_cache_add(struct bt_mesh_net_rx *rx)
+{
+	uint16_t bucket;
+
+	msg_cache_next %= ARRAY_SIZE(msg_cache);
+
+	if (msg_cache_count == ARRAY_SIZE(msg_cache)) {
+		msg_cache_evict(msg_cache_next);
+	} else {
+		msg_cache_count++;
+	}
+
+	msg_cache[msg_cache_next].src = rx->ctx.addr;
+	msg_cache[msg_cache_next].seq = rx->seq;
+
+	bucket = msg_cache_bucket(msg_cache[msg_cache_next].src, msg_cache[msg_cache_next].seq);
+	msg_cache[msg_cache_next].next = msg_cache_buckets[bucket];
+	msg_cache_buckets[bucket] = msg_cache_next + 1U;
+
+	msg_cache_next++;
+}
+#else
+static void msg_cache_reset(void)
+{
+	(void)memset(msg_cache, 0, sizeof(msg_cache));
+	msg_cache_next = 0U;
+}
+
 static bool msg_cache_match(struct net_buf_simple *pdu)
 {
 	uint16_t i;
@@ -165,6 +252,7 @@ static void msg_cache_add(struct bt_mesh_net_rx *rx)
 	msg_cache[msg_cache_next].seq = rx->seq;
 	msg_cache_next++;
 }
+#endif /* CONFIG_BT_MESH_MSG_CACHE_HASH */
 
 static void store_iv(bool only_duration)
 {
@@ -207,8 +295,7 @@ int bt_mesh_net_create(uint16_t idx, uint8_t flags, const struct bt_mesh_key *ke
 		return err;
 	}
 
-	(void)memset(msg_cache, 0, sizeof(msg_cache));
-	msg_cache_next = 0U;
+	msg_cache_reset();
 
 	bt_mesh.iv_index = iv_index;
 	atomic_set_bit_to(bt_mesh.flags, BT_MESH_IVU_IN_PROGRESS,
@@ -647,6 +734,11 @@ static bool net_decrypt(struct bt_mesh_net_rx *rx, struct net_buf_simple *in,
 
 	if (rx->net_if == BT_MESH_NET_IF_ADV && msg_cache_match(out)) {
 		LOG_DBG("Duplicate found in Network Message Cache");
+
+		if (IS_ENABLED(CONFIG_BT_MESH_STATISTIC)) {
+			bt_mesh_stat_rx_dup();
+		}
+
 		return false;
 	}
 
@@ -756,6 +848,29 @@ done:
 	bt_mesh_adv_unref(adv);
 }
 
+/* A unicast PDU for another node, which is neither an LPN of this Friend nor
+ * a Friend of this LPN, needs nothing from the transport layer: forward it to
+ * the bearers right away.
+ */
+static bool relay_fast_forward(struct bt_mesh_net_rx *rx)
+{
+	if (!IS_ENABLED(CONFIG_BT_MESH_RELAY) || IS_ENABLED(CONFIG_BT_TESTING) ||
+	    !BT_MESH_ADDR_IS_UNICAST(rx->ctx.recv_dst) || rx->local_match) {
+		return false;
+	}
+
+	if (IS_ENABLED(CONFIG_BT_MESH_LOW_POWER) && bt_mesh_lpn_established()) {
+		return false;
+	}
+
+	if (IS_ENABLED(CONFIG_BT_MESH_FRIEND)) {
+		rx->friend_match = bt_mesh_friend_match(rx->sub->net_idx,
+							rx->ctx.recv_dst);
+	}
+
+	return !rx->friend_match;
+}
+
 void bt_mesh_net_header_parse(struct net_buf_simple *buf,
 			      struct bt_mesh_net_rx *rx)
 {
@@ -782,6 +897,10 @@ int bt_mesh_net_decode(struct net_buf_simple *in, enum bt_mesh_net_if net_if,
 	}
 
 	if (net_if == BT_MESH_NET_IF_ADV && check_dup(in)) {
+		if (IS_ENABLED(CONFIG_BT_MESH_STATISTIC)) {
+			bt_mesh_stat_rx_dup();
+		}
+
 		return -EINVAL;
 	}
 
@@ -866,6 +985,11 @@ void bt_mesh_net_recv(struct net_buf_simple *data, int8_t rssi,
 		}
 	}
 
+	if (relay_fast_forward(&rx)) {
+		bt_mesh_net_relay(&buf, &rx);
+		return;
+	}
+
 	err = bt_mesh_trans_recv(&buf, &rx);
 	if (err == -EAGAIN) {
 		/* The transport layer has indicated that it has rejected the message,
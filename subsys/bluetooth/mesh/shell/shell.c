@@ -1620,12 +1620,19 @@ static int cmd_stat_get(const struct shell *sh, size_t argc, char *argv[])
 	shell_print(sh, "loopback:  %d", st.rx_loopback);
 	shell_print(sh, "proxy:     %d", st.rx_proxy);
 	shell_print(sh, "unknown:   %d", st.rx_uknown);
+	shell_print(sh, "Dropped duplicates: %d", st.rx_dup);
 
 	shell_print(sh, "Transmitted frames: <planned> - <succeeded>");
 	shell_print(sh, "relay adv:   %d - %d", st.tx_adv_relay_planned, st.tx_adv_relay_succeeded);
 	shell_print(sh, "local adv:   %d - %d", st.tx_local_planned, st.tx_local_succeeded);
 	shell_print(sh, "friend:      %d - %d", st.tx_friend_planned, st.tx_friend_succeeded);
 
+	if (st.tx_adv_relay_succeeded) {
+		shell_print(sh, "Relay latency: avg %u ms, max %u ms",
+			    st.tx_adv_relay_latency_sum / st.tx_adv_relay_succeeded,
+			    st.tx_adv_relay_latency_max);
+	}
+
 	return 0;
 }
 
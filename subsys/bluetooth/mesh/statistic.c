@@ -37,7 +37,11 @@ void bt_mesh_stat_succeeded_count(struct bt_mesh_adv_ctx *ctx)
 	if (ctx->tag == BT_MESH_ADV_TAG_LOCAL) {
 		stat.tx_local_succeeded++;
 	} else if (ctx->tag == BT_MESH_ADV_TAG_RELAY) {
+		uint32_t latency = k_uptime_get_32() - ctx->created;
+
 		stat.tx_adv_relay_succeeded++;
+		stat.tx_adv_relay_latency_sum += latency;
+		stat.tx_adv_relay_latency_max = MAX(stat.tx_adv_relay_latency_max, latency);
 	} else if (ctx->tag == BT_MESH_ADV_TAG_FRIEND) {
 		stat.tx_friend_succeeded++;
 	}
@@ -61,3 +65,8 @@ void bt_mesh_stat_rx(enum bt_mesh_net_if net_if)
 		break;
 	}
 }
+
+void bt_mesh_stat_rx_dup(void)
+{
+	stat.rx_dup++;
+}
@@ -34,6 +34,12 @@ static struct isotp_global_ctx global_ctx = {
 	.ff_sf_alloc_list = SYS_SLIST_STATIC_INIT(&global_ctx.ff_sf_alloc_list)
 };
 
+#ifdef CONFIG_ISOTP_RX_USER_BUF
+/* Buffers pointing to the user buffers given with isotp_set_recv_buf() */
+NET_BUF_POOL_DEFINE(isotp_rx_user_pool, CONFIG_ISOTP_RX_USER_BUF_COUNT, 0,
+		    sizeof(uint32_t), NULL);
+#endif
+
 #ifdef CONFIG_ISOTP_USE_TX_BUF
 NET_BUF_POOL_VAR_DEFINE(isotp_tx_pool, CONFIG_ISOTP_TX_BUF_COUNT,
 			CONFIG_ISOTP_BUF_TX_DATA_POOL_SIZE, 0, NULL);
@@ -266,6 +272,51 @@ static int receive_alloc_buffer(struct isotp_recv_ctx *rctx)
 	return 0;
 }
 
+#ifdef CONFIG_ISOTP_RX_USER_BUF
+/*
+ * Move the FF payload to the user buffer, so that the CFs are written there
+ * straight from the CAN frames. Returns false if the pool buffers are used.
+ */
+static bool receive_take_user_buf(struct isotp_recv_ctx *rctx)
+{
+	struct net_buf *buf;
+
+	if (rctx->user_buf == NULL) {
+		return false;
+	}
+
+	if (rctx->length > rctx->user_buf_size) {
+		LOG_ERR("Pkt length is %d but user buffer has only %zu bytes", rctx->length,
+			rctx->user_buf_size);
+		receive_report_error(rctx, ISOTP_N_BUFFER_OVERFLW);
+		return true;
+	}
+
+	buf = net_buf_alloc_with_data(&isotp_rx_user_pool, rctx->user_buf, rctx->user_buf_size,
+				      K_NO_WAIT);
+	if (!buf) {
+		LOG_DBG("No buffer left for the user buffer. Use the pool");
+		return false;
+	}
+
+	net_buf_reset(buf);
+	net_buf_add_mem(buf, rctx->buf->data, rctx->buf->len);
+	net_buf_unref(rctx->buf);
+
+	rctx->buf = buf;
+	rctx->act_frag = buf;
+	rctx->user_buf = NULL;
+	rctx->is_user_buf = 1;
+	rctx->length -= buf->len;
+	rctx->bs = rctx->opts.bs;
+	rctx->state = ISOTP_RX_STATE_SEND_FC;
+
+	return true;
+}
+#else
+#define receive_take_user_buf(rctx) false
+#endif /* CONFIG_ISOTP_RX_USER_BUF */
+
 static void receive_state_machine(struct isotp_recv_ctx *rctx)
 {
 	int ret;
@@ -286,6 +337,12 @@ static void receive_state_machine(struct isotp_recv_ctx *rctx)
 	case ISOTP_RX_STATE_PROCESS_FF:
 		rctx->length = receive_get_ff_length(rctx->buf);
 		LOG_DBG("SM process FF. Length: %d", rctx->length);
+		if (receive_take_user_buf(rctx)) {
+			/* No allocation needed, or overflow */
+			receive_state_machine(rctx);
+			break;
+		}
+
 		rctx->length -= rctx->buf->len;
 		if (rctx->opts.bs == 0 &&
 		    rctx->length > CONFIG_ISOTP_RX_BUF_COUNT * CONFIG_ISOTP_RX_BUF_SIZE) {
@@ -352,6 +409,7 @@ static void receive_state_machine(struct isotp_recv_ctx *rctx)
 		__fallthrough;
 	case ISOTP_RX_STATE_RECYCLE:
 		LOG_DBG("SM recycle context for next message");
+		rctx->is_user_buf = 0;
 		rctx->buf = net_buf_alloc_fixed(&isotp_rx_sf_ff_pool, K_NO_WAIT);
 		if (!rctx->buf) {
 			LOG_DBG("No free context. Append to waiters list");
@@ -543,8 +601,16 @@ static void process_cf(struct isotp_recv_ctx *rctx, struct can_frame *frame)
 	}
 
 	if (rctx->opts.bs && !--rctx->bs) {
-		LOG_DBG("Block is complete. Allocate new buffer");
 		rctx->bs = rctx->opts.bs;
+
+		if (rctx->is_user_buf) {
+			/* The whole message fits in the user buffer */
+			LOG_DBG("Block is complete. Send next FC");
+			rctx->state = ISOTP_RX_STATE_SEND_FC;
+			return;
+		}
+
+		LOG_DBG("Block is complete. Allocate new buffer");
 		*ud_rem_len = rctx->length;
 		net_buf_put(&rctx->fifo, rctx->buf);
 		rctx->state = ISOTP_RX_STATE_TRY_ALLOC;
@@ -637,6 +703,10 @@ int isotp_bind(struct isotp_recv_ctx *rctx, const struct device *can_dev,
 
 	rctx->opts = *opts;
 	rctx->state = ISOTP_RX_STATE_WAIT_FF_SF;
+	rctx->is_user_buf = 0;
+#ifdef CONFIG_ISOTP_RX_USER_BUF
+	rctx->user_buf = NULL;
+#endif
 
 	if ((rx_addr->flags & ISOTP_MSG_FDF) != 0 || (tx_addr->flags & ISOTP_MSG_FDF) != 0) {
 		ret = can_get_capabilities(can_dev, &cap);
@@ -683,6 +753,9 @@ void isotp_unbind(struct isotp_recv_ctx *rctx)
 	sys_slist_find_and_remove(&global_ctx.alloc_list, &rctx->alloc_node);
 
 	rctx->state = ISOTP_RX_STATE_UNBOUND;
+#ifdef CONFIG_ISOTP_RX_USER_BUF
+	rctx->user_buf = NULL;
+#endif
 
 	while ((buf = net_buf_get(&rctx->fifo, K_NO_WAIT))) {
 		net_buf_unref(buf);
@@ -715,6 +788,19 @@ int isotp_recv_net(struct isotp_recv_ctx *rctx, struct net_buf **buffer, k_timeo
 	return *(uint32_t *)net_buf_user_data(buf);
 }
 
+#ifdef CONFIG_ISOTP_RX_USER_BUF
+void isotp_set_recv_buf(struct isotp_recv_ctx *rctx, uint8_t *buf, size_t size)
+{
+	unsigned int key;
+
+	/* The buffer is taken by the work handler when a FF is received */
+	key = irq_lock();
+	rctx->user_buf = buf;
+	rctx->user_buf_size = size;
+	irq_unlock(key);
+}
+#endif /* CONFIG_ISOTP_RX_USER_BUF */
+
 int isotp_recv(struct isotp_recv_ctx *rctx, uint8_t *data, size_t len, k_timeout_t timeout)
 {
 	size_t copied, to_copy;
@@ -734,7 +820,10 @@ int isotp_recv(struct isotp_recv_ctx *rctx, uint8_t *data, size_t len, k_timeout
 	copied = 0;
 	while (rctx->recv_buf && copied < len) {
 		to_copy = MIN(len - copied, rctx->recv_buf->len);
-		memcpy((uint8_t *)data + copied, rctx->recv_buf->data, to_copy);
+		if (data + copied != rctx->recv_buf->data) {
+			/* Not already in place, see isotp_set_recv_buf() */
+			memcpy((uint8_t *)data + copied, rctx->recv_buf->data, to_copy);
+		}
 
 		if (rctx->recv_buf->len == to_copy) {
 			/* point recv_buf to next frag */
@@ -759,14 +848,15 @@ static inline void send_report_error(struct isotp_send_ctx *sctx, uint32_t err)
 static void send_can_tx_cb(const struct device *dev, int error, void *arg)
 {
 	struct isotp_send_ctx *sctx = (struct isotp_send_ctx *)arg;
+	atomic_val_t backlog;
 
 	ARG_UNUSED(dev);
 
-	sctx->tx_backlog--;
+	backlog = atomic_dec(&sctx->tx_backlog) - 1;
 	k_sem_give(&sctx->tx_sem);
 
 	if (sctx->state == ISOTP_TX_WAIT_BACKLOG) {
-		if (sctx->tx_backlog > 0) {
+		if (backlog > 0) {
 			return;
 		}
 
@@ -817,7 +907,6 @@ static void send_process_fc(struct isotp_send_ctx *sctx, struct can_frame *frame
 	case ISOTP_PCI_FS_CTS:
 		sctx->state = ISOTP_TX_SEND_CF;
 		sctx->wft = 0;
-		sctx->tx_backlog = 0;
 		k_sem_reset(&sctx->tx_sem);
 		sctx->opts.bs = *data++;
 		sctx->opts.stmin = *data++;
@@ -868,6 +957,21 @@ static void send_can_rx_cb(const struct device *dev, struct can_frame *frame, vo
 	k_work_submit(&sctx->work);
 }
 
+/* Queue a frame, counting it until its TX callback is called */
+static int send_frame(struct isotp_send_ctx *sctx, const struct can_frame *frame)
+{
+	int ret;
+
+	atomic_inc(&sctx->tx_backlog);
+
+	ret = can_send(sctx->can_dev, frame, K_MSEC(ISOTP_A_TIMEOUT_MS), send_can_tx_cb, sctx);
+	if (ret != 0) {
+		atomic_dec(&sctx->tx_backlog);
+	}
+
+	return ret;
+}
+
 static size_t get_send_ctx_data_len(struct isotp_send_ctx *sctx)
 {
 	return sctx->is_net_buf ? net_buf_frags_len(sctx->buf) : sctx->len;
@@ -939,7 +1043,7 @@ static inline int send_sf(struct isotp_send_ctx *sctx)
 	}
 
 	sctx->state = ISOTP_TX_SEND_SF;
-	ret = can_send(sctx->can_dev, &frame, K_MSEC(ISOTP_A_TIMEOUT_MS), send_can_tx_cb, sctx);
+	ret = send_frame(sctx, &frame);
 	return ret;
 }
 
@@ -979,7 +1083,7 @@ static inline int send_ff(struct isotp_send_ctx *sctx)
 	pull_send_ctx_data(sctx, sctx->tx_addr.dl - index);
 	memcpy(&frame.data[index], data, sctx->tx_addr.dl - index);
 
-	ret = can_send(sctx->can_dev, &frame, K_MSEC(ISOTP_A_TIMEOUT_MS), send_can_tx_cb, sctx);
+	ret = send_frame(sctx, &frame);
 	return ret;
 }
 
@@ -1021,12 +1125,11 @@ static inline int send_cf(struct isotp_send_ctx *sctx)
 		frame.dlc = can_bytes_to_dlc(len + index);
 	}
 
-	ret = can_send(sctx->can_dev, &frame, K_MSEC(ISOTP_A_TIMEOUT_MS), send_can_tx_cb, sctx);
+	ret = send_frame(sctx, &frame);
 	if (ret == 0) {
 		sctx->sn++;
 		pull_send_ctx_data(sctx, len);
 		sctx->bs--;
-		sctx->tx_backlog++;
 	}
 
 	ret = ret ? ret : rem_len;
@@ -1119,8 +1222,12 @@ static void send_state_machine(struct isotp_send_ctx *sctx)
 				break;
 			}
 
-			/* Ensure FIFO style transmission of CF */
-			k_sem_take(&sctx->tx_sem, K_FOREVER);
+			/* Queue the CFs of the block back-to-back, but no more
+			 * than can be sent in order by the controller.
+			 */
+			while (atomic_get(&sctx->tx_backlog) >= CONFIG_ISOTP_TX_CF_QUEUE_DEPTH) {
+				k_sem_take(&sctx->tx_sem, K_FOREVER);
+			}
 		} while (ret > 0);
 
 		break;
@@ -1131,12 +1238,19 @@ static void send_state_machine(struct isotp_send_ctx *sctx)
 		LOG_DBG("SM wait ST");
 		break;
 
+	case ISOTP_TX_WAIT_BACKLOG:
+		/* The last CF may have been sent before entering this state */
+		if (atomic_get(&sctx->tx_backlog) == 0) {
+			sctx->state = ISOTP_TX_WAIT_FIN;
+			send_state_machine(sctx);
+		}
+
+		break;
+
 	case ISOTP_TX_ERR:
 		LOG_DBG("SM error");
 		__fallthrough;
 	case ISOTP_TX_SEND_SF:
-		__fallthrough;
-	case ISOTP_TX_WAIT_FIN:
 		if (sctx->filter_id >= 0) {
 			can_remove_rx_filter(sctx->can_dev, sctx->filter_id);
 		}
@@ -1220,6 +1334,7 @@ static int send(struct isotp_send_ctx *sctx, const struct device *can_dev,
 	}
 
 	k_sem_init(&sctx->tx_sem, 0, 1);
+	atomic_set(&sctx->tx_backlog, 0);
 	sctx->can_dev = can_dev;
 	sctx->tx_addr = *tx_addr;
 	sctx->rx_addr = *rx_addr;
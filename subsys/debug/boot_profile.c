@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/** @file
+ *  @brief Boot profiler, timestamps of the boot steps up to main()
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/debug/boot_profile.h>
+#include <zephyr/debug/symtab.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/printk.h>
+
+/* Tells apart the early records written during this boot */
+#define EARLY_MAGIC 0x42505246
+
+#define EARLY_COUNT (BOOT_PROFILE_DATA_COPY + 1)
+
+/*
+ * Everything is noinit: the early records are written before the bss is
+ * cleared and the data copied, and the table is kept as is by a warm reset.
+ */
+static __noinit struct {
+	uint32_t magic;
+	uint32_t start;
+	uint32_t end;
+} early[EARLY_COUNT];
+
+static __noinit struct boot_profile_record records[CONFIG_BOOT_PROFILE_RECORDS];
+static __noinit atomic_t count;
+
+__weak uint32_t boot_profile_timestamp(void)
+{
+	return k_cycle_get_32();
+}
+
+void z_boot_profile_early(enum boot_profile_kind kind, uint32_t start)
+{
+	early[kind].start = start;
+	early[kind].end = boot_profile_timestamp();
+	early[kind].magic = EARLY_MAGIC;
+}
+
+void z_boot_profile_reset(void)
+{
+	atomic_val_t n = 0;
+
+	for (int kind = 0; kind < EARLY_COUNT; kind++) {
+		if (early[kind].magic != EARLY_MAGIC) {
+			continue;
+		}
+
+		records[n] = (struct boot_profile_record){
+			.start = early[kind].start,
+			.end = early[kind].end,
+			.kind = kind,
+		};
+		early[kind].magic = 0;
+		n++;
+	}
+
+	atomic_set(&count, n);
+}
+
+struct boot_profile_record *z_boot_profile_start(enum boot_profile_kind kind, uint8_t level,
+						  const struct init_entry *entry)
+{
+	struct boot_profile_record *rec;
+	atomic_val_t idx = atomic_inc(&count);
+
+	if (idx >= ARRAY_SIZE(records)) {
+		/* Table full, the later steps are not recorded */
+		atomic_dec(&count);
+		return NULL;
+	}
+
+	rec = &records[idx];
+	rec->entry = entry;
+	rec->result = 0;
+	rec->kind = kind;
+	rec->level = level;
+	rec->start = boot_profile_timestamp();
+	rec->end = rec->start;
+
+	return rec;
+}
+
+void z_boot_profile_end(struct boot_profile_record *rec, int result)
+{
+	if (rec == NULL) {
+		return;
+	}
+
+	rec->end = boot_profile_timestamp();
+	rec->result = CLAMP(result, INT16_MIN, INT16_MAX);
+}
+
+size_t boot_profile_get(const struct boot_profile_record **records_out)
+{
+	*records_out = records;
+
+	return MIN((size_t)atomic_get(&count), ARRAY_SIZE(records));
+}
+
+const char *boot_profile_name(const struct boot_profile_record *rec, char *buf, size_t len)
+{
+	static const char *const level_names[] = {
+		"EARLY", "PRE_KERNEL_1", "PRE_KERNEL_2", "POST_KERNEL", "APPLICATION", "SMP",
+	};
+	uintptr_t addr;
+
+	switch (rec->kind) {
+	case BOOT_PROFILE_BSS_ZERO:
+		return "z_bss_zero";
+	case BOOT_PROFILE_DATA_COPY:
+		return "z_data_copy";
+	case BOOT_PROFILE_LEVEL:
+		return rec->level < ARRAY_SIZE(level_names) ? level_names[rec->level] : "?";
+	case BOOT_PROFILE_MAIN:
+		return "main";
+	case BOOT_PROFILE_DEVICE:
+		return rec->entry->dev->name;
+	default:
+		break;
+	}
+
+	addr = (uintptr_t)rec->entry->init_fn.sys;
+
+#ifdef CONFIG_SYMTAB
+	uint32_t offset;
+	const char *name = symtab_find_symbol_name(addr, &offset);
+
+	if (offset == 0) {
+		return name;
+	}
+#endif /* CONFIG_SYMTAB */
+
+	snprintk(buf, len, "0x%lx", (unsigned long)addr);
+
+	return buf;
+}
+
+#ifdef CONFIG_BOOT_PROFILE_SHELL
+static int cmd_boot_profile_show(const struct shell *sh, size_t argc, char **argv)
+{
+	const struct boot_profile_record *recs;
+	size_t n = boot_profile_get(&recs);
+	uint32_t hz = sys_clock_hw_cycles_per_sec();
+	uint32_t base = n > 0 ? recs[0].start : 0;
+	char buf[2 + 2 * sizeof(uintptr_t) + 1];
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "%12s %10s %4s  %s", "start [us]", "time [us]", "rc", "step");
+
+	for (size_t i = 0; i < n; i++) {
+		const struct boot_profile_record *rec = &recs[i];
+
+		shell_print(sh, "%12llu %10llu %4d  %s%s",
+			    (uint64_t)(uint32_t)(rec->start - base) * USEC_PER_SEC / hz,
+			    (uint64_t)(uint32_t)(rec->end - rec->start) * USEC_PER_SEC / hz,
+			    rec->result, rec->kind == BOOT_PROFILE_LEVEL ? "" : "  ",
+			    boot_profile_name(rec, buf, sizeof(buf)));
+	}
+
+	return 0;
+}
+
+static int cmd_boot_profile_dump(const struct shell *sh, size_t argc, char **argv)
+{
+	const struct boot_profile_record *recs;
+	size_t n = boot_profile_get(&recs);
+	char buf[2 + 2 * sizeof(uintptr_t) + 1];
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	/* Parsed by scripts/tracing/boot_profile.py */
+	shell_print(sh, "boot_profile hz=%u records=%zu", sys_clock_hw_cycles_per_sec(), n);
+
+	for (size_t i = 0; i < n; i++) {
+		const struct boot_profile_record *rec = &recs[i];
+
+		shell_print(sh, "bp,%u,%u,%u,%u,%d,%s", rec->kind, rec->level, rec->start,
+			    rec->end, rec->result, boot_profile_name(rec, buf, sizeof(buf)));
+	}
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_boot_profile,
+	SHELL_CMD(show, NULL, "Show the boot profile timeline", cmd_boot_profile_show),
+	SHELL_CMD(dump, NULL, "Dump the boot profile records for the host script",
+		  cmd_boot_profile_dump),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(boot_profile, &sub_boot_profile, "Boot profiler commands", NULL);
+#endif /* CONFIG_BOOT_PROFILE_SHELL */
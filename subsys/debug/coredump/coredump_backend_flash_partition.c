@@ -44,7 +44,8 @@ LOG_MODULE_REGISTER(coredump, CONFIG_KERNEL_LOG_LEVEL);
 	DT_PARENT(DT_PARENT(DT_NODELABEL(FLASH_PARTITION)))
 
 #define FLASH_WRITE_SIZE	DT_PROP(FLASH_CONTROLLER, write_block_size)
-#define FLASH_BUF_SIZE		FLASH_WRITE_SIZE
+#define FLASH_BUF_SIZE		ROUND_UP(CONFIG_DEBUG_COREDUMP_FLASH_BUFFER_SIZE, \
+					 FLASH_WRITE_SIZE)
 #if DT_NODE_HAS_PROP(FLASH_CONTROLLER, erase_block_size)
 #define DEVICE_ERASE_BLOCK_SIZE DT_PROP(FLASH_CONTROLLER, erase_block_size)
 #else
@@ -81,6 +82,9 @@ static uint8_t stream_flash_buf[FLASH_BUF_SIZE];
 /* Buffer used in data_read() */
 static uint8_t data_read_buf[FLASH_BUF_SIZE];
 
+/* Buffer used in coredump_flash_backend_buffer_output() */
+static uint8_t data_copy_buf[FLASH_BUF_SIZE];
+
 /* Semaphore for exclusive flash access */
 K_SEM_DEFINE(flash_sem, 1, 1);
 
@@ -182,8 +186,10 @@ static int data_read(off_t off, uint8_t *dst, size_t len,
 			copy_sz = remaining;
 		}
 
+		/* Do not read past the write-aligned end of the data */
 		ret = flash_area_read(backend_ctx.flash_area, offset,
-				      data_read_buf, FLASH_BUF_SIZE);
+				      data_read_buf,
+				      ROUND_UP(copy_sz, FLASH_WRITE_SIZE));
 		if (ret != 0) {
 			break;
 		}
@@ -413,9 +419,18 @@ static void coredump_flash_backend_start(void)
 	ret = partition_open();
 
 	if (ret == 0) {
-		/* Erase whole flash partition */
-		ret = flash_area_flatten(backend_ctx.flash_area, 0,
-					 backend_ctx.flash_area->fa_size);
+		if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE)) {
+			/*
+			 * Stream flash erases the pages as it writes to them,
+			 * so only invalidate the header, which is written last.
+			 */
+			ret = flash_area_flatten(backend_ctx.flash_area, 0,
+						 HEADER_SCRAMBLE_SIZE);
+		} else {
+			/* Erase whole flash partition */
+			ret = flash_area_flatten(backend_ctx.flash_area, 0,
+						 backend_ctx.flash_area->fa_size);
+		}
 	}
 
 	if (ret == 0) {
@@ -507,7 +522,6 @@ static void coredump_flash_backend_buffer_output(uint8_t *buf, size_t buflen)
 	size_t remaining = buflen;
 	size_t copy_sz;
 	uint8_t *ptr = buf;
-	uint8_t tmp_buf[FLASH_BUF_SIZE];
 
 	if ((backend_ctx.error != 0) || (backend_ctx.flash_area == NULL)) {
 		return;
@@ -525,15 +539,15 @@ static void coredump_flash_backend_buffer_output(uint8_t *buf, size_t buflen)
 			copy_sz = remaining;
 		}
 
-		(void)memcpy(tmp_buf, ptr, copy_sz);
+		(void)memcpy(data_copy_buf, ptr, copy_sz);
 
 		for (i = 0; i < copy_sz; i++) {
-			backend_ctx.checksum += tmp_buf[i];
+			backend_ctx.checksum += data_copy_buf[i];
 		}
 
 		backend_ctx.error = stream_flash_buffered_write(
 					&backend_ctx.stream_ctx,
-					tmp_buf, copy_sz, false);
+					data_copy_buf, copy_sz, false);
 		if (backend_ctx.error != 0) {
 			LOG_ERR("Flash write error: %d", backend_ctx.error);
 			break;
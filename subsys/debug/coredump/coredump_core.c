@@ -5,6 +5,7 @@
  */
 
 #include <errno.h>
+#include <string.h>
 #include <kernel_internal.h>
 #include <zephyr/toolchain.h>
 #include <zephyr/debug/coredump.h>
@@ -37,6 +38,53 @@ static struct coredump_backend_api
 #define DT_DRV_COMPAT zephyr_coredump
 #endif
 
+#if defined(CONFIG_DEBUG_COREDUMP_COMPRESS_LZ4)
+#include <lz4.h>
+
+#define CHUNK_SIZE	CONFIG_DEBUG_COREDUMP_COMPRESS_CHUNK_SIZE
+
+static LZ4_stream_t lz4_state;
+static uint8_t chunk_raw[CHUNK_SIZE];
+static uint8_t chunk_comp[LZ4_COMPRESSBOUND(CHUNK_SIZE)];
+
+static void dump_compressed(uintptr_t start_addr, size_t len)
+{
+	struct coredump_mem_chunk_hdr_t c;
+	size_t raw_len;
+	int comp_len;
+
+	while (len > 0) {
+		raw_len = MIN(len, CHUNK_SIZE);
+
+		/*
+		 * As the system is still running, compress a copy of the
+		 * memory so that it does not change under the compressor.
+		 */
+		(void)memcpy(chunk_raw, UINT_TO_POINTER(start_addr), raw_len);
+
+		comp_len = LZ4_compress_fast_extState(&lz4_state, (const char *)chunk_raw,
+						      (char *)chunk_comp, (int)raw_len,
+						      sizeof(chunk_comp), 1);
+
+		c.raw_len = sys_cpu_to_le16(raw_len);
+
+		if ((comp_len <= 0) || (comp_len >= raw_len)) {
+			/* Store incompressible chunks as is */
+			c.comp_len = c.raw_len;
+			coredump_buffer_output((uint8_t *)&c, sizeof(c));
+			coredump_buffer_output(chunk_raw, raw_len);
+		} else {
+			c.comp_len = sys_cpu_to_le16(comp_len);
+			coredump_buffer_output((uint8_t *)&c, sizeof(c));
+			coredump_buffer_output(chunk_comp, comp_len);
+		}
+
+		start_addr += raw_len;
+		len -= raw_len;
+	}
+}
+#endif /* CONFIG_DEBUG_COREDUMP_COMPRESS_LZ4 */
+
 static void dump_header(unsigned int reason)
 {
 	struct coredump_hdr_t hdr = {
@@ -174,7 +222,8 @@ void coredump_memory_dump(uintptr_t start_addr, uintptr_t end_addr)
 	len = end_addr - start_addr;
 
 	m.id = COREDUMP_MEM_HDR_ID;
-	m.hdr_version = COREDUMP_MEM_HDR_VER;
+	m.hdr_version = IS_ENABLED(CONFIG_DEBUG_COREDUMP_COMPRESS_LZ4) ?
+			COREDUMP_MEM_HDR_VER_LZ4 : COREDUMP_MEM_HDR_VER;
 
 	if (sizeof(uintptr_t) == 8) {
 		m.start	= sys_cpu_to_le64(start_addr);
@@ -186,7 +235,11 @@ void coredump_memory_dump(uintptr_t start_addr, uintptr_t end_addr)
 
 	coredump_buffer_output((uint8_t *)&m, sizeof(m));
 
+#if defined(CONFIG_DEBUG_COREDUMP_COMPRESS_LZ4)
+	dump_compressed(start_addr, len);
+#else
 	coredump_buffer_output((uint8_t *)start_addr, len);
+#endif
 }
 
 int coredump_query(enum coredump_query_id query_id, void *arg)
@@ -126,6 +126,7 @@ static void thread_analyze_cb(const struct k_thread *cthread, void *user_data)
 	cb(&info);
 }
 
+#ifdef CONFIG_THREAD_ANALYZER_ISR_STACK_USAGE
 K_KERNEL_STACK_ARRAY_DECLARE(z_interrupt_stacks, CONFIG_MP_MAX_NUM_CPUS,
 			     CONFIG_ISR_STACK_SIZE);
 
@@ -149,6 +150,7 @@ static void isr_stacks(void)
 		}
 	}
 }
+#endif /* CONFIG_THREAD_ANALYZER_ISR_STACK_USAGE */
 
 void thread_analyzer_run(thread_analyzer_cb cb)
 {
@@ -158,9 +160,9 @@ void thread_analyzer_run(thread_analyzer_cb cb)
 		k_thread_foreach(thread_analyze_cb, cb);
 	}
 
-	if (IS_ENABLED(CONFIG_THREAD_ANALYZER_ISR_STACK_USAGE)) {
-		isr_stacks();
-	}
+#ifdef CONFIG_THREAD_ANALYZER_ISR_STACK_USAGE
+	isr_stacks();
+#endif /* CONFIG_THREAD_ANALYZER_ISR_STACK_USAGE */
 }
 
 void thread_analyzer_print(void)
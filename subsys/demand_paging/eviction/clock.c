@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Scan resistant CLOCK eviction algorithm for demand paging.
+ *
+ * Theory of Operation:
+ *
+ * This is a simplified CLOCK-Pro: page frames are either hot or cold, and a
+ * single clock hand sweeps over them looking for a cold page frame not
+ * accessed since the hand last passed over it. The accessed flag of each
+ * page frame is cleared as the hand passes.
+ *
+ * - Page frames made evictable start cold.
+ *
+ * - A cold page frame found accessed by the hand enters its test period.
+ *   Found accessed again by the next sweep, it is promoted to hot, unless
+ *   the hot page frames already reach CONFIG_EVICTION_CLOCK_HOT_PERCENT of
+ *   all page frames.
+ *
+ * - A hot page frame found not accessed is demoted to cold.
+ *
+ * - The first cold page frame found not accessed is evicted.
+ *
+ * Pages touched only once, as done by a sequential scan, never get hot and
+ * are thus evicted before the working set, which plain NRU or LRU would
+ * flush out. Since all accessed flags are cleared by a full sweep, and hot
+ * page frames demoted by the next one, a victim is always found within
+ * three sweeps.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/mm/demand_paging.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+#define CLOCK_HOT  BIT(0)
+#define CLOCK_TEST BIT(1)
+
+#define CLOCK_HOT_MAX (K_MEM_NUM_PAGE_FRAMES * CONFIG_EVICTION_CLOCK_HOT_PERCENT / 100)
+
+static uint8_t clock_state[K_MEM_NUM_PAGE_FRAMES];
+static uint32_t clock_hot_count;
+static uint32_t clock_hand;
+
+void k_mem_paging_eviction_add(struct k_mem_page_frame *pf)
+{
+	clock_state[pf - k_mem_page_frames] = 0;
+}
+
+void k_mem_paging_eviction_remove(struct k_mem_page_frame *pf)
+{
+	uint8_t *state = &clock_state[pf - k_mem_page_frames];
+
+	if ((*state & CLOCK_HOT) != 0) {
+		clock_hot_count--;
+	}
+
+	*state = 0;
+}
+
+void k_mem_paging_eviction_accessed(uintptr_t phys)
+{
+	ARG_UNUSED(phys);
+}
+
+struct k_mem_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	struct k_mem_page_frame *last_pf = NULL;
+	bool last_dirty = false;
+	struct k_mem_page_frame *pf;
+	uintptr_t flags;
+	uint8_t *state;
+
+	for (size_t i = 0; i < 3 * ARRAY_SIZE(k_mem_page_frames); i++) {
+		pf = &k_mem_page_frames[clock_hand];
+		state = &clock_state[clock_hand];
+		clock_hand = (clock_hand + 1) % ARRAY_SIZE(k_mem_page_frames);
+
+		if (!k_mem_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		/* Get and clear the accessed flag */
+		flags = arch_page_info_get(k_mem_page_frame_to_virt(pf), NULL, true);
+
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U, "non-present page");
+
+		last_pf = pf;
+		last_dirty = (flags & ARCH_DATA_PAGE_DIRTY) != 0U;
+
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) == 0U) {
+			if ((*state & CLOCK_HOT) == 0) {
+				break;
+			}
+
+			*state &= ~CLOCK_HOT;
+			clock_hot_count--;
+		} else if ((*state & CLOCK_HOT) == 0) {
+			if ((*state & CLOCK_TEST) != 0 && clock_hot_count < CLOCK_HOT_MAX) {
+				*state = CLOCK_HOT;
+				clock_hot_count++;
+			} else {
+				*state |= CLOCK_TEST;
+			}
+		}
+	}
+
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(last_pf != NULL, "no page to evict");
+
+	*dirty_ptr = last_dirty;
+
+	return last_pf;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+}
@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/dfu/flash_img.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_PSA)
+#include <psa/crypto.h>
+#define SUCCESS_VALUE PSA_SUCCESS
+#else
+#include <mbedtls/sha256.h>
+#define SUCCESS_VALUE 0
+#endif
+
+#define SHA256_DIGEST_SIZE 32
+
+enum delta_state {
+	DELTA_STATE_HDR,
+	DELTA_STATE_OPCODE,
+	DELTA_STATE_ARG,
+	DELTA_STATE_DATA,
+	DELTA_STATE_ERROR,
+};
+
+/* Hash of the reconstructed image, only one patch being applied at a time */
+#if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_PSA)
+static psa_hash_operation_t hash_ctx;
+#else
+static mbedtls_sha256_context hash_ctx;
+#endif
+static bool hash_active;
+
+static int hash_finish(uint8_t *hash);
+
+static int hash_start(void)
+{
+	int rc;
+
+	if (hash_active) {
+		/* Left over by a patch which was not flushed */
+		uint8_t hash[SHA256_DIGEST_SIZE];
+
+		(void)hash_finish(hash);
+	}
+
+#if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_PSA)
+	hash_ctx = psa_hash_operation_init();
+	rc = psa_hash_setup(&hash_ctx, PSA_ALG_SHA_256);
+#else
+	mbedtls_sha256_init(&hash_ctx);
+	rc = mbedtls_sha256_starts(&hash_ctx, false);
+#endif
+	hash_active = (rc == SUCCESS_VALUE);
+
+	return hash_active ? 0 : -ESRCH;
+}
+
+static int hash_finish(uint8_t *hash)
+{
+	int rc;
+
+	if (!hash_active) {
+		return -ESRCH;
+	}
+
+	hash_active = false;
+
+#if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_PSA)
+	size_t hash_len;
+
+	rc = psa_hash_finish(&hash_ctx, hash, SHA256_DIGEST_SIZE, &hash_len);
+	psa_hash_abort(&hash_ctx);
+#else
+	rc = mbedtls_sha256_finish(&hash_ctx, hash);
+	mbedtls_sha256_free(&hash_ctx);
+#endif
+
+	return rc == SUCCESS_VALUE ? 0 : -ESRCH;
+}
+
+static int delta_output(struct flash_img_delta_context *ctx, const uint8_t *data, size_t len)
+{
+	int rc;
+
+	if (len > ctx->target_size - ctx->written) {
+		return -EINVAL;
+	}
+
+#if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_PSA)
+	rc = psa_hash_update(&hash_ctx, data, len);
+#else
+	rc = mbedtls_sha256_update(&hash_ctx, data, len);
+#endif
+	if (rc != SUCCESS_VALUE) {
+		return -ESRCH;
+	}
+
+	rc = flash_img_buffered_write(ctx->img, data, len, false);
+	if (rc == 0) {
+		ctx->written += len;
+	}
+
+	return rc;
+}
+
+/* Reads up to <len> source bytes at the source position into the buffer */
+static int delta_read_source(struct flash_img_delta_context *ctx, size_t len, size_t *read)
+{
+	int rc;
+
+	len = MIN(len, sizeof(ctx->buf));
+	if (ctx->source_pos > ctx->source_size || len > ctx->source_size - ctx->source_pos) {
+		return -EINVAL;
+	}
+
+	rc = flash_area_read(ctx->source, ctx->source_pos, ctx->buf, len);
+	if (rc == 0) {
+		ctx->source_pos += len;
+		*read = len;
+	}
+
+	return rc;
+}
+
+static int delta_parse_hdr(struct flash_img_delta_context *ctx)
+{
+	const uint8_t *hdr = ctx->buf;
+	struct flash_area_check fac;
+	int rc;
+
+	if (sys_get_le32(hdr) != FLASH_IMG_DELTA_MAGIC) {
+		return -EINVAL;
+	}
+
+	ctx->source_size = sys_get_le32(&hdr[4]);
+	ctx->target_size = sys_get_le32(&hdr[8]);
+	memcpy(ctx->target_sha, &hdr[16 + SHA256_DIGEST_SIZE], SHA256_DIGEST_SIZE);
+
+	if (ctx->target_size > ctx->img->flash_area->fa_size) {
+		return -EFBIG;
+	}
+
+	/* Applying the patch to anything but its source image would produce garbage */
+	fac.match = &hdr[16];
+	fac.clen = ctx->source_size;
+	fac.off = 0;
+	fac.rbuf = ctx->buf + FLASH_IMG_DELTA_HDR_SIZE;
+	fac.rblen = sizeof(ctx->buf) - FLASH_IMG_DELTA_HDR_SIZE;
+
+	rc = flash_area_check_int_sha256(ctx->source, &fac);
+	if (rc != 0) {
+		return rc;
+	}
+
+	return hash_start();
+}
+
+static int delta_op(struct flash_img_delta_context *ctx)
+{
+	size_t read;
+	int rc = 0;
+
+	switch (ctx->op) {
+	case FLASH_IMG_DELTA_OP_COPY:
+		while (rc == 0 && ctx->arg > 0) {
+			rc = delta_read_source(ctx, ctx->arg, &read);
+			if (rc == 0) {
+				rc = delta_output(ctx, ctx->buf, read);
+				ctx->arg -= read;
+			}
+		}
+		ctx->state = DELTA_STATE_OPCODE;
+		break;
+	case FLASH_IMG_DELTA_OP_ADD:
+	case FLASH_IMG_DELTA_OP_INSERT:
+		ctx->state = ctx->arg > 0 ? DELTA_STATE_DATA : DELTA_STATE_OPCODE;
+		break;
+	case FLASH_IMG_DELTA_OP_SEEK: {
+		/* Zigzag decoding */
+		int32_t seek = (int32_t)(ctx->arg >> 1) ^ -(int32_t)(ctx->arg & 1);
+
+		if ((seek < 0 && (size_t)-(int64_t)seek > ctx->source_pos) ||
+		    (seek > 0 && (size_t)seek > ctx->source_size - ctx->source_pos)) {
+			rc = -EINVAL;
+		} else {
+			ctx->source_pos += seek;
+		}
+		ctx->state = DELTA_STATE_OPCODE;
+		break;
+	}
+	default:
+		rc = -EINVAL;
+		break;
+	}
+
+	return rc;
+}
+
+/* Handles up to <len> bytes of ADD or INSERT data, returning the number used */
+static int delta_data(struct flash_img_delta_context *ctx, const uint8_t *data, size_t len)
+{
+	size_t read;
+	int rc;
+
+	len = MIN(len, ctx->arg);
+
+	if (ctx->op == FLASH_IMG_DELTA_OP_INSERT) {
+		rc = delta_output(ctx, data, len);
+	} else {
+		rc = delta_read_source(ctx, len, &read);
+		if (rc == 0) {
+			len = read;
+			for (size_t i = 0; i < len; i++) {
+				ctx->buf[i] += data[i];
+			}
+			rc = delta_output(ctx, ctx->buf, len);
+		}
+	}
+
+	if (rc != 0) {
+		return rc;
+	}
+
+	ctx->arg -= len;
+	if (ctx->arg == 0) {
+		ctx->state = DELTA_STATE_OPCODE;
+	}
+
+	return len;
+}
+
+bool flash_img_delta_is_patch(const uint8_t *data, size_t len)
+{
+	return len >= sizeof(uint32_t) && sys_get_le32(data) == FLASH_IMG_DELTA_MAGIC;
+}
+
+int flash_img_delta_init(struct flash_img_delta_context *ctx, struct flash_img_context *img,
+			 uint8_t source_area_id)
+{
+	int rc;
+
+	memset(ctx, 0, sizeof(*ctx));
+
+	rc = flash_area_open(source_area_id, &ctx->source);
+	if (rc == 0) {
+		ctx->img = img;
+		ctx->state = DELTA_STATE_HDR;
+	}
+
+	return rc;
+}
+
+int flash_img_delta_write(struct flash_img_delta_context *ctx, const uint8_t *data, size_t len,
+			  bool flush)
+{
+	uint8_t hash[SHA256_DIGEST_SIZE];
+	int rc = 0;
+
+	while (rc == 0 && len > 0) {
+		size_t used = 1;
+
+		switch (ctx->state) {
+		case DELTA_STATE_HDR:
+			used = MIN(len, FLASH_IMG_DELTA_HDR_SIZE - ctx->hdr_len);
+			memcpy(&ctx->buf[ctx->hdr_len], data, used);
+			ctx->hdr_len += used;
+			if (ctx->hdr_len == FLASH_IMG_DELTA_HDR_SIZE) {
+				rc = delta_parse_hdr(ctx);
+				ctx->state = DELTA_STATE_OPCODE;
+			}
+			break;
+		case DELTA_STATE_OPCODE:
+			ctx->op = *data;
+			ctx->arg = 0;
+			ctx->arg_shift = 0;
+			ctx->state = DELTA_STATE_ARG;
+			break;
+		case DELTA_STATE_ARG:
+			if (ctx->arg_shift > 28) {
+				rc = -EINVAL;
+				break;
+			}
+			ctx->arg |= (uint32_t)(*data & 0x7f) << ctx->arg_shift;
+			ctx->arg_shift += 7;
+			if ((*data & 0x80) == 0) {
+				rc = delta_op(ctx);
+			}
+			break;
+		case DELTA_STATE_DATA:
+			rc = delta_data(ctx, data, len);
+			if (rc > 0) {
+				used = rc;
+				rc = 0;
+			}
+			break;
+		default:
+			rc = -EINVAL;
+			break;
+		}
+
+		data += used;
+		len -= used;
+	}
+
+	if (rc != 0) {
+		ctx->state = DELTA_STATE_ERROR;
+	}
+
+	if (!flush) {
+		return rc;
+	}
+
+	if (rc == 0 && (ctx->state != DELTA_STATE_OPCODE || ctx->written != ctx->target_size)) {
+		/* Truncated patch */
+		rc = -EINVAL;
+	}
+
+	if (hash_finish(hash) == 0 && rc == 0 &&
+	    memcmp(hash, ctx->target_sha, SHA256_DIGEST_SIZE) != 0) {
+		rc = -EILSEQ;
+	}
+
+	if (ctx->img->flash_area != NULL) {
+		int flush_rc = flash_img_buffered_write(ctx->img, NULL, 0, true);
+
+		rc = rc != 0 ? rc : flush_rc;
+	}
+
+	flash_area_close(ctx->source);
+
+	return rc;
+}
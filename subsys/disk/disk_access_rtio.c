@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * The disk drivers are synchronous, so submissions are queued and run one
+ * after the other by a thread, which lets the submitter keep several
+ * requests in flight. Transactions are run as a whole and complete with the
+ * first error.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/storage/disk_access.h>
+#include <zephyr/storage/disk_access_rtio.h>
+#include <zephyr/sys/mpsc_lockfree.h>
+#include <errno.h>
+
+#define LOG_LEVEL CONFIG_DISK_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(disk);
+
+static struct mpsc disk_rtio_q = MPSC_INIT(disk_rtio_q);
+static K_SEM_DEFINE(disk_rtio_sem, 0, K_SEM_MAX_LIMIT);
+
+static void disk_rtio_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	mpsc_push(&disk_rtio_q, &iodev_sqe->q);
+	k_sem_give(&disk_rtio_sem);
+}
+
+const struct rtio_iodev_api disk_access_iodev_api = {
+	.submit = disk_rtio_submit,
+};
+
+static int disk_rtio_exec(const struct rtio_sqe *sqe)
+{
+	const char *pdrv = sqe->iodev->data;
+
+	switch (sqe->op) {
+	case RTIO_OP_NOP:
+		return 0;
+	case RTIO_OP_DISK_READ:
+		return disk_access_read(pdrv, sqe->disk_buf, sqe->disk_start_sector,
+					sqe->disk_num_sectors);
+	case RTIO_OP_DISK_WRITE:
+		return disk_access_write(pdrv, sqe->disk_buf, sqe->disk_start_sector,
+					 sqe->disk_num_sectors);
+	default:
+		LOG_ERR("disk %s: unsupported RTIO op %d", pdrv, sqe->op);
+		return -ENOTSUP;
+	}
+}
+
+static void disk_rtio_thread(void *p1, void *p2, void *p3)
+{
+	struct rtio_iodev_sqe *iodev_sqe, *txn;
+	struct mpsc_node *node;
+	int rc;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&disk_rtio_sem, K_FOREVER);
+
+		/* The node may not be visible yet while its push completes */
+		while ((node = mpsc_pop(&disk_rtio_q)) == NULL) {
+			k_yield();
+		}
+
+		iodev_sqe = CONTAINER_OF(node, struct rtio_iodev_sqe, q);
+		rc = 0;
+
+		for (txn = iodev_sqe; (txn != NULL) && (rc == 0); txn = rtio_txn_next(txn)) {
+			rc = disk_rtio_exec(&txn->sqe);
+		}
+
+		if (rc) {
+			rtio_iodev_sqe_err(iodev_sqe, rc);
+		} else {
+			rtio_iodev_sqe_ok(iodev_sqe, 0);
+		}
+	}
+}
+
+K_THREAD_DEFINE(disk_rtio, CONFIG_DISK_ACCESS_RTIO_STACK_SIZE, disk_rtio_thread, NULL, NULL,
+		NULL, CONFIG_DISK_ACCESS_RTIO_THREAD_PRIORITY, 0, 0);
@@ -0,0 +1,398 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Sector cache shared by all disks. The cache is made of lines of
+ * CONFIG_DISK_CACHE_LINE_SECTORS consecutive sectors, aligned on the line
+ * size, so a miss fetches the whole line with a single driver call. Lines
+ * are replaced in least recently used order. Requests of two lines or more
+ * bypass the cache after the lines they overlap have been made coherent.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/storage/disk_access.h>
+#include <errno.h>
+
+#include "disk_cache.h"
+
+#define LOG_LEVEL CONFIG_DISK_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(disk);
+
+#define LINE_SECTORS CONFIG_DISK_CACHE_LINE_SECTORS
+#define SECTOR_SIZE CONFIG_DISK_CACHE_SECTOR_SIZE
+#define LINE_SIZE (LINE_SECTORS * SECTOR_SIZE)
+
+struct disk_cache_line {
+	/* Disk the line belongs to, NULL when the line is free */
+	struct disk_info *disk;
+	/* First sector of the line */
+	uint32_t first;
+	/* Value of the use counter at the last access */
+	uint32_t last_use;
+	bool dirty;
+	uint8_t data[LINE_SIZE] __aligned(4);
+};
+
+static struct disk_cache_line lines[CONFIG_DISK_CACHE_LINES];
+static uint32_t use_counter;
+static struct disk_cache_stats stats;
+
+/* Line following the last one accessed, for read-ahead */
+static struct disk_info *seq_disk;
+static uint32_t seq_next;
+
+static K_MUTEX_DEFINE(cache_lock);
+
+static inline uint32_t line_first(uint32_t sector)
+{
+	return sector - (sector % LINE_SECTORS);
+}
+
+static bool line_cacheable(struct disk_info *disk, uint32_t first)
+{
+	return (disk->cache_sector_count >= LINE_SECTORS) &&
+	       (first <= disk->cache_sector_count - LINE_SECTORS);
+}
+
+static struct disk_cache_line *line_find(struct disk_info *disk, uint32_t first)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(lines); i++) {
+		if ((lines[i].disk == disk) && (lines[i].first == first)) {
+			return &lines[i];
+		}
+	}
+
+	return NULL;
+}
+
+static int line_flush(struct disk_cache_line *line)
+{
+	int rc;
+
+	if (!line->dirty) {
+		return 0;
+	}
+
+	rc = line->disk->ops->write(line->disk, line->data, line->first, LINE_SECTORS);
+	if (rc == 0) {
+		line->dirty = false;
+		stats.write_backs++;
+	}
+
+	return rc;
+}
+
+/* Get a line to hold first, writing back the least recently used one */
+static struct disk_cache_line *line_alloc(struct disk_info *disk, uint32_t first,
+					  int *rc)
+{
+	struct disk_cache_line *victim = &lines[0];
+
+	for (size_t i = 0; i < ARRAY_SIZE(lines); i++) {
+		if (lines[i].disk == NULL) {
+			victim = &lines[i];
+			break;
+		}
+		if ((int32_t)(lines[i].last_use - victim->last_use) < 0) {
+			victim = &lines[i];
+		}
+	}
+
+	if (victim->disk != NULL) {
+		*rc = line_flush(victim);
+		if (*rc) {
+			return NULL;
+		}
+	}
+
+	victim->disk = disk;
+	victim->first = first;
+	victim->dirty = false;
+	victim->last_use = ++use_counter;
+	*rc = 0;
+
+	return victim;
+}
+
+static struct disk_cache_line *line_fill(struct disk_info *disk, uint32_t first,
+					 int *rc)
+{
+	struct disk_cache_line *line = line_alloc(disk, first, rc);
+
+	if (line == NULL) {
+		return NULL;
+	}
+
+	*rc = disk->ops->read(disk, line->data, first, LINE_SECTORS);
+	if (*rc) {
+		line->disk = NULL;
+		return NULL;
+	}
+
+	return line;
+}
+
+static void read_ahead(struct disk_info *disk, uint32_t first)
+{
+	int rc;
+
+	for (int i = 1; i <= CONFIG_DISK_CACHE_READ_AHEAD; i++) {
+		uint32_t next = first + i * LINE_SECTORS;
+
+		if (!line_cacheable(disk, next) || (line_find(disk, next) != NULL)) {
+			continue;
+		}
+
+		if (line_fill(disk, next, &rc) == NULL) {
+			break;
+		}
+		stats.read_ahead++;
+	}
+}
+
+/* Write back the dirty lines overlapping a range of sectors */
+static int flush_range(struct disk_info *disk, uint32_t start, uint32_t num)
+{
+	int rc;
+
+	for (size_t i = 0; i < ARRAY_SIZE(lines); i++) {
+		if ((lines[i].disk != disk) ||
+		    (lines[i].first + LINE_SECTORS <= start) ||
+		    (lines[i].first >= start + num)) {
+			continue;
+		}
+
+		rc = line_flush(&lines[i]);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
+/* Copy data written directly to the disk into the lines caching it */
+static void update_range(struct disk_info *disk, const uint8_t *buf, uint32_t start,
+			 uint32_t num)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(lines); i++) {
+		uint32_t from, to;
+
+		if ((lines[i].disk != disk) ||
+		    (lines[i].first + LINE_SECTORS <= start) ||
+		    (lines[i].first >= start + num)) {
+			continue;
+		}
+
+		from = MAX(start, lines[i].first);
+		to = MIN(start + num, lines[i].first + LINE_SECTORS);
+		memcpy(&lines[i].data[(from - lines[i].first) * SECTOR_SIZE],
+		       &buf[(from - start) * SECTOR_SIZE], (to - from) * SECTOR_SIZE);
+	}
+}
+
+int disk_cache_read(struct disk_info *disk, uint8_t *buf, uint32_t start, uint32_t num)
+{
+	struct disk_cache_line *line;
+	uint32_t first, off, cnt;
+	int rc = 0;
+
+	if (disk->cache_sector_count == 0U) {
+		return disk->ops->read(disk, buf, start, num);
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	if (num >= 2 * LINE_SECTORS) {
+		rc = flush_range(disk, start, num);
+		if (rc == 0) {
+			rc = disk->ops->read(disk, buf, start, num);
+		}
+		goto end;
+	}
+
+	while (num > 0) {
+		first = line_first(start);
+		off = start - first;
+		cnt = MIN(num, LINE_SECTORS - off);
+
+		if (!line_cacheable(disk, first)) {
+			rc = disk->ops->read(disk, buf, start, cnt);
+			if (rc) {
+				break;
+			}
+		} else {
+			line = line_find(disk, first);
+			if (line != NULL) {
+				stats.hits++;
+			} else {
+				stats.misses++;
+				line = line_fill(disk, first, &rc);
+				if (line == NULL) {
+					break;
+				}
+			}
+
+			memcpy(buf, &line->data[off * SECTOR_SIZE], cnt * SECTOR_SIZE);
+			line->last_use = ++use_counter;
+
+			/* Keep the next lines of a sequential stream ready */
+			if ((disk == seq_disk) && (first == seq_next)) {
+				read_ahead(disk, first);
+			}
+			seq_disk = disk;
+			seq_next = first + LINE_SECTORS;
+		}
+
+		buf += cnt * SECTOR_SIZE;
+		start += cnt;
+		num -= cnt;
+	}
+
+end:
+	k_mutex_unlock(&cache_lock);
+
+	return rc;
+}
+
+int disk_cache_write(struct disk_info *disk, const uint8_t *buf, uint32_t start,
+		     uint32_t num)
+{
+	struct disk_cache_line *line;
+	uint32_t first, off, cnt;
+	int rc = 0;
+
+	if (disk->cache_sector_count == 0U) {
+		return disk->ops->write(disk, buf, start, num);
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	if (!IS_ENABLED(CONFIG_DISK_CACHE_WRITE_BACK) || (num >= 2 * LINE_SECTORS)) {
+		rc = disk->ops->write(disk, buf, start, num);
+		if (rc == 0) {
+			update_range(disk, buf, start, num);
+		}
+		goto end;
+	}
+
+	while (num > 0) {
+		first = line_first(start);
+		off = start - first;
+		cnt = MIN(num, LINE_SECTORS - off);
+
+		if (!line_cacheable(disk, first)) {
+			rc = disk->ops->write(disk, buf, start, cnt);
+			if (rc) {
+				break;
+			}
+		} else {
+			line = line_find(disk, first);
+			if (line != NULL) {
+				stats.hits++;
+			} else {
+				stats.misses++;
+				/* No need to read a line that is fully overwritten */
+				if (cnt == LINE_SECTORS) {
+					line = line_alloc(disk, first, &rc);
+				} else {
+					line = line_fill(disk, first, &rc);
+				}
+				if (line == NULL) {
+					break;
+				}
+			}
+
+			memcpy(&line->data[off * SECTOR_SIZE], buf, cnt * SECTOR_SIZE);
+			line->dirty = true;
+			line->last_use = ++use_counter;
+		}
+
+		buf += cnt * SECTOR_SIZE;
+		start += cnt;
+		num -= cnt;
+	}
+
+end:
+	k_mutex_unlock(&cache_lock);
+
+	return rc;
+}
+
+int disk_cache_flush(struct disk_info *disk)
+{
+	int rc;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+	rc = flush_range(disk, 0, UINT32_MAX);
+	k_mutex_unlock(&cache_lock);
+
+	return rc;
+}
+
+void disk_cache_attach(struct disk_info *disk)
+{
+	uint32_t sector_size, sector_count;
+
+	disk->cache_sector_count = 0U;
+
+	if ((disk->ops->ioctl == NULL) ||
+	    disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_SIZE, &sector_size) ||
+	    disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_COUNT, &sector_count)) {
+		return;
+	}
+
+	if (sector_size != SECTOR_SIZE) {
+		LOG_DBG("disk %s: %u byte sectors not cached", disk->name, sector_size);
+		return;
+	}
+
+	disk->cache_sector_count = sector_count;
+}
+
+int disk_cache_detach(struct disk_info *disk)
+{
+	int rc;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	rc = flush_range(disk, 0, UINT32_MAX);
+	if (rc) {
+		LOG_ERR("disk %s: cache write back failed (%d)", disk->name, rc);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(lines); i++) {
+		if (lines[i].disk == disk) {
+			lines[i].disk = NULL;
+		}
+	}
+
+	if (seq_disk == disk) {
+		seq_disk = NULL;
+	}
+	disk->cache_sector_count = 0U;
+
+	k_mutex_unlock(&cache_lock);
+
+	return rc;
+}
+
+void disk_access_cache_stats_get(struct disk_cache_stats *cache_stats)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+	*cache_stats = stats;
+	k_mutex_unlock(&cache_lock);
+}
+
+void disk_access_cache_stats_reset(void)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+	memset(&stats, 0, sizeof(stats));
+	k_mutex_unlock(&cache_lock);
+}
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SUBSYS_DISK_DISK_CACHE_H_
+#define ZEPHYR_SUBSYS_DISK_DISK_CACHE_H_
+
+#include <zephyr/drivers/disk.h>
+
+/* Read and write through the sector cache */
+int disk_cache_read(struct disk_info *disk, uint8_t *buf, uint32_t start, uint32_t num);
+int disk_cache_write(struct disk_info *disk, const uint8_t *buf, uint32_t start,
+		     uint32_t num);
+
+/* Write back the dirty sectors of a disk */
+int disk_cache_flush(struct disk_info *disk);
+
+/* Start caching an initialized disk, if its sector size is supported */
+void disk_cache_attach(struct disk_info *disk);
+
+/* Write back and drop the cached sectors of a disk, and stop caching it */
+int disk_cache_detach(struct disk_info *disk);
+
+#endif /* ZEPHYR_SUBSYS_DISK_DISK_CACHE_H_ */
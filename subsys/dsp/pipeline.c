@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/dsp/pipeline.h>
+
+int zdsp_pipeline_process(struct zdsp_pipeline *pipeline, float32_t *frame, uint32_t num_samples,
+			  float32_t **out)
+{
+	float32_t *src = frame;
+	float32_t *dst = pipeline->scratch;
+	int ret = num_samples;
+
+	if (num_samples > pipeline->max_frame_size) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < pipeline->num_blocks; i++) {
+		struct zdsp_block *block = pipeline->blocks[i];
+
+		if (block->in_place) {
+			ret = block->process(block, src, src, ret);
+		} else {
+			float32_t *tmp = src;
+
+			ret = block->process(block, src, dst, ret);
+
+			/* The output of this block is the input of the next one */
+			src = dst;
+			dst = tmp;
+		}
+
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	*out = src;
+
+	return ret;
+}
+
+static int gain_process(struct zdsp_block *block, float32_t *src, float32_t *dst,
+			uint32_t num_samples)
+{
+	struct zdsp_gain_block *gb = CONTAINER_OF(block, struct zdsp_gain_block, block);
+
+	zdsp_scale_f32(src, gb->gain, dst, num_samples);
+
+	return num_samples;
+}
+
+struct zdsp_block *zdsp_gain_block_init(struct zdsp_gain_block *gb, float32_t gain)
+{
+	gb->block.process = gain_process;
+	gb->block.in_place = true;
+	gb->gain = gain;
+
+	return &gb->block;
+}
+
+static int fir_process(struct zdsp_block *block, float32_t *src, float32_t *dst,
+		       uint32_t num_samples)
+{
+	struct zdsp_fir_block *fb = CONTAINER_OF(block, struct zdsp_fir_block, block);
+
+	if (num_samples > fb->max_frame_size) {
+		return -EINVAL;
+	}
+
+	arm_fir_f32(&fb->fir, src, dst, num_samples);
+
+	return num_samples;
+}
+
+struct zdsp_block *zdsp_fir_block_init(struct zdsp_fir_block *fb, const float32_t *coeffs,
+				       uint16_t num_taps, float32_t *state,
+				       uint32_t max_frame_size)
+{
+	fb->block.process = fir_process;
+	fb->block.in_place = false;
+	fb->max_frame_size = max_frame_size;
+	arm_fir_init_f32(&fb->fir, num_taps, coeffs, state, max_frame_size);
+
+	return &fb->block;
+}
+
+static int biquad_process(struct zdsp_block *block, float32_t *src, float32_t *dst,
+			  uint32_t num_samples)
+{
+	struct zdsp_biquad_block *bb = CONTAINER_OF(block, struct zdsp_biquad_block, block);
+
+	arm_biquad_cascade_df2T_f32(&bb->iir, src, dst, num_samples);
+
+	return num_samples;
+}
+
+struct zdsp_block *zdsp_biquad_block_init(struct zdsp_biquad_block *bb, const float32_t *coeffs,
+					  uint8_t num_stages, float32_t *state)
+{
+	bb->block.process = biquad_process;
+	/* Each output sample only depends on the input sample of the same index */
+	bb->block.in_place = true;
+	arm_biquad_cascade_df2T_init_f32(&bb->iir, num_stages, coeffs, state);
+
+	return &bb->block;
+}
+
+static int decimate_process(struct zdsp_block *block, float32_t *src, float32_t *dst,
+			    uint32_t num_samples)
+{
+	struct zdsp_decimate_block *db = CONTAINER_OF(block, struct zdsp_decimate_block, block);
+
+	if (num_samples > db->max_frame_size || (num_samples % db->fir.M) != 0) {
+		return -EINVAL;
+	}
+
+	arm_fir_decimate_f32(&db->fir, src, dst, num_samples);
+
+	return num_samples / db->fir.M;
+}
+
+struct zdsp_block *zdsp_decimate_block_init(struct zdsp_decimate_block *db,
+					    const float32_t *coeffs, uint16_t num_taps,
+					    uint8_t factor, float32_t *state,
+					    uint32_t max_frame_size)
+{
+	if (arm_fir_decimate_init_f32(&db->fir, num_taps, factor, coeffs, state,
+				      max_frame_size) != ARM_MATH_SUCCESS) {
+		return NULL;
+	}
+
+	db->block.process = decimate_process;
+	db->block.in_place = false;
+	db->max_frame_size = max_frame_size;
+
+	return &db->block;
+}
+
+static int rfft_process(struct zdsp_block *block, float32_t *src, float32_t *dst,
+			uint32_t num_samples)
+{
+	struct zdsp_rfft_block *rb = CONTAINER_OF(block, struct zdsp_rfft_block, block);
+
+	if (num_samples != rb->fft_len) {
+		return -EINVAL;
+	}
+
+	/* The transform uses its input as working buffer */
+	arm_rfft_fast_f32(&rb->rfft, src, dst, 0);
+
+	return num_samples;
+}
+
+struct zdsp_block *zdsp_rfft_block_init(struct zdsp_rfft_block *rb, uint16_t fft_len)
+{
+	if (arm_rfft_fast_init_f32(&rb->rfft, fft_len) != ARM_MATH_SUCCESS) {
+		return NULL;
+	}
+
+	rb->block.process = rfft_process;
+	rb->block.in_place = false;
+	rb->fft_len = fft_len;
+
+	return &rb->block;
+}
@@ -59,10 +59,53 @@ struct char_framebuffer {
 
 	/** Inverted */
 	bool inverted;
+
+	/** Columns changed since the last write to the display, x1 excluded */
+	uint16_t dirty_x0;
+	uint16_t dirty_x1;
+
+	/** Pages (rows of tiles) changed since the last write, p1 excluded */
+	uint16_t dirty_p0;
+	uint16_t dirty_p1;
+
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_SHADOW
+	/** Contents last written to the display */
+	uint8_t *shadow;
+
+	/** The shadow matches the display */
+	bool shadow_valid;
+#endif
 };
 
 static struct char_framebuffer char_fb;
 
+/* Mark the pixels from (x0, y0) to (x1, y1) excluded as changed */
+static inline void mark_dirty(struct char_framebuffer *fb, uint16_t x0, uint16_t y0,
+			      uint16_t x1, uint16_t y1)
+{
+	if (x0 >= x1 || y0 >= y1) {
+		return;
+	}
+
+	fb->dirty_x0 = MIN(fb->dirty_x0, x0);
+	fb->dirty_x1 = MAX(fb->dirty_x1, x1);
+	fb->dirty_p0 = MIN(fb->dirty_p0, y0 / fb->ppt);
+	fb->dirty_p1 = MAX(fb->dirty_p1, DIV_ROUND_UP(y1, fb->ppt));
+}
+
+static inline void mark_all_dirty(struct char_framebuffer *fb)
+{
+	mark_dirty(fb, 0, 0, fb->x_res, fb->y_res);
+}
+
+static inline void clear_dirty(struct char_framebuffer *fb)
+{
+	fb->dirty_x0 = fb->x_res;
+	fb->dirty_x1 = 0;
+	fb->dirty_p0 = fb->y_res / fb->ppt;
+	fb->dirty_p1 = 0;
+}
+
 static inline uint8_t *get_glyph_ptr(const struct cfb_font *fptr, char c)
 {
 	return (uint8_t *)fptr->data +
@@ -87,13 +130,17 @@ static inline uint8_t get_glyph_byte(uint8_t *glyph_ptr, const struct cfb_font *
  * Draw the monochrome character in the monochrome tiled framebuffer,
  * a byte is interpreted as 8 pixels ordered vertically among each other.
  */
-static uint8_t draw_char_vtmono(const struct char_framebuffer *fb,
+static uint8_t draw_char_vtmono(struct char_framebuffer *fb,
 				char c, uint16_t x, uint16_t y,
 				bool draw_bg)
 {
 	const struct cfb_font *fptr = &(fb->fonts[fb->font_idx]);
 	const bool need_reverse = (((fb->screen_info & SCREEN_INFO_MONO_MSB_FIRST) != 0)
 			     != ((fptr->caps & CFB_FONT_MSB_FIRST) != 0));
+	int16_t x_min = INT16_MAX;
+	int16_t y_min = INT16_MAX;
+	int16_t x_max = -1;
+	int16_t y_max = -1;
 	uint8_t *glyph_ptr;
 
 	if (c < fptr->first_char || c > fptr->last_char) {
@@ -177,9 +224,16 @@ static uint8_t draw_char_vtmono(const struct char_framebuffer *fb,
 			}
 
 			fb->buf[fb_index] |= byte;
+
+			x_min = MIN(x_min, fb_x);
+			x_max = MAX(x_max, fb_x);
+			y_min = MIN(y_min, fb_y);
+			y_max = MAX(y_max, fb_y);
 		}
 	}
 
+	mark_dirty(fb, x_min, y_min, x_max + 1, y_max + 1);
+
 	return fptr->width;
 }
 
@@ -202,6 +256,7 @@ static inline void draw_point(struct char_framebuffer *fb, int16_t x, int16_t y)
 	}
 
 	fb->buf[index + x] |= m;
+	mark_dirty(fb, x, y, x + 1, y + 1);
 }
 
 static void draw_line(struct char_framebuffer *fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
@@ -237,7 +292,7 @@ static void draw_line(struct char_framebuffer *fb, int16_t x0, int16_t y0, int16
 static int draw_text(const struct device *dev, const char *const str, int16_t x, int16_t y,
 		     bool wrap)
 {
-	const struct char_framebuffer *fb = &char_fb;
+	struct char_framebuffer *fb = &char_fb;
 	const struct cfb_font *fptr;
 
 	if (!fb->fonts || !fb->buf) {
@@ -311,7 +366,7 @@ int cfb_print(const struct device *dev, const char *const str, uint16_t x, uint1
 int cfb_invert_area(const struct device *dev, uint16_t x, uint16_t y,
 		    uint16_t width, uint16_t height)
 {
-	const struct char_framebuffer *fb = &char_fb;
+	struct char_framebuffer *fb = &char_fb;
 	const bool need_reverse = ((fb->screen_info & SCREEN_INFO_MONO_MSB_FIRST) != 0);
 
 	if (x >= fb->x_res || y >= fb->y_res) {
@@ -337,6 +392,8 @@ int cfb_invert_area(const struct device *dev, uint16_t x, uint16_t y,
 			height = fb->y_res - y;
 		}
 
+		mark_dirty(fb, x, y, x + width, y + height);
+
 		for (size_t i = x; i < x + width; i++) {
 			for (size_t j = y; j < (y + height); j++) {
 				/*
@@ -395,24 +452,53 @@ int cfb_invert_area(const struct device *dev, uint16_t x, uint16_t y,
 	return -EINVAL;
 }
 
-static int cfb_invert(const struct char_framebuffer *fb)
+static void invert_bytes(uint8_t *buf, size_t len)
 {
-	for (size_t i = 0; i < fb->x_res * fb->y_res / 8U; i++) {
-		fb->buf[i] = ~fb->buf[i];
+	for (size_t i = 0; i < len; i++) {
+		buf[i] = ~buf[i];
 	}
+}
 
-	return 0;
+/* Write the columns x0 to x1 of the pages p0 to p1, both excluded */
+static int write_area(const struct device *dev, const struct char_framebuffer *fb,
+		      uint16_t x0, uint16_t x1, uint16_t p0, uint16_t p1, bool invert)
+{
+	const struct display_driver_api *api = dev->api;
+	struct display_buffer_descriptor desc;
+	uint8_t *buf = &fb->buf[p0 * fb->x_res + x0];
+	int err;
+
+	/* The pages are only contiguous in the buffer if they are complete */
+	__ASSERT_NO_MSG((p1 - p0 == 1) || (x1 - x0 == fb->x_res));
+
+	desc.width = x1 - x0;
+	desc.height = (p1 - p0) * fb->ppt;
+	desc.pitch = desc.width;
+	desc.buf_size = desc.width * (p1 - p0);
+
+	if (invert) {
+		invert_bytes(buf, desc.buf_size);
+	}
+
+	err = api->write(dev, x0, p0 * fb->ppt, &desc, buf);
+
+	if (invert) {
+		invert_bytes(buf, desc.buf_size);
+	}
+
+	return err;
 }
 
 int cfb_framebuffer_clear(const struct device *dev, bool clear_display)
 {
-	const struct char_framebuffer *fb = &char_fb;
+	struct char_framebuffer *fb = &char_fb;
 
 	if (!fb || !fb->buf) {
 		return -ENODEV;
 	}
 
 	memset(fb->buf, 0, fb->size);
+	mark_all_dirty(fb);
 
 	if (clear_display) {
 		cfb_framebuffer_finalize(dev);
@@ -430,34 +516,118 @@ int cfb_framebuffer_invert(const struct device *dev)
 	}
 
 	fb->inverted = !fb->inverted;
+	mark_all_dirty(fb);
 
 	return 0;
 }
 
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_SHADOW
+/*
+ * Narrow the columns x0 to x1 of a page to the ones which differ from the
+ * display, return false if none does.
+ */
+static bool shadow_diff(const struct char_framebuffer *fb, uint16_t page,
+			uint16_t *x0, uint16_t *x1, bool invert)
+{
+	const size_t base = page * fb->x_res;
+	const uint8_t mask = invert ? 0xFF : 0x00;
+	uint16_t first = *x0;
+	uint16_t last = *x1;
+
+	if (!fb->shadow_valid) {
+		return true;
+	}
+
+	while (first < last && (fb->buf[base + first] ^ mask) == fb->shadow[base + first]) {
+		first++;
+	}
+
+	while (last > first && (fb->buf[base + last - 1] ^ mask) == fb->shadow[base + last - 1]) {
+		last--;
+	}
+
+	*x0 = first;
+	*x1 = last;
+
+	return first < last;
+}
+
+static void shadow_update(struct char_framebuffer *fb, uint16_t page,
+			  uint16_t x0, uint16_t x1, bool invert)
+{
+	const size_t base = page * fb->x_res;
+	const uint8_t mask = invert ? 0xFF : 0x00;
+
+	for (size_t i = base + x0; i < base + x1; i++) {
+		fb->shadow[i] = fb->buf[i] ^ mask;
+	}
+}
+#endif /* CONFIG_CHARACTER_FRAMEBUFFER_SHADOW */
+
 int cfb_framebuffer_finalize(const struct device *dev)
 {
-	const struct display_driver_api *api = dev->api;
-	const struct char_framebuffer *fb = &char_fb;
-	struct display_buffer_descriptor desc;
+	struct char_framebuffer *fb = &char_fb;
+	bool invert;
 	int err;
 
 	if (!fb || !fb->buf) {
 		return -ENODEV;
 	}
 
-	desc.buf_size = fb->size;
-	desc.width = fb->x_res;
-	desc.height = fb->y_res;
-	desc.pitch = fb->x_res;
+	invert = !(fb->pixel_format & PIXEL_FORMAT_MONO10) != !(fb->inverted);
 
-	if (!(fb->pixel_format & PIXEL_FORMAT_MONO10) != !(fb->inverted)) {
-		cfb_invert(fb);
-		err = api->write(dev, 0, 0, &desc, fb->buf);
-		cfb_invert(fb);
-		return err;
+	if (!IS_ENABLED(CONFIG_CHARACTER_FRAMEBUFFER_PARTIAL_UPDATE)) {
+		return write_area(dev, fb, 0, fb->x_res, 0, fb->y_res / fb->ppt, invert);
 	}
 
-	return api->write(dev, 0, 0, &desc, fb->buf);
+	if (fb->dirty_x0 >= fb->dirty_x1) {
+		/* Nothing changed since the last write */
+		return 0;
+	}
+
+	if (!IS_ENABLED(CONFIG_CHARACTER_FRAMEBUFFER_SHADOW) &&
+	    fb->dirty_x0 == 0 && fb->dirty_x1 == fb->x_res) {
+		/* Complete pages are written at once */
+		err = write_area(dev, fb, 0, fb->x_res, fb->dirty_p0, fb->dirty_p1, invert);
+		if (err) {
+			return err;
+		}
+
+		clear_dirty(fb);
+		return 0;
+	}
+
+	for (uint16_t page = fb->dirty_p0; page < fb->dirty_p1; page++) {
+		uint16_t x0 = fb->dirty_x0;
+		uint16_t x1 = fb->dirty_x1;
+
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_SHADOW
+		if (!shadow_diff(fb, page, &x0, &x1, invert)) {
+			continue;
+		}
+#endif
+
+		err = write_area(dev, fb, x0, x1, page, page + 1, invert);
+		if (err) {
+			/* Keep the remaining pages dirty */
+			fb->dirty_p0 = page;
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_SHADOW
+			fb->shadow_valid = false;
+#endif
+			return err;
+		}
+
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_SHADOW
+		shadow_update(fb, page, x0, x1, invert);
+#endif
+	}
+
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_SHADOW
+	fb->shadow_valid = true;
+#endif
+	clear_dirty(fb);
+
+	return 0;
 }
 
 int cfb_get_display_parameter(const struct device *dev,
@@ -565,5 +735,20 @@ int cfb_framebuffer_init(const struct device *dev)
 
 	memset(fb->buf, 0, fb->size);
 
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_SHADOW
+	fb->shadow = k_malloc(fb->size);
+	if (!fb->shadow) {
+		k_free(fb->buf);
+		fb->buf = NULL;
+		return -ENOMEM;
+	}
+
+	fb->shadow_valid = false;
+#endif
+
+	/* The display contents are unknown until the first write */
+	clear_dirty(fb);
+	mark_all_dirty(fb);
+
 	return 0;
 }
@@ -26,8 +26,23 @@ LOG_MODULE_DECLARE(fs, CONFIG_FS_LOG_LEVEL);
 K_MEM_SLAB_DEFINE(fatfs_dirp_pool, sizeof(DIR),
 			CONFIG_FS_FATFS_NUM_DIRS, 4);
 
+#if defined(CONFIG_FS_FATFS_FASTSEEK)
+struct fatfs_file {
+	/* Must be first, zfp->filep is used as a FIL pointer */
+	FIL fil;
+	/* Cluster link map table, built at the first seek after open or
+	 * after a change of the cluster chain.
+	 */
+	bool clmt_built;
+	DWORD clmt[CONFIG_FS_FATFS_FASTSEEK_TABLE_SIZE];
+};
+#define FATFS_FILE_SIZE sizeof(struct fatfs_file)
+#else
+#define FATFS_FILE_SIZE sizeof(FIL)
+#endif /* CONFIG_FS_FATFS_FASTSEEK */
+
 /* Memory pool for FatFs file objects */
-K_MEM_SLAB_DEFINE(fatfs_filep_pool, sizeof(FIL),
+K_MEM_SLAB_DEFINE(fatfs_filep_pool, FATFS_FILE_SIZE,
 			CONFIG_FS_FATFS_NUM_FILES, 4);
 
 static int translate_error(int error)
@@ -114,6 +129,43 @@ static uint8_t translate_flags(fs_mode_t flags)
 	return fat_mode;
 }
 
+#if defined(CONFIG_FS_FATFS_FASTSEEK)
+/* Build the cluster link map table of a file opened with FS_O_FASTSEEK */
+static void fastseek_update(struct fs_file_t *zfp)
+{
+	struct fatfs_file *fatp = zfp->filep;
+	FRESULT res;
+
+	if (((zfp->flags & FS_O_FASTSEEK) == 0) || fatp->clmt_built) {
+		return;
+	}
+
+	fatp->clmt_built = true;
+	fatp->clmt[0] = ARRAY_SIZE(fatp->clmt);
+	fatp->fil.cltbl = fatp->clmt;
+
+	/* Only builds the table, the file position does not change */
+	res = f_lseek(&fatp->fil, CREATE_LINKMAP);
+	if (res != FR_OK) {
+		/* FR_NOT_ENOUGH_CORE when the file has too many fragments */
+		LOG_DBG("fast seek table not built (%d)", res);
+		fatp->fil.cltbl = NULL;
+	}
+}
+
+/* Stop using the table before the cluster chain of the file changes */
+static void fastseek_invalidate(struct fs_file_t *zfp)
+{
+	struct fatfs_file *fatp = zfp->filep;
+
+	fatp->fil.cltbl = NULL;
+	fatp->clmt_built = false;
+}
+#else
+static inline void fastseek_update(struct fs_file_t *zfp) {}
+static inline void fastseek_invalidate(struct fs_file_t *zfp) {}
+#endif /* CONFIG_FS_FATFS_FASTSEEK */
+
 static int fatfs_open(struct fs_file_t *zfp, const char *file_name,
 		      fs_mode_t mode)
 {
@@ -122,7 +174,7 @@ static int fatfs_open(struct fs_file_t *zfp, const char *file_name,
 	void *ptr;
 
 	if (k_mem_slab_alloc(&fatfs_filep_pool, &ptr, K_NO_WAIT) == 0) {
-		(void)memset(ptr, 0, sizeof(FIL));
+		(void)memset(ptr, 0, FATFS_FILE_SIZE);
 		zfp->filep = ptr;
 	} else {
 		return -ENOMEM;
@@ -220,6 +272,11 @@ static ssize_t fatfs_write(struct fs_file_t *zfp, const void *ptr, size_t size)
 		res = f_lseek(zfp->filep, pos);
 	}
 
+	/* FatFs does not allocate clusters while using the fast seek table */
+	if (f_tell((FIL *)zfp->filep) + size > pos) {
+		fastseek_invalidate(zfp);
+	}
+
 	if (res == FR_OK) {
 		res = f_write(zfp->filep, ptr, size, &bw);
 	}
@@ -257,6 +314,8 @@ static int fatfs_seek(struct fs_file_t *zfp, off_t offset, int whence)
 		return -EINVAL;
 	}
 
+	fastseek_update(zfp);
+
 	res = f_lseek(zfp->filep, pos);
 
 	return translate_error(res);
@@ -274,6 +333,8 @@ static int fatfs_truncate(struct fs_file_t *zfp, off_t length)
 #if !defined(CONFIG_FS_FATFS_READ_ONLY)
 	off_t cur_length = f_size((FIL *)zfp->filep);
 
+	fastseek_invalidate(zfp);
+
 	/* f_lseek expands file if new position is larger than file size */
 	res = f_lseek(zfp->filep, length);
 	if (res != FR_OK) {
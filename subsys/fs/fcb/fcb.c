@@ -118,6 +118,11 @@ fcb_init(int f_area_id, struct fcb *fcb)
 	if (align == 0U) {
 		return -EINVAL;
 	}
+	fcb->f_align = align;
+
+	for (i = 0; i < fcb->f_sector_cnt; i++) {
+		fcb_index_reset(fcb, &fcb->f_sectors[i]);
+	}
 
 	/* Fill last used, first used */
 	for (i = 0; i < fcb->f_sector_cnt; i++) {
@@ -153,7 +158,6 @@ fcb_init(int f_area_id, struct fcb *fcb)
 		}
 		newest = oldest = 0;
 	}
-	fcb->f_align = align;
 	fcb->f_oldest = oldest_sector;
 	fcb->f_active.fe_sector = newest_sector;
 	fcb->f_active.fe_elem_off = fcb_len_in_flash(fcb, sizeof(struct fcb_disk_area));
@@ -270,6 +274,8 @@ fcb_sector_hdr_init(struct fcb *fcb, struct flash_sector *sector, uint16_t id)
 	fda._pad = fcb->f_erase_value;
 	fda.fd_id = id;
 
+	fcb_index_reset(fcb, sector);
+
 	rc = fcb_flash_write(fcb, sector, 0, &fda, sizeof(fda));
 	if (rc != 0) {
 		return -EIO;
@@ -9,6 +9,7 @@
 #include <string.h>
 
 #include <zephyr/fs/fcb.h>
+#include <zephyr/sys/crc.h>
 #include "fcb_priv.h"
 
 static struct flash_sector *
@@ -56,10 +57,38 @@ fcb_append_to_scratch(struct fcb *fcb)
 	return 0;
 }
 
+/*
+ * Make sure the active sector has room for len bytes, moving to a new sector
+ * if needed. Called with the FCB locked.
+ */
+static int
+fcb_append_reserve(struct fcb *fcb, uint32_t len)
+{
+	struct flash_sector *sector;
+	struct fcb_entry *active;
+	int rc;
+
+	active = &fcb->f_active;
+	if (active->fe_elem_off + len > active->fe_sector->fs_size) {
+		sector = fcb_new_sector(fcb, fcb->f_scratch_cnt);
+		if (!sector || (sector->fs_size <
+			fcb_len_in_flash(fcb, sizeof(struct fcb_disk_area)) + len)) {
+			return -ENOSPC;
+		}
+		rc = fcb_sector_hdr_init(fcb, sector, fcb->f_active_id + 1);
+		if (rc) {
+			return rc;
+		}
+		fcb->f_active.fe_sector = sector;
+		fcb->f_active.fe_elem_off = fcb_len_in_flash(fcb, sizeof(struct fcb_disk_area));
+		fcb->f_active_id++;
+	}
+	return 0;
+}
+
 int
 fcb_append(struct fcb *fcb, uint16_t len, struct fcb_entry *append_loc)
 {
-	struct flash_sector *sector;
 	struct fcb_entry *active;
 	int cnt;
 	int rc;
@@ -81,23 +110,12 @@ fcb_append(struct fcb *fcb, uint16_t len, struct fcb_entry *append_loc)
 	if (rc) {
 		return -EINVAL;
 	}
-	active = &fcb->f_active;
-	if (active->fe_elem_off + len + cnt > active->fe_sector->fs_size) {
-		sector = fcb_new_sector(fcb, fcb->f_scratch_cnt);
-		if (!sector || (sector->fs_size <
-			fcb_len_in_flash(fcb, sizeof(struct fcb_disk_area)) + len + cnt)) {
-			rc = -ENOSPC;
-			goto err;
-		}
-		rc = fcb_sector_hdr_init(fcb, sector, fcb->f_active_id + 1);
-		if (rc) {
-			goto err;
-		}
-		fcb->f_active.fe_sector = sector;
-		fcb->f_active.fe_elem_off = fcb_len_in_flash(fcb, sizeof(struct fcb_disk_area));
-		fcb->f_active_id++;
+	rc = fcb_append_reserve(fcb, len + cnt);
+	if (rc) {
+		goto err;
 	}
 
+	active = &fcb->f_active;
 	rc = fcb_flash_write(fcb, active->fe_sector, active->fe_elem_off, tmp_str, cnt);
 	if (rc) {
 		rc = -EIO;
@@ -138,3 +156,95 @@ fcb_append_finish(struct fcb *fcb, struct fcb_entry *loc)
 	}
 	return 0;
 }
+
+void
+fcb_batch_init(struct fcb_batch *batch, uint8_t *buf, size_t size)
+{
+	batch->fb_buf = buf;
+	batch->fb_size = size;
+	batch->fb_used = 0;
+	batch->fb_cnt = 0;
+}
+
+int
+fcb_batch_add(struct fcb *fcb, struct fcb_batch *batch, const void *data, uint16_t len)
+{
+	uint8_t *elem;
+	uint8_t *em;
+	int cnt;
+	size_t hdr_len;
+	size_t data_len;
+	size_t em_len;
+
+	elem = &batch->fb_buf[batch->fb_used];
+	if (batch->fb_size - batch->fb_used < 2) {
+		return -ENOMEM;
+	}
+	cnt = fcb_put_len(fcb, elem, len);
+	if (cnt < 0) {
+		return cnt;
+	}
+	hdr_len = fcb_len_in_flash(fcb, cnt);
+	data_len = fcb_len_in_flash(fcb, len);
+	em_len = fcb_len_in_flash(fcb, FCB_CRC_SZ);
+
+	if (hdr_len + data_len + em_len > batch->fb_size - batch->fb_used) {
+		return -ENOMEM;
+	}
+
+	/* Same layout and padding as fcb_append() and fcb_append_finish() */
+	memset(&elem[cnt], fcb->f_erase_value, hdr_len - cnt);
+	memcpy(&elem[hdr_len], data, len);
+	memset(&elem[hdr_len + len], fcb->f_erase_value, data_len - len);
+
+	em = &elem[hdr_len + data_len];
+	memset(em, 0xFF, em_len);
+#if IS_ENABLED(CONFIG_FCB_ALLOW_FIXED_ENDMARKER)
+	if (fcb->f_flags & FCB_FLAGS_CRC_DISABLED) {
+		em[0] = FCB_FIXED_ENDMARKER;
+	} else
+#endif /* IS_ENABLED(CONFIG_FCB_ALLOW_FIXED_ENDMARKER) */
+	{
+		em[0] = crc8_ccitt(CRC8_CCITT_INITIAL_VALUE, elem, cnt);
+		em[0] = crc8_ccitt(em[0], data, len);
+	}
+
+	batch->fb_used += hdr_len + data_len + em_len;
+	batch->fb_cnt++;
+	return 0;
+}
+
+int
+fcb_batch_append(struct fcb *fcb, struct fcb_batch *batch)
+{
+	struct fcb_entry *active;
+	int rc;
+
+	if (batch->fb_cnt == 0) {
+		return 0;
+	}
+
+	rc = k_mutex_lock(&fcb->f_mtx, K_FOREVER);
+	if (rc) {
+		return -EINVAL;
+	}
+	rc = fcb_append_reserve(fcb, batch->fb_used);
+	if (rc) {
+		goto out;
+	}
+
+	active = &fcb->f_active;
+	rc = fcb_flash_write(fcb, active->fe_sector, active->fe_elem_off, batch->fb_buf,
+			     batch->fb_used);
+	if (rc) {
+		rc = -EIO;
+		goto out;
+	}
+	active->fe_elem_off += batch->fb_used;
+
+	batch->fb_used = 0;
+	batch->fb_cnt = 0;
+out:
+	k_mutex_unlock(&fcb->f_mtx);
+	return rc;
+}
@@ -10,8 +10,6 @@
 #include <zephyr/fs/fcb.h>
 #include "fcb_priv.h"
 
-#define FCB_FIXED_ENDMARKER 0xab
-
 /*
  * Given offset in flash sector, fill in rest of the fcb_entry, and crc8 over
  * the data.
@@ -66,12 +64,11 @@ fcb_elem_crc8(struct fcb *_fcb, struct fcb_entry *loc, uint8_t *c8p)
 	return 0;
 }
 
-#if IS_ENABLED(CONFIG_FCB_ALLOW_FIXED_ENDMARKER)
-/* Given the offset in flash sector, calculate the FCB entry data offset and size, and set
- * the fixed endmarker.
+#if IS_ENABLED(CONFIG_FCB_ALLOW_FIXED_ENDMARKER) || IS_ENABLED(CONFIG_FCB_INDEX)
+/* Given the offset in flash sector, calculate the FCB entry data offset and size.
  */
 static int
-fcb_elem_endmarker_fixed(struct fcb *_fcb, struct fcb_entry *loc, uint8_t *em)
+fcb_elem_len(struct fcb *_fcb, struct fcb_entry *loc)
 {
 	uint8_t tmp_str[2];
 	int cnt;
@@ -94,6 +91,24 @@ fcb_elem_endmarker_fixed(struct fcb *_fcb, struct fcb_entry *loc, uint8_t *em)
 	loc->fe_data_off = loc->fe_elem_off + fcb_len_in_flash(_fcb, cnt);
 	loc->fe_data_len = len;
 
+	return 0;
+}
+#endif
+
+#if IS_ENABLED(CONFIG_FCB_ALLOW_FIXED_ENDMARKER)
+/* Given the offset in flash sector, calculate the FCB entry data offset and size, and set
+ * the fixed endmarker.
+ */
+static int
+fcb_elem_endmarker_fixed(struct fcb *_fcb, struct fcb_entry *loc, uint8_t *em)
+{
+	int rc;
+
+	rc = fcb_elem_len(_fcb, loc);
+	if (rc) {
+		return rc;
+	}
+
 	*em = FCB_FIXED_ENDMARKER;
 	return 0;
 }
@@ -114,10 +129,8 @@ fcb_elem_endmarker(struct fcb *_fcb, struct fcb_entry *loc, uint8_t *em)
 	return fcb_elem_crc8(_fcb, loc, em);
 }
 
-/* Given the offset in flash sector, calculate the FCB entry data offset and size, and verify that
- * the FCB entry endmarker is correct.
- */
-int fcb_elem_info(struct fcb *_fcb, struct fcb_entry *loc)
+static int
+fcb_elem_check(struct fcb *_fcb, struct fcb_entry *loc)
 {
 	int rc;
 	uint8_t em;
@@ -147,3 +160,31 @@ int fcb_elem_info(struct fcb *_fcb, struct fcb_entry *loc)
 	}
 	return 0;
 }
+
+/* Given the offset in flash sector, calculate the FCB entry data offset and size, and verify that
+ * the FCB entry endmarker is correct.
+ */
+int fcb_elem_info(struct fcb *_fcb, struct fcb_entry *loc)
+{
+#ifdef CONFIG_FCB_INDEX
+	uint32_t *verified = fcb_index_entry(_fcb, loc->fe_sector);
+	int rc;
+
+	/* Entries are never modified once written, skip the data check */
+	if ((verified != NULL) && (loc->fe_elem_off < *verified)) {
+		return fcb_elem_len(_fcb, loc);
+	}
+
+	rc = fcb_elem_check(_fcb, loc);
+
+	/* Extend the run of valid entries at the start of the sector */
+	if ((rc == 0) && (verified != NULL) && (loc->fe_elem_off == *verified)) {
+		*verified = loc->fe_data_off + fcb_len_in_flash(_fcb, loc->fe_data_len) +
+			    fcb_len_in_flash(_fcb, FCB_CRC_SZ);
+	}
+
+	return rc;
+#else
+	return fcb_elem_check(_fcb, loc);
+#endif /* CONFIG_FCB_INDEX */
+}
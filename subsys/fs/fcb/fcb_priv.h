@@ -15,6 +15,8 @@ extern "C" {
 #define FCB_CRC_SZ	sizeof(uint8_t)
 #define FCB_TMP_BUF_SZ	32
 
+#define FCB_FIXED_ENDMARKER 0xab
+
 #define FCB_ID_GT(a, b) (((int16_t)(a) - (int16_t)(b)) > 0)
 
 #define MK32(val) ((((uint32_t)(val)) << 24) |			\
@@ -73,6 +75,33 @@ int fcb_elem_info(struct fcb *fcb, struct fcb_entry *loc);
 int fcb_elem_endmarker(struct fcb *fcb, struct fcb_entry *loc, uint8_t *crc8p);
 
 int fcb_sector_hdr_init(struct fcb *fcb, struct flash_sector *sector, uint16_t id);
+
+#ifdef CONFIG_FCB_INDEX
+/* Offset up to which the entries of a sector are known to be valid */
+static inline uint32_t *fcb_index_entry(struct fcb *fcb,
+					const struct flash_sector *sector)
+{
+	if (fcb->f_index == NULL) {
+		return NULL;
+	}
+	return &fcb->f_index[sector - fcb->f_sectors];
+}
+
+static inline void fcb_index_reset(struct fcb *fcb,
+				   const struct flash_sector *sector)
+{
+	uint32_t *verified = fcb_index_entry(fcb, sector);
+
+	if (verified != NULL) {
+		*verified = fcb_len_in_flash(fcb, sizeof(struct fcb_disk_area));
+	}
+}
+#else
+static inline void fcb_index_reset(struct fcb *fcb,
+				   const struct flash_sector *sector)
+{
+}
+#endif /* CONFIG_FCB_INDEX */
 int fcb_sector_hdr_read(struct fcb *fcb, struct flash_sector *sector,
 			struct fcb_disk_area *fdap);
 
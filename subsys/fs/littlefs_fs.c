@@ -69,6 +69,29 @@ BUILD_ASSERT((CONFIG_FS_LITTLEFS_HEAP_PER_ALLOC_OVERHEAD_SIZE % 8) == 0);
 
 static K_HEAP_DEFINE(file_cache_heap, CONFIG_FS_LITTLEFS_FC_HEAP_SIZE);
 
+#if CONFIG_FS_LITTLEFS_LOOKAHEAD_HEAP_SIZE > 0
+static K_HEAP_DEFINE(lookahead_heap, CONFIG_FS_LITTLEFS_LOOKAHEAD_HEAP_SIZE);
+#endif
+
+#ifdef CONFIG_FS_LITTLEFS_STATS
+STATS_NAME_START(littlefs_stats)
+STATS_NAME(littlefs_stats, reads)
+STATS_NAME(littlefs_stats, read_bytes)
+STATS_NAME(littlefs_stats, progs)
+STATS_NAME(littlefs_stats, prog_bytes)
+STATS_NAME(littlefs_stats, erases)
+STATS_NAME(littlefs_stats, syncs)
+STATS_NAME_END(littlefs_stats);
+
+/* The block device callbacks only get the littlefs configuration */
+#define LFS_STATS_INCN(c__, var__, n__)					\
+	STATS_INCN(CONTAINER_OF(c__, struct fs_littlefs, cfg)->stats, var__, n__)
+#else
+#define LFS_STATS_INCN(c__, var__, n__)
+#endif /* CONFIG_FS_LITTLEFS_STATS */
+
+#define LFS_STATS_INC(c__, var__) LFS_STATS_INCN(c__, var__, 1)
+
 static inline bool littlefs_on_blkdev(int flags)
 {
 	return (flags & FS_MOUNT_FLAG_USE_DISK_ACCESS) ? true : false;
@@ -179,6 +202,9 @@ static int lfs_api_read(const struct lfs_config *c, lfs_block_t block,
 
 	int rc = flash_area_read(fa, offset, buffer, size);
 
+	LFS_STATS_INC(c, reads);
+	LFS_STATS_INCN(c, read_bytes, size);
+
 	return errno_to_lfs(rc);
 }
 
@@ -190,6 +216,9 @@ static int lfs_api_prog(const struct lfs_config *c, lfs_block_t block,
 
 	int rc = flash_area_write(fa, offset, buffer, size);
 
+	LFS_STATS_INC(c, progs);
+	LFS_STATS_INCN(c, prog_bytes, size);
+
 	return errno_to_lfs(rc);
 }
 
@@ -200,6 +229,8 @@ static int lfs_api_erase(const struct lfs_config *c, lfs_block_t block)
 
 	int rc = flash_area_flatten(fa, offset, c->block_size);
 
+	LFS_STATS_INC(c, erases);
+
 	return errno_to_lfs(rc);
 }
 #endif /* CONFIG_FS_LITTLEFS_FMP_DEV */
@@ -212,6 +243,9 @@ static int lfs_api_read_blk(const struct lfs_config *c, lfs_block_t block,
 	int rc = disk_access_read(disk, buffer, block,
 				  size / c->block_size);
 
+	LFS_STATS_INC(c, reads);
+	LFS_STATS_INCN(c, read_bytes, size);
+
 	return errno_to_lfs(rc);
 }
 
@@ -221,6 +255,9 @@ static int lfs_api_prog_blk(const struct lfs_config *c, lfs_block_t block,
 	const char *disk = c->context;
 	int rc = disk_access_write(disk, buffer, block, size / c->block_size);
 
+	LFS_STATS_INC(c, progs);
+	LFS_STATS_INCN(c, prog_bytes, size);
+
 	return errno_to_lfs(rc);
 }
 
@@ -229,6 +266,8 @@ static int lfs_api_sync_blk(const struct lfs_config *c)
 	const char *disk = c->context;
 	int rc = disk_access_ioctl(disk, DISK_IOCTL_CTRL_SYNC, NULL);
 
+	LFS_STATS_INC(c, syncs);
+
 	return errno_to_lfs(rc);
 }
 #else
@@ -256,6 +295,8 @@ static int lfs_api_erase_blk(const struct lfs_config *c, lfs_block_t block)
 
 static int lfs_api_sync(const struct lfs_config *c)
 {
+	LFS_STATS_INC(c, syncs);
+
 	return LFS_ERR_OK;
 }
 
@@ -893,9 +934,36 @@ static int littlefs_init_fs(struct fs_littlefs *fs, void *dev_id, int flags)
 	if (ret < 0) {
 		return ret;
 	}
+
+#if CONFIG_FS_LITTLEFS_LOOKAHEAD_HEAP_SIZE > 0
+	if (fs->cfg.lookahead_buffer == NULL) {
+		fs->lookahead_heap_buffer = k_heap_aligned_alloc(&lookahead_heap,
+								 sizeof(uint64_t),
+								 fs->cfg.lookahead_size,
+								 K_NO_WAIT);
+		if (fs->lookahead_heap_buffer == NULL) {
+			LOG_ERR("can't allocate %u byte lookahead buffer",
+				fs->cfg.lookahead_size);
+			return -ENOMEM;
+		}
+		fs->cfg.lookahead_buffer = fs->lookahead_heap_buffer;
+	}
+#endif
 	return 0;
 }
 
+static void littlefs_release_fs(struct fs_littlefs *fs)
+{
+#if CONFIG_FS_LITTLEFS_LOOKAHEAD_HEAP_SIZE > 0
+	if (fs->lookahead_heap_buffer != NULL) {
+		k_heap_free(&lookahead_heap, fs->lookahead_heap_buffer);
+		fs->lookahead_heap_buffer = NULL;
+		fs->cfg.lookahead_buffer = NULL;
+	}
+#endif
+	fs->backend = NULL;
+}
+
 static int littlefs_mount(struct fs_mount_t *mountp)
 {
 	int ret = 0;
@@ -939,11 +1007,17 @@ static int littlefs_mount(struct fs_mount_t *mountp)
 		goto out;
 	}
 
+#ifdef CONFIG_FS_LITTLEFS_STATS
+	if (fs->stats.s_hdr.s_name == NULL) {
+		(void)STATS_INIT_AND_REG(fs->stats, STATS_SIZE_32, mountp->mnt_point);
+	}
+#endif
+
 	LOG_INF("%s mounted", mountp->mnt_point);
 
 out:
 	if (ret < 0) {
-		fs->backend = NULL;
+		littlefs_release_fs(fs);
 	}
 
 	fs_unlock(fs);
@@ -982,7 +1056,7 @@ static int littlefs_mkfs(uintptr_t dev_id, void *cfg, int flags)
 		goto out;
 	}
 out:
-	fs->backend = NULL;
+	littlefs_release_fs(fs);
 	fs_unlock(fs);
 	return ret;
 }
@@ -1003,7 +1077,7 @@ static int littlefs_unmount(struct fs_mount_t *mountp)
 	}
 #endif /* CONFIG_FS_LITTLEFS_FMP_DEV */
 
-	fs->backend = NULL;
+	littlefs_release_fs(fs);
 	fs_unlock(fs);
 
 	LOG_INF("%s unmounted", mountp->mnt_point);
@@ -36,14 +36,84 @@ static inline size_t nvs_lookup_cache_pos(uint16_t id)
 	return hash % CONFIG_NVS_LOOKUP_CACHE_SIZE;
 }
 
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+
+/* The cache is a complete index: each id owns a slot found by linear probing
+ * from its hash position. Slots keep their id when the address is dropped
+ * after a gc, and are only freed when the index is rebuilt on mount.
+ * Returns CONFIG_NVS_LOOKUP_CACHE_SIZE when the id has no slot and the
+ * index is full.
+ */
+static size_t nvs_lookup_index_slot(struct nvs_fs *fs, uint16_t id)
+{
+	size_t pos = nvs_lookup_cache_pos(id);
+
+	for (size_t i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
+		if ((fs->lookup_index_id[pos] == id) ||
+		    (fs->lookup_index_id[pos] == NVS_LOOKUP_INDEX_NO_ID)) {
+			return pos;
+		}
+		pos = (pos + 1) % CONFIG_NVS_LOOKUP_CACHE_SIZE;
+	}
+
+	return CONFIG_NVS_LOOKUP_CACHE_SIZE;
+}
+
+#endif /* CONFIG_NVS_LOOKUP_INDEX */
+
+/* Get the address to start the lookup of the most recent ate of the id */
+static uint32_t nvs_lookup_cache_get(struct nvs_fs *fs, uint16_t id)
+{
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	size_t pos = nvs_lookup_index_slot(fs, id);
+
+	if (pos == CONFIG_NVS_LOOKUP_CACHE_SIZE) {
+		/* index overflow, the id can only be found by a full walk */
+		return fs->ate_wra;
+	}
+
+	return fs->lookup_cache[pos];
+#else
+	return fs->lookup_cache[nvs_lookup_cache_pos(id)];
+#endif
+}
+
+static void nvs_lookup_cache_set(struct nvs_fs *fs, uint16_t id, uint32_t addr)
+{
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	size_t pos = nvs_lookup_index_slot(fs, id);
+
+	if (pos == CONFIG_NVS_LOOKUP_CACHE_SIZE) {
+		LOG_DBG("Lookup index full, id %d not indexed", id);
+		return;
+	}
+
+	fs->lookup_index_id[pos] = id;
+	fs->lookup_cache[pos] = addr;
+#else
+	fs->lookup_cache[nvs_lookup_cache_pos(id)] = addr;
+#endif
+}
+
+/* Make all lookups walk the ates from addr */
+static void nvs_lookup_cache_fill(struct nvs_fs *fs, uint32_t addr)
+{
+	for (size_t i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
+		fs->lookup_cache[i] = addr;
+	}
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	memset(fs->lookup_index_id, 0xff, sizeof(fs->lookup_index_id));
+#endif
+}
+
 static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
 {
 	int rc;
 	uint32_t addr, ate_addr;
-	uint32_t *cache_entry;
 	struct nvs_ate ate;
+	uint32_t start = k_cycle_get_32();
 
-	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+	nvs_lookup_cache_fill(fs, NVS_LOOKUP_CACHE_NO_ADDR);
 	addr = fs->ate_wra;
 
 	while (true) {
@@ -55,11 +125,10 @@ static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
 			return rc;
 		}
 
-		cache_entry = &fs->lookup_cache[nvs_lookup_cache_pos(ate.id)];
-
-		if (ate.id != 0xFFFF && *cache_entry == NVS_LOOKUP_CACHE_NO_ADDR &&
+		if (ate.id != 0xFFFF &&
+		    nvs_lookup_cache_get(fs, ate.id) == NVS_LOOKUP_CACHE_NO_ADDR &&
 		    nvs_ate_valid(fs, &ate)) {
-			*cache_entry = ate_addr;
+			nvs_lookup_cache_set(fs, ate.id, ate_addr);
 		}
 
 		if (addr == fs->ate_wra) {
@@ -67,6 +136,9 @@ static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
 		}
 	}
 
+	LOG_DBG("Lookup cache rebuilt in %u us",
+		k_cyc_to_us_floor32(k_cycle_get_32() - start));
+
 	return 0;
 }
 
@@ -166,7 +238,7 @@ static int nvs_flash_ate_wrt(struct nvs_fs *fs, const struct nvs_ate *entry)
 #ifdef CONFIG_NVS_LOOKUP_CACHE
 	/* 0xFFFF is a special-purpose identifier. Exclude it from the cache */
 	if (entry->id != 0xFFFF) {
-		fs->lookup_cache[nvs_lookup_cache_pos(entry->id)] = fs->ate_wra;
+		nvs_lookup_cache_set(fs, entry->id, fs->ate_wra);
 	}
 #endif
 	fs->ate_wra -= nvs_al_size(fs, sizeof(struct nvs_ate));
@@ -675,7 +747,7 @@ static int nvs_gc(struct nvs_fs *fs)
 		}
 
 #ifdef CONFIG_NVS_LOOKUP_CACHE
-		wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(gc_ate.id)];
+		wlk_addr = nvs_lookup_cache_get(fs, gc_ate.id);
 
 		if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
 			wlk_addr = fs->ate_wra;
@@ -913,9 +985,7 @@ static int nvs_startup(struct nvs_fs *fs)
 		 * So, temporarily, we set the lookup cache to the end of the fs.
 		 * The cache will be rebuilt afterwards
 		 **/
-		for (i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
-			fs->lookup_cache[i] = fs->ate_wra;
-		}
+		nvs_lookup_cache_fill(fs, fs->ate_wra);
 #endif
 		rc = nvs_gc(fs);
 		goto end;
@@ -969,6 +1039,48 @@ end:
 	return rc;
 }
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+
+/* Free space left in the sector being written */
+static inline uint32_t nvs_sector_free(struct nvs_fs *fs)
+{
+	return fs->ate_wra - fs->data_wra;
+}
+
+/* background garbage collection: close the current sector and gc the next
+ * one before a write runs out of space. A single sector is handled per run,
+ * with the same flash operations and recovery as the gc done by nvs_write.
+ */
+static void nvs_gc_work_handler(struct k_work *work)
+{
+	struct nvs_fs *fs = CONTAINER_OF(work, struct nvs_fs, gc_work);
+	int rc;
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+
+	/* a write may have rotated the sector in the meantime */
+	if (!fs->ready ||
+	    (nvs_sector_free(fs) >= CONFIG_NVS_BACKGROUND_GC_THRESHOLD)) {
+		goto end;
+	}
+
+	LOG_DBG("Background gc of sector %d", (fs->ate_wra >> ADDR_SECT_SHIFT));
+
+	rc = nvs_sector_close(fs);
+	if (rc) {
+		goto end;
+	}
+
+	rc = nvs_gc(fs);
+	if (rc) {
+		LOG_ERR("Background gc failed: %d", rc);
+	}
+end:
+	k_mutex_unlock(&fs->nvs_lock);
+}
+
+#endif /* CONFIG_NVS_BACKGROUND_GC */
+
 int nvs_clear(struct nvs_fs *fs)
 {
 	int rc;
@@ -979,6 +1091,12 @@ int nvs_clear(struct nvs_fs *fs)
 		return -EACCES;
 	}
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	struct k_work_sync sync;
+
+	(void)k_work_cancel_sync(&fs->gc_work, &sync);
+#endif
+
 	for (uint16_t i = 0; i < fs->sector_count; i++) {
 		addr = i << ADDR_SECT_SHIFT;
 		rc = nvs_flash_erase_sector(fs, addr);
@@ -1000,6 +1118,15 @@ int nvs_mount(struct nvs_fs *fs)
 	struct flash_pages_info info;
 	size_t write_block_size;
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	if (fs->ready) {
+		struct k_work_sync sync;
+
+		(void)k_work_cancel_sync(&fs->gc_work, &sync);
+	}
+	k_work_init(&fs->gc_work, nvs_gc_work_handler);
+#endif
+
 	k_mutex_init(&fs->nvs_lock);
 
 	fs->flash_parameters = flash_get_parameters(fs->flash_device);
@@ -1060,6 +1187,9 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 	uint32_t wlk_addr, rd_addr;
 	uint16_t required_space = 0U; /* no space, appropriate for delete ate */
 	bool prev_found = false;
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	uint32_t free_before;
+#endif
 
 	if (!fs->ready) {
 		LOG_ERR("NVS not initialized");
@@ -1082,7 +1212,7 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 
 	/* find latest entry with same id */
 #ifdef CONFIG_NVS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
+	wlk_addr = nvs_lookup_cache_get(fs, id);
 
 	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
 		goto no_cached_entry;
@@ -1147,6 +1277,10 @@ no_cached_entry:
 
 	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	free_before = nvs_sector_free(fs);
+#endif
+
 	gc_count = 0;
 	while (1) {
 		if (gc_count == fs->sector_count) {
@@ -1163,6 +1297,17 @@ no_cached_entry:
 			if (rc) {
 				goto end;
 			}
+#ifdef CONFIG_NVS_BACKGROUND_GC
+			/* Only start the gc when crossing the threshold, a sector
+			 * that is already low on space after a gc is left to the
+			 * synchronous gc to avoid needless erases.
+			 */
+			if ((gc_count == 0) &&
+			    (free_before >= CONFIG_NVS_BACKGROUND_GC_THRESHOLD) &&
+			    (nvs_sector_free(fs) < CONFIG_NVS_BACKGROUND_GC_THRESHOLD)) {
+				k_work_submit(&fs->gc_work);
+			}
+#endif
 			break;
 		}
 
@@ -1215,7 +1360,7 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 	cnt_his = 0U;
 
 #ifdef CONFIG_NVS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
+	wlk_addr = nvs_lookup_cache_get(fs, id);
 
 	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
 		rc = -ENOENT;
@@ -11,13 +11,30 @@
 
 LOG_MODULE_REGISTER(input, CONFIG_INPUT_LOG_LEVEL);
 
-#ifdef CONFIG_INPUT_MODE_THREAD
+#ifdef CONFIG_INPUT_FRAME_BATCHING
+
+/* Events of a device up to, and including, the one with sync set */
+struct input_frame {
+	uint8_t count;
+	struct input_event events[CONFIG_INPUT_FRAME_MAX_EVENTS];
+};
+
+/* Frames being built, a slot is free when its count is 0 */
+static struct input_frame input_frames[CONFIG_INPUT_FRAME_DEVICES];
+static struct k_spinlock input_frames_lock;
+
+K_MSGQ_DEFINE(input_msgq, sizeof(struct input_frame),
+	      CONFIG_INPUT_QUEUE_MAX_MSGS, 4);
+
+#elif defined(CONFIG_INPUT_MODE_THREAD)
 
 K_MSGQ_DEFINE(input_msgq, sizeof(struct input_event),
 	      CONFIG_INPUT_QUEUE_MAX_MSGS, 4);
 
 #endif
 
+#ifndef CONFIG_INPUT_FRAME_BATCHING
+
 static void input_process(struct input_event *evt)
 {
 	STRUCT_SECTION_FOREACH(input_callback, callback) {
@@ -27,8 +44,82 @@ static void input_process(struct input_event *evt)
 	}
 }
 
+#else /* CONFIG_INPUT_FRAME_BATCHING */
+
+static void input_process_frame(struct input_frame *frame)
+{
+	const struct device *dev = frame->events[0].dev;
+
+	/* All the events of a frame come from the same device, so each
+	 * callback is matched once per frame instead of once per event.
+	 */
+	STRUCT_SECTION_FOREACH(input_callback, callback) {
+		if (callback->dev != NULL && callback->dev != dev) {
+			continue;
+		}
+
+		for (uint8_t i = 0; i < frame->count; i++) {
+			callback->callback(&frame->events[i]);
+		}
+	}
+}
+
+static int input_report_frame(const struct input_event *evt, k_timeout_t timeout)
+{
+	struct input_frame *slot = NULL;
+	struct input_frame frame;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&input_frames_lock);
+
+	ARRAY_FOR_EACH_PTR(input_frames, f) {
+		if (f->count > 0 && f->events[0].dev == evt->dev) {
+			slot = f;
+			break;
+		}
+		if (f->count == 0 && slot == NULL) {
+			slot = f;
+		}
+	}
+
+	if (slot == NULL) {
+		/* More devices than slots are building a frame, send the
+		 * event on its own.
+		 */
+		k_spin_unlock(&input_frames_lock, key);
+
+		frame.count = 1;
+		frame.events[0] = *evt;
+
+		return k_msgq_put(&input_msgq, &frame, timeout);
+	}
+
+	slot->events[slot->count++] = *evt;
+
+	if (!evt->sync && slot->count < ARRAY_SIZE(slot->events)) {
+		k_spin_unlock(&input_frames_lock, key);
+		return 0;
+	}
+
+	frame = *slot;
+	slot->count = 0;
+
+	k_spin_unlock(&input_frames_lock, key);
+
+	return k_msgq_put(&input_msgq, &frame, timeout);
+}
+
+#endif /* CONFIG_INPUT_FRAME_BATCHING */
+
 bool input_queue_empty(void)
 {
+#ifdef CONFIG_INPUT_FRAME_BATCHING
+	ARRAY_FOR_EACH_PTR(input_frames, f) {
+		if (f->count > 0) {
+			return false;
+		}
+	}
+#endif
 #ifdef CONFIG_INPUT_MODE_THREAD
 	if (k_msgq_num_used_get(&input_msgq) > 0) {
 		return false;
@@ -49,7 +140,9 @@ int input_report(const struct device *dev,
 		.value = value,
 	};
 
-#ifdef CONFIG_INPUT_MODE_THREAD
+#if defined(CONFIG_INPUT_FRAME_BATCHING)
+	return input_report_frame(&evt, timeout);
+#elif defined(CONFIG_INPUT_MODE_THREAD)
 	return k_msgq_put(&input_msgq, &evt, timeout);
 #else
 	input_process(&evt);
@@ -61,17 +154,29 @@ int input_report(const struct device *dev,
 
 static void input_thread(void)
 {
+#ifdef CONFIG_INPUT_FRAME_BATCHING
+	struct input_frame frame;
+#else
 	struct input_event evt;
+#endif
 	int ret;
 
 	while (true) {
+#ifdef CONFIG_INPUT_FRAME_BATCHING
+		ret = k_msgq_get(&input_msgq, &frame, K_FOREVER);
+#else
 		ret = k_msgq_get(&input_msgq, &evt, K_FOREVER);
+#endif
 		if (ret) {
 			LOG_ERR("k_msgq_get error: %d", ret);
 			continue;
 		}
 
+#ifdef CONFIG_INPUT_FRAME_BATCHING
+		input_process_frame(&frame);
+#else
 		input_process(&evt);
+#endif
 	}
 }
 
@@ -86,6 +86,7 @@
 #include <zephyr/ipc/icmsg.h>
 #include <zephyr/ipc/ipc_service_backend.h>
 #include <zephyr/cache.h>
+#include <zephyr/stats/stats.h>
 
 LOG_MODULE_REGISTER(ipc_icbmsg,
 		    CONFIG_IPC_SERVICE_BACKEND_ICBMSG_LOG_LEVEL);
@@ -156,10 +157,43 @@ struct icbmsg_config {
 						 */
 };
 
+#ifdef CONFIG_IPC_SERVICE_BACKEND_ICBMSG_STATS
+STATS_SECT_START(icbmsg_ept_stats)
+STATS_SECT_ENTRY32(tx_msgs)		/* Messages sent. */
+STATS_SECT_ENTRY32(tx_bytes)		/* Bytes sent. */
+STATS_SECT_ENTRY32(tx_notify)		/* Notifications raised for sent messages. */
+STATS_SECT_ENTRY32(tx_wait_cycles)	/* Cycles spent waiting for free TX blocks. */
+STATS_SECT_ENTRY32(rx_msgs)		/* Messages received. */
+STATS_SECT_ENTRY32(rx_bytes)		/* Bytes received. */
+STATS_SECT_ENTRY32(rx_cycles)		/* Cycles spent in the receive callback. */
+STATS_SECT_ENTRY32(rx_max_cycles)	/* Longest receive callback, in cycles. */
+STATS_SECT_END;
+
+STATS_NAME_START(icbmsg_ept_stats)
+STATS_NAME(icbmsg_ept_stats, tx_msgs)
+STATS_NAME(icbmsg_ept_stats, tx_bytes)
+STATS_NAME(icbmsg_ept_stats, tx_notify)
+STATS_NAME(icbmsg_ept_stats, tx_wait_cycles)
+STATS_NAME(icbmsg_ept_stats, rx_msgs)
+STATS_NAME(icbmsg_ept_stats, rx_bytes)
+STATS_NAME(icbmsg_ept_stats, rx_cycles)
+STATS_NAME(icbmsg_ept_stats, rx_max_cycles)
+STATS_NAME_END(icbmsg_ept_stats);
+
+#define EPT_STATS_INC(ept, var) STATS_INC((ept)->stats, var)
+#define EPT_STATS_INCN(ept, var, n) STATS_INCN((ept)->stats, var, n)
+#else
+#define EPT_STATS_INC(ept, var)
+#define EPT_STATS_INCN(ept, var, n)
+#endif
+
 struct ept_data {
 	const struct ipc_ept_cfg *cfg;	/* Endpoint configuration. */
 	atomic_t state;			/* Bounding state. */
 	uint8_t addr;			/* Endpoint address. */
+#ifdef CONFIG_IPC_SERVICE_BACKEND_ICBMSG_STATS
+	STATS_SECT_DECL(icbmsg_ept_stats) stats; /* Endpoint statistics. */
+#endif
 };
 
 struct backend_data {
@@ -177,6 +211,12 @@ struct backend_data {
 					 * endpoints on lower.
 					 */
 	bool is_initiator;		/* This side has an initiator role. */
+#ifdef CONFIG_IPC_SERVICE_BACKEND_ICBMSG_COALESCE_RELEASE
+	bool release_pending;		/* Buffers were released without notifying
+					 * the remote. Only used from the ICMsg
+					 * receive callback.
+					 */
+#endif
 };
 
 struct block_header {
@@ -484,10 +524,11 @@ static int release_tx_buffer(struct backend_data *dev_data, const uint8_t *buffe
 /**
  * Send control message over ICMsg with mutex locked. Mutex must be locked because
  * ICMsg may return error on concurrent invocations even when there is enough space
- * in queue.
+ * in queue. If notify is false, the remote does not see the message until
+ * notify_control() is called or another message is sent with notification.
  */
 static int send_control_message(struct backend_data *dev_data, enum msg_type msg_type,
-				uint8_t ept_addr, uint8_t block_index)
+				uint8_t ept_addr, uint8_t block_index, bool notify)
 {
 	const struct icbmsg_config *conf = dev_data->conf;
 	const struct control_message message = {
@@ -498,8 +539,13 @@ static int send_control_message(struct backend_data *dev_data, enum msg_type msg
 	int r;
 
 	k_mutex_lock(&dev_data->mutex, K_FOREVER);
-	r = icmsg_send(&conf->control_config, &dev_data->control_data, &message,
-		       sizeof(message));
+	if (notify) {
+		r = icmsg_send(&conf->control_config, &dev_data->control_data, &message,
+			       sizeof(message));
+	} else {
+		r = icmsg_write(&conf->control_config, &dev_data->control_data, &message,
+				sizeof(message));
+	}
 	k_mutex_unlock(&dev_data->mutex);
 	if (r < sizeof(message)) {
 		LOG_ERR("Cannot send over ICMsg, err %d", r);
@@ -507,17 +553,33 @@ static int send_control_message(struct backend_data *dev_data, enum msg_type msg
 	return r;
 }
 
+/**
+ * Notify the remote of control messages sent without notification.
+ */
+static int notify_control(struct backend_data *dev_data)
+{
+	const struct icbmsg_config *conf = dev_data->conf;
+	int r;
+
+	r = icmsg_notify(&conf->control_config, &dev_data->control_data);
+	if (r < 0) {
+		LOG_ERR("Cannot notify over ICMsg, err %d", r);
+	}
+	return r;
+}
+
 /**
  * Release received buffer. This function will just send release control message.
  *
  * @param[in] buffer	Buffer to release.
  * @param[in] msg_type	Message type: MSG_RELEASE_BOUND or MSG_RELEASE_DATA.
  * @param[in] ept_addr	Endpoint address or zero for MSG_RELEASE_DATA.
+ * @param[in] notify	Notify the remote of the message.
  *
  * @return	zero or ICMsg send error.
  */
 static int send_release(struct backend_data *dev_data, const uint8_t *buffer,
-			enum msg_type msg_type, uint8_t ept_addr)
+			enum msg_type msg_type, uint8_t ept_addr, bool notify)
 {
 	const struct icbmsg_config *conf = dev_data->conf;
 	int rx_block_index;
@@ -527,7 +589,7 @@ static int send_release(struct backend_data *dev_data, const uint8_t *buffer,
 		return rx_block_index;
 	}
 
-	return send_control_message(dev_data, msg_type, ept_addr, rx_block_index);
+	return send_control_message(dev_data, msg_type, ept_addr, rx_block_index, notify);
 }
 
 /**
@@ -540,11 +602,12 @@ static int send_release(struct backend_data *dev_data, const uint8_t *buffer,
  *				so caller is responsible for passing only valid index.
  * @param[in] size		Actual size of the data, can be smaller than allocated,
  *				but it cannot change number of required blocks.
+ * @param[in] notify		Notify the remote of the message.
  *
  * @return			number of bytes sent in the message or negative error code.
  */
 static int send_block(struct backend_data *dev_data, enum msg_type msg_type,
-		      uint8_t ept_addr, size_t tx_block_index, size_t size)
+		      uint8_t ept_addr, size_t tx_block_index, size_t size, bool notify)
 {
 	struct block_content *block;
 	int r;
@@ -555,7 +618,7 @@ static int send_block(struct backend_data *dev_data, enum msg_type msg_type,
 	__sync_synchronize();
 	sys_cache_data_flush_range(block, size + BLOCK_HEADER_SIZE);
 
-	r = send_control_message(dev_data, msg_type, ept_addr, tx_block_index);
+	r = send_control_message(dev_data, msg_type, ept_addr, tx_block_index, notify);
 	if (r < 0) {
 		release_tx_blocks(dev_data, tx_block_index, size, -1);
 	}
@@ -643,7 +706,7 @@ static int match_bound_msg(struct backend_data *dev_data, size_t rx_block_index,
 	}
 
 	/* Release the bound message and inform remote that we are ready to receive. */
-	r = send_release(dev_data, buffer, MSG_RELEASE_BOUND, ept_addr);
+	r = send_release(dev_data, buffer, MSG_RELEASE_BOUND, ept_addr, true);
 	if (r < 0) {
 		return r;
 	}
@@ -670,7 +733,7 @@ static int send_bound_message(struct backend_data *dev_data, struct ept_data *ep
 	r = alloc_tx_buffer(dev_data, &alloc_size, &buffer, K_FOREVER);
 	if (r >= 0) {
 		strcpy(buffer, ept->cfg->name);
-		r = send_block(dev_data, MSG_BOUND, ept->addr, r, msg_len);
+		r = send_block(dev_data, MSG_BOUND, ept->addr, r, msg_len, true);
 	}
 
 	return r;
@@ -797,13 +860,34 @@ static int received_data(struct backend_data *dev_data, size_t rx_block_index,
 	/* Clear bit. If cleared, specific block will not be hold after the callback. */
 	sys_bitarray_clear_bit(conf->rx_hold_bitmap, rx_block_index);
 
+#ifdef CONFIG_IPC_SERVICE_BACKEND_ICBMSG_STATS
+	uint32_t start = k_cycle_get_32();
+#endif
+
 	/* Call the endpoint callback. It can set the hold bit. */
 	ept->cfg->cb.received(buffer, size, ept->cfg->priv);
 
+#ifdef CONFIG_IPC_SERVICE_BACKEND_ICBMSG_STATS
+	uint32_t cycles = k_cycle_get_32() - start;
+
+	EPT_STATS_INC(ept, rx_msgs);
+	EPT_STATS_INCN(ept, rx_bytes, size);
+	EPT_STATS_INCN(ept, rx_cycles, cycles);
+	if (cycles > ept->stats.rx_max_cycles) {
+		STATS_SET(ept->stats, rx_max_cycles, cycles);
+	}
+#endif
+
 	/* If the bit is still cleared, request release of the buffer. */
 	sys_bitarray_test_bit(conf->rx_hold_bitmap, rx_block_index, &bit_val);
 	if (!bit_val) {
-		send_release(dev_data, buffer, MSG_RELEASE_DATA, 0);
+#ifdef CONFIG_IPC_SERVICE_BACKEND_ICBMSG_COALESCE_RELEASE
+		/* The remote is notified once the burst of messages is processed. */
+		send_release(dev_data, buffer, MSG_RELEASE_DATA, 0, false);
+		dev_data->release_pending = true;
+#else
+		send_release(dev_data, buffer, MSG_RELEASE_DATA, 0, true);
+#endif
 	}
 
 	return 0;
@@ -922,6 +1006,14 @@ exit:
 	if (r < 0) {
 		LOG_ERR("Failed to receive, err %d", r);
 	}
+
+#ifdef CONFIG_IPC_SERVICE_BACKEND_ICBMSG_COALESCE_RELEASE
+	if (dev_data->release_pending &&
+	    !icmsg_rx_pending(&dev_data->control_data)) {
+		dev_data->release_pending = false;
+		(void)notify_control(dev_data);
+	}
+#endif
 }
 
 /**
@@ -992,14 +1084,62 @@ static int send(const struct device *instance, void *token, const void *msg, siz
 	memcpy(buffer, msg, len);
 
 	/* Send data message. */
-	r = send_block(dev_data, MSG_DATA, ept->addr, r, len);
+	r = send_block(dev_data, MSG_DATA, ept->addr, r, len, true);
 	if (r < 0) {
 		return r;
 	}
 
+	EPT_STATS_INC(ept, tx_msgs);
+	EPT_STATS_INCN(ept, tx_bytes, len);
+	EPT_STATS_INC(ept, tx_notify);
+
 	return len;
 }
 
+/**
+ * Endpoint batch sending callback function (with copy).
+ */
+static int send_batch(const struct device *instance, void *token,
+		      const struct ipc_service_msg *msgs, size_t count)
+{
+	struct backend_data *dev_data = instance->data;
+	struct ept_data *ept = token;
+	uint32_t alloc_size;
+	uint8_t *buffer;
+	size_t sent;
+	int r = 0;
+
+	for (sent = 0; sent < count; sent++) {
+		/* Allocate the buffer. */
+		alloc_size = msgs[sent].len;
+		r = alloc_tx_buffer(dev_data, &alloc_size, &buffer, K_NO_WAIT);
+		if (r < 0) {
+			break;
+		}
+
+		/* Copy data to allocated buffer. */
+		memcpy(buffer, msgs[sent].data, msgs[sent].len);
+
+		/* Send data message, the remote is notified after the last one. */
+		r = send_block(dev_data, MSG_DATA, ept->addr, r, msgs[sent].len, false);
+		if (r < 0) {
+			break;
+		}
+
+		EPT_STATS_INC(ept, tx_msgs);
+		EPT_STATS_INCN(ept, tx_bytes, msgs[sent].len);
+	}
+
+	if (sent == 0) {
+		return r;
+	}
+
+	(void)notify_control(dev_data);
+	EPT_STATS_INC(ept, tx_notify);
+
+	return sent;
+}
+
 /**
  * Backend endpoint registration callback.
  */
@@ -1028,6 +1168,13 @@ static int register_ept(const struct device *instance, void **token,
 	}
 	atomic_set(&ept->state, EPT_CONFIGURED);
 
+#ifdef CONFIG_IPC_SERVICE_BACKEND_ICBMSG_STATS
+	stats_init(&ept->stats.s_hdr, STATS_SIZE_32,
+		   (sizeof(ept->stats) - sizeof(struct stats_hdr)) / STATS_SIZE_32,
+		   STATS_NAME_INIT_PARMS(icbmsg_ept_stats));
+	(void)stats_register(cfg->name, &ept->stats.s_hdr);
+#endif
+
 	/* Keep endpoint address in token. */
 	*token = ept;
 
@@ -1056,7 +1203,15 @@ static int get_tx_buffer(const struct device *instance, void *token, void **data
 	struct backend_data *dev_data = instance->data;
 	int r;
 
+#ifdef CONFIG_IPC_SERVICE_BACKEND_ICBMSG_STATS
+	struct ept_data *ept = token;
+	uint32_t start = k_cycle_get_32();
+#endif
+
 	r = alloc_tx_buffer(dev_data, user_len, (uint8_t **)data, wait);
+
+	EPT_STATS_INCN(ept, tx_wait_cycles, k_cycle_get_32() - start);
+
 	if (r < 0) {
 		return r;
 	}
@@ -1096,7 +1251,16 @@ static int send_nocopy(const struct device *instance, void *token, const void *d
 		return r;
 	}
 
-	return send_block(dev_data, MSG_DATA, ept->addr, r, len);
+	r = send_block(dev_data, MSG_DATA, ept->addr, r, len, true);
+	if (r < 0) {
+		return r;
+	}
+
+	EPT_STATS_INC(ept, tx_msgs);
+	EPT_STATS_INCN(ept, tx_bytes, len);
+	EPT_STATS_INC(ept, tx_notify);
+
+	return r;
 }
 
 /**
@@ -1121,7 +1285,7 @@ static int release_rx_buffer(const struct device *instance, void *token, void *d
 {
 	struct backend_data *dev_data = instance->data;
 
-	return send_release(dev_data, (uint8_t *)data, MSG_RELEASE_DATA, 0);
+	return send_release(dev_data, (uint8_t *)data, MSG_RELEASE_DATA, 0, true);
 }
 
 /**
@@ -1160,6 +1324,7 @@ const static struct ipc_service_backend backend_ops = {
 	.open_instance = open,
 	.close_instance = NULL, /* not implemented */
 	.send = send,
+	.send_batch = send_batch,
 	.register_endpoint = register_ept,
 	.deregister_endpoint = NULL, /* not implemented */
 	.get_tx_buffer_size = get_tx_buffer_size,
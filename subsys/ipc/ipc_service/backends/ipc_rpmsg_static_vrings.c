@@ -26,6 +26,10 @@
 
 #define WQ_STACK_SIZE	CONFIG_IPC_SERVICE_BACKEND_RPMSG_WQ_STACK_SIZE
 
+#if defined(CONFIG_IPC_SERVICE_BACKEND_RPMSG_RX_POLL)
+#define RX_POLL_INTERVAL K_USEC(CONFIG_IPC_SERVICE_BACKEND_RPMSG_RX_POLL_INTERVAL_US)
+#endif
+
 #define STATE_READY	(0)
 #define STATE_BUSY	(1)
 #define STATE_INITED	(2)
@@ -46,7 +50,11 @@ struct backend_data_t {
 	struct ipc_static_vrings vr;
 
 	/* MBOX WQ */
+#if defined(CONFIG_IPC_SERVICE_BACKEND_RPMSG_RX_POLL)
+	struct k_work_delayable poll_work;
+#else
 	struct k_work mbox_work;
+#endif
 	struct k_work_q mbox_wq;
 
 	/* General */
@@ -302,17 +310,38 @@ static void virtio_notify_cb(struct virtqueue *vq, void *priv)
 	}
 }
 
-static void mbox_callback_process(struct k_work *item)
+static void rx_process(struct backend_data_t *data)
 {
-	struct backend_data_t *data;
 	unsigned int vq_id;
 
-	data = CONTAINER_OF(item, struct backend_data_t, mbox_work);
 	vq_id = (data->role == ROLE_HOST) ? VIRTQUEUE_ID_HOST : VIRTQUEUE_ID_REMOTE;
 
+	/* All the buffers used by the remote are processed, not only one. */
 	virtqueue_notification(data->vr.vq[vq_id]);
 }
 
+#if defined(CONFIG_IPC_SERVICE_BACKEND_RPMSG_RX_POLL)
+static void poll_process(struct k_work *item)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(item);
+	struct backend_data_t *data;
+
+	data = CONTAINER_OF(dwork, struct backend_data_t, poll_work);
+
+	rx_process(data);
+
+	(void)k_work_schedule_for_queue(&data->mbox_wq, dwork, RX_POLL_INTERVAL);
+}
+#else
+static void mbox_callback_process(struct k_work *item)
+{
+	struct backend_data_t *data;
+
+	data = CONTAINER_OF(item, struct backend_data_t, mbox_work);
+
+	rx_process(data);
+}
+
 static void mbox_callback(const struct device *instance, uint32_t channel,
 			  void *user_data, struct mbox_msg *msg_data)
 {
@@ -320,6 +349,7 @@ static void mbox_callback(const struct device *instance, uint32_t channel,
 
 	k_work_submit_to_queue(&data->mbox_wq, &data->mbox_work);
 }
+#endif
 
 static int mbox_init(const struct device *instance)
 {
@@ -341,6 +371,15 @@ static int mbox_init(const struct device *instance)
 		k_thread_name_set(&data->mbox_wq.thread, name);
 	}
 
+#if defined(CONFIG_IPC_SERVICE_BACKEND_RPMSG_RX_POLL)
+	/* The remote notifications are not needed, the vring is polled. */
+	ARG_UNUSED(err);
+
+	k_work_init_delayable(&data->poll_work, poll_process);
+	(void)k_work_schedule_for_queue(&data->mbox_wq, &data->poll_work, RX_POLL_INTERVAL);
+
+	return 0;
+#else
 	k_work_init(&data->mbox_work, mbox_callback_process);
 
 	err = mbox_register_callback_dt(&conf->mbox_rx, mbox_callback, data);
@@ -349,6 +388,7 @@ static int mbox_init(const struct device *instance)
 	}
 
 	return mbox_set_enabled_dt(&conf->mbox_rx, 1);
+#endif
 }
 
 static int mbox_deinit(const struct device *instance)
@@ -358,10 +398,19 @@ static int mbox_deinit(const struct device *instance)
 	k_tid_t wq_thread;
 	int err;
 
+#if defined(CONFIG_IPC_SERVICE_BACKEND_RPMSG_RX_POLL)
+	static struct k_work_sync sync;
+
+	ARG_UNUSED(conf);
+	ARG_UNUSED(err);
+
+	k_work_cancel_delayable_sync(&data->poll_work, &sync);
+#else
 	err = mbox_set_enabled_dt(&conf->mbox_rx, 0);
 	if (err != 0) {
 		return err;
 	}
+#endif
 
 	k_work_queue_drain(&data->mbox_wq, 1);
 
@@ -489,7 +538,11 @@ static int deregister_ept(const struct device *instance, void *token)
 	 * Note: `k_work_flush` Faults on Cortex-M33 with "illegal use of EPSR"
 	 * if `sync` is not declared static.
 	 */
+#if defined(CONFIG_IPC_SERVICE_BACKEND_RPMSG_RX_POLL)
+	k_work_flush_delayable(&data->poll_work, &sync);
+#else
 	k_work_flush(&data->mbox_work, &sync);
+#endif
 
 	rpmsg_destroy_ept(&rpmsg_ept->ep);
 
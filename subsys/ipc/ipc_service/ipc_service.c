@@ -144,6 +144,45 @@ int ipc_service_send(struct ipc_ept *ept, const void *data, size_t len)
 	return backend->send(ept->instance, ept->token, data, len);
 }
 
+int ipc_service_send_batch(struct ipc_ept *ept, const struct ipc_service_msg *msgs,
+			   size_t count)
+{
+	const struct ipc_service_backend *backend;
+	size_t sent;
+	int ret = 0;
+
+	if (!ept || !msgs || count == 0) {
+		LOG_ERR("Invalid endpoint or messages");
+		return -EINVAL;
+	}
+
+	if (!ept->instance) {
+		LOG_ERR("Endpoint not registered\n");
+		return -ENOENT;
+	}
+
+	backend = ept->instance->api;
+
+	if (!backend || !backend->send) {
+		LOG_ERR("Invalid backend configuration");
+		return -EIO;
+	}
+
+	if (backend->send_batch) {
+		return backend->send_batch(ept->instance, ept->token, msgs, count);
+	}
+
+	for (sent = 0; sent < count; sent++) {
+		ret = backend->send(ept->instance, ept->token, msgs[sent].data,
+				    msgs[sent].len);
+		if (ret < 0) {
+			break;
+		}
+	}
+
+	return sent > 0 ? (int)sent : ret;
+}
+
 int ipc_service_get_tx_buffer_size(struct ipc_ept *ept)
 {
 	const struct ipc_service_backend *backend;
@@ -257,14 +257,13 @@ int icmsg_close(const struct icmsg_config_t *conf,
 	return 0;
 }
 
-int icmsg_send(const struct icmsg_config_t *conf,
-	       struct icmsg_data_t *dev_data,
-	       const void *msg, size_t len)
+int icmsg_write(const struct icmsg_config_t *conf,
+		struct icmsg_data_t *dev_data,
+		const void *msg, size_t len)
 {
 	int ret;
 	int write_ret;
 	int release_ret;
-	int sent_bytes;
 
 	if (!is_endpoint_ready(dev_data)) {
 		return -EBUSY;
@@ -289,11 +288,33 @@ int icmsg_send(const struct icmsg_config_t *conf,
 	} else if (write_ret < len) {
 		return -EBADMSG;
 	}
-	sent_bytes = write_ret;
+
+	return write_ret;
+}
+
+int icmsg_notify(const struct icmsg_config_t *conf,
+		 struct icmsg_data_t *dev_data)
+{
+	ARG_UNUSED(dev_data);
 
 	__ASSERT_NO_MSG(conf->mbox_tx.dev != NULL);
 
-	ret = mbox_send_dt(&conf->mbox_tx, NULL);
+	return mbox_send_dt(&conf->mbox_tx, NULL);
+}
+
+int icmsg_send(const struct icmsg_config_t *conf,
+	       struct icmsg_data_t *dev_data,
+	       const void *msg, size_t len)
+{
+	int ret;
+	int sent_bytes;
+
+	sent_bytes = icmsg_write(conf, dev_data, msg, len);
+	if (sent_bytes < 0) {
+		return sent_bytes;
+	}
+
+	ret = icmsg_notify(conf, dev_data);
 	if (ret) {
 		return ret;
 	}
@@ -301,6 +322,11 @@ int icmsg_send(const struct icmsg_config_t *conf,
 	return sent_bytes;
 }
 
+bool icmsg_rx_pending(struct icmsg_data_t *dev_data)
+{
+	return data_available(dev_data) != 0;
+}
+
 #if IS_ENABLED(CONFIG_IPC_SERVICE_BACKEND_ICMSG_WQ_ENABLE)
 
 static int work_q_init(void)
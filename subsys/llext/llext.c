@@ -102,31 +102,90 @@ int llext_iterate(int (*fn)(struct llext *ext, void *arg), void *arg)
 	return ret;
 }
 
-const void *llext_find_sym(const struct llext_symtable *sym_table, const char *sym_name)
+/* Compare a built-in symbol with the name (or SLID) being looked up */
+static int llext_const_symbol_cmp(const struct llext_const_symbol *sym, const char *sym_name)
 {
-	if (sym_table == NULL) {
-		/* Built-in symbol table */
 #ifdef CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID
-		/* 'sym_name' is actually a SLID to search for */
-		uintptr_t slid = (uintptr_t)sym_name;
-
-		/* TODO: perform a binary search instead of linear.
-		 * Note that - as of writing - the llext_const_symbol_area
-		 * section is sorted in ascending SLID order.
-		 * (see scripts/build/llext_prepare_exptab.py)
-		 */
-		STRUCT_SECTION_FOREACH(llext_const_symbol, sym) {
-			if (slid == sym->slid) {
-				return sym->addr;
+	/* 'sym_name' is actually a SLID to search for */
+	uintptr_t slid = (uintptr_t)sym_name;
+
+	return (sym->slid > slid) - (sym->slid < slid);
+#else
+	return strcmp(sym->name, sym_name);
+#endif
+}
+
+/*
+ * The built-in symbol table is sorted after the build by
+ * scripts/build/llext_prepare_exptab.py. As images that did not go through
+ * that step are still valid, the order is checked on first use and a linear
+ * search is done if the table turns out not to be sorted.
+ */
+static bool llext_const_symbols_sorted(size_t count)
+{
+	static enum { UNKNOWN, SORTED, UNSORTED } state;
+	struct llext_const_symbol *prev;
+	struct llext_const_symbol *sym;
+
+	if (state == UNKNOWN) {
+		state = SORTED;
+
+		for (size_t i = 1; i < count; i++) {
+			STRUCT_SECTION_GET(llext_const_symbol, i - 1, &prev);
+			STRUCT_SECTION_GET(llext_const_symbol, i, &sym);
+			if (llext_const_symbol_cmp(sym, prev->name) <= 0) {
+				state = UNSORTED;
+				break;
 			}
 		}
-#else
+	}
+
+	return state == SORTED;
+}
+
+static const void *llext_find_const_sym(const char *sym_name)
+{
+	struct llext_const_symbol *sym;
+	size_t count;
+	size_t low = 0;
+	size_t high;
+
+	STRUCT_SECTION_COUNT(llext_const_symbol, &count);
+
+	if (!llext_const_symbols_sorted(count)) {
 		STRUCT_SECTION_FOREACH(llext_const_symbol, sym) {
-			if (strcmp(sym->name, sym_name) == 0) {
+			if (llext_const_symbol_cmp(sym, sym_name) == 0) {
 				return sym->addr;
 			}
 		}
-#endif
+
+		return NULL;
+	}
+
+	high = count;
+	while (low < high) {
+		size_t mid = low + (high - low) / 2;
+		int cmp;
+
+		STRUCT_SECTION_GET(llext_const_symbol, mid, &sym);
+		cmp = llext_const_symbol_cmp(sym, sym_name);
+		if (cmp == 0) {
+			return sym->addr;
+		} else if (cmp < 0) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	return NULL;
+}
+
+const void *llext_find_sym(const struct llext_symtable *sym_table, const char *sym_name)
+{
+	if (sym_table == NULL) {
+		/* Built-in symbol table */
+		return llext_find_const_sym(sym_name);
 	} else {
 		/* find symbols in module */
 		for (size_t i = 0; i < sym_table->sym_cnt; i++) {
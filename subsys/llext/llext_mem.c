@@ -61,6 +61,36 @@ static void llext_init_mem_part(struct llext *ext, enum llext_mem mem_idx,
 	LOG_DBG("mem idx %d: start 0x%zx, size %zd", mem_idx, (size_t)start, len);
 }
 
+/*
+ * Check whether a memory region can be used in place from read-only storage,
+ * that is whether it holds code or constant data and has no relocation to be
+ * applied to it.
+ */
+static bool llext_section_is_xip(struct llext_loader *ldr, enum llext_mem mem_idx)
+{
+	if (!IS_ENABLED(CONFIG_LLEXT_STORAGE_XIP) ||
+	    (mem_idx != LLEXT_MEM_TEXT && mem_idx != LLEXT_MEM_RODATA) ||
+	    ldr->sect_map == NULL) {
+		return false;
+	}
+
+	for (int i = 0; i < ldr->sect_cnt; ++i) {
+		elf_shdr_t *shdr = ldr->sect_hdrs + i;
+
+		if ((shdr->sh_type != SHT_REL && shdr->sh_type != SHT_RELA) ||
+		    shdr->sh_size == 0) {
+			continue;
+		}
+
+		if (shdr->sh_info >= ldr->sect_cnt ||
+		    ldr->sect_map[shdr->sh_info].mem_idx == mem_idx) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
 static int llext_copy_section(struct llext_loader *ldr, struct llext *ext,
 			      enum llext_mem mem_idx)
 {
@@ -72,7 +102,8 @@ static int llext_copy_section(struct llext_loader *ldr, struct llext *ext,
 	ext->mem_size[mem_idx] = ldr->sects[mem_idx].sh_size;
 
 	if (ldr->sects[mem_idx].sh_type != SHT_NOBITS &&
-	    IS_ENABLED(CONFIG_LLEXT_STORAGE_WRITABLE)) {
+	    (IS_ENABLED(CONFIG_LLEXT_STORAGE_WRITABLE) ||
+	     llext_section_is_xip(ldr, mem_idx))) {
 		ext->mem[mem_idx] = llext_peek(ldr, ldr->sects[mem_idx].sh_offset);
 		if (ext->mem[mem_idx]) {
 			llext_init_mem_part(ext, mem_idx, (uintptr_t)ext->mem[mem_idx],
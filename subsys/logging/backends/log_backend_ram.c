@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_core.h>
+#include <zephyr/logging/log_output.h>
+#include <zephyr/logging/log_output_dict.h>
+#include <zephyr/logging/log_backend_std.h>
+#include <zephyr/logging/log_backend_ram.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/ring_buffer.h>
+
+static uint8_t output_buf[CONFIG_LOG_BACKEND_RAM_OUTPUT_BUFFER_SIZE];
+static uint32_t log_format_current = CONFIG_LOG_BACKEND_RAM_OUTPUT_DEFAULT;
+
+RING_BUF_DECLARE(ram_ring, CONFIG_LOG_BACKEND_RAM_SIZE);
+static struct k_spinlock lock;
+
+/* Bytes of the message being formatted, claimed but not yet committed. */
+static uint32_t claimed;
+static bool overflow;
+static uint32_t dropped_cnt;
+
+static int char_out(uint8_t *data, size_t length, void *ctx)
+{
+	ARG_UNUSED(ctx);
+
+	size_t rem = length;
+
+	while (!overflow && (rem > 0)) {
+		uint8_t *dst;
+		uint32_t len = ring_buf_put_claim(&ram_ring, &dst, rem);
+
+		if (len == 0) {
+			overflow = true;
+			break;
+		}
+
+		memcpy(dst, data, len);
+		data += len;
+		rem -= len;
+		claimed += len;
+	}
+
+	/* Data that does not fit is consumed too, the whole message is
+	 * discarded when it is finished.
+	 */
+	return length;
+}
+
+LOG_OUTPUT_DEFINE(log_output_ram, char_out, output_buf, sizeof(output_buf));
+
+static void msg_start(void)
+{
+	claimed = 0;
+	overflow = false;
+}
+
+/* Commit the message, or drop it entirely if it did not fit, so that the
+ * stored stream can always be decoded.
+ */
+static void msg_end(void)
+{
+	log_output_flush(&log_output_ram);
+
+	if (overflow) {
+		dropped_cnt++;
+		claimed = 0;
+	}
+
+	(void)ring_buf_put_finish(&ram_ring, claimed);
+}
+
+static void process(const struct log_backend *const backend,
+		    union log_msg_generic *msg)
+{
+	uint32_t flags = log_backend_std_get_flags();
+	log_format_func_t log_output_func = log_format_func_t_get(log_format_current);
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	msg_start();
+	log_output_func(&log_output_ram, &msg->log, flags);
+	msg_end();
+
+	k_spin_unlock(&lock, key);
+}
+
+static int format_set(const struct log_backend *const backend, uint32_t log_type)
+{
+	log_format_current = log_type;
+	return 0;
+}
+
+static void panic(struct log_backend const *const backend)
+{
+	/* Messages are stored in RAM in the context of the caller, there is
+	 * no deferred output to switch off.
+	 */
+	ARG_UNUSED(backend);
+}
+
+static void dropped(const struct log_backend *const backend, uint32_t cnt)
+{
+	ARG_UNUSED(backend);
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	msg_start();
+	if (IS_ENABLED(CONFIG_LOG_BACKEND_RAM_OUTPUT_DICTIONARY)) {
+		log_dict_output_dropped_process(&log_output_ram, cnt);
+	} else {
+		log_backend_std_dropped(&log_output_ram, cnt);
+	}
+	msg_end();
+
+	k_spin_unlock(&lock, key);
+}
+
+size_t log_backend_ram_read(uint8_t *buf, size_t len)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	size_t ret = ring_buf_get(&ram_ring, buf, len);
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+size_t log_backend_ram_pending(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	size_t ret = ring_buf_size_get(&ram_ring);
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+void log_backend_ram_clear(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	ring_buf_reset(&ram_ring);
+
+	k_spin_unlock(&lock, key);
+}
+
+uint32_t log_backend_ram_dropped_get(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	uint32_t ret = dropped_cnt;
+
+	dropped_cnt = 0;
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+const struct log_backend_api log_backend_ram_api = {
+	.process = process,
+	.panic = panic,
+	.dropped = IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE) ? NULL : dropped,
+	.format_set = format_set,
+};
+
+LOG_BACKEND_DEFINE(log_backend_ram, log_backend_ram_api, true);
@@ -11,6 +11,89 @@
 #include <zephyr/logging/log_backend.h>
 #include <zephyr/logging/log_ctrl.h>
 
+#ifdef CONFIG_LOG_MULTIDOMAIN_BACKEND_BATCH
+#define BATCH_HDR_LEN offsetof(struct log_multidomain_msg, data)
+#define BATCH_TID_LEN COND_CODE_1(CONFIG_LOG_THREAD_ID_PREFIX, (sizeof(void *)), (0))
+
+static void batch_reset(struct log_multidomain_backend *backend_remote)
+{
+	struct log_multidomain_msg *out_msg =
+		(struct log_multidomain_msg *)backend_remote->batch;
+
+	out_msg->id = Z_LOG_MULTIDOMAIN_ID_MSG_BATCH;
+	out_msg->status = Z_LOG_MULTIDOMAIN_STATUS_OK;
+	backend_remote->batch_len = BATCH_HDR_LEN;
+	backend_remote->batch_timestamp = backend_remote->timestamp;
+}
+
+static void batch_flush(struct log_multidomain_backend *backend_remote)
+{
+	int err;
+
+	if (backend_remote->batch_len == BATCH_HDR_LEN) {
+		return;
+	}
+
+	err = backend_remote->transport_api->send(backend_remote, backend_remote->batch,
+						  backend_remote->batch_len);
+	if (err < 0) {
+		/* Remote did not get the batch so next timestamp difference
+		 * must be relative to the last delivered message.
+		 */
+		backend_remote->timestamp = backend_remote->batch_timestamp;
+		__ASSERT(false, "Unexpected error: %d\n", err);
+	}
+
+	batch_reset(backend_remote);
+}
+
+/* Append the message to the batch. Returns false if the message does not fit
+ * in an empty batch and must be sent on its own.
+ */
+static bool batch_put(struct log_multidomain_backend *backend_remote,
+		      const struct log_msg *msg, size_t body_len)
+{
+	size_t max_len = sizeof(struct log_msg_desc) + 2 * Z_LOG_MULTIDOMAIN_VARINT_MAX_LEN +
+			 BATCH_TID_LEN + body_len;
+	uintptr_t source = (uintptr_t)msg->hdr.source + 1U;
+	int64_t delta;
+	uint8_t *dst;
+
+	if (max_len > (sizeof(backend_remote->batch) - BATCH_HDR_LEN)) {
+		return false;
+	}
+
+	if ((backend_remote->batch_len + max_len) > sizeof(backend_remote->batch)) {
+		batch_flush(backend_remote);
+	}
+
+	dst = &backend_remote->batch[backend_remote->batch_len];
+
+	memcpy(dst, &msg->hdr.desc, sizeof(struct log_msg_desc));
+	dst += sizeof(struct log_msg_desc);
+
+	/* Source ID is shifted by one so that no source (-1) is encoded as 0. */
+	dst += z_log_multidomain_varint_put(dst, source);
+
+	/* Timestamp difference, zigzag encoded as it may be negative. */
+	delta = (int64_t)(msg->hdr.timestamp - backend_remote->timestamp);
+	dst += z_log_multidomain_varint_put(dst, ((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63));
+	backend_remote->timestamp = msg->hdr.timestamp;
+
+#ifdef CONFIG_LOG_THREAD_ID_PREFIX
+	memcpy(dst, &msg->hdr.tid, BATCH_TID_LEN);
+	dst += BATCH_TID_LEN;
+#endif
+
+	memcpy(dst, msg->data, body_len);
+	dst += body_len;
+
+	backend_remote->batch_len = dst - backend_remote->batch;
+
+	return true;
+}
+#endif /* CONFIG_LOG_MULTIDOMAIN_BACKEND_BATCH */
+
 static void process(const struct log_backend *const backend,
 		    union log_msg_generic *msg)
 {
@@ -72,6 +155,22 @@ static void process(const struct log_backend *const backend,
 		       dlen);
 	}
 
+#ifdef CONFIG_LOG_MULTIDOMAIN_BACKEND_BATCH
+	if (batch_put(backend_remote, out_log_msg, fsc_plen + dlen)) {
+		/* Send when no more messages are pending, so that messages
+		 * produced in a burst go to the remote in a single transfer.
+		 */
+		if (!log_data_pending() ||
+		    (backend_remote->batch_len == sizeof(backend_remote->batch))) {
+			batch_flush(backend_remote);
+		}
+
+		return;
+	}
+
+	batch_flush(backend_remote);
+#endif
+
 	err = backend_remote->transport_api->send(backend_remote, out_msg, msg_len + msg_offset);
 	if (err < 0) {
 		__ASSERT(false, "Unexpected error: %d\n", err);
@@ -182,6 +281,10 @@ void log_multidomain_backend_on_recv_cb(struct log_multidomain_backend *backend_
 				       outmsg.data.set_rt_level.runtime_level);
 		break;
 	case Z_LOG_MULTIDOMAIN_ID_READY:
+#ifdef CONFIG_LOG_MULTIDOMAIN_BACKEND_BATCH
+		backend_remote->timestamp = 0;
+		batch_reset(backend_remote);
+#endif
 		backend_remote->ready = true;
 		break;
 	default:
@@ -200,6 +303,9 @@ static void init(struct log_backend const *const backend)
 
 	backend_remote->log_backend = backend;
 	k_sem_init(&backend_remote->rdy_sem, 0, 1);
+#ifdef CONFIG_LOG_MULTIDOMAIN_BACKEND_BATCH
+	batch_reset(backend_remote);
+#endif
 
 	err = backend_remote->transport_api->init(backend_remote);
 	__ASSERT_NO_MSG(err >= 0);
@@ -219,6 +325,9 @@ static void panic(struct log_backend const *const backend)
 {
 	struct log_multidomain_backend *backend_remote = backend->cb->ctx;
 
+#ifdef CONFIG_LOG_MULTIDOMAIN_BACKEND_BATCH
+	batch_reset(backend_remote);
+#endif
 	backend_remote->panic = true;
 }
 
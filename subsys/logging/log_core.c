@@ -138,6 +138,23 @@ static const struct mpsc_pbuf_buffer_config mpsc_config = {
 };
 #endif
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+/* CPU 0 uses log_buffer, the other CPUs get a buffer of the same size each.
+ * They are registered like the buffers of the links, so messages are merged
+ * by timestamp when claimed.
+ */
+#define LOG_CPU_BUFFERS (CONFIG_MP_MAX_NUM_CPUS - 1)
+
+static uint32_t __aligned(Z_LOG_MSG_ALIGNMENT)
+	cpu_buf32[LOG_CPU_BUFFERS][CONFIG_LOG_BUFFER_SIZE / sizeof(int)];
+static STRUCT_SECTION_ITERABLE_ARRAY(log_msg_ptr, cpu_log_msg_ptr, LOG_CPU_BUFFERS);
+static STRUCT_SECTION_ITERABLE_ARRAY_ALTERNATE(log_mpsc_pbuf, mpsc_pbuf_buffer,
+					       cpu_log_buffer, LOG_CPU_BUFFERS);
+
+/* Dropped messages are counted per CPU so that cores do not share a counter. */
+static atomic_t cpu_dropped_cnt[CONFIG_MP_MAX_NUM_CPUS];
+#endif
+
 /* Check that default tag can fit in tag buffer. */
 COND_CODE_0(CONFIG_LOG_TAG_MAX_LEN, (),
 	(BUILD_ASSERT(sizeof(CONFIG_LOG_TAG_DEFAULT) <= CONFIG_LOG_TAG_MAX_LEN + 1,
@@ -610,9 +627,40 @@ uint32_t z_vrfy_log_buffered_cnt(void)
 #include <zephyr/syscalls/log_buffered_cnt_mrsh.c>
 #endif
 
+bool z_log_ratelimit(struct log_ratelimit *rl, uint32_t *suppressed)
+{
+	uint32_t now = k_uptime_get_32();
+	atomic_val_t start = atomic_get(&rl->start);
+
+	/* Only one of the callers racing at the end of an interval starts
+	 * the next one.
+	 */
+	if (((now - (uint32_t)start) >= CONFIG_LOG_RATELIMIT_INTERVAL_MS) &&
+	    atomic_cas(&rl->start, start, now)) {
+		atomic_set(&rl->used, 0);
+	}
+
+	/* Once the budget is used up, a suppressed message costs a single
+	 * atomic operation.
+	 */
+	if ((atomic_get(&rl->used) >= CONFIG_LOG_RATELIMIT_BURST) ||
+	    (atomic_inc(&rl->used) >= CONFIG_LOG_RATELIMIT_BURST)) {
+		atomic_inc(&rl->suppressed);
+		return false;
+	}
+
+	*suppressed = (atomic_get(&rl->suppressed) > 0) ? atomic_clear(&rl->suppressed) : 0;
+
+	return true;
+}
+
 void z_log_dropped(bool buffered)
 {
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	atomic_inc(&cpu_dropped_cnt[arch_curr_cpu()->id]);
+#else
 	atomic_inc(&dropped_cnt);
+#endif
 	if (buffered) {
 		atomic_dec(&buffered_cnt);
 	}
@@ -620,12 +668,32 @@ void z_log_dropped(bool buffered)
 
 uint32_t z_log_dropped_read_and_clear(void)
 {
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	uint32_t dropped = 0;
+
+	for (int i = 0; i < ARRAY_SIZE(cpu_dropped_cnt); i++) {
+		dropped += atomic_set(&cpu_dropped_cnt[i], 0);
+	}
+
+	return dropped;
+#else
 	return atomic_set(&dropped_cnt, 0);
+#endif
 }
 
 bool z_log_dropped_pending(void)
 {
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	for (int i = 0; i < ARRAY_SIZE(cpu_dropped_cnt); i++) {
+		if (atomic_get(&cpu_dropped_cnt[i]) > 0) {
+			return true;
+		}
+	}
+
+	return false;
+#else
 	return dropped_cnt > 0;
+#endif
 }
 
 void z_log_msg_init(void)
@@ -634,6 +702,45 @@ void z_log_msg_init(void)
 	mpsc_pbuf_init(&log_buffer, &mpsc_config);
 	curr_log_buffer = &log_buffer;
 #endif
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	for (int i = 0; i < LOG_CPU_BUFFERS; i++) {
+		struct mpsc_pbuf_buffer_config config = mpsc_config;
+
+		config.buf = cpu_buf32[i];
+		mpsc_pbuf_init(&cpu_log_buffer[i], &config);
+	}
+#endif
+}
+
+/* Buffer of the current CPU. Being migrated after picking it only costs
+ * sharing the buffer of another CPU for one message.
+ */
+static struct mpsc_pbuf_buffer *local_buffer(void)
+{
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	unsigned int id = arch_curr_cpu()->id;
+
+	if (id > 0) {
+		return &cpu_log_buffer[id - 1];
+	}
+#endif
+	return &log_buffer;
+}
+
+/* Buffer a message was allocated from. */
+static struct mpsc_pbuf_buffer *msg_buffer(struct log_msg *msg)
+{
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	for (int i = 0; i < LOG_CPU_BUFFERS; i++) {
+		if (((uint32_t *)msg >= cpu_buf32[i]) &&
+		    ((uint32_t *)msg < &cpu_buf32[i][ARRAY_SIZE(cpu_buf32[i])])) {
+			return &cpu_log_buffer[i];
+		}
+	}
+#else
+	ARG_UNUSED(msg);
+#endif
+	return &log_buffer;
 }
 
 static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
@@ -651,7 +758,7 @@ static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 
 struct log_msg *z_log_msg_alloc(uint32_t wlen)
 {
-	return msg_alloc(&log_buffer, wlen);
+	return msg_alloc(local_buffer(), wlen);
 }
 
 static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
@@ -673,7 +780,7 @@ static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
 void z_log_msg_commit(struct log_msg *msg)
 {
 	msg->hdr.timestamp = timestamp_func();
-	msg_commit(&log_buffer, msg);
+	msg_commit(msg_buffer(msg), msg);
 }
 
 union log_msg_generic *z_log_msg_local_claim(void)
@@ -760,7 +867,8 @@ union log_msg_generic *z_log_msg_claim(k_timeout_t *backoff)
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
 	/* Use only one buffer if others are not registered. */
-	if (IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && len > 1) {
+	if ((IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) || IS_ENABLED(CONFIG_LOG_PER_CPU_BUFFERS)) &&
+	    len > 1) {
 		return z_log_msg_claim_oldest(backoff);
 	}
 
@@ -795,7 +903,8 @@ bool z_log_msg_pending(void)
 
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
-	if (!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) || (len == 1)) {
+	if ((!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && !IS_ENABLED(CONFIG_LOG_PER_CPU_BUFFERS)) ||
+	    (len == 1)) {
 		return msg_pending(&log_buffer);
 	}
 
@@ -877,6 +986,17 @@ int log_mem_get_usage(uint32_t *buf_size, uint32_t *usage)
 
 	mpsc_pbuf_get_utilization(&log_buffer, buf_size, usage);
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	for (int i = 0; i < LOG_CPU_BUFFERS; i++) {
+		uint32_t cpu_size;
+		uint32_t cpu_usage;
+
+		mpsc_pbuf_get_utilization(&cpu_log_buffer[i], &cpu_size, &cpu_usage);
+		*buf_size += cpu_size;
+		*usage += cpu_usage;
+	}
+#endif
+
 	return 0;
 }
 
@@ -888,7 +1008,31 @@ int log_mem_get_max_usage(uint32_t *max)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	/* Sum of the peaks of each buffer, which may not have been reached at
+	 * the same time.
+	 */
+	uint32_t total = 0;
+	int err;
+
+	for (int i = 0; i <= LOG_CPU_BUFFERS; i++) {
+		uint32_t cpu_max;
+
+		err = mpsc_pbuf_get_max_utilization(i == 0 ? &log_buffer : &cpu_log_buffer[i - 1],
+						    &cpu_max);
+		if (err < 0) {
+			return err;
+		}
+
+		total += cpu_max;
+	}
+
+	*max = total;
+
+	return 0;
+#else
 	return mpsc_pbuf_get_max_utilization(&log_buffer, max);
+#endif
 }
 
 static void log_backend_notify_all(enum log_backend_evt event,
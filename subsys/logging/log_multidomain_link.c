@@ -27,6 +27,67 @@ void log_multidomain_link_on_started(struct log_multidomain_link *link_remote, i
 	}
 }
 
+/* Decode a batch of messages, see struct log_multidomain_log_msg_batch. */
+static void batch_enqueue(struct log_multidomain_link *link_remote,
+			  const uint8_t *data, size_t len)
+{
+	while (len > 0) {
+		struct log_msg_desc desc;
+		uint64_t source;
+		uint64_t delta;
+		size_t body_len;
+		size_t n;
+
+		if (len < sizeof(desc)) {
+			break;
+		}
+
+		memcpy(&desc, data, sizeof(desc));
+		data += sizeof(desc);
+		len -= sizeof(desc);
+
+		n = z_log_multidomain_varint_get(data, len, &source);
+		data += n;
+		len -= n;
+
+		n = (n > 0) ? z_log_multidomain_varint_get(data, len, &delta) : 0;
+		if (n == 0) {
+			break;
+		}
+
+		data += n;
+		len -= n;
+
+		body_len = desc.package_len + desc.data_len;
+		if (len < (body_len + COND_CODE_1(CONFIG_LOG_THREAD_ID_PREFIX,
+						  (sizeof(void *)), (0)))) {
+			break;
+		}
+
+		uint8_t buf[Z_LOG_MSG_LEN(body_len, 0)] __aligned(Z_LOG_MSG_ALIGNMENT);
+		struct log_msg *log_msg = (struct log_msg *)buf;
+
+		link_remote->timestamp += (log_timestamp_t)((delta >> 1) ^ (0 - (delta & 1)));
+
+		log_msg->hdr.desc = desc;
+		log_msg->hdr.source = (source == 0) ? (const void *)-1 :
+				      (const void *)(uintptr_t)(source - 1);
+		log_msg->hdr.timestamp = link_remote->timestamp;
+#ifdef CONFIG_LOG_THREAD_ID_PREFIX
+		memcpy(&log_msg->hdr.tid, data, sizeof(log_msg->hdr.tid));
+		data += sizeof(log_msg->hdr.tid);
+		len -= sizeof(log_msg->hdr.tid);
+#endif
+		memcpy(log_msg->data, data, body_len);
+		data += body_len;
+		len -= body_len;
+
+		z_log_msg_enqueue(link_remote->link, buf, sizeof(buf));
+	}
+
+	__ASSERT(len == 0, "Malformed message batch");
+}
+
 void log_multidomain_link_on_recv_cb(struct log_multidomain_link *link_remote,
 				const void *data, size_t len)
 {
@@ -45,6 +106,10 @@ void log_multidomain_link_on_recv_cb(struct log_multidomain_link *link_remote,
 				  msg->data.log_msg.data,
 				  len - offsetof(struct log_multidomain_msg, data));
 		return;
+	case Z_LOG_MULTIDOMAIN_ID_MSG_BATCH:
+		batch_enqueue(link_remote, msg->data.log_msg_batch.data,
+			      len - offsetof(struct log_multidomain_msg, data));
+		return;
 	case Z_LOG_MULTIDOMAIN_ID_GET_DOMAIN_CNT:
 		link_remote->dst.count = msg->data.domain_cnt.count;
 		break;
@@ -152,6 +217,9 @@ static int link_remote_ready(struct log_multidomain_link *link_remote)
 		.id = Z_LOG_MULTIDOMAIN_ID_READY
 	};
 
+	/* Remote restarts timestamp differences of batched messages. */
+	link_remote->timestamp = 0;
+
 	err = getter_msg_process(link_remote, &msg, sizeof(msg));
 	if (err < 0) {
 		return err;
@@ -75,6 +75,38 @@ int img_mgmt_read(int slot, unsigned int offset, void *dst, unsigned int num_byt
 int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned int num_bytes,
 			      bool last);
 
+/**
+ * @brief Indicates whether the ongoing upload is a delta patch.
+ *
+ * Only available with CONFIG_MCUMGR_GRP_IMG_DELTA.
+ *
+ * @return true if the image is reconstructed from a delta patch.
+ */
+bool img_mgmt_upload_is_delta(void);
+
+#ifdef CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW
+/**
+ * @brief Queues the specified chunk of image data to be written to slot 1.
+ *
+ * The data is written asynchronously, unless it ends the image in which
+ * case this waits for all queued data to be written.
+ *
+ * @param offset	The offset within slot 1 to write to.
+ * @param data		The image data to write.
+ * @param num_bytes	The number of bytes to write.
+ * @param size		The size of the image being uploaded.
+ *
+ * @return 0 on success, MGMT_ERR_[...] code of a failed queued write.
+ */
+int img_mgmt_window_write(size_t offset, const void *data, size_t num_bytes, size_t size);
+
+/**
+ * @brief Discards the image data queued for writing, waiting for a write in
+ * progress to complete.
+ */
+void img_mgmt_window_reset(void);
+#endif
+
 /**
  * @brief Indicates the type of swap operation that will occur on the next
  * reboot, if any, between provided slot and it's pair.
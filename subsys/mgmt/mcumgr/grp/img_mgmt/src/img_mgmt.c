@@ -312,6 +312,9 @@ static void img_mgmt_reset_upload(void)
 #endif
 {
 	img_mgmt_take_lock();
+#ifdef CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW
+	img_mgmt_window_reset();
+#endif
 	memset(&g_img_mgmt_state, 0, sizeof(g_img_mgmt_state));
 	g_img_mgmt_state.area_id = -1;
 	img_mgmt_release_lock();
@@ -360,6 +363,11 @@ img_mgmt_erase(struct smp_streamer *ctxt)
 		}
 	}
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW
+	/* Do not let queued upload data be written to the erased slot */
+	img_mgmt_window_reset();
+#endif
+
 	rc = img_mgmt_erase_slot(slot);
 	img_mgmt_reset_upload();
 
@@ -566,6 +574,11 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 
 		g_img_mgmt_state.off = 0;
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW
+		/* Drop what is left of an abandoned upload */
+		img_mgmt_window_reset();
+#endif
+
 #if defined(CONFIG_MCUMGR_GRP_IMG_STATUS_HOOKS)
 		(void)mgmt_callback_notify(MGMT_EVT_OP_IMG_MGMT_DFU_STARTED, NULL, 0, &err_rc,
 					   &err_group);
@@ -638,8 +651,13 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 			last = true;
 		}
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW
+		rc = img_mgmt_window_write(req.off, req.img_data.value, action.write_bytes,
+					   g_img_mgmt_state.size);
+#else
 		rc = img_mgmt_write_image_data(req.off, req.img_data.value, action.write_bytes,
 						    last);
+#endif
 		if (rc == 0) {
 			g_img_mgmt_state.off += action.write_bytes;
 		} else {
@@ -667,7 +685,12 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 #ifdef CONFIG_IMG_ENABLE_IMAGE_CHECK
 			static struct flash_img_context ctx;
 
-			if (flash_img_init_id(&ctx, g_img_mgmt_state.area_id) == 0) {
+			if (IS_ENABLED(CONFIG_MCUMGR_GRP_IMG_DELTA) && img_mgmt_upload_is_delta()) {
+				/* The "sha" is that of the patch, the reconstructed image
+				 * has been checked against the hash in the patch instead.
+				 */
+				data_match = true;
+			} else if (flash_img_init_id(&ctx, g_img_mgmt_state.area_id) == 0) {
 				struct flash_img_check fic = {
 					.match = g_img_mgmt_state.data_sha,
 					.clen = g_img_mgmt_state.size,
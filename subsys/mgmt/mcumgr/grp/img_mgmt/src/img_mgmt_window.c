@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/ring_buffer.h>
+
+#include <zephyr/mgmt/mcumgr/mgmt/mgmt.h>
+
+#include <mgmt/mcumgr/grp/img_mgmt/img_mgmt_priv.h>
+
+LOG_MODULE_DECLARE(mcumgr_img_grp, CONFIG_MCUMGR_GRP_IMG_LOG_LEVEL);
+
+/*
+ * Upload chunk data is copied to a ring buffer by the upload command handler
+ * and written to flash by the writer thread, so that the response to a chunk
+ * does not wait for its flash write.
+ */
+static K_MUTEX_DEFINE(window_lock);
+
+/* Signalled on every change of the window state */
+static K_CONDVAR_DEFINE(window_changed);
+
+RING_BUF_DECLARE(img_mgmt_window_rb, CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW_SIZE);
+
+static struct {
+	/* Image offset of the oldest queued data */
+	size_t off;
+	/* Size of the image, the write ending at it flushing the data */
+	size_t size;
+	/* Number of bytes queued, including those being written */
+	size_t pending;
+	/* Drop queued data rather than writing it */
+	bool discard;
+	/* Result of the first failed write since the last reset */
+	int rc;
+} window;
+
+static void img_mgmt_window_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_mutex_lock(&window_lock, K_FOREVER);
+
+	while (true) {
+		uint8_t *data;
+		uint32_t len;
+		size_t off;
+		size_t size;
+		bool write;
+		int rc = 0;
+
+		while (window.pending == 0) {
+			k_condvar_wait(&window_changed, &window_lock, K_FOREVER);
+		}
+
+		len = ring_buf_get_claim(&img_mgmt_window_rb, &data,
+					 CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW_SIZE);
+		off = window.off;
+		size = window.size;
+		write = !window.discard && window.rc == 0;
+
+		/* The claimed data is not touched by the handler, which only adds
+		 * more of it, so the lock is not needed while writing.
+		 */
+		k_mutex_unlock(&window_lock);
+
+		if (write) {
+			rc = img_mgmt_write_image_data(off, data, len, off + len == size);
+		}
+
+		k_mutex_lock(&window_lock, K_FOREVER);
+
+		if (rc != 0 && window.rc == 0 && !window.discard) {
+			LOG_ERR("Queued write of %u bytes at offset %zu failed: %d", len, off, rc);
+			window.rc = rc;
+		}
+
+		(void)ring_buf_get_finish(&img_mgmt_window_rb, len);
+		window.off += len;
+		window.pending -= len;
+		k_condvar_broadcast(&window_changed);
+	}
+}
+
+K_THREAD_DEFINE(img_mgmt_window_tid, CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW_STACK_SIZE,
+		img_mgmt_window_thread, NULL, NULL, NULL,
+		CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW_THREAD_PRIO, 0, 0);
+
+int img_mgmt_window_write(size_t offset, const void *data, size_t num_bytes, size_t size)
+{
+	const uint8_t *src = data;
+	size_t end = offset + num_bytes;
+	int rc;
+
+	k_mutex_lock(&window_lock, K_FOREVER);
+
+	rc = window.rc;
+	if (rc != 0) {
+		goto out;
+	}
+
+	if (window.pending == 0) {
+		window.off = offset;
+	}
+
+	__ASSERT(offset == window.off + window.pending, "Upload chunk is not contiguous");
+	window.size = size;
+
+	while (num_bytes > 0) {
+		uint32_t put = ring_buf_put(&img_mgmt_window_rb, src, num_bytes);
+
+		if (put == 0) {
+			k_condvar_wait(&window_changed, &window_lock, K_FOREVER);
+			continue;
+		}
+
+		src += put;
+		num_bytes -= put;
+		window.pending += put;
+		k_condvar_broadcast(&window_changed);
+	}
+
+	if (end == size) {
+		/* Last chunk, report the outcome of the whole upload */
+		while (window.pending > 0) {
+			k_condvar_wait(&window_changed, &window_lock, K_FOREVER);
+		}
+
+		rc = window.rc;
+	}
+
+out:
+	k_mutex_unlock(&window_lock);
+
+	return rc;
+}
+
+void img_mgmt_window_reset(void)
+{
+	k_mutex_lock(&window_lock, K_FOREVER);
+
+	window.discard = true;
+	k_condvar_broadcast(&window_changed);
+
+	while (window.pending > 0) {
+		k_condvar_wait(&window_changed, &window_lock, K_FOREVER);
+	}
+
+	window.discard = false;
+	window.rc = 0;
+	ring_buf_reset(&img_mgmt_window_rb);
+
+	k_mutex_unlock(&window_lock);
+}
@@ -13,6 +13,7 @@
 #include <zephyr/logging/log.h>
 #include <bootutil/bootutil_public.h>
 #include <assert.h>
+#include <zephyr/sys/byteorder.h>
 
 #include <zephyr/mgmt/mcumgr/mgmt/mgmt.h>
 #include <zephyr/mgmt/mcumgr/grp/img_mgmt/img_mgmt.h>
@@ -369,6 +370,83 @@ int img_mgmt_read(int slot, unsigned int offset, void *dst, unsigned int num_byt
 	return 0;
 }
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_DELTA
+static struct flash_img_delta_context img_mgmt_delta_ctx;
+static bool img_mgmt_delta;
+
+bool img_mgmt_upload_is_delta(void)
+{
+	return img_mgmt_delta;
+}
+
+/* Flash area of the image running from the slot paired with the upload one */
+static int img_mgmt_delta_source_area_id(void)
+{
+	for (int slot = 0; slot < (CONFIG_MCUMGR_GRP_IMG_UPDATABLE_IMAGE_NUMBER << 1); slot++) {
+		if (img_mgmt_flash_area_id(slot) == g_img_mgmt_state.area_id) {
+			return img_mgmt_flash_area_id(
+				img_mgmt_active_slot(img_mgmt_slot_to_image(slot)));
+		}
+	}
+
+	return -1;
+}
+#endif
+
+/*
+ * Starts writing an image, reconstructing it if the first chunk of data
+ * starts a delta patch.
+ */
+static int img_mgmt_write_start(struct flash_img_context *ctx, const void *data,
+				unsigned int num_bytes)
+{
+	if (flash_img_init_id(ctx, g_img_mgmt_state.area_id) != 0) {
+		return IMG_MGMT_ERR_FLASH_OPEN_FAILED;
+	}
+
+#ifdef CONFIG_MCUMGR_GRP_IMG_DELTA
+	int source_area_id;
+
+	img_mgmt_delta = flash_img_delta_is_patch(data, num_bytes);
+	if (!img_mgmt_delta) {
+		return IMG_MGMT_ERR_OK;
+	}
+
+	source_area_id = img_mgmt_delta_source_area_id();
+	if (source_area_id < 0 || source_area_id == g_img_mgmt_state.area_id) {
+		LOG_ERR("No source image for the delta patch");
+		return IMG_MGMT_ERR_ACTIVE_SLOT_NOT_KNOWN;
+	}
+
+	if (flash_img_delta_init(&img_mgmt_delta_ctx, ctx, source_area_id) != 0) {
+		return IMG_MGMT_ERR_FLASH_OPEN_FAILED;
+	}
+#else
+	ARG_UNUSED(data);
+	ARG_UNUSED(num_bytes);
+#endif
+
+	return IMG_MGMT_ERR_OK;
+}
+
+static int img_mgmt_buffered_write(struct flash_img_context *ctx, const void *data,
+				   unsigned int num_bytes, bool last)
+{
+#ifdef CONFIG_MCUMGR_GRP_IMG_DELTA
+	if (img_mgmt_delta) {
+		int rc = flash_img_delta_write(&img_mgmt_delta_ctx, data, num_bytes, last);
+
+		if (rc == -EILSEQ) {
+			LOG_ERR("Delta patch does not match the source or reconstructed image");
+		}
+
+		return rc;
+	}
+#endif
+
+	return flash_img_buffered_write(ctx, data, num_bytes, last);
+}
+
 #if defined(CONFIG_MCUMGR_GRP_IMG_USE_HEAP_FOR_FLASH_IMG_CONTEXT)
 int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned int num_bytes,
 			      bool last)
@@ -398,13 +476,13 @@ int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned in
 			return IMG_MGMT_ERR_NO_FREE_MEMORY;
 		}
 
-		if (flash_img_init_id(ctx, g_img_mgmt_state.area_id) != 0) {
-			rc = IMG_MGMT_ERR_FLASH_OPEN_FAILED;
+		rc = img_mgmt_write_start(ctx, data, num_bytes);
+		if (rc != IMG_MGMT_ERR_OK) {
 			goto out;
 		}
 	}
 
-	if (flash_img_buffered_write(ctx, data, num_bytes, last) != 0) {
+	if (img_mgmt_buffered_write(ctx, data, num_bytes, last) != 0) {
 		rc = IMG_MGMT_ERR_FLASH_WRITE_FAILED;
 		goto out;
 	}
@@ -424,12 +502,14 @@ int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned in
 	static struct flash_img_context ctx;
 
 	if (offset == 0) {
-		if (flash_img_init_id(&ctx, g_img_mgmt_state.area_id) != 0) {
-			return IMG_MGMT_ERR_FLASH_OPEN_FAILED;
+		int rc = img_mgmt_write_start(&ctx, data, num_bytes);
+
+		if (rc != IMG_MGMT_ERR_OK) {
+			return rc;
 		}
 	}
 
-	if (flash_img_buffered_write(&ctx, data, num_bytes, last) != 0) {
+	if (img_mgmt_buffered_write(&ctx, data, num_bytes, last) != 0) {
 		return IMG_MGMT_ERR_FLASH_WRITE_FAILED;
 	}
 
@@ -553,6 +633,7 @@ int img_mgmt_upload_inspect(const struct img_mgmt_upload_req *req,
 {
 	const struct image_header *hdr;
 	struct image_version cur_ver;
+	bool delta = false;
 	int rc;
 
 	memset(action, 0, sizeof(*action));
@@ -594,7 +675,17 @@ int img_mgmt_upload_inspect(const struct img_mgmt_upload_req *req,
 		action->size = req->size;
 
 		hdr = (struct image_header *)req->img_data.value;
-		if (hdr->ih_magic != IMAGE_MAGIC) {
+
+#ifdef CONFIG_MCUMGR_GRP_IMG_DELTA
+		delta = flash_img_delta_is_patch(req->img_data.value, req->img_data.len);
+		if (delta && (req->img_data.len < FLASH_IMG_DELTA_HDR_SIZE || req->upgrade)) {
+			/* The image header is only known once the image is reconstructed */
+			IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action, img_mgmt_err_str_hdr_malformed);
+			return IMG_MGMT_ERR_INVALID_IMAGE_HEADER;
+		}
+#endif
+
+		if (!delta && hdr->ih_magic != IMAGE_MAGIC) {
 			IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action, img_mgmt_err_str_magic_mismatch);
 			return IMG_MGMT_ERR_INVALID_IMAGE_HEADER_MAGIC;
 		}
@@ -641,6 +732,16 @@ int img_mgmt_upload_inspect(const struct img_mgmt_upload_req *req,
 			return IMG_MGMT_ERR_INVALID_IMAGE_TOO_LARGE;
 		}
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_DELTA
+		/* The patch header gives the size of the reconstructed image */
+		if (delta && sys_get_le32(&req->img_data.value[8]) > fa->fa_size) {
+			IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action,
+				img_mgmt_err_str_image_too_large);
+			flash_area_close(fa);
+			return IMG_MGMT_ERR_INVALID_IMAGE_TOO_LARGE;
+		}
+#endif
+
 #if defined(CONFIG_MCUMGR_GRP_IMG_TOO_LARGE_SYSBUILD) &&			\
 	(defined(CONFIG_MCUBOOT_BOOTLOADER_MODE_SWAP_WITHOUT_SCRATCH) ||	\
 	 defined(CONFIG_MCUBOOT_BOOTLOADER_MODE_SWAP_SCRATCH) ||		\
@@ -708,7 +809,7 @@ skip_size_check:
 #endif
 
 #if defined(CONFIG_MCUMGR_GRP_IMG_REJECT_DIRECT_XIP_MISMATCHED_SLOT)
-		if (hdr->ih_flags & IMAGE_F_ROM_FIXED) {
+		if (!delta && (hdr->ih_flags & IMAGE_F_ROM_FIXED)) {
 			if (fa->fa_off != hdr->ih_load_addr) {
 				IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action,
 					img_mgmt_err_str_image_bad_flash_addr);
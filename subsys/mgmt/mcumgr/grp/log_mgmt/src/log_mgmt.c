@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/sys/util.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend_ram.h>
+
+#include <zcbor_common.h>
+#include <zcbor_encode.h>
+
+#include <zephyr/mgmt/mcumgr/mgmt/mgmt.h>
+#include <zephyr/mgmt/mcumgr/mgmt/handlers.h>
+#include <zephyr/mgmt/mcumgr/smp/smp.h>
+#include <zephyr/mgmt/mcumgr/grp/log_mgmt/log_mgmt.h>
+
+LOG_MODULE_REGISTER(mcumgr_log_grp, CONFIG_MCUMGR_GRP_LOG_LOG_LEVEL);
+
+/**
+ * Command handler: log show
+ *
+ * Moves the oldest data of the RAM log backend into the response. The
+ * "rem" field tells how many bytes are left, the client repeats the
+ * command until it is 0.
+ */
+static int
+log_mgmt_show(struct smp_streamer *ctxt)
+{
+	zcbor_state_t *zse = ctxt->writer->zs;
+	uint8_t data[CONFIG_MCUMGR_GRP_LOG_CHUNK_SIZE];
+	size_t len;
+	bool ok;
+
+	len = log_backend_ram_read(data, sizeof(data));
+
+	ok = zcbor_tstr_put_lit(zse, "data")				&&
+	     zcbor_bstr_encode_ptr(zse, data, len)			&&
+	     zcbor_tstr_put_lit(zse, "rem")				&&
+	     zcbor_uint32_put(zse, log_backend_ram_pending())		&&
+	     zcbor_tstr_put_lit(zse, "dropped")			&&
+	     zcbor_uint32_put(zse, log_backend_ram_dropped_get());
+
+	return ok ? MGMT_ERR_EOK : MGMT_ERR_EMSGSIZE;
+}
+
+/**
+ * Command handler: log clear
+ */
+static int
+log_mgmt_clear(struct smp_streamer *ctxt)
+{
+	zcbor_state_t *zse = ctxt->writer->zs;
+	bool ok = true;
+
+	log_backend_ram_clear();
+
+	if (IS_ENABLED(CONFIG_MCUMGR_SMP_LEGACY_RC_BEHAVIOUR)) {
+		ok = zcbor_tstr_put_lit(zse, "rc")		&&
+		     zcbor_int32_put(zse, MGMT_ERR_EOK);
+	}
+
+	return ok ? MGMT_ERR_EOK : MGMT_ERR_EMSGSIZE;
+}
+
+static const struct mgmt_handler log_mgmt_handlers[] = {
+	[LOG_MGMT_ID_SHOW] = { log_mgmt_show, NULL },
+	[LOG_MGMT_ID_CLEAR] = { NULL, log_mgmt_clear },
+};
+
+#define LOG_MGMT_HANDLER_CNT ARRAY_SIZE(log_mgmt_handlers)
+
+static struct mgmt_group log_mgmt_group = {
+	.mg_handlers = log_mgmt_handlers,
+	.mg_handlers_count = LOG_MGMT_HANDLER_CNT,
+	.mg_group_id = MGMT_GROUP_ID_LOG,
+};
+
+static void log_mgmt_register_group(void)
+{
+	mgmt_register_group(&log_mgmt_group);
+}
+
+MCUMGR_HANDLER_DEFINE(log_mgmt, log_mgmt_register_group);
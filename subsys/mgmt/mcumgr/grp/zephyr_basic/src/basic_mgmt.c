@@ -8,6 +8,13 @@
 #include <zephyr/init.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/storage/flash_map.h>
+#include <zephyr/debug/boot_profile.h>
+
+#include <zcbor_common.h>
+#include <zcbor_decode.h>
+#include <zcbor_encode.h>
+
+#include <mgmt/mcumgr/util/zcbor_bulk.h>
 
 #include <zephyr/mgmt/mcumgr/mgmt/mgmt.h>
 #include <zephyr/mgmt/mcumgr/mgmt/handlers.h>
@@ -15,6 +22,7 @@
 
 LOG_MODULE_REGISTER(mcumgr_zbasic_grp, CONFIG_MCUMGR_GRP_ZBASIC_LOG_LEVEL);
 
+#ifdef CONFIG_MCUMGR_GRP_ZBASIC_STORAGE_ERASE
 #define ERASE_TARGET		storage_partition
 #define ERASE_TARGET_ID		FIXED_PARTITION_ID(ERASE_TARGET)
 
@@ -63,6 +71,78 @@ static int storage_erase_handler(struct smp_streamer *ctxt)
 
 	return MGMT_ERR_EOK;
 }
+#endif /* CONFIG_MCUMGR_GRP_ZBASIC_STORAGE_ERASE */
+
+#ifdef CONFIG_MCUMGR_GRP_ZBASIC_BOOT_PROFILE
+/* Map entries of a record */
+#define BOOT_PROFILE_RECORD_ENTRIES 6
+
+static bool boot_profile_encode_record(zcbor_state_t *zse, const struct boot_profile_record *rec)
+{
+	char buf[2 + 2 * sizeof(uintptr_t) + 1];
+	const char *name = boot_profile_name(rec, buf, sizeof(buf));
+
+	return zcbor_map_start_encode(zse, BOOT_PROFILE_RECORD_ENTRIES)	&&
+	       zcbor_tstr_put_lit(zse, "name")				&&
+	       zcbor_tstr_put_term(zse, name, CONFIG_MCUMGR_GRP_ZBASIC_BOOT_PROFILE_NAME_LEN) &&
+	       zcbor_tstr_put_lit(zse, "kind")				&&
+	       zcbor_uint32_put(zse, rec->kind)				&&
+	       zcbor_tstr_put_lit(zse, "level")				&&
+	       zcbor_uint32_put(zse, rec->level)			&&
+	       zcbor_tstr_put_lit(zse, "start")				&&
+	       zcbor_uint32_put(zse, rec->start)			&&
+	       zcbor_tstr_put_lit(zse, "end")				&&
+	       zcbor_uint32_put(zse, rec->end)				&&
+	       zcbor_tstr_put_lit(zse, "rc")				&&
+	       zcbor_int32_put(zse, rec->result)			&&
+	       zcbor_map_end_encode(zse, BOOT_PROFILE_RECORD_ENTRIES);
+}
+
+/*
+ * Responds with up to CONFIG_MCUMGR_GRP_ZBASIC_BOOT_PROFILE_RECORDS records
+ * from the requested offset, the client reading the rest with more requests.
+ */
+static int boot_profile_handler(struct smp_streamer *ctxt)
+{
+	zcbor_state_t *zse = ctxt->writer->zs;
+	zcbor_state_t *zsd = ctxt->reader->zs;
+	const struct boot_profile_record *recs;
+	size_t total = boot_profile_get(&recs);
+	uint32_t off = 0;
+	size_t decoded;
+	size_t n;
+	bool ok;
+
+	struct zcbor_map_decode_key_val boot_profile_decode[] = {
+		ZCBOR_MAP_DECODE_KEY_DECODER("off", zcbor_uint32_decode, &off),
+	};
+
+	if (zcbor_map_decode_bulk(zsd, boot_profile_decode, ARRAY_SIZE(boot_profile_decode),
+				  &decoded) != 0) {
+		return MGMT_ERR_EINVAL;
+	}
+
+	off = MIN(off, total);
+	n = MIN(total - off, CONFIG_MCUMGR_GRP_ZBASIC_BOOT_PROFILE_RECORDS);
+
+	ok = zcbor_tstr_put_lit(zse, "hz")				&&
+	     zcbor_uint32_put(zse, sys_clock_hw_cycles_per_sec())	&&
+	     zcbor_tstr_put_lit(zse, "total")				&&
+	     zcbor_uint32_put(zse, total)				&&
+	     zcbor_tstr_put_lit(zse, "off")				&&
+	     zcbor_uint32_put(zse, off)					&&
+	     zcbor_tstr_put_lit(zse, "records")			&&
+	     zcbor_list_start_encode(zse, n);
+
+	for (size_t i = off; ok && i < off + n; i++) {
+		ok = boot_profile_encode_record(zse, &recs[i]);
+	}
+
+	ok = ok && zcbor_list_end_encode(zse, n);
+
+	return ok ? MGMT_ERR_EOK : MGMT_ERR_EMSGSIZE;
+}
+#endif /* CONFIG_MCUMGR_GRP_ZBASIC_BOOT_PROFILE */
 
 #ifdef CONFIG_MCUMGR_SMP_SUPPORT_ORIGINAL_PROTOCOL
 /*
@@ -95,10 +175,18 @@ static int zephyr_basic_group_translate_error_code(uint16_t ret)
 #endif
 
 static const struct mgmt_handler zephyr_mgmt_basic_handlers[] = {
+#ifdef CONFIG_MCUMGR_GRP_ZBASIC_STORAGE_ERASE
 	[ZEPHYR_MGMT_GRP_BASIC_CMD_ERASE_STORAGE] = {
 		.mh_read  = NULL,
 		.mh_write = storage_erase_handler,
 	},
+#endif
+#ifdef CONFIG_MCUMGR_GRP_ZBASIC_BOOT_PROFILE
+	[ZEPHYR_MGMT_GRP_BASIC_CMD_BOOT_PROFILE] = {
+		.mh_read  = boot_profile_handler,
+		.mh_write = NULL,
+	},
+#endif
 };
 
 static struct mgmt_group zephyr_basic_mgmt_group = {
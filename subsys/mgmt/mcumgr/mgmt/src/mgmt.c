@@ -130,6 +130,9 @@ smp_translate_error_fn mgmt_find_error_translation_function(uint16_t group_id)
 void
 mgmt_register_group(struct mgmt_group *group)
 {
+#if CONFIG_MCUMGR_TRANSPORT_WORKQUEUE_COUNT > 1
+	k_mutex_init(&group->mg_lock);
+#endif
 	sys_slist_append(&mgmt_group_list, &group->node);
 }
 
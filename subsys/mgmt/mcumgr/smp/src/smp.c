@@ -236,7 +236,16 @@ static int smp_handle_single_payload(struct smp_streamer *cbuf, const struct smp
 		}
 #endif
 
+#if CONFIG_MCUMGR_TRANSPORT_WORKQUEUE_COUNT > 1
+		/* Handlers keep per group state, so requests for the same group received
+		 * on transports processed by different work queues must not overlap.
+		 */
+		(void)k_mutex_lock((struct k_mutex *)&group->mg_lock, K_FOREVER);
+		rc = handler_fn(cbuf);
+		(void)k_mutex_unlock((struct k_mutex *)&group->mg_lock);
+#else
 		rc = handler_fn(cbuf);
+#endif
 
 #if defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 end:
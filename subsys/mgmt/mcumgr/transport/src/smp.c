@@ -27,9 +27,15 @@ LOG_MODULE_REGISTER(mcumgr_smp, CONFIG_MCUMGR_TRANSPORT_LOG_LEVEL);
 #define WEAK
 #endif
 
-K_THREAD_STACK_DEFINE(smp_work_queue_stack, CONFIG_MCUMGR_TRANSPORT_WORKQUEUE_STACK_SIZE);
+K_THREAD_STACK_ARRAY_DEFINE(smp_work_queue_stacks, CONFIG_MCUMGR_TRANSPORT_WORKQUEUE_COUNT,
+			    CONFIG_MCUMGR_TRANSPORT_WORKQUEUE_STACK_SIZE);
 
-static struct k_work_q smp_work_queue;
+static struct k_work_q smp_work_queues[CONFIG_MCUMGR_TRANSPORT_WORKQUEUE_COUNT];
+
+#if CONFIG_MCUMGR_TRANSPORT_WORKQUEUE_COUNT > 1
+/* Work queue to assign to the next initialised transport */
+static atomic_t smp_work_queue_next;
+#endif
 
 #ifdef CONFIG_SMP_CLIENT
 static sys_slist_t smp_transport_clients;
@@ -103,6 +109,17 @@ void smp_free_buf(void *buf, void *arg)
 	smp_packet_free(buf);
 }
 
+static inline struct k_work_q *smp_transport_work_q(struct smp_transport *smpt)
+{
+#if CONFIG_MCUMGR_TRANSPORT_WORKQUEUE_COUNT > 1
+	return smpt->work_q;
+#else
+	ARG_UNUSED(smpt);
+
+	return &smp_work_queues[0];
+#endif
+}
+
 /**
  * Processes a single SMP packet and sends the corresponding response(s).
  */
@@ -157,6 +174,11 @@ int smp_transport_init(struct smp_transport *smpt)
 	k_work_init(&smpt->work, smp_handle_reqs);
 	k_fifo_init(&smpt->fifo);
 
+#if CONFIG_MCUMGR_TRANSPORT_WORKQUEUE_COUNT > 1
+	smpt->work_q = &smp_work_queues[(uint32_t)atomic_inc(&smp_work_queue_next) %
+					CONFIG_MCUMGR_TRANSPORT_WORKQUEUE_COUNT];
+#endif
+
 	return 0;
 }
 
@@ -200,13 +222,13 @@ WEAK void
 smp_rx_req(struct smp_transport *smpt, struct net_buf *nb)
 {
 	net_buf_put(&smpt->fifo, nb);
-	k_work_submit_to_queue(&smp_work_queue, &smpt->work);
+	k_work_submit_to_queue(smp_transport_work_q(smpt), &smpt->work);
 }
 
 #ifdef CONFIG_SMP_CLIENT
 void smp_tx_req(struct k_work *work)
 {
-	k_work_submit_to_queue(&smp_work_queue, work);
+	k_work_submit_to_queue(&smp_work_queues[0], work);
 }
 #endif
 
@@ -245,7 +267,7 @@ void smp_rx_remove_invalid(struct smp_transport *zst, void *arg)
 
 	/* If at least one entry remains, queue the workqueue for running */
 	if (!k_fifo_is_empty(&zst->fifo)) {
-		k_work_submit_to_queue(&smp_work_queue, &zst->work);
+		k_work_submit_to_queue(smp_transport_work_q(zst), &zst->work);
 	}
 }
 
@@ -270,11 +292,14 @@ static int smp_init(void)
 	sys_slist_init(&smp_transport_clients);
 #endif
 
-	k_work_queue_init(&smp_work_queue);
+	for (int i = 0; i < ARRAY_SIZE(smp_work_queues); i++) {
+		k_work_queue_init(&smp_work_queues[i]);
 
-	k_work_queue_start(&smp_work_queue, smp_work_queue_stack,
-			   K_THREAD_STACK_SIZEOF(smp_work_queue_stack),
-			   CONFIG_MCUMGR_TRANSPORT_WORKQUEUE_THREAD_PRIO, &smp_work_queue_config);
+		k_work_queue_start(&smp_work_queues[i], smp_work_queue_stacks[i],
+				   K_THREAD_STACK_SIZEOF(smp_work_queue_stacks[i]),
+				   CONFIG_MCUMGR_TRANSPORT_WORKQUEUE_THREAD_PRIO,
+				   &smp_work_queue_config);
+	}
 
 	return 0;
 }
@@ -83,6 +83,8 @@ struct modbus_serial_config {
 	struct k_timer rtu_timer;
 	/* Number of bytes received or to send */
 	uint16_t uart_buf_ctr;
+	/* Enable reception again once disabled, with the async UART API */
+	bool rx_restart;
 	/* Storage of received characters or characters to send */
 	uint8_t uart_buf[CONFIG_MODBUS_BUFFER_SIZE];
 };
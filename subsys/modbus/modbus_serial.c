@@ -37,14 +37,24 @@ static void modbus_serial_tx_on(struct modbus_context *ctx)
 		gpio_pin_set(cfg->de->port, cfg->de->pin, 1);
 	}
 
-	uart_irq_tx_enable(cfg->dev);
+	if (IS_ENABLED(CONFIG_MODBUS_SERIAL_ASYNC)) {
+		if (uart_tx(cfg->dev, cfg->uart_buf_ptr, cfg->uart_buf_ctr,
+			    SYS_FOREVER_US) != 0) {
+			LOG_ERR("Failed to start UART transmission");
+		}
+	} else {
+		uart_irq_tx_enable(cfg->dev);
+	}
 }
 
 static void modbus_serial_tx_off(struct modbus_context *ctx)
 {
 	struct modbus_serial_config *cfg = ctx->cfg;
 
-	uart_irq_tx_disable(cfg->dev);
+	if (!IS_ENABLED(CONFIG_MODBUS_SERIAL_ASYNC)) {
+		uart_irq_tx_disable(cfg->dev);
+	}
+
 	if (cfg->de != NULL) {
 		gpio_pin_set(cfg->de->port, cfg->de->pin, 0);
 	}
@@ -58,14 +68,40 @@ static void modbus_serial_rx_on(struct modbus_context *ctx)
 		gpio_pin_set(cfg->re->port, cfg->re->pin, 1);
 	}
 
-	uart_irq_rx_enable(cfg->dev);
+	if (IS_ENABLED(CONFIG_MODBUS_SERIAL_ASYNC)) {
+		int err;
+
+		/*
+		 * The frame is received in place, and reported when the
+		 * line has been idle for the inter-frame delay.
+		 */
+		cfg->uart_buf_ctr = 0;
+		cfg->uart_buf_ptr = &cfg->uart_buf[0];
+		err = uart_rx_enable(cfg->dev, cfg->uart_buf,
+				     CONFIG_MODBUS_BUFFER_SIZE, cfg->rtu_timeout);
+		if (err == -EBUSY) {
+			/* Still being disabled, enable it again when done */
+			cfg->rx_restart = true;
+		} else if (err != 0) {
+			LOG_ERR("Failed to enable UART reception");
+		}
+	} else {
+		uart_irq_rx_enable(cfg->dev);
+	}
 }
 
 static void modbus_serial_rx_off(struct modbus_context *ctx)
 {
 	struct modbus_serial_config *cfg = ctx->cfg;
 
-	uart_irq_rx_disable(cfg->dev);
+	if (IS_ENABLED(CONFIG_MODBUS_SERIAL_ASYNC)) {
+		cfg->rx_restart = false;
+		/* Fails if the reception is already disabled */
+		(void)uart_rx_disable(cfg->dev);
+	} else {
+		uart_irq_rx_disable(cfg->dev);
+	}
+
 	if (cfg->re != NULL) {
 		gpio_pin_set(cfg->re->port, cfg->re->pin, 0);
 	}
@@ -304,6 +340,7 @@ static void rtu_tx_adu(struct modbus_context *ctx)
 	modbus_serial_tx_on(ctx);
 }
 
+#ifndef CONFIG_MODBUS_SERIAL_ASYNC
 /*
  * A byte has been received from a serial port. We just store it in the buffer
  * for processing when a complete packet has been received.
@@ -406,6 +443,47 @@ static void uart_cb_handler(const struct device *dev, void *app_data)
 		}
 	}
 }
+#else
+static void uart_async_cb_handler(const struct device *dev,
+				  struct uart_event *evt, void *app_data)
+{
+	struct modbus_context *ctx = (struct modbus_context *)app_data;
+	struct modbus_serial_config *cfg;
+
+	if (ctx == NULL) {
+		LOG_ERR("Modbus hardware is not properly initialized");
+		return;
+	}
+
+	cfg = ctx->cfg;
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+	case UART_TX_ABORTED:
+		cfg->uart_buf_ptr = &cfg->uart_buf[0];
+		modbus_serial_tx_off(ctx);
+		modbus_serial_rx_on(ctx);
+		break;
+	case UART_RX_RDY:
+		/*
+		 * Reported after the RX timeout, at the end of the frame,
+		 * or when the buffer is full.
+		 */
+		cfg->uart_buf_ctr = evt->data.rx.offset + evt->data.rx.len;
+		cfg->uart_buf_ptr = &cfg->uart_buf[cfg->uart_buf_ctr];
+		k_work_submit(&ctx->server_work);
+		break;
+	case UART_RX_DISABLED:
+		if (cfg->rx_restart) {
+			cfg->rx_restart = false;
+			modbus_serial_rx_on(ctx);
+		}
+		break;
+	default:
+		break;
+	}
+}
+#endif /* CONFIG_MODBUS_SERIAL_ASYNC */
 
 /* This function is called when the RTU framing timer expires. */
 static void rtu_tmr_handler(struct k_timer *t_id)
@@ -598,7 +676,15 @@ int modbus_serial_init(struct modbus_context *ctx,
 	cfg->uart_buf_ctr = 0;
 	cfg->uart_buf_ptr = &cfg->uart_buf[0];
 
+	cfg->rx_restart = false;
+#ifdef CONFIG_MODBUS_SERIAL_ASYNC
+	if (uart_callback_set(cfg->dev, uart_async_cb_handler, ctx) != 0) {
+		LOG_ERR("UART does not support the asynchronous API");
+		return -ENOTSUP;
+	}
+#else
 	uart_irq_callback_user_data_set(cfg->dev, uart_cb_handler, ctx);
+#endif
 	k_timer_init(&cfg->rtu_timer, rtu_tmr_handler, NULL);
 	k_timer_user_data_set(&cfg->rtu_timer, ctx);
 
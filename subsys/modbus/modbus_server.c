@@ -91,6 +91,53 @@ static void mbs_exception_rsp(struct modbus_context *ctx, uint8_t excep_code)
 	ctx->tx_adu.length = 1;
 }
 
+/*
+ * The range callbacks get the registers in host byte order. Once parsed, the
+ * request payload is used to hold them.
+ */
+BUILD_ASSERT(offsetof(struct modbus_adu, data) % sizeof(uint16_t) == 0);
+
+static inline uint16_t *mbs_range_regs(struct modbus_context *ctx)
+{
+	return (uint16_t *)&ctx->rx_adu.data[0];
+}
+
+/* Read a range of integer registers with a single callback. */
+static bool mbs_regs_read(struct modbus_context *ctx,
+			  int (*regs_rd)(uint16_t addr, uint16_t *regs, uint16_t num_regs),
+			  uint16_t reg_addr, uint16_t reg_qty)
+{
+	uint16_t *regs = mbs_range_regs(ctx);
+	uint8_t *presp = &ctx->tx_adu.data[1];
+
+	if (regs_rd(reg_addr, regs, reg_qty) != 0) {
+		LOG_INF("Register address range not supported");
+		mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_DATA_ADDR);
+		return true;
+	}
+
+	for (uint16_t i = 0; i < reg_qty; i++) {
+		sys_put_be16(regs[i], presp);
+		presp += sizeof(uint16_t);
+	}
+
+	return true;
+}
+
+/* Write a range of integer registers with a single callback. */
+static int mbs_regs_write(struct modbus_context *ctx, uint16_t reg_addr,
+			  uint16_t reg_qty, const uint8_t *prx_data)
+{
+	uint16_t *regs = mbs_range_regs(ctx);
+
+	/* Converted in place, the data being behind the registers */
+	for (uint16_t i = 0; i < reg_qty; i++) {
+		regs[i] = sys_get_be16(&prx_data[i * sizeof(uint16_t)]);
+	}
+
+	return ctx->mbs_user_cb->holding_regs_wr(reg_addr, regs, reg_qty);
+}
+
 /*
  * FC 01 (0x01) Read Coils
  *
@@ -325,7 +372,8 @@ static bool mbs_fc03_hreg_read(struct modbus_context *ctx)
 	if ((reg_addr < MODBUS_FP_EXTENSIONS_ADDR) ||
 	    !IS_ENABLED(CONFIG_MODBUS_FP_EXTENSIONS)) {
 		/* Read integer register */
-		if (ctx->mbs_user_cb->holding_reg_rd == NULL) {
+		if (ctx->mbs_user_cb->holding_reg_rd == NULL &&
+		    ctx->mbs_user_cb->holding_regs_rd == NULL) {
 			mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_FC);
 			return true;
 		}
@@ -362,6 +410,13 @@ static bool mbs_fc03_hreg_read(struct modbus_context *ctx)
 
 	/* Reset the pointer to the start of the response payload */
 	presp = &ctx->tx_adu.data[1];
+
+	if (((reg_addr < MODBUS_FP_EXTENSIONS_ADDR) ||
+	     !IS_ENABLED(CONFIG_MODBUS_FP_EXTENSIONS)) &&
+	    ctx->mbs_user_cb->holding_regs_rd != NULL) {
+		return mbs_regs_read(ctx, ctx->mbs_user_cb->holding_regs_rd, reg_addr, reg_qty);
+	}
+
 	/* Loop through each register requested. */
 	while (reg_qty > 0) {
 		if (reg_addr < MODBUS_FP_EXTENSIONS_ADDR) {
@@ -435,7 +490,8 @@ static bool mbs_fc04_inreg_read(struct modbus_context *ctx)
 	if ((reg_addr < MODBUS_FP_EXTENSIONS_ADDR) ||
 	    !IS_ENABLED(CONFIG_MODBUS_FP_EXTENSIONS)) {
 		/* Read integer register */
-		if (ctx->mbs_user_cb->input_reg_rd == NULL) {
+		if (ctx->mbs_user_cb->input_reg_rd == NULL &&
+		    ctx->mbs_user_cb->input_regs_rd == NULL) {
 			mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_FC);
 			return true;
 		}
@@ -472,6 +528,13 @@ static bool mbs_fc04_inreg_read(struct modbus_context *ctx)
 
 	/* Reset the pointer to the start of the response payload */
 	presp = &ctx->tx_adu.data[1];
+
+	if (((reg_addr < MODBUS_FP_EXTENSIONS_ADDR) ||
+	     !IS_ENABLED(CONFIG_MODBUS_FP_EXTENSIONS)) &&
+	    ctx->mbs_user_cb->input_regs_rd != NULL) {
+		return mbs_regs_read(ctx, ctx->mbs_user_cb->input_regs_rd, reg_addr, reg_qty);
+	}
+
 	/* Loop through each register requested. */
 	while (reg_qty > 0) {
 		if (reg_addr < MODBUS_FP_EXTENSIONS_ADDR) {
@@ -596,7 +659,8 @@ static bool mbs_fc06_hreg_write(struct modbus_context *ctx)
 		return false;
 	}
 
-	if (ctx->mbs_user_cb->holding_reg_wr == NULL) {
+	if (ctx->mbs_user_cb->holding_reg_wr == NULL &&
+	    ctx->mbs_user_cb->holding_regs_wr == NULL) {
 		mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_FC);
 		return true;
 	}
@@ -604,7 +668,11 @@ static bool mbs_fc06_hreg_write(struct modbus_context *ctx)
 	reg_addr = sys_get_be16(&ctx->rx_adu.data[0]);
 	reg_val = sys_get_be16(&ctx->rx_adu.data[2]);
 
-	err = ctx->mbs_user_cb->holding_reg_wr(reg_addr, reg_val);
+	if (ctx->mbs_user_cb->holding_regs_wr != NULL) {
+		err = ctx->mbs_user_cb->holding_regs_wr(reg_addr, &reg_val, 1);
+	} else {
+		err = ctx->mbs_user_cb->holding_reg_wr(reg_addr, reg_val);
+	}
 
 	if (err != 0) {
 		LOG_INF("Register address not supported");
@@ -848,7 +916,8 @@ static bool mbs_fc16_hregs_write(struct modbus_context *ctx)
 	if ((reg_addr < MODBUS_FP_EXTENSIONS_ADDR) ||
 	    !IS_ENABLED(CONFIG_MODBUS_FP_EXTENSIONS)) {
 		/* Write integer register */
-		if (ctx->mbs_user_cb->holding_reg_wr == NULL) {
+		if (ctx->mbs_user_cb->holding_reg_wr == NULL &&
+		    ctx->mbs_user_cb->holding_regs_wr == NULL) {
 			mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_FC);
 			return true;
 		}
@@ -892,30 +961,40 @@ static bool mbs_fc16_hregs_write(struct modbus_context *ctx)
 	/* The 1st registers data byte is 6th element in payload */
 	prx_data = &ctx->rx_adu.data[5];
 
-	for (uint16_t reg_cntr = 0; reg_cntr < reg_qty; reg_cntr++) {
-		uint16_t addr = reg_addr + reg_cntr;
-
-		if ((reg_addr < MODBUS_FP_EXTENSIONS_ADDR) ||
-		    !IS_ENABLED(CONFIG_MODBUS_FP_EXTENSIONS)) {
-			uint16_t reg_val = sys_get_be16(prx_data);
-
-			prx_data += sizeof(uint16_t);
-			err = ctx->mbs_user_cb->holding_reg_wr(addr, reg_val);
-		} else {
-			uint32_t reg_val = sys_get_be32(prx_data);
-			float fp;
-
-			/* Write to floating point register */
-			memcpy(&fp, &reg_val, sizeof(float));
-			prx_data += sizeof(uint32_t);
-			err = ctx->mbs_user_cb->holding_reg_wr_fp(addr, fp);
-		}
-
+	if (reg_size == sizeof(uint16_t) &&
+	    ctx->mbs_user_cb->holding_regs_wr != NULL) {
+		err = mbs_regs_write(ctx, reg_addr, reg_qty, prx_data);
 		if (err != 0) {
-			LOG_INF("Register address not supported");
+			LOG_INF("Register address range not supported");
 			mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_DATA_ADDR);
 			return true;
 		}
+	} else {
+		for (uint16_t reg_cntr = 0; reg_cntr < reg_qty; reg_cntr++) {
+			uint16_t addr = reg_addr + reg_cntr;
+
+			if ((reg_addr < MODBUS_FP_EXTENSIONS_ADDR) ||
+			    !IS_ENABLED(CONFIG_MODBUS_FP_EXTENSIONS)) {
+				uint16_t reg_val = sys_get_be16(prx_data);
+
+				prx_data += sizeof(uint16_t);
+				err = ctx->mbs_user_cb->holding_reg_wr(addr, reg_val);
+			} else {
+				uint32_t reg_val = sys_get_be32(prx_data);
+				float fp;
+
+				/* Write to floating point register */
+				memcpy(&fp, &reg_val, sizeof(float));
+				prx_data += sizeof(uint32_t);
+				err = ctx->mbs_user_cb->holding_reg_wr_fp(addr, fp);
+			}
+
+			if (err != 0) {
+				LOG_INF("Register address not supported");
+				mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_DATA_ADDR);
+				return true;
+			}
+		}
 	}
 
 	/* Assemble response payload */
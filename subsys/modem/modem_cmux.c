@@ -725,6 +725,25 @@ static void modem_cmux_drop_frame(struct modem_cmux *cmux)
 #endif
 }
 
+static uint8_t modem_cmux_compute_received_fcs(struct modem_cmux *cmux)
+{
+	uint8_t fcs;
+
+	if (cmux->frame.type == MODEM_CMUX_FRAME_TYPE_UIH) {
+		fcs = 0xFF - crc8(cmux->frame_header, cmux->frame_header_len,
+				  MODEM_CMUX_FCS_POLYNOMIAL, MODEM_CMUX_FCS_INIT_VALUE,
+				  true);
+	} else {
+		fcs = crc8(cmux->frame_header, cmux->frame_header_len,
+			   MODEM_CMUX_FCS_POLYNOMIAL, MODEM_CMUX_FCS_INIT_VALUE, true);
+
+		fcs = 0xFF - crc8(cmux->frame.data, cmux->frame.data_len,
+				  MODEM_CMUX_FCS_POLYNOMIAL, fcs, true);
+	}
+
+	return fcs;
+}
+
 static void modem_cmux_process_received_byte(struct modem_cmux *cmux, uint8_t byte)
 {
 	uint8_t fcs;
@@ -845,17 +864,8 @@ static void modem_cmux_process_received_byte(struct modem_cmux *cmux, uint8_t by
 		}
 
 		/* Compute FCS */
-		if (cmux->frame.type == MODEM_CMUX_FRAME_TYPE_UIH) {
-			fcs = 0xFF - crc8(cmux->frame_header, cmux->frame_header_len,
-					  MODEM_CMUX_FCS_POLYNOMIAL, MODEM_CMUX_FCS_INIT_VALUE,
-					  true);
-		} else {
-			fcs = crc8(cmux->frame_header, cmux->frame_header_len,
-				   MODEM_CMUX_FCS_POLYNOMIAL, MODEM_CMUX_FCS_INIT_VALUE, true);
-
-			fcs = 0xFF - crc8(cmux->frame.data, cmux->frame.data_len,
-					  MODEM_CMUX_FCS_POLYNOMIAL, fcs, true);
-		}
+		cmux->frame.data = cmux->receive_buf;
+		fcs = modem_cmux_compute_received_fcs(cmux);
 
 		/* Validate FCS */
 		if (fcs != byte) {
@@ -894,6 +904,65 @@ static void modem_cmux_process_received_byte(struct modem_cmux *cmux, uint8_t by
 	}
 }
 
+/*
+ * Process the data field of the frame being received, returning the number of
+ * bytes used. A frame ending within the received data is processed in place,
+ * without copying the data field to the receive buffer, everything else is
+ * copied in one go.
+ */
+static size_t modem_cmux_process_received_data(struct modem_cmux *cmux, const uint8_t *data,
+					       size_t len)
+{
+	uint16_t remaining = cmux->frame.data_len - cmux->receive_buf_len;
+	size_t copy;
+
+	if ((cmux->receive_buf_len == 0) && (cmux->frame.data_len <= cmux->receive_buf_size) &&
+	    (len >= (remaining + 2))) {
+		/* Whole data field, FCS and EOF available */
+		cmux->frame.data = data;
+		if ((modem_cmux_compute_received_fcs(cmux) == data[remaining]) &&
+		    (data[remaining + 1] == 0xF9)) {
+			modem_cmux_on_frame(cmux);
+			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_SOF;
+			return remaining + 2;
+		}
+
+		/* Let the copying path report the error */
+	}
+
+	copy = MIN(remaining, len);
+	if (cmux->receive_buf_len < cmux->receive_buf_size) {
+		memcpy(&cmux->receive_buf[cmux->receive_buf_len], data,
+		       MIN(copy, cmux->receive_buf_size - cmux->receive_buf_len));
+	}
+	cmux->receive_buf_len += copy;
+
+	/* Check if datalen reached */
+	if (cmux->frame.data_len == cmux->receive_buf_len) {
+		/* Await FCS */
+		cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_FCS;
+	}
+
+	return copy;
+}
+
+static void modem_cmux_process_received(struct modem_cmux *cmux, const uint8_t *data, size_t len)
+{
+	size_t used;
+
+	while (len > 0) {
+		if (cmux->receive_state == MODEM_CMUX_RECEIVE_STATE_DATA) {
+			used = modem_cmux_process_received_data(cmux, data, len);
+		} else {
+			modem_cmux_process_received_byte(cmux, *data);
+			used = 1;
+		}
+
+		data += used;
+		len -= used;
+	}
+}
+
 static void modem_cmux_receive_handler(struct k_work *item)
 {
 	struct k_work_delayable *dwork = k_work_delayable_from_work(item);
@@ -910,9 +979,7 @@ static void modem_cmux_receive_handler(struct k_work *item)
 	}
 
 	/* Process received data */
-	for (int i = 0; i < ret; i++) {
-		modem_cmux_process_received_byte(cmux, cmux->work_buf[i]);
-	}
+	modem_cmux_process_received(cmux, cmux->work_buf, ret);
 
 	/* Reschedule received work */
 	k_work_schedule(&cmux->receive_work, K_NO_WAIT);
@@ -19,14 +19,66 @@ LOG_MODULE_REGISTER(modem_ppp, CONFIG_MODEM_MODULES_LOG_LEVEL);
 #define MODEM_PPP_CODE_ESCAPE		(0x7D)
 #define MODEM_PPP_VALUE_ESCAPE		(0x20)
 
+#if CONFIG_MODEM_PPP_FCS_TABLE
+/* FCS-16 lookup table from RFC 1662, section C.2 */
+static const uint16_t modem_ppp_fcs_table[256] = {
+	0x0000, 0x1189, 0x2312, 0x329B, 0x4624, 0x57AD, 0x6536, 0x74BF,
+	0x8C48, 0x9DC1, 0xAF5A, 0xBED3, 0xCA6C, 0xDBE5, 0xE97E, 0xF8F7,
+	0x1081, 0x0108, 0x3393, 0x221A, 0x56A5, 0x472C, 0x75B7, 0x643E,
+	0x9CC9, 0x8D40, 0xBFDB, 0xAE52, 0xDAED, 0xCB64, 0xF9FF, 0xE876,
+	0x2102, 0x308B, 0x0210, 0x1399, 0x6726, 0x76AF, 0x4434, 0x55BD,
+	0xAD4A, 0xBCC3, 0x8E58, 0x9FD1, 0xEB6E, 0xFAE7, 0xC87C, 0xD9F5,
+	0x3183, 0x200A, 0x1291, 0x0318, 0x77A7, 0x662E, 0x54B5, 0x453C,
+	0xBDCB, 0xAC42, 0x9ED9, 0x8F50, 0xFBEF, 0xEA66, 0xD8FD, 0xC974,
+	0x4204, 0x538D, 0x6116, 0x709F, 0x0420, 0x15A9, 0x2732, 0x36BB,
+	0xCE4C, 0xDFC5, 0xED5E, 0xFCD7, 0x8868, 0x99E1, 0xAB7A, 0xBAF3,
+	0x5285, 0x430C, 0x7197, 0x601E, 0x14A1, 0x0528, 0x37B3, 0x263A,
+	0xDECD, 0xCF44, 0xFDDF, 0xEC56, 0x98E9, 0x8960, 0xBBFB, 0xAA72,
+	0x6306, 0x728F, 0x4014, 0x519D, 0x2522, 0x34AB, 0x0630, 0x17B9,
+	0xEF4E, 0xFEC7, 0xCC5C, 0xDDD5, 0xA96A, 0xB8E3, 0x8A78, 0x9BF1,
+	0x7387, 0x620E, 0x5095, 0x411C, 0x35A3, 0x242A, 0x16B1, 0x0738,
+	0xFFCF, 0xEE46, 0xDCDD, 0xCD54, 0xB9EB, 0xA862, 0x9AF9, 0x8B70,
+	0x8408, 0x9581, 0xA71A, 0xB693, 0xC22C, 0xD3A5, 0xE13E, 0xF0B7,
+	0x0840, 0x19C9, 0x2B52, 0x3ADB, 0x4E64, 0x5FED, 0x6D76, 0x7CFF,
+	0x9489, 0x8500, 0xB79B, 0xA612, 0xD2AD, 0xC324, 0xF1BF, 0xE036,
+	0x18C1, 0x0948, 0x3BD3, 0x2A5A, 0x5EE5, 0x4F6C, 0x7DF7, 0x6C7E,
+	0xA50A, 0xB483, 0x8618, 0x9791, 0xE32E, 0xF2A7, 0xC03C, 0xD1B5,
+	0x2942, 0x38CB, 0x0A50, 0x1BD9, 0x6F66, 0x7EEF, 0x4C74, 0x5DFD,
+	0xB58B, 0xA402, 0x9699, 0x8710, 0xF3AF, 0xE226, 0xD0BD, 0xC134,
+	0x39C3, 0x284A, 0x1AD1, 0x0B58, 0x7FE7, 0x6E6E, 0x5CF5, 0x4D7C,
+	0xC60C, 0xD785, 0xE51E, 0xF497, 0x8028, 0x91A1, 0xA33A, 0xB2B3,
+	0x4A44, 0x5BCD, 0x6956, 0x78DF, 0x0C60, 0x1DE9, 0x2F72, 0x3EFB,
+	0xD68D, 0xC704, 0xF59F, 0xE416, 0x90A9, 0x8120, 0xB3BB, 0xA232,
+	0x5AC5, 0x4B4C, 0x79D7, 0x685E, 0x1CE1, 0x0D68, 0x3FF3, 0x2E7A,
+	0xE70E, 0xF687, 0xC41C, 0xD595, 0xA12A, 0xB0A3, 0x8238, 0x93B1,
+	0x6B46, 0x7ACF, 0x4854, 0x59DD, 0x2D62, 0x3CEB, 0x0E70, 0x1FF9,
+	0xF78F, 0xE606, 0xD49D, 0xC514, 0xB1AB, 0xA022, 0x92B9, 0x8330,
+	0x7BC7, 0x6A4E, 0x58D5, 0x495C, 0x3DE3, 0x2C6A, 0x1EF1, 0x0F78,
+};
+
+static uint16_t modem_ppp_fcs_update_buf(uint16_t fcs, const uint8_t *data, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		fcs = (fcs >> 8) ^ modem_ppp_fcs_table[(fcs ^ data[i]) & 0xFF];
+	}
+
+	return fcs;
+}
+#else
+static uint16_t modem_ppp_fcs_update_buf(uint16_t fcs, const uint8_t *data, size_t len)
+{
+	return crc16_ccitt(fcs, data, len);
+}
+#endif
+
 static uint16_t modem_ppp_fcs_init(uint8_t byte)
 {
-	return crc16_ccitt(0xFFFF, &byte, 1);
+	return modem_ppp_fcs_update_buf(0xFFFF, &byte, 1);
 }
 
 static uint16_t modem_ppp_fcs_update(uint16_t fcs, uint8_t byte)
 {
-	return crc16_ccitt(fcs, &byte, 1);
+	return modem_ppp_fcs_update_buf(fcs, &byte, 1);
 }
 
 static uint16_t modem_ppp_fcs_final(uint16_t fcs)
@@ -48,6 +100,75 @@ static uint16_t modem_ppp_ppp_protocol(struct net_pkt *pkt)
 	return 0;
 }
 
+static bool modem_ppp_byte_needs_escape(uint8_t byte)
+{
+	return (byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
+	       (byte < MODEM_PPP_VALUE_ESCAPE);
+}
+
+/*
+ * Word at a time tests, which are exact as long as only the result being zero or not is
+ * used. The position of the matching byte is found afterwards by testing byte by byte.
+ */
+#define MODEM_PPP_WORD_ONES  (0x01010101U)
+#define MODEM_PPP_WORD_HIGHS (0x80808080U)
+
+static uint32_t modem_ppp_word_has_less(uint32_t word, uint8_t value)
+{
+	return (word - (MODEM_PPP_WORD_ONES * value)) & ~word & MODEM_PPP_WORD_HIGHS;
+}
+
+static uint32_t modem_ppp_word_has_byte(uint32_t word, uint8_t value)
+{
+	return modem_ppp_word_has_less(word ^ (MODEM_PPP_WORD_ONES * value), 1);
+}
+
+/* Number of leading bytes which can be transmitted without escaping */
+static size_t modem_ppp_transmit_span(const uint8_t *data, size_t len)
+{
+	size_t i = 0;
+	uint32_t word;
+
+	for (; (i + sizeof(word)) <= len; i += sizeof(word)) {
+		memcpy(&word, &data[i], sizeof(word));
+
+		if (modem_ppp_word_has_less(word, MODEM_PPP_VALUE_ESCAPE) ||
+		    modem_ppp_word_has_byte(word, MODEM_PPP_CODE_DELIMITER) ||
+		    modem_ppp_word_has_byte(word, MODEM_PPP_CODE_ESCAPE)) {
+			break;
+		}
+	}
+
+	while ((i < len) && !modem_ppp_byte_needs_escape(data[i])) {
+		i++;
+	}
+
+	return i;
+}
+
+/* Number of leading bytes which are neither a delimiter nor an escape */
+static size_t modem_ppp_receive_span(const uint8_t *data, size_t len)
+{
+	size_t i = 0;
+	uint32_t word;
+
+	for (; (i + sizeof(word)) <= len; i += sizeof(word)) {
+		memcpy(&word, &data[i], sizeof(word));
+
+		if (modem_ppp_word_has_byte(word, MODEM_PPP_CODE_DELIMITER) ||
+		    modem_ppp_word_has_byte(word, MODEM_PPP_CODE_ESCAPE)) {
+			break;
+		}
+	}
+
+	while ((i < len) && (data[i] != MODEM_PPP_CODE_DELIMITER) &&
+	       (data[i] != MODEM_PPP_CODE_ESCAPE)) {
+		i++;
+	}
+
+	return i;
+}
+
 static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 {
 	uint8_t byte;
@@ -88,8 +209,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 		byte = (ppp->tx_pkt_protocol >> 8) & 0xFF;
 		ppp->tx_pkt_fcs = modem_ppp_fcs_update(ppp->tx_pkt_fcs, byte);
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_byte_needs_escape(byte)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_PROTOCOL_HIGH;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -106,8 +226,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 		byte = ppp->tx_pkt_protocol & 0xFF;
 		ppp->tx_pkt_fcs = modem_ppp_fcs_update(ppp->tx_pkt_fcs, byte);
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_byte_needs_escape(byte)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_PROTOCOL_LOW;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -125,8 +244,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 		(void)net_pkt_read_u8(ppp->tx_pkt, &byte);
 		ppp->tx_pkt_fcs = modem_ppp_fcs_update(ppp->tx_pkt_fcs, byte);
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_byte_needs_escape(byte)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_DATA;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -152,8 +270,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 		ppp->tx_pkt_fcs = modem_ppp_fcs_final(ppp->tx_pkt_fcs);
 		byte = ppp->tx_pkt_fcs & 0xFF;
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_byte_needs_escape(byte)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_FCS_LOW;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -169,8 +286,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 	case MODEM_PPP_TRANSMIT_STATE_FCS_HIGH:
 		byte = (ppp->tx_pkt_fcs >> 8) & 0xFF;
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_byte_needs_escape(byte)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_FCS_HIGH;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -192,6 +308,43 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 	return 0;
 }
 
+/*
+ * Copies the data of the packet which needs no escaping straight into the transmit ring
+ * buffer. Returns the number of bytes copied, 0 if the next byte must go through
+ * modem_ppp_wrap_net_pkt_byte().
+ */
+static uint32_t modem_ppp_wrap_net_pkt_data(struct modem_ppp *ppp)
+{
+	struct net_buf *buf = ppp->tx_pkt->cursor.buf;
+	uint8_t *pos = net_pkt_cursor_get_pos(ppp->tx_pkt);
+	uint8_t *reserved;
+	uint32_t reserved_size;
+	size_t len;
+
+	if ((buf == NULL) || (pos == NULL)) {
+		return 0;
+	}
+
+	/* Only the rest of the current fragment is contiguous */
+	len = (buf->data + buf->len) - pos;
+	reserved_size = ring_buf_put_claim(&ppp->transmit_rb, &reserved, len);
+	len = modem_ppp_transmit_span(pos, reserved_size);
+
+	if ((len == 0) || (net_pkt_read(ppp->tx_pkt, reserved, len) < 0)) {
+		ring_buf_put_finish(&ppp->transmit_rb, 0);
+		return 0;
+	}
+
+	ppp->tx_pkt_fcs = modem_ppp_fcs_update_buf(ppp->tx_pkt_fcs, reserved, len);
+	ring_buf_put_finish(&ppp->transmit_rb, len);
+
+	if (net_pkt_remaining_data(ppp->tx_pkt) == 0) {
+		ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_FCS_LOW;
+	}
+
+	return len;
+}
+
 static bool modem_ppp_is_byte_expected(uint8_t byte, uint8_t expected_byte)
 {
 	if (byte == expected_byte) {
@@ -313,6 +466,44 @@ static void modem_ppp_process_received_byte(struct modem_ppp *ppp, uint8_t byte)
 	}
 }
 
+/*
+ * Writes the data of the frame up to the next delimiter or escape straight into the
+ * packet being received. Returns the number of bytes consumed, 0 if the next byte must
+ * go through modem_ppp_process_received_byte().
+ */
+static size_t modem_ppp_process_received_data(struct modem_ppp *ppp, const uint8_t *data,
+					      size_t len)
+{
+	size_t available;
+
+	if (ppp->receive_state != MODEM_PPP_RECEIVE_STATE_WRITING) {
+		return 0;
+	}
+
+	/* Leave the last byte of buffer to the byte path, which allocates more */
+	available = net_pkt_available_buffer(ppp->rx_pkt);
+	if (available < 2) {
+		return 0;
+	}
+
+	len = modem_ppp_receive_span(data, MIN(len, available - 1));
+	if (len == 0) {
+		return 0;
+	}
+
+	if (net_pkt_write(ppp->rx_pkt, data, len) < 0) {
+		LOG_WRN("Dropped PPP frame");
+		net_pkt_unref(ppp->rx_pkt);
+		ppp->rx_pkt = NULL;
+		ppp->receive_state = MODEM_PPP_RECEIVE_STATE_HDR_SOF;
+#if defined(CONFIG_NET_STATISTICS_PPP)
+		ppp->stats.drop++;
+#endif
+	}
+
+	return len;
+}
+
 #if CONFIG_MODEM_STATS
 static uint32_t get_transmit_buf_length(struct modem_ppp *ppp)
 {
@@ -373,6 +564,11 @@ static void modem_ppp_send_handler(struct k_work *item)
 
 		/* Fill transmit ring buffer */
 		while (ring_buf_space_get(&ppp->transmit_rb) > 0) {
+			if ((ppp->transmit_state == MODEM_PPP_TRANSMIT_STATE_DATA) &&
+			    (modem_ppp_wrap_net_pkt_data(ppp) > 0)) {
+				continue;
+			}
+
 			byte = modem_ppp_wrap_net_pkt_byte(ppp);
 
 			ring_buf_put(&ppp->transmit_rb, &byte, 1);
@@ -409,6 +605,7 @@ static void modem_ppp_send_handler(struct k_work *item)
 static void modem_ppp_process_handler(struct k_work *item)
 {
 	struct modem_ppp *ppp = CONTAINER_OF(item, struct modem_ppp, process_work);
+	size_t processed;
 	int ret;
 
 	ret = modem_pipe_receive(ppp->pipe, ppp->receive_buf, ppp->buf_size);
@@ -420,8 +617,15 @@ static void modem_ppp_process_handler(struct k_work *item)
 	advertise_receive_buf_stats(ppp, ret);
 #endif
 
-	for (int i = 0; i < ret; i++) {
+	for (int i = 0; i < ret;) {
+		processed = modem_ppp_process_received_data(ppp, &ppp->receive_buf[i], ret - i);
+		if (processed > 0) {
+			i += processed;
+			continue;
+		}
+
 		modem_ppp_process_received_byte(ppp, ppp->receive_buf[i]);
+		i++;
 	}
 
 	k_work_submit(&ppp->process_work);
@@ -832,6 +832,17 @@ sa_end:
 
 	compressed = inline_pos - pkt->buffer->data;
 
+	if (pkt->buffer->frags == NULL) {
+		/* The compressed header was written right before the payload,
+		 * so dropping the unused head of the buffer is enough.
+		 */
+		net_buf_pull(pkt->buffer, compressed);
+		net_pkt_cursor_init(pkt);
+
+		return compressed;
+	}
+
+	/* Keep the fragments filled, the L2 may send them one by one */
 	net_pkt_cursor_init(pkt);
 	net_pkt_pull(pkt, compressed);
 	net_pkt_compact(pkt);
@@ -1389,7 +1400,15 @@ static bool uncompress_IPHC_header(struct net_pkt *pkt)
 		return false;
 	}
 
-	if (net_buf_tailroom(pkt->buffer) >= diff) {
+	if (net_buf_headroom(pkt->buffer) >= diff) {
+		/* Typically the room left by the compression or by the L2
+		 * header, the payload does not need to be moved.
+		 */
+		NET_DBG("Enough headroom. Uncompress inplace");
+		frag = pkt->buffer;
+		net_buf_push(frag, diff);
+		cursor = frag->data + diff;
+	} else if (net_buf_tailroom(pkt->buffer) >= diff) {
 		NET_DBG("Enough tailroom. Uncompress inplace");
 		frag = pkt->buffer;
 		net_buf_add(frag, diff);
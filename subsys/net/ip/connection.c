@@ -18,6 +18,8 @@ LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 
 #include <errno.h>
 #include <zephyr/sys/util.h>
+#include <zephyr/sys/hash_function.h>
+#include <zephyr/sys/hash_map.h>
 
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_pkt.h>
@@ -57,8 +59,14 @@ LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 /** Remote address specified */
 #define NET_CONN_LOCAL_ADDR_SPEC	BIT(6)
 
+/** Fully specified but could not be added to the hash table */
+#define NET_CONN_HASH_MISSING		BIT(7)
+
 #define NET_CONN_RANK(_flags)		(_flags & 0x78)
 
+/** Rank of a connection with both end points fully specified */
+#define NET_CONN_RANK_MAX		NET_CONN_RANK(0xff)
+
 static struct net_conn conns[CONFIG_NET_MAX_CONN];
 
 static sys_slist_t conn_unused;
@@ -116,6 +124,261 @@ void conn_register_debug(struct net_conn *conn,
 
 static K_MUTEX_DEFINE(conn_lock);
 
+#if defined(CONFIG_NET_CONN_HASH)
+/* The table only ever holds CONFIG_NET_MAX_CONN entries, so give it a
+ * private heap large enough for the old and the new bucket array while
+ * it is being rehashed.
+ */
+#define CONN_HASH_HEAP_SIZE (CONFIG_NET_MAX_CONN * 128 + 256)
+
+static K_HEAP_DEFINE(conn_hash_heap, CONN_HASH_HEAP_SIZE);
+
+static void *conn_hash_alloc(void *ptr, size_t size)
+{
+	if (size == 0) {
+		k_heap_free(&conn_hash_heap, ptr);
+		return NULL;
+	}
+
+	return k_heap_realloc(&conn_hash_heap, ptr, size, K_NO_WAIT);
+}
+
+/* Maps a hash key to the first connection of a chain linked through
+ * hash_next. Chaining takes care of both key collisions and connections
+ * that only differ by the interface they are bound to.
+ */
+SYS_HASHMAP_OA_LP_DEFINE_STATIC_ADVANCED(conn_hash, sys_hash32, conn_hash_alloc,
+					 SYS_HASHMAP_CONFIG(CONFIG_NET_MAX_CONN,
+							    SYS_HASHMAP_DEFAULT_LOAD_FACTOR));
+
+/* Number of fully specified connections that could not be added to the
+ * table (out of memory). The fast path is not used while non-zero, as
+ * the result could then differ from the list lookup.
+ */
+static int conn_hash_missing;
+
+static bool conn_addr_cmp(struct net_pkt *pkt,
+			  union net_ip_header *ip_hdr,
+			  struct sockaddr *addr,
+			  bool is_remote);
+
+struct conn_hash_tuple {
+	uint8_t local_addr[sizeof(struct in6_addr)];
+	uint8_t remote_addr[sizeof(struct in6_addr)];
+	uint16_t local_port;
+	uint16_t remote_port;
+	uint16_t proto;
+	uint8_t family;
+} __packed;
+
+static uint64_t conn_hash_key(uint16_t proto, uint8_t family,
+			      const uint8_t *local_addr, const uint8_t *remote_addr,
+			      uint16_t local_port, uint16_t remote_port)
+{
+	struct conn_hash_tuple tuple = { 0 };
+	size_t addr_len = family == AF_INET6 ? sizeof(struct in6_addr) :
+					       sizeof(struct in_addr);
+
+	memcpy(tuple.local_addr, local_addr, addr_len);
+	memcpy(tuple.remote_addr, remote_addr, addr_len);
+	tuple.local_port = local_port;
+	tuple.remote_port = remote_port;
+	tuple.proto = proto;
+	tuple.family = family;
+
+	return ((uint64_t)sys_hash32(&tuple, sizeof(tuple)) << 32) |
+		((uint32_t)local_port << 16) | remote_port;
+}
+
+static const uint8_t *conn_hash_addr(const struct sockaddr *addr)
+{
+	if (IS_ENABLED(CONFIG_NET_IPV6) && addr->sa_family == AF_INET6) {
+		return (const uint8_t *)&net_sin6(addr)->sin6_addr;
+	}
+
+	return (const uint8_t *)&net_sin(addr)->sin_addr;
+}
+
+static bool conn_is_hashable(struct net_conn *conn)
+{
+	if (conn->proto != IPPROTO_UDP && conn->proto != IPPROTO_TCP) {
+		return false;
+	}
+
+	if (!((IS_ENABLED(CONFIG_NET_IPV4) && conn->family == AF_INET) ||
+	      (IS_ENABLED(CONFIG_NET_IPV6) && conn->family == AF_INET6))) {
+		return false;
+	}
+
+	if (conn->local_addr.sa_family != conn->family ||
+	    conn->remote_addr.sa_family != conn->family) {
+		return false;
+	}
+
+	return NET_CONN_RANK(conn->flags) == NET_CONN_RANK_MAX;
+}
+
+static uint64_t conn_hash_key_of(struct net_conn *conn)
+{
+	return conn_hash_key(conn->proto, conn->family,
+			     conn_hash_addr(&conn->local_addr),
+			     conn_hash_addr(&conn->remote_addr),
+			     net_sin(&conn->local_addr)->sin_port,
+			     net_sin(&conn->remote_addr)->sin_port);
+}
+
+/* Must be called with conn_lock held. */
+static void conn_hash_add(struct net_conn *conn)
+{
+	uint64_t key;
+	uint64_t head = 0;
+
+	if (!conn_is_hashable(conn)) {
+		return;
+	}
+
+	key = conn_hash_key_of(conn);
+
+	/* Prepend, like conn_used, so that the chain keeps the list order */
+	(void)sys_hashmap_get(&conn_hash, key, &head);
+	conn->hash_next = (struct net_conn *)(uintptr_t)head;
+
+	if (sys_hashmap_insert(&conn_hash, key, (uint64_t)(uintptr_t)conn, NULL) < 0) {
+		NET_DBG("[%zu] connection handler %p not hashed", conn - conns, conn);
+		conn->hash_next = NULL;
+		conn->flags |= NET_CONN_HASH_MISSING;
+		conn_hash_missing++;
+	}
+}
+
+/* Must be called with conn_lock held. */
+static void conn_hash_del(struct net_conn *conn)
+{
+	struct net_conn *prev = NULL;
+	struct net_conn *node;
+	uint64_t head;
+	uint64_t key;
+
+	if (conn->flags & NET_CONN_HASH_MISSING) {
+		conn->flags &= ~NET_CONN_HASH_MISSING;
+		conn_hash_missing--;
+		return;
+	}
+
+	if (!conn_is_hashable(conn)) {
+		return;
+	}
+
+	key = conn_hash_key_of(conn);
+
+	if (!sys_hashmap_get(&conn_hash, key, &head)) {
+		return;
+	}
+
+	for (node = (struct net_conn *)(uintptr_t)head; node != NULL;
+	     prev = node, node = node->hash_next) {
+		if (node != conn) {
+			continue;
+		}
+
+		if (prev != NULL) {
+			prev->hash_next = conn->hash_next;
+		} else if (conn->hash_next != NULL) {
+			(void)sys_hashmap_insert(&conn_hash, key,
+						 (uint64_t)(uintptr_t)conn->hash_next,
+						 NULL);
+		} else {
+			(void)sys_hashmap_remove(&conn_hash, key, NULL);
+		}
+
+		conn->hash_next = NULL;
+		break;
+	}
+}
+
+/* Look up a fully specified connection for a unicast UDP/TCP packet.
+ * Such a connection has the highest possible rank, so the first one
+ * found is the same one the list walk in net_conn_input() would pick.
+ * Must be called with conn_lock held.
+ */
+static struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+					 union net_ip_header *ip_hdr,
+					 uint8_t proto,
+					 uint16_t src_port, uint16_t dst_port)
+{
+	uint8_t family = net_pkt_family(pkt);
+	const uint8_t *local_addr;
+	const uint8_t *remote_addr;
+	struct net_conn *conn;
+	uint64_t head;
+
+	if (conn_hash_missing > 0 || sys_hashmap_is_empty(&conn_hash)) {
+		return NULL;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && family == AF_INET6) {
+		local_addr = ip_hdr->ipv6->dst;
+		remote_addr = ip_hdr->ipv6->src;
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) && family == AF_INET) {
+		local_addr = ip_hdr->ipv4->dst;
+		remote_addr = ip_hdr->ipv4->src;
+	} else {
+		return NULL;
+	}
+
+	if (!sys_hashmap_get(&conn_hash,
+			     conn_hash_key(proto, family, local_addr, remote_addr,
+					   dst_port, src_port),
+			     &head)) {
+		return NULL;
+	}
+
+	for (conn = (struct net_conn *)(uintptr_t)head; conn != NULL;
+	     conn = conn->hash_next) {
+		if (conn->proto != proto || conn->family != family) {
+			continue;
+		}
+
+		if (net_sin(&conn->local_addr)->sin_port != dst_port ||
+		    net_sin(&conn->remote_addr)->sin_port != src_port) {
+			continue;
+		}
+
+		if (!conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true) ||
+		    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
+			continue;
+		}
+
+		if (conn->context != NULL &&
+		    net_context_is_bound_to_iface(conn->context) &&
+		    net_pkt_iface(pkt) != net_context_get_iface(conn->context)) {
+			continue;
+		}
+
+		return conn;
+	}
+
+	return NULL;
+}
+#else
+#define conn_hash_add(...)
+#define conn_hash_del(...)
+
+static inline struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+						union net_ip_header *ip_hdr,
+						uint8_t proto,
+						uint16_t src_port, uint16_t dst_port)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(ip_hdr);
+	ARG_UNUSED(proto);
+	ARG_UNUSED(src_port);
+	ARG_UNUSED(dst_port);
+
+	return NULL;
+}
+#endif /* CONFIG_NET_CONN_HASH */
+
 static struct net_conn *conn_get_unused(void)
 {
 	sys_snode_t *node;
@@ -141,6 +404,7 @@ static void conn_set_used(struct net_conn *conn)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_prepend(&conn_used, &conn->node);
+	conn_hash_add(conn);
 	k_mutex_unlock(&conn_lock);
 }
 
@@ -452,6 +716,7 @@ int net_conn_unregister(struct net_conn_handle *handle)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_find_and_remove(&conn_used, &conn->node);
+	conn_hash_del(conn);
 	k_mutex_unlock(&conn_lock);
 
 	conn_set_unused(conn);
@@ -478,7 +743,11 @@ int net_conn_update(struct net_conn_handle *handle,
 
 	net_conn_change_callback(conn, cb, user_data);
 
+	k_mutex_lock(&conn_lock, K_FOREVER);
+	conn_hash_del(conn);
 	ret = net_conn_change_remote(conn, remote_addr, remote_port);
+	conn_hash_add(conn);
+	k_mutex_unlock(&conn_lock);
 
 	return ret;
 }
@@ -710,6 +979,16 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
+	if (IS_ENABLED(CONFIG_NET_CONN_HASH) &&
+	    (pkt_family == AF_INET || pkt_family == AF_INET6) &&
+	    (proto == IPPROTO_UDP || proto == IPPROTO_TCP) &&
+	    !is_mcast_pkt && !is_bcast_pkt) {
+		best_match = conn_hash_lookup(pkt, ip_hdr, proto, src_port, dst_port);
+		if (best_match != NULL) {
+			goto match_found;
+		}
+	}
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
 		/* Is the candidate connection matching the packet's interface? */
 		if (conn->context != NULL &&
@@ -878,6 +1157,7 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		}
 	} /* loop end */
 
+match_found:
 	if (best_match) {
 		cb = best_match->cb;
 		user_data = best_match->user_data;
@@ -54,6 +54,11 @@ struct net_conn {
 	/** Internal slist node */
 	sys_snode_t node;
 
+#if defined(CONFIG_NET_CONN_HASH)
+	/** Next connection with the same hash key */
+	struct net_conn *hash_next;
+#endif
+
 	/** Remote socket address */
 	struct sockaddr remote_addr;
 
@@ -332,6 +332,12 @@ struct net_ipv4_reassembly {
 	/** Pointers to pending fragments */
 	struct net_pkt *pkt[CONFIG_NET_IPV4_FRAGMENT_MAX_PKT];
 
+	/** Number of bytes of payload in the pending fragments */
+	uint32_t received;
+
+	/** Number of pending fragments, sorted by offset in pkt */
+	uint16_t count;
+
 	/** IPv4 fragment identification */
 	uint16_t id;
 	uint8_t protocol;
@@ -65,6 +65,8 @@ static struct net_ipv4_reassembly *reassembly_get(uint16_t id, struct in_addr *s
 
 	reassembly[avail].protocol = protocol;
 	reassembly[avail].id = id;
+	reassembly[avail].received = 0U;
+	reassembly[avail].count = 0U;
 
 	return &reassembly[avail];
 }
@@ -234,98 +236,109 @@ void net_ipv4_frag_foreach(net_ipv4_frag_cb_t cb, void *user_data)
 	}
 }
 
-/* Verify that we have all the fragments received and in correct order.
- * Return:
- * - a negative value if the fragments are erroneous and must be dropped
- * - zero if we are expecting more fragments
- * - a positive value if we can proceed with the reassembly
- */
-static int fragments_are_ready(struct net_ipv4_reassembly *reass)
+static inline int fragment_payload_len(struct net_pkt *pkt)
 {
-	unsigned int expected_offset = 0;
-	bool more = true;
-	int i;
+	return net_pkt_get_len(pkt) - net_pkt_ip_hdr_len(pkt);
+}
 
-	/* Fragments can arrive in any order, for example in reverse order:
-	 *   1 -> Fragment3(M=0, offset=x2)
-	 *   2 -> Fragment2(M=1, offset=x1)
-	 *   3 -> Fragment1(M=1, offset=0)
-	 * We have to test several requirements before proceeding with the reassembly:
-	 * - We received the first fragment (Fragment Offset is 0)
-	 * - All intermediate fragments are contiguous
-	 * - The More bit of the last fragment is 0
-	 */
-	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
-		struct net_pkt *pkt = reass->pkt[i];
-		unsigned int offset;
-		int payload_len;
+static inline unsigned int fragment_end(struct net_pkt *pkt)
+{
+	return net_pkt_ipv4_fragment_offset(pkt) + fragment_payload_len(pkt);
+}
 
-		if (!pkt) {
-			break;
-		}
+/* Store the fragment in the reassembly, keeping the fragments sorted by
+ * their offset. As overlapping fragments are refused, the pending fragments
+ * never overlap and the total amount of payload received is enough to tell
+ * whether there are holes left.
+ * Return:
+ * - -EBADMSG if the fragment is erroneous and the packet must be dropped
+ * - -ENOMEM if there is no room left for the fragment
+ * - zero if the fragment was stored
+ */
+static int fragment_store(struct net_ipv4_reassembly *reass, struct net_pkt *pkt)
+{
+	unsigned int offset = net_pkt_ipv4_fragment_offset(pkt);
+	int len = fragment_payload_len(pkt);
+	int lo = 0;
+	int hi = reass->count;
 
-		offset = net_pkt_ipv4_fragment_offset(pkt);
+	if (len < 0) {
+		return -EBADMSG;
+	}
 
-		if (offset < expected_offset) {
-			/* Overlapping or duplicated, drop it */
-			return -EBADMSG;
-		} else if (offset != expected_offset) {
-			/* Not contiguous, let's wait for fragments */
-			return 0;
-		}
+	if (reass->count >= CONFIG_NET_IPV4_FRAGMENT_MAX_PKT) {
+		return -ENOMEM;
+	}
 
-		payload_len = net_pkt_get_len(pkt) - net_pkt_ip_hdr_len(pkt);
+	/* Find the first pending fragment that does not start before
+	 * this one.
+	 */
+	while (lo < hi) {
+		int mid = (lo + hi) / 2;
 
-		if (payload_len < 0) {
-			return -EBADMSG;
+		if (net_pkt_ipv4_fragment_offset(reass->pkt[mid]) < offset) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
 		}
+	}
 
-		expected_offset += payload_len;
-		more = net_pkt_ipv4_fragment_more(pkt);
+	/* Overlapping or duplicated fragments, or data after the last
+	 * fragment. The whole packet is dropped.
+	 */
+	if (lo > 0 && (fragment_end(reass->pkt[lo - 1]) > offset ||
+		       !net_pkt_ipv4_fragment_more(reass->pkt[lo - 1]))) {
+		return -EBADMSG;
 	}
 
-	if (more) {
-		return 0;
+	if (lo < reass->count &&
+	    (offset + len > net_pkt_ipv4_fragment_offset(reass->pkt[lo]) ||
+	     !net_pkt_ipv4_fragment_more(pkt))) {
+		return -EBADMSG;
 	}
 
-	return 1;
-}
+	LOG_DBG("Storing pkt %p to slot %d offset %d", pkt, lo, offset);
 
-static int shift_packets(struct net_ipv4_reassembly *reass, int pos)
-{
-	int i;
+	memmove(&reass->pkt[lo + 1], &reass->pkt[lo],
+		sizeof(void *) * (reass->count - lo));
 
-	for (i = pos + 1; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
-		if (!reass->pkt[i]) {
-			LOG_DBG("Moving [%d] %p (offset 0x%x) to [%d]", pos, reass->pkt[pos],
-				net_pkt_ipv4_fragment_offset(reass->pkt[pos]), pos + 1);
+	reass->pkt[lo] = pkt;
+	reass->count++;
+	reass->received += len;
 
-			/* pkt[i] is free, so shift everything between [pos] and [i - 1] by one
-			 * element
-			 */
-			memmove(&reass->pkt[pos + 1], &reass->pkt[pos],
-				sizeof(void *) * (i - pos));
+	return 0;
+}
 
-			/* pkt[pos] is now free */
-			reass->pkt[pos] = NULL;
+/* Fragments can arrive in any order, for example in reverse order:
+ *   1 -> Fragment3(M=0, offset=x2)
+ *   2 -> Fragment2(M=1, offset=x1)
+ *   3 -> Fragment1(M=1, offset=0)
+ * The packet can be reassembled once the last fragment (the More bit is 0)
+ * is received and the fragments cover all the payload before it.
+ */
+static bool fragments_are_ready(struct net_ipv4_reassembly *reass)
+{
+	struct net_pkt *last;
 
-			return 0;
-		}
+	if (reass->count == 0U) {
+		return false;
 	}
 
-	/* We do not have free space left in the array */
-	return -ENOMEM;
+	last = reass->pkt[reass->count - 1];
+	if (net_pkt_ipv4_fragment_more(last)) {
+		return false;
+	}
+
+	return reass->received == fragment_end(last);
 }
 
 enum net_verdict net_ipv4_handle_fragment_hdr(struct net_pkt *pkt, struct net_ipv4_hdr *hdr)
 {
 	struct net_ipv4_reassembly *reass = NULL;
 	uint16_t flag;
-	bool found;
 	uint8_t more;
 	uint16_t id;
 	int ret;
-	int i;
 
 	flag = ntohs(*((uint16_t *)&hdr->offset));
 	id = ntohs(*((uint16_t *)&hdr->id));
@@ -349,53 +362,18 @@ enum net_verdict net_ipv4_handle_fragment_hdr(struct net_pkt *pkt, struct net_ip
 		goto drop;
 	}
 
-	/* The fragments might come in wrong order so place them in the reassembly chain in the
-	 * correct order.
-	 */
-	for (i = 0, found = false; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
-		if (reass->pkt[i]) {
-			if (net_pkt_ipv4_fragment_offset(reass->pkt[i]) <
-			    net_pkt_ipv4_fragment_offset(pkt)) {
-				continue;
-			}
-
-			/* Make room for this fragment. If there is no room then it will discard
-			 * the whole reassembly.
-			 */
-			if (shift_packets(reass, i)) {
-				break;
-			}
-		}
-
-		LOG_DBG("Storing pkt %p to slot %d offset %d", pkt, i,
-			net_pkt_ipv4_fragment_offset(pkt));
-		reass->pkt[i] = pkt;
-		found = true;
-
-		break;
-	}
-
-	if (!found) {
-		/* We could not add this fragment into our saved fragment list. The whole packet
-		 * must be discarded at this point.
+	ret = fragment_store(reass, pkt);
+	if (ret < 0) {
+		/* We could not add this fragment into our saved fragment
+		 * list. We must discard the whole packet at this point.
 		 */
-		LOG_ERR("No slots available for 0x%x", reass->id);
+		LOG_ERR("Cannot store fragment (%d), dropping id %u", ret,
+			reass->id);
 		net_pkt_unref(pkt);
 		goto drop;
 	}
 
-	ret = fragments_are_ready(reass);
-	if (ret < 0) {
-		LOG_ERR("Reassembled IPv4 verify failed, dropping id %u", reass->id);
-
-		/* Let the caller release the already inserted pkt */
-		if (i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT) {
-			reass->pkt[i] = NULL;
-		}
-
-		net_pkt_unref(pkt);
-		goto drop;
-	} else if (ret == 0) {
+	if (!fragments_are_ready(reass)) {
 		reassembly_info("Reassembly nth pkt", reass);
 
 		LOG_DBG("More fragments to be received");
@@ -621,9 +599,9 @@ enum net_verdict net_ipv4_prepare_for_send(struct net_pkt *pkt)
 	}
 
 	/* If we have already fragmented the packet, the ID field will contain a non-zero value
-	 * and we can skip other checks.
+	 * and we can skip other checks. GSO packets are segmented by L2 instead.
 	 */
-	if (ip_hdr->id[0] == 0 && ip_hdr->id[1] == 0) {
+	if (ip_hdr->id[0] == 0 && ip_hdr->id[1] == 0 && net_pkt_gso_size(pkt) == 0U) {
 		uint16_t mtu = net_if_get_mtu(net_pkt_iface(pkt));
 		size_t pkt_len = net_pkt_get_len(pkt);
 
@@ -481,6 +481,12 @@ struct net_ipv6_reassembly {
 	/** Pointers to pending fragments */
 	struct net_pkt *pkt[CONFIG_NET_IPV6_FRAGMENT_MAX_PKT];
 
+	/** Number of bytes of payload in the pending fragments */
+	uint32_t received;
+
+	/** Number of pending fragments, sorted by offset in pkt */
+	uint16_t count;
+
 	/** IPv6 fragment identification */
 	uint32_t id;
 };
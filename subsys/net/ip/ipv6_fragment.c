@@ -153,6 +153,8 @@ static struct net_ipv6_reassembly *reassembly_get(uint32_t id,
 	net_ipaddr_copy(&reassembly[avail].dst, dst);
 
 	reassembly[avail].id = id;
+	reassembly[avail].received = 0U;
+	reassembly[avail].count = 0U;
 
 	return &reassembly[avail];
 }
@@ -370,91 +372,101 @@ void net_ipv6_frag_foreach(net_ipv6_frag_cb_t cb, void *user_data)
 	}
 }
 
-/* Verify that we have all the fragments received and in correct order.
+static inline int fragment_payload_len(struct net_pkt *pkt)
+{
+	return net_pkt_get_len(pkt) - net_pkt_ipv6_fragment_start(pkt) -
+		sizeof(struct net_ipv6_frag_hdr);
+}
+
+static inline unsigned int fragment_end(struct net_pkt *pkt)
+{
+	return net_pkt_ipv6_fragment_offset(pkt) + fragment_payload_len(pkt);
+}
+
+/* Store the fragment in the reassembly, keeping the fragments sorted by
+ * their offset. As overlapping fragments are refused, the pending fragments
+ * never overlap and the total amount of payload received is enough to tell
+ * whether there are holes left.
  * Return:
- * - a negative value if the fragments are erroneous and must be dropped
- * - zero if we are expecting more fragments
- * - a positive value if we can proceed with the reassembly
+ * - -EBADMSG if the fragment is erroneous and the packet must be dropped
+ * - -ENOMEM if there is no room left for the fragment
+ * - zero if the fragment was stored
  */
-static int fragments_are_ready(struct net_ipv6_reassembly *reass)
+static int fragment_store(struct net_ipv6_reassembly *reass, struct net_pkt *pkt)
 {
-	unsigned int expected_offset = 0;
-	bool more = true;
-	int i;
-
-	/* Fragments can arrive in any order, for example in reverse order:
-	 *   1 -> Fragment3(M=0, offset=x2)
-	 *   2 -> Fragment2(M=1, offset=x1)
-	 *   3 -> Fragment1(M=1, offset=0)
-	 * We have to test several requirements before proceeding with the reassembly:
-	 * - We received the first fragment (Fragment Offset is 0)
-	 * - All intermediate fragments are contiguous
-	 * - The More bit of the last fragment is 0
-	 */
-	for (i = 0; i < CONFIG_NET_IPV6_FRAGMENT_MAX_PKT; i++) {
-		struct net_pkt *pkt = reass->pkt[i];
-		unsigned int offset;
-		int payload_len;
+	unsigned int offset = net_pkt_ipv6_fragment_offset(pkt);
+	int len = fragment_payload_len(pkt);
+	int lo = 0;
+	int hi = reass->count;
 
-		if (!pkt) {
-			break;
-		}
+	if (len < 0) {
+		return -EBADMSG;
+	}
 
-		offset = net_pkt_ipv6_fragment_offset(pkt);
+	if (reass->count >= CONFIG_NET_IPV6_FRAGMENT_MAX_PKT) {
+		return -ENOMEM;
+	}
 
-		if (offset < expected_offset) {
-			/* Overlapping or duplicated
-			 * According to RFC8200 we can drop it
-			 */
-			return -EBADMSG;
-		} else if (offset != expected_offset) {
-			/* Not contiguous, let's wait for fragments */
-			return 0;
-		}
+	/* Find the first pending fragment that does not start before
+	 * this one.
+	 */
+	while (lo < hi) {
+		int mid = (lo + hi) / 2;
 
-		payload_len = net_pkt_get_len(pkt) - net_pkt_ipv6_fragment_start(pkt);
-		payload_len -= sizeof(struct net_ipv6_frag_hdr);
-		if (payload_len < 0) {
-			return -EBADMSG;
+		if (net_pkt_ipv6_fragment_offset(reass->pkt[mid]) < offset) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
 		}
+	}
 
-		expected_offset += payload_len;
-		more = net_pkt_ipv6_fragment_more(pkt);
+	/* Overlapping or duplicated fragments, or data after the last
+	 * fragment. According to RFC8200 we can drop the whole packet.
+	 */
+	if (lo > 0 && (fragment_end(reass->pkt[lo - 1]) > offset ||
+		       !net_pkt_ipv6_fragment_more(reass->pkt[lo - 1]))) {
+		return -EBADMSG;
 	}
 
-	if (more) {
-		return 0;
+	if (lo < reass->count &&
+	    (offset + len > net_pkt_ipv6_fragment_offset(reass->pkt[lo]) ||
+	     !net_pkt_ipv6_fragment_more(pkt))) {
+		return -EBADMSG;
 	}
 
-	return 1;
-}
+	NET_DBG("Storing pkt %p to slot %d offset %d", pkt, lo, offset);
 
-static int shift_packets(struct net_ipv6_reassembly *reass, int pos)
-{
-	int i;
+	memmove(&reass->pkt[lo + 1], &reass->pkt[lo],
+		sizeof(void *) * (reass->count - lo));
+
+	reass->pkt[lo] = pkt;
+	reass->count++;
+	reass->received += len;
 
-	for (i = pos + 1; i < CONFIG_NET_IPV6_FRAGMENT_MAX_PKT; i++) {
-		if (!reass->pkt[i]) {
-			NET_DBG("Moving [%d] %p (offset 0x%x) to [%d]",
-				pos, reass->pkt[pos],
-				net_pkt_ipv6_fragment_offset(reass->pkt[pos]),
-				pos + 1);
+	return 0;
+}
 
-			/* pkt[i] is free, so shift everything between
-			 * [pos] and [i - 1] by one element
-			 */
-			memmove(&reass->pkt[pos + 1], &reass->pkt[pos],
-				sizeof(void *) * (i - pos));
+/* Fragments can arrive in any order, for example in reverse order:
+ *   1 -> Fragment3(M=0, offset=x2)
+ *   2 -> Fragment2(M=1, offset=x1)
+ *   3 -> Fragment1(M=1, offset=0)
+ * The packet can be reassembled once the last fragment (the More bit is 0)
+ * is received and the fragments cover all the payload before it.
+ */
+static bool fragments_are_ready(struct net_ipv6_reassembly *reass)
+{
+	struct net_pkt *last;
 
-			/* pkt[pos] is now free */
-			reass->pkt[pos] = NULL;
+	if (reass->count == 0U) {
+		return false;
+	}
 
-			return 0;
-		}
+	last = reass->pkt[reass->count - 1];
+	if (net_pkt_ipv6_fragment_more(last)) {
+		return false;
 	}
 
-	/* We do not have free space left in the array */
-	return -ENOMEM;
+	return reass->received == fragment_end(last);
 }
 
 enum net_verdict net_ipv6_handle_fragment_hdr(struct net_pkt *pkt,
@@ -463,7 +475,6 @@ enum net_verdict net_ipv6_handle_fragment_hdr(struct net_pkt *pkt,
 {
 	struct net_ipv6_reassembly *reass = NULL;
 	uint16_t flag;
-	bool found;
 	uint8_t more;
 	uint32_t id;
 	int ret;
@@ -512,54 +523,18 @@ enum net_verdict net_ipv6_handle_fragment_hdr(struct net_pkt *pkt,
 		goto drop;
 	}
 
-	/* The fragments might come in wrong order so place them
-	 * in reassembly chain in correct order.
-	 */
-	for (i = 0, found = false; i < CONFIG_NET_IPV6_FRAGMENT_MAX_PKT; i++) {
-		if (reass->pkt[i]) {
-			if (net_pkt_ipv6_fragment_offset(reass->pkt[i]) <
-			    net_pkt_ipv6_fragment_offset(pkt)) {
-				continue;
-			}
-
-			/* Make room for this fragment. If there is no room,
-			 * then it will discard the whole reassembly.
-			 */
-			if (shift_packets(reass, i)) {
-				break;
-			}
-		}
-
-		NET_DBG("Storing pkt %p to slot %d offset %d",
-			pkt, i, net_pkt_ipv6_fragment_offset(pkt));
-		reass->pkt[i] = pkt;
-		found = true;
-
-		break;
-	}
-
-	if (!found) {
+	ret = fragment_store(reass, pkt);
+	if (ret < 0) {
 		/* We could not add this fragment into our saved fragment
 		 * list. We must discard the whole packet at this point.
 		 */
-		NET_DBG("No slots available for 0x%x", reass->id);
+		NET_DBG("Cannot store fragment (%d), dropping id %u", ret,
+			reass->id);
 		net_pkt_unref(pkt);
 		goto drop;
 	}
 
-	ret = fragments_are_ready(reass);
-	if (ret < 0) {
-		NET_DBG("Reassembled IPv6 verify failed, dropping id %u",
-			reass->id);
-
-		/* Let the caller release the already inserted pkt */
-		if (i < CONFIG_NET_IPV6_FRAGMENT_MAX_PKT) {
-			reass->pkt[i] = NULL;
-		}
-
-		net_pkt_unref(pkt);
-		goto drop;
-	} else if (ret == 0) {
+	if (!fragments_are_ready(reass)) {
 		reassembly_info("Reassembly nth pkt", reass);
 
 		NET_DBG("More fragments to be received");
@@ -265,6 +265,96 @@ void nbr_print(void)
 #define nbr_print(...)
 #endif
 
+static inline int get_nbr_index(struct net_nbr *nbr)
+{
+	return ((uint8_t *)nbr - (uint8_t *)net_neighbor_pool) /
+		sizeof(net_neighbor_pool[0]);
+}
+
+static inline bool nbr_matches(struct net_nbr *nbr, struct net_if *iface,
+			       const struct in6_addr *addr)
+{
+	if (!nbr->ref) {
+		return false;
+	}
+
+	if (iface && nbr->iface != iface) {
+		return false;
+	}
+
+	return net_ipv6_addr_cmp(&net_ipv6_nbr_data(nbr)->addr, addr);
+}
+
+#if CONFIG_NET_IPV6_NBR_HASH_SIZE > 0
+/* Index of the neighbors by IPv6 address. The chains link the pool
+ * indexes, offset by one so that 0 ends a chain. An entry is moved to
+ * another chain only when it is initialized for a new address, so the
+ * chains can contain unused entries. These are skipped as they have no
+ * reference.
+ */
+static uint8_t nbr_hash_buckets[CONFIG_NET_IPV6_NBR_HASH_SIZE];
+static uint8_t nbr_hash_next[CONFIG_NET_IPV6_MAX_NEIGHBORS];
+static uint8_t nbr_hash_bucket_of[CONFIG_NET_IPV6_MAX_NEIGHBORS];
+
+static inline uint8_t nbr_hash(const struct in6_addr *addr)
+{
+	/* The interface identifier differs the most between neighbors */
+	uint32_t hash = UNALIGNED_GET(&addr->s6_addr32[2]) ^
+			UNALIGNED_GET(&addr->s6_addr32[3]);
+
+	hash ^= hash >> 16;
+	hash ^= hash >> 8;
+
+	return hash % CONFIG_NET_IPV6_NBR_HASH_SIZE;
+}
+
+static void nbr_hash_link(struct net_nbr *nbr, const struct in6_addr *addr)
+{
+	int idx = get_nbr_index(nbr);
+	uint8_t bucket = nbr_hash(addr);
+	uint8_t *link;
+
+	if (nbr_hash_bucket_of[idx] != 0U) {
+		link = &nbr_hash_buckets[nbr_hash_bucket_of[idx] - 1];
+
+		while (*link != idx + 1) {
+			link = &nbr_hash_next[*link - 1];
+		}
+
+		*link = nbr_hash_next[idx];
+	}
+
+	nbr_hash_next[idx] = nbr_hash_buckets[bucket];
+	nbr_hash_buckets[bucket] = idx + 1;
+	nbr_hash_bucket_of[idx] = bucket + 1;
+}
+
+static struct net_nbr *nbr_lookup(struct net_nbr_table *table,
+				  struct net_if *iface,
+				  const struct in6_addr *addr)
+{
+	uint8_t link;
+
+	ARG_UNUSED(table);
+
+	for (link = nbr_hash_buckets[nbr_hash(addr)]; link != 0U;
+	     link = nbr_hash_next[link - 1]) {
+		struct net_nbr *nbr = get_nbr(link - 1);
+
+		if (nbr_matches(nbr, iface, addr)) {
+			return nbr;
+		}
+	}
+
+	return NULL;
+}
+#else
+static inline void nbr_hash_link(struct net_nbr *nbr, const struct in6_addr *addr)
+{
+	ARG_UNUSED(nbr);
+	ARG_UNUSED(addr);
+}
+
 static struct net_nbr *nbr_lookup(struct net_nbr_table *table,
 				  struct net_if *iface,
 				  const struct in6_addr *addr)
@@ -274,21 +364,48 @@ static struct net_nbr *nbr_lookup(struct net_nbr_table *table,
 	for (i = 0; i < CONFIG_NET_IPV6_MAX_NEIGHBORS; i++) {
 		struct net_nbr *nbr = get_nbr(i);
 
-		if (!nbr->ref) {
-			continue;
+		if (nbr_matches(nbr, iface, addr)) {
+			return nbr;
 		}
+	}
 
-		if (iface && nbr->iface != iface) {
-			continue;
-		}
+	return NULL;
+}
+#endif /* CONFIG_NET_IPV6_NBR_HASH_SIZE > 0 */
+
+#if defined(CONFIG_NET_IPV6_NBR_CONTEXT_CACHE)
+/* Look up the neighbor of a packet sent through a context, checking first
+ * the neighbor that the previous packet of the context was sent to.
+ */
+static struct net_nbr *nbr_lookup_pkt(struct net_pkt *pkt,
+				      struct net_if *iface,
+				      const struct in6_addr *addr)
+{
+	struct net_context *context = net_pkt_context(pkt);
+	struct net_nbr *nbr;
 
-		if (net_ipv6_addr_cmp(&net_ipv6_nbr_data(nbr)->addr, addr)) {
+	if (context == NULL) {
+		return nbr_lookup(&net_neighbor.table, iface, addr);
+	}
+
+	if (context->ipv6_nbr_hint != 0U &&
+	    context->ipv6_nbr_hint <= CONFIG_NET_IPV6_MAX_NEIGHBORS) {
+		nbr = get_nbr(context->ipv6_nbr_hint - 1);
+
+		if (nbr_matches(nbr, iface, addr)) {
 			return nbr;
 		}
 	}
 
-	return NULL;
+	nbr = nbr_lookup(&net_neighbor.table, iface, addr);
+	context->ipv6_nbr_hint = nbr != NULL ? get_nbr_index(nbr) + 1 : 0U;
+
+	return nbr;
 }
+#else
+#define nbr_lookup_pkt(pkt, iface, addr) \
+	nbr_lookup(&net_neighbor.table, iface, addr)
+#endif /* CONFIG_NET_IPV6_NBR_CONTEXT_CACHE */
 
 static inline void nbr_clear_ns_pending(struct net_ipv6_nbr_data *data)
 {
@@ -425,6 +542,7 @@ static void nbr_init(struct net_nbr *nbr, struct net_if *iface,
 	nbr->iface = iface;
 
 	net_ipaddr_copy(&net_ipv6_nbr_data(nbr)->addr, addr);
+	nbr_hash_link(nbr, addr);
 	ipv6_nbr_set_state(nbr, state);
 	net_ipv6_nbr_data(nbr)->is_router = is_router;
 	net_ipv6_nbr_data(nbr)->pending = NULL;
@@ -806,9 +924,10 @@ enum net_verdict net_ipv6_prepare_for_send(struct net_pkt *pkt)
 
 #if defined(CONFIG_NET_IPV6_FRAGMENT)
 	/* If we have already fragmented the packet, the fragment id will
-	 * contain a proper value and we can skip other checks.
+	 * contain a proper value and we can skip other checks. GSO packets
+	 * are segmented by L2 instead.
 	 */
-	if (net_pkt_ipv6_fragment_id(pkt) == 0U) {
+	if (net_pkt_ipv6_fragment_id(pkt) == 0U && net_pkt_gso_size(pkt) == 0U) {
 		uint16_t mtu = net_if_get_mtu(net_pkt_iface(pkt));
 		size_t pkt_len = net_pkt_get_len(pkt);
 
@@ -912,7 +1031,7 @@ ignore_frag_error:
 try_send:
 	net_ipv6_nbr_lock();
 
-	nbr = nbr_lookup(&net_neighbor.table, iface, nexthop);
+	nbr = nbr_lookup_pkt(pkt, iface, nexthop);
 
 	NET_DBG("Neighbor lookup %p (%d) iface %p/%d addr %s state %s", nbr,
 		nbr ? nbr->idx : NET_NBR_LLADDR_UNKNOWN,
@@ -1759,30 +1759,51 @@ static int get_context_timestamping(struct net_context *context,
 /* If buf is not NULL, then use it. Otherwise read the data to be written
  * to net_pkt from msghdr.
  */
+static int context_write_chunk(struct net_pkt *pkt, const void *buf,
+			       size_t len, size_t offset, uint16_t *chksum)
+{
+#if defined(CONFIG_NET_UDP_CHECKSUM_COPY)
+	if (chksum != NULL) {
+		return net_pkt_write_chksum(pkt, buf, len, offset, chksum);
+	}
+#else
+	ARG_UNUSED(offset);
+	ARG_UNUSED(chksum);
+#endif
+
+	return net_pkt_write(pkt, buf, len);
+}
+
+/* If chksum is not NULL, the checksum of the data is computed while it is
+ * copied into the packet.
+ */
 static int context_write_data(struct net_pkt *pkt, const void *buf,
-			      int buf_len, const struct msghdr *msghdr)
+			      int buf_len, const struct msghdr *msghdr,
+			      uint16_t *chksum)
 {
 	int ret = 0;
 
 	if (msghdr) {
+		size_t offset = 0;
 		int i;
 
 		for (i = 0; i < msghdr->msg_iovlen; i++) {
 			int len = MIN(msghdr->msg_iov[i].iov_len, buf_len);
 
-			ret = net_pkt_write(pkt, msghdr->msg_iov[i].iov_base,
-					    len);
+			ret = context_write_chunk(pkt, msghdr->msg_iov[i].iov_base,
+						  len, offset, chksum);
 			if (ret < 0) {
 				break;
 			}
 
+			offset += len;
 			buf_len -= len;
 			if (buf_len == 0) {
 				break;
 			}
 		}
 	} else {
-		ret = net_pkt_write(pkt, buf, buf_len);
+		ret = context_write_chunk(pkt, buf, buf_len, 0, chksum);
 	}
 
 	return ret;
@@ -1795,10 +1816,12 @@ static int context_setup_udp_packet(struct net_context *context,
 				    size_t len,
 				    const struct msghdr *msg,
 				    const struct sockaddr *dst_addr,
-				    socklen_t addrlen)
+				    socklen_t addrlen,
+				    bool chksum_copy)
 {
 	int ret = -EINVAL;
 	uint16_t dst_port = 0U;
+	uint16_t chksum = 0U;
 
 	if (IS_ENABLED(CONFIG_NET_IPV6) && family == AF_INET6) {
 		struct sockaddr_in6 *addr6 = (struct sockaddr_in6 *)dst_addr;
@@ -1833,9 +1856,21 @@ static int context_setup_udp_packet(struct net_context *context,
 		return ret;
 	}
 
-	ret = context_write_data(pkt, buf, len, msg);
-	if (ret) {
-		return ret;
+	if (IS_ENABLED(CONFIG_NET_UDP_CHECKSUM_COPY) && chksum_copy &&
+	    net_if_need_calc_tx_checksum(net_pkt_iface(pkt), family == AF_INET6 ?
+					 NET_IF_CHECKSUM_IPV6_UDP :
+					 NET_IF_CHECKSUM_IPV4_UDP)) {
+		ret = context_write_data(pkt, buf, len, msg, &chksum);
+		if (ret) {
+			return ret;
+		}
+
+		net_pkt_set_payload_chksum(pkt, chksum);
+	} else {
+		ret = context_write_data(pkt, buf, len, msg, NULL);
+		if (ret) {
+			return ret;
+		}
 	}
 
 #if defined(CONFIG_NET_CONTEXT_TIMESTAMPING)
@@ -1922,6 +1957,9 @@ static void set_pkt_txtime(struct net_pkt *pkt, const struct msghdr *msghdr)
 	}
 }
 
+/* If frags is not NULL, the data is taken from that net_buf chain instead
+ * of buf/len and attached to the packet as is. Only UDP supports it.
+ */
 static int context_sendto(struct net_context *context,
 			  const void *buf,
 			  size_t len,
@@ -1930,7 +1968,8 @@ static int context_sendto(struct net_context *context,
 			  net_context_send_cb_t cb,
 			  k_timeout_t timeout,
 			  void *user_data,
-			  bool sendto)
+			  bool sendto,
+			  struct net_buf *frags)
 {
 	const struct msghdr *msghdr = NULL;
 	struct net_if *iface;
@@ -2165,6 +2204,19 @@ static int context_sendto(struct net_context *context,
 		return -ENETDOWN;
 	}
 
+	if (frags != NULL) {
+		/* TCP rebuilds segments from its send queue for retransmission
+		 * and would have to copy the chain, which is not zero-copy.
+		 */
+		if (net_if_is_ip_offloaded(iface) ||
+		    !IS_ENABLED(CONFIG_NET_UDP) ||
+		    net_context_get_proto(context) != IPPROTO_UDP) {
+			return -EOPNOTSUPP;
+		}
+
+		len = net_buf_frags_len(frags);
+	}
+
 	context->send_cb = cb;
 	context->user_data = user_data;
 
@@ -2174,14 +2226,23 @@ static int context_sendto(struct net_context *context,
 		goto skip_alloc;
 	}
 
-	pkt = context_alloc_pkt(context, family, len, PKT_WAIT_TIME);
+	/* Only room for the headers is needed when attaching frags */
+	pkt = context_alloc_pkt(context, family, frags != NULL ? 0 : len,
+				PKT_WAIT_TIME);
 	if (!pkt) {
 		NET_ERR("Failed to allocate net_pkt");
 		return -ENOBUFS;
 	}
 
-	tmp_len = net_pkt_available_payload_buffer(
+	if (frags != NULL) {
+		/* The chain is attached as is, so only the MTU limits it */
+		tmp_len = net_pkt_payload_len_limit(
+				pkt, len, net_context_get_proto(context));
+	} else {
+		tmp_len = net_pkt_available_payload_buffer(
 				pkt, net_context_get_proto(context));
+	}
+
 	if (tmp_len < len) {
 		if (net_context_get_type(context) == SOCK_DGRAM) {
 			NET_ERR("Available payload buffer (%zu) is not enough for requested DGRAM (%zu)",
@@ -2216,7 +2277,7 @@ static int context_sendto(struct net_context *context,
 skip_alloc:
 	if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
 	    net_if_is_ip_offloaded(net_context_get_iface(context))) {
-		ret = context_write_data(pkt, buf, len, msghdr);
+		ret = context_write_data(pkt, buf, len, msghdr, NULL);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -2233,12 +2294,21 @@ skip_alloc:
 		}
 	} else if (IS_ENABLED(CONFIG_NET_UDP) &&
 	    net_context_get_proto(context) == IPPROTO_UDP) {
-		ret = context_setup_udp_packet(context, family, pkt, buf, len, msghdr,
-					       dst_addr, addrlen);
+		ret = context_setup_udp_packet(context, family, pkt,
+					       frags != NULL ? NULL : buf,
+					       frags != NULL ? 0 : len, msghdr,
+					       dst_addr, addrlen, frags == NULL);
 		if (ret < 0) {
 			goto fail;
 		}
 
+		if (frags != NULL) {
+			/* The packet keeps its own reference to the chain,
+			 * dropped once the driver has sent the packet.
+			 */
+			net_pkt_append_buffer(pkt, net_buf_ref(frags));
+		}
+
 		context_finalize_packet(context, family, pkt);
 
 		ret = net_send_data(pkt);
@@ -2254,7 +2324,7 @@ skip_alloc:
 
 		ret = net_tcp_send_data(context, cb, user_data);
 	} else if (IS_ENABLED(CONFIG_NET_SOCKETS_PACKET) && family == AF_PACKET) {
-		ret = context_write_data(pkt, buf, len, msghdr);
+		ret = context_write_data(pkt, buf, len, msghdr, NULL);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -2284,7 +2354,7 @@ skip_alloc:
 		}
 	} else if (IS_ENABLED(CONFIG_NET_SOCKETS_CAN) && family == AF_CAN &&
 		   net_context_get_proto(context) == CAN_RAW) {
-		ret = context_write_data(pkt, buf, len, msghdr);
+		ret = context_write_data(pkt, buf, len, msghdr, NULL);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -2347,7 +2417,7 @@ int net_context_send(struct net_context *context,
 	}
 
 	ret = context_sendto(context, buf, len, &context->remote,
-			     addrlen, cb, timeout, user_data, false);
+			     addrlen, cb, timeout, user_data, false, NULL);
 unlock:
 	k_mutex_unlock(&context->lock);
 
@@ -2366,7 +2436,7 @@ int net_context_sendmsg(struct net_context *context,
 	k_mutex_lock(&context->lock, K_FOREVER);
 
 	ret = context_sendto(context, msghdr, 0, NULL, 0,
-			     cb, timeout, user_data, true);
+			     cb, timeout, user_data, true, NULL);
 
 	k_mutex_unlock(&context->lock);
 
@@ -2387,8 +2457,45 @@ int net_context_sendto(struct net_context *context,
 	k_mutex_lock(&context->lock, K_FOREVER);
 
 	ret = context_sendto(context, buf, len, dst_addr, addrlen,
-			     cb, timeout, user_data, true);
+			     cb, timeout, user_data, true, NULL);
+
+	k_mutex_unlock(&context->lock);
+
+	return ret;
+}
+
+int net_context_sendto_buf(struct net_context *context,
+			   struct net_buf *buf,
+			   const struct sockaddr *dst_addr,
+			   socklen_t addrlen,
+			   net_context_send_cb_t cb,
+			   k_timeout_t timeout,
+			   void *user_data)
+{
+	int ret;
+
+	if (buf == NULL) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&context->lock, K_FOREVER);
 
+	if (dst_addr == NULL) {
+		if (!(context->flags & NET_CONTEXT_REMOTE_ADDR_SET) ||
+		    !net_sin(&context->remote)->sin_port) {
+			ret = -EDESTADDRREQ;
+			goto unlock;
+		}
+
+		dst_addr = &context->remote;
+		addrlen = IS_ENABLED(CONFIG_NET_IPV6) &&
+			  net_context_get_family(context) == AF_INET6 ?
+			  sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in);
+	}
+
+	ret = context_sendto(context, NULL, 0, dst_addr, addrlen,
+			     cb, timeout, user_data, true, buf);
+unlock:
 	k_mutex_unlock(&context->lock);
 
 	return ret;
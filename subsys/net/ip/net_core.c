@@ -60,7 +60,8 @@ LOG_MODULE_REGISTER(net_core, CONFIG_NET_CORE_LOG_LEVEL);
 #include "net_stats.h"
 
 static inline enum net_verdict process_data(struct net_pkt *pkt,
-					    bool is_loopback)
+					    bool is_loopback,
+					    struct net_gro *gro)
 {
 	int ret;
 	bool locally_routed = false;
@@ -129,6 +130,14 @@ static inline enum net_verdict process_data(struct net_pkt *pkt,
 			return ret;
 		}
 
+		/* Coalesce the TCP segments waiting in the RX queue */
+		if (IS_ENABLED(CONFIG_NET_GRO) && gro != NULL) {
+			ret = net_gro_receive(gro, pkt);
+			if (ret != NET_CONTINUE) {
+				return ret;
+			}
+		}
+
 		/* IP version and header length. */
 		uint8_t vtc_vhl = NET_IPV6_HDR(pkt)->vtc & 0xf0;
 
@@ -150,10 +159,11 @@ static inline enum net_verdict process_data(struct net_pkt *pkt,
 	return NET_DROP;
 }
 
-static void processing_data(struct net_pkt *pkt, bool is_loopback)
+static void processing_data(struct net_pkt *pkt, bool is_loopback,
+			    struct net_gro *gro)
 {
 again:
-	switch (process_data(pkt, is_loopback)) {
+	switch (process_data(pkt, is_loopback, gro)) {
 	case NET_CONTINUE:
 		if (IS_ENABLED(CONFIG_NET_L2_VIRTUAL)) {
 			/* If we have a tunneling packet, feed it back
@@ -407,7 +417,7 @@ int net_send_data(struct net_pkt *pkt)
 		 * to RX processing.
 		 */
 		NET_DBG("Loopback pkt %p back to us", pkt);
-		processing_data(pkt, true);
+		processing_data(pkt, true, NULL);
 		return 0;
 	}
 
@@ -429,7 +439,8 @@ int net_send_data(struct net_pkt *pkt)
 	return 0;
 }
 
-static void net_rx(struct net_if *iface, struct net_pkt *pkt)
+static void net_rx(struct net_if *iface, struct net_pkt *pkt,
+		   struct net_gro *gro)
 {
 	bool is_loopback = false;
 	size_t pkt_len;
@@ -448,19 +459,23 @@ static void net_rx(struct net_if *iface, struct net_pkt *pkt)
 #endif
 	}
 
-	processing_data(pkt, is_loopback);
+	processing_data(pkt, is_loopback, is_loopback ? NULL : gro);
 
 	net_print_statistics();
 	net_pkt_print();
 }
 
-void net_process_rx_packet(struct net_pkt *pkt)
+void net_process_rx_packet(struct net_pkt *pkt, struct net_gro *gro)
 {
 	net_pkt_set_rx_stats_tick(pkt, k_cycle_get_32());
 
+	if (CONFIG_NET_PKT_LINEAR_HEADERS_SIZE > 0) {
+		(void)net_pkt_pull_up(pkt, CONFIG_NET_PKT_LINEAR_HEADERS_SIZE);
+	}
+
 	net_capture_pkt(net_pkt_iface(pkt), pkt);
 
-	net_rx(net_pkt_iface(pkt), pkt);
+	net_rx(net_pkt_iface(pkt), pkt, gro);
 }
 
 static void net_queue_rx(struct net_if *iface, struct net_pkt *pkt)
@@ -479,14 +494,13 @@ static void net_queue_rx(struct net_if *iface, struct net_pkt *pkt)
 #endif
 
 	if (NET_TC_RX_COUNT == 0) {
-		net_process_rx_packet(pkt);
+		net_process_rx_packet(pkt, NULL);
 	} else {
 		net_tc_submit_to_rx_queue(tc, pkt);
 	}
 }
 
-/* Called by driver when a packet has been received */
-int net_recv_data(struct net_if *iface, struct net_pkt *pkt)
+static int net_recv_check(struct net_if *iface, struct net_pkt *pkt)
 {
 	if (!pkt || !iface) {
 		return -EINVAL;
@@ -512,6 +526,19 @@ int net_recv_data(struct net_if *iface, struct net_pkt *pkt)
 
 	net_pkt_set_iface(pkt, iface);
 
+	return 0;
+}
+
+/* Called by driver when a packet has been received */
+int net_recv_data(struct net_if *iface, struct net_pkt *pkt)
+{
+	int ret;
+
+	ret = net_recv_check(iface, pkt);
+	if (ret < 0) {
+		return ret;
+	}
+
 	if (!net_pkt_filter_recv_ok(pkt)) {
 		/* silently drop the packet */
 		net_pkt_unref(pkt);
@@ -522,6 +549,63 @@ int net_recv_data(struct net_if *iface, struct net_pkt *pkt)
 	return 0;
 }
 
+/* Called by driver when a batch of packets has been received */
+int net_recv_data_batch(struct net_if *iface, sys_slist_t *pkts)
+{
+#if NET_TC_RX_COUNT > 0
+	sys_slist_t tc_list[NET_TC_RX_COUNT];
+#endif
+	struct net_pkt *pkt;
+	int queued = 0;
+
+	if (!pkts) {
+		return -EINVAL;
+	}
+
+#if NET_TC_RX_COUNT > 0
+	for (int i = 0; i < NET_TC_RX_COUNT; i++) {
+		sys_slist_init(&tc_list[i]);
+	}
+#endif
+
+	while ((pkt = net_pkt_list_get(pkts)) != NULL) {
+		struct net_if *pkt_iface = iface != NULL ? iface : net_pkt_iface(pkt);
+
+		if (net_recv_check(pkt_iface, pkt) < 0 || !net_pkt_filter_recv_ok(pkt)) {
+			net_pkt_unref(pkt);
+			continue;
+		}
+
+		queued++;
+
+#if NET_TC_RX_COUNT > 0
+		uint8_t prio = net_pkt_priority(pkt);
+		uint8_t tc = net_rx_priority2tc(prio);
+
+#if defined(CONFIG_NET_STATISTICS)
+		net_stats_update_tc_recv_pkt(pkt_iface, tc);
+		net_stats_update_tc_recv_bytes(pkt_iface, tc, net_pkt_get_len(pkt));
+		net_stats_update_tc_recv_priority(pkt_iface, tc, prio);
+#endif
+
+		net_pkt_list_append(&tc_list[tc], pkt);
+#else
+		net_queue_rx(pkt_iface, pkt);
+#endif
+	}
+
+#if NET_TC_RX_COUNT > 0
+	/* One queue operation, and at most one wakeup, per traffic class */
+	for (int i = 0; i < NET_TC_RX_COUNT; i++) {
+		if (!sys_slist_is_empty(&tc_list[i])) {
+			net_tc_submit_list_to_rx_queue(i, &tc_list[i]);
+		}
+	}
+#endif
+
+	return queued;
+}
+
 static inline void l3_init(void)
 {
 	net_icmpv4_init();
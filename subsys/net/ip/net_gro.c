@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Generic receive offload (GRO) for TCP.
+ *
+ * Every RX traffic class thread holds back the last in-order TCP segment it
+ * has seen. The segments of the same flow that follow it in the RX queue are
+ * appended to it, stripped of their IP and TCP headers, so the IP and TCP
+ * input run once for the whole burst. Anything that does not fit in, and the
+ * RX queue running empty, hands the held packet over to IP.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_core, CONFIG_NET_CORE_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <string.h>
+
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "net_private.h"
+
+#define GRO_TCP_PSH BIT(3)
+#define GRO_TCP_ACK BIT(4)
+
+struct gro_seg {
+	uint8_t *ip;
+	struct net_tcp_hdr *tcp;
+	uint16_t ip_hdr_len;
+	uint16_t tcp_hdr_len;
+	uint16_t data_len;
+	uint32_t seq;
+};
+
+/* Check that the packet is a plain TCP data segment with both headers in
+ * the first fragment, and locate them.
+ */
+static bool gro_parse(struct net_pkt *pkt, struct gro_seg *seg)
+{
+	struct net_buf *frag = pkt->frags;
+	size_t pkt_len = net_pkt_get_len(pkt);
+	size_t hdrs_len;
+
+	if (frag == NULL || net_pkt_is_ip_reassembled(pkt)) {
+		return false;
+	}
+
+	seg->ip = frag->data;
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		struct net_ipv4_hdr *hdr = (struct net_ipv4_hdr *)seg->ip;
+
+		/* No options, no fragments and no link layer padding */
+		if (frag->len < sizeof(*hdr) || hdr->vhl != 0x45 ||
+		    hdr->proto != IPPROTO_TCP || (hdr->offset[0] & 0x3f) != 0 ||
+		    hdr->offset[1] != 0 || ntohs(hdr->len) != pkt_len) {
+			return false;
+		}
+
+		seg->ip_hdr_len = sizeof(struct net_ipv4_hdr);
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == AF_INET6) {
+		struct net_ipv6_hdr *hdr = (struct net_ipv6_hdr *)seg->ip;
+
+		/* No extension headers */
+		if (frag->len < sizeof(*hdr) || (hdr->vtc & 0xf0) != 0x60 ||
+		    hdr->nexthdr != IPPROTO_TCP ||
+		    ntohs(hdr->len) + sizeof(*hdr) != pkt_len) {
+			return false;
+		}
+
+		seg->ip_hdr_len = sizeof(struct net_ipv6_hdr);
+	} else {
+		return false;
+	}
+
+	if (frag->len < seg->ip_hdr_len + sizeof(struct net_tcp_hdr)) {
+		return false;
+	}
+
+	seg->tcp = (struct net_tcp_hdr *)(seg->ip + seg->ip_hdr_len);
+	seg->tcp_hdr_len = (seg->tcp->offset >> 4) * 4U;
+	hdrs_len = seg->ip_hdr_len + seg->tcp_hdr_len;
+
+	/* Only ACK and PSH, anything else needs the TCP state machine */
+	if (seg->tcp_hdr_len < sizeof(struct net_tcp_hdr) || frag->len < hdrs_len ||
+	    pkt_len <= hdrs_len || (seg->tcp->flags & ~GRO_TCP_PSH) != GRO_TCP_ACK) {
+		return false;
+	}
+
+	seg->data_len = pkt_len - hdrs_len;
+	seg->seq = sys_get_be32(seg->tcp->seq);
+
+	return true;
+}
+
+static bool gro_same_flow(struct net_pkt *held, struct gro_seg *first,
+			  struct net_pkt *pkt, struct gro_seg *seg)
+{
+	struct net_tcp_hdr *t1 = first->tcp;
+	struct net_tcp_hdr *t2 = seg->tcp;
+
+	if (net_pkt_iface(held) != net_pkt_iface(pkt) ||
+	    net_pkt_family(held) != net_pkt_family(pkt) ||
+	    first->tcp_hdr_len != seg->tcp_hdr_len) {
+		return false;
+	}
+
+	if (net_pkt_family(pkt) == AF_INET) {
+		struct net_ipv4_hdr *h1 = (struct net_ipv4_hdr *)first->ip;
+		struct net_ipv4_hdr *h2 = (struct net_ipv4_hdr *)seg->ip;
+
+		if (h1->tos != h2->tos || h1->ttl != h2->ttl ||
+		    memcmp(h1->src, h2->src, 2 * NET_IPV4_ADDR_SIZE) != 0) {
+			return false;
+		}
+	} else {
+		struct net_ipv6_hdr *h1 = (struct net_ipv6_hdr *)first->ip;
+		struct net_ipv6_hdr *h2 = (struct net_ipv6_hdr *)seg->ip;
+
+		/* Version, traffic class and flow label */
+		if (memcmp(h1, h2, 4) != 0 || h1->hop_limit != h2->hop_limit ||
+		    memcmp(h1->src, h2->src, 2 * NET_IPV6_ADDR_SIZE) != 0) {
+			return false;
+		}
+	}
+
+	/* Same ports, acknowledgment, window and flags apart from PSH */
+	if (t1->src_port != t2->src_port || t1->dst_port != t2->dst_port ||
+	    memcmp(t1->ack, t2->ack, sizeof(t1->ack)) != 0 ||
+	    memcmp(t1->wnd, t2->wnd, sizeof(t1->wnd)) != 0 ||
+	    ((t1->flags ^ t2->flags) & ~GRO_TCP_PSH) != 0) {
+		return false;
+	}
+
+	return memcmp(t1->optdata, t2->optdata,
+		      seg->tcp_hdr_len - sizeof(struct net_tcp_hdr)) == 0;
+}
+
+/* The merged packet carries a single TCP checksum, so every segment is
+ * verified before it is coalesced. TCP skips the check for GRO packets.
+ */
+static bool gro_chksum_ok(struct net_pkt *pkt, struct gro_seg *seg)
+{
+	enum net_if_checksum_type type = net_pkt_family(pkt) == AF_INET6 ?
+		NET_IF_CHECKSUM_IPV6_TCP : NET_IF_CHECKSUM_IPV4_TCP;
+
+	if (!IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) ||
+	    !net_if_need_calc_rx_checksum(net_pkt_iface(pkt), type)) {
+		return true;
+	}
+
+	net_pkt_set_ip_hdr_len(pkt, seg->ip_hdr_len);
+
+	return net_calc_chksum_tcp(pkt) == 0U;
+}
+
+static bool gro_merge(struct net_gro *gro, struct net_pkt *pkt, struct gro_seg *seg)
+{
+	struct net_pkt *held = gro->pkt;
+	uint8_t psh = seg->tcp->flags & GRO_TCP_PSH;
+	struct gro_seg first;
+	struct net_buf *frag;
+	size_t total_len;
+
+	if (!gro_parse(held, &first)) {
+		return false;
+	}
+
+	total_len = first.ip_hdr_len + first.tcp_hdr_len + (gro->next_seq - first.seq) +
+		    seg->data_len;
+
+	if (seg->seq != gro->next_seq || total_len > CONFIG_NET_GRO_MAX_SIZE ||
+	    !gro_same_flow(held, &first, pkt, seg)) {
+		return false;
+	}
+
+	if ((!net_pkt_is_gro(held) && !gro_chksum_ok(held, &first)) ||
+	    !gro_chksum_ok(pkt, seg)) {
+		return false;
+	}
+
+	/* Strip the headers and chain the payload to the held packet */
+	frag = pkt->frags;
+	net_buf_pull(frag, seg->ip_hdr_len + seg->tcp_hdr_len);
+	if (frag->len == 0U) {
+		frag = net_buf_frag_del(NULL, frag);
+	}
+
+	pkt->frags = NULL;
+	net_pkt_append_buffer(held, frag);
+	net_pkt_unref(pkt);
+
+	if (net_pkt_family(held) == AF_INET) {
+		((struct net_ipv4_hdr *)first.ip)->len = htons(total_len);
+	} else {
+		((struct net_ipv6_hdr *)first.ip)->len =
+			htons(total_len - sizeof(struct net_ipv6_hdr));
+	}
+
+	first.tcp->flags |= psh;
+	gro->next_seq += seg->data_len;
+	net_pkt_set_gro(held, true);
+
+	return true;
+}
+
+void net_gro_flush(struct net_gro *gro)
+{
+	struct net_pkt *pkt = gro->pkt;
+
+	if (pkt == NULL) {
+		return;
+	}
+
+	gro->pkt = NULL;
+
+#if defined(CONFIG_NET_IPV4)
+	if (net_pkt_is_gro(pkt) && net_pkt_family(pkt) == AF_INET &&
+	    net_if_need_calc_rx_checksum(net_pkt_iface(pkt), NET_IF_CHECKSUM_IPV4_HEADER)) {
+		struct net_ipv4_hdr *hdr = (struct net_ipv4_hdr *)pkt->frags->data;
+
+		/* The length changed, so has the header checksum */
+		net_pkt_set_ip_hdr_len(pkt, sizeof(struct net_ipv4_hdr));
+		hdr->chksum = 0U;
+		hdr->chksum = net_calc_chksum_ipv4(pkt);
+	}
+#endif /* CONFIG_NET_IPV4 */
+
+	NET_DBG("GRO pkt %p len %zu", pkt, net_pkt_get_len(pkt));
+
+	net_pkt_cursor_init(pkt);
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == AF_INET6) {
+		if (net_ipv6_input(pkt, false) == NET_OK) {
+			return;
+		}
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		if (net_ipv4_input(pkt, false) == NET_OK) {
+			return;
+		}
+	}
+
+	net_pkt_unref(pkt);
+}
+
+enum net_verdict net_gro_receive(struct net_gro *gro, struct net_pkt *pkt)
+{
+	struct gro_seg seg;
+
+	if (!gro_parse(pkt, &seg)) {
+		/* Keep the packet order, whatever flow this one belongs to */
+		net_gro_flush(gro);
+		return NET_CONTINUE;
+	}
+
+	if (gro->pkt != NULL) {
+		bool psh = seg.tcp->flags & GRO_TCP_PSH;
+
+		if (gro_merge(gro, pkt, &seg)) {
+			if (psh) {
+				/* The sender wants the data delivered now */
+				net_gro_flush(gro);
+			}
+
+			return NET_OK;
+		}
+
+		net_gro_flush(gro);
+	}
+
+	if (seg.tcp->flags & GRO_TCP_PSH) {
+		return NET_CONTINUE;
+	}
+
+	gro->pkt = pkt;
+	gro->next_seq = seg.seq + seg.data_len;
+
+	return NET_OK;
+}
@@ -47,19 +47,55 @@ K_KERNEL_STACK_DEFINE(mgmt_stack, CONFIG_NET_MGMT_EVENT_STACK_SIZE);
 static struct k_work_q mgmt_work_q_obj;
 #endif
 
+#define CALLBACK_BUCKETS CONFIG_NET_MGMT_EVENT_CALLBACK_BUCKETS
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CALLBACK_BUCKETS),
+	     "The number of callback buckets must be a power of two");
+
 static uint32_t global_event_mask;
-static sys_slist_t event_callbacks = SYS_SLIST_STATIC_INIT(&event_callbacks);
+
+/* The callbacks are hashed by layer and layer code, which an event must
+ * match exactly, so only one list is walked per event. Zero initialized
+ * lists are empty.
+ */
+static sys_slist_t event_callbacks[CALLBACK_BUCKETS];
+
+#if defined(CONFIG_NET_MGMT_EVENT_QUEUE)
+/* Callbacks run by the notifier, see net_mgmt_add_event_callback_direct() */
+static sys_slist_t direct_callbacks[CALLBACK_BUCKETS];
+#endif
+
+static inline sys_slist_t *mgmt_callback_list(sys_slist_t *table, uint32_t event)
+{
+	uint32_t key = (event & (NET_MGMT_LAYER_MASK | NET_MGMT_LAYER_CODE_MASK)) >> 16;
+
+	return &table[(key ^ (key >> 4) ^ (key >> 8)) & (CALLBACK_BUCKETS - 1)];
+}
 
 /* Forward declaration for the actual caller */
 static void mgmt_run_callbacks(const struct mgmt_event_entry * const mgmt_event);
 
 #if defined(CONFIG_NET_MGMT_EVENT_QUEUE)
 
-static K_MUTEX_DEFINE(net_mgmt_event_lock);
-/* event structure used to prevent increasing the stack usage on the caller thread */
-static struct mgmt_event_entry new_event;
-K_MSGQ_DEFINE(event_msgq, sizeof(struct mgmt_event_entry),
-	      CONFIG_NET_MGMT_EVENT_QUEUE_SIZE, sizeof(uint32_t));
+/* Events are written in place in a ring, without copy nor lock: notifiers
+ * reserve a free slot, claim the next one and mark it ready once filled.
+ * The single worker handles the ready slots in order, directly from the
+ * ring, and frees them.
+ */
+struct mgmt_event_slot {
+	struct mgmt_event_entry entry;
+	atomic_t ready;
+};
+
+static struct mgmt_event_slot event_ring[CONFIG_NET_MGMT_EVENT_QUEUE_SIZE];
+static atomic_t event_ring_head;
+/* Only accessed by the worker */
+static uint32_t event_ring_tail;
+static K_SEM_DEFINE(event_ring_free, CONFIG_NET_MGMT_EVENT_QUEUE_SIZE,
+		    CONFIG_NET_MGMT_EVENT_QUEUE_SIZE);
+
+static void mgmt_run_direct_callbacks(uint32_t mgmt_event, struct net_if *iface,
+				      const void *info, size_t length);
 
 static struct k_work_q *mgmt_work_q = COND_CODE_1(CONFIG_NET_MGMT_EVENT_SYSTEM_WORKQUEUE,
 	(&k_sys_work_q), (&mgmt_work_q_obj));
@@ -70,56 +106,74 @@ static K_WORK_DEFINE(mgmt_work, mgmt_event_work_handler);
 static inline void mgmt_push_event(uint32_t mgmt_event, struct net_if *iface,
 				   const void *info, size_t length)
 {
-#ifndef CONFIG_NET_MGMT_EVENT_INFO
-	ARG_UNUSED(info);
-	ARG_UNUSED(length);
-#endif /* CONFIG_NET_MGMT_EVENT_INFO */
-
-	(void)k_mutex_lock(&net_mgmt_event_lock, K_FOREVER);
-
-	memset(&new_event, 0, sizeof(struct mgmt_event_entry));
+	struct mgmt_event_slot *slot;
+	atomic_val_t head;
 
 #ifdef CONFIG_NET_MGMT_EVENT_INFO
-	if (info && length) {
-		if (length <= NET_EVENT_INFO_MAX_SIZE) {
-			memcpy(new_event.info, info, length);
-			new_event.info_length = length;
-		} else {
-			NET_ERR("Event %u info length %zu > max size %zu",
-				mgmt_event, length, NET_EVENT_INFO_MAX_SIZE);
-			(void)k_mutex_unlock(&net_mgmt_event_lock);
+	if (info && length > NET_EVENT_INFO_MAX_SIZE) {
+		NET_ERR("Event %u info length %zu > max size %zu",
+			mgmt_event, length, NET_EVENT_INFO_MAX_SIZE);
 
-			return;
-		}
+		return;
 	}
 #endif /* CONFIG_NET_MGMT_EVENT_INFO */
 
-	new_event.event = mgmt_event;
-	new_event.iface = iface;
+	mgmt_run_direct_callbacks(mgmt_event, iface, info, length);
 
-	if (k_msgq_put(&event_msgq, &new_event,
-		K_MSEC(CONFIG_NET_MGMT_EVENT_QUEUE_TIMEOUT)) != 0) {
+	if (k_sem_take(&event_ring_free,
+		       K_MSEC(CONFIG_NET_MGMT_EVENT_QUEUE_TIMEOUT)) != 0) {
 		NET_WARN("Failure to push event (%u), "
 			 "try increasing the 'CONFIG_NET_MGMT_EVENT_QUEUE_SIZE' "
 			 "or 'CONFIG_NET_MGMT_EVENT_QUEUE_TIMEOUT' options.",
 			 mgmt_event);
+		return;
+	}
+
+	do {
+		head = atomic_get(&event_ring_head);
+	} while (!atomic_cas(&event_ring_head, head,
+			     (head + 1) % CONFIG_NET_MGMT_EVENT_QUEUE_SIZE));
+
+	slot = &event_ring[head];
+
+#ifdef CONFIG_NET_MGMT_EVENT_INFO
+	if (info && length) {
+		memcpy(slot->entry.info, info, length);
+		slot->entry.info_length = length;
+	} else {
+		slot->entry.info_length = 0;
 	}
+#else
+	ARG_UNUSED(info);
+	ARG_UNUSED(length);
+#endif /* CONFIG_NET_MGMT_EVENT_INFO */
+
+	slot->entry.event = mgmt_event;
+	slot->entry.iface = iface;
 
-	(void)k_mutex_unlock(&net_mgmt_event_lock);
+	atomic_set(&slot->ready, 1);
 
 	k_work_submit_to_queue(mgmt_work_q, &mgmt_work);
 }
 
 static void mgmt_event_work_handler(struct k_work *work)
 {
-	struct mgmt_event_entry mgmt_event;
+	struct mgmt_event_slot *slot = &event_ring[event_ring_tail];
 
 	ARG_UNUSED(work);
 
-	while (k_msgq_get(&event_msgq, &mgmt_event, K_FOREVER) == 0) {
+	/* A slot claimed but not filled yet stops the loop, its notifier
+	 * submits the work again once done.
+	 */
+	while (atomic_get(&slot->ready) != 0) {
 		NET_DBG("Handling events, forwarding it relevantly");
 
-		mgmt_run_callbacks(&mgmt_event);
+		mgmt_run_callbacks(&slot->entry);
+
+		atomic_clear(&slot->ready);
+		event_ring_tail = (event_ring_tail + 1) % CONFIG_NET_MGMT_EVENT_QUEUE_SIZE;
+		slot = &event_ring[event_ring_tail];
+		k_sem_give(&event_ring_free);
 
 		/* forcefully give up our timeslot, to give time to the callback */
 		k_yield();
@@ -148,19 +202,38 @@ static inline void mgmt_add_event_mask(uint32_t event_mask)
 	global_event_mask |= event_mask;
 }
 
-static inline void mgmt_rebuild_global_event_mask(void)
+static inline void mgmt_add_table_event_mask(sys_slist_t *table)
 {
 	struct net_mgmt_event_callback *cb, *tmp;
 
+	for (int i = 0; i < CALLBACK_BUCKETS; i++) {
+		SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&table[i], cb, tmp, node) {
+			mgmt_add_event_mask(cb->event_mask);
+		}
+	}
+}
+
+static inline void mgmt_rebuild_global_event_mask(void)
+{
 	global_event_mask = 0U;
 
 	STRUCT_SECTION_FOREACH(net_mgmt_event_static_handler, it) {
 		mgmt_add_event_mask(it->event_mask);
 	}
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&event_callbacks, cb, tmp, node) {
-		mgmt_add_event_mask(cb->event_mask);
-	}
+	mgmt_add_table_event_mask(event_callbacks);
+#if defined(CONFIG_NET_MGMT_EVENT_QUEUE)
+	mgmt_add_table_event_mask(direct_callbacks);
+#endif
+}
+
+/* Layer and layer code must match exactly, command being a mask */
+static inline bool mgmt_event_matches(uint32_t mgmt_event, uint32_t event_mask)
+{
+	return NET_MGMT_GET_LAYER(mgmt_event) == NET_MGMT_GET_LAYER(event_mask) &&
+	       NET_MGMT_GET_LAYER_CODE(mgmt_event) == NET_MGMT_GET_LAYER_CODE(event_mask) &&
+	       (!NET_MGMT_GET_COMMAND(mgmt_event) || !NET_MGMT_GET_COMMAND(event_mask) ||
+		(NET_MGMT_GET_COMMAND(mgmt_event) & NET_MGMT_GET_COMMAND(event_mask)));
 }
 
 static inline bool mgmt_is_event_handled(uint32_t mgmt_event)
@@ -178,6 +251,7 @@ static inline bool mgmt_is_event_handled(uint32_t mgmt_event)
 
 static inline void mgmt_run_slist_callbacks(const struct mgmt_event_entry * const mgmt_event)
 {
+	sys_slist_t *list = mgmt_callback_list(event_callbacks, mgmt_event->event);
 	sys_snode_t *prev = NULL;
 	struct net_mgmt_event_callback *cb, *tmp;
 
@@ -187,15 +261,9 @@ static inline void mgmt_run_slist_callbacks(const struct mgmt_event_entry * cons
 		NET_MGMT_GET_LAYER_CODE(mgmt_event->event),
 		NET_MGMT_GET_COMMAND(mgmt_event->event));
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&event_callbacks, cb, tmp, node) {
-		if (!(NET_MGMT_GET_LAYER(mgmt_event->event) ==
-		      NET_MGMT_GET_LAYER(cb->event_mask)) ||
-		    !(NET_MGMT_GET_LAYER_CODE(mgmt_event->event) ==
-		      NET_MGMT_GET_LAYER_CODE(cb->event_mask)) ||
-		    (NET_MGMT_GET_COMMAND(mgmt_event->event) &&
-		     NET_MGMT_GET_COMMAND(cb->event_mask) &&
-		     !(NET_MGMT_GET_COMMAND(mgmt_event->event) &
-		       NET_MGMT_GET_COMMAND(cb->event_mask)))) {
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(list, cb, tmp, node) {
+		if (!mgmt_event_matches(mgmt_event->event, cb->event_mask)) {
+			prev = &cb->node;
 			continue;
 		}
 
@@ -216,6 +284,7 @@ static inline void mgmt_run_slist_callbacks(const struct mgmt_event_entry * cons
 
 			if (sync_data->iface &&
 			    sync_data->iface != mgmt_event->iface) {
+				prev = &cb->node;
 				continue;
 			}
 
@@ -224,7 +293,7 @@ static inline void mgmt_run_slist_callbacks(const struct mgmt_event_entry * cons
 			cb->raised_event = mgmt_event->event;
 			sync_data->iface = mgmt_event->iface;
 
-			sys_slist_remove(&event_callbacks, prev, &cb->node);
+			sys_slist_remove(list, prev, &cb->node);
 
 			k_sem_give(cb->sync_call);
 		} else {
@@ -244,14 +313,7 @@ static inline void mgmt_run_slist_callbacks(const struct mgmt_event_entry * cons
 static inline void mgmt_run_static_callbacks(const struct mgmt_event_entry * const mgmt_event)
 {
 	STRUCT_SECTION_FOREACH(net_mgmt_event_static_handler, it) {
-		if (!(NET_MGMT_GET_LAYER(mgmt_event->event) ==
-		      NET_MGMT_GET_LAYER(it->event_mask)) ||
-		    !(NET_MGMT_GET_LAYER_CODE(mgmt_event->event) ==
-		      NET_MGMT_GET_LAYER_CODE(it->event_mask)) ||
-		    (NET_MGMT_GET_COMMAND(mgmt_event->event) &&
-		     NET_MGMT_GET_COMMAND(it->event_mask) &&
-		     !(NET_MGMT_GET_COMMAND(mgmt_event->event) &
-		       NET_MGMT_GET_COMMAND(it->event_mask)))) {
+		if (!mgmt_event_matches(mgmt_event->event, it->event_mask)) {
 			continue;
 		}
 
@@ -276,6 +338,72 @@ static void mgmt_run_callbacks(const struct mgmt_event_entry * const mgmt_event)
 	(void)k_mutex_unlock(&net_mgmt_callback_lock);
 }
 
+#if defined(CONFIG_NET_MGMT_EVENT_QUEUE)
+static void mgmt_run_direct_callbacks(uint32_t mgmt_event, struct net_if *iface,
+				      const void *info, size_t length)
+{
+	sys_slist_t *list = mgmt_callback_list(direct_callbacks, mgmt_event);
+	struct net_mgmt_event_callback *cb, *tmp;
+
+	if (sys_slist_is_empty(list)) {
+		return;
+	}
+
+	(void)k_mutex_lock(&net_mgmt_callback_lock, K_FOREVER);
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(list, cb, tmp, node) {
+		if (!mgmt_event_matches(mgmt_event, cb->event_mask)) {
+			continue;
+		}
+
+#ifdef CONFIG_NET_MGMT_EVENT_INFO
+		/* The info of the notifier is given as is, nothing is copied */
+		if (info && length) {
+			cb->info = info;
+			cb->info_length = length;
+		} else {
+			cb->info = NULL;
+			cb->info_length = 0;
+		}
+#else
+		ARG_UNUSED(info);
+		ARG_UNUSED(length);
+#endif /* CONFIG_NET_MGMT_EVENT_INFO */
+
+		NET_DBG("Running direct callback %p : %p", cb, cb->handler);
+
+		cb->handler(cb, mgmt_event, iface);
+	}
+
+	(void)k_mutex_unlock(&net_mgmt_callback_lock);
+}
+#endif /* CONFIG_NET_MGMT_EVENT_QUEUE */
+
+static void mgmt_remove_callback(struct net_mgmt_event_callback *cb)
+{
+	/* The event mask of the callback may have changed since it was added */
+	for (int i = 0; i < CALLBACK_BUCKETS; i++) {
+		sys_slist_find_and_remove(&event_callbacks[i], &cb->node);
+#if defined(CONFIG_NET_MGMT_EVENT_QUEUE)
+		sys_slist_find_and_remove(&direct_callbacks[i], &cb->node);
+#endif
+	}
+}
+
+static void mgmt_add_callback(sys_slist_t *table, struct net_mgmt_event_callback *cb)
+{
+	(void)k_mutex_lock(&net_mgmt_callback_lock, K_FOREVER);
+
+	/* Remove the callback if it already exists to avoid loop */
+	mgmt_remove_callback(cb);
+
+	sys_slist_prepend(mgmt_callback_list(table, cb->event_mask), &cb->node);
+
+	mgmt_add_event_mask(cb->event_mask);
+
+	(void)k_mutex_unlock(&net_mgmt_callback_lock);
+}
+
 static int mgmt_event_wait_call(struct net_if *iface,
 				uint32_t mgmt_event_mask,
 				uint32_t *raised_event,
@@ -336,16 +464,15 @@ void net_mgmt_add_event_callback(struct net_mgmt_event_callback *cb)
 {
 	NET_DBG("Adding event callback %p", cb);
 
-	(void)k_mutex_lock(&net_mgmt_callback_lock, K_FOREVER);
-
-	/* Remove the callback if it already exists to avoid loop */
-	sys_slist_find_and_remove(&event_callbacks, &cb->node);
-
-	sys_slist_prepend(&event_callbacks, &cb->node);
+	mgmt_add_callback(event_callbacks, cb);
+}
 
-	mgmt_add_event_mask(cb->event_mask);
+void net_mgmt_add_event_callback_direct(struct net_mgmt_event_callback *cb)
+{
+	NET_DBG("Adding direct event callback %p", cb);
 
-	(void)k_mutex_unlock(&net_mgmt_callback_lock);
+	mgmt_add_callback(COND_CODE_1(CONFIG_NET_MGMT_EVENT_QUEUE,
+				      (direct_callbacks), (event_callbacks)), cb);
 }
 
 void net_mgmt_del_event_callback(struct net_mgmt_event_callback *cb)
@@ -354,7 +481,7 @@ void net_mgmt_del_event_callback(struct net_mgmt_event_callback *cb)
 
 	(void)k_mutex_lock(&net_mgmt_callback_lock, K_FOREVER);
 
-	sys_slist_find_and_remove(&event_callbacks, &cb->node);
+	mgmt_remove_callback(cb);
 
 	mgmt_rebuild_global_event_mask();
 
@@ -1067,6 +1067,18 @@ size_t net_pkt_available_payload_buffer(struct net_pkt *pkt,
 	return len;
 }
 
+size_t net_pkt_payload_len_limit(struct net_pkt *pkt, size_t size,
+				 enum net_ip_protocol proto)
+{
+	size_t hdr_len;
+	size_t max_len;
+
+	hdr_len = pkt_estimate_headers_length(pkt, net_pkt_family(pkt), proto);
+	max_len = pkt_buffer_length(pkt, size + hdr_len, proto, 0);
+
+	return max_len > hdr_len ? max_len - hdr_len : 0;
+}
+
 void net_pkt_trim_buffer(struct net_pkt *pkt)
 {
 	struct net_buf *buf, *prev;
@@ -1750,6 +1762,63 @@ int net_pkt_write(struct net_pkt *pkt, const void *data, size_t length)
 	return net_pkt_cursor_operate(pkt, (void *)data, length, true, true);
 }
 
+#if defined(CONFIG_NET_UDP_CHECKSUM_COPY)
+int net_pkt_write_chksum(struct net_pkt *pkt, const void *data, size_t length,
+			 size_t offset, uint16_t *sum)
+{
+	struct net_pkt_cursor *c_op = &pkt->cursor;
+	const uint8_t *src = data;
+
+	NET_DBG("pkt %p data %p length %zu", pkt, data, length);
+
+	while (c_op->buf && length) {
+		size_t d_len, len;
+
+		pkt_cursor_advance(pkt, !net_pkt_is_being_overwritten(pkt));
+		if (c_op->buf == NULL) {
+			break;
+		}
+
+		if (net_pkt_is_being_overwritten(pkt)) {
+			d_len = c_op->buf->len - (c_op->pos - c_op->buf->data);
+		} else {
+			d_len = net_buf_max_len(c_op->buf) -
+				(c_op->pos - c_op->buf->data);
+		}
+
+		if (!d_len) {
+			break;
+		}
+
+		len = MIN(length, d_len);
+
+		/* Data at an odd offset is summed with its bytes swapped */
+		if (offset % 2) {
+			*sum = BSWAP_16(calc_chksum_copy(BSWAP_16(*sum), c_op->pos, src, len));
+		} else {
+			*sum = calc_chksum_copy(*sum, c_op->pos, src, len);
+		}
+
+		if (!net_pkt_is_being_overwritten(pkt)) {
+			net_buf_add(c_op->buf, len);
+		}
+
+		pkt_cursor_update(pkt, len, true);
+
+		src += len;
+		offset += len;
+		length -= len;
+	}
+
+	if (length) {
+		NET_DBG("Still some length to go %zu", length);
+		return -ENOBUFS;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_NET_UDP_CHECKSUM_COPY */
+
 int net_pkt_copy(struct net_pkt *pkt_dst,
 		 struct net_pkt *pkt_src,
 		 size_t length)
@@ -1876,6 +1945,7 @@ static void clone_pkt_attributes(struct net_pkt *pkt, struct net_pkt *clone_pkt)
 	net_pkt_set_rx_timestamping(clone_pkt, net_pkt_is_rx_timestamping(pkt));
 	net_pkt_set_forwarding(clone_pkt, net_pkt_forwarding(pkt));
 	net_pkt_set_chksum_done(clone_pkt, net_pkt_is_chksum_done(pkt));
+	net_pkt_set_gso_size(clone_pkt, net_pkt_gso_size(pkt));
 	net_pkt_set_ip_reassembled(pkt, net_pkt_is_ip_reassembled(pkt));
 
 	net_pkt_set_l2_bridged(clone_pkt, net_pkt_is_l2_bridged(pkt));
@@ -2044,6 +2114,41 @@ int net_pkt_update_length(struct net_pkt *pkt, size_t length)
 	return !length ? 0 : -EINVAL;
 }
 
+int net_pkt_pull_up(struct net_pkt *pkt, size_t length)
+{
+	struct net_buf *first = pkt->buffer;
+
+	if (!first) {
+		return -ENOBUFS;
+	}
+
+	length = MIN(length, net_pkt_get_len(pkt));
+	if (first->len >= length) {
+		return 0;
+	}
+
+	if (length - first->len > net_buf_tailroom(first)) {
+		NET_DBG("pkt %p first fragment too small for %zu bytes", pkt, length);
+		return -ENOBUFS;
+	}
+
+	while (first->len < length) {
+		struct net_buf *frag = first->frags;
+		size_t len = MIN(length - first->len, frag->len);
+
+		net_buf_add_mem(first, frag->data, len);
+		net_buf_pull(frag, len);
+
+		if (!frag->len) {
+			net_buf_frag_del(first, frag);
+		}
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	return 0;
+}
+
 int net_pkt_pull(struct net_pkt *pkt, size_t length)
 {
 	struct net_pkt_cursor *c_op = &pkt->cursor;
@@ -2141,8 +2246,8 @@ size_t net_pkt_get_contiguous_len(struct net_pkt *pkt)
 	return 0;
 }
 
-void *net_pkt_get_data(struct net_pkt *pkt,
-		       struct net_pkt_data_access *access)
+void *net_pkt_get_data_slow(struct net_pkt *pkt,
+			    struct net_pkt_data_access *access)
 {
 	if (IS_ENABLED(CONFIG_NET_HEADERS_ALWAYS_CONTIGUOUS)) {
 		if (!net_pkt_is_contiguous(pkt, access->size)) {
@@ -2178,8 +2283,8 @@ void *net_pkt_get_data(struct net_pkt *pkt,
 	return NULL;
 }
 
-int net_pkt_set_data(struct net_pkt *pkt,
-		     struct net_pkt_data_access *access)
+int net_pkt_set_data_slow(struct net_pkt *pkt,
+			  struct net_pkt_data_access *access)
 {
 	if (IS_ENABLED(CONFIG_NET_HEADERS_ALWAYS_CONTIGUOUS)) {
 		return net_pkt_skip(pkt, access->size);
@@ -59,9 +59,36 @@ extern void net_if_init(void);
 extern void net_if_post_init(void);
 extern void net_if_stats_reset(struct net_if *iface);
 extern void net_if_stats_reset_all(void);
-extern void net_process_rx_packet(struct net_pkt *pkt);
+/* Generic receive offload state of one RX traffic class thread */
+struct net_gro {
+	/* Packet the following segments of the flow are appended to */
+	struct net_pkt *pkt;
+	/* Sequence number the next segment must start with */
+	uint32_t next_seq;
+};
+
+extern void net_process_rx_packet(struct net_pkt *pkt, struct net_gro *gro);
 extern void net_process_tx_packet(struct net_pkt *pkt);
 
+#if defined(CONFIG_NET_GRO)
+extern enum net_verdict net_gro_receive(struct net_gro *gro, struct net_pkt *pkt);
+extern void net_gro_flush(struct net_gro *gro);
+#else
+static inline enum net_verdict net_gro_receive(struct net_gro *gro,
+					       struct net_pkt *pkt)
+{
+	ARG_UNUSED(gro);
+	ARG_UNUSED(pkt);
+
+	return NET_CONTINUE;
+}
+
+static inline void net_gro_flush(struct net_gro *gro)
+{
+	ARG_UNUSED(gro);
+}
+#endif /* CONFIG_NET_GRO */
+
 extern int net_icmp_call_ipv4_handlers(struct net_pkt *pkt,
 				       struct net_ipv4_hdr *ipv4_hdr,
 				       struct net_icmp_hdr *icmp_hdr);
@@ -85,6 +112,9 @@ extern bool net_context_is_reuseport_set(struct net_context *context);
 extern bool net_context_is_v6only_set(struct net_context *context);
 extern bool net_context_is_recv_pktinfo_set(struct net_context *context);
 extern void net_pkt_init(void);
+/* Payload of size bytes, as limited by the MTU when allocating a packet */
+extern size_t net_pkt_payload_len_limit(struct net_pkt *pkt, size_t size,
+					enum net_ip_protocol proto);
 extern void net_tc_tx_init(void);
 extern void net_tc_rx_init(void);
 int net_context_get_local_addr(struct net_context *context,
@@ -164,6 +194,7 @@ static inline enum net_verdict net_ipv6_input(struct net_pkt *pkt,
 #endif
 extern bool net_tc_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt);
 extern void net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt);
+extern void net_tc_submit_list_to_rx_queue(uint8_t tc, sys_slist_t *pkts);
 extern enum net_verdict net_promisc_mode_input(struct net_pkt *pkt);
 
 char *net_sprint_addr(sa_family_t af, const void *addr);
@@ -247,8 +278,18 @@ extern char *net_byte_to_hex(char *ptr, uint8_t byte, char base, bool pad);
 extern char *net_sprint_ll_addr_buf(const uint8_t *ll, uint8_t ll_len,
 				    char *buf, int buflen);
 extern uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len);
+extern uint16_t calc_chksum_copy(uint16_t sum_in, uint8_t *dst, const uint8_t *src,
+				 size_t len);
 extern uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto);
 
+#if defined(CONFIG_NET_UDP_CHECKSUM_COPY)
+/* Write data to the packet like net_pkt_write() and add its checksum to sum,
+ * offset being where the data starts in the checksummed area.
+ */
+int net_pkt_write_chksum(struct net_pkt *pkt, const void *data, size_t length,
+			 size_t offset, uint16_t *sum);
+#endif
+
 /**
  * @brief Deliver the incoming packet through the recv_cb of the net_context
  *        to the upper layers
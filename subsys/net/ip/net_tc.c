@@ -38,6 +38,13 @@ static struct net_traffic_class tx_classes[NET_TC_TX_COUNT];
 
 #if NET_TC_RX_COUNT > 0
 static struct net_traffic_class rx_classes[NET_TC_RX_COUNT];
+
+#if defined(CONFIG_NET_GRO)
+static struct net_gro rx_gro[NET_TC_RX_COUNT];
+#define RX_GRO(_tc) (&rx_gro[_tc])
+#else
+#define RX_GRO(_tc) NULL
+#endif
 #endif
 
 #if NET_TC_RX_COUNT > 0 || NET_TC_TX_COUNT > 0
@@ -72,6 +79,23 @@ void net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 #endif
 }
 
+void net_tc_submit_list_to_rx_queue(uint8_t tc, sys_slist_t *pkts)
+{
+#if NET_TC_RX_COUNT > 0
+	uint32_t tick = k_cycle_get_32();
+	sys_snode_t *node;
+
+	SYS_SLIST_FOR_EACH_NODE(pkts, node) {
+		net_pkt_set_rx_stats_tick(net_pkt_list_node_to_pkt(node), tick);
+	}
+
+	k_fifo_put_slist(&rx_classes[tc].fifo, pkts);
+#else
+	ARG_UNUSED(tc);
+	ARG_UNUSED(pkts);
+#endif
+}
+
 int net_tx_priority2tc(enum net_priority prio)
 {
 #if NET_TC_TX_COUNT > 0
@@ -242,19 +266,31 @@ static void net_tc_rx_stats_priority_setup(struct net_if *iface,
 #if NET_TC_RX_COUNT > 0
 static void tc_rx_handler(void *p1, void *p2, void *p3)
 {
-	ARG_UNUSED(p2);
 	ARG_UNUSED(p3);
 
 	struct k_fifo *fifo = p1;
+	struct net_gro *gro = p2;
 	struct net_pkt *pkt;
 
 	while (1) {
-		pkt = k_fifo_get(fifo, K_FOREVER);
+		if (IS_ENABLED(CONFIG_NET_GRO)) {
+			pkt = k_fifo_get(fifo, K_NO_WAIT);
+			if (pkt == NULL) {
+				/* Queue drained, pass up what GRO is holding
+				 * before going to sleep.
+				 */
+				net_gro_flush(gro);
+				pkt = k_fifo_get(fifo, K_FOREVER);
+			}
+		} else {
+			pkt = k_fifo_get(fifo, K_FOREVER);
+		}
+
 		if (pkt == NULL) {
 			continue;
 		}
 
-		net_process_rx_packet(pkt);
+		net_process_rx_packet(pkt, gro);
 	}
 }
 #endif
@@ -379,7 +415,7 @@ void net_tc_rx_init(void)
 		tid = k_thread_create(&rx_classes[i].handler, rx_stack[i],
 				      K_KERNEL_STACK_SIZEOF(rx_stack[i]),
 				      tc_rx_handler,
-				      &rx_classes[i].fifo, NULL, NULL,
+				      &rx_classes[i].fifo, RX_GRO(i), NULL,
 				      priority, 0, K_FOREVER);
 		if (!tid) {
 			NET_ERR("Cannot create TC handler thread %d", i);
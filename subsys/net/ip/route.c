@@ -267,15 +267,284 @@ static inline void update_route_access(struct net_route_entry *route)
 	sys_slist_prepend(&routes, &route->node);
 }
 
+#if defined(CONFIG_NET_ROUTE_TRIE)
+/* Path compressed binary trie of the route prefixes. Each node holds a
+ * prefix, the routes with exactly that prefix (one per interface), and
+ * the subtrees for the next bit being 0 or 1. Nodes without routes are only
+ * kept as branching points, so at most 2 * CONFIG_NET_MAX_ROUTES - 1 nodes
+ * are in use.
+ */
+struct route_trie_node {
+	struct in6_addr prefix;
+	struct route_trie_node *parent;
+	struct route_trie_node *child[2];
+	sys_slist_t routes;
+	uint8_t len;
+	bool in_use;
+};
+
+static struct route_trie_node route_trie_nodes[2 * CONFIG_NET_MAX_ROUTES];
+static struct route_trie_node *route_trie_root;
+
+static inline int route_trie_bit(const struct in6_addr *addr, uint8_t bit)
+{
+	return (addr->s6_addr[bit / 8] >> (7 - (bit % 8))) & 1;
+}
+
+/* Number of leading bits, at most max, that a and b have in common */
+static uint8_t route_trie_common_len(const struct in6_addr *a,
+				     const struct in6_addr *b, uint8_t max)
+{
+	uint8_t len = 0U;
+
+	while (len < max) {
+		uint8_t diff = a->s6_addr[len / 8] ^ b->s6_addr[len / 8];
+
+		if (diff == 0U) {
+			len += 8U - (len % 8U);
+			continue;
+		}
+
+		/* Skip the bits of this byte that were already compared */
+		diff <<= len % 8U;
+		while ((diff & 0x80) == 0U) {
+			diff <<= 1;
+			len++;
+		}
+
+		break;
+	}
+
+	return MIN(len, max);
+}
+
+static struct route_trie_node *route_trie_node_new(const struct in6_addr *prefix,
+						   uint8_t len,
+						   struct route_trie_node *parent)
+{
+	struct route_trie_node *node = NULL;
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(route_trie_nodes); i++) {
+		if (!route_trie_nodes[i].in_use) {
+			node = &route_trie_nodes[i];
+			break;
+		}
+	}
+
+	if (node == NULL) {
+		return NULL;
+	}
+
+	memset(node, 0, sizeof(*node));
+	node->in_use = true;
+	node->len = len;
+	node->parent = parent;
+	sys_slist_init(&node->routes);
+
+	/* Only keep the prefix bits */
+	for (i = 0; i < len / 8; i++) {
+		node->prefix.s6_addr[i] = prefix->s6_addr[i];
+	}
+
+	if (len % 8) {
+		node->prefix.s6_addr[i] = prefix->s6_addr[i] &
+					  (uint8_t)(0xff << (8 - len % 8));
+	}
+
+	return node;
+}
+
+static int route_trie_insert(struct net_route_entry *route)
+{
+	struct route_trie_node **link = &route_trie_root;
+	struct route_trie_node *parent = NULL;
+	struct route_trie_node *node, *branch;
+	uint8_t len = route->prefix_len;
+	uint8_t common;
+
+	while (*link != NULL) {
+		node = *link;
+		common = route_trie_common_len(&node->prefix, &route->addr,
+					       MIN(node->len, len));
+
+		if (common == node->len) {
+			if (node->len == len) {
+				goto attach;
+			}
+
+			parent = node;
+			link = &node->child[route_trie_bit(&route->addr, node->len)];
+			continue;
+		}
+
+		/* The prefixes diverge before the end of this node, insert
+		 * a node for their common part above it.
+		 */
+		branch = route_trie_node_new(&route->addr, common, node->parent);
+		if (branch == NULL) {
+			return -ENOMEM;
+		}
+
+		branch->child[route_trie_bit(&node->prefix, common)] = node;
+		node->parent = branch;
+		*link = branch;
+
+		if (common == len) {
+			node = branch;
+			goto attach;
+		}
+
+		parent = branch;
+		link = &branch->child[route_trie_bit(&route->addr, common)];
+		break;
+	}
+
+	node = route_trie_node_new(&route->addr, len, parent);
+	if (node == NULL) {
+		return -ENOMEM;
+	}
+
+	*link = node;
+
+attach:
+	sys_slist_prepend(&node->routes, &route->trie_node);
+
+	return 0;
+}
+
+static void route_trie_remove(struct net_route_entry *route)
+{
+	struct route_trie_node *node = route_trie_root;
+	struct route_trie_node *parent, *child;
+	struct route_trie_node **link;
+
+	while (node != NULL && node->len < route->prefix_len) {
+		node = node->child[route_trie_bit(&route->addr, node->len)];
+	}
+
+	if (node == NULL || node->len != route->prefix_len ||
+	    !sys_slist_find_and_remove(&node->routes, &route->trie_node)) {
+		return;
+	}
+
+	/* Drop the nodes that are no longer needed for branching */
+	while (node != NULL && sys_slist_is_empty(&node->routes) &&
+	       (node->child[0] == NULL || node->child[1] == NULL)) {
+		parent = node->parent;
+		child = node->child[0] != NULL ? node->child[0] : node->child[1];
+
+		if (parent == NULL) {
+			link = &route_trie_root;
+		} else {
+			link = &parent->child[parent->child[1] == node];
+		}
+
+		*link = child;
+		if (child != NULL) {
+			child->parent = parent;
+		}
+
+		node->in_use = false;
+
+		if (child != NULL) {
+			break;
+		}
+
+		node = parent;
+	}
+}
+
+static struct net_route_entry *route_trie_lookup(struct net_if *iface,
+						 struct in6_addr *dst)
+{
+	struct route_trie_node *node = route_trie_root;
+	struct net_route_entry *route, *found = NULL;
+
+	while (node != NULL &&
+	       route_trie_common_len(&node->prefix, dst, node->len) == node->len) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&node->routes, route, trie_node) {
+			if (iface == NULL || route->iface == iface) {
+				found = route;
+				break;
+			}
+		}
+
+		if (node->len == 128U) {
+			break;
+		}
+
+		node = node->child[route_trie_bit(dst, node->len)];
+	}
+
+	return found;
+}
+#endif /* CONFIG_NET_ROUTE_TRIE */
+
+#if CONFIG_NET_ROUTE_DEST_CACHE_SIZE > 0
+/* Direct mapped cache of the route lookup results. Any change to the
+ * routing table bumps the generation, which invalidates all the entries.
+ */
+struct route_dest_cache_entry {
+	struct in6_addr dst;
+	struct net_if *iface;
+	struct net_route_entry *route;
+	uint32_t generation;
+};
+
+static struct route_dest_cache_entry route_dest_cache[CONFIG_NET_ROUTE_DEST_CACHE_SIZE];
+static uint32_t route_generation = 1U;
+
+static inline void route_dest_cache_invalidate(void)
+{
+	route_generation++;
+
+	if (route_generation == 0U) {
+		/* Never match the entries that were never filled */
+		memset(route_dest_cache, 0, sizeof(route_dest_cache));
+		route_generation = 1U;
+	}
+}
+
+static inline struct route_dest_cache_entry *route_dest_cache_slot(struct in6_addr *dst)
+{
+	uint32_t hash = UNALIGNED_GET(&dst->s6_addr32[2]) ^ UNALIGNED_GET(&dst->s6_addr32[3]);
+
+	hash ^= hash >> 16;
+
+	return &route_dest_cache[hash % CONFIG_NET_ROUTE_DEST_CACHE_SIZE];
+}
+#else
+static inline void route_dest_cache_invalidate(void) { }
+#endif /* CONFIG_NET_ROUTE_DEST_CACHE_SIZE > 0 */
+
 struct net_route_entry *net_route_lookup(struct net_if *iface,
 					 struct in6_addr *dst)
 {
-	struct net_route_entry *route, *found = NULL;
+	struct net_route_entry *found = NULL;
+#if !defined(CONFIG_NET_ROUTE_TRIE)
+	struct net_route_entry *route;
 	uint8_t longest_match = 0U;
 	int i;
+#endif
+#if CONFIG_NET_ROUTE_DEST_CACHE_SIZE > 0
+	struct route_dest_cache_entry *cached;
+#endif
 
 	net_ipv6_nbr_lock();
 
+#if CONFIG_NET_ROUTE_DEST_CACHE_SIZE > 0
+	cached = route_dest_cache_slot(dst);
+	if (cached->generation == route_generation && cached->iface == iface &&
+	    net_ipv6_addr_cmp(&cached->dst, dst)) {
+		found = cached->route;
+		goto done;
+	}
+#endif
+
+#if defined(CONFIG_NET_ROUTE_TRIE)
+	found = route_trie_lookup(iface, dst);
+#else
 	for (i = 0; i < CONFIG_NET_MAX_ROUTES && longest_match < 128; i++) {
 		struct net_nbr *nbr = get_nbr(i);
 
@@ -297,7 +566,16 @@ struct net_route_entry *net_route_lookup(struct net_if *iface,
 			longest_match = route->prefix_len;
 		}
 	}
+#endif /* CONFIG_NET_ROUTE_TRIE */
+
+#if CONFIG_NET_ROUTE_DEST_CACHE_SIZE > 0
+	net_ipaddr_copy(&cached->dst, dst);
+	cached->iface = iface;
+	cached->route = found;
+	cached->generation = route_generation;
 
+done:
+#endif
 	if (found) {
 		net_route_info("Found", found, dst);
 
@@ -455,6 +733,12 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 	sys_slist_init(&route->nexthop);
 	sys_slist_prepend(&route->nexthop, &nexthop_route->node);
 
+#if defined(CONFIG_NET_ROUTE_TRIE)
+	/* Cannot fail, there are enough nodes for every route */
+	(void)route_trie_insert(route);
+#endif
+	route_dest_cache_invalidate();
+
 	net_route_info("Added", route, addr);
 
 #if defined(CONFIG_NET_MGMT_EVENT_INFO)
@@ -588,6 +872,11 @@ int net_route_del(struct net_route_entry *route)
 
 	sys_slist_find_and_remove(&routes, &route->node);
 
+#if defined(CONFIG_NET_ROUTE_TRIE)
+	route_trie_remove(route);
+#endif
+	route_dest_cache_invalidate();
+
 	nbr = net_route_get_nbr(route);
 	if (!nbr) {
 		net_ipv6_nbr_unlock();
@@ -52,6 +52,13 @@ struct net_route_entry {
 	/** List of neighbors that the routes go through. */
 	sys_slist_t nexthop;
 
+#if defined(CONFIG_NET_ROUTE_TRIE)
+	/** Node in the list of routes sharing the same prefix in the
+	 * lookup trie.
+	 */
+	sys_snode_t trie_node;
+#endif
+
 	/** Network interface for the route. */
 	struct net_if *iface;
 
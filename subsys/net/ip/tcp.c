@@ -64,10 +64,6 @@ static int tcp_tx_window =
 #define TCP_RTO_MS (tcp_rto)
 #endif
 
-/* Define the number of MSS sections the congestion window is initialized at */
-#define TCP_CONGESTION_INITIAL_WIN 1
-#define TCP_CONGESTION_INITIAL_SSTHRESH 3
-
 static sys_slist_t tcp_conns = SYS_SLIST_STATIC_INIT(&tcp_conns);
 
 static K_MUTEX_DEFINE(tcp_lock);
@@ -513,32 +509,116 @@ static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
 	tcp_new_reno_log(conn, "pkts_acked");
 }
 
+TCP_CA_DEFINE(reno, tcp_new_reno_init, tcp_new_reno_fast_retransmit,
+	      tcp_new_reno_timeout, tcp_new_reno_dup_ack, tcp_new_reno_pkts_acked);
+
+static const struct tcp_ca_ops *tcp_ca_default = &tcp_ca_reno;
+
+static const struct tcp_ca_ops *tcp_ca_find(const char *name, size_t len)
+{
+	STRUCT_SECTION_FOREACH(tcp_ca_ops, ops) {
+		if (strlen(ops->name) == len && strncmp(ops->name, name, len) == 0) {
+			return ops;
+		}
+	}
+
+	return NULL;
+}
+
+static void tcp_ca_default_init(void)
+{
+	const char *name = CONFIG_NET_TCP_CONGESTION_DEFAULT;
+	const struct tcp_ca_ops *ops;
+
+	ops = tcp_ca_find(name, strlen(name));
+	if (ops == NULL) {
+		NET_WARN("Unknown congestion control \"%s\", using %s",
+			 name, tcp_ca_default->name);
+		return;
+	}
+
+	tcp_ca_default = ops;
+}
+
+static void tcp_ca_select(struct tcp *conn, struct tcp *parent)
+{
+	conn->ca_ops = parent != NULL ? parent->ca_ops : tcp_ca_default;
+}
+
 static void tcp_ca_init(struct tcp *conn)
 {
-	tcp_new_reno_init(conn);
+	conn->ca_ops->init(conn);
 }
 
 static void tcp_ca_fast_retransmit(struct tcp *conn)
 {
-	tcp_new_reno_fast_retransmit(conn);
+	conn->ca_ops->fast_retransmit(conn);
 }
 
 static void tcp_ca_timeout(struct tcp *conn)
 {
-	tcp_new_reno_timeout(conn);
+	conn->ca_ops->timeout(conn);
 }
 
 static void tcp_ca_dup_ack(struct tcp *conn)
 {
-	tcp_new_reno_dup_ack(conn);
+	conn->ca_ops->dup_ack(conn);
 }
 
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len)
 {
-	tcp_new_reno_pkts_acked(conn, acked_len);
+	conn->ca_ops->pkts_acked(conn, acked_len);
+}
+
+static int set_tcp_congestion(struct tcp *conn, const void *value, size_t len)
+{
+	const struct tcp_ca_ops *ops;
+
+	/* Accept the name with or without a terminating NUL */
+	len = strnlen(value, MIN(len, TCP_CA_NAME_MAX));
+
+	ops = tcp_ca_find(value, len);
+	if (ops == NULL) {
+		return -ENOENT;
+	}
+
+	if (ops == conn->ca_ops) {
+		return 0;
+	}
+
+	conn->ca_ops = ops;
+
+	/* The window state of the previous algorithm means nothing to the
+	 * new one, so start over if the connection is already running.
+	 */
+	if (conn->state == TCP_ESTABLISHED || conn->state == TCP_CLOSE_WAIT) {
+		tcp_ca_init(conn);
+	}
+
+	return 0;
+}
+
+static int get_tcp_congestion(struct tcp *conn, void *value, size_t *len)
+{
+	size_t name_len = strlen(conn->ca_ops->name) + 1;
+
+	if ((len == NULL) || (*len == 0)) {
+		return -EINVAL;
+	}
+
+	/* The name is truncated to fit, but always NUL terminated */
+	*len = MIN(*len, name_len);
+	memcpy(value, conn->ca_ops->name, *len - 1);
+	((char *)value)[*len - 1] = '\0';
+
+	return 0;
 }
 #else
 
+static void tcp_ca_default_init(void) { }
+
+static void tcp_ca_select(struct tcp *conn, struct tcp *parent) { }
+
 static void tcp_ca_init(struct tcp *conn) { }
 
 static void tcp_ca_fast_retransmit(struct tcp *conn) { }
@@ -549,8 +629,230 @@ static void tcp_ca_dup_ack(struct tcp *conn) { }
 
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len) { }
 
+static int set_tcp_congestion(struct tcp *conn, const void *value, size_t len)
+{
+	return -ENOPROTOOPT;
+}
+
+static int get_tcp_congestion(struct tcp *conn, void *value, size_t *len)
+{
+	return -ENOPROTOOPT;
+}
+
 #endif
 
+#if defined(CONFIG_NET_TCP_SACK)
+
+static void tcp_sack_negotiate(struct tcp *conn)
+{
+	conn->sack_ok = conn->recv_options.sack_perm_found;
+	conn->sack_cnt = 0;
+
+	NET_DBG("conn: %p SACK %s", conn, conn->sack_ok ? "permitted" : "not permitted");
+}
+
+/* Collect the out-of-order data queued for the application as SACK blocks */
+static int tcp_sack_blocks_get(struct tcp *conn, struct tcp_sack_block *blocks)
+{
+	struct net_buf *buf;
+	int cnt = 0;
+
+	if (conn->queue_recv_data == NULL) {
+		return 0;
+	}
+
+	for (buf = conn->queue_recv_data->buffer; buf != NULL; buf = buf->frags) {
+		uint32_t seq = tcp_get_seq(buf);
+
+		if (buf->len == 0) {
+			continue;
+		}
+
+		if (cnt > 0 && blocks[cnt - 1].end == seq) {
+			blocks[cnt - 1].end += buf->len;
+			continue;
+		}
+
+		if (cnt == NET_TCP_SACK_BLOCKS_MAX) {
+			break;
+		}
+
+		blocks[cnt].start = seq;
+		blocks[cnt].end = seq + buf->len;
+		cnt++;
+	}
+
+	return cnt;
+}
+
+/* Build the SACK related option for an outgoing segment, the option is
+ * padded with NOPs so that its length is a multiple of 4 bytes.
+ */
+static size_t tcp_sack_opt_prepare(struct tcp *conn, uint8_t flags, uint8_t *opt)
+{
+	struct tcp_sack_block blocks[NET_TCP_SACK_BLOCKS_MAX];
+	int cnt;
+
+	if ((flags & SYN) && conn->send_options.mss_found) {
+		/* Only answer with SACK permitted if the peer offered it */
+		if ((flags & ACK) && !conn->sack_ok) {
+			return 0;
+		}
+
+		opt[0] = NET_TCP_NOP_OPT;
+		opt[1] = NET_TCP_NOP_OPT;
+		opt[2] = NET_TCP_SACK_PERM_OPT;
+		opt[3] = NET_TCP_SACK_PERM_SIZE;
+
+		return 4;
+	}
+
+	if (!conn->sack_ok || !(flags & ACK) || (flags & (SYN | RST))) {
+		return 0;
+	}
+
+	cnt = tcp_sack_blocks_get(conn, blocks);
+	if (cnt == 0) {
+		return 0;
+	}
+
+	opt[0] = NET_TCP_NOP_OPT;
+	opt[1] = NET_TCP_NOP_OPT;
+	opt[2] = NET_TCP_SACK_OPT;
+	opt[3] = 2 + cnt * NET_TCP_SACK_BLOCK_SIZE;
+
+	for (int i = 0; i < cnt; i++) {
+		uint8_t *block = opt + 4 + i * NET_TCP_SACK_BLOCK_SIZE;
+
+		UNALIGNED_PUT(htonl(blocks[i].start), (uint32_t *)block);
+		UNALIGNED_PUT(htonl(blocks[i].end), (uint32_t *)(block + 4));
+	}
+
+	return 4 + cnt * NET_TCP_SACK_BLOCK_SIZE;
+}
+
+static void tcp_sack_block_add(struct tcp *conn, struct tcp_sack_block block)
+{
+	struct tcp_sack_block *blocks = conn->sack_blocks;
+	int i = 0;
+
+	/* Absorb the existing blocks that overlap or touch the new one */
+	while (i < conn->sack_cnt) {
+		if (net_tcp_seq_cmp(blocks[i].end, block.start) < 0 ||
+		    net_tcp_seq_cmp(block.end, blocks[i].start) < 0) {
+			i++;
+			continue;
+		}
+
+		if (net_tcp_seq_cmp(blocks[i].start, block.start) < 0) {
+			block.start = blocks[i].start;
+		}
+
+		if (net_tcp_seq_cmp(blocks[i].end, block.end) > 0) {
+			block.end = blocks[i].end;
+		}
+
+		conn->sack_cnt--;
+		memmove(&blocks[i], &blocks[i + 1],
+			(conn->sack_cnt - i) * sizeof(*blocks));
+	}
+
+	for (i = 0; i < conn->sack_cnt; i++) {
+		if (net_tcp_seq_cmp(block.start, blocks[i].start) < 0) {
+			break;
+		}
+	}
+
+	if (conn->sack_cnt == NET_TCP_SACK_BLOCKS_MAX) {
+		/* The lowest holes matter most for recovery, forget the
+		 * highest block.
+		 */
+		if (i == NET_TCP_SACK_BLOCKS_MAX) {
+			return;
+		}
+
+		conn->sack_cnt--;
+	}
+
+	memmove(&blocks[i + 1], &blocks[i], (conn->sack_cnt - i) * sizeof(*blocks));
+	blocks[i] = block;
+	conn->sack_cnt++;
+}
+
+/* Merge the SACK blocks of the received segment into the scoreboard */
+static void tcp_sack_update(struct tcp *conn)
+{
+	uint32_t snd_max = conn->seq + conn->unacked_len;
+
+	if (!conn->sack_ok) {
+		return;
+	}
+
+	for (int i = 0; i < conn->recv_options.sack_cnt; i++) {
+		struct tcp_sack_block block = conn->recv_options.sack[i];
+
+		/* Ignore blocks that are not within the data in flight */
+		if (net_tcp_seq_cmp(block.end, block.start) <= 0 ||
+		    net_tcp_seq_cmp(block.end, conn->seq) <= 0 ||
+		    net_tcp_seq_cmp(block.end, snd_max) > 0) {
+			continue;
+		}
+
+		if (net_tcp_seq_cmp(block.start, conn->seq) < 0) {
+			block.start = conn->seq;
+		}
+
+		tcp_sack_block_add(conn, block);
+	}
+}
+
+/* Drop the scoreboard entries covered by the cumulative acknowledgement */
+static void tcp_sack_trim(struct tcp *conn)
+{
+	int i = 0;
+
+	while (i < conn->sack_cnt &&
+	       net_tcp_seq_cmp(conn->sack_blocks[i].end, conn->seq) <= 0) {
+		i++;
+	}
+
+	if (i > 0) {
+		conn->sack_cnt -= i;
+		memmove(&conn->sack_blocks[0], &conn->sack_blocks[i],
+			conn->sack_cnt * sizeof(conn->sack_blocks[0]));
+	}
+
+	if (conn->sack_cnt > 0 &&
+	    net_tcp_seq_cmp(conn->sack_blocks[0].start, conn->seq) < 0) {
+		conn->sack_blocks[0].start = conn->seq;
+	}
+}
+
+/* The receiver may discard data it has selectively acknowledged, so the
+ * scoreboard must not be trusted after a retransmission timeout (RFC 2018).
+ */
+static void tcp_sack_reset(struct tcp *conn)
+{
+	conn->sack_cnt = 0;
+}
+
+#else
+
+static void tcp_sack_negotiate(struct tcp *conn) { }
+
+static size_t tcp_sack_opt_prepare(struct tcp *conn, uint8_t flags, uint8_t *opt)
+{
+	return 0;
+}
+
+static void tcp_sack_update(struct tcp *conn) { }
+
+static void tcp_sack_trim(struct tcp *conn) { }
+
+static void tcp_sack_reset(struct tcp *conn) { }
+
+#endif /* CONFIG_NET_TCP_SACK */
+
 #if defined(CONFIG_NET_TCP_KEEPALIVE)
 
 static void tcp_send_keepalive_probe(struct k_work *work);
@@ -1106,6 +1408,10 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	recv_options->mss_found = false;
 	recv_options->wnd_found = false;
+#ifdef CONFIG_NET_TCP_SACK
+	recv_options->sack_perm_found = false;
+	recv_options->sack_cnt = 0;
+#endif
 
 	for ( ; options && len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
@@ -1154,6 +1460,35 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 			recv_options->window = opt;
 			recv_options->wnd_found = true;
 			break;
+#ifdef CONFIG_NET_TCP_SACK
+		case NET_TCP_SACK_PERM_OPT:
+			if (opt_len != NET_TCP_SACK_PERM_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_perm_found = true;
+			break;
+		case NET_TCP_SACK_OPT:
+			if (opt_len < 2 + NET_TCP_SACK_BLOCK_SIZE ||
+			    ((opt_len - 2) % NET_TCP_SACK_BLOCK_SIZE) != 0) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_cnt = MIN((opt_len - 2) / NET_TCP_SACK_BLOCK_SIZE,
+						     NET_TCP_SACK_BLOCKS_MAX);
+
+			for (int i = 0; i < recv_options->sack_cnt; i++) {
+				uint8_t *block = options + 2 + i * NET_TCP_SACK_BLOCK_SIZE;
+
+				recv_options->sack[i].start =
+					ntohl(UNALIGNED_GET((uint32_t *)block));
+				recv_options->sack[i].end =
+					ntohl(UNALIGNED_GET((uint32_t *)(block + 4)));
+			}
+			break;
+#endif /* CONFIG_NET_TCP_SACK */
 		default:
 			continue;
 		}
@@ -1328,7 +1663,7 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 }
 
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
-			  uint32_t seq)
+			  uint32_t seq, size_t opts_len)
 {
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct tcphdr *th;
@@ -1342,11 +1677,7 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 
 	UNALIGNED_PUT(conn->src.sin.sin_port, &th->th_sport);
 	UNALIGNED_PUT(conn->dst.sin.sin_port, &th->th_dport);
-	th->th_off = 5;
-
-	if (conn->send_options.mss_found) {
-		th->th_off++;
-	}
+	th->th_off = 5 + opts_len / sizeof(uint32_t);
 
 	UNALIGNED_PUT(flags, &th->th_flags);
 	UNALIGNED_PUT(htons(conn->recv_win), &th->th_win);
@@ -1530,21 +1861,32 @@ err:
 static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		       uint32_t seq)
 {
-	size_t alloc_len = sizeof(struct tcphdr);
+	uint8_t sack_opt[NET_TCP_SACK_OPT_MAX_SIZE];
+	size_t sack_opt_len;
+	size_t opts_len = 0;
 	struct net_pkt *pkt;
 	int ret = 0;
 
 	if (conn->send_options.mss_found) {
-		alloc_len += sizeof(uint32_t);
+		opts_len += sizeof(uint32_t);
 	}
 
-	pkt = tcp_pkt_alloc(conn, alloc_len);
+	sack_opt_len = tcp_sack_opt_prepare(conn, flags, sack_opt);
+	opts_len += sack_opt_len;
+
+	pkt = tcp_pkt_alloc(conn, sizeof(struct tcphdr) + opts_len);
 	if (!pkt) {
 		ret = -ENOBUFS;
 		goto out;
 	}
 
 	if (data) {
+		if (IS_ENABLED(CONFIG_NET_TCP_GSO) &&
+		    net_pkt_get_len(data) > conn_mss(conn)) {
+			/* Super packet, L2 cuts it into MSS sized segments */
+			net_pkt_set_gso_size(pkt, conn_mss(conn));
+		}
+
 		/* Append the data buffer to the pkt */
 		net_pkt_append_buffer(pkt, data->buffer);
 		data->buffer = NULL;
@@ -1556,7 +1898,7 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		goto out;
 	}
 
-	ret = tcp_header_add(conn, pkt, flags, seq);
+	ret = tcp_header_add(conn, pkt, flags, seq, opts_len);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
 		goto out;
@@ -1570,6 +1912,14 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		}
 	}
 
+	if (sack_opt_len > 0) {
+		ret = net_pkt_write(pkt, sack_opt, sack_opt_len);
+		if (ret < 0) {
+			tcp_pkt_unref(pkt);
+			goto out;
+		}
+	}
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -1721,13 +2071,80 @@ static int tcp_unsent_len(struct tcp *conn)
 	return unsent_len;
 }
 
+#if defined(CONFIG_NET_TCP_GSO)
+static bool tcp_gso_possible(struct tcp *conn)
+{
+	const struct net_l2 *l2 = net_if_l2(conn->iface);
+
+	return l2 != NULL && l2->get_flags != NULL &&
+	       (l2->get_flags(conn->iface) & NET_L2_TCP_GSO);
+}
+
+/* Largest amount of data handed to tcp_send_segment() at once */
+static int tcp_send_len_max(struct tcp *conn)
+{
+	int mss = conn_mss(conn);
+
+	if (!tcp_gso_possible(conn)) {
+		return mss;
+	}
+
+	return MIN(mss * CONFIG_NET_TCP_GSO_MAX_SEGS, ROUND_DOWN(TCP_GSO_MAX_LEN, mss));
+}
+#else
+static int tcp_send_len_max(struct tcp *conn)
+{
+	return conn_mss(conn);
+}
+#endif /* CONFIG_NET_TCP_GSO */
+
+/* Send len bytes starting at offset of the send_data as one segment, or as
+ * a GSO super packet if len is larger than the MSS.
+ */
+static int tcp_send_segment(struct tcp *conn, int offset, int len)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	if (IS_ENABLED(CONFIG_NET_TCP_GSO) && len > conn_mss(conn)) {
+		/* The super packet is not bounded by the MTU */
+		pkt = tcp_pkt_alloc(conn, 0);
+		if (pkt && net_pkt_alloc_buffer_raw(pkt, len, TCP_PKT_ALLOC_TIMEOUT) < 0) {
+			tcp_pkt_unref(pkt);
+			pkt = NULL;
+		}
+	} else {
+		pkt = tcp_pkt_alloc(conn, len);
+	}
+
+	if (!pkt) {
+		NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
+		return -ENOBUFS;
+	}
+
+	ret = tcp_pkt_peek(pkt, conn->send_data, offset, len);
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		return -ENOBUFS;
+	}
+
+	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + offset);
+
+	/* The data we want to send, has been moved to the send queue so we
+	 * can unref the head net_pkt. If there was an error, we need to remove
+	 * the packet anyway.
+	 */
+	tcp_pkt_unref(pkt);
+
+	return ret;
+}
+
 static int tcp_send_data(struct tcp *conn)
 {
 	int ret = 0;
 	int len;
-	struct net_pkt *pkt;
 
-	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
+	len = MIN(tcp_unsent_len(conn), tcp_send_len_max(conn));
 	if (len < 0) {
 		ret = len;
 		goto out;
@@ -1738,21 +2155,7 @@ static int tcp_send_data(struct tcp *conn)
 		goto out;
 	}
 
-	pkt = tcp_pkt_alloc(conn, len);
-	if (!pkt) {
-		NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
-		ret = -ENOBUFS;
-		goto out;
-	}
-
-	ret = tcp_pkt_peek(pkt, conn->send_data, conn->unacked_len, len);
-	if (ret < 0) {
-		tcp_pkt_unref(pkt);
-		ret = -ENOBUFS;
-		goto out;
-	}
-
-	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + conn->unacked_len);
+	ret = tcp_send_segment(conn, conn->unacked_len, len);
 	if (ret == 0) {
 		conn->unacked_len += len;
 
@@ -1765,18 +2168,52 @@ static int tcp_send_data(struct tcp *conn)
 		}
 	}
 
-	/* The data we want to send, has been moved to the send queue so we
-	 * can unref the head net_pkt. If there was an error, we need to remove
-	 * the packet anyway.
-	 */
-	tcp_pkt_unref(pkt);
-
 	conn_send_data_dump(conn);
 
  out:
 	return ret;
 }
 
+#if defined(CONFIG_NET_TCP_SACK)
+/* Fast retransmit driven by the scoreboard: resend the start of every hole
+ * below the highest selectively acknowledged block, leaving the data the
+ * peer already holds alone. Returns false if there is no SACK information,
+ * in which case the caller falls back to resending the first segment.
+ */
+static bool tcp_sack_retransmit(struct tcp *conn)
+{
+	uint32_t hole_start = conn->seq;
+	bool sent = false;
+
+	if (!conn->sack_ok || conn->sack_cnt == 0) {
+		return false;
+	}
+
+	for (int i = 0; i < conn->sack_cnt; i++) {
+		int hole_len = conn->sack_blocks[i].start - hole_start;
+		int len = MIN(hole_len, conn_mss(conn));
+
+		if (len > 0 &&
+		    tcp_send_segment(conn, hole_start - conn->seq, len) == 0) {
+			net_stats_update_tcp_resent(conn->iface, len);
+			net_stats_update_tcp_seg_rexmit(conn->iface);
+			sent = true;
+		}
+
+		hole_start = conn->sack_blocks[i].end;
+	}
+
+	NET_DBG("conn: %p SACK retransmit of %d block(s)", conn, conn->sack_cnt);
+
+	return sent;
+}
+#else
+static bool tcp_sack_retransmit(struct tcp *conn)
+{
+	return false;
+}
+#endif /* CONFIG_NET_TCP_SACK */
+
 /* Send all queued but unsent data from the send_data packet by packet
  * until the receiver's window is full. */
 static int tcp_send_queued_data(struct tcp *conn)
@@ -1870,6 +2307,7 @@ static void tcp_resend_data(struct k_work *work)
 
 	conn->data_mode = TCP_DATA_MODE_RESEND;
 	conn->unacked_len = 0;
+	tcp_sack_reset(conn);
 
 	ret = tcp_send_data(conn);
 	conn->send_data_retries++;
@@ -2125,6 +2563,7 @@ static struct tcp *tcp_conn_alloc(void)
 	 */
 	conn->ca.cwnd = UINT16_MAX;
 #endif
+	tcp_ca_select(conn, NULL);
 
 	/* The ISN value will be set when we get the connection attempt or
 	 * when trying to create a connection.
@@ -2251,6 +2690,9 @@ static enum net_verdict tcp_recv(struct net_conn *net_conn,
 		}
 
 		conn->accepted_conn = conn_old;
+
+		/* Accepted connections inherit the listener's algorithm */
+		tcp_ca_select(conn, conn_old);
 	}
 in:
 	if (conn) {
@@ -2912,6 +3354,7 @@ next_state:
 		if (FL(&fl, ==, SYN)) {
 			/* Make sure our MSS is also sent in the ACK */
 			conn->send_options.mss_found = true;
+			tcp_sack_negotiate(conn);
 			conn_ack(conn, th_seq(th) + 1); /* capture peer's isn */
 			tcp_out(conn, SYN | ACK);
 			conn->send_options.mss_found = false;
@@ -3037,6 +3480,7 @@ next_state:
 		 */
 		if (FL(&fl, &, SYN | ACK, th && th_ack(th) == conn->seq)) {
 			tcp_send_timer_cancel(conn);
+			tcp_sack_negotiate(conn);
 			conn_ack(conn, th_seq(th) + 1);
 			if (len) {
 				verdict = tcp_data_get(conn, pkt, &len);
@@ -3120,6 +3564,10 @@ next_state:
 		 */
 		keep_alive_timer_restart(conn);
 
+		if (th && tcp_options_len) {
+			tcp_sack_update(conn);
+		}
+
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 		if (th && (net_tcp_seq_cmp(th_ack(th), conn->seq) == 0)) {
 			/* Only if there is pending data, increment the duplicate ack count */
@@ -3141,14 +3589,16 @@ next_state:
 			if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
 			    (conn->dup_ack_cnt == DUPLICATE_ACK_RETRANSMIT_TRHESHOLD)) {
 				/* Apply a fast retransmit */
-				int temp_unacked_len = conn->unacked_len;
+				if (!tcp_sack_retransmit(conn)) {
+					int temp_unacked_len = conn->unacked_len;
 
-				conn->unacked_len = 0;
+					conn->unacked_len = 0;
 
-				(void)tcp_send_data(conn);
+					(void)tcp_send_data(conn);
 
-				/* Restore the current transmission */
-				conn->unacked_len = temp_unacked_len;
+					/* Restore the current transmission */
+					conn->unacked_len = temp_unacked_len;
+				}
 
 				tcp_ca_fast_retransmit(conn);
 				if (tcp_window_full(conn)) {
@@ -3198,6 +3648,7 @@ next_state:
 			}
 
 			conn_seq(conn, + len_acked);
+			tcp_sack_trim(conn);
 			net_stats_update_tcp_seg_recv(conn->iface);
 
 			/* Receipt of an acknowledgment that covers a sequence number
@@ -4073,6 +4524,120 @@ int net_tcp_finalize(struct net_pkt *pkt, bool force_chksum)
 	return net_pkt_set_data(pkt, &tcp_access);
 }
 
+#if defined(CONFIG_NET_TCP_GSO)
+int net_tcp_gso_segment(struct net_pkt *pkt, sys_slist_t *segs)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
+	size_t l3_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt);
+	uint16_t mss = net_pkt_gso_size(pkt);
+	struct net_pkt *seg;
+	struct tcphdr *th;
+	size_t data_len;
+	size_t hdr_len;
+	uint8_t flags;
+	uint32_t seq;
+	int count = 0;
+
+	sys_slist_init(segs);
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (mss == 0U || net_pkt_skip(pkt, l3_len)) {
+		return -EINVAL;
+	}
+
+	th = (struct tcphdr *)net_pkt_get_data(pkt, &tcp_access);
+	if (th == NULL) {
+		return -ENOBUFS;
+	}
+
+	hdr_len = l3_len + th->th_off * 4U;
+	if (net_pkt_get_len(pkt) <= hdr_len) {
+		return -EINVAL;
+	}
+
+	data_len = net_pkt_get_len(pkt) - hdr_len;
+	seq = ntohl(UNALIGNED_GET(&th->th_seq));
+	flags = th_flags(th);
+
+	for (size_t offset = 0; offset < data_len; offset += mss) {
+		size_t len = MIN(mss, data_len - offset);
+		struct tcphdr *seg_th;
+
+		/* Take the metadata (family, header lengths, VLAN tag,
+		 * priority...) of the super packet but not its data.
+		 */
+		seg = net_pkt_shallow_clone(pkt, TCP_PKT_ALLOC_TIMEOUT);
+		if (seg == NULL) {
+			goto fail;
+		}
+
+		net_pkt_list_append(segs, seg);
+
+		net_pkt_frag_unref(seg->buffer);
+		seg->buffer = NULL;
+		net_pkt_set_gso_size(seg, 0U);
+		net_pkt_set_overwrite(seg, false);
+
+		if (net_pkt_alloc_buffer_raw(seg, hdr_len + len, TCP_PKT_ALLOC_TIMEOUT) < 0) {
+			goto fail;
+		}
+
+		net_pkt_cursor_init(seg);
+		net_pkt_cursor_init(pkt);
+
+		if (net_pkt_copy(seg, pkt, hdr_len) < 0 || net_pkt_skip(pkt, offset) ||
+		    net_pkt_copy(seg, pkt, len) < 0) {
+			goto fail;
+		}
+
+		net_pkt_cursor_init(seg);
+		net_pkt_set_overwrite(seg, true);
+		net_pkt_skip(seg, l3_len);
+
+		seg_th = (struct tcphdr *)net_pkt_get_data(seg, &tcp_access);
+		if (seg_th == NULL) {
+			goto fail;
+		}
+
+		UNALIGNED_PUT(htonl(seq + offset), &seg_th->th_seq);
+
+		/* PSH and FIN belong to the last segment only */
+		if (offset + len < data_len) {
+			UNALIGNED_PUT(flags & ~(PSH | FIN), &seg_th->th_flags);
+		}
+
+		net_pkt_set_data(seg, &tcp_access);
+
+		/* The IPv4 header checksum copied from the super packet would
+		 * otherwise be summed into the new one.
+		 */
+		if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(seg) == AF_INET) {
+			NET_IPV4_HDR(seg)->chksum = 0U;
+		}
+
+		/* Fixes the IP length and the checksums */
+		if (tcp_finalize_pkt(seg) < 0) {
+			goto fail;
+		}
+
+		count++;
+	}
+
+	NET_DBG("GSO pkt %p split into %d segment(s) of %u bytes", pkt, count, mss);
+
+	return count;
+
+fail:
+	while ((seg = net_pkt_list_get(segs)) != NULL) {
+		net_pkt_unref(seg);
+	}
+
+	return -ENOBUFS;
+}
+#endif /* CONFIG_NET_TCP_GSO */
+
 struct net_tcp_hdr *net_tcp_input(struct net_pkt *pkt,
 				  struct net_pkt_data_access *tcp_access)
 {
@@ -4080,7 +4645,8 @@ struct net_tcp_hdr *net_tcp_input(struct net_pkt *pkt,
 	enum net_if_checksum_type type = net_pkt_family(pkt) == AF_INET6 ?
 		NET_IF_CHECKSUM_IPV6_TCP : NET_IF_CHECKSUM_IPV4_TCP;
 
-	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) &&
+	/* GRO already verified the checksums of the coalesced segments */
+	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) && !net_pkt_is_gro(pkt) &&
 	    (net_if_need_calc_rx_checksum(net_pkt_iface(pkt), type) ||
 	     net_pkt_is_ip_reassembled(pkt)) &&
 	    net_calc_chksum_tcp(pkt) != 0U) {
@@ -4444,6 +5010,9 @@ int net_tcp_set_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = set_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = set_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -4481,6 +5050,9 @@ int net_tcp_get_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = get_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = get_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -4533,6 +5105,8 @@ void net_tcp_init(void)
 			   K_KERNEL_STACK_SIZEOF(work_q_stack), THREAD_PRIORITY,
 			   NULL);
 
+	tcp_ca_default_init();
+
 	/* Compute the largest possible retransmission timeout */
 	tcp_max_timeout_ms = 0;
 	rto = tcp_rto;
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* BBR-lite congestion control.
+ *
+ * A reduced version of the BBR model: once per round trip the delivery rate
+ * and the round trip time are sampled, the maximum rate and the minimum
+ * RTT give the bandwidth-delay product (BDP) and the congestion window is
+ * set to a multiple of it. Startup grows the window like slow start until
+ * the bandwidth estimate stops increasing, after which the window follows
+ * the model while a gain cycle periodically probes for more bandwidth and
+ * then drains the queue it may have built. The stack has no transmit timer
+ * finer than a tick, so the pacing gain is applied to the window.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+
+#include "tcp_internal.h"
+
+enum bbr_mode {
+	BBR_STARTUP,
+	BBR_PROBE_BW,
+};
+
+/* Minimum window, in MSS units */
+#define BBR_MIN_CWND_SEGS 4
+
+/* Window is sized to twice the BDP to absorb delayed and stretched ACKs */
+#define BBR_CWND_GAIN 2
+
+/* Bandwidth is considered full when it grew less than 25% for 3 rounds */
+#define BBR_FULL_BW_NUM 5
+#define BBR_FULL_BW_DEN 4
+#define BBR_FULL_BW_ROUNDS 3
+
+/* Lifetime of the bandwidth and RTT estimates */
+#define BBR_BW_ROUNDS 10
+#define BBR_MIN_RTT_WIN_MS 10000
+
+/* Gain cycle in quarters: probe, drain, then cruise for six rounds */
+static const uint8_t bbr_pacing_gain[] = { 5, 3, 4, 4, 4, 4, 4, 4 };
+
+#define ca_bbr(_conn) (&(_conn)->ca_priv.bbr)
+
+static void tcp_bbr_log(struct tcp *conn, char *step)
+{
+	NET_DBG("conn: %p, ca %s, cwnd=%d, mode=%u, bw=%u, min_rtt=%u",
+		conn, step, conn->ca.cwnd, ca_bbr(conn)->mode,
+		ca_bbr(conn)->max_bw, ca_bbr(conn)->min_rtt_us);
+}
+
+static uint16_t tcp_bbr_min_cwnd(struct tcp *conn)
+{
+	return MIN(conn_mss(conn) * BBR_MIN_CWND_SEGS, UINT16_MAX);
+}
+
+static void tcp_bbr_round_start(struct tcp *conn)
+{
+	struct tcp_ca_bbr *bbr = ca_bbr(conn);
+
+	/* The round ends when data sent from now on gets acknowledged */
+	bbr->round_seq = conn->seq + conn->unacked_len;
+	bbr->round_start = k_uptime_ticks();
+	bbr->delivered = 0;
+	bbr->round_active = true;
+}
+
+static void tcp_bbr_set_cwnd(struct tcp *conn)
+{
+	struct tcp_ca_bbr *bbr = ca_bbr(conn);
+	uint64_t bdp;
+	uint64_t cwnd;
+
+	if (bbr->max_bw == 0 || bbr->min_rtt_us == 0) {
+		return;
+	}
+
+	bdp = (uint64_t)bbr->max_bw * bbr->min_rtt_us / USEC_PER_SEC;
+	cwnd = bdp * BBR_CWND_GAIN * bbr_pacing_gain[bbr->cycle_idx] / 4;
+
+	conn->ca.cwnd = CLAMP(cwnd, tcp_bbr_min_cwnd(conn), UINT16_MAX);
+}
+
+static void tcp_bbr_round_end(struct tcp *conn)
+{
+	struct tcp_ca_bbr *bbr = ca_bbr(conn);
+	uint32_t now = k_uptime_get_32();
+	uint32_t rtt_us;
+	uint32_t bw;
+
+	rtt_us = (uint32_t)k_ticks_to_us_ceil64(k_uptime_ticks() - bbr->round_start);
+	rtt_us = MAX(rtt_us, 1);
+
+	if (bbr->min_rtt_us == 0 || rtt_us <= bbr->min_rtt_us ||
+	    (now - bbr->min_rtt_stamp) > BBR_MIN_RTT_WIN_MS) {
+		bbr->min_rtt_us = rtt_us;
+		bbr->min_rtt_stamp = now;
+	}
+
+	bw = (uint32_t)MIN((uint64_t)bbr->delivered * USEC_PER_SEC / rtt_us, UINT32_MAX);
+
+	/* Windowed maximum, an old peak eventually gives way to new samples */
+	if (bw >= bbr->max_bw || ++bbr->bw_rounds > BBR_BW_ROUNDS) {
+		bbr->max_bw = bw;
+		bbr->bw_rounds = 0;
+	}
+
+	if (bbr->mode == BBR_STARTUP) {
+		if ((uint64_t)bbr->max_bw * BBR_FULL_BW_DEN >=
+		    (uint64_t)bbr->full_bw * BBR_FULL_BW_NUM) {
+			bbr->full_bw = bbr->max_bw;
+			bbr->full_bw_cnt = 0;
+		} else if (++bbr->full_bw_cnt >= BBR_FULL_BW_ROUNDS) {
+			bbr->mode = BBR_PROBE_BW;
+			bbr->cycle_idx = 0;
+			tcp_bbr_log(conn, "probe_bw");
+		}
+	} else {
+		bbr->cycle_idx = (bbr->cycle_idx + 1) % ARRAY_SIZE(bbr_pacing_gain);
+	}
+}
+
+static void tcp_bbr_init(struct tcp *conn)
+{
+	memset(ca_bbr(conn), 0, sizeof(struct tcp_ca_bbr));
+
+	conn->ca.cwnd = tcp_bbr_min_cwnd(conn);
+	conn->ca.ssthresh = UINT16_MAX;
+	conn->ca.pending_fast_retransmit_bytes = 0;
+	tcp_bbr_log(conn, "init");
+}
+
+static void tcp_bbr_fast_retransmit(struct tcp *conn)
+{
+	struct tcp_ca_bbr *bbr = ca_bbr(conn);
+
+	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+		/* Loss is not a congestion signal for the model, only stop
+		 * sampling across the retransmission and leave startup.
+		 */
+		conn->ca.pending_fast_retransmit_bytes = conn->unacked_len;
+		bbr->round_active = false;
+		if (bbr->mode == BBR_STARTUP && bbr->max_bw != 0) {
+			bbr->mode = BBR_PROBE_BW;
+			bbr->cycle_idx = 0;
+			tcp_bbr_set_cwnd(conn);
+		}
+		tcp_bbr_log(conn, "fast_retransmit");
+	}
+}
+
+static void tcp_bbr_timeout(struct tcp *conn)
+{
+	struct tcp_ca_bbr *bbr = ca_bbr(conn);
+
+	conn->ca.cwnd = conn_mss(conn);
+	bbr->round_active = false;
+	bbr->mode = BBR_STARTUP;
+	bbr->full_bw = 0;
+	bbr->full_bw_cnt = 0;
+	tcp_bbr_log(conn, "timeout");
+}
+
+static void tcp_bbr_dup_ack(struct tcp *conn)
+{
+	ARG_UNUSED(conn);
+}
+
+static void tcp_bbr_pkts_acked(struct tcp *conn, uint32_t acked_len)
+{
+	struct tcp_ca_bbr *bbr = ca_bbr(conn);
+	int32_t new_win = conn->ca.cwnd;
+
+	if (conn->ca.pending_fast_retransmit_bytes != 0) {
+		if (conn->ca.pending_fast_retransmit_bytes <= acked_len) {
+			conn->ca.pending_fast_retransmit_bytes = 0;
+		} else {
+			conn->ca.pending_fast_retransmit_bytes -= acked_len;
+		}
+		return;
+	}
+
+	if (!bbr->round_active) {
+		tcp_bbr_round_start(conn);
+	}
+
+	bbr->delivered += acked_len;
+
+	if (net_tcp_seq_cmp(conn->seq + acked_len, bbr->round_seq) > 0) {
+		tcp_bbr_round_end(conn);
+		tcp_bbr_round_start(conn);
+	}
+
+	if (bbr->mode == BBR_STARTUP) {
+		new_win += acked_len;
+		conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+	} else {
+		tcp_bbr_set_cwnd(conn);
+	}
+
+	tcp_bbr_log(conn, "pkts_acked");
+}
+
+TCP_CA_DEFINE(bbr, tcp_bbr_init, tcp_bbr_fast_retransmit, tcp_bbr_timeout,
+	      tcp_bbr_dup_ack, tcp_bbr_pkts_acked);
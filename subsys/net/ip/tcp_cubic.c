@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* CUBIC congestion control, implementation according to RFC 9438 */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+
+#include "tcp_internal.h"
+
+/* Multiplicative decrease factor, beta = 0.7 */
+#define CUBIC_BETA_NUM 7
+#define CUBIC_BETA_DEN 10
+
+/* K = cbrt(W_max * (1 - beta) / C) seconds with C = 0.4. With W_max in
+ * segments and K in ms this is cbrt(W_max * 0.75 * 10^9).
+ */
+#define CUBIC_K_SCALE 750000000ULL
+
+/* C * (t - K)^3 with t in ms gives 4 * (t - K)^3 / 10^10 segments, computed
+ * in hundredths of a segment to keep the precision.
+ */
+#define CUBIC_C_NUM 4
+#define CUBIC_C_DEN 100000000LL
+
+/* The window saturates long before this, keeps (t - K)^3 from overflowing */
+#define CUBIC_MAX_DELTA_MS 60000
+
+#define ca_cubic(_conn) (&(_conn)->ca_priv.cubic)
+
+static void tcp_cubic_log(struct tcp *conn, char *step)
+{
+	NET_DBG("conn: %p, ca %s, cwnd=%d, ssthres=%d, w_max=%d, k=%u",
+		conn, step, conn->ca.cwnd, conn->ca.ssthresh,
+		ca_cubic(conn)->w_max, ca_cubic(conn)->k);
+}
+
+static uint32_t cubic_cbrt(uint64_t x)
+{
+	uint64_t y = 0;
+
+	for (int s = 63; s >= 0; s -= 3) {
+		uint64_t b;
+
+		y += y;
+		b = 3 * y * (y + 1) + 1;
+		if ((x >> s) >= b) {
+			x -= b << s;
+			y++;
+		}
+	}
+
+	return (uint32_t)y;
+}
+
+static void tcp_cubic_init(struct tcp *conn)
+{
+	conn->ca.cwnd = conn_mss(conn) * TCP_CONGESTION_INITIAL_WIN;
+	/* Leave slow start only on the first loss */
+	conn->ca.ssthresh = UINT16_MAX;
+	conn->ca.pending_fast_retransmit_bytes = 0;
+
+	memset(ca_cubic(conn), 0, sizeof(struct tcp_ca_cubic));
+	tcp_cubic_log(conn, "init");
+}
+
+static void tcp_cubic_reduce(struct tcp *conn)
+{
+	struct tcp_ca_cubic *cubic = ca_cubic(conn);
+	uint32_t win = MIN(conn->ca.cwnd, conn->unacked_len);
+
+	win = MAX(win, conn_mss(conn) * 2);
+
+	/* Fast convergence, release bandwidth to newer flows */
+	if (win < cubic->last_w_max) {
+		cubic->last_w_max = win;
+		cubic->w_max = win * (CUBIC_BETA_DEN + CUBIC_BETA_NUM) / (2 * CUBIC_BETA_DEN);
+	} else {
+		cubic->last_w_max = win;
+		cubic->w_max = win;
+	}
+
+	cubic->epoch_start = 0;
+	conn->ca.ssthresh = MAX(conn_mss(conn) * 2, win * CUBIC_BETA_NUM / CUBIC_BETA_DEN);
+}
+
+static void tcp_cubic_fast_retransmit(struct tcp *conn)
+{
+	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+		tcp_cubic_reduce(conn);
+		/* Account for the lost segments */
+		conn->ca.cwnd = MIN(conn_mss(conn) * 3 + conn->ca.ssthresh, UINT16_MAX);
+		conn->ca.pending_fast_retransmit_bytes = conn->unacked_len;
+		tcp_cubic_log(conn, "fast_retransmit");
+	}
+}
+
+static void tcp_cubic_timeout(struct tcp *conn)
+{
+	tcp_cubic_reduce(conn);
+	conn->ca.cwnd = conn_mss(conn);
+	tcp_cubic_log(conn, "timeout");
+}
+
+/* For every duplicate ack increment the cwnd by mss */
+static void tcp_cubic_dup_ack(struct tcp *conn)
+{
+	int32_t new_win = conn->ca.cwnd;
+
+	new_win += conn_mss(conn);
+	conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+	tcp_cubic_log(conn, "dup_ack");
+}
+
+/* Window increase in congestion avoidance for win_inc newly acked bytes */
+static uint32_t tcp_cubic_increase(struct tcp *conn, int32_t win_inc)
+{
+	struct tcp_ca_cubic *cubic = ca_cubic(conn);
+	int32_t cwnd = conn->ca.cwnd;
+	int32_t mss = conn_mss(conn);
+	uint32_t now = k_uptime_get_32();
+	int64_t delta;
+	int64_t target;
+	int32_t cubic_inc = 0;
+	int32_t reno_inc;
+
+	if (cubic->epoch_start == 0) {
+		cubic->epoch_start = now != 0 ? now : 1;
+
+		if (cwnd < cubic->w_max) {
+			cubic->k = cubic_cbrt((uint64_t)cubic->w_max * CUBIC_K_SCALE / mss);
+		} else {
+			cubic->w_max = cwnd;
+			cubic->k = 0;
+		}
+	}
+
+	delta = (int64_t)(now - cubic->epoch_start) - cubic->k;
+	delta = CLAMP(delta, -CUBIC_MAX_DELTA_MS, CUBIC_MAX_DELTA_MS);
+
+	target = delta * delta * delta * CUBIC_C_NUM / CUBIC_C_DEN;
+	target = cubic->w_max + target * mss / 100;
+	target = CLAMP(target, mss, UINT16_MAX);
+
+	if (target > cwnd) {
+		cubic_inc = (int32_t)((target - cwnd) * win_inc / cwnd);
+	}
+
+	/* Never grow slower than New Reno would (TCP friendly region).
+	 * Implement a div_ceil to avoid rounding to 0.
+	 */
+	reno_inc = ((win_inc * win_inc) + cwnd - 1) / cwnd;
+
+	return MAX(cubic_inc, reno_inc);
+}
+
+static void tcp_cubic_pkts_acked(struct tcp *conn, uint32_t acked_len)
+{
+	int32_t new_win = conn->ca.cwnd;
+	int32_t win_inc = MIN(acked_len, conn_mss(conn));
+
+	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+		if (conn->ca.cwnd < conn->ca.ssthresh) {
+			new_win += win_inc;
+		} else {
+			new_win += tcp_cubic_increase(conn, win_inc);
+		}
+		conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+	} else {
+		/* Check if it is still in fast recovery mode */
+		if (conn->ca.pending_fast_retransmit_bytes <= acked_len) {
+			conn->ca.pending_fast_retransmit_bytes = 0;
+			conn->ca.cwnd = conn->ca.ssthresh;
+		} else {
+			conn->ca.pending_fast_retransmit_bytes -= acked_len;
+			conn->ca.cwnd -= acked_len;
+		}
+	}
+	tcp_cubic_log(conn, "pkts_acked");
+}
+
+TCP_CA_DEFINE(cubic, tcp_cubic_init, tcp_cubic_fast_retransmit, tcp_cubic_timeout,
+	      tcp_cubic_dup_ack, tcp_cubic_pkts_acked);
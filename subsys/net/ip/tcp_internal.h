@@ -36,6 +36,7 @@ enum tcp_conn_option {
 	TCP_OPT_KEEPIDLE = 3,
 	TCP_OPT_KEEPINTVL = 4,
 	TCP_OPT_KEEPCNT = 5,
+	TCP_OPT_CONGESTION = 6,
 };
 
 /**
@@ -286,6 +287,31 @@ struct net_tcp_hdr *net_tcp_input(struct net_pkt *pkt,
 }
 #endif
 
+/**
+ * @brief Split a TCP super packet into MSS sized segments
+ *
+ * Used by L2 on packets that have a non-zero GSO size when the network
+ * device cannot do the segmentation itself. Every segment gets a copy of
+ * the IP and TCP headers with the length, sequence number, flags and
+ * checksums fixed up. The original packet is not modified.
+ *
+ * @param pkt Network packet with IP and TCP headers at its start
+ * @param segs List the segments are appended to
+ *
+ * @return Number of segments on success, negative errno otherwise.
+ */
+#if defined(CONFIG_NET_TCP_GSO)
+int net_tcp_gso_segment(struct net_pkt *pkt, sys_slist_t *segs);
+#else
+static inline int net_tcp_gso_segment(struct net_pkt *pkt, sys_slist_t *segs)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(segs);
+
+	return -ENOTSUP;
+}
+#endif
+
 /**
  * @brief Enqueue data for transmission
  *
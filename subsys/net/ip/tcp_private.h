@@ -5,6 +5,8 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <zephyr/sys/iterable_sections.h>
+
 #include "tp.h"
 
 #define is(_a, _b) (strcmp((_a), (_b)) == 0)
@@ -130,6 +132,11 @@
 
 #define NET_TCP_DEFAULT_MSS 536
 
+/* Upper bound for a GSO super packet, leaves room for the IP and TCP
+ * headers within the 16 bit IP length field.
+ */
+#define TCP_GSO_MAX_LEN (UINT16_MAX - 128)
+
 #define conn_mss(_conn)							\
 	MIN((_conn)->recv_options.mss_found ? (_conn)->recv_options.mss	\
 					    : NET_TCP_DEFAULT_MSS,	\
@@ -227,20 +234,41 @@ union tcp_endpoint {
 #define NET_TCP_NOP_OPT          1
 #define NET_TCP_MSS_OPT          2
 #define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_SACK_PERM_OPT    4
+#define NET_TCP_SACK_OPT         5
 
 /* TCP Option sizes */
 #define NET_TCP_END_SIZE          1
 #define NET_TCP_NOP_SIZE          1
 #define NET_TCP_MSS_SIZE          4
 #define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_SACK_PERM_SIZE    2
+#define NET_TCP_SACK_BLOCK_SIZE   8
+
+/* Without timestamps at most four SACK blocks fit in the option space */
+#define NET_TCP_SACK_BLOCKS_MAX   4
+#define NET_TCP_SACK_OPT_MAX_SIZE \
+	(2 * NET_TCP_NOP_SIZE + 2 + NET_TCP_SACK_BLOCKS_MAX * NET_TCP_SACK_BLOCK_SIZE)
+
+struct tcp_sack_block {
+	uint32_t start;
+	uint32_t end;
+};
 
 struct tcp_options {
 	uint16_t mss;
 	uint16_t window;
+#ifdef CONFIG_NET_TCP_SACK
+	struct tcp_sack_block sack[NET_TCP_SACK_BLOCKS_MAX];
+	uint8_t sack_cnt;
+	bool sack_perm_found : 1;
+#endif
 	bool mss_found : 1;
 	bool wnd_found : 1;
 };
 
+struct tcp;
+
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
 struct tcp_collision_avoidance_reno {
@@ -248,9 +276,68 @@ struct tcp_collision_avoidance_reno {
 	uint16_t ssthresh;
 	uint16_t pending_fast_retransmit_bytes;
 };
+
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+struct tcp_ca_cubic {
+	uint32_t epoch_start; /* Start of the current epoch in ms, 0 if none */
+	uint32_t k;           /* Time to reach w_max again in ms */
+	uint16_t w_max;       /* Window before the last reduction */
+	uint16_t last_w_max;  /* w_max of the previous epoch */
+};
 #endif
 
-struct tcp;
+#ifdef CONFIG_NET_TCP_CONGESTION_BBR
+struct tcp_ca_bbr {
+	int64_t round_start;    /* Round start timestamp in ticks */
+	uint32_t max_bw;        /* Bottleneck bandwidth estimate, bytes/s */
+	uint32_t full_bw;       /* Bandwidth at the last startup growth check */
+	uint32_t min_rtt_us;    /* Propagation delay estimate */
+	uint32_t min_rtt_stamp; /* When min_rtt_us was taken, in ms */
+	uint32_t round_seq;     /* Sequence number ending the current round */
+	uint32_t delivered;     /* Bytes acknowledged in the current round */
+	uint8_t full_bw_cnt;
+	uint8_t bw_rounds;
+	uint8_t cycle_idx;
+	uint8_t mode;
+	bool round_active : 1;
+};
+#endif
+
+/* Define the number of MSS sections the congestion window is initialized at */
+#define TCP_CONGESTION_INITIAL_WIN 1
+#define TCP_CONGESTION_INITIAL_SSTHRESH 3
+
+/** Maximum length of a congestion control algorithm name */
+#define TCP_CA_NAME_MAX 16
+
+/** Congestion control algorithm, called with the connection lock held */
+struct tcp_ca_ops {
+	const char *name;
+	/** Connection established, set up the initial window */
+	void (*init)(struct tcp *conn);
+	/** Duplicate ACK threshold reached, a fast retransmit was sent */
+	void (*fast_retransmit)(struct tcp *conn);
+	/** Retransmission timer expired */
+	void (*timeout)(struct tcp *conn);
+	/** Duplicate ACK received */
+	void (*dup_ack)(struct tcp *conn);
+	/** New data acknowledged, called before the send sequence moves */
+	void (*pkts_acked)(struct tcp *conn, uint32_t acked_len);
+};
+
+/** Register a congestion control algorithm selectable with TCP_CONGESTION */
+#define TCP_CA_DEFINE(_name, _init, _fast_retransmit, _timeout, _dup_ack, _pkts_acked) \
+	static const STRUCT_SECTION_ITERABLE(tcp_ca_ops, tcp_ca_##_name) = {	\
+		.name = STRINGIFY(_name),					\
+		.init = _init,							\
+		.fast_retransmit = _fast_retransmit,				\
+		.timeout = _timeout,						\
+		.dup_ack = _dup_ack,						\
+		.pkts_acked = _pkts_acked,					\
+	}
+
+#endif /* CONFIG_NET_TCP_CONGESTION_AVOIDANCE */
+
 typedef void (*net_tcp_closed_cb_t)(struct tcp *conn, void *user_data);
 
 struct tcp { /* TCP connection */
@@ -323,8 +410,24 @@ struct tcp { /* TCP connection */
 #endif
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 	struct tcp_collision_avoidance_reno ca;
+	const struct tcp_ca_ops *ca_ops;
+#if defined(CONFIG_NET_TCP_CONGESTION_CUBIC) || defined(CONFIG_NET_TCP_CONGESTION_BBR)
+	union {
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+		struct tcp_ca_cubic cubic;
+#endif
+#ifdef CONFIG_NET_TCP_CONGESTION_BBR
+		struct tcp_ca_bbr bbr;
+#endif
+	} ca_priv;
+#endif
 #endif
 	uint8_t send_data_retries;
+#ifdef CONFIG_NET_TCP_SACK
+	/* Sender scoreboard, blocks sorted by start and never overlapping */
+	struct tcp_sack_block sack_blocks[NET_TCP_SACK_BLOCKS_MAX];
+	uint8_t sack_cnt;
+#endif
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 	uint8_t dup_ack_cnt;
 #endif
@@ -337,6 +440,9 @@ struct tcp { /* TCP connection */
 #endif /* CONFIG_NET_TCP_KEEPALIVE */
 	bool tcp_nodelay : 1;
 	bool addr_ref_done : 1;
+#ifdef CONFIG_NET_TCP_SACK
+	bool sack_ok : 1;
+#endif
 };
 
 #define _flags(_fl, _op, _mask, _cond)					\
@@ -533,6 +533,29 @@ static uint16_t offset_based_swap8(const uint8_t *data)
 	}
 }
 
+#if defined(CONFIG_ARM) && !defined(CONFIG_ARMV6_M_ARMV8_M_BASELINE)
+#define CHKSUM_ADD_WORDS
+
+/* Add 4 aligned words to a 32 bit one's complement sum with the carry
+ * chain, one instruction per word instead of a 64 bit addition. The carry
+ * is added back twice, as adding it once can carry again.
+ */
+static inline uint32_t chksum_add_words(uint32_t sum, const uint32_t *p)
+{
+	__asm__ ("adds %0, %0, %1\n\t"
+		 "adcs %0, %0, %2\n\t"
+		 "adcs %0, %0, %3\n\t"
+		 "adcs %0, %0, %4\n\t"
+		 "adcs %0, %0, #0\n\t"
+		 "adc %0, %0, #0"
+		 : "+r" (sum)
+		 : "r" (p[0]), "r" (p[1]), "r" (p[2]), "r" (p[3])
+		 : "cc");
+
+	return sum;
+}
+#endif
+
 /* Word based checksum calculation based on:
  * https://blogs.igalia.com/dpino/2018/06/14/fast-checksum-computation/
  * It’s not necessary to add octets as 16-bit words. Due to the associative property of addition,
@@ -570,6 +593,49 @@ uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len)
 	}
 	p = (uint32_t *)data;
 
+#if defined(CHKSUM_ADD_WORDS)
+	/* Carry chain of the CPU, the 32 bit sum is later folded as the rest */
+	if (pending >= sizeof(uint32_t) * 4) {
+		uint32_t sum32 = 0U;
+
+		while (pending >= sizeof(uint32_t) * 4) {
+			pending -= sizeof(uint32_t) * 4;
+			sum32 = chksum_add_words(sum32, &p[i]);
+			i += 4;
+		}
+
+		sum += sum32;
+	}
+#elif defined(CONFIG_64BIT)
+	/* Add 64 bit words with end around carry, halving the loads */
+	if ((pending >= sizeof(uint64_t) * 2) && (((uintptr_t)p & 0x04) != 0)) {
+		pending -= sizeof(uint32_t);
+		sum = sum + p[i++];
+	}
+
+	if (pending >= sizeof(uint64_t) * 2) {
+		const uint64_t *p64 = (const uint64_t *)(p + i);
+		uint64_t sum64 = 0U;
+
+		while (pending >= sizeof(uint64_t) * 2) {
+			uint64_t word_a = p64[0];
+			uint64_t word_b = p64[1];
+
+			pending -= sizeof(uint64_t) * 2;
+			sum64 += word_a;
+			sum64 += (sum64 < word_a);
+			sum64 += word_b;
+			sum64 += (sum64 < word_b);
+			p64 += 2;
+			i += 4;
+		}
+
+		/* Fold to 32 bits first, so adding it to sum cannot overflow */
+		sum64 = (sum64 & 0xffffffff) + (sum64 >> 32);
+		sum64 = (sum64 & 0xffffffff) + (sum64 >> 32);
+		sum += sum64;
+	}
+#else
 	/* Do loop unrolling for the very large data sets */
 	while (pending >= sizeof(uint32_t) * 4) {
 		uint64_t sum_a = p[i];
@@ -581,6 +647,7 @@ uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len)
 		i += 4;
 		sum += sum_a + sum_b;
 	}
+#endif
 	while (pending >= sizeof(uint32_t)) {
 		pending -= sizeof(uint32_t);
 		sum = sum + p[i++];
@@ -610,6 +677,53 @@ uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len)
 	}
 }
 
+static inline uint16_t chksum_add(uint16_t sum_a, uint16_t sum_b)
+{
+	uint32_t sum = (uint32_t)sum_a + sum_b;
+
+	return (sum & 0xffff) + (sum >> 16);
+}
+
+/* Same as calc_chksum() for data at an even offset of the checksummed area,
+ * whatever its address, while copying it to dst in the same pass.
+ */
+uint16_t calc_chksum_copy(uint16_t sum_in, uint8_t *dst, const uint8_t *src, size_t len)
+{
+	uint64_t sum = 0U;
+
+	for (; len >= sizeof(uint32_t); len -= sizeof(uint32_t)) {
+		uint32_t word = UNALIGNED_GET((const uint32_t *)src);
+
+		UNALIGNED_PUT(word, (uint32_t *)dst);
+		sum += word;
+		src += sizeof(uint32_t);
+		dst += sizeof(uint32_t);
+	}
+
+	if (len >= sizeof(uint16_t)) {
+		uint16_t half = UNALIGNED_GET((const uint16_t *)src);
+
+		UNALIGNED_PUT(half, (uint16_t *)dst);
+		sum += half;
+		src += sizeof(uint16_t);
+		dst += sizeof(uint16_t);
+		len -= sizeof(uint16_t);
+	}
+
+	if (len == 1) {
+		/* A last odd byte is the high byte of its 16-bit word */
+		*dst = *src;
+		sum += CHECKSUM_BIG_ENDIAN ? ((uint16_t)*src << 8) : *src;
+	}
+
+	while (sum >> 16) {
+		sum = (sum & 0xffff) + (sum >> 16);
+	}
+
+	/* The words were summed in memory order, sum_in is in host order */
+	return chksum_add(sum_in, CHECKSUM_BIG_ENDIAN ? (uint16_t)sum : BSWAP_16((uint16_t)sum));
+}
+
 static inline uint16_t pkt_calc_chksum(struct net_pkt *pkt, uint16_t sum)
 {
 	struct net_pkt_cursor *cur = &pkt->cursor;
@@ -685,7 +799,21 @@ uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto)
 	sum = calc_chksum(sum, pkt->cursor.pos, len);
 	net_pkt_skip(pkt, len + net_pkt_ip_opts_len(pkt));
 
-	sum = pkt_calc_chksum(pkt, sum);
+	if (proto == IPPROTO_UDP && net_pkt_has_payload_chksum(pkt)) {
+		/* The payload was summed when it was written */
+		NET_PKT_DATA_ACCESS_DEFINE(udp_access, struct net_udp_hdr);
+		struct net_udp_hdr *udp_hdr;
+
+		udp_hdr = (struct net_udp_hdr *)net_pkt_get_data(pkt, &udp_access);
+		if (udp_hdr != NULL) {
+			sum = calc_chksum(sum, (uint8_t *)udp_hdr, sizeof(*udp_hdr));
+			sum = chksum_add(sum, net_pkt_payload_chksum(pkt));
+		} else {
+			sum = pkt_calc_chksum(pkt, sum);
+		}
+	} else {
+		sum = pkt_calc_chksum(pkt, sum);
+	}
 
 	sum = (sum == 0U) ? 0xffff : htons(sum);
 
@@ -28,6 +28,7 @@ LOG_MODULE_REGISTER(net_ethernet, CONFIG_NET_L2_ETHERNET_LOG_LEVEL);
 #include "ipv6.h"
 #include "ipv4.h"
 #include "bridge.h"
+#include "tcp_internal.h"
 
 #define NET_BUF_TIMEOUT K_MSEC(100)
 
@@ -601,6 +602,42 @@ static void ethernet_remove_l2_header(struct net_pkt *pkt)
 	net_pkt_frag_unref(buf);
 }
 
+static int ethernet_send(struct net_if *iface, struct net_pkt *pkt);
+
+/* Software segmentation of a TCP super packet for devices without TSO */
+static int ethernet_send_gso(struct net_if *iface, struct net_pkt *pkt)
+{
+	struct net_pkt *seg;
+	sys_slist_t segs;
+	int sent = 0;
+	int ret;
+
+	ret = net_tcp_gso_segment(pkt, &segs);
+	if (ret < 0) {
+		NET_DBG("Cannot segment GSO pkt %p (%d)", pkt, ret);
+		return ret;
+	}
+
+	while ((seg = net_pkt_list_get(&segs)) != NULL) {
+		ret = ethernet_send(iface, seg);
+		if (ret < 0) {
+			net_pkt_unref(seg);
+			continue;
+		}
+
+		sent += ret;
+	}
+
+	if (sent == 0) {
+		/* Nothing went out, let the caller drop the super packet */
+		return ret;
+	}
+
+	net_pkt_unref(pkt);
+
+	return sent;
+}
+
 static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 {
 	const struct ethernet_api *api = net_if_get_device(iface)->api;
@@ -614,6 +651,11 @@ static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 		goto error;
 	}
 
+	if (IS_ENABLED(CONFIG_NET_TCP_GSO) && net_pkt_gso_size(pkt) != 0U &&
+	    !(net_eth_get_hw_capabilities(iface) & ETHERNET_HW_TSO)) {
+		return ethernet_send_gso(iface, pkt);
+	}
+
 	if (IS_ENABLED(CONFIG_NET_ETHERNET_BRIDGE) &&
 	    net_pkt_is_l2_bridged(pkt)) {
 		net_pkt_cursor_init(pkt);
@@ -969,6 +1011,10 @@ void ethernet_init(struct net_if *iface)
 		ctx->ethernet_l2_flags |= NET_L2_PROMISC_MODE;
 	}
 
+	if (IS_ENABLED(CONFIG_NET_TCP_GSO)) {
+		ctx->ethernet_l2_flags |= NET_L2_TCP_GSO;
+	}
+
 #if defined(CONFIG_NET_NATIVE_IP) && !defined(CONFIG_NET_RAW_MODE)
 	if (net_eth_get_hw_capabilities(iface) & ETHERNET_HW_FILTERING) {
 		net_if_mcast_mon_register(&mcast_monitor, NULL, ethernet_mcast_monitor_cb);
@@ -24,6 +24,10 @@ LOG_MODULE_REGISTER(net_capture, CONFIG_NET_CAPTURE_LOG_LEVEL);
 #include "ipv6.h"
 #include "udp_internal.h"
 
+#if defined(CONFIG_NET_CAPTURE_FILTER)
+#include "capture_filter.h"
+#endif
+
 #define PKT_ALLOC_TIME K_MSEC(50)
 #define DEFAULT_PORT 4242
 
@@ -82,6 +86,24 @@ struct net_capture {
 	 */
 	struct sockaddr local;
 
+#if defined(CONFIG_NET_CAPTURE_FILTER)
+	/**
+	 * Filter program selecting the packets to capture.
+	 */
+	struct net_capture_filter_insn filter[CONFIG_NET_CAPTURE_FILTER_MAX_INSNS];
+
+	/**
+	 * Number of instructions in the filter, 0 if there is no filter.
+	 */
+	size_t filter_len;
+#endif
+
+	/**
+	 * Maximum number of bytes to capture from each packet, 0 if not
+	 * limited.
+	 */
+	size_t snaplen;
+
 	/**
 	 * Is this context setup already
 	 */
@@ -456,6 +478,10 @@ static int capture_cleanup(const struct device *dev)
 	(void)cleanup_iface(ctx->tunnel_iface, &ctx->local);
 
 	ctx->tunnel_iface = NULL;
+	ctx->snaplen = 0;
+#if defined(CONFIG_NET_CAPTURE_FILTER)
+	ctx->filter_len = 0;
+#endif
 	ctx->in_use = false;
 
 	return 0;
@@ -508,6 +534,89 @@ static int capture_disable(const struct device *dev)
 	return 0;
 }
 
+#if defined(CONFIG_NET_CAPTURE_FILTER)
+int net_capture_filter_set(const struct device *dev,
+			   const struct net_capture_filter_insn *prog,
+			   size_t count)
+{
+	struct net_capture *ctx = dev->data;
+	int ret;
+
+	if (prog != NULL) {
+		if (count > ARRAY_SIZE(ctx->filter)) {
+			return -ENOMEM;
+		}
+
+		ret = net_capture_filter_check(prog, count);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	k_mutex_lock(&lock, K_FOREVER);
+
+	if (prog != NULL) {
+		memcpy(ctx->filter, prog, count * sizeof(prog[0]));
+		ctx->filter_len = count;
+	} else {
+		ctx->filter_len = 0;
+	}
+
+	k_mutex_unlock(&lock);
+
+	return 0;
+}
+#endif /* CONFIG_NET_CAPTURE_FILTER */
+
+int net_capture_snaplen_set(const struct device *dev, size_t snaplen)
+{
+	struct net_capture *ctx = dev->data;
+
+	k_mutex_lock(&lock, K_FOREVER);
+	ctx->snaplen = snaplen;
+	k_mutex_unlock(&lock);
+
+	return 0;
+}
+
+/* Return how many bytes of the packet to capture, 0 if none */
+static size_t capture_len(struct net_capture *ctx, struct net_pkt *pkt)
+{
+	size_t len = net_pkt_get_len(pkt);
+
+#if defined(CONFIG_NET_CAPTURE_FILTER)
+	if (ctx->filter_len > 0) {
+		len = MIN(len, net_capture_filter_run(ctx->filter, pkt));
+	}
+#endif
+
+	if (ctx->snaplen > 0) {
+		len = MIN(len, ctx->snaplen);
+	}
+
+	return len;
+}
+
+/* Drop the end of the captured packet, releasing the unused buffers */
+static void capture_truncate(struct net_pkt *pkt, size_t len)
+{
+	struct net_buf *buf;
+
+	for (buf = pkt->buffer; buf != NULL; buf = buf->frags) {
+		if (buf->len >= len) {
+			buf->len = len;
+			break;
+		}
+
+		len -= buf->len;
+	}
+
+	if (buf != NULL && buf->frags != NULL) {
+		net_buf_unref(buf->frags);
+		buf->frags = NULL;
+	}
+}
+
 int net_capture_pkt_with_status(struct net_if *iface, struct net_pkt *pkt)
 {
 	struct k_mem_slab *orig_slab;
@@ -515,6 +624,7 @@ int net_capture_pkt_with_status(struct net_if *iface, struct net_pkt *pkt)
 	sys_snode_t *sn, *sns;
 	bool skip_clone = false;
 	int ret = -ENOENT;
+	size_t len;
 
 	/* We must prevent to capture network packet that is already captured
 	 * in order to avoid recursion.
@@ -542,6 +652,21 @@ int net_capture_pkt_with_status(struct net_if *iface, struct net_pkt *pkt)
 			skip_clone = true;
 		}
 
+		len = capture_len(ctx, pkt);
+		if (len == 0) {
+			/* Filtered out. A cooked packet was created only for
+			 * capturing, so it is consumed here.
+			 */
+			if (skip_clone) {
+				net_pkt_unref(pkt);
+			} else {
+				net_pkt_set_cooked_mode(pkt, false);
+			}
+
+			ret = 0;
+			goto out;
+		}
+
 		if (skip_clone) {
 			captured = pkt;
 		} else {
@@ -560,6 +685,10 @@ int net_capture_pkt_with_status(struct net_if *iface, struct net_pkt *pkt)
 			}
 		}
 
+		if (len < net_pkt_get_len(captured)) {
+			capture_truncate(captured, len);
+		}
+
 		net_pkt_set_orig_iface(captured, iface);
 		net_pkt_set_iface(captured, ctx->tunnel_iface);
 		net_pkt_set_captured(pkt, true);
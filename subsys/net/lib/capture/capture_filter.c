@@ -0,0 +1,384 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_capture, CONFIG_NET_CAPTURE_LOG_LEVEL);
+
+#include <errno.h>
+#include <zephyr/sys/byteorder.h>
+
+#include "capture_filter.h"
+
+/* Instruction encoding, as in the classic BPF of Linux and BSD */
+#define BPF_CLASS(code) ((code) & 0x07)
+#define BPF_LD    0x00
+#define BPF_LDX   0x01
+#define BPF_ST    0x02
+#define BPF_STX   0x03
+#define BPF_ALU   0x04
+#define BPF_JMP   0x05
+#define BPF_RET   0x06
+#define BPF_MISC  0x07
+
+#define BPF_SIZE(code) ((code) & 0x18)
+#define BPF_W     0x00
+#define BPF_H     0x08
+#define BPF_B     0x10
+
+#define BPF_MODE(code) ((code) & 0xe0)
+#define BPF_IMM   0x00
+#define BPF_ABS   0x20
+#define BPF_IND   0x40
+#define BPF_MEM   0x60
+#define BPF_LEN   0x80
+#define BPF_MSH   0xa0
+
+#define BPF_OP(code) ((code) & 0xf0)
+#define BPF_ADD   0x00
+#define BPF_SUB   0x10
+#define BPF_MUL   0x20
+#define BPF_DIV   0x30
+#define BPF_OR    0x40
+#define BPF_AND   0x50
+#define BPF_LSH   0x60
+#define BPF_RSH   0x70
+#define BPF_NEG   0x80
+#define BPF_MOD   0x90
+#define BPF_XOR   0xa0
+
+#define BPF_JA    0x00
+#define BPF_JEQ   0x10
+#define BPF_JGT   0x20
+#define BPF_JGE   0x30
+#define BPF_JSET  0x40
+
+#define BPF_SRC(code) ((code) & 0x08)
+#define BPF_K     0x00
+#define BPF_X     0x08
+
+#define BPF_RVAL(code) ((code) & 0x18)
+#define BPF_A     0x10
+
+#define BPF_MISCOP(code) ((code) & 0xf8)
+#define BPF_TAX   0x00
+#define BPF_TXA   0x80
+
+/* Number of words of scratch memory */
+#define BPF_MEMWORDS 16
+
+static bool load_is_valid(uint16_t code, uint32_t k)
+{
+	switch (BPF_MODE(code)) {
+	case BPF_ABS:
+	case BPF_IND:
+		return BPF_SIZE(code) != 0x18;
+	case BPF_MEM:
+		return k < BPF_MEMWORDS;
+	case BPF_IMM:
+	case BPF_LEN:
+		return true;
+	case BPF_MSH:
+		/* Only for loading the header length in X */
+		return BPF_CLASS(code) == BPF_LDX && BPF_SIZE(code) == BPF_B;
+	default:
+		return false;
+	}
+}
+
+static bool alu_is_valid(uint16_t code, uint32_t k)
+{
+	switch (BPF_OP(code)) {
+	case BPF_DIV:
+	case BPF_MOD:
+		/* Division by a zero constant is refused up front */
+		return BPF_SRC(code) == BPF_X || k != 0U;
+	case BPF_ADD:
+	case BPF_SUB:
+	case BPF_MUL:
+	case BPF_OR:
+	case BPF_AND:
+	case BPF_LSH:
+	case BPF_RSH:
+	case BPF_NEG:
+	case BPF_XOR:
+		return true;
+	default:
+		return false;
+	}
+}
+
+int net_capture_filter_check(const struct net_capture_filter_insn *prog, size_t count)
+{
+	size_t i;
+
+	if (prog == NULL || count == 0) {
+		return -EINVAL;
+	}
+
+	for (i = 0; i < count; i++) {
+		const struct net_capture_filter_insn *insn = &prog[i];
+		/* Number of instructions after this one */
+		size_t left = count - i - 1;
+		bool valid;
+
+		switch (BPF_CLASS(insn->code)) {
+		case BPF_LD:
+		case BPF_LDX:
+			valid = load_is_valid(insn->code, insn->k);
+			break;
+		case BPF_ST:
+		case BPF_STX:
+			valid = insn->k < BPF_MEMWORDS;
+			break;
+		case BPF_ALU:
+			valid = alu_is_valid(insn->code, insn->k);
+			break;
+		case BPF_JMP:
+			/* Jumps only go forward, so the program always ends */
+			if (BPF_OP(insn->code) == BPF_JA) {
+				valid = insn->k < left;
+			} else {
+				valid = BPF_OP(insn->code) <= BPF_JSET &&
+					insn->jt < left && insn->jf < left;
+			}
+			break;
+		case BPF_RET:
+			valid = BPF_RVAL(insn->code) != 0x18;
+			break;
+		case BPF_MISC:
+			valid = BPF_MISCOP(insn->code) == BPF_TAX ||
+				BPF_MISCOP(insn->code) == BPF_TXA;
+			break;
+		default:
+			valid = false;
+			break;
+		}
+
+		if (!valid) {
+			NET_DBG("Invalid instruction %zu (code 0x%04x)", i, insn->code);
+			return -EINVAL;
+		}
+	}
+
+	/* The last instruction must not fall through */
+	if (BPF_CLASS(prog[count - 1].code) != BPF_RET) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/* Read bytes of the packet without touching its cursor, as the packet is
+ * still on its way through the stack.
+ */
+static bool pkt_read(struct net_pkt *pkt, uint32_t offset, uint8_t *data, size_t len)
+{
+	struct net_buf *buf = pkt->buffer;
+
+	while (buf != NULL && offset >= buf->len) {
+		offset -= buf->len;
+		buf = buf->frags;
+	}
+
+	while (len > 0 && buf != NULL) {
+		size_t chunk = MIN(len, buf->len - offset);
+
+		memcpy(data, buf->data + offset, chunk);
+		data += chunk;
+		len -= chunk;
+		offset = 0;
+		buf = buf->frags;
+	}
+
+	return len == 0;
+}
+
+static bool pkt_load(struct net_pkt *pkt, uint16_t size, uint32_t offset, uint32_t *val)
+{
+	uint8_t data[sizeof(uint32_t)];
+
+	switch (size) {
+	case BPF_W:
+		if (!pkt_read(pkt, offset, data, 4)) {
+			return false;
+		}
+
+		*val = sys_get_be32(data);
+		return true;
+	case BPF_H:
+		if (!pkt_read(pkt, offset, data, 2)) {
+			return false;
+		}
+
+		*val = sys_get_be16(data);
+		return true;
+	default:
+		if (!pkt_read(pkt, offset, data, 1)) {
+			return false;
+		}
+
+		*val = data[0];
+		return true;
+	}
+}
+
+uint32_t net_capture_filter_run(const struct net_capture_filter_insn *prog,
+				struct net_pkt *pkt)
+{
+	uint32_t mem[BPF_MEMWORDS] = { 0 };
+	uint32_t a = 0U;
+	uint32_t x = 0U;
+	uint32_t val;
+
+	for (;; prog++) {
+		uint16_t code = prog->code;
+		uint32_t k = prog->k;
+
+		switch (BPF_CLASS(code)) {
+		case BPF_LD:
+			switch (BPF_MODE(code)) {
+			case BPF_IMM:
+				a = k;
+				break;
+			case BPF_LEN:
+				a = net_pkt_get_len(pkt);
+				break;
+			case BPF_MEM:
+				a = mem[k];
+				break;
+			case BPF_ABS:
+			case BPF_IND:
+				if (BPF_MODE(code) == BPF_IND) {
+					k += x;
+				}
+
+				/* Reading past the end rejects the packet */
+				if (!pkt_load(pkt, BPF_SIZE(code), k, &a)) {
+					return 0U;
+				}
+				break;
+			}
+			break;
+
+		case BPF_LDX:
+			switch (BPF_MODE(code)) {
+			case BPF_IMM:
+				x = k;
+				break;
+			case BPF_LEN:
+				x = net_pkt_get_len(pkt);
+				break;
+			case BPF_MEM:
+				x = mem[k];
+				break;
+			case BPF_MSH:
+				if (!pkt_load(pkt, BPF_B, k, &val)) {
+					return 0U;
+				}
+
+				x = (val & 0x0f) * 4U;
+				break;
+			}
+			break;
+
+		case BPF_ST:
+			mem[k] = a;
+			break;
+
+		case BPF_STX:
+			mem[k] = x;
+			break;
+
+		case BPF_ALU:
+			val = BPF_SRC(code) == BPF_X ? x : k;
+
+			switch (BPF_OP(code)) {
+			case BPF_ADD:
+				a += val;
+				break;
+			case BPF_SUB:
+				a -= val;
+				break;
+			case BPF_MUL:
+				a *= val;
+				break;
+			case BPF_DIV:
+				if (val == 0U) {
+					return 0U;
+				}
+
+				a /= val;
+				break;
+			case BPF_MOD:
+				if (val == 0U) {
+					return 0U;
+				}
+
+				a %= val;
+				break;
+			case BPF_OR:
+				a |= val;
+				break;
+			case BPF_AND:
+				a &= val;
+				break;
+			case BPF_LSH:
+				a = val < 32U ? a << val : 0U;
+				break;
+			case BPF_RSH:
+				a = val < 32U ? a >> val : 0U;
+				break;
+			case BPF_NEG:
+				a = -a;
+				break;
+			case BPF_XOR:
+				a ^= val;
+				break;
+			}
+			break;
+
+		case BPF_JMP:
+			val = BPF_SRC(code) == BPF_X ? x : k;
+
+			switch (BPF_OP(code)) {
+			case BPF_JA:
+				prog += k;
+				break;
+			case BPF_JEQ:
+				prog += (a == val) ? prog->jt : prog->jf;
+				break;
+			case BPF_JGT:
+				prog += (a > val) ? prog->jt : prog->jf;
+				break;
+			case BPF_JGE:
+				prog += (a >= val) ? prog->jt : prog->jf;
+				break;
+			case BPF_JSET:
+				prog += (a & val) ? prog->jt : prog->jf;
+				break;
+			}
+			break;
+
+		case BPF_RET:
+			switch (BPF_RVAL(code)) {
+			case BPF_K:
+				return k;
+			case BPF_X:
+				return x;
+			default:
+				return a;
+			}
+
+		case BPF_MISC:
+			if (BPF_MISCOP(code) == BPF_TAX) {
+				x = a;
+			} else {
+				a = x;
+			}
+			break;
+		}
+	}
+}
@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Classic BPF interpreter used for filtering the captured packets */
+
+#include <zephyr/kernel.h>
+#include <zephyr/types.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/capture.h>
+
+/* Return 0 if the program can be run safely, -EINVAL otherwise. */
+int net_capture_filter_check(const struct net_capture_filter_insn *prog, size_t count);
+
+/* Run a checked program on the packet. Return the number of bytes of the
+ * packet to capture, 0 if the packet is not to be captured.
+ */
+uint32_t net_capture_filter_run(const struct net_capture_filter_insn *prog,
+				struct net_pkt *pkt);
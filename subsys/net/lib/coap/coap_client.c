@@ -68,6 +68,9 @@ static void reset_internal_request(struct coap_client_internal_request *request)
 	request->last_id = 0;
 	request->last_response_id = -1;
 	reset_block_contexts(request);
+#if CONFIG_COAP_CLIENT_BLOCK2_WINDOW > 1
+	request->blk2.active = false;
+#endif
 }
 
 static int coap_client_schedule_poll(struct coap_client *client, int sock,
@@ -401,6 +404,286 @@ static void report_callback_error(struct coap_client_internal_request *internal_
 	}
 }
 
+#if CONFIG_COAP_CLIENT_BLOCK2_WINDOW > 1
+static int block2_window_send(struct coap_client *client,
+			      struct coap_client_internal_request *internal_req,
+			      struct coap_client_block2_slot *slot, bool resend)
+{
+	struct coap_transmission_parameters params = internal_req->pending.params;
+	size_t current = internal_req->recv_blk_ctx.current;
+	int ret;
+
+	k_mutex_lock(&client->send_mutex, K_FOREVER);
+
+	/* All the blocks are requested with the same token, and told apart by number */
+	internal_req->last_id = resend ? slot->pending.id : coap_next_id();
+	internal_req->recv_blk_ctx.current =
+		slot->block_num * coap_block_size_to_bytes(internal_req->recv_blk_ctx.block_size);
+
+	ret = coap_client_init_request(client, &internal_req->coap_request, internal_req, true);
+	internal_req->recv_blk_ctx.current = current;
+	if (ret < 0) {
+		LOG_ERR("Error creating a CoAP request");
+		goto unlock;
+	}
+
+	if (!resend) {
+		ret = coap_pending_init(&slot->pending, &internal_req->request, &client->address,
+					&params);
+		if (ret < 0) {
+			LOG_ERR("Error creating pending");
+			goto unlock;
+		}
+
+		coap_pending_cycle(&slot->pending);
+	}
+
+	ret = send_request(client->fd, internal_req->request.data, internal_req->request.offset,
+			   0, &client->address, client->socklen);
+	if (ret < 0) {
+		LOG_ERR("Error sending a CoAP request");
+	} else {
+		ret = 0;
+	}
+
+unlock:
+	k_mutex_unlock(&client->send_mutex);
+
+	return ret;
+}
+
+/* Request the blocks of the window not requested yet */
+static int block2_window_fill(struct coap_client *client,
+			      struct coap_client_internal_request *internal_req)
+{
+	struct coap_client_block2_window *win = &internal_req->blk2;
+	int ret;
+
+	while (win->next < win->expected + CONFIG_COAP_CLIENT_BLOCK2_WINDOW &&
+	       win->next < win->end) {
+		struct coap_client_block2_slot *slot =
+			&win->slots[win->next % CONFIG_COAP_CLIENT_BLOCK2_WINDOW];
+
+		slot->block_num = win->next;
+		slot->requested = true;
+		slot->received = false;
+
+		ret = block2_window_send(client, internal_req, slot, false);
+		if (ret < 0) {
+			return ret;
+		}
+
+		win->next++;
+	}
+
+	return 1;
+}
+
+static bool block2_window_start(struct coap_client_internal_request *internal_req)
+{
+	struct coap_client_block2_window *win = &internal_req->blk2;
+	uint16_t block_len = coap_block_size_to_bytes(internal_req->recv_blk_ctx.block_size);
+
+	if (internal_req->is_observe || internal_req->send_blk_ctx.total_size > 0 ||
+	    block_len > CONFIG_COAP_CLIENT_BLOCK_SIZE) {
+		return false;
+	}
+
+	win->expected = internal_req->recv_blk_ctx.current / block_len;
+	win->next = win->expected;
+	win->end = UINT32_MAX;
+	win->active = true;
+
+	ARRAY_FOR_EACH_PTR(win->slots, slot) {
+		slot->requested = false;
+		slot->received = false;
+	}
+
+	return true;
+}
+
+static bool block2_window_callback(struct coap_client_internal_request *internal_req,
+				   int16_t code, const uint8_t *payload, size_t len,
+				   bool last_block)
+{
+	if (internal_req->coap_request.cb) {
+		if (!atomic_set(&internal_req->in_callback, 1)) {
+			internal_req->coap_request.cb(code, internal_req->offset, payload, len,
+						      last_block,
+						      internal_req->coap_request.user_data);
+			atomic_clear(&internal_req->in_callback);
+		}
+
+		if (!internal_req->request_ongoing) {
+			/* User callback must have called coap_client_cancel_requests(). */
+			return false;
+		}
+	}
+
+	internal_req->offset += len;
+
+	return true;
+}
+
+static struct coap_client_block2_slot *
+block2_window_slot_by_id(struct coap_client_block2_window *win, uint16_t id)
+{
+	ARRAY_FOR_EACH_PTR(win->slots, slot) {
+		if (slot->requested && !slot->received && slot->pending.id == id) {
+			return slot;
+		}
+	}
+
+	return NULL;
+}
+
+/* Handle a response while blocks are requested ahead. Returns 0 once the transfer is over,
+ * 1 if more blocks are expected and a negative error code on failure.
+ */
+static int block2_window_response(struct coap_client *client,
+				  struct coap_client_internal_request *internal_req,
+				  const struct coap_packet *response)
+{
+	struct coap_client_block2_window *win = &internal_req->blk2;
+	int block_option = coap_get_option_int(response, COAP_OPTION_BLOCK2);
+	uint8_t code = coap_header_get_code(response);
+	struct coap_client_block2_slot *slot;
+	const uint8_t *payload;
+	uint16_t payload_len;
+	uint32_t block_num;
+
+	payload = coap_packet_get_payload(response, &payload_len);
+
+	if (block_option < 0 ||
+	    GET_BLOCK_SIZE(block_option) != internal_req->recv_blk_ctx.block_size) {
+		/* Not a block of the transfer. As its size isn't known upfront, blocks past
+		 * its end may have been requested, those fail without ending it.
+		 */
+		slot = NULL;
+		if (coap_header_get_type(response) == COAP_TYPE_ACK) {
+			slot = block2_window_slot_by_id(win, coap_header_get_id(response));
+		}
+
+		if (slot == NULL || slot->block_num == win->expected) {
+			block2_window_callback(internal_req, code, payload, payload_len, true);
+			return 0;
+		}
+
+		coap_pending_clear(&slot->pending);
+		slot->requested = false;
+
+		if (slot->block_num < win->end) {
+			win->end = slot->block_num;
+			win->end_code = code;
+		}
+
+		return 1;
+	}
+
+	block_num = GET_BLOCK_NUM(block_option);
+	if (block_num < win->expected || block_num >= win->next) {
+		LOG_DBG("Block %u out of the window, dropping", block_num);
+		return 1;
+	}
+
+	slot = &win->slots[block_num % CONFIG_COAP_CLIENT_BLOCK2_WINDOW];
+	if (slot->block_num != block_num || !slot->requested || slot->received) {
+		LOG_DBG("Duplicate block %u, dropping", block_num);
+		return 1;
+	}
+
+	coap_pending_clear(&slot->pending);
+	slot->last = !GET_MORE(block_option);
+
+	if (slot->last && block_num < win->end) {
+		win->end = block_num + 1;
+	}
+
+	if (block_num != win->expected) {
+		/* Keep it until the preceding blocks are received */
+		if (payload_len > sizeof(slot->payload)) {
+			LOG_ERR("Block %u too large", block_num);
+			return -EMSGSIZE;
+		}
+
+		memcpy(slot->payload, payload, payload_len);
+		slot->len = payload_len;
+		slot->received = true;
+
+		return 1;
+	}
+
+	/* Pass the block on, followed by the ones received ahead of it */
+	while (true) {
+		bool last_block = slot->last;
+
+		if (!block2_window_callback(internal_req, code, payload, payload_len,
+					    last_block)) {
+			return 0;
+		}
+
+		slot->requested = false;
+		slot->received = false;
+		win->expected++;
+
+		if (last_block) {
+			return 0;
+		}
+
+		if (win->expected >= win->end) {
+			/* The request of the next block failed */
+			block2_window_callback(internal_req, win->end_code, NULL, 0, true);
+			return 0;
+		}
+
+		slot = &win->slots[win->expected % CONFIG_COAP_CLIENT_BLOCK2_WINDOW];
+		if (!slot->received || slot->block_num != win->expected) {
+			break;
+		}
+
+		payload = slot->payload;
+		payload_len = slot->len;
+	}
+
+	return block2_window_fill(client, internal_req);
+}
+
+static int block2_window_resend(struct coap_client *client,
+				struct coap_client_internal_request *internal_req)
+{
+	struct coap_client_block2_window *win = &internal_req->blk2;
+	int64_t now = k_uptime_get();
+	int ret = 0;
+
+	if (!internal_req->request_ongoing || !win->active) {
+		return 0;
+	}
+
+	ARRAY_FOR_EACH_PTR(win->slots, slot) {
+		if (!slot->requested || slot->received || slot->pending.timeout == 0 ||
+		    slot->pending.timeout > now - slot->pending.t0) {
+			continue;
+		}
+
+		if (!coap_pending_cycle(&slot->pending)) {
+			LOG_ERR("Timeout for block %u, no more retries left", slot->block_num);
+			report_callback_error(internal_req, -ETIMEDOUT);
+			internal_req->request_ongoing = false;
+			return -ETIMEDOUT;
+		}
+
+		LOG_WRN("Timeout for block %u, retrying send", slot->block_num);
+
+		ret = block2_window_send(client, internal_req, slot, true);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return ret;
+}
+#endif /* CONFIG_COAP_CLIENT_BLOCK2_WINDOW > 1 */
+
 static bool timeout_expired(struct coap_client_internal_request *internal_req)
 {
 	if (internal_req->pending.timeout == 0) {
@@ -460,6 +743,11 @@ static int coap_client_resend_handler(void)
 			if (timeout_expired(&clients[i]->requests[j])) {
 				ret = resend_request(clients[i], &clients[i]->requests[j]);
 			}
+#if CONFIG_COAP_CLIENT_BLOCK2_WINDOW > 1
+			if (block2_window_resend(clients[i], &clients[i]->requests[j]) < 0) {
+				ret = -ETIMEDOUT;
+			}
+#endif
 		}
 	}
 
@@ -755,6 +1043,17 @@ static int handle_response(struct coap_client *client, const struct coap_packet
 		coap_pending_clear(&internal_req->pending);
 	}
 
+#if CONFIG_COAP_CLIENT_BLOCK2_WINDOW > 1
+	if (internal_req->blk2.active) {
+		ret = block2_window_response(client, internal_req, response);
+		if (ret > 0) {
+			return ret;
+		}
+
+		goto fail;
+	}
+#endif
+
 	/* Check if block2 exists */
 	block_option = coap_get_option_int(response, COAP_OPTION_BLOCK2);
 	if (block_option > 0) {
@@ -810,6 +1109,16 @@ static int handle_response(struct coap_client *client, const struct coap_packet
 
 	/* If this wasn't last block, send the next request */
 	if (blockwise_transfer && !last_block) {
+#if CONFIG_COAP_CLIENT_BLOCK2_WINDOW > 1
+		if (block_option > 0 && block2_window_start(internal_req)) {
+			ret = block2_window_fill(client, internal_req);
+			if (ret > 0) {
+				return ret;
+			}
+
+			goto fail;
+		}
+#endif
 		k_mutex_lock(&client->send_mutex, K_FOREVER);
 		ret = coap_client_init_request(client, &internal_req->coap_request, internal_req,
 					       false);
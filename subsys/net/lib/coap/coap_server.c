@@ -81,6 +81,263 @@ static inline void coap_server_free(void *ptr)
 #endif
 }
 
+#if defined(CONFIG_COAP_SERVER_RESOURCE_INDEX)
+BUILD_ASSERT(MAX_OBSERVERS < UINT16_MAX, "Too many observers to index");
+
+#define INDEX_HASH_OFFSET 2166136261U
+#define INDEX_HASH_PRIME  16777619U
+
+struct resource_index_entry {
+	uint32_t hash;
+	uint16_t res;
+};
+
+static struct resource_index_entry resource_index[CONFIG_COAP_SERVER_RESOURCE_INDEX_SIZE];
+static bool resource_index_built;
+
+/* FNV-1a */
+static uint32_t index_hash(uint32_t hash, const uint8_t *data, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ data[i]) * INDEX_HASH_PRIME;
+	}
+
+	return hash;
+}
+
+/* Segments are separated in the hash, so "ab" and "a/b" differ */
+static uint32_t index_hash_segment(uint32_t hash, const void *segment, size_t len)
+{
+	hash = (hash ^ '/') * INDEX_HASH_PRIME;
+
+	return index_hash(hash, segment, len);
+}
+
+static bool resource_is_wildcard(const struct coap_resource *resource)
+{
+	if (!IS_ENABLED(CONFIG_COAP_URI_WILDCARD)) {
+		return false;
+	}
+
+	for (const char * const *segment = resource->path; *segment != NULL; segment++) {
+		if (strlen(*segment) == 1 && (**segment == '+' || **segment == '#')) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static uint32_t resource_path_hash(const struct coap_resource *resource)
+{
+	uint32_t hash = INDEX_HASH_OFFSET;
+
+	for (const char * const *segment = resource->path; *segment != NULL; segment++) {
+		hash = index_hash_segment(hash, *segment, strlen(*segment));
+	}
+
+	return hash;
+}
+
+static uint32_t request_path_hash(const struct coap_option *options, uint8_t opt_num)
+{
+	uint32_t hash = INDEX_HASH_OFFSET;
+
+	for (uint8_t i = 0; i < opt_num; i++) {
+		if (options[i].delta == COAP_OPTION_URI_PATH) {
+			hash = index_hash_segment(hash, options[i].value, options[i].len);
+		}
+	}
+
+	return hash;
+}
+
+static void resource_index_build(void)
+{
+	size_t len = 0;
+
+	COAP_SERVICE_FOREACH(svc) {
+		struct coap_service_data *data = svc->data;
+		size_t count = COAP_SERVICE_RESOURCE_COUNT(svc);
+
+		if (count > ARRAY_SIZE(resource_index) - len) {
+			LOG_WRN("Resource index too small, increase "
+				"CONFIG_COAP_SERVER_RESOURCE_INDEX_SIZE");
+			return;
+		}
+
+		data->index_start = len;
+		data->index_wildcards = 0;
+		data->index_len = count;
+
+		/* Wildcard resources come first, in definition order */
+		for (size_t i = 0; i < count; i++) {
+			if (resource_is_wildcard(&svc->res_begin[i])) {
+				resource_index[len++] = (struct resource_index_entry){ .res = i };
+				data->index_wildcards++;
+			}
+		}
+
+		/* Followed by the others, sorted by hash then definition order */
+		for (size_t i = 0; i < count; i++) {
+			struct resource_index_entry entry = { .res = i };
+			size_t j = len;
+
+			if (resource_is_wildcard(&svc->res_begin[i])) {
+				continue;
+			}
+
+			entry.hash = resource_path_hash(&svc->res_begin[i]);
+
+			for (; j > data->index_start + data->index_wildcards &&
+			       resource_index[j - 1].hash > entry.hash; j--) {
+				resource_index[j] = resource_index[j - 1];
+			}
+
+			resource_index[j] = entry;
+			len++;
+		}
+	}
+
+	resource_index_built = true;
+}
+
+/* Narrow down the resources a request is matched against to at most one */
+static void resource_index_find(const struct coap_service *service,
+				struct coap_option *options, uint8_t opt_num,
+				struct coap_resource **resources, size_t *resources_len)
+{
+	const struct coap_service_data *data = service->data;
+	const struct resource_index_entry *entries = &resource_index[data->index_start];
+	struct coap_resource *found = NULL;
+	size_t lo = data->index_wildcards;
+	size_t hi = data->index_len;
+	uint32_t hash;
+
+	if (!resource_index_built) {
+		return;
+	}
+
+	hash = request_path_hash(options, opt_num);
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (entries[mid].hash < hash) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	for (; lo < data->index_len && entries[lo].hash == hash; lo++) {
+		struct coap_resource *resource = &service->res_begin[entries[lo].res];
+
+		if (coap_uri_path_match(resource->path, options, opt_num)) {
+			found = resource;
+			break;
+		}
+	}
+
+	/* A wildcard resource defined before the match takes precedence */
+	for (size_t i = 0; i < data->index_wildcards; i++) {
+		struct coap_resource *resource = &service->res_begin[entries[i].res];
+
+		if (found != NULL && resource > found) {
+			break;
+		}
+
+		if (coap_uri_path_match(resource->path, options, opt_num)) {
+			found = resource;
+			break;
+		}
+	}
+
+	*resources = found;
+	*resources_len = (found != NULL) ? 1 : 0;
+}
+
+static uint16_t *observer_bucket(struct coap_service_data *data, const uint8_t *token,
+				 uint8_t tkl)
+{
+	return &data->observer_bucket[index_hash(INDEX_HASH_OFFSET, token, tkl) % MAX_OBSERVERS];
+}
+
+static void observer_index_add(const struct coap_service *service,
+			       struct coap_resource *resource,
+			       struct coap_observer *observer)
+{
+	struct coap_service_data *data = service->data;
+	uint16_t *bucket = observer_bucket(data, observer->token, observer->tkl);
+	size_t i = observer - data->observers;
+
+	data->observer_res[i] = resource - service->res_begin;
+	data->observer_next[i] = *bucket;
+	*bucket = i + 1;
+}
+
+static void observer_index_remove(struct coap_service_data *data,
+				  struct coap_observer *observer)
+{
+	uint16_t *link = observer_bucket(data, observer->token, observer->tkl);
+	uint16_t i = observer - data->observers + 1;
+
+	while (*link != 0) {
+		if (*link == i) {
+			*link = data->observer_next[i - 1];
+			return;
+		}
+
+		link = &data->observer_next[*link - 1];
+	}
+}
+#endif /* CONFIG_COAP_SERVER_RESOURCE_INDEX */
+
+/* Find an observer by token, and by address too if given */
+static struct coap_observer *coap_service_find_observer(const struct coap_service *service,
+							const struct sockaddr *addr,
+							const uint8_t *token, uint8_t tkl)
+{
+#if defined(CONFIG_COAP_SERVER_RESOURCE_INDEX)
+	struct coap_service_data *data = service->data;
+
+	if (tkl == 0U || tkl > COAP_TOKEN_MAX_LEN) {
+		return NULL;
+	}
+
+	for (uint16_t i = *observer_bucket(data, token, tkl); i != 0;
+	     i = data->observer_next[i - 1]) {
+		struct coap_observer *obs = &data->observers[i - 1];
+
+		if (addr != NULL ? coap_find_observer(obs, 1, addr, token, tkl) != NULL :
+				   coap_find_observer_by_token(obs, 1, token, tkl) != NULL) {
+			return obs;
+		}
+	}
+
+	return NULL;
+#else
+	if (addr != NULL) {
+		return coap_find_observer(service->data->observers, MAX_OBSERVERS, addr, token,
+					  tkl);
+	}
+
+	return coap_find_observer_by_token(service->data->observers, MAX_OBSERVERS, token, tkl);
+#endif
+}
+
+static void coap_service_free_observer(const struct coap_service *service,
+				       struct coap_observer *obs)
+{
+#if defined(CONFIG_COAP_SERVER_RESOURCE_INDEX)
+	observer_index_remove(service->data, obs);
+#else
+	ARG_UNUSED(service);
+#endif
+
+	memset(obs, 0, sizeof(*obs));
+}
+
 static int coap_service_remove_observer(const struct coap_service *service,
 					struct coap_resource *resource,
 					const struct sockaddr *addr,
@@ -88,13 +345,9 @@ static int coap_service_remove_observer(const struct coap_service *service,
 {
 	struct coap_observer *obs;
 
-	if (tkl > 0 && addr != NULL) {
-		/* Prefer addr+token to find the observer */
-		obs = coap_find_observer(service->data->observers, MAX_OBSERVERS, addr, token, tkl);
-	} else if (tkl > 0) {
-		/* Then try to find the observer by token */
-		obs = coap_find_observer_by_token(service->data->observers, MAX_OBSERVERS, token,
-						  tkl);
+	if (tkl > 0) {
+		/* Prefer addr+token to find the observer, then try by token only */
+		obs = coap_service_find_observer(service, addr, token, tkl);
 	} else if (addr != NULL) {
 		obs = coap_find_observer_by_addr(service->data->observers, MAX_OBSERVERS, addr);
 	} else {
@@ -106,15 +359,22 @@ static int coap_service_remove_observer(const struct coap_service *service,
 		return 0;
 	}
 
+#if defined(CONFIG_COAP_SERVER_RESOURCE_INDEX)
+	if (resource == NULL) {
+		resource = &service->res_begin[service->data->observer_res[obs -
+									   service->data->observers]];
+	}
+#endif
+
 	if (resource == NULL) {
 		COAP_SERVICE_FOREACH_RESOURCE(service, it) {
 			if (coap_remove_observer(it, obs)) {
-				memset(obs, 0, sizeof(*obs));
+				coap_service_free_observer(service, obs);
 				return 1;
 			}
 		}
 	} else if (coap_remove_observer(resource, obs)) {
-		memset(obs, 0, sizeof(*obs));
+		coap_service_free_observer(service, obs);
 		return 1;
 	}
 
@@ -214,8 +474,14 @@ static int coap_server_process(int sock_fd)
 
 		ret = coap_service_send(service, &response, &client_addr, client_addr_len, NULL);
 	} else {
-		ret = coap_handle_request_len(&request, service->res_begin,
-					      COAP_SERVICE_RESOURCE_COUNT(service),
+		struct coap_resource *resources = service->res_begin;
+		size_t resources_len = COAP_SERVICE_RESOURCE_COUNT(service);
+
+#if defined(CONFIG_COAP_SERVER_RESOURCE_INDEX)
+		resource_index_find(service, options, opt_num, &resources, &resources_len);
+#endif
+
+		ret = coap_handle_request_len(&request, resources, resources_len,
 					      options, opt_num, &client_addr, client_addr_len);
 
 		/* Translate errors to response codes */
@@ -638,8 +904,7 @@ int coap_resource_parse_observe(struct coap_resource *resource, const struct coa
 		struct coap_observer *observer;
 
 		/* RFC7641 section 4.1 - Check if the current observer already exists */
-		observer = coap_find_observer(service->data->observers, MAX_OBSERVERS, addr, token,
-					      tkl);
+		observer = coap_service_find_observer(service, addr, token, tkl);
 		if (observer != NULL) {
 			/* Client refresh */
 			goto unlock;
@@ -654,6 +919,9 @@ int coap_resource_parse_observe(struct coap_resource *resource, const struct coa
 
 		coap_observer_init(observer, request, addr);
 		coap_register_observer(resource, observer);
+#if defined(CONFIG_COAP_SERVER_RESOURCE_INDEX)
+		observer_index_add(service, resource, observer);
+#endif
 	} else if (ret == 1) {
 		ret = coap_service_remove_observer(service, resource, addr, token, tkl);
 		if (ret < 0) {
@@ -743,6 +1011,12 @@ static void coap_server_thread(void *p1, void *p2, void *p3)
 		}
 	}
 
+#if defined(CONFIG_COAP_SERVER_RESOURCE_INDEX)
+	(void)k_mutex_lock(&lock, K_FOREVER);
+	resource_index_build();
+	(void)k_mutex_unlock(&lock);
+#endif
+
 	COAP_SERVICE_FOREACH(svc) {
 		if (svc->flags & COAP_SERVICE_AUTOSTART) {
 			ret = coap_service_start(svc);
@@ -9,14 +9,186 @@
 
 LOG_MODULE_REGISTER(net_dns_cache, CONFIG_DNS_RESOLVER_LOG_LEVEL);
 
-static void dns_cache_clean(struct dns_cache const *cache);
+static void dns_cache_clean(struct dns_cache *cache);
+
+/* FNV-1a */
+static uint32_t dns_cache_hash(char const *query)
+{
+	uint32_t hash = 2166136261U;
+
+	while (*query != '\0') {
+		hash ^= (uint8_t)*query++;
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+static inline uint16_t *dns_cache_bucket(struct dns_cache *cache, uint32_t hash)
+{
+	return &cache->buckets[hash % cache->size];
+}
+
+static inline bool heap_less(struct dns_cache *cache, size_t a, size_t b)
+{
+	return sys_timepoint_cmp(cache->entries[cache->heap[a]].expiry,
+				 cache->entries[cache->heap[b]].expiry) < 0;
+}
+
+static void heap_swap(struct dns_cache *cache, size_t a, size_t b)
+{
+	uint16_t tmp = cache->heap[a];
+
+	cache->heap[a] = cache->heap[b];
+	cache->heap[b] = tmp;
+
+	cache->entries[cache->heap[a]].heap_pos = a;
+	cache->entries[cache->heap[b]].heap_pos = b;
+}
+
+static void heap_sift_up(struct dns_cache *cache, size_t pos)
+{
+	while (pos > 0 && heap_less(cache, pos, (pos - 1) / 2)) {
+		heap_swap(cache, pos, (pos - 1) / 2);
+		pos = (pos - 1) / 2;
+	}
+}
+
+static void heap_sift_down(struct dns_cache *cache, size_t pos)
+{
+	while (true) {
+		size_t smallest = pos;
+		size_t child = 2 * pos + 1;
+
+		if (child < cache->heap_len && heap_less(cache, child, smallest)) {
+			smallest = child;
+		}
+
+		if (child + 1 < cache->heap_len && heap_less(cache, child + 1, smallest)) {
+			smallest = child + 1;
+		}
+
+		if (smallest == pos) {
+			break;
+		}
+
+		heap_swap(cache, pos, smallest);
+		pos = smallest;
+	}
+}
+
+/* Takes a free entry, the caller must make sure the cache is not full. */
+static size_t dns_cache_alloc(struct dns_cache *cache)
+{
+	size_t pos = cache->heap_len++;
+
+	if (pos == cache->heap_alloc) {
+		/* Entries past heap_alloc have never been used */
+		cache->heap[pos] = cache->heap_alloc++;
+	}
+
+	cache->entries[cache->heap[pos]].heap_pos = pos;
+
+	return cache->heap[pos];
+}
+
+/* Unlinks the entry from its hash bucket and from the expiry heap. */
+static void dns_cache_release(struct dns_cache *cache, size_t index)
+{
+	struct dns_cache_entry *entry = &cache->entries[index];
+	uint16_t *link = dns_cache_bucket(cache, entry->hash);
+	size_t pos = entry->heap_pos;
+	size_t last = cache->heap_len - 1;
+
+	while (*link != index + 1) {
+		link = &cache->entries[*link - 1].next;
+	}
+	*link = entry->next;
+
+	/* Move the entry just past the heap, which makes it free. */
+	if (pos != last) {
+		heap_swap(cache, pos, last);
+	}
+	cache->heap_len--;
+
+	if (pos < cache->heap_len) {
+		uint16_t moved = cache->heap[pos];
+
+		heap_sift_up(cache, pos);
+		heap_sift_down(cache, cache->entries[moved].heap_pos);
+	}
+
+	entry->in_use = false;
+}
+
+/* Needs to be called when lock is already acquired */
+static void dns_cache_insert(struct dns_cache *cache, char const *query, uint32_t hash,
+			     struct dns_addrinfo const *addrinfo, uint32_t ttl, bool negative)
+{
+	struct dns_cache_entry *entry;
+	uint16_t *bucket;
+	size_t index;
+
+	if (cache->heap_len == cache->size) {
+		/* The root of the heap is the entry closest to expiry */
+		NET_DBG("Overwrite \"%s\"", cache->entries[cache->heap[0]].query);
+		dns_cache_release(cache, cache->heap[0]);
+	}
+
+	index = dns_cache_alloc(cache);
+	entry = &cache->entries[index];
+
+	strncpy(entry->query, query, CONFIG_DNS_RESOLVER_MAX_QUERY_LEN - 1);
+	entry->query[CONFIG_DNS_RESOLVER_MAX_QUERY_LEN - 1] = '\0';
+	if (addrinfo != NULL) {
+		entry->data = *addrinfo;
+	} else {
+		memset(&entry->data, 0, sizeof(entry->data));
+	}
+	entry->expiry = sys_timepoint_calc(K_SECONDS(ttl));
+	entry->hash = hash;
+	entry->negative = negative;
+	entry->in_use = true;
+
+	bucket = dns_cache_bucket(cache, hash);
+	entry->next = *bucket;
+	*bucket = index + 1;
+
+	heap_sift_up(cache, entry->heap_pos);
+}
+
+/* Needs to be called when lock is already acquired */
+static void dns_cache_remove_matching(struct dns_cache *cache, char const *query, uint32_t hash,
+				      bool negative_only)
+{
+	uint16_t link = *dns_cache_bucket(cache, hash);
+
+	while (link != 0) {
+		struct dns_cache_entry *entry = &cache->entries[link - 1];
+		size_t index = link - 1;
+
+		link = entry->next;
+
+		if (entry->hash != hash || strcmp(entry->query, query) != 0) {
+			continue;
+		}
+
+		if (negative_only && !entry->negative) {
+			continue;
+		}
+
+		dns_cache_release(cache, index);
+	}
+}
 
 int dns_cache_flush(struct dns_cache *cache)
 {
 	k_mutex_lock(cache->lock, K_FOREVER);
 	for (size_t i = 0; i < cache->size; i++) {
 		cache->entries[i].in_use = false;
+		cache->buckets[i] = 0;
 	}
+	cache->heap_len = 0;
 	k_mutex_unlock(cache->lock);
 
 	return 0;
@@ -25,9 +197,7 @@ int dns_cache_flush(struct dns_cache *cache)
 int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinfo const *addrinfo,
 		  uint32_t ttl)
 {
-	k_timepoint_t closest_to_expiry = sys_timepoint_calc(K_FOREVER);
-	size_t index_to_replace = 0;
-	bool found_empty = false;
+	uint32_t hash;
 
 	if (cache == NULL || query == NULL || addrinfo == NULL || ttl == 0) {
 		return -EINVAL;
@@ -40,32 +210,50 @@ int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinf
 		return -EINVAL;
 	}
 
+	hash = dns_cache_hash(query);
+
 	k_mutex_lock(cache->lock, K_FOREVER);
 
 	NET_DBG("Add \"%s\" with TTL %" PRIu32, query, ttl);
 
 	dns_cache_clean(cache);
 
-	for (size_t i = 0; i < cache->size; i++) {
-		if (!cache->entries[i].in_use) {
-			index_to_replace = i;
-			found_empty = true;
-			break;
-		} else if (sys_timepoint_cmp(closest_to_expiry, cache->entries[i].expiry) > 0) {
-			index_to_replace = i;
-			closest_to_expiry = cache->entries[i].expiry;
-		}
+	/* The name exists after all */
+	dns_cache_remove_matching(cache, query, hash, true);
+
+	dns_cache_insert(cache, query, hash, addrinfo, ttl, false);
+
+	k_mutex_unlock(cache->lock);
+
+	return 0;
+}
+
+int dns_cache_add_negative(struct dns_cache *cache, char const *query, uint32_t ttl)
+{
+	uint32_t hash;
+
+	if (cache == NULL || query == NULL || ttl == 0) {
+		return -EINVAL;
 	}
 
-	if (!found_empty) {
-		NET_DBG("Overwrite \"%s\"", cache->entries[index_to_replace].query);
+	if (strlen(query) >= CONFIG_DNS_RESOLVER_MAX_QUERY_LEN) {
+		NET_WARN("Query string to big to be processed %u >= "
+			 "CONFIG_DNS_RESOLVER_MAX_QUERY_LEN",
+			 strlen(query));
+		return -EINVAL;
 	}
 
-	strncpy(cache->entries[index_to_replace].query, query,
-		CONFIG_DNS_RESOLVER_MAX_QUERY_LEN - 1);
-	cache->entries[index_to_replace].data = *addrinfo;
-	cache->entries[index_to_replace].expiry = sys_timepoint_calc(K_SECONDS(ttl));
-	cache->entries[index_to_replace].in_use = true;
+	hash = dns_cache_hash(query);
+
+	k_mutex_lock(cache->lock, K_FOREVER);
+
+	NET_DBG("Add negative \"%s\" with TTL %" PRIu32, query, ttl);
+
+	dns_cache_clean(cache);
+
+	dns_cache_remove_matching(cache, query, hash, false);
+
+	dns_cache_insert(cache, query, hash, NULL, ttl, true);
 
 	k_mutex_unlock(cache->lock);
 
@@ -86,21 +274,20 @@ int dns_cache_remove(struct dns_cache *cache, char const *query)
 
 	dns_cache_clean(cache);
 
-	for (size_t i = 0; i < cache->size; i++) {
-		if (cache->entries[i].in_use && strcmp(cache->entries[i].query, query) == 0) {
-			cache->entries[i].in_use = false;
-		}
-	}
+	dns_cache_remove_matching(cache, query, dns_cache_hash(query), false);
 
 	k_mutex_unlock(cache->lock);
 
 	return 0;
 }
 
-int dns_cache_find(struct dns_cache const *cache, const char *query, struct dns_addrinfo *addrinfo,
+int dns_cache_find(struct dns_cache *cache, const char *query, struct dns_addrinfo *addrinfo,
 		   size_t addrinfo_array_len)
 {
 	size_t found = 0;
+	bool negative = false;
+	uint32_t hash;
+	uint16_t link;
 
 	NET_DBG("Find \"%s\"", query);
 	if (cache == NULL || query == NULL || addrinfo == NULL || addrinfo_array_len <= 0) {
@@ -113,22 +300,28 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, struct dns_
 		return -EINVAL;
 	}
 
+	hash = dns_cache_hash(query);
+
 	k_mutex_lock(cache->lock, K_FOREVER);
 
 	dns_cache_clean(cache);
 
-	for (size_t i = 0; i < cache->size; i++) {
-		if (!cache->entries[i].in_use) {
+	for (link = *dns_cache_bucket(cache, hash); link != 0;
+	     link = cache->entries[link - 1].next) {
+		struct dns_cache_entry *entry = &cache->entries[link - 1];
+
+		if (entry->hash != hash || strcmp(entry->query, query) != 0) {
 			continue;
 		}
-		if (strcmp(cache->entries[i].query, query) != 0) {
-			continue;
+		if (entry->negative) {
+			negative = true;
+			break;
 		}
 		if (found >= addrinfo_array_len) {
 			NET_WARN("Found \"%s\" but not enough space in provided buffer.", query);
 			found++;
 		} else {
-			addrinfo[found] = cache->entries[i].data;
+			addrinfo[found] = entry->data;
 			found++;
 			NET_DBG("Found \"%s\"", query);
 		}
@@ -136,6 +329,11 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, struct dns_
 
 	k_mutex_unlock(cache->lock);
 
+	if (negative) {
+		NET_DBG("\"%s\" cached as non-existent", query);
+		return -ENOENT;
+	}
+
 	if (found > addrinfo_array_len) {
 		return -ENOSR;
 	}
@@ -147,16 +345,11 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, struct dns_
 }
 
 /* Needs to be called when lock is already acquired */
-static void dns_cache_clean(struct dns_cache const *cache)
+static void dns_cache_clean(struct dns_cache *cache)
 {
-	for (size_t i = 0; i < cache->size; i++) {
-		if (!cache->entries[i].in_use) {
-			continue;
-		}
-
-		if (sys_timepoint_expired(cache->entries[i].expiry)) {
-			NET_DBG("Remove \"%s\"", cache->entries[i].query);
-			cache->entries[i].in_use = false;
-		}
+	while (cache->heap_len > 0 &&
+	       sys_timepoint_expired(cache->entries[cache->heap[0]].expiry)) {
+		NET_DBG("Remove \"%s\"", cache->entries[cache->heap[0]].query);
+		dns_cache_release(cache, cache->heap[0]);
 	}
 }
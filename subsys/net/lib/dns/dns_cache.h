@@ -22,12 +22,28 @@ struct dns_cache_entry {
 	char query[CONFIG_DNS_RESOLVER_MAX_QUERY_LEN];
 	struct dns_addrinfo data;
 	k_timepoint_t expiry;
+	/* Hash of the query string */
+	uint32_t hash;
+	/* Next entry in the same hash bucket, index + 1, 0 ends the chain */
+	uint16_t next;
+	/* Position of the entry in the expiry heap */
+	uint16_t heap_pos;
+	/* Entry caches a non-existent domain (NXDOMAIN) answer */
+	bool negative;
 	bool in_use;
 };
 
 struct dns_cache {
 	size_t size;
 	struct dns_cache_entry *entries;
+	/* Hash bucket heads, index + 1, 0 is an empty bucket */
+	uint16_t *buckets;
+	/* Entry indexes. The first heap_len ones form a min-heap ordered on
+	 * expiry, the following ones up to heap_alloc are free entries.
+	 */
+	uint16_t *heap;
+	size_t heap_len;
+	size_t heap_alloc;
 	struct k_mutex *lock;
 };
 
@@ -41,10 +57,16 @@ struct dns_cache {
  * @param name Name of the cache.
  */
 #define DNS_CACHE_DEFINE(name, cache_size)                                                         \
+	BUILD_ASSERT((cache_size) < UINT16_MAX, "Too many DNS cache entries");                    \
 	static K_MUTEX_DEFINE(name##_mutex);                                                       \
 	static struct dns_cache_entry name##_entries[cache_size];                                  \
-	static struct dns_cache name = {                                                           \
-		.entries = name##_entries, .size = cache_size, .lock = &name##_mutex};
+	static uint16_t name##_buckets[cache_size];                                                \
+	static uint16_t name##_heap[cache_size];                                                   \
+	static struct dns_cache name = {.entries = name##_entries,                                 \
+					.size = cache_size,                                        \
+					.buckets = name##_buckets,                                 \
+					.heap = name##_heap,                                       \
+					.lock = &name##_mutex};
 
 /**
  * @brief Flushes the dns cache removing all its entries.
@@ -71,6 +93,19 @@ int dns_cache_flush(struct dns_cache *cache);
 int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinfo const *addrinfo,
 		  uint32_t ttl);
 
+/**
+ * @brief Adds a negative entry to the dns cache, recording that the queried
+ * name does not exist (NXDOMAIN, see RFC 2308). Any cached addresses for the
+ * query are removed.
+ *
+ * @param cache Cache where the entry should be added.
+ * @param query Query which should be persisted in the cache.
+ * @param ttl Time to live for the entry in seconds.
+ * @retval 0 on success
+ * @retval On error, a negative value is returned.
+ */
+int dns_cache_add_negative(struct dns_cache *cache, char const *query, uint32_t ttl);
+
 /**
  * @brief Removes all entries with the given query
  *
@@ -93,8 +128,9 @@ int dns_cache_remove(struct dns_cache *cache, char const *query);
  * @retval On error a negative value is returned.
  * -ENOSR means there was not enough space in the addrinfo array to accommodate all cache hits the
  * array will however be filled with valid data.
+ * -ENOENT means the query is cached as a non-existent domain.
  */
-int dns_cache_find(struct dns_cache const *cache, const char *query, struct dns_addrinfo *addrinfo,
+int dns_cache_find(struct dns_cache *cache, const char *query, struct dns_addrinfo *addrinfo,
 		   size_t addrinfo_array_len);
 
 #endif /* ZEPHYR_INCLUDE_NET_DNS_CACHE_H_ */
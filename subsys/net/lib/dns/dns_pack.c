@@ -177,6 +177,56 @@ int dns_unpack_answer(struct dns_msg_t *dns_msg, int dname_ptr, uint32_t *ttl,
 	return 0;
 }
 
+int dns_unpack_negative_ttl(struct dns_msg_t *dns_msg, uint32_t *ttl)
+{
+	uint16_t offset = dns_msg->answer_offset;
+	int nscount = dns_header_nscount(dns_msg->msg);
+
+	for (int i = 0; i < nscount; i++) {
+		uint8_t *record = dns_msg->msg + offset;
+		uint32_t minimum;
+		int dname_len;
+		uint16_t len;
+
+		if (offset >= dns_msg->msg_size) {
+			return -EINVAL;
+		}
+
+		dname_len = skip_fqdn(record, dns_msg->msg_size - offset);
+		if (dname_len < 0) {
+			return dname_len;
+		}
+
+		/* type + class + ttl + rdlength, see RFC-1035 4.1.3. */
+		if (offset + dname_len + 2 + 2 + 4 + 2 > dns_msg->msg_size) {
+			return -EINVAL;
+		}
+
+		len = dns_answer_rdlength(dname_len, record);
+		if (offset + dname_len + 2 + 2 + 4 + 2 + len > dns_msg->msg_size) {
+			return -EINVAL;
+		}
+
+		if (dns_answer_type(dname_len, record) != DNS_RR_TYPE_SOA) {
+			offset += dname_len + 2 + 2 + 4 + 2 + len;
+			continue;
+		}
+
+		/* MINIMUM is the last field of the SOA RDATA */
+		if (len < DNS_TTL_LEN) {
+			return -EINVAL;
+		}
+
+		minimum = ntohl(UNALIGNED_GET((uint32_t *)(record + dname_len + 2 + 2 + 4 + 2 +
+							   len - DNS_TTL_LEN)));
+		*ttl = MIN((uint32_t)dns_answer_ttl(dname_len, record), minimum);
+
+		return 0;
+	}
+
+	return -ENOENT;
+}
+
 int dns_unpack_response_header(struct dns_msg_t *msg, int src_id)
 {
 	uint8_t *dns_header;
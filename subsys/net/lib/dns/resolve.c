@@ -72,6 +72,9 @@ NET_BUF_POOL_DEFINE(dns_qname_pool, DNS_RESOLVER_BUF_CTR,
 		    CONFIG_DNS_RESOLVER_MAX_QUERY_LEN,
 		    0, NULL);
 
+BUILD_ASSERT(CONFIG_DNS_NUM_CONCUR_QUERIES < UINT8_MAX,
+	     "Query slot index must fit in dns_pending_query.leader");
+
 #ifdef CONFIG_DNS_RESOLVER_CACHE
 DNS_CACHE_DEFINE(dns_cache, CONFIG_DNS_RESOLVER_CACHE_MAX_ENTRIES);
 #endif /* CONFIG_DNS_RESOLVER_CACHE */
@@ -576,6 +579,32 @@ static inline int get_cb_slot(struct dns_resolve_context *ctx)
 	return -ENOENT;
 }
 
+/* Find a query in progress for the same name and type, that the query in
+ * slot "idx" can wait for instead of sending its own.
+ *
+ * Must be invoked with context lock held.
+ */
+static int get_leader_slot(struct dns_resolve_context *ctx, int idx,
+			   const char *query, enum dns_query_type type)
+{
+	int i;
+
+	for (i = 0; i < CONFIG_DNS_NUM_CONCUR_QUERIES; i++) {
+		if (i == idx || ctx->queries[i].leader != 0 ||
+		    !check_query_active(&ctx->queries[i], false) ||
+		    ctx->queries[i].query == NULL) {
+			continue;
+		}
+
+		if (ctx->queries[i].query_type == type &&
+		    strcmp(ctx->queries[i].query, query) == 0) {
+			return i;
+		}
+	}
+
+	return -ENOENT;
+}
+
 /* Invoke the callback associated with a query slot, if still relevant.
  *
  * Must be invoked with context lock held.
@@ -594,6 +623,21 @@ static inline void invoke_query_callback(int status,
 	if (pending_query->query != NULL && pending_query->cb != NULL)  {
 		pending_query->cb(status, info, pending_query->user_data);
 	}
+
+	/* Queries for the same name that were coalesced into this one. */
+	if (pending_query->leader == 0 && pending_query->ctx != NULL) {
+		struct dns_resolve_context *ctx = pending_query->ctx;
+		int leader = pending_query - ctx->queries + 1;
+
+		for (int i = 0; i < CONFIG_DNS_NUM_CONCUR_QUERIES; i++) {
+			if (ctx->queries[i].leader == leader &&
+			    ctx->queries[i].query != NULL &&
+			    ctx->queries[i].cb != NULL) {
+				ctx->queries[i].cb(status, info,
+						   ctx->queries[i].user_data);
+			}
+		}
+	}
 }
 
 /* Release a query slot reserved by get_cb_slot().
@@ -606,6 +650,20 @@ static void release_query(struct dns_pending_query *pending_query)
 {
 	int busy = k_work_cancel_delayable(&pending_query->timer);
 
+	if (pending_query->leader == 0 && pending_query->ctx != NULL) {
+		struct dns_resolve_context *ctx = pending_query->ctx;
+		int leader = pending_query - ctx->queries + 1;
+
+		for (int i = 0; i < CONFIG_DNS_NUM_CONCUR_QUERIES; i++) {
+			if (ctx->queries[i].leader == leader &&
+			    check_query_active(&ctx->queries[i], false)) {
+				release_query(&ctx->queries[i]);
+			}
+		}
+	}
+
+	pending_query->leader = 0;
+
 	/* If the work item is no longer pending we're done. */
 	if (busy == 0) {
 		/* All done. */
@@ -882,6 +940,20 @@ query_known:
 		}
 	}
 
+#ifdef CONFIG_DNS_RESOLVER_CACHE
+	/* Cache the non-existent domain, if the server tells for how long,
+	 * see RFC 2308 ch. 5.
+	 */
+	if (items == 0 && CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL_MAX > 0 &&
+	    dns_header_rcode(dns_msg->msg) == DNS_HEADER_NAMEERROR &&
+	    dns_header_ancount(dns_msg->msg) == 0 &&
+	    ctx->queries[*query_idx].query != NULL &&
+	    dns_unpack_negative_ttl(dns_msg, &ttl) == 0) {
+		dns_cache_add_negative(&dns_cache, ctx->queries[*query_idx].query,
+				       MIN(ttl, CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL_MAX));
+	}
+#endif /* CONFIG_DNS_RESOLVER_CACHE */
+
 	if (items == 0) {
 		ret = DNS_EAI_NODATA;
 	} else {
@@ -1285,7 +1357,14 @@ int dns_resolve_name(struct dns_resolve_context *ctx,
 
 try_resolve:
 #ifdef CONFIG_DNS_RESOLVER_CACHE
-	ret = dns_cache_find(&dns_cache, query, cached_info, sizeof(cached_info));
+	ret = dns_cache_find(&dns_cache, query, cached_info, ARRAY_SIZE(cached_info));
+	if (ret == -ENOENT) {
+		/* The name is known not to exist */
+		cb(DNS_EAI_NODATA, NULL, user_data);
+
+		return 0;
+	}
+
 	if (ret > 0) {
 		/* The query was cached, no
 		 * need to continue further.
@@ -1319,9 +1398,29 @@ try_resolve:
 	ctx->queries[i].user_data = user_data;
 	ctx->queries[i].ctx = ctx;
 	ctx->queries[i].query_hash = 0;
+	ctx->queries[i].leader = 0;
 
 	k_work_init_delayable(&ctx->queries[i].timer, query_timeout);
 
+	ret = get_leader_slot(ctx, i, query, type);
+	if (ret >= 0) {
+		/* Same query is already in progress, share its result. */
+		ctx->queries[i].leader = ret + 1;
+		ctx->queries[i].id = sys_rand16_get();
+
+		if (dns_id) {
+			*dns_id = ctx->queries[i].id;
+		}
+
+		NET_DBG("DNS req %u waits for req %u", ctx->queries[i].id,
+			ctx->queries[ret].id);
+
+		(void)k_work_reschedule(&ctx->queries[i].timer, tout);
+
+		ret = 0;
+		goto quit;
+	}
+
 	dns_data = net_buf_alloc(&dns_msg_pool, ctx->buf_timeout);
 	if (!dns_data) {
 		ret = -ENOMEM;
@@ -10,6 +10,7 @@
 
 #include <stdbool.h>
 
+#include <zephyr/fs/fs.h>
 #include <zephyr/net/http/server.h>
 #include <zephyr/net/http/service.h>
 #include <zephyr/net/http/status.h>
@@ -39,6 +40,12 @@ int enter_http_done_state(struct http_client_ctx *client);
 struct http_resource_detail *get_resource_detail(const char *path, int *len, bool is_ws);
 int http_server_sendall(struct http_client_ctx *client, const void *buf, size_t len);
 void http_client_timer_restart(struct http_client_ctx *client);
+bool http_server_accepts_gzip(const char *value, size_t len);
+int http_server_static_fs_open(struct http_resource_detail_static_fs *fs_detail,
+			       struct http_client_ctx *client, struct fs_file_t *file,
+			       size_t *len, bool *gzip);
+bool http_server_dynamic_hold(struct http_resource_detail_dynamic *dynamic_detail,
+			      struct http_client_ctx *client);
 
 /* TODO Could be static, but currently used in tests. */
 int parse_http_frame_header(struct http_client_ctx *client);
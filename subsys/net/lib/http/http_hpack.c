@@ -470,7 +470,7 @@ static int hpack_integer_encode(uint8_t *buf, size_t buflen, int value,
 			return -ENOBUFS;
 		}
 
-		*buf = (uint8_t)((value % 128) + 128);
+		*buf++ = (uint8_t)((value % 128) + 128);
 		len++;
 		value /= 128;
 	}
@@ -631,3 +631,203 @@ int http_hpack_encode_header(uint8_t *buf, size_t buflen,
 
 	return len;
 }
+
+#if defined(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE)
+#define HPACK_ENTRY_OVERHEAD 32
+#define HPACK_DYNAMIC_INDEX_FIRST (HTTP_SERVER_HPACK_WWW_AUTHENTICATE + 1)
+
+static size_t hpack_entry_size(size_t name_len, size_t value_len)
+{
+	return name_len + value_len + HPACK_ENTRY_OVERHEAD;
+}
+
+static void hpack_table_evict(struct http_hpack_encoder_table *table, size_t max_size)
+{
+	while (table->count > 0 && table->size > max_size) {
+		size_t len = table->name_len[0] + table->value_len[0];
+		size_t data_len = table->size - table->count * HPACK_ENTRY_OVERHEAD;
+
+		memmove(table->data, table->data + len, data_len - len);
+		memmove(table->name_len, table->name_len + 1,
+			(table->count - 1) * sizeof(table->name_len[0]));
+		memmove(table->value_len, table->value_len + 1,
+			(table->count - 1) * sizeof(table->value_len[0]));
+
+		table->size -= hpack_entry_size(len, 0);
+		table->count--;
+	}
+}
+
+void http_hpack_encoder_table_init(struct http_hpack_encoder_table *table)
+{
+	table->count = 0;
+	table->size = 0;
+	table->max_size = HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE;
+
+	/* Let the decoder size its table as ours */
+	table->size_update = true;
+}
+
+void http_hpack_encoder_table_set_max_size(struct http_hpack_encoder_table *table,
+					   uint32_t max_size)
+{
+	max_size = MIN(max_size, HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE);
+
+	if (max_size == table->max_size) {
+		return;
+	}
+
+	hpack_table_evict(table, max_size);
+	table->max_size = max_size;
+	table->size_update = true;
+}
+
+/* Find a header field in the dynamic table, newest entries first */
+static int hpack_table_find(struct http_hpack_encoder_table *table,
+			    struct http_hpack_header_buf *header, bool *name_only)
+{
+	const uint8_t *data = table->data;
+	int candidate = -ENOENT;
+	int found = -ENOENT;
+
+	for (int i = 0; i < table->count; i++) {
+		int index = HPACK_DYNAMIC_INDEX_FIRST + table->count - 1 - i;
+
+		if (table->name_len[i] == header->name_len &&
+		    memcmp(data, header->name, header->name_len) == 0) {
+			if (table->value_len[i] == header->value_len &&
+			    memcmp(data + header->name_len, header->value,
+				   header->value_len) == 0) {
+				found = index;
+			}
+
+			candidate = index;
+		}
+
+		data += table->name_len[i] + table->value_len[i];
+	}
+
+	*name_only = found < 0;
+
+	return found < 0 ? candidate : found;
+}
+
+static void hpack_table_add(struct http_hpack_encoder_table *table,
+			    struct http_hpack_header_buf *header)
+{
+	size_t entry_size = hpack_entry_size(header->name_len, header->value_len);
+	uint8_t *data;
+
+	hpack_table_evict(table, table->max_size - entry_size);
+
+	if (table->count == ARRAY_SIZE(table->name_len)) {
+		hpack_table_evict(table, table->size - 1);
+	}
+
+	data = table->data + table->size - table->count * HPACK_ENTRY_OVERHEAD;
+	memcpy(data, header->name, header->name_len);
+	memcpy(data + header->name_len, header->value, header->value_len);
+
+	table->name_len[table->count] = header->name_len;
+	table->value_len[table->count] = header->value_len;
+	table->count++;
+	table->size += entry_size;
+}
+
+static int hpack_encode_literal_indexing(uint8_t *buf, size_t buflen, int index,
+					 struct http_hpack_header_buf *header)
+{
+	int ret, len = 0;
+
+	ret = hpack_integer_encode(buf, buflen, index, HPACK_PREFIX_LITERAL_INDEXING,
+				   HPACK_PREFIX_LEN_LITERAL_INDEXING);
+	if (ret < 0) {
+		return ret;
+	}
+
+	buf += ret;
+	buflen -= ret;
+	len += ret;
+
+	if (index == 0) {
+		ret = hpack_string_encode(buf, buflen, HPACK_HEADER_NAME, header);
+		if (ret < 0) {
+			return ret;
+		}
+
+		buf += ret;
+		buflen -= ret;
+		len += ret;
+	}
+
+	ret = hpack_string_encode(buf, buflen, HPACK_HEADER_VALUE, header);
+	if (ret < 0) {
+		return ret;
+	}
+
+	len += ret;
+
+	return len;
+}
+
+int http_hpack_encode_header_indexed(uint8_t *buf, size_t buflen,
+				     struct http_hpack_header_buf *header,
+				     struct http_hpack_encoder_table *table)
+{
+	int ret, index, dynamic_index, len = 0;
+	bool name_only, dynamic_name_only;
+
+	if (buf == NULL || header == NULL || table == NULL ||
+	    header->name == NULL || header->name_len == 0 ||
+	    header->value == NULL || header->value_len == 0) {
+		return -EINVAL;
+	}
+
+	/* The encoder is called for each field of a header block in turn, so
+	 * a pending size update goes before the first field of the next block.
+	 */
+	if (table->size_update) {
+		ret = hpack_integer_encode(buf, buflen, table->max_size,
+					   HPACK_PREFIX_DYNAMIC_TABLE_SIZE_UPDATE,
+					   HPACK_PREFIX_LEN_DYNAMIC_TABLE_SIZE_UPDATE);
+		if (ret < 0) {
+			return ret;
+		}
+
+		buf += ret;
+		buflen -= ret;
+		len += ret;
+	}
+
+	index = http_hpack_find_index(header, &name_only);
+	if (index < 0 || name_only) {
+		dynamic_index = hpack_table_find(table, header, &dynamic_name_only);
+		if (dynamic_index > 0 && (!dynamic_name_only || index < 0)) {
+			index = dynamic_index;
+			name_only = dynamic_name_only;
+		}
+	}
+
+	if (index > 0 && !name_only) {
+		/* Indexed */
+		ret = hpack_encode_indexed(buf, buflen, index);
+	} else if (hpack_entry_size(header->name_len, header->value_len) > table->max_size) {
+		/* Too large to be indexed */
+		ret = (index < 0) ? hpack_encode_literal(buf, buflen, header) :
+				    hpack_encode_literal_value(buf, buflen, index, header);
+	} else {
+		ret = hpack_encode_literal_indexing(buf, buflen, MAX(index, 0), header);
+		if (ret >= 0) {
+			hpack_table_add(table, header);
+		}
+	}
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	table->size_update = false;
+
+	return len + ret;
+}
+#endif /* CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE */
@@ -281,43 +281,75 @@ static const struct decode_elem eos = {
 	30,   0, { 0b11111111, 0b11111111, 0b11111111, 0b11111100 }
 };
 
-#define UINT32_BITLEN 32
-
-#define MSB_MASK(len) (UINT32_MAX << (UINT32_BITLEN - len))
-#define LSB_MASK(len) ((1UL << len) - 1UL)
+/* Canonical code lengths, the codes of each length follow each other in
+ * decode_table, the EOS code being the last one.
+ */
+struct code_len {
+	uint8_t bitlen;
+	uint8_t count;
+	uint16_t index;
+	uint32_t first_code;
+};
 
-static bool huffman_bits_compare(uint32_t bits, const struct decode_elem *entry)
-{
-	uint32_t mask = MSB_MASK(entry->bitlen);
-	uint32_t code = sys_get_be32(entry->code);
+static const struct code_len code_lens[] = {
+	{  5, 10,   0, 0x00000000 },
+	{  6, 26,  10, 0x00000014 },
+	{  7, 32,  36, 0x0000005c },
+	{  8,  6,  68, 0x000000f8 },
+	{ 10,  5,  74, 0x000003f8 },
+	{ 11,  3,  79, 0x000007fa },
+	{ 12,  2,  82, 0x00000ffa },
+	{ 13,  6,  84, 0x00001ff8 },
+	{ 14,  2,  90, 0x00003ffc },
+	{ 15,  3,  92, 0x00007ffc },
+	{ 19,  3,  95, 0x0007fff0 },
+	{ 20,  8,  98, 0x000fffe6 },
+	{ 21, 13, 106, 0x001fffdc },
+	{ 22, 26, 119, 0x003fffd2 },
+	{ 23, 29, 145, 0x007fffd8 },
+	{ 24, 12, 174, 0x00ffffea },
+	{ 25,  4, 186, 0x01ffffec },
+	{ 26, 15, 190, 0x03ffffe0 },
+	{ 27, 19, 205, 0x07ffffde },
+	{ 28, 29, 224, 0x0fffffe2 },
+	{ 30,  4, 253, 0x3ffffffc },
+};
 
-	if (code == (bits & mask)) {
-		return true;
-	}
+/* Index in decode_table of each symbol */
+static const uint8_t encode_index[256] = {
+	 84, 145, 224, 225, 226, 227, 228, 229, 230, 174, 253, 231, 232, 254, 233, 234,
+	235, 236, 237, 238, 239, 240, 255, 241, 242, 243, 244, 245, 246, 247, 248, 249,
+	 10,  74,  75,  82,  85,  11,  68,  79,  76,  77,  69,  80,  70,  12,  13,  14,
+	  0,   1,   2,  15,  16,  17,  18,  19,  20,  21,  36,  71,  92,  22,  83,  78,
+	 86,  23,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,  48,  49,  50,
+	 51,  52,  53,  54,  55,  56,  57,  58,  72,  59,  73,  87,  95,  88,  90,  24,
+	 93,   3,  25,   4,  26,   5,  27,  28,  29,   6,  60,  61,  30,  31,  32,   7,
+	 33,  62,  34,   8,   9,  35,  63,  64,  65,  66,  67,  94,  81,  91,  89, 250,
+	 98, 119,  99, 100, 120, 121, 122, 146, 123, 147, 148, 149, 150, 151, 175, 152,
+	176, 177, 124, 153, 178, 154, 155, 156, 157, 106, 125, 158, 126, 159, 160, 179,
+	127, 107, 101, 128, 129, 161, 162, 108, 163, 130, 131, 180, 109, 132, 164, 165,
+	110, 111, 133, 112, 166, 134, 167, 168, 102, 135, 136, 137, 169, 138, 139, 170,
+	190, 191, 103,  96, 140, 171, 141, 186, 192, 193, 194, 205, 206, 195, 181, 187,
+	 97, 113, 196, 207, 208, 197, 209, 182, 114, 115, 198, 199, 251, 210, 211, 212,
+	104, 183, 105, 116, 142, 117, 118, 172, 143, 144, 188, 189, 184, 185, 200, 173,
+	201, 213, 202, 203, 214, 215, 216, 217, 218, 252, 219, 220, 221, 222, 223, 204,
+};
 
-	return false;
-}
+#define UINT32_BITLEN 32
 
+/* Decode the symbol at the start of a 32 bit window, checking one code
+ * length at a time instead of one code at a time.
+ */
 static const struct decode_elem *huffman_decode_bits(uint32_t bits)
 {
-	for (int i = 0; i < ARRAY_SIZE(decode_table); i++) {
-		if (huffman_bits_compare(bits, &decode_table[i])) {
-			return &decode_table[i];
-		}
-	}
+	for (int i = 0; i < ARRAY_SIZE(code_lens); i++) {
+		const struct code_len *len = &code_lens[i];
+		uint32_t code = bits >> (UINT32_BITLEN - len->bitlen);
 
-	if (huffman_bits_compare(bits, &eos)) {
-		return &eos;
-	}
-
-	return NULL;
-}
+		if (code - len->first_code < len->count) {
+			uint16_t index = len->index + (code - len->first_code);
 
-static const struct decode_elem *huffman_find_entry(uint8_t symbol)
-{
-	for (int i = 0; i < ARRAY_SIZE(decode_table); i++) {
-		if (decode_table[i].symbol == symbol) {
-			return &decode_table[i];
+			return index < ARRAY_SIZE(decode_table) ? &decode_table[index] : &eos;
 		}
 	}
 
@@ -329,53 +361,36 @@ static const struct decode_elem *huffman_find_entry(uint8_t symbol)
 int http_hpack_huffman_decode(const uint8_t *encoded_buf, size_t encoded_len,
 			      uint8_t *buf, size_t buflen)
 {
-	size_t encoded_bits_len = encoded_len * 8;
-	uint8_t bits_needed = UINT32_BITLEN;
 	const struct decode_elem *decoded;
-	uint8_t bits_in_byte_left = 8;
 	size_t decoded_len = 0;
-	uint32_t bits = 0;
+	uint64_t acc = 0;
+	uint8_t acc_bits = 0;
+	uint32_t bits;
 
 	if (encoded_buf == NULL || buf == NULL || encoded_len == 0) {
 		return -EINVAL;
 	}
 
-	while (encoded_bits_len > 0) {
-		/* Refill the bits variable */
-		while (bits_needed > 0) {
-			if (encoded_len > 0) {
-				if (bits_in_byte_left <= bits_needed) {
-					/* Consume rest of the byte */
-					bits <<= bits_in_byte_left;
-					bits |= *encoded_buf &
-						    LSB_MASK(bits_in_byte_left);
-					bits_needed -= bits_in_byte_left;
-					bits_in_byte_left = 0;
-				} else {
-					/* Consume part of the byte */
-					bits <<= bits_needed;
-					bits |= (*encoded_buf >>
-						 (bits_in_byte_left - bits_needed)) &
-						LSB_MASK(bits_needed);
-					bits_in_byte_left -= bits_needed;
-					bits_needed = 0;
-				}
-			} else {
-				/* Pad with ones */
-				bits <<= bits_needed;
-				bits |= LSB_MASK(bits_needed);
-				bits_needed = 0;
-			}
+	while (true) {
+		/* Refill the accumulator a byte at a time */
+		while (acc_bits <= 56 && encoded_len > 0) {
+			acc = (acc << 8) | *encoded_buf++;
+			acc_bits += 8;
+			encoded_len--;
+		}
 
-			/* Move to next encoded byte */
-			if (bits_in_byte_left == 0) {
-				encoded_buf++;
-				encoded_len--;
-				bits_in_byte_left = 8;
-			}
+		if (acc_bits == 0) {
+			break;
+		}
+
+		/* Window of the next 32 bits, padded with ones */
+		if (acc_bits >= UINT32_BITLEN) {
+			bits = (uint32_t)(acc >> (acc_bits - UINT32_BITLEN));
+		} else {
+			bits = (uint32_t)(acc << (UINT32_BITLEN - acc_bits)) |
+			       (UINT32_MAX >> acc_bits);
 		}
 
-		/* Pass to decoder */
 		decoded = huffman_decode_bits(bits);
 		if (decoded == NULL) {
 			LOG_ERR("No symbol found");
@@ -383,7 +398,7 @@ int http_hpack_huffman_decode(const uint8_t *encoded_buf, size_t encoded_len,
 		}
 
 		if (decoded == &eos) {
-			if (encoded_bits_len > MAX_PADDING_LEN) {
+			if (acc_bits > MAX_PADDING_LEN) {
 				LOG_ERR("eos reached prematurely");
 				return -EBADMSG;
 			}
@@ -391,14 +406,12 @@ int http_hpack_huffman_decode(const uint8_t *encoded_buf, size_t encoded_len,
 			break;
 		}
 
-		if (encoded_bits_len < decoded->bitlen) {
+		if (acc_bits < decoded->bitlen) {
 			LOG_ERR("Invalid symbol used for padding");
 			return -EBADMSG;
 		}
 
-		/* Remove consumed bits from bits variable. */
-		bits_needed += decoded->bitlen;
-		encoded_bits_len -= decoded->bitlen;
+		acc_bits -= decoded->bitlen;
 
 		/* Store decoded symbol */
 		if (buflen == 0) {
@@ -419,61 +432,38 @@ int http_hpack_huffman_encode(const uint8_t *str, size_t str_len,
 			      uint8_t *buf, size_t buflen)
 {
 	const struct decode_elem *entry;
-	size_t buflen_bits = buflen * 8;
-	uint8_t bit_offset = 0;
+	uint64_t acc = 0;
+	uint8_t acc_bits = 0;
 	int len = 0;
 
 	if (str == NULL || buf == NULL || str_len == 0) {
 		return -EINVAL;
 	}
 
-	while (str_len > 0) {
-		uint32_t code;
-		uint8_t bitlen;
-
-		entry = huffman_find_entry(*str);
-		if (entry == NULL) {
-			return -EINVAL;
-		}
-
-		if (entry->bitlen > buflen_bits) {
-			return -ENOBUFS;
+	while (str_len > 0 || acc_bits > 0) {
+		if (str_len > 0) {
+			entry = &decode_table[encode_index[*str]];
+
+			acc = (acc << entry->bitlen) |
+			      (sys_get_be32(entry->code) >> (UINT32_BITLEN - entry->bitlen));
+			acc_bits += entry->bitlen;
+			str_len--;
+			str++;
+		} else {
+			/* Pad with ones. */
+			acc = (acc << (8 - acc_bits)) | ((1U << (8 - acc_bits)) - 1U);
+			acc_bits = 8;
 		}
 
-		bitlen = entry->bitlen;
-		code = sys_get_be32(entry->code);
-
-		while (bitlen > 0) {
-			uint8_t to_copy = MIN(8 - bit_offset, bitlen);
-			uint8_t byte = (uint8_t)((code & MSB_MASK(to_copy)) >>
-						 (24 + bit_offset));
-
-			/* This is way suboptimal */
-			if (bit_offset == 0) {
-				*buf = byte;
-			} else {
-				*buf |= byte;
+		/* Flush whole bytes */
+		while (acc_bits >= 8) {
+			if (len == buflen) {
+				return -ENOBUFS;
 			}
 
-			code <<= to_copy;
-			bitlen -= to_copy;
-			bit_offset  = (bit_offset + to_copy) % 8;
-
-			if (bit_offset == 0) {
-				buf++;
-				len++;
-			}
+			acc_bits -= 8;
+			buf[len++] = (uint8_t)(acc >> acc_bits);
 		}
-
-		buflen_bits -= entry->bitlen;
-		str_len--;
-		str++;
-	}
-
-	/* Pad with ones. */
-	if (bit_offset > 0) {
-		*buf |= LSB_MASK((8 - bit_offset));
-		len++;
 	}
 
 	return len;
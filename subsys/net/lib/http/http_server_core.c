@@ -34,15 +34,19 @@ LOG_MODULE_REGISTER(net_http_server, CONFIG_NET_HTTP_SERVER_LOG_LEVEL);
 #endif
 
 #define INVALID_SOCK -1
+/* Client socket handed to a worker, left out of the poll set meanwhile */
+#define BUSY_SOCK -2
 #define INACTIVITY_TIMEOUT K_SECONDS(CONFIG_HTTP_SERVER_CLIENT_INACTIVITY_TIMEOUT)
 
 #define HTTP_SERVER_MAX_SERVICES CONFIG_HTTP_SERVER_NUM_SERVICES
 #define HTTP_SERVER_MAX_CLIENTS  CONFIG_HTTP_SERVER_MAX_CLIENTS
 #define HTTP_SERVER_SOCK_COUNT (1 + HTTP_SERVER_MAX_SERVICES + HTTP_SERVER_MAX_CLIENTS)
+#define HTTP_SERVER_WORKERS CONFIG_HTTP_SERVER_WORKERS
 
 struct http_server_ctx {
 	int num_clients;
 	int listen_fds; /* max value of 1 + MAX_SERVICES */
+	int busy_clients; /* clients handed to workers */
 
 	/* First pollfd is eventfd that can be used to stop the server,
 	 * then we have the server listen sockets,
@@ -55,6 +59,32 @@ struct http_server_ctx {
 static struct http_server_ctx server_ctx;
 static K_SEM_DEFINE(server_start, 0, 1);
 static bool server_running;
+static struct k_spinlock holder_lock;
+
+#if HTTP_SERVER_WORKERS > 0
+/* With workers, the server thread owns the poll set and the listening
+ * sockets, accepts the clients and initializes their context. A client
+ * with events is taken out of the poll set and its context is owned by
+ * the worker handling it, until the worker hands it back on the done
+ * queue. The server thread then puts the client back in the poll set, or
+ * frees its slot if the worker released it.
+ */
+struct client_event {
+	int index;
+	short revents;
+};
+
+K_MSGQ_DEFINE(worker_ready_msgq, sizeof(struct client_event), HTTP_SERVER_MAX_CLIENTS, 4);
+K_MSGQ_DEFINE(worker_done_msgq, sizeof(int), HTTP_SERVER_MAX_CLIENTS, 4);
+static K_MUTEX_DEFINE(worker_done_lock);
+static K_THREAD_STACK_ARRAY_DEFINE(worker_stacks, HTTP_SERVER_WORKERS,
+				   CONFIG_HTTP_SERVER_WORKER_STACK_SIZE);
+static struct k_thread worker_threads[HTTP_SERVER_WORKERS];
+#endif
+
+#if defined(CONFIG_HTTP_SERVER_ROUTE_TRIE)
+static void route_build(void);
+#endif
 
 int http_server_init(struct http_server_ctx *ctx)
 {
@@ -214,6 +244,12 @@ int http_server_init(struct http_server_ctx *ctx)
 
 	ctx->listen_fds = count;
 	ctx->num_clients = 0;
+	ctx->busy_clients = 0;
+
+#if defined(CONFIG_HTTP_SERVER_ROUTE_TRIE)
+	/* Before any worker looks up a resource */
+	route_build();
+#endif
 
 	return 0;
 }
@@ -293,6 +329,119 @@ static void client_release_resources(struct http_client_ctx *client)
 	}
 }
 
+/* Whether an Accept-Encoding header value allows gzip, that is it lists
+ * gzip or "*" without a zero quality value.
+ */
+bool http_server_accepts_gzip(const char *value, size_t len)
+{
+	const char *end = value + len;
+	int any = -1;
+
+	while (value < end) {
+		const char *next = memchr(value, ',', end - value);
+		const char *name, *param;
+		size_t name_len;
+		bool accepted = true;
+
+		if (next == NULL) {
+			next = end;
+		}
+
+		while (value < next && *value == ' ') {
+			value++;
+		}
+
+		name = value;
+		while (value < next && *value != ';' && *value != ' ') {
+			value++;
+		}
+
+		name_len = value - name;
+
+		param = memchr(value, ';', next - value);
+		if (param != NULL) {
+			param++;
+
+			while (param < next && *param == ' ') {
+				param++;
+			}
+
+			if (next - param >= 3 && (param[0] == 'q' || param[0] == 'Q') &&
+			    param[1] == '=' && param[2] == '0') {
+				accepted = false;
+
+				for (param += 3; param < next && *param != ' '; param++) {
+					if (*param != '.' && *param != '0') {
+						accepted = true;
+						break;
+					}
+				}
+			}
+		}
+
+		if (name_len == sizeof("gzip") - 1 && strncasecmp(name, "gzip", name_len) == 0) {
+			return accepted;
+		}
+
+		if (name_len == 1 && name[0] == '*') {
+			any = accepted;
+		}
+
+		value = next + 1;
+	}
+
+	return any == 1;
+}
+
+#if defined(CONFIG_HTTP_SERVER_STATIC_FS)
+int http_server_static_fs_open(struct http_resource_detail_static_fs *fs_detail,
+			       struct http_client_ctx *client, struct fs_file_t *file,
+			       size_t *len, bool *gzip)
+{
+	const char *path = fs_detail->fs_path;
+	struct fs_dirent entry;
+	int ret;
+
+	*gzip = false;
+
+	if (client->accept_gzip && fs_detail->fs_gzip_path != NULL &&
+	    fs_stat(fs_detail->fs_gzip_path, &entry) == 0 && entry.type == FS_DIR_ENTRY_FILE) {
+		path = fs_detail->fs_gzip_path;
+		*gzip = true;
+	} else if (fs_stat(path, &entry) < 0 || entry.type != FS_DIR_ENTRY_FILE) {
+		LOG_DBG("No file %s", path);
+		return -ENOENT;
+	}
+
+	fs_file_t_init(file);
+
+	ret = fs_open(file, path, FS_O_READ);
+	if (ret < 0) {
+		LOG_DBG("Cannot open %s (%d)", path, ret);
+		return -ENOENT;
+	}
+
+	*len = entry.size;
+
+	return 0;
+}
+#endif /* CONFIG_HTTP_SERVER_STATIC_FS */
+
+bool http_server_dynamic_hold(struct http_resource_detail_dynamic *dynamic_detail,
+			      struct http_client_ctx *client)
+{
+	k_spinlock_key_t key = k_spin_lock(&holder_lock);
+	bool held = dynamic_detail->holder == NULL || dynamic_detail->holder == client;
+
+	if (held) {
+		dynamic_detail->holder = client;
+	}
+
+	k_spin_unlock(&holder_lock, key);
+
+	return held;
+}
+
 void http_server_release_client(struct http_client_ctx *client)
 {
 	int i;
@@ -303,12 +452,15 @@ void http_server_release_client(struct http_client_ctx *client)
 	k_work_cancel_delayable_sync(&client->inactivity_timer, &sync);
 	client_release_resources(client);
 
-	server_ctx.num_clients--;
+	/* The slot of a worker client is freed once it is handed back */
+	if (HTTP_SERVER_WORKERS == 0) {
+		server_ctx.num_clients--;
 
-	for (i = server_ctx.listen_fds; i < ARRAY_SIZE(server_ctx.fds); i++) {
-		if (server_ctx.fds[i].fd == client->fd) {
-			server_ctx.fds[i].fd = INVALID_SOCK;
-			break;
+		for (i = server_ctx.listen_fds; i < ARRAY_SIZE(server_ctx.fds); i++) {
+			if (server_ctx.fds[i].fd == client->fd) {
+				server_ctx.fds[i].fd = INVALID_SOCK;
+				break;
+			}
 		}
 	}
 
@@ -364,6 +516,10 @@ static void init_client_ctx(struct http_client_ctx *client, int new_socket)
 		client->streams[i].stream_state = HTTP_SERVER_STREAM_IDLE;
 		client->streams[i].stream_id = 0;
 	}
+
+#if defined(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE)
+	http_hpack_encoder_table_init(&client->hpack_table);
+#endif
 }
 
 static int handle_http_preface(struct http_client_ctx *client)
@@ -462,9 +618,173 @@ static int handle_http_request(struct http_client_ctx *client)
 	return 0;
 }
 
+static void handle_client_event(struct http_client_ctx *client, short revents)
+{
+	int index = ARRAY_INDEX(server_ctx.clients, client);
+	int sock_error;
+	socklen_t optlen = sizeof(int);
+	int ret;
+
+	if (revents & ZSOCK_POLLHUP) {
+		LOG_DBG("Client #%d has disconnected", index);
+		close_client_connection(client);
+		return;
+	}
+
+	if (revents & ZSOCK_POLLERR) {
+		(void)zsock_getsockopt(client->fd, SOL_SOCKET, SO_ERROR, &sock_error, &optlen);
+		LOG_DBG("Error on fd %d %d", client->fd, sock_error);
+		close_client_connection(client);
+		return;
+	}
+
+	if (!(revents & ZSOCK_POLLIN)) {
+		return;
+	}
+
+	ret = zsock_recv(client->fd, client->buffer + client->data_len,
+			 sizeof(client->buffer) - client->data_len, 0);
+	if (ret <= 0) {
+		if (ret == 0) {
+			LOG_DBG("Connection closed by peer for client #%d", index);
+		} else {
+			ret = -errno;
+			LOG_DBG("ERROR reading from socket (%d)", ret);
+		}
+
+		close_client_connection(client);
+		return;
+	}
+
+	client->data_len += ret;
+
+	http_client_timer_restart(client);
+
+	ret = handle_http_request(client);
+	if (ret < 0 && ret != -EAGAIN) {
+		if (ret == -ENOTCONN) {
+			LOG_DBG("Client closed connection while handling request");
+		} else {
+			LOG_ERR("HTTP request handling error (%d)", ret);
+		}
+		close_client_connection(client);
+	} else if (client->data_len == sizeof(client->buffer)) {
+		/* If the RX buffer is still full after parsing,
+		 * it means we won't be able to handle this request
+		 * with the current buffer size.
+		 */
+		LOG_ERR("RX buffer too small to handle request");
+		close_client_connection(client);
+	}
+}
+
+#if HTTP_SERVER_WORKERS > 0
+static void worker_thread(void *p1, void *p2, void *p3)
+{
+	struct client_event event;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_msgq_get(&worker_ready_msgq, &event, K_FOREVER);
+
+		handle_client_event(&server_ctx.clients[event.index], event.revents);
+
+		/* Wake up the server thread to put the client back in the poll
+		 * set. The lock lets the server close the eventfd once the
+		 * last client is back.
+		 */
+		k_mutex_lock(&worker_done_lock, K_FOREVER);
+		(void)k_msgq_put(&worker_done_msgq, &event.index, K_NO_WAIT);
+		(void)eventfd_write(server_ctx.fds[0].fd, 1);
+		k_mutex_unlock(&worker_done_lock);
+	}
+}
+
+static void worker_dispatch(struct http_server_ctx *ctx, int i)
+{
+	struct client_event event = {
+		.index = i - ctx->listen_fds,
+		.revents = ctx->fds[i].revents,
+	};
+
+	ctx->fds[i].fd = BUSY_SOCK;
+	ctx->fds[i].revents = 0;
+	ctx->busy_clients++;
+
+	(void)k_msgq_put(&worker_ready_msgq, &event, K_NO_WAIT);
+}
+
+static void worker_client_back(struct http_server_ctx *ctx, int index)
+{
+	struct http_client_ctx *client = &ctx->clients[index];
+	int i = ctx->listen_fds + index;
+
+	ctx->busy_clients--;
+
+	if (client->fd == INVALID_SOCK) {
+		ctx->fds[i].fd = INVALID_SOCK;
+		ctx->num_clients--;
+	} else {
+		ctx->fds[i].fd = client->fd;
+	}
+}
+
+static void workers_collect(struct http_server_ctx *ctx)
+{
+	int index;
+
+	while (k_msgq_get(&worker_done_msgq, &index, K_NO_WAIT) == 0) {
+		worker_client_back(ctx, index);
+	}
+}
+
+/* Wait for the workers to hand back every client */
+static void workers_drain(struct http_server_ctx *ctx)
+{
+	int index;
+
+	while (ctx->busy_clients > 0) {
+		k_msgq_get(&worker_done_msgq, &index, K_FOREVER);
+		worker_client_back(ctx, index);
+	}
+
+	k_mutex_lock(&worker_done_lock, K_FOREVER);
+	k_mutex_unlock(&worker_done_lock);
+}
+
+static void workers_start(void)
+{
+	static bool started;
+
+	if (started) {
+		return;
+	}
+
+	started = true;
+
+	for (int i = 0; i < HTTP_SERVER_WORKERS; i++) {
+		k_thread_create(&worker_threads[i], worker_stacks[i],
+				K_THREAD_STACK_SIZEOF(worker_stacks[i]), worker_thread,
+				NULL, NULL, NULL, THREAD_PRIORITY, 0, K_NO_WAIT);
+		k_thread_name_set(&worker_threads[i], "http_worker");
+	}
+}
+#endif /* HTTP_SERVER_WORKERS > 0 */
+
+static void handle_client_ready(struct http_server_ctx *ctx, int i)
+{
+#if HTTP_SERVER_WORKERS > 0
+	worker_dispatch(ctx, i);
+#else
+	handle_client_event(&ctx->clients[i - ctx->listen_fds], ctx->fds[i].revents);
+#endif
+}
+
 static int http_server_run(struct http_server_ctx *ctx)
 {
-	struct http_client_ctx *client;
 	eventfd_t value;
 	bool found_slot;
 	int new_socket;
@@ -479,7 +799,7 @@ static int http_server_run(struct http_server_ctx *ctx)
 		if (ret < 0) {
 			ret = -errno;
 			LOG_DBG("poll failed (%d)", ret);
-			return ret;
+			goto exit;
 		}
 
 		if (ret == 0) {
@@ -487,132 +807,107 @@ static int http_server_run(struct http_server_ctx *ctx)
 			break;
 		}
 
+#if HTTP_SERVER_WORKERS > 0
+		/* Workers also signal the eventfd when handing back a client */
+		if (ctx->fds[0].revents) {
+			eventfd_read(ctx->fds[0].fd, &value);
+
+			if (!server_running) {
+				LOG_DBG("Received stop event. exiting ..");
+				goto closing;
+			}
+
+			workers_collect(ctx);
+		}
+#else
 		if (ret == 1 && ctx->fds[0].revents) {
 			eventfd_read(ctx->fds[0].fd, &value);
 			LOG_DBG("Received stop event. exiting ..");
 			goto closing;
 		}
+#endif
 
 		for (i = 1; i < ARRAY_SIZE(ctx->fds); i++) {
 			if (ctx->fds[i].fd < 0) {
 				continue;
 			}
 
-			if (ctx->fds[i].revents & ZSOCK_POLLHUP) {
-				if (i >= ctx->listen_fds) {
-					LOG_DBG("Client #%d has disconnected",
-						i - ctx->listen_fds);
-
-					client = &ctx->clients[i - ctx->listen_fds];
-					close_client_connection(client);
+			if (i >= ctx->listen_fds) {
+				if (ctx->fds[i].revents &
+				    (ZSOCK_POLLHUP | ZSOCK_POLLERR | ZSOCK_POLLIN)) {
+					handle_client_ready(ctx, i);
 				}
 
 				continue;
 			}
 
+			if (ctx->fds[i].revents & ZSOCK_POLLHUP) {
+				continue;
+			}
+
 			if (ctx->fds[i].revents & ZSOCK_POLLERR) {
 				(void)zsock_getsockopt(ctx->fds[i].fd, SOL_SOCKET,
 						       SO_ERROR, &sock_error, &optlen);
 				LOG_DBG("Error on fd %d %d", ctx->fds[i].fd, sock_error);
 
-				if (i >= ctx->listen_fds) {
-					client = &ctx->clients[i - ctx->listen_fds];
-					close_client_connection(client);
-					continue;
-				}
-
 				/* Listening socket error, abort. */
 				LOG_ERR("Listening socket error, aborting.");
-				return -sock_error;
-
+				ret = -sock_error;
+				goto exit;
 			}
 
 			if (!(ctx->fds[i].revents & ZSOCK_POLLIN)) {
 				continue;
 			}
 
-			/* First check if we have something to accept */
-			if (i < ctx->listen_fds) {
-				new_socket = accept_new_client(ctx->fds[i].fd);
-				if (new_socket < 0) {
-					ret = -errno;
-					LOG_DBG("accept: %d", ret);
-					continue;
-				}
-
-				found_slot = false;
-
-				for (j = ctx->listen_fds; j < ARRAY_SIZE(ctx->fds); j++) {
-					if (ctx->fds[j].fd != INVALID_SOCK) {
-						continue;
-					}
-
-					ctx->fds[j].fd = new_socket;
-					ctx->fds[j].events = ZSOCK_POLLIN;
-					ctx->fds[j].revents = 0;
-
-					ctx->num_clients++;
-
-					LOG_DBG("Init client #%d", j - ctx->listen_fds);
-
-					init_client_ctx(&ctx->clients[j - ctx->listen_fds],
-							new_socket);
-					found_slot = true;
-					break;
-				}
-
-				if (!found_slot) {
-					LOG_DBG("No free slot found.");
-					zsock_close(new_socket);
-				}
-
+			/* Accept the new client */
+			new_socket = accept_new_client(ctx->fds[i].fd);
+			if (new_socket < 0) {
+				ret = -errno;
+				LOG_DBG("accept: %d", ret);
 				continue;
 			}
 
-			/* Client sock */
-			client = &ctx->clients[i - ctx->listen_fds];
+			found_slot = false;
 
-			ret = zsock_recv(client->fd, client->buffer + client->data_len,
-					 sizeof(client->buffer) - client->data_len, 0);
-			if (ret <= 0) {
-				if (ret == 0) {
-					LOG_DBG("Connection closed by peer for client #%d",
-						i - ctx->listen_fds);
-				} else {
-					ret = -errno;
-					LOG_DBG("ERROR reading from socket (%d)", ret);
+			for (j = ctx->listen_fds; j < ARRAY_SIZE(ctx->fds); j++) {
+				if (ctx->fds[j].fd != INVALID_SOCK) {
+					continue;
 				}
 
-				close_client_connection(client);
-				continue;
-			}
+				ctx->fds[j].fd = new_socket;
+				ctx->fds[j].events = ZSOCK_POLLIN;
+				ctx->fds[j].revents = 0;
 
-			client->data_len += ret;
+				ctx->num_clients++;
 
-			http_client_timer_restart(client);
+				LOG_DBG("Init client #%d", j - ctx->listen_fds);
 
-			ret = handle_http_request(client);
-			if (ret < 0 && ret != -EAGAIN) {
-				if (ret == -ENOTCONN) {
-					LOG_DBG("Client closed connection while handling request");
-				} else {
-					LOG_ERR("HTTP request handling error (%d)", ret);
-				}
-				close_client_connection(client);
-			} else if (client->data_len == sizeof(client->buffer)) {
-				/* If the RX buffer is still full after parsing,
-				 * it means we won't be able to handle this request
-				 * with the current buffer size.
-				 */
-				LOG_ERR("RX buffer too small to handle request");
-				close_client_connection(client);
+				init_client_ctx(&ctx->clients[j - ctx->listen_fds],
+						new_socket);
+				found_slot = true;
+				break;
+			}
+
+			if (!found_slot) {
+				LOG_DBG("No free slot found.");
+				zsock_close(new_socket);
 			}
 		}
 	}
 
-	return 0;
+	ret = 0;
+
+exit:
+#if HTTP_SERVER_WORKERS > 0
+	workers_drain(ctx);
+#endif
+	return ret;
 
 closing:
+#if HTTP_SERVER_WORKERS > 0
+	workers_drain(ctx);
+#endif
 	/* Close all client connections and the server socket */
 	return close_all_sockets(ctx);
 }
@@ -652,10 +947,251 @@ static bool skip_this(struct http_resource_desc *resource, bool is_websocket)
 	return false;
 }
 
+#if defined(CONFIG_HTTP_SERVER_ROUTE_TRIE)
+/* Trie over the resource paths, split in '/' separated segments. Every
+ * resource is inserted with literal segments up to any '?', as matched by
+ * compare_strings(), and a resource with wildcards again with its wildcard
+ * segments matched by fnmatch(). The node of the last segment keeps the
+ * first resource in definition order, for websocket and other lookups.
+ */
+#define ROUTE_SEG_MAX CONFIG_HTTP_SERVER_MAX_URL_LENGTH
+
+struct route_node {
+	const char *seg;
+	uint16_t seg_len;
+	/* Index of the first child and next sibling, 0 (the root) if none */
+	uint16_t child;
+	uint16_t next;
+	bool wildcard;
+	/* Definition order of the resource, 0 if none */
+	uint16_t order[2];
+	struct http_resource_desc *res[2];
+};
+
+static struct {
+	struct route_node nodes[CONFIG_HTTP_SERVER_ROUTE_TRIE_NODES];
+	uint16_t count;
+	bool built;
+	bool failed;
+	char pattern[ROUTE_SEG_MAX + 1];
+	char string[ROUTE_SEG_MAX + 1];
+} route;
+
+#if HTTP_SERVER_WORKERS > 0
+static K_MUTEX_DEFINE(route_lock);
+#endif
+
+static const char *route_query(const char *path)
+{
+	const char *query = strchr(path, '?');
+
+	return query ? query : path + strlen(path);
+}
+
+static bool route_has_wildcard(const char *seg, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		if (strchr("*?[\\", seg[i]) != NULL) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static int route_insert(struct http_resource_desc *resource, uint16_t order, bool pattern)
+{
+	const char *seg = resource->resource;
+	const char *end = pattern ? seg + strlen(seg) : route_query(seg);
+	struct route_node *node = &route.nodes[0];
+	int slot;
+
+	while (true) {
+		const char *sep = memchr(seg, '/', end - seg);
+		size_t len = (sep ? sep : end) - seg;
+		bool wildcard = pattern && route_has_wildcard(seg, len);
+		uint16_t *link = &node->child;
+
+		while (*link != 0) {
+			struct route_node *child = &route.nodes[*link];
+
+			if (child->wildcard == wildcard && child->seg_len == len &&
+			    memcmp(child->seg, seg, len) == 0) {
+				break;
+			}
+
+			link = &child->next;
+		}
+
+		if (*link == 0) {
+			if (route.count == ARRAY_SIZE(route.nodes) ||
+			    (wildcard && len > ROUTE_SEG_MAX)) {
+				return -ENOMEM;
+			}
+
+			*link = route.count++;
+			route.nodes[*link] = (struct route_node){
+				.seg = seg,
+				.seg_len = len,
+				.wildcard = wildcard,
+			};
+		}
+
+		node = &route.nodes[*link];
+
+		if (sep == NULL) {
+			break;
+		}
+
+		seg = sep + 1;
+	}
+
+	slot = ((struct http_resource_detail *)resource->detail)->type ==
+	       HTTP_RESOURCE_TYPE_WEBSOCKET;
+
+	if (node->res[slot] == NULL) {
+		node->res[slot] = resource;
+		node->order[slot] = order;
+	}
+
+	return 0;
+}
+
+static void route_build(void)
+{
+	uint16_t order = 0;
+	int ret = 0;
+
+	if (route.built) {
+		return;
+	}
+
+	route.built = true;
+	route.count = 1;
+
+	HTTP_SERVICE_FOREACH(service) {
+		HTTP_SERVICE_FOREACH_RESOURCE(service, resource) {
+			if (order == UINT16_MAX) {
+				ret = -ENOMEM;
+				break;
+			}
+
+			order++;
+
+			ret = route_insert(resource, order, false);
+			if (ret == 0 && IS_ENABLED(CONFIG_HTTP_SERVER_RESOURCE_WILDCARD) &&
+			    route_has_wildcard(resource->resource, strlen(resource->resource))) {
+				ret = route_insert(resource, order, true);
+			}
+
+			if (ret < 0) {
+				break;
+			}
+		}
+
+		if (ret < 0) {
+			break;
+		}
+	}
+
+	if (ret < 0) {
+		LOG_WRN("Resource trie too small, using linear lookup");
+		route.failed = true;
+	}
+
+	LOG_DBG("Resource trie uses %u nodes", route.count);
+}
+
+static bool route_seg_match(const struct route_node *node, const char *seg, size_t len)
+{
+	if (!node->wildcard) {
+		return node->seg_len == len && memcmp(node->seg, seg, len) == 0;
+	}
+
+	if (len > ROUTE_SEG_MAX) {
+		return false;
+	}
+
+	memcpy(route.pattern, node->seg, node->seg_len);
+	route.pattern[node->seg_len] = '\0';
+	memcpy(route.string, seg, len);
+	route.string[len] = '\0';
+
+	return fnmatch(route.pattern, route.string, FNM_PATHNAME) == 0;
+}
+
+/* Find the first resource matching the path up to end. Wildcard children
+ * make this a depth first search, bounded by the depth of the trie.
+ */
+static void route_find(const struct route_node *node, const char *seg, const char *end,
+		       bool wildcard, int slot, const struct route_node **best)
+{
+	const char *sep = memchr(seg, '/', end - seg);
+	size_t len = (sep ? sep : end) - seg;
+
+	for (uint16_t i = node->child; i != 0; i = route.nodes[i].next) {
+		const struct route_node *child = &route.nodes[i];
+
+		if ((child->wildcard && !wildcard) || !route_seg_match(child, seg, len)) {
+			continue;
+		}
+
+		if (sep != NULL) {
+			route_find(child, sep + 1, end, wildcard, slot, best);
+		} else if (child->res[slot] != NULL &&
+			   (*best == NULL || child->order[slot] < (*best)->order[slot])) {
+			*best = child;
+		}
+	}
+}
+
+static struct http_resource_detail *route_lookup(const char *path, int *path_len,
+						 bool is_websocket)
+{
+	const struct route_node *best = NULL;
+	int slot = is_websocket ? 1 : 0;
+
+	/* Literal match up to the query, then wildcard match of the whole path */
+#if HTTP_SERVER_WORKERS > 0
+	/* Wildcard matching uses the segment buffers */
+	k_mutex_lock(&route_lock, K_FOREVER);
+#endif
+
+	route_find(&route.nodes[0], path, route_query(path), false, slot, &best);
+
+	if (IS_ENABLED(CONFIG_HTTP_SERVER_RESOURCE_WILDCARD)) {
+		route_find(&route.nodes[0], path, path + strlen(path), true, slot, &best);
+	}
+
+#if HTTP_SERVER_WORKERS > 0
+	k_mutex_unlock(&route_lock);
+#endif
+
+	if (best == NULL) {
+		NET_DBG("No match for %s", path);
+		return NULL;
+	}
+
+	NET_DBG("Got match for %s", best->res[slot]->resource);
+
+	*path_len = strlen(best->res[slot]->resource);
+
+	return best->res[slot]->detail;
+}
+#endif /* CONFIG_HTTP_SERVER_ROUTE_TRIE */
+
 struct http_resource_detail *get_resource_detail(const char *path,
 						 int *path_len,
 						 bool is_websocket)
 {
+#if defined(CONFIG_HTTP_SERVER_ROUTE_TRIE)
+	route_build();
+
+	if (!route.failed) {
+		return route_lookup(path, path_len, is_websocket);
+	}
+#endif
+
 	HTTP_SERVICE_FOREACH(service) {
 		HTTP_SERVICE_FOREACH_RESOURCE(service, resource) {
 			if (skip_this(resource, is_websocket)) {
@@ -743,6 +1279,10 @@ static void http_server_thread(void *p1, void *p2, void *p3)
 	ARG_UNUSED(p2);
 	ARG_UNUSED(p3);
 
+#if HTTP_SERVER_WORKERS > 0
+	workers_start();
+#endif
+
 	while (true) {
 		k_sem_take(&server_start, K_FOREVER);
 
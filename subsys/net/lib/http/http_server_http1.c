@@ -83,6 +83,71 @@ static int handle_http1_static_resource(
 	return 0;
 }
 
+#if defined(CONFIG_HTTP_SERVER_STATIC_FS)
+static int handle_http1_static_fs_resource(
+	struct http_resource_detail_static_fs *fs_detail,
+	struct http_client_ctx *client)
+{
+	char http_response[sizeof(RESPONSE_TEMPLATE) +
+			   sizeof("Content-Encoding: 01234567890123456789\r\n") +
+			   sizeof("Content-Type: \r\n") + HTTP_SERVER_MAX_CONTENT_TYPE_LEN +
+			   sizeof("xxxxxxxxxx") +
+			   sizeof("\r\n")];
+	uint8_t chunk[CONFIG_HTTP_SERVER_STATIC_FS_CHUNK_SIZE];
+	const char *content_encoding;
+	struct fs_file_t file;
+	size_t len;
+	bool gzip;
+	ssize_t read;
+	int ret;
+
+	if (!(fs_detail->common.bitmask_of_supported_http_methods & BIT(HTTP_GET))) {
+		return 0;
+	}
+
+	ret = http_server_static_fs_open(fs_detail, client, &file, &len, &gzip);
+	if (ret < 0) {
+		return ret;
+	}
+
+	content_encoding = gzip ? "gzip" : fs_detail->common.content_encoding;
+
+	if (content_encoding != NULL && content_encoding[0] != '\0') {
+		snprintk(http_response, sizeof(http_response),
+			 RESPONSE_TEMPLATE "Content-Encoding: %s\r\n\r\n",
+			 "Content-Type: ",
+			 fs_detail->common.content_type == NULL ?
+			 "text/html" : fs_detail->common.content_type,
+			 (int)len, content_encoding);
+	} else {
+		snprintk(http_response, sizeof(http_response),
+			 RESPONSE_TEMPLATE "\r\n",
+			 "Content-Type: ",
+			 fs_detail->common.content_type == NULL ?
+			 "text/html" : fs_detail->common.content_type,
+			 (int)len);
+	}
+
+	ret = http_server_sendall(client, http_response, strlen(http_response));
+
+	/* Stream the file, the length is known so no chunked encoding */
+	while (ret >= 0 && len > 0) {
+		read = fs_read(&file, chunk, MIN(len, sizeof(chunk)));
+		if (read <= 0) {
+			ret = (read < 0) ? (int)read : -EIO;
+			break;
+		}
+
+		ret = http_server_sendall(client, chunk, read);
+		len -= read;
+	}
+
+	(void)fs_close(&file);
+
+	return ret;
+}
+#endif /* CONFIG_HTTP_SERVER_STATIC_FS */
+
 #define RESPONSE_TEMPLATE_CHUNKED			\
 	"HTTP/1.1 200 OK\r\n"				\
 	"%s%s\r\n"					\
@@ -273,7 +338,7 @@ static int handle_http1_dynamic_resource(
 		return -ENOPROTOOPT;
 	}
 
-	if (dynamic_detail->holder != NULL && dynamic_detail->holder != client) {
+	if (!http_server_dynamic_hold(dynamic_detail, client)) {
 		static const char conflict_response[] =
 				"HTTP/1.1 409 Conflict\r\n\r\n";
 
@@ -287,8 +352,6 @@ static int handle_http1_dynamic_resource(
 		return enter_http_done_state(client);
 	}
 
-	dynamic_detail->holder = client;
-
 	switch (client->method) {
 	case HTTP_HEAD:
 		if (user_method & BIT(HTTP_HEAD)) {
@@ -360,6 +423,10 @@ static int on_header_field(struct http_parser *parser, const char *at,
 					       "Sec-WebSocket-Key",
 					       sizeof("Sec-WebSocket-Key") - 1) == 0) {
 				ctx->websocket_sec_key_next = true;
+			} else if (strncasecmp(ctx->header_buffer,
+					       "Accept-Encoding",
+					       sizeof("Accept-Encoding") - 1) == 0) {
+				ctx->accept_encoding_next = true;
 			}
 
 			ctx->header_buffer[0] = '\0';
@@ -410,6 +477,12 @@ static int on_header_value(struct http_parser *parser,
 				ctx->websocket_sec_key_next = false;
 			}
 
+			if (ctx->accept_encoding_next) {
+				ctx->accept_gzip = http_server_accepts_gzip(ctx->header_buffer,
+									    offset);
+				ctx->accept_encoding_next = false;
+			}
+
 			ctx->header_buffer[0] = '\0';
 		}
 	}
@@ -436,6 +509,7 @@ static int on_url(struct http_parser *parser, const char *at, size_t length)
 	size_t offset = strlen(ctx->url_buffer);
 
 	ctx->parser_state = HTTP1_WAITING_HEADER_STATE;
+	ctx->accept_gzip = false;
 
 	if (offset + length > sizeof(ctx->url_buffer) - 1) {
 		LOG_DBG("URL too long to handle");
@@ -612,6 +686,19 @@ upgrade_not_found:
 			if (ret < 0) {
 				return ret;
 			}
+#if defined(CONFIG_HTTP_SERVER_STATIC_FS)
+		} else if (detail->type == HTTP_RESOURCE_TYPE_STATIC_FS) {
+			ret = handle_http1_static_fs_resource(
+				(struct http_resource_detail_static_fs *)detail,
+				client);
+			if (ret == -ENOENT) {
+				goto not_found;
+			}
+
+			if (ret < 0) {
+				return ret;
+			}
+#endif
 		}
 	} else {
 not_found: ; /* Add extra semicolon to make clang to compile when using label */
@@ -126,7 +126,12 @@ static int add_header_field(struct http_client_ctx *client, uint8_t **buf,
 	client->header_field.value = value;
 	client->header_field.value_len = strlen(value);
 
+#if defined(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE)
+	ret = http_hpack_encode_header_indexed(*buf, *buflen, &client->header_field,
+					       &client->hpack_table);
+#else
 	ret = http_hpack_encode_header(*buf, *buflen, &client->header_field);
+#endif
 	if (ret < 0) {
 		return ret;
 	}
@@ -376,6 +381,64 @@ out:
 	return ret;
 }
 
+#if defined(CONFIG_HTTP_SERVER_STATIC_FS)
+static int handle_http2_static_fs_resource(
+	struct http_resource_detail_static_fs *fs_detail,
+	struct http_frame *frame, struct http_client_ctx *client)
+{
+	struct http_resource_detail common = fs_detail->common;
+	char chunk[CONFIG_HTTP_SERVER_STATIC_FS_CHUNK_SIZE];
+	struct fs_file_t file;
+	size_t len;
+	bool gzip;
+	ssize_t read;
+	int ret;
+
+	if (!(fs_detail->common.bitmask_of_supported_http_methods & BIT(HTTP_GET))) {
+		return -ENOTSUP;
+	}
+
+	ret = http_server_static_fs_open(fs_detail, client, &file, &len, &gzip);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (gzip) {
+		common.content_encoding = "gzip";
+	}
+
+	ret = send_headers_frame(client, HTTP_200_OK, frame->stream_identifier,
+				 &common, len == 0 ? HTTP_SERVER_FLAG_END_STREAM : 0);
+	if (ret < 0) {
+		LOG_DBG("Cannot write to socket (%d)", ret);
+		goto out;
+	}
+
+	/* One DATA frame per chunk, the last one ends the stream */
+	while (len > 0) {
+		read = fs_read(&file, chunk, MIN(len, sizeof(chunk)));
+		if (read <= 0) {
+			ret = (read < 0) ? (int)read : -EIO;
+			goto out;
+		}
+
+		len -= read;
+
+		ret = send_data_frame(client, chunk, read, frame->stream_identifier,
+				      len == 0 ? HTTP_SERVER_FLAG_END_STREAM : 0);
+		if (ret < 0) {
+			LOG_DBG("Cannot write to socket (%d)", ret);
+			goto out;
+		}
+	}
+
+out:
+	(void)fs_close(&file);
+
+	return ret;
+}
+#endif /* CONFIG_HTTP_SERVER_STATIC_FS */
+
 static int dynamic_get_req_v2(struct http_resource_detail_dynamic *dynamic_detail,
 			      struct http_client_ctx *client)
 {
@@ -561,7 +624,7 @@ static int handle_http2_dynamic_resource(
 		return -ENOPROTOOPT;
 	}
 
-	if (dynamic_detail->holder != NULL && dynamic_detail->holder != client) {
+	if (!http_server_dynamic_hold(dynamic_detail, client)) {
 		ret = send_http2_409(client, frame);
 		if (ret < 0) {
 			return ret;
@@ -570,8 +633,6 @@ static int handle_http2_dynamic_resource(
 		return enter_http_done_state(client);
 	}
 
-	dynamic_detail->holder = client;
-
 	switch (client->method) {
 	case HTTP_GET:
 		if (user_method & BIT(HTTP_GET)) {
@@ -822,6 +883,19 @@ int handle_http1_to_http2_upgrade(struct http_client_ctx *client)
 			if (ret < 0) {
 				goto error;
 			}
+#if defined(CONFIG_HTTP_SERVER_STATIC_FS)
+		} else if (detail->type == HTTP_RESOURCE_TYPE_STATIC_FS) {
+			ret = handle_http2_static_fs_resource(
+				(struct http_resource_detail_static_fs *)detail,
+				frame, client);
+			if (ret == -ENOENT) {
+				ret = send_http2_404(client, frame);
+			}
+
+			if (ret < 0) {
+				goto error;
+			}
+#endif
 		} else if (detail->type == HTTP_RESOURCE_TYPE_DYNAMIC) {
 			ret = handle_http2_dynamic_resource(
 				(struct http_resource_detail_dynamic *)detail,
@@ -956,6 +1030,10 @@ static int process_header(struct http_client_ctx *client,
 
 		memcpy(client->content_type, header->value, header->value_len);
 		client->content_type[header->value_len] = '\0';
+	} else if (header->name_len == (sizeof("accept-encoding") - 1) &&
+		   memcmp(header->name, "accept-encoding", header->name_len) == 0) {
+		client->accept_gzip = http_server_accepts_gzip(header->value,
+							       header->value_len);
 	} else if (header->name_len == (sizeof("content-length") - 1) &&
 		   memcmp(header->name, "content-length", header->name_len) == 0) {
 		char len_str[16] = { 0 };
@@ -1037,6 +1115,19 @@ int handle_http_frame_headers(struct http_client_ctx *client)
 			if (ret < 0) {
 				return ret;
 			}
+#if defined(CONFIG_HTTP_SERVER_STATIC_FS)
+		} else if (detail->type == HTTP_RESOURCE_TYPE_STATIC_FS) {
+			ret = handle_http2_static_fs_resource(
+				(struct http_resource_detail_static_fs *)detail,
+				frame, client);
+			if (ret == -ENOENT) {
+				ret = send_http2_404(client, frame);
+			}
+
+			if (ret < 0) {
+				return ret;
+			}
+#endif
 		} else if (detail->type == HTTP_RESOURCE_TYPE_DYNAMIC) {
 			ret = handle_http2_dynamic_resource(
 				(struct http_resource_detail_dynamic *)detail,
@@ -1058,6 +1149,7 @@ int handle_http_frame_headers(struct http_client_ctx *client)
 	}
 
 	client->server_state = HTTP_SERVER_FRAME_HEADER_STATE;
+	client->accept_gzip = false;
 
 	return 0;
 }
@@ -1106,6 +1198,28 @@ int handle_http_frame_rst_frame(struct http_client_ctx *client)
 	return 0;
 }
 
+static void apply_settings(struct http_client_ctx *client, const uint8_t *buf,
+			   size_t len)
+{
+	const size_t field_len = sizeof(struct http_settings_field);
+
+	for (; len >= field_len; buf += field_len, len -= field_len) {
+		uint16_t id = sys_get_be16(buf);
+		uint32_t value = sys_get_be32(buf + sizeof(id));
+
+		switch (id) {
+#if defined(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE)
+		case HTTP_SETTINGS_HEADER_TABLE_SIZE:
+			http_hpack_encoder_table_set_max_size(&client->hpack_table, value);
+			break;
+#endif
+		default:
+			LOG_DBG("Setting %u (%u) ignored", id, value);
+			break;
+		}
+	}
+}
+
 int handle_http_frame_settings(struct http_client_ctx *client)
 {
 	struct http_frame *frame = &client->current_frame;
@@ -1119,6 +1233,10 @@ int handle_http_frame_settings(struct http_client_ctx *client)
 		return -EAGAIN;
 	}
 
+	if (!settings_ack_flag(frame->flags)) {
+		apply_settings(client, client->cursor, frame->length);
+	}
+
 	bytes_consumed = client->current_frame.length;
 	client->data_len -= bytes_consumed;
 	client->cursor += bytes_consumed;
@@ -213,6 +213,9 @@ struct lwm2m_engine_obj {
 
 	/* Object is a core object (defined in the official LwM2M spec.) */
 	bool is_core : 1;
+
+	/* Fields are sorted by resource ID, set on registration */
+	bool fields_sorted : 1;
 };
 
 /* Resource instances with this value are considered "not created" yet */
@@ -412,12 +415,18 @@ struct lwm2m_engine_obj_inst {
 	/* instance list */
 	sys_snode_t node;
 
+	/* instance hash bucket list */
+	sys_snode_t index_node;
+
 	struct lwm2m_engine_obj *obj;
 	struct lwm2m_engine_res *resources;
 
 	/* object instance member data */
 	uint16_t obj_inst_id;
 	uint16_t resource_count;
+
+	/* Resources are sorted by resource ID, set on registration */
+	bool resources_sorted;
 };
 
 /* Initialize resource instances prior to use */
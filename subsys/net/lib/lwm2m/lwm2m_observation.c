@@ -204,8 +204,9 @@ static int engine_observe_get_attributes(const struct lwm2m_obj_path *path,
 	struct lwm2m_engine_obj *obj;
 	struct lwm2m_engine_obj_field *obj_field = NULL;
 	struct lwm2m_engine_obj_inst *obj_inst = NULL;
+	struct lwm2m_engine_res *res;
 	struct lwm2m_engine_res_inst *res_inst = NULL;
-	int ret, i;
+	int ret;
 
 	/* defaults from server object */
 	attrs->pmin = lwm2m_server_get_pmin(srv_obj_inst);
@@ -241,20 +242,15 @@ static int engine_observe_get_attributes(const struct lwm2m_obj_path *path,
 
 	/* check if resource exists */
 	if (path->level >= LWM2M_PATH_LEVEL_RESOURCE) {
-		for (i = 0; i < obj_inst->resource_count; i++) {
-			if (obj_inst->resources[i].res_id == path->res_id) {
-				break;
-			}
-		}
-
-		if (i == obj_inst->resource_count) {
+		res = lwm2m_engine_get_obj_inst_res(obj_inst, path->res_id);
+		if (!res) {
 			LOG_ERR("unable to find res_id: %u/%u/%u", path->obj_id, path->obj_inst_id,
 				path->res_id);
 			return -ENOENT;
 		}
 
 		/* load object field data */
-		obj_field = lwm2m_get_engine_obj_field(obj, obj_inst->resources[i].res_id);
+		obj_field = lwm2m_get_engine_obj_field(obj, res->res_id);
 		if (!obj_field) {
 			LOG_ERR("unable to find obj_field: %u/%u/%u", path->obj_id,
 				path->obj_inst_id, path->res_id);
@@ -266,7 +262,7 @@ static int engine_observe_get_attributes(const struct lwm2m_obj_path *path,
 			return -EPERM;
 		}
 
-		ret = update_attrs(&obj_inst->resources[i], attrs);
+		ret = update_attrs(res, attrs);
 		if (ret < 0) {
 			return ret;
 		}
@@ -334,6 +330,28 @@ int engine_observe_attribute_list_get(sys_slist_t *path_list, struct notificatio
 	return 0;
 }
 
+#if CONFIG_LWM2M_ENGINE_NOTIFY_AGGREGATION_WINDOW > 0
+/* Place notification times on a common grid, so that notifications that fall
+ * due close to each other are sent together. Rounding down is only done if the
+ * result is not earlier than @p earliest.
+ */
+static int64_t notify_time_align(int64_t timestamp, int64_t earliest, bool round_up)
+{
+	const int64_t window = CONFIG_LWM2M_ENGINE_NOTIFY_AGGREGATION_WINDOW;
+	int64_t aligned = timestamp - (timestamp % window);
+
+	if (aligned == timestamp) {
+		return timestamp;
+	}
+
+	if (round_up) {
+		return aligned + window;
+	}
+
+	return aligned >= earliest ? aligned : timestamp;
+}
+#endif
+
 int lwm2m_notify_observer_path(const struct lwm2m_obj_path *path)
 {
 	struct observe_node *obs;
@@ -366,6 +384,10 @@ int lwm2m_notify_observer_path(const struct lwm2m_obj_path *path)
 					timestamp = k_uptime_get();
 				}
 
+#if CONFIG_LWM2M_ENGINE_NOTIFY_AGGREGATION_WINDOW > 0
+				timestamp = notify_time_align(timestamp, timestamp, true);
+#endif
+
 				if (!obs->event_timestamp || obs->event_timestamp > timestamp) {
 					obs->resource_update = true;
 					obs->event_timestamp = timestamp;
@@ -1426,6 +1448,13 @@ int64_t engine_observe_shedule_next_event(struct observe_node *obs, uint16_t srv
 
 	if (attrs.pmax) {
 		t_s = timestamp + MSEC_PER_SEC * attrs.pmax;
+#if CONFIG_LWM2M_ENGINE_NOTIFY_AGGREGATION_WINDOW > 0
+		/* Sending early is fine for PMAX, but not before PMIN, and at
+		 * least a second later to keep short PMAX periods from looping.
+		 */
+		t_s = notify_time_align(t_s, timestamp + MSEC_PER_SEC * MAX(attrs.pmin, 1),
+					false);
+#endif
 	}
 
 	return t_s;
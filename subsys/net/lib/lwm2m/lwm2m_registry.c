@@ -88,6 +88,14 @@ static const struct default_obj_version default_obj_versions[] = {
 /* Resources */
 static sys_slist_t engine_obj_list;
 static sys_slist_t engine_obj_inst_list;
+static sys_slist_t engine_obj_inst_index[CONFIG_LWM2M_ENGINE_OBJ_INST_HASH_SIZE];
+
+static inline sys_slist_t *obj_inst_bucket(uint16_t obj_id, uint16_t obj_inst_id)
+{
+	uint32_t hash = ((uint32_t)obj_id << 16 | obj_inst_id) * 2654435761U;
+
+	return &engine_obj_inst_index[hash % CONFIG_LWM2M_ENGINE_OBJ_INST_HASH_SIZE];
+}
 
 /* Resource wrappers */
 sys_slist_t *lwm2m_engine_obj_list(void) { return &engine_obj_list; }
@@ -112,6 +120,14 @@ void lwm2m_register_obj(struct lwm2m_engine_obj *obj)
 	access_control_add_obj(obj->obj_id, server_obj_inst_id);
 #endif /* CONFIG_LWM2M_RD_CLIENT_SUPPORT_BOOTSTRAP */
 #endif /* CONFIG_LWM2M_ACCESS_CONTROL_ENABLE */
+	obj->fields_sorted = true;
+	for (int i = 1; i < obj->field_count; i++) {
+		if (obj->fields[i - 1].res_id >= obj->fields[i].res_id) {
+			obj->fields_sorted = false;
+			break;
+		}
+	}
+
 	sys_slist_append(&engine_obj_list, &obj->node);
 	k_mutex_unlock(&registry_lock);
 }
@@ -145,6 +161,24 @@ struct lwm2m_engine_obj_field *lwm2m_get_engine_obj_field(struct lwm2m_engine_ob
 	int i;
 
 	if (obj && obj->fields && obj->field_count > 0) {
+		if (obj->fields_sorted) {
+			int lo = 0;
+			int hi = obj->field_count - 1;
+
+			while (lo <= hi) {
+				i = lo + (hi - lo) / 2;
+				if (obj->fields[i].res_id == res_id) {
+					return &obj->fields[i];
+				} else if (obj->fields[i].res_id < res_id) {
+					lo = i + 1;
+				} else {
+					hi = i - 1;
+				}
+			}
+
+			return NULL;
+		}
+
 		for (i = 0; i < obj->field_count; i++) {
 			if (obj->fields[i].res_id == res_id) {
 				return &obj->fields[i];
@@ -175,7 +209,17 @@ static void engine_register_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 	access_control_add(obj_inst->obj->obj_id, obj_inst->obj_inst_id, server_obj_inst_id);
 #endif /* CONFIG_LWM2M_RD_CLIENT_SUPPORT_BOOTSTRAP */
 #endif /* CONFIG_LWM2M_ACCESS_CONTROL_ENABLE */
+	obj_inst->resources_sorted = true;
+	for (int i = 1; i < obj_inst->resource_count; i++) {
+		if (obj_inst->resources[i - 1].res_id >= obj_inst->resources[i].res_id) {
+			obj_inst->resources_sorted = false;
+			break;
+		}
+	}
+
 	sys_slist_append(&engine_obj_inst_list, &obj_inst->node);
+	sys_slist_append(obj_inst_bucket(obj_inst->obj->obj_id, obj_inst->obj_inst_id),
+			 &obj_inst->index_node);
 }
 
 static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
@@ -185,13 +229,19 @@ static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 #endif
 	engine_remove_observer_by_id(obj_inst->obj->obj_id, obj_inst->obj_inst_id);
 	sys_slist_find_and_remove(&engine_obj_inst_list, &obj_inst->node);
+	sys_slist_find_and_remove(obj_inst_bucket(obj_inst->obj->obj_id, obj_inst->obj_inst_id),
+				  &obj_inst->index_node);
 }
 
 struct lwm2m_engine_obj_inst *get_engine_obj_inst(int obj_id, int obj_inst_id)
 {
 	struct lwm2m_engine_obj_inst *obj_inst;
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&engine_obj_inst_list, obj_inst, node) {
+	if (obj_id < 0 || obj_id > UINT16_MAX || obj_inst_id < 0 || obj_inst_id > UINT16_MAX) {
+		return NULL;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(obj_inst_bucket(obj_id, obj_inst_id), obj_inst, index_node) {
 		if (obj_inst->obj->obj_id == obj_id && obj_inst->obj_inst_id == obj_inst_id) {
 			return obj_inst;
 		}
@@ -364,6 +414,42 @@ struct lwm2m_engine_obj_inst *lwm2m_engine_get_obj_inst(const struct lwm2m_obj_p
 	return get_engine_obj_inst(path->obj_id, path->obj_inst_id);
 }
 
+struct lwm2m_engine_res *lwm2m_engine_get_obj_inst_res(struct lwm2m_engine_obj_inst *obj_inst,
+						       int res_id)
+{
+	int i;
+
+	if (!obj_inst->resources) {
+		return NULL;
+	}
+
+	if (obj_inst->resources_sorted) {
+		int lo = 0;
+		int hi = obj_inst->resource_count - 1;
+
+		while (lo <= hi) {
+			i = lo + (hi - lo) / 2;
+			if (obj_inst->resources[i].res_id == res_id) {
+				return &obj_inst->resources[i];
+			} else if (obj_inst->resources[i].res_id < res_id) {
+				lo = i + 1;
+			} else {
+				hi = i - 1;
+			}
+		}
+
+		return NULL;
+	}
+
+	for (i = 0; i < obj_inst->resource_count; i++) {
+		if (obj_inst->resources[i].res_id == res_id) {
+			return &obj_inst->resources[i];
+		}
+	}
+
+	return NULL;
+}
+
 int path_to_objs(const struct lwm2m_obj_path *path, struct lwm2m_engine_obj_inst **obj_inst,
 		 struct lwm2m_engine_obj_field **obj_field, struct lwm2m_engine_res **res,
 		 struct lwm2m_engine_res_inst **res_inst)
@@ -395,13 +481,7 @@ int path_to_objs(const struct lwm2m_obj_path *path, struct lwm2m_engine_obj_inst
 		return -ENOENT;
 	}
 
-	for (i = 0; i < oi->resource_count; i++) {
-		if (oi->resources[i].res_id == path->res_id) {
-			r = &oi->resources[i];
-			break;
-		}
-	}
-
+	r = lwm2m_engine_get_obj_inst_res(oi, path->res_id);
 	if (!r) {
 		if (LWM2M_HAS_PERM(of, BIT(LWM2M_FLAG_OPTIONAL))) {
 			LOG_DBG("resource %d not found", path->res_id);
@@ -25,6 +25,9 @@ static void client_reset(struct mqtt_client *client)
 	client->internal.last_activity = 0U;
 	client->internal.rx_buf_datalen = 0U;
 	client->internal.remaining_payload = 0U;
+#if defined(CONFIG_MQTT_PUBLISH_BATCH)
+	client->internal.tx_batch_len = 0U;
+#endif
 }
 
 /** @brief Initialize tx buffer. */
@@ -125,11 +128,30 @@ static int client_read(struct mqtt_client *client)
 	return err_code;
 }
 
+static int client_write_msg(struct mqtt_client *client,
+			    const struct msghdr *message);
+
 static int client_write(struct mqtt_client *client, const uint8_t *data,
 			uint32_t datalen)
 {
 	int err_code;
 
+#if defined(CONFIG_MQTT_PUBLISH_BATCH)
+	if (client->internal.tx_batch_len > 0U) {
+		/* Send the queued packets along with this one. */
+		struct iovec io_vector = {
+			.iov_base = (void *)data,
+			.iov_len = datalen,
+		};
+		struct msghdr msg = {
+			.msg_iov = &io_vector,
+			.msg_iovlen = 1,
+		};
+
+		return client_write_msg(client, &msg);
+	}
+#endif
+
 	NET_DBG("[%p]: Transport writing %d bytes.", client, datalen);
 
 	err_code = mqtt_transport_write(client, data, datalen);
@@ -150,6 +172,29 @@ static int client_write_msg(struct mqtt_client *client,
 			    const struct msghdr *message)
 {
 	int err_code;
+#if defined(CONFIG_MQTT_PUBLISH_BATCH)
+	struct iovec io_vector[3];
+	struct msghdr batch_msg;
+
+	if (client->internal.tx_batch_len > 0U) {
+		/* Prepend the queued packets, keeping the order on the wire. */
+		__ASSERT_NO_MSG(message->msg_iovlen < ARRAY_SIZE(io_vector));
+
+		io_vector[0].iov_base = client->tx_batch_buf;
+		io_vector[0].iov_len = client->internal.tx_batch_len;
+		if (message->msg_iovlen > 0) {
+			memcpy(&io_vector[1], message->msg_iov,
+			       message->msg_iovlen * sizeof(struct iovec));
+		}
+
+		batch_msg = *message;
+		batch_msg.msg_iov = io_vector;
+		batch_msg.msg_iovlen = message->msg_iovlen + 1;
+		message = &batch_msg;
+
+		client->internal.tx_batch_len = 0U;
+	}
+#endif
 
 	NET_DBG("[%p]: Transport writing message.", client);
 
@@ -236,6 +281,42 @@ static int verify_tx_state(const struct mqtt_client *client)
 	return 0;
 }
 
+#if defined(CONFIG_MQTT_PUBLISH_BATCH)
+static bool publish_batch_queue(struct mqtt_client *client,
+				const struct mqtt_publish_param *param,
+				const struct buf_ctx *packet)
+{
+	uint32_t header_len = packet->end - packet->cur;
+	uint32_t payload_len = param->message.payload.len;
+	uint8_t *dst;
+
+	if ((client->tx_batch_buf == NULL) ||
+	    (param->message.topic.qos != MQTT_QOS_0_AT_MOST_ONCE)) {
+		return false;
+	}
+
+	if (header_len + payload_len >
+	    client->tx_batch_buf_size - client->internal.tx_batch_len) {
+		/* Does not fit, the caller sends it together with the batch. */
+		return false;
+	}
+
+	dst = client->tx_batch_buf + client->internal.tx_batch_len;
+	memcpy(dst, packet->cur, header_len);
+	if (payload_len > 0U) {
+		memcpy(dst + header_len, param->message.payload.data,
+		       payload_len);
+	}
+
+	client->internal.tx_batch_len += header_len + payload_len;
+
+	NET_DBG("[CID %p]: Queued publish, batch length %u", client,
+		client->internal.tx_batch_len);
+
+	return true;
+}
+#endif
+
 int mqtt_publish(struct mqtt_client *client,
 		 const struct mqtt_publish_param *param)
 {
@@ -266,6 +347,12 @@ int mqtt_publish(struct mqtt_client *client,
 		goto error;
 	}
 
+#if defined(CONFIG_MQTT_PUBLISH_BATCH)
+	if (publish_batch_queue(client, param, &packet)) {
+		goto error;
+	}
+#endif
+
 	io_vector[0].iov_base = packet.cur;
 	io_vector[0].iov_len = packet.end - packet.cur;
 	io_vector[1].iov_base = param->message.payload.data;
@@ -287,6 +374,34 @@ error:
 	return err_code;
 }
 
+int mqtt_publish_flush(struct mqtt_client *client)
+{
+#if defined(CONFIG_MQTT_PUBLISH_BATCH)
+	int err_code = 0;
+	struct msghdr msg;
+
+	NULL_PARAM_CHECK(client);
+
+	mqtt_mutex_lock(client);
+
+	if (client->internal.tx_batch_len > 0U) {
+		err_code = verify_tx_state(client);
+		if (err_code == 0) {
+			memset(&msg, 0, sizeof(msg));
+			err_code = client_write_msg(client, &msg);
+		}
+	}
+
+	mqtt_mutex_unlock(client);
+
+	return err_code;
+#else
+	ARG_UNUSED(client);
+
+	return -ENOTSUP;
+#endif
+}
+
 int mqtt_publish_qos1_ack(struct mqtt_client *client,
 			  const struct mqtt_puback_param *param)
 {
@@ -601,6 +716,19 @@ int mqtt_live(struct mqtt_client *client)
 
 	mqtt_mutex_lock(client);
 
+#if defined(CONFIG_MQTT_PUBLISH_BATCH)
+	if ((client->internal.tx_batch_len > 0U) &&
+	    (verify_tx_state(client) == 0)) {
+		struct msghdr msg = { 0 };
+
+		err_code = client_write_msg(client, &msg);
+		if (err_code < 0) {
+			mqtt_mutex_unlock(client);
+			return err_code;
+		}
+	}
+#endif
+
 	elapsed_time = mqtt_elapsed_time_in_ms_get(
 				client->internal.last_activity);
 	if ((client->keepalive > 0) &&
@@ -17,6 +17,7 @@ LOG_MODULE_REGISTER(ptp_clock, CONFIG_PTP_LOG_LEVEL);
 #include <zephyr/drivers/ptp_clock.h>
 #include <zephyr/net/ethernet.h>
 #include <zephyr/net/net_if.h>
+#include <zephyr/net/ptp.h>
 #include <zephyr/net/socket.h>
 #include <zephyr/sys/slist.h>
 
@@ -31,6 +32,12 @@ LOG_MODULE_REGISTER(ptp_clock, CONFIG_PTP_LOG_LEVEL);
 #define MIN_NSEC_TO_TIMEINTERVAL (0xFFFF800000000000ULL)
 #define MAX_NSEC_TO_TIMEINTERVAL (0x00007FFFFFFFFFFFULL)
 
+#if defined(CONFIG_PTP_SERVO_PI)
+#define SERVO_KP      (CONFIG_PTP_SERVO_PI_KP / 1000.0)
+#define SERVO_KI      (CONFIG_PTP_SERVO_PI_KI / 1000.0)
+#define SERVO_MAX_PPB ((double)CONFIG_PTP_SERVO_PI_MAX_PPB)
+#endif
+
 /**
  * @brief PTP Clock structure.
  */
@@ -53,6 +60,18 @@ struct ptp_clock {
 		uint64_t	    t3;
 		uint64_t	    t4;
 	} timestamp;			/* latest timestamps in nanoseconds */
+#if defined(CONFIG_PTP_SERVO_PI)
+	struct {
+		double		    freq_ppb;	/* frequency correction applied */
+		double		    drift_ppb;	/* integral term */
+		bool		    locked;	/* phase stepped, rate being steered */
+	} servo;
+#endif
+#if defined(CONFIG_PTP_STATS)
+	struct k_spinlock	    stats_lock;
+	struct ptp_stats	    stats;
+	uint64_t		    offset_abs_sum;
+#endif
 };
 
 __maybe_unused static struct ptp_clock ptp_clk = { 0 };
@@ -506,10 +525,114 @@ int ptp_clock_management_msg_process(struct ptp_port *port, struct ptp_msg *msg)
 	return state_decision_required;
 }
 
+static void clock_stats_offset(int64_t offset, bool step)
+{
+#if defined(CONFIG_PTP_STATS)
+	k_spinlock_key_t key = k_spin_lock(&ptp_clk.stats_lock);
+	struct ptp_stats *stats = &ptp_clk.stats;
+
+	if (stats->offset_count == 0U || offset < stats->offset_min) {
+		stats->offset_min = offset;
+	}
+	if (stats->offset_count == 0U || offset > stats->offset_max) {
+		stats->offset_max = offset;
+	}
+
+	stats->offset_count++;
+	stats->offset_last = offset;
+	ptp_clk.offset_abs_sum += (uint64_t)llabs(offset);
+
+	if (step) {
+		stats->step_count++;
+	}
+
+#if defined(CONFIG_PTP_SERVO_PI)
+	stats->freq_ppb = (int32_t)ptp_clk.servo.freq_ppb;
+#endif
+
+	k_spin_unlock(&ptp_clk.stats_lock, key);
+#else
+	ARG_UNUSED(offset);
+	ARG_UNUSED(step);
+#endif
+}
+
+static void clock_stats_delay(int64_t delay)
+{
+#if defined(CONFIG_PTP_STATS)
+	k_spinlock_key_t key = k_spin_lock(&ptp_clk.stats_lock);
+	struct ptp_stats *stats = &ptp_clk.stats;
+
+	if (stats->delay_count == 0U || delay < stats->delay_min) {
+		stats->delay_min = delay;
+	}
+	if (stats->delay_count == 0U || delay > stats->delay_max) {
+		stats->delay_max = delay;
+	}
+
+	stats->delay_count++;
+	stats->delay_last = delay;
+
+	k_spin_unlock(&ptp_clk.stats_lock, key);
+#else
+	ARG_UNUSED(delay);
+#endif
+}
+
+#if defined(CONFIG_PTP_SERVO_PI)
+static void clock_servo_reset(void)
+{
+	if (ptp_clk.servo.freq_ppb != 0.0) {
+		/* Give the clock its nominal rate back */
+		(void)ptp_clock_rate_adjust(ptp_clk.phc,
+					    1.0 / (1.0 - ptp_clk.servo.freq_ppb / NSEC_PER_SEC));
+	}
+
+	ptp_clk.servo.freq_ppb = 0.0;
+	ptp_clk.servo.drift_ppb = 0.0;
+	ptp_clk.servo.locked = false;
+}
+
+/*
+ * Steer the clock rate by the offset measured from a Sync message. Returns
+ * false if the phase has to be stepped instead, the servo being reset.
+ */
+static bool clock_servo_pi(int64_t offset, uint64_t interval_ns)
+{
+	double interval = (double)interval_ns / NSEC_PER_SEC;
+	double ppb;
+
+	if (!ptp_clk.servo.locked || interval_ns == 0U) {
+		clock_servo_reset();
+		ptp_clk.servo.locked = true;
+		return false;
+	}
+
+	ptp_clk.servo.drift_ppb += SERVO_KI * offset * interval;
+	ppb = SERVO_KP * offset + ptp_clk.servo.drift_ppb;
+
+	if (ppb > SERVO_MAX_PPB || ppb < -SERVO_MAX_PPB) {
+		LOG_WRN("Frequency correction out of range, resetting the servo");
+		clock_servo_reset();
+		ptp_clk.servo.locked = true;
+		return false;
+	}
+
+	/* The driver scales its current rate, a positive offset slows the clock down */
+	if (ptp_clock_rate_adjust(ptp_clk.phc, (1.0 - ppb / NSEC_PER_SEC) /
+				  (1.0 - ptp_clk.servo.freq_ppb / NSEC_PER_SEC)) == 0) {
+		ptp_clk.servo.freq_ppb = ppb;
+	}
+
+	return true;
+}
+#endif /* CONFIG_PTP_SERVO_PI */
+
 void ptp_clock_synchronize(uint64_t ingress, uint64_t egress)
 {
 	int64_t offset;
 	uint64_t delay = ptp_clk.current_ds.mean_delay >> 16;
+	uint64_t prev_ingress = ptp_clk.timestamp.t2;
 
 	ptp_clk.timestamp.t1 = egress;
 	ptp_clk.timestamp.t2 = ingress;
@@ -532,13 +655,27 @@ void ptp_clock_synchronize(uint64_t ingress, uint64_t egress)
 		current.nanosecond -= (uint32_t)(offset % NSEC_PER_SEC);
 
 		ptp_clock_set(ptp_clk.phc, &current);
+#if defined(CONFIG_PTP_SERVO_PI)
+		clock_servo_reset();
+#endif
+		clock_stats_offset(offset, true);
 		return;
 	}
 
 	LOG_DBG("Offset %lldns", offset);
 	ptp_clk.current_ds.offset_from_tt = clock_ns_to_timeinterval(offset);
 
+#if defined(CONFIG_PTP_SERVO_PI)
+	if (clock_servo_pi(offset, ingress > prev_ingress ? ingress - prev_ingress : 0U)) {
+		clock_stats_offset(offset, false);
+		return;
+	}
+#else
+	ARG_UNUSED(prev_ingress);
+#endif
+
 	ptp_clock_adjust(ptp_clk.phc, offset);
+	clock_stats_offset(offset, IS_ENABLED(CONFIG_PTP_SERVO_PI));
 }
 
 void ptp_clock_delay(uint64_t egress, uint64_t ingress)
@@ -553,7 +690,32 @@ void ptp_clock_delay(uint64_t egress, uint64_t ingress)
 
 	LOG_DBG("Delay %lldns", delay);
 	ptp_clk.current_ds.mean_delay = clock_ns_to_timeinterval(delay);
+	clock_stats_delay(delay);
+}
+
+#if defined(CONFIG_PTP_STATS)
+void ptp_stats_get(struct ptp_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&ptp_clk.stats_lock);
+
+	*stats = ptp_clk.stats;
+	if (stats->offset_count != 0U) {
+		stats->offset_abs_mean = ptp_clk.offset_abs_sum / stats->offset_count;
+	}
+
+	k_spin_unlock(&ptp_clk.stats_lock, key);
+}
+
+void ptp_stats_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&ptp_clk.stats_lock);
+
+	(void)memset(&ptp_clk.stats, 0, sizeof(ptp_clk.stats));
+	ptp_clk.offset_abs_sum = 0U;
+
+	k_spin_unlock(&ptp_clk.stats_lock, key);
 }
+#endif /* CONFIG_PTP_STATS */
 
 sys_slist_t *ptp_clock_ports_list(void)
 {
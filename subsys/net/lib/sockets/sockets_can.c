@@ -23,12 +23,14 @@ LOG_MODULE_REGISTER(net_sock_can, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/net/socketcan.h>
 #include <zephyr/net/socketcan_utils.h>
 #include <zephyr/drivers/can.h>
+#include <zephyr/drivers/can/filter_table.h>
 
 #include "sockets_internal.h"
 
 #define MEM_ALLOC_TIMEOUT K_MSEC(50)
 
 struct can_recv {
+	sys_snode_t node;
 	struct net_if *iface;
 	struct net_context *ctx;
 	socketcan_id_t can_id;
@@ -37,6 +39,13 @@ struct can_recv {
 
 static struct can_recv receivers[CONFIG_NET_SOCKETS_CAN_RECEIVERS];
 
+/* Receivers matching a single CAN ID are hashed by that ID, the others are
+ * in a list matched against every frame.
+ */
+static sys_slist_t receiver_buckets[CAN_FILTER_TABLE_BUCKETS(CONFIG_NET_SOCKETS_CAN_RECEIVERS)];
+static sys_slist_t masked_receivers;
+static K_MUTEX_DEFINE(receivers_lock);
+
 extern const struct socket_op_vtable sock_fd_op_vtable;
 
 static const struct socket_op_vtable can_sock_fd_op_vtable;
@@ -86,101 +95,143 @@ int zcan_socket(int family, int type, int proto)
 	return fd;
 }
 
-static void zcan_received_cb(struct net_context *ctx, struct net_pkt *pkt,
-			     union net_ip_header *ip_hdr,
-			     union net_proto_header *proto_hdr,
-			     int status, void *user_data)
+static socketcan_id_t can_recv_id_mask(socketcan_id_t can_id)
 {
-	/* The ctx parameter is not really relevant here. It refers to first
-	 * net_context that was used when registering CAN socket.
-	 * In practice there can be multiple sockets that are interested in
-	 * same CAN id packets. That is why we need to implement the dispatcher
-	 * which will give the packet to correct net_context(s).
-	 */
-	struct net_pkt *clone = NULL;
-	int i;
+	return (can_id & BIT(31)) != 0 ? BIT_MASK(29) : CAN_STD_ID_MASK;
+}
 
-	for (i = 0; i < ARRAY_SIZE(receivers); i++) {
-		struct can_frame *zframe =
-			(struct can_frame *)net_pkt_data(pkt);
-		struct socketcan_frame sframe;
+static sys_slist_t *can_recv_bucket(socketcan_id_t can_id)
+{
+	socketcan_id_t id = can_id & can_recv_id_mask(can_id);
 
-		if (!receivers[i].ctx ||
-		    receivers[i].iface != net_pkt_iface(pkt)) {
-			continue;
-		}
+	return &receiver_buckets[can_filter_table_hash(id, ARRAY_SIZE(receiver_buckets))];
+}
 
-		socketcan_from_can_frame(zframe, &sframe);
+static sys_slist_t *can_recv_list(socketcan_id_t can_id, socketcan_id_t can_mask)
+{
+	socketcan_id_t id_mask = can_recv_id_mask(can_id);
 
-		if ((sframe.can_id & receivers[i].can_mask) !=
-		    (receivers[i].can_id & receivers[i].can_mask)) {
-			continue;
-		}
+	/* A receiver matches a single CAN ID if its mask covers the ID type
+	 * and all the ID bits of that type.
+	 */
+	if ((can_mask & BIT(31)) == 0 || (can_mask & id_mask) != id_mask) {
+		return &masked_receivers;
+	}
+
+	return can_recv_bucket(can_id);
+}
+
+static struct net_pkt *zcan_deliver(struct can_recv *recv, struct net_pkt *pkt,
+				    int status)
+{
+	struct net_context *ctx = recv->ctx;
+	struct net_pkt *clone;
 
-		/* If there are multiple receivers configured, we use the
-		 * original net_pkt as a template, and just clone it to all
-		 * recipients. This is done like this so that we avoid the
-		 * original net_pkt being freed while we are cloning it.
+	/* If there are multiple receivers configured, we use the
+	 * original net_pkt as a template, and just clone it to all
+	 * recipients. This is done like this so that we avoid the
+	 * original net_pkt being freed while we are cloning it.
+	 */
+	if (pkt != NULL && ARRAY_SIZE(receivers) > 1) {
+		/* There are multiple receivers, we need to clone
+		 * the packet.
 		 */
-		if (pkt != NULL && ARRAY_SIZE(receivers) > 1) {
-			/* There are multiple receivers, we need to clone
-			 * the packet.
+		clone = net_pkt_clone(pkt, MEM_ALLOC_TIMEOUT);
+		if (!clone) {
+			/* Sent the packet to at least one recipient
+			 * if there is no memory to clone the packet.
 			 */
-			clone = net_pkt_clone(pkt, MEM_ALLOC_TIMEOUT);
-			if (!clone) {
-				/* Sent the packet to at least one recipient
-				 * if there is no memory to clone the packet.
-				 */
-				clone = pkt;
-			}
-		} else {
 			clone = pkt;
 		}
+	} else {
+		clone = pkt;
+	}
 
-		ctx = receivers[i].ctx;
+	/* To prevent the reader from missing the wake-up signal
+	 *  as described in commit 1184089 and implemented in sockets.c
+	 */
+	if (ctx->cond.lock) {
+		(void)k_mutex_lock(ctx->cond.lock, K_FOREVER);
+	}
 
-		/* To prevent the reader from missing the wake-up signal
-		 *  as described in commit 1184089 and implemented in sockets.c
-		 */
-		if (ctx->cond.lock) {
-			(void)k_mutex_lock(ctx->cond.lock, K_FOREVER);
+	NET_DBG("[%d] ctx %p pkt %p st %d", (int)(recv - receivers), ctx, clone, status);
+
+	/* if pkt is NULL, EOF */
+	if (!clone) {
+		struct net_pkt *last_pkt =
+			k_fifo_peek_tail(&ctx->recv_q);
+
+		if (!last_pkt) {
+			/* If there're no packets in the queue,
+			 * recv() may be blocked waiting on it to
+			 * become non-empty, so cancel that wait.
+			 */
+			sock_set_eof(ctx);
+			k_fifo_cancel_wait(&ctx->recv_q);
+
+			NET_DBG("Marked socket %p as peer-closed", ctx);
+		} else {
+			net_pkt_set_eof(last_pkt, true);
+
+			NET_DBG("Set EOF flag on pkt %p", ctx);
 		}
+	} else {
+		/* Normal packet */
+		net_pkt_set_eof(clone, false);
 
-		NET_DBG("[%d] ctx %p pkt %p st %d", i, ctx, clone, status);
+		k_fifo_put(&ctx->recv_q, clone);
+	}
 
-		/* if pkt is NULL, EOF */
-		if (!clone) {
-			struct net_pkt *last_pkt =
-				k_fifo_peek_tail(&ctx->recv_q);
+	if (ctx->cond.lock) {
+		k_mutex_unlock(ctx->cond.lock);
+	}
 
-			if (!last_pkt) {
-				/* If there're no packets in the queue,
-				 * recv() may be blocked waiting on it to
-				 * become non-empty, so cancel that wait.
-				 */
-				sock_set_eof(ctx);
-				k_fifo_cancel_wait(&ctx->recv_q);
+	k_condvar_signal(&ctx->cond.recv);
 
-				NET_DBG("Marked socket %p as peer-closed", ctx);
-			} else {
-				net_pkt_set_eof(last_pkt, true);
+	return clone;
+}
 
-				NET_DBG("Set EOF flag on pkt %p", ctx);
+static void zcan_received_cb(struct net_context *ctx, struct net_pkt *pkt,
+			     union net_ip_header *ip_hdr,
+			     union net_proto_header *proto_hdr,
+			     int status, void *user_data)
+{
+	/* The ctx parameter is not really relevant here. It refers to first
+	 * net_context that was used when registering CAN socket.
+	 * In practice there can be multiple sockets that are interested in
+	 * same CAN id packets. That is why we need to implement the dispatcher
+	 * which will give the packet to correct net_context(s).
+	 */
+	struct can_frame *zframe = (struct can_frame *)net_pkt_data(pkt);
+	struct socketcan_frame sframe;
+	struct net_pkt *clone = NULL;
+	sys_slist_t *lists[2];
+	struct can_recv *recv;
+
+	socketcan_from_can_frame(zframe, &sframe);
+
+	lists[0] = can_recv_bucket(sframe.can_id);
+	lists[1] = &masked_receivers;
+
+	k_mutex_lock(&receivers_lock, K_FOREVER);
+
+	ARRAY_FOR_EACH(lists, i) {
+		SYS_SLIST_FOR_EACH_CONTAINER(lists[i], recv, node) {
+			if (recv->iface != net_pkt_iface(pkt)) {
+				continue;
 			}
-		} else {
-			/* Normal packet */
-			net_pkt_set_eof(clone, false);
 
-			k_fifo_put(&ctx->recv_q, clone);
-		}
+			if ((sframe.can_id & recv->can_mask) !=
+			    (recv->can_id & recv->can_mask)) {
+				continue;
+			}
 
-		if (ctx->cond.lock) {
-			k_mutex_unlock(ctx->cond.lock);
+			clone = zcan_deliver(recv, pkt, status);
 		}
-
-		k_condvar_signal(&ctx->cond.recv);
 	}
 
+	k_mutex_unlock(&receivers_lock);
+
 	if (clone && clone != pkt) {
 		net_pkt_unref(pkt);
 	}
@@ -419,7 +470,12 @@ static int can_close_socket(struct net_context *ctx)
 		if (receivers[i].ctx == ctx) {
 			struct socketcan_filter sfilter;
 
+			k_mutex_lock(&receivers_lock, K_FOREVER);
+			(void)sys_slist_find_and_remove(can_recv_list(receivers[i].can_id,
+								      receivers[i].can_mask),
+							&receivers[i].node);
 			receivers[i].ctx = NULL;
+			k_mutex_unlock(&receivers_lock);
 
 			sfilter.can_id = receivers[i].can_id;
 			sfilter.can_mask = receivers[i].can_mask;
@@ -547,6 +603,8 @@ static int can_register_receiver(struct net_if *iface, struct net_context *ctx,
 
 	NET_DBG("Max %zu receivers", ARRAY_SIZE(receivers));
 
+	k_mutex_lock(&receivers_lock, K_FOREVER);
+
 	for (i = 0; i < ARRAY_SIZE(receivers); i++) {
 		if (receivers[i].ctx != NULL) {
 			continue;
@@ -556,10 +614,15 @@ static int can_register_receiver(struct net_if *iface, struct net_context *ctx,
 		receivers[i].iface = iface;
 		receivers[i].can_id = can_id;
 		receivers[i].can_mask = can_mask;
+		sys_slist_append(can_recv_list(can_id, can_mask), &receivers[i].node);
+
+		k_mutex_unlock(&receivers_lock);
 
 		return i;
 	}
 
+	k_mutex_unlock(&receivers_lock);
+
 	return -ENOENT;
 }
 
@@ -567,17 +630,23 @@ static void can_unregister_receiver(struct net_if *iface,
 				    struct net_context *ctx,
 				    socketcan_id_t can_id, socketcan_id_t can_mask)
 {
-	int i;
-
-	for (i = 0; i < ARRAY_SIZE(receivers); i++) {
-		if (receivers[i].ctx == ctx &&
-		    receivers[i].iface == iface &&
-		    receivers[i].can_id == can_id &&
-		    receivers[i].can_mask == can_mask) {
-			receivers[i].ctx = NULL;
-			return;
+	struct can_recv *recv;
+
+	k_mutex_lock(&receivers_lock, K_FOREVER);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(can_recv_list(can_id, can_mask), recv, node) {
+		if (recv->ctx == ctx &&
+		    recv->iface == iface &&
+		    recv->can_id == can_id &&
+		    recv->can_mask == can_mask) {
+			(void)sys_slist_find_and_remove(can_recv_list(can_id, can_mask),
+							&recv->node);
+			recv->ctx = NULL;
+			break;
 		}
 	}
+
+	k_mutex_unlock(&receivers_lock);
 }
 
 static int can_register_filters(struct net_if *iface, struct net_context *ctx,
@@ -11,6 +11,9 @@ LOG_MODULE_REGISTER(net_sock_svc, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/init.h>
 #include <zephyr/net/socket_service.h>
 #include <zephyr/zvfs/eventfd.h>
+#if defined(CONFIG_NET_SOCKETS_SERVICE_EPOLL)
+#include <zephyr/zvfs/epoll.h>
+#endif
 
 static int init_socket_service(void);
 static bool init_done;
@@ -23,10 +26,56 @@ STRUCT_SECTION_END_EXTERN(net_socket_service_desc);
 
 static struct service {
 	struct zsock_pollfd events[CONFIG_NET_SOCKETS_POLL_MAX];
+	/* Service event of each entry of events[], for O(1) dispatching */
+	struct net_socket_service_event *slots[CONFIG_NET_SOCKETS_POLL_MAX];
+	struct k_thread *thread;
+#if defined(CONFIG_NET_SOCKETS_SERVICE_EPOLL)
+	/* Interest set of the registered sockets, kept across waits */
+	int epfd;
+#endif
 	int count;
 } ctx;
 
 #define get_idx(svc) (*(svc->idx))
+#define get_slot(svc, pev) (get_idx(svc) + ((pev) - (svc)->pev))
+
+#if CONFIG_NET_SOCKETS_SERVICE_WORKQS > 0
+static struct k_work_q workqs[CONFIG_NET_SOCKETS_SERVICE_WORKQS];
+static K_THREAD_STACK_ARRAY_DEFINE(workq_stacks, CONFIG_NET_SOCKETS_SERVICE_WORKQS,
+				   CONFIG_NET_SOCKETS_SERVICE_WORKQ_STACK_SIZE);
+#endif
+
+#if defined(CONFIG_NET_SOCKETS_SERVICE_EPOLL)
+/* Start, or stop, waiting for the events of a service socket */
+static void watch_event(struct net_socket_service_event *pev, bool watch)
+{
+	struct zvfs_epoll_event ev = {
+		.events = pev->event.events,
+		.data.ptr = pev,
+	};
+
+	if (pev->event.fd < 0) {
+		return;
+	}
+
+	/* Fails harmlessly when the socket is already in the state asked for */
+	(void)zvfs_epoll_ctl(ctx.epfd, watch ? ZVFS_EPOLL_CTL_ADD : ZVFS_EPOLL_CTL_DEL,
+			     pev->event.fd, &ev);
+}
+#endif
+
+/* Make the socket of a service event pollable again */
+static void restore_event(const struct net_socket_service_desc *svc,
+			  struct net_socket_service_event *pev)
+{
+#if defined(CONFIG_NET_SOCKETS_SERVICE_EPOLL)
+	ARG_UNUSED(svc);
+
+	watch_event(pev, true);
+#else
+	ctx.events[get_slot(svc, pev)] = pev->event;
+#endif
+}
 
 void net_socket_service_foreach(net_socket_service_cb_t cb, void *user_data)
 {
@@ -38,6 +87,9 @@ void net_socket_service_foreach(net_socket_service_cb_t cb, void *user_data)
 static void cleanup_svc_events(const struct net_socket_service_desc *svc)
 {
 	for (int i = 0; i < svc->pev_len; i++) {
+#if defined(CONFIG_NET_SOCKETS_SERVICE_EPOLL)
+		watch_event(&svc->pev[i], false);
+#endif
 		ctx.events[get_idx(svc) + i].fd = -1;
 		svc->pev[i].event.fd = -1;
 		svc->pev[i].event.events = 0;
@@ -72,13 +124,20 @@ int z_impl_net_socket_service_register(const struct net_socket_service_desc *svc
 			goto out;
 		}
 
+#if defined(CONFIG_NET_SOCKETS_SERVICE_EPOLL)
+		/* Only the sockets of this service are updated in the set */
+		for (i = 0; i < svc->pev_len; i++) {
+			watch_event(&svc->pev[i], false);
+		}
+#endif
+
 		for (i = 0; i < len; i++) {
 			svc->pev[i].event = fds[i];
 			svc->pev[i].user_data = user_data;
 		}
 
 		for (i = 0; i < svc->pev_len; i++) {
-			ctx.events[get_idx(svc) + i] = svc->pev[i].event;
+			restore_event(svc, &svc->pev[i]);
 		}
 	}
 
@@ -92,22 +151,6 @@ out:
 	return ret;
 }
 
-static struct net_socket_service_desc *find_svc_and_event(
-	struct zsock_pollfd *pev,
-	struct net_socket_service_event **event)
-{
-	STRUCT_SECTION_FOREACH(net_socket_service_desc, svc) {
-		for (int i = 0; i < svc->pev_len; i++) {
-			if (svc->pev[i].event.fd == pev->fd) {
-				*event = &svc->pev[i];
-				return svc;
-			}
-		}
-	}
-
-	return NULL;
-}
-
 /* We do not set the user callback to our work struct because we need to
  * hook into the flow and restore the global poll array so that the next poll
  * round will not notice it and call the callback again while we are
@@ -122,23 +165,37 @@ void net_socket_service_callback(struct k_work *work)
 
 	ev.callback(&ev.work);
 
-	/* Copy back the socket fd to the global array because we marked
-	 * it as -1 when triggering the work.
+	/* Make the socket pollable again, because we marked it as -1, or
+	 * removed it from the interest set, when triggering the work.
 	 */
-	for (int i = 0; i < svc->pev_len; i++) {
-		ctx.events[get_idx(svc) + i] = svc->pev[i].event;
+	restore_event(svc, pev);
+
+	if (k_current_get() != ctx.thread) {
+		/* Let the service thread poll the socket again */
+		zvfs_eventfd_write(ctx.events[0].fd, 1);
 	}
 }
 
-static int call_work(struct zsock_pollfd *pev, struct k_work_q *work_q,
-		     struct k_work *work)
+static struct k_work_q *get_work_q(const struct net_socket_service_desc *svc,
+				   struct net_socket_service_event *event)
 {
-	int ret = 0;
+#if CONFIG_NET_SOCKETS_SERVICE_WORKQS > 0
+	if (svc->work_q == NULL) {
+		/* A socket is always handled by the same queue, so that its
+		 * events are processed in order.
+		 */
+		return &workqs[get_slot(svc, event) % ARRAY_SIZE(workqs)];
+	}
+#else
+	ARG_UNUSED(event);
+#endif
 
-	/* Mark the global fd non pollable so that we do not
-	 * call the callback second time.
-	 */
-	pev->fd = -1;
+	return svc->work_q;
+}
+
+static int call_work(struct k_work_q *work_q, struct k_work *work)
+{
+	int ret = 0;
 
 	if (work->handler == NULL) {
 		/* Synchronous call */
@@ -157,30 +214,98 @@ static int call_work(struct zsock_pollfd *pev, struct k_work_q *work_q,
 
 }
 
-static int trigger_work(struct zsock_pollfd *pev)
+static int trigger_work(struct net_socket_service_event *event, short revents)
 {
-	struct net_socket_service_event *event;
-	struct net_socket_service_desc *svc;
+	struct net_socket_service_desc *svc = event->svc;
 
-	svc = find_svc_and_event(pev, &event);
-	if (svc == NULL) {
+	if (event->event.fd < 0) {
+		/* Unregistered while the event was pending */
 		return -ENOENT;
 	}
 
-	event->svc = svc;
+	/* Record what was actually causing the event. */
+	event->event.revents = revents;
 
-	/* Copy the triggered event to our event so that we know what
-	 * was actually causing the event.
+	/* Stop polling the socket so that we do not call the callback a
+	 * second time.
 	 */
-	event->event = *pev;
+#if defined(CONFIG_NET_SOCKETS_SERVICE_EPOLL)
+	watch_event(event, false);
+#else
+	ctx.events[get_slot(svc, event)].fd = -1;
+#endif
 
-	return call_work(pev, svc->work_q, &event->work);
+	return call_work(get_work_q(svc, event), &event->work);
 }
 
-static void socket_service_thread(void)
+#if defined(CONFIG_NET_SOCKETS_SERVICE_EPOLL)
+static int wait_events(int count)
+{
+	struct zvfs_epoll_event events[CONFIG_NET_SOCKETS_SERVICE_EPOLL_BATCH];
+	zvfs_eventfd_t value;
+	int ret;
+
+	ARG_UNUSED(count);
+
+	ret = zvfs_epoll_wait(ctx.epfd, events, ARRAY_SIZE(events), -1);
+	if (ret < 0) {
+		return -errno;
+	}
+
+	for (int i = 0; i < ret; i++) {
+		struct net_socket_service_event *event = events[i].data.ptr;
+		int err;
+
+		if (event == NULL) {
+			/* Registration changed, or a socket can be polled again */
+			zvfs_eventfd_read(ctx.events[0].fd, &value);
+			continue;
+		}
+
+		err = trigger_work(event, events[i].events);
+		if (err < 0) {
+			NET_DBG("Triggering work failed (%d)", err);
+		}
+	}
+
+	return 0;
+}
+#else
+static int wait_events(int count)
 {
-	int ret, i, fd, count = 0;
 	zvfs_eventfd_t value;
+	int ret;
+
+	ret = zsock_poll(ctx.events, count + 1, -1);
+	if (ret < 0) {
+		return -errno;
+	}
+
+	if (ctx.events[0].revents) {
+		/* The entries were updated in place, poll them again */
+		zvfs_eventfd_read(ctx.events[0].fd, &value);
+		NET_DBG("Received restart event.");
+		return 0;
+	}
+
+	for (int i = 1; i < (count + 1); i++) {
+		if (ctx.events[i].fd < 0 || ctx.events[i].revents == 0) {
+			continue;
+		}
+
+		ret = trigger_work(ctx.slots[i], ctx.events[i].revents);
+		if (ret < 0) {
+			NET_DBG("Triggering work failed (%d)", ret);
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_NET_SOCKETS_SERVICE_EPOLL */
+
+static void socket_service_thread(void)
+{
+	int ret, fd, count = 0;
 
 	STRUCT_SECTION_COUNT(net_socket_service_desc, &ret);
 	if (ret == 0) {
@@ -196,6 +321,13 @@ static void socket_service_thread(void)
 			svc->pev_len);
 		get_idx(svc) = count + 1;
 		count += svc->pev_len;
+
+		if (count < ARRAY_SIZE(ctx.slots)) {
+			for (int j = 0; j < svc->pev_len; j++) {
+				ctx.slots[get_idx(svc) + j] = &svc->pev[j];
+				svc->pev[j].svc = svc;
+			}
+		}
 	}
 
 	if ((count + 1) > ARRAY_SIZE(ctx.events)) {
@@ -219,57 +351,46 @@ static void socket_service_thread(void)
 		goto out;
 	}
 
-	init_done = true;
-	k_condvar_broadcast(&wait_start);
-
 	ctx.events[0].fd = fd;
 	ctx.events[0].events = ZSOCK_POLLIN;
 
-restart:
-	i = 1;
+#if defined(CONFIG_NET_SOCKETS_SERVICE_EPOLL)
+	ctx.epfd = zvfs_epoll_create(0);
+	if (ctx.epfd < 0) {
+		ret = -errno;
+		NET_ERR("epoll create failed (%d)", ret);
+		goto out;
+	}
+
+	ret = zvfs_epoll_ctl(ctx.epfd, ZVFS_EPOLL_CTL_ADD, fd,
+			     &(struct zvfs_epoll_event){ .events = ZVFS_EPOLLIN });
+	if (ret < 0) {
+		ret = -errno;
+		NET_ERR("epoll add failed (%d)", ret);
+		goto out;
+	}
+#endif
 
+	/* Services registered from now on update their own entries only */
 	k_mutex_lock(&lock, K_FOREVER);
 
-	/* Copy individual events to the big array */
 	STRUCT_SECTION_FOREACH(net_socket_service_desc, svc) {
 		for (int j = 0; j < svc->pev_len; j++) {
-			ctx.events[get_idx(svc) + j] = svc->pev[j].event;
+			restore_event(svc, &svc->pev[j]);
 		}
 	}
 
+	init_done = true;
+	k_condvar_broadcast(&wait_start);
+
 	k_mutex_unlock(&lock);
 
 	while (true) {
-		ret = zsock_poll(ctx.events, count + 1, -1);
+		ret = wait_events(count);
 		if (ret < 0) {
-			ret = -errno;
 			NET_ERR("poll failed (%d)", ret);
 			goto out;
 		}
-
-		if (ret == 0) {
-			/* should not happen because timeout is -1 */
-			break;
-		}
-
-		if (ret > 0 && ctx.events[0].revents) {
-			zvfs_eventfd_read(ctx.events[0].fd, &value);
-			NET_DBG("Received restart event.");
-			goto restart;
-		}
-
-		for (i = 1; i < (count + 1); i++) {
-			if (ctx.events[i].fd < 0) {
-				continue;
-			}
-
-			if (ctx.events[i].revents > 0) {
-				ret = trigger_work(&ctx.events[i]);
-				if (ret < 0) {
-					NET_DBG("Triggering work failed (%d)", ret);
-				}
-			}
-		}
 	}
 
 out:
@@ -299,6 +420,19 @@ static int init_socket_service(void)
 				    K_LOWEST_APPLICATION_THREAD_PRIO), 0, K_NO_WAIT);
 
 	k_thread_name_set(ssm, "net_socket_service");
+	ctx.thread = ssm;
+
+#if CONFIG_NET_SOCKETS_SERVICE_WORKQS > 0
+	for (int i = 0; i < ARRAY_SIZE(workqs); i++) {
+		struct k_work_queue_config cfg = {
+			.name = "net_socket_service_wq",
+		};
+
+		k_work_queue_start(&workqs[i], workq_stacks[i],
+				   K_THREAD_STACK_SIZEOF(workq_stacks[i]),
+				   CONFIG_SYSTEM_WORKQUEUE_PRIORITY, &cfg);
+	}
+#endif
 
 	return 0;
 }
@@ -47,6 +47,7 @@ LOG_MODULE_REGISTER(net_sock_tls, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <mbedtls/error.h>
 #include <mbedtls/platform.h>
 #include <mbedtls/ssl_cache.h>
+#include <mbedtls/ssl_ticket.h>
 #endif /* CONFIG_MBEDTLS */
 
 #include "sockets_internal.h"
@@ -254,6 +255,11 @@ static struct tls_session_cache client_cache[CONFIG_NET_SOCKETS_TLS_MAX_CLIENT_S
 static mbedtls_ssl_cache_context server_cache;
 #endif
 
+#if defined(MBEDTLS_SSL_TICKET_C)
+static mbedtls_ssl_ticket_context server_ticket;
+static bool server_ticket_ready;
+#endif
+
 /* A mutex for protecting TLS context allocation. */
 static struct k_mutex context_lock;
 
@@ -291,6 +297,33 @@ static int tls_ctr_drbg_random(void *ctx, unsigned char *buf, size_t len)
 #endif
 }
 
+#if defined(MBEDTLS_SSL_TICKET_C)
+/* Ticket keys are generated on first use, as the entropy source might not
+ * be ready when the TLS sockets are initialized.
+ */
+static int tls_session_ticket_setup(void)
+{
+	int ret = 0;
+
+	k_mutex_lock(&context_lock, K_FOREVER);
+
+	if (!server_ticket_ready) {
+		ret = mbedtls_ssl_ticket_setup(&server_ticket, tls_ctr_drbg_random,
+					       NULL, MBEDTLS_CIPHER_AES_128_GCM,
+					       CONFIG_NET_SOCKETS_TLS_SESSION_TICKET_LIFETIME);
+		if (ret == 0) {
+			server_ticket_ready = true;
+		} else {
+			NET_ERR("Failed to setup session tickets, err: -0x%x", -ret);
+		}
+	}
+
+	k_mutex_unlock(&context_lock);
+
+	return ret;
+}
+#endif /* MBEDTLS_SSL_TICKET_C */
+
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 /* mbedTLS-defined function for setting timer. */
 static void dtls_timing_set_delay(void *data, uint32_t int_ms, uint32_t fin_ms)
@@ -373,6 +406,10 @@ static int tls_init(void)
 	mbedtls_ssl_cache_init(&server_cache);
 #endif
 
+#if defined(MBEDTLS_SSL_TICKET_C)
+	mbedtls_ssl_ticket_init(&server_ticket);
+#endif
+
 	return 0;
 }
 
@@ -730,6 +767,15 @@ static void tls_session_purge(void)
 	mbedtls_ssl_cache_free(&server_cache);
 	mbedtls_ssl_cache_init(&server_cache);
 #endif
+
+#if defined(MBEDTLS_SSL_TICKET_C)
+	/* New keys invalidate the tickets issued so far */
+	k_mutex_lock(&context_lock, K_FOREVER);
+	mbedtls_ssl_ticket_free(&server_ticket);
+	mbedtls_ssl_ticket_init(&server_ticket);
+	server_ticket_ready = false;
+	k_mutex_unlock(&context_lock);
+#endif
 }
 
 static inline int time_left(uint32_t start, uint32_t timeout)
@@ -1421,6 +1467,16 @@ static int tls_mbedtls_init(struct tls_context *context, bool is_server)
 	}
 #endif
 
+#if defined(MBEDTLS_SSL_TICKET_C)
+	if (is_server && context->options.cache_enabled &&
+	    tls_session_ticket_setup() == 0) {
+		mbedtls_ssl_conf_session_tickets_cb(&context->config,
+						    mbedtls_ssl_ticket_write,
+						    mbedtls_ssl_ticket_parse,
+						    &server_ticket);
+	}
+#endif
+
 	ret = mbedtls_ssl_setup(&context->ssl,
 				&context->config);
 	if (ret != 0) {
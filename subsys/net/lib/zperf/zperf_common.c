@@ -220,6 +220,66 @@ uint32_t zperf_packet_duration(uint32_t packet_size, uint32_t rate_in_kbps)
 			  (rate_in_kbps * 1024U));
 }
 
+uint64_t zperf_thread_cycles(void)
+{
+#if defined(CONFIG_THREAD_RUNTIME_STATS)
+	k_thread_runtime_stats_t stats;
+
+	if (k_thread_runtime_stats_get(k_current_get(), &stats) == 0) {
+		return stats.execution_cycles;
+	}
+#endif
+
+	return 0;
+}
+
+void zperf_send_stats_merge(struct zperf_results *dst,
+			    const struct zperf_results *src)
+{
+	dst->cpu_cycles += src->cpu_cycles;
+
+#if defined(CONFIG_NET_ZPERF_SEND_LATENCY)
+	for (int i = 0; i < ZPERF_SEND_LATENCY_BUCKETS; i++) {
+		dst->send_latency[i] += src->send_latency[i];
+	}
+#endif
+}
+
+uint32_t zperf_send_latency_percentile(const struct zperf_results *result,
+				       unsigned int percent)
+{
+#if defined(CONFIG_NET_ZPERF_SEND_LATENCY)
+	uint64_t total = 0U;
+	uint64_t count = 0U;
+	uint64_t rank;
+
+	for (int i = 0; i < ZPERF_SEND_LATENCY_BUCKETS; i++) {
+		total += result->send_latency[i];
+	}
+
+	if (total == 0U) {
+		return 0U;
+	}
+
+	/* Number of calls at or below the percentile, at least one */
+	rank = MAX(DIV_ROUND_UP(total * MIN(percent, 100U), 100U), 1U);
+
+	for (int i = 0; i < ZPERF_SEND_LATENCY_BUCKETS - 1; i++) {
+		count += result->send_latency[i];
+		if (count >= rank) {
+			return BIT(i);
+		}
+	}
+
+	return UINT32_MAX;
+#else
+	ARG_UNUSED(result);
+	ARG_UNUSED(percent);
+
+	return 0U;
+#endif
+}
+
 void zperf_async_work_submit(struct k_work *work)
 {
 	k_work_submit_to_queue(&zperf_work_q, work);
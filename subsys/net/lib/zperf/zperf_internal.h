@@ -7,6 +7,8 @@
 #define __ZPERF_INTERNAL_H
 
 #include <limits.h>
+#include <string.h>
+#include <zephyr/kernel.h>
 #include <zephyr/net/net_ip.h>
 #include <zephyr/net/zperf.h>
 #include <zephyr/shell/shell.h>
@@ -108,6 +110,45 @@ int zperf_prepare_upload_sock(const struct sockaddr *peer_addr, uint8_t tos,
 
 uint32_t zperf_packet_duration(uint32_t packet_size, uint32_t rate_in_kbps);
 
+/* Cycles used so far by the current thread, 0 if not accounted */
+uint64_t zperf_thread_cycles(void);
+
+/* Add the CPU and send latency accounting of an upload to another one */
+void zperf_send_stats_merge(struct zperf_results *dst,
+			    const struct zperf_results *src);
+
+static inline void zperf_send_latency_reset(struct zperf_results *results)
+{
+#if defined(CONFIG_NET_ZPERF_SEND_LATENCY)
+	(void)memset(results->send_latency, 0, sizeof(results->send_latency));
+#else
+	ARG_UNUSED(results);
+#endif
+}
+
+static inline uint32_t zperf_send_latency_start(void)
+{
+	return IS_ENABLED(CONFIG_NET_ZPERF_SEND_LATENCY) ? k_cycle_get_32() : 0U;
+}
+
+static inline void zperf_send_latency_add(struct zperf_results *results,
+					  uint32_t start)
+{
+#if defined(CONFIG_NET_ZPERF_SEND_LATENCY)
+	uint32_t us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+	unsigned int bucket = 0U;
+
+	if (us != 0U) {
+		bucket = MIN(LOG2(us) + 1, ZPERF_SEND_LATENCY_BUCKETS - 1);
+	}
+
+	results->send_latency[bucket]++;
+#else
+	ARG_UNUSED(results);
+	ARG_UNUSED(start);
+#endif
+}
+
 void zperf_async_work_submit(struct k_work *work);
 void zperf_udp_uploader_init(void);
 void zperf_tcp_uploader_init(void);
@@ -475,6 +475,26 @@ static int cmd_udp_download(const struct shell *sh, size_t argc,
 	}
 }
 
+static void shell_upload_print_send_stats(const struct shell *sh,
+					  struct zperf_results *results)
+{
+	uint64_t len = (uint64_t)results->nb_packets_sent * results->packet_size;
+
+	if (results->cpu_cycles != 0U && len != 0U) {
+		shell_fprintf(sh, SHELL_NORMAL, "CPU cycles:\t\t%llu (%llu per kB)\n",
+			      (unsigned long long)results->cpu_cycles,
+			      (unsigned long long)(results->cpu_cycles * 1024U / len));
+	}
+
+	if (IS_ENABLED(CONFIG_NET_ZPERF_SEND_LATENCY)) {
+		shell_fprintf(sh, SHELL_NORMAL,
+			      "Send latency:\t\tp50 <= %u us, p90 <= %u us, p99 <= %u us\n",
+			      zperf_send_latency_percentile(results, 50),
+			      zperf_send_latency_percentile(results, 90),
+			      zperf_send_latency_percentile(results, 99));
+	}
+}
+
 static void shell_udp_upload_print_stats(const struct shell *sh,
 					 struct zperf_results *results)
 {
@@ -536,6 +556,8 @@ static void shell_udp_upload_print_stats(const struct shell *sh,
 		shell_fprintf(sh, SHELL_NORMAL, "\t(");
 		print_number(sh, client_rate_in_kbps, KBPS, KBPS_UNIT);
 		shell_fprintf(sh, SHELL_NORMAL, ")\n");
+
+		shell_upload_print_send_stats(sh, results);
 	}
 }
 
@@ -569,6 +591,8 @@ static void shell_tcp_upload_print_stats(const struct shell *sh,
 		shell_fprintf(sh, SHELL_NORMAL, "Rate:\t\t");
 		print_number(sh, client_rate_in_kbps, KBPS, KBPS_UNIT);
 		shell_fprintf(sh, SHELL_NORMAL, "\n");
+
+		shell_upload_print_send_stats(sh, results);
 	}
 }
 
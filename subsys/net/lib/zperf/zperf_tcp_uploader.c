@@ -43,6 +43,7 @@ static int tcp_upload(int sock,
 {
 	k_timepoint_t end = sys_timepoint_calc(K_MSEC(duration_in_ms));
 	int64_t start_time, end_time;
+	uint64_t start_cycles;
 	uint32_t nb_packets = 0U, nb_errors = 0U;
 	uint32_t alloc_errors = 0U;
 	int ret = 0;
@@ -64,9 +65,15 @@ static int tcp_upload(int sock,
 	 */
 	(void)memset(sample_packet, 0, sizeof(uint32_t));
 
+	zperf_send_latency_reset(results);
+	start_cycles = zperf_thread_cycles();
+
 	do {
+		uint32_t send_start = zperf_send_latency_start();
+
 		/* Send the packet */
 		ret = sendall(sock, sample_packet, packet_size);
+		zperf_send_latency_add(results, send_start);
 		if (ret < 0) {
 			if (nb_errors == 0 && ret != -ENOMEM) {
 				NET_ERR("Failed to send the packet (%d)", errno);
@@ -98,6 +105,7 @@ static int tcp_upload(int sock,
 	} while (!sys_timepoint_expired(end));
 
 	end_time = k_uptime_ticks();
+	results->cpu_cycles = zperf_thread_cycles() - start_cycles;
 
 	/* Add result coming from the client */
 	results->nb_packets_sent = nb_packets;
@@ -200,6 +208,7 @@ static void tcp_upload_async_work(struct k_work *work)
 			result.nb_packets_sent += periodic_result.nb_packets_sent;
 			result.client_time_in_us += periodic_result.client_time_in_us;
 			result.nb_packets_errors += periodic_result.nb_packets_errors;
+			zperf_send_stats_merge(&result, &periodic_result);
 		}
 
 		result.packet_size = periodic_result.packet_size;
@@ -91,7 +91,9 @@ static inline int zperf_upload_fin(int sock,
 		hdr->num_of_bytes = htonl(packet_size);
 
 		/* Send the packet */
+		send_start = zperf_send_latency_start();
 		ret = zsock_send(sock, sample_packet, packet_size, 0);
+		zperf_send_latency_add(results, send_start);
 		if (ret < 0) {
 			NET_ERR("Failed to send the packet (%d)", errno);
 			continue;
@@ -151,6 +153,7 @@ static int udp_upload(int sock, int port,
 	uint32_t nb_packets = 0U;
 	int64_t start_time, end_time;
 	int64_t print_time, last_loop_time;
+	uint64_t start_cycles;
 	uint32_t print_period;
 	bool is_mcast_pkt = false;
 	int ret;
@@ -176,6 +179,9 @@ static int udp_upload(int sock, int port,
 
 	(void)memset(sample_packet, 'z', sizeof(sample_packet));
 
+	zperf_send_latency_reset(results);
+	start_cycles = zperf_thread_cycles();
+
 	do {
 		struct zperf_udp_datagram *datagram;
 		struct zperf_client_hdr_v1 *hdr;
@@ -183,6 +189,7 @@ static int udp_upload(int sock, int port,
 		uint32_t secs, usecs;
 		int64_t loop_time;
 		int32_t adjust;
+		uint32_t send_start;
 
 		/* Timestamp */
 		loop_time = k_uptime_ticks();
@@ -255,6 +262,7 @@ static int udp_upload(int sock, int port,
 	} while (last_loop_time < end_time);
 
 	end_time = k_uptime_ticks();
+	results->cpu_cycles = zperf_thread_cycles() - start_cycles;
 
 	if (param->peer_addr.sa_family == AF_INET) {
 		if (net_ipv4_is_addr_mcast(&net_sin(&param->peer_addr)->sin_addr)) {
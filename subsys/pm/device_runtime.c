@@ -24,6 +24,27 @@ LOG_MODULE_DECLARE(pm_device, CONFIG_PM_DEVICE_LOG_LEVEL);
 
 #define EVENT_MASK		(EVENT_STATE_ACTIVE | EVENT_STATE_SUSPENDED)
 
+static void runtime_suspend_queue(struct pm_device *pm, k_timeout_t delay);
+
+static int runtime_resume(const struct device *dev, struct pm_device_base *pm)
+{
+#ifdef CONFIG_PM_DEVICE_RUNTIME_RESUME_LATENCY
+	uint32_t start = k_cycle_get_32();
+#endif
+	int ret;
+
+	ret = pm->action_cb(dev, PM_DEVICE_ACTION_RESUME);
+
+#ifdef CONFIG_PM_DEVICE_RUNTIME_RESUME_LATENCY
+	if (ret == 0) {
+		pm->resume_cyc_last = k_cycle_get_32() - start;
+		pm->resume_cyc_max = MAX(pm->resume_cyc_max, pm->resume_cyc_last);
+	}
+#endif
+
+	return ret;
+}
+
 /**
  * @brief Suspend a device
  *
@@ -79,7 +100,7 @@ static int runtime_suspend(const struct device *dev, bool async,
 	if (async) {
 		/* queue suspend */
 		pm->base.state = PM_DEVICE_STATE_SUSPENDING;
-		(void)k_work_schedule(&pm->work, delay);
+		runtime_suspend_queue(pm, delay);
 	} else {
 		/* suspend now */
 		ret = pm->base.action_cb(pm->dev, PM_DEVICE_ACTION_SUSPEND);
@@ -99,11 +120,9 @@ unlock:
 	return ret;
 }
 
-static void runtime_suspend_work(struct k_work *work)
+static void runtime_suspend_exec(struct pm_device *pm)
 {
 	int ret;
-	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
-	struct pm_device *pm = CONTAINER_OF(dwork, struct pm_device, work);
 
 	ret = pm->base.action_cb(pm->dev, PM_DEVICE_ACTION_SUSPEND);
 
@@ -129,6 +148,109 @@ static void runtime_suspend_work(struct k_work *work)
 	__ASSERT(ret == 0, "Could not suspend device (%d)", ret);
 }
 
+#ifdef CONFIG_PM_DEVICE_RUNTIME_ASYNC_BATCH
+/*
+ * All the pending asynchronous suspends, handled by a single work item which
+ * is scheduled for the earliest one.
+ */
+static sys_slist_t batch_list = SYS_SLIST_STATIC_INIT(&batch_list);
+static struct k_spinlock batch_lock;
+
+static void runtime_suspend_batch_work(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(batch_work, runtime_suspend_batch_work);
+
+static void batch_schedule_locked(void)
+{
+	struct pm_device *pm;
+	k_timepoint_t due = sys_timepoint_calc(K_FOREVER);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&batch_list, pm, batch_node) {
+		if (sys_timepoint_cmp(pm->batch_due, due) < 0) {
+			due = pm->batch_due;
+		}
+	}
+
+	if (!K_TIMEOUT_EQ(sys_timepoint_timeout(due), K_FOREVER)) {
+		(void)k_work_reschedule(&batch_work, sys_timepoint_timeout(due));
+	}
+}
+
+static void runtime_suspend_batch_work(struct k_work *work)
+{
+	sys_slist_t due_list;
+	sys_snode_t *node;
+	sys_snode_t *prev = NULL;
+	struct pm_device *pm, *tmp;
+	k_timepoint_t limit;
+	k_spinlock_key_t key;
+
+	ARG_UNUSED(work);
+
+	sys_slist_init(&due_list);
+	limit = sys_timepoint_calc(K_MSEC(CONFIG_PM_DEVICE_RUNTIME_ASYNC_BATCH_SLACK_MS));
+
+	key = k_spin_lock(&batch_lock);
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&batch_list, pm, tmp, batch_node) {
+		if (sys_timepoint_cmp(pm->batch_due, limit) <= 0) {
+			sys_slist_remove(&batch_list, prev, &pm->batch_node);
+			sys_slist_append(&due_list, &pm->batch_node);
+		} else {
+			prev = &pm->batch_node;
+		}
+	}
+	batch_schedule_locked();
+	k_spin_unlock(&batch_lock, key);
+
+	/*
+	 * The devices stay SUSPENDING until done, a concurrent get waits for
+	 * the completion as they are no longer in the pending list.
+	 */
+	while ((node = sys_slist_get(&due_list)) != NULL) {
+		runtime_suspend_exec(CONTAINER_OF(node, struct pm_device, batch_node));
+	}
+}
+
+static void runtime_suspend_queue(struct pm_device *pm, k_timeout_t delay)
+{
+	k_spinlock_key_t key = k_spin_lock(&batch_lock);
+
+	pm->batch_due = sys_timepoint_calc(delay);
+	sys_slist_append(&batch_list, &pm->batch_node);
+	batch_schedule_locked();
+
+	k_spin_unlock(&batch_lock, key);
+}
+
+/* Returns true if the pending suspend was canceled before it started */
+static bool runtime_suspend_cancel(struct pm_device *pm)
+{
+	k_spinlock_key_t key = k_spin_lock(&batch_lock);
+	bool canceled = sys_slist_find_and_remove(&batch_list, &pm->batch_node);
+
+	k_spin_unlock(&batch_lock, key);
+
+	return canceled;
+}
+#else
+static void runtime_suspend_work(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+
+	runtime_suspend_exec(CONTAINER_OF(dwork, struct pm_device, work));
+}
+
+static void runtime_suspend_queue(struct pm_device *pm, k_timeout_t delay)
+{
+	(void)k_work_schedule(&pm->work, delay);
+}
+
+/* Returns true if the pending suspend was canceled before it started */
+static bool runtime_suspend_cancel(struct pm_device *pm)
+{
+	return (k_work_cancel_delayable(&pm->work) & K_WORK_RUNNING) == 0;
+}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC_BATCH */
+
 static int get_sync_locked(const struct device *dev)
 {
 	int ret;
@@ -149,7 +271,7 @@ static int get_sync_locked(const struct device *dev)
 			}
 		}
 
-		ret = pm->base.action_cb(dev, PM_DEVICE_ACTION_RESUME);
+		ret = runtime_resume(dev, &pm->base);
 		if (ret < 0) {
 			return ret;
 		}
@@ -231,7 +353,7 @@ int pm_device_runtime_get(const struct device *dev)
 	 * the device is actually active.
 	 */
 	if ((pm->base.state == PM_DEVICE_STATE_SUSPENDING) &&
-		((k_work_cancel_delayable(&pm->work) & K_WORK_RUNNING) == 0)) {
+		runtime_suspend_cancel(pm)) {
 		pm->base.state = PM_DEVICE_STATE_ACTIVE;
 		goto unlock;
 	}
@@ -255,7 +377,7 @@ int pm_device_runtime_get(const struct device *dev)
 		goto unlock;
 	}
 
-	ret = pm->base.action_cb(pm->dev, PM_DEVICE_ACTION_RESUME);
+	ret = runtime_resume(pm->dev, &pm->base);
 	if (ret < 0) {
 		pm->base.usage--;
 		goto unlock;
@@ -439,7 +561,9 @@ int pm_device_runtime_enable(const struct device *dev)
 	/* lazy init of PM fields */
 	if (pm->dev == NULL) {
 		pm->dev = dev;
+#ifndef CONFIG_PM_DEVICE_RUNTIME_ASYNC_BATCH
 		k_work_init_delayable(&pm->work, runtime_suspend_work);
+#endif
 	}
 
 	if (pm->base.state == PM_DEVICE_STATE_ACTIVE) {
@@ -514,7 +638,7 @@ int pm_device_runtime_disable(const struct device *dev)
 
 	if (!k_is_pre_kernel()) {
 		if ((pm->base.state == PM_DEVICE_STATE_SUSPENDING) &&
-			((k_work_cancel_delayable(&pm->work) & K_WORK_RUNNING) == 0)) {
+			runtime_suspend_cancel(pm)) {
 			pm->base.state = PM_DEVICE_STATE_ACTIVE;
 			goto clear_bit;
 		}
@@ -585,3 +709,20 @@ int pm_device_runtime_usage(const struct device *dev)
 
 	return usage;
 }
+
+#ifdef CONFIG_PM_DEVICE_RUNTIME_RESUME_LATENCY
+int pm_device_runtime_resume_latency_get(const struct device *dev, uint32_t *last,
+					 uint32_t *max)
+{
+	struct pm_device_base *pm = dev->pm_base;
+
+	if (!pm_device_runtime_is_enabled(dev)) {
+		return -ENOTSUP;
+	}
+
+	*last = pm->resume_cyc_last;
+	*max = pm->resume_cyc_max;
+
+	return 0;
+}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_RESUME_LATENCY */
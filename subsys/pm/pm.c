@@ -18,6 +18,7 @@
 #include <zephyr/tracing/tracing.h>
 
 #include "pm_stats.h"
+#include "policy_predictive.h"
 #include "device_system_managed.h"
 
 #include <zephyr/logging/log.h>
@@ -189,8 +190,14 @@ bool pm_system_suspend(int32_t ticks)
 	/* Enter power state */
 	pm_state_notify(true);
 	atomic_set_bit(z_post_ops_required, id);
+#ifdef CONFIG_PM_POLICY_PREDICTIVE
+	uint32_t idle_start = k_cycle_get_32();
+#endif
 	pm_state_set(z_cpus_pm_state[id].state, z_cpus_pm_state[id].substate_id);
 	pm_stats_stop();
+#ifdef CONFIG_PM_POLICY_PREDICTIVE
+	pm_policy_idle_exit(id, &z_cpus_pm_state[id], k_cycle_get_32() - idle_start);
+#endif
 
 	/* Wake up sequence starts here */
 	pm_stats_update(z_cpus_pm_state[id].state);
@@ -28,6 +28,30 @@ static STATS_SECT_DECL(pm_stats) stats[CONFIG_MP_MAX_NUM_CPUS][PM_STATE_COUNT];
 
 #define PM_STAT_NAME_LEN sizeof("pm_cpu_XXX_state_X_stats")
 static char names[CONFIG_MP_MAX_NUM_CPUS][PM_STATE_COUNT][PM_STAT_NAME_LEN];
+
+#ifdef CONFIG_PM_POLICY_PREDICTIVE
+STATS_SECT_START(pm_policy_stats)
+STATS_SECT_ENTRY32(decisions)
+STATS_SECT_ENTRY32(shallower)
+STATS_SECT_ENTRY32(timer_wakeups)
+STATS_SECT_ENTRY32(early_wakeups)
+STATS_SECT_ENTRY32(too_deep)
+STATS_SECT_END;
+
+STATS_NAME_START(pm_policy_stats)
+STATS_NAME(pm_policy_stats, decisions)
+STATS_NAME(pm_policy_stats, shallower)
+STATS_NAME(pm_policy_stats, timer_wakeups)
+STATS_NAME(pm_policy_stats, early_wakeups)
+STATS_NAME(pm_policy_stats, too_deep)
+STATS_NAME_END(pm_policy_stats);
+
+static STATS_SECT_DECL(pm_policy_stats) policy_stats[CONFIG_MP_MAX_NUM_CPUS];
+
+#define PM_POLICY_STAT_NAME_LEN sizeof("pm_cpu_XXX_policy_stats")
+static char policy_names[CONFIG_MP_MAX_NUM_CPUS][PM_POLICY_STAT_NAME_LEN];
+#endif /* CONFIG_PM_POLICY_PREDICTIVE */
+
 static uint32_t time_start[CONFIG_MP_MAX_NUM_CPUS];
 static uint32_t time_stop[CONFIG_MP_MAX_NUM_CPUS];
 
@@ -44,6 +68,13 @@ static int pm_stats_init(void)
 				   STATS_NAME_INIT_PARMS(pm_stats));
 			stats_register(names[i][j], &(stats[i][j].s_hdr));
 		}
+
+#ifdef CONFIG_PM_POLICY_PREDICTIVE
+		snprintk(policy_names[i], PM_POLICY_STAT_NAME_LEN, "pm_cpu_%03d_policy_stats", i);
+		stats_init(&(policy_stats[i].s_hdr), STATS_SIZE_32, 5U,
+			   STATS_NAME_INIT_PARMS(pm_policy_stats));
+		stats_register(policy_names[i], &(policy_stats[i].s_hdr));
+#endif /* CONFIG_PM_POLICY_PREDICTIVE */
 	}
 
 	return 0;
@@ -70,3 +101,26 @@ void pm_stats_update(enum pm_state state)
 	STATS_INCN(stats[cpu][state], state_total_cycles, time_total);
 	STATS_SET(stats[cpu][state], state_last_cycles, time_total);
 }
+
+#ifdef CONFIG_PM_POLICY_PREDICTIVE
+void pm_stats_policy_decision(uint8_t cpu, bool shallower)
+{
+	STATS_INC(policy_stats[cpu], decisions);
+	if (shallower) {
+		STATS_INC(policy_stats[cpu], shallower);
+	}
+}
+
+void pm_stats_policy_wakeup(uint8_t cpu, bool timer, bool too_deep)
+{
+	if (timer) {
+		STATS_INC(policy_stats[cpu], timer_wakeups);
+	} else {
+		STATS_INC(policy_stats[cpu], early_wakeups);
+	}
+
+	if (too_deep) {
+		STATS_INC(policy_stats[cpu], too_deep);
+	}
+}
+#endif /* CONFIG_PM_POLICY_PREDICTIVE */
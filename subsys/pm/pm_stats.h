@@ -8,6 +8,8 @@
 #ifndef ZEPHYR_SUBSYS_PM_PM_STATS_H_
 #define ZEPHYR_SUBSYS_PM_PM_STATS_H_
 
+#include <stdbool.h>
+#include <stdint.h>
 #include <zephyr/pm/state.h>
 
 #ifdef CONFIG_PM_STATS
@@ -20,4 +22,12 @@ static inline void pm_stats_stop(void) {}
 static inline void pm_stats_update(enum pm_state state) {}
 #endif /* CONFIG_PM_STATS */
 
+#if defined(CONFIG_PM_STATS) && defined(CONFIG_PM_POLICY_PREDICTIVE)
+void pm_stats_policy_decision(uint8_t cpu, bool shallower);
+void pm_stats_policy_wakeup(uint8_t cpu, bool timer, bool too_deep);
+#else
+static inline void pm_stats_policy_decision(uint8_t cpu, bool shallower) {}
+static inline void pm_stats_policy_wakeup(uint8_t cpu, bool timer, bool too_deep) {}
+#endif /* CONFIG_PM_STATS && CONFIG_PM_POLICY_PREDICTIVE */
+
 #endif /* ZEPHYR_SUBSYS_PM_PM_STATS_H_ */
@@ -16,6 +16,9 @@
 #include <zephyr/toolchain.h>
 #include <zephyr/pm/device.h>
 
+#include "pm_stats.h"
+#include "policy_predictive.h"
+
 #if DT_HAS_COMPAT_STATUS_OKAY(zephyr_power_state)
 
 #define DT_SUB_LOCK_INIT(node_id)				\
@@ -130,25 +133,16 @@ static void update_next_event(uint32_t cyc)
 	next_event_cyc = new_next_event_cyc;
 }
 
-#ifdef CONFIG_PM_POLICY_DEFAULT
-const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
+#if defined(CONFIG_PM_POLICY_DEFAULT) || defined(CONFIG_PM_POLICY_PREDICTIVE)
+/** @brief Cycles until the next timeout or event, -1 if there is none. */
+static int64_t sleep_cyc_get(int32_t ticks)
 {
 	int64_t cyc = -1;
-	uint8_t num_cpu_states;
-	const struct pm_state_info *cpu_states;
-
-#ifdef CONFIG_PM_NEED_ALL_DEVICES_IDLE
-	if (pm_device_is_any_busy()) {
-		return NULL;
-	}
-#endif
 
 	if (ticks != K_TICKS_FOREVER) {
 		cyc = k_ticks_to_cyc_ceil32(ticks);
 	}
 
-	num_cpu_states = pm_state_cpu_get_all(cpu, &cpu_states);
-
 	if (next_event_cyc >= 0) {
 		uint32_t cyc_curr = k_cycle_get_32();
 		int64_t cyc_evt = next_event_cyc - cyc_curr;
@@ -170,34 +164,215 @@ const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
 		}
 	}
 
+	return cyc;
+}
+
+/** @brief Check the locks and the latency constraint of a state. */
+static bool state_is_allowed(const struct pm_state_info *state)
+{
+	/* check if there is a lock on state + substate */
+	if (pm_policy_state_lock_is_active(state->state, state->substate_id)) {
+		return false;
+	}
+
+	/* skip state if it brings too much latency */
+	if ((max_latency_cyc >= 0) &&
+	    (k_us_to_cyc_ceil32(state->exit_latency_us) >= max_latency_cyc)) {
+		return false;
+	}
+
+	return true;
+}
+
+/** @brief Minimum idle time for a state to pay off, in cycles. */
+static uint32_t state_target_cyc(const struct pm_state_info *state)
+{
+	return k_us_to_cyc_ceil32(state->min_residency_us) +
+	       k_us_to_cyc_ceil32(state->exit_latency_us);
+}
+
+/** @brief Deepest allowed state paying off in cyc, -1 if there is none. */
+static int state_for_sleep_cyc(const struct pm_state_info *cpu_states, uint8_t num_cpu_states,
+			       int64_t cyc)
+{
 	for (int16_t i = (int16_t)num_cpu_states - 1; i >= 0; i--) {
 		const struct pm_state_info *state = &cpu_states[i];
-		uint32_t min_residency_cyc, exit_latency_cyc;
 
-		/* check if there is a lock on state + substate */
-		if (pm_policy_state_lock_is_active(state->state, state->substate_id)) {
+		if (!state_is_allowed(state)) {
 			continue;
 		}
 
-		min_residency_cyc = k_us_to_cyc_ceil32(state->min_residency_us);
-		exit_latency_cyc = k_us_to_cyc_ceil32(state->exit_latency_us);
-
-		/* skip state if it brings too much latency */
-		if ((max_latency_cyc >= 0) &&
-		    (exit_latency_cyc >= max_latency_cyc)) {
-			continue;
+		if ((cyc < 0) || (cyc >= state_target_cyc(state))) {
+			return i;
 		}
+	}
+
+	return -1;
+}
+#endif /* CONFIG_PM_POLICY_DEFAULT || CONFIG_PM_POLICY_PREDICTIVE */
+
+#ifdef CONFIG_PM_POLICY_DEFAULT
+const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
+{
+	uint8_t num_cpu_states;
+	const struct pm_state_info *cpu_states;
+	int i;
+
+#ifdef CONFIG_PM_NEED_ALL_DEVICES_IDLE
+	if (pm_device_is_any_busy()) {
+		return NULL;
+	}
+#endif
+
+	num_cpu_states = pm_state_cpu_get_all(cpu, &cpu_states);
+	i = state_for_sleep_cyc(cpu_states, num_cpu_states, sleep_cyc_get(ticks));
+
+	return (i >= 0) ? &cpu_states[i] : NULL;
+}
+#endif
+
+#ifdef CONFIG_PM_POLICY_PREDICTIVE
+/*
+ * Idle durations are sorted in bins: bin 0 holds those too short for any
+ * state, bin i + 1 those for which state i is the deepest paying off.
+ */
+#define NUM_BINS (DT_FOREACH_CHILD_STATUS_OKAY_SEP(DT_PATH(cpus), DT_NUM_CPU_POWER_STATES, (+)) \
+		  + 1)
+
+/* Metric added to a bin for every wakeup, the metrics decaying geometrically */
+#define PULSE 1024U
+
+/** Recent idle history of a CPU */
+struct idle_history {
+	/** Wakeups by the timeout or event the state was chosen for */
+	uint32_t hits[NUM_BINS];
+	/** Wakeups before the timeout or event, in the bin of the idle duration */
+	uint32_t intercepts[NUM_BINS];
+	/** States of the CPU */
+	const struct pm_state_info *cpu_states;
+	/** Number of states of the CPU accounted in the bins */
+	uint8_t num_cpu_states;
+	/** Index of the chosen state, -1 if idle was not entered */
+	int8_t state_idx;
+	/** Cycles to the next timeout or event when the state was chosen */
+	int64_t sleep_cyc;
+};
+
+static struct idle_history idle_history[CONFIG_MP_MAX_NUM_CPUS];
 
-		if ((cyc < 0) ||
-		    (cyc >= (min_residency_cyc + exit_latency_cyc))) {
-			return state;
+/** @brief Bin of an idle duration, the locks not being taken into account. */
+static uint8_t bin_for_cyc(const struct idle_history *h, int64_t cyc)
+{
+	uint8_t bin = h->num_cpu_states;
+
+	if (cyc >= 0) {
+		while ((bin > 0U) && (cyc < state_target_cyc(&h->cpu_states[bin - 1U]))) {
+			bin--;
 		}
 	}
 
-	return NULL;
+	return bin;
 }
+
+const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
+{
+	struct idle_history *h = &idle_history[cpu];
+	uint32_t early = 0U;
+	uint32_t all = 0U;
+	int64_t cyc;
+	int cand;
+	int sel;
+
+	h->state_idx = -1;
+
+#ifdef CONFIG_PM_NEED_ALL_DEVICES_IDLE
+	if (pm_device_is_any_busy()) {
+		return NULL;
+	}
 #endif
 
+	h->num_cpu_states = MIN(pm_state_cpu_get_all(cpu, &h->cpu_states), NUM_BINS - 1);
+
+	/* Candidate from the next timeout or event, as the default policy */
+	cyc = sleep_cyc_get(ticks);
+	cand = state_for_sleep_cyc(h->cpu_states, h->num_cpu_states, cyc);
+	if (cand < 0) {
+		return NULL;
+	}
+
+	for (int bin = 0; bin <= h->num_cpu_states; bin++) {
+		all += h->hits[bin] + h->intercepts[bin];
+		if (bin <= cand) {
+			early += h->intercepts[bin];
+		}
+	}
+
+	sel = cand;
+	if (2U * early > all) {
+		/* Most of the recent wakeups came too early for the candidate to
+		 * pay off, take the deepest state paying off for most of them.
+		 */
+		uint32_t sum = 0U;
+
+		for (sel = cand - 1; sel >= 0; sel--) {
+			sum += h->intercepts[sel + 1];
+			if ((2U * sum > early) && state_is_allowed(&h->cpu_states[sel])) {
+				break;
+			}
+		}
+	}
+
+	pm_stats_policy_decision(cpu, sel != cand);
+
+	if (sel < 0) {
+		return NULL;
+	}
+
+	h->state_idx = (int8_t)sel;
+	h->sleep_cyc = cyc;
+
+	return &h->cpu_states[sel];
+}
+
+void pm_policy_idle_exit(uint8_t cpu, const struct pm_state_info *info, uint32_t idle_cyc)
+{
+	struct idle_history *h = &idle_history[cpu];
+	const struct pm_state_info *state;
+	uint8_t measured_bin;
+	uint8_t timer_bin;
+	bool timer;
+
+	if (h->state_idx < 0) {
+		/* Forced state */
+		return;
+	}
+
+	state = &h->cpu_states[h->state_idx];
+	h->state_idx = -1;
+	if ((state->state != info->state) || (state->substate_id != info->substate_id)) {
+		return;
+	}
+
+	measured_bin = bin_for_cyc(h, idle_cyc);
+	timer_bin = bin_for_cyc(h, h->sleep_cyc);
+
+	for (int bin = 0; bin <= h->num_cpu_states; bin++) {
+		h->hits[bin] -= h->hits[bin] >> CONFIG_PM_POLICY_PREDICTIVE_DECAY_SHIFT;
+		h->intercepts[bin] -= h->intercepts[bin] >> CONFIG_PM_POLICY_PREDICTIVE_DECAY_SHIFT;
+	}
+
+	/* Waking up in the bin of the timeout counts as reaching it */
+	timer = measured_bin >= timer_bin;
+	if (timer) {
+		h->hits[timer_bin] += PULSE;
+	} else {
+		h->intercepts[measured_bin] += PULSE;
+	}
+
+	pm_stats_policy_wakeup(cpu, timer, idle_cyc < state_target_cyc(state));
+}
+#endif /* CONFIG_PM_POLICY_PREDICTIVE */
+
 void pm_policy_state_lock_get(enum pm_state state, uint8_t substate_id)
 {
 #if DT_HAS_COMPAT_STATUS_OKAY(zephyr_power_state)
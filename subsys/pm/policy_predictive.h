@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SUBSYS_PM_POLICY_PREDICTIVE_H_
+#define ZEPHYR_SUBSYS_PM_POLICY_PREDICTIVE_H_
+
+#include <stdint.h>
+#include <zephyr/pm/state.h>
+
+#ifdef CONFIG_PM_POLICY_PREDICTIVE
+/**
+ * @brief Account the idle duration of a CPU back from a power state.
+ *
+ * @param cpu CPU index.
+ * @param info State the CPU was in.
+ * @param idle_cyc Cycles spent in the state.
+ */
+void pm_policy_idle_exit(uint8_t cpu, const struct pm_state_info *info, uint32_t idle_cyc);
+#else
+static inline void pm_policy_idle_exit(uint8_t cpu, const struct pm_state_info *info,
+				       uint32_t idle_cyc) {}
+#endif /* CONFIG_PM_POLICY_PREDICTIVE */
+
+#endif /* ZEPHYR_SUBSYS_PM_POLICY_PREDICTIVE_H_ */
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/profiling/sampler.h>
+
+#define PROBE_MAX 8
+
+struct sampler_cpu {
+	struct profiling_sample entries[CONFIG_PROFILING_SAMPLER_ENTRIES];
+	uint32_t lost;
+};
+
+static struct sampler_cpu sampler_cpus[CONFIG_MP_MAX_NUM_CPUS];
+static struct k_spinlock lock;
+static bool running;
+
+/* Entries are found by open addressing with a short linear probe, so that
+ * recording a sample from the timer interrupt has a bounded cost.
+ */
+static void record(struct sampler_cpu *cpu, uintptr_t pc, const struct k_thread *thread)
+{
+	uint32_t hash = (uint32_t)(pc ^ (uintptr_t)thread) * 2654435761U;
+	unsigned int idx = hash % CONFIG_PROFILING_SAMPLER_ENTRIES;
+
+	for (int i = 0; i < PROBE_MAX; i++) {
+		struct profiling_sample *entry = &cpu->entries[idx];
+
+		if (entry->count == 0U) {
+			entry->pc = pc;
+			entry->thread = thread;
+			entry->count = 1U;
+			return;
+		}
+
+		if ((entry->pc == pc) && (entry->thread == thread)) {
+			entry->count++;
+			return;
+		}
+
+		idx = (idx + 1U) % CONFIG_PROFILING_SAMPLER_ENTRIES;
+	}
+
+	cpu->lost++;
+}
+
+static void sampler_expiry(struct k_timer *timer);
+static K_TIMER_DEFINE(sampler_timer, sampler_expiry, NULL);
+
+static void sampler_expiry(struct k_timer *timer)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	unsigned int id = arch_curr_cpu()->id;
+
+	ARG_UNUSED(timer);
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		uintptr_t pc = 0;
+
+		/* Only the interrupted context of this CPU can be inspected,
+		 * the other CPUs are sampled at thread level.
+		 */
+#ifdef CONFIG_ARCH_HAS_IRQ_INTERRUPTED_PC
+		if (i == id) {
+			pc = arch_irq_interrupted_pc();
+		}
+#endif
+
+		record(&sampler_cpus[i], pc, _kernel.cpus[i].current);
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+int profiling_sampler_start(uint32_t freq_hz)
+{
+	k_spinlock_key_t key;
+
+	if ((freq_hz == 0U) || (freq_hz > CONFIG_SYS_CLOCK_TICKS_PER_SEC)) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&lock);
+	if (running) {
+		k_spin_unlock(&lock, key);
+		return -EALREADY;
+	}
+
+	running = true;
+	k_spin_unlock(&lock, key);
+
+	k_timer_start(&sampler_timer, K_USEC(USEC_PER_SEC / freq_hz),
+		      K_USEC(USEC_PER_SEC / freq_hz));
+
+	return 0;
+}
+
+void profiling_sampler_stop(void)
+{
+	k_timer_stop(&sampler_timer);
+
+	K_SPINLOCK(&lock) {
+		running = false;
+	}
+}
+
+void profiling_sampler_reset(void)
+{
+	K_SPINLOCK(&lock) {
+		memset(sampler_cpus, 0, sizeof(sampler_cpus));
+	}
+}
+
+uint32_t profiling_sampler_foreach(profiling_sampler_cb_t cb, void *user_data)
+{
+	uint32_t lost = 0;
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		struct sampler_cpu *cpu = &sampler_cpus[i];
+
+		for (int j = 0; j < CONFIG_PROFILING_SAMPLER_ENTRIES; j++) {
+			if (cpu->entries[j].count > 0U) {
+				cb(&cpu->entries[j], i, user_data);
+			}
+		}
+
+		lost += cpu->lost;
+	}
+
+	return lost;
+}
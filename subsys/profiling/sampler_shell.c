@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/debug/symtab.h>
+#include <zephyr/profiling/sampler.h>
+
+struct thread_label {
+	const struct k_thread *thread;
+	const char *name;
+};
+
+#if defined(CONFIG_THREAD_MONITOR) && defined(CONFIG_THREAD_NAME)
+static void thread_name_cb(const struct k_thread *thread, void *user_data)
+{
+	struct thread_label *label = user_data;
+
+	if (thread == label->thread) {
+		label->name = k_thread_name_get((k_tid_t)thread);
+	}
+}
+#endif
+
+static void print_sample(const struct profiling_sample *sample, unsigned int cpu,
+			 void *user_data)
+{
+	const struct shell *sh = user_data;
+	struct thread_label label = {
+		.thread = sample->thread,
+	};
+
+	ARG_UNUSED(cpu);
+
+#if defined(CONFIG_THREAD_MONITOR) && defined(CONFIG_THREAD_NAME)
+	k_thread_foreach_unlocked(thread_name_cb, &label);
+#endif
+
+	if ((label.name != NULL) && (label.name[0] != '\0')) {
+		shell_fprintf(sh, SHELL_NORMAL, "%s;", label.name);
+	} else {
+		shell_fprintf(sh, SHELL_NORMAL, "%p;", (void *)sample->thread);
+	}
+
+#ifdef CONFIG_SYMTAB
+	uint32_t offset;
+	const char *name = symtab_find_symbol_name(sample->pc, &offset);
+
+	if ((sample->pc != 0) && (name[0] != '?')) {
+		shell_fprintf(sh, SHELL_NORMAL, "%s %u\n", name, sample->count);
+		return;
+	}
+#endif
+
+	shell_fprintf(sh, SHELL_NORMAL, "0x%lx %u\n", (unsigned long)sample->pc, sample->count);
+}
+
+static int cmd_start(const struct shell *sh, size_t argc, char **argv)
+{
+	uint32_t freq = CONFIG_PROFILING_SAMPLER_FREQ;
+	int ret;
+
+	if (argc > 1) {
+		freq = strtoul(argv[1], NULL, 10);
+	}
+
+	ret = profiling_sampler_start(freq);
+	if (ret < 0) {
+		shell_error(sh, "Cannot start sampling at %u Hz (err %d)", freq, ret);
+		return ret;
+	}
+
+	return 0;
+}
+
+static int cmd_stop(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(sh);
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	profiling_sampler_stop();
+
+	return 0;
+}
+
+static int cmd_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(sh);
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	profiling_sampler_reset();
+
+	return 0;
+}
+
+static int cmd_show(const struct shell *sh, size_t argc, char **argv)
+{
+	uint32_t lost;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	lost = profiling_sampler_foreach(print_sample, (void *)sh);
+	if (lost > 0U) {
+		shell_warn(sh, "%u samples lost", lost);
+	}
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_sampler,
+	SHELL_CMD_ARG(start, NULL, "Start sampling. [frequency in Hz]", cmd_start, 1, 1),
+	SHELL_CMD(stop, NULL, "Stop sampling.", cmd_stop),
+	SHELL_CMD(reset, NULL, "Clear the collected samples.", cmd_reset),
+	SHELL_CMD(show, NULL, "Print the samples in folded stack format.", cmd_show),
+	SHELL_SUBCMD_SET_END /* Array terminated. */
+);
+
+SHELL_CMD_REGISTER(sampler, &sub_sampler, "Sampling profiler commands", NULL);
@@ -26,32 +26,58 @@
 
 #endif /* CONFIG_MBEDTLS */
 
+#if defined(CONFIG_ENTROPY_POOL)
+#include "random_entropy_pool.h"
+#endif /* CONFIG_ENTROPY_POOL */
+
+#if defined(CONFIG_CTR_DRBG_CSPRNG_PER_CPU)
+#define CTR_DRBG_STATES CONFIG_MP_MAX_NUM_CPUS
+#else
+#define CTR_DRBG_STATES 1
+#endif /* CONFIG_CTR_DRBG_CSPRNG_PER_CPU */
+
 /*
  * entropy_dev is initialized at runtime to allow first time initialization
  * of the ctr_drbg engine.
  */
 static const struct device *entropy_dev;
 static const unsigned char drbg_seed[] = CONFIG_CS_CTR_DRBG_PERSONALIZATION;
-static bool ctr_initialised;
-static struct k_mutex ctr_lock;
 
+/* One generator per CPU with CONFIG_CTR_DRBG_CSPRNG_PER_CPU, so that
+ * concurrent requests on different CPUs do not wait for each other.
+ */
+struct ctr_drbg_state {
+	struct k_mutex lock;
+	bool initialised;
 #if defined(CONFIG_MBEDTLS)
+	mbedtls_ctr_drbg_context ctx;
+#elif defined(CONFIG_TINYCRYPT)
+	TCCtrPrng_t ctx;
+#endif /* CONFIG_MBEDTLS */
+};
 
-static mbedtls_ctr_drbg_context ctr_ctx;
+static struct ctr_drbg_state ctr_states[CTR_DRBG_STATES];
 
-static int ctr_drbg_entropy_func(void *ctx, unsigned char *buf, size_t len)
+static int ctr_drbg_get_entropy(uint8_t *buf, size_t len)
 {
-	return entropy_get_entropy(entropy_dev, (void *)buf, len);
+#if defined(CONFIG_ENTROPY_POOL)
+	return z_entropy_pool_get(buf, len);
+#else
+	return entropy_get_entropy(entropy_dev, buf, len);
+#endif /* CONFIG_ENTROPY_POOL */
 }
 
-#elif defined(CONFIG_TINYCRYPT)
+#if defined(CONFIG_MBEDTLS)
 
-static TCCtrPrng_t ctr_ctx;
+static int ctr_drbg_entropy_func(void *ctx, unsigned char *buf, size_t len)
+{
+	return ctr_drbg_get_entropy((void *)buf, len);
+}
 
 #endif /* CONFIG_MBEDTLS */
 
 
-static int ctr_drbg_initialize(void)
+static int ctr_drbg_initialize(struct ctr_drbg_state *state)
 {
 	int ret;
 
@@ -64,16 +90,16 @@ static int ctr_drbg_initialize(void)
 
 #if defined(CONFIG_MBEDTLS)
 
-	mbedtls_ctr_drbg_init(&ctr_ctx);
+	mbedtls_ctr_drbg_init(&state->ctx);
 
-	ret = mbedtls_ctr_drbg_seed(&ctr_ctx,
+	ret = mbedtls_ctr_drbg_seed(&state->ctx,
 				    ctr_drbg_entropy_func,
 				    NULL,
 				    drbg_seed,
 				    sizeof(drbg_seed));
 
 	if (ret != 0) {
-		mbedtls_ctr_drbg_free(&ctr_ctx);
+		mbedtls_ctr_drbg_free(&state->ctx);
 		return -EIO;
 	}
 
@@ -81,13 +107,12 @@ static int ctr_drbg_initialize(void)
 
 	uint8_t entropy[TC_AES_KEY_SIZE + TC_AES_BLOCK_SIZE];
 
-	ret = entropy_get_entropy(entropy_dev, (void *)&entropy,
-				  sizeof(entropy));
+	ret = ctr_drbg_get_entropy((void *)&entropy, sizeof(entropy));
 	if (ret != 0) {
 		return -EIO;
 	}
 
-	ret = tc_ctr_prng_init(&ctr_ctx,
+	ret = tc_ctr_prng_init(&state->ctx,
 			       (uint8_t *)&entropy,
 			       sizeof(entropy),
 			       (uint8_t *)drbg_seed,
@@ -98,19 +123,31 @@ static int ctr_drbg_initialize(void)
 	}
 
 #endif
-	ctr_initialised = true;
+	state->initialised = true;
 	return 0;
 }
 
+static struct ctr_drbg_state *ctr_drbg_state_get(void)
+{
+#if defined(CONFIG_CTR_DRBG_CSPRNG_PER_CPU)
+	/* The thread may migrate once the CPU is read, the state lock still
+	 * serializes its use.
+	 */
+	return &ctr_states[arch_curr_cpu()->id];
+#else
+	return &ctr_states[0];
+#endif /* CONFIG_CTR_DRBG_CSPRNG_PER_CPU */
+}
 
 int z_impl_sys_csrand_get(void *dst, uint32_t outlen)
 {
+	struct ctr_drbg_state *state = ctr_drbg_state_get();
 	int ret;
 
-	k_mutex_lock(&ctr_lock, K_FOREVER);
+	k_mutex_lock(&state->lock, K_FOREVER);
 
-	if (unlikely(!ctr_initialised)) {
-		ret = ctr_drbg_initialize();
+	if (unlikely(!state->initialised)) {
+		ret = ctr_drbg_initialize(state);
 		if (ret != 0) {
 			ret = -EIO;
 			goto end;
@@ -119,32 +156,31 @@ int z_impl_sys_csrand_get(void *dst, uint32_t outlen)
 
 #if defined(CONFIG_MBEDTLS)
 
-	ret = mbedtls_ctr_drbg_random(&ctr_ctx, (unsigned char *)dst, outlen);
+	ret = mbedtls_ctr_drbg_random(&state->ctx, (unsigned char *)dst, outlen);
 
 #elif defined(CONFIG_TINYCRYPT)
 
 	uint8_t entropy[TC_AES_KEY_SIZE + TC_AES_BLOCK_SIZE];
 
-	ret = tc_ctr_prng_generate(&ctr_ctx, 0, 0, (uint8_t *)dst, outlen);
+	ret = tc_ctr_prng_generate(&state->ctx, 0, 0, (uint8_t *)dst, outlen);
 
 	if (ret == TC_CRYPTO_SUCCESS) {
 		ret = 0;
 	} else if (ret == TC_CTR_PRNG_RESEED_REQ) {
 
-		ret = entropy_get_entropy(entropy_dev,
-				    (void *)&entropy, sizeof(entropy));
+		ret = ctr_drbg_get_entropy((void *)&entropy, sizeof(entropy));
 		if (ret != 0) {
 			ret = -EIO;
 			goto end;
 		}
 
-		ret = tc_ctr_prng_reseed(&ctr_ctx,
+		ret = tc_ctr_prng_reseed(&state->ctx,
 					entropy,
 					sizeof(entropy),
 					drbg_seed,
 					sizeof(drbg_seed));
 
-		ret = tc_ctr_prng_generate(&ctr_ctx, 0, 0,
+		ret = tc_ctr_prng_generate(&state->ctx, 0, 0,
 					   (uint8_t *)dst, outlen);
 
 		ret = (ret == TC_CRYPTO_SUCCESS) ? 0 : -EIO;
@@ -153,7 +189,18 @@ int z_impl_sys_csrand_get(void *dst, uint32_t outlen)
 	}
 #endif
 end:
-	k_mutex_unlock(&ctr_lock);
+	k_mutex_unlock(&state->lock);
 
 	return ret;
 }
+
+static int ctr_drbg_init_locks(void)
+{
+	ARRAY_FOR_EACH(ctr_states, i) {
+		k_mutex_init(&ctr_states[i].lock);
+	}
+
+	return 0;
+}
+
+SYS_INIT(ctr_drbg_init_locks, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
@@ -9,6 +9,10 @@
 #include <zephyr/drivers/entropy.h>
 #include <string.h>
 
+#if defined(CONFIG_ENTROPY_POOL)
+#include "random_entropy_pool.h"
+#endif /* CONFIG_ENTROPY_POOL */
+
 static const struct device *const entropy_dev =
 	DEVICE_DT_GET(DT_CHOSEN(zephyr_entropy));
 
@@ -20,7 +24,11 @@ static int rand_get(uint8_t *dst, size_t outlen, bool csrand)
 	__ASSERT(device_is_ready(entropy_dev), "Entropy device %s not ready",
 		 entropy_dev->name);
 
+#if defined(CONFIG_ENTROPY_POOL)
+	ret = z_entropy_pool_get(dst, outlen);
+#else
 	ret = entropy_get_entropy(entropy_dev, dst, outlen);
+#endif /* CONFIG_ENTROPY_POOL */
 
 	if (unlikely(ret < 0)) {
 		/* Don't try to fill the buffer in case of
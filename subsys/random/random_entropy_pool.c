@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/init.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/entropy.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/ring_buffer.h>
+#include <string.h>
+
+#include "random_entropy_pool.h"
+
+static const struct device *const entropy_dev =
+	DEVICE_DT_GET(DT_CHOSEN(zephyr_entropy));
+
+/* The refill work is the only writer, readers are serialized by pool_lock */
+RING_BUF_DECLARE(pool, CONFIG_ENTROPY_POOL_SIZE);
+static struct k_spinlock pool_lock;
+
+static void pool_refill_handler(struct k_work *work)
+{
+	uint8_t *space;
+	uint32_t len;
+
+	ARG_UNUSED(work);
+
+	while (true) {
+		len = ring_buf_put_claim(&pool, &space, CONFIG_ENTROPY_POOL_BATCH_SIZE);
+		if (len == 0U) {
+			break;
+		}
+
+		if (entropy_get_entropy(entropy_dev, space, len) != 0) {
+			ring_buf_put_finish(&pool, 0);
+			break;
+		}
+
+		ring_buf_put_finish(&pool, len);
+	}
+}
+
+static K_WORK_DEFINE(pool_refill_work, pool_refill_handler);
+
+static void pool_take(uint8_t *dst, size_t len)
+{
+	uint8_t *data;
+	uint32_t claimed;
+
+	while (len > 0) {
+		claimed = ring_buf_get_claim(&pool, &data, len);
+		memcpy(dst, data, claimed);
+		/* Do not leave consumed entropy behind */
+		memset(data, 0, claimed);
+		(void)ring_buf_get_finish(&pool, claimed);
+
+		dst += claimed;
+		len -= claimed;
+	}
+}
+
+int z_entropy_pool_get(uint8_t *dst, size_t len)
+{
+	k_spinlock_key_t key;
+	uint32_t level;
+	bool taken = false;
+
+	key = k_spin_lock(&pool_lock);
+
+	if (ring_buf_size_get(&pool) >= len) {
+		pool_take(dst, len);
+		taken = true;
+	}
+
+	level = ring_buf_size_get(&pool);
+
+	k_spin_unlock(&pool_lock, key);
+
+	if (level < CONFIG_ENTROPY_POOL_SIZE / 2 && !k_is_pre_kernel()) {
+		(void)k_work_submit(&pool_refill_work);
+	}
+
+	if (taken) {
+		return 0;
+	}
+
+	/* The pool ran dry, take the entropy from the device itself */
+	return entropy_get_entropy(entropy_dev, dst, len);
+}
+
+static int entropy_pool_init(void)
+{
+	if (!device_is_ready(entropy_dev)) {
+		return -ENODEV;
+	}
+
+	(void)k_work_submit(&pool_refill_work);
+
+	return 0;
+}
+
+SYS_INIT(entropy_pool_init, POST_KERNEL, CONFIG_APPLICATION_INIT_PRIORITY);
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SUBSYS_RANDOM_RANDOM_ENTROPY_POOL_H_
+#define ZEPHYR_SUBSYS_RANDOM_RANDOM_ENTROPY_POOL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Get entropy from the pool
+ *
+ * Takes the bytes from the pool, refilled in the background from the
+ * entropy device, and only reads the device directly when the pool does
+ * not hold enough of them.
+ *
+ * @param dst Buffer to fill.
+ * @param len Number of bytes to get.
+ *
+ * @return 0 on success, negative errno code of the entropy driver otherwise.
+ */
+int z_entropy_pool_get(uint8_t *dst, size_t len);
+
+#endif /* ZEPHYR_SUBSYS_RANDOM_RANDOM_ENTROPY_POOL_H_ */
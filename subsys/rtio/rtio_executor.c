@@ -22,6 +22,10 @@ static void rtio_executor_op(struct rtio_iodev_sqe *iodev_sqe)
 		sqe->callback(iodev_sqe->r, sqe, sqe->arg0);
 		rtio_iodev_sqe_ok(iodev_sqe, 0);
 		break;
+	case RTIO_OP_SEM_GIVE:
+		k_sem_give(sqe->sem);
+		rtio_iodev_sqe_ok(iodev_sqe, 0);
+		break;
 	default:
 		rtio_iodev_sqe_err(iodev_sqe, -EINVAL);
 	}
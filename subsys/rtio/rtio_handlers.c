@@ -16,10 +16,14 @@
  * thread.
  *
  * Each op code that is acceptable from user mode must also be validated.
+ *
+ * The previously verified SQE of the same batch, if any, is given as prev so
+ * that the kernel objects it already validated are not looked up again.
  */
-static inline bool rtio_vrfy_sqe(struct rtio_sqe *sqe)
+static inline bool rtio_vrfy_sqe(struct rtio_sqe *sqe, const struct rtio_sqe *prev)
 {
-	if (sqe->iodev != NULL && K_SYSCALL_OBJ(sqe->iodev, K_OBJ_RTIO_IODEV)) {
+	if (sqe->iodev != NULL && (prev == NULL || prev->iodev != sqe->iodev) &&
+	    K_SYSCALL_OBJ(sqe->iodev, K_OBJ_RTIO_IODEV)) {
 		return false;
 	}
 
@@ -42,6 +46,11 @@ static inline bool rtio_vrfy_sqe(struct rtio_sqe *sqe)
 		valid_sqe &= K_SYSCALL_MEMORY(sqe->tx_buf, sqe->txrx_buf_len, true);
 		valid_sqe &= K_SYSCALL_MEMORY(sqe->rx_buf, sqe->txrx_buf_len, true);
 		break;
+	case RTIO_OP_SEM_GIVE:
+		if (prev == NULL || prev->op != RTIO_OP_SEM_GIVE || prev->sem != sqe->sem) {
+			valid_sqe &= K_SYSCALL_OBJ(sqe->sem, K_OBJ_SEM) == 0;
+		}
+		break;
 	default:
 		/* RTIO OP must be known and allowable from user mode
 		 * otherwise it is invalid
@@ -52,6 +61,41 @@ static inline bool rtio_vrfy_sqe(struct rtio_sqe *sqe)
 	return valid_sqe;
 }
 
+/**
+ * Copy the SQEs of the calling thread into the queue, verifying each of them
+ * once copied so they cannot be changed afterwards.
+ */
+static int rtio_vrfy_sqe_copy_in(struct rtio *r, const struct rtio_sqe *sqes,
+				 struct rtio_sqe **handle, size_t sqe_count)
+{
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_READ(sqes, sqe_count, sizeof(struct rtio_sqe)));
+	struct rtio_sqe *sqe;
+	struct rtio_sqe *prev = NULL;
+	uint32_t acquirable = rtio_sqe_acquirable(r);
+
+	if (acquirable < sqe_count) {
+		return -ENOMEM;
+	}
+
+	for (int i = 0; i < sqe_count; i++) {
+		sqe = rtio_sqe_acquire(r);
+		__ASSERT_NO_MSG(sqe != NULL);
+		if (handle != NULL && i == 0) {
+			*handle = sqe;
+		}
+		*sqe = sqes[i];
+
+		if (!rtio_vrfy_sqe(sqe, prev)) {
+			rtio_sqe_drop_all(r);
+			K_OOPS(true);
+		}
+
+		prev = sqe;
+	}
+
+	return 0;
+}
+
 static inline void z_vrfy_rtio_release_buffer(struct rtio *r, void *buff, uint32_t buff_len)
 {
 	K_OOPS(K_SYSCALL_OBJ(r, K_OBJ_RTIO));
@@ -79,29 +123,13 @@ static inline int z_vrfy_rtio_sqe_cancel(struct rtio_sqe *sqe)
 static inline int z_vrfy_rtio_sqe_copy_in_get_handles(struct rtio *r, const struct rtio_sqe *sqes,
 						      struct rtio_sqe **handle, size_t sqe_count)
 {
-	K_OOPS(K_SYSCALL_OBJ(r, K_OBJ_RTIO));
-
-	K_OOPS(K_SYSCALL_MEMORY_ARRAY_READ(sqes, sqe_count, sizeof(struct rtio_sqe)));
-	struct rtio_sqe *sqe;
-	uint32_t acquirable = rtio_sqe_acquirable(r);
-
-	if (acquirable < sqe_count) {
-		return -ENOMEM;
-	}
-
+	int res;
 
-	for (int i = 0; i < sqe_count; i++) {
-		sqe = rtio_sqe_acquire(r);
-		__ASSERT_NO_MSG(sqe != NULL);
-		if (handle != NULL && i == 0) {
-			*handle = sqe;
-		}
-		*sqe = sqes[i];
+	K_OOPS(K_SYSCALL_OBJ(r, K_OBJ_RTIO));
 
-		if (!rtio_vrfy_sqe(sqe)) {
-			rtio_sqe_drop_all(r);
-			K_OOPS(true);
-		}
+	res = rtio_vrfy_sqe_copy_in(r, sqes, handle, sqe_count);
+	if (res != 0) {
+		return res;
 	}
 
 	/* Already copied *and* verified, no need to redo */
@@ -133,3 +161,23 @@ static inline int z_vrfy_rtio_submit(struct rtio *r, uint32_t wait_count)
 	return z_impl_rtio_submit(r, wait_count);
 }
 #include <zephyr/syscalls/rtio_submit_mrsh.c>
+
+static inline int z_vrfy_rtio_sqe_copy_in_submit(struct rtio *r, const struct rtio_sqe *sqes,
+						 size_t sqe_count, uint32_t wait_count)
+{
+	int res;
+
+	K_OOPS(K_SYSCALL_OBJ(r, K_OBJ_RTIO));
+
+#ifdef CONFIG_RTIO_SUBMIT_SEM
+	K_OOPS(K_SYSCALL_OBJ(r->submit_sem, K_OBJ_SEM));
+#endif
+
+	res = rtio_vrfy_sqe_copy_in(r, sqes, NULL, sqe_count);
+	if (res != 0) {
+		return res;
+	}
+
+	return z_impl_rtio_submit(r, wait_count);
+}
+#include <zephyr/syscalls/rtio_sqe_copy_in_submit_mrsh.c>
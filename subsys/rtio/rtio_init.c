@@ -14,6 +14,17 @@
 K_APPMEM_PARTITION_DEFINE(rtio_partition);
 #endif
 
+#ifdef CONFIG_RTIO_CONSUME_SEM_COALESCE
+static void rtio_cq_notify_expiry(struct k_timer *timer)
+{
+	struct rtio *r = CONTAINER_OF(timer, struct rtio, cq_notify_timer);
+
+	if (atomic_set(&r->cq_pending, 0) != 0) {
+		k_sem_give(r->consume_sem);
+	}
+}
+#endif
+
 int rtio_init(void)
 {
 	STRUCT_SECTION_FOREACH(rtio_sqe_pool, sqe_pool) {
@@ -28,6 +39,12 @@ int rtio_init(void)
 		}
 	}
 
+#ifdef CONFIG_RTIO_CONSUME_SEM_COALESCE
+	STRUCT_SECTION_FOREACH(rtio, r) {
+		k_timer_init(&r->cq_notify_timer, rtio_cq_notify_expiry, NULL);
+	}
+#endif
+
 	return 0;
 }
 
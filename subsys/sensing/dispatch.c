@@ -3,6 +3,7 @@
  *
  * SPDX-License-Identifier: Apache-2.0
  */
+#include <stdlib.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/rtio/rtio.h>
@@ -34,6 +35,170 @@ static void update_client_consume_time(struct sensing_sensor *sensor,
 	conn->next_consume_time += interval;
 }
 
+#ifdef CONFIG_SENSING_SAMPLE_RING
+#define RING_SIZE CONFIG_SENSING_SAMPLE_RING_SIZE
+
+BUILD_ASSERT(IS_POWER_OF_TWO(RING_SIZE), "sample ring size must be a power of two");
+
+static inline uint8_t *ring_sample(struct sensing_sample_ring *ring, uint32_t idx)
+{
+	return &ring->samples[(idx & (RING_SIZE - 1)) * ring->sample_size];
+}
+
+/* store a sample in the ring, dropping the oldest one if it is not claimed */
+static void ring_push(struct sensing_sensor *sensor, const void *data)
+{
+	struct sensing_sample_ring *ring = sensor->ring;
+	struct sensing_connection *conn;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&ring->lock);
+
+	if (ring->head - ring->tail == RING_SIZE) {
+		for_each_client_conn(sensor, conn) {
+			if (conn->ring_reader && conn->ring_claimed &&
+			    conn->ring_cursor == ring->tail) {
+				break;
+			}
+		}
+
+		if (conn != NULL) {
+			/* oldest sample in use, the readers lose the new one */
+			for_each_client_conn(sensor, conn) {
+				if (conn->ring_reader) {
+					conn->ring_overflow++;
+				}
+			}
+			k_spin_unlock(&ring->lock, key);
+			return;
+		}
+
+		ring->tail++;
+	}
+
+	memcpy(ring_sample(ring, ring->head), data, ring->sample_size);
+	ring->times[ring->head & (RING_SIZE - 1)] = get_us();
+	ring->head++;
+
+	k_spin_unlock(&ring->lock, key);
+}
+
+int ring_attach(struct sensing_connection *conn)
+{
+	struct sensing_sensor *sensor = conn->source;
+	struct sensing_sample_ring *ring = sensor->ring;
+	uint16_t sample_size = sensor->register_info->sample_size;
+	k_spinlock_key_t key;
+
+	if (ring == NULL) {
+		ring = malloc(sizeof(*ring) + RING_SIZE * (sizeof(uint64_t) + sample_size));
+		if (ring == NULL) {
+			return -ENOMEM;
+		}
+		memset(ring, 0, sizeof(*ring));
+		ring->sample_size = sample_size;
+		ring->times = (uint64_t *)(ring + 1);
+		ring->samples = (uint8_t *)&ring->times[RING_SIZE];
+		sensor->ring = ring;
+	}
+
+	key = k_spin_lock(&ring->lock);
+	conn->ring_cursor = ring->head;
+	conn->ring_overflow = 0;
+	conn->ring_claimed = false;
+	conn->ring_reader = true;
+	k_spin_unlock(&ring->lock, key);
+
+	return 0;
+}
+
+int ring_claim(struct sensing_connection *conn, const void **buf)
+{
+	struct sensing_sensor *sensor = conn->source;
+	struct sensing_sample_ring *ring = sensor->ring;
+	k_spinlock_key_t key;
+	int ret = -EAGAIN;
+
+	if (!conn->ring_reader) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&ring->lock);
+
+	if (conn->ring_claimed) {
+		ret = -EBUSY;
+		goto out;
+	}
+
+	/* account the samples overwritten before the client read them */
+	if ((int32_t)(ring->tail - conn->ring_cursor) > 0) {
+		conn->ring_overflow += ring->tail - conn->ring_cursor;
+		conn->ring_cursor = ring->tail;
+	}
+
+	for (; conn->ring_cursor != ring->head; conn->ring_cursor++) {
+		uint64_t time = ring->times[conn->ring_cursor & (RING_SIZE - 1)];
+
+		if (is_client_request_data(conn) &&
+		    sensor_test_consume_time(sensor, conn, time)) {
+			update_client_consume_time(sensor, conn);
+			conn->ring_claimed = true;
+			*buf = ring_sample(ring, conn->ring_cursor);
+			ret = 0;
+			break;
+		}
+	}
+
+out:
+	k_spin_unlock(&ring->lock, key);
+
+	return ret;
+}
+
+int ring_finish(struct sensing_connection *conn)
+{
+	struct sensing_sample_ring *ring = conn->source->ring;
+	k_spinlock_key_t key;
+	int ret = 0;
+
+	if (!conn->ring_reader) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&ring->lock);
+	if (conn->ring_claimed) {
+		conn->ring_claimed = false;
+		conn->ring_cursor++;
+	} else {
+		ret = -EINVAL;
+	}
+	k_spin_unlock(&ring->lock, key);
+
+	return ret;
+}
+
+int ring_overflow_get(struct sensing_connection *conn, uint32_t *count)
+{
+	struct sensing_sample_ring *ring = conn->source->ring;
+	k_spinlock_key_t key;
+
+	if (!conn->ring_reader) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&ring->lock);
+	if ((int32_t)(ring->tail - conn->ring_cursor) > 0) {
+		conn->ring_overflow += ring->tail - conn->ring_cursor;
+		conn->ring_cursor = ring->tail;
+	}
+	*count = conn->ring_overflow;
+	conn->ring_overflow = 0;
+	k_spin_unlock(&ring->lock, key);
+
+	return 0;
+}
+#endif
+
 /* send data to clients based on interval and sensitivity */
 static int send_data_to_clients(struct sensing_sensor *sensor,
 				void *data)
@@ -41,6 +206,12 @@ static int send_data_to_clients(struct sensing_sensor *sensor,
 	struct sensing_sensor *client;
 	struct sensing_connection *conn;
 
+#ifdef CONFIG_SENSING_SAMPLE_RING
+	if (sensor->ring != NULL) {
+		ring_push(sensor, data);
+	}
+#endif
+
 	for_each_client_conn(sensor, conn) {
 		client = conn->sink;
 		LOG_DBG("sensor:%s send data to client:%p", conn->source->dev->name, conn);
@@ -49,6 +220,13 @@ static int send_data_to_clients(struct sensing_sensor *sensor,
 			continue;
 		}
 
+#ifdef CONFIG_SENSING_SAMPLE_RING
+		/* ring readers pull the samples at their own rate */
+		if (conn->ring_reader) {
+			continue;
+		}
+#endif
+
 		/* sensor_test_consume_time(), check whether time is ready or not:
 		 * true: it's time for client consuming the data
 		 * false: client time not arrived yet, not consume the data
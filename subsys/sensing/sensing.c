@@ -155,3 +155,41 @@ const struct sensing_sensor_info *sensing_get_sensor_info(sensing_sensor_handle_
 {
 	return get_sensor_info(handle);
 }
+
+#ifdef CONFIG_SENSING_SAMPLE_RING
+int sensing_ring_attach(sensing_sensor_handle_t handle)
+{
+	if (handle == NULL) {
+		return -ENODEV;
+	}
+
+	return ring_attach(handle);
+}
+
+int sensing_ring_claim(sensing_sensor_handle_t handle, const void **buf)
+{
+	if (handle == NULL || buf == NULL) {
+		return -ENODEV;
+	}
+
+	return ring_claim(handle, buf);
+}
+
+int sensing_ring_finish(sensing_sensor_handle_t handle)
+{
+	if (handle == NULL) {
+		return -ENODEV;
+	}
+
+	return ring_finish(handle);
+}
+
+int sensing_ring_overflow_get(sensing_sensor_handle_t handle, uint32_t *count)
+{
+	if (handle == NULL || count == NULL) {
+		return -ENODEV;
+	}
+
+	return ring_overflow_get(handle, count);
+}
+#endif
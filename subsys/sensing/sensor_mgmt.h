@@ -49,6 +49,30 @@ struct sensing_context {
 	atomic_t event_flag;
 };
 
+#ifdef CONFIG_SENSING_SAMPLE_RING
+/**
+ * @struct sensing_sample_ring
+ * @brief ring of the latest samples of a sensor, shared by its ring readers
+ *
+ * head and tail are free running counters of the entries written and dropped, each
+ * reader keeps its own cursor in its connection.
+ */
+struct sensing_sample_ring {
+	struct k_spinlock lock;
+	uint32_t head;
+	uint32_t tail;
+	uint16_t sample_size;
+	/* time each entry was dispatched at, in micro seconds */
+	uint64_t *times;
+	uint8_t *samples;
+};
+
+int ring_attach(struct sensing_connection *conn);
+int ring_claim(struct sensing_connection *conn, const void **buf);
+int ring_finish(struct sensing_connection *conn);
+int ring_overflow_get(struct sensing_connection *conn, uint32_t *count);
+#endif
+
 int open_sensor(struct sensing_sensor *sensor, struct sensing_connection **conn);
 int close_sensor(struct sensing_connection **conn);
 int sensing_register_callback(struct sensing_connection *conn,
@@ -44,7 +44,6 @@ struct settings_nvs {
 		uint16_t name_id;
 	} cache[CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE];
 
-	uint16_t cache_next;
 	uint16_t cache_total;
 	bool loaded;
 #endif
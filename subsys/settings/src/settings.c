@@ -24,6 +24,40 @@ sys_slist_t settings_handlers;
 
 K_MUTEX_DEFINE(settings_lock);
 
+#if defined(CONFIG_SETTINGS_LOOKUP_CACHE)
+/*
+ * Handlers resolved for the most recently looked up keys, so that repeated
+ * runtime accesses to the same keys do not compare them against every
+ * handler name. Any change of the dynamic handlers drops the whole cache.
+ */
+struct settings_lookup_entry {
+	struct settings_handler_static *handler;
+	uint32_t hash;
+	uint32_t last_use;
+	uint8_t len;
+	/* Offset of the key part following the handler name, 0 if none */
+	uint8_t next;
+	char name[SETTINGS_MAX_NAME_LEN];
+};
+
+static struct settings_lookup_entry lookup_cache[CONFIG_SETTINGS_LOOKUP_CACHE_SIZE];
+static uint32_t lookup_clock;
+static uint32_t lookup_generation;
+static struct k_spinlock lookup_lock;
+
+void settings_lookup_cache_invalidate(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lookup_lock);
+
+	ARRAY_FOR_EACH_PTR(lookup_cache, entry) {
+		entry->handler = NULL;
+	}
+	lookup_generation++;
+
+	k_spin_unlock(&lookup_lock, key);
+}
+#endif /* CONFIG_SETTINGS_LOOKUP_CACHE */
+
 
 void settings_store_init(void);
 
@@ -56,6 +90,9 @@ int settings_register(struct settings_handler *handler)
 		}
 	}
 	sys_slist_append(&settings_handlers, &handler->node);
+#if defined(CONFIG_SETTINGS_LOOKUP_CACHE)
+	settings_lookup_cache_invalidate();
+#endif
 
 end:
 	k_mutex_unlock(&settings_lock);
@@ -134,8 +171,8 @@ int settings_name_next(const char *name, const char **next)
 	return rc;
 }
 
-struct settings_handler_static *settings_parse_and_lookup(const char *name,
-							const char **next)
+static struct settings_handler_static *settings_lookup(const char *name,
+						       const char **next)
 {
 	struct settings_handler_static *bestmatch;
 	const char *tmpnext;
@@ -189,6 +226,85 @@ struct settings_handler_static *settings_parse_and_lookup(const char *name,
 	return bestmatch;
 }
 
+#if defined(CONFIG_SETTINGS_LOOKUP_CACHE)
+struct settings_handler_static *settings_parse_and_lookup(const char *name,
+							const char **next)
+{
+	struct settings_lookup_entry *victim = &lookup_cache[0];
+	struct settings_handler_static *handler;
+	const char *tmpnext;
+	uint32_t hash = 2166136261U;
+	uint32_t generation;
+	k_spinlock_key_t key;
+	size_t len = 0;
+
+	/* FNV-1a over the key, which ends like in settings_name_steq() */
+	while (name[len] != '\0' && name[len] != SETTINGS_NAME_END) {
+		hash = (hash ^ (uint8_t)name[len]) * 16777619U;
+		len++;
+	}
+
+	if (len > SETTINGS_MAX_NAME_LEN) {
+		return settings_lookup(name, next);
+	}
+
+	key = k_spin_lock(&lookup_lock);
+
+	ARRAY_FOR_EACH_PTR(lookup_cache, entry) {
+		if (entry->handler != NULL && entry->hash == hash && entry->len == len &&
+		    memcmp(entry->name, name, len) == 0) {
+			entry->last_use = ++lookup_clock;
+			handler = entry->handler;
+			if (next) {
+				*next = entry->next != 0U ? &name[entry->next] : NULL;
+			}
+
+			k_spin_unlock(&lookup_lock, key);
+			return handler;
+		}
+
+		if (entry->handler == NULL ||
+		    (victim->handler != NULL && entry->last_use < victim->last_use)) {
+			victim = entry;
+		}
+	}
+
+	generation = lookup_generation;
+	k_spin_unlock(&lookup_lock, key);
+
+	handler = settings_lookup(name, &tmpnext);
+	if (next) {
+		*next = tmpnext;
+	}
+
+	if (handler == NULL) {
+		return NULL;
+	}
+
+	key = k_spin_lock(&lookup_lock);
+
+	/* Not cached if the handlers changed meanwhile */
+	if (generation == lookup_generation) {
+		victim->handler = handler;
+		victim->hash = hash;
+		victim->last_use = ++lookup_clock;
+		victim->len = len;
+		victim->next = tmpnext != NULL ? tmpnext - name : 0U;
+		memcpy(victim->name, name, len);
+	}
+
+	k_spin_unlock(&lookup_lock, key);
+
+	return handler;
+}
+#else
+struct settings_handler_static *settings_parse_and_lookup(const char *name,
+							const char **next)
+{
+	return settings_lookup(name, next);
+}
+#endif /* CONFIG_SETTINGS_LOOKUP_CACHE */
+
 int settings_call_set_handler(const char *name,
 			      size_t len,
 			      settings_read_cb read_cb,
@@ -76,33 +76,85 @@ int settings_nvs_dst(struct settings_nvs *cf)
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
 #define SETTINGS_NVS_CACHE_OVFL(cf) ((cf)->cache_total > ARRAY_SIZE((cf)->cache))
 
+/* The cache is a hash table with linear probing, indexed by the CRC-16 of the
+ * name. A name_id of 0 marks a slot that was never used and ends a probe,
+ * NVS_NAMECNT_ID marks a slot freed by a delete that can be reused.
+ */
+#define SETTINGS_NVS_CACHE_EMPTY 0
+
+static inline uint16_t settings_nvs_cache_hash(const char *name)
+{
+	return crc16_ccitt(0xffff, name, strlen(name));
+}
+
 static void settings_nvs_cache_add(struct settings_nvs *cf, const char *name,
 				   uint16_t name_id)
 {
-	uint16_t name_hash = crc16_ccitt(0xffff, name, strlen(name));
+	uint16_t name_hash = settings_nvs_cache_hash(name);
+	uint16_t pos = name_hash % CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE;
+	int free = -1;
 
-	cf->cache[cf->cache_next].name_hash = name_hash;
-	cf->cache[cf->cache_next++].name_id = name_id;
+	for (int i = 0; i < CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE; i++) {
+		if (cf->cache[pos].name_id == name_id) {
+			free = pos;
+			break;
+		}
+
+		if ((free < 0) && (cf->cache[pos].name_id <= NVS_NAMECNT_ID)) {
+			free = pos;
+		}
 
-	cf->cache_next %= CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE;
+		if (cf->cache[pos].name_id == SETTINGS_NVS_CACHE_EMPTY) {
+			break;
+		}
+
+		pos = (pos + 1) % CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE;
+	}
+
+	if (free < 0) {
+		/* Cache full, evict the entry in the home slot. */
+		free = name_hash % CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE;
+	}
+
+	cf->cache[free].name_hash = name_hash;
+	cf->cache[free].name_id = name_id;
+}
+
+static void settings_nvs_cache_del(struct settings_nvs *cf, uint16_t name_id)
+{
+	for (int i = 0; i < CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE; i++) {
+		if (cf->cache[i].name_id == name_id) {
+			cf->cache[i].name_id = NVS_NAMECNT_ID;
+			if (cf->loaded && !SETTINGS_NVS_CACHE_OVFL(cf)) {
+				cf->cache_total--;
+			}
+			return;
+		}
+	}
 }
 
 static uint16_t settings_nvs_cache_match(struct settings_nvs *cf, const char *name,
 					 char *rdname, size_t len)
 {
-	uint16_t name_hash = crc16_ccitt(0xffff, name, strlen(name));
+	uint16_t name_hash = settings_nvs_cache_hash(name);
+	uint16_t pos = name_hash % CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE;
 	int rc;
 
-	for (int i = 0; i < CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE; i++) {
-		if (cf->cache[i].name_hash != name_hash) {
+	for (int i = 0; i < CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE;
+	     i++, pos = (pos + 1) % CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE) {
+		if (cf->cache[pos].name_id == SETTINGS_NVS_CACHE_EMPTY) {
+			break;
+		}
+
+		if (cf->cache[pos].name_hash != name_hash) {
 			continue;
 		}
 
-		if (cf->cache[i].name_id <= NVS_NAMECNT_ID) {
+		if (cf->cache[pos].name_id <= NVS_NAMECNT_ID) {
 			continue;
 		}
 
-		rc = nvs_read(&cf->cf_nvs, cf->cache[i].name_id, rdname, len);
+		rc = nvs_read(&cf->cf_nvs, cf->cache[pos].name_id, rdname, len);
 		if (rc < 0) {
 			continue;
 		}
@@ -113,7 +165,7 @@ static uint16_t settings_nvs_cache_match(struct settings_nvs *cf, const char *na
 			continue;
 		}
 
-		return cf->cache[i].name_id;
+		return cf->cache[pos].name_id;
 	}
 
 	return NVS_NAMECNT_ID;
@@ -155,6 +207,20 @@ static int settings_nvs_load(struct settings_store *cs,
 		 * setting's value.
 		 */
 		rc1 = nvs_read(&cf->cf_nvs, name_id, &name, sizeof(name));
+		if ((rc1 > 0) && (arg != NULL) && (arg->subtree != NULL)) {
+			/* Skip the value of names outside of the requested
+			 * subtree, the set handler would ignore them anyway.
+			 */
+			name[rc1] = '\0';
+			if (!settings_name_steq(name, arg->subtree, NULL)) {
+#if CONFIG_SETTINGS_NVS_NAME_CACHE
+				settings_nvs_cache_add(cf, name, name_id);
+				cached++;
+#endif
+				continue;
+			}
+		}
+
 		rc2 = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET,
 			       &buf, sizeof(buf));
 
@@ -297,6 +363,10 @@ found:
 			return rc;
 		}
 
+#if CONFIG_SETTINGS_NVS_NAME_CACHE
+		settings_nvs_cache_del(cf, name_id);
+#endif
+
 		if (name_id == cf->last_name_id) {
 			cf->last_name_id--;
 			rc = nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID,
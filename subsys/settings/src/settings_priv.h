@@ -107,6 +107,9 @@ void settings_line_io_init(int (*read_cb)(void *ctx, off_t off, char *buf,
 			  uint8_t io_rwbs);
 
 
+/* Drop the handlers resolved by settings_parse_and_lookup() */
+void settings_lookup_cache_invalidate(void);
+
 extern sys_slist_t settings_load_srcs;
 extern sys_slist_t settings_handlers;
 extern struct settings_store *settings_save_dst;
@@ -88,6 +88,167 @@ int settings_load_subtree_direct(
 	return 0;
 }
 
+#if defined(CONFIG_SETTINGS_TXN)
+/*
+ * Transaction buffer. Each record is a settings_txn_hdr followed by the
+ * name, including its terminating '\0', and the value. The settings lock
+ * is held from settings_txn_begin() until the transaction ends, so only
+ * the thread owning the transaction can add records.
+ */
+struct settings_txn_hdr {
+	uint16_t name_len;
+	uint16_t val_len;
+};
+
+static struct {
+	uint8_t buf[CONFIG_SETTINGS_TXN_BUFFER_SIZE];
+	size_t len;
+	bool active;
+} settings_txn;
+
+static size_t settings_txn_rec_size(const struct settings_txn_hdr *hdr)
+{
+	return sizeof(*hdr) + hdr->name_len + hdr->val_len;
+}
+
+static int settings_txn_add(const char *name, const void *value, size_t val_len)
+{
+	struct settings_txn_hdr hdr, old;
+	size_t off = 0;
+	size_t free_len = sizeof(settings_txn.buf) - settings_txn.len;
+
+	hdr.name_len = strlen(name) + 1;
+	hdr.val_len = (value == NULL) ? 0 : val_len;
+	if ((hdr.name_len > SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1) ||
+	    (val_len > SETTINGS_MAX_VAL_LEN)) {
+		return -EINVAL;
+	}
+
+	/* A key saved again in the transaction replaces the previous value */
+	while (off < settings_txn.len) {
+		memcpy(&old, &settings_txn.buf[off], sizeof(old));
+		if ((old.name_len == hdr.name_len) &&
+		    !memcmp(&settings_txn.buf[off + sizeof(old)], name, hdr.name_len)) {
+			free_len += settings_txn_rec_size(&old);
+			break;
+		}
+		off += settings_txn_rec_size(&old);
+	}
+
+	if (settings_txn_rec_size(&hdr) > free_len) {
+		return -ENOMEM;
+	}
+
+	if (off < settings_txn.len) {
+		size_t old_size = settings_txn_rec_size(&old);
+
+		memmove(&settings_txn.buf[off], &settings_txn.buf[off + old_size],
+			settings_txn.len - off - old_size);
+		settings_txn.len -= old_size;
+	}
+
+	off = settings_txn.len;
+	memcpy(&settings_txn.buf[off], &hdr, sizeof(hdr));
+	off += sizeof(hdr);
+	memcpy(&settings_txn.buf[off], name, hdr.name_len);
+	off += hdr.name_len;
+	if (hdr.val_len) {
+		memcpy(&settings_txn.buf[off], value, hdr.val_len);
+	}
+	settings_txn.len = off + hdr.val_len;
+
+	return 0;
+}
+
+int settings_txn_begin(void)
+{
+	k_mutex_lock(&settings_lock, K_FOREVER);
+
+	if (settings_txn.active) {
+		k_mutex_unlock(&settings_lock);
+		return -EALREADY;
+	}
+
+	settings_txn.active = true;
+	settings_txn.len = 0;
+
+	/* settings_lock stays locked until the transaction ends */
+	return 0;
+}
+
+static void settings_txn_end(void)
+{
+	settings_txn.active = false;
+	settings_txn.len = 0;
+
+	/* Unlock for the caller and for settings_txn_begin() */
+	k_mutex_unlock(&settings_lock);
+	k_mutex_unlock(&settings_lock);
+}
+
+int settings_txn_commit(void)
+{
+	struct settings_store *cs;
+	struct settings_txn_hdr hdr;
+	const char *name;
+	size_t off = 0;
+	int rc = 0;
+
+	k_mutex_lock(&settings_lock, K_FOREVER);
+
+	if (!settings_txn.active) {
+		k_mutex_unlock(&settings_lock);
+		return -EINVAL;
+	}
+
+	cs = settings_save_dst;
+	if (!cs) {
+		settings_txn_end();
+		return -ENOENT;
+	}
+
+	if (cs->cs_itf->csi_save_start) {
+		cs->cs_itf->csi_save_start(cs);
+	}
+
+	while (off < settings_txn.len) {
+		memcpy(&hdr, &settings_txn.buf[off], sizeof(hdr));
+		name = (const char *)&settings_txn.buf[off + sizeof(hdr)];
+
+		rc = cs->cs_itf->csi_save(cs, name,
+					  hdr.val_len ? &name[hdr.name_len] : NULL,
+					  hdr.val_len);
+		if (rc) {
+			LOG_ERR("Transaction commit failed at %s (err %d)", name, rc);
+			break;
+		}
+		off += settings_txn_rec_size(&hdr);
+	}
+
+	if (cs->cs_itf->csi_save_end) {
+		cs->cs_itf->csi_save_end(cs);
+	}
+
+	settings_txn_end();
+
+	return rc;
+}
+
+int settings_txn_abort(void)
+{
+	k_mutex_lock(&settings_lock, K_FOREVER);
+
+	if (!settings_txn.active) {
+		k_mutex_unlock(&settings_lock);
+		return -EINVAL;
+	}
+
+	settings_txn_end();
+
+	return 0;
+}
+#endif /* CONFIG_SETTINGS_TXN */
+
 /*
  * Append a single value to persisted config. Don't store duplicate value.
  */
@@ -103,6 +264,14 @@ int settings_save_one(const char *name, const void *value, size_t val_len)
 
 	k_mutex_lock(&settings_lock, K_FOREVER);
 
+#if defined(CONFIG_SETTINGS_TXN)
+	if (settings_txn.active) {
+		rc = settings_txn_add(name, value, val_len);
+		k_mutex_unlock(&settings_lock);
+		return rc;
+	}
+#endif
+
 	rc = cs->cs_itf->csi_save(cs, name, (char *)value, val_len);
 
 	k_mutex_unlock(&settings_lock);
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
 #include <zephyr/sys/ring_buffer.h>
 #include <zephyr/sys/atomic.h>
 #include <zephyr/mgmt/mcumgr/transport/smp_shell.h>
@@ -28,13 +29,59 @@ NET_BUF_POOL_DEFINE(smp_shell_rx_pool, CONFIG_MCUMGR_TRANSPORT_SHELL_RX_BUF_COUN
 		    SMP_SHELL_RX_BUF_SIZE, 0, NULL);
 #endif /* CONFIG_MCUMGR_TRANSPORT_SHELL */
 
+#define ASYNC_TX_BUFFERED (CONFIG_SHELL_BACKEND_SERIAL_ASYNC_TX_BUFFER_SIZE > 0)
+
+#if ASYNC_TX_BUFFERED
+/* Start the transfer of the buffer being filled and switch to the other one.
+ * Must be called with tx_lock held.
+ */
+static int async_tx_start(struct shell_uart_async *sh_uart)
+{
+	int err;
+
+	err = uart_tx(sh_uart->common.dev, sh_uart->tx_data[sh_uart->tx_fill],
+		      sh_uart->tx_len, SYS_FOREVER_US);
+	if (err == 0) {
+		sh_uart->tx_busy = true;
+		sh_uart->tx_fill ^= 1U;
+		sh_uart->tx_len = 0;
+	}
+
+	return err;
+}
+
+static void async_tx_done(struct shell_uart_async *sh_uart)
+{
+	K_SPINLOCK(&sh_uart->tx_lock) {
+		sh_uart->tx_busy = false;
+		if (sh_uart->tx_len > 0) {
+			if (async_tx_start(sh_uart) < 0) {
+				sh_uart->tx_len = 0;
+			}
+		}
+	}
+
+	sh_uart->common.handler(SHELL_TRANSPORT_EVT_TX_RDY, sh_uart->common.context);
+}
+#else
+static void async_tx_done(struct shell_uart_async *sh_uart)
+{
+	ARG_UNUSED(sh_uart);
+}
+#endif /* ASYNC_TX_BUFFERED */
+
 static void async_callback(const struct device *dev, struct uart_event *evt, void *user_data)
 {
 	struct shell_uart_async *sh_uart = (struct shell_uart_async *)user_data;
 
 	switch (evt->type) {
 	case  UART_TX_DONE:
-		k_sem_give(&sh_uart->tx_sem);
+	case  UART_TX_ABORTED:
+		if (ASYNC_TX_BUFFERED) {
+			async_tx_done(sh_uart);
+		} else {
+			k_sem_give(&sh_uart->tx_sem);
+		}
 		break;
 	case  UART_RX_RDY:
 		uart_async_rx_on_rdy(&sh_uart->async_rx, evt->data.rx.buf, evt->data.rx.len);
@@ -322,6 +369,9 @@ static void irq_uninit(struct shell_uart_int_driven *sh_uart)
 
 static void async_uninit(struct shell_uart_async *sh_uart)
 {
+#if ASYNC_TX_BUFFERED
+	(void)uart_tx_abort(sh_uart->common.dev);
+#endif
 }
 
 static void polling_uninit(struct shell_uart_polling *sh_uart)
@@ -388,6 +438,31 @@ static int async_write(struct shell_uart_async *sh_uart,
 {
 	int err;
 
+#if ASYNC_TX_BUFFERED
+	/* Data is copied into the buffer being filled while the other one is
+	 * transferred, so the shell thread can keep formatting output. It
+	 * only waits, on TX_RDY, when both buffers are in use.
+	 */
+	k_spinlock_key_t key = k_spin_lock(&sh_uart->tx_lock);
+	size_t len = MIN(length, sizeof(sh_uart->tx_data[0]) - sh_uart->tx_len);
+
+	memcpy(&sh_uart->tx_data[sh_uart->tx_fill][sh_uart->tx_len], data, len);
+	sh_uart->tx_len += len;
+
+	err = 0;
+	if (!sh_uart->tx_busy) {
+		err = async_tx_start(sh_uart);
+		if (err < 0) {
+			sh_uart->tx_len -= len;
+			len = 0;
+		}
+	}
+
+	k_spin_unlock(&sh_uart->tx_lock, key);
+	*cnt = len;
+
+	return err;
+#else
 	err = uart_tx(sh_uart->common.dev, data, length, SYS_FOREVER_US);
 	if (err < 0) {
 		*cnt = 0;
@@ -400,6 +475,7 @@ static int async_write(struct shell_uart_async *sh_uart,
 	sh_uart->common.handler(SHELL_TRANSPORT_EVT_TX_RDY, sh_uart->common.context);
 
 	return err;
+#endif /* ASYNC_TX_BUFFERED */
 }
 
 static int write_uart(const struct shell_transport *transport,
@@ -94,8 +94,8 @@ static int cmd_kernel_cycles(const struct shell *sh,
 	return 0;
 }
 
-#if defined(CONFIG_INIT_STACKS) && defined(CONFIG_THREAD_STACK_INFO) && \
-	defined(CONFIG_THREAD_MONITOR)
+#if (defined(CONFIG_INIT_STACKS) || defined(CONFIG_THREAD_STACK_WATERMARK)) && \
+	defined(CONFIG_THREAD_STACK_INFO) && defined(CONFIG_THREAD_MONITOR)
 static void shell_tdata_dump(const struct k_thread *cthread, void *user_data)
 {
 	struct k_thread *thread = (struct k_thread *)cthread;
@@ -122,7 +122,7 @@ static void shell_tdata_dump(const struct k_thread *cthread, void *user_data)
 	shell_print(sh, "\toptions: 0x%x, priority: %d timeout: %" PRId64,
 		      thread->base.user_options,
 		      thread->base.prio,
-		      (int64_t)thread->base.timeout.dticks);
+		      (int64_t)k_thread_timeout_remaining_ticks(thread));
 	shell_print(sh, "\tstate: %s, entry: %p",
 		    k_thread_state_str(thread, state_str, sizeof(state_str)),
 		    thread->entry.pEntry);
@@ -292,8 +292,10 @@ static void shell_stack_dump(const struct k_thread *thread, void *user_data)
 		thread, tname ? tname : "NA", size, unused, size - unused, size, pcnt);
 }
 
+#ifdef CONFIG_INIT_STACKS
 K_KERNEL_STACK_ARRAY_DECLARE(z_interrupt_stacks, CONFIG_MP_MAX_NUM_CPUS,
 			     CONFIG_ISR_STACK_SIZE);
+#endif /* CONFIG_INIT_STACKS */
 
 static int cmd_kernel_stacks(const struct shell *sh,
 			     size_t argc, char **argv)
@@ -310,6 +312,7 @@ static int cmd_kernel_stacks(const struct shell *sh,
 	 */
 	k_thread_foreach_unlocked(shell_stack_dump, (void *)sh);
 
+#ifdef CONFIG_INIT_STACKS
 	/* Placeholder logic for interrupt stack until we have better
 	 * kernel support, including dumping arch-specific exception-related
 	 * stack buffers.
@@ -330,6 +333,7 @@ static int cmd_kernel_stacks(const struct shell *sh,
 			    &z_interrupt_stacks[i], i, pad, size, unused, size - unused, size,
 			    ((size - unused) * 100U) / size);
 	}
+#endif /* CONFIG_INIT_STACKS */
 
 	return 0;
 }
@@ -454,8 +458,8 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel,
 #if defined(CONFIG_REBOOT)
 	SHELL_CMD(reboot, &sub_kernel_reboot, "Reboot.", NULL),
 #endif
-#if defined(CONFIG_INIT_STACKS) && defined(CONFIG_THREAD_STACK_INFO) && \
-		defined(CONFIG_THREAD_MONITOR)
+#if (defined(CONFIG_INIT_STACKS) || defined(CONFIG_THREAD_STACK_WATERMARK)) && \
+	defined(CONFIG_THREAD_STACK_INFO) && defined(CONFIG_THREAD_MONITOR)
 	SHELL_CMD(stacks, NULL, "List threads stack usage.", cmd_kernel_stacks),
 	SHELL_CMD(threads, NULL, "List kernel threads.", cmd_kernel_threads),
 #if defined(CONFIG_ARCH_HAS_STACKWALK)
@@ -330,12 +330,16 @@ static void find_completion_candidates(const struct shell *sh,
 	struct shell_static_entry dloc;
 	size_t incompl_cmd_len;
 	size_t idx = 0;
+	size_t end = SIZE_MAX;
 
 	incompl_cmd_len = z_shell_strlen(incompl_cmd);
 	*longest = 0U;
 	*cnt = 0;
 
-	while ((candidate = z_shell_cmd_get(cmd, idx, &dloc)) != NULL) {
+	/* Only visit the commands sharing the prefix when they are sorted */
+	(void)z_shell_cmd_prefix_range(cmd, incompl_cmd, incompl_cmd_len, &idx, &end);
+
+	while ((idx < end) && ((candidate = z_shell_cmd_get(cmd, idx, &dloc)) != NULL)) {
 		bool is_candidate;
 		is_candidate = is_completion_candidate(candidate->syntax,
 						incompl_cmd, incompl_cmd_len);
@@ -266,13 +266,94 @@ static inline uint32_t shell_root_cmd_count(void)
 	return len;
 }
 
+/* Root commands are placed in sections named after their syntax, which the
+ * linker sorts by name. Check it once so that other linkers only fall back
+ * to linear search.
+ */
+static bool shell_root_cmds_sorted(void)
+{
+	static int8_t sorted = -1;
+
+	if (sorted < 0) {
+		const size_t cmd_count = shell_root_cmd_count();
+		bool ok = true;
+
+		for (size_t cmd_idx = 1; ok && (cmd_idx < cmd_count); ++cmd_idx) {
+			ok = strcmp(shell_root_cmd_get(cmd_idx - 1)->entry->syntax,
+				    shell_root_cmd_get(cmd_idx)->entry->syntax) < 0;
+		}
+
+		sorted = ok ? 1 : 0;
+	}
+
+	return sorted == 1;
+}
+
+/* Index of the first root command not sorting before the first len
+ * characters of str.
+ */
+static size_t shell_root_cmd_lower_bound(const char *str, size_t len)
+{
+	size_t lo = 0;
+	size_t hi = shell_root_cmd_count();
+
+	while (lo < hi) {
+		size_t mid = lo + ((hi - lo) / 2);
+
+		if (strncmp(shell_root_cmd_get(mid)->entry->syntax, str, len) < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+bool z_shell_cmd_prefix_range(const struct shell_static_entry *parent,
+			      const char *prefix, size_t len,
+			      size_t *first, size_t *end)
+{
+	size_t idx;
+
+	if ((parent != NULL) || (len == 0) || !shell_root_cmds_sorted()) {
+		return false;
+	}
+
+	idx = shell_root_cmd_lower_bound(prefix, len);
+	*first = idx;
+
+	while ((idx < shell_root_cmd_count()) &&
+	       (strncmp(shell_root_cmd_get(idx)->entry->syntax, prefix, len) == 0)) {
+		idx++;
+	}
+
+	*end = idx;
+
+	return true;
+}
+
 /* Function returning pointer to parent command matching requested syntax. */
 const struct shell_static_entry *root_cmd_find(const char *syntax)
 {
 	const size_t cmd_count = shell_root_cmd_count();
 	const union shell_cmd_entry *cmd;
+	size_t cmd_idx = 0;
+
+	if (shell_root_cmds_sorted()) {
+		/* Including the terminating null character */
+		cmd_idx = shell_root_cmd_lower_bound(syntax, strlen(syntax) + 1);
+		if (cmd_idx < cmd_count) {
+			cmd = shell_root_cmd_get(cmd_idx);
+			if (strcmp(syntax, cmd->entry->syntax) == 0) {
+				return cmd->entry;
+			}
+		}
+
+		return NULL;
+	}
 
-	for (size_t cmd_idx = 0; cmd_idx < cmd_count; ++cmd_idx) {
+	for (; cmd_idx < cmd_count; ++cmd_idx) {
 		cmd = shell_root_cmd_get(cmd_idx);
 		if (strcmp(syntax, cmd->entry->syntax) == 0) {
 			return cmd->entry;
@@ -352,6 +433,8 @@ const struct shell_static_entry *z_shell_find_cmd(
 	if (parent) {
 		memcpy(&parent_cpy, parent, sizeof(struct shell_static_entry));
 		parent = &parent_cpy;
+	} else {
+		return root_cmd_find(cmd_str);
 	}
 
 	while ((entry = z_shell_cmd_get(parent, idx++, dloc)) != NULL) {
@@ -83,6 +83,22 @@ void z_shell_cmd_trim(const struct shell *sh);
 
 const struct shell_static_entry *root_cmd_find(const char *syntax);
 
+/* @internal @brief Function finds the range of commands starting with a prefix.
+ *
+ * Only available for the root commands, which are sorted.
+ *
+ * @param parent	Parent entry. NULL for root entry.
+ * @param prefix	Prefix.
+ * @param len		Prefix length.
+ * @param first		Index of the first matching command.
+ * @param end		Index following the last matching command.
+ *
+ * @return		False if not available, commands must then be scanned.
+ */
+bool z_shell_cmd_prefix_range(const struct shell_static_entry *parent,
+			      const char *prefix, size_t len,
+			      size_t *first, size_t *end);
+
 static inline void z_transport_buffer_flush(const struct shell *sh)
 {
 	z_shell_fprintf_buffer_flush(sh->fprintf_ctx);
@@ -74,11 +74,18 @@ static enum shell_wildcard_status commands_expand(const struct shell *sh,
 	struct shell_static_entry const *entry = NULL;
 	struct shell_static_entry dloc;
 	size_t cmd_idx = 0;
+	size_t cmd_end = SIZE_MAX;
 	size_t cnt = 0;
+	/* Literal part of the pattern, which all matching commands start with */
+	size_t prefix_len = strcspn(pattern, "*?[\\");
 
-	while ((entry = z_shell_cmd_get(cmd, cmd_idx++, &dloc)) != NULL) {
+	(void)z_shell_cmd_prefix_range(cmd, pattern, prefix_len, &cmd_idx, &cmd_end);
 
-		if (fnmatch(pattern, entry->syntax, 0) == 0) {
+	while ((cmd_idx < cmd_end) &&
+	       ((entry = z_shell_cmd_get(cmd, cmd_idx++, &dloc)) != NULL)) {
+
+		if ((strncmp(entry->syntax, pattern, prefix_len) == 0) &&
+		    (fnmatch(pattern, entry->syntax, 0) == 0)) {
 			ret_val = command_add(sh->ctx->temp_buff,
 					      &sh->ctx->cmd_tmp_buff_len,
 					      entry->syntax, pattern);
@@ -139,6 +139,9 @@ stats_init(struct stats_hdr *hdr, uint8_t size, uint16_t cnt,
 	hdr->s_map = map;
 	hdr->s_map_cnt = map_cnt;
 #endif
+#ifdef CONFIG_STATS_PERCPU
+	hdr->s_cpu_stride = 0;
+#endif
 
 	stats_reset(hdr);
 }
@@ -272,6 +275,89 @@ stats_init_and_reg(struct stats_hdr *shdr, uint8_t size, uint16_t cnt,
 	return 0;
 }
 
+#ifdef CONFIG_STATS_PERCPU
+/**
+ * Initializes and registers the specified per-CPU statistics section.
+ *
+ * @param shdr The statistics header of the first copy of the section
+ * @param stride The distance between the copies of the section, in bytes.
+ *
+ * See stats_init_and_reg() for the other parameters.
+ *
+ * @return 0 on success, non-zero error code on failure.
+ */
+int
+stats_init_and_reg_percpu(struct stats_hdr *shdr, uint16_t stride, uint8_t size,
+			  uint16_t cnt, const struct stats_name_map *map,
+			  uint16_t map_cnt, const char *name)
+{
+	stats_init(shdr, size, cnt, map, map_cnt);
+
+	/* The other copies were not cleared by stats_init() */
+	shdr->s_cpu_stride = stride;
+	stats_reset(shdr);
+
+	return stats_register(name, shdr);
+}
+#endif
+
+static unsigned int
+stats_num_copies(const struct stats_hdr *hdr)
+{
+#ifdef CONFIG_STATS_PERCPU
+	if (hdr->s_cpu_stride != 0) {
+		return STATS_PERCPU_NUM_CPUS;
+	}
+#endif
+
+	return 1;
+}
+
+static uint16_t
+stats_stride(const struct stats_hdr *hdr)
+{
+#ifdef CONFIG_STATS_PERCPU
+	return hdr->s_cpu_stride;
+#else
+	return 0;
+#endif
+}
+
+/**
+ * Reads a statistic, summing the copies of per-CPU sections.
+ *
+ * @param hdr The statistics header
+ * @param off The offset of the statistic from the header
+ *
+ * @return the value of the statistic.
+ */
+uint64_t
+stats_value_get(const struct stats_hdr *hdr, uint16_t off)
+{
+	const uint8_t *addr = (const uint8_t *)hdr + off;
+	uint64_t val = 0;
+
+	for (unsigned int i = 0; i < stats_num_copies(hdr); i++) {
+		switch (hdr->s_size) {
+		case sizeof(uint16_t):
+			val += *(const volatile uint16_t *)addr;
+			break;
+		case sizeof(uint32_t):
+			val += *(const volatile uint32_t *)addr;
+			break;
+		case sizeof(uint64_t):
+			val += *(const volatile uint64_t *)addr;
+			break;
+		default:
+			break;
+		}
+
+		addr += stats_stride(hdr);
+	}
+
+	return val;
+}
+
 /**
  * Resets and zeroes the specified statistics section.
  *
@@ -280,5 +366,10 @@ stats_init_and_reg(struct stats_hdr *shdr, uint8_t size, uint16_t cnt,
 void
 stats_reset(struct stats_hdr *hdr)
 {
-	(void)memset((uint8_t *)hdr + sizeof(*hdr), 0, hdr->s_size * hdr->s_cnt);
+	uint8_t *entries = (uint8_t *)hdr + sizeof(*hdr);
+
+	for (unsigned int i = 0; i < stats_num_copies(hdr); i++) {
+		(void)memset(entries, 0, hdr->s_size * hdr->s_cnt);
+		entries += stats_stride(hdr);
+	}
 }
@@ -4,27 +4,28 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <zephyr/kernel.h>
 #include <zephyr/shell/shell.h>
 #include <zephyr/stats/stats.h>
 
+/* Number of entries of a group whose rate can be computed */
+#define STATS_RATE_MAX_ENTRIES 32
+#define STATS_RATE_DEFAULT_INTERVAL_MS 1000
+
+struct stats_rate_arg {
+	const struct shell *sh;
+	uint64_t values[STATS_RATE_MAX_ENTRIES];
+	uint32_t interval_ms;
+	int idx;
+	bool print;
+};
+
 static int stats_cb(struct stats_hdr *hdr, void *arg, const char *name, uint16_t off)
 {
 	struct shell *sh = arg;
 	void *addr = (uint8_t *)hdr + off;
-	uint64_t val = 0;
-
-	switch (hdr->s_size) {
-	case sizeof(uint16_t):
-		val = *(uint16_t *)(addr);
-		break;
-
-	case sizeof(uint32_t):
-		val = *(uint32_t *)(addr);
-		break;
-	case sizeof(uint64_t):
-		val = *(uint64_t *)(addr);
-		break;
-	}
+	uint64_t val = stats_value_get(hdr, off);
+
 	shell_print(sh, "\t%s (offset: %u, addr: %p): %" PRIu64, name, off, addr, val);
 	return 0;
 }
@@ -43,8 +44,70 @@ static int cmd_stats_list(const struct shell *sh, size_t argc,
 	return stats_group_walk(stats_group_cb, (struct shell *)sh);
 }
 
+static int stats_rate_cb(struct stats_hdr *hdr, void *arg, const char *name, uint16_t off)
+{
+	struct stats_rate_arg *rate = arg;
+	uint64_t val;
+
+	if (rate->idx >= STATS_RATE_MAX_ENTRIES) {
+		return 0;
+	}
+
+	val = stats_value_get(hdr, off);
+	if (rate->print) {
+		shell_print(rate->sh, "\t%s: %" PRIu64 "/s", name,
+			    (val - rate->values[rate->idx]) * MSEC_PER_SEC / rate->interval_ms);
+	}
+
+	rate->values[rate->idx++] = val;
+	return 0;
+}
+
+static int cmd_stats_rate(const struct shell *sh, size_t argc, char **argv)
+{
+	struct stats_rate_arg rate = {
+		.sh = sh,
+		.interval_ms = STATS_RATE_DEFAULT_INTERVAL_MS,
+	};
+	struct stats_hdr *hdr;
+	int err = 0;
+
+	hdr = stats_group_find(argv[1]);
+	if (hdr == NULL) {
+		shell_error(sh, "Stats group %s not found", argv[1]);
+		return -ENOENT;
+	}
+
+	if (argc > 2) {
+		rate.interval_ms = shell_strtoul(argv[2], 10, &err);
+		if (err != 0 || rate.interval_ms == 0) {
+			shell_error(sh, "Invalid interval %s", argv[2]);
+			return -EINVAL;
+		}
+	}
+
+	/* Sample the group twice, the entries being summed over the CPUs */
+	(void)stats_walk(hdr, stats_rate_cb, &rate);
+	k_msleep(rate.interval_ms);
+
+	shell_print(sh, "Stats Group %s, rate over %u ms", hdr->s_name, rate.interval_ms);
+	rate.idx = 0;
+	rate.print = true;
+	(void)stats_walk(hdr, stats_rate_cb, &rate);
+
+	if (hdr->s_cnt > STATS_RATE_MAX_ENTRIES) {
+		shell_warn(sh, "Only the first %d entries are shown", STATS_RATE_MAX_ENTRIES);
+	}
+
+	return 0;
+}
+
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_stats,
 			       SHELL_CMD(list, NULL, "List stats", cmd_stats_list),
+			       SHELL_CMD_ARG(rate, NULL,
+					     "Show the rate of a stats group\n"
+					     "Usage: rate <group> [interval ms]",
+					     cmd_stats_rate, 2, 1),
 			       SHELL_SUBCMD_SET_END /* Array terminated. */
 			       );
 
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT fixed_partitions
+
+#include <errno.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/mm.h>
+#include <zephyr/storage/flash_map.h>
+
+struct flash_area_xip {
+	uint8_t fa_id;
+	uintptr_t addr;
+};
+
+/* Partitions of flash memory addressable by the CPU, leaving out the flash
+ * simulator whose memory node only describes the simulated layout.
+ */
+#define FLASH_AREA_XIP(part)								\
+	COND_CODE_1(DT_NODE_HAS_COMPAT(DT_GPARENT(part), soc_nv_flash),			\
+		(COND_CODE_0(DT_NODE_HAS_COMPAT(DT_PARENT(DT_GPARENT(part)),		\
+						zephyr_sim_flash),			\
+			({.fa_id = DT_FIXED_PARTITION_ID(part),				\
+			  .addr = DT_FIXED_PARTITION_ADDR(part)},), ())), ())
+
+#define FOREACH_PARTITION(n) DT_FOREACH_CHILD(DT_DRV_INST(n), FLASH_AREA_XIP)
+
+static const struct flash_area_xip flash_area_xip_map[] = {
+	DT_INST_FOREACH_STATUS_OKAY(FOREACH_PARTITION)
+};
+
+#ifdef CONFIG_MMU
+/* Virtual address of each partition, mapped on first use */
+static uint8_t *flash_area_xip_virt[ARRAY_SIZE(flash_area_xip_map)];
+static K_MUTEX_DEFINE(flash_area_xip_lock);
+
+static uint8_t *flash_area_xip_virt_get(size_t idx, size_t size)
+{
+	uintptr_t phys = ROUND_DOWN(flash_area_xip_map[idx].addr, CONFIG_MMU_PAGE_SIZE);
+	size_t skip = flash_area_xip_map[idx].addr - phys;
+	uint8_t *virt;
+
+	(void)k_mutex_lock(&flash_area_xip_lock, K_FOREVER);
+
+	if (flash_area_xip_virt[idx] == NULL) {
+		/* Read only, as the flash is written through its driver */
+		k_mem_map_phys_bare(&virt, phys, ROUND_UP(size + skip, CONFIG_MMU_PAGE_SIZE),
+				    K_MEM_CACHE_WB);
+		if (virt != NULL) {
+			flash_area_xip_virt[idx] = virt + skip;
+		}
+	}
+
+	virt = flash_area_xip_virt[idx];
+	k_mutex_unlock(&flash_area_xip_lock);
+
+	return virt;
+}
+#endif /* CONFIG_MMU */
+
+int flash_area_mmap(const struct flash_area *fa, off_t off, size_t len, const void **addr)
+{
+	if (off < 0 || len > fa->fa_size || off > fa->fa_size - len) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(flash_area_xip_map); i++) {
+		const uint8_t *base;
+
+		if (flash_area_xip_map[i].fa_id != fa->fa_id) {
+			continue;
+		}
+
+#ifdef CONFIG_MMU
+		base = flash_area_xip_virt_get(i, fa->fa_size);
+		if (base == NULL) {
+			return -ENOMEM;
+		}
+#else
+		base = (const uint8_t *)flash_area_xip_map[i].addr;
+#endif
+
+		*addr = base + off;
+
+		return 0;
+	}
+
+	return -ENOTSUP;
+}
@@ -12,6 +12,8 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME, CONFIG_STREAM_FLASH_LOG_LEVEL);
 
 #include <zephyr/types.h>
 #include <string.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
 #include <zephyr/drivers/flash.h>
 
 #include <zephyr/storage/stream_flash.h>
@@ -116,7 +118,9 @@ int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 
 #endif /* CONFIG_STREAM_FLASH_ERASE */
 
-static int flash_sync(struct stream_flash_ctx *ctx)
+/* Write buf_bytes bytes of buf at the current end of the stream */
+static int flash_sync_buf(struct stream_flash_ctx *ctx, uint8_t *buf,
+			  size_t buf_bytes)
 {
 	int rc = 0;
 	size_t write_addr = ctx->offset + ctx->bytes_written;
@@ -125,14 +129,14 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 	uint8_t filler;
 
 
-	if (ctx->buf_bytes == 0) {
+	if (buf_bytes == 0) {
 		return 0;
 	}
 
 	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE)) {
 
 		rc = stream_flash_erase_page(ctx,
-					     write_addr + ctx->buf_bytes - 1);
+					     write_addr + buf_bytes - 1);
 		if (rc < 0) {
 			LOG_ERR("stream_flash_erase_page err %d offset=0x%08zx",
 				rc, write_addr);
@@ -141,17 +145,17 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 	}
 
 	fill_length = ctx->write_block_size;
-	if (ctx->buf_bytes % fill_length) {
-		fill_length -= ctx->buf_bytes % fill_length;
+	if (buf_bytes % fill_length) {
+		fill_length -= buf_bytes % fill_length;
 		filler = ctx->erase_value;
 
-		memset(ctx->buf + ctx->buf_bytes, filler, fill_length);
+		memset(buf + buf_bytes, filler, fill_length);
 	} else {
 		fill_length = 0;
 	}
 
-	buf_bytes_aligned = ctx->buf_bytes + fill_length;
-	rc = flash_write(ctx->fdev, write_addr, ctx->buf, buf_bytes_aligned);
+	buf_bytes_aligned = buf_bytes + fill_length;
+	rc = flash_write(ctx->fdev, write_addr, buf, buf_bytes_aligned);
 
 	if (rc != 0) {
 		LOG_ERR("flash_write error %d offset=0x%08zx", rc,
@@ -163,30 +167,181 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 		/* Invert to ensure that caller is able to discover a faulty
 		 * flash_read() even if no error code is returned.
 		 */
-		for (int i = 0; i < ctx->buf_bytes; i++) {
-			ctx->buf[i] = ~ctx->buf[i];
+		for (int i = 0; i < buf_bytes; i++) {
+			buf[i] = ~buf[i];
 		}
 
-		rc = flash_read(ctx->fdev, write_addr, ctx->buf,
-				ctx->buf_bytes);
+		rc = flash_read(ctx->fdev, write_addr, buf, buf_bytes);
 		if (rc != 0) {
 			LOG_ERR("flash read failed: %d", rc);
 			return rc;
 		}
 
-		rc = ctx->callback(ctx->buf, ctx->buf_bytes, write_addr);
+		rc = ctx->callback(buf, buf_bytes, write_addr);
 		if (rc != 0) {
 			LOG_ERR("callback failed: %d", rc);
 			return rc;
 		}
 	}
 
-	ctx->bytes_written += ctx->buf_bytes;
+	return rc;
+}
+
+static int flash_sync(struct stream_flash_ctx *ctx)
+{
+	int rc = flash_sync_buf(ctx, ctx->buf, ctx->buf_bytes);
+
+	if (rc == 0) {
+		ctx->bytes_written += ctx->buf_bytes;
+		ctx->buf_bytes = 0U;
+	}
+
+	return rc;
+}
+
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+
+static K_THREAD_STACK_DEFINE(async_stack, CONFIG_STREAM_FLASH_ASYNC_STACK_SIZE);
+static struct k_work_q async_work_q;
+
+static void async_work_handler(struct k_work *work)
+{
+	struct stream_flash_ctx *ctx =
+		CONTAINER_OF(work, struct stream_flash_ctx, async_work);
+	size_t next = ctx->bytes_written + ctx->async_bytes;
+	int rc;
+
+	rc = flash_sync_buf(ctx, ctx->async_buf, ctx->async_bytes);
+
+#ifdef CONFIG_STREAM_FLASH_ERASE
+	/* Erase the page the next buffer starts in while it is being filled */
+	if ((rc == 0) && (next < ctx->available)) {
+		rc = stream_flash_erase_page(ctx, ctx->offset + next);
+	}
+#endif
+
+	ctx->async_rc = rc;
+	k_sem_give(&ctx->async_done);
+}
+
+/* Wait for the buffer being written, the caller then owns the context */
+static int async_collect(struct stream_flash_ctx *ctx)
+{
+	int rc;
+
+	k_sem_take(&ctx->async_done, K_FOREVER);
+
+	rc = ctx->async_rc;
+	if (rc == 0) {
+		ctx->bytes_written += ctx->async_bytes;
+	}
+	ctx->async_bytes = 0U;
+	ctx->async_rc = 0;
+
+	return rc;
+}
+
+/* Hand the full buffer over to the work queue and fill the other one */
+static int async_submit(struct stream_flash_ctx *ctx)
+{
+	uint8_t *buf = ctx->buf;
+	int rc = async_collect(ctx);
+
+	if (rc != 0) {
+		k_sem_give(&ctx->async_done);
+		return rc;
+	}
+
+	ctx->async_bytes = ctx->buf_bytes;
+	ctx->buf = ctx->async_buf;
+	ctx->async_buf = buf;
 	ctx->buf_bytes = 0U;
 
+	k_work_submit_to_queue(&async_work_q, &ctx->async_work);
+
+	return 0;
+}
+
+static int async_flush(struct stream_flash_ctx *ctx)
+{
+	int rc = async_collect(ctx);
+
+	if ((rc == 0) && (ctx->buf_bytes > 0)) {
+		rc = flash_sync(ctx);
+	}
+
+	k_sem_give(&ctx->async_done);
+
 	return rc;
 }
 
+int stream_flash_async_enable(struct stream_flash_ctx *ctx, uint8_t *buf,
+			      size_t buf_len)
+{
+	if (!ctx || !buf) {
+		return -EFAULT;
+	}
+
+	if (buf_len != ctx->buf_len || ctx->buf_bytes != 0) {
+		return -EINVAL;
+	}
+
+	ctx->async_buf = buf;
+	ctx->async_bytes = 0U;
+	ctx->async_rc = 0;
+	k_sem_init(&ctx->async_done, 1, 1);
+	k_work_init(&ctx->async_work, async_work_handler);
+
+	return 0;
+}
+
+static int stream_flash_async_init(void)
+{
+	k_work_queue_start(&async_work_q, async_stack,
+			   K_THREAD_STACK_SIZEOF(async_stack),
+			   CONFIG_STREAM_FLASH_ASYNC_THREAD_PRIORITY, NULL);
+	k_thread_name_set(&async_work_q.thread, "stream_flash");
+
+	return 0;
+}
+
+SYS_INIT(stream_flash_async_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+static inline bool async_enabled(struct stream_flash_ctx *ctx)
+{
+	return ctx->async_buf != NULL;
+}
+
+/* Bytes being written, they are added to bytes_written once collected */
+static inline size_t async_pending(struct stream_flash_ctx *ctx)
+{
+	return ctx->async_bytes;
+}
+
+#else
+
+static inline bool async_enabled(struct stream_flash_ctx *ctx)
+{
+	return false;
+}
+
+static inline size_t async_pending(struct stream_flash_ctx *ctx)
+{
+	return 0;
+}
+
+static inline int async_submit(struct stream_flash_ctx *ctx)
+{
+	return -ENOTSUP;
+}
+
+static inline int async_flush(struct stream_flash_ctx *ctx)
+{
+	return -ENOTSUP;
+}
+
+#endif /* CONFIG_STREAM_FLASH_ASYNC */
+
 int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *data,
 				size_t len, bool flush)
 {
@@ -198,7 +353,8 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		return -EFAULT;
 	}
 
-	if (ctx->bytes_written + ctx->buf_bytes + len > ctx->available) {
+	if (ctx->bytes_written + async_pending(ctx) + ctx->buf_bytes + len >
+	    ctx->available) {
 		return -ENOMEM;
 	}
 
@@ -208,7 +364,11 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		       buf_empty_bytes);
 
 		ctx->buf_bytes = ctx->buf_len;
-		rc = flash_sync(ctx);
+		if (async_enabled(ctx)) {
+			rc = async_submit(ctx);
+		} else {
+			rc = flash_sync(ctx);
+		}
 
 		if (rc != 0) {
 			return rc;
@@ -224,7 +384,9 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		ctx->buf_bytes += len - processed;
 	}
 
-	if (flush && ctx->buf_bytes > 0) {
+	if (flush && async_enabled(ctx)) {
+		rc = async_flush(ctx);
+	} else if (flush && ctx->buf_bytes > 0) {
 		rc = flash_sync(ctx);
 	}
 
@@ -315,6 +477,10 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 
 #ifdef CONFIG_STREAM_FLASH_ERASE
 	ctx->last_erased_page_start_offset = -1;
+#endif
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+	ctx->async_buf = NULL;
+	ctx->async_bytes = 0U;
 #endif
 	ctx->erase_value = params->erase_value;
 
@@ -31,18 +31,39 @@ struct task_wdt_channel {
 	uint32_t reload_period;
 	/* abs. ticks when this channel expires (updated by task_wdt_feed) */
 	int64_t timeout_abs_ticks;
+	/* timeout the channel is sorted by in the heap, which may be older
+	 * than timeout_abs_ticks if the channel was fed since
+	 */
+	int64_t heap_timeout;
+	/* index of the channel in the heap */
+	uint8_t heap_idx;
 	/* user data passed to the callback function */
 	void *user_data;
 	/* function to be called when watchdog timer expired */
 	task_wdt_callback_t callback;
 };
 
+BUILD_ASSERT(CONFIG_TASK_WDT_CHANNELS <= UINT8_MAX);
+
 /* array of all task watchdog channels */
 static struct task_wdt_channel channels[CONFIG_TASK_WDT_CHANNELS];
 static struct k_spinlock channels_lock;
 
+/*
+ * Min-heap of the IDs of the installed channels, sorted by heap_timeout.
+ *
+ * Feeding a channel only updates its timeout_abs_ticks, as a channel can
+ * only expire later when fed. The heap is brought up to date when the timer
+ * expires, so that the time spent in task_wdt_feed() does not depend on the
+ * number of channels, and the timer is not restarted on each feed.
+ */
+static uint8_t heap[CONFIG_TASK_WDT_CHANNELS];
+static uint8_t heap_len;
+
 /* timer used for watchdog handling */
 static struct k_timer timer;
+static bool timer_running;
+static int64_t timer_timeout;
 
 #ifdef CONFIG_TASK_WDT_HW_FALLBACK
 /* pointer to the hardware watchdog used as a fallback */
@@ -51,6 +72,92 @@ static int hw_wdt_channel;
 static bool hw_wdt_started;
 #endif
 
+static void heap_set(uint8_t idx, uint8_t id)
+{
+	heap[idx] = id;
+	channels[id].heap_idx = idx;
+}
+
+static void heap_sift_up(uint8_t idx)
+{
+	uint8_t id = heap[idx];
+
+	while (idx > 0) {
+		uint8_t parent = (idx - 1) / 2;
+
+		if (channels[heap[parent]].heap_timeout <= channels[id].heap_timeout) {
+			break;
+		}
+
+		heap_set(idx, heap[parent]);
+		idx = parent;
+	}
+
+	heap_set(idx, id);
+}
+
+static void heap_sift_down(uint8_t idx)
+{
+	uint8_t id = heap[idx];
+
+	while (2 * idx + 1 < heap_len) {
+		uint8_t child = 2 * idx + 1;
+
+		if (child + 1 < heap_len &&
+		    channels[heap[child + 1]].heap_timeout < channels[heap[child]].heap_timeout) {
+			child++;
+		}
+
+		if (channels[id].heap_timeout <= channels[heap[child]].heap_timeout) {
+			break;
+		}
+
+		heap_set(idx, heap[child]);
+		idx = child;
+	}
+
+	heap_set(idx, id);
+}
+
+static void heap_insert(uint8_t id)
+{
+	channels[id].heap_timeout = channels[id].timeout_abs_ticks;
+	heap_set(heap_len++, id);
+	heap_sift_up(heap_len - 1);
+}
+
+static void heap_remove(uint8_t id)
+{
+	uint8_t idx = channels[id].heap_idx;
+	uint8_t moved;
+
+	heap_len--;
+	if (idx == heap_len) {
+		return;
+	}
+
+	/* move the last channel to the freed slot */
+	moved = heap[heap_len];
+	heap_set(idx, moved);
+	heap_sift_up(idx);
+	heap_sift_down(channels[moved].heap_idx);
+}
+
+/* make sure the channel at the top of the heap is the one expiring next */
+static void heap_update(void)
+{
+	while (heap_len > 0) {
+		struct task_wdt_channel *channel = &channels[heap[0]];
+
+		if (channel->heap_timeout == channel->timeout_abs_ticks) {
+			break;
+		}
+
+		channel->heap_timeout = channel->timeout_abs_ticks;
+		heap_sift_down(0);
+	}
+}
+
 static void schedule_next_timeout(int64_t current_ticks)
 {
 	uintptr_t next_channel_id;	/* channel which will time out next */
@@ -65,18 +172,17 @@ static void schedule_next_timeout(int64_t current_ticks)
 	next_timeout = INT64_MAX;
 #endif
 
-	/* find minimum timeout of all channels */
-	for (int id = 0; id < ARRAY_SIZE(channels); id++) {
-		if (channels[id].reload_period != 0 &&
-		    channels[id].timeout_abs_ticks < next_timeout) {
-			next_channel_id = id;
-			next_timeout = channels[id].timeout_abs_ticks;
-		}
+	/* the channel which may time out first is at the top of the heap */
+	if (heap_len > 0 && channels[heap[0]].heap_timeout < next_timeout) {
+		next_channel_id = heap[0];
+		next_timeout = channels[heap[0]].heap_timeout;
 	}
 
 	/* update task wdt kernel timer */
 	k_timer_user_data_set(&timer, (void *)next_channel_id);
 	k_timer_start(&timer, K_TIMEOUT_ABS_TICKS(next_timeout), K_FOREVER);
+	timer_running = true;
+	timer_timeout = next_timeout;
 
 #ifdef CONFIG_TASK_WDT_HW_FALLBACK
 	if (hw_wdt_started) {
@@ -88,9 +194,9 @@ static void schedule_next_timeout(int64_t current_ticks)
 /**
  * @brief Task watchdog timer callback.
  *
- * If the device operates as intended, this function will never be called,
- * as the timer is continuously restarted with the next due timeout in the
- * task_wdt_feed() function.
+ * The timer expires when the channel at the top of the heap may time out.
+ * If that channel was fed since it was sorted, the heap is updated and the
+ * timer restarted with the next due timeout.
  *
  * If all task watchdogs have longer timeouts than the hardware watchdog,
  * this function is called regularly (via the background channel). This
@@ -104,17 +210,32 @@ static void task_wdt_trigger(struct k_timer *timer_id)
 	uintptr_t channel_id = (uintptr_t)k_timer_user_data_get(timer_id);
 	bool bg_channel = IS_ENABLED(CONFIG_TASK_WDT_HW_FALLBACK) &&
 			  (channel_id == TASK_WDT_BACKGROUND_CHANNEL);
+	int64_t current_ticks;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&channels_lock);
+
+	current_ticks = sys_clock_tick_get();
+	heap_update();
 
 	/* If the timeout expired for the background channel (so the hardware
-	 * watchdog needs to be fed) or for a channel that has been deleted,
-	 * only schedule a new timeout (the hardware watchdog, if used, will be
-	 * fed right after that new timeout is scheduled).
+	 * watchdog needs to be fed), for a channel that has been deleted or
+	 * for a channel that has been fed since, only schedule a new timeout
+	 * (the hardware watchdog, if used, will be fed right after that new
+	 * timeout is scheduled).
 	 */
-	if (bg_channel || channels[channel_id].reload_period == 0) {
-		schedule_next_timeout(sys_clock_tick_get());
+	if (bg_channel || channels[channel_id].reload_period == 0 ||
+	    channels[channel_id].timeout_abs_ticks > current_ticks) {
+		schedule_next_timeout(current_ticks);
+		k_spin_unlock(&channels_lock, key);
 		return;
 	}
 
+	/* the next feed of any channel restarts the timer */
+	timer_running = false;
+
+	k_spin_unlock(&channels_lock, key);
+
 	if (channels[channel_id].callback) {
 		channels[channel_id].callback(channel_id,
 			channels[channel_id].user_data);
@@ -125,6 +246,8 @@ static void task_wdt_trigger(struct k_timer *timer_id)
 
 int task_wdt_init(const struct device *hw_wdt)
 {
+	k_spinlock_key_t key;
+
 	if (hw_wdt) {
 #ifdef CONFIG_TASK_WDT_HW_FALLBACK
 		struct wdt_timeout_cfg wdt_config;
@@ -147,7 +270,10 @@ int task_wdt_init(const struct device *hw_wdt)
 	}
 
 	k_timer_init(&timer, task_wdt_trigger, NULL);
+
+	key = k_spin_lock(&channels_lock);
 	schedule_next_timeout(sys_clock_tick_get());
+	k_spin_unlock(&channels_lock, key);
 
 	return 0;
 }
@@ -172,8 +298,10 @@ int task_wdt_add(uint32_t reload_period, task_wdt_callback_t callback,
 		if (channels[id].reload_period == 0) {
 			channels[id].reload_period = reload_period;
 			channels[id].user_data = user_data;
-			channels[id].timeout_abs_ticks = K_TICKS_FOREVER;
+			channels[id].timeout_abs_ticks = sys_clock_tick_get() +
+				k_ms_to_ticks_ceil64(reload_period);
 			channels[id].callback = callback;
+			heap_insert(id);
 
 #ifdef CONFIG_TASK_WDT_HW_FALLBACK
 			if (!hw_wdt_started && hw_wdt_dev) {
@@ -183,8 +311,11 @@ int task_wdt_add(uint32_t reload_period, task_wdt_callback_t callback,
 				hw_wdt_started = true;
 			}
 #endif
-			/* must be called after hw wdt has been started */
-			task_wdt_feed(id);
+			/* must be done after hw wdt has been started */
+			if (!timer_running ||
+			    channels[id].timeout_abs_ticks < timer_timeout) {
+				schedule_next_timeout(sys_clock_tick_get());
+			}
 
 			k_spin_unlock(&channels_lock, key);
 
@@ -207,7 +338,10 @@ int task_wdt_delete(int channel_id)
 
 	key = k_spin_lock(&channels_lock);
 
-	channels[channel_id].reload_period = 0;
+	if (channels[channel_id].reload_period != 0) {
+		channels[channel_id].reload_period = 0;
+		heap_remove(channel_id);
+	}
 
 	k_spin_unlock(&channels_lock, key);
 
@@ -217,28 +351,37 @@ int task_wdt_delete(int channel_id)
 int task_wdt_feed(int channel_id)
 {
 	int64_t current_ticks;
+	k_spinlock_key_t key;
 
 	if (channel_id < 0 || channel_id >= ARRAY_SIZE(channels)) {
 		return -EINVAL;
 	}
 
 	/*
-	 * We need a critical section instead of a mutex while updating the
-	 * channels array in order to prevent priority inversion. Otherwise,
-	 * a low priority thread could be preempted before releasing the mutex
-	 * and block a high priority thread that wants to feed its task wdt.
+	 * A spinlock instead of a mutex is used while updating a channel in
+	 * order to prevent priority inversion. Otherwise, a low priority
+	 * thread could be preempted before releasing the mutex and block a
+	 * high priority thread that wants to feed its task wdt. The section
+	 * is kept short, as the heap and the timer are only updated when the
+	 * timer expires.
 	 */
-	k_sched_lock();
+	key = k_spin_lock(&channels_lock);
 
-	current_ticks = sys_clock_tick_get();
+	if (channels[channel_id].reload_period != 0) {
+		current_ticks = sys_clock_tick_get();
 
-	/* feed the specified channel */
-	channels[channel_id].timeout_abs_ticks = current_ticks +
-		k_ms_to_ticks_ceil64(channels[channel_id].reload_period);
+		/* feed the specified channel */
+		channels[channel_id].timeout_abs_ticks = current_ticks +
+			k_ms_to_ticks_ceil64(channels[channel_id].reload_period);
 
-	schedule_next_timeout(current_ticks);
+		/* restart the timer if it was stopped by an expired channel */
+		if (!timer_running) {
+			heap_update();
+			schedule_next_timeout(current_ticks);
+		}
+	}
 
-	k_sched_unlock();
+	k_spin_unlock(&channels_lock, key);
 
 	return 0;
 }
@@ -49,10 +49,22 @@
 		tracing_format_raw_data(epacket, sizeof(epacket));              \
 	}
 
+/*
+ * The timestamp field is the low 32 bits of the uptime in nanoseconds, which
+ * trace readers extend across wrap arounds. Converting a 32-bit cycle count
+ * would instead wrap at an arbitrary value, so use the 64-bit counter when
+ * the timer has one.
+ */
+#ifdef CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER
+#define CTF_TIMESTAMP() ((uint32_t)k_cyc_to_ns_floor64(k_cycle_get_64()))
+#else
+#define CTF_TIMESTAMP() ((uint32_t)k_cyc_to_ns_floor64(k_cycle_get_32()))
+#endif
+
 #ifdef CONFIG_TRACING_CTF_TIMESTAMP
 #define CTF_EVENT(...)                                                         \
 	{                                                                      \
-		const uint32_t tstamp = k_cyc_to_ns_floor64(k_cycle_get_32()); \
+		const uint32_t tstamp = CTF_TIMESTAMP();                       \
 									       \
 		CTF_GATHER_FIELDS(tstamp, __VA_ARGS__)                         \
 	}
@@ -22,6 +22,10 @@ void tracing_buffer_init(void);
 /**
  * @brief Tracing buffer is empty or not.
  *
+ * With CONFIG_TRACING_PER_CPU_BUFFERS the buffers of all CPUs are checked.
+ * Data is put to the buffer of the current CPU, and read from each buffer
+ * in turn.
+ *
  * @return true if the ring buffer is empty, or false if not.
  */
 bool tracing_buffer_is_empty(void);
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Disable syscall tracing for all calls from this compilation unit to avoid
+ * undefined symbols as the macros are not expanded recursively
+ */
+#define DISABLE_SYSCALL_TRACING
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/socket.h>
+#include <tracing_core.h>
+#include <tracing_buffer.h>
+#include <tracing_backend.h>
+
+static struct sockaddr server_addr;
+static bool server_addr_valid;
+static int sock = -1;
+
+static int tracing_backend_udp_connect(void)
+{
+	socklen_t addr_len = server_addr.sa_family == AF_INET6 ?
+			     sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in);
+	int ret;
+
+	ret = zsock_socket(server_addr.sa_family, SOCK_DGRAM, IPPROTO_UDP);
+	if (ret < 0) {
+		return -errno;
+	}
+
+	sock = ret;
+
+	ret = zsock_connect(sock, &server_addr, addr_len);
+	if (ret < 0) {
+		ret = -errno;
+		(void)zsock_close(sock);
+		sock = -1;
+		return ret;
+	}
+
+	return 0;
+}
+
+static void tracing_backend_udp_output(
+		const struct tracing_backend *backend,
+		uint8_t *data, uint32_t length)
+{
+	ARG_UNUSED(backend);
+
+	if (!server_addr_valid) {
+		return;
+	}
+
+	/* The network may not be up when tracing starts, the socket is
+	 * opened by the first output and again after an error. Data that
+	 * cannot be sent is dropped.
+	 */
+	if ((sock < 0) && (tracing_backend_udp_connect() < 0)) {
+		tracing_packet_drop_handle();
+		return;
+	}
+
+	while (length > 0) {
+		uint32_t len = MIN(length, CONFIG_TRACING_BACKEND_UDP_MTU);
+		ssize_t ret = zsock_send(sock, data, len, 0);
+
+		if (ret < 0) {
+			(void)zsock_close(sock);
+			sock = -1;
+			tracing_packet_drop_handle();
+			return;
+		}
+
+		data += len;
+		length -= len;
+	}
+}
+
+static void tracing_backend_udp_init(void)
+{
+	const char *addr = CONFIG_TRACING_BACKEND_UDP_SERVER_ADDR;
+
+	server_addr_valid = net_ipaddr_parse(addr, strlen(addr), &server_addr);
+	if (!server_addr_valid) {
+		return;
+	}
+
+	if (server_addr.sa_family == AF_INET6) {
+		net_sin6(&server_addr)->sin6_port =
+			htons(CONFIG_TRACING_BACKEND_UDP_SERVER_PORT);
+	} else {
+		net_sin(&server_addr)->sin_port =
+			htons(CONFIG_TRACING_BACKEND_UDP_SERVER_PORT);
+	}
+}
+
+const struct tracing_backend_api tracing_backend_udp_api = {
+	.init = tracing_backend_udp_init,
+	.output  = tracing_backend_udp_output
+};
+
+TRACING_BACKEND_DEFINE(tracing_backend_udp, tracing_backend_udp_api);
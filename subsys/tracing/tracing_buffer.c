@@ -4,12 +4,57 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <zephyr/kernel.h>
 #include <zephyr/sys/ring_buffer.h>
 
-static struct ring_buf tracing_ring_buf;
-static uint8_t tracing_buffer[CONFIG_TRACING_BUFFER_SIZE + 1];
+#ifdef CONFIG_TRACING_PER_CPU_BUFFERS
+#define TRACING_BUFFERS CONFIG_MP_MAX_NUM_CPUS
+#else
+#define TRACING_BUFFERS 1
+#endif
+
+static struct ring_buf tracing_ring_buf[TRACING_BUFFERS];
+static uint8_t tracing_buffer[TRACING_BUFFERS][CONFIG_TRACING_BUFFER_SIZE + 1];
 static uint8_t tracing_cmd_buffer[CONFIG_TRACING_CMD_BUFFER_SIZE];
 
+#ifdef CONFIG_TRACING_PER_CPU_BUFFERS
+/* Buffer being read by the tracing thread */
+static unsigned int get_idx;
+#endif
+
+/* Packets are put with interrupts locked, so the current CPU cannot change
+ * and is the only writer of its buffer.
+ */
+static inline struct ring_buf *put_buf(void)
+{
+#ifdef CONFIG_TRACING_PER_CPU_BUFFERS
+	return &tracing_ring_buf[arch_curr_cpu()->id];
+#else
+	return &tracing_ring_buf[0];
+#endif
+}
+
+/* The tracing thread is the only reader. It keeps reading a buffer until it
+ * is empty and then moves to the next one, so that a busy CPU cannot starve
+ * the others.
+ */
+static inline struct ring_buf *get_buf(void)
+{
+#ifdef CONFIG_TRACING_PER_CPU_BUFFERS
+	for (int i = 0; i < TRACING_BUFFERS; i++) {
+		if (!ring_buf_is_empty(&tracing_ring_buf[get_idx])) {
+			break;
+		}
+
+		get_idx = (get_idx + 1) % TRACING_BUFFERS;
+	}
+
+	return &tracing_ring_buf[get_idx];
+#else
+	return &tracing_ring_buf[0];
+#endif
+}
+
 uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
 {
 	*data = &tracing_cmd_buffer[0];
@@ -19,51 +64,63 @@ uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
 
 uint32_t tracing_buffer_put_claim(uint8_t **data, uint32_t size)
 {
-	return ring_buf_put_claim(&tracing_ring_buf, data, size);
+	return ring_buf_put_claim(put_buf(), data, size);
 }
 
 int tracing_buffer_put_finish(uint32_t size)
 {
-	return ring_buf_put_finish(&tracing_ring_buf, size);
+	return ring_buf_put_finish(put_buf(), size);
 }
 
 uint32_t tracing_buffer_put(uint8_t *data, uint32_t size)
 {
-	return ring_buf_put(&tracing_ring_buf, data, size);
+	return ring_buf_put(put_buf(), data, size);
 }
 
 uint32_t tracing_buffer_get_claim(uint8_t **data, uint32_t size)
 {
-	return ring_buf_get_claim(&tracing_ring_buf, data, size);
+	return ring_buf_get_claim(get_buf(), data, size);
 }
 
 int tracing_buffer_get_finish(uint32_t size)
 {
-	return ring_buf_get_finish(&tracing_ring_buf, size);
+#ifdef CONFIG_TRACING_PER_CPU_BUFFERS
+	return ring_buf_get_finish(&tracing_ring_buf[get_idx], size);
+#else
+	return ring_buf_get_finish(&tracing_ring_buf[0], size);
+#endif
 }
 
 uint32_t tracing_buffer_get(uint8_t *data, uint32_t size)
 {
-	return ring_buf_get(&tracing_ring_buf, data, size);
+	return ring_buf_get(get_buf(), data, size);
 }
 
 void tracing_buffer_init(void)
 {
-	ring_buf_init(&tracing_ring_buf,
-		      sizeof(tracing_buffer), tracing_buffer);
+	for (int i = 0; i < TRACING_BUFFERS; i++) {
+		ring_buf_init(&tracing_ring_buf[i],
+			      sizeof(tracing_buffer[i]), tracing_buffer[i]);
+	}
 }
 
 bool tracing_buffer_is_empty(void)
 {
-	return ring_buf_is_empty(&tracing_ring_buf);
+	for (int i = 0; i < TRACING_BUFFERS; i++) {
+		if (!ring_buf_is_empty(&tracing_ring_buf[i])) {
+			return false;
+		}
+	}
+
+	return true;
 }
 
 uint32_t tracing_buffer_capacity_get(void)
 {
-	return ring_buf_capacity_get(&tracing_ring_buf);
+	return ring_buf_capacity_get(&tracing_ring_buf[0]);
 }
 
 uint32_t tracing_buffer_space_get(void)
 {
-	return ring_buf_space_get(&tracing_ring_buf);
+	return ring_buf_space_get(put_buf());
 }
@@ -27,6 +27,8 @@
 #define TRACING_BACKEND_NAME "tracing_backend_usb"
 #elif defined CONFIG_TRACING_BACKEND_POSIX
 #define TRACING_BACKEND_NAME "tracing_backend_posix"
+#elif defined CONFIG_TRACING_BACKEND_UDP
+#define TRACING_BACKEND_NAME "tracing_backend_udp"
 #elif defined CONFIG_TRACING_BACKEND_RAM
 #define TRACING_BACKEND_NAME "tracing_backend_ram"
 #elif defined CONFIG_TRACING_BACKEND_ADSP_MEMORY_WINDOW
@@ -15,6 +15,7 @@
 #include <zephyr/usb/usbd.h>
 #include <zephyr/usb/usb_ch9.h>
 #include <zephyr/usb/class/usb_cdc.h>
+#include <zephyr/usb/class/usbd_cdc_acm.h>
 
 #include <zephyr/drivers/usb/udc.h>
 
@@ -36,6 +37,13 @@ NET_BUF_POOL_FIXED_DEFINE(cdc_acm_ep_pool,
 			  DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * 2,
 			  512, sizeof(struct udc_buf_info), NULL);
 
+#if CONFIG_USBD_CDC_ACM_TX_TRANSFERS > 1
+/* Bulk IN transfers referencing the TX FIFO data, without data of their own */
+NET_BUF_POOL_DEFINE(cdc_acm_tx_pool,
+		    DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * CONFIG_USBD_CDC_ACM_TX_TRANSFERS,
+		    0, sizeof(struct udc_buf_info), NULL);
+#endif
+
 #define CDC_ACM_DEFAULT_LINECODING	{sys_cpu_to_le32(115200), 0, 0, 8}
 #define CDC_ACM_DEFAULT_INT_EP_MPS	16
 #define CDC_ACM_INTERVAL_DEFAULT	10000UL
@@ -109,6 +117,14 @@ struct cdc_acm_uart_data {
 	struct k_work tx_fifo_work;
 	/* USBD CDC ACM RX fifo work */
 	struct k_work rx_fifo_work;
+#if CONFIG_USBD_CDC_ACM_TX_TRANSFERS > 1
+	/* Number of bulk IN transfers queued */
+	atomic_t tx_queued;
+	/* Number of bytes of the completed bulk IN transfers */
+	atomic_t tx_done;
+	/* Number of TX FIFO bytes claimed by the queued transfers */
+	uint32_t tx_claimed;
+#endif
 	atomic_t state;
 	struct k_sem notif_sem;
 };
@@ -217,6 +233,15 @@ static int usbd_cdc_acm_request(struct usbd_class_data *const c_data,
 			atomic_clear_bit(&data->state, CDC_ACM_RX_FIFO_BUSY);
 		}
 
+#if CONFIG_USBD_CDC_ACM_TX_TRANSFERS > 1
+		if (bi->ep == cdc_acm_get_bulk_in(c_data)) {
+			/* Data of the transfer is discarded from the TX FIFO */
+			atomic_add(&data->tx_done, buf->len);
+			atomic_dec(&data->tx_queued);
+			cdc_acm_work_submit(&data->tx_fifo_work);
+		}
+#endif
+
 		goto ep_request_error;
 	}
 
@@ -236,6 +261,11 @@ static int usbd_cdc_acm_request(struct usbd_class_data *const c_data,
 
 	if (bi->ep == cdc_acm_get_bulk_in(c_data)) {
 		/* TX transfer completion */
+#if CONFIG_USBD_CDC_ACM_TX_TRANSFERS > 1
+		atomic_add(&data->tx_done, buf->len);
+		atomic_dec(&data->tx_queued);
+		cdc_acm_work_submit(&data->tx_fifo_work);
+#endif
 		if (data->cb) {
 			cdc_acm_work_submit(&data->irq_cb_work);
 		}
@@ -511,6 +541,98 @@ static int cdc_acm_send_notification(const struct device *dev,
 	return ret;
 }
 
+#if CONFIG_USBD_CDC_ACM_TX_TRANSFERS > 1
+/*
+ * Finishing a claim of the ring buffer releases all the other claims, claim
+ * again the data of the transfers still queued.
+ */
+static void cdc_acm_tx_fifo_finish(struct cdc_acm_uart_data *const data,
+				   const uint32_t done)
+{
+	uint32_t size;
+	uint32_t len;
+	uint8_t *ptr;
+	int err;
+
+	err = ring_buf_get_finish(data->tx_fifo.rb, done);
+	__ASSERT_NO_MSG(err == 0);
+	ARG_UNUSED(err);
+
+	data->tx_claimed -= done;
+
+	for (size = data->tx_claimed; size > 0; size -= len) {
+		len = ring_buf_get_claim(data->tx_fifo.rb, &ptr, size);
+		__ASSERT_NO_MSG(len > 0);
+	}
+}
+
+/*
+ * TX handler is triggered when the state of TX fifo has been altered.
+ */
+static void cdc_acm_tx_fifo_handler(struct k_work *work)
+{
+	struct cdc_acm_uart_data *data;
+	struct usbd_class_data *c_data;
+	struct net_buf *buf;
+	struct udc_buf_info *bi;
+	uint32_t len;
+	uint8_t *ptr;
+	int ret;
+
+	data = CONTAINER_OF(work, struct cdc_acm_uart_data, tx_fifo_work);
+	c_data = data->c_data;
+
+	if (!atomic_test_bit(&data->state, CDC_ACM_CLASS_ENABLED)) {
+		LOG_DBG("USB configuration is not enabled");
+		return;
+	}
+
+	if (atomic_test_bit(&data->state, CDC_ACM_CLASS_SUSPENDED)) {
+		LOG_INF("USB support is suspended (FIXME: submit rwup)");
+		return;
+	}
+
+	if (atomic_test_and_set_bit(&data->state, CDC_ACM_LOCK)) {
+		cdc_acm_work_submit(&data->tx_fifo_work);
+		return;
+	}
+
+	cdc_acm_tx_fifo_finish(data, atomic_clear(&data->tx_done));
+
+	/* Keep the bulk IN endpoint busy, each transfer sending FIFO data in place */
+	while (atomic_get(&data->tx_queued) < CONFIG_USBD_CDC_ACM_TX_TRANSFERS) {
+		len = ring_buf_get_claim(data->tx_fifo.rb, &ptr, UINT16_MAX);
+		if (len == 0) {
+			break;
+		}
+
+		buf = net_buf_alloc_with_data(&cdc_acm_tx_pool, ptr, len, K_NO_WAIT);
+		if (buf == NULL) {
+			cdc_acm_tx_fifo_finish(data, 0);
+			break;
+		}
+
+		bi = udc_get_buf_info(buf);
+		memset(bi, 0, sizeof(struct udc_buf_info));
+		bi->ep = cdc_acm_get_bulk_in(c_data);
+
+		data->tx_claimed += len;
+		atomic_inc(&data->tx_queued);
+
+		ret = usbd_ep_enqueue(c_data, buf);
+		if (ret) {
+			LOG_ERR("Failed to enqueue");
+			net_buf_unref(buf);
+			atomic_dec(&data->tx_queued);
+			data->tx_claimed -= len;
+			cdc_acm_tx_fifo_finish(data, 0);
+			break;
+		}
+	}
+
+	atomic_clear_bit(&data->state, CDC_ACM_LOCK);
+}
+#else
 /*
  * TX handler is triggered when the state of TX fifo has been altered.
  */
@@ -558,6 +680,7 @@ static void cdc_acm_tx_fifo_handler(struct k_work *work)
 tx_fifo_handler_exit:
 	atomic_clear_bit(&data->state, CDC_ACM_LOCK);
 }
+#endif
 
 /*
  * RX handler should be conditionally triggered at:
@@ -894,6 +1017,12 @@ static void cdc_acm_poll_out(const struct device *dev, const unsigned char c)
 		goto poll_out_exit;
 	}
 
+#if CONFIG_USBD_CDC_ACM_TX_TRANSFERS > 1
+	/* The oldest data may be referenced by queued transfers */
+	LOG_DBG("Ring buffer full, drop character");
+	goto poll_out_exit;
+#endif
+
 	LOG_DBG("Ring buffer full, drain buffer");
 	if (!ring_buf_get(data->tx_fifo.rb, NULL, 1) ||
 	    !ring_buf_put(data->tx_fifo.rb, &c, 1)) {
@@ -1002,6 +1131,26 @@ static int cdc_acm_config_get(const struct device *dev,
 }
 #endif /* CONFIG_UART_USE_RUNTIME_CONFIGURE */
 
+uint32_t usbd_cdc_acm_tx_claim(const struct device *dev, uint8_t **data, uint32_t size)
+{
+	struct cdc_acm_uart_data *const dev_data = dev->data;
+
+	return ring_buf_put_claim(dev_data->tx_fifo.rb, data, size);
+}
+
+int usbd_cdc_acm_tx_commit(const struct device *dev, uint32_t size)
+{
+	struct cdc_acm_uart_data *const data = dev->data;
+	int ret;
+
+	ret = ring_buf_put_finish(data->tx_fifo.rb, size);
+	if (ret == 0 && size > 0) {
+		cdc_acm_work_submit(&data->tx_fifo_work);
+	}
+
+	return ret;
+}
+
 static int usbd_cdc_acm_init_wq(void)
 {
 	k_work_queue_init(&cdc_acm_work_q);
@@ -0,0 +1,1134 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT zephyr_cdc_ncm_ethernet
+
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/ethernet.h>
+
+#include <eth.h>
+
+#include <zephyr/usb/usbd.h>
+#include <zephyr/usb/usb_ch9.h>
+#include <zephyr/usb/class/usb_cdc.h>
+#include <zephyr/drivers/usb/udc.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(cdc_ncm, CONFIG_USBD_CDC_NCM_LOG_LEVEL);
+
+#define CDC_NCM_EP_MPS_INT		16
+#define CDC_NCM_FS_INT_EP_INTERVAL	USB_FS_INT_EP_INTERVAL(10000U)
+#define CDC_NCM_HS_INT_EP_INTERVAL	USB_HS_INT_EP_INTERVAL(10000U)
+
+/* Minimum NTB IN size the host may select, NCM10.pdf, 6.2.7 */
+#define CDC_NCM_NTB_MIN_IN_SIZE		2048U
+#define CDC_NCM_NTB_IN_SIZE		CONFIG_USBD_CDC_NCM_NTB_IN_SIZE
+#define CDC_NCM_NTB_OUT_SIZE		CONFIG_USBD_CDC_NCM_NTB_OUT_SIZE
+#define CDC_NCM_MAX_DATAGRAMS		CONFIG_USBD_CDC_NCM_MAX_DATAGRAMS_PER_NTB
+
+/* Datagrams start at multiples of the divisor in both directions */
+#define CDC_NCM_NDP_DIVISOR		4U
+#define CDC_NCM_NDP_ALIGNMENT		4U
+
+/*
+ * The NDP of an NTB IN is placed right after the NTH, with room for the
+ * maximum number of datagram pointers and the terminating null entry. The
+ * datagrams follow it.
+ */
+#define CDC_NCM_NDP_IN_OFFSET		sizeof(struct cdc_ncm_nth16)
+#define CDC_NCM_NDP_IN_SIZE(n)		(sizeof(struct cdc_ncm_ndp16) +		\
+					 ((n) + 1) * sizeof(struct cdc_ncm_dpe16))
+#define CDC_NCM_DGRAM_IN_OFFSET		ROUND_UP(CDC_NCM_NDP_IN_OFFSET +	\
+						 CDC_NCM_NDP_IN_SIZE(CDC_NCM_MAX_DATAGRAMS), \
+						 CDC_NCM_NDP_DIVISOR)
+
+BUILD_ASSERT(CDC_NCM_NTB_IN_SIZE >= CDC_NCM_DGRAM_IN_OFFSET + NET_ETH_MAX_FRAME_SIZE,
+	     "NTB IN size too small for one Ethernet frame");
+
+enum {
+	CDC_NCM_IFACE_UP,
+	CDC_NCM_CLASS_ENABLED,
+	CDC_NCM_CLASS_SUSPENDED,
+	CDC_NCM_OUT_ENGAGED,
+	CDC_NCM_IN_ENGAGED,
+};
+
+/*
+ * One NTB OUT transfer per instance. Datagrams sent while an NTB IN is in
+ * flight are aggregated in the second NTB IN buffer of the instance.
+ */
+NET_BUF_POOL_FIXED_DEFINE(cdc_ncm_out_pool,
+			  DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT),
+			  CDC_NCM_NTB_OUT_SIZE,
+			  sizeof(struct udc_buf_info), NULL);
+
+NET_BUF_POOL_FIXED_DEFINE(cdc_ncm_in_pool,
+			  DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * 2,
+			  CDC_NCM_NTB_IN_SIZE,
+			  sizeof(struct udc_buf_info), NULL);
+
+struct cdc_ncm_notification {
+	union {
+		uint8_t bmRequestType;
+		struct usb_req_type_field RequestType;
+	};
+	uint8_t bNotificationType;
+	uint16_t wValue;
+	uint16_t wIndex;
+	uint16_t wLength;
+} __packed;
+
+/*
+ * Collection of descriptors used to assemble specific function descriptors.
+ * This structure is used by CDC NCM implementation to update and fetch
+ * properties at runtime. We currently support full and high speed.
+ */
+struct usbd_cdc_ncm_desc {
+	struct usb_association_descriptor iad;
+
+	struct usb_if_descriptor if0;
+	struct cdc_header_descriptor if0_header;
+	struct cdc_union_descriptor if0_union;
+	struct cdc_ecm_descriptor if0_ecm;
+	struct cdc_ncm_descriptor if0_ncm;
+	struct usb_ep_descriptor if0_int_ep;
+	struct usb_ep_descriptor if0_hs_int_ep;
+
+	struct usb_if_descriptor if1_0;
+
+	struct usb_if_descriptor if1_1;
+	struct usb_ep_descriptor if1_1_in_ep;
+	struct usb_ep_descriptor if1_1_out_ep;
+	struct usb_ep_descriptor if1_1_hs_in_ep;
+	struct usb_ep_descriptor if1_1_hs_out_ep;
+
+	struct usb_desc_header nil_desc;
+};
+
+struct cdc_ncm_eth_data {
+	struct usbd_class_data *c_data;
+	struct usbd_desc_node *const mac_desc_data;
+	struct usbd_cdc_ncm_desc *const desc;
+	const struct usb_desc_header **const fs_desc;
+	const struct usb_desc_header **const hs_desc;
+
+	struct net_if *iface;
+	uint8_t mac_addr[6];
+
+	/* NTB IN being filled, sent once the previous one is done */
+	struct net_buf *tx_ntb;
+	uint16_t tx_count;
+	uint16_t tx_seq;
+	/* NTB IN size selected by the host */
+	uint32_t ntb_in_size;
+	struct k_mutex tx_lock;
+	struct k_condvar tx_done;
+
+	struct k_sem notif_sem;
+	atomic_t state;
+};
+
+static const struct cdc_ncm_ntb_parameters cdc_ncm_ntb_params = {
+	.wLength = sys_cpu_to_le16(sizeof(struct cdc_ncm_ntb_parameters)),
+	.bmNtbFormatsSupported = sys_cpu_to_le16(NCM_NTB_FORMAT_16),
+	.dwNtbInMaxSize = sys_cpu_to_le32(CDC_NCM_NTB_IN_SIZE),
+	.wNdpInDivisor = sys_cpu_to_le16(CDC_NCM_NDP_DIVISOR),
+	.wNdpInPayloadRemainder = sys_cpu_to_le16(0),
+	.wNdpInAlignment = sys_cpu_to_le16(CDC_NCM_NDP_ALIGNMENT),
+	.dwNtbOutMaxSize = sys_cpu_to_le32(CDC_NCM_NTB_OUT_SIZE),
+	.wNdpOutDivisor = sys_cpu_to_le16(CDC_NCM_NDP_DIVISOR),
+	.wNdpOutPayloadRemainder = sys_cpu_to_le16(0),
+	.wNdpOutAlignment = sys_cpu_to_le16(CDC_NCM_NDP_ALIGNMENT),
+	.wNtbOutMaxDatagrams = sys_cpu_to_le16(0),
+};
+
+static uint8_t cdc_ncm_get_ctrl_if(struct cdc_ncm_eth_data *const data)
+{
+	struct usbd_cdc_ncm_desc *desc = data->desc;
+
+	return desc->if0.bInterfaceNumber;
+}
+
+static uint8_t cdc_ncm_get_int_in(struct usbd_class_data *const c_data)
+{
+	struct usbd_context *uds_ctx = usbd_class_get_ctx(c_data);
+	const struct device *dev = usbd_class_get_private(c_data);
+	struct cdc_ncm_eth_data *data = dev->data;
+	struct usbd_cdc_ncm_desc *desc = data->desc;
+
+	if (usbd_bus_speed(uds_ctx) == USBD_SPEED_HS) {
+		return desc->if0_hs_int_ep.bEndpointAddress;
+	}
+
+	return desc->if0_int_ep.bEndpointAddress;
+}
+
+static uint8_t cdc_ncm_get_bulk_in(struct usbd_class_data *const c_data)
+{
+	struct usbd_context *uds_ctx = usbd_class_get_ctx(c_data);
+	const struct device *dev = usbd_class_get_private(c_data);
+	struct cdc_ncm_eth_data *data = dev->data;
+	struct usbd_cdc_ncm_desc *desc = data->desc;
+
+	if (usbd_bus_speed(uds_ctx) == USBD_SPEED_HS) {
+		return desc->if1_1_hs_in_ep.bEndpointAddress;
+	}
+
+	return desc->if1_1_in_ep.bEndpointAddress;
+}
+
+static uint16_t cdc_ncm_get_bulk_in_mps(struct usbd_class_data *const c_data)
+{
+	struct usbd_context *uds_ctx = usbd_class_get_ctx(c_data);
+
+	if (usbd_bus_speed(uds_ctx) == USBD_SPEED_HS) {
+		return 512U;
+	}
+
+	return 64U;
+}
+
+static uint8_t cdc_ncm_get_bulk_out(struct usbd_class_data *const c_data)
+{
+	struct usbd_context *uds_ctx = usbd_class_get_ctx(c_data);
+	const struct device *dev = usbd_class_get_private(c_data);
+	struct cdc_ncm_eth_data *data = dev->data;
+	struct usbd_cdc_ncm_desc *desc = data->desc;
+
+	if (usbd_bus_speed(uds_ctx) == USBD_SPEED_HS) {
+		return desc->if1_1_hs_out_ep.bEndpointAddress;
+	}
+
+	return desc->if1_1_out_ep.bEndpointAddress;
+}
+
+static struct net_buf *cdc_ncm_buf_alloc(struct net_buf_pool *const pool,
+					 const uint8_t ep)
+{
+	struct net_buf *buf = NULL;
+	struct udc_buf_info *bi;
+
+	buf = net_buf_alloc(pool, K_NO_WAIT);
+	if (!buf) {
+		return NULL;
+	}
+
+	bi = udc_get_buf_info(buf);
+	memset(bi, 0, sizeof(struct udc_buf_info));
+	bi->ep = ep;
+
+	return buf;
+}
+
+static int cdc_ncm_out_start(struct usbd_class_data *const c_data)
+{
+	const struct device *dev = usbd_class_get_private(c_data);
+	struct cdc_ncm_eth_data *data = dev->data;
+	struct net_buf *buf;
+	uint8_t ep;
+	int ret;
+
+	if (!atomic_test_bit(&data->state, CDC_NCM_CLASS_ENABLED)) {
+		return -EACCES;
+	}
+
+	if (atomic_test_and_set_bit(&data->state, CDC_NCM_OUT_ENGAGED)) {
+		return -EBUSY;
+	}
+
+	ep = cdc_ncm_get_bulk_out(c_data);
+	buf = cdc_ncm_buf_alloc(&cdc_ncm_out_pool, ep);
+	if (buf == NULL) {
+		atomic_clear_bit(&data->state, CDC_NCM_OUT_ENGAGED);
+		return -ENOMEM;
+	}
+
+	ret = usbd_ep_enqueue(c_data, buf);
+	if (ret) {
+		LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
+		net_buf_unref(buf);
+		atomic_clear_bit(&data->state, CDC_NCM_OUT_ENGAGED);
+	}
+
+	return  ret;
+}
+
+/* Parse a received NTB16 and pass all its datagrams up in one batch */
+static void cdc_ncm_ntb_parse(struct cdc_ncm_eth_data *const data,
+			      const struct net_buf *const buf)
+{
+	const struct cdc_ncm_nth16 *nth = (const void *)buf->data;
+	sys_slist_t pkts;
+	size_t block_len;
+	size_t ndp_idx;
+	unsigned int ndp_num = 0;
+
+	sys_slist_init(&pkts);
+
+	if (buf->len < sizeof(struct cdc_ncm_nth16) ||
+	    sys_le32_to_cpu(nth->dwSignature) != NCM_NTH16_SIGNATURE ||
+	    sys_le16_to_cpu(nth->wHeaderLength) != sizeof(struct cdc_ncm_nth16)) {
+		LOG_WRN("Invalid NTH16");
+		return;
+	}
+
+	block_len = sys_le16_to_cpu(nth->wBlockLength);
+	if (block_len == 0 || block_len > buf->len) {
+		/* Zero means the transfer ends the NTB, NCM10.pdf, 3.2.1 */
+		block_len = buf->len;
+	}
+
+	ndp_idx = sys_le16_to_cpu(nth->wNdpIndex);
+
+	/* NDPs are chained, limit the number to stop at a loop */
+	while (ndp_idx != 0 && ndp_num++ < block_len / sizeof(struct cdc_ncm_ndp16)) {
+		const struct cdc_ncm_ndp16 *ndp = (const void *)&buf->data[ndp_idx];
+		const struct cdc_ncm_dpe16 *dpe;
+		size_t ndp_len;
+
+		if (ndp_idx % sizeof(uint32_t) != 0 ||
+		    ndp_idx + sizeof(struct cdc_ncm_ndp16) > block_len) {
+			LOG_WRN("Invalid NDP16 index %zu", ndp_idx);
+			break;
+		}
+
+		ndp_len = sys_le16_to_cpu(ndp->wLength);
+		if (sys_le32_to_cpu(ndp->dwSignature) != NCM_NDP16_NOCRC_SIGNATURE ||
+		    ndp_len < CDC_NCM_NDP_IN_SIZE(1) || ndp_idx + ndp_len > block_len) {
+			LOG_WRN("Invalid NDP16");
+			break;
+		}
+
+		dpe = (const void *)&buf->data[ndp_idx + sizeof(struct cdc_ncm_ndp16)];
+		for (size_t i = 0; i < (ndp_len - sizeof(struct cdc_ncm_ndp16)) /
+				       sizeof(struct cdc_ncm_dpe16); i++) {
+			size_t dg_idx = sys_le16_to_cpu(dpe[i].wDatagramIndex);
+			size_t dg_len = sys_le16_to_cpu(dpe[i].wDatagramLength);
+			struct net_pkt *pkt;
+
+			if (dg_idx == 0 || dg_len == 0) {
+				/* Terminating entry */
+				break;
+			}
+
+			if (dg_idx + dg_len > block_len ||
+			    dg_len < sizeof(struct net_eth_hdr)) {
+				LOG_WRN("Invalid datagram pointer %zu %zu", dg_idx, dg_len);
+				continue;
+			}
+
+			pkt = net_pkt_rx_alloc_with_buffer(data->iface, dg_len,
+							   AF_UNSPEC, 0, K_FOREVER);
+			if (!pkt) {
+				LOG_ERR("No memory for net_pkt");
+				continue;
+			}
+
+			if (net_pkt_write(pkt, &buf->data[dg_idx], dg_len)) {
+				LOG_ERR("Unable to write into pkt");
+				net_pkt_unref(pkt);
+				continue;
+			}
+
+			LOG_DBG("Received datagram len %zu", dg_len);
+			net_pkt_list_append(&pkts, pkt);
+		}
+
+		ndp_idx = sys_le16_to_cpu(ndp->wNextNdpIndex);
+	}
+
+	if (!sys_slist_is_empty(&pkts) &&
+	    net_recv_data_batch(data->iface, &pkts) < 0) {
+		LOG_ERR("Datagrams dropped by network stack");
+	}
+}
+
+static int cdc_ncm_acl_out_cb(struct usbd_class_data *const c_data,
+			      struct net_buf *const buf, const int err)
+{
+	const struct device *dev = usbd_class_get_private(c_data);
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	if (err == 0 && buf->len > 0) {
+		cdc_ncm_ntb_parse(data, buf);
+	}
+
+	net_buf_unref(buf);
+	atomic_clear_bit(&data->state, CDC_NCM_OUT_ENGAGED);
+
+	return cdc_ncm_out_start(c_data);
+}
+
+/* Finalize the NTB IN being filled and start its transfer, tx_lock held */
+static int cdc_ncm_ntb_submit(struct cdc_ncm_eth_data *const data)
+{
+	struct usbd_class_data *c_data = data->c_data;
+	struct net_buf *buf = data->tx_ntb;
+	struct cdc_ncm_nth16 *nth = (void *)buf->data;
+	struct cdc_ncm_ndp16 *ndp = (void *)&buf->data[CDC_NCM_NDP_IN_OFFSET];
+	struct cdc_ncm_dpe16 *dpe = (void *)(ndp + 1);
+	int ret;
+
+	nth->dwSignature = sys_cpu_to_le32(NCM_NTH16_SIGNATURE);
+	nth->wHeaderLength = sys_cpu_to_le16(sizeof(struct cdc_ncm_nth16));
+	nth->wSequence = sys_cpu_to_le16(data->tx_seq++);
+	nth->wBlockLength = sys_cpu_to_le16(buf->len);
+	nth->wNdpIndex = sys_cpu_to_le16(CDC_NCM_NDP_IN_OFFSET);
+
+	ndp->dwSignature = sys_cpu_to_le32(NCM_NDP16_NOCRC_SIGNATURE);
+	ndp->wLength = sys_cpu_to_le16(CDC_NCM_NDP_IN_SIZE(data->tx_count));
+	ndp->wNextNdpIndex = 0;
+	dpe[data->tx_count].wDatagramIndex = 0;
+	dpe[data->tx_count].wDatagramLength = 0;
+
+	if (!(buf->len % cdc_ncm_get_bulk_in_mps(c_data)) &&
+	    buf->len < data->ntb_in_size) {
+		udc_ep_buf_set_zlp(buf);
+	}
+
+	data->tx_ntb = NULL;
+	data->tx_count = 0;
+
+	atomic_set_bit(&data->state, CDC_NCM_IN_ENGAGED);
+	ret = usbd_ep_enqueue(c_data, buf);
+	if (ret) {
+		LOG_ERR("Failed to enqueue NTB IN");
+		net_buf_unref(buf);
+		atomic_clear_bit(&data->state, CDC_NCM_IN_ENGAGED);
+	}
+
+	return ret;
+}
+
+static void cdc_ncm_acl_in_cb(struct usbd_class_data *const c_data,
+			      struct net_buf *const buf, const int err)
+{
+	const struct device *dev = usbd_class_get_private(c_data);
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	if (err) {
+		LOG_DBG("NTB IN transfer failed, %d", err);
+	}
+
+	net_buf_unref(buf);
+
+	k_mutex_lock(&data->tx_lock, K_FOREVER);
+	atomic_clear_bit(&data->state, CDC_NCM_IN_ENGAGED);
+
+	/* Send what has been aggregated while the previous NTB was in flight */
+	if (data->tx_ntb != NULL && data->tx_count > 0 &&
+	    atomic_test_bit(&data->state, CDC_NCM_CLASS_ENABLED)) {
+		(void)cdc_ncm_ntb_submit(data);
+	}
+
+	k_condvar_broadcast(&data->tx_done);
+	k_mutex_unlock(&data->tx_lock);
+}
+
+static void cdc_ncm_tx_reset(struct cdc_ncm_eth_data *const data)
+{
+	k_mutex_lock(&data->tx_lock, K_FOREVER);
+
+	if (data->tx_ntb != NULL) {
+		net_buf_unref(data->tx_ntb);
+		data->tx_ntb = NULL;
+	}
+
+	data->tx_count = 0;
+	data->tx_seq = 0;
+	data->ntb_in_size = CDC_NCM_NTB_IN_SIZE;
+	k_condvar_broadcast(&data->tx_done);
+
+	k_mutex_unlock(&data->tx_lock);
+}
+
+static int usbd_cdc_ncm_request(struct usbd_class_data *const c_data,
+				struct net_buf *buf, int err)
+{
+	struct usbd_context *uds_ctx = usbd_class_get_ctx(c_data);
+	const struct device *dev = usbd_class_get_private(c_data);
+	struct cdc_ncm_eth_data *data = dev->data;
+	struct udc_buf_info *bi;
+
+	bi = udc_get_buf_info(buf);
+
+	if (bi->ep == cdc_ncm_get_bulk_out(c_data)) {
+		return cdc_ncm_acl_out_cb(c_data, buf, err);
+	}
+
+	if (bi->ep == cdc_ncm_get_bulk_in(c_data)) {
+		cdc_ncm_acl_in_cb(c_data, buf, err);
+
+		return 0;
+	}
+
+	if (bi->ep == cdc_ncm_get_int_in(c_data)) {
+		k_sem_give(&data->notif_sem);
+
+		return 0;
+	}
+
+	return usbd_ep_buf_free(uds_ctx, buf);
+}
+
+static int cdc_ncm_send_notification(const struct device *dev,
+				     const bool connected)
+{
+	struct cdc_ncm_eth_data *data = dev->data;
+	struct usbd_class_data *c_data = data->c_data;
+	struct cdc_ncm_notification notification = {
+		.RequestType = {
+			.direction = USB_REQTYPE_DIR_TO_HOST,
+			.type = USB_REQTYPE_TYPE_CLASS,
+			.recipient = USB_REQTYPE_RECIPIENT_INTERFACE,
+		},
+		.bNotificationType = USB_CDC_NETWORK_CONNECTION,
+		.wValue = sys_cpu_to_le16((uint16_t)connected),
+		.wIndex = sys_cpu_to_le16(cdc_ncm_get_ctrl_if(data)),
+		.wLength = 0,
+	};
+	struct net_buf *buf;
+	uint8_t ep;
+	int ret;
+
+	if (!atomic_test_bit(&data->state, CDC_NCM_CLASS_ENABLED)) {
+		LOG_INF("USB configuration is not enabled");
+		return 0;
+	}
+
+	if (atomic_test_bit(&data->state, CDC_NCM_CLASS_SUSPENDED)) {
+		LOG_INF("USB device is suspended (FIXME)");
+		return 0;
+	}
+
+	ep = cdc_ncm_get_int_in(c_data);
+	buf = usbd_ep_buf_alloc(c_data, ep, sizeof(struct cdc_ncm_notification));
+	if (buf == NULL) {
+		return -ENOMEM;
+	}
+
+	net_buf_add_mem(buf, &notification, sizeof(struct cdc_ncm_notification));
+	ret = usbd_ep_enqueue(c_data, buf);
+	if (ret) {
+		LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
+		net_buf_unref(buf);
+		return ret;
+	}
+
+	k_sem_take(&data->notif_sem, K_FOREVER);
+	net_buf_unref(buf);
+
+	return 0;
+}
+
+static void usbd_cdc_ncm_update(struct usbd_class_data *const c_data,
+				const uint8_t iface, const uint8_t alternate)
+{
+	const struct device *dev = usbd_class_get_private(c_data);
+	struct cdc_ncm_eth_data *data = dev->data;
+	struct usbd_cdc_ncm_desc *desc = data->desc;
+	const uint8_t data_iface = desc->if1_1.bInterfaceNumber;
+
+	LOG_INF("New configuration, interface %u alternate %u",
+		iface, alternate);
+
+	if (data_iface == iface && alternate == 0) {
+		/* Selecting alternate setting 0 resets the function */
+		net_if_carrier_off(data->iface);
+		cdc_ncm_tx_reset(data);
+	}
+
+	if (data_iface == iface && alternate == 1) {
+		net_if_carrier_on(data->iface);
+		if (cdc_ncm_out_start(c_data)) {
+			LOG_ERR("Failed to start OUT transfer");
+		}
+	}
+}
+
+static void usbd_cdc_ncm_enable(struct usbd_class_data *const c_data)
+{
+	const struct device *dev = usbd_class_get_private(c_data);
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	atomic_set_bit(&data->state, CDC_NCM_CLASS_ENABLED);
+	LOG_DBG("Configuration enabled");
+}
+
+static void usbd_cdc_ncm_disable(struct usbd_class_data *const c_data)
+{
+	const struct device *dev = usbd_class_get_private(c_data);
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	if (atomic_test_and_clear_bit(&data->state, CDC_NCM_CLASS_ENABLED)) {
+		net_if_carrier_off(data->iface);
+	}
+
+	atomic_clear_bit(&data->state, CDC_NCM_CLASS_SUSPENDED);
+	cdc_ncm_tx_reset(data);
+	LOG_INF("Configuration disabled");
+}
+
+static void usbd_cdc_ncm_suspended(struct usbd_class_data *const c_data)
+{
+	const struct device *dev = usbd_class_get_private(c_data);
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	atomic_set_bit(&data->state, CDC_NCM_CLASS_SUSPENDED);
+}
+
+static void usbd_cdc_ncm_resumed(struct usbd_class_data *const c_data)
+{
+	const struct device *dev = usbd_class_get_private(c_data);
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	atomic_clear_bit(&data->state, CDC_NCM_CLASS_SUSPENDED);
+}
+
+static int usbd_cdc_ncm_cth(struct usbd_class_data *const c_data,
+			    const struct usb_setup_packet *const setup,
+			    struct net_buf *const buf)
+{
+	const struct device *dev = usbd_class_get_private(c_data);
+	struct cdc_ncm_eth_data *data = dev->data;
+	uint32_t ntb_in_size;
+
+	if (buf == NULL) {
+		errno = -ENOMEM;
+		return 0;
+	}
+
+	switch (setup->bRequest) {
+	case GET_NTB_PARAMETERS:
+		net_buf_add_mem(buf, &cdc_ncm_ntb_params,
+				MIN(sizeof(cdc_ncm_ntb_params), setup->wLength));
+		return 0;
+
+	case GET_NTB_FORMAT:
+		/* Only NTB16 is supported */
+		net_buf_add_le16(buf, 0);
+		return 0;
+
+	case GET_NTB_INPUT_SIZE:
+		ntb_in_size = sys_cpu_to_le32(data->ntb_in_size);
+		net_buf_add_mem(buf, &ntb_in_size,
+				MIN(sizeof(ntb_in_size), setup->wLength));
+		return 0;
+
+	default:
+		break;
+	}
+
+	LOG_DBG("bmRequestType 0x%02x bRequest 0x%02x unsupported",
+		setup->bmRequestType, setup->bRequest);
+	errno = -ENOTSUP;
+
+	return 0;
+}
+
+static int usbd_cdc_ncm_ctd(struct usbd_class_data *const c_data,
+			    const struct usb_setup_packet *const setup,
+			    const struct net_buf *const buf)
+{
+	const struct device *dev = usbd_class_get_private(c_data);
+	struct cdc_ncm_eth_data *data = dev->data;
+	uint32_t ntb_in_size;
+
+	switch (setup->bRequest) {
+	case SET_ETHERNET_PACKET_FILTER:
+		LOG_INF("bRequest 0x%02x (SetPacketFilter) not implemented",
+			setup->bRequest);
+		return 0;
+
+	case SET_NTB_FORMAT:
+		if (setup->wValue == 0) {
+			return 0;
+		}
+
+		break;
+
+	case SET_NTB_INPUT_SIZE:
+		if (buf == NULL || buf->len < sizeof(uint32_t)) {
+			break;
+		}
+
+		ntb_in_size = sys_get_le32(buf->data);
+		if (ntb_in_size < CDC_NCM_NTB_MIN_IN_SIZE ||
+		    ntb_in_size > CDC_NCM_NTB_IN_SIZE) {
+			break;
+		}
+
+		k_mutex_lock(&data->tx_lock, K_FOREVER);
+		data->ntb_in_size = ntb_in_size;
+		k_mutex_unlock(&data->tx_lock);
+		LOG_DBG("NTB IN size %u", ntb_in_size);
+
+		return 0;
+
+	default:
+		break;
+	}
+
+	LOG_DBG("bmRequestType 0x%02x bRequest 0x%02x unsupported",
+		setup->bmRequestType, setup->bRequest);
+	errno = -ENOTSUP;
+
+	return 0;
+}
+
+static int usbd_cdc_ncm_init(struct usbd_class_data *const c_data)
+{
+	struct usbd_context *uds_ctx = usbd_class_get_ctx(c_data);
+	const struct device *dev = usbd_class_get_private(c_data);
+	struct cdc_ncm_eth_data *const data = dev->data;
+	struct usbd_cdc_ncm_desc *desc = data->desc;
+	const uint8_t if_num = desc->if0.bInterfaceNumber;
+
+	/* Update relevant b*Interface fields */
+	desc->iad.bFirstInterface = if_num;
+	desc->if0_union.bControlInterface = if_num;
+	desc->if0_union.bSubordinateInterface0 = if_num + 1;
+	LOG_DBG("CDC NCM class initialized");
+
+	if (usbd_add_descriptor(uds_ctx, data->mac_desc_data)) {
+		LOG_ERR("Failed to add iMACAddress string descriptor");
+	} else {
+		desc->if0_ecm.iMACAddress = usbd_str_desc_get_idx(data->mac_desc_data);
+	}
+
+	return 0;
+}
+
+static void usbd_cdc_ncm_shutdown(struct usbd_class_data *const c_data)
+{
+	const struct device *dev = usbd_class_get_private(c_data);
+	struct cdc_ncm_eth_data *const data = dev->data;
+	struct usbd_cdc_ncm_desc *desc = data->desc;
+
+	desc->if0_ecm.iMACAddress = 0;
+	sys_dlist_remove(&data->mac_desc_data->node);
+}
+
+static void *usbd_cdc_ncm_get_desc(struct usbd_class_data *const c_data,
+				   const enum usbd_speed speed)
+{
+	const struct device *dev = usbd_class_get_private(c_data);
+	struct cdc_ncm_eth_data *const data = dev->data;
+
+	if (speed == USBD_SPEED_HS) {
+		return data->hs_desc;
+	}
+
+	return data->fs_desc;
+}
+
+/* Check whether a datagram fits in the NTB IN being filled, tx_lock held */
+static bool cdc_ncm_ntb_fits(struct cdc_ncm_eth_data *const data, const size_t len)
+{
+	size_t offset = ROUND_UP(data->tx_ntb->len, CDC_NCM_NDP_DIVISOR);
+
+	return data->tx_count < CDC_NCM_MAX_DATAGRAMS &&
+	       offset + len <= data->ntb_in_size;
+}
+
+static int cdc_ncm_send(const struct device *dev, struct net_pkt *const pkt)
+{
+	struct cdc_ncm_eth_data *const data = dev->data;
+	struct usbd_class_data *c_data = data->c_data;
+	size_t len = net_pkt_get_len(pkt);
+	struct cdc_ncm_dpe16 *dpe;
+	struct net_buf *buf;
+	size_t offset;
+	int ret = 0;
+
+	if (len > NET_ETH_MAX_FRAME_SIZE) {
+		LOG_WRN("Trying to send too large packet, drop");
+		return -ENOMEM;
+	}
+
+	k_mutex_lock(&data->tx_lock, K_FOREVER);
+
+	while (true) {
+		if (!atomic_test_bit(&data->state, CDC_NCM_CLASS_ENABLED) ||
+		    !atomic_test_bit(&data->state, CDC_NCM_IFACE_UP)) {
+			LOG_INF("Configuration is not enabled or interface not ready");
+			ret = -EACCES;
+			goto out;
+		}
+
+		if (data->tx_ntb == NULL) {
+			data->tx_ntb = cdc_ncm_buf_alloc(&cdc_ncm_in_pool,
+							 cdc_ncm_get_bulk_in(c_data));
+			if (data->tx_ntb == NULL) {
+				/* Both NTBs are in use, wait for one to be sent */
+				k_condvar_wait(&data->tx_done, &data->tx_lock, K_FOREVER);
+				continue;
+			}
+
+			net_buf_add(data->tx_ntb, CDC_NCM_DGRAM_IN_OFFSET);
+		}
+
+		if (cdc_ncm_ntb_fits(data, len)) {
+			break;
+		}
+
+		if (atomic_test_bit(&data->state, CDC_NCM_IN_ENGAGED)) {
+			/* The full NTB is sent as soon as the previous one is done */
+			k_condvar_wait(&data->tx_done, &data->tx_lock, K_FOREVER);
+			continue;
+		}
+
+		ret = cdc_ncm_ntb_submit(data);
+		if (ret) {
+			goto out;
+		}
+	}
+
+	buf = data->tx_ntb;
+	offset = ROUND_UP(buf->len, CDC_NCM_NDP_DIVISOR);
+	if (net_pkt_read(pkt, &buf->data[offset], len)) {
+		LOG_ERR("Failed copy net_pkt");
+		ret = -ENOBUFS;
+		goto out;
+	}
+
+	memset(&buf->data[buf->len], 0, offset - buf->len);
+	net_buf_add(buf, offset + len - buf->len);
+
+	dpe = (void *)&buf->data[CDC_NCM_NDP_IN_OFFSET + sizeof(struct cdc_ncm_ndp16)];
+	dpe[data->tx_count].wDatagramIndex = sys_cpu_to_le16(offset);
+	dpe[data->tx_count].wDatagramLength = sys_cpu_to_le16(len);
+	data->tx_count++;
+
+	/*
+	 * Datagrams are sent immediately when the endpoint is idle, otherwise
+	 * they are aggregated until the transfer in flight is done.
+	 */
+	if (!atomic_test_bit(&data->state, CDC_NCM_IN_ENGAGED)) {
+		ret = cdc_ncm_ntb_submit(data);
+	}
+
+out:
+	k_mutex_unlock(&data->tx_lock);
+
+	return ret;
+}
+
+static int cdc_ncm_set_config(const struct device *dev,
+			      const enum ethernet_config_type type,
+			      const struct ethernet_config *config)
+{
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	if (type == ETHERNET_CONFIG_TYPE_MAC_ADDRESS) {
+		memcpy(data->mac_addr, config->mac_address.addr,
+		       sizeof(data->mac_addr));
+
+		return 0;
+	}
+
+	return -ENOTSUP;
+}
+
+static int cdc_ncm_get_config(const struct device *dev,
+			      enum ethernet_config_type type,
+			      struct ethernet_config *config)
+{
+	return -ENOTSUP;
+}
+
+static enum ethernet_hw_caps cdc_ncm_get_capabilities(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return ETHERNET_LINK_10BASE_T;
+}
+
+static int cdc_ncm_iface_start(const struct device *dev)
+{
+	struct cdc_ncm_eth_data *data = dev->data;
+	int ret;
+
+	LOG_DBG("Start interface %p", data->iface);
+	ret = cdc_ncm_send_notification(dev, true);
+	if (!ret) {
+		atomic_set_bit(&data->state, CDC_NCM_IFACE_UP);
+	}
+
+	return ret;
+}
+
+static int cdc_ncm_iface_stop(const struct device *dev)
+{
+	struct cdc_ncm_eth_data *data = dev->data;
+	int ret;
+
+	LOG_DBG("Stop interface %p", data->iface);
+	ret = cdc_ncm_send_notification(dev, false);
+	if (!ret) {
+		atomic_clear_bit(&data->state, CDC_NCM_IFACE_UP);
+	}
+
+	return ret;
+}
+
+static void cdc_ncm_iface_init(struct net_if *const iface)
+{
+	const struct device *dev = net_if_get_device(iface);
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	data->iface = iface;
+	ethernet_init(iface);
+	net_if_set_link_addr(iface, data->mac_addr,
+			     sizeof(data->mac_addr),
+			     NET_LINK_ETHERNET);
+
+	net_if_carrier_off(iface);
+
+	LOG_DBG("CDC NCM interface initialized");
+}
+
+static int usbd_cdc_ncm_preinit(const struct device *dev)
+{
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	if (sys_get_le48(data->mac_addr) == sys_cpu_to_le48(0)) {
+		gen_random_mac(data->mac_addr, 0, 0, 0);
+	}
+
+	k_mutex_init(&data->tx_lock);
+	k_condvar_init(&data->tx_done);
+	data->ntb_in_size = CDC_NCM_NTB_IN_SIZE;
+
+	LOG_DBG("CDC NCM device initialized");
+
+	return 0;
+}
+
+static struct usbd_class_api usbd_cdc_ncm_api = {
+	.request = usbd_cdc_ncm_request,
+	.update = usbd_cdc_ncm_update,
+	.enable = usbd_cdc_ncm_enable,
+	.disable = usbd_cdc_ncm_disable,
+	.suspended = usbd_cdc_ncm_suspended,
+	.resumed = usbd_cdc_ncm_resumed,
+	.control_to_host = usbd_cdc_ncm_cth,
+	.control_to_dev = usbd_cdc_ncm_ctd,
+	.init = usbd_cdc_ncm_init,
+	.shutdown = usbd_cdc_ncm_shutdown,
+	.get_desc = usbd_cdc_ncm_get_desc,
+};
+
+static const struct ethernet_api cdc_ncm_eth_api = {
+	.iface_api.init = cdc_ncm_iface_init,
+	.get_config = cdc_ncm_get_config,
+	.set_config = cdc_ncm_set_config,
+	.get_capabilities = cdc_ncm_get_capabilities,
+	.send = cdc_ncm_send,
+	.start = cdc_ncm_iface_start,
+	.stop = cdc_ncm_iface_stop,
+};
+
+#define CDC_NCM_DEFINE_DESCRIPTOR(n)						\
+static struct usbd_cdc_ncm_desc cdc_ncm_desc_##n = {				\
+	.iad = {								\
+		.bLength = sizeof(struct usb_association_descriptor),		\
+		.bDescriptorType = USB_DESC_INTERFACE_ASSOC,			\
+		.bFirstInterface = 0,						\
+		.bInterfaceCount = 0x02,					\
+		.bFunctionClass = USB_BCC_CDC_CONTROL,				\
+		.bFunctionSubClass = NCM_SUBCLASS,				\
+		.bFunctionProtocol = 0,						\
+		.iFunction = 0,							\
+	},									\
+										\
+	.if0 = {								\
+		.bLength = sizeof(struct usb_if_descriptor),			\
+		.bDescriptorType = USB_DESC_INTERFACE,				\
+		.bInterfaceNumber = 0,						\
+		.bAlternateSetting = 0,						\
+		.bNumEndpoints = 1,						\
+		.bInterfaceClass = USB_BCC_CDC_CONTROL,				\
+		.bInterfaceSubClass = NCM_SUBCLASS,				\
+		.bInterfaceProtocol = 0,					\
+		.iInterface = 0,						\
+	},									\
+										\
+	.if0_header = {								\
+		.bFunctionLength = sizeof(struct cdc_header_descriptor),	\
+		.bDescriptorType = USB_DESC_CS_INTERFACE,			\
+		.bDescriptorSubtype = HEADER_FUNC_DESC,				\
+		.bcdCDC = sys_cpu_to_le16(USB_SRN_1_1),				\
+	},									\
+										\
+	.if0_union = {								\
+		.bFunctionLength = sizeof(struct cdc_union_descriptor),		\
+		.bDescriptorType = USB_DESC_CS_INTERFACE,			\
+		.bDescriptorSubtype = UNION_FUNC_DESC,				\
+		.bControlInterface = 0,						\
+		.bSubordinateInterface0 = 1,					\
+	},									\
+										\
+	.if0_ecm = {								\
+		.bFunctionLength = sizeof(struct cdc_ecm_descriptor),		\
+		.bDescriptorType = USB_DESC_CS_INTERFACE,			\
+		.bDescriptorSubtype = ETHERNET_FUNC_DESC,			\
+		.iMACAddress = 0,						\
+		.bmEthernetStatistics = sys_cpu_to_le32(0),			\
+		.wMaxSegmentSize = sys_cpu_to_le16(NET_ETH_MAX_FRAME_SIZE),	\
+		.wNumberMCFilters = sys_cpu_to_le16(0),				\
+		.bNumberPowerFilters = 0,					\
+	},									\
+										\
+	.if0_ncm = {								\
+		.bFunctionLength = sizeof(struct cdc_ncm_descriptor),		\
+		.bDescriptorType = USB_DESC_CS_INTERFACE,			\
+		.bDescriptorSubtype = NCM_FUNC_DESC,				\
+		.bcdNcmVersion = sys_cpu_to_le16(0x0100),			\
+		.bmNetworkCapabilities = 0,					\
+	},									\
+										\
+	.if0_int_ep = {								\
+		.bLength = sizeof(struct usb_ep_descriptor),			\
+		.bDescriptorType = USB_DESC_ENDPOINT,				\
+		.bEndpointAddress = 0x81,					\
+		.bmAttributes = USB_EP_TYPE_INTERRUPT,				\
+		.wMaxPacketSize = sys_cpu_to_le16(CDC_NCM_EP_MPS_INT),		\
+		.bInterval = CDC_NCM_FS_INT_EP_INTERVAL,			\
+	},									\
+										\
+	.if0_hs_int_ep = {							\
+		.bLength = sizeof(struct usb_ep_descriptor),			\
+		.bDescriptorType = USB_DESC_ENDPOINT,				\
+		.bEndpointAddress = 0x81,					\
+		.bmAttributes = USB_EP_TYPE_INTERRUPT,				\
+		.wMaxPacketSize = sys_cpu_to_le16(CDC_NCM_EP_MPS_INT),		\
+		.bInterval = CDC_NCM_HS_INT_EP_INTERVAL,			\
+	},									\
+										\
+	.if1_0 = {								\
+		.bLength = sizeof(struct usb_if_descriptor),			\
+		.bDescriptorType = USB_DESC_INTERFACE,				\
+		.bInterfaceNumber = 1,						\
+		.bAlternateSetting = 0,						\
+		.bNumEndpoints = 0,						\
+		.bInterfaceClass = USB_BCC_CDC_DATA,				\
+		.bInterfaceSubClass = 0,					\
+		.bInterfaceProtocol = NCM_DATA_PROTOCOL,			\
+		.iInterface = 0,						\
+	},									\
+										\
+	.if1_1 = {								\
+		.bLength = sizeof(struct usb_if_descriptor),			\
+		.bDescriptorType = USB_DESC_INTERFACE,				\
+		.bInterfaceNumber = 1,						\
+		.bAlternateSetting = 1,						\
+		.bNumEndpoints = 2,						\
+		.bInterfaceClass = USB_BCC_CDC_DATA,				\
+		.bInterfaceSubClass = 0,					\
+		.bInterfaceProtocol = NCM_DATA_PROTOCOL,			\
+		.iInterface = 0,						\
+	},									\
+										\
+	.if1_1_in_ep = {							\
+		.bLength = sizeof(struct usb_ep_descriptor),			\
+		.bDescriptorType = USB_DESC_ENDPOINT,				\
+		.bEndpointAddress = 0x82,					\
+		.bmAttributes = USB_EP_TYPE_BULK,				\
+		.wMaxPacketSize = sys_cpu_to_le16(64U),				\
+		.bInterval = 0,							\
+	},									\
+										\
+	.if1_1_out_ep = {							\
+		.bLength = sizeof(struct usb_ep_descriptor),			\
+		.bDescriptorType = USB_DESC_ENDPOINT,				\
+		.bEndpointAddress = 0x01,					\
+		.bmAttributes = USB_EP_TYPE_BULK,				\
+		.wMaxPacketSize = sys_cpu_to_le16(64U),				\
+		.bInterval = 0,							\
+	},									\
+										\
+	.if1_1_hs_in_ep = {							\
+		.bLength = sizeof(struct usb_ep_descriptor),			\
+		.bDescriptorType = USB_DESC_ENDPOINT,				\
+		.bEndpointAddress = 0x82,					\
+		.bmAttributes = USB_EP_TYPE_BULK,				\
+		.wMaxPacketSize = sys_cpu_to_le16(512U),			\
+		.bInterval = 0,							\
+	},									\
+										\
+	.if1_1_hs_out_ep = {							\
+		.bLength = sizeof(struct usb_ep_descriptor),			\
+		.bDescriptorType = USB_DESC_ENDPOINT,				\
+		.bEndpointAddress = 0x01,					\
+		.bmAttributes = USB_EP_TYPE_BULK,				\
+		.wMaxPacketSize = sys_cpu_to_le16(512U),			\
+		.bInterval = 0,							\
+	},									\
+										\
+	.nil_desc = {								\
+		.bLength = 0,							\
+		.bDescriptorType = 0,						\
+	},									\
+};										\
+										\
+	const static struct usb_desc_header *cdc_ncm_fs_desc_##n[] = {		\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.iad,		\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.if0,		\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.if0_header,	\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.if0_union,		\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.if0_ecm,		\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.if0_ncm,		\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.if0_int_ep,	\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.if1_0,		\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.if1_1,		\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.if1_1_in_ep,	\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.if1_1_out_ep,	\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.nil_desc,		\
+	};									\
+										\
+	const static struct usb_desc_header *cdc_ncm_hs_desc_##n[] = {		\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.iad,		\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.if0,		\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.if0_header,	\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.if0_union,		\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.if0_ecm,		\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.if0_ncm,		\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.if0_hs_int_ep,	\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.if1_0,		\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.if1_1,		\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.if1_1_hs_in_ep,	\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.if1_1_hs_out_ep,	\
+		(struct usb_desc_header *) &cdc_ncm_desc_##n.nil_desc,		\
+	}
+
+#define USBD_CDC_NCM_DT_DEVICE_DEFINE(n)					\
+	CDC_NCM_DEFINE_DESCRIPTOR(n);						\
+	USBD_DESC_STRING_DEFINE(mac_desc_data_##n,				\
+				DT_INST_PROP(n, remote_mac_address),		\
+				USBD_DUT_STRING_INTERFACE);			\
+										\
+	USBD_DEFINE_CLASS(cdc_ncm_##n,						\
+			  &usbd_cdc_ncm_api,					\
+			  (void *)DEVICE_DT_GET(DT_DRV_INST(n)), NULL);		\
+										\
+	static struct cdc_ncm_eth_data eth_data_##n = {				\
+		.c_data = &cdc_ncm_##n,						\
+		.mac_addr = DT_INST_PROP_OR(n, local_mac_address, {0}),		\
+		.notif_sem = Z_SEM_INITIALIZER(eth_data_##n.notif_sem, 0, 1),	\
+		.mac_desc_data = &mac_desc_data_##n,				\
+		.desc = &cdc_ncm_desc_##n,					\
+		.fs_desc = cdc_ncm_fs_desc_##n,					\
+		.hs_desc = cdc_ncm_hs_desc_##n,					\
+	};									\
+										\
+	ETH_NET_DEVICE_DT_INST_DEFINE(n, usbd_cdc_ncm_preinit, NULL,		\
+		&eth_data_##n, NULL,						\
+		CONFIG_ETH_INIT_PRIORITY,					\
+		&cdc_ncm_eth_api,						\
+		NET_ETH_MTU);
+
+DT_INST_FOREACH_STATUS_OKAY(USBD_CDC_NCM_DT_DEVICE_DEFINE);
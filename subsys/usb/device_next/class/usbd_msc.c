@@ -67,6 +67,14 @@ NET_BUF_POOL_FIXED_DEFINE(msc_ep_pool,
 			  MSC_NUM_INSTANCES * 2, MSC_BUF_SIZE,
 			  sizeof(struct udc_buf_info), NULL);
 
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+/* READ and WRITE data transfers use the instance transfer buffers, at most
+ * one IN or two OUT (one being processed, one queued) per instance.
+ */
+NET_BUF_POOL_DEFINE(msc_xfer_pool, MSC_NUM_INSTANCES * 2, 0,
+		    sizeof(struct udc_buf_info), NULL);
+#endif
+
 struct msc_event {
 	struct usbd_class_data *c_data;
 	/* NULL to request Bulk-Only Mass Storage Reset
@@ -125,6 +133,16 @@ struct msc_bot_ctx {
 	uint32_t transferred_data;
 	size_t scsi_offset;
 	size_t scsi_bytes;
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+	/* Disk data is read to or written from one of the buffers while the
+	 * other one is transferred.
+	 */
+	uint8_t xfer_buf[2][CONFIG_USBD_MSC_SCSI_BUFFER_SIZE] __aligned(sizeof(void *));
+	/* Buffer containing the IN data, scsi_buf or one of xfer_buf */
+	uint8_t *in_data;
+	/* Transfer buffer to receive the next OUT data to */
+	uint8_t out_idx;
+#endif
 };
 
 static struct net_buf *msc_buf_alloc(const uint8_t ep)
@@ -144,6 +162,30 @@ static struct net_buf *msc_buf_alloc(const uint8_t ep)
 	return buf;
 }
 
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+static struct net_buf *msc_xfer_buf_alloc(const uint8_t ep, uint8_t *data, size_t size)
+{
+	struct net_buf *buf = NULL;
+	struct udc_buf_info *bi;
+
+	buf = net_buf_alloc_with_data(&msc_xfer_pool, data, size, K_NO_WAIT);
+	if (!buf) {
+		return NULL;
+	}
+
+	bi = udc_get_buf_info(buf);
+	memset(bi, 0, sizeof(struct udc_buf_info));
+	bi->ep = ep;
+
+	if (USB_EP_DIR_IS_OUT(ep)) {
+		/* Buffer is empty, USB stack will write data from host */
+		buf->len = 0;
+	}
+
+	return buf;
+}
+#endif
+
 static uint8_t msc_get_bulk_in(struct usbd_class_data *const c_data)
 {
 	struct usbd_context *uds_ctx = usbd_class_get_ctx(c_data);
@@ -184,7 +226,20 @@ static void msc_queue_bulk_out_ep(struct usbd_class_data *const c_data)
 
 	LOG_DBG("Queuing OUT");
 	ep = msc_get_bulk_out(c_data);
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+	if (ctx->state == MSC_BBB_PROCESS_WRITE) {
+		/* Receive as much of the remaining data as fits in one buffer */
+		size_t len = MIN(ctx->cbw.dCBWDataTransferLength - ctx->transferred_data,
+				 sizeof(ctx->xfer_buf[0]));
+
+		buf = msc_xfer_buf_alloc(ep, ctx->xfer_buf[ctx->out_idx], len);
+		ctx->out_idx ^= 1;
+	} else {
+		buf = msc_buf_alloc(ep);
+	}
+#else
 	buf = msc_buf_alloc(ep);
+#endif
 	/* The pool is large enough to support all allocations. Failing alloc
 	 * indicates either a memory leak or logic error.
 	 */
@@ -249,6 +304,61 @@ static bool is_cbw_meaningful(struct msc_bot_ctx *const ctx)
 	return true;
 }
 
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+static void msc_process_read(struct msc_bot_ctx *ctx)
+{
+	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
+	struct net_buf *buf;
+	uint8_t ep;
+	size_t len;
+	int ret;
+
+	/* Fill SCSI Data IN buffer if there is no data available */
+	if (ctx->scsi_bytes == 0) {
+		ctx->in_data = ctx->xfer_buf[0];
+		ctx->scsi_bytes = scsi_read_data(lun, ctx->in_data);
+		ctx->scsi_offset = 0;
+	}
+
+	if (atomic_test_and_set_bit(&ctx->bits, MSC_BULK_IN_QUEUED)) {
+		__ASSERT_NO_MSG(false);
+		LOG_ERR("IN already queued");
+		return;
+	}
+
+	ep = msc_get_bulk_in(ctx->class_node);
+	len = MIN(ctx->scsi_bytes - ctx->scsi_offset, UINT16_MAX);
+	if (len > 0) {
+		buf = msc_xfer_buf_alloc(ep, &ctx->in_data[ctx->scsi_offset], len);
+	} else {
+		buf = msc_buf_alloc(ep);
+	}
+	/* The pools are large enough to support all allocations. Failing
+	 * alloc indicates either a memory leak or logic error.
+	 */
+	__ASSERT_NO_MSG(buf);
+
+	ctx->scsi_offset += len;
+	ctx->csw.dCSWDataResidue -= len;
+	ret = usbd_ep_enqueue(ctx->class_node, buf);
+	if (ret) {
+		LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
+		net_buf_unref(buf);
+		atomic_clear_bit(&ctx->bits, MSC_BULK_IN_QUEUED);
+		return;
+	}
+
+	if (ctx->scsi_bytes == ctx->scsi_offset) {
+		/* Read the next data to the other buffer while the host
+		 * receives this one.
+		 */
+		ctx->in_data = ctx->in_data == ctx->xfer_buf[0] ?
+			       ctx->xfer_buf[1] : ctx->xfer_buf[0];
+		ctx->scsi_bytes = scsi_read_data(lun, ctx->in_data);
+		ctx->scsi_offset = 0;
+	}
+}
+#else
 static void msc_process_read(struct msc_bot_ctx *ctx)
 {
 	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
@@ -307,6 +417,7 @@ static void msc_process_read(struct msc_bot_ctx *ctx)
 		atomic_clear_bit(&ctx->bits, MSC_BULK_IN_QUEUED);
 	}
 }
+#endif
 
 static void msc_process_cbw(struct msc_bot_ctx *ctx)
 {
@@ -319,6 +430,10 @@ static void msc_process_cbw(struct msc_bot_ctx *ctx)
 	data_len = scsi_cmd(lun, ctx->cbw.CBWCB, cb_len, ctx->scsi_buf);
 	ctx->scsi_bytes = data_len;
 	ctx->scsi_offset = 0;
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+	ctx->in_data = ctx->scsi_buf;
+	ctx->out_idx = 0;
+#endif
 	cmd_is_data_read = scsi_cmd_is_data_read(lun);
 	cmd_is_data_write = scsi_cmd_is_data_write(lun);
 	data_len += scsi_cmd_remaining_data_len(lun);
@@ -398,6 +513,16 @@ static void msc_process_write(struct msc_bot_ctx *ctx,
 
 	ctx->transferred_data += len;
 
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+	if ((ctx->transferred_data < ctx->cbw.dCBWDataTransferLength) &&
+	    (scsi_cmd_remaining_data_len(lun) > ctx->scsi_bytes + len)) {
+		/* More data is expected, let the host send it to the other
+		 * buffer while this one is written to the disk.
+		 */
+		msc_queue_bulk_out_ep(ctx->class_node);
+	}
+#endif
+
 	while ((len > 0) && (scsi_cmd_remaining_data_len(lun) > 0)) {
 		/* Copy received data to the end of SCSI buffer */
 		tmp = MIN(len, sizeof(ctx->scsi_buf) - ctx->scsi_bytes);
@@ -583,12 +708,18 @@ static void usbd_msc_handle_request(struct usbd_class_data *c_data,
 		goto ep_request_error;
 	}
 
+	/* The endpoint is free again, the handlers may queue the next transfer */
 	if (bi->ep == msc_get_bulk_out(c_data)) {
+		atomic_clear_bit(&ctx->bits, MSC_BULK_OUT_QUEUED);
 		msc_handle_bulk_out(ctx, buf->data, buf->len);
 	} else if (bi->ep == msc_get_bulk_in(c_data)) {
+		atomic_clear_bit(&ctx->bits, MSC_BULK_IN_QUEUED);
 		msc_handle_bulk_in(ctx, buf->data, buf->len);
 	}
 
+	usbd_ep_buf_free(uds_ctx, buf);
+	return;
+
 ep_request_error:
 	if (bi->ep == msc_get_bulk_out(c_data)) {
 		atomic_clear_bit(&ctx->bits, MSC_BULK_OUT_QUEUED);
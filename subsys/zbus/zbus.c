@@ -8,6 +8,7 @@
 #include <zephyr/sys/iterable_sections.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/printk.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/net/buf.h>
 #include <zephyr/zbus/zbus.h>
 LOG_MODULE_REGISTER(zbus, CONFIG_ZBUS_LOG_LEVEL);
@@ -54,6 +55,19 @@ static inline struct net_buf *_zbus_create_net_buf(struct net_buf_pool *pool, si
 
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 
+#if defined(CONFIG_ZBUS_ASYNC_DISPATCH)
+
+K_MSGQ_DEFINE(_zbus_dispatch_q, sizeof(struct zbus_channel *),
+	      CONFIG_ZBUS_ASYNC_DISPATCH_QUEUE_SIZE, sizeof(struct zbus_channel *));
+
+static K_KERNEL_STACK_ARRAY_DEFINE(_zbus_dispatch_stacks, CONFIG_ZBUS_ASYNC_DISPATCH_THREADS,
+				   CONFIG_ZBUS_ASYNC_DISPATCH_STACK_SIZE);
+static struct k_thread _zbus_dispatch_threads[CONFIG_ZBUS_ASYNC_DISPATCH_THREADS];
+
+static void _zbus_dispatch_start(void);
+
+#endif /* CONFIG_ZBUS_ASYNC_DISPATCH */
+
 int _zbus_init(void)
 {
 
@@ -83,6 +97,9 @@ int _zbus_init(void)
 		sys_slist_init(&chan->data->observers);
 #endif /* CONFIG_ZBUS_RUNTIME_OBSERVERS */
 	}
+
+	IF_ENABLED(CONFIG_ZBUS_ASYNC_DISPATCH, (_zbus_dispatch_start();))
+
 	return 0;
 }
 SYS_INIT(_zbus_init, APPLICATION, CONFIG_ZBUS_CHANNELS_SYS_INIT_PRIORITY);
@@ -161,8 +178,23 @@ static inline int _zbus_vded_exec(const struct zbus_channel *chan, k_timepoint_t
 			continue;
 		}
 
+#if defined(CONFIG_ZBUS_OBSERVER_STATS)
+		uint32_t start = k_cycle_get_32();
+#endif /* CONFIG_ZBUS_OBSERVER_STATS */
+
 		err = _zbus_notify_observer(chan, obs, end_time, buf);
 
+#if defined(CONFIG_ZBUS_OBSERVER_STATS)
+		uint32_t cycles = k_cycle_get_32() - start;
+
+		K_SPINLOCK(&obs_slock) {
+			observation_mask->stats.count++;
+			observation_mask->stats.total_cycles += cycles;
+			observation_mask->stats.max_cycles =
+				MAX(observation_mask->stats.max_cycles, cycles);
+		}
+#endif /* CONFIG_ZBUS_OBSERVER_STATS */
+
 		if (err) {
 			last_error = err;
 			LOG_ERR("could not deliver notification to observer %s. Error code %d",
@@ -347,6 +379,163 @@ static inline void chan_unlock(const struct zbus_channel *chan, int prio)
 #endif /* CONFIG_ZBUS_PRIORITY_BOOST */
 }
 
+#if defined(CONFIG_ZBUS_ASYNC_DISPATCH)
+
+static void _zbus_dispatch_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	const struct zbus_channel *chan;
+
+	while (true) {
+		k_msgq_get(&_zbus_dispatch_q, &chan, K_FOREVER);
+
+		/* Publications from now on need a new dispatch */
+		atomic_clear(&chan->data->async_pending);
+
+		int context_priority = ZBUS_MIN_THREAD_PRIORITY;
+
+		if (chan_lock(chan, K_FOREVER, &context_priority)) {
+			continue;
+		}
+
+		(void)_zbus_vded_exec(
+			chan, sys_timepoint_calc(K_MSEC(CONFIG_ZBUS_ASYNC_DISPATCH_TIMEOUT_MS)));
+
+		chan_unlock(chan, context_priority);
+	}
+}
+
+static void _zbus_dispatch_start(void)
+{
+	for (int i = 0; i < CONFIG_ZBUS_ASYNC_DISPATCH_THREADS; i++) {
+		k_tid_t tid = k_thread_create(&_zbus_dispatch_threads[i], _zbus_dispatch_stacks[i],
+					      K_KERNEL_STACK_SIZEOF(_zbus_dispatch_stacks[i]),
+					      _zbus_dispatch_thread, NULL, NULL, NULL,
+					      CONFIG_ZBUS_ASYNC_DISPATCH_THREAD_PRIORITY, 0,
+					      K_NO_WAIT);
+
+		k_thread_name_set(tid, "zbus_dispatch");
+	}
+}
+
+/* Notify the observers, or queue the channel for the dispatch threads */
+static inline int chan_dispatch(const struct zbus_channel *chan, k_timepoint_t end_time)
+{
+	int err;
+
+	if (!chan->data->async) {
+		return _zbus_vded_exec(chan, end_time);
+	}
+
+	if (atomic_set(&chan->data->async_pending, 1)) {
+		/* Already queued, the observers will see this message */
+		return 0;
+	}
+
+	err = k_msgq_put(&_zbus_dispatch_q, &chan, sys_timepoint_timeout(end_time));
+	if (err) {
+		atomic_clear(&chan->data->async_pending);
+		LOG_ERR("could not queue %s for dispatch. Error code %d", _ZBUS_CHAN_NAME(chan),
+			err);
+	}
+
+	return err;
+}
+
+int zbus_chan_async_set(const struct zbus_channel *chan, bool async)
+{
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+
+	chan->data->async = async;
+
+	return 0;
+}
+
+#else
+
+static inline int chan_dispatch(const struct zbus_channel *chan, k_timepoint_t end_time)
+{
+	return _zbus_vded_exec(chan, end_time);
+}
+
+#endif /* CONFIG_ZBUS_ASYNC_DISPATCH */
+
+#if defined(CONFIG_ZBUS_SEQLOCK_CHANNELS)
+
+/* Read attempts before waiting for a preempted publisher to finish */
+#define SEQLOCK_READ_SPINS 8
+
+static inline bool chan_is_seqlock(const struct zbus_channel *chan)
+{
+	return chan->data->seqlock;
+}
+
+static inline void chan_seqlock_write(const struct zbus_channel *chan, const void *msg)
+{
+	/* An odd sequence tells the readers the message is being written */
+	atomic_inc(&chan->data->seq);
+	barrier_dmem_fence_full();
+
+	memcpy(chan->message, msg, chan->message_size);
+
+	barrier_dmem_fence_full();
+	atomic_inc(&chan->data->seq);
+}
+
+static int chan_seqlock_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeout)
+{
+	k_timepoint_t end_time = sys_timepoint_calc(timeout);
+	atomic_val_t seq;
+
+	while (true) {
+		for (int i = 0; i < SEQLOCK_READ_SPINS; i++) {
+			seq = atomic_get(&chan->data->seq);
+			if (seq & 1) {
+				continue;
+			}
+
+			barrier_dmem_fence_full();
+			memcpy(msg, chan->message, chan->message_size);
+			barrier_dmem_fence_full();
+
+			if (atomic_get(&chan->data->seq) == seq) {
+				return 0;
+			}
+		}
+
+		/* The publisher was preempted while writing, let it run */
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return -EBUSY;
+		}
+		if (sys_timepoint_expired(end_time)) {
+			return -EAGAIN;
+		}
+		k_sleep(K_TICKS(1));
+	}
+}
+
+#else
+
+static inline bool chan_is_seqlock(const struct zbus_channel *chan)
+{
+	return false;
+}
+
+static inline void chan_seqlock_write(const struct zbus_channel *chan, const void *msg)
+{
+}
+
+static inline int chan_seqlock_read(const struct zbus_channel *chan, void *msg,
+				    k_timeout_t timeout)
+{
+	return -ENOTSUP;
+}
+
+#endif /* CONFIG_ZBUS_SEQLOCK_CHANNELS */
+
 int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t timeout)
 {
 	int err;
@@ -364,6 +553,16 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 		return -ENOMSG;
 	}
 
+	if (chan_is_seqlock(chan)) {
+		_ZBUS_ASSERT((atomic_get(&chan->data->seq) & 1) == 0,
+			     "single-writer channel %s published concurrently", _ZBUS_CHAN_NAME(chan));
+
+		chan_seqlock_write(chan, msg);
+
+		/* Readers never take the channel, only the notification does */
+		return zbus_chan_notify(chan, timeout);
+	}
+
 	int context_priority = ZBUS_MIN_THREAD_PRIORITY;
 
 	err = chan_lock(chan, timeout, &context_priority);
@@ -373,7 +572,7 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 
 	memcpy(chan->message, msg, chan->message_size);
 
-	err = _zbus_vded_exec(chan, end_time);
+	err = chan_dispatch(chan, end_time);
 
 	chan_unlock(chan, context_priority);
 
@@ -389,6 +588,10 @@ int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeo
 		timeout = K_NO_WAIT;
 	}
 
+	if (chan_is_seqlock(chan)) {
+		return chan_seqlock_read(chan, msg, timeout);
+	}
+
 	int err = k_sem_take(&chan->data->sem, timeout);
 	if (err) {
 		return err;
@@ -420,7 +623,7 @@ int zbus_chan_notify(const struct zbus_channel *chan, k_timeout_t timeout)
 		return err;
 	}
 
-	err = _zbus_vded_exec(chan, end_time);
+	err = chan_dispatch(chan, end_time);
 
 	chan_unlock(chan, context_priority);
 
@@ -565,6 +768,63 @@ int zbus_obs_is_chan_notification_masked(const struct zbus_observer *obs,
 	return err;
 }
 
+#if defined(CONFIG_ZBUS_OBSERVER_STATS)
+
+int zbus_chan_obs_stats_get(const struct zbus_channel *chan, const struct zbus_observer *obs,
+			    struct zbus_obs_stats *stats)
+{
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(obs != NULL, "obs is required");
+	_ZBUS_ASSERT(stats != NULL, "stats is required");
+
+	int err = -ESRCH;
+
+	struct zbus_channel_observation *observation;
+	struct zbus_channel_observation_mask *observation_mask;
+
+	K_SPINLOCK(&obs_slock) {
+		const int limit = chan->data->observers_end_idx;
+
+		for (int16_t i = chan->data->observers_start_idx; i < limit; ++i) {
+			STRUCT_SECTION_GET(zbus_channel_observation, i, &observation);
+			STRUCT_SECTION_GET(zbus_channel_observation_mask, i, &observation_mask);
+
+			__ASSERT(observation != NULL, "observation must be not NULL");
+
+			if (observation->obs == obs) {
+				*stats = observation_mask->stats;
+
+				err = 0;
+
+				K_SPINLOCK_BREAK;
+			}
+		}
+	}
+
+	return err;
+}
+
+int zbus_chan_obs_stats_reset(const struct zbus_channel *chan)
+{
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+
+	struct zbus_channel_observation_mask *observation_mask;
+
+	K_SPINLOCK(&obs_slock) {
+		const int limit = chan->data->observers_end_idx;
+
+		for (int16_t i = chan->data->observers_start_idx; i < limit; ++i) {
+			STRUCT_SECTION_GET(zbus_channel_observation_mask, i, &observation_mask);
+
+			memset(&observation_mask->stats, 0, sizeof(observation_mask->stats));
+		}
+	}
+
+	return 0;
+}
+
+#endif /* CONFIG_ZBUS_OBSERVER_STATS */
+
 int zbus_obs_set_enable(struct zbus_observer *obs, bool enabled)
 {
 	_ZBUS_ASSERT(obs != NULL, "obs is required");
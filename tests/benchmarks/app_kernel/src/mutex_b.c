@@ -8,6 +8,68 @@
 
 #include "master.h"
 
+#if defined(CONFIG_SMP) && (CONFIG_MP_MAX_NUM_CPUS > 1) && !defined(CONFIG_USERSPACE)
+#define MUTEX_CONTENDED_TEST 1
+
+/* Time the contender holds, then leaves, the mutex in each iteration */
+#define MUTEX_HOLD_US 2
+
+#define CONTENDER_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static struct k_thread contender_thread;
+static K_THREAD_STACK_DEFINE(contender_stack, CONTENDER_STACK_SIZE);
+static atomic_t contender_stop;
+
+static void contender_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (!atomic_get(&contender_stop)) {
+		k_mutex_lock(&DEMO_MUTEX, K_FOREVER);
+		k_busy_wait(MUTEX_HOLD_US);
+		k_mutex_unlock(&DEMO_MUTEX);
+		k_busy_wait(MUTEX_HOLD_US);
+	}
+}
+
+/**
+ * @brief Mutex lock/unlock test with the owner running on another CPU
+ */
+static void mutex_contended_test(void)
+{
+	uint32_t et; /* elapsed time */
+	int i;
+	timing_t  start;
+	timing_t  end;
+
+	if (arch_num_cpus() < 2) {
+		return;
+	}
+
+	atomic_set(&contender_stop, 0);
+	k_thread_create(&contender_thread, contender_stack,
+			K_THREAD_STACK_SIZEOF(contender_stack), contender_entry,
+			NULL, NULL, NULL, k_thread_priority_get(k_current_get()),
+			0, K_NO_WAIT);
+
+	start = timing_timestamp_get();
+	for (i = 0; i < NR_OF_MUTEX_RUNS; i++) {
+		k_mutex_lock(&DEMO_MUTEX, K_FOREVER);
+		k_mutex_unlock(&DEMO_MUTEX);
+	}
+	end = timing_timestamp_get();
+	et = (uint32_t)timing_cycles_get(&start, &end);
+
+	atomic_set(&contender_stop, 1);
+	k_thread_join(&contender_thread, K_FOREVER);
+
+	PRINT_F(FORMAT, "average lock and unlock contended mutex",
+		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, (2 * NR_OF_MUTEX_RUNS)));
+}
+#endif /* CONFIG_SMP && CONFIG_MP_MAX_NUM_CPUS > 1 && !CONFIG_USERSPACE */
+
 /**
  * @brief Mutex lock/unlock test
  */
@@ -29,4 +91,8 @@ void mutex_test(void)
 
 	PRINT_F(FORMAT, "average lock and unlock mutex",
 		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, (2 * NR_OF_MUTEX_RUNS)));
+
+#ifdef MUTEX_CONTENDED_TEST
+	mutex_contended_test();
+#endif
 }
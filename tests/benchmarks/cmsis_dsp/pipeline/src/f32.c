@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/dsp/pipeline.h>
+#include "../../common/benchmark_common.h"
+
+#define PATTERN_LENGTH	(256)
+#define NUM_TAPS	(16)
+#define NUM_STAGES	(2)
+#define DECIMATION	(4)
+
+static float32_t frame[PATTERN_LENGTH];
+static float32_t fir_coeffs[NUM_TAPS];
+static float32_t biquad_coeffs[5 * NUM_STAGES];
+
+static float32_t fir_state[ZDSP_FIR_STATE_SIZE(NUM_TAPS, PATTERN_LENGTH)];
+static float32_t decimate_state[ZDSP_FIR_STATE_SIZE(NUM_TAPS, PATTERN_LENGTH)];
+static float32_t biquad_state[ZDSP_BIQUAD_STATE_SIZE(NUM_STAGES)];
+
+static struct zdsp_gain_block gain;
+static struct zdsp_fir_block fir;
+static struct zdsp_decimate_block decimate;
+static struct zdsp_biquad_block biquad;
+static struct zdsp_rfft_block rfft;
+
+ZDSP_PIPELINE_DEFINE(filter_chain, PATTERN_LENGTH, &gain.block, &fir.block, &decimate.block,
+		     &biquad.block);
+ZDSP_PIPELINE_DEFINE(spectrum, PATTERN_LENGTH, &gain.block, &rfft.block);
+
+static void fill_frame(void)
+{
+	for (int i = 0; i < PATTERN_LENGTH; i++) {
+		frame[i] = (float32_t)((i * 37) % 101) / 101.0f - 0.5f;
+	}
+}
+
+static void *pipeline_setup(void)
+{
+	for (int i = 0; i < NUM_TAPS; i++) {
+		fir_coeffs[i] = 1.0f / NUM_TAPS;
+	}
+
+	for (int i = 0; i < NUM_STAGES; i++) {
+		biquad_coeffs[5 * i + 0] = 0.25f;
+		biquad_coeffs[5 * i + 1] = 0.5f;
+		biquad_coeffs[5 * i + 2] = 0.25f;
+		biquad_coeffs[5 * i + 3] = 0.5f;
+		biquad_coeffs[5 * i + 4] = -0.25f;
+	}
+
+	zdsp_gain_block_init(&gain, 0.5f);
+	zdsp_fir_block_init(&fir, fir_coeffs, NUM_TAPS, fir_state, PATTERN_LENGTH);
+	zassert_not_null(zdsp_decimate_block_init(&decimate, fir_coeffs, NUM_TAPS, DECIMATION,
+						  decimate_state, PATTERN_LENGTH));
+	zdsp_biquad_block_init(&biquad, biquad_coeffs, NUM_STAGES, biquad_state);
+	zassert_not_null(zdsp_rfft_block_init(&rfft, PATTERN_LENGTH));
+
+	return NULL;
+}
+
+ZTEST(pipeline_f32_benchmark, test_benchmark_filter_chain_f32)
+{
+	uint32_t irq_key, timestamp, timespan;
+	float32_t *output;
+	int ret;
+
+	fill_frame();
+
+	/* Begin benchmark */
+	benchmark_begin(&irq_key, &timestamp);
+
+	/* Execute function */
+	ret = zdsp_pipeline_process(&filter_chain, frame, PATTERN_LENGTH, &output);
+
+	/* End benchmark */
+	timespan = benchmark_end(irq_key, timestamp);
+
+	zassert_equal(ret, PATTERN_LENGTH / DECIMATION, "pipeline failed: %d", ret);
+
+	/* Print result */
+	TC_PRINT(BENCHMARK_TYPE " = %u\n", timespan);
+}
+
+ZTEST(pipeline_f32_benchmark, test_benchmark_spectrum_f32)
+{
+	uint32_t irq_key, timestamp, timespan;
+	float32_t *output;
+	int ret;
+
+	fill_frame();
+
+	/* Begin benchmark */
+	benchmark_begin(&irq_key, &timestamp);
+
+	/* Execute function */
+	ret = zdsp_pipeline_process(&spectrum, frame, PATTERN_LENGTH, &output);
+
+	/* End benchmark */
+	timespan = benchmark_end(irq_key, timestamp);
+
+	zassert_equal(ret, PATTERN_LENGTH, "pipeline failed: %d", ret);
+
+	/* Print result */
+	TC_PRINT(BENCHMARK_TYPE " = %u\n", timespan);
+}
+
+ZTEST_SUITE(pipeline_f32_benchmark, NULL, pipeline_setup, NULL, NULL, NULL);
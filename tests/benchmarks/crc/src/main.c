@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/timing/timing.h>
+
+#define BUF_SIZE   4096
+#define ITERATIONS 64
+
+/* One more byte than used, so the data can start unaligned */
+static uint8_t buf[BUF_SIZE + 1];
+static const uint8_t *data = &buf[1];
+
+static volatile uint32_t sink;
+
+static void report(const char *name, timing_t *start, timing_t *end)
+{
+	uint64_t ns = timing_cycles_to_ns(timing_cycles_get(start, end));
+	uint64_t bytes = (uint64_t)BUF_SIZE * ITERATIONS;
+
+	TC_PRINT("%s: %llu bytes in %llu ns (%llu KiB/s)\n", name, (unsigned long long)bytes,
+		 (unsigned long long)ns,
+		 ns > 0 ? (unsigned long long)(bytes * NSEC_PER_SEC / 1024 / ns) : 0ULL);
+}
+
+ZTEST(crc_perf, test_crc32_ieee)
+{
+	timing_t start, end;
+
+	zassert_equal(crc32_ieee(data, BUF_SIZE), 0xe3de9855);
+
+	start = timing_counter_get();
+	for (int i = 0; i < ITERATIONS; i++) {
+		sink = crc32_ieee(data, BUF_SIZE);
+	}
+	end = timing_counter_get();
+
+	report("crc32_ieee", &start, &end);
+}
+
+ZTEST(crc_perf, test_crc32_c)
+{
+	timing_t start, end;
+
+	zassert_equal(crc32_c(0, data, BUF_SIZE, true, true), 0x20ffe541);
+
+	start = timing_counter_get();
+	for (int i = 0; i < ITERATIONS; i++) {
+		sink = crc32_c(0, data, BUF_SIZE, true, true);
+	}
+	end = timing_counter_get();
+
+	report("crc32_c", &start, &end);
+}
+
+ZTEST(crc_perf, test_crc16_ccitt)
+{
+	timing_t start, end;
+
+	zassert_equal(crc16_ccitt(0xffff, data, BUF_SIZE), 0xb87b);
+
+	start = timing_counter_get();
+	for (int i = 0; i < ITERATIONS; i++) {
+		sink = crc16_ccitt(0xffff, data, BUF_SIZE);
+	}
+	end = timing_counter_get();
+
+	report("crc16_ccitt", &start, &end);
+}
+
+static void *crc_perf_setup(void)
+{
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		buf[i] = (uint8_t)(i * 7 + 3);
+	}
+
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+ZTEST_SUITE(crc_perf, NULL, crc_perf_setup, NULL, NULL, NULL);
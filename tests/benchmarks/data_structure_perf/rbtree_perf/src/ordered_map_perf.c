@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Red/black tree versus B+tree: cost of inserting, looking up, walking
+ * and removing a set of keys inserted in random order.
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/rb.h>
+#include <zephyr/sys/btree.h>
+#include <zephyr/timing/timing.h>
+
+#define MAP_SIZE    1024
+/* Nodes are at least half full */
+#define BTREE_NODES (4 * MAP_SIZE / SYS_BTREE_ORDER)
+
+struct map_node {
+	struct rbnode node;
+	uint32_t key;
+};
+
+static struct map_node map_nodes[MAP_SIZE];
+static uint32_t keys[MAP_SIZE];
+
+SYS_BTREE_SLAB_DEFINE(btree_slab, BTREE_NODES);
+
+enum {
+	OP_INSERT,
+	OP_LOOKUP,
+	OP_WALK,
+	OP_REMOVE,
+	OP_COUNT,
+};
+
+static const char *const op_names[] = { "insert", "lookup", "walk", "remove" };
+
+static bool map_node_lessthan(struct rbnode *a, struct rbnode *b)
+{
+	return CONTAINER_OF(a, struct map_node, node)->key <
+	       CONTAINER_OF(b, struct map_node, node)->key;
+}
+
+static void report(const char *tree, uint64_t cycles[OP_COUNT])
+{
+	for (int op = 0; op < OP_COUNT; op++) {
+		TC_PRINT("%-8s %-6s: %6llu ns per key\n", tree, op_names[op],
+			 timing_cycles_to_ns(cycles[op]) / MAP_SIZE);
+	}
+}
+
+ZTEST(ordered_map_perf, test_rbtree)
+{
+	struct rbtree tree = { .lessthan_fn = map_node_lessthan };
+	uint64_t cycles[OP_COUNT];
+	struct map_node probe;
+	struct rbnode *node;
+	timing_t start, end;
+	uint32_t count = 0;
+	uint32_t prev = 0;
+
+	start = timing_counter_get();
+	ARRAY_FOR_EACH(map_nodes, i) {
+		rb_insert(&tree, &map_nodes[i].node);
+	}
+	end = timing_counter_get();
+	cycles[OP_INSERT] = timing_cycles_get(&start, &end);
+
+	start = timing_counter_get();
+	ARRAY_FOR_EACH(keys, i) {
+		probe.key = keys[i];
+		zassert_true(rb_contains(&tree, &probe.node));
+	}
+	end = timing_counter_get();
+	cycles[OP_LOOKUP] = timing_cycles_get(&start, &end);
+
+	start = timing_counter_get();
+	RB_FOR_EACH(&tree, node) {
+		uint32_t key = CONTAINER_OF(node, struct map_node, node)->key;
+
+		zassert_true(count == 0 || key > prev);
+		prev = key;
+		count++;
+	}
+	end = timing_counter_get();
+	cycles[OP_WALK] = timing_cycles_get(&start, &end);
+	zassert_equal(count, MAP_SIZE);
+
+	start = timing_counter_get();
+	ARRAY_FOR_EACH(map_nodes, i) {
+		rb_remove(&tree, &map_nodes[i].node);
+	}
+	end = timing_counter_get();
+	cycles[OP_REMOVE] = timing_cycles_get(&start, &end);
+	zassert_is_null(rb_get_min(&tree));
+
+	report("rbtree", cycles);
+}
+
+ZTEST(ordered_map_perf, test_btree)
+{
+	uint64_t cycles[OP_COUNT];
+	struct sys_btree tree;
+	struct sys_btree_iter iter;
+	sys_btree_key_t key;
+	timing_t start, end;
+	uint32_t count = 0;
+	uint32_t prev = 0;
+	void *val;
+
+	sys_btree_init(&tree, &btree_slab);
+
+	start = timing_counter_get();
+	ARRAY_FOR_EACH(map_nodes, i) {
+		zassert_ok(sys_btree_insert(&tree, keys[i], &map_nodes[i]));
+	}
+	end = timing_counter_get();
+	cycles[OP_INSERT] = timing_cycles_get(&start, &end);
+	zassert_equal(sys_btree_size(&tree), MAP_SIZE);
+	zassert_equal(sys_btree_insert(&tree, keys[0], NULL), -EEXIST);
+
+	start = timing_counter_get();
+	ARRAY_FOR_EACH(keys, i) {
+		zassert_equal_ptr(sys_btree_get(&tree, keys[i]), &map_nodes[i]);
+	}
+	end = timing_counter_get();
+	cycles[OP_LOOKUP] = timing_cycles_get(&start, &end);
+
+	start = timing_counter_get();
+	SYS_BTREE_FOR_EACH(&tree, iter, key, val) {
+		zassert_true(count == 0 || key > prev);
+		zassert_equal(((struct map_node *)val)->key, key);
+		prev = key;
+		count++;
+	}
+	end = timing_counter_get();
+	cycles[OP_WALK] = timing_cycles_get(&start, &end);
+	zassert_equal(count, MAP_SIZE);
+
+	start = timing_counter_get();
+	ARRAY_FOR_EACH(keys, i) {
+		zassert_equal_ptr(sys_btree_remove(&tree, keys[i]), &map_nodes[i]);
+	}
+	end = timing_counter_get();
+	cycles[OP_REMOVE] = timing_cycles_get(&start, &end);
+	zassert_equal(sys_btree_size(&tree), 0);
+	zassert_false(sys_btree_min(&tree, &key, NULL));
+	zassert_equal(k_mem_slab_num_used_get(&btree_slab), 0);
+
+	report("btree", cycles);
+}
+
+static void *ordered_map_perf_setup(void)
+{
+	/* Unique keys in a random order: a multiplicative permutation of 0..MAP_SIZE - 1 */
+	ARRAY_FOR_EACH(keys, i) {
+		keys[i] = (i * 2654435761U) % MAP_SIZE * 7919U + 1U;
+		map_nodes[i].key = keys[i];
+	}
+
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+ZTEST_SUITE(ordered_map_perf, NULL, ordered_map_perf_setup, NULL, NULL, NULL);
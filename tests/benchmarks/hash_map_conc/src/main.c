@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/hash_map.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+
+/* This is a read-mostly benchmark of the concurrent hashmap.  Several
+ * reader threads look up a preloaded set of keys while a writer thread
+ * inserts then removes as many other keys, growing and shrinking the
+ * map meanwhile.  All the threads run at the same priority so that, on
+ * SMP, they run on every CPU at once.  The workload is run twice, once
+ * on the lock-free lookups of a concurrent hashmap and once on an open
+ * addressing hashmap guarded by a k_mutex, and the total and average
+ * number of cycles per lookup are reported for each.
+ *
+ * The preloaded keys are never removed, so every lookup must find its
+ * key with the expected value.
+ */
+
+#define N_READERS 2
+#define N_KEYS 128
+#define N_LOOKUPS 20000
+#define N_CHURN 256
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+SYS_HASHMAP_CONC_DEFINE_STATIC_ADVANCED(conc_map, sys_hash32, realloc,
+					SYS_HASHMAP_CONFIG(SIZE_MAX, SYS_HASHMAP_DEFAULT_LOAD_FACTOR));
+SYS_HASHMAP_OA_LP_DEFINE_STATIC_ADVANCED(oa_lp_map, sys_hash32, realloc,
+					 SYS_HASHMAP_CONFIG(SIZE_MAX,
+							    SYS_HASHMAP_DEFAULT_LOAD_FACTOR));
+static K_MUTEX_DEFINE(oa_lp_lock);
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, N_READERS + 1, STACK_SIZE);
+static struct k_thread threads[N_READERS + 1];
+
+static K_SEM_DEFINE(start_sem, 0, N_READERS + 1);
+static atomic_t failures;
+
+struct bench {
+	const char *name;
+	struct sys_hashmap *map;
+	/* NULL for the concurrent hashmap */
+	struct k_mutex *lock;
+};
+
+static void bench_lock(const struct bench *b)
+{
+	if (b->lock != NULL) {
+		k_mutex_lock(b->lock, K_FOREVER);
+	}
+}
+
+static void bench_unlock(const struct bench *b)
+{
+	if (b->lock != NULL) {
+		k_mutex_unlock(b->lock);
+	}
+}
+
+static void reader(void *p1, void *p2, void *p3)
+{
+	const struct bench *b = p1;
+	uint32_t offset = (uint32_t)(uintptr_t)p2;
+	uint64_t value;
+	bool found;
+
+	ARG_UNUSED(p3);
+
+	k_sem_take(&start_sem, K_FOREVER);
+	for (uint32_t i = 0; i < N_LOOKUPS; i++) {
+		uint64_t key = (offset + i * 7919U) % N_KEYS;
+
+		bench_lock(b);
+		found = sys_hashmap_get(b->map, key, &value);
+		bench_unlock(b);
+
+		if (!found || value != 3 * key) {
+			atomic_inc(&failures);
+		}
+	}
+}
+
+static void writer(void *p1, void *p2, void *p3)
+{
+	const struct bench *b = p1;
+	int ret;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_sem_take(&start_sem, K_FOREVER);
+	for (uint64_t key = N_KEYS; key < N_KEYS + N_CHURN; key++) {
+		bench_lock(b);
+		ret = sys_hashmap_insert(b->map, key, key, NULL);
+		bench_unlock(b);
+
+		if (ret != 1) {
+			atomic_inc(&failures);
+		}
+		k_yield();
+	}
+
+	for (uint64_t key = N_KEYS; key < N_KEYS + N_CHURN; key++) {
+		bench_lock(b);
+		ret = sys_hashmap_remove(b->map, key, NULL);
+		bench_unlock(b);
+
+		if (!ret) {
+			atomic_inc(&failures);
+		}
+		k_yield();
+	}
+}
+
+static bool run(const struct bench *b)
+{
+	const uint32_t n = N_READERS * N_LOOKUPS;
+	timing_t start, end;
+	uint64_t cycles;
+
+	atomic_clear(&failures);
+
+	for (uint64_t key = 0; key < N_KEYS; key++) {
+		if (sys_hashmap_insert(b->map, key, 3 * key, NULL) != 1) {
+			printk("%s: cannot preload the map\n", b->name);
+			return false;
+		}
+	}
+
+	for (int i = 0; i < N_READERS; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, reader, (void *)b,
+				(void *)(uintptr_t)(i * N_KEYS / N_READERS), NULL,
+				K_PRIO_PREEMPT(5), 0, K_NO_WAIT);
+	}
+	k_thread_create(&threads[N_READERS], stacks[N_READERS], STACK_SIZE, writer, (void *)b,
+			NULL, NULL, K_PRIO_PREEMPT(5), 0, K_NO_WAIT);
+
+	start = timing_counter_get();
+	for (int i = 0; i < N_READERS + 1; i++) {
+		k_sem_give(&start_sem);
+	}
+	for (int i = 0; i < N_READERS + 1; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+	end = timing_counter_get();
+
+	cycles = timing_cycles_get(&start, &end);
+	printk("%s lookups %u cycles %llu (avg %llu)\n", b->name, n,
+	       (unsigned long long)cycles, (unsigned long long)(cycles / n));
+
+	if (atomic_get(&failures) != 0 || sys_hashmap_size(b->map) != N_KEYS) {
+		printk("%s: lost or corrupted entries\n", b->name);
+		return false;
+	}
+
+	sys_hashmap_clear(b->map, NULL, NULL);
+
+	return true;
+}
+
+int main(void)
+{
+	const struct bench conc = { "conc", &conc_map, NULL };
+	const struct bench mutex = { "mutex", &oa_lp_map, &oa_lp_lock };
+	bool ok;
+
+	timing_init();
+	timing_start();
+
+	/* The main thread only waits, the workers run at a lower priority */
+	k_thread_priority_set(k_current_get(), K_PRIO_PREEMPT(0));
+
+	ok = run(&conc);
+	ok = run(&mutex) && ok;
+
+	timing_stop();
+
+	printk("fin\n");
+	if (ok) {
+		printk("PROJECT EXECUTION SUCCESSFUL\n");
+	} else {
+		printk("PROJECT EXECUTION FAILED\n");
+	}
+
+	return 0;
+}
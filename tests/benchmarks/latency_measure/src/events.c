@@ -13,6 +13,7 @@
  * 2. Immediately receiving any or all events.
  * 3. Blocking to receive either any or all events.
  * 4. Waking (and switching to) a thread waiting for any or all events.
+ * 5. Posting events to an event object many threads wait on.
  */
 
 #include <zephyr/kernel.h>
@@ -23,7 +24,17 @@
 #define BENCH_EVENT_SET  0x1234
 #define ALL_EVENTS       0xFFFFFFFF
 
+#define CONTENTION_WAITERS 4
+#define CONTENTION_EVENT   0x1
+#define UNRELATED_EVENT    0x100
+
 static K_EVENT_DEFINE(event_set);
+static K_EVENT_DEFINE(event_shared);
+static K_EVENT_DEFINE_OPTIONS(event_wake_one, K_EVENT_WAKE_ONE);
+
+static K_THREAD_STACK_ARRAY_DEFINE(waiter_stacks, CONTENTION_WAITERS,
+				   ALT_STACK_SIZE);
+static struct k_thread waiter_threads[CONTENTION_WAITERS];
 
 static void event_ops_entry(void *p1, void *p2, void *p3)
 {
@@ -330,3 +341,98 @@ int event_blocking_ops(uint32_t num_iterations, uint32_t start_options,
 
 	return 0;
 }
+
+static void waiter_thread_entry(void *p1, void *p2, void *p3)
+{
+	struct k_event *event = p1;
+	bool reset = (bool)(uintptr_t)p2;
+
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_event_wait(event, CONTENTION_EVENT, reset, K_FOREVER);
+	}
+}
+
+static void start_waiters(struct k_event *event, bool reset, int priority)
+{
+	for (int i = 0; i < CONTENTION_WAITERS; i++) {
+		k_thread_create(&waiter_threads[i], waiter_stacks[i],
+				K_THREAD_STACK_SIZEOF(waiter_stacks[i]),
+				waiter_thread_entry, event,
+				(void *)(uintptr_t)reset, NULL,
+				priority - 1, 0, K_NO_WAIT);
+	}
+}
+
+static void stop_waiters(void)
+{
+	for (int i = 0; i < CONTENTION_WAITERS; i++) {
+		k_thread_abort(&waiter_threads[i]);
+	}
+}
+
+static uint64_t post_events(struct k_event *event, uint32_t num_iterations,
+			    bool clear)
+{
+	timing_t  start;
+	timing_t  finish;
+
+	start = timing_timestamp_get();
+	for (uint32_t i = 0; i < num_iterations; i++) {
+		k_event_post(event, clear ? UNRELATED_EVENT : CONTENTION_EVENT);
+		if (clear) {
+			k_event_clear(event, UNRELATED_EVENT);
+		}
+	}
+	finish = timing_timestamp_get();
+
+	return timing_cycles_get(&start, &finish);
+}
+
+int event_contention_ops(uint32_t num_iterations)
+{
+	int       priority;
+	char      description[120];
+	uint64_t  cycles;
+
+	priority = k_thread_priority_get(k_current_get());
+
+	timing_start();
+
+	/* The waiters have a higher priority, and pend right away */
+
+	k_event_clear(&event_shared, ALL_EVENTS);
+	start_waiters(&event_shared, true, priority);
+
+	cycles = post_events(&event_shared, num_iterations, true);
+	snprintf(description, sizeof(description),
+		 "%-40s - Post and clear events no waiter waits for",
+		 "events.post.contention.unrelated");
+	PRINT_STATS_AVG(description, (uint32_t)cycles,
+			num_iterations, false, "");
+
+	cycles = post_events(&event_shared, num_iterations, false);
+	snprintf(description, sizeof(description),
+		 "%-40s - Post events waking all %d waiters",
+		 "events.post.contention.wake_all", CONTENTION_WAITERS);
+	PRINT_STATS_AVG(description, (uint32_t)cycles,
+			num_iterations, false, "");
+
+	stop_waiters();
+
+	start_waiters(&event_wake_one, false, priority);
+
+	cycles = post_events(&event_wake_one, num_iterations, false);
+	snprintf(description, sizeof(description),
+		 "%-40s - Post events waking 1 of %d waiters",
+		 "events.post.contention.wake_one", CONTENTION_WAITERS);
+	PRINT_STATS_AVG(description, (uint32_t)cycles,
+			num_iterations, false, "");
+
+	stop_waiters();
+
+	timing_stop();
+
+	return 0;
+}
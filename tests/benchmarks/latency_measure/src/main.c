@@ -40,6 +40,8 @@ extern void thread_switch_yield(uint32_t num_iterations, bool is_cooperative);
 extern void int_to_thread(uint32_t num_iterations);
 extern void sema_test_signal(uint32_t num_iterations, uint32_t options);
 extern void mutex_lock_unlock(uint32_t num_iterations, uint32_t options);
+extern int sys_mutex_lock_unlock(uint32_t num_iterations, uint32_t options);
+extern int syscall_overhead(uint32_t num_iterations, uint32_t options);
 extern void sema_context_switch(uint32_t num_iterations,
 				uint32_t start_options, uint32_t alt_options);
 extern int thread_ops(uint32_t num_iterations, uint32_t start_options,
@@ -53,12 +55,14 @@ extern int lifo_blocking_ops(uint32_t num_iterations, uint32_t start_options,
 extern int event_ops(uint32_t num_iterations, uint32_t options);
 extern int event_blocking_ops(uint32_t num_iterations, uint32_t start_options,
 			      uint32_t alt_options);
+extern int event_contention_ops(uint32_t num_iterations);
 extern int condvar_blocking_ops(uint32_t num_iterations, uint32_t start_options,
 				uint32_t alt_options);
 extern int stack_ops(uint32_t num_iterations, uint32_t options);
 extern int stack_blocking_ops(uint32_t num_iterations, uint32_t start_options,
 			       uint32_t alt_options);
 extern void heap_malloc_free(void);
+extern void timeout_arm_cancel(void);
 
 static void test_thread(void *arg1, void *arg2, void *arg3)
 {
@@ -138,6 +142,8 @@ static void test_thread(void *arg1, void *arg2, void *arg3)
 	event_blocking_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, K_USER, K_USER);
 #endif
 
+	event_contention_ops(CONFIG_BENCHMARK_NUM_ITERATIONS);
+
 	sema_test_signal(CONFIG_BENCHMARK_NUM_ITERATIONS, 0);
 #ifdef CONFIG_USERSPACE
 	sema_test_signal(CONFIG_BENCHMARK_NUM_ITERATIONS, K_USER);
@@ -174,8 +180,20 @@ static void test_thread(void *arg1, void *arg2, void *arg3)
 	mutex_lock_unlock(CONFIG_BENCHMARK_NUM_ITERATIONS, K_USER);
 #endif
 
+	sys_mutex_lock_unlock(CONFIG_BENCHMARK_NUM_ITERATIONS, 0);
+#ifdef CONFIG_USERSPACE
+	sys_mutex_lock_unlock(CONFIG_BENCHMARK_NUM_ITERATIONS, K_USER);
+#endif
+
+	syscall_overhead(CONFIG_BENCHMARK_NUM_ITERATIONS, 0);
+#ifdef CONFIG_USERSPACE
+	syscall_overhead(CONFIG_BENCHMARK_NUM_ITERATIONS, K_USER);
+#endif
+
 	heap_malloc_free();
 
+	timeout_arm_cancel();
+
 	TC_END_REPORT(error_count);
 }
 
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file measure time for uncontended sys_mutex and sys_sem operations
+ *
+ * This file contains the test that measures the time to lock and unlock a
+ * sys_mutex and a k_mutex, and to give and take a sys_sem, all without
+ * contention or recursion. With userspace and CONFIG_CURRENT_THREAD_USE_TLS
+ * the sys_mutex and sys_sem operations are done with atomic ops in user
+ * memory, the k_mutex figures give the cost of the syscalls they avoid.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/sys/mutex.h>
+#include <zephyr/sys/sem.h>
+#include <string.h>
+#include "utils.h"
+#include "timing_sc.h"
+
+static BENCH_BMEM SYS_MUTEX_DEFINE(test_sys_mutex);
+static BENCH_BMEM struct sys_sem test_sys_sem;
+static K_MUTEX_DEFINE(test_k_mutex);
+
+enum {
+	SYS_MUTEX_LOCK,
+	SYS_MUTEX_UNLOCK,
+	K_MUTEX_LOCK,
+	K_MUTEX_UNLOCK,
+	SYS_SEM_GIVE,
+	SYS_SEM_TAKE,
+	NUM_OPS
+};
+
+static BENCH_BMEM uint64_t op_cycles[NUM_OPS];
+
+static void start_sys_lock_unlock(void *p1, void *p2, void *p3)
+{
+	uint32_t  i;
+	uint32_t  num_iterations = (uint32_t)(uintptr_t)p1;
+	timing_t  start;
+	timing_t  mid;
+	timing_t  finish;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (i = 0; i < num_iterations; i++) {
+		start = timing_timestamp_get();
+		sys_mutex_lock(&test_sys_mutex, K_NO_WAIT);
+		mid = timing_timestamp_get();
+		sys_mutex_unlock(&test_sys_mutex);
+		finish = timing_timestamp_get();
+
+		op_cycles[SYS_MUTEX_LOCK] += timing_cycles_get(&start, &mid);
+		op_cycles[SYS_MUTEX_UNLOCK] += timing_cycles_get(&mid, &finish);
+	}
+
+	for (i = 0; i < num_iterations; i++) {
+		start = timing_timestamp_get();
+		k_mutex_lock(&test_k_mutex, K_NO_WAIT);
+		mid = timing_timestamp_get();
+		k_mutex_unlock(&test_k_mutex);
+		finish = timing_timestamp_get();
+
+		op_cycles[K_MUTEX_LOCK] += timing_cycles_get(&start, &mid);
+		op_cycles[K_MUTEX_UNLOCK] += timing_cycles_get(&mid, &finish);
+	}
+
+	for (i = 0; i < num_iterations; i++) {
+		start = timing_timestamp_get();
+		sys_sem_give(&test_sys_sem);
+		mid = timing_timestamp_get();
+		sys_sem_take(&test_sys_sem, K_NO_WAIT);
+		finish = timing_timestamp_get();
+
+		op_cycles[SYS_SEM_GIVE] += timing_cycles_get(&start, &mid);
+		op_cycles[SYS_SEM_TAKE] += timing_cycles_get(&mid, &finish);
+	}
+}
+
+static void report(const char *name, const char *what, uint64_t cycles,
+		   uint32_t num_iterations, uint32_t options)
+{
+	char tag[50];
+	char description[120];
+
+	snprintf(tag, sizeof(tag), "%s.immediate.%s", name,
+		 (options & K_USER) == K_USER ? "user" : "kernel");
+	snprintf(description, sizeof(description), "%-40s - %s", tag, what);
+	PRINT_STATS_AVG(description, (uint32_t)cycles, num_iterations,
+			false, "");
+}
+
+/**
+ *
+ * @brief Test for the uncontended sys_mutex and sys_sem operation times
+ *
+ * The routine locks and unlocks a sys_mutex and a k_mutex, and gives and
+ * takes a sys_sem, measuring the average time of each operation.
+ *
+ * @return 0 on success
+ */
+int sys_mutex_lock_unlock(uint32_t num_iterations, uint32_t options)
+{
+	int  priority;
+
+	timing_start();
+
+	sys_mutex_init(&test_sys_mutex);
+	sys_sem_init(&test_sys_sem, 0, 1);
+	memset(op_cycles, 0, sizeof(op_cycles));
+#ifdef CONFIG_SYS_SYNC_STATS
+	memset(&test_sys_mutex.stats, 0, sizeof(test_sys_mutex.stats));
+	memset(&test_sys_sem.stats, 0, sizeof(test_sys_sem.stats));
+#endif
+
+	priority = k_thread_priority_get(k_current_get());
+
+	k_thread_create(&start_thread, start_stack,
+			K_THREAD_STACK_SIZEOF(start_stack),
+			start_sys_lock_unlock,
+			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			priority - 1, options, K_FOREVER);
+
+#ifdef CONFIG_USERSPACE
+	k_thread_access_grant(&start_thread, &test_sys_mutex, &test_k_mutex);
+#endif
+	k_thread_start(&start_thread);
+	k_thread_join(&start_thread, K_FOREVER);
+
+	report("sys_mutex.lock", "Lock a sys_mutex",
+	       op_cycles[SYS_MUTEX_LOCK], num_iterations, options);
+	report("sys_mutex.unlock", "Unlock a sys_mutex",
+	       op_cycles[SYS_MUTEX_UNLOCK], num_iterations, options);
+	report("mutex.lock", "Lock a mutex",
+	       op_cycles[K_MUTEX_LOCK], num_iterations, options);
+	report("mutex.unlock", "Unlock a mutex",
+	       op_cycles[K_MUTEX_UNLOCK], num_iterations, options);
+	report("sys_sem.give", "Give a sys_sem",
+	       op_cycles[SYS_SEM_GIVE], num_iterations, options);
+	report("sys_sem.take", "Take a sys_sem",
+	       op_cycles[SYS_SEM_TAKE], num_iterations, options);
+
+#ifdef CONFIG_SYS_SYNC_STATS
+	struct sys_sync_stats stats;
+
+	sys_mutex_stats_get(&test_sys_mutex, &stats);
+	printk("sys_mutex: %ld fast path, %ld slow path\n",
+		 (long)stats.fast, (long)stats.slow);
+	sys_sem_stats_get(&test_sys_sem, &stats);
+	printk("sys_sem: %ld fast path, %ld slow path\n",
+		 (long)stats.fast, (long)stats.slow);
+#endif
+
+	timing_stop();
+	return 0;
+}
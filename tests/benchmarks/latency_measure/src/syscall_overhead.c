@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file measure time for a trivial system call
+ *
+ * This file contains the test that measures the time of k_sem_count_get()
+ * on a statically defined semaphore and, with CONFIG_DYNAMIC_OBJECTS, on a
+ * dynamically allocated one while other dynamic objects exist. From a user
+ * thread this is mostly the cost of entering the kernel and validating the
+ * object, the dynamic figure showing the cost of the dynamic object lookup.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include "utils.h"
+#include "timing_sc.h"
+
+/* Dynamic objects allocated besides the measured one */
+#define NUM_EXTRA_OBJECTS 32
+
+static K_SEM_DEFINE(static_sem, 0, 1);
+
+static BENCH_BMEM struct k_sem *dynamic_sem;
+static BENCH_BMEM uint64_t static_cycles;
+static BENCH_BMEM uint64_t dynamic_cycles;
+static BENCH_BMEM unsigned int dummy;
+
+static uint64_t count_get_cycles(struct k_sem *sem, uint32_t num_iterations)
+{
+	uint64_t cycles = 0;
+	timing_t start;
+	timing_t finish;
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+		start = timing_timestamp_get();
+		dummy += k_sem_count_get(sem);
+		finish = timing_timestamp_get();
+
+		cycles += timing_cycles_get(&start, &finish);
+	}
+
+	return cycles;
+}
+
+static void start_syscall(void *p1, void *p2, void *p3)
+{
+	uint32_t num_iterations = (uint32_t)(uintptr_t)p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	static_cycles = count_get_cycles(&static_sem, num_iterations);
+
+	if (dynamic_sem != NULL) {
+		dynamic_cycles = count_get_cycles(dynamic_sem, num_iterations);
+	}
+}
+
+static void report(const char *name, const char *what, uint64_t cycles,
+		   uint32_t num_iterations, uint32_t options)
+{
+	char tag[50];
+	char description[120];
+
+	snprintf(tag, sizeof(tag), "%s.%s", name,
+		 (options & K_USER) == K_USER ? "user" : "kernel");
+	snprintf(description, sizeof(description), "%-40s - %s", tag, what);
+	PRINT_STATS_AVG(description, (uint32_t)cycles, num_iterations,
+			false, "");
+}
+
+/**
+ *
+ * @brief Test for the time of a trivial system call
+ *
+ * The routine gets the count of a static and of a dynamically allocated
+ * semaphore, measuring the average time of each call.
+ *
+ * @return 0 on success
+ */
+int syscall_overhead(uint32_t num_iterations, uint32_t options)
+{
+	int  priority;
+
+	timing_start();
+
+	static_cycles = 0;
+	dynamic_cycles = 0;
+	dynamic_sem = NULL;
+
+#ifdef CONFIG_DYNAMIC_OBJECTS
+	void *extra[NUM_EXTRA_OBJECTS];
+
+	k_thread_system_pool_assign(k_current_get());
+
+	/* Surround the measured object with others, so that a lookup whose
+	 * cost depends on the number of objects shows up in the results.
+	 */
+	for (int i = 0; i < NUM_EXTRA_OBJECTS; i++) {
+		extra[i] = k_object_alloc(K_OBJ_SEM);
+		if (i == NUM_EXTRA_OBJECTS / 2) {
+			dynamic_sem = k_object_alloc(K_OBJ_SEM);
+		}
+	}
+
+	if (dynamic_sem == NULL) {
+		error_count++;
+		printk("Failed to allocate a dynamic semaphore\n");
+	} else {
+		k_sem_init(dynamic_sem, 0, 1);
+	}
+#endif
+
+	priority = k_thread_priority_get(k_current_get());
+
+	k_thread_create(&start_thread, start_stack,
+			K_THREAD_STACK_SIZEOF(start_stack),
+			start_syscall,
+			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			priority - 1, options, K_FOREVER);
+
+#ifdef CONFIG_USERSPACE
+	k_thread_access_grant(&start_thread, &static_sem);
+	if (dynamic_sem != NULL) {
+		k_object_access_grant(dynamic_sem, &start_thread);
+	}
+#endif
+	k_thread_start(&start_thread);
+	k_thread_join(&start_thread, K_FOREVER);
+
+	report("syscall.static", "Get count of a static semaphore",
+	       static_cycles, num_iterations, options);
+
+#ifdef CONFIG_DYNAMIC_OBJECTS
+	if (dynamic_sem != NULL) {
+		report("syscall.dynamic", "Get count of a dynamic semaphore",
+		       dynamic_cycles, num_iterations, options);
+		k_object_free(dynamic_sem);
+	}
+
+	for (int i = 0; i < NUM_EXTRA_OBJECTS; i++) {
+		if (extra[i] != NULL) {
+			k_object_free(extra[i]);
+		}
+	}
+#endif
+
+	timing_stop();
+	return 0;
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file measure time to arm and cancel many kernel timeouts
+ *
+ * This file contains the test that measures the average time needed to
+ * start and then stop a k_timer while CONFIG_BENCHMARK_NUM_TIMEOUTS other
+ * timeouts are already armed.  Expiries are scattered so that the cost of
+ * inserting into (and removing from) the kernel timeout queue is exposed.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include "utils.h"
+#include "timing_sc.h"
+
+static struct k_timer bench_timers[CONFIG_BENCHMARK_NUM_TIMEOUTS];
+
+/* Far enough in the future that nothing expires during the benchmark */
+#define TIMEOUT_BASE_TICKS 1000
+
+static k_timeout_t bench_timeout(uint32_t i)
+{
+	/* Scatter the expiries using a multiplicative hash of the index */
+	return K_TICKS(TIMEOUT_BASE_TICKS + ((i * 2654435761U) % 997U));
+}
+
+void timeout_arm_cancel(void)
+{
+	timing_t start;
+	timing_t finish;
+	uint64_t sum_start = 0ULL;
+	uint64_t sum_stop = 0ULL;
+	char description[120];
+	char tag[50];
+	uint32_t i;
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_TIMEOUTS; i++) {
+		k_timer_init(&bench_timers[i], NULL, NULL);
+	}
+
+	timing_start();
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_TIMEOUTS; i++) {
+		start = timing_timestamp_get();
+		k_timer_start(&bench_timers[i], bench_timeout(i), K_NO_WAIT);
+		finish = timing_timestamp_get();
+
+		sum_start += timing_cycles_get(&start, &finish);
+	}
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_TIMEOUTS; i++) {
+		start = timing_timestamp_get();
+		k_timer_stop(&bench_timers[i]);
+		finish = timing_timestamp_get();
+
+		sum_stop += timing_cycles_get(&start, &finish);
+	}
+
+	timing_stop();
+
+	sum_start -= timestamp_overhead_adjustment(0, 0) *
+		     CONFIG_BENCHMARK_NUM_TIMEOUTS;
+	sum_stop -= timestamp_overhead_adjustment(0, 0) *
+		    CONFIG_BENCHMARK_NUM_TIMEOUTS;
+
+	snprintf(tag, sizeof(tag), "timeout.arm.%u", CONFIG_BENCHMARK_NUM_TIMEOUTS);
+	snprintf(description, sizeof(description),
+		 "%-40s - Arm one of many timeouts", tag);
+	PRINT_STATS_AVG(description, (uint32_t)sum_start,
+			CONFIG_BENCHMARK_NUM_TIMEOUTS, false, "");
+
+	snprintf(tag, sizeof(tag), "timeout.cancel.%u", CONFIG_BENCHMARK_NUM_TIMEOUTS);
+	snprintf(description, sizeof(description),
+		 "%-40s - Cancel one of many timeouts", tag);
+	PRINT_STATS_AVG(description, (uint32_t)sum_stop,
+			CONFIG_BENCHMARK_NUM_TIMEOUTS, false, "");
+}
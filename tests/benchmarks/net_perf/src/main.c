@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Network stack benchmarks over the loopback interface.
+ *
+ * Besides the human readable summary, each measurement is printed as a
+ * single "NET_PERF <json>" line for regression tracking, e.g.
+ *   NET_PERF {"bench":"udp_tx","size":64,"packets":2000,"bytes":128000,
+ *             "ns":...,"cycles_per_pkt":...,"pps":...,"kbps":...}
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/net/socket.h>
+
+#include "net_private.h"
+
+#define SERVER_PORT   4242
+#define DEMUX_PORT    5000
+#define UDP_PACKETS   2000
+#define UDP_BURST     8
+#define TCP_BULK_SIZE (256 * 1024)
+#define TCP_CHUNK     1024
+#define TCP_CONNECTS  20
+#define DEMUX_PACKETS 1000
+#define CHKSUM_BYTES  (256 * 1024)
+
+static const size_t udp_sizes[] = {16, 256, 1024};
+static const size_t demux_counts[] = {1, 8, 32};
+static const size_t chksum_sizes[] = {20, 64, 512, 1460};
+
+static uint8_t tx_buf[1500];
+static uint8_t rx_buf[1500];
+static int demux_socks[32];
+
+static volatile uint16_t sink;
+
+static void report(const char *bench, const char *param, size_t value, uint32_t packets,
+		   uint64_t bytes, uint64_t cycles)
+{
+	uint64_t ns = MAX(timing_cycles_to_ns(cycles), 1);
+	uint64_t per_pkt = packets > 0 ? cycles / packets : 0;
+	uint64_t pps = (uint64_t)packets * NSEC_PER_SEC / ns;
+	uint64_t kbps = bytes * 8U * NSEC_PER_SEC / 1000U / ns;
+
+	TC_PRINT("%-12s %-8s %5zu: %8llu cycles per packet, %8llu packets/s, %8llu kbit/s\n",
+		 bench, param, value, per_pkt, pps, kbps);
+	TC_PRINT("NET_PERF {\"bench\":\"%s\",\"%s\":%zu,\"packets\":%u,\"bytes\":%llu,"
+		 "\"ns\":%llu,\"cycles_per_pkt\":%llu,\"pps\":%llu,\"kbps\":%llu}\n",
+		 bench, param, value, packets, bytes, ns, per_pkt, pps, kbps);
+}
+
+static void loopback_addr(struct sockaddr_in *addr, uint16_t port)
+{
+	memset(addr, 0, sizeof(*addr));
+	addr->sin_family = AF_INET;
+	addr->sin_port = htons(port);
+	zassert_equal(zsock_inet_pton(AF_INET, "127.0.0.1", &addr->sin_addr), 1);
+}
+
+static int udp_socket(uint16_t port)
+{
+	struct sockaddr_in addr;
+	int sock;
+
+	sock = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	zassert_true(sock >= 0, "socket failed (%d)", errno);
+
+	if (port != 0) {
+		loopback_addr(&addr, port);
+		zassert_ok(zsock_bind(sock, (struct sockaddr *)&addr, sizeof(addr)),
+			   "bind failed (%d)", errno);
+	}
+
+	return sock;
+}
+
+static void recv_all(int sock, size_t len)
+{
+	size_t got = 0;
+
+	while (got < len) {
+		ssize_t ret = zsock_recv(sock, rx_buf, MIN(len - got, sizeof(rx_buf)), 0);
+
+		zassert_true(ret > 0, "recv failed (%d)", errno);
+		got += ret;
+	}
+}
+
+/* Send to the server in bursts, then drain them, timing each side apart */
+static void udp_run(int client, int server, uint16_t port, size_t size, uint32_t packets,
+		    uint64_t *tx_cycles, uint64_t *rx_cycles)
+{
+	struct sockaddr_in addr;
+	timing_t start, end;
+
+	loopback_addr(&addr, port);
+	*tx_cycles = 0;
+	*rx_cycles = 0;
+
+	for (uint32_t sent = 0; sent < packets; sent += UDP_BURST) {
+		start = timing_counter_get();
+		for (int i = 0; i < UDP_BURST; i++) {
+			ssize_t ret = zsock_sendto(client, tx_buf, size, 0,
+						   (struct sockaddr *)&addr, sizeof(addr));
+
+			zassert_equal(ret, size, "sendto failed (%d)", errno);
+		}
+		end = timing_counter_get();
+		*tx_cycles += timing_cycles_get(&start, &end);
+
+		start = timing_counter_get();
+		for (int i = 0; i < UDP_BURST; i++) {
+			ssize_t ret = zsock_recv(server, rx_buf, sizeof(rx_buf), 0);
+
+			zassert_equal(ret, size, "recv failed (%d)", errno);
+		}
+		end = timing_counter_get();
+		*rx_cycles += timing_cycles_get(&start, &end);
+	}
+}
+
+/**
+ * UDP send and receive cost, per packet size.
+ */
+ZTEST(net_perf, test_udp)
+{
+	int server = udp_socket(SERVER_PORT);
+	int client = udp_socket(0);
+	uint64_t tx_cycles, rx_cycles;
+
+	ARRAY_FOR_EACH(udp_sizes, i) {
+		size_t size = udp_sizes[i];
+
+		udp_run(client, server, SERVER_PORT, size, UDP_PACKETS, &tx_cycles, &rx_cycles);
+
+		report("udp_tx", "size", size, UDP_PACKETS, (uint64_t)UDP_PACKETS * size,
+		       tx_cycles);
+		report("udp_rx", "size", size, UDP_PACKETS, (uint64_t)UDP_PACKETS * size,
+		       rx_cycles);
+	}
+
+	zassert_ok(zsock_close(client));
+	zassert_ok(zsock_close(server));
+}
+
+/**
+ * UDP receive cost when the destination is one of N bound sockets, which
+ * measures the demultiplexing of net_conn_input().
+ */
+ZTEST(net_perf, test_udp_demux)
+{
+	int client = udp_socket(0);
+	uint64_t tx_cycles, rx_cycles;
+
+	zassert_true(ARRAY_SIZE(demux_socks) >= demux_counts[ARRAY_SIZE(demux_counts) - 1]);
+
+	ARRAY_FOR_EACH(demux_counts, i) {
+		size_t count = demux_counts[i];
+
+		for (size_t j = 0; j < count; j++) {
+			demux_socks[j] = udp_socket(DEMUX_PORT + j);
+		}
+
+		/* The last bound socket is the worst case of a linear lookup */
+		udp_run(client, demux_socks[count - 1], DEMUX_PORT + count - 1, 16,
+			DEMUX_PACKETS, &tx_cycles, &rx_cycles);
+
+		report("udp_demux", "sockets", count, DEMUX_PACKETS,
+		       (uint64_t)DEMUX_PACKETS * 16, tx_cycles + rx_cycles);
+
+		for (size_t j = 0; j < count; j++) {
+			zassert_ok(zsock_close(demux_socks[j]));
+		}
+	}
+
+	zassert_ok(zsock_close(client));
+}
+
+static int tcp_listen(void)
+{
+	struct sockaddr_in addr;
+	int sock;
+
+	sock = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	zassert_true(sock >= 0, "socket failed (%d)", errno);
+
+	loopback_addr(&addr, SERVER_PORT);
+	zassert_ok(zsock_bind(sock, (struct sockaddr *)&addr, sizeof(addr)),
+		   "bind failed (%d)", errno);
+	zassert_ok(zsock_listen(sock, 1), "listen failed (%d)", errno);
+
+	return sock;
+}
+
+static void tcp_connect(int listener, int *client, int *server)
+{
+	struct sockaddr_in addr;
+
+	*client = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	zassert_true(*client >= 0, "socket failed (%d)", errno);
+
+	loopback_addr(&addr, SERVER_PORT);
+	zassert_ok(zsock_connect(*client, (struct sockaddr *)&addr, sizeof(addr)),
+		   "connect failed (%d)", errno);
+
+	*server = zsock_accept(listener, NULL, NULL);
+	zassert_true(*server >= 0, "accept failed (%d)", errno);
+}
+
+/**
+ * TCP bulk transfer throughput.
+ */
+ZTEST(net_perf, test_tcp_bulk)
+{
+	int listener = tcp_listen();
+	int client, server;
+	timing_t start, end;
+
+	tcp_connect(listener, &client, &server);
+
+	start = timing_counter_get();
+	for (size_t sent = 0; sent < TCP_BULK_SIZE; sent += TCP_CHUNK) {
+		ssize_t ret = zsock_send(client, tx_buf, TCP_CHUNK, 0);
+
+		zassert_equal(ret, TCP_CHUNK, "send failed (%d)", errno);
+		recv_all(server, TCP_CHUNK);
+	}
+	end = timing_counter_get();
+
+	report("tcp_bulk", "chunk", TCP_CHUNK, TCP_BULK_SIZE / TCP_CHUNK, TCP_BULK_SIZE,
+	       timing_cycles_get(&start, &end));
+
+	zassert_ok(zsock_close(client));
+	zassert_ok(zsock_close(server));
+	zassert_ok(zsock_close(listener));
+}
+
+/**
+ * TCP connection setup and teardown cost, one "packet" per connection.
+ */
+ZTEST(net_perf, test_tcp_connect)
+{
+	int listener = tcp_listen();
+	int client, server;
+	timing_t start, end;
+	uint64_t cycles = 0;
+
+	for (int i = 0; i < TCP_CONNECTS; i++) {
+		start = timing_counter_get();
+		tcp_connect(listener, &client, &server);
+		zassert_ok(zsock_close(client));
+		zassert_ok(zsock_close(server));
+		end = timing_counter_get();
+
+		cycles += timing_cycles_get(&start, &end);
+	}
+
+	report("tcp_connect", "count", TCP_CONNECTS, TCP_CONNECTS, 0, cycles);
+
+	zassert_ok(zsock_close(listener));
+}
+
+/**
+ * Internet checksum cost, per buffer size.
+ */
+ZTEST(net_perf, test_checksum)
+{
+	timing_t start, end;
+
+	ARRAY_FOR_EACH(chksum_sizes, i) {
+		size_t size = chksum_sizes[i];
+		uint32_t count = CHKSUM_BYTES / size;
+
+		start = timing_counter_get();
+		for (uint32_t j = 0; j < count; j++) {
+			sink = calc_chksum(0, tx_buf, size);
+		}
+		end = timing_counter_get();
+
+		report("checksum", "size", size, count, (uint64_t)count * size,
+		       timing_cycles_get(&start, &end));
+	}
+}
+
+static void *net_perf_setup(void)
+{
+	for (size_t i = 0; i < sizeof(tx_buf); i++) {
+		tx_buf[i] = (uint8_t)(i * 7 + 3);
+	}
+
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+ZTEST_SUITE(net_perf, NULL, net_perf_setup, NULL, NULL, NULL);
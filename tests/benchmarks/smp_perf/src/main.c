@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * SMP scalability benchmarks: cross-CPU IPC, wakeup latency, work queue
+ * throughput, spinlock contention and timeout insertion at scale.
+ *
+ * Each result is also printed as "SMP_PERF <json>" for twister to record.
+ * The wakeup latency compares timestamps taken on different CPUs, so it
+ * expects the timing counter to be synchronized across CPUs.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+
+#define NUM_CPUS       CONFIG_MP_MAX_NUM_CPUS
+#define NUM_THREADS    MAX(NUM_CPUS, 4)
+#define STACK_SIZE     (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define THREAD_PRIO    K_PRIO_PREEMPT(1)
+
+#define PINGPONG_COUNT 10000
+#define WAKEUP_COUNT   1000
+#define SPIN_COUNT     100000
+#define WORK_ITEMS     16
+#define WORK_ROUNDS    500
+#define MAX_TIMEOUTS   1024
+
+static struct k_thread threads[NUM_THREADS];
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS, STACK_SIZE);
+
+static void report(const char *bench, const char *param, uint32_t value, uint32_t ops,
+		   uint64_t cycles)
+{
+	uint64_t ns = MAX(timing_cycles_to_ns(cycles), 1);
+	uint64_t per_op = ops > 0 ? cycles / ops : 0;
+	uint64_t ops_per_sec = (uint64_t)ops * NSEC_PER_SEC / ns;
+
+	TC_PRINT("%-16s %-8s %4u: %8llu cycles per op, %10llu ops/s\n", bench, param, value,
+		 per_op, ops_per_sec);
+	TC_PRINT("SMP_PERF {\"bench\":\"%s\",\"%s\":%u,\"ops\":%u,\"ns\":%llu,"
+		 "\"cycles_per_op\":%llu,\"ops_per_sec\":%llu}\n",
+		 bench, param, value, ops, ns, per_op, ops_per_sec);
+}
+
+/* Start a thread, pinned to a CPU unless cpu is negative */
+static void spawn(int idx, k_thread_entry_t fn, int cpu, void *p1, void *p2)
+{
+	k_thread_create(&threads[idx], stacks[idx], K_THREAD_STACK_SIZEOF(stacks[idx]), fn, p1,
+			p2, NULL, THREAD_PRIO, 0, K_FOREVER);
+	if (cpu >= 0) {
+		zassert_ok(k_thread_cpu_pin(&threads[idx], cpu));
+	}
+	k_thread_start(&threads[idx]);
+}
+
+static void join(int count)
+{
+	for (int i = 0; i < count; i++) {
+		zassert_ok(k_thread_join(&threads[i], K_FOREVER));
+	}
+}
+
+/* Semaphore and mutex ping-pong */
+
+static K_SEM_DEFINE(sem_ping, 0, 1);
+static K_SEM_DEFINE(sem_pong, 0, 1);
+static K_MUTEX_DEFINE(mutex);
+static uint64_t pingpong_cycles;
+
+static void sem_pinger(void *p1, void *p2, void *p3)
+{
+	timing_t start, end;
+
+	start = timing_counter_get();
+	for (int i = 0; i < PINGPONG_COUNT; i++) {
+		k_sem_give(&sem_ping);
+		k_sem_take(&sem_pong, K_FOREVER);
+	}
+	end = timing_counter_get();
+
+	pingpong_cycles = timing_cycles_get(&start, &end);
+}
+
+static void sem_ponger(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < PINGPONG_COUNT; i++) {
+		k_sem_take(&sem_ping, K_FOREVER);
+		k_sem_give(&sem_pong);
+	}
+}
+
+/**
+ * Round trips between two threads on different CPUs, through semaphores.
+ */
+ZTEST(smp_perf, test_sem_pingpong)
+{
+	spawn(1, sem_ponger, 1, NULL, NULL);
+	spawn(0, sem_pinger, 0, NULL, NULL);
+	join(2);
+
+	report("sem_pingpong", "cpus", 2, PINGPONG_COUNT, pingpong_cycles);
+}
+
+static void mutex_contender(void *p1, void *p2, void *p3)
+{
+	uint64_t *cycles = p1;
+	timing_t start, end;
+
+	start = timing_counter_get();
+	for (int i = 0; i < PINGPONG_COUNT; i++) {
+		k_mutex_lock(&mutex, K_FOREVER);
+		arch_nop();
+		k_mutex_unlock(&mutex);
+	}
+	end = timing_counter_get();
+
+	*cycles = timing_cycles_get(&start, &end);
+}
+
+/**
+ * Mutex lock and unlock by two threads on different CPUs.
+ */
+ZTEST(smp_perf, test_mutex_contention)
+{
+	static uint64_t cycles[2];
+
+	spawn(0, mutex_contender, 0, &cycles[0], NULL);
+	spawn(1, mutex_contender, 1, &cycles[1], NULL);
+	join(2);
+
+	report("mutex_contention", "cpus", 2, 2 * PINGPONG_COUNT, MAX(cycles[0], cycles[1]));
+}
+
+/* Wakeup of a thread waiting on another CPU */
+
+static K_SEM_DEFINE(sem_wake, 0, 1);
+static K_SEM_DEFINE(sem_woken, 0, 1);
+static volatile timing_t wake_start;
+static uint64_t wake_total;
+static uint64_t wake_max;
+
+static void waker(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < WAKEUP_COUNT; i++) {
+		/* Let the sleeper reach its idle CPU */
+		k_busy_wait(100);
+		wake_start = timing_counter_get();
+		k_sem_give(&sem_wake);
+		k_sem_take(&sem_woken, K_FOREVER);
+	}
+}
+
+static void sleeper(void *p1, void *p2, void *p3)
+{
+	timing_t start, end;
+	uint64_t cycles;
+
+	for (int i = 0; i < WAKEUP_COUNT; i++) {
+		k_sem_take(&sem_wake, K_FOREVER);
+		end = timing_counter_get();
+		start = wake_start;
+
+		cycles = timing_cycles_get(&start, &end);
+		wake_total += cycles;
+		wake_max = MAX(wake_max, cycles);
+		k_sem_give(&sem_woken);
+	}
+}
+
+/**
+ * Latency from a k_sem_give() to the waiting thread running on another,
+ * idle, CPU, which goes through an IPI where supported.
+ */
+ZTEST(smp_perf, test_ipi_wakeup)
+{
+	wake_total = 0;
+	wake_max = 0;
+
+	spawn(1, sleeper, 1, NULL, NULL);
+	spawn(0, waker, 0, NULL, NULL);
+	join(2);
+
+	report("ipi_wakeup", "cpus", 2, WAKEUP_COUNT, wake_total);
+	report("ipi_wakeup_max", "cpus", 2, 1, wake_max);
+}
+
+/* Work queue throughput */
+
+static struct k_work_q work_q;
+static K_THREAD_STACK_DEFINE(work_q_stack, STACK_SIZE);
+
+struct submitter;
+
+struct work_item {
+	struct k_work work;
+	struct submitter *sub;
+};
+
+struct submitter {
+	struct work_item items[WORK_ITEMS];
+	struct k_sem done;
+};
+
+static struct submitter submitters[NUM_THREADS];
+
+static void work_handler(struct k_work *work)
+{
+	struct work_item *item = CONTAINER_OF(work, struct work_item, work);
+
+	k_sem_give(&item->sub->done);
+}
+
+static void work_submitter(void *p1, void *p2, void *p3)
+{
+	struct submitter *sub = p1;
+
+	for (int round = 0; round < WORK_ROUNDS; round++) {
+		for (int i = 0; i < WORK_ITEMS; i++) {
+			zassert_true(k_work_submit_to_queue(&work_q, &sub->items[i].work) >= 0);
+		}
+		for (int i = 0; i < WORK_ITEMS; i++) {
+			k_sem_take(&sub->done, K_FOREVER);
+		}
+	}
+}
+
+/**
+ * Work items handled per second by one work queue, with 1 to 4 submitters.
+ */
+ZTEST(smp_perf, test_work_queue)
+{
+	timing_t start, end;
+
+	for (int count = 1; count <= NUM_THREADS; count *= 2) {
+		start = timing_counter_get();
+		for (int i = 0; i < count; i++) {
+			spawn(i, work_submitter, -1, &submitters[i], NULL);
+		}
+		join(count);
+		end = timing_counter_get();
+
+		report("work_queue", "threads", count, count * WORK_ROUNDS * WORK_ITEMS,
+		       timing_cycles_get(&start, &end));
+	}
+}
+
+/* Spinlock contention */
+
+static struct k_spinlock lock;
+static atomic_t spin_ready;
+static atomic_t spin_go;
+static uint32_t spin_counter;
+
+static void spinner(void *p1, void *p2, void *p3)
+{
+	uint64_t *cycles = p1;
+	timing_t start, end;
+
+	atomic_inc(&spin_ready);
+	while (!atomic_get(&spin_go)) {
+		arch_nop();
+	}
+
+	start = timing_counter_get();
+	for (int i = 0; i < SPIN_COUNT; i++) {
+		k_spinlock_key_t key = k_spin_lock(&lock);
+
+		spin_counter++;
+		k_spin_unlock(&lock, key);
+	}
+	end = timing_counter_get();
+
+	*cycles = timing_cycles_get(&start, &end);
+}
+
+/**
+ * Spinlock acquisitions per second with 1 up to all the CPUs contending.
+ */
+ZTEST(smp_perf, test_spinlock_contention)
+{
+	static uint64_t cycles[NUM_CPUS];
+
+	for (int count = 1; count <= NUM_CPUS; count++) {
+		uint64_t max = 0;
+
+		atomic_set(&spin_ready, 0);
+		atomic_set(&spin_go, 0);
+		spin_counter = 0;
+
+		for (int i = 0; i < count; i++) {
+			spawn(i, spinner, i, &cycles[i], NULL);
+		}
+		/* Sleep, the spinners may have a lower priority on this CPU */
+		while (atomic_get(&spin_ready) < count) {
+			k_msleep(1);
+		}
+		atomic_set(&spin_go, 1);
+		join(count);
+
+		for (int i = 0; i < count; i++) {
+			max = MAX(max, cycles[i]);
+		}
+
+		zassert_equal(spin_counter, count * SPIN_COUNT);
+		report("spinlock", "cpus", count, count * SPIN_COUNT, max);
+	}
+}
+
+/* Timeout insertion at scale */
+
+static struct k_timer timers[MAX_TIMEOUTS];
+
+/**
+ * Cost of starting and stopping a timer with N timeouts already queued.
+ */
+ZTEST(smp_perf, test_timeout_scale)
+{
+	static const uint32_t counts[] = {16, 128, MAX_TIMEOUTS};
+	timing_t start, end;
+
+	ARRAY_FOR_EACH(timers, i) {
+		k_timer_init(&timers[i], NULL, NULL);
+	}
+
+	ARRAY_FOR_EACH(counts, i) {
+		uint32_t count = counts[i];
+
+		start = timing_counter_get();
+		for (uint32_t j = 0; j < count; j++) {
+			/* Far and distinct expiries, spread over the queue */
+			k_timer_start(&timers[j], K_SECONDS(100 + (j * 7919) % count),
+				      K_NO_WAIT);
+		}
+		end = timing_counter_get();
+		report("timeout_insert", "timeouts", count, count,
+		       timing_cycles_get(&start, &end));
+
+		start = timing_counter_get();
+		for (uint32_t j = 0; j < count; j++) {
+			k_timer_stop(&timers[j]);
+		}
+		end = timing_counter_get();
+		report("timeout_abort", "timeouts", count, count,
+		       timing_cycles_get(&start, &end));
+	}
+}
+
+static void *smp_perf_setup(void)
+{
+	k_work_queue_start(&work_q, work_q_stack, K_THREAD_STACK_SIZEOF(work_q_stack),
+			   THREAD_PRIO, NULL);
+
+	ARRAY_FOR_EACH(submitters, i) {
+		for (int j = 0; j < WORK_ITEMS; j++) {
+			k_work_init(&submitters[i].items[j].work, work_handler);
+			submitters[i].items[j].sub = &submitters[i];
+		}
+		k_sem_init(&submitters[i].done, 0, WORK_ITEMS);
+	}
+
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+ZTEST_SUITE(smp_perf, NULL, smp_perf_setup, NULL, NULL, NULL);
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+
+#define BUF_SIZE    1024
+#define TOTAL_BYTES (64 * 1024)
+
+/* Room to offset both buffers from their word alignment */
+static uint8_t src_buf[BUF_SIZE + 8] __aligned(8);
+static uint8_t dst_buf[BUF_SIZE + 8] __aligned(8);
+
+static const size_t sizes[] = {1, 7, 16, 61, 256, 1024};
+
+/* Source and destination offsets from word alignment */
+static const size_t offsets[][2] = {{0, 0}, {1, 1}, {0, 3}};
+
+static volatile size_t sink;
+
+static void report(const char *name, size_t size, const size_t *offset, timing_t *start,
+		   timing_t *end)
+{
+	uint64_t ns = timing_cycles_to_ns(timing_cycles_get(start, end));
+	size_t iterations = TOTAL_BYTES / size;
+
+	TC_PRINT("%-8s size %4zu offsets %zu/%zu: %llu ns per call\n", name, size, offset[0],
+		 offset[1], iterations > 0 ? (unsigned long long)(ns / iterations) : 0ULL);
+}
+
+ZTEST(string_perf, test_memcpy)
+{
+	timing_t start, end;
+
+	ARRAY_FOR_EACH(offsets, i) {
+		uint8_t *src = &src_buf[offsets[i][0]];
+		uint8_t *dst = &dst_buf[offsets[i][1]];
+
+		ARRAY_FOR_EACH(sizes, j) {
+			size_t size = sizes[j];
+
+			memset(dst_buf, 0, sizeof(dst_buf));
+			memcpy(dst, src, size);
+			zassert_mem_equal(dst, src, size);
+			zassert_equal(dst[size], 0, "copied past the end");
+
+			start = timing_counter_get();
+			for (size_t k = 0; k < TOTAL_BYTES / size; k++) {
+				memcpy(dst, src, size);
+			}
+			end = timing_counter_get();
+
+			report("memcpy", size, offsets[i], &start, &end);
+		}
+	}
+}
+
+ZTEST(string_perf, test_memset)
+{
+	timing_t start, end;
+
+	ARRAY_FOR_EACH(offsets, i) {
+		uint8_t *dst = &dst_buf[offsets[i][1]];
+
+		ARRAY_FOR_EACH(sizes, j) {
+			size_t size = sizes[j];
+
+			memset(dst_buf, 0, sizeof(dst_buf));
+			memset(dst, 0xa5, size);
+			zassert_equal(dst[0], 0xa5);
+			zassert_equal(dst[size - 1], 0xa5);
+			zassert_equal(dst[size], 0, "set past the end");
+
+			start = timing_counter_get();
+			for (size_t k = 0; k < TOTAL_BYTES / size; k++) {
+				memset(dst, 0xa5, size);
+			}
+			end = timing_counter_get();
+
+			report("memset", size, offsets[i], &start, &end);
+		}
+	}
+}
+
+ZTEST(string_perf, test_memcmp)
+{
+	timing_t start, end;
+
+	ARRAY_FOR_EACH(offsets, i) {
+		uint8_t *src = &src_buf[offsets[i][0]];
+		uint8_t *dst = &dst_buf[offsets[i][1]];
+
+		ARRAY_FOR_EACH(sizes, j) {
+			size_t size = sizes[j];
+
+			memcpy(dst, src, size);
+			zassert_equal(memcmp(dst, src, size), 0);
+
+			/* A difference in the last byte must be found */
+			dst[size - 1]++;
+			zassert_true(memcmp(dst, src, size) > 0);
+			dst[size - 1] -= 2;
+			zassert_true(memcmp(dst, src, size) < 0);
+			dst[size - 1]++;
+
+			start = timing_counter_get();
+			for (size_t k = 0; k < TOTAL_BYTES / size; k++) {
+				sink = memcmp(dst, src, size);
+			}
+			end = timing_counter_get();
+
+			report("memcmp", size, offsets[i], &start, &end);
+		}
+	}
+}
+
+ZTEST(string_perf, test_strlen)
+{
+	timing_t start, end;
+
+	ARRAY_FOR_EACH(offsets, i) {
+		char *str = (char *)&dst_buf[offsets[i][1]];
+
+		ARRAY_FOR_EACH(sizes, j) {
+			size_t size = sizes[j];
+
+			memset(dst_buf, 'x', sizeof(dst_buf));
+			str[size - 1] = '\0';
+			zassert_equal(strlen(str), size - 1);
+
+			start = timing_counter_get();
+			for (size_t k = 0; k < TOTAL_BYTES / size; k++) {
+				sink = strlen(str);
+			}
+			end = timing_counter_get();
+
+			report("strlen", size, offsets[i], &start, &end);
+		}
+	}
+}
+
+static void *string_perf_setup(void)
+{
+	for (size_t i = 0; i < sizeof(src_buf); i++) {
+		/* No zero bytes, and no wrap around when changed by one */
+		src_buf[i] = (uint8_t)(0x10 + (i * 7 + 3) % 0x80);
+	}
+
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+ZTEST_SUITE(string_perf, NULL, string_perf_setup, NULL, NULL, NULL);
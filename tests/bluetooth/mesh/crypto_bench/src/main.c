@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/bluetooth/mesh.h>
+#include <zephyr/bluetooth/crypto.h>
+#include <zephyr/net/buf.h>
+
+#include "crypto.h"
+
+#define IV_INDEX   0x12345678
+#define ITERATIONS 200
+#define PDU_LEN    29
+
+static const uint8_t net_key[16] = {
+	0x7d, 0xd7, 0x36, 0x4c, 0xd8, 0x42, 0xad, 0x18,
+	0xc1, 0x7c, 0x2b, 0x82, 0x0c, 0x84, 0xc3, 0xd6,
+};
+
+/* Access message with a 4 byte MIC: IVI/NID, CTL/TTL, SEQ, SRC, DST */
+static const uint8_t plain_pdu[PDU_LEN - 4] = {
+	0x68, 0x03, 0x00, 0x00, 0x01, 0x12, 0x01, 0xff, 0xfd,
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+	0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+};
+
+static struct bt_mesh_key enc_key;
+static struct bt_mesh_key privacy_key;
+
+static void *crypto_bench_setup(void)
+{
+	uint8_t p = 0x00;
+	uint8_t nid;
+
+	zassert_ok(bt_mesh_crypto_init());
+	zassert_ok(bt_mesh_k2(net_key, &p, 1, &nid, &enc_key, &privacy_key));
+
+	return NULL;
+}
+
+/* Encode a network PDU as its source would */
+static void pdu_encode(struct net_buf_simple *buf)
+{
+	net_buf_simple_reset(buf);
+	net_buf_simple_add_mem(buf, plain_pdu, sizeof(plain_pdu));
+
+	zassert_ok(bt_mesh_net_encrypt(&enc_key, buf, IV_INDEX, BT_MESH_NONCE_NETWORK));
+	zassert_ok(bt_mesh_net_obfuscate(buf->data, IV_INDEX, &privacy_key));
+}
+
+ZTEST(bt_mesh_crypto_bench, test_ccm_matches_software)
+{
+	uint8_t nonce[13] = { 0x00, 0x03, 0x00, 0x00, 0x01, 0x12, 0x01 };
+	uint8_t sw[sizeof(plain_pdu) + 8];
+	uint8_t out[sizeof(plain_pdu) + 8];
+	uint8_t dec[sizeof(plain_pdu)];
+
+	for (size_t mic = 4; mic <= 8; mic += 4) {
+		zassert_ok(bt_ccm_encrypt(enc_key.key, nonce, plain_pdu, sizeof(plain_pdu), NULL,
+					  0, sw, mic));
+		zassert_ok(bt_mesh_ccm_encrypt(&enc_key, nonce, plain_pdu, sizeof(plain_pdu), NULL,
+					       0, out, mic));
+		zassert_mem_equal(out, sw, sizeof(plain_pdu) + mic);
+
+		zassert_ok(bt_mesh_ccm_decrypt(&enc_key, nonce, out, sizeof(plain_pdu), NULL, 0,
+					       dec, mic));
+		zassert_mem_equal(dec, plain_pdu, sizeof(plain_pdu));
+
+		/* In place, as done by the network layer */
+		zassert_ok(bt_mesh_ccm_decrypt(&enc_key, nonce, out, sizeof(plain_pdu), NULL, 0,
+					       out, mic));
+		zassert_mem_equal(out, plain_pdu, sizeof(plain_pdu));
+
+		sw[0] ^= 0x01;
+		zassert_not_ok(bt_mesh_ccm_decrypt(&enc_key, nonce, sw, sizeof(plain_pdu), NULL, 0,
+						   dec, mic));
+	}
+}
+
+/* Receive and relay a network PDU: deobfuscate, decrypt, then encrypt and
+ * obfuscate it again with a decremented TTL.
+ */
+ZTEST(bt_mesh_crypto_bench, test_relay)
+{
+	NET_BUF_SIMPLE_DEFINE(rx, PDU_LEN);
+	NET_BUF_SIMPLE_DEFINE(buf, PDU_LEN);
+	uint32_t start, cycles;
+
+	pdu_encode(&rx);
+	zassert_equal(rx.len, PDU_LEN);
+
+	start = k_cycle_get_32();
+
+	for (int i = 0; i < ITERATIONS; i++) {
+		net_buf_simple_reset(&buf);
+		net_buf_simple_add_mem(&buf, rx.data, rx.len);
+
+		zassert_ok(bt_mesh_net_obfuscate(buf.data, IV_INDEX, &privacy_key));
+		zassert_ok(bt_mesh_net_decrypt(&enc_key, &buf, IV_INDEX, BT_MESH_NONCE_NETWORK));
+
+		buf.data[1]--;
+
+		zassert_ok(bt_mesh_net_encrypt(&enc_key, &buf, IV_INDEX, BT_MESH_NONCE_NETWORK));
+		zassert_ok(bt_mesh_net_obfuscate(buf.data, IV_INDEX, &privacy_key));
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	/* The last relayed PDU decodes to the original one with a lower TTL */
+	zassert_ok(bt_mesh_net_obfuscate(buf.data, IV_INDEX, &privacy_key));
+	zassert_ok(bt_mesh_net_decrypt(&enc_key, &buf, IV_INDEX, BT_MESH_NONCE_NETWORK));
+	zassert_equal(buf.data[1], plain_pdu[1] - 1);
+	zassert_mem_equal(&buf.data[2], &plain_pdu[2], sizeof(plain_pdu) - 2);
+
+	TC_PRINT("Relayed %u PDUs, %u cycles per PDU (%s)\n", ITERATIONS, cycles / ITERATIONS,
+		 IS_ENABLED(CONFIG_BT_MESH_CRYPTO_DRIVER) ? "crypto driver" : "TinyCrypt");
+}
+
+ZTEST_SUITE(bt_mesh_crypto_bench, NULL, crypto_bench_setup, NULL, NULL, NULL);
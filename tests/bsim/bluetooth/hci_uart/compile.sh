@@ -17,4 +17,14 @@ app=tests/bsim/bluetooth/ll/conn conf_file=prj_split_hci_uart.conf conf_overlay=
 app=samples/bluetooth/hci_uart compile
 app=samples/bluetooth/hci_uart_async compile
 
+# GATT write throughput over a 1 Mbaud HCI UART, with the interrupt driven
+# and the async H:4 drivers
+app=tests/bsim/bluetooth/ll/throughput conf_file=prj_hci_uart.conf \
+    cmake_extra_args=-DEXTRA_DTC_OVERLAY_FILE=hci-uart.overlay compile
+app=tests/bsim/bluetooth/ll/throughput conf_file=prj_hci_uart.conf \
+    conf_overlay=overlay-h4_async.conf cmake_extra_args=-DEXTRA_DTC_OVERLAY_FILE=hci-uart.overlay compile
+app=samples/bluetooth/hci_uart exe_name=bs_${BOARD}_samples_bluetooth_hci_uart_1mbaud \
+    cmake_extra_args=-DEXTRA_DTC_OVERLAY_FILE=${ZEPHYR_BASE}/tests/bsim/bluetooth/hci_uart/uart-1mbaud.overlay \
+    compile
+
 wait_for_background_jobs
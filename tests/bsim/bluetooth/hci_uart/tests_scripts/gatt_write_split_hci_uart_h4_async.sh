@@ -0,0 +1,45 @@
+#!/usr/bin/env bash
+# Copyright (c) 2026 The Zephyr Project Contributors
+# SPDX-License-Identifier: Apache-2.0
+
+source ${ZEPHYR_BASE}/tests/bsim/sh_common.source
+
+# GATT write throughput test, reporting the write rate, with both hosts having
+# their controller in a separate device connected over a 1 Mbaud UART. The
+# hosts use the H:4 driver using the UART async API, the controllers are the HCI UART sample.
+simulation_id="gatt_write_split_hci_uart_h4_async"
+verbosity_level=2
+EXECUTE_TIMEOUT=120
+
+cd ${BSIM_OUT_PATH}/bin
+
+UART_DIR=/tmp/bs_${USER}/${simulation_id}/
+UART_PER=${UART_DIR}/peripheral
+UART_CEN=${UART_DIR}/central
+
+# Note the host+app devices are NOT connected to the phy, only the controllers are.
+
+# Central app + host:
+Execute ./bs_${BOARD_TS}_tests_bsim_bluetooth_ll_throughput_prj_hci_uart_conf_overlay-h4_async_conf \
+  -v=${verbosity_level} -s=${simulation_id} -d=10 -nosim -RealEncryption=0 \
+  -testid=central -rs=6 -uart1_fifob_rxfile=${UART_CEN}.rx -uart1_fifob_txfile=${UART_CEN}.tx
+
+# Central controller:
+Execute ./bs_${BOARD_TS}_samples_bluetooth_hci_uart_1mbaud \
+  -v=${verbosity_level} -s=${simulation_id} -d=0 -RealEncryption=0 \
+  -rs=23 -uart1_fifob_rxfile=${UART_CEN}.tx -uart1_fifob_txfile=${UART_CEN}.rx
+
+# Peripheral app + host:
+Execute ./bs_${BOARD_TS}_tests_bsim_bluetooth_ll_throughput_prj_hci_uart_conf_overlay-h4_async_conf \
+  -v=${verbosity_level} -s=${simulation_id} -d=11 -nosim -RealEncryption=0 \
+  -testid=peripheral -rs=23 -uart1_fifob_rxfile=${UART_PER}.rx -uart1_fifob_txfile=${UART_PER}.tx
+
+# Peripheral controller:
+Execute ./bs_${BOARD_TS}_samples_bluetooth_hci_uart_1mbaud \
+  -v=${verbosity_level} -s=${simulation_id} -d=1 -RealEncryption=0 \
+  -rs=23 -uart1_fifob_rxfile=${UART_PER}.tx -uart1_fifob_txfile=${UART_PER}.rx
+
+Execute ./bs_2G4_phy_v1 -v=${verbosity_level} -s=${simulation_id} \
+  -D=2 -sim_length=60e6 $@ -argschannel -at=40
+
+wait_for_background_jobs
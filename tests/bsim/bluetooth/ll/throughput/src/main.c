@@ -52,6 +52,18 @@ extern uint32_t peripheral_gatt_write(uint32_t count);
 
 extern enum bst_result_t bst_result;
 
+static bool write_rate_check(uint32_t write_rate)
+{
+	/* Across an HCI UART the rate depends on the UART and its driver, it
+	 * is only reported, to compare the drivers.
+	 */
+	if (!IS_ENABLED(CONFIG_BT_CTLR)) {
+		return write_rate > 0U;
+	}
+
+	return write_rate == WRITE_RATE;
+}
+
 static void test_central_main(void)
 {
 	uint32_t write_rate;
@@ -59,7 +71,7 @@ static void test_central_main(void)
 	write_rate = central_gatt_write(COUNT);
 
 	printk("%s: Write Rate = %u bps\n", __func__, write_rate);
-	if (write_rate == WRITE_RATE) {
+	if (write_rate_check(write_rate)) {
 		PASS("Central tests passed\n");
 	} else {
 		FAIL("Central tests failed\n");
@@ -78,7 +90,7 @@ static void test_peripheral_main(void)
 	write_rate = peripheral_gatt_write(COUNT);
 
 	printk("%s: Write Rate = %u bps\n", __func__, write_rate);
-	if (write_rate == WRITE_RATE) {
+	if (write_rate_check(write_rate)) {
 		PASS("Peripheral tests passed\n");
 	} else {
 		FAIL("Peripheral tests failed\n");
@@ -640,6 +640,89 @@ ZTEST_USER(adc_emul, test_adc_emul_ref_voltage_set)
 	check_empty_samples(samples * 2);
 }
 
+#ifdef CONFIG_ADC_STREAM
+#define STREAM_BATCH		4
+#define STREAM_BATCHES		3
+
+ADC_DT_STREAM_IODEV(adc_stream_iodev, ADC_DEVICE_NODE,
+		    BIT(ADC_1ST_CHANNEL_ID) | BIT(ADC_2ND_CHANNEL_ID),
+		    ADC_RESOLUTION, 100, STREAM_BATCH);
+RTIO_DEFINE_WITH_MEMPOOL(adc_stream_rtio, 4, 4, 8, 16, 4);
+
+/** @brief Test streaming two channels, batch after batch. */
+ZTEST(adc_emul, test_adc_emul_stream)
+{
+	const struct adc_stream_config *cfg = adc_stream_iodev.data;
+	const uint16_t input1_mv = 100;
+	const uint16_t input2_mv = 1500;
+	struct handle_seq_params channel1_param;
+	struct rtio_sqe *handle;
+	struct rtio_cqe *cqe;
+	uint32_t buf_len;
+	uint8_t *buf;
+	int32_t output;
+	int ret, i, n;
+
+	const struct device *adc_dev = get_adc_device();
+
+	channel_setup(adc_dev, ADC_REF_INTERNAL, ADC_GAIN_1,
+		      ADC_1ST_CHANNEL_ID);
+	channel_setup(adc_dev, ADC_REF_INTERNAL, ADC_GAIN_1,
+		      ADC_2ND_CHANNEL_ID);
+
+	channel1_param.value = input1_mv;
+	ret = adc_emul_value_func_set(adc_dev, ADC_1ST_CHANNEL_ID,
+				      handle_seq, &channel1_param);
+	zassert_ok(ret, "adc_emul_value_func_set() failed with code %d", ret);
+
+	ret = adc_emul_const_value_set(adc_dev, ADC_2ND_CHANNEL_ID, input2_mv);
+	zassert_ok(ret, "adc_emul_const_value_set() failed with code %d", ret);
+
+	ret = adc_stream(&adc_stream_iodev, &adc_stream_rtio, NULL, &handle);
+	zassert_ok(ret, "adc_stream() failed with code %d", ret);
+
+	for (n = 0; n < STREAM_BATCHES; n++) {
+		cqe = rtio_cqe_consume_block(&adc_stream_rtio);
+		zassert_ok(cqe->result, "batch %d failed with code %d", n,
+			   cqe->result);
+
+		ret = rtio_cqe_get_mempool_buffer(&adc_stream_rtio, cqe, &buf,
+						  &buf_len);
+		zassert_ok(ret, "no buffer in batch %d", n);
+		zassert_equal(buf_len, adc_stream_buffer_size(cfg));
+
+		/* The first channel keeps counting from one batch to the next */
+		for (i = 0; i < STREAM_BATCH; i++) {
+			output = ((int16_t *)buf)[2 * i];
+			adc_raw_to_millivolts(ADC_REF_INTERNAL_MV, ADC_GAIN_1,
+					      ADC_RESOLUTION, &output);
+			zassert_within(input1_mv + (n * STREAM_BATCH + i) *
+				       SEQUENCE_STEP, output, MV_OUTPUT_EPS);
+
+			output = ((int16_t *)buf)[2 * i + 1];
+			adc_raw_to_millivolts(ADC_REF_INTERNAL_MV, ADC_GAIN_1,
+					      ADC_RESOLUTION, &output);
+			zassert_within(input2_mv, output, MV_OUTPUT_EPS);
+		}
+
+		rtio_release_buffer(&adc_stream_rtio, buf, buf_len);
+		rtio_cqe_release(&adc_stream_rtio, cqe);
+	}
+
+	rtio_sqe_cancel(handle);
+
+	/* Drop the batch sampled meanwhile, if any */
+	k_msleep(10);
+	while ((cqe = rtio_cqe_consume(&adc_stream_rtio)) != NULL) {
+		if (rtio_cqe_get_mempool_buffer(&adc_stream_rtio, cqe, &buf,
+						&buf_len) == 0) {
+			rtio_release_buffer(&adc_stream_rtio, buf, buf_len);
+		}
+		rtio_cqe_release(&adc_stream_rtio, cqe);
+	}
+}
+#endif /* CONFIG_ADC_STREAM */
+
 void *adc_emul_setup(void)
 {
 	k_object_access_grant(get_adc_device(), k_current_get());
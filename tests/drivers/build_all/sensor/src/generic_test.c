@@ -215,6 +215,7 @@ static void run_generic_test(const struct device *dev)
 			/* Retrieve the actual value */
 			q31_t q;
 			int8_t shift;
+			int axis = 0;
 
 			switch (ch) {
 			/* Special handling to break out triplet samples. */
@@ -229,12 +230,14 @@ static void run_generic_test(const struct device *dev)
 			case SENSOR_CHAN_GYRO_Y:
 				q = decoded_data.three_axis.readings[0].y;
 				shift = decoded_data.three_axis.shift;
+				axis = 1;
 				break;
 			case SENSOR_CHAN_MAGN_Z:
 			case SENSOR_CHAN_ACCEL_Z:
 			case SENSOR_CHAN_GYRO_Z:
 				q = decoded_data.three_axis.readings[0].z;
 				shift = decoded_data.three_axis.shift;
+				axis = 2;
 				break;
 
 			/* Default case for single Q31 samples */
@@ -258,6 +261,22 @@ static void run_generic_test(const struct device *dev)
 				       expected_shifted, actual_shifted, shift, ch, iteration + 1,
 				       CONFIG_GENERIC_SENSOR_TEST_NUM_EXPECTED_VALS,
 				       expected_shifted - actual_shifted, epsilon_shifted);
+
+			/* The bulk decode must produce the same sample */
+			q31_t soa_values[3];
+			struct sensor_soa_data soa = {
+				.values = {&soa_values[0], &soa_values[1], &soa_values[2]},
+			};
+			uint32_t fit = 0;
+
+			rv = sensor_decode_soa(decoder, buf, ctx.channel, &fit, 1, &soa);
+			if (rv != -ENOTSUP) {
+				zassert_equal(1, rv, "Could not bulk decode (error %d, ch %d)", rv,
+					      ch);
+				zassert_equal(soa.shift, shift);
+				zassert_equal(soa_values[axis], q, "Bulk decode mismatch (ch %d)",
+					      ch);
+			}
 		}
 
 		/* Release the memory */
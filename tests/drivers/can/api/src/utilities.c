@@ -6,6 +6,7 @@
  */
 
 #include <zephyr/drivers/can.h>
+#include <zephyr/drivers/can/filter_table.h>
 #include <zephyr/ztest.h>
 
 #include "common.h"
@@ -116,4 +117,81 @@ ZTEST(can_utilities, test_can_frame_matches_filter)
 #endif /* CONFIG_CAN_FD_MODE */
 }
 
+struct test_filter_table_entry {
+	struct can_filter_table_entry entry;
+	int matches;
+};
+
+static void test_filter_table_cb(struct can_filter_table_entry *entry,
+				 const struct can_frame *frame, void *user_data)
+{
+	struct test_filter_table_entry *test_entry =
+		CONTAINER_OF(entry, struct test_filter_table_entry, entry);
+	int *matches = user_data;
+
+	test_entry->matches++;
+	(*matches)++;
+}
+
+/**
+ * @brief Test of the software CAN filter table
+ */
+ZTEST(can_utilities, test_can_filter_table)
+{
+	struct test_filter_table_entry entries[4] = {
+		{ .entry.filter = test_std_filter_1 },
+		{ .entry.filter = test_std_masked_filter_1 },
+		{ .entry.filter = test_ext_filter_1 },
+		{ .entry.filter = test_std_filter_2 },
+	};
+	sys_slist_t buckets[CAN_FILTER_TABLE_BUCKETS(ARRAY_SIZE(entries))];
+	struct can_filter_table table;
+	int matches;
+
+	zassert_true(can_filter_is_exact(&test_std_filter_1));
+	zassert_true(can_filter_is_exact(&test_ext_filter_1));
+	zassert_false(can_filter_is_exact(&test_std_masked_filter_1));
+	zassert_false(can_filter_is_exact(&test_ext_masked_filter_1));
+
+	can_filter_table_init(&table, buckets, ARRAY_SIZE(buckets));
+
+	ARRAY_FOR_EACH(entries, i) {
+		can_filter_table_add(&table, &entries[i].entry);
+	}
+
+	matches = 0;
+	can_filter_table_match(&table, &test_std_frame_1, test_filter_table_cb, &matches);
+	zassert_equal(matches, 2);
+	zassert_equal(entries[0].matches, 1);
+	zassert_equal(entries[1].matches, 1);
+
+	matches = 0;
+	can_filter_table_match(&table, &test_ext_frame_1, test_filter_table_cb, &matches);
+	zassert_equal(matches, 1);
+	zassert_equal(entries[2].matches, 1);
+
+	can_filter_table_remove(&table, &entries[0].entry);
+	can_filter_table_remove(&table, &entries[1].entry);
+
+	matches = 0;
+	can_filter_table_match(&table, &test_std_frame_1, test_filter_table_cb, &matches);
+	zassert_equal(matches, 0);
+	zassert_equal(entries[3].matches, 0);
+}
+
+/**
+ * @brief Test of @a can_filter_merge()
+ */
+ZTEST(can_utilities, test_can_filter_merge)
+{
+	struct can_filter merged;
+
+	zassert_true(can_filter_merge(&test_std_filter_1, &test_std_filter_2, &merged));
+	zassert_true(can_frame_matches_filter(&test_std_frame_1, &merged));
+	zassert_true(can_frame_matches_filter(&test_std_frame_2, &merged));
+	zassert_false(can_frame_matches_filter(&test_ext_frame_1, &merged));
+
+	zassert_false(can_filter_merge(&test_std_filter_1, &test_ext_filter_1, &merged));
+}
+
 ZTEST_SUITE(can_utilities, NULL, NULL, NULL, NULL, NULL);
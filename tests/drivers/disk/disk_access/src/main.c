@@ -13,6 +13,9 @@
 #include <zephyr/ztest.h>
 #include <zephyr/storage/disk_access.h>
 #include <zephyr/device.h>
+#ifdef CONFIG_DISK_ACCESS_RTIO
+#include <zephyr/storage/disk_access_rtio.h>
+#endif
 
 #ifdef CONFIG_DISK_DRIVER_LOOPBACK
 #include <ff.h>
@@ -275,6 +278,86 @@ ZTEST(disk_driver, test_write)
 	}
 }
 
+#ifdef CONFIG_DISK_CACHE
+/* Test that small accesses are served by the sector cache and written back on sync */
+ZTEST(disk_driver, test_cache)
+{
+	struct disk_cache_stats stats;
+	int rc;
+
+	if (disk_sector_size != CONFIG_DISK_CACHE_SECTOR_SIZE) {
+		ztest_test_skip();
+	}
+
+	/* Write back what the other tests left in the cache */
+	rc = disk_access_ioctl(disk_pdrv, DISK_IOCTL_CTRL_SYNC, NULL);
+	zassert_equal(rc, 0, "Disk sync failed");
+
+	rc = read_sector(scratch_buf[0], 0, 1);
+	zassert_equal(rc, 0, "Failed to read from disk");
+
+	disk_access_cache_stats_reset();
+	rc = read_sector(scratch_buf[1], 0, 1);
+	zassert_equal(rc, 0, "Failed to read from disk");
+	zassert_mem_equal(scratch_buf[0], scratch_buf[1], disk_sector_size);
+	disk_access_cache_stats_get(&stats);
+	zassert_equal(stats.hits, 1, "Cached sector not hit");
+	zassert_equal(stats.misses, 0, "Unexpected cache miss");
+
+	rc = write_sector_checked(scratch_buf[0], scratch_buf[1], 1, 1);
+	zassert_equal(rc, 0, "Failed to write to disk");
+
+	rc = disk_access_ioctl(disk_pdrv, DISK_IOCTL_CTRL_SYNC, NULL);
+	zassert_equal(rc, 0, "Disk sync failed");
+	disk_access_cache_stats_get(&stats);
+	zassert_equal(stats.write_backs, IS_ENABLED(CONFIG_DISK_CACHE_WRITE_BACK) ? 1 : 0,
+		      "Unexpected write back count");
+}
+#endif
+
+#ifdef CONFIG_DISK_ACCESS_RTIO
+DISK_ACCESS_IODEV_DEFINE(disk_iodev, DISK_NAME);
+RTIO_DEFINE(disk_rtio_ctx, 4, 4);
+
+/* Test chained sector writes and a read submitted through RTIO */
+ZTEST(disk_driver, test_rtio)
+{
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+	uint32_t half = SECTOR_COUNT1 / 2;
+	int rc, i;
+
+	for (i = 0; i < SECTOR_COUNT1 * disk_sector_size; i++) {
+		scratch_buf[0][i] = i ^ 0x5a;
+	}
+	memset(scratch_buf[1], 0, SECTOR_COUNT1 * disk_sector_size);
+
+	sqe = rtio_sqe_acquire(&disk_rtio_ctx);
+	rtio_sqe_prep_disk_write(sqe, &disk_iodev, RTIO_PRIO_NORM, scratch_buf[0], 0,
+				 half, NULL);
+	sqe->flags |= RTIO_SQE_CHAINED;
+	sqe = rtio_sqe_acquire(&disk_rtio_ctx);
+	rtio_sqe_prep_disk_write(sqe, &disk_iodev, RTIO_PRIO_NORM,
+				 &scratch_buf[0][half * disk_sector_size], half, half, NULL);
+	sqe->flags |= RTIO_SQE_CHAINED;
+	sqe = rtio_sqe_acquire(&disk_rtio_ctx);
+	rtio_sqe_prep_disk_read(sqe, &disk_iodev, RTIO_PRIO_NORM, scratch_buf[1], 0,
+				SECTOR_COUNT1, NULL);
+
+	rc = rtio_submit(&disk_rtio_ctx, 3);
+	zassert_equal(rc, 0, "RTIO submit failed");
+
+	for (i = 0; i < 3; i++) {
+		cqe = rtio_cqe_consume_block(&disk_rtio_ctx);
+		zassert_equal(cqe->result, 0, "RTIO disk op %d failed: %d", i, cqe->result);
+		rtio_cqe_release(&disk_rtio_ctx, cqe);
+	}
+
+	zassert_mem_equal(scratch_buf[0], scratch_buf[1], SECTOR_COUNT1 * disk_sector_size,
+			  "Read data did not match data written through RTIO");
+}
+#endif
+
 static void *disk_driver_setup(void)
 {
 #ifdef CONFIG_DISK_DRIVER_LOOPBACK
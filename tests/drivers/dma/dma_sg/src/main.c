@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/dma.h>
+#include <zephyr/drivers/dma/dma_sg.h>
+#include <zephyr/net/buf.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/ztest.h>
+
+#define MAX_BLOCKS 4
+#define CHUNK      32
+
+static const struct device *const dma = DEVICE_DT_GET(DT_NODELABEL(test_dma0));
+
+DMA_SG_DEFINE(test_sg, MAX_BLOCKS);
+NET_BUF_POOL_DEFINE(test_pool, 4, CHUNK, 0, NULL);
+
+static uint8_t src[MAX_BLOCKS][CHUNK];
+static uint8_t dst[MAX_BLOCKS * CHUNK];
+
+K_SEM_DEFINE(xfer_sem, 0, 1);
+
+static void xfer_done(const struct device *dev, void *user_data, uint32_t channel, int status)
+{
+	if (status >= 0) {
+		k_sem_give(&xfer_sem);
+	}
+}
+
+static void dma_sg_before(void *f)
+{
+	struct dma_config cfg = {
+		.channel_direction = MEMORY_TO_MEMORY,
+		.source_data_size = 1,
+		.dest_data_size = 1,
+		.source_burst_length = 1,
+		.dest_burst_length = 1,
+		.dma_callback = xfer_done,
+	};
+
+	ARG_UNUSED(f);
+
+	for (int i = 0; i < MAX_BLOCKS; i++) {
+		memset(src[i], i + 1, CHUNK);
+	}
+	memset(dst, 0, sizeof(dst));
+	k_sem_reset(&xfer_sem);
+
+	dma_sg_init(&test_sg, dma, 0, &cfg, DMA_SG_RELOAD);
+}
+
+static void run_and_check(size_t size)
+{
+	zassert_equal(dma_sg_size(&test_sg), size);
+	zassert_ok(dma_sg_start(&test_sg));
+	zassert_ok(k_sem_take(&xfer_sem, K_SECONDS(1)));
+
+	for (size_t i = 0; i < size; i++) {
+		zassert_equal(dst[i], i / CHUNK + 1, "byte %zu", i);
+	}
+}
+
+ZTEST(dma_sg, test_gather_mem)
+{
+	uint64_t addr = (uintptr_t)dst;
+
+	for (int i = 0; i < MAX_BLOCKS; i++) {
+		zassert_ok(dma_sg_add_mem(&test_sg, src[i], CHUNK, &addr));
+	}
+	zassert_equal(dma_sg_add_mem(&test_sg, src[0], CHUNK, &addr), -ENOMEM);
+	zassert_equal(addr, (uintptr_t)dst + sizeof(dst));
+
+	run_and_check(sizeof(dst));
+}
+
+ZTEST(dma_sg, test_restart_single)
+{
+	/* The emulator has no reload, the list falls back to a configuration */
+	for (int i = 0; i < 3; i++) {
+		memset(dst, 0, sizeof(dst));
+		dma_sg_reset(&test_sg);
+		zassert_ok(dma_sg_add(&test_sg, (uintptr_t)src[0], (uintptr_t)dst, CHUNK));
+		run_and_check(CHUNK);
+	}
+}
+
+ZTEST(dma_sg, test_net_buf)
+{
+	struct net_buf *frags = NULL;
+	struct net_buf *frag;
+
+	for (int i = 0; i < 3; i++) {
+		frag = net_buf_alloc(&test_pool, K_NO_WAIT);
+		zassert_not_null(frag);
+		net_buf_add_mem(frag, src[i], CHUNK);
+		frags = frags == NULL ? frag : net_buf_frag_add(frags, frag);
+	}
+
+	/* A chain not fitting in the list leaves it untouched */
+	zassert_ok(dma_sg_add(&test_sg, (uintptr_t)src[0], (uintptr_t)dst, 0));
+	zassert_ok(dma_sg_add(&test_sg, (uintptr_t)src[0], (uintptr_t)dst, 0));
+	zassert_equal(dma_sg_add_net_buf(&test_sg, frags, (uintptr_t)dst), -ENOMEM);
+	zassert_equal(dma_sg_size(&test_sg), 0);
+
+	dma_sg_reset(&test_sg);
+	zassert_ok(dma_sg_add_net_buf(&test_sg, frags, (uintptr_t)dst));
+	run_and_check(3 * CHUNK);
+
+	net_buf_unref(frags);
+}
+
+ZTEST(dma_sg, test_rtio)
+{
+	static struct rtio_iodev_sqe txn[2];
+
+	/* A transaction as handed to an iodev */
+	rtio_sqe_prep_write(&txn[0].sqe, NULL, RTIO_PRIO_NORM, src[0], CHUNK, NULL);
+	txn[0].sqe.flags = RTIO_SQE_TRANSACTION;
+	txn[0].next = &txn[1];
+	rtio_sqe_prep_write(&txn[1].sqe, NULL, RTIO_PRIO_NORM, src[1], CHUNK, NULL);
+
+	zassert_ok(dma_sg_add_rtio(&test_sg, &txn[0], (uintptr_t)dst));
+	run_and_check(2 * CHUNK);
+
+	/* Reads do not match a memory to memory channel */
+	rtio_sqe_prep_read(&txn[1].sqe, NULL, RTIO_PRIO_NORM, dst, CHUNK, NULL);
+	dma_sg_reset(&test_sg);
+	zassert_equal(dma_sg_add_rtio(&test_sg, &txn[0], (uintptr_t)dst), -EINVAL);
+	zassert_equal(dma_sg_size(&test_sg), 0);
+}
+
+ZTEST_SUITE(dma_sg, NULL, NULL, dma_sg_before, NULL, NULL);
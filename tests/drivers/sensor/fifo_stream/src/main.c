@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/drivers/sensor/fifo_stream.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/ztest.h>
+
+#define REG_FIFO_COUNT 0x2e
+#define REG_FIFO_DATA  0x30
+#define READ_FLAG      0x80
+#define FRAME_SIZE     6
+#define PERIOD_NS      10000
+
+/* Bus with a FIFO register returning a counting byte pattern */
+static struct {
+	uint8_t reg;
+	uint16_t level;
+	uint8_t next;
+	int err;
+} bus;
+
+static void bus_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct rtio_iodev_sqe *curr;
+
+	if (bus.err) {
+		rtio_iodev_sqe_err(iodev_sqe, bus.err);
+		return;
+	}
+
+	for (curr = iodev_sqe; curr != NULL; curr = rtio_txn_next(curr)) {
+		struct rtio_sqe *sqe = &curr->sqe;
+
+		if (sqe->op == RTIO_OP_TINY_TX) {
+			bus.reg = sqe->tiny_buf[0];
+		} else if (sqe->op == RTIO_OP_RX && bus.reg == (REG_FIFO_COUNT | READ_FLAG)) {
+			sys_put_le16(bus.level, sqe->buf);
+		} else if (sqe->op == RTIO_OP_RX && bus.reg == (REG_FIFO_DATA | READ_FLAG)) {
+			for (uint32_t i = 0; i < sqe->buf_len; i++) {
+				sqe->buf[i] = bus.next++;
+			}
+		}
+	}
+
+	rtio_iodev_sqe_ok(iodev_sqe, 0);
+}
+
+static const struct rtio_iodev_api bus_api = {
+	.submit = bus_submit,
+};
+
+RTIO_IODEV_DEFINE(bus_iodev, &bus_api, NULL);
+RTIO_DEFINE(drv_r, 8, 8);
+
+static int done_count;
+
+static void stream_done(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	done_count++;
+}
+
+static const struct sensor_fifo_stream_config fifo_cfg = {
+	.count_reg = REG_FIFO_COUNT,
+	.count_len = 2,
+	.count_mask = 0x0fff,
+	.data_reg = REG_FIFO_DATA,
+	.read_flag = READ_FLAG,
+	.frame_size = FRAME_SIZE,
+	.done = stream_done,
+};
+
+static struct sensor_fifo_stream stream;
+
+/* Streaming iodev of a sensor driver built on the helpers */
+static struct sensor_stream_trigger triggers[] = {
+	SENSOR_STREAM_TRIGGER_PREP(SENSOR_TRIG_FIFO_WATERMARK, SENSOR_STREAM_DATA_INCLUDE),
+};
+
+static struct sensor_read_config read_cfg = {
+	.is_streaming = true,
+	.triggers = triggers,
+	.count = ARRAY_SIZE(triggers),
+	.max = ARRAY_SIZE(triggers),
+};
+
+static void stream_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	sensor_fifo_stream_submit(&stream, iodev_sqe);
+}
+
+static const struct rtio_iodev_api stream_api = {
+	.submit = stream_submit,
+};
+
+RTIO_IODEV_DEFINE(stream_iodev, &stream_api, &read_cfg);
+RTIO_DEFINE_WITH_MEMPOOL(app_r, 4, 4, 4, 64, 4);
+
+static void submit_read(void)
+{
+	struct rtio_sqe *sqe = rtio_sqe_acquire(&app_r);
+
+	zassert_not_null(sqe);
+	rtio_sqe_prep_read_with_pool(sqe, &stream_iodev, RTIO_PRIO_NORM, NULL);
+	zassert_ok(rtio_submit(&app_r, 0));
+}
+
+static const struct sensor_fifo_stream_header *get_result(struct rtio_cqe *cqe, uint8_t **buf,
+							  uint32_t *buf_len)
+{
+	zassert_equal(rtio_cqe_copy_out(&app_r, cqe, 1, K_NO_WAIT), 1);
+	zassert_ok(cqe->result);
+	zassert_ok(rtio_cqe_get_mempool_buffer(&app_r, cqe, buf, buf_len));
+
+	return (const struct sensor_fifo_stream_header *)*buf;
+}
+
+static void fifo_stream_before(void *f)
+{
+	ARG_UNUSED(f);
+
+	memset(&bus, 0, sizeof(bus));
+	done_count = 0;
+	sensor_fifo_stream_init(&stream, NULL, &fifo_cfg, &drv_r, &bus_iodev, PERIOD_NS);
+}
+
+ZTEST(sensor_fifo_stream, test_read_frames)
+{
+	const struct sensor_fifo_stream_header *hdr;
+	const uint8_t *frames;
+	struct rtio_cqe cqe;
+	uint32_t buf_len;
+	uint8_t *buf;
+
+	submit_read();
+
+	bus.level = 4 * FRAME_SIZE;
+	sensor_fifo_stream_irq(&stream, SENSOR_TRIG_FIFO_WATERMARK, 1000000);
+	zassert_equal(done_count, 1);
+
+	hdr = get_result(&cqe, &buf, &buf_len);
+	zassert_equal(hdr->frame_count, 4);
+	zassert_equal(hdr->frame_size, FRAME_SIZE);
+	zassert_equal(hdr->trigger, SENSOR_TRIG_FIFO_WATERMARK);
+	zassert_equal(hdr->period_ns, PERIOD_NS);
+
+	/* The last frame is the one that raised the watermark */
+	zassert_equal(sensor_fifo_stream_frame_time(hdr, 3), 1000000);
+	zassert_equal(sensor_fifo_stream_frame_time(hdr, 0), 1000000 - 3 * PERIOD_NS);
+
+	frames = sensor_fifo_stream_frames(buf, 0);
+	for (int i = 0; i < 4 * FRAME_SIZE; i++) {
+		zassert_equal(frames[i], i);
+	}
+
+	rtio_release_buffer(&app_r, buf, buf_len);
+}
+
+ZTEST(sensor_fifo_stream, test_period_measured)
+{
+	const struct sensor_fifo_stream_header *hdr;
+	struct rtio_cqe cqe;
+	uint32_t buf_len;
+	uint8_t *buf;
+
+	bus.level = 4 * FRAME_SIZE;
+
+	submit_read();
+	sensor_fifo_stream_irq(&stream, SENSOR_TRIG_FIFO_WATERMARK, 1000000);
+	hdr = get_result(&cqe, &buf, &buf_len);
+	rtio_release_buffer(&app_r, buf, buf_len);
+
+	/* The sensor runs 20% slower than nominal, the estimate moves towards it */
+	submit_read();
+	sensor_fifo_stream_irq(&stream, SENSOR_TRIG_FIFO_WATERMARK, 1000000 + 4 * 12000);
+	hdr = get_result(&cqe, &buf, &buf_len);
+	zassert_equal(hdr->period_ns, PERIOD_NS + 2000 / 4);
+	zassert_equal(sensor_fifo_stream_frame_time(hdr, 3), 1000000 + 4 * 12000);
+	rtio_release_buffer(&app_r, buf, buf_len);
+
+	/* A gap the nominal rate cannot explain leaves the estimate alone */
+	submit_read();
+	sensor_fifo_stream_irq(&stream, SENSOR_TRIG_FIFO_WATERMARK, 10000000);
+	hdr = get_result(&cqe, &buf, &buf_len);
+	zassert_equal(hdr->period_ns, PERIOD_NS + 2000 / 4);
+	rtio_release_buffer(&app_r, buf, buf_len);
+
+	zassert_equal(done_count, 3);
+}
+
+ZTEST(sensor_fifo_stream, test_no_submission)
+{
+	struct rtio_cqe cqe;
+
+	bus.level = 4 * FRAME_SIZE;
+	sensor_fifo_stream_irq(&stream, SENSOR_TRIG_FIFO_WATERMARK, 1000000);
+	zassert_equal(done_count, 1);
+	zassert_equal(rtio_cqe_copy_out(&app_r, &cqe, 1, K_NO_WAIT), 0);
+}
+
+ZTEST(sensor_fifo_stream, test_bus_error)
+{
+	struct rtio_cqe cqe;
+
+	submit_read();
+
+	bus.err = -EIO;
+	sensor_fifo_stream_irq(&stream, SENSOR_TRIG_FIFO_WATERMARK, 1000000);
+	zassert_equal(done_count, 1);
+
+	zassert_equal(rtio_cqe_copy_out(&app_r, &cqe, 1, K_NO_WAIT), 1);
+	zassert_equal(cqe.result, -EIO);
+}
+
+ZTEST_SUITE(sensor_fifo_stream, NULL, NULL, fifo_stream_before, NULL, NULL);
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/drivers/serial/uart_emul.h>
+#include <zephyr/drivers/serial/uart_rtio.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/ztest.h>
+
+#define EMUL_UART_NODE DT_NODELABEL(euart0)
+#define RX_BUF_SIZE    16
+#define RX_TIMEOUT_US  (10 * USEC_PER_MSEC)
+
+UART_RTIO_IODEV_DEFINE(uart_iodev, DEVICE_DT_GET(EMUL_UART_NODE), RX_BUF_SIZE, RX_TIMEOUT_US);
+RTIO_DEFINE_WITH_MEMPOOL(uart_r, 4, 4, 4, RX_BUF_SIZE, 4);
+
+static const struct device *const uart_dev = DEVICE_DT_GET(EMUL_UART_NODE);
+
+static void uart_rtio_before(void *f)
+{
+	ARG_UNUSED(f);
+
+	uart_emul_flush_rx_data(uart_dev);
+	uart_emul_flush_tx_data(uart_dev);
+	zassert_ok(uart_rtio_init(&uart_iodev));
+}
+
+ZTEST(uart_rtio, test_tx)
+{
+	static uint8_t data[] = "hello world";
+	uint8_t tx_content[sizeof(data)];
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+
+	sqe = rtio_sqe_acquire(&uart_r);
+	rtio_sqe_prep_write(sqe, &uart_iodev, RTIO_PRIO_NORM, data, 5, NULL);
+	sqe = rtio_sqe_acquire(&uart_r);
+	rtio_sqe_prep_tiny_write(sqe, &uart_iodev, RTIO_PRIO_NORM, &data[5], sizeof(data) - 5,
+				 NULL);
+	zassert_ok(rtio_submit(&uart_r, 2));
+
+	for (int i = 0; i < 2; i++) {
+		cqe = rtio_cqe_consume(&uart_r);
+		zassert_not_null(cqe);
+		zassert_ok(cqe->result);
+		rtio_cqe_release(&uart_r, cqe);
+	}
+
+	zassert_equal(uart_emul_get_tx_data(uart_dev, tx_content, sizeof(tx_content)),
+		      sizeof(data));
+	zassert_mem_equal(tx_content, data, sizeof(data));
+}
+
+ZTEST(uart_rtio, test_rx_idle)
+{
+	static const uint8_t data[] = {1, 2, 3, 4, 5};
+	uint8_t rx_content[RX_BUF_SIZE];
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+
+	uart_emul_set_release_buffer_on_timeout(uart_dev, false);
+
+	/* The read completes once the line is idle, before its buffer is full */
+	sqe = rtio_sqe_acquire(&uart_r);
+	rtio_sqe_prep_read(sqe, &uart_iodev, RTIO_PRIO_NORM, rx_content, sizeof(rx_content),
+			   NULL);
+	zassert_ok(rtio_submit(&uart_r, 0));
+
+	uart_emul_put_rx_data(uart_dev, data, sizeof(data));
+
+	cqe = rtio_cqe_consume_block(&uart_r);
+	zassert_equal(cqe->result, sizeof(data));
+	zassert_mem_equal(rx_content, data, sizeof(data));
+	rtio_cqe_release(&uart_r, cqe);
+}
+
+ZTEST(uart_rtio, test_rx_multishot)
+{
+	static uint8_t data[RX_BUF_SIZE + 4];
+	static int userdata;
+	struct rtio_sqe *handle;
+	struct rtio_sqe sqe;
+	struct rtio_cqe cqe;
+	uint8_t *buf;
+	uint32_t buf_len;
+	size_t received = 0;
+
+	for (size_t i = 0; i < sizeof(data); i++) {
+		data[i] = i;
+	}
+
+	uart_emul_set_release_buffer_on_timeout(uart_dev, true);
+
+	rtio_sqe_prep_read_multishot(&sqe, &uart_iodev, RTIO_PRIO_NORM, &userdata);
+	zassert_ok(rtio_sqe_copy_in_get_handles(&uart_r, &sqe, &handle, 1));
+	zassert_ok(rtio_submit(&uart_r, 0));
+
+	/* Data spanning two mempool buffers is received in place, without loss */
+	uart_emul_put_rx_data(uart_dev, data, sizeof(data));
+
+	while (received < sizeof(data)) {
+		zassert_equal(rtio_cqe_copy_out(&uart_r, &cqe, 1, K_SECONDS(1)), 1);
+		zassert_true(cqe.result > 0);
+		zassert_equal_ptr(cqe.userdata, &userdata);
+		zassert_ok(rtio_cqe_get_mempool_buffer(&uart_r, &cqe, &buf, &buf_len));
+		zassert_true(cqe.result <= buf_len);
+		zassert_mem_equal(buf, &data[received], cqe.result);
+		received += cqe.result;
+		rtio_release_buffer(&uart_r, buf, buf_len);
+	}
+	zassert_equal(received, sizeof(data));
+
+	/* The canceled read is retired with the next reception */
+	rtio_sqe_cancel(handle);
+	uart_emul_put_rx_data(uart_dev, data, 1);
+	zassert_equal(rtio_cqe_copy_out(&uart_r, &cqe, 1, K_MSEC(100)), 0);
+}
+
+ZTEST_SUITE(uart_rtio, NULL, NULL, uart_rtio_before, NULL, NULL);
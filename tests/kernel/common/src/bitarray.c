@@ -520,6 +520,61 @@ ZTEST(bitarray, test_bitarray_alloc_free)
 	alloc_and_free_interval();
 }
 
+/**
+ * @brief Test allocations in a large and fragmented bitarray
+ *
+ * @see sys_bitarray_alloc()
+ * @see sys_bitarray_free()
+ */
+ZTEST(bitarray, test_bitarray_alloc_fragmented)
+{
+	SYS_BITARRAY_DEFINE_STATIC(ba, 4096);
+	size_t offset;
+	size_t bit;
+	int ret;
+
+	for (bit = 0; bit < ba.num_bits; bit++) {
+		ret = sys_bitarray_alloc(&ba, 1, &offset);
+		zassert_equal(ret, 0, "sys_bitarray_alloc() failed (%d) (bit %u)", ret, bit);
+		zassert_equal(offset, bit, "offset expected %u, got %u", bit, offset);
+	}
+
+	zassert_equal(sys_bitarray_alloc(&ba, 1, &offset), -ENOSPC,
+		      "sys_bitarray_alloc() should fail on a full bitarray");
+
+	/* Holes of 3 bits every 100 bits, too small for what follows */
+	for (bit = 50; bit < 3900; bit += 100) {
+		zassert_equal(sys_bitarray_free(&ba, 3, bit), 0,
+			      "sys_bitarray_free() failed (bit %u)", bit);
+	}
+
+	zassert_equal(sys_bitarray_free(&ba, 64, 4000), 0, "sys_bitarray_free() failed");
+	zassert_equal(sys_bitarray_free(&ba, 32, 2001), 0, "sys_bitarray_free() failed");
+
+	ret = sys_bitarray_alloc(&ba, 16, &offset);
+	zassert_equal(ret, 0, "sys_bitarray_alloc() failed (%d)", ret);
+	zassert_equal(offset, 2001, "offset expected %u, got %u", 2001, offset);
+
+	ret = sys_bitarray_alloc(&ba, 17, &offset);
+	zassert_equal(ret, 0, "sys_bitarray_alloc() failed (%d)", ret);
+	zassert_equal(offset, 4000, "offset expected %u, got %u", 4000, offset);
+
+	ret = sys_bitarray_alloc(&ba, 47, &offset);
+	zassert_equal(ret, 0, "sys_bitarray_alloc() failed (%d)", ret);
+	zassert_equal(offset, 4017, "offset expected %u, got %u", 4017, offset);
+
+	zassert_equal(sys_bitarray_alloc(&ba, 17, &offset), -ENOSPC,
+		      "sys_bitarray_alloc() should fail without a large enough region");
+
+	ret = sys_bitarray_alloc(&ba, 3, &offset);
+	zassert_equal(ret, 0, "sys_bitarray_alloc() failed (%d)", ret);
+	zassert_equal(offset, 50, "offset expected %u, got %u", 50, offset);
+
+	ret = sys_bitarray_alloc(&ba, 16, &offset);
+	zassert_equal(ret, 0, "sys_bitarray_alloc() failed (%d)", ret);
+	zassert_equal(offset, 2017, "offset expected %u, got %u", 2017, offset);
+}
+
 ZTEST(bitarray, test_bitarray_popcount_region)
 {
 	int ret;
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/init.h>
+#include <zephyr/linker/linker-defs.h>
+#include <zephyr/ztest.h>
+
+static __lazy_bss uint8_t lazy_buf[512];
+static bool lazy_buf_zeroed;
+
+static int lazy_bss_check(void)
+{
+	lazy_buf_zeroed = true;
+	for (size_t i = 0; i < sizeof(lazy_buf); i++) {
+		if (lazy_buf[i] != 0) {
+			lazy_buf_zeroed = false;
+		}
+	}
+
+	return 0;
+}
+
+/* First entry after the clearing of the lazy BSS */
+SYS_INIT(lazy_bss_check, POST_KERNEL, 1);
+
+/**
+ * @brief Test that variables tagged with __lazy_bss are cleared
+ */
+ZTEST(lazy_bss, test_lazy_bss)
+{
+	zassert_true(lazy_buf_zeroed, "lazy BSS not cleared at POST_KERNEL");
+	zassert_true((char *)lazy_buf >= __lazy_bss_start &&
+		     (char *)lazy_buf + sizeof(lazy_buf) <= __lazy_bss_end,
+		     "buffer not in the lazy BSS section");
+	zassert_true((char *)lazy_buf < __bss_start || (char *)lazy_buf >= __bss_end,
+		     "buffer in the BSS");
+}
+
+extern void *common_setup(void);
+ZTEST_SUITE(lazy_bss, NULL, common_setup, NULL, NULL, NULL);
@@ -217,6 +217,11 @@ ZTEST(printk, test_printk)
 	printk("%lld %lld %llu %llx\n", 0xFFFFFFFFFULL, -1LL, -1ULL, -1ULL);
 	printk("0x%x %p %-2p\n", hex, ptr, (char *)42);
 
+	if (IS_ENABLED(CONFIG_PRINTK_DEFERRED)) {
+		/* Let the output thread drain the buffer */
+		k_msleep(100);
+	}
+
 	pk_console[pos] = '\0';
 	__printk_hook_install(_old_char_out);
 	printk("expected '%s'\n", expected);
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define SLOW_INIT_MS  100
+#define ASYNC_INIT_MS 50
+
+static const struct device *const slow_dev = DEVICE_DT_GET(DT_NODELABEL(test_slow));
+static const struct device *const async_dev = DEVICE_DT_GET(DT_NODELABEL(test_async));
+
+/* Initialization order, set when the init of each device completes */
+static atomic_t init_seq;
+static atomic_val_t slow_seq;
+static atomic_val_t fast_seq;
+static atomic_val_t dependent_seq;
+static bool dependent_saw_slow_ready;
+static bool async_dependent_saw_async_ready;
+static bool sys_init_saw_async_ready;
+
+static struct k_work_delayable async_work;
+
+static int slow_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	k_msleep(SLOW_INIT_MS);
+	slow_seq = atomic_inc(&init_seq);
+
+	return 0;
+}
+
+static int fast_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	fast_seq = atomic_inc(&init_seq);
+
+	return 0;
+}
+
+static int dependent_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	dependent_saw_slow_ready = device_is_ready(slow_dev);
+	dependent_seq = atomic_inc(&init_seq);
+
+	return 0;
+}
+
+static void async_work_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	device_init_complete(async_dev, 0);
+}
+
+static int async_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	k_work_init_delayable(&async_work, async_work_handler);
+	(void)k_work_schedule(&async_work, K_MSEC(ASYNC_INIT_MS));
+
+	return -EINPROGRESS;
+}
+
+static int async_dependent_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	async_dependent_saw_async_ready = device_is_ready(async_dev);
+
+	return 0;
+}
+
+#define TEST_DEVICE_DEFINE(label, init_fn)                                                         \
+	DEVICE_DT_DEFINE(DT_NODELABEL(label), init_fn, NULL, NULL, NULL, POST_KERNEL,              \
+			 CONFIG_KERNEL_INIT_PRIORITY_DEVICE, NULL)
+
+TEST_DEVICE_DEFINE(test_slow, slow_init);
+TEST_DEVICE_DEFINE(test_fast, fast_init);
+TEST_DEVICE_DEFINE(test_dependent, dependent_init);
+TEST_DEVICE_DEFINE(test_async, async_init);
+TEST_DEVICE_DEFINE(test_async_dependent, async_dependent_init);
+
+static int check_after_devices(void)
+{
+	sys_init_saw_async_ready = device_is_ready(async_dev);
+
+	return 0;
+}
+
+SYS_INIT(check_after_devices, POST_KERNEL, 99);
+
+/**
+ * @brief Test that independent devices do not wait for a slow one
+ */
+ZTEST(device_init_parallel, test_independent)
+{
+	zassert_true(device_is_ready(slow_dev));
+	zassert_true(fast_seq < slow_seq, "fast device waited for the slow one");
+}
+
+/**
+ * @brief Test that devices wait for the devices they require
+ */
+ZTEST(device_init_parallel, test_dependencies)
+{
+	zassert_true(dependent_saw_slow_ready);
+	zassert_true(dependent_seq > slow_seq);
+	zassert_true(async_dependent_saw_async_ready);
+}
+
+/**
+ * @brief Test that an asynchronous init holds back the later SYS_INIT entries
+ */
+ZTEST(device_init_parallel, test_async)
+{
+	zassert_true(device_is_ready(async_dev));
+	zassert_true(sys_init_saw_async_ready);
+}
+
+ZTEST_SUITE(device_init_parallel, NULL, NULL, NULL, NULL, NULL);
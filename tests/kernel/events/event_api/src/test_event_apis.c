@@ -23,6 +23,11 @@ static K_THREAD_STACK_DEFINE(sextra2, STACK_SIZE);
 
 static K_EVENT_DEFINE(test_event);
 static K_EVENT_DEFINE(sync_event);
+static K_EVENT_DEFINE_OPTIONS(wake_one_event, K_EVENT_WAKE_ONE);
+
+static struct k_thread twaiter[2];
+static K_THREAD_STACK_ARRAY_DEFINE(swaiter, 2, STACK_SIZE);
+static atomic_t wake_one_count;
 
 static K_SEM_DEFINE(receiver_sem, 0, 1);
 static K_SEM_DEFINE(sync_sem, 0, 1);
@@ -431,3 +436,58 @@ ZTEST(events_api, test_event_receive)
 
 	test_wake_multiple_threads();
 }
+
+static void entry_wake_one(void *p1, void *p2, void *p3)
+{
+	uint32_t  events;
+
+	events = k_event_wait(&wake_one_event, 0x1, false, K_FOREVER);
+	zassert_equal(events, 0x1);
+
+	atomic_inc(&wake_one_count);
+}
+
+/**
+ * Test the K_EVENT_WAKE_ONE option.
+ *
+ * Verify that posting an event to an event object with this option wakes a
+ * single waiter, and that the events matching a wait are cleared.
+ */
+
+ZTEST(events_api, test_event_wake_one)
+{
+	uint32_t  events;
+
+	k_event_post(&wake_one_event, 0x3);
+	events = k_event_wait(&wake_one_event, 0x1, false, K_NO_WAIT);
+	zassert_equal(events, 0x1);
+	zassert_equal(k_event_test(&wake_one_event, ~0), 0x2,
+		      "matching events were not cleared");
+	k_event_clear(&wake_one_event, ~0);
+
+	atomic_set(&wake_one_count, 0);
+
+	for (int i = 0; i < ARRAY_SIZE(twaiter); i++) {
+		(void) k_thread_create(&twaiter[i], swaiter[i], STACK_SIZE,
+				       entry_wake_one, NULL, NULL, NULL,
+				       K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	}
+
+	/* Let both threads wait */
+
+	k_sleep(DELAY);
+
+	for (int i = 1; i <= ARRAY_SIZE(twaiter); i++) {
+		k_event_post(&wake_one_event, 0x1);
+		k_sleep(DELAY);
+
+		zassert_equal(atomic_get(&wake_one_count), i,
+			      "%d threads woken by %d posts",
+			      (int)atomic_get(&wake_one_count), i);
+		zassert_equal(k_event_test(&wake_one_event, ~0), 0);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(twaiter); i++) {
+		k_thread_join(&twaiter[i], K_FOREVER);
+	}
+}
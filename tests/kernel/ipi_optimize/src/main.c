@@ -10,6 +10,7 @@
 #include <ksched.h>
 #include <ipi.h>
 #include <zephyr/kernel_structs.h>
+#include <zephyr/kernel/smp.h>
 
 #define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
 
@@ -241,6 +242,42 @@ ZTEST(ipi, test_arch_sched_directed_ipi)
 }
 #endif
 
+#ifdef CONFIG_SMP_CALL
+static void record_cpu(void *arg)
+{
+	*(uint32_t *)arg = _current_cpu->id;
+}
+
+/**
+ * Verify that k_smp_call_on_cpu() runs the function on the given CPU,
+ * with a single IPI.
+ */
+ZTEST(ipi, test_smp_call_on_cpu)
+{
+	uint32_t  set[CONFIG_MP_MAX_NUM_CPUS];
+	uint32_t  id;
+	uint32_t  cpu;
+	int priority;
+
+	priority = k_thread_priority_get(k_current_get());
+
+	id = busy_threads_create(priority - 1);
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		cpu = UINT32_MAX;
+		clear_ipi_counts();
+		zassert_ok(k_smp_call_on_cpu(i, record_cpu, &cpu));
+		get_ipi_counts(set, CONFIG_MP_MAX_NUM_CPUS);
+
+		zassert_equal(cpu, i, "Call ran on CPU %u instead of %u\n", cpu, i);
+		zassert_equal(set[i], (i == id) ? 0 : 1, "Expected %u IPI, got %u\n",
+			      (i == id) ? 0 : 1, set[i]);
+	}
+
+	zassert_equal(k_smp_call_on_cpu(CONFIG_MP_MAX_NUM_CPUS, record_cpu, &cpu), -EINVAL);
+}
+#endif
+
 /**
  * Verify that waking a thread whose priority is lower than any other
  * currently executing thread does not result in any IPIs being sent.
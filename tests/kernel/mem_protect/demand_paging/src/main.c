@@ -113,6 +113,13 @@ static void print_paging_stats(struct k_mem_paging_stats_t *stats, const char *s
 	       stats->eviction.clean);
 	printk("    - Dirty pages evicted: %lu\n",
 	       stats->eviction.dirty);
+
+#ifdef CONFIG_DEMAND_PAGING_PREFETCH
+	printk("* Read ahead (%s):\n", scope);
+	printk("    - Total: %lu\n", stats->prefetch.cnt);
+	printk("    - Accessed: %lu\n", stats->prefetch.hits);
+	printk("    - Evicted unused: %lu\n", stats->prefetch.misses);
+#endif
 }
 
 static void touch_anon_pages(bool zig, bool zag)
@@ -217,6 +224,66 @@ ZTEST(demand_paging, test_touch_anon_pages_zigzag2)
 	touch_anon_pages(false, true);
 }
 
+#define TOUCH_THREADS		2
+#define TOUCH_STACK_SIZE	1024
+
+static K_THREAD_STACK_ARRAY_DEFINE(touch_stacks, TOUCH_THREADS, TOUCH_STACK_SIZE);
+static struct k_thread touch_threads[TOUCH_THREADS];
+static size_t touch_errors[TOUCH_THREADS];
+
+static void touch_thread(void *p1, void *p2, void *p3)
+{
+	uintptr_t id = (uintptr_t)p1;
+	size_t part = arena_size / TOUCH_THREADS;
+	char *base = arena + id * part;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (size_t i = 0; i < part; i++) {
+		base[i] = nums[(i + id) % 10];
+	}
+
+	for (size_t i = 0; i < part; i++) {
+		if (base[i] != nums[(i + id) % 10]) {
+			touch_errors[id]++;
+		}
+	}
+}
+
+/* Several threads faulting in separate parts of the arena at once. With
+ * CONFIG_DEMAND_PAGING_ALLOW_SLEEP, one thread may run while the other one
+ * waits for its page to be transferred.
+ */
+ZTEST(demand_paging, test_touch_anon_pages_threads)
+{
+	struct k_mem_paging_stats_t before, after;
+	unsigned long faults;
+	int64_t start;
+
+	k_mem_paging_stats_get(&before);
+	start = k_uptime_get();
+
+	for (uintptr_t i = 0; i < TOUCH_THREADS; i++) {
+		touch_errors[i] = 0;
+		k_thread_create(&touch_threads[i], touch_stacks[i],
+				K_THREAD_STACK_SIZEOF(touch_stacks[i]), touch_thread,
+				(void *)i, NULL, NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+
+	for (int i = 0; i < TOUCH_THREADS; i++) {
+		k_thread_join(&touch_threads[i], K_FOREVER);
+		zassert_equal(touch_errors[i], 0, "thread %d read back %zu bad bytes",
+			      i, touch_errors[i]);
+	}
+
+	k_mem_paging_stats_get(&after);
+	faults = after.pagefaults.cnt - before.pagefaults.cnt;
+	printk("%d threads: %lu page faults in %lld ms\n", TOUCH_THREADS, faults,
+	       k_uptime_get() - start);
+	zassert_true(faults > 0, "no page faults");
+}
+
 ZTEST(demand_paging, test_unmap_anon_pages)
 {
 	 k_mem_unmap(arena, arena_size);
@@ -236,6 +303,13 @@ static void test_k_mem_page_out(void)
 {
 	unsigned long faults;
 	int key, ret;
+#ifdef CONFIG_DEMAND_PAGING_PREFETCH
+	struct k_mem_paging_stats_t stats;
+	unsigned long prefetched;
+
+	k_mem_paging_stats_get(&stats);
+	prefetched = stats.prefetch.cnt;
+#endif
 
 	/* Lock IRQs to prevent other pagefaults from happening while we
 	 * are measuring stuff
@@ -252,9 +326,23 @@ static void test_k_mem_page_out(void)
 	faults = k_mem_num_pagefaults_get() - faults;
 	irq_unlock(key);
 
+#ifdef CONFIG_DEMAND_PAGING_PREFETCH
+	/* Pages read ahead are not faulted in, and the last read ahead may go
+	 * past the evicted region
+	 */
+	k_mem_paging_stats_get(&stats);
+	prefetched = stats.prefetch.cnt - prefetched;
+	printk("%lu pages read ahead\n", prefetched);
+
+	zassert_true(faults < HALF_PAGES, "no page read ahead");
+	zassert_true(faults + prefetched >= HALF_PAGES,
+		     "unexpected num pagefaults %lu and read ahead %lu",
+		     faults, prefetched);
+#else
 	zassert_equal(faults, HALF_PAGES,
 		      "unexpected num pagefaults expected %lu got %d",
 		      HALF_PAGES, faults);
+#endif
 
 	ret = k_mem_page_out(arena, arena_size);
 	zassert_equal(ret, -ENOMEM, "k_mem_page_out should have failed");
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+
+#define MAG_BLOCKS 9
+#define MAG_BLK_SIZE 16
+
+K_MEM_SLAB_DEFINE_STATIC(mag_slab, MAG_BLK_SIZE, MAG_BLOCKS, 4);
+
+static void alloc_all(void **blocks)
+{
+	void *extra;
+
+	for (int i = 0; i < MAG_BLOCKS; i++) {
+		zassert_ok(k_mem_slab_alloc(&mag_slab, &blocks[i], K_NO_WAIT));
+		zassert_equal(k_mem_slab_num_used_get(&mag_slab), i + 1);
+	}
+	zassert_equal(k_mem_slab_alloc(&mag_slab, &extra, K_NO_WAIT), -ENOMEM);
+	zassert_equal(k_mem_slab_num_free_get(&mag_slab), 0);
+}
+
+static void free_all(void **blocks)
+{
+	for (int i = 0; i < MAG_BLOCKS; i++) {
+		k_mem_slab_free(&mag_slab, blocks[i]);
+		zassert_equal(k_mem_slab_num_free_get(&mag_slab), i + 1);
+	}
+}
+
+/**
+ * @brief Verify that the per-CPU magazines do not hide free blocks
+ *
+ * @details Blocks cached in the magazines must count as free, and all of
+ * them must be allocatable again even if they sit in a magazine.
+ *
+ * @ingroup kernel_memory_slab_tests
+ */
+ZTEST(mslab_threadsafe, test_mslab_magazine)
+{
+	void *blocks[MAG_BLOCKS];
+	struct k_mem_slab_magazine_stats stats;
+
+	alloc_all(blocks);
+	free_all(blocks);
+	alloc_all(blocks);
+	free_all(blocks);
+
+	zassert_ok(k_mem_slab_magazine_stats_get(&mag_slab, &stats));
+	zassert_true(stats.refills > 0);
+	zassert_true(stats.hits > 0);
+	zassert_true(stats.hits + stats.refills <= 2 * MAG_BLOCKS);
+	zassert_true(stats.max_cached <= CONFIG_MEM_SLAB_MAGAZINE_SIZE);
+	zassert_equal(k_mem_slab_magazine_stats_get(NULL, &stats), -EINVAL);
+}
+#endif /* CONFIG_MEM_SLAB_MAGAZINE */
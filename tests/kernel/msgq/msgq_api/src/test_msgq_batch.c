@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+#define BATCH_LEN 4
+
+K_THREAD_STACK_DECLARE(tstack, STACK_SIZE);
+extern struct k_thread tdata;
+extern struct k_msgq msgq;
+static ZTEST_BMEM char __aligned(4) tbuffer[MSG_SIZE * BATCH_LEN];
+static ZTEST_DMEM uint32_t out[BATCH_LEN * 2] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+static ZTEST_BMEM uint32_t in[BATCH_LEN * 2];
+static ZTEST_BMEM uint32_t single;
+
+static void reader_entry(void *p1, void *p2, void *p3)
+{
+	zassert_ok(k_msgq_get((struct k_msgq *)p1, &single, K_FOREVER));
+}
+
+static void writer_entry(void *p1, void *p2, void *p3)
+{
+	single = MSG0;
+	zassert_ok(k_msgq_put((struct k_msgq *)p1, &single, K_FOREVER));
+}
+
+static void batch_put_get(struct k_msgq *q)
+{
+	/**TESTPOINT: only as many messages as fit are sent */
+	zassert_equal(k_msgq_put_batch(q, out, ARRAY_SIZE(out), K_NO_WAIT), BATCH_LEN);
+	zassert_equal(k_msgq_put_batch(q, out, 1, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_put_batch(q, out, 1, TIMEOUT), -EAGAIN);
+
+	zassert_equal(k_msgq_get_batch(q, in, 3, K_NO_WAIT), 3);
+	zassert_mem_equal(in, out, 3 * MSG_SIZE);
+
+	/**TESTPOINT: the batch wraps around the end of the ring buffer */
+	zassert_equal(k_msgq_put_batch(q, &out[4], 4, K_NO_WAIT), 3);
+	zassert_equal(k_msgq_num_used_get(q), BATCH_LEN);
+
+	zassert_equal(k_msgq_get_batch(q, in, ARRAY_SIZE(in), K_NO_WAIT), BATCH_LEN);
+	zassert_equal(in[0], 3);
+	zassert_mem_equal(&in[1], &out[4], 3 * MSG_SIZE);
+
+	zassert_equal(k_msgq_get_batch(q, in, 1, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_get_batch(q, in, 1, TIMEOUT), -EAGAIN);
+	zassert_equal(k_msgq_get_batch(q, in, 0, K_NO_WAIT), 0);
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test batched put and get, including ring buffer wrap around
+ * @see k_msgq_put_batch(), k_msgq_get_batch()
+ */
+ZTEST(msgq_api, test_msgq_batch)
+{
+	k_msgq_init(&msgq, tbuffer, MSG_SIZE, BATCH_LEN);
+
+	batch_put_get(&msgq);
+}
+
+#ifdef CONFIG_USERSPACE
+/**
+ * @brief Test batched put and get from a user thread
+ * @see k_msgq_put_batch(), k_msgq_get_batch()
+ */
+ZTEST_USER(msgq_api, test_msgq_user_batch)
+{
+	struct k_msgq *q;
+
+	q = k_object_alloc(K_OBJ_MSGQ);
+	zassert_not_null(q, "couldn't alloc message queue");
+	zassert_false(k_msgq_alloc_init(q, MSG_SIZE, BATCH_LEN));
+
+	batch_put_get(q);
+}
+#endif
+
+/**
+ * @brief Test that batches serve the threads waiting on the queue
+ * @see k_msgq_put_batch(), k_msgq_get_batch()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_batch_waiters)
+{
+	k_msgq_init(&msgq, tbuffer, MSG_SIZE, BATCH_LEN);
+
+	/**TESTPOINT: a waiting reader gets the first message of the batch */
+	k_thread_create(&tdata, tstack, STACK_SIZE, reader_entry, &msgq, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	zassert_equal(k_msgq_put_batch(&msgq, out, 3, K_NO_WAIT), 3);
+	k_thread_join(&tdata, K_FOREVER);
+	zassert_equal(single, out[0]);
+	zassert_equal(k_msgq_num_used_get(&msgq), 2);
+
+	/**TESTPOINT: a waiting writer refills the queue */
+	zassert_equal(k_msgq_put_batch(&msgq, out, 2, K_NO_WAIT), 2);
+	k_thread_create(&tdata, tstack, STACK_SIZE, writer_entry, &msgq, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	zassert_equal(k_msgq_get_batch(&msgq, in, 2, K_NO_WAIT), 2);
+	k_thread_join(&tdata, K_FOREVER);
+	zassert_equal(k_msgq_num_used_get(&msgq), 3);
+
+	zassert_equal(k_msgq_get_batch(&msgq, in, ARRAY_SIZE(in), K_NO_WAIT), 3);
+	zassert_equal(in[2], MSG0);
+
+	k_msgq_purge(&msgq);
+}
+
+/**
+ * @}
+ */
@@ -460,6 +460,53 @@ ZTEST(mutex_api_1cpu, test_mutex_timeout_race_during_priority_inversion)
 	k_mutex_unlock(&tmutex);
 }
 
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+static void tThread_entry_lock_contended(void *p1, void *p2, void *p3)
+{
+	zassert_true(k_mutex_lock((struct k_mutex *)p1, K_FOREVER) == 0);
+	k_mutex_unlock((struct k_mutex *)p1);
+}
+
+/**
+ * @brief Test mutex contention statistics
+ *
+ * @details A thread blocks on a mutex held by the main thread, every
+ * contended lock must be accounted either as acquired while spinning or
+ * as pended.
+ *
+ * @ingroup kernel_mutex_tests
+ *
+ * @see k_mutex_lock()
+ */
+ZTEST(mutex_api, test_mutex_contention_stats)
+{
+	struct k_mutex_stats stats;
+
+	k_mutex_init(&tmutex);
+
+	zassert_ok(k_obj_core_stats_raw(K_OBJ_CORE(&tmutex), &stats, sizeof(stats)));
+	zassert_equal(stats.contended, 0);
+
+	k_mutex_lock(&tmutex, K_FOREVER);
+	k_thread_create(&tdata, tstack, STACK_SIZE,
+			tThread_entry_lock_contended, &tmutex, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	/* Let the thread give up spinning, if it does, and pend */
+	k_msleep(TIMEOUT);
+	k_mutex_unlock(&tmutex);
+	k_thread_join(&tdata, K_FOREVER);
+
+	zassert_ok(k_obj_core_stats_raw(K_OBJ_CORE(&tmutex), &stats, sizeof(stats)));
+	zassert_equal(stats.contended, 1);
+	zassert_equal(stats.spin_acquired + stats.pended, stats.contended);
+
+	zassert_ok(k_obj_core_stats_reset(K_OBJ_CORE(&tmutex)));
+	zassert_ok(k_obj_core_stats_raw(K_OBJ_CORE(&tmutex), &stats, sizeof(stats)));
+	zassert_equal(stats.contended, 0);
+}
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
+
 static void *mutex_api_tests_setup(void)
 {
 #ifdef CONFIG_USERSPACE
@@ -479,6 +479,76 @@ ZTEST_USER_OR_NOT(mutex_complex, test_user_access)
 #endif /* CONFIG_USERSPACE */
 }
 
+#ifdef CONFIG_USERSPACE
+static ZTEST_BMEM SYS_MUTEX_DEFINE(forged_mutex);
+K_THREAD_STACK_DEFINE(bystander_stack_area, STACKSIZE);
+static struct k_thread bystander_thread_data;
+
+static void bystander(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+}
+
+/**
+ * @brief Test that a thread without access to a mutex is not made its owner
+ *
+ * The owner word lives in user memory, any thread ID written there must not
+ * let the kernel boost a thread which could not have taken the mutex.
+ */
+ZTEST_USER(mutex_complex, test_forged_owner)
+{
+	atomic_set(&forged_mutex.val, (atomic_val_t)&bystander_thread_data);
+
+	/* The word is ignored, a free mutex is taken right away */
+	zassert_ok(sys_mutex_lock(&forged_mutex, K_NO_WAIT),
+		   "forged owner was adopted");
+	zassert_ok(sys_mutex_unlock(&forged_mutex));
+}
+#endif /* CONFIG_USERSPACE */
+
+#ifdef CONFIG_SYS_SYNC_STATS
+static ZTEST_BMEM SYS_MUTEX_DEFINE(fast_mutex);
+
+/**
+ * @brief Test that only recursive or contended operations enter the kernel
+ */
+ZTEST_USER(mutex_complex, test_fast_path)
+{
+	struct sys_sync_stats stats;
+
+	/* The first use is checked by the kernel, which then releases it */
+	zassert_ok(sys_mutex_lock(&fast_mutex, K_NO_WAIT));
+	zassert_ok(sys_mutex_unlock(&fast_mutex));
+	sys_mutex_stats_get(&fast_mutex, &stats);
+	zassert_equal(stats.fast, 0);
+	zassert_equal(stats.slow, 2);
+
+	zassert_ok(sys_mutex_lock(&fast_mutex, K_NO_WAIT));
+	zassert_ok(sys_mutex_unlock(&fast_mutex));
+	sys_mutex_stats_get(&fast_mutex, &stats);
+	zassert_equal(stats.fast, 2);
+	zassert_equal(stats.slow, 2);
+
+	/* Recursion is counted by the kernel */
+	zassert_ok(sys_mutex_lock(&fast_mutex, K_NO_WAIT));
+	zassert_ok(sys_mutex_lock(&fast_mutex, K_NO_WAIT));
+	zassert_ok(sys_mutex_unlock(&fast_mutex));
+	zassert_ok(sys_mutex_unlock(&fast_mutex));
+	sys_mutex_stats_get(&fast_mutex, &stats);
+	zassert_equal(stats.fast, 3);
+	zassert_equal(stats.slow, 5);
+
+	/* Released by the kernel, the fast path works again */
+	zassert_ok(sys_mutex_lock(&fast_mutex, K_NO_WAIT));
+	zassert_ok(sys_mutex_unlock(&fast_mutex));
+	sys_mutex_stats_get(&fast_mutex, &stats);
+	zassert_equal(stats.fast, 5);
+	zassert_equal(stats.slow, 5);
+}
+#endif /* CONFIG_SYS_SYNC_STATS */
+
 /*test case main entry*/
 static void *sys_mutex_tests_setup(void)
 {
@@ -497,6 +567,11 @@ static void *sys_mutex_tests_setup(void)
 				&thread_09_thread_data, &thread_09_stack_area,
 				&thread_11_thread_data, &thread_11_stack_area,
 				&thread_12_thread_data, &thread_12_stack_area);
+
+	/* Never started and without access to forged_mutex */
+	k_thread_create(&bystander_thread_data, bystander_stack_area,
+			K_THREAD_STACK_SIZEOF(bystander_stack_area), bystander,
+			NULL, NULL, NULL, K_LOWEST_APPLICATION_THREAD_PRIO, 0, K_FOREVER);
 #endif
 	rv = sys_mutex_lock(&not_my_mutex, K_NO_WAIT);
 	if (rv != 0) {
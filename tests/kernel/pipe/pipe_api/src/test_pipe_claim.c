@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief Tests for the Pipe claim / commit API
+ * @ingroup kernel_pipe_tests
+ * @{
+ */
+
+#include <zephyr/ztest.h>
+
+#define PIPE_LEN 8
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define TIMEOUT_MS 100
+
+static unsigned char __aligned(4) claim_buf[PIPE_LEN];
+static struct k_pipe claim_pipe;
+static K_THREAD_STACK_DEFINE(claim_stack, STACK_SIZE);
+static struct k_thread claim_thread;
+static unsigned char rx[PIPE_LEN];
+
+static void reader_entry(void *p1, void *p2, void *p3)
+{
+	size_t read;
+
+	zassert_ok(k_pipe_get(&claim_pipe, rx, 4, &read, 4, K_FOREVER));
+	zassert_equal(read, 4);
+}
+
+static void writer_entry(void *p1, void *p2, void *p3)
+{
+	size_t written;
+
+	zassert_ok(k_pipe_put(&claim_pipe, "wxyz", 4, &written, 4, K_FOREVER));
+	zassert_equal(written, 4);
+}
+
+/**
+ * @brief Test claiming pipe buffer space and data in place
+ *
+ * Data written into claimed space must be read back in order by
+ * k_pipe_get() and by read claims, which stop at the end of the buffer.
+ */
+ZTEST(pipe_api, test_pipe_claim)
+{
+	unsigned char *ptr;
+	size_t bytes;
+
+	k_pipe_init(&claim_pipe, claim_buf, sizeof(claim_buf));
+
+	zassert_equal(k_pipe_write_claim(&claim_pipe, &ptr, 6), 6);
+	memcpy(ptr, "abcdef", 6);
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 0);
+	zassert_equal(k_pipe_write_commit(&claim_pipe, 7), -EINVAL);
+	zassert_ok(k_pipe_write_commit(&claim_pipe, 6));
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 6);
+
+	zassert_ok(k_pipe_get(&claim_pipe, rx, 4, &bytes, 4, K_NO_WAIT));
+	zassert_mem_equal(rx, "abcd", 4);
+
+	/* Only the space up to the end of the buffer is contiguous */
+	zassert_equal(k_pipe_write_claim(&claim_pipe, &ptr, PIPE_LEN), 2);
+	memcpy(ptr, "gh", 2);
+	zassert_ok(k_pipe_write_commit(&claim_pipe, 2));
+	zassert_equal(k_pipe_write_claim(&claim_pipe, &ptr, PIPE_LEN), 4);
+	zassert_equal_ptr(ptr, claim_buf);
+	memcpy(ptr, "ij", 2);
+	zassert_ok(k_pipe_write_commit(&claim_pipe, 2));
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 6);
+
+	/* Reading is blocked while a read claim is pending */
+	zassert_equal(k_pipe_read_claim(&claim_pipe, &ptr, PIPE_LEN), 4);
+	zassert_mem_equal(ptr, "efgh", 4);
+	zassert_equal(k_pipe_get(&claim_pipe, rx, 1, &bytes, 1, K_NO_WAIT), -EIO);
+	zassert_ok(k_pipe_read_finish(&claim_pipe, 3));
+
+	zassert_equal(k_pipe_read_claim(&claim_pipe, &ptr, PIPE_LEN), 1);
+	zassert_equal(*ptr, 'h');
+	zassert_equal(k_pipe_read_finish(&claim_pipe, 2), -EINVAL);
+	zassert_ok(k_pipe_read_finish(&claim_pipe, 1));
+
+	zassert_equal(k_pipe_read_claim(&claim_pipe, &ptr, PIPE_LEN), 2);
+	zassert_mem_equal(ptr, "ij", 2);
+	zassert_ok(k_pipe_read_finish(&claim_pipe, 2));
+
+	zassert_equal(k_pipe_read_claim(&claim_pipe, &ptr, PIPE_LEN), 0);
+	zassert_is_null(ptr);
+}
+
+/**
+ * @brief Test that claims hand data to and take data from waiting threads
+ */
+ZTEST(pipe_api_1cpu, test_pipe_claim_waiters)
+{
+	unsigned char *ptr;
+
+	k_pipe_init(&claim_pipe, claim_buf, sizeof(claim_buf));
+
+	/* A committed write wakes up the waiting reader */
+	k_thread_create(&claim_thread, claim_stack, STACK_SIZE, reader_entry,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS);
+
+	zassert_equal(k_pipe_write_claim(&claim_pipe, &ptr, 4), 4);
+	memcpy(ptr, "abcd", 4);
+	zassert_ok(k_pipe_write_commit(&claim_pipe, 4));
+	k_thread_join(&claim_thread, K_FOREVER);
+	zassert_mem_equal(rx, "abcd", 4);
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 0);
+
+	/* Finishing a read refills the buffer from the waiting writer */
+	zassert_equal(k_pipe_write_claim(&claim_pipe, &ptr, PIPE_LEN), 4);
+	memcpy(ptr, "efgh", 4);
+	zassert_ok(k_pipe_write_commit(&claim_pipe, 4));
+	zassert_equal(k_pipe_write_claim(&claim_pipe, &ptr, PIPE_LEN), 4);
+	memcpy(ptr, "ijkl", 4);
+	zassert_ok(k_pipe_write_commit(&claim_pipe, 4));
+
+	k_thread_create(&claim_thread, claim_stack, STACK_SIZE, writer_entry,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS);
+
+	zassert_equal(k_pipe_read_claim(&claim_pipe, &ptr, PIPE_LEN), 4);
+	zassert_mem_equal(ptr, "efgh", 4);
+	zassert_ok(k_pipe_read_finish(&claim_pipe, 4));
+	k_thread_join(&claim_thread, K_FOREVER);
+
+	zassert_equal(k_pipe_read_claim(&claim_pipe, &ptr, PIPE_LEN), 4);
+	zassert_mem_equal(ptr, "ijkl", 4);
+	zassert_ok(k_pipe_read_finish(&claim_pipe, 4));
+	zassert_equal(k_pipe_read_claim(&claim_pipe, &ptr, PIPE_LEN), 4);
+	zassert_mem_equal(ptr, "wxyz", 4);
+	zassert_ok(k_pipe_read_finish(&claim_pipe, 4));
+}
+
+/**
+ * @brief Test that flushing and cleanup leave claimed memory alone
+ *
+ * Flushing with a pending read claim and freeing an allocated buffer
+ * with any claim pending must fail with -EBUSY and keep the pipe intact.
+ */
+ZTEST(pipe_api_1cpu, test_pipe_claim_flush_cleanup)
+{
+	unsigned char *ptr;
+	size_t bytes;
+
+	k_pipe_init(&claim_pipe, claim_buf, sizeof(claim_buf));
+	zassert_ok(k_pipe_put(&claim_pipe, "abcd", 4, &bytes, 4, K_NO_WAIT));
+
+	zassert_equal(k_pipe_read_claim(&claim_pipe, &ptr, 2), 2);
+	zassert_equal(k_pipe_flush(&claim_pipe), -EBUSY);
+	zassert_equal(k_pipe_buffer_flush(&claim_pipe), -EBUSY);
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 4);
+	zassert_mem_equal(ptr, "ab", 2);
+	zassert_ok(k_pipe_read_finish(&claim_pipe, 2));
+
+	zassert_ok(k_pipe_buffer_flush(&claim_pipe));
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 0);
+
+	/* A write claim does not prevent flushing the committed data */
+	zassert_ok(k_pipe_put(&claim_pipe, "ef", 2, &bytes, 2, K_NO_WAIT));
+	zassert_equal(k_pipe_write_claim(&claim_pipe, &ptr, 2), 2);
+	zassert_ok(k_pipe_flush(&claim_pipe));
+	memcpy(ptr, "gh", 2);
+	zassert_ok(k_pipe_write_commit(&claim_pipe, 2));
+	zassert_ok(k_pipe_get(&claim_pipe, rx, 2, &bytes, 2, K_NO_WAIT));
+	zassert_mem_equal(rx, "gh", 2);
+
+	zassert_ok(k_pipe_alloc_init(&claim_pipe, PIPE_LEN));
+
+	zassert_equal(k_pipe_write_claim(&claim_pipe, &ptr, 4), 4);
+	zassert_equal(k_pipe_cleanup(&claim_pipe), -EBUSY);
+	zassert_ok(k_pipe_write_commit(&claim_pipe, 4));
+
+	zassert_equal(k_pipe_read_claim(&claim_pipe, &ptr, 4), 4);
+	zassert_equal(k_pipe_cleanup(&claim_pipe), -EBUSY);
+	zassert_ok(k_pipe_read_finish(&claim_pipe, 4));
+
+	zassert_ok(k_pipe_cleanup(&claim_pipe));
+	zassert_equal(k_pipe_write_claim(&claim_pipe, &ptr, 4), 0);
+	zassert_equal(k_pipe_read_claim(&claim_pipe, &ptr, 4), 0);
+}
+
+/**
+ * @}
+ */
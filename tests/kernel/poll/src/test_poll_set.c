@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+
+#define SET_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static struct k_poll_set set;
+static struct k_sem set_sem;
+static struct k_fifo set_fifo;
+static struct k_poll_signal set_signal;
+static struct k_poll_event set_events[3];
+static struct k_thread set_thread;
+static K_THREAD_STACK_DEFINE(set_stack, SET_STACK_SIZE);
+
+static void set_init(void)
+{
+	k_poll_set_init(&set);
+	k_sem_init(&set_sem, 0, 2);
+	k_fifo_init(&set_fifo);
+	k_poll_signal_init(&set_signal);
+
+	k_poll_event_init(&set_events[0], K_POLL_TYPE_SEM_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_sem);
+	k_poll_event_init(&set_events[1], K_POLL_TYPE_FIFO_DATA_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_fifo);
+	k_poll_event_init(&set_events[2], K_POLL_TYPE_SIGNAL,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_signal);
+
+	for (int i = 0; i < ARRAY_SIZE(set_events); i++) {
+		zassert_ok(k_poll_set_add(&set, &set_events[i]));
+	}
+}
+
+/**
+ * @brief Test that a poll set only reports the events that became ready
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_add(), k_poll_set_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_ready)
+{
+	struct k_poll_event *ready[ARRAY_SIZE(set_events)];
+	void *data[2] = { NULL, NULL };
+
+	set_init();
+
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT), -EAGAIN);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_MSEC(10)), -EAGAIN);
+
+	/* Signaling twice before waiting reports the event once */
+	k_sem_give(&set_sem);
+	k_sem_give(&set_sem);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &set_events[0]);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SEM_AVAILABLE);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT), -EAGAIN);
+
+	/* The event stays registered although the semaphore is still given */
+	zassert_equal(k_sem_count_get(&set_sem), 2);
+	k_fifo_put(&set_fifo, data);
+	k_poll_signal_raise(&set_signal, 0);
+	zassert_equal(k_poll_set_wait(&set, ready, 1, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &set_events[1]);
+	zassert_equal(ready[0]->state, K_POLL_STATE_FIFO_DATA_AVAILABLE);
+	zassert_equal(k_poll_set_wait(&set, ready, 1, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &set_events[2]);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SIGNALED);
+	zassert_equal(k_poll_set_wait(&set, ready, 1, K_NO_WAIT), -EAGAIN);
+
+	zassert_equal_ptr(k_fifo_get(&set_fifo, K_NO_WAIT), data);
+	k_poll_signal_reset(&set_signal);
+
+	/* Events which are ready when added are reported */
+	zassert_ok(k_poll_set_del(&set, &set_events[0]));
+	zassert_equal(k_poll_set_del(&set, &set_events[0]), -EINVAL);
+	zassert_ok(k_poll_set_add(&set, &set_events[0]));
+	zassert_equal(k_poll_set_add(&set, &set_events[0]), -EBUSY);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &set_events[0]);
+	k_sem_reset(&set_sem);
+
+	/* Removed events are not reported anymore, even when ready */
+	k_sem_give(&set_sem);
+	zassert_ok(k_poll_set_del(&set, &set_events[0]));
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT), -EAGAIN);
+
+	zassert_ok(k_poll_set_del(&set, &set_events[1]));
+	zassert_ok(k_poll_set_del(&set, &set_events[2]));
+	k_sem_give(&set_sem);
+	k_fifo_put(&set_fifo, data);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT), -EAGAIN);
+	zassert_equal_ptr(k_fifo_get(&set_fifo, K_NO_WAIT), data);
+}
+
+static void set_raise_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_msleep(10);
+	k_poll_signal_raise(&set_signal, 0);
+}
+
+/**
+ * @brief Test waiting on a poll set for an event signaled by another thread
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_wait)
+{
+	struct k_poll_event *ready[ARRAY_SIZE(set_events)];
+
+	set_init();
+
+	k_thread_create(&set_thread, set_stack, K_THREAD_STACK_SIZEOF(set_stack),
+			set_raise_entry, NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_FOREVER), 1);
+	zassert_equal_ptr(ready[0], &set_events[2]);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SIGNALED);
+
+	k_thread_join(&set_thread, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(set_events); i++) {
+		zassert_ok(k_poll_set_del(&set, &set_events[i]));
+	}
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define TIMEOUT_MS 100
+#define NUM_READERS 2
+
+K_RWLOCK_DEFINE(static_rwlock);
+static struct k_rwlock rwlock;
+
+static K_THREAD_STACK_ARRAY_DEFINE(tstacks, NUM_READERS, STACK_SIZE);
+static struct k_thread tdata[NUM_READERS];
+
+static ZTEST_BMEM atomic_t readers_in;
+static ZTEST_BMEM atomic_t writer_done;
+
+static int higher_prio(void)
+{
+	return k_thread_priority_get(k_current_get()) - 1;
+}
+
+static void reader_entry(void *p1, void *p2, void *p3)
+{
+	zassert_ok(k_rwlock_read_lock(p1, K_FOREVER));
+	atomic_inc(&readers_in);
+	/* Let the other readers in while holding the lock */
+	k_msleep(TIMEOUT_MS / 2);
+	zassert_ok(k_rwlock_read_unlock(p1));
+}
+
+static void writer_entry(void *p1, void *p2, void *p3)
+{
+	zassert_ok(k_rwlock_write_lock(p1, K_FOREVER));
+	atomic_set(&writer_done, 1);
+	zassert_ok(k_rwlock_write_unlock(p1));
+}
+
+static void writer_timeout_entry(void *p1, void *p2, void *p3)
+{
+	zassert_equal(k_rwlock_write_lock(p1, K_MSEC(TIMEOUT_MS)), -EAGAIN);
+}
+
+static void reader_prio_entry(void *p1, void *p2, void *p3)
+{
+	zassert_ok(k_rwlock_read_lock(p1, K_FOREVER));
+	zassert_ok(k_rwlock_read_unlock(p1));
+}
+
+/**
+ * @brief Test that several readers may hold the lock at the same time
+ *
+ * @ingroup kernel_rwlock_tests
+ */
+ZTEST_USER(rwlock_api, test_rwlock_readers)
+{
+	zassert_ok(k_rwlock_read_lock(&static_rwlock, K_NO_WAIT));
+	zassert_ok(k_rwlock_read_lock(&static_rwlock, K_NO_WAIT));
+	zassert_equal(k_rwlock_write_lock(&static_rwlock, K_NO_WAIT), -EBUSY);
+
+	zassert_ok(k_rwlock_read_unlock(&static_rwlock));
+	zassert_ok(k_rwlock_read_unlock(&static_rwlock));
+	zassert_equal(k_rwlock_read_unlock(&static_rwlock), -EPERM);
+
+	zassert_ok(k_rwlock_write_lock(&static_rwlock, K_NO_WAIT));
+	zassert_ok(k_rwlock_write_unlock(&static_rwlock));
+}
+
+/**
+ * @brief Test that a writer has exclusive access
+ *
+ * @ingroup kernel_rwlock_tests
+ */
+ZTEST_USER(rwlock_api, test_rwlock_writer_exclusive)
+{
+	zassert_ok(k_rwlock_init(&rwlock));
+	zassert_equal(k_rwlock_write_unlock(&rwlock), -EPERM);
+
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_NO_WAIT));
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_MSEC(TIMEOUT_MS)), -EAGAIN);
+	zassert_ok(k_rwlock_write_unlock(&rwlock));
+
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+}
+
+/**
+ * @brief Test that a waiting writer keeps new readers out
+ *
+ * @details The main thread holds the lock for reading while a writer
+ * waits for it. A new reader must not get in, and the writer must get the
+ * lock as soon as the last reader leaves.
+ *
+ * @ingroup kernel_rwlock_tests
+ */
+ZTEST(rwlock_api, test_rwlock_writer_preference)
+{
+	k_rwlock_init(&rwlock);
+	atomic_set(&writer_done, 0);
+
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_FOREVER));
+
+	k_thread_create(&tdata[0], tstacks[0], STACK_SIZE, writer_entry,
+			&rwlock, NULL, NULL, higher_prio(), 0, K_NO_WAIT);
+
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_NO_WAIT), -EBUSY);
+	zassert_false(atomic_get(&writer_done));
+
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+	zassert_true(atomic_get(&writer_done));
+
+	k_thread_join(&tdata[0], K_FOREVER);
+
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+}
+
+/**
+ * @brief Test that all waiting readers are woken up by the writer
+ *
+ * @ingroup kernel_rwlock_tests
+ */
+ZTEST(rwlock_api, test_rwlock_wake_readers)
+{
+	k_rwlock_init(&rwlock);
+	atomic_set(&readers_in, 0);
+
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_FOREVER));
+
+	for (int i = 0; i < NUM_READERS; i++) {
+		k_thread_create(&tdata[i], tstacks[i], STACK_SIZE, reader_entry,
+				&rwlock, NULL, NULL, higher_prio(), 0, K_NO_WAIT);
+	}
+
+	zassert_equal(atomic_get(&readers_in), 0);
+	zassert_ok(k_rwlock_write_unlock(&rwlock));
+	zassert_equal(atomic_get(&readers_in), NUM_READERS);
+
+	for (int i = 0; i < NUM_READERS; i++) {
+		k_thread_join(&tdata[i], K_FOREVER);
+	}
+
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_NO_WAIT));
+	zassert_ok(k_rwlock_write_unlock(&rwlock));
+}
+
+/**
+ * @brief Test that a writer giving up lets the blocked readers in
+ *
+ * @ingroup kernel_rwlock_tests
+ */
+ZTEST(rwlock_api, test_rwlock_writer_timeout)
+{
+	k_rwlock_init(&rwlock);
+
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_FOREVER));
+
+	k_thread_create(&tdata[0], tstacks[0], STACK_SIZE, writer_timeout_entry,
+			&rwlock, NULL, NULL, higher_prio(), 0, K_NO_WAIT);
+
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_NO_WAIT), -EBUSY);
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_MSEC(TIMEOUT_MS * 2)));
+
+	k_thread_join(&tdata[0], K_FOREVER);
+
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_NO_WAIT));
+	zassert_ok(k_rwlock_write_unlock(&rwlock));
+}
+
+/**
+ * @brief Test priority inheritance of the writer
+ *
+ * @ingroup kernel_rwlock_tests
+ */
+ZTEST(rwlock_api, test_rwlock_priority_inheritance)
+{
+	int prio = k_thread_priority_get(k_current_get());
+
+	k_rwlock_init(&rwlock);
+
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_FOREVER));
+
+	k_thread_create(&tdata[0], tstacks[0], STACK_SIZE, reader_prio_entry,
+			&rwlock, NULL, NULL, prio - 2, 0, K_NO_WAIT);
+
+	zassert_equal(k_thread_priority_get(k_current_get()), prio - 2);
+
+	zassert_ok(k_rwlock_write_unlock(&rwlock));
+	zassert_equal(k_thread_priority_get(k_current_get()), prio);
+
+	k_thread_join(&tdata[0], K_FOREVER);
+}
+
+static void *rwlock_api_setup(void)
+{
+#ifdef CONFIG_USERSPACE
+	k_thread_access_grant(k_current_get(), &static_rwlock, &rwlock);
+#endif
+	return NULL;
+}
+
+ZTEST_SUITE(rwlock_api, NULL, rwlock_api_setup, NULL, NULL, NULL);
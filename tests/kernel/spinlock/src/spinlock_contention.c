@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/spinlock.h>
+
+#ifdef CONFIG_SCHED_CPU_MASK
+
+#define STACK_SIZE	(2 * 1024)
+#define CORES_NUM	CONFIG_MP_MAX_NUM_CPUS
+#define CONTENTION_TEST_CYCLES_PER_CORE 10000
+
+static K_THREAD_STACK_ARRAY_DEFINE(cstack, CORES_NUM, STACK_SIZE);
+static struct k_thread cthread[CORES_NUM];
+static uint32_t elapsed_cycles[CORES_NUM];
+static struct k_spinlock lock;
+static atomic_t start_sync;
+/* Only modified with the lock held, non-atomically on purpose */
+static volatile uint32_t shared_counter;
+
+static void contention_thread(void *arg1, void *arg2, void *arg3)
+{
+	int core_id = (uintptr_t)arg1;
+	uint32_t start;
+	int key;
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	key = arch_irq_lock();
+
+	atomic_dec(&start_sync);
+	while (atomic_get(&start_sync) != 0) {
+	}
+
+	start = k_cycle_get_32();
+
+	/* Short critical sections, so that the lock is always contended */
+	for (int i = 0; i < CONTENTION_TEST_CYCLES_PER_CORE; i++) {
+		k_spinlock_key_t spinlock_key = k_spin_lock(&lock);
+
+		shared_counter = shared_counter + 1;
+
+		k_spin_unlock(&lock, spinlock_key);
+	}
+
+	elapsed_cycles[core_id] = k_cycle_get_32() - start;
+
+	arch_irq_unlock(key);
+}
+
+/**
+ * @brief Benchmark a spinlock contended by all the CPUs
+ *
+ * @details Every CPU takes and releases the same spinlock in a loop,
+ *		incrementing a counter protected by it. The counter must
+ *		account for every acquisition, and the average number of
+ *		cycles per acquisition is printed for each CPU, so that the
+ *		spinlock implementations can be compared.
+ *
+ * @ingroup kernel_spinlock_tests
+ *
+ * @see k_spin_lock(), k_spin_unlock()
+ */
+ZTEST(spinlock, test_spinlock_contention)
+{
+	shared_counter = 0;
+	atomic_set(&start_sync, CORES_NUM);
+
+	for (uintptr_t core_id = 0; core_id < CORES_NUM; core_id++) {
+		k_thread_create(&cthread[core_id], cstack[core_id], STACK_SIZE,
+				contention_thread, (void *)core_id, NULL, NULL,
+				K_PRIO_COOP(10), 0, K_FOREVER);
+		k_thread_cpu_pin(&cthread[core_id], core_id);
+	}
+
+	for (uint8_t core_id = 0; core_id < CORES_NUM; core_id++) {
+		k_thread_start(&cthread[core_id]);
+	}
+
+	for (uint8_t core_id = 0; core_id < CORES_NUM; core_id++) {
+		k_thread_join(&cthread[core_id], K_FOREVER);
+	}
+
+	for (uint8_t core_id = 0; core_id < CORES_NUM; core_id++) {
+		printk("CPU%u: %u cycles per contended spinlock acquisition\n", core_id,
+		       elapsed_cycles[core_id] / CONTENTION_TEST_CYCLES_PER_CORE);
+	}
+
+	zassert_equal(shared_counter, CONTENTION_TEST_CYCLES_PER_CORE * CORES_NUM,
+		      "%u acquisitions counted, expected %u", shared_counter,
+		      CONTENTION_TEST_CYCLES_PER_CORE * CORES_NUM);
+}
+
+#endif /* CONFIG_SCHED_CPU_MASK */
@@ -841,6 +841,39 @@ static void timer_init(struct k_timer *timer, k_timer_expiry_t expiry_fn,
 	k_timer_init(timer, expiry_fn, stop_fn);
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+K_TIMER_DEFINE(slack_timer, NULL, NULL);
+K_TIMER_DEFINE(slack_peer_timer, NULL, NULL);
+
+/**
+ * @brief Test timer slack
+ *
+ * @details A timer with a slack is handled by the wakeup of another timer
+ * due within its slack, instead of its own.
+ *
+ * @ingroup kernel_timer_tests
+ */
+ZTEST(timer_api, test_timer_slack)
+{
+	uint32_t avoided = sys_clock_wakeups_avoided_get();
+
+	k_timer_slack_set(&slack_timer, K_MSEC(DURATION));
+	k_timer_start(&slack_timer, K_MSEC(DURATION), K_NO_WAIT);
+	k_timer_start(&slack_peer_timer, K_MSEC(DURATION + PERIOD), K_NO_WAIT);
+
+	/* busy wait, a sleep would be a wakeup on its own */
+	k_busy_wait((DURATION + PERIOD / 2) * USEC_PER_MSEC);
+	zassert_equal(k_timer_status_get(&slack_timer), 0,
+		      "timer with slack did not wait for its peer");
+
+	zassert_equal(k_timer_status_sync(&slack_peer_timer), 1);
+	zassert_equal(k_timer_status_get(&slack_timer), 1);
+	zassert_true(sys_clock_wakeups_avoided_get() > avoided);
+
+	k_timer_slack_set(&slack_timer, K_NO_WAIT);
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 void *setup_timer_api(void)
 {
 	timer_init(&duration_timer, duration_expire, duration_stop);
@@ -541,5 +541,75 @@ ZTEST(usage_api, test_thread_stats_usage)
 	k_thread_abort(tid);
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HIST
+static uint32_t hist_sum(const uint32_t *hist)
+{
+	uint32_t sum = 0;
+
+	for (int i = 0; i < CONFIG_SCHED_THREAD_USAGE_HIST_BINS; i++) {
+		sum += hist[i];
+	}
+
+	return sum;
+}
+#endif
+
+/**
+ * @brief Test the optional runtime statistics
+ *
+ * The main thread sleeps a few times to go through wait and ready periods,
+ * then busy waits over two load windows, so that the last one is entirely
+ * busy.
+ */
+ZTEST(usage_api, test_extended_stats)
+{
+#if !defined(CONFIG_SCHED_THREAD_USAGE_ISR) && !defined(CONFIG_SCHED_THREAD_USAGE_SCHED) && \
+	!defined(CONFIG_SCHED_THREAD_USAGE_HIST) && !defined(CONFIG_SCHED_THREAD_USAGE_WINDOW)
+	ztest_test_skip();
+#else
+	k_thread_runtime_stats_t  thread_stats;
+	k_thread_runtime_stats_t  cpu_stats;
+
+	for (int i = 0; i < 5; i++) {
+		k_sleep(K_TICKS(1));
+	}
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_WINDOW
+	k_busy_wait(2 * CONFIG_SCHED_THREAD_USAGE_WINDOW_MS * USEC_PER_MSEC);
+#endif
+
+	zassert_ok(k_thread_runtime_stats_get(_current, &thread_stats));
+	zassert_ok(k_thread_runtime_stats_all_get(&cpu_stats));
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_HIST
+	zassert_true(hist_sum(thread_stats.wait_hist) >= 5);
+	zassert_true(hist_sum(thread_stats.ready_hist) >= 5);
+	zassert_true(hist_sum(cpu_stats.ready_hist) >= hist_sum(thread_stats.ready_hist));
+	zassert_equal(hist_sum(cpu_stats.wait_hist), 0);
+#endif
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_WINDOW
+	/* The load is the one of the last window with a single window average */
+	zassert_true(thread_stats.load > 900, "thread load %u", thread_stats.load);
+	zassert_true(cpu_stats.load > 900, "CPU load %u", cpu_stats.load);
+#endif
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_SCHED
+	zassert_equal(thread_stats.sched_cycles, 0);
+	zassert_true(cpu_stats.sched_cycles < cpu_stats.execution_cycles);
+#endif
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ISR
+	struct k_isr_stats  isr_stats;
+
+	zassert_equal(k_isr_runtime_stats_get(CONFIG_NUM_IRQS, &isr_stats), -EINVAL);
+	zassert_equal(k_isr_runtime_stats_get(0, NULL), -EINVAL);
+	zassert_ok(k_isr_runtime_stats_get(0, &isr_stats));
+	zassert_equal(thread_stats.isr_cycles, 0);
+	zassert_true(cpu_stats.isr_cycles < cpu_stats.execution_cycles);
+#endif
+#endif
+}
+
 ZTEST_SUITE(usage_api, NULL, NULL,
 		ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
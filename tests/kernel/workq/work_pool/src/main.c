@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define NUM_WORKERS 2
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WORKER_PRIORITY K_PRIO_PREEMPT(1)
+#define NUM_ITEMS 16
+#define NUM_RESUBMITS 20
+
+K_WORK_Q_POOL_DEFINE(test_pool, NUM_WORKERS, STACK_SIZE);
+
+static struct k_work items[NUM_ITEMS];
+static atomic_t run_count;
+static atomic_t active_count;
+static atomic_t overlap_count;
+
+static struct k_work block_work;
+static struct k_work stolen_work;
+static struct k_work_delayable dwork;
+static struct k_sem block_sem;
+static struct k_sem done_sem;
+static k_tid_t stolen_by;
+
+static struct k_work_sync work_sync;
+
+static void count_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	atomic_inc(&run_count);
+	k_sem_give(&done_sem);
+}
+
+static void block_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_sem_take(&block_sem, K_FOREVER);
+}
+
+static void stolen_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	stolen_by = k_current_get();
+	k_sem_give(&done_sem);
+}
+
+static void resubmit_handler(struct k_work *work)
+{
+	if (atomic_inc(&active_count) != 0) {
+		atomic_inc(&overlap_count);
+	}
+
+	/* Requeue while running, giving the idle sibling a chance to steal */
+	if (atomic_inc(&run_count) < NUM_RESUBMITS - 1) {
+		(void)k_work_submit_to_queue(&test_pool.queues[0], work);
+	}
+
+	k_busy_wait(1000);
+
+	(void)atomic_dec(&active_count);
+
+	if (atomic_get(&run_count) == NUM_RESUBMITS) {
+		k_sem_give(&done_sem);
+	}
+}
+
+static void *work_pool_setup(void)
+{
+	k_work_q_pool_start(&test_pool, WORKER_PRIORITY, NULL);
+
+	return NULL;
+}
+
+static void work_pool_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	atomic_clear(&run_count);
+	atomic_clear(&active_count);
+	atomic_clear(&overlap_count);
+	stolen_by = NULL;
+	k_sem_init(&block_sem, 0, 1);
+	k_sem_init(&done_sem, 0, NUM_ITEMS);
+}
+
+static void work_pool_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_sem_give(&block_sem);
+	zassert_true(k_work_q_pool_drain(&test_pool, false) >= 0);
+}
+
+/**
+ * @brief Verify that every item submitted to a pool is run exactly once.
+ */
+ZTEST(work_pool, test_submit_all_run)
+{
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		k_work_init(&items[i], count_handler);
+		zassert_equal(k_work_submit_to_pool(&test_pool, &items[i]), 1);
+	}
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		zassert_ok(k_sem_take(&done_sem, K_SECONDS(1)));
+	}
+
+	zassert_equal(atomic_get(&run_count), NUM_ITEMS);
+}
+
+/**
+ * @brief Verify that an idle worker steals from a busy sibling.
+ */
+ZTEST(work_pool, test_steal_from_busy_queue)
+{
+	struct k_work_q *busy = &test_pool.queues[0];
+
+	k_work_init(&block_work, block_handler);
+	k_work_init(&stolen_work, stolen_handler);
+
+	/* Occupy the first worker, then queue behind it */
+	zassert_equal(k_work_submit_to_queue(busy, &block_work), 1);
+	k_msleep(10);
+	zassert_true(k_work_busy_get(&block_work) & K_WORK_RUNNING);
+
+	zassert_equal(k_work_submit_to_queue(busy, &stolen_work), 1);
+	zassert_ok(k_sem_take(&done_sem, K_SECONDS(1)),
+		   "queued item was not stolen");
+	zassert_equal(stolen_by, k_work_queue_thread_get(&test_pool.queues[1]));
+
+	k_sem_give(&block_sem);
+	(void)k_work_flush(&block_work, &work_sync);
+	zassert_equal(k_work_busy_get(&block_work), 0);
+}
+
+/**
+ * @brief Verify that flushing an item queued behind a busy worker waits
+ * for that item to complete.
+ */
+ZTEST(work_pool, test_flush_not_stolen)
+{
+	struct k_work_q *busy = &test_pool.queues[0];
+
+	k_work_init(&block_work, block_handler);
+	k_work_init(&items[0], count_handler);
+
+	zassert_equal(k_work_submit_to_queue(busy, &block_work), 1);
+	k_msleep(10);
+
+	zassert_equal(k_work_submit_to_queue(busy, &items[0]), 1);
+	k_sem_give(&block_sem);
+
+	/* Wherever the item ends up running, the flush must wait for it */
+	zassert_true(k_work_flush(&items[0], &work_sync));
+	zassert_equal(atomic_get(&run_count), 1);
+	zassert_equal(k_work_busy_get(&items[0]), 0);
+}
+
+/**
+ * @brief Verify that an item resubmitted by its own handler is not stolen
+ * and run by a sibling worker while the handler is still running.
+ */
+ZTEST(work_pool, test_resubmit_not_stolen)
+{
+	k_work_init(&items[0], resubmit_handler);
+
+	zassert_equal(k_work_submit_to_queue(&test_pool.queues[0], &items[0]), 1);
+	zassert_ok(k_sem_take(&done_sem, K_SECONDS(1)));
+	(void)k_work_flush(&items[0], &work_sync);
+
+	zassert_equal(atomic_get(&run_count), NUM_RESUBMITS);
+	zassert_equal(atomic_get(&overlap_count), 0,
+		      "handler ran concurrently with itself");
+}
+
+/**
+ * @brief Verify delayable work scheduled to a pool and its cancellation.
+ */
+ZTEST(work_pool, test_delayable)
+{
+	k_work_init_delayable(&dwork, count_handler);
+
+	zassert_equal(k_work_schedule_for_pool(&test_pool, &dwork, K_MSEC(10)), 1);
+	zassert_ok(k_sem_take(&done_sem, K_SECONDS(1)));
+	zassert_equal(atomic_get(&run_count), 1);
+
+	zassert_equal(k_work_schedule_for_pool(&test_pool, &dwork, K_SECONDS(10)), 1);
+	zassert_true(k_work_cancel_delayable_sync(&dwork, &work_sync));
+	zassert_false(k_work_delayable_is_pending(&dwork));
+	zassert_equal(atomic_get(&run_count), 1);
+}
+
+/**
+ * @brief Verify that a plugged pool rejects submissions until unplugged.
+ */
+ZTEST(work_pool, test_drain_plug)
+{
+	k_work_init(&items[0], count_handler);
+
+	zassert_true(k_work_q_pool_drain(&test_pool, true) >= 0);
+	zassert_equal(k_work_submit_to_pool(&test_pool, &items[0]), -EBUSY);
+	zassert_ok(k_work_q_pool_unplug(&test_pool));
+	zassert_equal(k_work_q_pool_unplug(&test_pool), -EALREADY);
+	zassert_equal(k_work_submit_to_pool(&test_pool, &items[0]), 1);
+	zassert_ok(k_sem_take(&done_sem, K_SECONDS(1)));
+}
+
+ZTEST_SUITE(work_pool, NULL, work_pool_setup, work_pool_before,
+	    work_pool_after, NULL);
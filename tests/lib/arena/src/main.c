@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/arena.h>
+
+#define ARENA_SZ 256
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static uint8_t __aligned(8) arena_mem[ARENA_SZ];
+static struct sys_arena arena;
+
+K_HEAP_DEFINE(backing_heap, 2 * ARENA_SZ);
+
+static K_THREAD_STACK_DEFINE(child_stack, STACK_SIZE);
+static struct k_thread child_thread;
+
+ZTEST(lib_arena, test_arena_alloc)
+{
+	uint8_t *p1, *p2, *p3;
+
+	sys_arena_init(&arena, arena_mem, sizeof(arena_mem));
+
+	p1 = sys_arena_alloc(&arena, 3);
+	p2 = sys_arena_alloc(&arena, 8);
+	zassert_equal_ptr(p1, arena_mem);
+	zassert_equal_ptr(p2, arena_mem + sizeof(void *));
+
+	p3 = sys_arena_aligned_alloc(&arena, 64, 1);
+	zassert_not_null(p3);
+	zassert_equal((uintptr_t)p3 & 63, 0, "misaligned memory at %p", p3);
+
+	/* Exhaustion must not move the arena */
+	zassert_is_null(sys_arena_alloc(&arena, ARENA_SZ));
+	zassert_is_null(sys_arena_alloc(&arena, SIZE_MAX));
+	zassert_equal(sys_arena_used_get(&arena), p3 + 1 - arena_mem);
+
+	sys_arena_reset(&arena);
+	zassert_equal(sys_arena_used_get(&arena), 0);
+	zassert_equal_ptr(sys_arena_alloc(&arena, ARENA_SZ), arena_mem);
+	zassert_equal(sys_arena_max_used_get(&arena), ARENA_SZ);
+}
+
+ZTEST(lib_arena, test_arena_marks)
+{
+	sys_arena_mark_t outer, inner;
+	void *p1, *p2;
+
+	sys_arena_init(&arena, arena_mem, sizeof(arena_mem));
+	(void)sys_arena_alloc(&arena, 16);
+
+	outer = sys_arena_mark(&arena);
+	p1 = sys_arena_alloc(&arena, 16);
+
+	inner = sys_arena_mark(&arena);
+	p2 = sys_arena_alloc(&arena, 32);
+	zassert_equal(sys_arena_used_get(&arena), 64);
+
+	/* Rewinding releases only what came after the mark */
+	sys_arena_rewind(&arena, inner);
+	zassert_equal(sys_arena_used_get(&arena), 32);
+	zassert_equal_ptr(sys_arena_alloc(&arena, 32), p2);
+
+	sys_arena_rewind(&arena, outer);
+	zassert_equal(sys_arena_used_get(&arena), 16);
+	zassert_equal_ptr(sys_arena_alloc(&arena, 16), p1);
+	zassert_equal(sys_arena_max_used_get(&arena), 64);
+}
+
+ZTEST(lib_arena, test_arena_heap)
+{
+	struct sys_arena heap_arena;
+
+	zassert_ok(sys_arena_init_from_heap(&heap_arena, &backing_heap, ARENA_SZ,
+					    K_NO_WAIT));
+	zassert_not_null(sys_arena_alloc(&heap_arena, ARENA_SZ));
+	zassert_equal(sys_arena_init_from_heap(&arena, &backing_heap, ARENA_SZ * 2,
+					       K_NO_WAIT), -ENOMEM);
+
+	/* Releasing the arena gives its memory back to the heap */
+	sys_arena_release(&heap_arena);
+	zassert_ok(sys_arena_init_from_heap(&heap_arena, &backing_heap, ARENA_SZ,
+					    K_NO_WAIT));
+	sys_arena_release(&heap_arena);
+	zassert_is_null(sys_arena_alloc(&heap_arena, 1));
+}
+
+static void child_entry(void *p1, void *p2, void *p3)
+{
+	zassert_is_null(sys_arena_current());
+	zassert_is_null(sys_arena_thread_alloc(1));
+}
+
+ZTEST(lib_arena, test_arena_thread)
+{
+	sys_arena_init(&arena, arena_mem, sizeof(arena_mem));
+
+	zassert_is_null(sys_arena_thread_alloc(1));
+
+	sys_arena_thread_assign(k_current_get(), &arena);
+	zassert_equal_ptr(sys_arena_current(), &arena);
+	zassert_equal_ptr(sys_arena_thread_alloc(8), arena_mem);
+
+	/* The default arena is not inherited */
+	k_thread_create(&child_thread, child_stack, STACK_SIZE, child_entry,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_thread_join(&child_thread, K_FOREVER);
+
+	sys_arena_thread_assign(k_current_get(), NULL);
+	zassert_is_null(sys_arena_thread_alloc(1));
+}
+
+ZTEST_SUITE(lib_arena, NULL, NULL, NULL, NULL, NULL);
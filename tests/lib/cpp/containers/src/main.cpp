@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/cpp/allocator.hpp>
+#include <zephyr/cpp/intrusive.hpp>
+#include <zephyr/cpp/static_vector.hpp>
+
+#if defined(CONFIG_GLIBCXX_LIBCPP)
+#include <list>
+#include <vector>
+#endif
+
+#define SLAB_BLOCKS 4
+#define SLAB_BLOCK_SIZE 32
+#define LIST_ITEMS 8
+#define MAP_ITEMS 16
+
+K_HEAP_DEFINE(test_heap, 1024);
+K_MEM_SLAB_DEFINE_STATIC(test_slab, SLAB_BLOCK_SIZE, SLAB_BLOCKS, 8);
+
+static int live_objects;
+
+struct counted {
+	int value;
+
+	explicit counted(int v) : value(v)
+	{
+		live_objects++;
+	}
+
+	counted(const counted &other) : value(other.value)
+	{
+		live_objects++;
+	}
+
+	counted &operator=(const counted &other) = default;
+
+	~counted()
+	{
+		live_objects--;
+	}
+};
+
+struct item {
+	int key;
+	sys_snode_t snode;
+	sys_dnode_t dnode;
+	struct rbnode rbnode;
+};
+
+struct item_less {
+	bool operator()(const item &a, const item &b) const
+	{
+		return a.key < b.key;
+	}
+};
+
+ZTEST(cpp_containers, test_heap_allocator)
+{
+	zephyr::heap_allocator<uint32_t> alloc(&test_heap);
+	zephyr::heap_allocator<uint64_t> rebound(alloc);
+	uint64_t *mem;
+
+	zassert_true(rebound == alloc);
+
+	mem = rebound.allocate(8);
+	zassert_not_null(mem);
+	zassert_true(IS_ALIGNED(mem, alignof(uint64_t)));
+	rebound.deallocate(mem, 8);
+
+	/* Everything was given back */
+	mem = rebound.allocate(100);
+	zassert_not_null(mem);
+	rebound.deallocate(mem, 100);
+}
+
+ZTEST(cpp_containers, test_slab_allocator)
+{
+	zephyr::slab_allocator<uint32_t> alloc(&test_slab);
+	uint32_t *blocks[SLAB_BLOCKS];
+
+	for (int i = 0; i < SLAB_BLOCKS; i++) {
+		blocks[i] = alloc.allocate(1);
+		zassert_not_null(blocks[i]);
+	}
+	zassert_equal(k_mem_slab_num_free_get(&test_slab), 0);
+
+#if !defined(CONFIG_CPP_EXCEPTIONS)
+	zassert_is_null(alloc.allocate(1), "the slab is full");
+#endif
+
+	for (int i = 0; i < SLAB_BLOCKS; i++) {
+		alloc.deallocate(blocks[i], 1);
+	}
+	zassert_equal(k_mem_slab_num_free_get(&test_slab), SLAB_BLOCKS);
+
+#if !defined(CONFIG_CPP_EXCEPTIONS)
+	zassert_is_null(alloc.allocate(2), "only single objects fit in a block");
+#endif
+}
+
+ZTEST(cpp_containers, test_arena_allocator)
+{
+	static uint8_t __aligned(8) buf[64];
+	struct sys_arena arena;
+	zephyr::arena_allocator<uint32_t> alloc(&arena);
+	zephyr::arena_allocator<uint8_t> byte_alloc(alloc);
+	uint32_t *words;
+	uint8_t *bytes;
+
+	sys_arena_init(&arena, buf, sizeof(buf));
+	zassert_true(byte_alloc == alloc);
+
+	bytes = byte_alloc.allocate(3);
+	zassert_equal_ptr(bytes, buf);
+
+	words = alloc.allocate(2);
+	zassert_equal_ptr(words, &buf[4], "the allocation is not aligned");
+	zassert_equal(sys_arena_used_get(&arena), 12U);
+
+	/* Only the last allocation is given back */
+	byte_alloc.deallocate(bytes, 3);
+	zassert_equal(sys_arena_used_get(&arena), 12U);
+	alloc.deallocate(words, 2);
+	zassert_equal(sys_arena_used_get(&arena), 4U);
+
+	zassert_is_null(sys_arena_aligned_alloc(&arena, 1, 61), "the arena overflowed");
+	zassert_not_null(sys_arena_aligned_alloc(&arena, 1, 60));
+
+	sys_arena_reset(&arena);
+	zassert_equal(sys_arena_used_get(&arena), 0U);
+}
+
+ZTEST(cpp_containers, test_static_vector)
+{
+	{
+		zephyr::static_vector<counted, 4> vec;
+		int sum = 0;
+
+		for (int i = 0; i < 4; i++) {
+			zassert_true(vec.push_back(counted(i)));
+		}
+		zassert_true(vec.full());
+		zassert_false(vec.push_back(counted(4)), "the vector overflowed");
+		zassert_is_null(vec.emplace_back(4));
+		zassert_equal(live_objects, 4);
+
+		vec.erase(vec.begin() + 1);
+		zassert_equal(vec.size(), 3U);
+		zassert_equal(vec[1].value, 2);
+		zassert_equal(vec.back().value, 3);
+		zassert_equal(live_objects, 3);
+
+		vec.pop_back();
+		zassert_equal(vec.emplace_back(9)->value, 9);
+
+		for (const counted &c : vec) {
+			sum += c.value;
+		}
+		zassert_equal(sum, 0 + 2 + 9);
+	}
+
+	zassert_equal(live_objects, 0, "%d objects were not destroyed", live_objects);
+}
+
+ZTEST(cpp_containers, test_intrusive_lists)
+{
+	static item items[LIST_ITEMS];
+	zephyr::slist<item, &item::snode> slist;
+	zephyr::dlist<item, &item::dnode> dlist;
+	int idx;
+
+	for (int i = 0; i < LIST_ITEMS; i++) {
+		slist.push_back(items[i]);
+		dlist.push_front(items[i]);
+	}
+
+	zassert_equal(slist.size(), (size_t)LIST_ITEMS);
+	zassert_true(slist.remove(items[3]));
+	zassert_false(slist.remove(items[3]));
+	slist.insert_after(&items[2], items[3]);
+
+	idx = 0;
+	for (item &it : slist) {
+		zassert_equal_ptr(&it, &items[idx++]);
+	}
+	zassert_equal(idx, LIST_ITEMS);
+	zassert_equal_ptr(slist.pop_front(), &items[0]);
+
+	zassert_equal_ptr(dlist.front(), &items[LIST_ITEMS - 1]);
+	zassert_equal_ptr(dlist.back(), &items[0]);
+	zassert_equal_ptr(dlist.next(items[5]), &items[4]);
+	zassert_is_null(dlist.prev(*dlist.front()));
+
+	dlist.remove(items[5]);
+	zassert_false(dlist.is_linked(items[5]));
+	dlist.insert_before(items[4], items[5]);
+
+	idx = LIST_ITEMS;
+	for (item &it : dlist) {
+		zassert_equal_ptr(&it, &items[--idx]);
+	}
+	zassert_equal(idx, 0);
+}
+
+ZTEST(cpp_containers, test_rbmap)
+{
+	static item items[MAP_ITEMS];
+	zephyr::rbmap<item, &item::rbnode, item_less> map;
+	item probe;
+	int prev = -1;
+	int count = 0;
+
+	zassert_true(map.empty());
+
+	for (int i = 0; i < MAP_ITEMS; i++) {
+		items[i].key = (i * 7) % MAP_ITEMS;
+		map.insert(items[i]);
+	}
+
+	zassert_equal(map.min()->key, 0);
+	zassert_equal(map.max()->key, MAP_ITEMS - 1);
+
+	probe.key = 6;
+	zassert_not_null(map.find(probe));
+	zassert_equal(map.find(probe)->key, 6);
+	zassert_false(map.contains(probe), "the probe is not linked");
+
+	map.remove(*map.find(probe));
+	zassert_is_null(map.find(probe));
+
+	map.for_each([&](item &it) {
+		zassert_true(it.key > prev, "the map is out of order");
+		prev = it.key;
+		count++;
+	});
+	zassert_equal(count, MAP_ITEMS - 1);
+}
+
+#if defined(CONFIG_GLIBCXX_LIBCPP)
+ZTEST(cpp_containers, test_std_containers)
+{
+	{
+		zephyr::slab_allocator<int> alloc(&test_slab);
+		std::list<int, zephyr::slab_allocator<int>> list(alloc);
+
+		for (int i = 0; i < SLAB_BLOCKS; i++) {
+			list.push_back(i);
+		}
+		zassert_equal(k_mem_slab_num_free_get(&test_slab), 0);
+
+		std::vector<int, zephyr::heap_allocator<int>> vec(
+			zephyr::heap_allocator<int>(&test_heap));
+
+		vec.assign(list.begin(), list.end());
+		zassert_equal(vec.size(), (size_t)SLAB_BLOCKS);
+		zassert_equal(vec.back(), SLAB_BLOCKS - 1);
+	}
+
+	zassert_equal(k_mem_slab_num_free_get(&test_slab), SLAB_BLOCKS);
+}
+#endif
+
+ZTEST_SUITE(cpp_containers, NULL, NULL, NULL, NULL, NULL);
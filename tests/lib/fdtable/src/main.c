@@ -178,4 +178,72 @@ ZTEST(fdtable, test_z_fd_multiple_access)
 	zassert_equal(errno, EBADF, "fd was found");
 }
 
+ZTEST(fdtable, test_zvfs_reserve_lowest_fd)
+{
+	int fds[CONFIG_ZVFS_OPEN_MAX];
+	int count = 0;
+	int fd;
+
+	/* Use up every free descriptor */
+	while (count < ARRAY_SIZE(fds)) {
+		fd = zvfs_reserve_fd();
+		if (fd < 0) {
+			break;
+		}
+
+		fds[count++] = fd;
+	}
+
+	zassert_true(count >= 2, "expected at least two free descriptors");
+	zassert_equal(zvfs_reserve_fd(), -1, "expected the table to be full");
+	zassert_equal(errno, ENFILE);
+
+	/* The lowest free descriptor is reused first */
+	zvfs_free_fd(fds[1]);
+	zvfs_free_fd(fds[0]);
+	fd = zvfs_reserve_fd();
+	zassert_equal(fd, fds[0], "expected the lowest free descriptor");
+	fds[1] = zvfs_reserve_fd();
+	zassert_true(fds[1] > fd, "expected the next free descriptor");
+
+	for (int i = 0; i < count; i++) {
+		zvfs_free_fd(fds[i]);
+	}
+}
+
+ZTEST(fdtable, test_zvfs_get_obj_lock_and_cond)
+{
+	static int objs[2];
+	struct k_mutex *lock;
+	struct k_condvar *cond;
+	const struct fd_op_vtable *vtable;
+	struct k_mutex *fd_lock;
+	int fd[2];
+
+	for (int i = 0; i < ARRAY_SIZE(fd); i++) {
+		fd[i] = zvfs_alloc_fd(&objs[i], VTABLE_INIT);
+		zassert_true(fd[i] >= 0);
+	}
+
+	/* Look up twice, the second time through the cached hint */
+	for (int n = 0; n < 2; n++) {
+		for (int i = 0; i < ARRAY_SIZE(fd); i++) {
+			zassert_true(zvfs_get_obj_lock_and_cond(&objs[i], VTABLE_INIT, &lock,
+								&cond));
+			(void)zvfs_get_fd_obj_and_vtable(fd[i], &vtable, &fd_lock);
+			zassert_equal_ptr(lock, fd_lock, "wrong descriptor found");
+		}
+	}
+
+	zassert_false(zvfs_get_obj_lock_and_cond(&objs[0], NULL, &lock, &cond),
+		      "found an object with another vtable");
+
+	for (int i = 0; i < ARRAY_SIZE(fd); i++) {
+		zvfs_free_fd(fd[i]);
+	}
+
+	zassert_false(zvfs_get_obj_lock_and_cond(&objs[0], VTABLE_INIT, &lock, &cond),
+		      "found a freed descriptor");
+}
+
 ZTEST_SUITE(fdtable, NULL, NULL, NULL, NULL, NULL);
@@ -7,6 +7,7 @@
 #include <zephyr/ztest.h>
 #include <zephyr/sys/sys_heap.h>
 #include <zephyr/sys/heap_listener.h>
+#include <zephyr/sys/heap_tracker.h>
 #include <inttypes.h>
 
 /* Guess at a value for heap size based on available memory on the
@@ -146,6 +147,43 @@ void testfree(void *arg, void *p)
 	sys_heap_validate(arg);
 }
 
+/* Resizes and aligns blocks as well, checking the markers of the old
+ * block survived the move.
+ */
+void *testrealloc(void *arg, void *p, size_t bytes)
+{
+	size_t align = sizeof(void *) << (bytes % 4);
+	size_t old_sz = 0, old_tok = 0;
+	void *ret;
+
+	if (p != NULL) {
+		check_fill(p);
+		old_sz = ((size_t *)p)[0];
+		old_tok = fill_token(p, old_sz);
+	}
+
+	ret = sys_heap_aligned_realloc(arg, p, align, bytes);
+
+	if (ret != NULL) {
+		zassert_true(IS_ALIGNED(ret, align), "block %p not aligned to %zu", ret, align);
+
+		if ((p != NULL) && (bytes >= sizeof(size_t))) {
+			zassert_equal(((size_t *)ret)[0], old_sz, "data lost by realloc");
+			if ((old_sz >= 2 * sizeof(size_t)) && (bytes >= 2 * sizeof(size_t))) {
+				zassert_equal(((size_t *)ret)[1], old_tok, "data lost by realloc");
+			}
+		}
+
+		fill_block(ret, bytes);
+	} else if ((p != NULL) && (bytes != 0)) {
+		/* Failed resizes leave the block alone */
+		check_fill(p);
+	}
+
+	sys_heap_validate(arg);
+	return ret;
+}
+
 static void log_result(size_t sz, struct z_heap_stress_result *r)
 {
 	uint32_t tot = r->total_allocs + r->total_frees;
@@ -238,6 +276,29 @@ ZTEST(lib_heap, test_big_heap)
 	log_result(BIG_HEAP_SZ, &result);
 }
 
+/* Same as test_small_heap, but growing and shrinking blocks with
+ * aligned reallocations instead of only allocating and freeing them.
+ */
+ZTEST(lib_heap, test_realloc_stress)
+{
+	struct sys_heap heap;
+	struct z_heap_stress_result result;
+
+	TC_PRINT("Testing realloc on a small (%d byte) heap\n", (int) SMALL_HEAP_SZ);
+
+	sys_heap_init(&heap, heapmem, SMALL_HEAP_SZ);
+	zassert_true(sys_heap_validate(&heap), "");
+	sys_heap_realloc_stress(testrealloc, &heap,
+				SMALL_HEAP_SZ, ITERATION_COUNT,
+				scratchmem, sizeof(scratchmem),
+				50, &result);
+
+	log_result(SMALL_HEAP_SZ, &result);
+	TC_PRINT("successful reallocs: %d/%d\n",
+		 result.successful_reallocs, result.total_reallocs);
+	zassert_true(result.successful_reallocs > 0, "");
+}
+
 /* Test a heap with a solo free header.  A solo free header can exist
  * only on a heap with 64 bit CPU (or chunk_header_bytes() == 8).
  * With 64 bytes heap and 1 byte allocation on a big heap, we get:
@@ -259,8 +320,9 @@ ZTEST(lib_heap, test_solo_free_header)
 
 	TC_PRINT("Testing solo free header in a heap\n");
 
-	sys_heap_init(&heap, heapmem, SOLO_FREE_HEADER_HEAP_SZ);
-	if (sizeof(void *) > 4U) {
+	/* The heap size is tailored to the layout without size classes */
+	if (sizeof(void *) > 4U && !IS_ENABLED(CONFIG_SYS_HEAP_SIZE_CLASSES)) {
+		sys_heap_init(&heap, heapmem, SOLO_FREE_HEADER_HEAP_SZ);
 		sys_heap_alloc(&heap, 1);
 		zassert_true(sys_heap_validate(&heap), "");
 	} else {
@@ -385,6 +447,23 @@ ZTEST(lib_heap, test_realloc)
 	zassert_true(sys_heap_validate(&heap), "invalid heap");
 	zassert_true(p2 != p3,
 		     "Realloc should have moved %p", p2);
+
+	/* Free the block before another, then expand the second while
+	 * the next one is in use.  Validate that it moves down into the
+	 * freed block.
+	 */
+	sys_heap_init(&heap, heapmem, SMALL_HEAP_SZ);
+	p1 = sys_heap_alloc(&heap, 64);
+	p2 = sys_heap_alloc(&heap, 64);
+	realloc_fill_block(p2, 64);
+	p3 = sys_heap_alloc(&heap, 64);
+	sys_heap_free(&heap, p1);
+	p3 = sys_heap_realloc(&heap, p2, 112);
+
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+	zassert_true(p3 == p1,
+		     "Realloc should have moved down %p -> %p", p2, p1);
+	zassert_true(realloc_check_block(p3, p2, 64), "data changed");
 }
 
 #ifdef CONFIG_SYS_HEAP_LISTENER
@@ -485,4 +564,128 @@ ZTEST(lib_heap, test_heap_listeners)
 #endif /* CONFIG_SYS_HEAP_LISTENER */
 }
 
+ZTEST(lib_heap, test_size_classes)
+{
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	struct sys_heap heap;
+	struct sys_heap_size_class_stats stats;
+	void *blocks[CONFIG_SYS_HEAP_SIZE_CLASS_DEPTH + 1];
+	void *p1, *p2;
+
+	sys_heap_init(&heap, heapmem, SMALL_HEAP_SZ);
+
+	/* Requests are rounded up to their class, freed chunks are reused */
+	p1 = sys_heap_alloc(&heap, 20);
+	zassert_not_null(p1, "alloc failed");
+	zassert_true(sys_heap_usable_size(&heap, p1) >= 32, "not rounded up");
+	sys_heap_free(&heap, p1);
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+
+	p2 = sys_heap_alloc(&heap, 32);
+	zassert_equal_ptr(p1, p2, "cached chunk was not reused");
+	sys_heap_free(&heap, p2);
+
+	zassert_ok(sys_heap_size_class_stats_get(&heap, 1, &stats));
+	zassert_equal(stats.bytes, 32);
+	zassert_equal(stats.allocs, 2);
+	zassert_equal(stats.hits, 1);
+	zassert_equal(stats.cached, 1);
+
+	/* Only a bounded number of chunks stays cached per class */
+	for (int i = 0; i < ARRAY_SIZE(blocks); i++) {
+		blocks[i] = sys_heap_alloc(&heap, 100);
+		zassert_not_null(blocks[i], "alloc failed");
+	}
+	for (int i = 0; i < ARRAY_SIZE(blocks); i++) {
+		sys_heap_free(&heap, blocks[i]);
+	}
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+
+	zassert_ok(sys_heap_size_class_stats_get(&heap, 3, &stats));
+	zassert_equal(stats.bytes, 128);
+	zassert_equal(stats.allocs, ARRAY_SIZE(blocks));
+	zassert_equal(stats.hits, 0);
+	zassert_equal(stats.cached, CONFIG_SYS_HEAP_SIZE_CLASS_DEPTH);
+
+	/* Bigger requests are not affected */
+	p1 = sys_heap_alloc(&heap, 300);
+	zassert_not_null(p1, "alloc failed");
+	zassert_true(sys_heap_usable_size(&heap, p1) < 320, "rounded up");
+	sys_heap_free(&heap, p1);
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+
+	zassert_equal(sys_heap_size_class_stats_get(&heap, SYS_HEAP_NUM_SIZE_CLASSES,
+						    &stats), -EINVAL);
+#else
+	ztest_test_skip();
+#endif /* CONFIG_SYS_HEAP_SIZE_CLASSES */
+}
+
+#ifdef CONFIG_SYS_HEAP_TRACKER
+static struct sys_heap tracker_heap;
+
+static bool get_site(const struct sys_heap_tracker_site *site, void *user_data)
+{
+	*(struct sys_heap_tracker_site *)user_data = *site;
+
+	return false;
+}
+#endif
+
+ZTEST(lib_heap, test_heap_tracker)
+{
+#ifdef CONFIG_SYS_HEAP_TRACKER
+	struct sys_heap_tracker_site site;
+	struct sys_heap_frag_info info;
+	char map[17];
+	void *blocks[6];
+	size_t bytes;
+
+	sys_heap_init(&tracker_heap, heapmem, SMALL_HEAP_SZ);
+
+	/* All the blocks come from the same call site */
+	for (int i = 0; i < ARRAY_SIZE(blocks); i++) {
+		blocks[i] = sys_heap_alloc(&tracker_heap, 64);
+		zassert_not_null(blocks[i], "alloc failed");
+	}
+
+	sys_heap_tracker_foreach(&tracker_heap, get_site, &site);
+	zassert_equal_ptr(site.heap, &tracker_heap);
+	zassert_equal_ptr(site.thread, k_current_get());
+	zassert_not_equal(site.pc[0], 0);
+	zassert_equal(site.count, ARRAY_SIZE(blocks));
+	zassert_equal(site.allocs, ARRAY_SIZE(blocks));
+	zassert_true(site.bytes >= ARRAY_SIZE(blocks) * 64);
+	bytes = site.bytes;
+
+	/* Every other block left in use sits between free chunks */
+	for (int i = 0; i < ARRAY_SIZE(blocks); i += 2) {
+		sys_heap_free(&tracker_heap, blocks[i]);
+	}
+
+	sys_heap_tracker_frag_map(&tracker_heap, map, 16, &info);
+	zassert_equal(strlen(map), 16);
+	zassert_equal(info.free_chunks, ARRAY_SIZE(blocks) / 2 + 1);
+	zassert_true(info.largest_free < info.free_bytes);
+
+	sys_heap_tracker_foreach(&tracker_heap, get_site, &site);
+	zassert_equal(site.count, ARRAY_SIZE(blocks) / 2);
+	zassert_equal(site.bytes, bytes / 2);
+	zassert_equal(site.max_bytes, bytes);
+	zassert_equal(site.pinning, ARRAY_SIZE(blocks) / 2);
+
+	sys_heap_tracker_reset_max();
+	sys_heap_tracker_foreach(&tracker_heap, get_site, &site);
+	zassert_equal(site.max_bytes, bytes / 2);
+
+	/* Reinitializing the heap forgets its live allocations */
+	sys_heap_init(&tracker_heap, heapmem, SMALL_HEAP_SZ);
+	sys_heap_tracker_foreach(&tracker_heap, get_site, &site);
+	zassert_equal(site.count, 0);
+	zassert_equal(site.bytes, 0);
+#else
+	ztest_test_skip();
+#endif /* CONFIG_SYS_HEAP_TRACKER */
+}
+
 ZTEST_SUITE(lib_heap, NULL, NULL, NULL, NULL, NULL);
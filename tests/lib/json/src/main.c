@@ -219,6 +219,72 @@ ZTEST(lib_json_test, test_json_encoding)
 	zassert_equal(ret, 0, "Encoded contents not consistent");
 }
 
+struct stream_sink {
+	char buf[256];
+	size_t used;
+	int flushes;
+};
+
+static int stream_sink_flush(const char *bytes, size_t len, void *data)
+{
+	struct stream_sink *sink = data;
+
+	if (len >= sizeof(sink->buf) - sink->used) {
+		return -ENOMEM;
+	}
+
+	memcpy(sink->buf + sink->used, bytes, len);
+	sink->used += len;
+	sink->buf[sink->used] = '\0';
+	sink->flushes++;
+
+	return 0;
+}
+
+ZTEST(lib_json_test, test_json_stream_encoding)
+{
+	struct test_nested elems[] = {
+		{ 1, true, "first" },
+		{ -2, false, "second, with \"escapes\"" },
+		{ 3, true, "" },
+	};
+	char encoded[] = "[{\"nested_int\":1,\"nested_bool\":true,\"nested_string\":\"first\"},"
+		"{\"nested_int\":-2,\"nested_bool\":false,"
+		"\"nested_string\":\"second, with \\\"escapes\\\"\"},"
+		"{\"nested_int\":3,\"nested_bool\":true,\"nested_string\":\"\"}]";
+	struct stream_sink sink = { 0 };
+	struct json_stream stream;
+	char buf[8];
+	int ret;
+
+	json_stream_init(&stream, buf, sizeof(buf), stream_sink_flush, &sink);
+
+	/* Array generated one element at a time, as for a large response */
+	ret = json_stream_write(&stream, "[", 1);
+	zassert_equal(ret, 0, "Writing to the stream failed");
+
+	ARRAY_FOR_EACH(elems, i) {
+		if (i > 0) {
+			ret = json_stream_write(&stream, ",", 1);
+			zassert_equal(ret, 0, "Writing to the stream failed");
+		}
+
+		ret = json_obj_encode_stream(nested_descr, ARRAY_SIZE(nested_descr),
+					     &elems[i], &stream);
+		zassert_equal(ret, 0, "Encoding function failed");
+	}
+
+	ret = json_stream_write(&stream, "]", 1);
+	zassert_equal(ret, 0, "Writing to the stream failed");
+	zassert_true(sink.used < strlen(encoded), "Stream not buffered");
+
+	ret = json_stream_flush(&stream);
+	zassert_equal(ret, 0, "Flushing the stream failed");
+
+	zassert_str_equal(sink.buf, encoded, "Encoded contents not consistent");
+	zassert_true(sink.flushes > 1, "Stream not written out in chunks");
+}
+
 ZTEST(lib_json_test, test_json_decoding)
 {
 	struct test_struct ts;
@@ -1009,6 +1075,28 @@ ZTEST(lib_json_test, test_json_key_not_in_descr)
 	zassert_equal(ret, 0, "No items should be decoded");
 }
 
+ZTEST(lib_json_test, test_json_decoding_unordered)
+{
+	struct test_nested ts;
+	char encoded[] = "{\"nested_string\":\"a string longer than a word, "
+			 "with \\\"escapes\\\" \\t in between\","
+			 "                \"nested_int\":\t\n        1234,"
+			 "\"nested_string\":\"duplicate\","
+			 "\"nested_bool\":true}";
+	int ret;
+
+	ret = json_obj_parse(encoded, sizeof(encoded) - 1, nested_descr,
+			     ARRAY_SIZE(nested_descr), &ts);
+
+	zassert_equal(ret, (1 << ARRAY_SIZE(nested_descr)) - 1,
+		      "Not all fields decoded correctly");
+	zassert_str_equal(ts.nested_string,
+			  "a string longer than a word, with \\\"escapes\\\" \\t in between",
+			  "String not decoded correctly");
+	zassert_equal(ts.nested_int, 1234, "Integer not decoded correctly");
+	zassert_true(ts.nested_bool, "Boolean not decoded correctly");
+}
+
 ZTEST(lib_json_test, test_json_escape)
 {
 	char buf[42];
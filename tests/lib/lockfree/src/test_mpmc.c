@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/mpmc_lockfree.h>
+
+#define MPMC_THREADS_NUM 4
+#define MPMC_STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define MPMC_ITERATIONS 1000
+
+MPMC_DEFINE(ezmpmc, uint32_t, 4);
+MPMC_WAIT_DEFINE(wait_q, uint32_t, 8);
+
+static K_THREAD_STACK_ARRAY_DEFINE(mpmc_stack, MPMC_THREADS_NUM, MPMC_STACK_SIZE);
+static struct k_thread mpmc_thread[MPMC_THREADS_NUM];
+static atomic_t consumed_sum;
+
+/*
+ * @brief Push and pop in the same execution context, wrapping around
+ *
+ * @see mpmc_push(), mpmc_pop()
+ *
+ * @ingroup tests
+ */
+ZTEST(mpmc, test_push_pop_wrap_around)
+{
+	uint32_t val;
+
+	mpmc_reset(&ezmpmc);
+
+	for (uint32_t i = 0; i < 10; i++) {
+		for (uint32_t j = 0; j < mpmc_size(&ezmpmc); j++) {
+			val = i * 10 + j;
+			zassert_true(mpmc_push(&ezmpmc, &val), "Push should succeed");
+		}
+		zassert_false(mpmc_push(&ezmpmc, &val), "Push should fail");
+		zassert_equal(mpmc_consumable(&ezmpmc), mpmc_size(&ezmpmc));
+
+		for (uint32_t j = 0; j < mpmc_size(&ezmpmc); j++) {
+			zassert_true(mpmc_pop(&ezmpmc, &val), "Pop should succeed");
+			zassert_equal(val, i * 10 + j, "Elements should be in order");
+		}
+		zassert_false(mpmc_pop(&ezmpmc, &val), "Pop should fail");
+		zassert_equal(mpmc_consumable(&ezmpmc), 0);
+	}
+}
+
+static void mpmc_producer(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	uint32_t base = (uint32_t)(uintptr_t)p1 * MPMC_ITERATIONS;
+
+	for (uint32_t i = 1; i <= MPMC_ITERATIONS; i++) {
+		uint32_t val = base + i;
+
+		zassert_ok(mpmc_push_wait(&wait_q, &val, K_FOREVER));
+	}
+}
+
+static void mpmc_consumer(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	uint32_t val;
+
+	for (int i = 0; i < MPMC_ITERATIONS; i++) {
+		zassert_ok(mpmc_pop_wait(&wait_q, &val, K_FOREVER));
+		atomic_add(&consumed_sum, val);
+	}
+}
+
+/**
+ * @brief Test that blocking producers and consumers get every element once
+ *
+ * This can and should be validated on SMP machines where incoherent
+ * memory could cause issues.
+ */
+ZTEST(mpmc, test_mpmc_threaded)
+{
+	const uint32_t n = MPMC_ITERATIONS * (MPMC_THREADS_NUM / 2);
+
+	mpmc_wait_reset(&wait_q);
+	atomic_clear(&consumed_sum);
+
+	for (int i = 0; i < MPMC_THREADS_NUM; i++) {
+		k_thread_create(&mpmc_thread[i], mpmc_stack[i], MPMC_STACK_SIZE,
+				(i % 2) ? mpmc_consumer : mpmc_producer,
+				(void *)(uintptr_t)(i / 2), NULL, NULL,
+				K_PRIO_PREEMPT(5), K_INHERIT_PERMS, K_NO_WAIT);
+	}
+
+	for (int i = 0; i < MPMC_THREADS_NUM; i++) {
+		k_thread_join(&mpmc_thread[i], K_FOREVER);
+	}
+
+	zassert_equal(atomic_get(&consumed_sum), n * (n + 1) / 2,
+		      "Elements were lost or duplicated");
+	zassert_equal(mpmc_consumable(&wait_q), 0);
+}
+
+/**
+ * @brief Test the timeouts of the blocking wrappers
+ *
+ * @see mpmc_push_wait(), mpmc_pop_wait()
+ */
+ZTEST(mpmc, test_mpmc_wait_timeout)
+{
+	uint32_t val = 0;
+
+	mpmc_wait_reset(&wait_q);
+
+	zassert_equal(mpmc_pop_wait(&wait_q, &val, K_NO_WAIT), -EBUSY);
+	zassert_equal(mpmc_pop_wait(&wait_q, &val, K_MSEC(10)), -EAGAIN);
+
+	for (uint32_t i = 0; i < mpmc_size(&wait_q); i++) {
+		zassert_ok(mpmc_push_wait(&wait_q, &i, K_NO_WAIT));
+	}
+	zassert_equal(mpmc_push_wait(&wait_q, &val, K_NO_WAIT), -EBUSY);
+	zassert_equal(mpmc_push_wait(&wait_q, &val, K_MSEC(10)), -EAGAIN);
+
+	for (uint32_t i = 0; i < mpmc_size(&wait_q); i++) {
+		zassert_ok(mpmc_pop_wait(&wait_q, &val, K_NO_WAIT));
+		zassert_equal(val, i);
+	}
+}
+
+#ifdef CONFIG_POLL
+static void mpmc_poll_producer(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	uint32_t val = 42;
+
+	k_msleep(10);
+	zassert_ok(mpmc_push_wait(&wait_q, &val, K_NO_WAIT));
+}
+#endif
+
+/**
+ * @brief Test waiting for an element with k_poll()
+ *
+ * @see mpmc_poll_event_init(), mpmc_poll_pop()
+ */
+ZTEST(mpmc, test_mpmc_poll)
+{
+#ifdef CONFIG_POLL
+	struct k_poll_event event;
+	uint32_t val = 0;
+
+	mpmc_wait_reset(&wait_q);
+	mpmc_poll_event_init(&wait_q, &event);
+
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN);
+	zassert_equal(mpmc_poll_pop(&wait_q, &val), -EBUSY);
+
+	k_thread_create(&mpmc_thread[0], mpmc_stack[0], MPMC_STACK_SIZE,
+			mpmc_poll_producer, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(5), K_INHERIT_PERMS, K_NO_WAIT);
+
+	zassert_ok(k_poll(&event, 1, K_FOREVER));
+	zassert_ok(mpmc_poll_pop(&wait_q, &val));
+	zassert_equal(val, 42);
+
+	event.state = K_POLL_STATE_NOT_READY;
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN);
+
+	mpmc_poll_event_cleanup(&wait_q);
+	k_thread_join(&mpmc_thread[0], K_FOREVER);
+#else
+	ztest_test_skip();
+#endif
+}
+
+ZTEST_SUITE(mpmc, NULL, NULL, NULL, NULL, NULL);
@@ -604,6 +604,53 @@ ZTEST(ringbuffer_api, test_ringbuffer_alloc_put)
 	}
 }
 
+ZTEST(ringbuffer_api, test_ringbuffer_claim_vec)
+{
+	uint8_t inbuf[RINGBUFFER_SIZE] = {1, 2, 3, 4, 5};
+	uint8_t outbuf[RINGBUFFER_SIZE];
+	struct ring_buf_vec vec[2];
+	uint32_t size;
+
+	ring_buf_init(&ringbuf_raw, RINGBUFFER_SIZE, ringbuf_raw.buffer);
+
+	size = ring_buf_get_claim_vec(&ringbuf_raw, vec, RINGBUFFER_SIZE);
+	zassert_equal(size, 0);
+	zassert_equal(vec[0].size + vec[1].size, 0);
+
+	/* move the heads so that the whole buffer wraps */
+	zassert_equal(ring_buf_put(&ringbuf_raw, inbuf, 3), 3);
+	zassert_equal(ring_buf_get(&ringbuf_raw, NULL, 3), 3);
+
+	size = ring_buf_put_claim_vec(&ringbuf_raw, vec, RINGBUFFER_SIZE + 1);
+	zassert_equal(size, RINGBUFFER_SIZE);
+	zassert_equal_ptr(vec[0].data, &ringbuf_raw.buffer[3]);
+	zassert_equal(vec[0].size, 2);
+	zassert_equal_ptr(vec[1].data, ringbuf_raw.buffer);
+	zassert_equal(vec[1].size, 3);
+
+	memcpy(vec[0].data, inbuf, vec[0].size);
+	memcpy(vec[1].data, &inbuf[vec[0].size], vec[1].size);
+	zassert_ok(ring_buf_put_finish(&ringbuf_raw, size));
+	zassert_equal(ring_buf_space_get(&ringbuf_raw), 0);
+
+	/* no wrap, the second segment is empty */
+	size = ring_buf_get_claim_vec(&ringbuf_raw, vec, 1);
+	zassert_equal(size, 1);
+	zassert_equal(vec[1].size, 0);
+	zassert_ok(ring_buf_get_finish(&ringbuf_raw, 0));
+
+	size = ring_buf_get_claim_vec(&ringbuf_raw, vec, RINGBUFFER_SIZE);
+	zassert_equal(size, RINGBUFFER_SIZE);
+	zassert_equal(vec[0].size, 2);
+	zassert_equal(vec[1].size, 3);
+
+	memcpy(outbuf, vec[0].data, vec[0].size);
+	memcpy(&outbuf[vec[0].size], vec[1].data, vec[1].size);
+	zassert_mem_equal(outbuf, inbuf, RINGBUFFER_SIZE);
+	zassert_ok(ring_buf_get_finish(&ringbuf_raw, size));
+	zassert_true(ring_buf_is_empty(&ringbuf_raw));
+}
+
 ZTEST(ringbuffer_api, test_byte_put_free)
 {
 	uint8_t indata[] = {1, 2, 3, 4, 5};
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/sharded_heap.h>
+
+#define HEAP_BYTES   8192
+#define SHARED_BYTES 2048
+#define BLOCK_BYTES  128
+#define MAX_BLOCKS   (HEAP_BYTES / BLOCK_BYTES)
+#define STACK_SIZE   (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static uint8_t __aligned(8) heap_mem[HEAP_BYTES];
+static struct sys_sharded_heap heap;
+static void *blocks[MAX_BLOCKS];
+
+static bool in_shared_arena(void *mem)
+{
+	return (uint8_t *)mem < &heap_mem[SHARED_BYTES];
+}
+
+static unsigned int cpu_arena(void *mem)
+{
+	size_t idx = ((uintptr_t)mem - (uintptr_t)&heap_mem[SHARED_BYTES]) / heap.cpu_bytes;
+
+	return MIN(idx, arch_num_cpus() - 1);
+}
+
+static int fill_heap(void)
+{
+	int n;
+
+	for (n = 0; n < MAX_BLOCKS; n++) {
+		blocks[n] = sys_sharded_heap_alloc(&heap, BLOCK_BYTES);
+		if (blocks[n] == NULL) {
+			break;
+		}
+	}
+
+	return n;
+}
+
+static void empty_heap(int n)
+{
+	for (int i = 0; i < n; i++) {
+		sys_sharded_heap_free(&heap, blocks[i]);
+	}
+}
+
+ZTEST(sharded_heap, test_alloc_free)
+{
+	uint8_t *mem, *grown;
+
+	mem = sys_sharded_heap_alloc(&heap, 100);
+	zassert_not_null(mem);
+	zassert_false(in_shared_arena(mem), "the CPU arena is used first");
+	memset(mem, 0xa5, 100);
+
+	grown = sys_sharded_heap_aligned_realloc(&heap, mem, 0, 1000);
+	zassert_not_null(grown);
+	for (int i = 0; i < 100; i++) {
+		zassert_equal(grown[i], 0xa5, "realloc lost the data at %d", i);
+	}
+
+	mem = sys_sharded_heap_aligned_alloc(&heap, 64, 10);
+	zassert_not_null(mem);
+	zassert_true(IS_ALIGNED(mem, 64));
+
+	sys_sharded_heap_free(&heap, mem);
+	zassert_is_null(sys_sharded_heap_aligned_realloc(&heap, grown, 0, 0));
+	sys_sharded_heap_free(&heap, NULL);
+	zassert_is_null(sys_sharded_heap_alloc(&heap, 0));
+	zassert_is_null(sys_sharded_heap_alloc(&heap, HEAP_BYTES));
+}
+
+ZTEST(sharded_heap, test_fallback)
+{
+	uint32_t cpu_arenas = 0;
+	bool shared = false;
+	int first_n, n;
+
+	first_n = fill_heap();
+	zassert_true(first_n > 0);
+
+	for (int i = 0; i < first_n; i++) {
+		if (in_shared_arena(blocks[i])) {
+			shared = true;
+		} else {
+			cpu_arenas |= BIT(cpu_arena(blocks[i]));
+		}
+	}
+
+	/* All the arenas are used once the CPU arena is full */
+	zassert_true(shared, "the shared arena was not used");
+	zassert_equal(cpu_arenas, BIT_MASK(arch_num_cpus()),
+		      "the arenas of the other CPUs were not used");
+
+	/* Everything came back */
+	empty_heap(first_n);
+	n = fill_heap();
+	zassert_equal(n, first_n, "%d blocks allocated, expected %d", n, first_n);
+	empty_heap(n);
+}
+
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_CPU_MASK)
+static K_THREAD_STACK_DEFINE(stack, STACK_SIZE);
+static struct k_thread thread;
+static void *block;
+
+static void alloc_entry(void *p1, void *p2, void *p3)
+{
+	block = sys_sharded_heap_alloc(&heap, BLOCK_BYTES);
+}
+
+static void free_entry(void *p1, void *p2, void *p3)
+{
+	sys_sharded_heap_free(&heap, block);
+}
+
+static void run_on_cpu(k_thread_entry_t entry, int cpu)
+{
+	k_thread_create(&thread, stack, STACK_SIZE, entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(1), 0, K_FOREVER);
+	zassert_ok(k_thread_cpu_pin(&thread, cpu));
+	k_thread_start(&thread);
+	zassert_ok(k_thread_join(&thread, K_FOREVER));
+}
+#endif
+
+ZTEST(sharded_heap, test_remote_free)
+{
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_CPU_MASK)
+	struct sys_sharded_heap_arena *arena = &heap.arenas[1];
+
+	if (arch_num_cpus() < 2) {
+		ztest_test_skip();
+	}
+
+	run_on_cpu(alloc_entry, 0);
+	zassert_not_null(block);
+
+	/* A free from another CPU is left to the owner */
+	run_on_cpu(free_entry, 1);
+	zassert_equal_ptr(atomic_ptr_get(&arena->remote), block);
+
+	/* And done by its next allocation */
+	run_on_cpu(alloc_entry, 0);
+	zassert_is_null(atomic_ptr_get(&arena->remote));
+	run_on_cpu(free_entry, 0);
+	zassert_is_null(atomic_ptr_get(&arena->remote));
+#else
+	ztest_test_skip();
+#endif
+}
+
+static void sharded_heap_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	sys_sharded_heap_init(&heap, heap_mem, sizeof(heap_mem), SHARED_BYTES);
+}
+
+ZTEST_SUITE(sharded_heap, NULL, NULL, sharded_heap_before, NULL, NULL);
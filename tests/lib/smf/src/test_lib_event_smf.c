@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/smf.h>
+
+/*
+ * Event Test Transition:
+ *
+ *	PARENT
+ *	|-- A --EV_NEXT--> B --EV_NEXT--> C --EV_STOP--> terminate
+ *	|
+ *	|-- EV_RESET --> A
+ *
+ * B posts EV_NEXT from its EV_NEXT handler, so the event must only be
+ * dispatched once B was entered.
+ */
+
+#define TEST_OBJECT(o) ((struct test_object *)o)
+
+#define TEST_TERMINATE_VAL 42
+
+enum test_event {
+	EV_NEXT,
+	EV_RESET,
+	EV_STOP,
+	EV_IGNORED,
+};
+
+enum test_state {
+	PARENT,
+	STATE_A,
+	STATE_B,
+	STATE_C,
+};
+
+static const struct smf_state test_states[];
+
+SMF_EVENT_QUEUE_DEFINE(test_queue, 4);
+
+static struct test_object {
+	struct smf_ctx ctx;
+	uint32_t a_entries;
+	uint32_t b_entries;
+	uint32_t c_entries;
+	uint32_t resets;
+	uint32_t last_data;
+} test_obj;
+
+static void a_entry(void *obj)
+{
+	TEST_OBJECT(obj)->a_entries++;
+}
+
+static void a_next(void *obj, const struct smf_event *event)
+{
+	smf_set_state(SMF_CTX(obj), &test_states[STATE_B]);
+}
+
+static void b_entry(void *obj)
+{
+	TEST_OBJECT(obj)->b_entries++;
+}
+
+static void b_next(void *obj, const struct smf_event *event)
+{
+	/* Dispatched after this event was processed, i.e. in C */
+	zassert_ok(smf_post_event(SMF_CTX(obj), EV_NEXT, NULL));
+	smf_set_state(SMF_CTX(obj), &test_states[STATE_C]);
+}
+
+static void c_entry(void *obj)
+{
+	TEST_OBJECT(obj)->c_entries++;
+}
+
+static void c_stop(void *obj, const struct smf_event *event)
+{
+	TEST_OBJECT(obj)->last_data = POINTER_TO_UINT(event->data);
+	smf_set_terminate(SMF_CTX(obj), TEST_TERMINATE_VAL);
+}
+
+static void parent_reset(void *obj, const struct smf_event *event)
+{
+	TEST_OBJECT(obj)->resets++;
+	smf_set_state(SMF_CTX(obj), &test_states[STATE_A]);
+}
+
+static const smf_event_handler parent_events[] = {
+	[EV_RESET] = parent_reset,
+};
+
+static const smf_event_handler a_events[] = {
+	[EV_NEXT] = a_next,
+};
+
+static const smf_event_handler b_events[] = {
+	[EV_NEXT] = b_next,
+};
+
+static const smf_event_handler c_events[] = {
+	[EV_STOP] = c_stop,
+};
+
+static const struct smf_state test_states[] = {
+	[PARENT] = SMF_CREATE_EVENT_STATE(NULL, NULL, NULL, NULL, NULL, parent_events),
+	[STATE_A] = SMF_CREATE_EVENT_STATE(a_entry, NULL, NULL, &test_states[PARENT], NULL,
+					   a_events),
+	[STATE_B] = SMF_CREATE_EVENT_STATE(b_entry, NULL, NULL, &test_states[PARENT], NULL,
+					   b_events),
+	[STATE_C] = SMF_CREATE_EVENT_STATE(c_entry, NULL, NULL, &test_states[PARENT], NULL,
+					   c_events),
+};
+
+ZTEST(smf_tests, test_smf_events)
+{
+	struct smf_event event = { .id = EV_IGNORED };
+
+	smf_set_initial((struct smf_ctx *)&test_obj, &test_states[STATE_A]);
+	zassert_equal(smf_post_event(SMF_CTX(&test_obj), EV_NEXT, NULL), -EINVAL,
+		      "Posted an event without a queue");
+	smf_set_event_queue(SMF_CTX(&test_obj), &test_queue);
+
+	/* Events without a handler are dropped */
+	zassert_equal(smf_dispatch_event(SMF_CTX(&test_obj), &event), 0);
+	zassert_equal_ptr(test_obj.ctx.current, &test_states[STATE_A]);
+
+	/* The ancestor handles events its children do not */
+	event.id = EV_RESET;
+	zassert_equal(smf_dispatch_event(SMF_CTX(&test_obj), &event), 0);
+	zassert_equal(test_obj.resets, 1);
+	zassert_equal(test_obj.a_entries, 2, "A was not re-entered");
+
+	zassert_ok(smf_post_event(SMF_CTX(&test_obj), EV_NEXT, NULL));
+	zassert_ok(smf_post_event(SMF_CTX(&test_obj), EV_NEXT, NULL));
+	zassert_equal(smf_run_events(SMF_CTX(&test_obj), K_NO_WAIT), 0);
+
+	/* The event posted by B was handled, and dropped, in C */
+	zassert_equal_ptr(test_obj.ctx.current, &test_states[STATE_C]);
+	zassert_equal(test_obj.b_entries, 1);
+	zassert_equal(test_obj.c_entries, 1);
+	zassert_equal(k_msgq_num_used_get(&test_queue), 0);
+
+	/* Nothing to process */
+	zassert_equal(smf_run_events(SMF_CTX(&test_obj), K_MSEC(1)), 0);
+
+	for (int i = 0; i < 4; i++) {
+		zassert_ok(smf_post_event(SMF_CTX(&test_obj), EV_STOP, UINT_TO_POINTER(i)));
+	}
+	zassert_equal(smf_post_event(SMF_CTX(&test_obj), EV_STOP, NULL), -ENOMSG,
+		      "Posted an event to a full queue");
+
+	/* Processing stops at the first event terminating the state machine */
+	zassert_equal(smf_run_events(SMF_CTX(&test_obj), K_NO_WAIT), TEST_TERMINATE_VAL);
+	zassert_equal(test_obj.last_data, 0);
+	zassert_equal(k_msgq_num_used_get(&test_queue), 3);
+
+	k_msgq_purge(&test_queue);
+}
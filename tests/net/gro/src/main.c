@@ -0,0 +1,437 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_gro_test, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/types.h>
+#include <stddef.h>
+#include <string.h>
+#include <errno.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/ztest.h>
+#include <zephyr/net/dummy.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+#include <net_private.h>
+#include <connection.h>
+#include <ipv4.h>
+#include <tcp_internal.h>
+#include <tcp_private.h>
+
+#define ALLOC_TIMEOUT K_MSEC(500)
+
+#define HDRS_LEN (sizeof(struct net_ipv4_hdr) + sizeof(struct net_tcp_hdr))
+#define SEG_LEN 100
+#define GSO_MSS 536
+
+#define PEER_PORT 4242
+#define LOCAL_PORT 8080
+
+/* Dummy network addresses, 192.0.2.1 is ours */
+static struct in_addr my_addr = { { { 192, 0, 2, 1 } } };
+static struct in_addr peer_addr = { { { 192, 0, 2, 2 } } };
+
+/* Packets that went through the IP and TCP input */
+struct rx_seg {
+	uint32_t seq;
+	uint16_t len;
+	uint16_t src_port;
+	uint8_t flags;
+	bool gro;
+};
+
+static struct rx_seg received[4];
+static int received_count;
+
+static struct net_gro gro;
+static struct net_if *iface;
+
+static uint8_t net_iface_dummy_data;
+
+static void net_iface_init(struct net_if *iface)
+{
+	static uint8_t mac[6] = { 0x00, 0x00, 0x5e, 0x00, 0x53, 0x01 };
+
+	net_if_set_link_addr(iface, mac, sizeof(mac), NET_LINK_DUMMY);
+}
+
+static int sender_iface(const struct device *dev, struct net_pkt *pkt)
+{
+	/* Nothing is sent back, the TCP handler is not a real connection */
+	return 0;
+}
+
+static struct dummy_api net_iface_api = {
+	.iface_api.init = net_iface_init,
+	.send = sender_iface,
+};
+
+NET_DEVICE_INIT(net_gro_test, "net_gro_test", NULL, NULL, &net_iface_dummy_data,
+		NULL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &net_iface_api, DUMMY_L2,
+		NET_L2_GET_CTX_TYPE(DUMMY_L2), NET_IPV4_MTU);
+
+/* The payload byte at sequence number seq is the low byte of seq, so the data
+ * of merged or split segments can be checked without knowing the boundaries.
+ */
+static bool check_payload(struct net_pkt *pkt, uint32_t seq)
+{
+	size_t len = net_pkt_get_len(pkt) - HDRS_LEN;
+	uint8_t byte;
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_skip(pkt, HDRS_LEN)) {
+		return false;
+	}
+
+	for (size_t i = 0; i < len; i++) {
+		if (net_pkt_read_u8(pkt, &byte) || byte != (uint8_t)(seq + i)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static struct net_tcp_hdr *seg_tcp_hdr(struct net_pkt *pkt)
+{
+	return (struct net_tcp_hdr *)(pkt->frags->data + sizeof(struct net_ipv4_hdr));
+}
+
+static enum net_verdict tcp_received(struct net_conn *conn, struct net_pkt *pkt,
+				     union net_ip_header *ip_hdr,
+				     union net_proto_header *proto_hdr, void *user_data)
+{
+	struct net_tcp_hdr *tcp_hdr = seg_tcp_hdr(pkt);
+	struct rx_seg *seg;
+
+	zassert_true(received_count < ARRAY_SIZE(received), "Too many packets");
+
+	seg = &received[received_count++];
+	seg->seq = sys_get_be32(tcp_hdr->seq);
+	seg->len = net_pkt_get_len(pkt);
+	seg->src_port = ntohs(tcp_hdr->src_port);
+	seg->flags = tcp_hdr->flags;
+	seg->gro = net_pkt_is_gro(pkt);
+
+	zassert_equal(ntohs(NET_IPV4_HDR(pkt)->len), seg->len, "IPv4 length mismatch");
+	zassert_equal(net_calc_chksum_ipv4(pkt), 0, "IPv4 header checksum mismatch");
+	zassert_true(check_payload(pkt, seg->seq), "Payload mismatch");
+
+	net_pkt_unref(pkt);
+
+	return NET_OK;
+}
+
+/* Build an IPv4 TCP segment from the peer, with valid checksums */
+static struct net_pkt *tcp_seg(bool rx, uint16_t src_port, uint32_t seq, uint8_t flags,
+			       size_t len)
+{
+	struct net_ipv4_hdr ip_hdr = {
+		.vhl = 0x45,
+		.len = htons(HDRS_LEN + len),
+		.offset = { 0x40, 0x00 }, /* Don't fragment */
+		.ttl = 64,
+		.proto = IPPROTO_TCP,
+	};
+	struct net_tcp_hdr tcp_hdr = {
+		.src_port = htons(src_port),
+		.dst_port = htons(LOCAL_PORT),
+		.offset = 0x50,
+		.flags = flags,
+	};
+	struct net_pkt *pkt;
+
+	if (rx) {
+		pkt = net_pkt_rx_alloc_with_buffer(iface, HDRS_LEN + len, AF_INET, IPPROTO_TCP,
+						   ALLOC_TIMEOUT);
+	} else {
+		pkt = net_pkt_alloc_with_buffer(iface, HDRS_LEN + len, AF_INET, IPPROTO_TCP,
+						ALLOC_TIMEOUT);
+	}
+
+	zassert_not_null(pkt, "Cannot allocate packet");
+
+	memcpy(ip_hdr.src, &peer_addr, sizeof(ip_hdr.src));
+	memcpy(ip_hdr.dst, &my_addr, sizeof(ip_hdr.dst));
+	sys_put_be32(seq, tcp_hdr.seq);
+	sys_put_be32(1U, tcp_hdr.ack);
+	sys_put_be16(8192U, tcp_hdr.wnd);
+
+	zassert_ok(net_pkt_write(pkt, &ip_hdr, sizeof(ip_hdr)), "Cannot write IPv4 header");
+	zassert_ok(net_pkt_write(pkt, &tcp_hdr, sizeof(tcp_hdr)), "Cannot write TCP header");
+
+	for (size_t i = 0; i < len; i++) {
+		zassert_ok(net_pkt_write_u8(pkt, (uint8_t)(seq + i)), "Cannot write data");
+	}
+
+	net_pkt_set_ip_hdr_len(pkt, sizeof(struct net_ipv4_hdr));
+	net_pkt_cursor_init(pkt);
+	zassert_ok(net_ipv4_finalize(pkt, IPPROTO_TCP), "Cannot finalize packet");
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	return pkt;
+}
+
+static struct net_pkt *rx_seg(uint32_t seq, uint8_t flags)
+{
+	return tcp_seg(true, PEER_PORT, seq, flags, SEG_LEN);
+}
+
+static void gro_receive_ok(struct net_pkt *pkt)
+{
+	zassert_equal(net_gro_receive(&gro, pkt), NET_OK, "Segment not taken by GRO");
+}
+
+static void gro_receive_continue(struct net_pkt *pkt)
+{
+	zassert_equal(net_gro_receive(&gro, pkt), NET_CONTINUE, "Segment taken by GRO");
+
+	/* The caller would carry on with IP input, the tests don't need it */
+	net_pkt_unref(pkt);
+}
+
+static void check_received(int idx, uint32_t seq, size_t data_len, bool is_gro)
+{
+	zassert_true(idx < received_count, "Packet %d not received", idx);
+	zassert_equal(received[idx].seq, seq, "Packet %d sequence mismatch", idx);
+	zassert_equal(received[idx].len, HDRS_LEN + data_len, "Packet %d length mismatch", idx);
+	zassert_equal(received[idx].gro, is_gro, "Packet %d GRO flag mismatch", idx);
+}
+
+ZTEST(net_gro, test_coalesce_in_order)
+{
+	gro_receive_ok(rx_seg(1000, ACK));
+	gro_receive_ok(rx_seg(1000 + SEG_LEN, ACK));
+	gro_receive_ok(rx_seg(1000 + 2 * SEG_LEN, ACK));
+
+	zassert_equal(received_count, 0, "Segments passed up before the flush");
+
+	net_gro_flush(&gro);
+
+	zassert_equal(received_count, 1, "Segments not coalesced");
+	zassert_is_null(gro.pkt, "GRO still holding a packet");
+	check_received(0, 1000, 3 * SEG_LEN, true);
+	zassert_equal(received[0].flags, ACK, "Flags changed");
+}
+
+ZTEST(net_gro, test_flush_on_psh)
+{
+	gro_receive_ok(rx_seg(1000, ACK));
+	gro_receive_ok(rx_seg(1000 + SEG_LEN, ACK | PSH));
+
+	zassert_equal(received_count, 1, "PSH did not flush");
+	zassert_is_null(gro.pkt, "GRO still holding a packet");
+	check_received(0, 1000, 2 * SEG_LEN, true);
+	zassert_equal(received[0].flags, ACK | PSH, "PSH not carried over");
+
+	/* Nothing to coalesce with, a PSH segment is not held back */
+	gro_receive_continue(rx_seg(1000 + 2 * SEG_LEN, ACK | PSH));
+	zassert_is_null(gro.pkt, "PSH segment held");
+}
+
+ZTEST(net_gro, test_flush_on_fin)
+{
+	gro_receive_ok(rx_seg(1000, ACK));
+	gro_receive_continue(rx_seg(1000 + SEG_LEN, ACK | FIN));
+
+	zassert_equal(received_count, 1, "FIN did not flush");
+	zassert_is_null(gro.pkt, "GRO still holding a packet");
+	check_received(0, 1000, SEG_LEN, false);
+}
+
+ZTEST(net_gro, test_flush_on_flow_mismatch)
+{
+	gro_receive_ok(rx_seg(1000, ACK));
+	gro_receive_ok(tcp_seg(true, PEER_PORT + 1, 1000 + SEG_LEN, ACK, SEG_LEN));
+
+	zassert_equal(received_count, 1, "Other flow did not flush");
+	check_received(0, 1000, SEG_LEN, false);
+	zassert_equal(received[0].src_port, PEER_PORT, "Wrong flow flushed");
+
+	net_gro_flush(&gro);
+
+	zassert_equal(received_count, 2, "Second flow not flushed");
+	check_received(1, 1000 + SEG_LEN, SEG_LEN, false);
+	zassert_equal(received[1].src_port, PEER_PORT + 1, "Wrong flow flushed");
+}
+
+ZTEST(net_gro, test_flush_on_out_of_order)
+{
+	/* A hole, then a segment from before the held one */
+	gro_receive_ok(rx_seg(1000, ACK));
+	gro_receive_ok(rx_seg(1000 + 2 * SEG_LEN, ACK));
+	gro_receive_ok(rx_seg(1000 + SEG_LEN, ACK));
+
+	zassert_equal(received_count, 2, "Out of order segments coalesced");
+	check_received(0, 1000, SEG_LEN, false);
+	check_received(1, 1000 + 2 * SEG_LEN, SEG_LEN, false);
+
+	net_gro_flush(&gro);
+
+	zassert_equal(received_count, 3, "Last segment not flushed");
+	check_received(2, 1000 + SEG_LEN, SEG_LEN, false);
+}
+
+ZTEST(net_gro, test_bad_chksum)
+{
+	struct net_pkt *pkt;
+
+	/* A corrupted segment following a good one is not merged, and TCP
+	 * drops it once it is flushed.
+	 */
+	gro_receive_ok(rx_seg(1000, ACK));
+
+	pkt = rx_seg(1000 + SEG_LEN, ACK);
+	seg_tcp_hdr(pkt)->chksum ^= 0x5555;
+	gro_receive_ok(pkt);
+
+	zassert_equal(received_count, 1, "Good segment not flushed");
+	check_received(0, 1000, SEG_LEN, false);
+
+	net_gro_flush(&gro);
+	zassert_equal(received_count, 1, "Corrupted segment passed up");
+
+	/* Nor is a good segment merged into a corrupted one */
+	pkt = rx_seg(2000, ACK);
+	seg_tcp_hdr(pkt)->chksum ^= 0x5555;
+	gro_receive_ok(pkt);
+	gro_receive_ok(rx_seg(2000 + SEG_LEN, ACK));
+
+	zassert_equal(received_count, 1, "Corrupted segment passed up");
+
+	net_gro_flush(&gro);
+
+	zassert_equal(received_count, 2, "Good segment not flushed");
+	check_received(1, 2000 + SEG_LEN, SEG_LEN, false);
+}
+
+static void check_gso(size_t data_len, uint8_t flags, int expected_segs)
+{
+	struct net_pkt *pkt = tcp_seg(false, PEER_PORT, 5000, flags, data_len);
+	struct net_pkt *seg;
+	size_t offset = 0;
+	sys_slist_t segs;
+	int count = 0;
+
+	net_pkt_set_gso_size(pkt, GSO_MSS);
+
+	zassert_equal(net_tcp_gso_segment(pkt, &segs), expected_segs,
+		      "Wrong number of segments");
+
+	while ((seg = net_pkt_list_get(&segs)) != NULL) {
+		struct net_tcp_hdr *tcp_hdr = seg_tcp_hdr(seg);
+		size_t len = MIN(GSO_MSS, data_len - offset);
+		bool last = offset + len == data_len;
+
+		zassert_equal(net_pkt_get_len(seg), HDRS_LEN + len,
+			      "Segment %d length mismatch", count);
+		zassert_equal(ntohs(NET_IPV4_HDR(seg)->len), HDRS_LEN + len,
+			      "Segment %d IPv4 length mismatch", count);
+		zassert_equal(net_pkt_gso_size(seg), 0, "Segment %d is a GSO packet", count);
+		zassert_equal(sys_get_be32(tcp_hdr->seq), 5000 + offset,
+			      "Segment %d sequence mismatch", count);
+		zassert_equal(tcp_hdr->flags, last ? flags : (flags & ~(PSH | FIN)),
+			      "Segment %d flags mismatch", count);
+		zassert_equal(net_calc_chksum_ipv4(seg), 0,
+			      "Segment %d IPv4 header checksum mismatch", count);
+		zassert_equal(net_calc_chksum_tcp(seg), 0,
+			      "Segment %d TCP checksum mismatch", count);
+		zassert_true(check_payload(seg, 5000 + offset), "Segment %d payload mismatch",
+			     count);
+
+		net_pkt_unref(seg);
+		offset += len;
+		count++;
+	}
+
+	zassert_equal(count, expected_segs, "Segments missing from the list");
+	zassert_equal(offset, data_len, "Data missing from the segments");
+
+	/* The super packet is left as it was */
+	zassert_equal(net_pkt_get_len(pkt), HDRS_LEN + data_len, "GSO packet modified");
+	zassert_equal(net_calc_chksum_tcp(pkt), 0, "GSO packet modified");
+	zassert_true(check_payload(pkt, 5000), "GSO packet modified");
+
+	net_pkt_unref(pkt);
+}
+
+ZTEST(net_gro, test_gso_segment)
+{
+	/* Last segment shorter, PSH and FIN on it only */
+	check_gso(3 * GSO_MSS + 100, ACK | PSH | FIN, 4);
+
+	/* Exact multiple of the MSS, no empty trailing segment */
+	check_gso(2 * GSO_MSS, ACK | PSH, 2);
+
+	/* Less than the MSS */
+	check_gso(GSO_MSS - 1, ACK | PSH, 1);
+}
+
+ZTEST(net_gro, test_gso_segment_invalid)
+{
+	struct net_pkt *pkt;
+	sys_slist_t segs;
+
+	/* No GSO size */
+	pkt = tcp_seg(false, PEER_PORT, 5000, ACK, GSO_MSS);
+	zassert_equal(net_tcp_gso_segment(pkt, &segs), -EINVAL, "Packet without MSS split");
+	net_pkt_unref(pkt);
+
+	/* No payload */
+	pkt = tcp_seg(false, PEER_PORT, 5000, ACK, 0);
+	net_pkt_set_gso_size(pkt, GSO_MSS);
+	zassert_equal(net_tcp_gso_segment(pkt, &segs), -EINVAL, "Empty packet split");
+	net_pkt_unref(pkt);
+}
+
+static void *test_setup(void)
+{
+	static struct net_conn_handle *handle;
+	struct sockaddr local_addr = { 0 };
+	struct net_if_addr *ifaddr;
+	int ret;
+
+	iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	zassert_not_null(iface, "No dummy interface");
+
+	ifaddr = net_if_ipv4_addr_add(iface, &my_addr, NET_ADDR_MANUAL, 0);
+	zassert_not_null(ifaddr, "Cannot add IPv4 address");
+
+	net_if_up(iface);
+
+	net_ipaddr_copy(&net_sin(&local_addr)->sin_addr, &my_addr);
+	local_addr.sa_family = AF_INET;
+
+	/* Any peer port, so that the segments of every flow are seen */
+	ret = net_conn_register(IPPROTO_TCP, AF_INET, NULL, &local_addr, 0, LOCAL_PORT, NULL,
+				tcp_received, NULL, &handle);
+	zassert_equal(ret, 0, "Cannot register TCP connection");
+
+	return NULL;
+}
+
+static void test_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	received_count = 0;
+	memset(received, 0, sizeof(received));
+}
+
+static void test_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	net_gro_flush(&gro);
+}
+
+ZTEST_SUITE(net_gro, NULL, test_setup, test_before, test_after, NULL);
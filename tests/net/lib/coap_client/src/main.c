@@ -687,3 +687,126 @@ ZTEST(coap_client, test_unmatching_tokens)
 	k_sleep(K_MSEC(500));
 	zassert_equal(last_response_code, -ETIMEDOUT, "Unexpected response");
 }
+
+#if CONFIG_COAP_CLIENT_BLOCK2_WINDOW > 1
+#define BLOCK2_TEST_LEN 64
+
+static struct {
+	uint16_t id;
+	uint8_t token[COAP_TOKEN_MAX_LEN];
+	uint8_t tkl;
+	uint32_t block_num;
+} block2_requests[CONFIG_COAP_CLIENT_BLOCK2_WINDOW + 1];
+static int block2_requests_len;
+static int block2_max_in_flight;
+static uint8_t block2_received[512];
+static size_t block2_received_len;
+static bool block2_last;
+
+static ssize_t z_impl_zsock_sendto_custom_fake_block2(int sock, void *buf, size_t len,
+						      int flags, const struct sockaddr *dest_addr,
+						      socklen_t addrlen)
+{
+	struct coap_packet request;
+	int block2;
+
+	zassert_ok(coap_packet_parse(&request, buf, len, NULL, 0));
+	zassert_true(block2_requests_len < ARRAY_SIZE(block2_requests), "Too many requests");
+
+	block2 = coap_get_option_int(&request, COAP_OPTION_BLOCK2);
+
+	block2_requests[block2_requests_len].id = coap_header_get_id(&request);
+	block2_requests[block2_requests_len].tkl =
+		coap_header_get_token(&request, block2_requests[block2_requests_len].token);
+	block2_requests[block2_requests_len].block_num = block2 < 0 ? 0 : GET_BLOCK_NUM(block2);
+	block2_requests_len++;
+
+	block2_max_in_flight = MAX(block2_max_in_flight, block2_requests_len);
+
+	return 1;
+}
+
+/* Answer the most recent request first, so the blocks come out of order */
+static ssize_t z_impl_zsock_recvfrom_custom_fake_block2(int sock, void *buf, size_t max_len,
+							int flags, struct sockaddr *src_addr,
+							socklen_t *addrlen)
+{
+	size_t total = strlen(long_payload);
+	struct coap_packet response;
+	uint32_t block_num;
+	size_t offset;
+	bool more;
+
+	if (block2_requests_len == 0) {
+		errno = EAGAIN;
+		return -1;
+	}
+
+	block2_requests_len--;
+	block_num = block2_requests[block2_requests_len].block_num;
+	offset = block_num * BLOCK2_TEST_LEN;
+	more = offset + BLOCK2_TEST_LEN < total;
+
+	zassert_ok(coap_packet_init(&response, buf, max_len, COAP_VERSION_1, COAP_TYPE_ACK,
+				    block2_requests[block2_requests_len].tkl,
+				    block2_requests[block2_requests_len].token,
+				    COAP_RESPONSE_CODE_CONTENT,
+				    block2_requests[block2_requests_len].id));
+	zassert_ok(coap_append_option_int(&response, COAP_OPTION_BLOCK2,
+					  (block_num << 4) | (more ? 0x08 : 0) | COAP_BLOCK_64));
+	zassert_ok(coap_packet_append_payload_marker(&response));
+	zassert_ok(coap_packet_append_payload(&response, long_payload + offset,
+					      MIN(BLOCK2_TEST_LEN, total - offset)));
+
+	return response.offset;
+}
+
+static void coap_callback_block2(int16_t code, size_t offset, const uint8_t *payload, size_t len,
+				 bool last_block, void *user_data)
+{
+	zassert_equal(code, COAP_RESPONSE_CODE_CONTENT, "Unexpected response");
+	zassert_equal(offset, block2_received_len, "Blocks out of order");
+	zassert_true(offset + len <= sizeof(block2_received), "Too much data");
+
+	memcpy(&block2_received[offset], payload, len);
+	block2_received_len += len;
+	block2_last = last_block;
+}
+
+ZTEST(coap_client, test_block2_window)
+{
+	int ret = 0;
+	struct sockaddr address = {0};
+	struct coap_client_request client_request = {
+		.method = COAP_METHOD_GET,
+		.confirmable = true,
+		.path = test_path,
+		.fmt = COAP_CONTENT_FORMAT_TEXT_PLAIN,
+		.cb = coap_callback_block2,
+		.payload = NULL,
+		.len = 0
+	};
+
+	block2_requests_len = 0;
+	block2_max_in_flight = 0;
+	block2_received_len = 0;
+	block2_last = false;
+
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_custom_fake_block2;
+	z_impl_zsock_recvfrom_fake.custom_fake = z_impl_zsock_recvfrom_custom_fake_block2;
+
+	k_sleep(K_MSEC(1));
+
+	LOG_INF("Send request");
+	ret = coap_client_req(&client, 0, &address, &client_request, NULL);
+	zassert_true(ret >= 0, "Sending request failed, %d", ret);
+	set_socket_events(ZSOCK_POLLIN);
+
+	k_sleep(K_MSEC(500));
+	zassert_true(block2_last, "Transfer not completed");
+	zassert_equal(block2_max_in_flight, CONFIG_COAP_CLIENT_BLOCK2_WINDOW,
+		      "Blocks not requested ahead");
+	zassert_equal(block2_received_len, strlen(long_payload), "Wrong length");
+	zassert_mem_equal(block2_received, long_payload, block2_received_len, "Wrong payload");
+}
+#endif /* CONFIG_COAP_CLIENT_BLOCK2_WINDOW > 1 */
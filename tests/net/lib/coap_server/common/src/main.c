@@ -318,4 +318,35 @@ ZTEST(coap_service, test_COAP_RESOURCE_DEFINE)
 	}
 }
 
+ZTEST(coap_service, test_coap_resource_observers)
+{
+	static const uint8_t token[] = { 0x01, 0x02, 0x03, 0x04 };
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(5683),
+		.sin_addr = { { { 192, 0, 2, 1 } } },
+	};
+	struct coap_packet request;
+	uint8_t buf[32];
+
+	zassert_ok(coap_packet_init(&request, buf, sizeof(buf), COAP_VERSION_1, COAP_TYPE_CON,
+				    sizeof(token), token, COAP_METHOD_GET, coap_next_id()));
+	zassert_ok(coap_append_option_int(&request, COAP_OPTION_OBSERVE, 0));
+
+	zassert_ok(coap_resource_parse_observe(&resource_0, &request, (struct sockaddr *)&addr));
+	zassert_equal(sys_slist_len(&resource_0.observers), 1);
+
+	/* A refresh doesn't add an observer */
+	zassert_ok(coap_resource_parse_observe(&resource_0, &request, (struct sockaddr *)&addr));
+	zassert_equal(sys_slist_len(&resource_0.observers), 1);
+
+	zassert_equal(coap_resource_remove_observer_by_token(&resource_1, token, sizeof(token)),
+		      -ENOENT);
+	zassert_ok(coap_resource_remove_observer_by_token(&resource_0, token, sizeof(token)));
+	zassert_true(sys_slist_is_empty(&resource_0.observers));
+
+	zassert_equal(coap_resource_remove_observer_by_token(&resource_0, token, sizeof(token)),
+		      -ENOENT);
+}
+
 ZTEST_SUITE(coap_service, NULL, NULL, NULL, NULL, NULL);
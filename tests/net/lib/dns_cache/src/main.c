@@ -133,3 +133,52 @@ ZTEST(net_dns_cache_test, test_expired_entries_removed)
 	zassert_equal(1, dns_cache_find(&test_dns_cache, query, info_read, 3));
 	zassert_equal(AF_INET, info_read[0].ai_family);
 }
+
+ZTEST(net_dns_cache_test, test_negative_entry)
+{
+	struct dns_addrinfo info_write = {.ai_family = AF_INET};
+	struct dns_addrinfo info_read = {0};
+	const char *query = "nx.example.com";
+
+	zassert_ok(dns_cache_add(&test_dns_cache, query, &info_write, TEST_DNS_CACHE_DEFAULT_TTL * 2),
+		   "Cache entry adding should work.");
+	zassert_ok(dns_cache_add_negative(&test_dns_cache, query, TEST_DNS_CACHE_DEFAULT_TTL),
+		   "Negative cache entry adding should work.");
+	zassert_equal(-ENOENT, dns_cache_find(&test_dns_cache, query, &info_read, 1));
+	zassert_equal(0, info_read.ai_family);
+	zassert_equal(0, dns_cache_find(&test_dns_cache, "example.com", &info_read, 1));
+
+	/* The cached addresses were dropped, and the negative entry expires */
+	k_sleep(K_MSEC(TEST_DNS_CACHE_DEFAULT_TTL * 1000 + 1));
+	zassert_equal(0, dns_cache_find(&test_dns_cache, query, &info_read, 1));
+
+	/* A positive answer replaces the negative one */
+	zassert_ok(dns_cache_add_negative(&test_dns_cache, query, TEST_DNS_CACHE_DEFAULT_TTL));
+	zassert_ok(dns_cache_add(&test_dns_cache, query, &info_write, TEST_DNS_CACHE_DEFAULT_TTL));
+	zassert_equal(1, dns_cache_find(&test_dns_cache, query, &info_read, 1));
+	zassert_equal(AF_INET, info_read.ai_family);
+}
+
+ZTEST(net_dns_cache_test, test_remove_keeps_other_queries)
+{
+	struct dns_addrinfo info_write = {.ai_family = AF_INET};
+	struct dns_addrinfo info_read[TEST_DNS_CACHE_SIZE] = {0};
+	char query[sizeof("host00.example.com")];
+
+	for (size_t i = 0; i < TEST_DNS_CACHE_SIZE; i++) {
+		snprintk(query, sizeof(query), "host%02u.example.com", (unsigned int)i);
+		zassert_ok(dns_cache_add(&test_dns_cache, query, &info_write,
+					 TEST_DNS_CACHE_DEFAULT_TTL),
+			   "Cache entry adding should work.");
+	}
+
+	zassert_ok(dns_cache_remove(&test_dns_cache, "host03.example.com"));
+
+	for (size_t i = 0; i < TEST_DNS_CACHE_SIZE; i++) {
+		snprintk(query, sizeof(query), "host%02u.example.com", (unsigned int)i);
+		zassert_equal(i == 3 ? 0 : 1,
+			      dns_cache_find(&test_dns_cache, query, info_read,
+					     TEST_DNS_CACHE_SIZE),
+			      "Unexpected result for %s", query);
+	}
+}
@@ -329,4 +329,47 @@ ZTEST(http_service, test_HTTP_RESOURCE_WILDCARD)
 	zassert_equal(res, RES(3), "Resource mismatch");
 }
 
+ZTEST(http_service, test_HTTP_RESOURCE_QUERY)
+{
+	struct http_resource_detail *res;
+	int len;
+
+	res = CHECK_PATH("/index.html?lang=en", &len);
+	zassert_equal(res, RES(1), "Resource mismatch");
+	zassert_equal(len, strlen("/index.html"), "Length mismatch");
+
+	res = CHECK_PATH("/bar/baz.php?id=1/2", &len);
+	zassert_equal(res, RES(3), "Resource mismatch");
+
+	res = CHECK_PATH("/bar", &len);
+	zassert_is_null(res, "Resource found");
+
+	res = CHECK_PATH("/bar/baz.php/", &len);
+	zassert_is_null(res, "Resource found");
+
+	/* Websocket resources are only found by websocket lookups */
+	res = CHECK_PATH("/foo.htm", &len);
+	zassert_equal(res, RES(1), "Resource mismatch");
+
+	res = get_resource_detail("/foo.htm", &len, true);
+	zassert_equal(res, RES(2), "Resource mismatch");
+}
+
+extern bool http_server_accepts_gzip(const char *value, size_t len);
+
+#define ACCEPTS_GZIP(value) http_server_accepts_gzip(value, strlen(value))
+
+ZTEST(http_service, test_accept_encoding_gzip)
+{
+	zassert_true(ACCEPTS_GZIP("gzip"));
+	zassert_true(ACCEPTS_GZIP("deflate, GZIP;q=0.8"));
+	zassert_true(ACCEPTS_GZIP("br, *"));
+	zassert_false(ACCEPTS_GZIP(""));
+	zassert_false(ACCEPTS_GZIP("br, deflate"));
+	zassert_false(ACCEPTS_GZIP("x-gzip"));
+	zassert_false(ACCEPTS_GZIP("gzip;q=0"));
+	zassert_false(ACCEPTS_GZIP("gzip; q=0.000, *"));
+	zassert_false(ACCEPTS_GZIP("*;q=0"));
+}
+
 ZTEST_SUITE(http_service, NULL, NULL, NULL, NULL, NULL);
@@ -494,4 +494,87 @@ ZTEST(http2_hpack, test_http2_hpack_literal_not_indexed_decode)
 				 ARRAY_SIZE(test_enc_literal_not_indexed_headers));
 }
 
+#if defined(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE)
+static void test_hpack_verify_encode_indexed(struct http_hpack_encoder_table *table,
+					     const struct example_headers *example,
+					     size_t num_examples)
+{
+	for (int i = 0; i < num_examples; i++) {
+		struct http_hpack_header_buf hdr = {
+			.name = example[i].name,
+			.value = example[i].value,
+			.name_len = strlen(example[i].name),
+			.value_len = strlen(example[i].value)
+		};
+		int ret;
+
+		ret = http_hpack_encode_header_indexed(test_buf, sizeof(test_buf), &hdr,
+						       table);
+		zassert_equal(ret, example[i].encoded_len, "Wrong encoding length");
+		zassert_mem_equal(test_buf, example[i].encoded, ret,
+				  "Header wrongly encoded");
+	}
+}
+
+/* The first field carries the size update of the 256 bytes table. */
+static const struct example_headers test_enc_dynamic_headers[] = {
+	{ ":status", "200", { 0x3f, 0xe1, 0x01, 0x88 }, 4 },
+	{ "content-type", "text/html",
+	  { 0x5f, 0x87, 0x49, 0x7c, 0xa5, 0x89, 0xd3, 0x4d, 0x1f },
+	  9 },
+	{ "content-type", "text/html", { 0xbe }, 1 },
+	{ ":status", "200", { 0x88 }, 1 },
+};
+
+/* With a zero table size, fields are no longer indexed. */
+static const struct example_headers test_enc_dynamic_disabled_headers[] = {
+	{ "content-type", "text/html",
+	  { 0x20, 0x1f, 0x10, 0x87, 0x49, 0x7c, 0xa5, 0x89, 0xd3,
+	    0x4d, 0x1f },
+	  11 },
+	{ "content-type", "text/html",
+	  { 0x1f, 0x10, 0x87, 0x49, 0x7c, 0xa5, 0x89, 0xd3, 0x4d,
+	    0x1f },
+	  10 },
+};
+
+/* A 60 bytes table only holds one of the fields. */
+static const struct example_headers test_enc_dynamic_evict_headers[] = {
+	{ "content-type", "text/html",
+	  { 0x3f, 0x1d, 0x5f, 0x87, 0x49, 0x7c, 0xa5, 0x89, 0xd3,
+	    0x4d, 0x1f },
+	  11 },
+	{ "content-encoding", "gzip", { 0x5a, 0x83, 0x9b, 0xd9, 0xab }, 5 },
+	{ "content-encoding", "gzip", { 0xbe }, 1 },
+	{ "content-type", "text/html",
+	  { 0x5f, 0x87, 0x49, 0x7c, 0xa5, 0x89, 0xd3, 0x4d, 0x1f },
+	  9 },
+};
+
+ZTEST(http2_hpack, test_http2_hpack_dynamic_table_encode)
+{
+	struct http_hpack_encoder_table table;
+
+	zassume_equal(HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE, 256);
+
+	http_hpack_encoder_table_init(&table);
+	test_hpack_verify_encode_indexed(&table, test_enc_dynamic_headers,
+					 ARRAY_SIZE(test_enc_dynamic_headers));
+
+	http_hpack_encoder_table_set_max_size(&table, 0);
+	test_hpack_verify_encode_indexed(&table, test_enc_dynamic_disabled_headers,
+					 ARRAY_SIZE(test_enc_dynamic_disabled_headers));
+}
+
+ZTEST(http2_hpack, test_http2_hpack_dynamic_table_evict)
+{
+	struct http_hpack_encoder_table table;
+
+	http_hpack_encoder_table_init(&table);
+	http_hpack_encoder_table_set_max_size(&table, 60);
+	test_hpack_verify_encode_indexed(&table, test_enc_dynamic_evict_headers,
+					 ARRAY_SIZE(test_enc_dynamic_evict_headers));
+}
+#endif /* CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE */
+
 ZTEST_SUITE(http2_hpack, NULL, NULL, NULL, NULL, NULL);
@@ -125,6 +125,48 @@ ZTEST(lwm2m_registry, test_unknown_res)
 	zassert_equal(ret, 0);
 }
 
+ZTEST(lwm2m_registry, test_obj_inst_lookup)
+{
+	const uint16_t ids[] = {0, 16, 17, 1000};
+	struct lwm2m_engine_obj_inst *obj_inst;
+	struct lwm2m_engine_res *res;
+	int ret;
+
+	for (int i = 0; i < ARRAY_SIZE(ids); i++) {
+		ret = lwm2m_create_object_inst(&LWM2M_OBJ(3303, ids[i]));
+		zassert_equal(ret, 0);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(ids); i++) {
+		obj_inst = lwm2m_engine_get_obj_inst(&LWM2M_OBJ(3303, ids[i]));
+		zassert_not_null(obj_inst);
+		zassert_equal(obj_inst->obj_inst_id, ids[i]);
+		zassert_equal(obj_inst->obj->obj_id, 3303);
+
+		res = lwm2m_engine_get_res(&LWM2M_OBJ(3303, ids[i], 5700));
+		zassert_not_null(res);
+		zassert_equal(res->res_id, 5700);
+		zassert_true(res >= obj_inst->resources &&
+			     res < obj_inst->resources + obj_inst->resource_count);
+	}
+
+	zassert_is_null(lwm2m_engine_get_obj_inst(&LWM2M_OBJ(3303, 1)));
+	zassert_is_null(lwm2m_engine_get_obj_inst(&LWM2M_OBJ(3304, 0)));
+	zassert_is_null(lwm2m_engine_get_res(&LWM2M_OBJ(3303, 0, 5699)));
+
+	ret = lwm2m_delete_object_inst(&LWM2M_OBJ(3303, 16));
+	zassert_equal(ret, 0);
+	zassert_is_null(lwm2m_engine_get_obj_inst(&LWM2M_OBJ(3303, 16)));
+	zassert_not_null(lwm2m_engine_get_obj_inst(&LWM2M_OBJ(3303, 17)));
+
+	for (int i = 0; i < ARRAY_SIZE(ids); i++) {
+		if (ids[i] != 16) {
+			ret = lwm2m_delete_object_inst(&LWM2M_OBJ(3303, ids[i]));
+			zassert_equal(ret, 0);
+		}
+	}
+}
+
 ZTEST(lwm2m_registry, test_get_res_inst)
 {
 	zassert_is_null(lwm2m_engine_get_res_inst(&LWM2M_OBJ(3)));
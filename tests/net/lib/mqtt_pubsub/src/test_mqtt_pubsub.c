@@ -21,6 +21,9 @@ LOG_MODULE_REGISTER(net_test, LOG_LEVEL_WRN);
 
 static uint8_t rx_buffer[BUFFER_SIZE];
 static uint8_t tx_buffer[BUFFER_SIZE];
+#if defined(CONFIG_MQTT_PUBLISH_BATCH)
+static uint8_t batch_buffer[256];
+#endif
 static struct mqtt_client client_ctx;
 static struct sockaddr broker;
 static struct zsock_pollfd fds[1];
@@ -268,6 +271,10 @@ static void client_init(struct mqtt_client *client)
 	client->rx_buf_size = sizeof(rx_buffer);
 	client->tx_buf = tx_buffer;
 	client->tx_buf_size = sizeof(tx_buffer);
+#if defined(CONFIG_MQTT_PUBLISH_BATCH)
+	client->tx_batch_buf = batch_buffer;
+	client->tx_batch_buf_size = sizeof(batch_buffer);
+#endif
 }
 
 /* In this routine we block until the connected variable is 1 */
@@ -363,6 +370,14 @@ static int test_publish(enum mqtt_qos qos)
 		return TC_FAIL;
 	}
 
+	if (IS_ENABLED(CONFIG_MQTT_PUBLISH_BATCH)) {
+		/* A QoS 0 message may still be queued in the batch buffer. */
+		rc = mqtt_publish_flush(&client_ctx);
+		if (rc != 0) {
+			return TC_FAIL;
+		}
+	}
+
 	while (payload_left > 0) {
 		wait(APP_SLEEP_MSECS);
 		rc = mqtt_input(&client_ctx);
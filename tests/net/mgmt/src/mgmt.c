@@ -456,4 +456,39 @@ ZTEST(mgmt_fn_test_suite, test_mgmt_duplicate_handler)
 	net_mgmt_del_event_callback(&cb);
 }
 
+static k_tid_t direct_cb_thread;
+static int direct_cb_calls;
+
+static void net_mgmt_direct_event_handler(struct net_mgmt_event_callback *cb,
+					  uint32_t mgmt_event, struct net_if *iface)
+{
+	ARG_UNUSED(cb);
+	ARG_UNUSED(iface);
+	ARG_UNUSED(mgmt_event);
+
+	direct_cb_thread = k_current_get();
+	direct_cb_calls++;
+}
+
+ZTEST(mgmt_fn_test_suite, test_mgmt_direct_handler)
+{
+	struct net_mgmt_event_callback cb;
+
+	net_mgmt_init_event_callback(&cb, net_mgmt_direct_event_handler,
+				     NET_EVENT_IPV6_ADDR_DEL);
+	net_mgmt_add_event_callback_direct(&cb);
+
+	net_mgmt_event_notify(NET_EVENT_IPV6_ADDR_DEL, NULL);
+
+	zassert_equal(direct_cb_calls, 1, "Direct callback not called on notify");
+	zassert_equal_ptr(direct_cb_thread, k_current_get(),
+			  "Direct callback not called by the notifier");
+
+	net_mgmt_del_event_callback(&cb);
+
+	net_mgmt_event_notify(NET_EVENT_IPV6_ADDR_DEL, NULL);
+
+	zassert_equal(direct_cb_calls, 1, "Deleted callback called");
+}
+
 ZTEST_SUITE(mgmt_fn_test_suite, NULL, NULL, NULL, NULL, NULL);
@@ -1283,4 +1283,84 @@ ZTEST(net_pkt_test_suite, test_net_pkt_shallow_clone_append_buf_2)
 	test_net_pkt_shallow_clone_append_buf(2);
 }
 
+ZTEST(net_pkt_test_suite, test_net_pkt_pull_up)
+{
+	static const size_t frag_lens[] = { 10, 20, 30 };
+	NET_PKT_DATA_ACCESS_DEFINE(access, struct net_ipv4_hdr);
+	uint8_t readback[60];
+	struct net_buf_pool *tx_data;
+	struct net_pkt *pkt;
+	struct net_buf *frag;
+	size_t offset = 0;
+	void *hdr;
+
+	for (int i = 0; i < sizeof(small_buffer); i++) {
+		small_buffer[i] = i & 0xff;
+	}
+
+	pkt = net_pkt_alloc(K_NO_WAIT);
+	zassert_true(pkt != NULL, "Pkt not allocated");
+
+	net_pkt_get_info(NULL, NULL, NULL, &tx_data);
+
+	for (int i = 0; i < ARRAY_SIZE(frag_lens); i++) {
+		frag = net_buf_alloc_len(tx_data, CONFIG_NET_BUF_DATA_SIZE, K_NO_WAIT);
+		zassert_true(frag != NULL, "Frag not allocated");
+
+		net_buf_add_mem(frag, &small_buffer[offset], frag_lens[i]);
+		net_pkt_append_buffer(pkt, frag);
+		offset += frag_lens[i];
+	}
+
+	/* A 20 bytes header straddling fragments is copied */
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	hdr = net_pkt_get_data(pkt, &access);
+	zassert_not_null(hdr, "No header");
+	zassert_not_equal(hdr, pkt->buffer->data, "Header not copied");
+	zassert_mem_equal(hdr, small_buffer, sizeof(struct net_ipv4_hdr), "Wrong header");
+
+	/* Moving 40 bytes empties the second fragment */
+	zassert_equal(net_pkt_pull_up(pkt, 40), 0, "Pull up failed");
+	zassert_equal(pkt->buffer->len, 40, "Wrong first fragment length");
+	zassert_equal(pkt->buffer->frags->len, 20, "Wrong second fragment length");
+	zassert_is_null(pkt->buffer->frags->frags, "Empty fragment not freed");
+	zassert_equal(atomic_get(&tx_data->avail_count), tx_data->buf_count - 2,
+		      "Empty fragment not freed");
+	zassert_equal(net_pkt_get_len(pkt), 60, "Wrong packet length");
+
+	/* The header is now accessed in place */
+	hdr = net_pkt_get_data(pkt, &access);
+	zassert_equal(hdr, pkt->buffer->data, "Header not in place");
+
+	zassert_equal(net_pkt_acknowledge_data(pkt, &access), 0, "Acknowledge failed");
+	zassert_equal(net_pkt_get_current_offset(pkt), sizeof(struct net_ipv4_hdr),
+		      "Cursor not moved");
+
+	/* Asking for more than there is moves the whole packet */
+	zassert_equal(net_pkt_pull_up(pkt, 100), 0, "Pull up failed");
+	zassert_equal(pkt->buffer->len, 60, "Wrong first fragment length");
+	zassert_is_null(pkt->buffer->frags, "Empty fragment not freed");
+
+	net_pkt_cursor_init(pkt);
+	zassert_equal(net_pkt_read(pkt, readback, sizeof(readback)), 0, "Read failed");
+	zassert_mem_equal(readback, small_buffer, sizeof(readback), "Packet data changed");
+
+	/* No room left in a full first fragment */
+	net_buf_add_mem(pkt->buffer, small_buffer, net_buf_tailroom(pkt->buffer));
+
+	frag = net_buf_alloc_len(tx_data, CONFIG_NET_BUF_DATA_SIZE, K_NO_WAIT);
+	zassert_true(frag != NULL, "Frag not allocated");
+
+	net_buf_add_mem(frag, small_buffer, 10);
+	net_pkt_append_buffer(pkt, frag);
+
+	zassert_equal(net_pkt_pull_up(pkt, pkt->buffer->len + 1), -ENOBUFS,
+		      "Pull up did not fail");
+
+	net_pkt_unref(pkt);
+	zassert_equal(atomic_get(&tx_data->avail_count), tx_data->buf_count, "Leak detected");
+}
+
 ZTEST_SUITE(net_pkt_test_suite, NULL, NULL, NULL, NULL, NULL);
@@ -877,6 +877,55 @@ ZTEST_USER(net_socket_tcp, test_v6_recv_enotconn)
 	_test_recv_enotconn(c_sock, s_sock);
 }
 
+NET_BUF_POOL_FIXED_DEFINE(send_buf_pool, 1, sizeof(TEST_STR_SMALL), 0, NULL);
+
+ZTEST(net_socket_tcp, test_v4_send_buf_eopnotsupp)
+{
+	/* Zero-copy send is for datagram sockets only, a stream socket must
+	 * not fall back to copying the data.
+	 */
+	int c_sock;
+	int s_sock;
+	int new_sock;
+	struct sockaddr_in c_saddr;
+	struct sockaddr_in s_saddr;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	struct net_buf *buf;
+	char rx_buf[30];
+	ssize_t ret;
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, SERVER_PORT, &s_sock, &s_saddr);
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+
+	test_connect(c_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_accept(s_sock, &new_sock, &addr, &addrlen);
+
+	buf = net_buf_alloc(&send_buf_pool, K_NO_WAIT);
+	zassert_not_null(buf, "cannot allocate buffer");
+	net_buf_add_mem(buf, TEST_STR_SMALL, strlen(TEST_STR_SMALL));
+
+	ret = zsock_send_buf(c_sock, buf, 0);
+	zassert_equal(ret, -1, "send_buf should fail");
+	zassert_equal(errno, EOPNOTSUPP, "unexpected errno %d", errno);
+
+	net_buf_unref(buf);
+
+	/* Nothing was queued */
+	ret = zsock_recv(new_sock, rx_buf, sizeof(rx_buf), ZSOCK_MSG_DONTWAIT);
+	zassert_equal(ret, -1, "recv should fail");
+	zassert_equal(errno, EAGAIN, "unexpected errno %d", errno);
+
+	test_close(c_sock);
+	test_close(new_sock);
+	test_close(s_sock);
+
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+}
+
 ZTEST_USER(net_socket_tcp, test_shutdown_rd_synchronous)
 {
 	/* recv() after shutdown(..., ZSOCK_SHUT_RD) should return 0 (EOF).
@@ -2415,6 +2464,56 @@ ZTEST(net_socket_tcp, test_so_keepalive)
 	test_context_cleanup();
 }
 
+ZTEST(net_socket_tcp, test_congestion_control)
+{
+	struct sockaddr_in bind_addr4;
+	char name[16];
+	socklen_t namelen = sizeof(name);
+	int sock, ret;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_CONGESTION_AVOIDANCE);
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &sock, &bind_addr4);
+
+	ret = zsock_getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &namelen);
+	zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+	zassert_str_equal(name, CONFIG_NET_TCP_CONGESTION_DEFAULT,
+			  "unexpected default algorithm");
+	zassert_equal(namelen, strlen(CONFIG_NET_TCP_CONGESTION_DEFAULT) + 1,
+		      "getsockopt got invalid size");
+
+	/* A short buffer gets a truncated, NUL terminated name */
+	memset(name, 'x', sizeof(name));
+	namelen = 2;
+	ret = zsock_getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &namelen);
+	zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+	zassert_equal(namelen, 2, "getsockopt got invalid size");
+	zassert_equal(name[0], CONFIG_NET_TCP_CONGESTION_DEFAULT[0]);
+	zassert_equal(name[1], '\0', "name is not NUL terminated");
+
+	ret = zsock_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "none", strlen("none"));
+	zassert_equal(ret, -1, "setsockopt accepted an unknown algorithm");
+	zassert_equal(errno, ENOENT, "setsockopt failed with %d", errno);
+
+	if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_CUBIC)) {
+		ret = zsock_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "cubic",
+				       strlen("cubic"));
+		zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+
+		namelen = sizeof(name);
+		ret = zsock_getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &namelen);
+		zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+		zassert_str_equal(name, "cubic", "algorithm was not changed");
+	}
+
+	ret = zsock_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "reno", sizeof("reno"));
+	zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+
+	test_close(sock);
+
+	test_context_cleanup();
+}
+
 ZTEST(net_socket_tcp, test_keepalive_timeout)
 {
 	struct sockaddr_in c_saddr, s_saddr;
@@ -2528,6 +2528,143 @@ ZTEST(net_socket_udp, test_37_ipv6_src_addr_select)
 				       &my_addr3, &dest);
 }
 
+ZTEST(net_socket_udp, test_38_v4_recv_buf)
+{
+	int rv;
+	ssize_t recved;
+	int client_sock;
+	int server_sock;
+	struct net_buf *frags;
+	struct sockaddr addr;
+	socklen_t addrlen;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, CLIENT_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(client_sock,
+			(struct sockaddr *)&client_addr, sizeof(client_addr));
+	zassert_equal(rv, 0, "bind failed");
+
+	rv = zsock_bind(server_sock,
+			(struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, 0, "bind failed");
+
+	/* Nothing queued yet */
+	recved = zsock_recv_buf(server_sock, &frags, ZSOCK_MSG_DONTWAIT, NULL, NULL);
+	zassert_equal(recved, -1, "recv_buf should fail");
+	zassert_equal(errno, EAGAIN, "unexpected errno %d", errno);
+
+	recved = zsock_recv_buf(server_sock, &frags, ZSOCK_MSG_PEEK, NULL, NULL);
+	zassert_equal(recved, -1, "recv_buf with MSG_PEEK should fail");
+	zassert_equal(errno, EINVAL, "unexpected errno %d", errno);
+
+	/* Payload spanning several net_bufs */
+	rv = zsock_sendto(client_sock, TEST_STR2, STRLEN(TEST_STR2), 0,
+			  (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, STRLEN(TEST_STR2), "sendto failed");
+
+	addrlen = sizeof(addr);
+	frags = NULL;
+	recved = zsock_recv_buf(server_sock, &frags, 0, &addr, &addrlen);
+	zassert_equal(recved, STRLEN(TEST_STR2), "unexpected length %zd", recved);
+	zassert_not_null(frags, "no fragments returned");
+	zassert_equal(net_buf_frags_len(frags), recved, "fragment length mismatch");
+	zassert_equal(addrlen, sizeof(struct sockaddr_in), "wrong addrlen");
+	zassert_equal(net_sin(&addr)->sin_port, htons(CLIENT_PORT), "wrong port");
+
+	clear_buf(rx_buf);
+	zassert_equal(net_buf_linearize(rx_buf, sizeof(rx_buf), frags, 0, recved),
+		      recved, "linearize failed");
+	zassert_mem_equal(rx_buf, BUF_AND_SIZE(TEST_STR2), "wrong data");
+
+	zsock_recv_buf_release(frags);
+
+	/* Regular receive keeps working afterwards */
+	rv = zsock_sendto(client_sock, TEST_STR_SMALL, STRLEN(TEST_STR_SMALL), 0,
+			  (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, STRLEN(TEST_STR_SMALL), "sendto failed");
+
+	clear_buf(rx_buf);
+	recved = zsock_recv(server_sock, rx_buf, sizeof(rx_buf), 0);
+	zassert_equal(recved, STRLEN(TEST_STR_SMALL), "recv failed");
+	zassert_mem_equal(rx_buf, BUF_AND_SIZE(TEST_STR_SMALL), "wrong data");
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
+static K_SEM_DEFINE(zc_buf_released, 0, 1);
+
+static void zc_buf_destroy(struct net_buf *buf)
+{
+	net_buf_destroy(buf);
+	k_sem_give(&zc_buf_released);
+}
+
+NET_BUF_POOL_HEAP_DEFINE(zc_buf_pool, 1, 0, zc_buf_destroy);
+
+static const char zc_tx_data[] = TEST_STR2;
+
+ZTEST(net_socket_udp, test_39_v4_send_buf)
+{
+	int rv;
+	ssize_t sent;
+	ssize_t recved;
+	int client_sock;
+	int server_sock;
+	struct net_buf *buf;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, CLIENT_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock,
+			(struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, 0, "bind failed");
+
+	/* Wrap constant data without copying it */
+	buf = net_buf_alloc_with_data(&zc_buf_pool, (void *)zc_tx_data,
+				      STRLEN(TEST_STR2), K_NO_WAIT);
+	zassert_not_null(buf, "cannot allocate buffer");
+
+	sent = zsock_sendto_buf(client_sock, buf, 0,
+				(struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(sent, STRLEN(TEST_STR2), "sendto_buf failed (%d)", errno);
+
+	/* Drop our reference, the stack holds its own until the packet is sent */
+	net_buf_unref(buf);
+
+	rv = k_sem_take(&zc_buf_released, K_MSEC(100));
+	zassert_equal(rv, 0, "buffer not released after send");
+
+	clear_buf(rx_buf);
+	recved = zsock_recv(server_sock, rx_buf, sizeof(rx_buf), 0);
+	zassert_equal(recved, STRLEN(TEST_STR2), "recv failed");
+	zassert_mem_equal(rx_buf, BUF_AND_SIZE(TEST_STR2), "wrong data");
+
+	/* Not connected, so there is no peer to send to */
+	buf = net_buf_alloc_with_data(&zc_buf_pool, (void *)zc_tx_data,
+				      STRLEN(TEST_STR2), K_NO_WAIT);
+	zassert_not_null(buf, "cannot allocate buffer");
+
+	sent = zsock_send_buf(client_sock, buf, 0);
+	zassert_equal(sent, -1, "send_buf should fail");
+	zassert_equal(errno, EDESTADDRREQ, "unexpected errno %d", errno);
+
+	net_buf_unref(buf);
+	(void)k_sem_take(&zc_buf_released, K_NO_WAIT);
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
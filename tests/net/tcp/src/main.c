@@ -133,6 +133,8 @@ static enum test_case_no {
 	TEST_CLIENT_CLOSING_FAILURE_IPV6 = 16,
 	TEST_CLIENT_FIN_WAIT_2_IPV4_FAILURE = 17,
 	TEST_CLIENT_FIN_ACK_WITH_DATA = 18,
+	TEST_SERVER_SACK_IPV4 = 19,
+	TEST_CLIENT_SACK_IPV4 = 20,
 } test_case_no;
 
 static enum test_state t_state;
@@ -157,6 +159,9 @@ static void handle_server_rst_on_closed_port(sa_family_t af, struct tcphdr *th);
 static void handle_server_rst_on_listening_port(sa_family_t af, struct tcphdr *th);
 static void handle_syn_invalid_ack(sa_family_t af, struct tcphdr *th);
 static void handle_client_fin_ack_with_data_test(sa_family_t af, struct tcphdr *th);
+#if defined(CONFIG_NET_TCP_SACK)
+static void handle_sack_test(struct net_pkt *pkt, struct tcphdr *th);
+#endif
 
 static void verify_flags(struct tcphdr *th, uint8_t flags,
 			 const char *fun, int line)
@@ -254,23 +259,20 @@ static uint8_t tcp_options[20] = {
 	0x01, /* NOP */
 	0x03, 0x03, 0x07 /* Win scale*/ };
 
-static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
-					      uint16_t src_port,
-					      uint16_t dst_port,
-					      uint8_t flags,
-					      const uint8_t *data,
-					      size_t len)
+static struct net_pkt *tester_prepare_tcp_pkt_opts(sa_family_t af,
+						   uint16_t src_port,
+						   uint16_t dst_port,
+						   uint8_t flags,
+						   const uint8_t *opts,
+						   size_t opts_len,
+						   const uint8_t *data,
+						   size_t len)
 {
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct net_pkt *pkt;
 	struct tcphdr *th;
-	uint8_t opts_len = 0;
 	int ret = -EINVAL;
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
-		opts_len = sizeof(tcp_options);
-	}
-
 	/* Allocate buffer */
 	pkt = net_pkt_alloc_with_buffer(net_iface,
 					sizeof(struct tcphdr) + len + opts_len,
@@ -303,14 +305,9 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	th->th_sport = src_port;
 	th->th_dport = dst_port;
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
-		th->th_off = 10U;
-	} else {
-		th->th_off = 5U;
-	}
-
+	th->th_off = 5U + opts_len / sizeof(uint32_t);
 	th->th_flags = flags;
-	th->th_win = NET_IPV6_MTU;
+	th->th_win = htons(NET_IPV6_MTU);
 	th->th_seq = htonl(seq);
 
 	if (ACK & flags) {
@@ -322,9 +319,9 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 		goto fail;
 	}
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+	if (opts_len) {
 		/* Add TCP Options */
-		ret = net_pkt_write(pkt, tcp_options, opts_len);
+		ret = net_pkt_write(pkt, opts, opts_len);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -357,6 +354,23 @@ fail:
 	return NULL;
 }
 
+static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
+					      uint16_t src_port,
+					      uint16_t dst_port,
+					      uint8_t flags,
+					      const uint8_t *data,
+					      size_t len)
+{
+	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+		return tester_prepare_tcp_pkt_opts(af, src_port, dst_port, flags,
+						   tcp_options, sizeof(tcp_options),
+						   data, len);
+	}
+
+	return tester_prepare_tcp_pkt_opts(af, src_port, dst_port, flags,
+					   NULL, 0U, data, len);
+}
+
 static struct net_pkt *prepare_syn_packet(sa_family_t af, uint16_t src_port,
 					  uint16_t dst_port)
 {
@@ -509,6 +523,12 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 	case TEST_CLIENT_FIN_ACK_WITH_DATA:
 		handle_client_fin_ack_with_data_test(net_pkt_family(pkt), &th);
 		break;
+#if defined(CONFIG_NET_TCP_SACK)
+	case TEST_SERVER_SACK_IPV4:
+	case TEST_CLIENT_SACK_IPV4:
+		handle_sack_test(pkt, &th);
+		break;
+#endif
 
 	default:
 		zassert_true(false, "Undefined test case");
@@ -738,6 +758,13 @@ static void handle_server_test(sa_family_t af, struct tcphdr *th)
 		break;
 	case T_SYN_ACK:
 		test_verify_flags(th, SYN | ACK);
+		/* MSS is always sent, SACK permitted only if the peer offered it */
+		if (IS_ENABLED(CONFIG_NET_TCP_SACK) &&
+		    test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) {
+			zassert_equal(th->th_off, 7U, "SACK permitted option missing");
+		} else {
+			zassert_equal(th->th_off, 6U, "Unexpected TCP options");
+		}
 		seq++;
 		ack = ntohl(th->th_seq) + 1U;
 		reply = prepare_ack_packet(af, htons(MY_PORT),
@@ -2621,4 +2648,421 @@ ZTEST(net_tcp, test_client_fin_ack_with_data)
 	}
 }
 
+#if defined(CONFIG_NET_TCP_SACK)
+/* Peer MSS, small so that a few hundred bytes span several segments */
+#define SACK_TEST_MSS 100
+#define SACK_TEST_SEGMENTS 4
+
+/* Segment sent by the device, as seen by the peer */
+struct sack_segment {
+	uint32_t seq;
+	uint32_t ack;
+	uint16_t len;
+	uint8_t flags;
+	bool sack_perm;
+	uint8_t sack_cnt;
+	struct tcp_sack_block sack[NET_TCP_SACK_BLOCKS_MAX];
+};
+
+K_MSGQ_DEFINE(sack_segments, sizeof(struct sack_segment), 8, 4);
+static uint16_t sack_port;
+
+static void sack_options_parse(struct sack_segment *seg, const uint8_t *opts,
+			       size_t len)
+{
+	uint8_t opt_len;
+
+	for (size_t i = 0; i < len; i += opt_len) {
+		if (opts[i] == NET_TCP_END_OPT) {
+			break;
+		}
+
+		if (opts[i] == NET_TCP_NOP_OPT) {
+			opt_len = NET_TCP_NOP_SIZE;
+			continue;
+		}
+
+		zassert_true(i + 1 < len, "Truncated TCP option");
+		opt_len = opts[i + 1];
+		zassert_true(opt_len >= 2 && i + opt_len <= len, "Invalid TCP option length");
+
+		if (opts[i] == NET_TCP_SACK_PERM_OPT) {
+			seg->sack_perm = true;
+		} else if (opts[i] == NET_TCP_SACK_OPT) {
+			seg->sack_cnt = (opt_len - 2) / NET_TCP_SACK_BLOCK_SIZE;
+			zassert_true(seg->sack_cnt <= NET_TCP_SACK_BLOCKS_MAX,
+				     "Too many SACK blocks (%d)", seg->sack_cnt);
+
+			for (int j = 0; j < seg->sack_cnt; j++) {
+				const uint8_t *block = &opts[i + 2 + j * NET_TCP_SACK_BLOCK_SIZE];
+
+				seg->sack[j].start = ntohl(UNALIGNED_GET((uint32_t *)block));
+				seg->sack[j].end = ntohl(UNALIGNED_GET((uint32_t *)(block + 4)));
+			}
+		}
+	}
+}
+
+static struct net_pkt *prepare_sack_packet(uint8_t flags,
+					   const struct tcp_sack_block *blocks,
+					   int cnt, const uint8_t *data,
+					   size_t len)
+{
+	uint8_t opts[NET_TCP_SACK_OPT_MAX_SIZE];
+	size_t opts_len = 0;
+
+	if (flags & SYN) {
+		opts[0] = NET_TCP_MSS_OPT;
+		opts[1] = NET_TCP_MSS_SIZE;
+		UNALIGNED_PUT(htons(SACK_TEST_MSS), (uint16_t *)&opts[2]);
+		opts[4] = NET_TCP_NOP_OPT;
+		opts[5] = NET_TCP_NOP_OPT;
+		opts[6] = NET_TCP_SACK_PERM_OPT;
+		opts[7] = NET_TCP_SACK_PERM_SIZE;
+		opts_len = 8;
+	} else if (cnt > 0) {
+		opts[0] = NET_TCP_NOP_OPT;
+		opts[1] = NET_TCP_NOP_OPT;
+		opts[2] = NET_TCP_SACK_OPT;
+		opts[3] = 2 + cnt * NET_TCP_SACK_BLOCK_SIZE;
+		opts_len = 4;
+
+		for (int i = 0; i < cnt; i++) {
+			UNALIGNED_PUT(htonl(blocks[i].start), (uint32_t *)&opts[opts_len]);
+			UNALIGNED_PUT(htonl(blocks[i].end), (uint32_t *)&opts[opts_len + 4]);
+			opts_len += NET_TCP_SACK_BLOCK_SIZE;
+		}
+	}
+
+	return tester_prepare_tcp_pkt_opts(AF_INET, htons(MY_PORT), sack_port,
+					   flags, opts, opts_len, data, len);
+}
+
+static void send_sack_packet(uint8_t flags, const struct tcp_sack_block *blocks,
+			     int cnt, const uint8_t *data, size_t len)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	pkt = prepare_sack_packet(flags, blocks, cnt, data, len);
+	zassert_not_null(pkt, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	/* Let the IP stack to process the packet properly */
+	k_yield();
+}
+
+static void handle_sack_test(struct net_pkt *pkt, struct tcphdr *th)
+{
+	size_t hdr_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt);
+	size_t opts_len = th->th_off * 4U - sizeof(struct tcphdr);
+	struct sack_segment seg = { 0 };
+	uint8_t opts[40];
+	struct net_pkt *reply;
+	int ret;
+
+	seg.seq = ntohl(th->th_seq);
+	seg.ack = ntohl(th->th_ack);
+	seg.flags = th->th_flags;
+	seg.len = net_pkt_get_len(pkt) - hdr_len - th->th_off * 4U;
+
+	if (opts_len > 0) {
+		net_pkt_cursor_init(pkt);
+		net_pkt_set_overwrite(pkt, true);
+
+		ret = net_pkt_skip(pkt, hdr_len + sizeof(struct tcphdr));
+		zassert_ok(ret, "Cannot skip to the TCP options");
+
+		ret = net_pkt_read(pkt, opts, opts_len);
+		zassert_ok(ret, "Cannot read the TCP options");
+
+		net_pkt_cursor_init(pkt);
+
+		sack_options_parse(&seg, opts, opts_len);
+	}
+
+	/* The peer side of the client test answers the SYN itself, so that
+	 * net_context_connect() can complete.
+	 */
+	if (test_case_no == TEST_CLIENT_SACK_IPV4 && seg.flags == SYN) {
+		device_initial_seq = seg.seq;
+		sack_port = th->th_sport;
+		seq = 0U;
+		ack = seg.seq + 1U;
+
+		reply = prepare_sack_packet(SYN | ACK, NULL, 0, NULL, 0U);
+		zassert_not_null(reply, "Cannot create pkt");
+		seq++;
+
+		ret = net_recv_data(net_iface, reply);
+		zassert_true(ret == 0, "recv data failed (%d)", ret);
+		return;
+	}
+
+	ret = k_msgq_put(&sack_segments, &seg, K_NO_WAIT);
+	zassert_ok(ret, "Too many segments pending");
+}
+
+static void sack_segment_get(struct sack_segment *seg, int line)
+{
+	int ret;
+
+	ret = k_msgq_get(&sack_segments, seg, K_MSEC(100));
+	zassert_ok(ret, "No segment from the device (line %d)", line);
+}
+
+static void check_sack_blocks(const struct tcp_sack_block *blocks, int cnt,
+			      const struct tcp_sack_block *expected,
+			      int expected_cnt)
+{
+	zassert_equal(cnt, expected_cnt, "Expected %d SACK block(s), got %d",
+		      expected_cnt, cnt);
+
+	for (int i = 0; i < cnt; i++) {
+		zassert_equal(blocks[i].start, expected[i].start,
+			      "SACK block %d starts at %u, expected %u",
+			      i, blocks[i].start, expected[i].start);
+		zassert_equal(blocks[i].end, expected[i].end,
+			      "SACK block %d ends at %u, expected %u",
+			      i, blocks[i].end, expected[i].end);
+	}
+}
+
+static void check_sack_ack(uint32_t expected_ack,
+			   const struct tcp_sack_block *expected, int cnt)
+{
+	struct sack_segment seg;
+
+	sack_segment_get(&seg, __LINE__);
+
+	zassert_equal(seg.flags, ACK, "Expected ACK, got 0x%02x", seg.flags);
+	zassert_equal(seg.ack, expected_ack, "Expected ACK %u but got %u",
+		      expected_ack, seg.ack);
+	check_sack_blocks(seg.sack, seg.sack_cnt, expected, cnt);
+}
+
+/* Test case scenario IPv4
+ *   send SYN with SACK permitted,
+ *   expect SYN ACK with SACK permitted,
+ *   send ACK,
+ *   send out-of-order data,
+ *   expect ACK with a SACK block for it,
+ *   send more out-of-order data,
+ *   expect ACK with the SACK block extended,
+ *   fill the hole,
+ *   expect ACK for all data and no SACK block.
+ *   any failures cause test case to fail.
+ */
+ZTEST(net_tcp, test_server_sack_blocks_ipv4)
+{
+	const uint8_t *data = lorem_ipsum;
+	struct tcp_sack_block block;
+	struct sack_segment seg;
+	struct net_context *ctx;
+	int ret;
+
+	/* Only out-of-order data that is queued can be reported */
+	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT == 0) {
+		return;
+	}
+
+	test_case_no = TEST_SERVER_SACK_IPV4;
+	sack_port = htons(PEER_PORT);
+	seq = ack = 0;
+	k_msgq_purge(&sack_segments);
+	k_sem_reset(&test_sem);
+
+	ret = net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx);
+	zassert_ok(ret, "Failed to get net_context");
+
+	net_context_ref(ctx);
+
+	ret = net_context_bind(ctx, (struct sockaddr *)&my_addr_s,
+			       sizeof(struct sockaddr_in));
+	zassert_ok(ret, "Failed to bind net_context");
+
+	ret = net_context_listen(ctx, 1);
+	zassert_ok(ret, "Failed to listen on net_context");
+
+	ret = net_context_accept(ctx, test_tcp_accept_cb, K_FOREVER, NULL);
+	zassert_ok(ret, "Failed to set accept on net_context");
+
+	send_sack_packet(SYN, NULL, 0, NULL, 0U);
+
+	sack_segment_get(&seg, __LINE__);
+	zassert_equal(seg.flags, SYN | ACK, "Expected SYN ACK, got 0x%02x", seg.flags);
+	zassert_true(seg.sack_perm, "SACK permitted option missing");
+	ack = seg.seq + 1U;
+	seq++;
+
+	send_sack_packet(ACK, NULL, 0, NULL, 0U);
+
+	/* test_tcp_accept_cb will release the semaphore after successful
+	 * connection.
+	 */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	/* Bytes 10..19 arrive before 0..9 */
+	seq = 11U;
+	send_sack_packet(PSH | ACK, NULL, 0, &data[10], 10U);
+	block = (struct tcp_sack_block){ .start = 11U, .end = 21U };
+	check_sack_ack(1U, &block, 1);
+
+	/* Contiguous out-of-order data extends the block */
+	seq = 21U;
+	send_sack_packet(PSH | ACK, NULL, 0, &data[20], 10U);
+	block.end = 31U;
+	check_sack_ack(1U, &block, 1);
+
+	/* Filling the hole acknowledges everything, nothing is left to report */
+	seq = 1U;
+	send_sack_packet(PSH | ACK, NULL, 0, &data[0], 10U);
+	check_sack_ack(31U, NULL, 0);
+
+	/* Just send a RST packet to abort the underlying connection, so that
+	 * the testcase does not need to implement full TCP closing handshake.
+	 */
+	seq = 31U;
+	send_sack_packet(RST, NULL, 0, NULL, 0U);
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+	net_context_put(accepted_ctx);
+}
+
+static bool sack_segment_overlaps(const struct sack_segment *seg,
+				  const struct tcp_sack_block *block)
+{
+	return seg->len > 0 &&
+	       net_tcp_seq_cmp(seg->seq + seg->len, block->start) > 0 &&
+	       net_tcp_seq_cmp(seg->seq, block->end) < 0;
+}
+
+static void check_sack_scoreboard(struct tcp *conn,
+				  const struct tcp_sack_block *expected, int cnt)
+{
+	/* Let the receiving thread run */
+	k_msleep(10);
+
+	check_sack_blocks(conn->sack_blocks, conn->sack_cnt, expected, cnt);
+}
+
+/* Test case scenario IPv4
+ *   expect SYN,
+ *   send SYN ACK with SACK permitted,
+ *   expect ACK,
+ *   expect four data segments,
+ *   send two duplicate ACKs selectively acknowledging segments 2 and 4,
+ *   send the third duplicate ACK,
+ *   expect segments 1 and 3 to be resent, and 2 and 4 not,
+ *   acknowledge segments 1 and 2, then all data,
+ *   any failures cause test case to fail.
+ */
+ZTEST(net_tcp, test_client_sack_retransmit_ipv4)
+{
+	struct tcp_sack_block blocks[2];
+	struct tcp_sack_block expected[2];
+	struct sack_segment seg;
+	struct net_context *ctx;
+	struct tcp *conn;
+	uint32_t base;
+	int ret;
+
+	/* The initial congestion window would allow a single segment in flight */
+	Z_TEST_SKIP_IFDEF(CONFIG_NET_TCP_CONGESTION_AVOIDANCE);
+
+	test_case_no = TEST_CLIENT_SACK_IPV4;
+	seq = ack = 0;
+	k_msgq_purge(&sack_segments);
+
+	ret = net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx);
+	zassert_ok(ret, "Failed to get net_context");
+
+	net_context_ref(ctx);
+
+	ret = net_context_connect(ctx, (struct sockaddr *)&peer_addr_s,
+				  sizeof(struct sockaddr_in), NULL,
+				  K_MSEC(100), NULL);
+	zassert_ok(ret, "Failed to connect to peer");
+
+	conn = ctx->tcp;
+	zassert_true(conn->sack_ok, "SACK not negotiated");
+
+	sack_segment_get(&seg, __LINE__);
+	zassert_equal(seg.flags, ACK, "Expected ACK, got 0x%02x", seg.flags);
+
+	base = device_initial_seq + 1U;
+
+	ret = net_context_send(ctx, lorem_ipsum, SACK_TEST_SEGMENTS * SACK_TEST_MSS,
+			       NULL, K_NO_WAIT, NULL);
+	zassert_equal(ret, SACK_TEST_SEGMENTS * SACK_TEST_MSS,
+		      "Failed to send data to peer (%d)", ret);
+
+	for (int i = 0; i < SACK_TEST_SEGMENTS; i++) {
+		sack_segment_get(&seg, __LINE__);
+		zassert_equal(seg.seq, base + i * SACK_TEST_MSS,
+			      "Unexpected sequence number of segment %d", i);
+		zassert_equal(seg.len, SACK_TEST_MSS, "Unexpected length of segment %d", i);
+	}
+
+	/* Segments 1 and 3 are lost, the peer reports 2 in the first
+	 * duplicate ACK, then 4 and 2 (most recent first).
+	 */
+	blocks[0] = (struct tcp_sack_block){ base + 100U, base + 200U };
+	send_sack_packet(ACK, blocks, 1, NULL, 0U);
+	check_sack_scoreboard(conn, blocks, 1);
+
+	blocks[0] = (struct tcp_sack_block){ base + 300U, base + 400U };
+	blocks[1] = (struct tcp_sack_block){ base + 100U, base + 200U };
+	send_sack_packet(ACK, blocks, 2, NULL, 0U);
+
+	/* The scoreboard is kept sorted */
+	expected[0] = blocks[1];
+	expected[1] = blocks[0];
+	check_sack_scoreboard(conn, expected, 2);
+
+	/* The third duplicate ACK triggers the fast retransmit of the holes */
+	send_sack_packet(ACK, blocks, 2, NULL, 0U);
+
+	sack_segment_get(&seg, __LINE__);
+	zassert_equal(seg.seq, base, "First hole not resent");
+	zassert_equal(seg.len, SACK_TEST_MSS, "Unexpected length of the first hole");
+
+	sack_segment_get(&seg, __LINE__);
+	zassert_equal(seg.seq, base + 200U, "Second hole not resent");
+	zassert_equal(seg.len, SACK_TEST_MSS, "Unexpected length of the second hole");
+
+	/* Nothing the peer already holds may be resent */
+	while (k_msgq_get(&sack_segments, &seg, K_MSEC(10)) == 0) {
+		zassert_false(sack_segment_overlaps(&seg, &blocks[0]) ||
+			      sack_segment_overlaps(&seg, &blocks[1]),
+			      "Selectively acknowledged data resent at %u",
+			      seg.seq - base);
+	}
+
+	/* The cumulative ACK covers the first block, only the second is kept */
+	ack = base + 200U;
+	send_sack_packet(ACK, blocks, 1, NULL, 0U);
+	check_sack_scoreboard(conn, &blocks[0], 1);
+
+	ack = base + 400U;
+	send_sack_packet(ACK, NULL, 0, NULL, 0U);
+	check_sack_scoreboard(conn, NULL, 0);
+
+	/* Just send a RST packet to abort the underlying connection, so that
+	 * the testcase does not need to implement full TCP closing handshake.
+	 */
+	send_sack_packet(RST, NULL, 0, NULL, 0U);
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+}
+#endif /* CONFIG_NET_TCP_SACK */
+
 ZTEST_SUITE(net_tcp, NULL, presetup, NULL, NULL, NULL);
@@ -95,6 +95,9 @@ static bool test_started;
 static bool test_failed;
 static bool start_receiving;
 static bool recv_cb_called;
+static bool batch_receiving;
+static sys_slist_t batch_pkts;
+static int batch_pkt_count;
 static struct k_sem wait_data;
 
 #define WAIT_TIME K_SECONDS(1)
@@ -188,6 +191,12 @@ static int eth_tx(const struct device *dev, struct net_pkt *pkt)
 		udp_hdr->src_port = udp_hdr->dst_port;
 		udp_hdr->dst_port = port;
 
+		if (batch_receiving) {
+			net_pkt_list_append(&batch_pkts, net_pkt_clone(pkt, K_NO_WAIT));
+			batch_pkt_count++;
+			return 0;
+		}
+
 		if (net_recv_data(net_pkt_iface(pkt),
 				  net_pkt_clone(pkt, K_NO_WAIT)) < 0) {
 			test_failed = true;
@@ -1053,6 +1062,65 @@ ZTEST(net_traffic_class, test_mix_all_2)
 	test_traffic_class_recv_data_mix_all_2();
 }
 
+ZTEST(net_traffic_class, test_recv_batch)
+{
+	static const enum net_priority prios[] = {
+		NET_PRIORITY_BK, NET_PRIORITY_VO, NET_PRIORITY_BE, NET_PRIORITY_NC,
+	};
+	uint8_t data[128];
+	int len, ret, i;
+
+	zassert_equal(net_recv_data_batch(NULL, NULL), -EINVAL,
+		      "NULL batch accepted");
+
+	sys_slist_init(&batch_pkts);
+	batch_pkt_count = 0;
+	zassert_equal(net_recv_data_batch(NULL, &batch_pkts), 0,
+		      "Empty batch not handled");
+
+	len = strlen(test_data);
+	memcpy(data, test_data, len);
+
+	k_sem_init(&wait_data, 0, UINT_MAX);
+
+	/* Collect the looped back packets of different traffic classes
+	 * and hand them over to the stack in one go.
+	 */
+	batch_receiving = true;
+	start_receiving = true;
+
+	for (i = 0; i < ARRAY_SIZE(prios); i++) {
+		int tc = net_rx_priority2tc(prios[i]);
+
+		ret = net_context_sendto(net_ctxs_rx[tc].ctx, data, len,
+					 (struct sockaddr *)&dst_addr6,
+					 sizeof(struct sockaddr_in6),
+					 NULL, K_NO_WAIT, NULL);
+		zassert_true(ret > 0, "Send UDP pkt failed");
+	}
+
+	/* Let the TX side loop the packets back */
+	k_sleep(K_MSEC(10));
+
+	batch_receiving = false;
+	start_receiving = false;
+
+	zassert_equal(batch_pkt_count, ARRAY_SIZE(prios),
+		      "Expected %d packets, got %d", ARRAY_SIZE(prios),
+		      batch_pkt_count);
+
+	ret = net_recv_data_batch(NULL, &batch_pkts);
+	zassert_equal(ret, ARRAY_SIZE(prios), "Batch queued %d packets", ret);
+	zassert_true(sys_slist_is_empty(&batch_pkts), "Batch not consumed");
+
+	for (i = 0; i < ARRAY_SIZE(prios); i++) {
+		zassert_ok(k_sem_take(&wait_data, WAIT_TIME),
+			   "Timeout waiting packet %d", i);
+	}
+
+	zassert_false(test_failed, "Traffic class verification failed.");
+}
+
 static void run_before(void *dummy)
 {
 	ARG_UNUSED(dummy);
@@ -923,4 +923,36 @@ ZTEST(test_utils_fn, test_ip_checksum)
 	}
 }
 
+ZTEST(test_utils_fn, test_ip_checksum_copy)
+{
+	static uint8_t copy[CHECKSUM_TEST_LENGTH + 8];
+	uint16_t sum_got;
+	uint16_t sum_exp;
+
+	for (int i = 0; i < CHECKSUM_TEST_LENGTH; i++) {
+		testdata[i] = (uint8_t)(i + 7) * 13;
+	}
+
+	/* Source and destination alignments are independent */
+	for (int offset = 0; offset < 8; offset++) {
+		for (int length = 0; length < 64; length++) {
+			memset(copy, 0, sizeof(copy));
+
+			sum_exp = calc_chksum_ref(length ^ 0x4a1d, testdata + offset, length);
+			sum_got = calc_chksum_copy(length ^ 0x4a1d, copy + (7 - offset),
+						   testdata + offset, length);
+
+			zassert_equal(sum_got, sum_exp,
+				      "Mismatch between reference and copied checksum\n");
+			zassert_mem_equal(copy + (7 - offset), testdata + offset, length,
+					  "Data not copied\n");
+		}
+	}
+
+	sum_exp = calc_chksum_ref(0, testdata, CHECKSUM_TEST_LENGTH);
+	sum_got = calc_chksum_copy(0, copy + 1, testdata, CHECKSUM_TEST_LENGTH);
+
+	zassert_equal(sum_got, sum_exp, "Mismatch between reference and copied checksum\n");
+}
+
 ZTEST_SUITE(test_utils_fn, NULL, NULL, NULL, NULL, NULL);
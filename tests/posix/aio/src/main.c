@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <aio.h>
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/posix/fcntl.h>
+#include <zephyr/posix/posix_features.h>
+#include <zephyr/ztest.h>
+
+#define SHM_PATH "/aio"
+#define SHM_SIZE 64
+
+BUILD_ASSERT(AIO_LISTIO_MAX >= 3, "CONFIG_POSIX_AIO_MAX must be at least 3");
+
+static int fd;
+static K_SEM_DEFINE(notify_sem, 0, 1);
+
+static void notify(union sigval val)
+{
+	*(int *)val.sival_ptr += 1;
+	k_sem_give(&notify_sem);
+}
+
+static void aiocb_prep(struct aiocb *cb, int opcode, void *buf, size_t len, off_t offset)
+{
+	memset(cb, 0, sizeof(*cb));
+	cb->aio_fildes = fd;
+	cb->aio_buf = buf;
+	cb->aio_nbytes = len;
+	cb->aio_offset = offset;
+	cb->aio_lio_opcode = opcode;
+	cb->aio_sigevent.sigev_notify = SIGEV_NONE;
+}
+
+static void aio_wait(struct aiocb *cb)
+{
+	const struct aiocb *list[] = {cb};
+
+	while (aio_error(cb) == EINPROGRESS) {
+		zassert_ok(aio_suspend(list, ARRAY_SIZE(list), NULL));
+	}
+}
+
+ZTEST(aio, test_aio_read_write)
+{
+	static const char data[] = "asynchronous";
+	char buf[sizeof(data)] = {0};
+	struct aiocb cb;
+
+	aiocb_prep(&cb, LIO_WRITE, (void *)data, sizeof(data), 8);
+	zassert_ok(aio_write(&cb));
+	aio_wait(&cb);
+	zassert_ok(aio_error(&cb));
+	zassert_equal(aio_return(&cb), sizeof(data));
+
+	aiocb_prep(&cb, LIO_READ, buf, sizeof(buf), 8);
+	zassert_ok(aio_read(&cb));
+	aio_wait(&cb);
+	zassert_ok(aio_error(&cb));
+	zassert_equal(aio_return(&cb), sizeof(buf));
+	zassert_mem_equal(buf, data, sizeof(data));
+
+	aiocb_prep(&cb, LIO_NOP, NULL, 0, 0);
+	zassert_ok(aio_fsync(0, &cb));
+	aio_wait(&cb);
+}
+
+ZTEST(aio, test_aio_invalid)
+{
+	struct aiocb cb;
+	char c;
+
+	zassert_equal(aio_read(NULL), -1);
+	zassert_equal(errno, EINVAL);
+
+	aiocb_prep(&cb, LIO_READ, &c, 1, -1);
+	zassert_equal(aio_read(&cb), -1);
+	zassert_equal(errno, EINVAL);
+
+	/* A bad descriptor is reported asynchronously */
+	aiocb_prep(&cb, LIO_READ, &c, 1, 0);
+	cb.aio_fildes = -1;
+	zassert_ok(aio_read(&cb));
+	aio_wait(&cb);
+	zassert_equal(aio_error(&cb), EBADF);
+	zassert_equal(aio_return(&cb), -1);
+}
+
+ZTEST(aio, test_aio_notify)
+{
+	static const char data[] = "notified";
+	struct aiocb cb;
+	int count = 0;
+
+	k_sem_reset(&notify_sem);
+
+	aiocb_prep(&cb, LIO_WRITE, (void *)data, sizeof(data), 0);
+	cb.aio_sigevent.sigev_notify = SIGEV_THREAD;
+	cb.aio_sigevent.sigev_notify_function = notify;
+	cb.aio_sigevent.sigev_value.sival_ptr = &count;
+	zassert_ok(aio_write(&cb));
+
+	zassert_ok(k_sem_take(&notify_sem, K_SECONDS(1)));
+	zassert_equal(count, 1);
+	zassert_equal(aio_return(&cb), sizeof(data));
+}
+
+ZTEST(aio, test_lio_listio)
+{
+	static const char data[] = "0123456789";
+	char buf[2][5] = {0};
+	struct aiocb cbs[AIO_LISTIO_MAX];
+	struct aiocb *list[AIO_LISTIO_MAX] = {0};
+	struct sigevent sig = {0};
+	int count = 0;
+
+	aiocb_prep(&cbs[0], LIO_WRITE, (void *)data, sizeof(data), 16);
+	list[0] = &cbs[0];
+	zassert_ok(lio_listio(LIO_WAIT, list, 1, NULL));
+	zassert_equal(aio_return(&cbs[0]), sizeof(data));
+
+	/* Reads of the two halves, with a no-op in between */
+	aiocb_prep(&cbs[0], LIO_READ, buf[0], 5, 16);
+	aiocb_prep(&cbs[1], LIO_NOP, NULL, 0, 0);
+	aiocb_prep(&cbs[2], LIO_READ, buf[1], 5, 21);
+	list[1] = &cbs[1];
+	list[2] = &cbs[2];
+
+	k_sem_reset(&notify_sem);
+	sig.sigev_notify = SIGEV_THREAD;
+	sig.sigev_notify_function = notify;
+	sig.sigev_value.sival_ptr = &count;
+	zassert_ok(lio_listio(LIO_NOWAIT, list, 3, &sig));
+
+	zassert_ok(k_sem_take(&notify_sem, K_SECONDS(1)));
+	zassert_equal(count, 1);
+	zassert_ok(aio_error(&cbs[0]));
+	zassert_ok(aio_error(&cbs[2]));
+	zassert_mem_equal(buf[0], "01234", 5);
+	zassert_mem_equal(buf[1], "56789", 5);
+
+	zassert_equal(lio_listio(LIO_WAIT, list, AIO_LISTIO_MAX + 1, NULL), -1);
+	zassert_equal(errno, EINVAL);
+}
+
+ZTEST(aio, test_aio_cancel)
+{
+	struct aiocb cb;
+
+	/* Nothing in progress */
+	zassert_equal(aio_cancel(fd, NULL), AIO_ALLDONE);
+
+	aiocb_prep(&cb, LIO_NOP, NULL, 0, 0);
+	zassert_ok(aio_fsync(0, &cb));
+	aio_wait(&cb);
+	zassert_equal(aio_cancel(fd, &cb), AIO_ALLDONE);
+}
+
+static void *aio_setup(void)
+{
+	fd = shm_open(SHM_PATH, O_RDWR | O_CREAT, 0666);
+	zassert_true(fd >= 0, "shm_open() failed: %d", errno);
+	zassert_ok(ftruncate(fd, SHM_SIZE));
+
+	return NULL;
+}
+
+static void aio_teardown(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	zassert_ok(close(fd));
+	zassert_ok(shm_unlink(SHM_PATH));
+}
+
+ZTEST_SUITE(aio, NULL, aio_setup, NULL, NULL, aio_teardown);
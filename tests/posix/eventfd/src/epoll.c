@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "_main.h"
+
+#include <zephyr/zvfs/epoll.h>
+
+#define EPOLL_DATA 0x1ee7
+
+ZTEST_F(eventfd, test_epoll_level_triggered)
+{
+	struct zvfs_epoll_event ev = {
+		.events = ZVFS_EPOLLIN,
+		.data.u32 = EPOLL_DATA,
+	};
+	struct zvfs_epoll_event out[2];
+	eventfd_t val;
+	int epfd;
+
+	epfd = zvfs_epoll_create(0);
+	zassert_true(epfd >= 0, "zvfs_epoll_create() failed: %d", errno);
+
+	zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, fixture->fd, &ev));
+	zassert_equal(zvfs_epoll_wait(epfd, out, ARRAY_SIZE(out), 0), 0);
+
+	zassert_ok(eventfd_write(fixture->fd, TESTVAL));
+	zassert_equal(zvfs_epoll_wait(epfd, out, ARRAY_SIZE(out), 0), 1);
+	zassert_equal(out[0].events, ZVFS_EPOLLIN);
+	zassert_equal(out[0].data.u32, EPOLL_DATA);
+
+	/* Still reported while readable */
+	zassert_equal(zvfs_epoll_wait(epfd, out, ARRAY_SIZE(out), 0), 1);
+	zassert_equal(out[0].events, ZVFS_EPOLLIN);
+
+	zassert_ok(eventfd_read(fixture->fd, &val));
+	zassert_equal(zvfs_epoll_wait(epfd, out, ARRAY_SIZE(out), 0), 0);
+
+	zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_DEL, fixture->fd, NULL));
+	zassert_ok(eventfd_write(fixture->fd, TESTVAL));
+	zassert_equal(zvfs_epoll_wait(epfd, out, ARRAY_SIZE(out), 0), 0);
+
+	zassert_ok(close(epfd));
+}
+
+ZTEST_F(eventfd, test_epoll_edge_triggered)
+{
+	struct zvfs_epoll_event ev = {
+		.events = ZVFS_EPOLLIN | ZVFS_EPOLLET,
+		.data.u32 = EPOLL_DATA,
+	};
+	struct zvfs_epoll_event out[2];
+	eventfd_t val;
+	int epfd;
+
+	epfd = zvfs_epoll_create(0);
+	zassert_true(epfd >= 0, "zvfs_epoll_create() failed: %d", errno);
+
+	zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, fixture->fd, &ev));
+
+	zassert_ok(eventfd_write(fixture->fd, TESTVAL));
+	zassert_equal(zvfs_epoll_wait(epfd, out, ARRAY_SIZE(out), 0), 1);
+	zassert_equal(out[0].events, ZVFS_EPOLLIN);
+
+	/* Not reported again until written again */
+	zassert_equal(zvfs_epoll_wait(epfd, out, ARRAY_SIZE(out), 0), 0);
+	zassert_ok(eventfd_write(fixture->fd, TESTVAL));
+	zassert_equal(zvfs_epoll_wait(epfd, out, ARRAY_SIZE(out), 0), 1);
+	zassert_ok(eventfd_read(fixture->fd, &val));
+	zassert_equal(val, 2 * TESTVAL);
+
+	/* An eventfd can be written to right away */
+	ev.events = ZVFS_EPOLLOUT;
+	zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_MOD, fixture->fd, &ev));
+	zassert_equal(zvfs_epoll_wait(epfd, out, ARRAY_SIZE(out), 0), 1);
+	zassert_equal(out[0].events, ZVFS_EPOLLOUT);
+
+	zassert_ok(close(epfd));
+}
+
+ZTEST_F(eventfd, test_epoll_ctl_errors)
+{
+	struct zvfs_epoll_event ev = {
+		.events = ZVFS_EPOLLIN,
+	};
+	struct zvfs_epoll_event out;
+	int epfd;
+
+	epfd = zvfs_epoll_create(0);
+	zassert_true(epfd >= 0, "zvfs_epoll_create() failed: %d", errno);
+
+	zassert_equal(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_MOD, fixture->fd, &ev), -1);
+	zassert_equal(errno, ENOENT);
+	zassert_equal(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_DEL, fixture->fd, NULL), -1);
+	zassert_equal(errno, ENOENT);
+
+	zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, fixture->fd, &ev));
+	zassert_equal(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, fixture->fd, &ev), -1);
+	zassert_equal(errno, EEXIST);
+	zassert_equal(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, epfd, &ev), -1);
+	zassert_equal(errno, EINVAL);
+
+	zassert_equal(zvfs_epoll_wait(fixture->fd, &out, 1, 0), -1);
+	zassert_equal(errno, EBADF);
+	zassert_equal(zvfs_epoll_wait(epfd, &out, 0, 0), -1);
+	zassert_equal(errno, EINVAL);
+
+	zassert_ok(close(epfd));
+}
+
+ZTEST_F(eventfd, test_epoll_close_registered)
+{
+	struct zvfs_epoll_event ev = {
+		.events = ZVFS_EPOLLIN,
+		.data.u32 = EPOLL_DATA,
+	};
+	struct zvfs_epoll_event out;
+	int epfd;
+
+	epfd = zvfs_epoll_create(0);
+	zassert_true(epfd >= 0, "zvfs_epoll_create() failed: %d", errno);
+
+	/* Closing the eventfd removes it, its poll events must not be left
+	 * linked into the eventfd which is reused right away
+	 */
+	zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, fixture->fd, &ev));
+	reopen(&fixture->fd, 0, 0);
+
+	zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, fixture->fd, &ev));
+	zassert_equal(zvfs_epoll_wait(epfd, &out, 1, 0), 0);
+	zassert_ok(eventfd_write(fixture->fd, TESTVAL));
+	zassert_equal(zvfs_epoll_wait(epfd, &out, 1, 0), 1);
+	zassert_equal(out.events, ZVFS_EPOLLIN);
+
+	zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_DEL, fixture->fd, NULL));
+	zassert_ok(close(epfd));
+}
+
+K_THREAD_STACK_DEFINE(epoll_stack, CONFIG_TEST_STACK_SIZE);
+static struct k_thread epoll_thread;
+
+static void epoll_writer(void *arg1, void *arg2, void *arg3)
+{
+	struct eventfd_fixture *fixture = arg1;
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	zassert_ok(eventfd_write(fixture->fd, TESTVAL));
+}
+
+ZTEST_F(eventfd, test_epoll_wait_blocking)
+{
+	struct zvfs_epoll_event ev = {
+		.events = ZVFS_EPOLLIN,
+		.data.u32 = EPOLL_DATA,
+	};
+	struct zvfs_epoll_event out;
+	int epfd;
+
+	epfd = zvfs_epoll_create(0);
+	zassert_true(epfd >= 0, "zvfs_epoll_create() failed: %d", errno);
+	zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, fixture->fd, &ev));
+
+	zassert_equal(zvfs_epoll_wait(epfd, &out, 1, 50), 0);
+
+	k_thread_create(&epoll_thread, epoll_stack, K_THREAD_STACK_SIZEOF(epoll_stack),
+			epoll_writer, fixture, NULL, NULL, 0, 0, K_MSEC(100));
+
+	zassert_equal(zvfs_epoll_wait(epfd, &out, 1, -1), 1);
+	zassert_equal(out.events, ZVFS_EPOLLIN);
+	zassert_equal(out.data.u32, EPOLL_DATA);
+
+	k_thread_join(&epoll_thread, K_FOREVER);
+	zassert_ok(close(epfd));
+}
@@ -7,6 +7,7 @@
 #include <string.h>
 #include <fcntl.h>
 #include <zephyr/posix/unistd.h>
+#include <zephyr/posix/sys/mman.h>
 #include "test_fs.h"
 
 const char test_str[] = "hello world!";
@@ -302,3 +303,36 @@ ZTEST(posix_fs_file_test, test_fs_fd_leak)
 		}
 	}
 }
+
+/**
+ * @brief Test for POSIX mmap API on a file
+ *
+ * @details Test maps the file written through POSIX write API and checks
+ * that the mapping holds the file content, zero filled past the end of file.
+ */
+ZTEST(posix_fs_file_test, test_fs_mmap)
+{
+	size_t len = strlen(test_str);
+	char *addr;
+
+	if (!IS_ENABLED(CONFIG_POSIX_MAPPED_FILES) || !IS_ENABLED(CONFIG_MMU)) {
+		ztest_test_skip();
+	}
+
+	zassert_true(test_file_open() == TC_PASS);
+	zassert_true(test_file_write() == TC_PASS);
+
+	addr = mmap(NULL, len + 1, PROT_READ, MAP_PRIVATE, file, 0);
+	zassert_not_equal(addr, MAP_FAILED, "mmap failed, errno=%d", errno);
+	zassert_mem_equal(addr, test_str, len);
+	zassert_equal(addr[len], 0);
+
+	/* The file position is left unchanged */
+	zassert_equal(lseek(file, 0, SEEK_CUR), len);
+	zassert_ok(munmap(addr, len + 1));
+
+	zassert_equal(mmap(NULL, len, PROT_READ, MAP_PRIVATE, file, 1), MAP_FAILED);
+	zassert_equal(errno, EINVAL);
+	zassert_equal(mmap(NULL, len, PROT_WRITE, MAP_SHARED, file, 0), MAP_FAILED);
+	zassert_equal(errno, ENOTSUP);
+}
@@ -324,6 +324,42 @@ ZTEST(isotp_implementation, test_send_receive_single_block)
 	isotp_unbind(&recv_ctx);
 }
 
+#ifdef CONFIG_ISOTP_RX_USER_BUF
+ZTEST(isotp_implementation, test_send_receive_user_buf)
+{
+	static uint8_t user_buf[sizeof(random_data)];
+	struct net_buf *buf;
+	int ret, i;
+
+	ret = isotp_bind(&recv_ctx, can_dev, &rx_addr, &tx_addr, &fc_opts,
+			 K_NO_WAIT);
+	zassert_equal(ret, 0, "Binding failed (%d)", ret);
+
+	for (i = 0; i < NUMBER_OF_REPETITIONS; i++) {
+		memset(user_buf, 0, sizeof(user_buf));
+		isotp_set_recv_buf(&recv_ctx, user_buf, sizeof(user_buf));
+		send_test_data(can_dev, random_data, sizeof(random_data));
+
+		/* All the blocks are in the user buffer */
+		ret = isotp_recv_net(&recv_ctx, &buf, K_MSEC(1000));
+		zassert_equal(ret, 0, "recv returned %d", ret);
+		zassert_equal_ptr(buf->data, user_buf, "Not received in the user buffer");
+		zassert_is_null(buf->frags, "Data is fragmented");
+		zassert_equal(buf->len, sizeof(random_data), "Data length differ");
+		check_data(user_buf, random_data, sizeof(random_data));
+		net_buf_unref(buf);
+	}
+
+	/* The message does not fit, the sender gets an overflow */
+	isotp_set_recv_buf(&recv_ctx, user_buf, sizeof(user_buf) / 2);
+	ret = isotp_send(&send_ctx, can_dev, random_data, sizeof(random_data),
+			 &rx_addr, &tx_addr, NULL, NULL);
+	zassert_equal(ret, ISOTP_N_BUFFER_OVERFLW, "Send returned %d", ret);
+
+	isotp_unbind(&recv_ctx);
+}
+#endif /* CONFIG_ISOTP_RX_USER_BUF */
+
 ZTEST(isotp_implementation, test_bind_unbind)
 {
 	int ret, i;
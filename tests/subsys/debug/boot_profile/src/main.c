@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/debug/boot_profile.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define TEST_INIT_DELAY_US 2000
+
+static int test_sys_init(void)
+{
+	k_busy_wait(TEST_INIT_DELAY_US);
+
+	return -EALREADY;
+}
+
+SYS_INIT(test_sys_init, APPLICATION, 0);
+
+static const struct boot_profile_record *find_record(enum boot_profile_kind kind, uint8_t level,
+						     const void *fn)
+{
+	const struct boot_profile_record *recs;
+	size_t n = boot_profile_get(&recs);
+
+	for (size_t i = 0; i < n; i++) {
+		if (recs[i].kind == kind && recs[i].level == level &&
+		    (fn == NULL || (const void *)recs[i].entry->init_fn.sys == fn)) {
+			return &recs[i];
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Test that the init levels and main() are recorded in order
+ */
+ZTEST(boot_profile, test_levels)
+{
+	const struct boot_profile_record *main_rec = find_record(BOOT_PROFILE_MAIN, 0, NULL);
+	uint32_t prev_start = 0;
+	char buf[32];
+
+	zassert_not_null(main_rec);
+	zassert_str_equal(boot_profile_name(main_rec, buf, sizeof(buf)), "main");
+
+	for (int level = INIT_LEVEL_EARLY; level <= INIT_LEVEL_APPLICATION; level++) {
+		const struct boot_profile_record *rec = find_record(BOOT_PROFILE_LEVEL, level,
+								    NULL);
+
+		zassert_not_null(rec, "level %d not recorded", level);
+		zassert_true((int32_t)(rec->start - prev_start) >= 0 || level == INIT_LEVEL_EARLY);
+		zassert_true((int32_t)(main_rec->start - rec->end) >= 0);
+		prev_start = rec->start;
+	}
+}
+
+/**
+ * @brief Test that an init function is recorded with its duration and result
+ */
+ZTEST(boot_profile, test_sys_init_record)
+{
+	const struct boot_profile_record *rec =
+		find_record(BOOT_PROFILE_SYS_INIT, INIT_LEVEL_APPLICATION, test_sys_init);
+	const struct boot_profile_record *level_rec =
+		find_record(BOOT_PROFILE_LEVEL, INIT_LEVEL_APPLICATION, NULL);
+
+	zassert_not_null(rec);
+	zassert_equal(rec->result, -EALREADY);
+	zassert_true(k_cyc_to_us_floor32(rec->end - rec->start) >= TEST_INIT_DELAY_US);
+	zassert_true((int32_t)(rec->start - level_rec->start) >= 0);
+	zassert_true((int32_t)(level_rec->end - rec->end) >= 0);
+}
+
+ZTEST_SUITE(boot_profile, NULL, NULL, NULL, NULL, NULL);
@@ -9,6 +9,11 @@
 #include <zephyr/storage/flash_map.h>
 #include <zephyr/dfu/flash_img.h>
 
+#ifdef CONFIG_IMG_DELTA_UPDATE
+#include <zephyr/sys/byteorder.h>
+#include <mbedtls/sha256.h>
+#endif
+
 #define SLOT0_PARTITION		slot0_partition
 #define SLOT1_PARTITION		slot1_partition
 
@@ -165,4 +170,112 @@ ZTEST(img_util, test_check_flash)
 	flash_area_close(ctx.flash_area);
 }
 
+#ifdef CONFIG_IMG_DELTA_UPDATE
+static const uint8_t delta_source[] = "0123456789ABCDEF\nzzfedcba98765432??\n";
+static const uint8_t delta_target[] = "0123456789abcdef\nfedcba9876543210\n";
+
+/* Operations turning delta_source into delta_target */
+static const uint8_t delta_ops[] = {
+	FLASH_IMG_DELTA_OP_COPY, 10,
+	FLASH_IMG_DELTA_OP_ADD, 6, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	FLASH_IMG_DELTA_OP_COPY, 1,
+	FLASH_IMG_DELTA_OP_SEEK, 4, /* +2 zigzag encoded */
+	FLASH_IMG_DELTA_OP_COPY, 14,
+	FLASH_IMG_DELTA_OP_INSERT, 3, '1', '0', '\n',
+};
+
+static uint8_t delta_patch[FLASH_IMG_DELTA_HDR_SIZE + sizeof(delta_ops)];
+
+static int apply_delta_patch(size_t chunk)
+{
+	struct flash_img_delta_context delta;
+	struct flash_img_context ctx;
+	int ret;
+
+	ret = flash_img_init_id(&ctx, SLOT1_PARTITION_ID);
+	zassert_true(ret == 0, "Flash img init");
+	ret = flash_area_flatten(ctx.flash_area, 0, ctx.flash_area->fa_size);
+	zassert_true(ret == 0, "Flash erase failure (%d)", ret);
+
+	zassert_true(flash_img_delta_is_patch(delta_patch, sizeof(delta_patch)));
+	ret = flash_img_delta_init(&delta, &ctx, SLOT0_PARTITION_ID);
+	zassert_true(ret == 0, "Flash img delta init");
+
+	/* The patch may be split anywhere */
+	for (size_t off = 0; off < sizeof(delta_patch); off += chunk) {
+		size_t len = MIN(chunk, sizeof(delta_patch) - off);
+
+		ret = flash_img_delta_write(&delta, &delta_patch[off], len,
+					    off + len == sizeof(delta_patch));
+		if (ret != 0) {
+			if (off + len < sizeof(delta_patch)) {
+				(void)flash_img_delta_write(&delta, NULL, 0, true);
+			}
+			break;
+		}
+	}
+
+	return ret;
+}
+
+ZTEST(img_util, test_delta_patch)
+{
+	const size_t target_len = sizeof(delta_target) - 1;
+	uint8_t source_buf[64];
+	uint8_t readback[sizeof(delta_target) - 1];
+	const struct flash_area *fa;
+	int ret;
+
+	/* Source image in slot 0, padded to the flash write block size */
+	(void)memset(source_buf, 0xff, sizeof(source_buf));
+	memcpy(source_buf, delta_source, sizeof(delta_source) - 1);
+
+	ret = flash_area_open(SLOT0_PARTITION_ID, &fa);
+	zassert_true(ret == 0, "Flash area open");
+	ret = flash_area_flatten(fa, 0, fa->fa_size);
+	zassert_true(ret == 0, "Flash erase failure (%d)", ret);
+	ret = flash_area_write(fa, 0, source_buf, sizeof(source_buf));
+	zassert_true(ret == 0, "Flash write failure (%d)", ret);
+	flash_area_close(fa);
+
+	sys_put_le32(FLASH_IMG_DELTA_MAGIC, &delta_patch[0]);
+	sys_put_le32(sizeof(delta_source) - 1, &delta_patch[4]);
+	sys_put_le32(target_len, &delta_patch[8]);
+	sys_put_le32(0, &delta_patch[12]);
+	zassert_ok(mbedtls_sha256(delta_source, sizeof(delta_source) - 1, &delta_patch[16], 0));
+	zassert_ok(mbedtls_sha256(delta_target, target_len, &delta_patch[48], 0));
+	memcpy(&delta_patch[FLASH_IMG_DELTA_HDR_SIZE], delta_ops, sizeof(delta_ops));
+
+	for (size_t chunk = 1; chunk <= sizeof(delta_patch); chunk += 13) {
+		ret = apply_delta_patch(chunk);
+		zassert_true(ret == 0, "Delta patch in chunks of %zu failed (%d)", chunk, ret);
+
+		ret = flash_area_open(SLOT1_PARTITION_ID, &fa);
+		zassert_true(ret == 0, "Flash area open");
+		ret = flash_area_read(fa, 0, readback, sizeof(readback));
+		zassert_true(ret == 0, "Flash read failure (%d)", ret);
+		flash_area_close(fa);
+		zassert_mem_equal(readback, delta_target, target_len, "Wrong reconstructed image");
+	}
+
+	/* Corrupted difference data */
+	delta_patch[FLASH_IMG_DELTA_HDR_SIZE + 4] ^= 0x01;
+	ret = apply_delta_patch(sizeof(delta_patch));
+	zassert_equal(ret, -EILSEQ, "Corrupted patch not detected (%d)", ret);
+	delta_patch[FLASH_IMG_DELTA_HDR_SIZE + 4] ^= 0x01;
+
+	/* Patch against another source image */
+	delta_patch[16] ^= 0x01;
+	ret = apply_delta_patch(sizeof(delta_patch));
+	zassert_equal(ret, -EILSEQ, "Wrong source image not detected (%d)", ret);
+	delta_patch[16] ^= 0x01;
+
+	/* Truncated patch */
+	delta_patch[8]++;
+	ret = apply_delta_patch(sizeof(delta_patch));
+	zassert_equal(ret, -EINVAL, "Truncated patch not detected (%d)", ret);
+	delta_patch[8]--;
+}
+#endif
+
 ZTEST_SUITE(img_util, NULL, NULL, NULL, NULL, NULL);
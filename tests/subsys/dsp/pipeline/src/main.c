@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/dsp/pipeline.h>
+#include <zephyr/ztest.h>
+
+#define FRAME_SIZE	16
+#define NUM_TAPS	4
+#define FFT_LEN		32
+#define TOLERANCE	1e-5f
+
+/* Coefficients are in time reversed order, b0 = 1 makes the FIR a no-op */
+static const float32_t identity_coeffs[NUM_TAPS] = {0.0f, 0.0f, 0.0f, 1.0f};
+/* b0 b1 b2 a1 a2 */
+static const float32_t half_coeffs[5] = {0.5f, 0.0f, 0.0f, 0.0f, 0.0f};
+
+static float32_t fir_state[ZDSP_FIR_STATE_SIZE(NUM_TAPS, FRAME_SIZE)];
+static float32_t decimate_state[ZDSP_FIR_STATE_SIZE(NUM_TAPS, FRAME_SIZE)];
+static float32_t biquad_state[ZDSP_BIQUAD_STATE_SIZE(1)];
+
+static struct zdsp_gain_block gain;
+static struct zdsp_fir_block fir;
+static struct zdsp_decimate_block decimate;
+static struct zdsp_biquad_block biquad;
+static struct zdsp_rfft_block rfft;
+
+ZDSP_PIPELINE_DEFINE(chain, FRAME_SIZE, &gain.block, &fir.block, &decimate.block, &biquad.block);
+ZDSP_PIPELINE_DEFINE(spectrum, FFT_LEN, &rfft.block);
+
+static void *pipeline_setup(void)
+{
+	zdsp_gain_block_init(&gain, 2.0f);
+	zdsp_fir_block_init(&fir, identity_coeffs, NUM_TAPS, fir_state, FRAME_SIZE);
+	zassert_not_null(zdsp_decimate_block_init(&decimate, identity_coeffs, NUM_TAPS, 2,
+						  decimate_state, FRAME_SIZE));
+	zdsp_biquad_block_init(&biquad, half_coeffs, 1, biquad_state);
+	zassert_not_null(zdsp_rfft_block_init(&rfft, FFT_LEN));
+
+	return NULL;
+}
+
+ZTEST(zdsp_pipeline, test_pipeline_chain)
+{
+	float32_t frame[FRAME_SIZE];
+	float32_t *out;
+	int ret;
+
+	for (int i = 0; i < FRAME_SIZE; i++) {
+		frame[i] = (float32_t)i;
+	}
+
+	ret = zdsp_pipeline_process(&chain, frame, FRAME_SIZE, &out);
+	zassert_equal(ret, FRAME_SIZE / 2, "unexpected number of output samples: %d", ret);
+
+	/* Gain of 2, then decimated, then halved: the odd input samples */
+	for (int i = 0; i < ret; i++) {
+		zassert_within(out[i], (float32_t)(2 * i + 1), TOLERANCE, "sample %d is %f", i,
+			       (double)out[i]);
+	}
+}
+
+ZTEST(zdsp_pipeline, test_pipeline_errors)
+{
+	float32_t frame[FRAME_SIZE + 1] = {0};
+	float32_t *out;
+
+	zassert_equal(zdsp_pipeline_process(&chain, frame, FRAME_SIZE + 1, &out), -EINVAL,
+		      "frame larger than the pipeline was accepted");
+	zassert_equal(zdsp_pipeline_process(&chain, frame, FRAME_SIZE - 1, &out), -EINVAL,
+		      "frame not a multiple of the decimation factor was accepted");
+	zassert_equal(zdsp_pipeline_process(&spectrum, frame, FFT_LEN / 2, &out), -EINVAL,
+		      "frame shorter than the FFT was accepted");
+}
+
+ZTEST(zdsp_pipeline, test_pipeline_rfft)
+{
+	float32_t frame[FFT_LEN];
+	float32_t *out;
+	int ret;
+
+	for (int i = 0; i < FFT_LEN; i++) {
+		frame[i] = 1.0f;
+	}
+
+	ret = zdsp_pipeline_process(&spectrum, frame, FFT_LEN, &out);
+	zassert_equal(ret, FFT_LEN);
+
+	/* A constant signal only has a DC component */
+	zassert_within(out[0], (float32_t)FFT_LEN, TOLERANCE);
+	for (int i = 1; i < FFT_LEN; i++) {
+		zassert_within(out[i], 0.0f, TOLERANCE, "bin value %d is %f", i, (double)out[i]);
+	}
+}
+
+ZTEST_SUITE(zdsp_pipeline, NULL, pipeline_setup, NULL, NULL, NULL);
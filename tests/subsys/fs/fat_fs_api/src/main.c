@@ -22,6 +22,9 @@ static void *fat_fs_basic_setup(void)
 #ifdef CONFIG_FS_FATFS_REENTRANT
 	test_fat_file_reentrant();
 #endif /* CONFIG_FS_FATFS_REENTRANT */
+#ifdef CONFIG_FS_FATFS_FASTSEEK
+	test_fat_fastseek();
+#endif /* CONFIG_FS_FATFS_FASTSEEK */
 	test_fat_unmount();
 
 	return NULL;
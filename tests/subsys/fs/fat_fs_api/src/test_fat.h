@@ -49,3 +49,6 @@ void test_fat_rename(void);
 #ifdef CONFIG_FS_FATFS_REENTRANT
 void test_fat_file_reentrant(void);
 #endif /* CONFIG_FS_FATFS_REENTRANT */
+#ifdef CONFIG_FS_FATFS_FASTSEEK
+void test_fat_fastseek(void);
+#endif /* CONFIG_FS_FATFS_FASTSEEK */
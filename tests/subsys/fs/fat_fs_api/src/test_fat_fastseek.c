@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_fat.h"
+
+#define TEST_FASTSEEK_FILE FATFS_MNTP"/fastseek.bin"
+#define BLOCK_SIZE 256
+#define BLOCK_COUNT 64
+
+static uint8_t block[BLOCK_SIZE];
+
+static void fill_block(uint32_t n)
+{
+	for (size_t i = 0; i < sizeof(block); i++) {
+		block[i] = (uint8_t)(n + i);
+	}
+}
+
+static void write_blocks(struct fs_file_t *zfp, uint32_t first, uint32_t count)
+{
+	for (uint32_t n = first; n < first + count; n++) {
+		fill_block(n);
+		zassert_equal(fs_write(zfp, block, sizeof(block)), sizeof(block),
+			      "write of block %u failed", n);
+	}
+}
+
+static void check_block(struct fs_file_t *zfp, uint32_t n)
+{
+	uint8_t buf[BLOCK_SIZE];
+
+	zassert_ok(fs_seek(zfp, n * BLOCK_SIZE, FS_SEEK_SET));
+	zassert_equal(fs_read(zfp, buf, sizeof(buf)), sizeof(buf));
+	fill_block(n);
+	zassert_mem_equal(buf, block, sizeof(block), "block %u mismatch", n);
+}
+
+void test_fat_fastseek(void)
+{
+	struct fs_file_t file;
+	uint32_t n;
+
+	TC_PRINT("\nFast seek tests:\n");
+
+	fs_file_t_init(&file);
+	zassert_ok(fs_open(&file, TEST_FASTSEEK_FILE,
+			   FS_O_CREATE | FS_O_RDWR | FS_O_TRUNC | FS_O_FASTSEEK));
+	write_blocks(&file, 0, BLOCK_COUNT);
+
+	/* The first seek builds the table */
+	check_block(&file, BLOCK_COUNT - 1);
+	zassert_not_null(((FIL *)file.filep)->cltbl, "no fast seek table");
+
+	for (n = 0; n < BLOCK_COUNT; n++) {
+		check_block(&file, (n * 37) % BLOCK_COUNT);
+	}
+
+	/* Growing the file drops the table, the next seek rebuilds it */
+	zassert_ok(fs_seek(&file, 0, FS_SEEK_END));
+	write_blocks(&file, BLOCK_COUNT, BLOCK_COUNT);
+	zassert_is_null(((FIL *)file.filep)->cltbl);
+	check_block(&file, 2 * BLOCK_COUNT - 1);
+	zassert_not_null(((FIL *)file.filep)->cltbl);
+	check_block(&file, BLOCK_COUNT / 2);
+
+	zassert_ok(fs_truncate(&file, BLOCK_COUNT * BLOCK_SIZE));
+	check_block(&file, BLOCK_COUNT - 1);
+	zassert_equal(fs_seek(&file, BLOCK_COUNT * BLOCK_SIZE + 1, FS_SEEK_SET), -EINVAL);
+
+	zassert_ok(fs_close(&file));
+
+	/* Reopening without the flag reads the same data by following the chain */
+	zassert_ok(fs_open(&file, TEST_FASTSEEK_FILE, FS_O_READ));
+	check_block(&file, BLOCK_COUNT / 3);
+	zassert_is_null(((FIL *)file.filep)->cltbl);
+	zassert_ok(fs_close(&file));
+
+	zassert_ok(fs_unlink(TEST_FASTSEEK_FILE));
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "fcb_test.h"
+
+#define BATCH_ENTRIES 32
+
+static uint8_t batch_buf[1024];
+
+static void test_fcb_batch(struct fcb *_fcb)
+{
+	struct fcb_batch batch;
+	struct fcb_entry loc;
+	uint8_t test_data[128];
+	int var_cnt;
+	int rc;
+	int i;
+	int j;
+
+	fcb_batch_init(&batch, batch_buf, sizeof(batch_buf));
+
+	/* An empty batch is a no-op */
+	rc = fcb_batch_append(_fcb, &batch);
+	zassert_true(rc == 0, "fcb_batch_append call failure");
+	zassert_true(fcb_is_empty(_fcb), "empty batch was written");
+
+	for (i = 0; i < BATCH_ENTRIES; i++) {
+		for (j = 0; j < i; j++) {
+			test_data[j] = fcb_test_append_data(i, j);
+		}
+		rc = fcb_batch_add(_fcb, &batch, test_data, i);
+		zassert_true(rc == 0, "fcb_batch_add call failure");
+
+		/* Flush the batch every few entries */
+		if ((i % 10) == 9) {
+			rc = fcb_batch_append(_fcb, &batch);
+			zassert_true(rc == 0, "fcb_batch_append call failure");
+			zassert_equal(batch.fb_cnt, 0, "batch not emptied");
+		}
+	}
+	zassert_equal(batch.fb_cnt, BATCH_ENTRIES % 10, "wrong count of entries in batch");
+	rc = fcb_batch_append(_fcb, &batch);
+	zassert_true(rc == 0, "fcb_batch_append call failure");
+
+	/* Entries appended one by one follow the batched ones */
+	for (; i < sizeof(test_data); i++) {
+		for (j = 0; j < i; j++) {
+			test_data[j] = fcb_test_append_data(i, j);
+		}
+		rc = fcb_append(_fcb, i, &loc);
+		zassert_true(rc == 0, "fcb_append call failure");
+		rc = flash_area_write(_fcb->fap, FCB_ENTRY_FA_DATA_OFF(loc),
+				      test_data, i);
+		zassert_true(rc == 0, "flash_area_write call failure");
+		rc = fcb_append_finish(_fcb, &loc);
+		zassert_true(rc == 0, "fcb_append_finish call failure");
+	}
+
+	var_cnt = 0;
+	rc = fcb_walk(_fcb, 0, fcb_test_data_walk_cb, &var_cnt);
+	zassert_true(rc == 0, "fcb_walk call failure");
+	zassert_true(var_cnt == sizeof(test_data),
+		     "fetched data size not match to wrote data size");
+
+	/* Entries which do not fit are rejected, the batch is left intact */
+	fcb_batch_init(&batch, batch_buf, 64);
+	rc = fcb_batch_add(_fcb, &batch, test_data, 8);
+	zassert_true(rc == 0, "fcb_batch_add call failure");
+	rc = fcb_batch_add(_fcb, &batch, test_data, 64);
+	zassert_equal(rc, -ENOMEM, "fcb_batch_add accepted entry too big");
+	zassert_equal(batch.fb_cnt, 1, "wrong count of entries in batch");
+}
+
+ZTEST(fcb_test_with_2sectors_set, test_fcb_batch_2sectors)
+{
+	test_fcb_batch(&test_fcb);
+}
+
+ZTEST(fcb_test_crc_disabled, test_fcb_batch_crc_disabled)
+{
+	test_fcb_batch(&test_fcb_crc_disabled);
+}
+
+#ifdef CONFIG_FCB_INDEX
+ZTEST(fcb_test_with_4sectors_set, test_fcb_index)
+{
+	uint32_t index[4];
+	struct fcb_entry loc;
+	uint8_t test_data[128];
+	int var_cnt;
+	int rc;
+	int i;
+	int j;
+
+	test_fcb.f_index = index;
+	rc = fcb_init(TEST_FCB_FLASH_AREA_ID, &test_fcb);
+	zassert_true(rc == 0, "fcb_init call failure");
+
+	for (i = 0; i < sizeof(test_data); i++) {
+		for (j = 0; j < i; j++) {
+			test_data[j] = fcb_test_append_data(i, j);
+		}
+		rc = fcb_append(&test_fcb, i, &loc);
+		zassert_true(rc == 0, "fcb_append call failure");
+		rc = flash_area_write(test_fcb.fap, FCB_ENTRY_FA_DATA_OFF(loc),
+				      test_data, i);
+		zassert_true(rc == 0, "flash_area_write call failure");
+		rc = fcb_append_finish(&test_fcb, &loc);
+		zassert_true(rc == 0, "fcb_append_finish call failure");
+	}
+
+	/* The first walk verifies all the entries */
+	var_cnt = 0;
+	rc = fcb_walk(&test_fcb, 0, fcb_test_data_walk_cb, &var_cnt);
+	zassert_true(rc == 0, "fcb_walk call failure");
+	zassert_true(var_cnt == sizeof(test_data),
+		     "fetched data size not match to wrote data size");
+	zassert_equal(index[test_fcb.f_active.fe_sector - test_fcb_sector],
+		      test_fcb.f_active.fe_elem_off, "entries not all verified");
+
+	/* The next ones rely on the index and find the same entries */
+	var_cnt = 0;
+	rc = fcb_walk(&test_fcb, 0, fcb_test_data_walk_cb, &var_cnt);
+	zassert_true(rc == 0, "fcb_walk call failure");
+	zassert_true(var_cnt == sizeof(test_data),
+		     "fetched data size not match to wrote data size");
+
+	/* Reusing a sector forgets about its previous entries */
+	rc = fcb_clear(&test_fcb);
+	zassert_true(rc == 0, "fcb_clear call failure");
+	zassert_equal(index[test_fcb.f_active.fe_sector - test_fcb_sector],
+		      test_fcb.f_active.fe_elem_off, "index not reset");
+
+	test_fcb.f_index = NULL;
+}
+#endif /* CONFIG_FCB_INDEX */
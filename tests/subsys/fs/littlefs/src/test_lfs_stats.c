@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* littlefs block device statistics and heap lookahead buffers */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include "testfs_tests.h"
+#include "testfs_lfs.h"
+#include <lfs.h>
+
+#include <zephyr/fs/littlefs.h>
+
+#define HEAP_LOOKAHEAD_SIZE 256
+
+#if defined(CONFIG_FS_LITTLEFS_STATS) || (CONFIG_FS_LITTLEFS_LOOKAHEAD_HEAP_SIZE > 0)
+static const char data[] = "littlefs statistics";
+
+static void write_file(struct fs_mount_t *mp)
+{
+	struct testfs_path path;
+	struct fs_file_t file;
+
+	testfs_path_init(&path, mp, "stats", TESTFS_PATH_END);
+	fs_file_t_init(&file);
+
+	zassert_ok(fs_open(&file, path.path, FS_O_CREATE | FS_O_RDWR));
+	zassert_equal(fs_write(&file, data, sizeof(data)), sizeof(data));
+	zassert_ok(fs_close(&file));
+}
+
+static void read_file(struct fs_mount_t *mp)
+{
+	struct testfs_path path;
+	struct fs_file_t file;
+	char buf[sizeof(data)];
+
+	testfs_path_init(&path, mp, "stats", TESTFS_PATH_END);
+	fs_file_t_init(&file);
+
+	zassert_ok(fs_open(&file, path.path, FS_O_READ));
+	zassert_equal(fs_read(&file, buf, sizeof(buf)), sizeof(buf));
+	zassert_mem_equal(buf, data, sizeof(data));
+	zassert_ok(fs_close(&file));
+}
+#endif
+
+#ifdef CONFIG_FS_LITTLEFS_STATS
+ZTEST(littlefs, test_lfs_stats)
+{
+	struct fs_mount_t *mp = &testfs_small_mnt;
+	struct fs_littlefs *fs = mp->fs_data;
+	uint32_t reads, progs;
+
+	zassert_equal(testfs_lfs_wipe_partition(mp), TC_PASS);
+	zassert_ok(fs_mount(mp));
+	zassert_equal_ptr(stats_group_find(mp->mnt_point), &fs->stats.s_hdr,
+			  "stats not registered under the mount point");
+
+	TC_PRINT("format and mount: %u reads, %u progs, %u erases\n",
+		 fs->stats.reads, fs->stats.progs, fs->stats.erases);
+	zassert_true(fs->stats.erases > 0, "format did not erase");
+
+	progs = fs->stats.progs;
+	write_file(mp);
+	zassert_true(fs->stats.progs > progs, "write did not program");
+	zassert_true(fs->stats.prog_bytes >= sizeof(data));
+
+	zassert_ok(fs_unmount(mp));
+	zassert_ok(fs_mount(mp));
+
+	reads = fs->stats.reads;
+	read_file(mp);
+	zassert_true(fs->stats.reads > reads, "read did not read");
+	TC_PRINT("total: %u reads (%u bytes), %u progs (%u bytes), %u erases\n",
+		 fs->stats.reads, fs->stats.read_bytes, fs->stats.progs,
+		 fs->stats.prog_bytes, fs->stats.erases);
+
+	zassert_ok(fs_unmount(mp));
+}
+#endif /* CONFIG_FS_LITTLEFS_STATS */
+
+#if CONFIG_FS_LITTLEFS_LOOKAHEAD_HEAP_SIZE > 0
+static uint8_t heap_read_buffer[CONFIG_FS_LITTLEFS_CACHE_SIZE];
+static uint8_t heap_prog_buffer[CONFIG_FS_LITTLEFS_CACHE_SIZE];
+static struct fs_littlefs heap_lookahead = {
+	.cfg = {
+		.lookahead_size = HEAP_LOOKAHEAD_SIZE,
+		.read_buffer = heap_read_buffer,
+		.prog_buffer = heap_prog_buffer,
+	},
+};
+
+ZTEST(littlefs, test_lfs_lookahead_heap)
+{
+	struct fs_mount_t mnt = {
+		.type = FS_LITTLEFS,
+		.fs_data = &heap_lookahead,
+		.storage_dev = testfs_small_mnt.storage_dev,
+		.mnt_point = TESTFS_MNT_POINT_SMALL,
+	};
+
+	zassert_equal(testfs_lfs_wipe_partition(&mnt), TC_PASS);
+	zassert_ok(fs_mount(&mnt));
+	zassert_not_null(heap_lookahead.cfg.lookahead_buffer);
+	zassert_equal(heap_lookahead.cfg.lookahead_size, HEAP_LOOKAHEAD_SIZE);
+
+	write_file(&mnt);
+	read_file(&mnt);
+
+	zassert_ok(fs_unmount(&mnt));
+	zassert_is_null(heap_lookahead.cfg.lookahead_buffer,
+			"lookahead buffer not released");
+
+	/* The buffer is allocated again at the next mount */
+	zassert_ok(fs_mount(&mnt));
+	read_file(&mnt);
+	zassert_ok(fs_unmount(&mnt));
+}
+#endif /* CONFIG_FS_LITTLEFS_LOOKAHEAD_HEAP_SIZE > 0 */
@@ -97,7 +97,15 @@ static void after(void *data)
 	fixture->fs.sector_count = TEST_SECTOR_COUNT;
 }
 
-ZTEST_SUITE(nvs, NULL, setup, before, after, NULL);
+/* The sector layout checks of this suite assume that gc only runs from nvs_write */
+static bool nvs_predicate(const void *global_state)
+{
+	ARG_UNUSED(global_state);
+
+	return !IS_ENABLED(CONFIG_NVS_BACKGROUND_GC);
+}
+
+ZTEST_SUITE(nvs, nvs_predicate, setup, before, after, NULL);
 
 ZTEST_F(nvs, test_nvs_mount)
 {
@@ -959,3 +967,120 @@ ZTEST_F(nvs, test_nvs_cache_hash_quality)
 
 #endif
 }
+
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+static int flash_sim_read_calls_find(struct stats_hdr *hdr, void *arg,
+				     const char *name, uint16_t off)
+{
+	if (!strcmp(name, "flash_read_calls")) {
+		uint32_t **flash_read_stat = (uint32_t **) arg;
+		*flash_read_stat = (uint32_t *)((uint8_t *)hdr + off);
+	}
+
+	return 0;
+}
+#endif
+
+/*
+ * Test that with the complete lookup index a read only needs the ATE and the
+ * data of the entry, and report the cost of the mount scan building it.
+ */
+ZTEST_F(nvs, test_nvs_index_read)
+{
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	int err;
+	uint16_t id, data;
+	uint32_t *flash_read_stat;
+	uint32_t reads, start, mount_us;
+	ssize_t len;
+
+	fixture->fs.sector_count = 3;
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	for (id = 0; id < CONFIG_NVS_LOOKUP_CACHE_SIZE; id++) {
+		data = id;
+		err = nvs_write(&fixture->fs, id, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "nvs_write call failure: %d", err);
+	}
+
+	start = k_cycle_get_32();
+	err = nvs_mount(&fixture->fs);
+	mount_us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+	TC_PRINT("Mount with %u entries: %u us\n", CONFIG_NVS_LOOKUP_CACHE_SIZE, mount_us);
+
+	stats_walk(fixture->sim_stats, flash_sim_read_calls_find, &flash_read_stat);
+
+	for (id = 0; id < CONFIG_NVS_LOOKUP_CACHE_SIZE; id++) {
+		reads = *flash_read_stat;
+		len = nvs_read(&fixture->fs, id, &data, sizeof(data));
+		zassert_equal(len, sizeof(data), "nvs_read call failure: %d", len);
+		zassert_equal(data, id, "incorrect data read");
+		zassert_equal(*flash_read_stat - reads, 2,
+			      "read of #%d took %u flash reads", id, *flash_read_stat - reads);
+	}
+
+	/* a missing id is known without reading the flash */
+	reads = *flash_read_stat;
+	len = nvs_read(&fixture->fs, CONFIG_NVS_LOOKUP_CACHE_SIZE + 1, &data, sizeof(data));
+	zassert_equal(len, -ENOENT, "nvs_read should not find the entry: %d", len);
+	zassert_equal(*flash_read_stat, reads, "flash read for a missing id");
+#endif
+}
+
+#ifdef CONFIG_NVS_BACKGROUND_GC
+ZTEST_SUITE(nvs_background_gc, NULL, setup, before, after, NULL);
+
+/*
+ * Test that the sector is rotated by the background gc once the free space
+ * drops below the threshold, without waiting for a write that does not fit.
+ */
+ZTEST_F(nvs_background_gc, test_nvs_background_gc)
+{
+	int err;
+	ssize_t len;
+	uint8_t buf[32];
+	uint16_t id = 0;
+	uint32_t sector;
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	sector = fixture->fs.ate_wra >> ADDR_SECT_SHIFT;
+
+	while ((fixture->fs.ate_wra >> ADDR_SECT_SHIFT) == sector) {
+		/* a write that does not fit would rotate the sector itself */
+		zassert_true((fixture->fs.ate_wra - fixture->fs.data_wra) >=
+			     (sizeof(buf) + 2 * sizeof(struct nvs_ate)),
+			     "sector not rotated by the background gc");
+
+		memset(buf, id, sizeof(buf));
+		len = nvs_write(&fixture->fs, id, buf, sizeof(buf));
+		zassert_true(len == sizeof(buf), "nvs_write failed: %d", len);
+		id++;
+		/* let the work queue run */
+		k_msleep(1);
+	}
+
+	zassert_true((fixture->fs.ate_wra - fixture->fs.data_wra) >=
+		     CONFIG_NVS_BACKGROUND_GC_THRESHOLD,
+		     "no free space after the background gc");
+
+	for (uint16_t i = 0; i < id; i++) {
+		uint8_t rd_buf[sizeof(buf)];
+
+		memset(buf, i, sizeof(buf));
+		len = nvs_read(&fixture->fs, i, rd_buf, sizeof(rd_buf));
+		zassert_true(len == sizeof(rd_buf), "nvs_read #%d failed: %d", i, len);
+		zassert_mem_equal(rd_buf, buf, sizeof(buf), "incorrect data for #%d", i);
+	}
+
+	/* the entries survive a remount */
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	len = nvs_read(&fixture->fs, 0, buf, sizeof(buf));
+	zassert_true(len == sizeof(buf), "nvs_read failed: %d", len);
+}
+#endif /* CONFIG_NVS_BACKGROUND_GC */
@@ -12,7 +12,78 @@ static const struct device fake_dev;
 static int message_count_filtered;
 static int message_count_unfiltered;
 
-#if CONFIG_INPUT_MODE_THREAD
+#if CONFIG_INPUT_FRAME_BATCHING
+
+static const struct device other_dev;
+static struct input_event frame_events[4];
+static K_SEM_DEFINE(frame_done, 0, 1);
+
+static void input_cb_filtered(struct input_event *evt)
+{
+	if (evt->dev == &fake_dev) {
+		message_count_filtered++;
+	}
+}
+INPUT_CALLBACK_DEFINE(&fake_dev, input_cb_filtered);
+
+static void input_cb_unfiltered(struct input_event *evt)
+{
+	if (message_count_unfiltered < ARRAY_SIZE(frame_events)) {
+		frame_events[message_count_unfiltered] = *evt;
+	}
+
+	message_count_unfiltered++;
+
+	if (evt->sync) {
+		k_sem_give(&frame_done);
+	}
+}
+INPUT_CALLBACK_DEFINE(NULL, input_cb_unfiltered);
+
+ZTEST(input_api, test_frame_batching)
+{
+	int ret;
+
+	message_count_filtered = 0;
+	message_count_unfiltered = 0;
+
+	ret = input_report_abs(&fake_dev, INPUT_ABS_X, 10, false, K_FOREVER);
+	zassert_equal(ret, 0, "ret: %d", ret);
+	ret = input_report_abs(&fake_dev, INPUT_ABS_Y, 20, false, K_FOREVER);
+	zassert_equal(ret, 0, "ret: %d", ret);
+
+	/* the frame is held until it is synced */
+	k_sleep(K_MSEC(10));
+	zassert_false(input_queue_empty());
+	zassert_equal(message_count_unfiltered, 0);
+
+	ret = input_report_key(&fake_dev, INPUT_BTN_TOUCH, 1, true, K_FOREVER);
+	zassert_equal(ret, 0, "ret: %d", ret);
+
+	zassert_equal(k_sem_take(&frame_done, K_SECONDS(1)), 0);
+
+	zassert_equal(message_count_unfiltered, 3);
+	zassert_equal(message_count_filtered, 3);
+	zassert_equal(frame_events[0].code, INPUT_ABS_X);
+	zassert_equal(frame_events[0].value, 10);
+	zassert_equal(frame_events[1].code, INPUT_ABS_Y);
+	zassert_equal(frame_events[1].value, 20);
+	zassert_equal(frame_events[2].code, INPUT_BTN_TOUCH);
+	zassert_true(frame_events[2].sync);
+	zassert_true(input_queue_empty());
+
+	/* frames of other devices skip the filtered callback */
+	ret = input_report_key(&other_dev, INPUT_KEY_A, 1, true, K_FOREVER);
+	zassert_equal(ret, 0, "ret: %d", ret);
+
+	zassert_equal(k_sem_take(&frame_done, K_SECONDS(1)), 0);
+
+	zassert_equal(message_count_unfiltered, 4);
+	zassert_equal(message_count_filtered, 3);
+	zassert_equal_ptr(frame_events[3].dev, &other_dev);
+}
+
+#elif CONFIG_INPUT_MODE_THREAD
 
 static K_SEM_DEFINE(cb_start, 1, 1);
 static K_SEM_DEFINE(cb_done, 1, 1);
@@ -79,4 +79,55 @@ ZTEST(ipc_service, test_ipc_service)
 	zassert_equal(ret, -ENOENT, "ipc_service_send() should return -ENOENT");
 }
 
+static int batch_received;
+
+static void batch_received_cb(const void *data, size_t len, void *priv)
+{
+	uint8_t *msg = (uint8_t *) data;
+
+	zassert_equal(*msg, 20, "msg doesn't match the expected value");
+
+	batch_received++;
+}
+
+static struct ipc_ept_cfg batch_ept_cfg = {
+	.name = "test_batch_ept",
+	.cb = {
+		.received = batch_received_cb,
+	},
+};
+
+ZTEST(ipc_service, test_ipc_service_send_batch)
+{
+	const struct device *dev_10;
+	struct ipc_ept ept_10;
+	uint8_t msg[3] = { 10, 10, 10 };
+	struct ipc_service_msg msgs[] = {
+		{ .data = &msg[0], .len = sizeof(msg[0]) },
+		{ .data = &msg[1], .len = sizeof(msg[1]) },
+		{ .data = &msg[2], .len = sizeof(msg[2]) },
+	};
+	int ret;
+
+	dev_10 = DEVICE_DT_GET(DT_NODELABEL(ipc10));
+
+	ret = ipc_service_register_endpoint(dev_10, &ept_10, &batch_ept_cfg);
+	zassert_ok(ret, "ipc_service_register_endpoint() failed");
+
+	/* The test backend has no batch hook, messages are sent one by one */
+	batch_received = 0;
+	ret = ipc_service_send_batch(&ept_10, msgs, ARRAY_SIZE(msgs));
+	zassert_equal(ret, ARRAY_SIZE(msgs), "ipc_service_send_batch() failed");
+	zassert_equal(batch_received, ARRAY_SIZE(msgs), "not all messages received");
+
+	ret = ipc_service_send_batch(&ept_10, msgs, 0);
+	zassert_equal(ret, -EINVAL, "empty batch should return -EINVAL");
+
+	ret = ipc_service_deregister_endpoint(&ept_10);
+	zassert_ok(ret, "ipc_service_deregister_endpoint() failed");
+
+	ret = ipc_service_send_batch(&ept_10, msgs, ARRAY_SIZE(msgs));
+	zassert_equal(ret, -ENOENT, "ipc_service_send_batch() should return -ENOENT");
+}
+
 ZTEST_SUITE(ipc_service, NULL, NULL, NULL, NULL, NULL);
@@ -348,4 +348,32 @@ ZTEST(llext, test_ext_syscall_fail)
 			"ext_syscall_fail should be NULL");
 }
 
+#ifndef CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID
+/*
+ * Ensure that every exported symbol is found by name, whatever the order of
+ * the built-in symbol table, and report the average time of a lookup.
+ */
+ZTEST(llext, test_find_all_builtin_syms)
+{
+	uint32_t cycles = 0;
+	size_t count = 0;
+	uint32_t start;
+
+	STRUCT_SECTION_FOREACH(llext_const_symbol, sym) {
+		start = k_cycle_get_32();
+		const void *addr = llext_find_sym(NULL, sym->name);
+
+		cycles += k_cycle_get_32() - start;
+		count++;
+
+		zassert_equal(addr, sym->addr, "wrong address for %s", sym->name);
+	}
+
+	zassert_is_null(llext_find_sym(NULL, "not_an_exported_symbol"));
+
+	TC_PRINT("%zu built-in symbols, %u cycles per lookup\n", count,
+		 count > 0 ? (uint32_t)(cycles / count) : 0U);
+}
+#endif
+
 ZTEST_SUITE(llext, NULL, NULL, NULL, NULL, NULL);
@@ -697,6 +697,49 @@ ZTEST(test_log_api, test_log_panic)
 	process_and_validate(false, true);
 }
 
+static void log_ratelimited(void)
+{
+	LOG_WRN_RATELIMIT("test");
+}
+
+/* Test checks that a rate limited call site logs a burst of messages per
+ * interval and reports the suppressed ones with the next logged message.
+ */
+ZTEST(test_log_api, test_log_ratelimit)
+{
+	log_timestamp_t exp_timestamp = TIMESTAMP_INIT_VAL;
+
+	log_setup(false);
+
+	for (int i = 0; i < CONFIG_LOG_RATELIMIT_BURST; i++) {
+		mock_log_frontend_record(LOG_CURRENT_MODULE_ID(), LOG_LEVEL_WRN, "test");
+		mock_log_backend_record(&backend1, LOG_CURRENT_MODULE_ID(),
+					Z_LOG_LOCAL_DOMAIN_ID, LOG_LEVEL_WRN,
+					exp_timestamp++, "test");
+	}
+
+	for (int i = 0; i < CONFIG_LOG_RATELIMIT_BURST + 3; i++) {
+		log_ratelimited();
+	}
+
+	process_and_validate(false, false);
+
+	k_msleep(CONFIG_LOG_RATELIMIT_INTERVAL_MS);
+
+	mock_log_frontend_record(LOG_CURRENT_MODULE_ID(), LOG_LEVEL_WRN,
+				 "Last message repeated 3 times");
+	mock_log_backend_record(&backend1, LOG_CURRENT_MODULE_ID(),
+				Z_LOG_LOCAL_DOMAIN_ID, LOG_LEVEL_WRN,
+				exp_timestamp++, "Last message repeated 3 times");
+	mock_log_frontend_record(LOG_CURRENT_MODULE_ID(), LOG_LEVEL_WRN, "test");
+	mock_log_backend_record(&backend1, LOG_CURRENT_MODULE_ID(),
+				Z_LOG_LOCAL_DOMAIN_ID, LOG_LEVEL_WRN,
+				exp_timestamp++, "test");
+	log_ratelimited();
+
+	process_and_validate(false, false);
+}
+
 ZTEST(test_log_api, test_log_printk)
 {
 	if (!IS_ENABLED(CONFIG_LOG_PRINTK)) {
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend_ram.h>
+
+LOG_MODULE_REGISTER(test, LOG_LEVEL_DBG);
+
+#define NUM_MSGS 10
+
+static char data[CONFIG_LOG_BACKEND_RAM_SIZE + 1];
+
+static size_t count_lines(const char *str, size_t len)
+{
+	size_t lines = 0;
+
+	for (size_t i = 0; i < len; i++) {
+		if (str[i] == '\n') {
+			lines++;
+		}
+	}
+
+	return lines;
+}
+
+ZTEST(log_backend_ram, test_read)
+{
+	size_t len;
+
+	LOG_INF("hello %d", 1);
+	zassert_true(log_backend_ram_pending() > 0);
+
+	/* Data may be read in chunks of any size */
+	len = log_backend_ram_read((uint8_t *)data, 4);
+	zassert_equal(len, 4);
+	len += log_backend_ram_read((uint8_t *)&data[len], sizeof(data) - 1 - len);
+	data[len] = '\0';
+
+	zassert_not_null(strstr(data, "<inf> test: hello 1"), "got \"%s\"", data);
+	zassert_equal(data[len - 1], '\n');
+	zassert_equal(log_backend_ram_pending(), 0);
+	zassert_equal(log_backend_ram_read((uint8_t *)data, sizeof(data)), 0);
+}
+
+ZTEST(log_backend_ram, test_overflow)
+{
+	uint32_t dropped;
+	size_t len;
+
+	for (int i = 0; i < NUM_MSGS; i++) {
+		LOG_INF("message %d", i);
+	}
+
+	/* Messages that do not fit are dropped whole */
+	dropped = log_backend_ram_dropped_get();
+	zassert_true(dropped > 0);
+	zassert_equal(log_backend_ram_dropped_get(), 0);
+
+	len = log_backend_ram_read((uint8_t *)data, sizeof(data) - 1);
+	data[len] = '\0';
+
+	zassert_equal(count_lines(data, len), NUM_MSGS - dropped, "got \"%s\"", data);
+	zassert_not_null(strstr(data, "message 0"));
+	zassert_equal(data[len - 1], '\n');
+}
+
+ZTEST(log_backend_ram, test_clear)
+{
+	LOG_INF("hello %d", 2);
+	zassert_true(log_backend_ram_pending() > 0);
+
+	log_backend_ram_clear();
+	zassert_equal(log_backend_ram_pending(), 0);
+}
+
+static void before(void *unused)
+{
+	ARG_UNUSED(unused);
+
+	log_backend_ram_clear();
+	(void)log_backend_ram_dropped_get();
+}
+
+ZTEST_SUITE(log_backend_ram, NULL, NULL, before, NULL, NULL);
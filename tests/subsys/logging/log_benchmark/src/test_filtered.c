@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/tc_util.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/logging/log.h>
+#include "test_helpers.h"
+
+/* Debug messages are compiled in and rejected by the runtime filter. */
+LOG_MODULE_REGISTER(test_filtered, LOG_LEVEL_DBG);
+
+#define FILTERED_REPEAT 1000
+
+ZTEST(test_log_benchmark, test_log_runtime_filtered_out)
+{
+	if (!IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING)) {
+		ztest_test_skip();
+	}
+
+	int source_id = log_source_id_get(STRINGIFY(test_filtered));
+
+	zassert_true(source_id >= 0);
+	log_filter_set(NULL, Z_LOG_LOCAL_DOMAIN_ID, source_id, LOG_LEVEL_INF);
+
+	uint32_t cyc = test_helpers_cycle_get();
+
+	for (int i = 0; i < FILTERED_REPEAT; i++) {
+		LOG_DBG("filtered out %d", i);
+	}
+
+	cyc = test_helpers_cycle_get() - cyc;
+
+	PRINT("Runtime filtered out debug message: %u cycles per %d messages\n",
+	      cyc, FILTERED_REPEAT);
+
+	log_filter_set(NULL, Z_LOG_LOCAL_DOMAIN_ID, source_id, LOG_LEVEL_DBG);
+}
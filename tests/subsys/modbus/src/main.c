@@ -47,6 +47,8 @@ ZTEST(modbus, test_setup_high_even)
 
 ZTEST(modbus, test_setup_ascii)
 {
+	Z_TEST_SKIP_IFNDEF(CONFIG_MODBUS_ASCII_MODE);
+
 	test_server_setup_ascii();
 	test_client_setup_ascii();
 	test_coil_wr_rd();
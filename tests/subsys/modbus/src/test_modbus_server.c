@@ -153,6 +153,32 @@ static int holding_reg_wr_fp(uint16_t addr, float reg)
 	return 0;
 }
 
+static int holding_regs_rd(uint16_t addr, uint16_t *regs, uint16_t num_regs)
+{
+	if (addr + num_regs > ARRAY_SIZE(holding_reg)) {
+		return -ENOTSUP;
+	}
+
+	memcpy(regs, &holding_reg[addr], num_regs * sizeof(uint16_t));
+
+	LOG_DBG("Holding registers read, addr %u, %u regs", addr, num_regs);
+
+	return 0;
+}
+
+static int holding_regs_wr(uint16_t addr, const uint16_t *regs, uint16_t num_regs)
+{
+	if (addr + num_regs > ARRAY_SIZE(holding_reg)) {
+		return -ENOTSUP;
+	}
+
+	memcpy(&holding_reg[addr], regs, num_regs * sizeof(uint16_t));
+
+	LOG_DBG("Holding registers write, addr %u, %u regs", addr, num_regs);
+
+	return 0;
+}
+
 static struct modbus_user_callbacks mbs_cbs = {
 	/** Coil read/write callback */
 	.coil_rd = coil_rd,
@@ -272,6 +298,10 @@ void test_server_setup_raw(void)
 	server_iface = modbus_iface_get_by_name(iface_name);
 	server_param.mode = MODBUS_MODE_RAW;
 	server_param.rawcb.raw_tx_cb = server_raw_cb;
+	/* Access the integer registers by range */
+	mbs_cbs.input_regs_rd = holding_regs_rd;
+	mbs_cbs.holding_regs_rd = holding_regs_rd;
+	mbs_cbs.holding_regs_wr = holding_regs_wr;
 
 	if (IS_ENABLED(CONFIG_MODBUS_SERVER)) {
 		err = modbus_init_server(server_iface, server_param);
@@ -285,6 +315,10 @@ void test_server_disable(void)
 {
 	int err;
 
+	mbs_cbs.input_regs_rd = NULL;
+	mbs_cbs.holding_regs_rd = NULL;
+	mbs_cbs.holding_regs_wr = NULL;
+
 	if (IS_ENABLED(CONFIG_MODBUS_SERVER)) {
 		err = modbus_disable(server_iface);
 		zassert_equal(err, 0, "Failed to disable RTU server");
@@ -408,6 +408,35 @@ ZTEST(modem_cmux, test_modem_cmux_receive_dlci2_ppp)
 		     "Incorrect data received");
 }
 
+ZTEST(modem_cmux, test_modem_cmux_receive_dlci2_ppp_split)
+{
+	const size_t split = sizeof(cmux_frame_dlci2_ppp_52) / 2;
+	int ret;
+
+	/* Frame received in two parts, followed by a whole one */
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci2_ppp_52, split);
+	k_msleep(10);
+	modem_backend_mock_put(&bus_mock, &cmux_frame_dlci2_ppp_52[split],
+			       sizeof(cmux_frame_dlci2_ppp_52) - split);
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci2_ppp_18, sizeof(cmux_frame_dlci2_ppp_18));
+
+	k_msleep(100);
+
+	ret = modem_pipe_receive(dlci2_pipe, buffer2, sizeof(buffer2));
+	zassert_true(ret == (sizeof(cmux_frame_data_dlci2_ppp_52) +
+			     sizeof(cmux_frame_data_dlci2_ppp_18)),
+		     "Incorrect number of bytes received");
+
+	zassert_true(memcmp(buffer2, cmux_frame_data_dlci2_ppp_52,
+			    sizeof(cmux_frame_data_dlci2_ppp_52)) == 0,
+		     "Incorrect data received");
+
+	zassert_true(memcmp(&buffer2[sizeof(cmux_frame_data_dlci2_ppp_52)],
+			    cmux_frame_data_dlci2_ppp_18,
+			    sizeof(cmux_frame_data_dlci2_ppp_18)) == 0,
+		     "Incorrect data received");
+}
+
 ZTEST(modem_cmux, test_modem_cmux_transmit_dlci2_ppp)
 {
 	int ret;
@@ -793,6 +793,36 @@ ZTEST(openthread_radio, test_receive_test)
 	platformRadioProcess(ot);
 }
 
+/**
+ * @brief Test received fragmented frames handling.
+ * Tests if frames split over several buffers are gathered before being
+ * passed to the OpenThread
+ *
+ */
+ZTEST(openthread_radio, test_receive_fragmented_test)
+{
+	struct net_pkt *packet;
+	uint8_t expected[40];
+	const uint8_t channel = 21;
+
+	alloc_pkt(&packet, 2, 'a');
+	packet->buffer->len = sizeof(expected) / 2;
+	packet->buffer->frags->len = sizeof(expected) / 2;
+	net_buf_linearize(expected, sizeof(expected), packet->buffer, 0, sizeof(expected));
+
+	set_channel_mock_fake.return_val = 0;
+	zassert_equal(otPlatRadioReceive(ot, channel), OT_ERROR_NONE, "Failed to receive.");
+
+	notify_new_rx_frame(packet);
+
+	make_sure_sem_set(Z_TIMEOUT_MS(100));
+	otPlatRadioReceiveDone_expected_error = OT_ERROR_NONE;
+	otPlatRadioReceiveDone_expected_aframe.mChannel = channel;
+	otPlatRadioReceiveDone_expected_aframe.mLength = sizeof(expected);
+	otPlatRadioReceiveDone_expected_aframe.mPsdu = expected;
+	platformRadioProcess(ot);
+}
+
 /**
  * @brief Test received messages handling.
  * Tests if received frames are properly passed to the OpenThread
@@ -297,6 +297,81 @@ ZTEST(device_runtime_api, test_pm_device_runtime_auto)
 	zassert_equal(pm_device_runtime_put(dev), 0, "");
 }
 
+#ifdef CONFIG_PM_DEVICE_RUNTIME_ASYNC_BATCH
+/**
+ * @brief Test that asynchronous suspends due close together are batched.
+ */
+ZTEST(device_runtime_api, test_async_batch)
+{
+	const struct device *const dev = DEVICE_DT_GET(DT_NODELABEL(test_dev));
+	enum pm_device_state state;
+	int ret;
+
+	ret = pm_device_runtime_get(test_dev);
+	zassert_equal(ret, 0);
+	ret = pm_device_runtime_get(dev);
+	zassert_equal(ret, 0);
+
+	/* second suspend is due within the slack of the first one */
+	ret = pm_device_runtime_put_async(test_dev, K_MSEC(50));
+	zassert_equal(ret, 0);
+	ret = pm_device_runtime_put_async(dev,
+			K_MSEC(50 + CONFIG_PM_DEVICE_RUNTIME_ASYNC_BATCH_SLACK_MS));
+	zassert_equal(ret, 0);
+
+	k_sleep(K_MSEC(40));
+
+	(void)pm_device_state_get(test_dev, &state);
+	zassert_equal(state, PM_DEVICE_STATE_SUSPENDING);
+	(void)pm_device_state_get(dev, &state);
+	zassert_equal(state, PM_DEVICE_STATE_SUSPENDING);
+
+	k_sleep(K_MSEC(15));
+
+	/* both suspended by the first pass */
+	(void)pm_device_state_get(test_dev, &state);
+	zassert_equal(state, PM_DEVICE_STATE_SUSPENDED);
+	(void)pm_device_state_get(dev, &state);
+	zassert_equal(state, PM_DEVICE_STATE_SUSPENDED);
+
+	/* a get before the pass cancels the pending suspend */
+	ret = pm_device_runtime_get(dev);
+	zassert_equal(ret, 0);
+	ret = pm_device_runtime_put_async(dev, K_MSEC(10));
+	zassert_equal(ret, 0);
+	ret = pm_device_runtime_get(dev);
+	zassert_equal(ret, 0);
+
+	k_sleep(K_MSEC(20));
+
+	(void)pm_device_state_get(dev, &state);
+	zassert_equal(state, PM_DEVICE_STATE_ACTIVE);
+	zassert_equal(pm_device_runtime_put(dev), 0);
+}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC_BATCH */
+
+#ifdef CONFIG_PM_DEVICE_RUNTIME_RESUME_LATENCY
+ZTEST(device_runtime_api, test_resume_latency)
+{
+	uint32_t last, max;
+	int ret;
+
+	ret = pm_device_runtime_get(test_dev);
+	zassert_equal(ret, 0);
+
+	ret = pm_device_runtime_resume_latency_get(test_dev, &last, &max);
+	zassert_equal(ret, 0);
+	zassert_true(last <= max);
+
+	ret = pm_device_runtime_put(test_dev);
+	zassert_equal(ret, 0);
+
+	ret = pm_device_runtime_resume_latency_get(DEVICE_GET(pm_unsupported_device), &last,
+						   &max);
+	zassert_equal(ret, -ENOTSUP);
+}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_RESUME_LATENCY */
+
 void *device_runtime_api_setup(void)
 {
 	test_dev = device_get_binding("test_driver");
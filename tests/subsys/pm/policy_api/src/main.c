@@ -23,7 +23,7 @@ void pm_state_exit_post_ops(enum pm_state state, uint8_t substate_id)
 	irq_unlock(0);
 }
 
-#ifdef CONFIG_PM_POLICY_DEFAULT
+#if defined(CONFIG_PM_POLICY_DEFAULT) || defined(CONFIG_PM_POLICY_PREDICTIVE)
 /**
  * @brief Test the behavior of pm_policy_next_state() when
  * CONFIG_PM_POLICY_DEFAULT=y.
@@ -273,7 +273,60 @@ ZTEST(policy_api, test_pm_policy_next_state_default_latency)
 {
 	ztest_test_skip();
 }
-#endif /* CONFIG_PM_POLICY_DEFAULT */
+#endif /* CONFIG_PM_POLICY_DEFAULT || CONFIG_PM_POLICY_PREDICTIVE */
+
+#ifdef CONFIG_PM_POLICY_PREDICTIVE
+void pm_policy_idle_exit(uint8_t cpu, const struct pm_state_info *info, uint32_t idle_cyc);
+
+/**
+ * @brief Test that the predictive policy adapts to early wakeups when
+ * CONFIG_PM_POLICY_PREDICTIVE=y.
+ */
+ZTEST(policy_api, test_pm_policy_next_state_predictive)
+{
+	const struct pm_state_info *next;
+	int32_t ticks = k_us_to_ticks_floor32(2000000);
+
+	/* cpu 1, no history: deepest state fitting the timeout */
+	next = pm_policy_next_state(1U, ticks);
+	zassert_equal(next->state, PM_STATE_SUSPEND_TO_RAM);
+
+	/* wakeups 200 ms after entering idle, too early for suspend to ram */
+	for (int i = 0; i < 10; i++) {
+		next = pm_policy_next_state(0U, ticks);
+		zassert_not_null(next);
+		pm_policy_idle_exit(0U, next, k_us_to_cyc_ceil32(200000));
+	}
+
+	next = pm_policy_next_state(0U, ticks);
+	zassert_equal(next->state, PM_STATE_RUNTIME_IDLE);
+
+	/* timeouts reached again, the early wakeups are forgotten */
+	for (int i = 0; i < 20; i++) {
+		next = pm_policy_next_state(0U, ticks);
+		zassert_not_null(next);
+		pm_policy_idle_exit(0U, next, k_us_to_cyc_ceil32(2000000));
+	}
+
+	next = pm_policy_next_state(0U, ticks);
+	zassert_equal(next->state, PM_STATE_SUSPEND_TO_RAM);
+
+	/* cpu 1 history is independent */
+	next = pm_policy_next_state(1U, ticks);
+	zassert_equal(next->state, PM_STATE_SUSPEND_TO_RAM);
+
+	/* locks still apply, prediction or not */
+	pm_policy_state_lock_get(PM_STATE_SUSPEND_TO_RAM, PM_ALL_SUBSTATES);
+	next = pm_policy_next_state(0U, ticks);
+	zassert_equal(next->state, PM_STATE_RUNTIME_IDLE);
+	pm_policy_state_lock_put(PM_STATE_SUSPEND_TO_RAM, PM_ALL_SUBSTATES);
+}
+#else
+ZTEST(policy_api, test_pm_policy_next_state_predictive)
+{
+	ztest_test_skip();
+}
+#endif /* CONFIG_PM_POLICY_PREDICTIVE */
 
 #ifdef CONFIG_PM_POLICY_CUSTOM
 const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
@@ -304,7 +357,7 @@ ZTEST(policy_api, test_pm_policy_next_state_custom)
 }
 #endif /* CONFIG_PM_POLICY_CUSTOM */
 
-#ifdef CONFIG_PM_POLICY_DEFAULT
+#if defined(CONFIG_PM_POLICY_DEFAULT) || defined(CONFIG_PM_POLICY_PREDICTIVE)
 /* note: we can't easily mock k_cycle_get_32(), so test is not ideal */
 ZTEST(policy_api, test_pm_policy_events)
 {
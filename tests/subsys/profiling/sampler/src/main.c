@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/profiling/sampler.h>
+
+#define SAMPLE_FREQ 1000
+#define BUSY_MS 200
+
+struct sample_stats {
+	const struct k_thread *thread;
+	uint32_t total;
+	uint32_t entries;
+};
+
+static void count_sample(const struct profiling_sample *sample, unsigned int cpu,
+			 void *user_data)
+{
+	struct sample_stats *stats = user_data;
+
+	ARG_UNUSED(cpu);
+
+	stats->entries++;
+	if (sample->thread == stats->thread) {
+		stats->total += sample->count;
+	}
+}
+
+ZTEST(profiling_sampler, test_sampler)
+{
+	struct sample_stats stats = {
+		.thread = k_current_get(),
+	};
+
+	zassert_equal(profiling_sampler_start(0), -EINVAL);
+	zassert_ok(profiling_sampler_start(SAMPLE_FREQ));
+	zassert_equal(profiling_sampler_start(SAMPLE_FREQ), -EALREADY);
+
+	k_busy_wait(BUSY_MS * USEC_PER_MSEC);
+	profiling_sampler_stop();
+
+	zassert_equal(profiling_sampler_foreach(count_sample, &stats), 0);
+	zassert_true(stats.total > 0, "no samples for the busy thread");
+
+	profiling_sampler_reset();
+	stats.total = 0;
+	stats.entries = 0;
+	profiling_sampler_foreach(count_sample, &stats);
+	zassert_equal(stats.entries, 0);
+}
+
+ZTEST_SUITE(profiling_sampler, NULL, NULL, NULL, NULL, NULL);
@@ -274,6 +274,38 @@ ZTEST_USER(rtio_api, test_rtio_syscalls)
 	}
 }
 
+K_SEM_DEFINE(batch_sem, 0, SQE_POOL_SIZE);
+
+ZTEST_USER(rtio_api, test_rtio_copy_in_submit)
+{
+	int res;
+	struct rtio_sqe sqes[SQE_POOL_SIZE];
+	struct rtio_cqe cqe = {0};
+
+	struct rtio *r = &r_syscall;
+
+	k_sem_reset(&batch_sem);
+
+	rtio_sqe_prep_nop(&sqes[0], &iodev_test_syscall, &syscall_bufs[0]);
+	rtio_sqe_prep_nop(&sqes[1], &iodev_test_syscall, &syscall_bufs[1]);
+	rtio_sqe_prep_sem_give(&sqes[2], &batch_sem, &syscall_bufs[2]);
+	rtio_sqe_prep_sem_give(&sqes[3], &batch_sem, &syscall_bufs[3]);
+
+	TC_PRINT("copying in and submitting a batch\n");
+	res = rtio_sqe_copy_in_submit(r, sqes, ARRAY_SIZE(sqes), ARRAY_SIZE(sqes));
+	zassert_ok(res, "Expected success submitting the batch");
+
+	for (int i = 0; i < ARRAY_SIZE(sqes); i++) {
+		res = rtio_cqe_copy_out(r, &cqe, 1, K_FOREVER);
+		zassert_equal(res, 1, "Expected success copying cqe");
+		zassert_ok(cqe.result, "Result should be ok");
+		zassert_equal_ptr(cqe.userdata, &syscall_bufs[i],
+				  "Expected in order completions");
+	}
+
+	zassert_equal(k_sem_count_get(&batch_sem), 2, "Expected the semaphore given twice");
+}
+
 RTIO_BMEM uint8_t mempool_data[MEM_BLK_SIZE];
 
 static void test_rtio_simple_mempool_(struct rtio *r, int run_count)
@@ -732,6 +764,62 @@ ZTEST(rtio_api, test_rtio_callback_chaining)
 	test_rtio_callback_chaining_(&r_callback_chaining);
 }
 
+#ifdef CONFIG_RTIO_CONSUME_SEM_COALESCE
+RTIO_DEFINE(r_coalesce, SQE_POOL_SIZE, CQE_POOL_SIZE);
+RTIO_IODEV_TEST_DEFINE(iodev_test_coalesce);
+
+/**
+ * @brief Test coalesced completion signals
+ *
+ * Ensures that a consumer blocked in rtio_cqe_consume_block() is woken up
+ * once all the completions of a batch are there, or once the notification
+ * timeout has elapsed, and gets every completion in order.
+ */
+ZTEST(rtio_api, test_rtio_consume_coalesce)
+{
+	uint32_t userdata[SQE_POOL_SIZE] = {0, 1, 2, 3};
+	struct rtio *r = &r_coalesce;
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+
+	rtio_iodev_test_init(&iodev_test_coalesce);
+
+	TC_PRINT("signal once per %d completions\n", SQE_POOL_SIZE);
+	rtio_cqe_notify_set(r, SQE_POOL_SIZE, 0);
+	for (int i = 0; i < SQE_POOL_SIZE; i++) {
+		sqe = rtio_sqe_acquire(r);
+		zassert_not_null(sqe, "Expected a valid sqe");
+		rtio_sqe_prep_nop(sqe, (struct rtio_iodev *)&iodev_test_coalesce, &userdata[i]);
+		sqe->flags |= RTIO_SQE_CHAINED;
+	}
+	sqe->flags &= ~RTIO_SQE_CHAINED;
+	zassert_ok(rtio_submit(r, 0));
+
+	for (int i = 0; i < SQE_POOL_SIZE; i++) {
+		cqe = rtio_cqe_consume_block(r);
+		zassert_ok(cqe->result, "Result should be ok");
+		zassert_equal_ptr(cqe->userdata, &userdata[i], "Expected in order completions");
+		rtio_cqe_release(r, cqe);
+	}
+
+	TC_PRINT("signal a lone completion after a timeout\n");
+	rtio_cqe_notify_set(r, SQE_POOL_SIZE, 1000);
+	rtio_cqe_poll_set(r, 10);
+	sqe = rtio_sqe_acquire(r);
+	zassert_not_null(sqe, "Expected a valid sqe");
+	rtio_sqe_prep_nop(sqe, (struct rtio_iodev *)&iodev_test_coalesce, &userdata[0]);
+	zassert_ok(rtio_submit(r, 0));
+
+	cqe = rtio_cqe_consume_block(r);
+	zassert_ok(cqe->result, "Result should be ok");
+	zassert_equal_ptr(cqe->userdata, &userdata[0], "Expected userdata back");
+	rtio_cqe_release(r, cqe);
+
+	rtio_cqe_notify_set(r, 1, 0);
+	rtio_cqe_poll_set(r, 0);
+}
+#endif /* CONFIG_RTIO_CONSUME_SEM_COALESCE */
+
 static void *rtio_api_setup(void)
 {
 #ifdef CONFIG_USERSPACE
@@ -765,6 +853,7 @@ static void rtio_api_before(void *a)
 	rtio_access_grant(&r_syscall, k_current_get());
 	k_object_access_grant(&iodev_test_simple, k_current_get());
 	k_object_access_grant(&iodev_test_syscall, k_current_get());
+	k_object_access_grant(&batch_sem, k_current_get());
 #endif
 }
 
@@ -23,4 +23,100 @@ ZTEST(settings_functional, test_setting_storage_get)
 
 	zassert_true(nvs_rc >= 0, "Can't read nvs record (err=%d).", rc);
 }
+#define NAME_TEST_KEYS 12
+
+static int name_test_cb(const char *key, size_t len, settings_read_cb read_cb,
+			void *cb_arg, void *param)
+{
+	uint8_t *val = param;
+
+	zassert_equal(len, sizeof(*val), "Unexpected length %d", len);
+	zassert_equal(read_cb(cb_arg, val, sizeof(*val)), sizeof(*val));
+
+	return 0;
+}
+
+ZTEST(settings_functional, test_setting_names)
+{
+	char name[SETTINGS_MAX_NAME_LEN];
+	uint8_t val;
+	int rc;
+
+	for (uint8_t i = 0; i < NAME_TEST_KEYS; i++) {
+		snprintk(name, sizeof(name), "nvs_names/k%u", i);
+		rc = settings_save_one(name, &i, sizeof(i));
+		zassert_equal(0, rc, "Can't save %s (err=%d)", name, rc);
+	}
+
+	/* Updates and deletes must find the existing names */
+	for (uint8_t i = 0; i < NAME_TEST_KEYS; i++) {
+		snprintk(name, sizeof(name), "nvs_names/k%u", i);
+		if (i % 3) {
+			val = i + 100;
+			rc = settings_save_one(name, &val, sizeof(val));
+		} else {
+			rc = settings_delete(name);
+		}
+		zassert_equal(0, rc, "Can't update %s (err=%d)", name, rc);
+	}
+
+	for (uint8_t i = 0; i < NAME_TEST_KEYS; i++) {
+		snprintk(name, sizeof(name), "nvs_names/k%u", i);
+		val = 0;
+		rc = settings_load_subtree_direct(name, name_test_cb, &val);
+		zassert_equal(0, rc, "Can't load %s (err=%d)", name, rc);
+		zassert_equal(val, (i % 3) ? i + 100 : 0, "Bad value for %s", name);
+	}
+
+	for (uint8_t i = 0; i < NAME_TEST_KEYS; i++) {
+		snprintk(name, sizeof(name), "nvs_names/k%u", i);
+		settings_delete(name);
+	}
+}
+
+#ifdef CONFIG_SETTINGS_TXN
+ZTEST(settings_functional, test_setting_txn)
+{
+	uint8_t val;
+	int rc;
+
+	rc = settings_txn_begin();
+	zassert_equal(0, rc, "Can't begin transaction (err=%d)", rc);
+	zassert_equal(-EALREADY, settings_txn_begin());
+
+	for (val = 1; val <= 3; val++) {
+		zassert_equal(0, settings_save_one("nvs_txn/a", &val, sizeof(val)));
+	}
+	zassert_equal(0, settings_save_one("nvs_txn/b", &val, sizeof(val)));
+	zassert_equal(0, settings_delete("nvs_txn/b"));
+
+	/* Nothing is stored before the commit */
+	val = 0;
+	zassert_equal(0, settings_load_subtree_direct("nvs_txn/a", name_test_cb, &val));
+	zassert_equal(0, val, "Value stored before the commit");
+
+	rc = settings_txn_commit();
+	zassert_equal(0, rc, "Can't commit transaction (err=%d)", rc);
+	zassert_equal(-EINVAL, settings_txn_commit());
+
+	zassert_equal(0, settings_load_subtree_direct("nvs_txn/a", name_test_cb, &val));
+	zassert_equal(3, val, "Last value of the transaction not stored");
+	val = 0;
+	zassert_equal(0, settings_load_subtree_direct("nvs_txn/b", name_test_cb, &val));
+	zassert_equal(0, val, "Deleted value stored");
+
+	/* An aborted transaction leaves the storage untouched */
+	zassert_equal(0, settings_txn_begin());
+	val = 10;
+	zassert_equal(0, settings_save_one("nvs_txn/a", &val, sizeof(val)));
+	zassert_equal(0, settings_txn_abort());
+	zassert_equal(-EINVAL, settings_txn_abort());
+
+	zassert_equal(0, settings_load_subtree_direct("nvs_txn/a", name_test_cb, &val));
+	zassert_equal(3, val, "Aborted value stored");
+
+	zassert_equal(0, settings_delete("nvs_txn/a"));
+}
+#endif
+
 ZTEST_SUITE(settings_functional, NULL, NULL, NULL, NULL, NULL);
@@ -233,6 +233,12 @@ int settings_deregister(struct settings_handler *handler)
 {
 	extern sys_slist_t settings_handlers;
 
+#if defined(CONFIG_SETTINGS_LOOKUP_CACHE)
+	extern void settings_lookup_cache_invalidate(void);
+
+	settings_lookup_cache_invalidate();
+#endif
+
 	return sys_slist_find_and_remove(&settings_handlers, &handler->node);
 }
 
@@ -356,6 +362,62 @@ ZTEST(settings_functional, test_register_and_loading)
 	zassert_true(rc, "deregistering val3_settings failed");
 }
 
+#if defined(CONFIG_SETTINGS_RUNTIME)
+static int lookup_get(const char *key, char *val, int val_len_max)
+{
+	val[0] = 1;
+	return 1;
+}
+
+static int lookup_sub_get(const char *key, char *val, int val_len_max)
+{
+	val[0] = 2;
+	return 1;
+}
+
+static struct settings_handler lookup_settings = {
+	.name = "lk",
+	.h_get = lookup_get,
+};
+
+static struct settings_handler lookup_sub_settings = {
+	.name = "lk/sub",
+	.h_get = lookup_sub_get,
+};
+
+ZTEST(settings_functional, test_runtime_lookup)
+{
+	char val;
+	int rc;
+
+	rc = settings_register(&lookup_settings);
+	zassert_equal(rc, 0, "register of lookup settings failed");
+
+	/* Repeated lookups of a key resolve the same handler */
+	for (int i = 0; i < 2; i++) {
+		rc = settings_runtime_get("lk/sub/val", &val, sizeof(val));
+		zassert_equal(rc, 1);
+		zassert_equal(val, 1, "wrong handler called");
+	}
+
+	/* A more specific handler takes over the key once registered */
+	rc = settings_register(&lookup_sub_settings);
+	zassert_equal(rc, 0, "register of lookup sub settings failed");
+
+	rc = settings_runtime_get("lk/sub/val", &val, sizeof(val));
+	zassert_equal(rc, 1);
+	zassert_equal(val, 2, "wrong handler called");
+
+	settings_deregister(&lookup_sub_settings);
+
+	rc = settings_runtime_get("lk/sub/val", &val, sizeof(val));
+	zassert_equal(rc, 1);
+	zassert_equal(val, 1, "wrong handler called");
+
+	settings_deregister(&lookup_settings);
+}
+#endif /* CONFIG_SETTINGS_RUNTIME */
+
 int val123_set(const char *key, size_t len,
 	       settings_read_cb read_cb, void *cb_arg)
 {
@@ -460,6 +460,19 @@ ZTEST(sh, test_cmd_dict)
 	test_shell_execute_cmd("dict2 two", 4);
 }
 
+ZTEST(sh, test_root_cmd_lookup)
+{
+	/* Commands sharing a prefix with existing ones */
+	test_shell_execute_cmd("dict one", -ENOEXEC);
+	test_shell_execute_cmd("dict12 one", -ENOEXEC);
+	test_shell_execute_cmd("dict3 one", -ENOEXEC);
+	test_shell_execute_cmd("dict2 one", 2);
+
+	zassert_equal(shell_set_root_cmd("dict"), -EINVAL);
+	zassert_equal(shell_set_root_cmd("dict1"), 0);
+	zassert_equal(shell_set_root_cmd(NULL), 0);
+}
+
 SHELL_SUBCMD_SET_CREATE(sub_section_cmd, (section_cmd));
 
 static int cmd1_handler(const struct shell *sh, size_t argc, char **argv)
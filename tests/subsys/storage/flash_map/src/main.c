@@ -252,6 +252,37 @@ ZTEST(flash_map, test_flash_area_erased_val)
 	flash_area_close(fa);
 }
 
+ZTEST(flash_map, test_flash_area_mmap)
+{
+#ifdef CONFIG_FLASH_MAP_XIP
+	const struct flash_area *fa;
+	const void *addr;
+	uint8_t buf[64];
+	int rc;
+
+	rc = flash_area_open(SLOT1_PARTITION_ID, &fa);
+	zassert_true(rc == 0, "flash_area_open() fail");
+
+	rc = flash_area_mmap(fa, 0, fa->fa_size + 1, &addr);
+	zassert_equal(rc, -EINVAL, "Out of range mapping did not fail");
+
+	rc = flash_area_mmap(fa, fa->fa_size - sizeof(buf), sizeof(buf), &addr);
+	if (rc == -ENOTSUP) {
+		flash_area_close(fa);
+		ztest_test_skip();
+	}
+	zassert_true(rc == 0, "flash_area_mmap() fail");
+
+	rc = flash_area_read(fa, fa->fa_size - sizeof(buf), buf, sizeof(buf));
+	zassert_true(rc == 0, "flash_area_read() fail");
+	zassert_mem_equal(addr, buf, sizeof(buf), "Content read in place differs");
+
+	flash_area_close(fa);
+#else
+	ztest_test_skip();
+#endif
+}
+
 ZTEST(flash_map, test_fixed_partition_node_macros)
 {
 	/* Test against changes in API */
@@ -478,6 +478,54 @@ ZTEST(lib_stream_flash, test_stream_flash_buffered_write_whole_page)
 }
 #endif
 
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+static uint8_t async_buf[BUF_LEN];
+
+ZTEST(lib_stream_flash, test_stream_flash_async)
+{
+	int rc;
+	int num_pages = MAX_NUM_PAGES - 1;
+
+	init_target();
+
+	zassert_equal(stream_flash_async_enable(&ctx, async_buf, BUF_LEN - 1),
+		      -EINVAL, "expected failure");
+	rc = stream_flash_async_enable(&ctx, async_buf, BUF_LEN);
+	zassert_equal(rc, 0, "expected success");
+
+	/* The first full buffer is being written when the call returns */
+	rc = stream_flash_buffered_write(&ctx, write_buf, BUF_LEN + 128, false);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(stream_flash_bytes_written(&ctx), 0,
+		      "buffer being written should not be counted");
+
+	rc = stream_flash_buffered_write(&ctx, write_buf,
+					 (page_size * num_pages) - BUF_LEN, false);
+	zassert_equal(rc, 0, "expected success");
+
+	rc = stream_flash_buffered_write(&ctx, write_buf, 0, true);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(stream_flash_bytes_written(&ctx),
+		      (page_size * num_pages) + 128, "all data should be written");
+
+	VERIFY_WRITTEN(0, (page_size * num_pages) + 128);
+
+	/* Space still being written counts against the available size */
+	rc = stream_flash_init(&ctx, fdev, generic_buf, BUF_LEN, FLASH_BASE,
+			       BUF_LEN * 2, stream_flash_callback);
+	zassert_equal(rc, 0, "expected success");
+	rc = stream_flash_async_enable(&ctx, async_buf, BUF_LEN);
+	zassert_equal(rc, 0, "expected success");
+	rc = stream_flash_buffered_write(&ctx, write_buf, BUF_LEN, false);
+	zassert_equal(rc, 0, "expected success");
+	rc = stream_flash_buffered_write(&ctx, write_buf, BUF_LEN + 1, false);
+	zassert_equal(rc, -ENOMEM, "expected failure");
+	rc = stream_flash_buffered_write(&ctx, write_buf, BUF_LEN, true);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(stream_flash_bytes_written(&ctx), BUF_LEN * 2);
+}
+#endif /* CONFIG_STREAM_FLASH_ASYNC */
+
 static size_t write_and_save_progress(size_t bytes, const char *save_key)
 {
 	int rc;
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/zbus/zbus.h>
+#include <zephyr/ztest.h>
+
+#define SLOW_LISTENER_US 2000
+
+struct value_msg {
+	int value;
+};
+
+static K_SEM_DEFINE(slow_done, 0, 1);
+static k_tid_t fast_tid;
+static int fast_count;
+static int slow_count;
+static int last_value;
+
+static void fast_callback(const struct zbus_channel *chan)
+{
+	const struct value_msg *msg = zbus_chan_const_msg(chan);
+
+	fast_tid = k_current_get();
+	last_value = msg->value;
+	fast_count++;
+}
+
+static void slow_callback(const struct zbus_channel *chan)
+{
+	k_busy_wait(SLOW_LISTENER_US);
+	slow_count++;
+	k_sem_give(&slow_done);
+}
+
+ZBUS_LISTENER_DEFINE(fast_lis, fast_callback);
+ZBUS_LISTENER_DEFINE(slow_lis, slow_callback);
+ZBUS_LISTENER_DEFINE(orphan_lis, fast_callback);
+
+ZBUS_CHAN_DEFINE(value_chan,	   /* Name */
+		 struct value_msg, /* Message type */
+
+		 NULL,				      /* Validator */
+		 NULL,				      /* User data */
+		 ZBUS_OBSERVERS(fast_lis, slow_lis), /* observers */
+		 ZBUS_MSG_INIT(0)		      /* Initial value */
+);
+
+static void publish(int value)
+{
+	struct value_msg msg = {.value = value};
+
+	zassert_ok(zbus_chan_pub(&value_chan, &msg, K_MSEC(100)));
+}
+
+static void async_dispatch_before(void *f)
+{
+	ARG_UNUSED(f);
+
+	fast_count = 0;
+	slow_count = 0;
+	fast_tid = NULL;
+	k_sem_reset(&slow_done);
+	zassert_ok(zbus_chan_async_set(&value_chan, false));
+	zassert_ok(zbus_chan_obs_stats_reset(&value_chan));
+}
+
+ZTEST(async_dispatch, test_sync_stats)
+{
+	struct zbus_obs_stats stats;
+
+	publish(1);
+	zassert_equal(fast_count, 1);
+	zassert_equal(slow_count, 1);
+	zassert_equal(fast_tid, k_current_get(), "sync channel notified from another thread");
+
+	zassert_ok(zbus_chan_obs_stats_get(&value_chan, &slow_lis, &stats));
+	zassert_equal(stats.count, 1);
+	zassert_true(stats.max_cycles >= k_us_to_cyc_floor32(SLOW_LISTENER_US));
+	zassert_equal(stats.total_cycles, stats.max_cycles);
+
+	zassert_ok(zbus_chan_obs_stats_get(&value_chan, &fast_lis, &stats));
+	zassert_equal(stats.count, 1);
+	zassert_true(stats.max_cycles < k_us_to_cyc_floor32(SLOW_LISTENER_US));
+}
+
+ZTEST(async_dispatch, test_async_batching)
+{
+	struct zbus_obs_stats stats;
+
+	zassert_ok(zbus_chan_async_set(&value_chan, true));
+
+	/* The dispatch thread has a lower priority, all publications land in one dispatch */
+	k_sched_lock();
+	publish(1);
+	publish(2);
+	publish(3);
+	k_sched_unlock();
+
+	zassert_ok(k_sem_take(&slow_done, K_MSEC(100)));
+	zassert_equal(fast_count, 1);
+	zassert_equal(slow_count, 1);
+	zassert_equal(last_value, 3);
+	zassert_not_equal(fast_tid, k_current_get(), "async channel notified by the publisher");
+
+	zassert_ok(zbus_chan_obs_stats_get(&value_chan, &slow_lis, &stats));
+	zassert_equal(stats.count, 1);
+
+	/* A publication after the dispatch needs another one */
+	publish(4);
+	zassert_ok(k_sem_take(&slow_done, K_MSEC(100)));
+	zassert_equal(fast_count, 2);
+	zassert_equal(last_value, 4);
+}
+
+ZTEST(async_dispatch, test_async_publish_latency)
+{
+	zassert_ok(zbus_chan_async_set(&value_chan, true));
+
+	uint32_t start = k_cycle_get_32();
+
+	publish(5);
+
+	/* The slow listener does not delay the publisher */
+	zassert_true(k_cycle_get_32() - start < k_us_to_cyc_floor32(SLOW_LISTENER_US));
+	zassert_ok(k_sem_take(&slow_done, K_MSEC(100)));
+}
+
+ZTEST(async_dispatch, test_stats_unknown_observer)
+{
+	struct zbus_obs_stats stats;
+
+	zassert_equal(zbus_chan_obs_stats_get(&value_chan, &orphan_lis, &stats), -ESRCH);
+}
+
+ZTEST_SUITE(async_dispatch, NULL, NULL, async_dispatch_before, NULL, NULL);
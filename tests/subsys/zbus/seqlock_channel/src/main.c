@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/zbus/zbus.h>
+#include <zephyr/ztest.h>
+
+#define SAMPLE_WORDS 16
+
+struct sample_msg {
+	uint32_t seq[SAMPLE_WORDS];
+};
+
+static atomic_t notifications;
+
+static void sample_callback(const struct zbus_channel *chan)
+{
+	atomic_inc(&notifications);
+}
+
+ZBUS_LISTENER_DEFINE(sample_lis, sample_callback);
+
+ZBUS_CHAN_SEQLOCK_DEFINE(sample_chan,	  /* Name */
+			 struct sample_msg, /* Message type */
+
+			 NULL,			    /* Validator */
+			 NULL,			    /* User data */
+			 ZBUS_OBSERVERS(sample_lis), /* observers */
+			 ZBUS_MSG_INIT(0)	    /* Initial value */
+);
+
+static void publish(uint32_t value)
+{
+	struct sample_msg msg;
+
+	for (int i = 0; i < SAMPLE_WORDS; i++) {
+		msg.seq[i] = value;
+	}
+
+	zassert_ok(zbus_chan_pub(&sample_chan, &msg, K_NO_WAIT));
+}
+
+static bool consistent(const struct sample_msg *msg)
+{
+	for (int i = 1; i < SAMPLE_WORDS; i++) {
+		if (msg->seq[i] != msg->seq[0]) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+ZTEST(seqlock_channel, test_pub_read)
+{
+	struct sample_msg msg;
+	atomic_val_t before = atomic_get(&notifications);
+
+	publish(7);
+	zassert_equal(atomic_get(&notifications), before + 1, "listener not notified");
+
+	zassert_ok(zbus_chan_read(&sample_chan, &msg, K_NO_WAIT));
+	zassert_true(consistent(&msg));
+	zassert_equal(msg.seq[0], 7);
+}
+
+ZTEST(seqlock_channel, test_read_while_claimed)
+{
+	struct sample_msg msg;
+
+	publish(3);
+
+	/* Readers do not take the channel, so a claim does not hold them */
+	zassert_ok(zbus_chan_claim(&sample_chan, K_NO_WAIT));
+	zassert_ok(zbus_chan_read(&sample_chan, &msg, K_NO_WAIT));
+	zassert_ok(zbus_chan_finish(&sample_chan));
+	zassert_equal(msg.seq[0], 3);
+}
+
+static struct k_timer reader_timer;
+static atomic_t torn_reads;
+static atomic_t isr_reads;
+
+static void reader_fn(struct k_timer *timer)
+{
+	struct sample_msg msg;
+
+	/* A read preempting the publisher may give up, it must never return a torn message */
+	if (zbus_chan_read(&sample_chan, &msg, K_NO_WAIT) == 0) {
+		atomic_inc(&isr_reads);
+		if (!consistent(&msg)) {
+			atomic_inc(&torn_reads);
+		}
+	}
+}
+
+ZTEST(seqlock_channel, test_no_torn_reads)
+{
+	int64_t end = k_uptime_get() + 200;
+	uint32_t value = 0;
+
+	k_timer_init(&reader_timer, reader_fn, NULL);
+	k_timer_start(&reader_timer, K_MSEC(1), K_MSEC(1));
+
+	while (k_uptime_get() < end) {
+		publish(value++);
+	}
+
+	k_timer_stop(&reader_timer);
+
+	zassert_true(atomic_get(&isr_reads) > 0, "reads from the ISR never succeeded");
+	zassert_equal(atomic_get(&torn_reads), 0, "torn message read");
+}
+
+ZTEST_SUITE(seqlock_channel, NULL, NULL, NULL, NULL, NULL);